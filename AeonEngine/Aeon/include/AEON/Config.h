@@ -30,6 +30,30 @@
 	#define AEON_DEBUG 0
 #endif // _DEBUG
 
+// Define the minimum level of the logs that are compiled (0: Info, 1: Warning, 2: Error, 3: None), the logs below it are removed entirely
+#ifndef AEON_LOG_LEVEL
+	#define AEON_LOG_LEVEL 0
+#endif // AEON_LOG_LEVEL
+
+// Enable the hot reload of the assets modified on disk in Debug mode (it may be enabled or disabled explicitly)
+#ifndef AEON_HOT_RELOAD
+	#define AEON_HOT_RELOAD AEON_DEBUG
+#endif // AEON_HOT_RELOAD
+
+// Disable the tracking of the heap allocations per subsystem by default (it replaces the global new and delete operators once enabled)
+#ifndef AEON_MEMORY_TRACKING
+	#define AEON_MEMORY_TRACKING 0
+#endif // AEON_MEMORY_TRACKING
+
+// Enable the coroutine tasks if the compiler supports the C++20 coroutines (they may be disabled explicitly)
+#ifndef AEON_COROUTINES
+	#if defined(__cpp_impl_coroutine) && __cpp_impl_coroutine >= 201902L
+		#define AEON_COROUTINES 1
+	#else
+		#define AEON_COROUTINES 0
+	#endif // __cpp_impl_coroutine
+#endif // AEON_COROUTINES
+
 // Remove the console window in Release mode
 #ifndef _DEBUG
 	#ifndef AEON_INTERNAL_LIB
@@ -90,4 +114,32 @@
 	#pragma message("AEON_DEPRECATED isn't supported by your compiler")
 	#define AEON_DEPRECATED
 #endif // AEON_NO_DEPRECATED_WARNINGS
+
+// Select the SIMD instruction set used by the math module's 4-dimensional vectors and 4x4 matrices of floats
+#ifdef AEON_NO_SIMD
+	// The user explicitly requested the scalar implementations
+	#define AEON_SIMD 0
+
+#elif defined(__AVX__)
+	// AVX implies SSE, the 4-wide operations use SSE and the 8-wide ones use AVX
+	#define AEON_SIMD 1
+	#define AEON_SIMD_SSE
+	#define AEON_SIMD_AVX
+
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+	#define AEON_SIMD 1
+	#define AEON_SIMD_SSE
+
+#elif defined(__ARM_NEON) || defined(_M_ARM64)
+	#define AEON_SIMD 1
+	#define AEON_SIMD_NEON
+
+#else
+	// No supported instruction set, the scalar implementations are used
+	#define AEON_SIMD 0
+#endif // AEON_NO_SIMD
+
+// Concatenate two tokens after expanding them (used to create unique identifiers with __LINE__)
+#define AEON_CONCAT_IMPL(a, b) a##b
+#define AEON_CONCAT(a, b) AEON_CONCAT_IMPL(a, b)
 #endif // Aeon_Config_H_
\ No newline at end of file
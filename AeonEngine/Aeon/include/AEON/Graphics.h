@@ -29,6 +29,7 @@
 #include <AEON/Graphics/Camera2D.h>
 #include <AEON/Graphics/Camera3D.h>
 #include <AEON/Graphics/CameraFPS.h>
+#include <AEON/Graphics/CullingTree3D.h>
 #include <AEON/Graphics/Color.h>
 #include <AEON/Graphics/GLResourceFactory.h>
 #include <AEON/Graphics/Shader.h>
@@ -37,16 +38,28 @@
 #include <AEON/Graphics/Texture.h>
 #include <AEON/Graphics/Texture2D.h>
 #include <AEON/Graphics/Material.h>
+#include <AEON/Graphics/MaterialLibrary.h>
+#include <AEON/Graphics/Mesh.h>
+#include <AEON/Graphics/Renderer3D.h>
 #include <AEON/Graphics/Renderer2D.h>
 #include <AEON/Graphics/Font.h>
 #include <AEON/Graphics/RenderTexture.h>
+#include <AEON/Graphics/RenderGraph.h>
+#include <AEON/Graphics/PostProcessChain.h>
+#include <AEON/Graphics/LightRenderer2D.h>
+#include <AEON/Graphics/FrameCapture.h>
 #include <AEON/Graphics/RenderStates.h>
 #include <AEON/Graphics/TextureAtlas.h>
 #include <AEON/Graphics/Actor2D.h>
 #include <AEON/Graphics/Sprite.h>
+#include <AEON/Graphics/SpriteAnimation.h>
 #include <AEON/Graphics/EllipseShape.h>
 #include <AEON/Graphics/RectangleShape.h>
 #include <AEON/Graphics/Text.h>
+#include <AEON/Graphics/ParticleEmitter2D.h>
+#include <AEON/Graphics/TileMap.h>
+#include <AEON/Graphics/Prefab.h>
+#include <AEON/Graphics/TweenSystem.h>
 
 #endif // Aeon_Graphics_H_
 
@@ -23,7 +23,10 @@
 #ifndef Aeon_Graphics_Actor2D_H_
 #define Aeon_Graphics_Actor2D_H_
 
-#include <map>
+#include <vector>
+#include <memory>
+#include <string>
+#include <unordered_map>
 
 #include <AEON/System/Time.h>
 #include <AEON/Window/Event.h>
@@ -32,6 +35,10 @@
 
 namespace ae
 {
+	// Forward declaration(s)
+	class TransformHierarchy2D;
+	class RenderTarget;
+
 	/*!
 	 \brief Base class used in scene graph architecture.
 	 \details The majority of user-defined classes will derive from this class or one of its derivatives.
@@ -69,7 +76,7 @@ namespace ae
 		Actor2D();
 		/*!
 		 \brief Copy constructor.
-		 \note The \a copy's children won't be copied over.
+		 \note The \a copy's children won't be copied over, contrary to its name and tags.
 
 		 \param[in] copy The ae::Actor2D that will be copied
 
@@ -86,16 +93,16 @@ namespace ae
 		Actor2D(Actor2D&& rvalue) noexcept;
 		/*!
 		 \brief Virtual destructor.
-		 \details A virtual destructor is needed as this class will be inherited.
+		 \details A virtual destructor is needed as this class will be inherited. The ae::Actor2D is removed from its ae::TransformHierarchy2D (if any) and its tweens are cancelled.
 
 		 \since v0.6.0
 		*/
-		virtual ~Actor2D() = default;
+		virtual ~Actor2D();
 	public:
 		// Public operator(s)
 		/*!
 		 \brief Assignment operator.
-		 \note The caller's children won't be overwritten.
+		 \note The caller's children, name and tags won't be overwritten.
 
 		 \param[in] other The ae::Actor2D that will be copied
 
@@ -119,6 +126,7 @@ namespace ae
 		/*!
 		 \brief Attaches an ae::Actor2D child node to the caller ae::Actor2D.
 		 \details The caller ae::Actor2D's transform will also be applied to the child.
+		 \note Actors that are frequently spawned and despawned can derive from ae::PoolAllocated to recycle their memory through an ae::ObjectPool.
 
 		 \param[in] child An ae::Actor2D (or derivative) unique_ptr created before being moved
 
@@ -161,6 +169,152 @@ namespace ae
 		 \since v0.4.0
 		*/
 		std::unique_ptr<Actor2D> detachChild(const Actor2D& child);
+		/*!
+		 \brief Creates a deep copy of the ae::Actor2D and of its entire subtree.
+		 \details The nodes are copied through their copy constructors, so the clones reference the same textures and fonts as the prototype.
+		 The prototype's local-space vertices are handed over to be shared beforehand, so the clones only copy their geometry once it's modified.
+		 The nodes marked for removal aren't cloned, nor are the nodes of the derived classes that don't override cloneSelf() (an error is logged).
+		 \note The returned root has no parent, and the clones are allocated by their classes (the ones deriving from ae::PoolAllocated are taken from their pool).
+
+		 \return The clone of the subtree, nullptr if the caller couldn't be cloned
+
+		 \par Example:
+		 \code
+		 // Spawn a hundred copies of an enemy assembled once
+		 std::unique_ptr<ae::Actor2D> prototype = assembleEnemy();
+		 for (int i = 0; i < 100; ++i) {
+			std::unique_ptr<ae::Actor2D> enemy = prototype->clone();
+			enemy->setPosition(getSpawnPoint(i));
+			scene->attachChild(std::move(enemy));
+		 }
+		 \endcode
+
+		 \sa cloneSelf()
+
+		 \since v0.7.0
+		*/
+		_NODISCARD std::unique_ptr<Actor2D> clone();
+		/*!
+		 \brief Sets the ae::Actor2D's name, with which it can be retrieved through findByName().
+		 \details The named nodes are registered in a hash index owned by the root node of their tree, which is kept up to date as subtrees are attached, detached and removed.
+		 Several nodes of a tree may share the same name.
+		 \note The name isn't unique-checked, and an empty name removes the node from the index.
+
+		 \param[in] name The node's name, empty by default
+
+		 \par Example:
+		 \code
+		 auto player = std::make_unique<ae::Sprite>(playerTexture);
+		 player->setName("Player");
+		 scene->attachChild(std::move(player));
+
+		 ...
+
+		 ae::Actor2D* player = scene->findByName("Player");
+		 \endcode
+
+		 \sa getName(), findByName()
+
+		 \since v0.7.0
+		*/
+		void setName(const std::string& name);
+		/*!
+		 \brief Retrieves the ae::Actor2D's name.
+
+		 \return The node's name, empty if it wasn't named
+
+		 \sa setName()
+
+		 \since v0.7.0
+		*/
+		_NODISCARD const std::string& getName() const noexcept;
+		/*!
+		 \brief Adds a tag to the ae::Actor2D, with which it can be retrieved through findByTag() alongside the other nodes sharing it.
+		 \details The tagged nodes are registered in the hash index owned by the root node of their tree (see setName()).
+		 \note Nothing is done if the node already has the \a tag.
+
+		 \param[in] tag The tag to add, mustn't be empty
+
+		 \par Example:
+		 \code
+		 enemy->addTag("Enemy");
+		 enemy->addTag("Flying");
+		 \endcode
+
+		 \sa removeTag(), hasTag(), findByTag()
+
+		 \since v0.7.0
+		*/
+		void addTag(const std::string& tag);
+		/*!
+		 \brief Removes a tag from the ae::Actor2D.
+		 \note Nothing is done if the node doesn't have the \a tag.
+
+		 \param[in] tag The tag to remove
+
+		 \sa addTag(), hasTag()
+
+		 \since v0.7.0
+		*/
+		void removeTag(const std::string& tag);
+		/*!
+		 \brief Checks whether the ae::Actor2D has the \a tag provided.
+
+		 \param[in] tag The tag to check
+
+		 \return True if the node has the \a tag, false otherwise
+
+		 \sa addTag(), getTags()
+
+		 \since v0.7.0
+		*/
+		_NODISCARD bool hasTag(const std::string& tag) const noexcept;
+		/*!
+		 \brief Retrieves the ae::Actor2D's tags.
+
+		 \return The list of the node's tags, in their order of addition
+
+		 \sa addTag(), hasTag()
+
+		 \since v0.7.0
+		*/
+		_NODISCARD const std::vector<std::string>& getTags() const noexcept;
+		/*!
+		 \brief Retrieves a node of the ae::Actor2D's tree bearing the \a name provided.
+		 \details The whole tree is searched, not only the caller's subtree: the lookup is a single hash lookup in the root node's index once the root is reached.
+		 \note The lookups aren't synchronized with the structural changes made by other threads during a parallel update (see updateParallel()).
+
+		 \param[in] name The name of the node to retrieve
+
+		 \return A node named \a name, nullptr if none was found (if several share the name, any one of them is returned)
+
+		 \sa setName(), findByTag()
+
+		 \since v0.7.0
+		*/
+		_NODISCARD Actor2D* findByName(const std::string& name) const;
+		/*!
+		 \brief Retrieves the nodes of the ae::Actor2D's tree bearing the \a tag provided.
+		 \details The whole tree is searched through the root node's index, the cost of the lookup doesn't depend on the size of the tree.
+		 \note The list returned is invalidated once a node of the tree gains or loses the \a tag, or is attached, detached or removed.
+
+		 \param[in] tag The tag of the nodes to retrieve
+
+		 \return The list of the nodes tagged \a tag in no particular order, empty if none was found
+
+		 \par Example:
+		 \code
+		 // Slow down every enemy of the scene
+		 for (ae::Actor2D* const enemy : scene->findByTag("Enemy")) {
+			static_cast<Enemy*>(enemy)->slowDown();
+		 }
+		 \endcode
+
+		 \sa addTag(), findByName()
+
+		 \since v0.7.0
+		*/
+		_NODISCARD const std::vector<Actor2D*>& findByTag(const std::string& tag) const;
 		/*!
 		 \brief Relatively aligns the caller ae::Transformable2D to its parent based on the flags provided.
 		 \details Can be used to easily center text inside a rectangle, placing elements below/above/next to parent.
@@ -189,7 +343,9 @@ namespace ae
 		void setRelativeAlignment(uint32_t alignmentFlags, const Vector2f& padding = Vector2f(0.f));
 		/*!
 		 \brief Sends the event received to the current node and all of its children nodes for processing.
-		 \note The children handle the event before the caller.
+		 \details The node first receives the event in the capture phase (see captureEventSelf()), then its children, then the node once again in the bubble phase (see handleEventSelf()).
+		 The traversal is short-circuited as soon as the event's propagation is stopped, so the remaining nodes of the tree aren't visited.
+		 \note The children handle the event before the caller, except in the capture phase.
 
 		 \param[in] event The polled input event
 
@@ -200,15 +356,103 @@ namespace ae
 		void handleEvent(Event* const event);
 		/*!
 		 \brief Updates the current nodes and all of its children nodes.
+		 \details Sleeping nodes, which have no pending work, aren't updated and subtrees whose nodes are all sleeping aren't traversed.
 		 \note The caller is updated before its chilren.
 
 		 \param[in] dt The delta time between the current frame and the previous one
 
-		 \sa updateSelf(), updateChildren()
+		 \sa updateSelf(), updateChildren(), wake()
 
 		 \since v0.6.0
 		*/
 		void update(const Time& dt);
+		/*!
+		 \brief Marks the ae::Actor2D for removal so that its parent removes it during its next update.
+		 \details The parent counts the removals requested so that it only scans its children when there is at least one to remove.
+		 Sleeping nodes are only removed through this method as their removal condition isn't polled until they're woken up.
+
+		 \par Example:
+		 \code
+		 ae::Actor2D* bullet = ...;
+		 bullet->markForRemoval();
+		 \endcode
+
+		 \sa isMarkedForRemoval()
+
+		 \since v0.7.0
+		*/
+		void markForRemoval();
+		/*!
+		 \brief Updates the current node and its children by spreading the thread-safe children's subtrees across several threads.
+		 \details The awake children flagged as thread-safe are divided into contiguous groups, each updated by a job of the ae::JobSystem.
+		 The other children are updated afterwards by the calling thread, in the same fashion as update().
+		 Attaching a child to the caller or marking one of its children for removal from a worker thread is deferred until all of the threads have joined.
+		 \note The thread-safe children's subtrees must be independent of each other and must not restructure nodes outside of their own subtree.
+
+		 \param[in] dt The delta time between the current frame and the previous one
+		 \param[in] threadCount The maximum number of threads (including the calling one) to use, 0 to use all of the ae::JobSystem's threads
+
+		 \par Example:
+		 \code
+		 // Update the background and particle layers in parallel
+		 backgroundLayer->setThreadSafeUpdate(true);
+		 particleLayer->setThreadSafeUpdate(true);
+		 sceneRoot.updateParallel(dt);
+		 \endcode
+
+		 \sa update(), setThreadSafeUpdate()
+
+		 \since v0.7.0
+		*/
+		void updateParallel(const Time& dt, unsigned int threadCount = 0);
+		/*!
+		 \brief Flags the ae::Actor2D's origin and relative alignment for recomputation during the next layout pass.
+		 \details The parents that arrange their children are invalidated as well, and the ancestors are flagged so that the layout pass reaches the invalidated node.
+		 \note The derived classes of the engine call this method whenever their model bounds are modified.
+
+		 \sa updateLayout(), correctProperties()
+
+		 \since v0.7.0
+		*/
+		void invalidateLayout() noexcept;
+		/*!
+		 \brief Lays out the invalidated nodes of the ae::Actor2D's subtree.
+		 \details Only the invalidated nodes and the nodes that depend on them are laid out again: the children aligned relative to a node whose model bounds changed, and the containers arranging an invalidated child.
+		 Valid subtrees without any invalidated descendant aren't traversed.
+		 \note The root node (parentless) calls this method at the end of each update() and updateParallel() so the layout is resolved once per frame.
+
+		 \par Example:
+		 \code
+		 // Resolve the layout of a subtree right away (to retrieve its bounds before the next update)
+		 panel->invalidateLayout();
+		 panel->updateLayout();
+		 \endcode
+
+		 \sa invalidateLayout(), arrangeChildren()
+
+		 \since v0.7.0
+		*/
+		void updateLayout();
+		/*!
+		 \brief Sets whether the ae::Actor2D's subtree may be updated on a worker thread by its parent's updateParallel().
+
+		 \param[in] flag True if the subtree is independent of its siblings, false otherwise
+
+		 \sa isThreadSafeUpdate(), updateParallel()
+
+		 \since v0.7.0
+		*/
+		void setThreadSafeUpdate(bool flag) noexcept;
+		/*!
+		 \brief Checks whether the ae::Actor2D's subtree may be updated on a worker thread by its parent's updateParallel().
+
+		 \return True if the subtree may be updated on a worker thread, false otherwise
+
+		 \sa setThreadSafeUpdate()
+
+		 \since v0.7.0
+		*/
+		_NODISCARD bool isThreadSafeUpdate() const noexcept;
 		/*!
 		 \brief (De)Activates event handling, updating and/or rendering for the current node and/or its children.
 		 \details Several functionalities and targets may be selected simultaneously.
@@ -228,7 +472,88 @@ namespace ae
 		*/
 		void activateFunctionality(uint32_t func, uint32_t target, bool flag);
 		/*!
-		 \brief Calculates and retrieves the global transform by multiplying every parent's transform until the root node is reached.
+		 \brief Subscribes the ae::Actor2D to the events of the \a type provided through the ae::EventBus.
+		 \details The events of this type are then delivered to handleEventSelf() directly by the ae::EventBus instead of through the tree-order dispatch,
+		 so they don't need to be routed through the actor's ancestors. The subscription is released along with the actor.
+		 \note The events are only delivered if the actor's event handling is active. Subscribing is best suited to the notifications that most nodes ignore (window movements, resizes, etc.),
+		 the input that needs to be intercepted in the tree's order should remain dispatched through the tree.
+
+		 \param[in] type The ae::Event::Type of the events to receive
+
+		 \par Example:
+		 \code
+		 // Within the custom actor's constructor
+		 subscribeEvent(ae::Event::Type::FramebufferResized);
+		 \endcode
+
+		 \sa unsubscribeEvent()
+
+		 \since v0.7.0
+		*/
+		void subscribeEvent(Event::Type type);
+		/*!
+		 \brief Unsubscribes the ae::Actor2D from the events of the \a type provided, which are then delivered through the tree-order dispatch again.
+
+		 \param[in] type The ae::Event::Type of the events to stop receiving through the ae::EventBus
+
+		 \sa subscribeEvent()
+
+		 \since v0.7.0
+		*/
+		void unsubscribeEvent(Event::Type type);
+		/*!
+		 \brief Declares the layer in which the ae::Actor2D and its children (those that haven't declared their own layer) are rendered.
+		 \details Layers are only taken into account by the ae::BatchRenderer2D::Mode::Layered mode, wherein lower layers are rendered first
+		 and the actors of the same layer are rendered in the order of which they were submitted.
+
+		 \param[in] layer The layer in which the actor will be rendered
+
+		 \par Example:
+		 \code
+		 background->setLayer(0);
+		 player->setLayer(1); // The player's children are also rendered in layer 1
+		 hud->setLayer(10);
+		 \endcode
+
+		 \sa resetLayer(), getLayer()
+
+		 \since v0.7.0
+		*/
+		void setLayer(int layer) noexcept;
+		/*!
+		 \brief Removes the layer declared so that the ae::Actor2D inherits its parent's layer.
+
+		 \sa setLayer()
+
+		 \since v0.7.0
+		*/
+		void resetLayer() noexcept;
+		/*!
+		 \brief Retrieves the layer declared by the ae::Actor2D.
+
+		 \return The layer declared, 0 if the actor inherits its parent's layer
+
+		 \sa setLayer()
+
+		 \since v0.7.0
+		*/
+		_NODISCARD int getLayer() const noexcept;
+		/*!
+		 \brief Retrieves the ae::Actor2D's depth within its scene graph, the number of parents until the root node is reached.
+		 \details The depth is used as the Z position of the node's geometry so that the children are rendered above their parents. It's kept apart
+		 from the node's position so that reparenting a node doesn't invalidate any transform: the depths of the reparented subtrees are resolved lazily
+		 by the root node's next update or rendering, and only the nodes whose depth changed rebuild their geometry.
+
+		 \return The ae::Actor2D's depth, 0 for a root node
+
+		 \sa attachChild(), detachChild()
+
+		 \since v0.7.0
+		*/
+		_NODISCARD int getDepth() const noexcept;
+		/*!
+		 \brief Retrieves the global transform, the product of every parent's transform until the root node is reached.
+		 \details The global transform is cached and only recomputed after the transform of the ae::Actor2D or of one of its parents was modified.
 
 		 \return The ae::Actor2D's global transform
 
@@ -236,7 +561,18 @@ namespace ae
 
 		 \since v0.5.0
 		*/
-		_NODISCARD Matrix4f getGlobalTransform();
+		_NODISCARD const Matrix4f& getGlobalTransform();
+		/*!
+		 \brief Retrieves a stamp combining the transform versions of the ae::Actor2D and of every parent until the root node is reached.
+		 \details The stamp changes whenever the global transform changes, which is far cheaper to check than recomputing the global transform.
+
+		 \return The ae::Actor2D's global transform stamp
+
+		 \sa getGlobalTransform(), getTransformVersion()
+
+		 \since v0.7.0
+		*/
+		_NODISCARD uint64_t getGlobalTransformStamp();
 		/*!
 		 \brief Calculates and retrieves the global axis-aligned bounding box of the ae::Actor2D.
 
@@ -256,6 +592,91 @@ namespace ae
 		 \since v0.4.0
 		*/
 		_NODISCARD Vector2f getGlobalPosition();
+		/*!
+		 \brief Sets whether the ae::Actor2D may be culled when it's situated outside the view of the scene being rendered.
+		 \details Culling relies on the model bounds, ae::Actor2D derived classes that render geometry without declaring their model bounds should disable it.
+		 An ae::Actor2D that can't be culled prevents its parents from being culled as well but its children may still be culled.
+		 \note Actors are cullable by default.
+
+		 \param[in] flag True to allow the ae::Actor2D to be culled, false otherwise
+
+		 \par Example:
+		 \code
+		 auto customActor = std::make_unique<CustomActor>();
+		 customActor->setCullable(false);
+		 \endcode
+
+		 \sa isCullable(), getSubtreeBounds()
+
+		 \since v0.7.0
+		*/
+		void setCullable(bool flag) noexcept;
+		/*!
+		 \brief Checks whether the ae::Actor2D may be culled when it's situated outside the view of the scene being rendered.
+
+		 \return True if the ae::Actor2D may be culled, false otherwise
+
+		 \sa setCullable()
+
+		 \since v0.7.0
+		*/
+		_NODISCARD bool isCullable() const noexcept;
+		/*!
+		 \brief Retrieves the global axis-aligned bounding box enclosing the ae::Actor2D and all of its descendants.
+		 \details The bounds are cached and only recomputed when a node of the subtree is transformed, attached, detached or has its model bounds modified.
+		 An empty subtree is represented by an inverted box which doesn't intersect any other box.
+
+		 \return A std::pair containing whether the subtree may be culled and its global bounding box
+
+		 \sa getGlobalBounds(), setCullable()
+
+		 \since v0.7.0
+		*/
+		_NODISCARD const std::pair<bool, Box2f>& getSubtreeBounds();
+		/*!
+		 \brief Sets whether the ae::Actor2D's subtree is static, in which case its geometry is baked instead of being traversed every frame.
+		 \details The submissions of the ae::Actor2D and of its descendants are recorded once, transformed relative to the ae::Actor2D and merged per render states.
+		 The subtree is then submitted as a few large submissions, which the renderers keep cached until the subtree is invalidated.
+		 The ae::Actor2D itself may still be transformed freely without baking its subtree again.
+		 \note The custom drawcalls (ae::TileMap, ae::ParticleEmitter2D, etc.) can't be baked and are skipped, so such actors shouldn't be part of a static subtree.
+
+		 \param[in] flag True to bake the subtree, false to traverse it every frame (default)
+
+		 \par Example:
+		 \code
+		 // Bake the level's decoration which won't move once loaded
+		 decoration->setStatic(true);
+
+		 // Bake the decoration again once one of its props has been modified
+		 prop->setColor(ae::Color::Red);
+		 prop->invalidateStaticGeometry();
+		 \endcode
+
+		 \sa isStatic(), invalidateStaticGeometry()
+
+		 \since v0.7.0
+		*/
+		void setStatic(bool flag);
+		/*!
+		 \brief Checks whether the ae::Actor2D's subtree is static.
+
+		 \return True if the subtree's geometry is baked, false otherwise
+
+		 \sa setStatic()
+
+		 \since v0.7.0
+		*/
+		_NODISCARD bool isStatic() const noexcept;
+		/*!
+		 \brief Flags the baked geometry of the static ae::Actor2D nodes among the caller and its ancestors for recomputation.
+		 \details Must be called after modifying a descendant of a static node as the modifications aren't detected automatically.
+		 The attachment and detachment of children invalidate the baked geometry automatically.
+
+		 \sa setStatic()
+
+		 \since v0.7.0
+		*/
+		void invalidateStaticGeometry() noexcept;
 		_NODISCARD inline const Vector2f& getAlignmentPadding() const noexcept { return mAlignment.second.second; }
 
 		// Public virtual method(s)
@@ -266,7 +687,7 @@ namespace ae
 
 		 \return True if the ae::Actor2D will be removed, false otherwise
 
-		 \sa isDestroyed()
+		 \sa isDestroyed(), markForRemoval()
 
 		 \since v0.4.0
 		*/
@@ -284,13 +705,27 @@ namespace ae
 		*/
 		_NODISCARD virtual bool isDestroyed() const;
 		/*!
-		 \brief Recalculates the correct origin based on the origin flags, and realigns the actor relative to its parent.
+		 \brief Flags the correct origin based on the origin flags and the alignment relative to the parent for recomputation.
+		 \details The origin and alignment are resolved by the next layout pass instead of immediately, so several modifications within a frame only lay out the node once.
+
+		 \sa invalidateLayout(), updateLayout()
 
 		 \since v0.5.0
 		*/
 		virtual void correctProperties() override final;
+		/*!
+		 \brief Flags the cached global transforms of the ae::Actor2D and of its descendants for recomputation.
+
+		 \sa getGlobalTransform()
+
+		 \since v0.7.0
+		*/
+		virtual void onTransformModified() noexcept override;
 		/*!
 		 \brief Renders the current ae::Actor2D and its children.
+		 \details The \a states are shared by reference with the whole subtree: each node only pushes its parent's transform onto a preallocated
+		 stack and restores it once its subtree has been traversed. If the \a states' transform matches the parent's global transform (the
+		 identity for a root node), the nodes' cached global transforms are used instead of multiplying the transforms at every level.
 
 		 \param[in] states The ae::RenderStates associated (texture, transform, blend mode, shader)
 
@@ -299,6 +734,28 @@ namespace ae
 		 \since v0.5.0
 		*/
 		virtual void render(RenderStates states) override final;
+		/*!
+		 \brief Renders the current ae::Actor2D and its children by splitting the children's traversal across several threads.
+		 \details The children are divided into contiguous groups, each traversed by a job of the ae::JobSystem which records its submissions into an ae::RenderCommandList.
+		 The recorded lists are then submitted by the calling thread in the order of the groups, so the result is identical to the one of render().
+		 \note The renderSelf() methods of the traversed actors must not issue any OpenGL calls themselves, they may only submit their geometry.
+
+		 \param[in] states The ae::RenderStates associated (texture, transform, blend mode, shader)
+		 \param[in] threadCount The maximum number of threads (including the calling one) to use, 0 to use all of the ae::JobSystem's threads
+
+		 \par Example:
+		 \code
+		 // Traverse a large scene graph with up to 4 threads
+		 renderer.beginScene(camera, window);
+		 sceneRoot.renderParallel(ae::RenderStates(), 4);
+		 renderer.endScene();
+		 \endcode
+
+		 \sa render(), ae::RenderCommandList
+
+		 \since v0.7.0
+		*/
+		void renderParallel(RenderStates states, unsigned int threadCount = 0);
 		/*!
 		 \brief Retrieves the ae::Actor2D's model bounding box.
 		 \note Derived classes should override this method to set the appropriate bounding box.
@@ -313,14 +770,109 @@ namespace ae
 	protected:
 		// Protected method(s)
 		/*!
-		 \brief Updates the z-index ordering of the caller and its children to achieve correct depth ordering.
-		 \details The z-index provided will be assigned to the caller and its children will be assigned to a superior z-index.
+		 \brief Wakes the ae::Actor2D up so that it's updated during the next update traversal.
+		 \details Derived classes must call this method whenever they raise one of their pending work flags.
 
-		 \param[in] zIndex The depth index to assign to the caller
+		 \sa hasPendingUpdate()
 
-		 \since v0.5.0
+		 \since v0.7.0
+		*/
+		void wake() noexcept;
+		/*!
+		 \brief Checks whether the ae::Actor2D's layout was invalidated since the last layout pass.
+
+		 \return True if the ae::Actor2D will be laid out during the next layout pass, false otherwise
+
+		 \sa invalidateLayout()
+
+		 \since v0.7.0
+		*/
+		_NODISCARD bool isLayoutDirty() const noexcept;
+		/*!
+		 \brief Retrieves the ae::Actor2D's attached children, in their order of attachment.
+
+		 \return The list of the attached children nodes
+
+		 \sa attachChild(), arrangeChildren()
+
+		 \since v0.7.0
+		*/
+		_NODISCARD const std::vector<std::unique_ptr<Actor2D>>& getChildren() const noexcept;
+
+		// Protected virtual method(s)
+		/*!
+		 \brief Positions the ae::Actor2D's children during the layout pass.
+		 \details Called when the ae::Actor2D is laid out, after its invalidated children's origins were resolved and before its own origin and alignment are.
+		 \note Derived classes arranging their children must also override isLayoutDependentOnChildren(), does nothing by default.
+
+		 \sa isLayoutDependentOnChildren(), updateLayout()
+
+		 \since v0.7.0
+		*/
+		virtual void arrangeChildren();
+		/*!
+		 \brief Checks whether the ae::Actor2D's layout depends on its children's model bounds.
+		 \details The ae::Actor2D is invalidated alongside its children if this method returns true.
+
+		 \return True if the ae::Actor2D needs to be laid out whenever one of its children is, false by default
+
+		 \sa arrangeChildren(), invalidateLayout()
+
+		 \since v0.7.0
+		*/
+		_NODISCARD virtual bool isLayoutDependentOnChildren() const noexcept;
+		/*!
+		 \brief Checks whether the ae::Actor2D has pending work for its next update.
+		 \details The ae::Actor2D falls asleep once it's updated and this method returns false, until wake() is called.
+		 Derived classes that override updateSelf() with logic that runs every update must return true.
+		 \note Plain ae::Actor2D instances have no work of their own so they may always sleep, and derived classes never sleep by default.
+
+		 \return True if the ae::Actor2D needs to be updated, false if it may sleep
+
+		 \sa wake()
+
+		 \since v0.7.0
+		*/
+		_NODISCARD virtual bool hasPendingUpdate() const;
+		/*!
+		 \brief Called once the ae::Actor2D's depth was modified by the resolution of the reparented subtrees.
+		 \details Derived classes whose geometry contains the depth must rebuild it, does nothing by default.
+
+		 \sa getDepth()
+
+		 \since v0.7.0
+		*/
+		virtual void onDepthModified();
+		/*!
+		 \brief Flags the cached subtree bounds of the ae::Actor2D and of its parents for recomputation.
+		 \details Derived classes must call this method whenever their model bounds are modified.
+
+		 \sa getSubtreeBounds()
+
+		 \since v0.7.0
+		*/
+		void invalidateBounds() noexcept;
+	private:
+		// Private struct(s)
+		/*!
+		 \brief The internal struct representing a group of baked submissions sharing the same render states.
 		*/
-		void updateZOrdering(int zIndex);
+		struct StaticGroup
+		{
+			Vertex2DList              vertices;    //!< The merged vertices, relative to the static node
+			std::vector<unsigned int> indices;     //!< The merged indices
+			RenderStates              states;      //!< The render states shared by the submissions
+			bool                      translucent; //!< Whether one of the merged vertices is translucent
+		};
+		/*!
+		 \brief The internal struct representing the hash index of a tree's named and tagged nodes, owned by the tree's root node.
+		*/
+		struct LookupIndex
+		{
+			std::unordered_map<std::string, std::vector<Actor2D*>> names; //!< The nodes bearing each name
+			std::unordered_map<std::string, std::vector<Actor2D*>> tags;  //!< The nodes bearing each tag
+		};
+
 	private:
 		// Private method(s)
 		/*!
@@ -333,7 +885,36 @@ namespace ae
 		*/
 		void removeChildrenMarkedForRemoval();
 		/*!
-		 \brief Sends the polled input \a event to the ae::Actor2D's attached children nodes.
+		 \brief Flags the cached global transform of the ae::Actor2D and of its descendants for recomputation.
+		 \details The propagation stops at the nodes already flagged as their descendants are flagged as well.
+
+		 \sa getGlobalTransform()
+
+		 \since v0.7.0
+		*/
+		void invalidateGlobalTransform() noexcept;
+		/*!
+		 \brief Flags the ae::Actor2D's depth for recomputation, as well as its parents so that they traverse it during the next resolution.
+		 \details The parents' propagation stops at the first node already flagged.
+
+		 \sa updateDepth(), getDepth()
+
+		 \since v0.7.0
+		*/
+		void invalidateDepth() noexcept;
+		/*!
+		 \brief Resolves the depths of the flagged nodes of the subtree, the descendants of a node whose depth changed being assigned the next depths.
+
+		 \param[in] depth The depth of the ae::Actor2D, derived from its parent's
+		 \param[in] force Whether the depth must be assigned, as the parent's depth changed
+
+		 \sa invalidateDepth(), getDepth()
+
+		 \since v0.7.0
+		*/
+		void updateDepth(int depth, bool force);
+		/*!
+		 \brief Sends the polled input \a event to the ae::Actor2D's attached children nodes, until one of them stops its propagation.
 
 		 \param[in] event The polled input ae::Event
 
@@ -344,28 +925,200 @@ namespace ae
 		void handleEventChildren(Event* const event);
 		/*!
 		 \brief Sends the command to the ae::Actor2D's children to update themselves and their own children.
+		 \details The removal condition of the children which were updated is checked as well.
 		 
 		 \param[in] dt The time difference between the previous frame and the current frame
 
+		 \return True if at least one of the children's subtrees is still awake, false otherwise
+
 		 \sa updateSelf(), update()
 
 		 \since v0.5.0
 		*/
-		void updateChildren(const Time& dt);
+		bool updateChildren(const Time& dt);
 		/*!
 		 \brief Sends the command to the ae::Actor2D's children to render themselves and their own children.
 
-		 \param[in] states The ae::RenderStates defining the OpenGL state
+		 \param[in,out] states The ae::RenderStates defining the OpenGL state, they're restored once each child's subtree has been traversed
 
 		 \sa renderSelf(), render()
 
 		 \since v0.5.0
 		*/
-		void renderChildren(RenderStates states) const;
+		void renderChildren(RenderStates& states) const;
+		/*!
+		 \brief Renders the ae::Actor2D and its children with the render traversal's shared states.
+		 \details The node's transform and layer are applied to the \a states for the duration of its subtree's traversal.
+
+		 \param[in,out] states The ae::RenderStates shared by the traversal, they're restored before returning
+
+		 \sa render(), renderChildren()
+
+		 \since v0.7.0
+		*/
+		void renderNode(RenderStates& states);
+		/*!
+		 \brief Submits the baked geometry of the static subtree, baking it beforehand if it was invalidated.
+
+		 \param[in] states The ae::RenderStates defining the OpenGL state
+
+		 \sa setStatic(), bakeStaticGeometry()
+
+		 \since v0.7.0
+		*/
+		void renderStatic(const RenderStates& states);
+		/*!
+		 \brief Records the submissions of the ae::Actor2D and of its descendants and merges them into groups sharing the same render states.
+
+		 \param[in] states The ae::RenderStates defining the OpenGL state
+
+		 \sa renderStatic()
+
+		 \since v0.7.0
+		*/
+		void bakeStaticGeometry(const RenderStates& states);
+		/*!
+		 \brief Damages the regions of the render \a target modified by the ae::Actor2D since its last rendering.
+		 \details The region previously covered and the one now covered by the node's geometry are damaged if the geometry was modified or moved, as are the regions left by its hidden or removed descendants.
+
+		 \param[in] target The damage-tracked ae::RenderTarget of the scene being rendered
+		 \param[in] transform The transform with which the node's geometry is rendered
+
+		 \sa releaseDamage(), ae::RenderTarget::addDamage()
+
+		 \since v0.7.0
+		*/
+		void trackDamage(RenderTarget& target, const Matrix4f& transform);
+		/*!
+		 \brief Merges the regions covered by the ae::Actor2D and its descendants during their last rendering into the \a damage, and forgets them.
+		 \details Used when the subtree stops being rendered (culled, hidden or removed).
+
+		 \param[in,out] damage A std::pair containing whether a region was damaged and the union of the damaged regions
+
+		 \sa trackDamage()
+
+		 \since v0.7.0
+		*/
+		void releaseDamage(std::pair<bool, Box2f>& damage) noexcept;
+		/*!
+		 \brief Checks whether the ae::Actor2D and its descendants are situated outside the view of the scene being rendered.
+		 \details The culling is disabled for the rest of the traversal if the transform accumulated doesn't match the cached global transforms.
+
+		 \param[in,out] states The ae::RenderStates received by the ae::Actor2D
+
+		 \return True if the ae::Actor2D and its descendants may be skipped, false otherwise
+
+		 \since v0.7.0
+		*/
+		_NODISCARD bool isCulled(RenderStates& states);
+		/*!
+		 \brief Checks whether all of the functionalities selected are active for all of the targets selected.
+
+		 \param[in] func The ae::Actor2D::Func flags to check
+		 \param[in] target The ae::Actor2D::Target flags to check
+
+		 \return True if the functionalities are active, false otherwise
+
+		 \since v0.7.0
+		*/
+		_NODISCARD bool isFunctionalityActive(uint32_t func, uint32_t target) const noexcept;
+		/*!
+		 \brief Retrieves the root node of the ae::Actor2D's tree, the one owning the tree's lookup index.
+
+		 \return The root node, the caller if it has no parent
+
+		 \since v0.7.0
+		*/
+		_NODISCARD const Actor2D& getRootNode() const noexcept;
+		/*!
+		 \brief Registers the named and tagged nodes of the ae::Actor2D's subtree in its new root node's index once it's attached.
+		 \details The subtree's own index is merged if it has one, otherwise the subtree is traversed (skipping the branches without indexed nodes).
+
+		 \sa unindexSubtree()
+
+		 \since v0.7.0
+		*/
+		void indexSubtree();
+		/*!
+		 \brief Unregisters the named and tagged nodes of the ae::Actor2D's subtree from its root node's index before it's detached or removed.
+
+		 \param[in] keepIndex Whether the nodes are registered in a new index owned by the ae::Actor2D, as it's becoming a root node
+
+		 \sa indexSubtree()
+
+		 \since v0.7.0
+		*/
+		void unindexSubtree(bool keepIndex);
+		/*!
+		 \brief Adds the entries of the named and tagged nodes of the ae::Actor2D's subtree to the \a index, skipping the branches without indexed nodes.
+
+		 \param[in,out] index The ae::Actor2D::LookupIndex in which the nodes are registered
+
+		 \sa unregisterSubtree()
+
+		 \since v0.7.0
+		*/
+		void registerSubtree(LookupIndex& index) const;
+		/*!
+		 \brief Removes the entries of the named and tagged nodes of the ae::Actor2D's subtree from the \a index, skipping the branches without indexed nodes.
+
+		 \param[in,out] index The ae::Actor2D::LookupIndex from which the nodes are unregistered
+
+		 \sa registerSubtree()
+
+		 \since v0.7.0
+		*/
+		void unregisterSubtree(LookupIndex& index) const;
+		/*!
+		 \brief Updates the number of indexed nodes of the ae::Actor2D and of its parents after its name or tags were modified.
+
+		 \param[in] wasIndexed Whether the node was named or tagged before the modification
+
+		 \since v0.7.0
+		*/
+		void updateIndexedNodes(bool wasIndexed) noexcept;
+		/*!
+		 \brief Repoints the \a index's entries of the ae::Actor2D's name and tags from the \a previous node to the caller, after the caller took over its identity.
+
+		 \param[in,out] index The ae::Actor2D::LookupIndex containing the entries
+		 \param[in] previous The node from which the name and tags were moved
+
+		 \since v0.7.0
+		*/
+		void repointIndexEntries(LookupIndex& index, const Actor2D* previous) const noexcept;
+
+		// Private static method(s)
+		/*!
+		 \brief Computes the packed bitmask of the functionalities and targets selected.
+
+		 \param[in] func The ae::Actor2D::Func flags
+		 \param[in] target The ae::Actor2D::Target flags
+
+		 \return The bitmask as stored in the packed functionality field
+
+		 \since v0.7.0
+		*/
+		_NODISCARD static constexpr uint8_t getFuncMask(uint32_t func, uint32_t target) noexcept
+		{
+			return static_cast<uint8_t>(((target & Target::Self) ? func : 0u) | ((target & Target::Children) ? func << 3 : 0u));
+		}
 
 		// Private virtual method(s)
+		/*!
+		 \brief The ae::Actor2D intercepts the polled input event before its children receive it.
+		 \details The event's phase is ae::Event::Phase::Capture, stopping its propagation prevents the children and the rest of the tree from receiving it.
+		 Typically used by a modal container to block the input from reaching the actors beneath it. Nothing is done by default.
+
+		 \param[in] event The polled input ae::Event
+
+		 \sa handleEventSelf(), handleEvent()
+
+		 \since v0.7.0
+		*/
+		virtual void captureEventSelf(Event* const event);
 		/*!
 		 \brief The ae::Actor2D processes the polled input event.
+		 \details The event's phase is ae::Event::Phase::Bubble if the children received it beforehand, ae::Event::Phase::Target otherwise.
 		 \note The method's behaviour is defined by the derived class.
 
 		 \param[in] event The polled input ae::Event
@@ -388,7 +1141,8 @@ namespace ae
 		virtual void updateSelf(const Time& dt);
 		/*!
 		 \brief Renders the ae::Actor2D.
-		 \note The method's behaviour is defined by the derived class.
+		 \note The method's behaviour is defined by the derived class. The \a states are shared with the rest of the traversal, so a derived
+		 class modifying them should do so on its own copy.
 
 		 \param[in] states The ae::RenderStates defining the OpenGL state
 
@@ -396,17 +1150,66 @@ namespace ae
 
 		 \since v0.5.0
 		*/
-		virtual void renderSelf(RenderStates states) const;
+		virtual void renderSelf(const RenderStates& states) const;
+		/*!
+		 \brief Copies the ae::Actor2D without its children.
+		 \details Derived classes that may be cloned override this method to copy themselves through their copy constructor.
+		 \note The default implementation copies an ae::Actor2D, the clones of other types being discarded by clone().
+
+		 \return The copy of the node
+
+		 \sa clone()
+
+		 \since v0.7.0
+		*/
+		_NODISCARD virtual std::unique_ptr<Actor2D> cloneSelf() const;
 
 	protected:
 		// Protected member(s)
-		Actor2D*                                       mParent;          //!< The node's parent node
+		Actor2D*                                       mParent;                //!< The node's parent node
 	private:
 		// Private member(s)
-		Matrix4f                                       mGlobalTransform; //!< The cached global transform
-		std::vector<std::unique_ptr<Actor2D>>          mChildren;        //!< The list of attached children nodes
-		std::map<Func, std::map<Target, bool>>         mFuncs;           //!< The active functionalities
-		std::pair<bool, std::pair<uint32_t, Vector2f>> mAlignment;       //!< The relative alignment to the parent node
+		Matrix4f                                       mGlobalTransform;       //!< The cached global transform
+		std::vector<std::unique_ptr<Actor2D>>          mChildren;              //!< The list of attached children nodes
+		uint8_t                                        mFuncs;                 //!< The active functionalities packed per target (bits 0-2: self, bits 3-5: children)
+		std::pair<bool, std::pair<uint32_t, Vector2f>> mAlignment;             //!< The relative alignment to the parent node
+		std::pair<bool, int>                           mLayer;                 //!< Whether a layer was declared and the layer declared
+		int                                            mDepth;                 //!< The depth within the scene graph, used as the Z position of the geometry
+		std::pair<bool, Box2f>                         mSubtreeBounds;         //!< Whether the subtree may be culled and the cached global bounds of the subtree
+		Box2f                                          mLayoutBounds;          //!< The model bounds with which the node was last laid out
+		std::vector<StaticGroup>                       mStaticGroups;          //!< The baked geometry of the subtree if it's static
+		std::pair<bool, Box2f>                         mDamageBounds;          //!< Whether the node's geometry was rendered onto a damage-tracked target and the world-space bounds it covered
+		std::pair<bool, Box2f>                         mPendingDamage;         //!< Whether regions were left by the hidden or removed descendants and their union, damaged during the next rendering
+		Matrix4f                                       mDamageTransform;       //!< The transform with which the node's geometry was last rendered onto a damage-tracked target
+		bool                                           mDamageTracked;         //!< Whether the node or one of its descendants may cover regions of a damage-tracked target
+		bool                                           mUpdateGlobalTransform; //!< Whether the cached global transform needs to be recomputed
+		bool                                           mUpdateSubtreeBounds;   //!< Whether the cached subtree bounds need to be recomputed
+		bool                                           mUpdateLayout;          //!< Whether the node needs to be laid out
+		bool                                           mUpdateSubtreeLayout;   //!< Whether one of the node's descendants needs to be laid out
+		bool                                           mUpdateDepth;           //!< Whether the node's depth needs to be recomputed
+		bool                                           mUpdateSubtreeDepth;    //!< Whether one of the node's descendants' depth needs to be recomputed
+		bool                                           mCullable;              //!< Whether the node may be culled
+		bool                                           mStatic;                //!< Whether the subtree's geometry is baked
+		bool                                           mUpdateStaticGeometry;  //!< Whether the baked geometry needs to be recomputed
+		bool                                           mAwake;                 //!< Whether the node needs to be updated
+		bool                                           mSubtreeAwake;          //!< Whether the node or one of its descendants needs to be updated
+		bool                                           mMarkedForRemoval;      //!< Whether the node was explicitly marked for removal
+		size_t                                         mPendingRemovals;       //!< The number of children marked for removal
+		bool                                           mThreadSafeUpdate;      //!< Whether the subtree may be updated on a worker thread
+		std::vector<std::pair<Event::Type, size_t>>    mSubscriptions;         //!< The event types to which the node subscribed through the ae::EventBus and their subscription identifiers
+		uint32_t                                       mSubscribedTypes;       //!< The bitmask of the event types to which the node subscribed
+		TransformHierarchy2D*                          mHierarchy;             //!< The data-oriented transform hierarchy storing the node, if any
+		size_t                                         mHierarchyIndex;        //!< The node's index in the transform hierarchy
+		bool                                           mTweened;               //!< Whether the node was animated by the ae::TweenSystem
+		std::string                                    mName;                  //!< The node's name, empty if it wasn't named
+		std::vector<std::string>                       mTags;                  //!< The node's tags
+		size_t                                         mIndexedNodes;          //!< The number of named or tagged nodes in the node's subtree (including itself)
+		std::unique_ptr<LookupIndex>                   mIndex;                 //!< The hash index of the tree's named and tagged nodes, only owned by root nodes
+
+		// Friend class(es)
+		friend class TransformHierarchy2D;
+		friend class Prefab;
+		friend class TweenSystem;
 	};
 }
 #endif // Aeon_Graphics_Actor2D_H_
@@ -420,6 +1223,15 @@ namespace ae
  functionality for attaching/detaching children nodes, event handling, updating
  and drawing the caller node and its children.
 
+ Subtrees that don't move after being loaded may be flagged as static so that
+ their geometry is baked once and submitted as a few large submissions instead
+ of being traversed every frame.
+
+ Actors may be given a name and tags so that they can be retrieved without
+ walking the tree: the named and tagged nodes are registered in a hash index
+ owned by their tree's root node, which is updated as subtrees are attached,
+ detached and removed.
+
  \author Filippos Gleglakos
  \version v0.6.0
  \date 2021.06.03
@@ -125,7 +125,7 @@ namespace ae
 
 		 \since v0.6.0
 		*/
-		virtual void submit(const std::vector<Vertex2D>& vertices, const std::vector<unsigned int>& indices, const RenderStates& states) override final;
+		virtual void submit(const Vertex2DList& vertices, const std::vector<unsigned int>& indices, const RenderStates& states) override final;
 
 		// Public static method(s)
 		/*!
@@ -23,17 +23,29 @@
 #ifndef	Aeon_Graphics_BatchRenderer2D_H_
 #define Aeon_Graphics_BatchRenderer2D_H_
 
+#include <array>
+#include <cstdint>
 #include <map>
+#include <memory_resource>
+#include <utility>
 
 #include <AEON/Config.h>
 #include <AEON/Math/Matrix.h>
+#include <AEON/Graphics/BlendMode.h>
+#include <AEON/Graphics/RenderStates.h>
+#include <AEON/Graphics/internal/Buffer.h>
 #include <AEON/Graphics/internal/Renderer2D.h>
+#include <AEON/Graphics/internal/ArenaBuffer.h>
+#include <AEON/Graphics/internal/IndexBuffer.h>
+#include <AEON/Graphics/internal/RingBuffer.h>
+#include <AEON/Graphics/internal/VertexBuffer.h>
+#include <AEON/System/MemoryResource.h>
 
 namespace ae
 {
 	// Forward declaration(s)
-	struct BlendMode;
 	class Shader;
+	class Sampler;
 	class Texture;
 
 	/*!
@@ -41,34 +53,142 @@ namespace ae
 	*/
 	class AEON_API BatchRenderer2D : public Renderer2D
 	{
+	public:
+		// Public static member(s)
+		static constexpr uint32_t InvalidProxy = static_cast<uint32_t>(-1); //!< The handle of an unregistered retained proxy
+
+		// Public enum(s)
+		/*!
+		 \brief The batching strategies available to the ae::BatchRenderer2D.
+		*/
+		enum class Mode
+		{
+			Cached,  //!< The batches are cached between frames and only rebuilt when one of their submissions is modified (default)
+			SortKey, //!< The submissions are appended to a flat list which is radix-sorted and batched once per frame
+			Layered  //!< The submissions are appended to their layer's list and rendered layer by layer in submission order, without depth-testing
+		};
+		/*!
+		 \brief The vertex formats in which the batches may be uploaded.
+		*/
+		enum class VertexFormat
+		{
+			Standard, //!< The vertices are uploaded as they are (36 bytes) along with 32-bit indices (default)
+			Packed    //!< The colors and texture coordinates are packed into normalized 8-bit and 16-bit integers (20 bytes) along with 16-bit indices
+		};
+
 	private:
 		// Private struct(s)
+		/*!
+		 \brief The internal struct representing a vertex of the packed vertex format (20 bytes).
+		*/
+		struct PackedVertex2D {
+			Vector3f position; //!< The vertex's position
+			uint8_t  color[4]; //!< The vertex's RGBA color normalized to the range [0,255]
+			uint16_t uv[2];    //!< The vertex's texture coordinates normalized to the range [0,65535]
+		};
 		/*!
 		 \brief The internal struct used to cache each submission's metadata.
 		*/
 		struct SubmissionData {
-			Matrix4f                         transform;   //!< The transform that needs to be applied
-			const std::vector<Vertex2D>*     vertexList;  //!< The list of vertices
-			const std::vector<unsigned int>* indexList;   //!< The list of indices
-			bool                             resubmitted; //!< Whether the submission should remain cached
-			bool                             dirty;       //!< Whether the submission's render data have been modified
+			Matrix4f                         transform;    //!< The transform that needs to be applied
+			const Vertex2DList*              vertexList;   //!< The list of vertices
+			const std::vector<unsigned int>* indexList;    //!< The list of indices
+			unsigned int                     vertexOffset; //!< The position of the submission's first vertex within the batch
+			unsigned int                     vertexCount;  //!< The number of vertices laid out in the batch
+			unsigned int                     indexOffset;  //!< The position of the submission's first index within the batch
+			unsigned int                     indexCount;   //!< The number of indices laid out in the batch
+			size_t                           nextShared;   //!< The next submission of the same list of vertices (submitted by renderables sharing their geometry), SIZE_MAX if none
+			float                            depth;        //!< The depth of the submission's first vertex, copied when the geometry is submitted so that the sort doesn't read the list of vertices
+			bool                             resubmitted;    //!< Whether the submission should remain cached
+			bool                             dirty;          //!< Whether the submission's render data have been modified
+			bool                             transformDirty; //!< Whether the submission's transform has been modified
+			bool                             quads;          //!< Whether the submission's indices form a list of quads (0, 1, 2, 0, 2, 3, offset by 4 for each quad)
+			bool                             retained;       //!< Whether the submission belongs to a retained proxy, it then remains cached until the proxy is hidden or unregistered
 		};
 		/*!
 		 \brief The internal struct representing a batch.
 		*/
 		struct RenderData {
-			std::vector<Vertex2D>                                   vertices;    //!< The list of vertices of all submissions in the batch
-			std::vector<unsigned int>                               indices;     //!< The list of indices of all submissions in the batch
-			std::vector<SubmissionData>                             submissions; //!< The list of submissions in the batch
-			unsigned int                                            indexOffset; //!< The offset used to increment each individual submission's indices
-
-			std::map<const std::vector<Vertex2D>*, SubmissionData*> lookup;      //!< The hashmap of submissions and their corresponding metadata (used to check resubmissions faster)
+			std::vector<Vertex2D>                          vertices;    //!< The list of vertices of all submissions in the batch
+			std::vector<unsigned int>                      indices;     //!< The list of indices of all submissions in the batch
+			std::vector<SubmissionData>                    submissions; //!< The list of submissions in the batch
+			std::vector<float>                             drawIDs;     //!< The index of each vertex's submission (only used when the transforms are applied on the GPU)
+			size_t                                         placedCount; //!< The number of leading submissions whose geometry is laid out in the batch
+			const Shader*                                  fallbackShader; //!< The batch's original shader if its transforms are applied on the GPU (bound when the batch must be transformed on the CPU instead), nullptr if the batch is always transformed on the CPU
+			bool                                           quadList;    //!< Whether all submissions are lists of quads, the batch may then be drawn from the static quad list IBO
+			bool                                           unchanged;   //!< Whether the batch wasn't modified since the previous frame, it may then be kept resident in the GPU arenas
+			int                                            arenaVertexOffset; //!< The offset of the batch's vertices within the vertex arena
+			int                                            arenaVertexSize;   //!< The size of the batch's range within the vertex arena, 0 if the batch isn't resident
+			int                                            arenaIndexOffset;  //!< The offset of the batch's indices within the index arena
+			int                                            arenaIndexSize;    //!< The size of the batch's range within the index arena
+			size_t                                         retainedCount;     //!< The number of submissions belonging to retained proxies
+			bool                                           retainedModified;  //!< Whether a proxy's submission was modified, added or removed since the batch was last sorted
+
+			std::map<const Vertex2DList*, size_t>          lookup;      //!< The hashmap of submissions and their corresponding index (used to check resubmissions faster)
+			std::map<const Vertex2DList*, size_t>          sharedCursors; //!< The last submission matched this frame for each list of vertices submitted several times
+		};
+		/*!
+		 \brief The internal struct representing a retained proxy registered by a renderable.
+		*/
+		struct ProxyData {
+			RenderStates                     states;      //!< The render states last pushed for the proxy
+			const Vertex2DList*              vertexList;  //!< The proxy's list of vertices
+			const std::vector<unsigned int>* indexList;   //!< The proxy's list of indices
+			RenderData*                      batch;       //!< The batch containing the proxy's submission, nullptr if it isn't part of a batch
+			bool                             transparent; //!< Whether the proxy belongs to the transparent pass
+			bool                             visible;     //!< Whether the proxy is rendered
+			bool                             registered;  //!< Whether the proxy is in use, its slot is free otherwise
+		};
+		/*!
+		 \brief The internal struct representing a single submission in the ae::BatchRenderer2D::Mode::SortKey and ae::BatchRenderer2D::Mode::Layered modes.
+		*/
+		struct DrawCommand {
+			Matrix4f                         transform;  //!< The transform that needs to be applied
+			const Vertex2DList*              vertexList; //!< The list of vertices
+			const std::vector<unsigned int>* indexList;  //!< The list of indices
+			const Shader*                    shader;     //!< The shader used to render the submission
+			const Texture*                   texture;    //!< The texture used to render the submission
+			const Sampler*                   sampler;    //!< The sampler overriding the texture's parameters, nullptr if none is used
+			unsigned int                     blendMode;  //!< The index of the submission's blend mode
+			Vector4i                         clipRect;   //!< The region outside of which the submission is discarded, empty if it isn't clipped
+		};
+		/*!
+		 \brief The internal struct associating a draw command (or a cached submission) to its sort key.
+		 \details From the most significant bit: transparency (1 bit), shader (11 bits), blend mode (4 bits), texture (16 bits) and depth (32 bits).
+		 The cached submissions are only sorted by their depth, stored in the upper 32 bits.
+		*/
+		struct SortEntry {
+			uint64_t     key;     //!< The packed sort key
+			unsigned int command; //!< The index of the associated draw command or submission
+		};
+		/*!
+		 \brief The internal struct representing the states applied to the pending batch of draw commands.
+		*/
+		struct CommandStates {
+			const Shader*  shader;      //!< The shader bound
+			const Texture* texture;     //!< The texture bound
+			const Sampler* sampler;     //!< The sampler bound alongside the texture
+			unsigned int   blendMode;   //!< The index of the blend mode applied
+			Vector4i       clipRect;    //!< The scissor region applied, empty if the scissor test is disabled
+			bool           transparent; //!< Whether the commands belong to the transparent pass
+		};
+		/*!
+		 \brief The internal struct matching OpenGL's indexed indirect drawing command.
+		*/
+		struct IndirectCommand {
+			unsigned int count;         //!< The number of indices of the batch
+			unsigned int instanceCount; //!< The number of instances to draw (always 1)
+			unsigned int firstIndex;    //!< The position of the batch's first index within the index ring
+			int          baseVertex;    //!< The position of the batch's first vertex within the group
+			unsigned int baseInstance;  //!< The first instance to draw (always 0)
 		};
 	private:
 		// Private typedef(s)
-		using TexturePasses = std::map<const Texture*, RenderData>;
-		using BlendPasses = std::map<BlendMode, TexturePasses>;
-		using ShaderPasses = std::map<const Shader*, BlendPasses>;
+		using TextureKey = std::pair<const Texture*, const Sampler*>;
+		using TexturePasses = std::pmr::map<TextureKey, RenderData>;
+		using ClipPasses = std::pmr::map<std::array<int, 4>, TexturePasses>;
+		using BlendPasses = std::pmr::map<BlendMode, ClipPasses>;
+		using ShaderPasses = std::pmr::map<const Shader*, BlendPasses>;
 
 	public:
 		// Public constructor(s)
@@ -99,6 +219,258 @@ namespace ae
 		*/
 		BatchRenderer2D& operator=(BatchRenderer2D&&) = delete;
 	public:
+		// Public method(s)
+		/*!
+		 \brief Sets the batching strategy used by the ae::BatchRenderer2D.
+		 \details The ae::BatchRenderer2D::Mode::Cached mode is best suited for mostly-static scenes as unmodified batches aren't rebuilt.\n
+		 The ae::BatchRenderer2D::Mode::SortKey mode is best suited for scenes where most submissions are modified every frame, as each
+		 submission is only appended to a contiguous list which is radix-sorted once when the scene ends.\n
+		 The ae::BatchRenderer2D::Mode::Layered mode is best suited for pure-2D scenes ordered by layers (see ae::Actor2D::setLayer()), as
+		 each submission is appended to its layer's list and no sorting nor depth-testing is performed.
+		 \note The cached batches and the pending submissions are discarded when the mode is changed (the retained proxies are kept).
+
+		 \param[in] mode The new ae::BatchRenderer2D::Mode
+
+		 \par Example:
+		 \code
+		 ae::BatchRenderer2D::getInstance().setMode(ae::BatchRenderer2D::Mode::SortKey);
+		 \endcode
+
+		 \sa getMode()
+
+		 \since v0.7.0
+		*/
+		void setMode(Mode mode);
+		/*!
+		 \brief Retrieves the batching strategy used by the ae::BatchRenderer2D.
+
+		 \return The active ae::BatchRenderer2D::Mode
+
+		 \sa setMode()
+
+		 \since v0.7.0
+		*/
+		_NODISCARD Mode getMode() const noexcept;
+		/*!
+		 \brief Sets whether the submissions' transforms are applied on the GPU instead of the CPU.
+		 \details When enabled, each submission's transform is streamed into a shader storage buffer and indexed by a per-vertex draw ID,
+		 so moving a submission only updates its matrix instead of re-transforming all of its vertices.\n
+		 Only the submissions using Aeon's built-in shaders ("_AEON_Basic2D", "_AEON_Text2D" and "_AEON_TextSDF2D") are transformed on the GPU, the
+		 others are still transformed on the CPU.
+		 \note This only affects the ae::BatchRenderer2D::Mode::Cached mode, and the cached batches are discarded when this setting is changed.
+
+		 \param[in] enabled True to apply the transforms on the GPU, false to apply them on the CPU (default)
+
+		 \par Example:
+		 \code
+		 ae::BatchRenderer2D::getInstance().setGPUTransforms(true);
+		 \endcode
+
+		 \sa hasGPUTransforms()
+
+		 \since v0.7.0
+		*/
+		void setGPUTransforms(bool enabled);
+		/*!
+		 \brief Checks whether the submissions' transforms are applied on the GPU.
+
+		 \return True if the transforms are applied on the GPU, false otherwise
+
+		 \sa setGPUTransforms()
+
+		 \since v0.7.0
+		*/
+		_NODISCARD bool hasGPUTransforms() const noexcept;
+		/*!
+		 \brief Sets the memory resource from which the cached passes (the shader, blend, clip and texture passes) are allocated.
+		 \details The resource must outlive the ae::BatchRenderer2D or be replaced beforehand. The batches' own lists of geometry are still
+		 allocated from the global heap as they're exchanged with the renderer's scratch lists.
+		 \note The cached batches are discarded when the resource is replaced (the retained proxies are kept), so it's usually set once at startup.
+
+		 \param[in] resource The memory resource of the cached passes, nullptr to allocate them from the default resource
+
+		 \par Example:
+		 \code
+		 // Attribute the cached passes to the renderer's tag
+		 static ae::TrackedResource passResource(ae::MemoryTag::Renderer);
+		 ae::BatchRenderer2D::getInstance().setMemoryResource(&passResource);
+		 \endcode
+
+		 \since v0.7.0
+		*/
+		void setMemoryResource(std::pmr::memory_resource* resource);
+		/*!
+		 \brief Sets whether the batches using different textures are merged into a single drawcall.
+		 \details When enabled, the texture passes sharing a shader and a blend mode are bound to consecutive texture units (up to 16)
+		 and rendered by a single glMultiDrawElementsBaseVertex drawcall, each vertex carrying the index of its texture unit.\n
+		 Only the batches using the built-in "_AEON_Basic2D" shader are merged (the ones transformed on the GPU aren't).
+		 \note This only affects the ae::BatchRenderer2D::Mode::Cached mode.
+
+		 \param[in] enabled True to merge the batches across textures, false to render each texture's batch separately (default)
+
+		 \par Example:
+		 \code
+		 ae::BatchRenderer2D::getInstance().setMultiTextureBatching(true);
+		 \endcode
+
+		 \sa hasMultiTextureBatching()
+
+		 \since v0.7.0
+		*/
+		void setMultiTextureBatching(bool enabled) noexcept;
+		/*!
+		 \brief Checks whether the batches using different textures are merged into a single drawcall.
+
+		 \return True if the batches are merged across textures, false otherwise
+
+		 \sa setMultiTextureBatching()
+
+		 \since v0.7.0
+		*/
+		_NODISCARD bool hasMultiTextureBatching() const noexcept;
+		/*!
+		 \brief Sets whether the merged batches are submitted through an indirect draw buffer.
+		 \details When enabled, the drawing commands of the batches merged across textures are written into a persistently-mapped
+		 GL_DRAW_INDIRECT_BUFFER and submitted with a single glMultiDrawElementsIndirect drawcall, which lowers the driver's overhead
+		 for groups of many small batches.
+		 \note This only has an effect if the multi-texture batching is enabled.
+
+		 \param[in] enabled True to submit the merged batches indirectly, false otherwise (default)
+
+		 \par Example:
+		 \code
+		 ae::BatchRenderer2D& renderer = ae::BatchRenderer2D::getInstance();
+		 renderer.setMultiTextureBatching(true);
+		 renderer.setIndirectDrawing(true);
+		 \endcode
+
+		 \sa hasIndirectDrawing(), setMultiTextureBatching()
+
+		 \since v0.7.0
+		*/
+		void setIndirectDrawing(bool enabled) noexcept;
+		/*!
+		 \brief Checks whether the merged batches are submitted through an indirect draw buffer.
+
+		 \return True if the merged batches are submitted indirectly, false otherwise
+
+		 \sa setIndirectDrawing()
+
+		 \since v0.7.0
+		*/
+		_NODISCARD bool hasIndirectDrawing() const noexcept;
+		/*!
+		 \brief Sets the vertex format in which the batches are uploaded.
+		 \details The ae::BatchRenderer2D::VertexFormat::Packed format converts the colors to normalized 8-bit integers, the texture
+		 coordinates to normalized 16-bit integers and the indices to 16-bit integers while writing them into the ring buffers, which
+		 reduces the vertex bandwidth by 44%. The shaders receive the same attributes, so custom shaders don't need to be modified.
+		 \note The batches transformed on the GPU or merged across textures, and the batches containing texture coordinates outside of
+		 the range [0,1] (repeated textures), are always uploaded in the standard format.
+
+		 \param[in] format The new ae::BatchRenderer2D::VertexFormat
+
+		 \par Example:
+		 \code
+		 ae::BatchRenderer2D::getInstance().setVertexFormat(ae::BatchRenderer2D::VertexFormat::Packed);
+		 \endcode
+
+		 \sa getVertexFormat()
+
+		 \since v0.7.0
+		*/
+		void setVertexFormat(VertexFormat format) noexcept;
+		/*!
+		 \brief Retrieves the vertex format in which the batches are uploaded.
+
+		 \return The active ae::BatchRenderer2D::VertexFormat
+
+		 \sa setVertexFormat()
+
+		 \since v0.7.0
+		*/
+		_NODISCARD VertexFormat getVertexFormat() const noexcept;
+		/*!
+		 \brief Registers a retained proxy which keeps rendering the geometry provided every scene without it being resubmitted.
+		 \details The proxy's submission remains part of its cached batch, so an unmodified proxy costs nothing per frame: the batches
+		 solely made up of unmodified proxies are drawn as they are without inspecting their submissions. The modifications are pushed
+		 with updateProxy(), setProxyTransform() and setProxyVisible() only when they occur.\n
+		 In the ae::BatchRenderer2D::Mode::SortKey and ae::BatchRenderer2D::Mode::Layered modes, the visible proxies are recorded
+		 along with each scene's submissions instead.
+		 \note This method is automatically called by the retained ae::Renderable2D instances, see ae::Renderable2D::setRetained().\n
+		 The lists of vertices and indices must remain valid until the proxy is unregistered, and the proxies are rendered in every scene.
+
+		 \param[in] vertices The list of vertices to be rendered
+		 \param[in] indices The list of associated indices to be rendered
+		 \param[in] states The ae::RenderStates (texture, transform, blend mode, shader) to be applied to the geometry
+
+		 \return The stable handle of the proxy
+
+		 \par Example:
+		 \code
+		 ae::BatchRenderer2D& renderer = ae::BatchRenderer2D::getInstance();
+		 const uint32_t proxy = renderer.registerProxy(vertices, indices, states);
+		 ...
+		 // Only push the transform once the geometry is moved
+		 renderer.setProxyTransform(proxy, transform);
+		 ...
+		 renderer.unregisterProxy(proxy);
+		 \endcode
+
+		 \sa unregisterProxy(), updateProxy(), setProxyTransform(), setProxyVisible()
+
+		 \since v0.7.0
+		*/
+		_NODISCARD uint32_t registerProxy(const Vertex2DList& vertices, const std::vector<unsigned int>& indices, const RenderStates& states);
+		/*!
+		 \brief Unregisters a retained proxy, its geometry is no longer rendered and its handle may be reused.
+
+		 \param[in] proxy The handle of the proxy provided by registerProxy()
+
+		 \sa registerProxy()
+
+		 \since v0.7.0
+		*/
+		void unregisterProxy(uint32_t proxy);
+		/*!
+		 \brief Updates a retained proxy's geometry and render states.
+		 \details The proxy's geometry is only rewritten if the \a states are flagged as dirty, and the proxy is only moved to another
+		 batch if its shader, blend mode, clip region, texture or transparency were modified.
+
+		 \param[in] proxy The handle of the proxy provided by registerProxy()
+		 \param[in] vertices The list of vertices to be rendered
+		 \param[in] indices The list of associated indices to be rendered
+		 \param[in] states The ae::RenderStates to be applied to the geometry
+
+		 \sa registerProxy(), setProxyTransform()
+
+		 \since v0.7.0
+		*/
+		void updateProxy(uint32_t proxy, const Vertex2DList& vertices, const std::vector<unsigned int>& indices, const RenderStates& states);
+		/*!
+		 \brief Sets a retained proxy's transform.
+		 \details The proxy's batch is only updated if the \a transform differs from the previous one.
+
+		 \param[in] proxy The handle of the proxy provided by registerProxy()
+		 \param[in] transform The transform that will be applied to the proxy's vertices
+
+		 \sa registerProxy(), updateProxy()
+
+		 \since v0.7.0
+		*/
+		void setProxyTransform(uint32_t proxy, const Matrix4f& transform);
+		/*!
+		 \brief Sets whether a retained proxy is rendered.
+		 \details A hidden proxy is removed from its batch but remains registered, it's added back once it's made visible.
+
+		 \param[in] proxy The handle of the proxy provided by registerProxy()
+		 \param[in] visible True to render the proxy, false to hide it
+
+		 \sa registerProxy()
+
+		 \since v0.7.0
+		*/
+		void setProxyVisible(uint32_t proxy, bool visible);
+
 		// Public virtual method(s)
 		/*!
 		 \brief Indicates to the ae::BatchRenderer2D to batch together all submissions received and render them.
@@ -142,7 +514,7 @@ namespace ae
 
 		 \since v0.6.0
 		*/
-		virtual void submit(const std::vector<Vertex2D>& vertices, const std::vector<unsigned int>& indices, const RenderStates& states) override final;
+		virtual void submit(const Vertex2DList& vertices, const std::vector<unsigned int>& indices, const RenderStates& states) override final;
 
 		// Public static method(s)
 		/*!
@@ -178,9 +550,59 @@ namespace ae
 		 \since v0.6.0
 		*/
 		void flush(ShaderPasses& drawcalls, bool frontToBack);
+		/*!
+		 \brief Retrieves the batch corresponding to the \a states provided, creating its shader, blend, clip and texture passes if needed.
+
+		 \param[in] states The ae::RenderStates of a submission
+		 \param[in] transparent Whether the submission belongs to the transparent pass
+
+		 \return The batch in which the submission is cached
+
+		 \since v0.7.0
+		*/
+		_NODISCARD RenderData& getBatch(const RenderStates& states, bool transparent);
+		/*!
+		 \brief Adds a retained proxy's submission to its batch, reviving the submission if it hadn't yet been removed.
+
+		 \param[in,out] proxy The retained proxy that will be added
+
+		 \sa removeProxy()
+
+		 \since v0.7.0
+		*/
+		void insertProxy(ProxyData& proxy);
+		/*!
+		 \brief Removes a retained proxy's submission from its batch, the submission is compacted away when the batch is next sorted.
+
+		 \param[in,out] proxy The retained proxy that will be removed
+
+		 \sa insertProxy()
+
+		 \since v0.7.0
+		*/
+		void removeProxy(ProxyData& proxy);
+		/*!
+		 \brief Adds the visible retained proxies back into the batches after the cached batches were discarded.
+
+		 \since v0.7.0
+		*/
+		void restoreProxies();
+		/*!
+		 \brief Checks whether the \a proxy provided is a registered proxy's handle (ignored in Release mode).
+
+		 \param[in] proxy The handle to check
+
+		 \return True if the \a proxy is registered, false otherwise
+
+		 \since v0.7.0
+		*/
+		_NODISCARD bool isProxyRegistered(uint32_t proxy) const noexcept;
 		/*!
 		 \brief Sorts the submissions received based on their Z-index and the rendering order.
-		 \details The submissions will also be stored in a single vertex and index list to be drawn as a batch.
+		 \details The submissions will also be stored in a single vertex and index list to be drawn as a batch.\n
+		 Each submission keeps a stable range within the batch: the ones that weren't resubmitted are compacted away, the dirty ones
+		 are re-transformed in place and the new ones are appended. The batch is only entirely rebuilt if a submission's geometry was
+		 resized or if the submissions are no longer in the rendering order.
 
 		 \param[in] data The data containing the submissions to be batched together
 		 \param[in] frontToBack Whether to sort the renderables front-to-back or back-to-front
@@ -191,7 +613,8 @@ namespace ae
 		*/
 		void sortSubmissions(RenderData& data, bool frontToBack);
 		/*!
-		 \brief Deletes the renderables that weren't resubmitted and resets the remaining renderables' resubmission flags.
+		 \brief Resets the submissions' resubmission and dirty flags.
+		 \details The submissions that aren't resubmitted by the next frame will be removed when the batch is next sorted.
 
 		 \param[in] data The data containing the submissions
 
@@ -200,11 +623,254 @@ namespace ae
 		 \since v0.6.0
 		*/
 		void resetSubmissions(RenderData& data);
+		/*!
+		 \brief Removes the submissions that weren't resubmitted this frame.
+		 \details The geometry of the remaining submissions is moved over the space freed (and their indices are rebased) without being re-transformed.
+
+		 \param[in,out] data The batch containing the submissions
+
+		 \return True if at least one submission was removed, false otherwise
+
+		 \sa sortSubmissions()
+
+		 \since v0.7.0
+		*/
+		bool compactSubmissions(RenderData& data);
+		/*!
+		 \brief Rebuilds the lookup of the batch's submissions after their indices changed.
+		 \details The submissions sharing a list of vertices are chained in the order in which they're laid out, the lookup referencing the first one.
+
+		 \param[in,out] data The batch containing the submissions
+
+		 \sa compactSubmissions(), sortSubmissions()
+
+		 \since v0.7.0
+		*/
+		void linkSubmissions(RenderData& data);
+		/*!
+		 \brief Transforms a submission's vertices and offsets its indices into the submission's range within the batch.
+		 \note The batch's vertex and index lists must already be large enough to contain the submission's range.
+
+		 \param[in,out] data The batch containing the submission
+		 \param[in] submission The submission whose geometry will be written
+
+		 \since v0.7.0
+		*/
+		void writeGeometry(RenderData& data, const SubmissionData& submission) const;
+		/*!
+		 \brief Appends a submission's vertices and indices to a batch.
+		 \details The vertices are transformed by the \a transform provided and the indices are offset by the batch's previous vertex count.
+
+		 \param[in,out] data The batch in which the geometry will be added
+		 \param[in] transform The transform that will be applied to the vertices
+		 \param[in] vertices The submission's vertices
+		 \param[in] indices The submission's indices
+
+		 \since v0.7.0
+		*/
+		void appendGeometry(RenderData& data, const Matrix4f& transform, const Vertex2DList& vertices, const std::vector<unsigned int>& indices) const;
+		/*!
+		 \brief Records a submission in the flat list of draw commands.
+		 \details Only used in the ae::BatchRenderer2D::Mode::SortKey mode.
+
+		 \param[in] vertices The list of vertices to be rendered
+		 \param[in] indices The list of associated indices to be rendered
+		 \param[in] states The ae::RenderStates to be applied to the geometry
+
+		 \sa flushCommands()
+
+		 \since v0.7.0
+		*/
+		void submitCommand(const Vertex2DList& vertices, const std::vector<unsigned int>& indices, const RenderStates& states);
+		/*!
+		 \brief Sorts the draw commands recorded by their sort keys, and batches and renders consecutive commands sharing the same states.
+		 \details Only used in the ae::BatchRenderer2D::Mode::SortKey mode.
+
+		 \sa submitCommand()
+
+		 \since v0.7.0
+		*/
+		void flushCommands();
+		/*!
+		 \brief Records a submission at the end of its layer's list of draw commands.
+		 \details Only used in the ae::BatchRenderer2D::Mode::Layered mode.
+
+		 \param[in] vertices The list of vertices to be rendered
+		 \param[in] indices The list of associated indices to be rendered
+		 \param[in] states The ae::RenderStates to be applied to the geometry (including the layer)
+
+		 \sa flushLayers()
+
+		 \since v0.7.0
+		*/
+		void submitLayered(const Vertex2DList& vertices, const std::vector<unsigned int>& indices, const RenderStates& states);
+		/*!
+		 \brief Renders the layers' draw commands from the lowest layer to the highest, batching consecutive commands sharing the same states.
+		 \details Only used in the ae::BatchRenderer2D::Mode::Layered mode.
+
+		 \sa submitLayered()
+
+		 \since v0.7.0
+		*/
+		void flushLayers();
+		/*!
+		 \brief Retrieves the index of the \a blendMode provided within the list of distinct blend modes, adding it if it's the first occurrence.
+
+		 \param[in] blendMode The ae::BlendMode of a submission
+
+		 \return The index of the \a blendMode
+
+		 \since v0.7.0
+		*/
+		_NODISCARD unsigned int getBlendIndex(const BlendMode& blendMode);
+		/*!
+		 \brief Adds a draw command's geometry to the pending batch, rendering the batch beforehand if the command's states differ.
+
+		 \param[in] command The draw command to add
+		 \param[in] transparent Whether the command belongs to the transparent pass
+		 \param[in,out] active The states applied to the pending batch
+
+		 \sa renderCommandBatch()
+
+		 \since v0.7.0
+		*/
+		void batchCommand(const DrawCommand& command, bool transparent, CommandStates& active);
+		/*!
+		 \brief Renders the pending batch of draw commands and clears it.
+
+		 \sa batchCommand()
+
+		 \since v0.7.0
+		*/
+		void renderCommandBatch();
+		/*!
+		 \brief Sorts the sort entries provided in ascending order of their keys using a least-significant-digit radix sort.
+		 \details Byte positions for which all keys are equal are skipped, and the entries of equal keys keep their relative order.
+
+		 \param[in,out] entries The sort entries
+
+		 \since v0.7.0
+		*/
+		void radixSortEntries(std::vector<SortEntry>& entries);
+
+		/*!
+		 \brief Sorts a batch's submissions by their depth using a radix sort on their depth keys.
+		 \details Used instead of a comparison sort for the large batches. The submissions of equal depths keep their relative order.
+
+		 \param[in,out] data The batch whose submissions will be sorted
+		 \param[in] frontToBack Whether the submissions are sorted in descending order of depth
+
+		 \sa sortSubmissions(), radixSortEntries()
+
+		 \since v0.7.0
+		*/
+		void radixSortSubmissions(RenderData& data, bool frontToBack);
+		/*!
+		 \brief Uploads a batch's vertices and indices (and its transforms and draw IDs if applied on the GPU) and issues its drawcall.
+		 \details The batch is written directly into the persistently-mapped ring buffers. If the batch doesn't fit within the rings'
+		 current regions, the general-purpose VAO's data stores are reallocated instead (and the batch is transformed on the CPU).\n
+		 The indices of a batch only made up of quads aren't uploaded, the batch is drawn from the static quad list IBO instead.
+
+		 \param[in] data The batch that will be drawn
+
+		 \since v0.7.0
+		*/
+		void drawBatch(const RenderData& data);
+		/*!
+		 \brief Renders the pending group of texture passes with a single drawcall and clears the group.
+		 \details The batches' vertices, indices and texture slots are written contiguously into the rings and the textures are bound to
+		 consecutive texture units. The group's drawing commands are also written into the indirect ring if indirect drawing is enabled.\n
+		 If every batch of the group is only made up of quads, their indices aren't uploaded: each batch is drawn from the start of the
+		 static quad list IBO with its own base vertex.\n
+		 If the group doesn't fit within the rings' current regions, each texture pass is rendered separately.
+
+		 \since v0.7.0
+		*/
+		void flushTextureGroup();
+		/*!
+		 \brief Converts a batch into the packed vertex format while writing it into the packed rings, and issues its drawcall.
+
+		 \param[in] data The batch that will be drawn
+
+		 \return True if the batch was drawn, false if it couldn't be packed or if it doesn't fit within the packed rings' current regions
+
+		 \since v0.7.0
+		*/
+		_NODISCARD bool drawPackedBatch(const RenderData& data);
+		/*!
+		 \brief Draws an unchanged batch from its ranges within the GPU arenas, uploading it into them first if it isn't yet resident.
+		 \details Only the batches transformed on the CPU in the standard vertex format are kept resident. A batch is uploaded into the
+		 arenas the first frame it's unchanged and is then drawn with its base vertex without any upload until it's modified.
+
+		 \param[in,out] data The batch that will be drawn
+
+		 \return True if the batch was drawn, false if it was modified this frame, if it can't be kept resident or if the arenas lack the space
+
+		 \sa releaseResidency()
+
+		 \since v0.7.0
+		*/
+		_NODISCARD bool drawResidentBatch(RenderData& data);
+		/*!
+		 \brief Releases a batch's ranges within the GPU arenas, it will be streamed through the rings until it's once again unchanged.
+
+		 \param[in,out] data The batch whose ranges will be released
+
+		 \sa drawResidentBatch()
+
+		 \since v0.7.0
+		*/
+		void releaseResidency(RenderData& data);
 
 	private:
 		// Private member(s)
-		ShaderPasses mOpaqueCalls;      //!< The list of all drawcalls for opaque renderables
-		ShaderPasses mTransparentCalls; //!< The list of all drawcalls for transparent renderables
+		ForwardingResource           mPassResource;     //!< The resource forwarding the cached passes' allocations to the one supplied
+		ShaderPasses                 mOpaqueCalls;      //!< The list of all drawcalls for opaque renderables
+		ShaderPasses                 mTransparentCalls; //!< The list of all drawcalls for transparent renderables
+		std::shared_ptr<VertexArray> mStreamVAO;        //!< The VAO whose buffers are streamed through the ring buffers
+		RingBuffer                   mVertexRing;       //!< The persistently-mapped ring used to stream the batches' vertices
+		RingBuffer                   mIndexRing;        //!< The persistently-mapped ring used to stream the batches' indices
+		std::shared_ptr<VertexArray> mPackedStreamVAO;  //!< The VAO whose buffers are streamed through the packed ring buffers (packed vertex format)
+		RingBuffer                   mPackedVertexRing; //!< The persistently-mapped ring used to stream the batches' packed vertices (packed vertex format)
+		RingBuffer                   mPackedIndexRing;  //!< The persistently-mapped ring used to stream the batches' 16-bit indices (packed vertex format)
+		std::shared_ptr<IndexBuffer> mQuadListIBO;      //!< The engine-owned static IBO from which the batches of quads are drawn
+		size_t                       mQuadListCapacity; //!< The number of quads contained in the static quad list IBO
+		std::unique_ptr<VertexBuffer> mArenaVBO;        //!< The VBO attached to the streaming VAO in place of its ring to draw the resident batches
+		std::unique_ptr<IndexBuffer> mArenaIBO;         //!< The IBO attached to the streaming VAO in place of its ring to draw the resident batches
+		ArenaBuffer                  mVertexArena;      //!< The persistently-mapped arena in which the unchanged batches' vertices remain resident
+		ArenaBuffer                  mIndexArena;       //!< The persistently-mapped arena in which the unchanged batches' indices remain resident
+		RingBuffer                   mDrawIDRing;       //!< The persistently-mapped ring used to stream the batches' draw IDs (GPU transforms)
+		RingBuffer                   mModelRing;        //!< The persistently-mapped ring used to stream the batches' transforms (GPU transforms)
+		std::unique_ptr<Buffer>      mModelBuffer;      //!< The shader storage buffer containing the batches' transforms (GPU transforms)
+		std::map<const Shader*, const Shader*> mTransformShaders; //!< The built-in shaders and their counterparts that apply the transforms on the GPU
+		int                          mModelAlignment;   //!< The required alignment of the shader storage buffer's bound ranges
+		RingBuffer                   mTextureSlotRing;  //!< The persistently-mapped ring used to stream the vertices' texture slots (multi-texture batching)
+		std::vector<std::pair<TextureKey, const RenderData*>> mTextureGroup; //!< The pending texture passes merged into a single drawcall (multi-texture batching)
+		std::vector<int>             mGroupCounts;      //!< The index count of each batch within the pending group (multi-texture batching)
+		std::vector<const void*>     mGroupIndexOffsets; //!< The offset of each batch's indices within the pending group (multi-texture batching)
+		std::vector<int>             mGroupBaseVertices; //!< The base vertex of each batch within the pending group (multi-texture batching)
+		std::vector<unsigned int>    mGroupTextures;    //!< The handles of the textures bound for the pending group (multi-texture batching)
+		std::vector<unsigned int>    mGroupSamplers;    //!< The handles of the samplers bound alongside the pending group's textures, 0 for the textures sampled with their own parameters (multi-texture batching)
+		std::unique_ptr<Buffer>      mIndirectBuffer;   //!< The indirect draw buffer containing the groups' drawing commands (indirect drawing)
+		RingBuffer                   mIndirectRing;     //!< The persistently-mapped ring used to stream the groups' drawing commands (indirect drawing)
+		const Shader*                mBasicShader;      //!< The built-in shader whose batches may be merged across textures
+		const Shader*                mMultiTextureShader; //!< The shader sampling the texture indicated by each vertex's texture slot
+		size_t                       mTextureUnitCount; //!< The maximum number of textures within a group (multi-texture batching)
+		std::vector<DrawCommand>     mCommands;         //!< The draw commands recorded this frame (SortKey mode)
+		std::vector<SortEntry>       mSortEntries;      //!< The sort keys of the draw commands recorded this frame (SortKey mode)
+		std::vector<SortEntry>       mSortScratch;      //!< The scratch list used by the radix sort
+		std::vector<SortEntry>       mDepthEntries;     //!< The depth keys of the submissions of the batch being sorted (Cached mode)
+		std::vector<SubmissionData>  mSubmissionScratch; //!< The scratch list into which the sorted submissions are moved (Cached mode)
+		std::vector<BlendMode>       mBlendModes;       //!< The distinct blend modes encountered, their index is used in the sort keys (SortKey and Layered modes)
+		RenderData                   mCommandBatch;     //!< The batch reused to render consecutive draw commands (SortKey and Layered modes)
+		std::map<int, std::vector<DrawCommand>> mLayers; //!< The draw commands recorded this frame, per layer in submission order (Layered mode)
+		std::vector<ProxyData>       mProxies;          //!< The retained proxies, indexed by their handles
+		std::vector<uint32_t>        mFreeProxies;      //!< The handles of the unregistered proxies whose slots may be reused
+		Mode                         mMode;             //!< The active batching strategy
+		VertexFormat                 mVertexFormat;     //!< The vertex format in which the batches are uploaded
+		bool                         mGPUTransforms;    //!< Whether the transforms are applied on the GPU
+		bool                         mMultiTexture;     //!< Whether the batches are merged across textures
+		bool                         mIndirect;         //!< Whether the merged batches are submitted through the indirect draw buffer
 	};
 }
 #endif // Aeon_Graphics_BatchRenderer2D_H_
@@ -220,9 +886,30 @@ namespace ae
 
  The ae::Renderable2D instances submitted are additionally cached, meaning that
  the batches won't be recreated every frame if they haven't been modified.
+ Retained renderables go further by registering a proxy once and only pushing
+ their modifications, see registerProxy().
+
+ Alternatively, the ae::BatchRenderer2D::Mode::SortKey mode records each
+ submission in a flat list along with a 64-bit key which packs its shader,
+ blend mode, texture and depth; the list is radix-sorted once per frame which
+ minimizes the state changes while keeping submission as cheap as possible.
+
+ The ae::BatchRenderer2D::Mode::Layered mode instead relies on the layers
+ declared by the actors: each submission is appended to its layer's list and
+ the layers are rendered in ascending order, the submissions of a layer being
+ rendered in the order of which they were received. No sorting is performed
+ and depth-testing is disabled, which suits pure-2D scenes.
+
+ The batches sharing a shader and a blend mode may also be merged across up to
+ 16 textures at a time, see setMultiTextureBatching().
+
+ The batches are streamed to OpenGL through triple-buffered, persistently-mapped
+ ring buffers, so the data stores are never reallocated between drawcalls. The
+ batches only made up of quads (sprites, texts) don't upload their indices, they
+ are drawn from an engine-owned static index buffer with base-vertex draws.
 
  \author Filippos Gleglakos
- \version v0.6.0
+ \version v0.7.0
  \date 2020.08.31
  \copyright MIT License
 */
\ No newline at end of file
@@ -26,6 +26,7 @@
 #include <AEON/Math/Vector.h>
 #include <AEON/Math/Matrix.h>
 #include <AEON/Math/AABoxCollider.h>
+#include <AEON/Math/Frustum.h>
 #include <AEON/Math/internal/Quaternion.h>
 
 namespace ae
@@ -229,6 +230,15 @@ namespace ae
 		 \since v0.4.0
 		*/
 		void setTarget(const RenderTarget* const target) noexcept;
+		/*!
+		 \brief Marks the ae::Camera's projection matrix to be recomputed the next time it's retrieved.
+		 \note This method is called automatically by the associated ae::RenderTarget once it has been resized.
+
+		 \sa getProjectionMatrix()
+
+		 \since v0.7.0
+		*/
+		void invalidateProjection() noexcept;
 		/*!
 		 \brief Retrieves the ae::Camera's local directional vector pointing rightwards.
 		 \details This directional vector differs from the global vector ae::Vector3f::Right as it depends on the position and the rotation of the ae::Camera instance.
@@ -384,6 +394,57 @@ namespace ae
 		 \since v0.5.0
 		*/
 		_NODISCARD const Matrix4f& getInverseProjectionMatrix();
+		/*!
+		 \brief Retrieves the inverse of the product of the ae::Camera's projection and view matrices.
+		 \details The inverse maps the normalized device coordinates back to world coordinates, it's only computed again once either matrix has changed
+		 so that picking several points per frame doesn't multiply the inverse matrices each time.
+
+		 \return An ae::Matrix4f containing the inverse view-projection matrix
+
+		 \par Example:
+		 \code
+		 ae::Camera2D camera;
+		 ...
+		 const ae::Vector3f worldPos = camera.getInverseViewProjectionMatrix() * ae::Vector3f(ndc.x, ndc.y, 0.f);
+		 \endcode
+
+		 \sa getInverseViewMatrix(), getInverseProjectionMatrix()
+
+		 \since v0.7.0
+		*/
+		_NODISCARD const Matrix4f& getInverseViewProjectionMatrix();
+		/*!
+		 \brief Retrieves the version of the ae::Camera's view and projection matrices.
+		 \details The version changes whenever either matrix is recomputed, and is unique amongst all cameras (a copied camera shares its version until either is modified).
+		 This allows the renderers to skip the upload of the matrices when the camera hasn't changed since they were last uploaded.
+		 \note The matrices should be retrieved beforehand, as they're only recomputed (and the version changed) upon their retrieval.
+
+		 \return The version of the view and projection matrices
+
+		 \since v0.7.0
+		*/
+		_NODISCARD uint64_t getVersion() const noexcept;
+		/*!
+		 \brief Retrieves the planes bounding what the ae::Camera can see, in world coordinates.
+		 \details The planes are extracted from the product of the projection and view matrices, they're only extracted again once either matrix has changed.
+
+		 \return The ae::Frustum of the ae::Camera
+
+		 \par Example:
+		 \code
+		 ae::CameraFPS camera;
+		 ...
+		 const ae::Frustum& frustum = camera.getViewFrustum();
+		 if (frustum.intersects(model.getWorldBox())) {
+			... // submit the model
+		 }
+		 \endcode
+
+		 \sa getViewMatrix(), getProjectionMatrix()
+
+		 \since v0.7.0
+		*/
+		_NODISCARD const Frustum& getViewFrustum();
 
 		// Public virtual method(s)
 		/*!
@@ -488,6 +549,26 @@ namespace ae
 		*/
 		Camera& operator=(Camera&& rvalue) noexcept;
 
+	protected:
+		// Protected method(s)
+		/*!
+		 \brief Assigns a new version to the ae::Camera's matrices.
+		 \note This method should be called by the derived classes whenever they recompute the view or projection matrix.
+
+		 \sa getVersion()
+
+		 \since v0.7.0
+		*/
+		void updateVersion() noexcept;
+		/*!
+		 \brief Renormalizes the ae::Camera's rotation if its magnitude drifted beyond a threshold.
+		 \details The rounding errors accumulated by successive rotations slowly denormalize the quaternion, which only needs to be renormalized
+		 once the drift becomes noticeable rather than after each rotation.
+
+		 \since v0.7.0
+		*/
+		void renormalizeRotation() noexcept;
+
 	protected:
 		// Protected member(s)
 		Matrix4f            mViewMatrix;                //!< The view matrix
@@ -506,6 +587,11 @@ namespace ae
 		Vector3f            mPosition;                  //!< The camera's position
 		float               mNearPlane;                 //!< The distance to the near plane in the Z-axis
 		float               mFarPlane;                  //!< The distance to the far plane in the Z-axis
+		uint64_t            mVersion;                   //!< The version of the view and projection matrices
+		Frustum             mFrustum;                   //!< The planes of the view volume
+		uint64_t            mFrustumVersion;            //!< The version of the matrices from which the frustum's planes were extracted
+		Matrix4f            mInvViewProjMatrix;         //!< The inverse view-projection matrix
+		uint64_t            mInvViewProjVersion;        //!< The version of the matrices from which the inverse view-projection matrix was computed
 	};
 }
 #endif // Aeon_Graphics_Camera_H_
@@ -27,6 +27,9 @@
 
 namespace ae
 {
+	// Forward declaration(s)
+	class Event;
+
 	/*!
 	 \brief The class used to represent an FPS (First-Person Shooter) camera for a 3D scene.
 	 \details This class is typically the standard camera for FPS games.
@@ -90,6 +93,30 @@ namespace ae
 		 \since v0.4.0
 		*/
 		_NODISCARD float getSensitivity() const noexcept;
+		/*!
+		 \brief Records the mouse cursor's movement to be applied to the ae::CameraFPS's rotation.
+		 \details Once this method has received a mouse movement, the camera stops polling the mouse cursor's position and its rotation is only
+		 updated by the received movements. The movements received during a frame are coalesced, only the latest position being applied once
+		 upon the next retrieval of the rotation (or of the view matrix).
+
+		 \param[in] event The polymorphic event to handle
+		 
+		 \return False as the event isn't consumed, it remains available to the other handlers
+		 
+		 \par Example:
+		 \code
+		 virtual bool handleEvent(ae::Event* const event) override final
+		 {
+			mCamera.handleEvent(event);
+			...
+		 }
+		 \endcode
+
+		 \sa getRotation()
+
+		 \since v0.7.0
+		*/
+		bool handleEvent(Event* const event);
 
 		// Public virtual method(s)
 		/*!
@@ -126,8 +153,11 @@ namespace ae
 
 	private:
 		// Private member(s)
-		Vector2f mLastMousePos; //!< The last recorded mouse position
-		float    mSensitivity;  //!< The rotational sensitivity of the camera
+		Vector2f mLastMousePos;      //!< The last recorded mouse position
+		Vector2f mPendingMousePos;   //!< The latest mouse position received and not yet applied
+		float    mSensitivity;       //!< The rotational sensitivity of the camera
+		bool     mMouseInputPending; //!< Whether a mouse movement was received since the rotation was last updated
+		bool     mEventDriven;       //!< Whether the rotation is updated by the received mouse movements instead of by polling the mouse
 	};
 }
 #endif // Aeon_Graphics_CameraFPS_H_
@@ -42,11 +42,13 @@ namespace ae
 		*/
 		ConvexShape();
 		/*!
-		 \brief Deleted copy constructor.
-		 
-		 \since v0.6.0
+		 \brief Copy constructor.
+
+		 \param[in] copy The ae::ConvexShape that will be copied
+
+		 \since v0.7.0
 		*/
-		ConvexShape(const ConvexShape&) = delete;
+		ConvexShape(const ConvexShape& copy) = default;
 		/*!
 		 \brief Move constructor.
 
@@ -154,6 +156,19 @@ namespace ae
 		*/
 		virtual Vector2f getPoint(size_t index) const override final;
 
+	private:
+		// Private virtual method(s)
+		/*!
+		 \brief Copies the ae::ConvexShape without its children, its texture and geometry being shared with the copy.
+
+		 \return The copy of the ae::ConvexShape
+
+		 \sa clone()
+
+		 \since v0.7.0
+		*/
+		_NODISCARD virtual std::unique_ptr<Actor2D> cloneSelf() const override;
+
 	private:
 		// Private member(s)
 		std::vector<Vector2f> mPoints; //!< The points representing the polygon
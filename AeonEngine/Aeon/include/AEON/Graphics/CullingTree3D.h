@@ -0,0 +1,318 @@
+// MIT License
+// 
+// Copyright(c) 2019-2021 Filippos Gleglakos
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef Aeon_Graphics_CullingTree3D_H_
+#define Aeon_Graphics_CullingTree3D_H_
+
+#include <cstdint>
+#include <vector>
+
+#include <AEON/Config.h>
+#include <AEON/Math/AABoxCollider.h>
+#include <AEON/Math/Frustum.h>
+
+namespace ae
+{
+	// Forward declaration(s)
+	class Transformable;
+
+	/*!
+	 \brief The class used to find the 3D transformables situated inside of a camera's view volume without testing each one of them.
+	 \details The transformables' world boxes are stored in a bounding volume hierarchy of fattened boxes, which is traversed from the root and pruned by the ae::Frustum.
+	*/
+	class AEON_API CullingTree3D
+	{
+	public:
+		// Public constructor(s)
+		/*!
+		 \brief Constructs the ae::CullingTree3D by providing the margin of the fattened boxes.
+
+		 \param[in] margin The distance by which the boxes are fattened so that small movements don't modify the tree, 1 unit by default
+
+		 \par Example:
+		 \code
+		 ae::CullingTree3D cullingTree(0.5f);
+		 \endcode
+
+		 \since v0.7.0
+		*/
+		explicit CullingTree3D(float margin = 1.f);
+		/*!
+		 \brief Deleted copy constructor.
+
+		 \since v0.7.0
+		*/
+		CullingTree3D(const CullingTree3D&) = delete;
+		/*!
+		 \brief Move constructor.
+
+		 \param[in] rvalue The ae::CullingTree3D that will be moved
+
+		 \since v0.7.0
+		*/
+		CullingTree3D(CullingTree3D&& rvalue) noexcept = default;
+	public:
+		// Public operator(s)
+		/*!
+		 \brief Deleted assignment operator.
+
+		 \since v0.7.0
+		*/
+		CullingTree3D& operator=(const CullingTree3D&) = delete;
+		/*!
+		 \brief Move assignment operator.
+
+		 \param[in] rvalue The ae::CullingTree3D that will be moved
+
+		 \return The caller ae::CullingTree3D
+
+		 \since v0.7.0
+		*/
+		CullingTree3D& operator=(CullingTree3D&& rvalue) noexcept = default;
+	public:
+		// Public method(s)
+		/*!
+		 \brief Creates a proxy for the \a transformable provided.
+		 \details The proxies of the removed transformables are reused first.
+		 \note The \a transformable must outlive its proxy, or be removed beforehand.
+
+		 \param[in] transformable The ae::Transformable whose world box will be stored
+
+		 \return The new proxy
+
+		 \par Example:
+		 \code
+		 const uint32_t proxy = cullingTree.insert(*model);
+		 \endcode
+
+		 \sa remove(), update()
+
+		 \since v0.7.0
+		*/
+		uint32_t insert(Transformable& transformable);
+		/*!
+		 \brief Removes the \a proxy so that its transformable is no longer reported.
+
+		 \param[in] proxy The proxy to remove
+
+		 \sa insert()
+
+		 \since v0.7.0
+		*/
+		void remove(uint32_t proxy);
+		/*!
+		 \brief Updates the \a proxy's world box after its transformable was moved, rotated or scaled.
+		 \details The tree is only modified if the world box leaves its fattened box.
+
+		 \param[in] proxy The proxy whose transformable was modified
+
+		 \par Example:
+		 \code
+		 model->move(velocity * dt.asSeconds());
+		 cullingTree.update(proxy);
+		 \endcode
+
+		 \sa insert()
+
+		 \since v0.7.0
+		*/
+		void update(uint32_t proxy);
+		/*!
+		 \brief Retrieves the transformables whose world boxes are at least partly inside of the \a frustum.
+		 \details The subtrees entirely inside of the \a frustum are reported without any further tests and the ones entirely outside of it are skipped.
+
+		 \param[in] frustum The ae::Frustum against which the world boxes are tested
+		 \param[out] visible The vector receiving the visible transformables, cleared beforehand so that its memory may be reused between frames
+
+		 \par Example:
+		 \code
+		 std::vector<ae::Transformable*> visible;
+		 cullingTree.query(camera.getViewFrustum(), visible);
+		 for (ae::Transformable* const transformable : visible) {
+			... // submit the transformable to the renderer
+		 }
+		 \endcode
+
+		 \since v0.7.0
+		*/
+		void query(const Frustum& frustum, std::vector<Transformable*>& visible) const;
+		/*!
+		 \brief Retrieves the world box of the \a proxy.
+
+		 \param[in] proxy The proxy whose world box will be retrieved
+
+		 \return The Box3f containing the minimum and maximum world coordinates of the proxy's transformable
+
+		 \since v0.7.0
+		*/
+		_NODISCARD Box3f getBox(uint32_t proxy) const;
+		/*!
+		 \brief Retrieves the transformable of the \a proxy.
+
+		 \param[in] proxy The proxy whose transformable will be retrieved
+
+		 \return The ae::Transformable provided to insert(), nullptr if the proxy was removed
+
+		 \since v0.7.0
+		*/
+		_NODISCARD Transformable* getTransformable(uint32_t proxy) const;
+		/*!
+		 \brief Retrieves the number of proxies that haven't been removed.
+
+		 \return The number of active proxies
+
+		 \since v0.7.0
+		*/
+		_NODISCARD size_t getProxyCount() const noexcept;
+	private:
+		// Private struct(s)
+		/*!
+		 \brief The internal struct representing a node of the tree.
+		*/
+		struct TreeNode
+		{
+			Box3f    box;    //!< The fattened box of the leaf or the union of the children's boxes
+			int32_t  parent; //!< The parent node, or the next free node if the node is free
+			int32_t  child1; //!< The first child, -1 for leaves
+			int32_t  child2; //!< The second child, -1 for leaves
+			int32_t  height; //!< The height of the subtree, 0 for leaves and -1 for free nodes
+			uint32_t proxy;  //!< The proxy of the leaf
+		};
+
+	private:
+		// Private method(s)
+		/*!
+		 \brief Allocates a node of the tree.
+
+		 \return The index of the new node
+
+		 \since v0.7.0
+		*/
+		int32_t allocateNode();
+		/*!
+		 \brief Releases the \a node of the tree so that it may be reused.
+
+		 \param[in] node The index of the node to release
+
+		 \since v0.7.0
+		*/
+		void freeNode(int32_t node);
+		/*!
+		 \brief Inserts the \a leaf into the tree, next to the sibling that increases the tree's surface area the least.
+
+		 \param[in] leaf The index of the leaf to insert
+
+		 \since v0.7.0
+		*/
+		void insertLeaf(int32_t leaf);
+		/*!
+		 \brief Removes the \a leaf from the tree without releasing it.
+
+		 \param[in] leaf The index of the leaf to remove
+
+		 \since v0.7.0
+		*/
+		void removeLeaf(int32_t leaf);
+		/*!
+		 \brief Refits and rebalances the ancestors of the \a node up to the root.
+
+		 \param[in] node The index of the first node to refit
+
+		 \since v0.7.0
+		*/
+		void refit(int32_t node);
+		/*!
+		 \brief Rotates the subtree of the \a node if its children's heights differ by more than 1.
+
+		 \param[in] node The index of the node to balance
+
+		 \return The index of the node that replaced the \a node in the tree
+
+		 \since v0.7.0
+		*/
+		int32_t balance(int32_t node);
+		/*!
+		 \brief Builds the fattened box of the \a proxy.
+
+		 \param[in] proxy The proxy whose box will be fattened
+
+		 \return The Box3f fattened by the margin
+
+		 \since v0.7.0
+		*/
+		_NODISCARD Box3f getFatBox(uint32_t proxy) const;
+
+	private:
+		// Private member(s)
+		float                       mMargin;         //!< The distance by which the boxes are fattened
+		std::vector<Box3f>          mBoxes;          //!< The world boxes of the proxies' transformables
+		std::vector<Transformable*> mTransformables; //!< The proxies' transformables, nullptr for the removed proxies
+		std::vector<int32_t>        mLeaves;         //!< The tree's leaf of each proxy
+		std::vector<uint32_t>       mFreeProxies;    //!< The removed proxies
+		std::vector<TreeNode>       mNodes;          //!< The tree's nodes
+		int32_t                     mRoot;           //!< The tree's root node, -1 if it's empty
+		int32_t                     mFreeNode;       //!< The first free node of the tree, -1 if there aren't any
+	};
+}
+#endif // Aeon_Graphics_CullingTree3D_H_
+
+/*!
+ \class ae::CullingTree3D
+ \ingroup graphics
+
+ The ae::CullingTree3D class stores the world boxes of 3D transformables in a
+ balanced bounding volume hierarchy so that a 3D scene only submits to the GPU
+ what the camera can see. The world box of each transformable encloses its
+ rotated and scaled model bounds; only the transformables that were modified
+ need to be updated, and the tree is only restructured when a box leaves the
+ fattened box it was inserted with.
+
+ The query descends from the root and classifies each node's box against the
+ camera's ae::Frustum: the subtrees entirely outside of the view volume are
+ skipped and the ones entirely inside of it are reported without any further
+ tests, so a query is logarithmic in the number of transformables.
+
+ Usage example:
+ \code
+ ae::CullingTree3D cullingTree;
+ std::vector<uint32_t> proxies;
+ for (Model& model : models) {
+	proxies.push_back(cullingTree.insert(model));
+ }
+ ...
+ // Every frame
+ for (size_t i = 0; i < models.size(); ++i) {
+	if (models[i].hasMoved()) {
+		cullingTree.update(proxies[i]);
+	}
+ }
+ std::vector<ae::Transformable*> visible;
+ cullingTree.query(camera.getViewFrustum(), visible);
+ \endcode
+
+ \sa ae::Frustum, ae::BroadPhase2D
+
+ \author Filippos Gleglakos
+ \version v0.7.0
+ \date 2021.07.26
+ \copyright MIT License
+*/
\ No newline at end of file
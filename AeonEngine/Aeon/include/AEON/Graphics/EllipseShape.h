@@ -55,11 +55,13 @@ namespace ae
 		*/
 		explicit EllipseShape(const Vector2f& radius = Vector2f(), size_t pointCount = 30);
 		/*!
-		 \brief Deleted copy constructor.
+		 \brief Copy constructor.
 
-		 \since v0.5.0
+		 \param[in] copy The ae::EllipseShape that will be copied
+
+		 \since v0.7.0
 		*/
-		EllipseShape(const EllipseShape&) = delete;
+		EllipseShape(const EllipseShape& copy) = default;
 		/*!
 		 \brief Move constructor.
 
@@ -181,11 +183,56 @@ namespace ae
 		 \since v0.5.0
 		*/
 		virtual Vector2f getPoint(size_t index) const override final;
+		/*!
+		 \brief Retrieves all the points of the ae::EllipseShape at once.
+		 \details The points are computed by scaling and offsetting the shared unit circle table, no trigonometry is evaluated when the radius changes.
+
+		 \param[out] points The array receiving the getPointCount() points
+
+		 \sa getPoint(), getPointCount()
+
+		 \since v0.7.0
+		*/
+		virtual void getPoints(Vector2f* points) const override final;
+
+	private:
+		// Private virtual method(s)
+		/*!
+		 \brief Retrieves the largest radius as the radius of the ae::EllipseShape's curve.
+
+		 \return The largest of the horizontal and vertical radii
+
+		 \sa applySegmentCount()
+
+		 \since v0.7.0
+		*/
+		_NODISCARD virtual float getCurveRadius() const noexcept override final;
+		/*!
+		 \brief Sets the point count to \a segmentCount as the ellipse is formed of a single full turn.
+
+		 \param[in] segmentCount The number of segments to use for the full ellipse
+
+		 \sa getCurveRadius()
+
+		 \since v0.7.0
+		*/
+		virtual void applySegmentCount(size_t segmentCount) override final;
+		/*!
+		 \brief Copies the ae::EllipseShape without its children, its texture and geometry being shared with the copy.
+
+		 \return The copy of the ae::EllipseShape
+
+		 \sa clone()
+
+		 \since v0.7.0
+		*/
+		_NODISCARD virtual std::unique_ptr<Actor2D> cloneSelf() const override;
 
 	private:
 		// Private member(s)
-		Vector2f mRadius;     //!< The radius of the ellipse along the X and Y axes
-		size_t   mPointCount; //!< The number of points used to form the ellipse
+		std::shared_ptr<const std::vector<Vector2f>> mUnitPoints; //!< The shared points of the unit circle of the same point count
+		Vector2f                                     mRadius;     //!< The radius of the ellipse along the X and Y axes
+		size_t                                       mPointCount; //!< The number of points used to form the ellipse
 	};
 }
 #endif // Aeon_Graphics_EllipseShape_H_
@@ -23,10 +23,19 @@
 #ifndef Aeon_Graphics_Font_H_
 #define Aeon_Graphics_Font_H_
 
+#include <functional>
+#include <map>
 #include <memory>
+#include <memory_resource>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
 
 #include <AEON/Config.h>
 #include <AEON/Graphics/TextureAtlas.h>
+#include <AEON/System/FileSystem.h>
+#include <AEON/System/JobSystem.h>
 
 namespace ae
 {
@@ -38,77 +47,152 @@ namespace ae
 	*/
 	class AEON_API Font
 	{
+	public:
+		// Public enum(s)
+		/*!
+		 \brief The different ways of rasterizing the glyphs.
+		*/
+		enum class RenderMode
+		{
+			Bitmap,       //!< One coverage bitmap per character size (sharp at its own size only)
+			DistanceField //!< One signed distance field per glyph serving every character size (requires the "_AEON_TextSDF2D" shader)
+		};
+
+		// Public struct(s)
+		/*!
+		 \brief The structure representing a glyph rasterized by FreeType which has yet to be inserted into the texture atlas.
+		*/
+		struct GlyphBitmap
+		{
+			// Public member(s)
+			uint32_t                   codepoint; //!< The glyph's unicode
+			Vector2i                   size;      //!< The bitmap's size in pixels
+			Vector2i                   bearing;   //!< The glyph's offset in pixels based on its origin
+			unsigned int               advance;   //!< The horizontal offset in 1/64 pixels to the next glyph's origin
+			std::vector<unsigned char> pixels;    //!< The bitmap's tightly-packed coverage values
+		};
+		/*!
+		 \brief The structure representing a set of glyphs of the same size rasterized in one pass with rasterize().
+		*/
+		struct GlyphBatch
+		{
+			// Public member(s)
+			unsigned int             characterSize; //!< The font size of the glyphs
+			std::vector<GlyphBitmap> glyphs;        //!< The rasterized glyphs
+		};
+		/*!
+		 \brief The structure representing the laid-out glyphs of a string of codepoints retrieved with getGlyphRun().
+		*/
+		struct GlyphRun
+		{
+			// Public member(s)
+			std::vector<const Glyph*> glyphs;  //!< The glyphs of the codepoints
+			std::vector<float>        offsets; //!< The horizontal offsets of the glyphs' origins at the page's size (followed by the run's width)
+		};
+
 	private:
 		// Private nested class(es)
 		/*!
 		 \brief The structure representing a font page containing glyphs.
-		 \details Each font size extracted represents a page.
+		 \details Each font size extracted represents a page, the pages share the font's FreeType face through their own size object.
 		*/
 		struct Page
 		{
 			// Public member(s)
-			std::map<uint32_t, Glyph> glyphs; //!< The hashmap of glyphs and their codepoint
-			void*                     face;   //!< The pointer to the FreeType face
+			std::map<uint32_t, Glyph>                    glyphs; //!< The hashmap of glyphs and their codepoint
+			std::unordered_map<std::u32string, GlyphRun> runs;   //!< The cached glyph runs laid out with the page's glyphs
+			void*                                        size;   //!< The pointer to the FreeType size object (owned by the face)
 
 			// Public constructor(s)
 			/*!
-			 \brief Constructs the ae::Font::Page by providing the filename of the font.
+			 \brief Constructs the ae::Font::Page by providing the FreeType face from which the glyphs will be extracted.
 
-			 \param[in] filename The string containing the location of the font
-			 \param[in] success Whether or not the font was successfully loaded in
+			 \param[in] face The pointer to the font's FreeType face
+			 \param[in] success Whether or not the page's size object was successfully created
 
-			 \since v0.5.0
+			 \since v0.7.0
 			*/
-			Page(const std::string& filename, bool& success);
+			Page(void* face, bool& success);
+		};
+		/*!
+		 \brief The structure representing the font file loaded in memory and the FreeType face created from it.
+		 \details The file is mapped in memory once, every glyph page shares this face and the faces created to rasterize glyphs on
+		 other threads are opened from the same contents.
+		*/
+		struct Face
+		{
+			// Public member(s)
+			FileSystem::MappedFile data;   //!< The contents of the font file mapped in memory
+			void*                  handle; //!< The pointer to the FreeType face
+
+			// Public constructor(s)
 			/*!
-			 \brief Copy constructor.
+			 \brief Default constructor.
 
-			 \param[in] copy The ae::Font::Page that will be copied
+			 \since v0.7.0
+			*/
+			Face() noexcept;
+			/*!
+			 \brief Deleted copy constructor.
 
-			 \since v0.6.0
+			 \since v0.7.0
 			*/
-			Page(const Page& copy) = default;
+			Face(const Face&) = delete;
 			/*!
 			 \brief Move constructor.
 
-			 \param[in] rvalue The ae::Font::Page that will be moved
+			 \param[in] rvalue The ae::Font::Face that will be moved
 
-			 \since v0.5.0
+			 \since v0.7.0
 			*/
-			Page(Page&& rvalue) noexcept;
+			Face(Face&& rvalue) noexcept;
 			/*!
 			 \brief Destructor.
-			 \details Releases all FreeType resources that were allocated.
+			 \details Releases the FreeType face along with the size objects of the glyph pages.
 
-			 \since v0.5.0
+			 \since v0.7.0
 			*/
-			~Page();
+			~Face();
 
 			// Public operator(s)
 			/*!
-			 \brief Assignment operator.
+			 \brief Deleted assignment operator.
+
+			 \since v0.7.0
+			*/
+			Face& operator=(const Face&) = delete;
+			/*!
+			 \brief Move assignment operator.
 
-			 \param[in] other The ae::Font::Page that will be copied
+			 \param[in] rvalue The ae::Font::Face that will be moved
 
-			 \return The caller ae::Font::Page
+			 \return The caller ae::Font::Face
 
-			 \since v0.6.0
+			 \since v0.7.0
 			*/
-			Page& operator=(const Page& other) = default;
+			Face& operator=(Face&& rvalue) noexcept;
+
+			// Public method(s)
 			/*!
-			 \brief Move assignment operator.
+			 \brief Reads in the font file at the location provided and creates the FreeType face from its contents.
+
+			 \param[in] filename The string containing the location of the font
 
-			 \param[in] rvalue The ae::Font::Page that will be moved
+			 \return True if the face was successfully created, false otherwise
 
-			 \return The caller ae::Font::Page
+			 \since v0.7.0
+			*/
+			bool open(const std::string& filename);
+			/*!
+			 \brief Releases the FreeType face and the font file's contents.
 
-			 \since v0.5.0
+			 \since v0.7.0
 			*/
-			Page& operator=(Page&& rvalue) noexcept;
+			void close();
 		};
 	private:
 		// Private typedef(s)
-		using PageItr = std::map<unsigned int, Page>::iterator;
+		using PageItr = std::pmr::map<unsigned int, Page>::iterator;
 		using GlyphItr = std::map<uint32_t, Glyph>::iterator;
 
 	public:
@@ -132,7 +216,14 @@ namespace ae
 
 		 \since v0.5.0
 		*/
-		Font(Font&& rvalue) noexcept = default;
+		Font(Font&& rvalue) noexcept;
+		/*!
+		 \brief Destructor.
+		 \details Unregisters the font from the fonts reloaded when their file is modified.
+
+		 \since v0.7.0
+		*/
+		~Font();
 	public:
 		// Public operator(s)
 		/*!
@@ -150,12 +241,13 @@ namespace ae
 
 		 \since v0.5.0
 		*/
-		Font& operator=(Font&& rvalue) noexcept = default;
+		Font& operator=(Font&& rvalue) noexcept;
 	public:
 		// Public method(s)
 		/*!
-		 \brief Prepares to load in the font stored at the location provided.
-		 \details Supported file formats: .TTF, .TTC, .CFF, .WOFF, .OTF, .OTC, .PFA, .PFB, .PCF, .FNT, .BDF, .PFR
+		 \brief Loads in the font stored at the location provided, the glyphs themselves are loaded when they're first requested.
+		 \details Supported file formats: .TTF, .TTC, .CFF, .WOFF, .OTF, .OTC, .PFA, .PFB, .PCF, .FNT, .BDF, .PFR\n
+		 The file is read once and kept in memory, every character size shares the same FreeType face.
 		 \note Reinitialises the glyph pages in case a different font was previously chosen.
 		 
 		 \param[in] filename The string containing the filepath of the font (with its extension)
@@ -171,6 +263,19 @@ namespace ae
 		 \since v0.6.0
 		*/
 		void loadFromFile(const std::string& filename);
+		/*!
+		 \brief Reads in the font file again, typically after it was modified on disk.
+		 \details The glyph pages and the texture atlas are recreated, the listeners are then notified so that they retrieve their glyphs again.
+		 The current font is kept if the file can't be opened.
+		 \note No glyph batch rasterized with rasterize() may be in flight.
+
+		 \return True if the font was successfully reloaded, false otherwise
+
+		 \sa loadFromFile(), addListener()
+
+		 \since v0.7.0
+		*/
+		bool reloadFromFile();
 		/*!
 		 \brief Retrieves the glyph corresponding to the parameters provided.
 		 \details If the glyph requested hasn't been loaded in, it will be created.
@@ -194,6 +299,231 @@ namespace ae
 		 \since v0.6.0
 		*/
 		_NODISCARD const Glyph& getGlyph(uint32_t codepoint, unsigned int characterSize);
+		/*!
+		 \brief Retrieves the glyphs and the horizontal offsets of the string of \a codepoints provided.
+		 \details The runs are cached, so identical strings (such as repeated labels) reuse the layout computed the first time.
+		 The offsets are expressed at the page's character size and need to be multiplied by getGlyphScale().
+		 \note The reference remains valid until the next run is laid out.
+
+		 \param[in] codepoints The string of codepoints to lay out
+		 \param[in] characterSize The font size of the glyphs to retrieve
+
+		 \return The ae::Font::GlyphRun containing the glyphs and their offsets
+
+		 \sa getGlyph(), getGlyphScale()
+
+		 \since v0.7.0
+		*/
+		_NODISCARD const GlyphRun& getGlyphRun(const std::u32string& codepoints, unsigned int characterSize);
+		/*!
+		 \brief Sets the way in which the glyphs are rasterized.
+		 \details In the ae::Font::RenderMode::DistanceField mode, each glyph is rasterized once as a signed distance field at a single
+		 character size and is then scaled to the size requested, so the texts stay sharp when scaled and a single set of glyphs
+		 occupies the texture atlas no matter how many character sizes are used.
+		 \note The render mode must be set before the first glyph is loaded.
+
+		 \param[in] mode The ae::Font::RenderMode to use, ae::Font::RenderMode::Bitmap by default
+
+		 \par Example:
+		 \code
+		 ae::Font font;
+		 font.loadFromFile("Assets/Fonts/arial.ttf");
+		 font.setRenderMode(ae::Font::RenderMode::DistanceField);
+		 \endcode
+
+		 \sa getRenderMode(), getGlyphScale()
+
+		 \since v0.7.0
+		*/
+		void setRenderMode(RenderMode mode);
+		/*!
+		 \brief Retrieves the way in which the glyphs are rasterized.
+
+		 \return The ae::Font::RenderMode in use
+
+		 \sa setRenderMode()
+
+		 \since v0.7.0
+		*/
+		_NODISCARD RenderMode getRenderMode() const noexcept;
+		/*!
+		 \brief Retrieves the filepath of the font loaded.
+
+		 \return The filepath provided to loadFromFile(), an empty string if no font was loaded
+
+		 \sa loadFromFile()
+
+		 \since v0.7.0
+		*/
+		_NODISCARD const std::string& getFilename() const noexcept;
+		/*!
+		 \brief Retrieves the factor by which the glyphs' metrics need to be scaled to obtain the character size provided.
+		 \details The glyphs retrieved in the ae::Font::RenderMode::DistanceField mode are rasterized at a single character size.
+
+		 \param[in] characterSize The font size requested
+
+		 \return The scale factor, 1 in the ae::Font::RenderMode::Bitmap mode
+
+		 \sa getGlyph(), setRenderMode()
+
+		 \since v0.7.0
+		*/
+		_NODISCARD float getGlyphScale(unsigned int characterSize) const noexcept;
+		/*!
+		 \brief Rasterizes and inserts the glyphs of the \a codepoints provided in one pass so that they don't need to be loaded while rendering.
+		 \details The listeners of the font are only notified once, and only if the texture atlas had to grow.
+		 \note A font must be loaded prior to calling this method.
+
+		 \param[in] codepoints The glyphs' unicodes, the glyphs already loaded are skipped
+		 \param[in] characterSize The font size of the glyphs to load
+
+		 \par Example:
+		 \code
+		 ae::Font font;
+		 font.loadFromFile("Assets/Fonts/arial.ttf");
+		 font.preload(ae::Font::getCodepointRange(0x20, 0x7E), 24); // printable ASCII
+		 font.preload(U"éèàçù", 24);
+		 \endcode
+
+		 \sa rasterize(), upload(), getCodepointRange()
+
+		 \since v0.7.0
+		*/
+		void preload(const std::u32string& codepoints, unsigned int characterSize);
+		/*!
+		 \brief Rasterizes the glyphs of the \a codepoints provided without inserting them into the texture atlas.
+		 \details The rasterization doesn't issue any OpenGL calls and uses its own FreeType face, so it may be executed on a worker thread.
+		 The batch is then inserted with upload() on the thread owning the OpenGL context.
+		 \note The font must not be reloaded while the rasterization is in progress.
+
+		 \param[in] codepoints The glyphs' unicodes
+		 \param[in] characterSize The font size of the glyphs to rasterize
+
+		 \return The ae::Font::GlyphBatch containing the rasterized glyphs
+
+		 \par Example:
+		 \code
+		 ae::JobSystem& jobSystem = ae::JobSystem::getInstance();
+		 ae::Font::GlyphBatch batch;
+		 ae::JobSystem::Job* job = jobSystem.createJob([&font, &batch]() { batch = font.rasterize(ae::Font::getCodepointRange(0x20, 0xFF), 32); });
+		 jobSystem.run(job);
+		 ...
+		 jobSystem.wait(job);
+		 font.upload(batch);
+		 \endcode
+
+		 \sa upload(), preload()
+
+		 \since v0.7.0
+		*/
+		_NODISCARD GlyphBatch rasterize(const std::u32string& codepoints, unsigned int characterSize) const;
+		/*!
+		 \brief Inserts the glyphs rasterized with rasterize() into the texture atlas.
+		 \note This method must be called by the thread owning the OpenGL context.
+
+		 \param[in] batch The ae::Font::GlyphBatch to insert, the glyphs already loaded are skipped
+
+		 \sa rasterize(), preload()
+
+		 \since v0.7.0
+		*/
+		void upload(const GlyphBatch& batch);
+		/*!
+		 \brief Rasterizes the glyphs of the \a codepoints provided on the worker threads, and inserts them into the texture atlas as they complete.
+		 \details The codepoints are split into batches rasterized in parallel with rasterize() (each worker thread owning its FreeType library),
+		 the glyphs already loaded being skipped. The batches completed are inserted into the atlas by the thread owning the OpenGL context
+		 once per frame (see ae::FontManager::update()), so large character sets such as CJK pages don't stall the frame.\n
+		 The glyphs retrieved with getGlyph() before their batch is inserted are rasterized immediately.
+		 \note This method must be called by the thread owning the OpenGL context and a font must be loaded prior to calling it.
+
+		 \param[in] codepoints The glyphs' unicodes, the glyphs already loaded are skipped
+		 \param[in] characterSize The font size of the glyphs to load
+
+		 \par Example:
+		 \code
+		 ae::Font font;
+		 font.loadFromFile("Assets/Fonts/NotoSansCJK.otf");
+		 font.rasterizeAsync(ae::Font::getCodepointRange(0x4E00, 0x9FFF), 24); // CJK unified ideographs
+		 \endcode
+
+		 \sa isRasterizing(), rasterize(), preload()
+
+		 \since v0.7.0
+		*/
+		void rasterizeAsync(const std::u32string& codepoints, unsigned int characterSize);
+		/*!
+		 \brief Checks whether glyphs requested with rasterizeAsync() have yet to be inserted into the texture atlas.
+
+		 \return True if batches of glyphs are still being rasterized or awaiting their insertion, false otherwise
+
+		 \sa rasterizeAsync()
+
+		 \since v0.7.0
+		*/
+		_NODISCARD bool isRasterizing() const noexcept;
+		/*!
+		 \brief Registers the \a callback to invoke whenever the texture atlas grows, invalidating the glyphs' texture coordinates.
+		 \details Only the listeners of this font are notified, so the instances using other fonts aren't involved.\n
+		 The callback's parameter is true when the font was reloaded with reloadFromFile(), the glyphs previously retrieved then being invalid.
+		 \note The listener must be removed with removeListener() before it's destroyed.
+
+		 \param[in] listener The address identifying the listener (usually the listener's \a this pointer)
+		 \param[in] callback The function to invoke when the texture atlas grows
+
+		 \par Example:
+		 \code
+		 font.addListener(this, [this](bool reloaded) { mUpdateUV = true; });
+		 ...
+		 font.removeListener(this);
+		 \endcode
+
+		 \sa removeListener()
+
+		 \since v0.7.0
+		*/
+		void addListener(const void* listener, std::function<void(bool)> callback) const;
+		/*!
+		 \brief Unregisters the listener added with addListener().
+
+		 \param[in] listener The address identifying the listener
+
+		 \sa addListener()
+
+		 \since v0.7.0
+		*/
+		void removeListener(const void* listener) const;
+
+		// Public static method(s)
+		/*!
+		 \brief Creates the string containing every codepoint of the range [\a first, \a last].
+
+		 \param[in] first The first codepoint of the range
+		 \param[in] last The last codepoint of the range (included)
+
+		 \return The string containing the codepoints of the range
+
+		 \sa preload()
+
+		 \since v0.7.0
+		*/
+		_NODISCARD static std::u32string getCodepointRange(uint32_t first, uint32_t last);
+		/*!
+		 \brief Sets the memory resource from which the glyph pages of the fonts created afterwards are allocated.
+		 \details The resource must outlive every font created while it's set, a moved font keeping the resource of the font it was moved from.
+		 \note The fonts created beforehand keep allocating from their own resource.
+
+		 \param[in] resource The memory resource of the glyph pages, nullptr to allocate them from the default resource
+
+		 \par Example:
+		 \code
+		 // Attribute the fonts' pages to the text's tag
+		 static ae::TrackedResource pageResource(ae::MemoryTag::Text);
+		 ae::Font::setPageResource(&pageResource);
+		 \endcode
+
+		 \since v0.7.0
+		*/
+		static void setPageResource(std::pmr::memory_resource* resource) noexcept;
 	private:
 		// Private method(s)
 		/*!
@@ -208,9 +538,22 @@ namespace ae
 		 \since v0.5.0
 		*/
 		_NODISCARD PageItr createPage(unsigned int characterSize);
+		/*!
+		 \brief Retrieves the character size of the page storing the glyphs of the font size provided.
+
+		 \param[in] characterSize The font size requested
+
+		 \return The page's character size, the single rasterization size in the ae::Font::RenderMode::DistanceField mode
+
+		 \sa getGlyphScale()
+
+		 \since v0.7.0
+		*/
+		_NODISCARD unsigned int getPageSize(unsigned int characterSize) const noexcept;
 		/*!
 		 \brief Loads in the requested glyph to the appropriate page.
-		 \details Creates the ae::Glyph, assigns the metadata extracted, creates the individual texture and loads it into the texture atlas.
+		 \details Creates the ae::Glyph, assigns the metadata extracted and inserts its bitmap into the texture atlas.
+		 The listeners are only notified to update their texture coordinates if the texture atlas had to grow.
 
 		 \param[in] page The ae::Font::Page wherein the glyph will be stored
 		 \param[in] codepoint The unicode of the glyph to load in
@@ -223,19 +566,92 @@ namespace ae
 		*/
 		_NODISCARD GlyphItr loadGlyph(PageItr& page, uint32_t codepoint);
 		/*!
-		 \brief Packs all individual textures and assigns the packed positions to the glyphs' texture rects.
+		 \brief Creates the ae::Glyph described by the parameters provided within the page and inserts its bitmap into the texture atlas.
 
-		 \sa loadGlyph()
+		 \param[in] page The ae::Font::Page wherein the glyph will be stored
+		 \param[in] bitmap The glyph's metadata and tightly-packed bitmap
+		 \param[out] grown Set to true if the texture atlas had to grow, left untouched otherwise
 
-		 \since v0.6.0
+		 \return The iterator to the newly-created glyph
+
+		 \sa loadGlyph(), upload()
+
+		 \since v0.7.0
 		*/
-		void updateAtlasTexture();
+		GlyphItr storeGlyph(PageItr& page, const GlyphBitmap& bitmap, bool& grown);
+		/*!
+		 \brief Looks up the glyph corresponding to the \a key provided in the flat glyph cache.
+
+		 \param[in] key The page's character size in the upper 32 bits and the glyph's codepoint in the lower 32 bits
+
+		 \return The pointer to the cached glyph, nullptr if it hasn't been cached
+
+		 \sa cacheGlyph()
+
+		 \since v0.7.0
+		*/
+		_NODISCARD const Glyph* findCachedGlyph(uint64_t key) const noexcept;
+		/*!
+		 \brief Inserts the glyph into the flat glyph cache, growing the cache if necessary.
+
+		 \param[in] key The page's character size in the upper 32 bits and the glyph's codepoint in the lower 32 bits
+		 \param[in] glyph The pointer to the glyph stored within its page
+
+		 \sa findCachedGlyph()
+
+		 \since v0.7.0
+		*/
+		void cacheGlyph(uint64_t key, const Glyph* glyph);
+		/*!
+		 \brief Notifies the listeners that the texture atlas grew or that the font was reloaded.
+
+		 \param[in] reloaded Whether or not the font was reloaded, invalidating the glyphs
+
+		 \sa addListener()
+
+		 \since v0.7.0
+		*/
+		void notifyListeners(bool reloaded) const;
+		/*!
+		 \brief Inserts the batches of glyphs rasterized by the worker threads into the texture atlas.
+		 \details The jobs are waited upon once every batch requested has been inserted.
+
+		 \return True if every batch requested with rasterizeAsync() has been inserted, false otherwise
+
+		 \sa rasterizeAsync(), ae::FontManager::update()
+
+		 \since v0.7.0
+		*/
+		bool uploadRasterized();
+		/*!
+		 \brief Waits for the rasterization jobs in flight to complete.
+		 \details The batches rasterized are either inserted into the texture atlas or discarded.
+
+		 \param[in] upload Whether the batches are inserted into the atlas, they're discarded otherwise
+
+		 \sa rasterizeAsync()
+
+		 \since v0.7.0
+		*/
+		void finishRasterization(bool upload);
 
 	private:
 		// Private member(s)
-		std::map<unsigned int, Page> mPages;    //!< The hashmap of the glyph pages and their character size
-		TextureAtlas                 mAtlas;    //!< The texture atlas containing all individual glyph textures
-		std::string                  mFilename; //!< The filepath of the font
+		std::pmr::map<unsigned int, Page>                                      mPages;           //!< The hashmap of the glyph pages and their character size
+		TextureAtlas                                                           mAtlas;           //!< The texture atlas into which the glyphs' bitmaps are inserted
+		std::string                                                            mFilename;        //!< The filepath of the font
+		RenderMode                                                             mMode;            //!< The way in which the glyphs are rasterized
+		Face                                                                   mFace;            //!< The font file and the FreeType face shared by the glyph pages (released before the pages)
+		std::vector<std::pair<uint64_t, const Glyph*>>                         mGlyphCache;      //!< The open-addressing table of the glyphs retrieved, keyed by their page's size and codepoint
+		size_t                                                                 mGlyphCacheCount; //!< The number of glyphs stored within the glyph cache
+		mutable std::vector<std::pair<const void*, std::function<void(bool)>>> mListeners;       //!< The listeners notified when the texture atlas grows or when the font is reloaded
+		std::vector<GlyphBatch>                                                mRasterized;      //!< The batches rasterized by the worker threads, waiting to be inserted into the atlas
+		std::mutex                                                             mRasterMutex;     //!< The mutex protecting the batches rasterized, pushed by the worker threads
+		JobSystem::Job*                                                        mRasterJob;       //!< The parent job of the rasterization jobs in flight, nullptr if there are none
+		size_t                                                                 mPendingBatches;  //!< The number of batches requested that have yet to be inserted into the atlas
+
+		// Friend class(es)
+		friend class FontManager;
 	};
 }
 #endif // Aeon_Graphics_Font_H_
@@ -260,9 +676,16 @@ namespace ae
  \li .PFR
 
  It also internally handles font page creation which are the same glyphs
- (characters) in different sizes, and rendering individual glyph textures to an
- atlas texture which is dynamically created in order to reduce texture-swapping,
- therefore improving performance.
+ (characters) in different sizes, and inserting the glyphs' bitmaps into an
+ atlas texture which grows dynamically in order to reduce texture-swapping,
+ therefore improving performance. Each new glyph only uploads its own bitmap.
+
+ Large character sets can be rasterized by the worker threads with
+ rasterizeAsync(), each thread using its own FreeType library, the glyphs
+ being inserted into the atlas once per frame as their batches complete.
+
+ When AEON_HOT_RELOAD is enabled, the fonts whose file is modified are reloaded
+ in place by the ae::GLResourceFactory (see ae::GLResourceFactory::watchDirectory()).
 
  \author Filippos Gleglakos
  \version v0.6.0
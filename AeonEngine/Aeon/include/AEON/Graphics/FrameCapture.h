@@ -0,0 +1,370 @@
+// MIT License
+// 
+// Copyright(c) 2019-2021 Filippos Gleglakos
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef Aeon_Graphics_FrameCapture_H_
+#define Aeon_Graphics_FrameCapture_H_
+
+#include <yvals_core.h>
+#include <array>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdio>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <AEON/Config.h>
+#include <AEON/Math/Vector.h>
+
+namespace ae
+{
+	// Forward declaration(s)
+	class Buffer;
+
+	/*!
+	 \brief The singleton class used to capture screenshots and videos of the frames presented by the active window without stalling the GPU.
+	*/
+	class AEON_API FrameCapture
+	{
+	public:
+		/*!
+		 \brief The encoders to which the frames of a video are handed.
+		*/
+		enum class VideoEncoder
+		{
+			Raw,   //!< The RGBA8 frames are written back to back, top row first, without any header
+			FFmpeg //!< The RGBA8 frames are piped to an ffmpeg process (which has to be found in the PATH) that encodes them with H.264
+		};
+
+	public:
+		// Public constructor(s)
+		/*!
+		 \brief Deleted copy constructor.
+
+		 \since v0.7.0
+		*/
+		FrameCapture(const FrameCapture&) = delete;
+		/*!
+		 \brief Deleted move constructor.
+
+		 \since v0.7.0
+		*/
+		FrameCapture(FrameCapture&&) = delete;
+	public:
+		// Public operator(s)
+		/*!
+		 \brief Deleted assignment operator.
+
+		 \since v0.7.0
+		*/
+		FrameCapture& operator=(const FrameCapture&) = delete;
+		/*!
+		 \brief Deleted move assignment operator.
+
+		 \since v0.7.0
+		*/
+		FrameCapture& operator=(FrameCapture&&) = delete;
+	public:
+		// Public method(s)
+		/*!
+		 \brief Captures the next frame presented by the active window into a PNG file at the \a filepath provided.
+		 \details The frame is read back a few frames later and encoded by the encoder thread, so the file is written asynchronously.
+		 A screenshot requested while another one is pending replaces it.
+
+		 \param[in] filepath The filepath of the PNG file, an existing file is replaced
+
+		 \par Example:
+		 \code
+		 if (ae::InputManager::wasKeyPressed(ae::Keyboard::Key::F12)) {
+			ae::FrameCapture::getInstance().requestScreenshot("Screenshots/frame.png");
+		 }
+		 \endcode
+
+		 \sa startVideo()
+
+		 \since v0.7.0
+		*/
+		void requestScreenshot(const std::string& filepath);
+		/*!
+		 \brief Starts capturing every frame presented by the active window into a video at the \a filepath provided.
+		 \details The frames are read back a few frames late and handed to the encoder thread. A frame is dropped rather than stalling the GPU
+		 if every readback buffer is still in flight (see getDroppedFrameCount()).
+		 \note Every frame of the video should have the same size, the frames whose size differs from the first frame's are skipped.
+
+		 \param[in] filepath The filepath of the video, an existing file is replaced
+		 \param[in] encoder The ae::FrameCapture::VideoEncoder to which the frames are handed, ae::FrameCapture::VideoEncoder::FFmpeg by default
+		 \param[in] frameRate The frame rate stored in the encoded video, 60 by default
+
+		 \return True if the capture started, false if a video is already being captured
+
+		 \par Example:
+		 \code
+		 ae::FrameCapture& capture = ae::FrameCapture::getInstance();
+		 capture.startVideo("gameplay.mp4");
+		 ...
+		 capture.stopVideo();
+		 \endcode
+
+		 \sa stopVideo(), requestScreenshot()
+
+		 \since v0.7.0
+		*/
+		bool startVideo(const std::string& filepath, VideoEncoder encoder = VideoEncoder::FFmpeg, int frameRate = 60);
+		/*!
+		 \brief Stops capturing the frames, the video being completed once the frames still in flight have been encoded.
+
+		 \sa startVideo()
+
+		 \since v0.7.0
+		*/
+		void stopVideo();
+		/*!
+		 \brief Reads back the frame about to be presented if a screenshot or a video is being captured, and hands the frames read back beforehand to the encoder thread.
+		 \details The framebuffer's color buffer is copied into a pixel pack buffer that's fenced, it's only mapped once the GPU has completed the copy.
+		 \note This method is automatically called by the ae::Window before its buffers are swapped.
+
+		 \param[in] framebuffer The handle of the framebuffer to read, 0 for the window's own backbuffer
+		 \param[in] size The size of the framebuffer in pixels
+
+		 \since v0.7.0
+		*/
+		void captureFrame(unsigned int framebuffer, const Vector2i& size);
+		/*!
+		 \brief Waits for the frames in flight, completes the video being captured, stops the encoder thread and deletes the pixel pack buffers.
+		 \note This method is automatically called by the ae::Application once the window is closed.
+
+		 \since v0.7.0
+		*/
+		void destroy();
+		/*!
+		 \brief Checks whether a video is being captured.
+
+		 \return True if the frames are being captured into a video, false otherwise
+
+		 \since v0.7.0
+		*/
+		_NODISCARD bool isCapturingVideo() const noexcept;
+		/*!
+		 \brief Retrieves the number of frames of the video being captured that were handed to the encoder thread.
+
+		 \return The number of frames captured since the last call to startVideo()
+
+		 \sa getDroppedFrameCount()
+
+		 \since v0.7.0
+		*/
+		_NODISCARD uint64_t getCapturedFrameCount() const noexcept;
+		/*!
+		 \brief Retrieves the number of frames of the video being captured that were dropped as every readback buffer was still in flight.
+
+		 \return The number of frames dropped since the last call to startVideo()
+
+		 \sa getCapturedFrameCount()
+
+		 \since v0.7.0
+		*/
+		_NODISCARD uint64_t getDroppedFrameCount() const noexcept;
+
+		// Public static method(s)
+		/*!
+		 \brief Retrieves the single instance of the ae::FrameCapture.
+
+		 \return The single instance of the ae::FrameCapture
+
+		 \since v0.7.0
+		*/
+		_NODISCARD static FrameCapture& getInstance();
+	private:
+		// Private enum(s)
+		/*!
+		 \brief The kinds of work handed to the encoder thread.
+		*/
+		enum class Task
+		{
+			Frame,      //!< A frame read back, encoded into a screenshot and/or the video
+			VideoStart, //!< The start of a video, its encoder being created with its first frame
+			VideoEnd    //!< The end of the video, its encoder being closed
+		};
+
+		// Private struct(s)
+		/*!
+		 \brief The internal struct representing a copy of the framebuffer in flight.
+		*/
+		struct Readback
+		{
+			std::shared_ptr<Buffer> buffer;     //!< The pixel pack buffer receiving the copy
+			void*                   fence;      //!< The fence placed after the copy, nullptr if the readback isn't in flight
+			Vector2i                size;       //!< The size of the copy in pixels
+			int                     capacity;   //!< The size in bytes of the pixel pack buffer's storage
+			std::string             screenshot; //!< The filepath of the screenshot, empty if the frame isn't a screenshot
+			bool                    video;      //!< Whether the frame belongs to the video
+		};
+		/*!
+		 \brief The internal struct representing the work handed to the encoder thread, recycled once it's completed.
+		*/
+		struct EncoderTask
+		{
+			Task                 task;      //!< The kind of work
+			std::vector<uint8_t> pixels;    //!< The RGBA8 pixels of the frame, bottom row first
+			Vector2i             size;      //!< The size of the frame in pixels
+			std::string          filepath;  //!< The filepath of the screenshot (empty if the frame isn't one) or of the video started
+			bool                 video;     //!< Whether the frame belongs to the video
+			VideoEncoder         encoder;   //!< The encoder of the video started
+			int                  frameRate; //!< The frame rate of the video started
+		};
+
+	private:
+		// Private constructor(s)
+		/*!
+		 \brief Default constructor.
+		 \details The encoder thread is only started once a capture is requested.
+
+		 \since v0.7.0
+		*/
+		FrameCapture();
+		/*!
+		 \brief Destructor.
+		 \details Completes the video being captured and stops the encoder thread.
+
+		 \since v0.7.0
+		*/
+		~FrameCapture();
+
+		// Private method(s)
+		/*!
+		 \brief Hands the frames whose copies have completed to the encoder thread, in the order in which they were read back.
+
+		 \param[in] wait True to wait for every copy in flight, false to only retrieve the completed ones
+
+		 \since v0.7.0
+		*/
+		void retrieveReadbacks(bool wait);
+		/*!
+		 \brief Retrieves a recycled task for the encoder thread, or a new one if none is available.
+
+		 \param[in] task The kind of work
+
+		 \return The encoder task
+
+		 \since v0.7.0
+		*/
+		_NODISCARD std::unique_ptr<EncoderTask> acquireTask(Task task);
+		/*!
+		 \brief Hands a \a task to the encoder thread, which is started if it isn't running.
+
+		 \param[in] task The encoder task
+
+		 \since v0.7.0
+		*/
+		void submitTask(std::unique_ptr<EncoderTask> task);
+		/*!
+		 \brief Waits for the encoder thread to complete every task handed to it and stops it.
+
+		 \since v0.7.0
+		*/
+		void stopEncoderThread();
+		/*!
+		 \brief The encoder thread's loop, which encodes the tasks handed to it until it's requested to stop.
+
+		 \since v0.7.0
+		*/
+		void encodeTasks();
+		/*!
+		 \brief Encodes a \a task on the encoder thread.
+
+		 \param[in] task The encoder task
+
+		 \since v0.7.0
+		*/
+		void encode(EncoderTask& task);
+		/*!
+		 \brief Closes the video's output on the encoder thread.
+
+		 \since v0.7.0
+		*/
+		void closeVideo();
+
+	private:
+		// Private static member(s)
+		static constexpr size_t READBACK_COUNT = 3; //!< The number of readbacks in flight, which is the number of frames by which the frames are read back late
+
+		// Private member(s)
+		std::array<Readback, READBACK_COUNT>      mReadbacks;      //!< The ring of readbacks
+		size_t                                    mFirstReadback;  //!< The index of the oldest readback in flight
+		size_t                                    mReadbackCount;  //!< The number of readbacks in flight
+		std::string                               mScreenshot;     //!< The filepath of the screenshot requested, empty if there is none
+		bool                                      mVideo;          //!< Whether a video is being captured
+		bool                                      mVideoEnding;    //!< Whether the video was stopped and its frames in flight have yet to be handed over
+		uint64_t                                  mCapturedFrames; //!< The number of frames of the video handed to the encoder thread
+		uint64_t                                  mDroppedFrames;  //!< The number of frames of the video dropped
+		std::thread                               mEncoderThread;  //!< The thread encoding the frames
+		std::deque<std::unique_ptr<EncoderTask>>  mTasks;          //!< The tasks waiting to be encoded
+		std::vector<std::unique_ptr<EncoderTask>> mFreeTasks;      //!< The completed tasks, recycled along with their pixel storage
+		std::mutex                                mMutex;          //!< The mutex protecting the tasks
+		std::condition_variable                   mCondition;      //!< The condition on which the encoder thread waits for tasks
+		bool                                      mEncoderExit;    //!< Whether the encoder thread was requested to stop
+		std::FILE*                                mVideoOutput;    //!< The video's file or the pipe to the ffmpeg process (encoder thread only)
+		std::string                               mVideoPath;      //!< The filepath of the video started (encoder thread only)
+		VideoEncoder                              mVideoEncoder;   //!< The encoder of the video started (encoder thread only)
+		int                                       mVideoFrameRate; //!< The frame rate of the video started (encoder thread only)
+		Vector2i                                  mVideoSize;      //!< The size of the video's frames (encoder thread only)
+	};
+}
+#endif // Aeon_Graphics_FrameCapture_H_
+
+/*!
+ \class ae::FrameCapture
+ \ingroup graphics
+
+ The ae::FrameCapture singleton class captures screenshots and videos of the
+ frames presented by the active window (including headless windows) without
+ stalling the GPU, unlike a direct glReadPixels() of the window's framebuffer.
+
+ Each frame captured is copied into one of a ring of pixel pack buffers whose
+ copy is fenced, the buffer only being mapped a few frames later once the GPU
+ has completed the copy. The pixels are then handed to an encoder thread which
+ writes the screenshots as PNG files and the videos as raw frames or through a
+ pipe to an ffmpeg process, the pixel storage being recycled from a pool once
+ it's encoded. A video frame is dropped rather than waiting on the GPU when
+ every buffer is still in flight.
+
+ Usage example:
+ \code
+ ae::FrameCapture& capture = ae::FrameCapture::getInstance();
+
+ // Capture a regression frame
+ capture.requestScreenshot("Regression/menu.png");
+
+ // Record gameplay footage
+ capture.startVideo("gameplay.mp4", ae::FrameCapture::VideoEncoder::FFmpeg, 60);
+ ...
+ capture.stopVideo();
+ \endcode
+
+ \author Filippos Gleglakos
+ \version v0.7.0
+ \date 2021.07.05
+ \copyright MIT License
+*/
\ No newline at end of file
@@ -25,16 +25,25 @@
 
 #include <memory>
 #include <unordered_map>
+#include <map>
+#include <tuple>
+#include <deque>
+#include <vector>
+#include <mutex>
 
 #include <AEON/Graphics/internal/GLResource.h>
+#include <AEON/Graphics/internal/Buffer.h>
 #include <AEON/Graphics/internal/VertexArray.h>
 #include <AEON/Graphics/internal/UniformBuffer.h>
+#include <AEON/Graphics/internal/ShaderStorageBuffer.h>
 #include <AEON/Graphics/internal/VertexBuffer.h>
 #include <AEON/Graphics/internal/IndexBuffer.h>
 #include <AEON/Graphics/internal/Framebuffer.h>
 #include <AEON/Graphics/Texture.h>
 #include <AEON/Graphics/Texture2D.h>
+#include <AEON/Graphics/Sampler.h>
 #include <AEON/Graphics/Shader.h>
+#include <AEON/System/FileWatcher.h>
 
 namespace ae
 {
@@ -44,25 +53,60 @@ namespace ae
 	*/
 	class AEON_API GLResourceFactory
 	{
-	private:
-		// Private enumeration(s)
+	public:
+		// Public enumeration(s)
 		/*!
 		 \brief The enumeration of all ae::GLResource types available.
+		 \details The resources' video memory is aggregated by type, see getMemoryUsage().
 		*/
 		enum class ResourceType
 		{
-			Shader,     //!< The shader program type
-			VAO,        //!< The vertex array object type
-			VBO,        //!< The vertex buffer object type
-			IBO,        //!< The index buffer object type
-			UBO,        //!< The uniform buffer object type
-			Texture,    //!< The texture object type
-			Framebuffer //!< The framebuffer object type
+			Shader,      //!< The shader program type
+			VAO,         //!< The vertex array object type
+			VBO,         //!< The vertex buffer object type
+			IBO,         //!< The index buffer object type
+			UBO,         //!< The uniform buffer object type
+			Texture,     //!< The texture object type
+			Framebuffer, //!< The framebuffer object type
+			PBO,         //!< The pixel buffer object type
+			SSBO         //!< The shader storage buffer object type
 		};
 	private:
 		// Private typedef(s)
 		using ResourceMap = std::unordered_map<std::string, std::shared_ptr<GLResource>>; //!< A hashmap containing all GLResource objects of a certain type with an associated name
 
+	public:
+		// Public struct(s)
+		/*!
+		 \brief The struct representing a pooled framebuffer and the textures attached to it.
+		*/
+		struct AEON_API RenderTargetAttachments
+		{
+			std::shared_ptr<Framebuffer> framebuffer;  //!< The framebuffer object
+			std::shared_ptr<Texture2D>   color;        //!< The color buffer texture
+			std::shared_ptr<Texture2D>   depth;        //!< The depth/stencil buffer texture, nullptr if none was requested or if the render target is multisampled
+			std::shared_ptr<Texture2D>   stencil;      //!< The stencil buffer texture, nullptr if none was requested or if the render target is multisampled
+			std::shared_ptr<Framebuffer> multisampled; //!< The multisampled framebuffer rendered into and resolved into the color buffer texture, nullptr if the render target isn't multisampled
+		};
+		/*!
+		 \brief The struct representing the estimated video memory occupied by a group of resources.
+		*/
+		struct AEON_API MemoryUsage
+		{
+			size_t bytes; //!< The estimated size in bytes of the resources' storage
+			size_t count; //!< The number of resources
+		};
+		/*!
+		 \brief The struct representing the video memory reported by the driver.
+		 \details The values are only available on the drivers exposing the GL_NVX_gpu_memory_info or the GL_ATI_meminfo extension.
+		*/
+		struct AEON_API VideoMemoryInfo
+		{
+			size_t total;     //!< The dedicated video memory in bytes, 0 if unknown (GL_ATI_meminfo doesn't report it)
+			size_t available; //!< The currently available video memory in bytes, 0 if unknown
+			bool   supported; //!< Whether the driver reports its video memory
+		};
+
 	public:
 		// Public constructor(s)
 		/*!
@@ -130,7 +174,9 @@ namespace ae
 		_NODISCARD std::enable_if_t<std::is_base_of_v<GLResource, T>, std::shared_ptr<T>> create(const std::string& name, Args&&... args);
 		/*!
 		 \brief Retrieves a previously-created shared_ptr to a ae::GLResource derived type that's stored in the ae::GLResourceFactory instance.
+		 \details The resource is looked up within the hashmap of its type and isn't cast at runtime (the cast is only verified in Debug mode).
 		 \note If the same \a name is associated with two resources of a different type, the template type should be provided to ensure the correct resource is retrieved.
+		 The lookup hashes the \a name, so the resources used every frame should be retrieved once and kept.
 
 		 \param[in] name The name associated with the resource created
 
@@ -162,19 +208,33 @@ namespace ae
 		_NODISCARD std::shared_ptr<T> get(const std::string& name);
 
 		/*!
-		 \brief Destroys all unused OpenGL resources.
+		 \brief Queues all unused OpenGL resources for destruction.
+		 \details The unused resources are removed from the hashmaps right away, but their OpenGL objects are only deleted by update() a few frames later, once the GPU has completed the commands that may still read from them.
 		 \note Should be used whenever the application's state changes.
 
+		 \sa update()
+
 		 \since v0.4.0
 		*/
 		void destroyUnused();
 		/*!
-		 \brief Destroys all stored OpenGL resources.
+		 \brief Destroys the queued OpenGL resources that the GPU no longer uses.
+		 \details The pooled render targets that weren't borrowed for a few seconds are queued for destruction.\n
+		 The shaders, textures and fonts whose file was modified in a watched directory are also reloaded.
+		 \note This method is automatically called once per frame by the ae::Application.
+
+		 \sa destroyUnused(), watchDirectory()
+
+		 \since v0.7.0
+		*/
+		void update();
+		/*!
+		 \brief Destroys all stored OpenGL resources, including the ones queued for destruction and the pooled render targets.
 		 \details Typically used at the termination of the application.
 
 		 \since v0.4.0
 		*/
-		void destroy() const;
+		void destroy();
 		/*!
 		 \brief Attempts to reload all stored OpenGL resources that need to be reloaded after an OpenGL context change.
 		 \note This method is automatically called when the window's OpenGL context is destroyed.
@@ -182,6 +242,200 @@ namespace ae
 		 \since v0.4.0
 		*/
 		void reload();
+		/*!
+		 \brief Watches the \a directory provided and its subdirectories so that the assets modified within are reloaded in place.
+		 \details The shaders and the 2D textures created by the factory, as well as the fonts, whose file is modified are reloaded by update().
+		 A shader whose new sources fail to compile keeps its previous program.
+		 \note Only available when AEON_HOT_RELOAD is enabled (in Debug mode by default), does nothing otherwise.
+
+		 \param[in] directory The directory containing the assets
+
+		 \return True if the directory is now being watched, false otherwise
+
+		 \par Example:
+		 \code
+		 ae::GLResourceFactory::getInstance().watchDirectory("Assets");
+		 \endcode
+
+		 \sa update()
+
+		 \since v0.7.0
+		*/
+		bool watchDirectory(const std::string& directory);
+		/*!
+		 \brief Retrieves the immutable list of indices of \a quadCount quads shared by all renderables.
+		 \details Each quad is formed by 4 vertices and 2 triangles (0, 1, 2, 0, 2, 3), the indices of the following quad being offset by 4.
+		 The list is generated once per quad count, it's meant to be provided to ae::Renderable2D::setSharedIndices() by renderables of a fixed topology.\n
+		 The engine-owned static index buffer "_AEON_QuadListIBO" contains the same pattern for up to 16384 quads (65536 vertices), the batches made up exclusively of quads are drawn from it instead of uploading their indices.
+		 \note This method may be called concurrently by several threads.
+
+		 \param[in] quadCount The number of quads
+
+		 \return The shared list of 6 * \a quadCount indices
+
+		 \par Example:
+		 \code
+		 // Share the indices of a single quad
+		 setSharedIndices(ae::GLResourceFactory::getInstance().getQuadIndices(1));
+		 \endcode
+
+		 \since v0.7.0
+		*/
+		_NODISCARD std::shared_ptr<const std::vector<unsigned int>> getQuadIndices(size_t quadCount);
+		/*!
+		 \brief Retrieves the sampler applying the filter type and the wrapping mode provided.
+		 \details A single sampler is created per combination, it's destroyed alongside the other resources once the context is destroyed.
+		 The sampler is meant to be provided through ae::RenderStates::sampler so that a texture may be rendered with several filters without being duplicated.
+
+		 \param[in] filter The ae::Texture::Filter applied to the textures sampled
+		 \param[in] wrap The ae::Texture::Wrap mode applied to the textures sampled
+
+		 \return The ae::Sampler applying the filter type and the wrapping mode
+
+		 \par Example:
+		 \code
+		 // Render the texture with nearest filtering without modifying its own filter
+		 ae::RenderStates states;
+		 states.sampler = &ae::GLResourceFactory::getInstance().getSampler(ae::Texture::Filter::Nearest, ae::Texture::Wrap::ClampToEdge);
+		 \endcode
+
+		 \sa ae::Sampler
+
+		 \since v0.7.0
+		*/
+		_NODISCARD const Sampler& getSampler(Texture::Filter filter, Texture::Wrap wrap);
+		/*!
+		 \brief Registers the source code of an uber shader from which the variants of the \a name provided will be compiled.
+		 \details No shader is compiled until a variant is requested through getShaderVariant(). Registering sources of a name already registered replaces them for the variants not yet compiled.
+
+		 \param[in] name The name of the uber shader
+		 \param[in] sources The source code of each shader stage, specialised by the ae::Shader::Feature defines
+		 \param[in] layout The ae::VertexBuffer::Layout of the variants' attributes
+		 \param[in] instancedLayout The ae::VertexBuffer::Layout of the variants with the ae::Shader::Instanced feature, empty by default
+
+		 \par Example:
+		 \code
+		 ae::GLResourceFactory& glResourceFactory = ae::GLResourceFactory::getInstance();
+
+		 // Register the uber shader, its variants share the same attributes
+		 ae::VertexBuffer::Layout layout;
+		 layout.addElement(GL_FLOAT, 3, GL_FALSE);
+		 layout.addElement(GL_FLOAT, 4, GL_FALSE);
+		 layout.addElement(GL_FLOAT, 2, GL_FALSE);
+		 glResourceFactory.registerShaderVariants("Water", { { ae::Shader::StageType::Vertex, vertSource }, { ae::Shader::StageType::Fragment, fragSource } }, layout);
+		 \endcode
+
+		 \sa getShaderVariant()
+
+		 \since v0.7.0
+		*/
+		void registerShaderVariants(const std::string& name, const std::map<Shader::StageType, std::string>& sources, const VertexBuffer::Layout& layout,
+		                            const VertexBuffer::Layout& instancedLayout = VertexBuffer::Layout());
+		/*!
+		 \brief Retrieves the variant of the uber shader \a name specialised with the \a features provided, compiling it on demand.
+		 \details The variant's shader stages receive the defines of the features (see ae::Shader::getFeatureDefines()) and it's attached to the transform uniform buffer, its link being deferred.
+		 The variants are stored like any other shader, so they're reloaded with the context, their program binary is cached (each combination of defines has its own binary) and they're destroyed by destroyUnused() once they're no longer referenced.\n
+		 A variant is named after the uber shader and its features (\"name#features\") unless the \a variantName provided the first time it's requested.\n
+		 Each variant has its own compact ID (see ae::Shader::getID()) which the renderers' sort keys use to group the draws of the same variant.
+
+		 \param[in] name The name of the uber shader registered with registerShaderVariants()
+		 \param[in] features The combination of ae::Shader::Feature flags
+		 \param[in] variantName The name under which the variant is created if it hasn't been yet, empty by default
+
+		 \return The variant's ae::Shader, nullptr if the uber shader hasn't been registered
+
+		 \par Example:
+		 \code
+		 // Retrieve the textured sprite shader drawing outlines
+		 std::shared_ptr<ae::Shader> shader = ae::GLResourceFactory::getInstance().getShaderVariant("_AEON_Sprite2D", ae::Shader::Textured | ae::Shader::VertexColor | ae::Shader::Outline);
+		 shader->setUniform("uOutlineSize", 0.002f);
+		 shader->setUniform("uOutlineColor", ae::Color::Black.normalize());
+		 \endcode
+
+		 \sa registerShaderVariants()
+
+		 \since v0.7.0
+		*/
+		_NODISCARD std::shared_ptr<Shader> getShaderVariant(const std::string& name, uint32_t features, const std::string& variantName = "");
+		/*!
+		 \brief Borrows a framebuffer with its attached textures of the dimensions and formats provided from the pool of render targets.
+		 \details A pooled render target is borrowed for as long as the attachments returned are referenced, it's returned to the pool once they're released.
+		 The render targets that remain in the pool for a few seconds are queued for destruction by update(), like the resources released by destroyUnused().
+		 A multisampled render target renders into the multisampled renderbuffers of a second framebuffer, only its color buffer being resolved into the texture.
+		 \note The textures' contents are undefined once borrowed, this is used by ae::RenderTexture::create().
+
+		 \param[in] size The dimensions of the textures
+		 \param[in] colorFormat The ae::Texture2D::InternalFormat of the color buffer
+		 \param[in] depthFormat The ae::Texture2D::InternalFormat of the depth buffer, ae::Texture2D::InternalFormat::Native for none
+		 \param[in] stencilFormat The ae::Texture2D::InternalFormat of the stencil buffer, ae::Texture2D::InternalFormat::Native for none
+		 \param[in] sampleCount The number of samples per pixel, the render target is multisampled if it's greater than 1 (1 by default)
+
+		 \return The borrowed ae::GLResourceFactory::RenderTargetAttachments, their framebuffer being nullptr if the textures couldn't be created
+
+		 \sa update()
+
+		 \since v0.7.0
+		*/
+		_NODISCARD RenderTargetAttachments acquireRenderTarget(const Vector2i& size, Texture2D::InternalFormat colorFormat,
+		                                                       Texture2D::InternalFormat depthFormat, Texture2D::InternalFormat stencilFormat, int sampleCount = 1);
+		/*!
+		 \brief Estimates the video memory occupied by the stored resources of the \a type provided.
+		 \details Each resource's size is given by ae::GLResource::getMemorySize(): the 2D textures' storage (mip levels included), the buffers' data stores and the framebuffers' multisampled renderbuffers.
+		 The pooled render targets are included, their textures as ae::GLResourceFactory::ResourceType::Texture and their framebuffers as ae::GLResourceFactory::ResourceType::Framebuffer.
+		 The resources queued for destruction are only included in the total returned by the overload without parameters.
+		 \note The estimation traverses every resource of the type, it's meant to be retrieved periodically rather than several times per frame.
+
+		 \param[in] type The ae::GLResourceFactory::ResourceType of the resources
+
+		 \return The ae::GLResourceFactory::MemoryUsage of the resources of the \a type provided
+
+		 \par Example:
+		 \code
+		 // Keep the textures within the platform's budget
+		 const ae::GLResourceFactory::MemoryUsage TEXTURES = ae::GLResourceFactory::getInstance().getMemoryUsage(ae::GLResourceFactory::ResourceType::Texture);
+		 if (TEXTURES.bytes > TEXTURE_BUDGET) {
+			...
+		 }
+		 \endcode
+
+		 \sa getMemoryUsageByName(), queryVideoMemory()
+
+		 \since v0.7.0
+		*/
+		_NODISCARD MemoryUsage getMemoryUsage(ResourceType type) const;
+		/*!
+		 \brief Estimates the video memory occupied by all the resources created by the ae::GLResourceFactory.
+		 \details The resources queued for destruction, whose storage hasn't yet been released, are included.
+
+		 \return The ae::GLResourceFactory::MemoryUsage of all the resources
+
+		 \sa getMemoryUsageByName(), queryVideoMemory()
+
+		 \since v0.7.0
+		*/
+		_NODISCARD MemoryUsage getMemoryUsage() const;
+		/*!
+		 \brief Estimates the video memory occupied by each stored resource of the \a type provided.
+		 \details The anonymous resources are listed under the identifier generated by create(), the pooled render targets are aggregated under "_AEON_RenderTargetPool".
+
+		 \param[in] type The ae::GLResourceFactory::ResourceType of the resources
+
+		 \return The resources' names and estimated sizes in bytes, from largest to smallest
+
+		 \par Example:
+		 \code
+		 // List the five largest textures
+		 const auto TEXTURES = ae::GLResourceFactory::getInstance().getMemoryUsageByName(ae::GLResourceFactory::ResourceType::Texture);
+		 for (size_t i = 0; i < std::min<size_t>(TEXTURES.size(), 5); ++i) {
+			std::cout << TEXTURES[i].first << ": " << TEXTURES[i].second / 1024 << " KiB\n";
+		 }
+		 \endcode
+
+		 \sa getMemoryUsage()
+
+		 \since v0.7.0
+		*/
+		_NODISCARD std::vector<std::pair<std::string, size_t>> getMemoryUsageByName(ResourceType type) const;
 
 		// Public static method(s)
 		/*!
@@ -197,6 +451,60 @@ namespace ae
 		 \since v0.4.0
 		*/
 		_NODISCARD static GLResourceFactory& getInstance() noexcept;
+		/*!
+		 \brief Queries the video memory reported by the driver.
+		 \details The GL_NVX_gpu_memory_info extension (NVIDIA) reports the dedicated and the available memory, the GL_ATI_meminfo extension (AMD) only reports the memory available for textures.
+		 The available memory accounts for the other applications' allocations as well, so it's meant to be compared to the budget that the application's estimation has to remain within.
+
+		 \return The ae::GLResourceFactory::VideoMemoryInfo, not supported if the driver exposes neither extension
+
+		 \par Example:
+		 \code
+		 // Give the textures half of the video memory still available on startup
+		 const ae::GLResourceFactory::VideoMemoryInfo VIDEO_MEMORY = ae::GLResourceFactory::queryVideoMemory();
+		 if (VIDEO_MEMORY.supported) {
+			ae::TextureResidency::getInstance().setBudget(VIDEO_MEMORY.available / 2);
+		 }
+		 \endcode
+
+		 \sa getMemoryUsage()
+
+		 \since v0.7.0
+		*/
+		_NODISCARD static VideoMemoryInfo queryVideoMemory();
+	private:
+		// Private struct(s)
+		/*!
+		 \brief The internal struct representing the resources queued by a single call to destroyUnused().
+		*/
+		struct PendingDeletion
+		{
+			std::vector<std::shared_ptr<GLResource>> resources; //!< The resources to destroy
+			void*                                    fence;     //!< The fence placed after the last commands that may use the resources
+			uint64_t                                 frame;     //!< The index of the frame during which the resources were queued
+		};
+		/*!
+		 \brief The internal struct representing a render target of the pool.
+		*/
+		struct PooledRenderTarget
+		{
+			RenderTargetAttachments attachments; //!< The framebuffer and its attached textures
+			uint64_t                freeSince;   //!< The index of the frame since which the render target isn't borrowed, 0 if it's borrowed
+		};
+		/*!
+		 \brief The internal struct representing an uber shader registered with registerShaderVariants().
+		*/
+		struct ShaderVariants
+		{
+			std::map<Shader::StageType, std::string>  sources;         //!< The source code of each shader stage
+			VertexBuffer::Layout                      layout;          //!< The layout of the variants' attributes
+			VertexBuffer::Layout                      instancedLayout; //!< The layout of the instanced variants' attributes
+			std::unordered_map<uint32_t, std::string> names;           //!< The names of the variants compiled, indexed by their features
+		};
+
+		// Private typedef(s)
+		using RenderTargetKey = std::tuple<int, int, Texture2D::InternalFormat, Texture2D::InternalFormat, Texture2D::InternalFormat, int>; //!< The dimensions, formats and sample count of a pooled render target
+
 	private:
 		// Private constructor(s)
 		/*!
@@ -223,10 +531,49 @@ namespace ae
 		*/
 		template <class T>
 		_NODISCARD ResourceMap* const getResourceMap();
+		/*!
+		 \brief Reloads the shaders, textures and fonts whose file was modified since the last call.
+
+		 \since v0.7.0
+		*/
+		void reloadModifiedAssets();
+		/*!
+		 \brief Queues the pooled render targets that weren't borrowed for a few seconds for destruction.
+
+		 \since v0.7.0
+		*/
+		void trimRenderTargetPool();
+		/*!
+		 \brief Adds the video memory occupied by the pooled render targets' resources of the \a type provided to the \a usage.
+
+		 \param[in] type The ae::GLResourceFactory::ResourceType of the resources, only the textures and the framebuffers are pooled
+		 \param[out] usage The ae::GLResourceFactory::MemoryUsage to which the pooled resources will be added
+
+		 \since v0.7.0
+		*/
+		void accumulatePoolMemory(ResourceType type, MemoryUsage& usage) const;
+		/*!
+		 \brief Checks if a pooled render target is borrowed, that is, if its attachments are referenced outside of the pool.
+
+		 \param[in] renderTarget The ae::GLResourceFactory::PooledRenderTarget that will be checked
+
+		 \return True if the render target is borrowed, false otherwise
+
+		 \since v0.7.0
+		*/
+		_NODISCARD static bool isBorrowed(const PooledRenderTarget& renderTarget) noexcept;
 
 	private:
 		// Private member(s)
-		std::unordered_map<ResourceType, ResourceMap> mResourceMaps; //!< The hashmap containing the hashmaps of all GLResource objects of a certain type
+		std::unordered_map<ResourceType, ResourceMap>                                 mResourceMaps;   //!< The hashmap containing the hashmaps of all GLResource objects of a certain type
+		std::deque<PendingDeletion>                                                   mDeletionQueue;  //!< The resources waiting for the GPU to complete before being destroyed, from oldest to newest
+		std::unordered_map<size_t, std::shared_ptr<const std::vector<unsigned int>>>  mQuadIndices;    //!< The shared lists of quad indices, indexed by their quad count
+		std::mutex                                                                    mQuadIndexMutex; //!< The mutex protecting the shared lists of quad indices
+		uint64_t                                                                      mFrame;          //!< The index of the current frame
+		FileWatcher                                                                   mFileWatcher;    //!< The watcher of the asset directories (see watchDirectory())
+		std::map<RenderTargetKey, std::vector<PooledRenderTarget>>                    mRenderTargets;  //!< The pooled render targets, bucketed by their dimensions, formats and sample count
+		std::map<std::pair<Texture::Filter, Texture::Wrap>, std::unique_ptr<Sampler>> mSamplers;       //!< The samplers created, indexed by their filter type and wrapping mode
+		std::unordered_map<std::string, ShaderVariants>                               mShaderVariants; //!< The uber shaders registered, indexed by their name
 	};
 }
 #include <AEON/Graphics/GLResourceFactory.inl>
@@ -241,7 +588,26 @@ namespace ae
  objects, ae::Shader objects, ae::UniformBuffer objects, etc.
 
  It contains several pre-compiled ae::Shader objects that represent the most
- common shaders that can be used by the API user.
+ common shaders that can be used by the API user. Most of the 2D ones are
+ variants of the \"_AEON_Sprite2D\" uber shader, whose other variants (like
+ the outlined sprites) are compiled on demand by getShaderVariant().
+
+ It also owns the immutable lists of indices shared by the renderables of the
+ same topology: the quad lists (see getQuadIndices()) and the static index
+ buffer "_AEON_QuadListIBO" from which the batches of quads are drawn.
+
+ The unused resources are destroyed in a deferred manner: they're queued
+ along with a fence and their OpenGL objects are only deleted a few frames
+ later, once the GPU has completed the commands that may still use them.
+
+ When AEON_HOT_RELOAD is enabled, the directories provided to watchDirectory()
+ are watched and the shaders, textures and fonts whose file is modified are
+ reloaded in place, so the objects referring to them don't need to be updated.
+
+ The video memory occupied by the resources is estimated by type and by name
+ (see getMemoryUsage() and getMemoryUsageByName()) and may be compared to the
+ memory reported by the driver (see queryVideoMemory()) in order to enforce a
+ per-platform budget. The ae::GPUProfiler's overlay displays these figures.
 
  \author Filippos Gleglakos
  \version v0.4.0
@@ -34,7 +34,7 @@ namespace ae
 			auto resource = std::make_shared<T>(std::forward<Args>(args)...);
 			const std::string NAME = (name.empty()) ? std::to_string(reinterpret_cast<uint64_t>(resource.get())) + std::to_string(resource->getHandle()) : name;
 
-			return std::dynamic_pointer_cast<T>(resourceMap->try_emplace(NAME, std::move(resource)).first->second);
+			return std::static_pointer_cast<T>(resourceMap->try_emplace(NAME, std::move(resource)).first->second);
 		}
 		return nullptr;
 	}
@@ -49,7 +49,15 @@ namespace ae
 		if (resourceMap) {
 			auto found = resourceMap->find(name);
 			if (found != resourceMap->end()) {
-				return std::dynamic_pointer_cast<T>(found->second);
+				// Check that the resource is of the type requested as the hashmaps of some types store derived types (ignored in Release mode)
+				if _CONSTEXPR_IF (AEON_DEBUG) {
+					if (!std::dynamic_pointer_cast<T>(found->second)) {
+						AEON_LOG_ERROR("Invalid resource type", "The resource \"" + name + "\" isn't of the type requested.\nReturning nullptr.");
+						return nullptr;
+					}
+				}
+
+				return std::static_pointer_cast<T>(found->second);
 			}
 		}
 		return nullptr;
@@ -81,6 +89,12 @@ namespace ae
 		else if (std::is_same_v<Framebuffer, T>) {
 			resourceMap = &mResourceMaps[ResourceType::Framebuffer];
 		}
+		else if (std::is_same_v<Buffer, T>) {
+			resourceMap = &mResourceMaps[ResourceType::PBO];
+		}
+		else if (std::is_same_v<ShaderStorageBuffer, T>) {
+			resourceMap = &mResourceMaps[ResourceType::SSBO];
+		}
 
 		return resourceMap;
 	}
@@ -0,0 +1,411 @@
+// MIT License
+// 
+// Copyright(c) 2019-2021 Filippos Gleglakos
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#ifndef Aeon_Graphics_GPUProfiler_H_
+#define Aeon_Graphics_GPUProfiler_H_
+
+#include <array>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <AEON/Config.h>
+#include <AEON/System/Time.h>
+
+// Define the profiling macro
+#define AEON_PROFILE_GPU_SCOPE(name) ae::GPUProfiler::Scope AEON_CONCAT(aeonGPUScope, __LINE__)(name)
+
+namespace ae
+{
+	// Forward declaration(s)
+	class Font;
+	class RectangleShape;
+	class RenderTarget;
+	class Text;
+
+	/*!
+	 \brief Singleton class used to measure the time spent by the GPU on named sections of a frame.
+	*/
+	class AEON_API GPUProfiler
+	{
+	public:
+		// Public struct(s)
+		/*!
+		 \brief The struct representing the GPU time measured for a named scope.
+		*/
+		struct AEON_API Result
+		{
+			std::string name;     //!< The name of the scope
+			Time        duration; //!< The time spent by the GPU between the scope's two timestamps
+			int         depth;    //!< The number of scopes that were open when this scope began
+		};
+
+		/*!
+		 \brief RAII class opening a named GPU scope upon construction and closing it upon destruction.
+		 \details Prefer using the AEON_PROFILE_GPU_SCOPE macro over instantiating this class directly.
+		*/
+		class _NODISCARD AEON_API Scope
+		{
+		public:
+			// Public constructor(s)
+			/*!
+			 \brief Opens the GPU scope \a name.
+
+			 \param[in] name The name of the scope which will be displayed by the overlay
+
+			 \since v0.7.0
+			*/
+			explicit Scope(const std::string& name);
+			/*!
+			 \brief Deleted copy constructor.
+
+			 \since v0.7.0
+			*/
+			Scope(const Scope&) = delete;
+			/*!
+			 \brief Deleted move constructor.
+
+			 \since v0.7.0
+			*/
+			Scope(Scope&&) = delete;
+			/*!
+			 \brief Destructor.
+			 \details Closes the scope opened upon construction.
+
+			 \since v0.7.0
+			*/
+			~Scope();
+		public:
+			// Public operator(s)
+			/*!
+			 \brief Deleted assignment operator.
+
+			 \since v0.7.0
+			*/
+			Scope& operator=(const Scope&) = delete;
+			/*!
+			 \brief Deleted move assignment operator.
+
+			 \since v0.7.0
+			*/
+			Scope& operator=(Scope&&) = delete;
+		};
+
+	public:
+		// Public constructor(s)
+		/*!
+		 \brief Deleted copy constructor.
+
+		 \since v0.7.0
+		*/
+		GPUProfiler(const GPUProfiler&) = delete;
+		/*!
+		 \brief Deleted move constructor.
+
+		 \since v0.7.0
+		*/
+		GPUProfiler(GPUProfiler&&) = delete;
+		/*!
+		 \brief Destructor.
+		 \note The destroy() method should be called beforehand as OpenGL's context will no longer be available.
+
+		 \since v0.7.0
+		*/
+		~GPUProfiler();
+	public:
+		// Public operator(s)
+		/*!
+		 \brief Deleted assignment operator.
+
+		 \since v0.7.0
+		*/
+		GPUProfiler& operator=(const GPUProfiler&) = delete;
+		/*!
+		 \brief Deleted move assignment operator.
+
+		 \since v0.7.0
+		*/
+		GPUProfiler& operator=(GPUProfiler&&) = delete;
+	public:
+		// Public method(s)
+		/*!
+		 \brief Starts recording a new frame.
+		 \details The results of the frame recorded two frames ago are retrieved if the GPU has already made them available, the previous results are kept otherwise.
+		 \note This method is automatically called by the ae::Application at the beginning of each iteration of its game loop.
+
+		 \sa endFrame()
+
+		 \since v0.7.0
+		*/
+		void beginFrame();
+		/*!
+		 \brief Finishes recording the current frame.
+		 \note This method is automatically called by the ae::Application before presenting the window's content.
+
+		 \sa beginFrame()
+
+		 \since v0.7.0
+		*/
+		void endFrame();
+		/*!
+		 \brief Opens a named GPU scope by recording a timestamp into the current frame.
+		 \details Scopes may be nested, and every scope opened must be closed with endScope() within the same frame.\n
+		 Nothing is recorded if the ae::GPUProfiler is disabled.
+
+		 \param[in] name The name of the scope which will be displayed by the overlay
+
+		 \par Example:
+		 \code
+		 bool MyState::draw()
+		 {
+			AEON_PROFILE_GPU_SCOPE("MyState::draw");
+
+			ae::BatchRenderer2D& renderer = ae::BatchRenderer2D::getInstance();
+			renderer.beginScene(mWindow);
+			mSceneGraph->render(ae::RenderStates());
+			renderer.endScene();
+
+			return false;
+		 }
+		 \endcode
+
+		 \sa endScope()
+
+		 \since v0.7.0
+		*/
+		void beginScope(const std::string& name);
+		/*!
+		 \brief Closes the last GPU scope opened.
+
+		 \sa beginScope()
+
+		 \since v0.7.0
+		*/
+		void endScope();
+		/*!
+		 \brief Renders the last results retrieved onto the \a target provided (if the overlay is visible).
+		 \details One line of text per result is rendered over a translucent background using the ae::BasicRenderer2D and the \a target's camera.
+		 \note This method is automatically called by the ae::Application onto the window once the user-created states have been drawn.
+
+		 \param[in] target The ae::RenderTarget onto which the overlay will be rendered
+
+		 \sa showOverlay()
+
+		 \since v0.7.0
+		*/
+		void renderOverlay(RenderTarget& target);
+		/*!
+		 \brief Deletes the OpenGL queries and the overlay's entities.
+		 \note This method is automatically called by the ae::Application once the window is closed.
+
+		 \since v0.7.0
+		*/
+		void destroy();
+		/*!
+		 \brief Sets whether the ae::GPUProfiler will record timestamps.
+		 \details The ae::GPUProfiler is disabled by default, in which case profiling scopes cost a single comparison.
+
+		 \param[in] flag True to enable the profiler, false to disable it
+
+		 \sa isEnabled()
+
+		 \since v0.7.0
+		*/
+		void setEnabled(bool flag) noexcept;
+		/*!
+		 \brief Displays the profiling overlay using the \a font provided.
+		 \details The ae::GPUProfiler is automatically enabled.
+		 Below the frame's duration, the overlay displays the video memory estimated by the ae::GLResourceFactory and, if the driver reports it, the memory available.
+
+		 \param[in] font The ae::Font used by the overlay's lines of text
+
+		 \par Example:
+		 \code
+		 ae::Font font;
+		 font.loadFromFile("Assets/Fonts/Arial.ttf");
+		 ae::GPUProfiler::getInstance().showOverlay(font);
+		 \endcode
+
+		 \sa hideOverlay()
+
+		 \since v0.7.0
+		*/
+		void showOverlay(Font& font);
+		/*!
+		 \brief Hides the profiling overlay.
+		 \details The ae::GPUProfiler remains enabled.
+
+		 \sa showOverlay()
+
+		 \since v0.7.0
+		*/
+		void hideOverlay() noexcept;
+		/*!
+		 \brief Retrieves the results of the last frame whose timestamps were made available by the GPU.
+		 \details The results are listed in the order of which their scopes were opened.
+
+		 \return The list of results of the last frame resolved
+
+		 \sa getFrameTime()
+
+		 \since v0.7.0
+		*/
+		_NODISCARD const std::vector<Result>& getResults() const noexcept;
+		/*!
+		 \brief Retrieves the GPU time elapsed between the beginning and the end of the last frame resolved.
+
+		 \return The ae::Time measured between the calls to beginFrame() and endFrame()
+
+		 \sa getResults()
+
+		 \since v0.7.0
+		*/
+		_NODISCARD const Time& getFrameTime() const noexcept;
+		/*!
+		 \brief Checks whether the ae::GPUProfiler records timestamps.
+
+		 \return True if the profiler is enabled, false otherwise
+
+		 \sa setEnabled()
+
+		 \since v0.7.0
+		*/
+		_NODISCARD bool isEnabled() const noexcept;
+		/*!
+		 \brief Checks whether the profiling overlay is displayed.
+
+		 \return True if the overlay is visible, false otherwise
+
+		 \sa showOverlay(), hideOverlay()
+
+		 \since v0.7.0
+		*/
+		_NODISCARD bool isOverlayVisible() const noexcept;
+
+		// Public static method(s)
+		/*!
+		 \brief Retrieves the single instance of the ae::GPUProfiler.
+
+		 \return The single instance of the ae::GPUProfiler
+
+		 \since v0.7.0
+		*/
+		_NODISCARD static GPUProfiler& getInstance();
+	private:
+		// Private struct(s)
+		/*!
+		 \brief The internal struct representing the pair of timestamp queries of a scope.
+		*/
+		struct ScopeQuery
+		{
+			std::string  name;  //!< The name of the scope
+			unsigned int begin; //!< The identifier of the query recording the scope's beginning
+			unsigned int end;   //!< The identifier of the query recording the scope's end
+			int          depth; //!< The number of scopes that were open when this scope began
+		};
+
+		/*!
+		 \brief The internal struct representing the queries recorded during a frame.
+		 \details The queries are kept once the frame has been resolved so that they may be reused.
+		*/
+		struct FrameQueries
+		{
+			std::vector<ScopeQuery> scopes;     //!< The list of scope queries (some of which may be unused)
+			size_t                  scopeCount; //!< The number of scope queries recorded during the frame
+			unsigned int            frameBegin; //!< The identifier of the query recording the frame's beginning
+			unsigned int            frameEnd;   //!< The identifier of the query recording the frame's end
+			bool                    pending;    //!< Whether the frame's results have yet to be retrieved
+		};
+
+	private:
+		// Private constructor(s)
+		/*!
+		 \brief Default constructor.
+
+		 \since v0.7.0
+		*/
+		GPUProfiler();
+	private:
+		// Private method(s)
+		/*!
+		 \brief Retrieves the results of the \a frame provided if they've all been made available by the GPU.
+
+		 \param[in,out] frame The frame whose results will be retrieved
+
+		 \since v0.7.0
+		*/
+		void resolveFrame(FrameQueries& frame);
+		/*!
+		 \brief Updates the overlay's lines of text and background to match the last results.
+
+		 \since v0.7.0
+		*/
+		void updateOverlay();
+
+	private:
+		// Private member(s)
+		std::array<FrameQueries, 2>     mFrames;            //!< The two frames' queries, alternately recorded and resolved
+		std::vector<Result>             mResults;           //!< The results of the last frame resolved
+		std::vector<size_t>             mOpenScopes;        //!< The indices of the scopes that have yet to be closed
+		Time                            mFrameTime;         //!< The GPU time measured for the last frame resolved
+		size_t                          mFrameIndex;        //!< The index of the frame currently being recorded
+		std::unique_ptr<RectangleShape> mOverlayBackground; //!< The overlay's translucent background, parent of the lines of text
+		std::vector<Text*>              mOverlayLines;      //!< The overlay's lines of text
+		Font*                           mOverlayFont;       //!< The font used by the overlay
+		bool                            mEnabled;           //!< Whether timestamps are recorded
+		bool                            mRecording;         //!< Whether a frame is currently being recorded
+		bool                            mOverlayDirty;      //!< Whether the overlay needs to be updated
+	};
+}
+#endif // Aeon_Graphics_GPUProfiler_H_
+
+/*!
+ \class ae::GPUProfiler
+ \ingroup graphics
+
+ The ae::GPUProfiler singleton class measures the time spent by the GPU on the
+ named scopes of a frame by recording a pair of timestamp queries per scope.
+ Two sets of queries are alternately recorded and resolved so that the results
+ are read back two frames late, once the GPU has made them available, instead
+ of stalling the application.
+
+ Aeon's renderers already open scopes around their opaque and transparent
+ flushes, around the scenes rendered onto an ae::RenderTexture and around the
+ rendering of the ae::TextArea's lines. Further scopes may be opened from the
+ user-created states with the AEON_PROFILE_GPU_SCOPE macro.
+
+ Usage example:
+ \code
+ ae::GPUProfiler& profiler = ae::GPUProfiler::getInstance();
+ profiler.showOverlay(font);
+ ...
+ for (const ae::GPUProfiler::Result& result : profiler.getResults()) {
+	std::cout << result.name << ": " << result.duration.asMicroseconds() << "us\n";
+ }
+ \endcode
+
+ \author Filippos Gleglakos
+ \version v0.7.0
+ \date 2021.07.05
+ \copyright MIT License
+*/
\ No newline at end of file
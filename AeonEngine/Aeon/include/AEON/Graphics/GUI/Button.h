@@ -33,7 +33,7 @@ namespace ae
 
 	/*!
 	 \brief Class representing a GUI button.
-	 \details The Idle and Hover states need to be configured.
+	 \details The Idle and Hover styles need to be configured.
 	*/
 	class _NODISCARD AEON_API Button : public Widget<RectangleShape>
 	{
@@ -96,14 +96,6 @@ namespace ae
 		_NODISCARD Text& getText() const noexcept;
 	private:
 		// Private virtual method(s)
-		/*!
-		 \brief Attaches the text to the active state.
-
-		 \param[in] state The ae::Widget::State that will be enabled
-
-		 \since v0.6.0
-		*/
-		virtual void enableState(State state) override final;
 		/*!
 		 \brief Sets the ae::Button to its hover state if it's currently clicked.
 
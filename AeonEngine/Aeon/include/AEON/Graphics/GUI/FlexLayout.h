@@ -0,0 +1,274 @@
+// MIT License
+// 
+// Copyright(c) 2019-2021 Filippos Gleglakos
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef Aeon_Graphics_GUI_FlexLayout_H_
+#define Aeon_Graphics_GUI_FlexLayout_H_
+
+#include <AEON/Graphics/Actor2D.h>
+
+namespace ae
+{
+	/*!
+	 \brief Class representing a container that arranges its children in a row or a column.
+	 \details The children are placed one after the other along the main axis by their model bounds, and aligned along the cross axis.
+	*/
+	class AEON_API FlexLayout : public Actor2D
+	{
+	public:
+		// Public enum(s)
+		/*!
+		 \brief The axis along which the children are placed.
+		*/
+		enum class Direction
+		{
+			Row,   //!< The children are placed from left to right
+			Column //!< The children are placed from top to bottom
+		};
+		/*!
+		 \brief The alignment of the children along the cross axis.
+		*/
+		enum class Alignment
+		{
+			Start,  //!< The children are aligned to the top (row) or to the left (column)
+			Center, //!< The children are centered
+			End     //!< The children are aligned to the bottom (row) or to the right (column)
+		};
+
+	public:
+		// Public constructor(s)
+		/*!
+		 \brief Constructs the ae::FlexLayout by providing the axis along which the children are placed.
+
+		 \param[in] direction The ae::FlexLayout::Direction of the main axis, ae::FlexLayout::Direction::Column by default
+
+		 \par Example:
+		 \code
+		 // Stack two buttons vertically, separated by 8 units
+		 auto menu = std::make_unique<ae::FlexLayout>(ae::FlexLayout::Direction::Column);
+		 menu->setSpacing(8.f);
+		 menu->setAlignment(ae::FlexLayout::Alignment::Center);
+		 menu->attachChild(std::move(playButton));
+		 menu->attachChild(std::move(quitButton));
+		 \endcode
+
+		 \since v0.7.0
+		*/
+		explicit FlexLayout(Direction direction = Direction::Column);
+		/*!
+		 \brief Copy constructor.
+
+		 \param[in] copy The ae::FlexLayout that will be copied
+
+		 \since v0.7.0
+		*/
+		FlexLayout(const FlexLayout& copy) = default;
+		/*!
+		 \brief Move constructor.
+
+		 \param[in] rvalue The ae::FlexLayout that will be moved
+
+		 \since v0.7.0
+		*/
+		FlexLayout(FlexLayout&& rvalue) noexcept = default;
+	public:
+		// Public operator(s)
+		/*!
+		 \brief Assignment operator.
+
+		 \param[in] other The ae::FlexLayout that will be copied
+
+		 \return The caller ae::FlexLayout
+
+		 \since v0.7.0
+		*/
+		FlexLayout& operator=(const FlexLayout& other) = default;
+		/*!
+		 \brief Move assignment operator.
+
+		 \param[in] rvalue The ae::FlexLayout that will be moved
+
+		 \return The caller ae::FlexLayout
+
+		 \since v0.7.0
+		*/
+		FlexLayout& operator=(FlexLayout&& rvalue) noexcept = default;
+	public:
+		// Public method(s)
+		/*!
+		 \brief Sets the axis along which the children are placed.
+
+		 \param[in] direction The ae::FlexLayout::Direction of the main axis
+
+		 \sa getDirection()
+
+		 \since v0.7.0
+		*/
+		void setDirection(Direction direction) noexcept;
+		/*!
+		 \brief Sets the distance separating two consecutive children along the main axis.
+
+		 \param[in] spacing The distance between two children in model units
+
+		 \sa getSpacing()
+
+		 \since v0.7.0
+		*/
+		void setSpacing(float spacing) noexcept;
+		/*!
+		 \brief Sets the horizontal and vertical spacing between the ae::FlexLayout's edges and its children.
+
+		 \param[in] padding The ae::Vector2f containing the horizontal and vertical padding
+
+		 \sa getPadding()
+
+		 \since v0.7.0
+		*/
+		void setPadding(const Vector2f& padding) noexcept;
+		/*!
+		 \brief Sets the alignment of the children along the cross axis.
+
+		 \param[in] alignment The ae::FlexLayout::Alignment of the children
+
+		 \sa getAlignment()
+
+		 \since v0.7.0
+		*/
+		void setAlignment(Alignment alignment) noexcept;
+		/*!
+		 \brief Retrieves the axis along which the children are placed.
+
+		 \return The ae::FlexLayout::Direction of the main axis
+
+		 \sa setDirection()
+
+		 \since v0.7.0
+		*/
+		_NODISCARD Direction getDirection() const noexcept;
+		/*!
+		 \brief Retrieves the distance separating two consecutive children along the main axis.
+
+		 \return The distance between two children in model units
+
+		 \sa setSpacing()
+
+		 \since v0.7.0
+		*/
+		_NODISCARD float getSpacing() const noexcept;
+		/*!
+		 \brief Retrieves the horizontal and vertical spacing between the ae::FlexLayout's edges and its children.
+
+		 \return The ae::Vector2f containing the horizontal and vertical padding
+
+		 \sa setPadding()
+
+		 \since v0.7.0
+		*/
+		_NODISCARD const Vector2f& getPadding() const noexcept;
+		/*!
+		 \brief Retrieves the alignment of the children along the cross axis.
+
+		 \return The ae::FlexLayout::Alignment of the children
+
+		 \sa setAlignment()
+
+		 \since v0.7.0
+		*/
+		_NODISCARD Alignment getAlignment() const noexcept;
+
+		// Public virtual method(s)
+		/*!
+		 \brief Retrieves the ae::FlexLayout's model bounding box, which encloses its children and its padding.
+		 \details The bounds measured during the last layout pass are returned unless the ae::FlexLayout was invalidated since.
+
+		 \return The ae::FlexLayout's model bounding box
+
+		 \since v0.7.0
+		*/
+		_NODISCARD virtual Box2f getModelBounds() const override final;
+
+	protected:
+		// Protected virtual method(s)
+		/*!
+		 \brief Places the children one after the other along the main axis and aligns them along the cross axis.
+
+		 \sa updateLayout()
+
+		 \since v0.7.0
+		*/
+		virtual void arrangeChildren() override final;
+		/*!
+		 \brief Checks whether the ae::FlexLayout's layout depends on its children's model bounds.
+
+		 \return True
+
+		 \since v0.7.0
+		*/
+		_NODISCARD virtual bool isLayoutDependentOnChildren() const noexcept override final;
+		/*!
+		 \brief Checks whether the ae::FlexLayout has pending work for its next update.
+		 \details The ae::FlexLayout is laid out by the layout pass so it has no update logic of its own.
+
+		 \return False
+
+		 \since v0.7.0
+		*/
+		_NODISCARD virtual bool hasPendingUpdate() const override;
+
+	private:
+		// Private method(s)
+		/*!
+		 \brief Measures the box enclosing the children placed along the main axis and the padding.
+
+		 \return The ae::FlexLayout's model bounding box
+
+		 \since v0.7.0
+		*/
+		_NODISCARD Box2f measure() const;
+
+	private:
+		// Private member(s)
+		Box2f     mContentBounds; //!< The model bounds measured during the last layout pass
+		Vector2f  mPadding;       //!< The spacing between the edges and the children
+		float     mSpacing;       //!< The distance between two consecutive children
+		Direction mDirection;     //!< The axis along which the children are placed
+		Alignment mAlignment;     //!< The alignment of the children along the cross axis
+	};
+}
+#endif // Aeon_Graphics_GUI_FlexLayout_H_
+
+/*!
+ \class ae::FlexLayout
+ \ingroup graphics
+
+ The ae::FlexLayout class is a retained layout container: it only arranges its
+ children during the layout pass that follows the invalidation of one of them
+ (a resized shape, a modified text, ...) or of one of its own properties, instead
+ of recomputing the positions every frame.
+
+ The model bounds of the nested ae::FlexLayout instances are measured from their
+ children so the containers can be nested to build complex layouts.
+
+ \author Filippos Gleglakos
+ \version v0.7.0
+ \date 2021.07.05
+ \copyright MIT License
+*/
\ No newline at end of file
@@ -0,0 +1,309 @@
+// MIT License
+// 
+// Copyright(c) 2019-2021 Filippos Gleglakos
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef Aeon_Graphics_GUI_ListView_H_
+#define Aeon_Graphics_GUI_ListView_H_
+
+#include <functional>
+
+#include <AEON/Graphics/GUI/internal/Widget.h>
+#include <AEON/Graphics/RectangleShape.h>
+
+namespace ae
+{
+	// Forward declaration(s)
+	class Scrollbar;
+
+	/*!
+	 \brief Class representing a scrollable list whose item widgets are only created for its visible entries.
+	 \details The entries are all of the same height and the item widgets are recycled as the list is scrolled, so the cost of the list doesn't depend on its entry count.
+	*/
+	class _NODISCARD AEON_API ListView : public Widget<RectangleShape>
+	{
+	public:
+		// Public typedef(s)
+		using ItemFactory = std::function<std::unique_ptr<Actor2D>()>;       //!< Creates a new item widget
+		using ItemBinder = std::function<void(Actor2D& item, size_t index)>; //!< Displays the entry of the index provided with an item widget
+
+	public:
+		// Public constructor(s)
+		/*!
+		 \brief Constructs the ae::ListView by providing the size of its viewport, the height of its entries and the callbacks creating and binding the item widgets.
+		 \details The \a factory is only called when there aren't enough item widgets to cover the visible entries, and the \a binder whenever an item widget is assigned to another entry.
+
+		 \param[in] size The width and height of the viewport
+		 \param[in] itemHeight The height of an entry
+		 \param[in] factory The ae::ListView::ItemFactory creating the item widgets
+		 \param[in] binder The ae::ListView::ItemBinder displaying an entry with an item widget
+
+		 \par Example:
+		 \code
+		 // Display a server browser's entries with recycled texts
+		 auto list = std::make_unique<ae::ListView>(ae::Vector2f(400.f, 600.f), 24.f,
+			 []() { return std::make_unique<ae::Text>(); },
+			 [&servers](ae::Actor2D& item, size_t index) { static_cast<ae::Text&>(item).setText(servers[index].name); });
+		 list->setItemCount(servers.size());
+		 \endcode
+
+		 \since v0.7.0
+		*/
+		ListView(const Vector2f& size, float itemHeight, ItemFactory factory, ItemBinder binder);
+		/*!
+		 \brief Deleted copy constructor.
+
+		 \since v0.7.0
+		*/
+		ListView(const ListView&) = delete;
+		/*!
+		 \brief Deleted move constructor.
+
+		 \since v0.7.0
+		*/
+		ListView(ListView&&) = delete;
+	public:
+		// Public operator(s)
+		/*!
+		 \brief Deleted assignment operator.
+
+		 \since v0.7.0
+		*/
+		ListView& operator=(const ListView&) = delete;
+		/*!
+		 \brief Deleted move assignment operator.
+
+		 \since v0.7.0
+		*/
+		ListView& operator=(ListView&&) = delete;
+	public:
+		// Public method(s)
+		/*!
+		 \brief Sets the number of entries of the list.
+		 \details The item widgets of the removed entries are recycled and the scroll offset is clamped to the new content.
+		 \note The entries which remain visible aren't bound again, refresh() must be called if their data changed.
+
+		 \param[in] count The number of entries
+
+		 \sa getItemCount(), refresh()
+
+		 \since v0.7.0
+		*/
+		void setItemCount(size_t count);
+		/*!
+		 \brief Sets the height of the entries, the visible entries being bound again.
+
+		 \param[in] height The height of an entry
+
+		 \sa getItemHeight()
+
+		 \since v0.7.0
+		*/
+		void setItemHeight(float height);
+		/*!
+		 \brief Sets the number of entries bound beyond each edge of the viewport.
+		 \details The margin prevents the item widgets from being bound while they're entering the viewport during a slow scroll.
+
+		 \param[in] margin The number of entries bound above and below the visible ones, 2 by default
+
+		 \sa getMargin()
+
+		 \since v0.7.0
+		*/
+		void setMargin(size_t margin);
+		/*!
+		 \brief Scrolls the list to the offset provided, the thumb of the scrollbar following it.
+
+		 \param[in] offset The distance between the top of the content and the top of the viewport, clamped to the content
+
+		 \sa scroll(), getScrollOffset()
+
+		 \since v0.7.0
+		*/
+		void scrollTo(float offset);
+		/*!
+		 \brief Scrolls the list by the distance provided.
+
+		 \param[in] delta The distance to scroll, positive to scroll downwards
+
+		 \sa scrollTo()
+
+		 \since v0.7.0
+		*/
+		void scroll(float delta);
+		/*!
+		 \brief Binds all of the visible entries again, to be called when the data of the entries changed.
+
+		 \sa refreshItem()
+
+		 \since v0.7.0
+		*/
+		void refresh();
+		/*!
+		 \brief Binds the entry of the \a index provided again if it's visible.
+
+		 \param[in] index The index of the entry whose data changed
+
+		 \sa refresh()
+
+		 \since v0.7.0
+		*/
+		void refreshItem(size_t index);
+		/*!
+		 \brief Retrieves the number of entries of the list.
+
+		 \return The number of entries
+
+		 \sa setItemCount()
+
+		 \since v0.7.0
+		*/
+		_NODISCARD size_t getItemCount() const noexcept;
+		/*!
+		 \brief Retrieves the height of the entries.
+
+		 \return The height of an entry
+
+		 \sa setItemHeight()
+
+		 \since v0.7.0
+		*/
+		_NODISCARD float getItemHeight() const noexcept;
+		/*!
+		 \brief Retrieves the number of entries bound beyond each edge of the viewport.
+
+		 \return The number of entries bound above and below the visible ones
+
+		 \sa setMargin()
+
+		 \since v0.7.0
+		*/
+		_NODISCARD size_t getMargin() const noexcept;
+		/*!
+		 \brief Retrieves the distance between the top of the content and the top of the viewport.
+
+		 \return The current scroll offset
+
+		 \sa scrollTo()
+
+		 \since v0.7.0
+		*/
+		_NODISCARD float getScrollOffset() const noexcept;
+		/*!
+		 \brief Retrieves the range of the entries currently bound to item widgets, including the margin.
+
+		 \return The index of the first entry bound and the index past the last one
+
+		 \since v0.7.0
+		*/
+		_NODISCARD std::pair<size_t, size_t> getBoundRange() const noexcept;
+		/*!
+		 \brief Retrieves the scrollbar driving the list, whose thumb's appearance may be modified.
+
+		 \return The ae::Scrollbar placed along the right edge of the viewport
+
+		 \since v0.7.0
+		*/
+		_NODISCARD Scrollbar& getScrollbar() noexcept;
+
+	private:
+		// Private nested class(es)
+		class Content;
+
+		// Private method(s)
+		/*!
+		 \brief Recycles the item widgets whose entries left the bound range, binds the entries that entered it and positions the item widgets.
+
+		 \since v0.7.0
+		*/
+		void updateItems();
+		/*!
+		 \brief Resizes the scrollbar to the content and realigns its thumb to the scroll offset.
+
+		 \since v0.7.0
+		*/
+		void updateScrollbar();
+		/*!
+		 \brief Retrieves the maximum scroll offset, at which the last entry is at the bottom of the viewport.
+
+		 \return The content's height minus the viewport's height
+
+		 \since v0.7.0
+		*/
+		_NODISCARD double getMaxScrollOffset() const noexcept;
+
+		// Private virtual method(s)
+		/*!
+		 \brief Follows the scrollbar's thumb and updates the item widgets if the list was scrolled or resized.
+
+		 \param[in] dt The time difference between the previous frame and the current frame
+
+		 \since v0.7.0
+		*/
+		virtual void updateSelf(const Time& dt) override final;
+		/*!
+		 \brief Checks for mouse movement and scrolls the list with the vertical mouse wheel.
+
+		 \param[in] event The polled input ae::Event
+
+		 \since v0.7.0
+		*/
+		virtual void handleEventSelf(Event* const event) override final;
+
+	private:
+		// Private member(s)
+		ItemFactory                               mFactory;      //!< The callback creating the item widgets
+		ItemBinder                                mBinder;       //!< The callback binding an entry to an item widget
+		std::vector<std::pair<size_t, Actor2D*>>  mItems;        //!< The bound item widgets and the indices of their entries
+		std::vector<std::unique_ptr<Actor2D>>     mFreeItems;    //!< The detached item widgets awaiting a new entry
+		Content*                                  mContent;      //!< The node clipping the item widgets to the viewport
+		Scrollbar*                                mScrollbar;    //!< The scrollbar driving the list
+		Vector2f                                  mViewportSize; //!< The viewport's size with which the item widgets were last updated
+		double                                    mScrollOffset; //!< The distance between the top of the content and the top of the viewport
+		float                                     mScrollRatio;  //!< The scrollbar's thumb ratio matching the scroll offset
+		float                                     mItemHeight;   //!< The height of an entry
+		size_t                                    mItemCount;    //!< The number of entries
+		size_t                                    mMargin;       //!< The number of entries bound beyond each edge of the viewport
+		size_t                                    mFirstIndex;   //!< The index of the first bound entry
+		size_t                                    mLastIndex;    //!< The index past the last bound entry
+		bool                                      mUpdateItems;  //!< Whether the item widgets need to be positioned again
+		bool                                      mRebindItems;  //!< Whether all bound entries need to be bound again
+	};
+}
+#endif // Aeon_Graphics_GUI_ListView_H_
+
+/*!
+ \class ae::ListView
+ \ingroup graphics
+
+ The ae::ListView class is a virtualized list: instead of storing one widget per
+ entry, it only binds the entries situated within its viewport (and a margin) to
+ item widgets, which are recycled as the entries scroll out of view. The item
+ widgets are clipped to the viewport with the scissor test of the renderers.
+
+ Scrolling a list of a hundred thousand entries thus costs as much as scrolling
+ a list of a few dozen, and the item widgets are only created with the factory
+ until the viewport is covered.
+
+ \author Filippos Gleglakos
+ \version v0.7.0
+ \date 2021.07.05
+ \copyright MIT License
+*/
\ No newline at end of file
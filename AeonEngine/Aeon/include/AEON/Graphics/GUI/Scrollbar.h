@@ -78,7 +78,38 @@ namespace ae
 		void scrollTo(float pos);
 		void scroll(float offset);
 		void updateSize(float actualSize, float visibleSize);
+		/*!
+		 \brief Moves the thumb to the ratio provided of its track.
+
+		 \param[in] ratio The position of the thumb along its track, from 0 (top) to 1 (bottom)
+
+		 \sa getScrollRatio()
+
+		 \since v0.7.0
+		*/
+		void setScrollRatio(float ratio);
+		/*!
+		 \brief Retrieves the position of the thumb as a ratio of its track.
+		 \details This ratio maps the thumb's position to the associated container's scroll offset.
+
+		 \return The position of the thumb along its track, from 0 (top) to 1 (bottom), 0 if the container's content is entirely visible
+
+		 \sa setScrollRatio()
+
+		 \since v0.7.0
+		*/
+		_NODISCARD float getScrollRatio() const noexcept;
 	private:
+		// Private method(s)
+		/*!
+		 \brief Retrieves the distance along which the thumb may be moved.
+
+		 \return The visible size minus the thumb's length
+
+		 \since v0.7.0
+		*/
+		_NODISCARD float getTrackLength() const noexcept;
+
 		// Private virtual method(s)
 		/*!
 		 \brief Checks for mouse mouvement and mouse clicks.
@@ -31,6 +31,8 @@ namespace ae
 {
 	// Forward declaration(s)
 	class Text;
+	class Font;
+	class Sprite;
 
 	class _NODISCARD AEON_API TextArea : public Widget<RectangleShape>
 	{
@@ -43,6 +45,7 @@ namespace ae
 
 	public:
 		TextArea();
+		virtual ~TextArea();
 	public:
 		void setProperties(uint32_t properties);
 		//void setMaxSize(const Vector2f& size);
@@ -58,8 +61,6 @@ namespace ae
 		void handleResizing();
 		void handleImposedReturns();
 
-		virtual void enableState(State state) override final;
-
 	private:
 		RenderTexture      mContent;
 		std::string        mText;
@@ -67,6 +68,8 @@ namespace ae
 		Vector2f           mMaxSize;
 		uint32_t           mProperties;
 		bool               mUpdateContent;
+		const Font*        mFont;
+		Sprite*            mContentSprite;
 	};
 }
 #endif // Aeon_Graphics_GUI_TextArea_H_
\ No newline at end of file
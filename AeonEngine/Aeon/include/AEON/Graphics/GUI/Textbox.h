@@ -26,6 +26,8 @@
 #include <AEON/Graphics/GUI/internal/Widget.h>
 #include <AEON/Graphics/RectangleShape.h>
 
+#include <utility>
+
 namespace ae
 {
 	// Forward declaration(s)
@@ -34,7 +36,7 @@ namespace ae
 
 	/*!
 	 \brief Class representing a GUI textbox.
-	 \details The Idle, Hover and Click states need to be configured.
+	 \details The Idle, Hover and Click styles need to be configured.
 	*/
 	class _NODISCARD AEON_API Textbox : public Widget<RectangleShape>
 	{
@@ -43,14 +45,123 @@ namespace ae
 	public:
 		Text& getText() noexcept;
 		Text& getPlaceholder() noexcept;
+		/*!
+		 \brief Sets the color of the ae::Textbox's blinking caret.
+		 \details The caret is displayed while the ae::Textbox is in its Click state, its default color is white.
+
+		 \param[in] color The ae::Color of the caret
+
+		 \par Example:
+		 \code
+		 auto textbox = std::make_unique<ae::Textbox>();
+		 textbox->setCaretColor(ae::Color::Black);
+		 \endcode
+
+		 \sa setSelectionColor()
+
+		 \since v0.7.0
+		*/
+		void setCaretColor(const Color& color);
+		/*!
+		 \brief Sets the color of the highlight behind the selected characters.
+		 \details The default color is a translucent blue.
+
+		 \param[in] color The ae::Color of the selection highlight
+
+		 \par Example:
+		 \code
+		 auto textbox = std::make_unique<ae::Textbox>();
+		 textbox->setSelectionColor(ae::Color(255, 200, 0, 100));
+		 \endcode
+
+		 \sa setCaretColor()
+
+		 \since v0.7.0
+		*/
+		void setSelectionColor(const Color& color);
+		/*!
+		 \brief Moves the caret in front of the character at the \a index provided, dropping the selection.
+		 \details The \a index is a byte position within the text's UTF-8 string, it's clamped to the string's size.
+
+		 \param[in] index The byte position of the caret
+
+		 \par Example:
+		 \code
+		 auto textbox = std::make_unique<ae::Textbox>();
+		 textbox->setCaretPosition(textbox->getText().getText().size());
+		 \endcode
+
+		 \sa getCaretPosition(), select()
+
+		 \since v0.7.0
+		*/
+		void setCaretPosition(size_t index);
+		/*!
+		 \brief Retrieves the caret's byte position within the text's UTF-8 string.
+
+		 \return The byte position of the caret
+
+		 \sa setCaretPosition()
+
+		 \since v0.7.0
+		*/
+		_NODISCARD size_t getCaretPosition() const noexcept;
+		/*!
+		 \brief Selects the characters between the \a anchor and the \a caret byte positions.
+		 \details The caret is placed at the \a caret position, both positions are clamped to the string's size.
+
+		 \param[in] anchor The byte position at which the selection starts
+		 \param[in] caret The byte position at which the selection ends
+
+		 \par Example:
+		 \code
+		 auto textbox = std::make_unique<ae::Textbox>();
+		 textbox->select(0, textbox->getText().getText().size()); // select all
+		 \endcode
+
+		 \sa getSelection(), setCaretPosition()
+
+		 \since v0.7.0
+		*/
+		void select(size_t anchor, size_t caret);
+		/*!
+		 \brief Retrieves the first and one-past-last byte positions of the selected characters.
+		 \details Both positions are equal when no characters are selected.
+
+		 \return A pair containing the ordered byte positions of the selection
+
+		 \par Example:
+		 \code
+		 const auto [first, last] = textbox->getSelection();
+		 const std::string selected = textbox->getText().getText().substr(first, last - first);
+		 \endcode
+
+		 \sa select()
+
+		 \since v0.7.0
+		*/
+		_NODISCARD std::pair<size_t, size_t> getSelection() const noexcept;
 	private:
+		// Private nested class(es)
+		class Overlay;
+
+		// Private method(s)
+		void moveCaret(size_t index, bool extend);
+		void insertText(std::string_view text);
+		bool eraseSelection();
+		void updatePlaceholder();
+		size_t findCaretPosition() const;
+
 		virtual void enableState(State state) override final;
 		virtual void updateSelf(const Time& dt) override final;
 		virtual void handleEventSelf(Event* const event) override final;
 		
 	private:
-		Text* mText;
-		Text* mPlaceholder;
+		Text*    mText;        //!< The text typed in
+		Text*    mPlaceholder; //!< The text displayed while nothing has been typed
+		Overlay* mOverlay;     //!< The caret and selection highlight, drawn over the text
+		size_t   mCaret;       //!< The caret's byte position
+		size_t   mAnchor;      //!< The byte position at which the selection started
 	};
 }
 #endif // Aeon_Graphics_GUI_Textbox_H_
@@ -62,6 +173,11 @@ namespace ae
  The ae::Textbox class provided typical functionality of a GUI textbox, such as
  typing text
 
+ While the textbox is focused (in its Click state), a caret is displayed at the
+ editing position and the selected characters are highlighted. The caret blinks
+ within the shader using the scene time so an idle textbox doesn't update any
+ geometry, only caret moves and edits rebuild the overlay's two quads.
+
  \author Filippos Gleglakos
  \version v0.6.0
  \date 2020.08.17
@@ -96,14 +96,6 @@ namespace ae
 		_NODISCARD Text& getText() const noexcept;
 	private:
 		// Private virtual method(s)
-		/*!
-		 \brief Attaches the text to the active state.
-
-		 \param[in] state The ae::ToggleButton::State that will be enabled
-
-		 \since v0.6.0
-		*/
-		virtual void enableState(State state) override final;
 		/*!
 		 \brief Updates the ae::ToggleButton's state based on the input event.
 		 \details Updates the active state based on mouse movement and mouse clicks.
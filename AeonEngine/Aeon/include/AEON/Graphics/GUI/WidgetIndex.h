@@ -0,0 +1,260 @@
+// MIT License
+// 
+// Copyright(c) 2019-2021 Filippos Gleglakos
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#ifndef Aeon_Graphics_GUI_WidgetIndex_H_
+#define Aeon_Graphics_GUI_WidgetIndex_H_
+
+#include <vector>
+#include <cstdint>
+#include <unordered_map>
+
+#include <AEON/Config.h>
+#include <AEON/Math/AABoxCollider.h>
+
+namespace ae
+{
+	// Forward declaration(s)
+	class Actor2D;
+	class Event;
+
+	/*!
+	 \brief Class representing a uniform grid of GUI widget bounds used to route the mouse events to the widgets under the cursor.
+	 \details The registered widgets provide their hit bounds in the application window's world coordinates, and update them whenever their transforms change.
+	*/
+	class _NODISCARD AEON_API WidgetIndex
+	{
+	public:
+		// Public constructor(s)
+		/*!
+		 \brief Constructs the ae::WidgetIndex by providing the size of the grid's cells.
+
+		 \param[in] cellSize The width and height of a grid cell in world units, 128 by default
+
+		 \since v0.7.0
+		*/
+		explicit WidgetIndex(float cellSize = 128.f);
+		/*!
+		 \brief Deleted copy constructor.
+
+		 \since v0.7.0
+		*/
+		WidgetIndex(const WidgetIndex&) = delete;
+		/*!
+		 \brief Deleted move constructor.
+
+		 \since v0.7.0
+		*/
+		WidgetIndex(WidgetIndex&&) = delete;
+	public:
+		// Public operator(s)
+		/*!
+		 \brief Deleted assignment operator.
+
+		 \since v0.7.0
+		*/
+		WidgetIndex& operator=(const WidgetIndex&) = delete;
+		/*!
+		 \brief Deleted move assignment operator.
+
+		 \since v0.7.0
+		*/
+		WidgetIndex& operator=(WidgetIndex&&) = delete;
+	public:
+		// Public method(s)
+		/*!
+		 \brief Registers the \a widget with its hit \a bounds.
+		 \note The ae::Widget class registers itself when it's attached to an ae::WidgetIndex through ae::Widget::setWidgetIndex().
+
+		 \param[in] widget The ae::Actor2D widget that will receive the mouse events situated within its bounds
+		 \param[in] bounds The widget's hit bounds in the application window's world coordinates
+
+		 \sa update(), remove()
+
+		 \since v0.7.0
+		*/
+		void insert(Actor2D& widget, const Box2f& bounds);
+		/*!
+		 \brief Updates the hit \a bounds of a registered \a widget.
+		 \details The widget is only moved between the grid's cells if its bounds actually changed.
+
+		 \param[in] widget The registered ae::Actor2D widget
+		 \param[in] bounds The widget's new hit bounds in the application window's world coordinates
+
+		 \sa insert(), getBounds()
+
+		 \since v0.7.0
+		*/
+		void update(Actor2D& widget, const Box2f& bounds);
+		/*!
+		 \brief Unregisters the \a widget.
+
+		 \param[in] widget The registered ae::Actor2D widget
+
+		 \sa insert()
+
+		 \since v0.7.0
+		*/
+		void remove(Actor2D& widget);
+		/*!
+		 \brief Sets whether the \a widget is engaged, meaning that it receives every mouse event regardless of the cursor's position.
+		 \details A widget is engaged while it's hovered over, clicked or focused so that it can react to the cursor leaving it or to a click elsewhere.
+
+		 \param[in] widget The registered ae::Actor2D widget
+		 \param[in] flag True to engage the widget, false to only route it the events situated within its bounds
+
+		 \since v0.7.0
+		*/
+		void setEngaged(Actor2D& widget, bool flag);
+		/*!
+		 \brief Routes the mouse \a event to the widgets whose hit bounds contain the cursor and to the engaged widgets.
+		 \details The engaged widgets are visited first, then the widgets in the order in which they were registered, until one of them stops the event's propagation. Non-mouse events are ignored.
+
+		 \param[in] event The polled input ae::Event
+
+		 \par Example:
+		 \code
+		 ae::WidgetIndex index;
+		 auto button = std::make_unique<ae::Button>();
+		 button->setWidgetIndex(&index);
+		 ...
+
+		 // Route the mouse events before propagating the event through the scene graph
+		 index.handleEvent(event); // the indexed widgets skip the mouse events that weren't routed to them
+		 scene->handleEvent(event);
+		 \endcode
+
+		 \sa isRouting()
+
+		 \since v0.7.0
+		*/
+		void handleEvent(Event* const event);
+		/*!
+		 \brief Retrieves the registered hit bounds of the \a widget.
+
+		 \param[in] widget The registered ae::Actor2D widget
+
+		 \return A pair containing whether the widget is registered and its hit bounds
+
+		 \since v0.7.0
+		*/
+		_NODISCARD std::pair<bool, Box2f> getBounds(const Actor2D& widget) const;
+		/*!
+		 \brief Checks whether the mouse event being handled is currently being routed to the \a widget.
+
+		 \param[in] widget The ae::Actor2D widget
+
+		 \return True if the ae::WidgetIndex is delivering an event to the \a widget, false otherwise
+
+		 \sa handleEvent()
+
+		 \since v0.7.0
+		*/
+		_NODISCARD bool isRouting(const Actor2D& widget) const noexcept;
+
+		// Public static method(s)
+		/*!
+		 \brief Checks whether the \a event is one of the mouse events routed by the ae::WidgetIndex.
+
+		 \param[in] event The ae::Event to check
+
+		 \return True if the event is a ae::MouseMoveEvent or an ae::MouseButtonEvent, false otherwise
+
+		 \since v0.7.0
+		*/
+		_NODISCARD static bool isRoutedEvent(const Event& event) noexcept;
+
+	private:
+		// Private struct(s)
+		/*!
+		 \brief The registration of a widget.
+		*/
+		struct Entry
+		{
+			Box2f                bounds;  //!< The widget's hit bounds
+			std::vector<int64_t> cells;   //!< The keys of the grid cells overlapped by the bounds
+			uint64_t             order;   //!< The registration order of the widget
+			bool                 engaged; //!< Whether the widget receives every mouse event
+		};
+
+	private:
+		// Private method(s)
+		/*!
+		 \brief Adds the \a widget to the grid cells overlapped by its registered bounds.
+
+		 \param[in] widget The registered ae::Actor2D widget
+		 \param[in] entry The widget's registration
+
+		 \since v0.7.0
+		*/
+		void bin(Actor2D& widget, Entry& entry);
+		/*!
+		 \brief Removes the \a widget from the grid cells it was added to.
+
+		 \param[in] widget The registered ae::Actor2D widget
+		 \param[in] entry The widget's registration
+
+		 \since v0.7.0
+		*/
+		void unbin(Actor2D& widget, Entry& entry);
+		/*!
+		 \brief Computes the key of the grid cell associated to the cell coordinates provided.
+
+		 \param[in] x The cell's column
+		 \param[in] y The cell's row
+
+		 \return The cell's key
+
+		 \since v0.7.0
+		*/
+		_NODISCARD static int64_t getCellKey(int x, int y) noexcept;
+
+	private:
+		// Private member(s)
+		std::unordered_map<Actor2D*, Entry>                mEntries;      //!< The registered widgets
+		std::unordered_map<int64_t, std::vector<Actor2D*>> mCells;        //!< The widgets overlapping each grid cell
+		std::vector<Actor2D*>                              mEngaged;      //!< The engaged widgets
+		std::vector<Actor2D*>                              mCandidates;   //!< The widgets to which the current event is routed
+		Actor2D*                                           mRoutedWidget; //!< The widget currently receiving an event
+		float                                              mCellSize;     //!< The width and height of a grid cell
+		uint64_t                                           mNextOrder;    //!< The registration order of the next widget
+	};
+}
+#endif // Aeon_Graphics_GUI_WidgetIndex_H_
+
+/*!
+ \class ae::WidgetIndex
+ \ingroup graphics
+
+ The ae::WidgetIndex class is a uniform grid spatial index of the GUI widgets' bounds.
+ Instead of every widget receiving every mouse event and walking its scene graph to
+ compute its global bounds, the index routes ae::MouseMoveEvent and ae::MouseButtonEvent
+ events only to the widgets situated under the cursor (and to the engaged widgets).
+
+ Each ae::State owns an ae::WidgetIndex which is fed the events by the ae::StateStack
+ before the state itself handles them.
+
+ \author Filippos Gleglakos
+ \version v0.7.0
+ \date 2021.07.05
+ \copyright MIT License
+*/
\ No newline at end of file
@@ -23,21 +23,23 @@
 #ifndef Aeon_Graphics_GUI_Widget_H_
 #define Aeon_Graphics_GUI_Widget_H_
 
+#include <AEON/System/MemoryTracker.h>
 #include <AEON/Window/Application.h>
 #include <AEON/Graphics/Actor2D.h>
 #include <AEON/Graphics/Camera2D.h>
+#include <AEON/Graphics/internal/Shape.h>
+#include <AEON/Graphics/GUI/WidgetIndex.h>
 
 namespace ae
 {
 	// Forward declaration(s)
-	class Shape;
 	class RenderTarget;
 
 	/*!
 	 \brief Abstract base class used to provide basic GUI functionalities.
-	 \note The typename T needs to be derived of the ae::Actor2D class and be default-constructible.
+	 \note The typename T needs to be derived of the ae::Shape class and be default-constructible.
 	*/
-	template <typename T, typename = std::enable_if_t<std::is_base_of_v<Actor2D, T> && std::is_default_constructible_v<T>>>
+	template <typename T, typename = std::enable_if_t<std::is_base_of_v<Shape, T> && std::is_default_constructible_v<T>>>
 	class Widget : public Actor2D
 	{
 	public:
@@ -54,6 +56,19 @@ namespace ae
 			StateCount //!< The number of states available
 		};
 
+		// Public struct(s)
+		/*!
+		 \brief Struct containing the appearance of the widget's shape in one of its states.
+		 \details Switching states only changes the shape's colors, outline thickness and texture, its geometry and children are left as is.
+		*/
+		struct Style
+		{
+			Color            fillColor;        //!< The shape's fill color
+			Color            outlineColor;     //!< The shape's outline color
+			float            outlineThickness; //!< The shape's outline thickness
+			const Texture2D* texture;          //!< The shape's texture, nullptr for an untextured shape
+		};
+
 	public:
 		// Public constructor(s)
 		/*!
@@ -64,6 +79,9 @@ namespace ae
 		*/
 		virtual ~Widget()
 		{
+			if (mWidgetIndex) {
+				mWidgetIndex->remove(*this);
+			}
 		}
 	public:
 		// Public method(s)
@@ -103,7 +121,7 @@ namespace ae
 		 ae::Widget::State buttonState = button->getActiveState();
 		 \endcode
 
-		 \sa getState()
+		 \sa getStyle()
 
 		 \since v0.5.0
 		*/
@@ -116,26 +134,125 @@ namespace ae
 			mTarget = &target;
 		}
 		/*!
-		 \brief Retrieves the ae::Widget's state associated to the ae::Widget::State provided.
+		 \brief Attaches the ae::Widget to the ae::WidgetIndex provided which will route it the mouse events situated under the cursor.
+		 \details Once attached, the ae::Widget ignores the mouse events that weren't routed to it by the index and keeps its hit bounds up to date in the index.
 
-		 \param[in] state The ae::Widget::State associated to the appropriate ae::Shape
+		 \param[in] index The ae::WidgetIndex that will route the ae::Widget's mouse events, nullptr to detach the ae::Widget from its current index
 
-		 \return The ae::Shape associated to the ae::Widget::State provided
+		 \par Example:
+		 \code
+		 // Inside a custom ae::State
+		 auto button = std::make_unique<ae::Button>();
+		 button->setWidgetIndex(&mWidgetIndex);
+		 \endcode
+
+		 \sa getWidgetIndex()
+
+		 \since v0.7.0
+		*/
+		void setWidgetIndex(WidgetIndex* index)
+		{
+			if (mWidgetIndex) {
+				mWidgetIndex->remove(*this);
+			}
+
+			mWidgetIndex = index;
+			if (mWidgetIndex) {
+				mIndexedStamp = getGlobalTransformStamp();
+				mIndexedModelBounds = getModelBounds();
+				mWidgetIndex->insert(*this, getHitBounds());
+				mWidgetIndex->setEngaged(*this, isEngaged(mActiveState));
+			}
+		}
+		/*!
+		 \brief Retrieves the ae::WidgetIndex to which the ae::Widget is attached.
+
+		 \return The ae::WidgetIndex routing the ae::Widget's mouse events, nullptr if the ae::Widget isn't attached to one
+
+		 \sa setWidgetIndex()
+
+		 \since v0.7.0
+		*/
+		_NODISCARD WidgetIndex* getWidgetIndex() const noexcept
+		{
+			return mWidgetIndex;
+		}
+		/*!
+		 \brief Sets the appearance of the ae::Widget's shape in the \a state provided.
+		 \details The style is applied to the shape straight away if the \a state is the active state.
+
+		 \param[in] state The ae::Widget::State whose appearance is set
+		 \param[in] style The ae::Widget::Style applied to the shape whenever the \a state is enabled
 
 		 \par Example:
 		 \code
 		 auto button = std::make_unique<ae::Button>();
-		 ...
-		 ae::RectangleShape& idleState = button->getState(ae::Button::State::Idle);
+		 button->getShape().setSize(200.f, 50.f);
+		 button->setStyle(ae::Button::State::Idle, { ae::Color::Black, ae::Color::White, 2.f, nullptr });
+		 button->setStyle(ae::Button::State::Hover, { ae::Color(32, 32, 32), ae::Color::White, 2.f, nullptr });
 		 \endcode
 
-		 \sa getActiveState()
+		 \sa getStyle(), getShape()
 
-		 \since v0.5.0
+		 \since v0.7.0
+		*/
+		void setStyle(State state, const Style& style)
+		{
+			mStyles[state] = style;
+			if (state == mActiveState) {
+				applyStyle(style);
+			}
+		}
+		/*!
+		 \brief Retrieves the appearance of the ae::Widget's shape in the \a state provided.
+		 \details Every state initially has the appearance of the shape when the ae::Widget was constructed.
+
+		 \param[in] state The ae::Widget::State whose appearance is retrieved
+
+		 \return The ae::Widget::Style applied to the shape whenever the \a state is enabled
+
+		 \sa setStyle()
+
+		 \since v0.7.0
 		*/
-		_NODISCARD T& getState(State state) noexcept
+		_NODISCARD const Style& getStyle(State state) const noexcept
 		{
-			return *mStates[state];
+			return mStyles[state];
+		}
+		/*!
+		 \brief Retrieves the ae::Widget's shape, shared by all of its states.
+		 \details The shape's geometry, such as its size, is set directly on it whereas its appearance is set per state with setStyle().
+		 \note The colors, outline thickness and texture set directly on the shape are overwritten by the next state change.
+
+		 \return The ae::Shape displaying the ae::Widget
+
+		 \par Example:
+		 \code
+		 auto button = std::make_unique<ae::Button>();
+		 ae::RectangleShape& shape = button->getShape();
+		 shape.setSize(200.f, 50.f);
+		 \endcode
+
+		 \sa setStyle()
+
+		 \since v0.7.0
+		*/
+		_NODISCARD T& getShape() noexcept
+		{
+			return *mShape;
+		}
+		/*!
+		 \brief Retrieves the ae::Widget's shape, shared by all of its states.
+
+		 \return The ae::Shape displaying the ae::Widget
+
+		 \sa setStyle()
+
+		 \since v0.7.0
+		*/
+		_NODISCARD const T& getShape() const noexcept
+		{
+			return *mShape;
 		}
 
 		// Public virtual method(s)
@@ -156,28 +273,32 @@ namespace ae
 		*/
 		_NODISCARD virtual Box2f getModelBounds() const override
 		{
-			return mStates[mActiveState]->getModelBounds();
+			return mShape->getModelBounds();
 		}
 	protected:
 		// Protected constructor(s)
 		/*!
 		 \brief Default constructor.
-		 \details The different states will be instantiated and attached to the ae::Widget, and the idle state will be enabled.
+		 \details The shape will be instantiated and attached to the ae::Widget, every state adopting its default appearance, and the idle state will be enabled.
 
 		 \since v0.5.0
 		*/
 		Widget()
 			: Actor2D()
 			, mTarget(&Application::getInstance().getWindow())
-			, mStates()
+			, mShape(nullptr)
+			, mStyles()
 			, mActiveState(State::Idle)
+			, mWidgetIndex(nullptr)
+			, mIndexedModelBounds()
+			, mIndexedStamp(0)
 		{
-			// Instantiate and attach the children states
-			for (size_t i = 0; i < State::StateCount; ++i) {
-				auto state = std::make_unique<T>();
-				mStates[i] = state.get();
-				attachChild(std::move(state));
-			}
+			// Instantiate and attach the shape shared by all states
+			auto shape = std::make_unique<T>();
+			mShape = shape.get();
+			attachChild(std::move(shape));
+
+			mStyles.fill(Style{ mShape->getFillColor(), mShape->getOutlineColor(), mShape->getOutlineThickness(), mShape->getTexture() });
 			enableState(mActiveState);
 		}
 		/*!
@@ -196,9 +317,17 @@ namespace ae
 		Widget(Widget<T>&& rvalue) noexcept
 			: Actor2D(std::move(rvalue))
 			, mTarget(rvalue.mTarget)
-			, mStates(rvalue.mStates)
+			, mShape(rvalue.mShape)
+			, mStyles(rvalue.mStyles)
 			, mActiveState(rvalue.mActiveState)
+			, mWidgetIndex(nullptr)
+			, mIndexedModelBounds()
+			, mIndexedStamp(0)
 		{
+			// Transfer the registration to the index
+			WidgetIndex* const index = rvalue.mWidgetIndex;
+			rvalue.setWidgetIndex(nullptr);
+			setWidgetIndex(index);
 		}
 	protected:
 		// Protected operator(s)
@@ -222,26 +351,115 @@ namespace ae
 			// Copy the rvalue's trivial data and move the rest
 			Actor2D::operator=(std::move(rvalue));
 			mTarget = rvalue.mTarget;
-			mStates = rvalue.mStates;
+			mShape = rvalue.mShape;
+			mStyles = rvalue.mStyles;
 			mActiveState = rvalue.mActiveState;
 
+			// Transfer the registration to the index
+			WidgetIndex* const index = rvalue.mWidgetIndex;
+			rvalue.setWidgetIndex(nullptr);
+			setWidgetIndex(index);
+
 			return *this;
 		}
 	protected:
 		// Protected method(s)
 		/*!
-		 \brief Enables event handling, updating and rendering for the active state, and disables it for the others.
+		 \brief Applies the style of the \a state provided to the shape.
+		 \details Only the shape's vertex colors, outline and texture are modified, its children and z-ordering are left untouched.
 
 		 \param[in] state The ae::Widget::State that will be enabled
 
+		 \sa setStyle()
+
 		 \since v0.5.0
 		*/
 		virtual void enableState(State state)
 		{
 			mActiveState = state;
-			for (size_t i = 0; i < State::StateCount; ++i) {
-				const bool FLAG = static_cast<State>(i) == mActiveState;
-				mStates[i]->activateFunctionality(Func::EventHandle | Func::Render, Target::Self | Target::Children, FLAG);
+			applyStyle(mStyles[state]);
+
+			// Hovered, clicked and focused widgets must receive every mouse event to be able to return to their idle state
+			if (mWidgetIndex) {
+				mWidgetIndex->setEngaged(*this, isEngaged(mActiveState));
+			}
+		}
+		/*!
+		 \brief Retrieves the ae::Widget's bounds in the application window's world coordinates, used to check if the mouse cursor is over it.
+
+		 \return The ae::Widget's hit bounds
+
+		 \sa isHoveredOver()
+
+		 \since v0.7.0
+		*/
+		_NODISCARD Box2f getHitBounds()
+		{
+			if (&Application::getInstance().getWindow() != mTarget) {
+				const Matrix4f GLOBAL_TRANSFORM = mTarget->getCamera()->getViewMatrix() * getGlobalTransform();
+				const Box2f MODEL_BOUNDS = getModelBounds();
+				return Box2f(Vector2f(GLOBAL_TRANSFORM * Vector3f(MODEL_BOUNDS.min)), Vector2f(GLOBAL_TRANSFORM * Vector3f(MODEL_BOUNDS.max)));
+			}
+			else {
+				return getGlobalBounds();
+			}
+		}
+		/*!
+		 \brief Checks whether the \a event should be handled by the ae::Widget.
+		 \details The mouse events are only handled when they're routed to the ae::Widget by its ae::WidgetIndex (if it's attached to one).
+
+		 \param[in] event The polled input ae::Event
+
+		 \return True if the ae::Widget should handle the \a event, false otherwise
+
+		 \sa setWidgetIndex()
+
+		 \since v0.7.0
+		*/
+		_NODISCARD bool isEventRouted(Event* const event) const noexcept
+		{
+			return !mWidgetIndex || !WidgetIndex::isRoutedEvent(*event) || mWidgetIndex->isRouting(*this);
+		}
+		/*!
+		 \brief Marks the \a event as consumed by the ae::Widget.
+		 \details The propagation of the mouse events is only stopped if they're routed by an ae::WidgetIndex, which delivers them to the engaged widgets first,
+		 so that the widgets traversed through the tree still receive the clicks made elsewhere. The other events' propagation is always stopped.
+
+		 \param[in] event The polled input ae::Event handled by the ae::Widget
+
+		 \sa isEventRouted()
+
+		 \since v0.7.0
+		*/
+		void consumeEvent(Event* const event) const noexcept
+		{
+			if (mWidgetIndex || !WidgetIndex::isRoutedEvent(*event)) {
+				event->stopPropagation();
+			}
+			else {
+				event->handled = true;
+			}
+		}
+		/*!
+		 \brief Updates the ae::Widget's hit bounds in its ae::WidgetIndex if its global transform or its model bounds changed.
+
+		 \sa setWidgetIndex()
+
+		 \since v0.7.0
+		*/
+		void updateWidgetIndex()
+		{
+			if (!mWidgetIndex) {
+				return;
+			}
+
+			// The hit bounds of widgets rendered to another target depend on that target's camera
+			const uint64_t STAMP = getGlobalTransformStamp();
+			const Box2f MODEL_BOUNDS = getModelBounds();
+			if (STAMP != mIndexedStamp || MODEL_BOUNDS != mIndexedModelBounds || &Application::getInstance().getWindow() != mTarget) {
+				mIndexedStamp = STAMP;
+				mIndexedModelBounds = MODEL_BOUNDS;
+				mWidgetIndex->update(*this, getHitBounds());
 			}
 		}
 
@@ -256,21 +474,22 @@ namespace ae
 		*/
 		_NODISCARD virtual bool isHoveredOver(const Vector2d& mousePos)
 		{
-			Window& appWindow = Application::getInstance().getWindow();
-			if (&appWindow != mTarget) {
-				const Matrix4f GLOBAL_TRANSFORM = mTarget->getCamera()->getViewMatrix() * getGlobalTransform();
-				const Box2f MODEL_BOUNDS = getModelBounds();
-				const Box2f GLOBAL_BOUNDS(Vector2f(GLOBAL_TRANSFORM * Vector3f(MODEL_BOUNDS.min)), Vector2f(GLOBAL_TRANSFORM * Vector3f(MODEL_BOUNDS.max)));
-				return GLOBAL_BOUNDS.contains(appWindow.mapPixelToCoords(mousePos));
-			}
-			else {
-				return getGlobalBounds().contains(mTarget->mapPixelToCoords(mousePos));
+			// Use the indexed hit bounds instead of walking the scene graph if possible
+			const Vector2f WORLD_POS = Application::getInstance().getWindow().mapPixelToCoords(mousePos);
+			if (mWidgetIndex) {
+				const std::pair<bool, Box2f> INDEXED_BOUNDS = mWidgetIndex->getBounds(*this);
+				if (INDEXED_BOUNDS.first) {
+					return INDEXED_BOUNDS.second.contains(WORLD_POS);
+				}
 			}
+
+			return getHitBounds().contains(WORLD_POS);
 		}
 	protected:
 		// Protected virtual method(s)
 		/*!
-		 \brief Corrects the ae::Widget's and its childrens' properties.
+		 \brief Updates the ae::Widget's entry in the widget index.
+		 \details The ae::Widget's and its childrens' properties are corrected by the layout pass when they're invalidated.
 
 		 \param[in] dt The time difference between the previous frame and the current frame
 
@@ -280,16 +499,73 @@ namespace ae
 		*/
 		virtual void updateSelf(const Time& dt) override
 		{
-			correctProperties();
+			AEON_MEMORY_SCOPE(MemoryTag::GUI);
+			updateWidgetIndex();
+		}
+		/*!
+		 \brief Checks whether the ae::Widget's layout depends on its children's model bounds.
+		 \details The ae::Widget's model bounds are its shape's, so it's laid out again whenever its shape is.
+
+		 \return True
+
+		 \since v0.7.0
+		*/
+		_NODISCARD virtual bool isLayoutDependentOnChildren() const noexcept override
+		{
+			return true;
 		}
 
 	protected:
 		// Protected member(s)
 		RenderTarget*               mTarget;      //!< The widget's render target
+	private:
+		// Private method(s)
+		/*!
+		 \brief Applies the \a style provided to the shape, its unchanged properties being left as is.
+
+		 \param[in] style The ae::Widget::Style to apply
+
+		 \since v0.7.0
+		*/
+		void applyStyle(const Style& style)
+		{
+			if (mShape->getFillColor() != style.fillColor) {
+				mShape->setFillColor(style.fillColor);
+			}
+			if (mShape->getOutlineColor() != style.outlineColor) {
+				mShape->setOutlineColor(style.outlineColor);
+			}
+			if (mShape->getOutlineThickness() != style.outlineThickness) {
+				mShape->setOutlineThickness(style.outlineThickness);
+			}
+			if (mShape->getTexture() != style.texture) {
+				mShape->setTexture(style.texture);
+			}
+		}
+
+		// Private static method(s)
+		/*!
+		 \brief Checks whether a widget in the \a state provided must receive every mouse event routed by its ae::WidgetIndex.
+
+		 \param[in] state The ae::Widget::State to check
+
+		 \return True if the \a state is hover, click or focus, false otherwise
+
+		 \since v0.7.0
+		*/
+		_NODISCARD static bool isEngaged(State state) noexcept
+		{
+			return state != State::Disabled && state != State::Idle;
+		}
+
 	private:
 		// Private member(s)
-		std::array<T*, State::StateCount> mStates;      //!< The different widgets based on the active state
-		State                             mActiveState; //!< The widget's active state
+		T*                                   mShape;              //!< The shape shared by all states
+		std::array<Style, State::StateCount> mStyles;             //!< The shape's appearance in each state
+		State                                mActiveState;        //!< The widget's active state
+		WidgetIndex*                         mWidgetIndex;        //!< The spatial index routing the widget's mouse events
+		Box2f                                mIndexedModelBounds; //!< The model bounds when the hit bounds were last indexed
+		uint64_t                             mIndexedStamp;       //!< The global transform stamp when the hit bounds were last indexed
 	};
 }
 #endif // Aeon_Graphics_GUI_Widget_H_
@@ -0,0 +1,300 @@
+// MIT License
+// 
+// Copyright(c) 2019-2021 Filippos Gleglakos
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#ifndef Aeon_Graphics_InstancedRenderer2D_H_
+#define Aeon_Graphics_InstancedRenderer2D_H_
+
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <utility>
+
+#include <AEON/Config.h>
+#include <AEON/Math/Matrix.h>
+#include <AEON/Graphics/BlendMode.h>
+#include <AEON/Graphics/internal/Renderer2D.h>
+#include <AEON/Graphics/internal/RingBuffer.h>
+
+namespace ae
+{
+	// Forward declaration(s)
+	class Buffer;
+	class Sampler;
+	class Shader;
+	class Texture;
+	class VertexBuffer;
+
+	/*!
+	 \brief Singleton class used as the 2D renderer specialized for textured quads.
+	*/
+	class AEON_API InstancedRenderer2D : public Renderer2D
+	{
+	private:
+		// Private struct(s)
+		/*!
+		 \brief The internal struct representing the per-instance attributes of a quad (48 bytes).
+		 \details The quad's transformed corners are given by origin + axisX * x + axisY * y, x and y being the unit quad's coordinates.
+		*/
+		struct InstanceData {
+			Vector2f axisX;    //!< The transformed horizontal edge of the quad
+			Vector2f axisY;    //!< The transformed vertical edge of the quad
+			Vector2f origin;   //!< The transformed position of the quad's first corner
+			Vector2f uvMin;    //!< The texture coordinates of the quad's first corner
+			Vector2f uvMax;    //!< The texture coordinates of the quad's opposite corner
+			uint8_t  color[4]; //!< The quad's RGBA color
+			float    depth;    //!< The quad's depth
+		};
+	private:
+		// Private typedef(s)
+		using TexturePasses = std::map<std::pair<const Texture*, const Sampler*>, std::vector<InstanceData>>;
+		using BlendPasses = std::map<BlendMode, TexturePasses>;
+		using ShaderPasses = std::map<const Shader*, BlendPasses>;
+
+	public:
+		// Public constructor(s)
+		/*!
+		 \brief Deleted copy constructor.
+
+		 \since v0.7.0
+		*/
+		InstancedRenderer2D(const InstancedRenderer2D&) = delete;
+		/*!
+		 \brief Deleted move constructor.
+
+		 \since v0.7.0
+		*/
+		InstancedRenderer2D(InstancedRenderer2D&&) = delete;
+	public:
+		// Public operator(s)
+		/*!
+		 \brief Deleted assignment operator.
+
+		 \since v0.7.0
+		*/
+		InstancedRenderer2D& operator=(const InstancedRenderer2D&) = delete;
+		/*!
+		 \brief Deleted move assignment operator.
+
+		 \since v0.7.0
+		*/
+		InstancedRenderer2D& operator=(InstancedRenderer2D&&) = delete;
+	public:
+		// Public virtual method(s)
+		/*!
+		 \brief Setups the ae::InstancedRenderer2D for rendering to the \a target provided.
+		 \details Uploads the ae::RenderTarget's camera's properties to the global transform UBO, enables depth-testing and activates the \a target.
+
+		 \param[in] target The ae::RenderTarget which will act as the scene's framebuffer
+
+		 \sa submit(), endScene()
+
+		 \since v0.7.0
+		*/
+		virtual void beginScene(RenderTarget& target) override final;
+		/*!
+		 \brief Renders the quads submitted with one instanced drawcall per shader, blend mode and texture.
+		 \details The opaque quads are rendered front-to-back followed by the transparent quads back-to-front.
+		 \note The beginScene() and submit() methods must be called prior to calling this method for correct results.
+
+		 \sa beginScene(), submit()
+
+		 \since v0.7.0
+		*/
+		virtual void endScene() override final;
+		/*!
+		 \brief Adds a submission to the ae::InstancedRenderer2D to be rendered.
+		 \details Quads (4 vertices sharing a color and a depth, and 6 indices in the order of ae::Sprite's) rendered with the built-in
+		 "_AEON_Basic2D" shader are converted into 48-byte instances which are rendered once the scene ends.\n
+		 Any other submission is rendered immediately, as done by the ae::BasicRenderer2D.
+		 \note This method is automatically called by Aeon's derived classes of ae::Renderable2D.\n
+		 The beginScene() method must be called prior to calling this method for correct results.
+
+		 \param[in] vertices The list of vertices to be rendered
+		 \param[in] indices The list of associated indices to be rendered
+		 \param[in] states The ae::RenderStates (texture, transform, blend mode, shader) to be applied to the geometry
+
+		 \sa beginScene(), endScene()
+
+		 \since v0.7.0
+		*/
+		virtual void submit(const Vertex2DList& vertices, const std::vector<unsigned int>& indices, const RenderStates& states) override final;
+
+		// Public method(s)
+		/*!
+		 \brief Sets whether the instances are culled against the camera's view on the GPU before being rendered.
+		 \details When enabled, a compute pass tests each instance's bounds against the view of the ae::RenderTarget's camera and compacts
+		 the visible instances into a separate buffer, each group of 256 instances writing its own drawing command. The instances are then
+		 rendered with a single glMultiDrawElementsIndirect drawcall per texture pass, so the quads outside of the view cost no vertex
+		 processing and the CPU does no per-instance culling work.
+		 \note This is worthwhile for very large numbers of instances of which a good part is off-screen, such as the tiles and particles of
+		 a large world. The instances keep their order, so the transparent quads are still blended back-to-front.
+
+		 \param[in] enabled True to cull the instances on the GPU, false otherwise (default)
+
+		 \par Example:
+		 \code
+		 ae::InstancedRenderer2D::getInstance().setGPUCulling(true);
+		 \endcode
+
+		 \sa hasGPUCulling()
+
+		 \since v0.7.0
+		*/
+		void setGPUCulling(bool enabled) noexcept;
+		/*!
+		 \brief Checks whether the instances are culled against the camera's view on the GPU.
+
+		 \return True if the instances are culled on the GPU, false otherwise
+
+		 \sa setGPUCulling()
+
+		 \since v0.7.0
+		*/
+		_NODISCARD bool hasGPUCulling() const noexcept;
+
+		// Public static method(s)
+		/*!
+		 \brief Retrieves the single instance of the ae::InstancedRenderer2D.
+
+		 \return The single instance of the ae::InstancedRenderer2D
+
+		 \par Example:
+		 \code
+		 ae::InstancedRenderer2D& renderer = ae::InstancedRenderer2D::getInstance();
+		 \endcode
+
+		 \since v0.7.0
+		*/
+		static InstancedRenderer2D& getInstance();
+	private:
+		// Private constructor(s)
+		/*!
+		 \brief Default constructor.
+		 \details Retrieves the instancing VAO and creates the ring buffer through which the instances are streamed.
+
+		 \since v0.7.0
+		*/
+		InstancedRenderer2D();
+
+		// Private method(s)
+		/*!
+		 \brief Renders the instances of the \a drawcalls provided sorted by their depth.
+
+		 \param[in] drawcalls The ae::InstancedRenderer2D::ShaderPasses which will be rendered
+		 \param[in] frontToBack Whether the instances should be rendered front-to-back (opaque) or back-to-front (transparent)
+
+		 \since v0.7.0
+		*/
+		void flush(ShaderPasses& drawcalls, bool frontToBack);
+		/*!
+		 \brief Uploads the \a instances provided to the ring buffer and issues their instanced drawcalls.
+		 \details The instances are split into as many drawcalls as necessary if they don't fit within the ring's regions.
+		 If the GPU culling is enabled, the instances are culled and compacted by a compute pass before being rendered indirectly.
+
+		 \param[in] instances The list of instances which will be rendered
+		 \param[in] shader The ae::Shader rendering the instances, bound again after the compute pass
+
+		 \since v0.7.0
+		*/
+		void drawInstances(const std::vector<InstanceData>& instances, const Shader& shader);
+		/*!
+		 \brief Creates the buffers of the GPU culling (if they weren't already) and binds them along with the ring to the culling shader's binding points.
+
+		 \since v0.7.0
+		*/
+		void prepareGPUCulling();
+		/*!
+		 \brief Renders the geometry provided immediately (used for the submissions that can't be instanced).
+
+		 \param[in] vertices The list of vertices to be rendered
+		 \param[in] indices The list of associated indices to be rendered
+		 \param[in] states The ae::RenderStates (texture, transform, blend mode, shader) to be applied to the geometry
+
+		 \since v0.7.0
+		*/
+		void drawGeometry(const Vertex2DList& vertices, const std::vector<unsigned int>& indices, const RenderStates& states);
+		/*!
+		 \brief Converts the quad provided into an instance.
+
+		 \param[in] vertices The list of vertices of the quad
+		 \param[in] indices The list of associated indices of the quad
+		 \param[in] transform The transform which will be applied to the quad
+		 \param[out] instance The ae::InstancedRenderer2D::InstanceData which will be filled in
+
+		 \return True if the geometry provided could be converted into an instance, false otherwise
+
+		 \since v0.7.0
+		*/
+		_NODISCARD bool extractInstance(const Vertex2DList& vertices, const std::vector<unsigned int>& indices, const Matrix4f& transform, InstanceData& instance) const;
+
+	private:
+		// Private member(s)
+		ShaderPasses                           mOpaqueCalls;      //!< The list of all drawcalls for opaque quads
+		ShaderPasses                           mTransparentCalls; //!< The list of all drawcalls for transparent quads
+		std::shared_ptr<VertexArray>           mInstanceVAO;      //!< The VAO containing the unit quad and the per-instance attributes
+		RingBuffer                             mInstanceRing;     //!< The persistently-mapped ring used to stream the instances
+		std::map<const Shader*, const Shader*> mInstanceShaders;  //!< The built-in shaders and their instanced counterparts
+		std::vector<Vertex2D>                  mVertexScratch;    //!< The list of transformed vertices reused by the immediate drawcalls
+		std::shared_ptr<Shader>                mCullShader;       //!< The compute shader culling and compacting the instances (GPU culling)
+		std::unique_ptr<VertexBuffer>          mCulledInstances;  //!< The visible instances, laid out like the ring (GPU culling)
+		std::unique_ptr<Buffer>                mCommandBuffer;    //!< The drawing commands of each group of 256 instances of the ring (GPU culling)
+		bool                                   mGPUCulling;       //!< Whether the instances are culled on the GPU
+	};
+}
+#endif // Aeon_Graphics_InstancedRenderer2D_H_
+
+/*!
+ \class ae::InstancedRenderer2D
+ \ingroup graphics
+
+ The ae::InstancedRenderer2D singleton class is a 2D renderer specialized for
+ scenes composed mostly of quads, such as particles and tile maps. Each
+ ae::Sprite submitted (or any other quad laid out like one) is reduced to 48
+ bytes of per-instance attributes (its transformed edges and origin, its texture
+ coordinates, its color and its depth) which are streamed through a
+ persistently-mapped ring buffer and expanded from a shared unit quad on the
+ GPU, instead of uploading 4 transformed vertices and 6 indices per quad.
+
+ The submissions which can't be instanced are rendered immediately, just like
+ the ae::BasicRenderer2D would.
+
+ For very large numbers of instances, the instances may be culled against the
+ camera's view on the GPU (see setGPUCulling()): a compute pass compacts the
+ visible instances and writes their drawing commands, which are then consumed
+ by indirect drawcalls without the CPU reading anything back.
+
+ Usage example:
+ \code
+ ae::InstancedRenderer2D& renderer = ae::InstancedRenderer2D::getInstance();
+ renderer.beginScene(window);
+ for (ae::Sprite& particle : particles) {
+	particle.render(states);
+ }
+ renderer.endScene();
+ \endcode
+
+ \author Filippos Gleglakos
+ \version v0.7.0
+ \date 2021.07.05
+ \copyright MIT License
+*/
\ No newline at end of file
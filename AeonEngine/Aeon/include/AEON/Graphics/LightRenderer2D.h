@@ -0,0 +1,248 @@
+// MIT License
+// 
+// Copyright(c) 2019-2021 Filippos Gleglakos
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef Aeon_Graphics_LightRenderer2D_H_
+#define Aeon_Graphics_LightRenderer2D_H_
+
+#include <vector>
+#include <memory>
+
+#include <AEON/Config.h>
+#include <AEON/Math/Vector.h>
+#include <AEON/Graphics/Color.h>
+
+namespace ae
+{
+	// Forward declaration(s)
+	class RenderTarget;
+	class RenderTexture;
+	class Shader;
+	class VertexArray;
+
+	/*!
+	 \brief Singleton class used to light the 2D scenes by accumulating their lights into a reduced-resolution light buffer.
+	*/
+	class AEON_API LightRenderer2D
+	{
+	public:
+		// Public constructor(s)
+		/*!
+		 \brief Deleted copy constructor.
+
+		 \since v0.7.0
+		*/
+		LightRenderer2D(const LightRenderer2D&) = delete;
+		/*!
+		 \brief Deleted move constructor.
+
+		 \since v0.7.0
+		*/
+		LightRenderer2D(LightRenderer2D&&) = delete;
+	public:
+		// Public operator(s)
+		/*!
+		 \brief Deleted assignment operator.
+
+		 \since v0.7.0
+		*/
+		LightRenderer2D& operator=(const LightRenderer2D&) = delete;
+		/*!
+		 \brief Deleted move assignment operator.
+
+		 \since v0.7.0
+		*/
+		LightRenderer2D& operator=(LightRenderer2D&&) = delete;
+	public:
+		// Public method(s)
+		/*!
+		 \brief Begins the lighting of the scene that was rendered into the \a target provided.
+		 \details The lights submitted until endScene() are positioned with the \a target's camera, so this method should be called once the scene's renderer has ended its scene.
+
+		 \param[in] target The ae::RenderTarget whose scene will be lit
+
+		 \sa submit(), endScene()
+
+		 \since v0.7.0
+		*/
+		void beginScene(RenderTarget& target);
+		/*!
+		 \brief Submits a point light whose intensity falls off quadratically until its \a radius.
+		 \note The lights don't go through the depth sorting nor the batching of the 2D renderers, they're accumulated in a single instanced drawcall.
+
+		 \param[in] position The light's center in world coordinates
+		 \param[in] radius The light's radius in world units
+		 \param[in] color The light's ae::Color
+		 \param[in] intensity The factor applied to the light's color, 1 by default
+
+		 \since v0.7.0
+		*/
+		void submit(const Vector2f& position, float radius, const Color& color, float intensity = 1.f);
+		/*!
+		 \brief Accumulates the submitted lights into the light buffer and composites it over the scene's target.
+		 \details The light buffer is cleared with the ambient color, lit by every light additively, and the scene's colors are multiplied by it in a single full-screen pass,
+		 the bilinear upscaling smoothing the lights' gradients.
+
+		 \sa beginScene()
+
+		 \since v0.7.0
+		*/
+		void endScene();
+		/*!
+		 \brief Sets the scale applied to the target's resolution to size the light buffer.
+		 \details The lights' cost is proportional to the light buffer's size rather than to the target's resolution, the soft gradients of the lights hiding the reduced resolution.
+
+		 \param[in] scale The resolution scale, clamped to the range ]0,1], 0.5 by default
+
+		 \par Example:
+		 \code
+		 // Accumulate the lights at quarter resolution on the integrated GPUs
+		 ae::LightRenderer2D::getInstance().setResolutionScale(0.25f);
+		 \endcode
+
+		 \since v0.7.0
+		*/
+		void setResolutionScale(float scale) noexcept;
+		/*!
+		 \brief Sets the ambient light, which lights the regions that aren't reached by any light.
+
+		 \param[in] color The ambient ae::Color, ae::Color::Black by default (the regions unlit being entirely dark)
+
+		 \since v0.7.0
+		*/
+		void setAmbientColor(const Color& color);
+		/*!
+		 \brief Retrieves the scale applied to the target's resolution to size the light buffer.
+
+		 \return The resolution scale
+
+		 \since v0.7.0
+		*/
+		_NODISCARD float getResolutionScale() const noexcept;
+		/*!
+		 \brief Retrieves the ambient light.
+
+		 \return The ambient ae::Color
+
+		 \since v0.7.0
+		*/
+		_NODISCARD const Color& getAmbientColor() const noexcept;
+		/*!
+		 \brief Retrieves the number of lights accumulated during the last scene.
+
+		 \return The number of lights
+
+		 \since v0.7.0
+		*/
+		_NODISCARD size_t getLightCount() const noexcept;
+
+		// Public static method(s)
+		/*!
+		 \brief Retrieves the single instance of the ae::LightRenderer2D.
+
+		 \return The single instance of the ae::LightRenderer2D
+
+		 \since v0.7.0
+		*/
+		_NODISCARD static LightRenderer2D& getInstance();
+
+	private:
+		// Private struct(s)
+		/*!
+		 \brief The internal struct representing a light's per-instance attributes.
+		*/
+		struct LightData
+		{
+			Vector2f center; //!< The light's center in world coordinates
+			float    radius; //!< The light's radius
+			Vector4f color;  //!< The light's normalized color, its alpha channel holding the intensity
+		};
+
+	private:
+		// Private constructor(s)
+		/*!
+		 \brief Default constructor.
+		 \details Retrieves the built-in light shaders and VAO.
+
+		 \since v0.7.0
+		*/
+		LightRenderer2D();
+		/*!
+		 \brief Destructor.
+
+		 \since v0.7.0
+		*/
+		~LightRenderer2D();
+
+	private:
+		// Private member(s)
+		std::vector<LightData>         mLights;          //!< The lights submitted during the current scene
+		std::unique_ptr<RenderTexture> mLightBuffer;     //!< The reduced-resolution render texture into which the lights are accumulated
+		std::shared_ptr<Shader>        mLightShader;     //!< The shader accumulating the lights
+		std::shared_ptr<Shader>        mCompositeShader; //!< The shader compositing the light buffer over the scene
+		std::shared_ptr<VertexArray>   mLightVAO;        //!< The VAO instancing the unit quad once per light
+		RenderTarget*                  mRenderTarget;    //!< The target of the current scene, nullptr if there's none
+		Color                          mAmbientColor;    //!< The color with which the light buffer is cleared
+		float                          mResolutionScale; //!< The scale applied to the target's resolution to size the light buffer
+		size_t                         mLightCount;      //!< The number of lights accumulated during the last scene
+	};
+}
+#endif // Aeon_Graphics_LightRenderer2D_H_
+
+/*!
+ \class ae::LightRenderer2D
+ \ingroup graphics
+
+ The ae::LightRenderer2D singleton class lights the 2D scenes without going
+ through the 2D renderers: the lights aren't depth-sorted, batched nor drawn at
+ the target's full resolution like additive sprites would be. They're instead
+ accumulated additively into a light buffer whose resolution is a fraction of
+ the target's (see setResolutionScale()) by a single instanced drawcall, and the
+ scene's colors are multiplied by the light buffer in a single full-screen pass.
+
+ The lights' cost thus scales with the light buffer's size rather than with the
+ target's resolution times the lights' overdraw.
+
+ Usage example:
+ \code
+ void GameState::render()
+ {
+	// Render the scene
+	ae::BatchRenderer2D& renderer = ae::BatchRenderer2D::getInstance();
+	renderer.beginScene(mWindow);
+	mScene.render(ae::RenderStates());
+	renderer.endScene();
+
+	// Light it
+	ae::LightRenderer2D& lightRenderer = ae::LightRenderer2D::getInstance();
+	lightRenderer.beginScene(mWindow);
+	for (const Torch& torch : mTorches) {
+		lightRenderer.submit(torch.position, 200.f, ae::Color(255, 180, 100));
+	}
+	lightRenderer.endScene();
+ }
+ \endcode
+
+ \author Filippos Gleglakos
+ \version v0.7.0
+ \date 2021.07.05
+ \copyright MIT License
+*/
\ No newline at end of file
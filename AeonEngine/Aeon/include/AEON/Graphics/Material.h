@@ -23,17 +23,19 @@
 #ifndef Aeon_Graphics_Material_H_
 #define Aeon_Graphics_Material_H_
 
+#include <cstdint>
+#include <string>
 #include <vector>
 #include <memory>
 
 #include <AEON/Config.h>
+#include <AEON/Math/Vector.h>
+#include <AEON/Graphics/Shader.h>
 
 namespace ae
 {
 	// Forward declaration(s)
-	class Shader;
 	class Texture;
-	class UniformBuffer;
 
 	/*!
 	 \brief The class representing a material used to define properties determining how light affects an object.
@@ -44,6 +46,7 @@ namespace ae
 		// Public constructor(s)
 		/*!
 		 \brief Constructs the ae::Material by providing a name and an ae::Shader program to use.
+		 \details The ae::Material is assigned a compact ID in the ae::MaterialLibrary and the library's shader storage buffer is assigned to the \a shader's "uMaterialBuffer" storage block.
 
 		 \param[in] name A name to assign to this ae::Material
 		 \param[in] shader The ae::Shader to use
@@ -58,6 +61,13 @@ namespace ae
 		 \since v0.4.0
 		*/
 		Material(const std::string& name, const std::shared_ptr<Shader>& shader);
+		/*!
+		 \brief Destructor.
+		 \details Releases the ae::Material's ID so that it may be reused.
+
+		 \since v0.7.0
+		*/
+		~Material();
 		/*!
 		 \brief Deleted copy constructor.
 
@@ -94,6 +104,8 @@ namespace ae
 		 \li "specular" (ae::Vector3f)
 		 \li "shininess" (float)
 
+		 The typed setters (setAmbient(), setDiffuse(), setSpecular() and setShininess()) should be preferred as they don't look the uniform up by its name.
+
 		 \param[in] name A string containing the name of one of the valid uniform names
 		 \param[in] data The pointer to the uniform's new data
 		 \param[in] size The size of the uniform's new \a data in bytes (sizeof() of the data's type)
@@ -109,13 +121,81 @@ namespace ae
 		 material.setUniform("ambient", materialAmbient.elements.data(), sizeof(ae::Vector3f));
 		 \endcode
 
+		 \sa setAmbient(), setDiffuse(), setSpecular(), setShininess()
+
 		 \since v0.4.0
 		*/
 		void setUniform(const std::string& name, const void* data, size_t size);
 		/*!
-		 \brief 
+		 \brief Sets the ae::Material's ambient reflectance.
+
+		 \param[in] ambient An ae::Vector3f containing the ambient reflectance
+
+		 \par Example:
+		 \code
+		 material.setAmbient(ae::Vector3f(0.0215f, 0.1745f, 0.0215f));
+		 \endcode
+
+		 \since v0.7.0
+		*/
+		void setAmbient(const Vector3f& ambient);
+		/*!
+		 \brief Sets the ae::Material's diffuse reflectance.
+
+		 \param[in] diffuse An ae::Vector3f containing the diffuse reflectance
+
+		 \since v0.7.0
+		*/
+		void setDiffuse(const Vector3f& diffuse);
+		/*!
+		 \brief Sets the ae::Material's specular reflectance.
+
+		 \param[in] specular An ae::Vector3f containing the specular reflectance
+
+		 \since v0.7.0
+		*/
+		void setSpecular(const Vector3f& specular);
+		/*!
+		 \brief Sets the ae::Material's specular exponent.
+
+		 \param[in] shininess The specular exponent
+
+		 \since v0.7.0
+		*/
+		void setShininess(float shininess);
+		/*!
+		 \brief Adds a \a texture to the ae::Material's list of textures.
+		 \details The textures are bound to consecutive texture units, in the order of which they were added, when the ae::Material is bound.
+
+		 \param[in] texture The ae::Texture to add
+
+		 \sa bind()
+
+		 \since v0.4.0
 		*/
 		void setTexture(const std::shared_ptr<Texture>& texture);
+		/*!
+		 \brief Binds the ae::Material's shader and textures, and selects the ae::Material's parameters.
+		 \details The parameters modified since the last bind are uploaded to the ae::MaterialLibrary first. Only the shader's "uMaterialID" uniform is modified
+		 to select the material, so that consecutive materials sharing the same shader don't rebind any buffer.
+
+		 \par Example:
+		 \code
+		 // Render the meshes sorted by their materials' sort keys
+		 std::sort(meshes.begin(), meshes.end(), [](const Mesh* a, const Mesh* b) {
+			return a->material->getSortKey() < b->material->getSortKey();
+		 });
+		 for (const Mesh* mesh : meshes) {
+			mesh->material->bind();
+			mesh->draw();
+		 }
+		 \endcode
+
+		 \sa getSortKey()
+
+		 \since v0.7.0
+		*/
+		void bind();
 		/*!
 		 \brief Retrieves the ae::Material's assigned name.
 
@@ -150,13 +230,36 @@ namespace ae
 		 \since v0.4.0
 		*/
 		_NODISCARD const Shader& getShader() const noexcept;
+		/*!
+		 \brief Retrieves the ae::Material's compact ID, which is its index in the ae::MaterialLibrary's shader storage buffer.
+
+		 \return The ae::Material's ID
+
+		 \sa getSortKey()
+
+		 \since v0.7.0
+		*/
+		_NODISCARD uint16_t getID() const noexcept;
+		/*!
+		 \brief Retrieves the ae::Material's key with which the renderers may sort their draws.
+		 \details The shader's compact ID (see ae::Shader::getID()) occupies the most significant bits so that the materials sharing the same shader are drawn consecutively,
+		 followed by the ae::Material's ID.
+
+		 \return The ae::Material's sort key
+
+		 \sa getID(), bind()
+
+		 \since v0.7.0
+		*/
+		_NODISCARD uint32_t getSortKey() const noexcept;
 
 	private:
 		// Private member(s)
 		const std::string                     mName;     //!< The material's assigned name
 		std::vector<std::shared_ptr<Texture>> mTextures; //!< The list of textures
 		std::shared_ptr<Shader>               mShader;   //!< The shader program to use
-		std::shared_ptr<UniformBuffer>        mUBO;      //!< The UBO containing the light reaction properties
+		Shader::UniformHandle                 mIDHandle; //!< The handle of the shader's "uMaterialID" uniform
+		uint16_t                              mID;       //!< The material's index in the ae::MaterialLibrary
 	};
 }
 #endif // Aeon_Graphics_Material_H_
@@ -168,6 +271,10 @@ namespace ae
  The ae::Material class contains several properties that determine how a mesh
  reacts to light, as well as one or more textures that be wrapped on said mesh.
 
+ The properties of every material are stored by the ae::MaterialLibrary in a
+ single shader storage buffer indexed by the materials' IDs, see
+ ae::MaterialLibrary for the storage block that the shaders must declare.
+
  \author Filippos Gleglakos
  \version v0.4.0
  \date 2020.01.07
@@ -0,0 +1,226 @@
+// MIT License
+// 
+// Copyright(c) 2019-2021 Filippos Gleglakos
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+
+#ifndef Aeon_Graphics_MaterialLibrary_H_
+#define Aeon_Graphics_MaterialLibrary_H_
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include <AEON/Config.h>
+#include <AEON/Math/Vector.h>
+
+namespace ae
+{
+	// Forward declaration(s)
+	class Shader;
+	class ShaderStorageBuffer;
+
+	/*!
+	 \brief Singleton class storing the parameters of every ae::Material in a single shader storage buffer indexed by the materials' IDs.
+	*/
+	class AEON_API MaterialLibrary
+	{
+	public:
+		// Public struct(s)
+		/*!
+		 \brief The struct representing the parameters of a single material, laid out as the shaders' std430 Material struct.
+		*/
+		struct AEON_API MaterialData
+		{
+			Vector3f ambient;   //!< The ambient reflectance
+			float    shininess; //!< The specular exponent
+			Vector3f diffuse;   //!< The diffuse reflectance
+			float    padding0;  //!< Unused, pads the diffuse reflectance to 16 bytes
+			Vector3f specular;  //!< The specular reflectance
+			float    padding1;  //!< Unused, pads the specular reflectance to 16 bytes
+		};
+
+	public:
+		// Public constructor(s)
+		/*!
+		 \brief Deleted copy constructor.
+
+		 \since v0.7.0
+		*/
+		MaterialLibrary(const MaterialLibrary&) = delete;
+		/*!
+		 \brief Deleted move constructor.
+
+		 \since v0.7.0
+		*/
+		MaterialLibrary(MaterialLibrary&&) = delete;
+	public:
+		// Public operator(s)
+		/*!
+		 \brief Deleted assignment operator.
+
+		 \since v0.7.0
+		*/
+		MaterialLibrary& operator=(const MaterialLibrary&) = delete;
+		/*!
+		 \brief Deleted move assignment operator.
+
+		 \since v0.7.0
+		*/
+		MaterialLibrary& operator=(MaterialLibrary&&) = delete;
+	public:
+		// Public method(s)
+		/*!
+		 \brief Reserves a slot for a new material and retrieves its ID.
+		 \details The IDs of the released materials are reused first so that the IDs remain compact.
+		 \note This method is automatically called by the ae::Material's constructor.
+
+		 \return The new material's ID, which is its index in the shaders' material array
+
+		 \sa release()
+
+		 \since v0.7.0
+		*/
+		_NODISCARD uint16_t allocate();
+		/*!
+		 \brief Releases the slot of the material \a id so that it may be reused.
+		 \note This method is automatically called by the ae::Material's destructor.
+
+		 \param[in] id The ID of the material to release
+
+		 \sa allocate()
+
+		 \since v0.7.0
+		*/
+		void release(uint16_t id);
+		/*!
+		 \brief Sets the parameters of the material \a id.
+		 \details The parameters are copied into the CPU copy of the buffer and are only uploaded by upload().
+
+		 \param[in] id The ID of the material
+		 \param[in] data The ae::MaterialLibrary::MaterialData containing the new parameters
+
+		 \sa getData(), upload()
+
+		 \since v0.7.0
+		*/
+		void setData(uint16_t id, const MaterialData& data);
+		/*!
+		 \brief Retrieves the parameters of the material \a id.
+
+		 \param[in] id The ID of the material
+
+		 \return The ae::MaterialLibrary::MaterialData containing the material's parameters
+
+		 \sa setData()
+
+		 \since v0.7.0
+		*/
+		_NODISCARD const MaterialData& getData(uint16_t id) const;
+		/*!
+		 \brief Uploads the parameters modified since the last upload in a single call.
+		 \details The shader storage buffer is grown when materials were allocated beyond its size, in which case every material is uploaded.
+		 \note This method is automatically called when an ae::Material is bound.
+
+		 \since v0.7.0
+		*/
+		void upload();
+		/*!
+		 \brief Assigns the materials' shader storage buffer to the \a shader's "uMaterialBuffer" storage block.
+		 \note This method is automatically called by the ae::Material's constructor.
+
+		 \param[in] shader The ae::Shader which declares the "uMaterialBuffer" storage block
+
+		 \since v0.7.0
+		*/
+		void attach(Shader& shader) const;
+		/*!
+		 \brief Retrieves the number of material slots, including the released ones.
+
+		 \return The number of material slots
+
+		 \since v0.7.0
+		*/
+		_NODISCARD size_t getCapacity() const noexcept;
+
+		// Public static method(s)
+		/*!
+		 \brief Retrieves the single instance of the ae::MaterialLibrary.
+		 \note The first call creates the shader storage buffer, it must therefore be made on the OpenGL context's thread.
+
+		 \return The single instance of the ae::MaterialLibrary
+
+		 \since v0.7.0
+		*/
+		_NODISCARD static MaterialLibrary& getInstance();
+	private:
+		// Private constructor(s)
+		/*!
+		 \brief Default constructor.
+		 \details Creates the shader storage buffer through the ae::GLResourceFactory.
+
+		 \since v0.7.0
+		*/
+		MaterialLibrary();
+
+	private:
+		// Private member(s)
+		std::vector<MaterialData>            mMaterials;  //!< The CPU copy of every material's parameters, indexed by their IDs
+		std::vector<uint16_t>                mFreeIDs;    //!< The IDs of the released materials
+		std::shared_ptr<ShaderStorageBuffer> mBuffer;     //!< The shader storage buffer containing every material's parameters
+		size_t                               mDirtyBegin; //!< The index of the first material modified since the last upload
+		size_t                               mDirtyEnd;   //!< The index past the last material modified since the last upload, equal to mDirtyBegin if nothing was modified
+	};
+}
+#endif // Aeon_Graphics_MaterialLibrary_H_
+
+/*!
+ \class ae::MaterialLibrary
+ \ingroup graphics
+
+ The ae::MaterialLibrary singleton class stores the parameters of every
+ ae::Material in a single shader storage buffer. Each material is assigned a
+ compact ID which is its index in the buffer, so that the shaders only need
+ the material's ID to retrieve its parameters. Switching from one material to
+ another sharing the same shader is then reduced to an index change, instead
+ of binding another uniform buffer per material.
+
+ The shaders access the materials through the following storage block:
+ \code
+ struct Material {
+ 	vec3  ambient;
+ 	float shininess;
+ 	vec3  diffuse;
+ 	vec3  specular;
+ };
+
+ layout (std430) readonly buffer uMaterialBuffer {
+ 	Material materials[];
+ };
+
+ uniform uint uMaterialID;
+ \endcode
+
+ \author Filippos Gleglakos
+ \version v0.7.0
+ \date 2021.07.25
+ \copyright MIT License
+*/
\ No newline at end of file
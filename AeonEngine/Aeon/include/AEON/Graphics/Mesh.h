@@ -0,0 +1,300 @@
+// MIT License
+// 
+// Copyright(c) 2019-2021 Filippos Gleglakos
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef Aeon_Graphics_Mesh_H_
+#define Aeon_Graphics_Mesh_H_
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <AEON/Config.h>
+#include <AEON/Math/Vector.h>
+#include <AEON/Math/AABoxCollider.h>
+
+namespace ae
+{
+	// Forward declaration(s)
+	class VertexBuffer;
+	class IndexBuffer;
+
+	/*!
+	 \brief Struct representing a 3-dimensional vertex which the ae::Mesh instances will use.
+	*/
+	struct Vertex3D
+	{
+		Vector3f position; //!< The vertex's position
+		Vector3f normal;   //!< The vertex's normal
+		Vector2f uv;       //!< The vertex's texture coordinates
+	};
+
+	/*!
+	 \brief The class representing static 3D geometry stored on the GPU, which may be rendered by the ae::Renderer3D.
+	*/
+	class AEON_API Mesh
+	{
+	public:
+		// Public struct(s)
+		/*!
+		 \brief The range of indices of a part of the ae::Mesh, such as the triangles sharing a material.
+		*/
+		struct Submesh
+		{
+			unsigned int firstIndex; //!< The index of the submesh's first index
+			unsigned int indexCount; //!< The number of indices forming the submesh's triangles
+			Box3f        bounds;     //!< The model bounding box of the submesh (position and size)
+		};
+
+	public:
+		// Public constructor(s)
+		/*!
+		 \brief Default constructor.
+		 \details Assigns a unique ID to the ae::Mesh, its geometry is provided with create().
+
+		 \since v0.7.0
+		*/
+		Mesh();
+		/*!
+		 \brief Destructor.
+		 \details Deletes the ae::Mesh's OpenGL buffers.
+
+		 \since v0.7.0
+		*/
+		~Mesh();
+		/*!
+		 \brief Deleted copy constructor.
+
+		 \since v0.7.0
+		*/
+		Mesh(const Mesh&) = delete;
+		/*!
+		 \brief Deleted move constructor.
+
+		 \since v0.7.0
+		*/
+		Mesh(Mesh&&) = delete;
+	public:
+		// Public operator(s)
+		/*!
+		 \brief Deleted assignment operator.
+
+		 \since v0.7.0
+		*/
+		Mesh& operator=(const Mesh&) = delete;
+		/*!
+		 \brief Deleted move assignment operator.
+
+		 \since v0.7.0
+		*/
+		Mesh& operator=(Mesh&&) = delete;
+	public:
+		// Public method(s)
+		/*!
+		 \brief Uploads the \a vertices and \a indices provided to the GPU, replacing the ae::Mesh's previous geometry.
+		 \details The ae::Mesh's model bounds are computed from the \a vertices' positions and a single submesh covers all of the \a indices.
+		 \note The triangles are expected to be wound counter-clockwise as their back faces are culled.
+
+		 \param[in] vertices The list of vertices of the ae::Mesh
+		 \param[in] indices The list of indices forming the ae::Mesh's triangles
+
+		 \par Example:
+		 \code
+		 const std::vector<ae::Vertex3D> vertices = {
+			{ ae::Vector3f(-1.f, 0.f, 0.f), ae::Vector3f(0.f, 0.f, 1.f), ae::Vector2f(0.f, 0.f) },
+			{ ae::Vector3f( 1.f, 0.f, 0.f), ae::Vector3f(0.f, 0.f, 1.f), ae::Vector2f(1.f, 0.f) },
+			{ ae::Vector3f( 0.f, 1.f, 0.f), ae::Vector3f(0.f, 0.f, 1.f), ae::Vector2f(0.5f, 1.f) }
+		 };
+		 const std::vector<unsigned int> indices = { 0, 1, 2 };
+
+		 ae::Mesh triangle;
+		 triangle.create(vertices, indices);
+		 \endcode
+
+		 \since v0.7.0
+		*/
+		void create(const std::vector<Vertex3D>& vertices, const std::vector<unsigned int>& indices);
+		/*!
+		 \brief Loads a mesh previously written with saveToFile().
+		 \details The file is memory-mapped and its interleaved vertices and indices are uploaded directly into the ae::Mesh's buffers, nothing is parsed or copied.
+		 The ae::VertexBuffer's layout, the indices' type (16-bit or 32-bit), the submeshes and the bounds are read from the file's header.
+
+		 \param[in] filename The string containing the filepath of the mesh file
+
+		 \return True if the mesh was loaded successfully, false otherwise
+
+		 \par Example:
+		 \code
+		 ae::Mesh tree;
+		 if (!tree.loadFromFile("Resources/Meshes/tree.aemesh")) {
+			...
+		 }
+		 \endcode
+
+		 \sa saveToFile()
+
+		 \since v0.7.0
+		*/
+		bool loadFromFile(const std::string& filename);
+		/*!
+		 \brief Retrieves the submeshes of the ae::Mesh.
+
+		 \return The list of ae::Mesh::Submesh
+
+		 \since v0.7.0
+		*/
+		_NODISCARD const std::vector<Submesh>& getSubmeshes() const noexcept;
+		/*!
+		 \brief Retrieves the ae::VertexBuffer containing the ae::Mesh's vertices.
+
+		 \return The ae::Mesh's ae::VertexBuffer, nullptr if create() hasn't been called
+
+		 \since v0.7.0
+		*/
+		_NODISCARD const VertexBuffer* getVBO() const noexcept;
+		/*!
+		 \brief Retrieves the ae::IndexBuffer containing the ae::Mesh's indices.
+
+		 \return The ae::Mesh's ae::IndexBuffer, nullptr if create() hasn't been called
+
+		 \since v0.7.0
+		*/
+		_NODISCARD const IndexBuffer* getIBO() const noexcept;
+		/*!
+		 \brief Retrieves the number of indices forming the ae::Mesh's triangles.
+
+		 \return The ae::Mesh's number of indices
+
+		 \since v0.7.0
+		*/
+		_NODISCARD unsigned int getIndexCount() const noexcept;
+		/*!
+		 \brief Retrieves the OpenGL type of the ae::Mesh's indices, to be provided to the drawcalls.
+
+		 \return GL_UNSIGNED_SHORT if the indices are 16-bit, GL_UNSIGNED_INT otherwise
+
+		 \since v0.7.0
+		*/
+		_NODISCARD uint32_t getIndexType() const noexcept;
+		/*!
+		 \brief Retrieves the ae::Mesh's model bounding box.
+		 \details The box's \a position member contains its minimum coordinates and its \a size member contains its size.
+
+		 \return An ae::Box3f containing the box enclosing the ae::Mesh's vertices
+
+		 \since v0.7.0
+		*/
+		_NODISCARD const Box3f& getModelBounds() const noexcept;
+		/*!
+		 \brief Retrieves the ae::Mesh's unique ID.
+		 \details The ae::Renderer3D sorts its draws by the ID so that the instances of the same ae::Mesh are drawn together.
+
+		 \return The ae::Mesh's ID
+
+		 \since v0.7.0
+		*/
+		_NODISCARD uint32_t getID() const noexcept;
+
+		// Public static method(s)
+		/*!
+		 \brief Writes the geometry provided into a binary mesh file, which is loaded with loadFromFile().
+		 \details The vertices are stored interleaved, as laid out by the ae::Vertex3D struct, and the indices are stored as 16-bit integers if there are at most 65536 vertices.
+		 No OpenGL context is required, so that the meshes may be converted by an offline tool.
+
+		 \param[in] filename The string containing the filepath of the file that will be written
+		 \param[in] vertices The list of vertices of the mesh
+		 \param[in] indices The list of indices forming the mesh's triangles
+		 \param[in] submeshes The list of submeshes, a single submesh covering all of the \a indices is written if it's empty
+
+		 \return True if the mesh file was written successfully, false otherwise
+
+		 \par Example:
+		 \code
+		 // Convert the parsed model once, during a baking step for example
+		 if (!ae::Mesh::saveToFile("Resources/Meshes/tree.aemesh", vertices, indices)) {
+			...
+		 }
+		 \endcode
+
+		 \sa loadFromFile()
+
+		 \since v0.7.0
+		*/
+		static bool saveToFile(const std::string& filename, const std::vector<Vertex3D>& vertices, const std::vector<unsigned int>& indices,
+		                       const std::vector<Submesh>& submeshes = {});
+	private:
+		// Private method(s)
+		/*!
+		 \brief Deletes the OpenGL buffers containing the ae::Mesh's geometry (if they were created).
+
+		 \since v0.7.0
+		*/
+		void destroy();
+
+	private:
+		// Private member(s)
+		std::unique_ptr<VertexBuffer> mVBO;        //!< The buffer containing the vertices
+		std::unique_ptr<IndexBuffer>  mIBO;        //!< The buffer containing the indices
+		std::vector<Submesh>          mSubmeshes;  //!< The ranges of indices of the mesh's parts
+		Box3f                         mBounds;     //!< The model bounding box
+		unsigned int                  mIndexCount; //!< The number of indices
+		const uint32_t                mID;         //!< The unique ID
+	};
+}
+#endif // Aeon_Graphics_Mesh_H_
+
+/*!
+ \class ae::Mesh
+ \ingroup graphics
+
+ The ae::Mesh class stores a list of vertices and indices in GPU memory, once,
+ so that the same geometry may be drawn any number of times with different
+ transforms and materials by the ae::Renderer3D without being re-uploaded.
+
+ The meshes may be converted offline into binary mesh files with
+ saveToFile() (or the MeshConverter tool), which are memory-mapped and
+ uploaded as is by loadFromFile().
+
+ Binary mesh file layout (little-endian):
+ \li Header: identifier "AEMS", version, vertex stride, attribute count, vertex count, index size (2 or 4), index count, submesh count, bounds (6 floats)
+ \li Attributes: type, component count, normalized (3 uint32 each), matching the ae::VertexBuffer::Layout's elements
+ \li Submeshes: first index, index count, bounds (2 uint32 and 6 floats each)
+ \li The interleaved vertices followed by the indices, each starting at a multiple of 4 bytes
+
+ Usage example:
+ \code
+ ae::Mesh cube;
+ cube.create(cubeVertices, cubeIndices);
+ ...
+ ae::Renderer3D& renderer = ae::Renderer3D::getInstance();
+ renderer.beginScene(window);
+ for (const ae::Matrix4f& transform : cubeTransforms) {
+	renderer.submit(cube, material, transform);
+ }
+ renderer.endScene();
+ \endcode
+
+ \author Filippos Gleglakos
+ \version v0.7.0
+ \date 2021.07.27
+ \copyright MIT License
+*/
\ No newline at end of file
@@ -0,0 +1,467 @@
+// MIT License
+// 
+// Copyright(c) 2019-2021 Filippos Gleglakos
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+
+#ifndef Aeon_Graphics_ParticleEmitter2D_H_
+#define Aeon_Graphics_ParticleEmitter2D_H_
+
+#include <memory>
+
+#include <AEON/Graphics/Actor2D.h>
+#include <AEON/Graphics/BlendMode.h>
+#include <AEON/Graphics/Color.h>
+#include <AEON/Graphics/Texture2D.h>
+#include <AEON/Math/AABoxCollider.h>
+
+namespace ae
+{
+	// Forward declaration(s)
+	class Shader;
+	class ShaderStorageBuffer;
+	class VertexArray;
+
+	/*!
+	 \brief The class representing an emitter of 2D particles that are simulated and rendered entirely on the GPU.
+	*/
+	class _NODISCARD AEON_API ParticleEmitter2D : public Actor2D
+	{
+	public:
+		// Public constructor(s)
+		/*!
+		 \brief Constructs the ae::ParticleEmitter2D by providing the maximum number of particles alive at once.
+		 \details The emitter doesn't emit any particles until an emission rate is set or a burst is requested.
+		 \note No OpenGL calls are issued, the particles' shader storage buffer is created once the emitter is first rendered.
+
+		 \param[in] capacity The maximum number of particles alive at once, 10'000 by default
+
+		 \par Example:
+		 \code
+		 auto sparks = std::make_unique<ae::ParticleEmitter2D>(50'000);
+		 sparks->setEmissionRate(5'000.f);
+		 sparks->setLifetime(0.5f, 1.5f);
+		 sparks->setSpeed(100.f, 300.f);
+		 sparks->setColors(ae::Color::Yellow, ae::Color(255, 0, 0, 0));
+		 \endcode
+
+		 \since v0.7.0
+		*/
+		explicit ParticleEmitter2D(unsigned int capacity = 10'000);
+		/*!
+		 \brief Deleted copy constructor.
+
+		 \since v0.7.0
+		*/
+		ParticleEmitter2D(const ParticleEmitter2D&) = delete;
+		/*!
+		 \brief Move constructor.
+
+		 \param[in] rvalue The ae::ParticleEmitter2D that will be moved
+
+		 \since v0.7.0
+		*/
+		ParticleEmitter2D(ParticleEmitter2D&& rvalue) noexcept = default;
+	public:
+		// Public operator(s)
+		/*!
+		 \brief Deleted assignment operator.
+
+		 \since v0.7.0
+		*/
+		ParticleEmitter2D& operator=(const ParticleEmitter2D&) = delete;
+		/*!
+		 \brief Move assignment operator.
+
+		 \param[in] rvalue The ae::ParticleEmitter2D that will be moved
+
+		 \return The caller ae::ParticleEmitter2D
+
+		 \since v0.7.0
+		*/
+		ParticleEmitter2D& operator=(ParticleEmitter2D&& rvalue) noexcept = default;
+	public:
+		// Public method(s)
+		/*!
+		 \brief Sets the maximum number of particles alive at once.
+		 \details The particles currently alive are discarded as the shader storage buffer is recreated once the emitter is next rendered.
+
+		 \param[in] capacity The maximum number of particles alive at once
+
+		 \sa getCapacity()
+
+		 \since v0.7.0
+		*/
+		void setCapacity(unsigned int capacity);
+		/*!
+		 \brief Sets the number of particles emitted per second.
+
+		 \param[in] rate The number of particles emitted per second, 0 to stop the continuous emission
+
+		 \par Example:
+		 \code
+		 emitter->setEmissionRate(1'000.f);
+		 \endcode
+
+		 \sa burst(), getEmissionRate()
+
+		 \since v0.7.0
+		*/
+		void setEmissionRate(float rate) noexcept;
+		/*!
+		 \brief Emits a number of particles at once during the next simulation step.
+		 \details The particles are only emitted if enough of them are dead, the emitter never exceeds its capacity.
+
+		 \param[in] count The number of particles to emit
+
+		 \par Example:
+		 \code
+		 // Explode once
+		 emitter->setEmissionRate(0.f);
+		 emitter->burst(2'000);
+		 \endcode
+
+		 \sa setEmissionRate()
+
+		 \since v0.7.0
+		*/
+		void burst(unsigned int count) noexcept;
+		/*!
+		 \brief Sets the range of the lifetime, in seconds, randomly assigned to each particle emitted.
+
+		 \param[in] min The minimum lifetime in seconds
+		 \param[in] max The maximum lifetime in seconds
+
+		 \sa getLifetime()
+
+		 \since v0.7.0
+		*/
+		void setLifetime(float min, float max);
+		/*!
+		 \brief Sets the range of the initial speed, in units per second, randomly assigned to each particle emitted.
+
+		 \param[in] min The minimum speed
+		 \param[in] max The maximum speed
+
+		 \sa setAngle(), getSpeed()
+
+		 \since v0.7.0
+		*/
+		void setSpeed(float min, float max);
+		/*!
+		 \brief Sets the range of the direction, in degrees, randomly assigned to each particle emitted.
+		 \details A direction of 0 degrees points towards the positive X axis.
+
+		 \param[in] min The minimum direction in degrees
+		 \param[in] max The maximum direction in degrees
+
+		 \par Example:
+		 \code
+		 // Emit the particles in a 30 degree cone around the positive Y axis
+		 emitter->setAngle(75.f, 105.f);
+		 \endcode
+
+		 \sa setSpeed(), getAngle()
+
+		 \since v0.7.0
+		*/
+		void setAngle(float min, float max);
+		/*!
+		 \brief Sets the colors between which the particles are interpolated over their lifetime.
+
+		 \param[in] start The ae::Color of the particles when they're emitted
+		 \param[in] end The ae::Color of the particles when they die
+
+		 \sa getStartColor(), getEndColor()
+
+		 \since v0.7.0
+		*/
+		void setColors(const Color& start, const Color& end) noexcept;
+		/*!
+		 \brief Sets the sizes between which the particles are interpolated over their lifetime.
+
+		 \param[in] start The size of the particles' quads when they're emitted
+		 \param[in] end The size of the particles' quads when they die
+
+		 \sa getSizes()
+
+		 \since v0.7.0
+		*/
+		void setSizes(float start, float end);
+		/*!
+		 \brief Sets the constant acceleration applied to every particle alive.
+
+		 \param[in] gravity An ae::Vector2f containing the acceleration in units per second squared
+
+		 \par Example:
+		 \code
+		 emitter->setGravity(ae::Vector2f(0.f, -98.f));
+		 \endcode
+
+		 \sa getGravity()
+
+		 \since v0.7.0
+		*/
+		void setGravity(const Vector2f& gravity);
+		/*!
+		 \brief Sets the texture applied to every particle's quad.
+		 \note The \a texture must remain valid as long as it's used by the ae::ParticleEmitter2D.
+
+		 \param[in] texture The ae::Texture2D to assign to the particles
+
+		 \sa getTexture()
+
+		 \since v0.7.0
+		*/
+		void setTexture(const Texture2D& texture) noexcept;
+		/*!
+		 \brief Sets the blend mode used to render the particles.
+
+		 \param[in] blendMode The ae::BlendMode to use, ae::BlendMode::BlendAlpha by default
+
+		 \par Example:
+		 \code
+		 emitter->setBlendMode(ae::BlendMode::BlendAdd);
+		 \endcode
+
+		 \since v0.7.0
+		*/
+		void setBlendMode(const BlendMode& blendMode) noexcept;
+		/*!
+		 \brief Retrieves the maximum number of particles alive at once.
+
+		 \return The ae::ParticleEmitter2D's capacity
+
+		 \sa setCapacity()
+
+		 \since v0.7.0
+		*/
+		_NODISCARD unsigned int getCapacity() const noexcept;
+		/*!
+		 \brief Retrieves the number of particles emitted per second.
+
+		 \return The ae::ParticleEmitter2D's emission rate
+
+		 \sa setEmissionRate()
+
+		 \since v0.7.0
+		*/
+		_NODISCARD float getEmissionRate() const noexcept;
+		/*!
+		 \brief Retrieves the range of the lifetime assigned to the particles emitted.
+
+		 \return An ae::Vector2f containing the minimum and maximum lifetimes in seconds
+
+		 \sa setLifetime()
+
+		 \since v0.7.0
+		*/
+		_NODISCARD const Vector2f& getLifetime() const noexcept;
+		/*!
+		 \brief Retrieves the range of the initial speed assigned to the particles emitted.
+
+		 \return An ae::Vector2f containing the minimum and maximum speeds
+
+		 \sa setSpeed()
+
+		 \since v0.7.0
+		*/
+		_NODISCARD const Vector2f& getSpeed() const noexcept;
+		/*!
+		 \brief Retrieves the range of the direction assigned to the particles emitted.
+
+		 \return An ae::Vector2f containing the minimum and maximum directions in degrees
+
+		 \sa setAngle()
+
+		 \since v0.7.0
+		*/
+		_NODISCARD Vector2f getAngle() const noexcept;
+		/*!
+		 \brief Retrieves the color of the particles when they're emitted.
+
+		 \return The ae::Color of the new particles
+
+		 \sa setColors(), getEndColor()
+
+		 \since v0.7.0
+		*/
+		_NODISCARD const Color& getStartColor() const noexcept;
+		/*!
+		 \brief Retrieves the color of the particles when they die.
+
+		 \return The ae::Color of the dying particles
+
+		 \sa setColors(), getStartColor()
+
+		 \since v0.7.0
+		*/
+		_NODISCARD const Color& getEndColor() const noexcept;
+		/*!
+		 \brief Retrieves the sizes between which the particles are interpolated.
+
+		 \return An ae::Vector2f containing the sizes when the particles are emitted and when they die
+
+		 \sa setSizes()
+
+		 \since v0.7.0
+		*/
+		_NODISCARD const Vector2f& getSizes() const noexcept;
+		/*!
+		 \brief Retrieves the constant acceleration applied to the particles.
+
+		 \return An ae::Vector2f containing the acceleration in units per second squared
+
+		 \sa setGravity()
+
+		 \since v0.7.0
+		*/
+		_NODISCARD const Vector2f& getGravity() const noexcept;
+		/*!
+		 \brief Retrieves the texture applied to the particles.
+
+		 \return A pointer to the ae::Texture2D, nullptr if the particles are untextured
+
+		 \sa setTexture()
+
+		 \since v0.7.0
+		*/
+		_NODISCARD const Texture2D* const getTexture() const noexcept;
+
+		// Public virtual method(s)
+		/*!
+		 \brief Retrieves the ae::ParticleEmitter2D's model bounding box.
+		 \details The bounds enclose the furthest distance a particle may travel from the emitter during its lifetime.
+		 They're computed from the emission properties as the particles themselves are never read back from the GPU.
+
+		 \return An ae::Box2f containing the model bounding box
+
+		 \since v0.7.0
+		*/
+		_NODISCARD virtual Box2f getModelBounds() const override final;
+	private:
+		// Private struct(s)
+		/*!
+		 \brief The struct holding the GPU-side state shared with the drawcalls handed to the renderer.
+		 \details The drawcalls keep the state alive so that it outlives the emitter until they've been executed.
+		*/
+		struct Simulation
+		{
+			std::shared_ptr<ShaderStorageBuffer> buffer;         //!< The SSBO storing the particles, created by the first drawcall
+			unsigned int                         capacity;       //!< The number of particles stored in the SSBO
+			uint32_t                             seed;           //!< The seed of the spawned particles' random properties, incremented every simulation step
+			std::shared_ptr<Shader>              updateShader;   //!< The compute shader advancing the particles, resolved by the first drawcall
+			std::shared_ptr<Shader>              particleShader; //!< The shader rendering the particles, resolved by the first drawcall
+			std::shared_ptr<VertexArray>         vao;            //!< The VAO of the particles' quad, resolved by the first drawcall
+			std::shared_ptr<Texture2D>           whiteTexture;   //!< The texture applied to the untextured particles, resolved by the first drawcall
+		};
+
+	private:
+		// Private method(s)
+		/*!
+		 \brief Recomputes the model bounds from the emission properties.
+
+		 \since v0.7.0
+		*/
+		void updateBounds();
+
+		// Private virtual method(s)
+		/*!
+		 \brief Accumulates the elapsed time and the number of particles to emit until the next simulation step.
+
+		 \param[in] dt The time difference between the previous frame and the current frame
+
+		 \sa renderSelf()
+
+		 \since v0.7.0
+		*/
+		virtual void updateSelf(const Time& dt) override final;
+		/*!
+		 \brief Hands the simulation step and the particles' rendering over to the active renderer.
+		 \details The accumulated time and emissions are consumed by the simulation step, which is dispatched by the renderer on the OpenGL context's thread.
+
+		 \param[in] states The ae::RenderStates defining the OpenGL state
+
+		 \sa updateSelf()
+
+		 \since v0.7.0
+		*/
+		virtual void renderSelf(const RenderStates& states) const override final;
+
+	private:
+		// Private member(s)
+		std::shared_ptr<Simulation> mSimulation;   //!< The GPU-side state of the particles
+		Box2f                       mModelBounds;  //!< The local bounds enclosing every particle
+		Vector2f                    mLifetime;     //!< The minimum and maximum lifetimes in seconds
+		Vector2f                    mSpeed;        //!< The minimum and maximum initial speeds
+		Vector2f                    mAngle;        //!< The minimum and maximum directions in radians
+		Vector2f                    mSizes;        //!< The sizes when the particles are emitted and when they die
+		Vector2f                    mGravity;      //!< The acceleration applied to the particles
+		Color                       mStartColor;   //!< The color of the particles when they're emitted
+		Color                       mEndColor;     //!< The color of the particles when they die
+		BlendMode                   mBlendMode;    //!< The blend mode used to render the particles
+		const Texture2D*            mTexture;      //!< The texture applied to the particles
+		unsigned int                mCapacity;     //!< The maximum number of particles alive at once
+		float                       mEmissionRate; //!< The number of particles emitted per second
+		mutable float               mElapsedTime;  //!< The time elapsed since the last simulation step in seconds
+		mutable float               mEmissions;    //!< The number of particles to emit during the next simulation step
+	};
+}
+#endif // Aeon_Graphics_ParticleEmitter2D_H_
+
+/*!
+ \class ae::ParticleEmitter2D
+ \ingroup graphics
+
+ The ae::ParticleEmitter2D class emits particles that are simulated by a
+ compute shader over a shader storage buffer and rendered as instanced quads
+ fetched straight from that buffer. The CPU never touches the individual
+ particles: it only accumulates the elapsed time and the number of particles
+ to emit, which makes tens of thousands of particles as cheap as a single
+ ae::Actor2D for the scene graph.
+
+ The particles are emitted in world space from the emitter's current position
+ and aren't affected by the emitter's later movements. As the simulation
+ requires the OpenGL context, it's dispatched through
+ ae::Renderer2D::drawToActive() when the emitter is rendered, after the rest of
+ the scene's geometry, so the particles are only advanced while the emitter is
+ visible.
+
+ \par Example:
+ \code
+ auto smoke = std::make_unique<ae::ParticleEmitter2D>(20'000);
+ smoke->setEmissionRate(2'000.f);
+ smoke->setLifetime(1.f, 3.f);
+ smoke->setSpeed(20.f, 60.f);
+ smoke->setAngle(80.f, 100.f);
+ smoke->setSizes(8.f, 32.f);
+ smoke->setColors(ae::Color(200, 200, 200, 200), ae::Color(50, 50, 50, 0));
+ smoke->setGravity(ae::Vector2f(10.f, 0.f));
+ smoke->setTexture(smokeTexture);
+ smoke->setPosition(640.f, 100.f);
+ scene->attachChild(std::move(smoke));
+ \endcode
+
+ \author Filippos Gleglakos
+ \version v0.7.0
+ \date 2021.07.25
+ \copyright MIT License
+*/
\ No newline at end of file
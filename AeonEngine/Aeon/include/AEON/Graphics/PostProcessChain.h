@@ -0,0 +1,354 @@
+// MIT License
+// 
+// Copyright(c) 2019-2021 Filippos Gleglakos
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef Aeon_Graphics_PostProcessChain_H_
+#define Aeon_Graphics_PostProcessChain_H_
+
+#include <vector>
+#include <string>
+#include <memory>
+#include <functional>
+#include <unordered_map>
+
+#include <AEON/Config.h>
+#include <AEON/Math/Vector.h>
+
+namespace ae
+{
+	// Forward declaration(s)
+	class Shader;
+	class Texture2D;
+	class RenderTexture;
+
+	/*!
+	 \brief The class representing an ordered list of full-screen effects applied to a texture before it's presented.
+	 \details Each group of passes renders into render textures borrowed from the ae::GLResourceFactory's pool, at the resolution scale of its effect.
+	*/
+	class _NODISCARD AEON_API PostProcessChain
+	{
+	public:
+		// Public typedef(s)
+		using SetupFunction = std::function<void(Shader&)>; //!< The function setting an effect's uniforms before its pass is rendered
+
+	public:
+		// Public constructor(s)
+		/*!
+		 \brief Default constructor.
+		 \details The chain is empty, its texture is thus simply copied.
+
+		 \since v0.7.0
+		*/
+		PostProcessChain();
+		/*!
+		 \brief Deleted copy constructor.
+
+		 \since v0.7.0
+		*/
+		PostProcessChain(const PostProcessChain&) = delete;
+		/*!
+		 \brief Move constructor.
+
+		 \param[in] rvalue The ae::PostProcessChain that will be moved
+
+		 \since v0.7.0
+		*/
+		PostProcessChain(PostProcessChain&& rvalue) noexcept;
+		/*!
+		 \brief Destructor.
+		 \details Returns the render textures to the ae::GLResourceFactory's pool.
+
+		 \since v0.7.0
+		*/
+		~PostProcessChain();
+	public:
+		// Public operator(s)
+		/*!
+		 \brief Deleted assignment operator.
+
+		 \since v0.7.0
+		*/
+		PostProcessChain& operator=(const PostProcessChain&) = delete;
+		/*!
+		 \brief Move assignment operator.
+
+		 \param[in] rvalue The ae::PostProcessChain that will be moved
+
+		 \return The caller ae::PostProcessChain
+
+		 \since v0.7.0
+		*/
+		PostProcessChain& operator=(PostProcessChain&& rvalue) noexcept;
+	public:
+		// Public method(s)
+		/*!
+		 \brief Appends an effect sampling its input freely, such as a blur, which is rendered in its own pass.
+		 \details The \a source is the body of a fragment shader whose '#version' directive and interface are provided by the chain:
+		 \li 'fs_in.uv' the texture coordinates of the fragment
+		 \li 'uSource' the sampler of the previous pass' result (or of the chain's texture)
+		 \li 'uTexelSize' the size of a texel of uSource in texture coordinates
+		 \li 'color' the fragment's output
+		 A \a resolutionScale lower than 1 renders the pass into a smaller render texture (0.5 for half resolution, 0.25 for quarter resolution), which divides its fill rate accordingly.
+
+		 \param[in] name The name of the effect, several effects may share the same name so that they're toggled together
+		 \param[in] source The source code of the pass' fragment shader, without its version and interface
+		 \param[in] resolutionScale The scale applied to the resolution of the chain's output, 1 by default
+		 \param[in] setup The function setting the effect's uniforms before every pass, none by default
+
+		 \par Example:
+		 \code
+		 // Invert the colors of the lower half of the screen
+		 ae::PostProcessChain& chain = ae::Application::getInstance().getWindow().getPostProcessChain();
+		 chain.addEffect("Invert", R"(
+			void main()
+			{
+				vec4 texel = texture(uSource, fs_in.uv);
+				color = (fs_in.uv.y < 0.5) ? vec4(1.0 - texel.rgb, texel.a) : texel;
+			}
+		 )");
+		 \endcode
+
+		 \sa addColorEffect(), addBlurEffect()
+
+		 \since v0.7.0
+		*/
+		void addEffect(const std::string& name, const std::string& source, float resolutionScale = 1.f, SetupFunction setup = nullptr);
+		/*!
+		 \brief Appends an effect that only transforms the color of each texel, such as a color grading or a vignette.
+		 \details The \a source defines the function 'vec4 apply(vec4 texel, vec2 uv)' returning the transformed color of the texel at the texture coordinates uv, the chain's interface being available (see addEffect()).
+		 The consecutive color effects of the same resolution scale are fused into a single pass, their functions being chained within the same fragment shader, which saves a full-screen pass per effect.
+		 \note The uniforms of the fused effects share the same shader program, their names must thus be unique across the effects.
+
+		 \param[in] name The name of the effect, several effects may share the same name so that they're toggled together
+		 \param[in] source The source code of the effect's function and of its uniforms
+		 \param[in] resolutionScale The scale applied to the resolution of the chain's output, 1 by default
+		 \param[in] setup The function setting the effect's uniforms before every pass, none by default
+
+		 \par Example:
+		 \code
+		 // The vignette and the grayscale effects are rendered in the same pass
+		 chain.addColorEffect("Vignette", R"(
+			uniform float uVignetteStrength;
+
+			vec4 apply(vec4 texel, vec2 uv)
+			{
+				float falloff = 1.0 - uVignetteStrength * dot(uv - 0.5, uv - 0.5);
+				return vec4(texel.rgb * falloff, texel.a);
+			}
+		 )", 1.f, [](ae::Shader& shader) {
+			shader.setUniform("uVignetteStrength", 1.5f);
+		 });
+		 chain.addColorEffect("Grayscale", R"(
+			vec4 apply(vec4 texel, vec2 uv)
+			{
+				return vec4(vec3(dot(texel.rgb, vec3(0.2126, 0.7152, 0.0722))), texel.a);
+			}
+		 )");
+		 \endcode
+
+		 \sa addEffect()
+
+		 \since v0.7.0
+		*/
+		void addColorEffect(const std::string& name, const std::string& source, float resolutionScale = 1.f, SetupFunction setup = nullptr);
+		/*!
+		 \brief Appends a separable gaussian blur made up of a horizontal and a vertical pass.
+		 \details The blur is rendered at half resolution by default, the bilinear upscaling of the following pass adding to its smoothness at no cost.
+
+		 \param[in] name The name of the effect
+		 \param[in] resolutionScale The scale applied to the resolution of the chain's output, 0.5 by default
+		 \param[in] radius The spacing of the kernel's samples in texels, 1 by default
+
+		 \par Example:
+		 \code
+		 // Blur the scene at quarter resolution while the game is paused
+		 chain.addBlurEffect("PauseBlur", 0.25f);
+		 ...
+		 chain.setEffectEnabled("PauseBlur", mPaused);
+		 \endcode
+
+		 \sa addEffect()
+
+		 \since v0.7.0
+		*/
+		void addBlurEffect(const std::string& name, float resolutionScale = 0.5f, float radius = 1.f);
+		/*!
+		 \brief Enables or disables the effects of the \a name provided.
+		 \details The disabled effects are skipped without being removed, the passes being regrouped upon the next application.
+
+		 \param[in] name The name of the effects
+		 \param[in] enabled Whether the effects are applied
+
+		 \since v0.7.0
+		*/
+		void setEffectEnabled(const std::string& name, bool enabled);
+		/*!
+		 \brief Removes the effects of the \a name provided.
+
+		 \param[in] name The name of the effects
+
+		 \since v0.7.0
+		*/
+		void removeEffect(const std::string& name);
+		/*!
+		 \brief Removes every effect.
+
+		 \since v0.7.0
+		*/
+		void clear();
+		/*!
+		 \brief Renders the chain's passes from the \a source texture and blits the result into the framebuffer provided.
+		 \details Each pass renders into the render texture of its size that isn't its input, so the passes of the same size ping-pong between two render textures.
+		 The last pass' result is blitted into the output framebuffer, with a linear filter if its resolution is scaled.
+		 \note This method is automatically called by the ae::Window once its frame has been rendered if the chain has an enabled effect.
+
+		 \param[in] source The ae::Texture2D to which the effects are applied
+		 \param[in] outputFramebuffer The OpenGL identifier of the framebuffer into which the result is blitted (0 for the window's default framebuffer)
+		 \param[in] outputSize The dimensions of the output framebuffer
+
+		 \since v0.7.0
+		*/
+		void apply(const Texture2D& source, unsigned int outputFramebuffer, const Vector2i& outputSize);
+		/*!
+		 \brief Checks whether the chain has at least one enabled effect.
+
+		 \return True if no effect is enabled, false otherwise
+
+		 \since v0.7.0
+		*/
+		_NODISCARD bool isEmpty() const noexcept;
+		/*!
+		 \brief Retrieves the number of full-screen passes rendered by the last application, the fused effects counting as a single pass.
+
+		 \return The number of passes
+
+		 \since v0.7.0
+		*/
+		_NODISCARD size_t getPassCount() const noexcept;
+
+	private:
+		// Private struct(s)
+		/*!
+		 \brief The internal struct representing an effect of the chain.
+		*/
+		struct Effect
+		{
+			std::string   name;            //!< The effect's name
+			std::string   source;          //!< The source code of the effect's fragment shader or function
+			SetupFunction setup;           //!< The function setting the effect's uniforms
+			float         resolutionScale; //!< The scale applied to the output's resolution
+			bool          fusable;         //!< Whether the effect only transforms the texels' color
+			bool          enabled;         //!< Whether the effect is applied
+		};
+		/*!
+		 \brief The internal struct representing a full-screen pass made up of one or several fused effects.
+		*/
+		struct Pass
+		{
+			std::shared_ptr<Shader> shader;          //!< The shader program rendering the pass
+			std::vector<size_t>     effects;         //!< The indices of the effects rendered by the pass
+			float                   resolutionScale; //!< The scale applied to the output's resolution
+		};
+		/*!
+		 \brief The internal struct representing a render texture into which the passes render.
+		*/
+		struct Target
+		{
+			std::unique_ptr<RenderTexture> texture; //!< The render texture
+			bool                           used;    //!< Whether the render texture was used by the last application
+		};
+
+	private:
+		// Private method(s)
+		/*!
+		 \brief Groups the enabled effects into passes, fusing the consecutive color effects of the same resolution scale.
+
+		 \since v0.7.0
+		*/
+		void buildPasses();
+		/*!
+		 \brief Retrieves the shader program compiled from the fragment shader \a source provided, compiling it if it hasn't been yet.
+
+		 \param[in] source The complete source code of the fragment shader
+
+		 \return The shader program
+
+		 \since v0.7.0
+		*/
+		_NODISCARD std::shared_ptr<Shader> getShader(const std::string& source);
+		/*!
+		 \brief Retrieves a render texture of the \a size provided that isn't the \a input, creating it if there's none.
+
+		 \param[in] size The dimensions of the render texture
+		 \param[in] input The render texture read by the pass, nullptr if it reads the chain's texture
+
+		 \return The render texture into which the pass renders
+
+		 \since v0.7.0
+		*/
+		_NODISCARD RenderTexture& acquireTarget(const Vector2i& size, const RenderTexture* input);
+
+	private:
+		// Private member(s)
+		std::vector<Effect>                                      mEffects; //!< The effects in their order of application
+		std::vector<Pass>                                        mPasses;  //!< The passes grouping the enabled effects
+		std::vector<Target>                                      mTargets; //!< The render textures into which the passes render
+		std::unordered_map<std::string, std::shared_ptr<Shader>> mShaders; //!< The shader programs compiled, indexed by their fragment shader's source code
+		bool                                                     mDirty;   //!< Whether the passes need to be regrouped
+	};
+}
+#endif // Aeon_Graphics_PostProcessChain_H_
+
+/*!
+ \class ae::PostProcessChain
+ \ingroup graphics
+
+ The ae::PostProcessChain class applies a list of full-screen effects to a
+ texture, typically the scene rendered into the window's back buffer. Every
+ ae::Window owns a chain (see ae::Window::getPostProcessChain()) which is
+ applied once the frame has been rendered, so the effects don't require the
+ API user to manage their own render textures nor to draw their results.
+
+ The effects are rendered into render textures borrowed from the
+ ae::GLResourceFactory's pool, the consecutive passes of the same size
+ ping-ponging between two of them. Each effect may be rendered at a fraction
+ of the output's resolution, which is how the blurs and the blooms remain
+ affordable on integrated GPUs, and the consecutive effects that only
+ transform the texels' color are fused into a single pass. The last pass'
+ result is blitted into the output framebuffer.
+
+ Usage example:
+ \code
+ ae::PostProcessChain& chain = window.getPostProcessChain();
+ chain.addBlurEffect("Blur", 0.5f);
+ chain.addColorEffect("Tint", R"(
+	vec4 apply(vec4 texel, vec2 uv)
+	{
+		return texel * vec4(1.0, 0.9, 0.8, 1.0);
+	}
+ )");
+ \endcode
+
+ \author Filippos Gleglakos
+ \version v0.7.0
+ \date 2021.07.05
+ \copyright MIT License
+*/
\ No newline at end of file
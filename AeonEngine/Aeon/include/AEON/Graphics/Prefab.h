@@ -0,0 +1,271 @@
+// MIT License
+// 
+// Copyright(c) 2019-2021 Filippos Gleglakos
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef Aeon_Graphics_Prefab_H_
+#define Aeon_Graphics_Prefab_H_
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <AEON/Config.h>
+#include <AEON/System/FileSystem.h>
+
+namespace ae
+{
+	// Forward declaration(s)
+	class Actor2D;
+	class Font;
+	class Texture2D;
+
+	/*!
+	 \brief Class representing a tree of actors stored in a compact binary file, mapped in memory and instantiated in bulk.
+	*/
+	class AEON_API Prefab
+	{
+	public:
+		// Public constructor(s)
+		/*!
+		 \brief Default constructor.
+		 \details Creates an empty prefab which can't be instantiated until a file is loaded.
+
+		 \since v0.7.0
+		*/
+		Prefab() noexcept;
+		/*!
+		 \brief Deleted copy constructor.
+
+		 \since v0.7.0
+		*/
+		Prefab(const Prefab&) = delete;
+		/*!
+		 \brief Move constructor.
+
+		 \param[in] rvalue The ae::Prefab that will be moved
+
+		 \since v0.7.0
+		*/
+		Prefab(Prefab&& rvalue) noexcept = default;
+
+		// Public operator(s)
+		/*!
+		 \brief Deleted assignment operator.
+
+		 \since v0.7.0
+		*/
+		Prefab& operator=(const Prefab&) = delete;
+		/*!
+		 \brief Move assignment operator.
+
+		 \param[in] rvalue The ae::Prefab that will be moved
+
+		 \return The caller ae::Prefab
+
+		 \since v0.7.0
+		*/
+		Prefab& operator=(Prefab&& rvalue) noexcept = default;
+
+		// Public method(s)
+		/*!
+		 \brief Loads the prefab situated at the \a filepath provided.
+		 \details The file is mapped in memory (through the mounted archives if any) and all of its nodes are validated so that the
+		 instantiations don't need to check them. The textures referenced are retrieved from the ae::GLResourceFactory by their filepath,
+		 the ones that weren't created yet being created and loaded.
+		 \note The fonts referenced must be bound with bindFont() before the prefab is instantiated.
+
+		 \param[in] filepath The filepath of the prefab
+
+		 \return True if the prefab was loaded, false otherwise
+
+		 \par Example:
+		 \code
+		 ae::Prefab level;
+		 if (level.loadFromFile("Levels/level1.prefab")) {
+			level.bindFont("Fonts/Roboto.ttf", mFont);
+			mSceneRoot->attachChild(level.instantiate());
+		 }
+		 \endcode
+
+		 \sa instantiate(), save()
+
+		 \since v0.7.0
+		*/
+		bool loadFromFile(const std::string& filepath);
+		/*!
+		 \brief Binds the font used by the texts that reference the \a filename provided.
+		 \details The fonts aren't shared resources, so the application supplies the instance that the instantiated texts use.
+		 \note The font must outlive the texts instantiated.
+
+		 \param[in] filename The filename of the font as stored in the prefab (see ae::Font::getFilename())
+		 \param[in] font The ae::Font used by the texts
+
+		 \return True if the prefab references the font, false otherwise
+
+		 \sa loadFromFile()
+
+		 \since v0.7.0
+		*/
+		bool bindFont(const std::string& filename, Font& font);
+		/*!
+		 \brief Instantiates the tree of actors described by the prefab.
+		 \details The nodes are created and linked to their parent directly: each list of children is reserved once and the dirty flags
+		 that attachChild() would propagate node by node are set as the nodes are created. The tree is then ready to be attached.
+
+		 \return The root node of the tree, nullptr if no prefab was loaded
+
+		 \par Example:
+		 \code
+		 // Spawn the enemy wave described by the prefab
+		 mSceneRoot->attachChild(mWavePrefab.instantiate());
+		 \endcode
+
+		 \sa loadFromFile()
+
+		 \since v0.7.0
+		*/
+		_NODISCARD std::unique_ptr<Actor2D> instantiate() const;
+		/*!
+		 \brief Checks whether a prefab was loaded.
+
+		 \return True if a prefab was loaded, false otherwise
+
+		 \since v0.7.0
+		*/
+		_NODISCARD bool isLoaded() const noexcept;
+		/*!
+		 \brief Retrieves the number of nodes of the prefab's tree.
+
+		 \return The number of nodes, root included
+
+		 \since v0.7.0
+		*/
+		_NODISCARD size_t getNodeCount() const noexcept;
+		/*!
+		 \brief Retrieves the filepath of the loaded prefab.
+
+		 \return The filepath provided to loadFromFile(), an empty string if no prefab was loaded
+
+		 \since v0.7.0
+		*/
+		_NODISCARD const std::string& getFilepath() const noexcept;
+
+		// Public static method(s)
+		/*!
+		 \brief Saves the tree of actors whose root is provided as a prefab at the \a filepath provided.
+		 \details The nodes which are exactly of the types ae::Actor2D, ae::Sprite, ae::Text, ae::RectangleShape and ae::EllipseShape are
+		 stored along with their transform, their layer, their static and cullable flags and their render data. The nodes of the other types
+		 are stored as plain ae::Actor2D nodes (with their transform and flags).
+		 \note The textures and the fonts are referenced by their filepath, the ones that weren't loaded from a file can't be referenced.
+
+		 \param[in] root The root node of the tree to save
+		 \param[in] filepath The filepath of the prefab
+
+		 \return True if the prefab was saved, false otherwise
+
+		 \par Example:
+		 \code
+		 // Build the level once (in a tool for example) and save it
+		 ae::Prefab::save(*levelRoot, "Levels/level1.prefab");
+		 \endcode
+
+		 \sa loadFromFile()
+
+		 \since v0.7.0
+		*/
+		static bool save(const Actor2D& root, const std::string& filepath);
+
+	private:
+		// Private struct(s)
+		/*!
+		 \brief The internal struct representing a texture or a font referenced by the prefab's nodes.
+		*/
+		struct Resource
+		{
+			std::string                path;    //!< The filepath of the resource
+			std::shared_ptr<Texture2D> texture; //!< The texture retrieved, nullptr if the resource is a font
+			Font*                      font;    //!< The font bound, nullptr if it's a texture or if it wasn't bound
+			bool                       isFont;  //!< Whether the resource is a font
+		};
+
+		// Private method(s)
+		/*!
+		 \brief Checks that the nodes of the mapped prefab are valid: their parents precede them, their resources and texts are within bounds.
+
+		 \return True if all nodes are valid, false otherwise
+
+		 \since v0.7.0
+		*/
+		_NODISCARD bool validateNodes() const;
+		/*!
+		 \brief Releases the mapped prefab and its resources.
+
+		 \since v0.7.0
+		*/
+		void unload() noexcept;
+
+		// Private member(s)
+		FileSystem::MappedFile mMapping;    //!< The prefab mapped in memory
+		const uint8_t*         mNodes;      //!< The pointer to the node records within the mapping
+		const char*            mStrings;    //!< The pointer to the string table within the mapping
+		uint32_t               mStringSize; //!< The size of the string table
+		uint32_t               mNodeCount;  //!< The number of nodes
+		std::vector<Resource>  mResources;  //!< The textures and fonts referenced by the nodes
+		std::string            mFilepath;   //!< The prefab's filepath
+	};
+}
+#endif // Aeon_Graphics_Prefab_H_
+
+/*!
+ \class ae::Prefab
+ \ingroup graphics
+
+ The ae::Prefab class loads trees of actors that were saved to a compact binary
+ file, such as levels or the entities spawned repeatedly. Building such trees in
+ code calls every setter and attaches the nodes one by one, each attachment
+ propagating dirty flags up the tree. A prefab instead stores fixed-size node
+ records in pre-order, read in place from the mapped file, and instantiates the
+ whole tree in a single pass.
+
+ Layout (little-endian):
+ \li Header: identifier "AEPF", version, node count, resource count, string table size
+ \li Resources: the type, path offset and path length of each texture and font
+ \li Nodes: a fixed-size record per node in pre-order (parent, child count, type, flags, transform, resource and render data)
+ \li String table: the resources' paths and the texts' strings
+
+ Usage example:
+ \code
+ // Save a level built in code
+ ae::Prefab::save(*levelRoot, "Levels/level1.prefab");
+
+ // Load it and instantiate it
+ ae::Prefab level;
+ level.loadFromFile("Levels/level1.prefab");
+ level.bindFont("Fonts/Roboto.ttf", mFont);
+ mSceneRoot->attachChild(level.instantiate());
+ \endcode
+
+ \author Filippos Gleglakos
+ \version v0.7.0
+ \date 2021.07.05
+ \copyright MIT License
+*/
\ No newline at end of file
@@ -55,11 +55,13 @@ namespace ae
 		*/
 		explicit RectangleShape(const Vector2f& size = Vector2f(), float cornerRadius = 0.f, size_t cornerPointCount = 1);
 		/*!
-		 \brief Deleted copy constructor.
+		 \brief Copy constructor.
 
-		 \since v0.5.0
+		 \param[in] copy The ae::RectangleShape that will be copied
+
+		 \since v0.7.0
 		*/
-		RectangleShape(const RectangleShape&) = delete;
+		RectangleShape(const RectangleShape& copy) = default;
 		/*!
 		 \brief Move constructor.
 
@@ -223,12 +225,57 @@ namespace ae
 		 \since v0.5.0
 		*/
 		virtual Vector2f getPoint(size_t index) const override final;
+		/*!
+		 \brief Retrieves all the points of the ae::RectangleShape at once.
+		 \details The points are computed by scaling and offsetting the shared unit quarter circle table, no trigonometry is evaluated when the size or the corner radius changes.
+
+		 \param[out] points The array receiving the getPointCount() points
+
+		 \sa getPoint(), getPointCount()
+
+		 \since v0.7.0
+		*/
+		virtual void getPoints(Vector2f* points) const override final;
+
+	private:
+		// Private virtual method(s)
+		/*!
+		 \brief Retrieves the corner radius as the radius of the ae::RectangleShape's curves.
+
+		 \return The corner radius
+
+		 \sa applySegmentCount()
+
+		 \since v0.7.0
+		*/
+		_NODISCARD virtual float getCurveRadius() const noexcept override final;
+		/*!
+		 \brief Sets the corner point count so that each corner is formed of a quarter of \a segmentCount segments.
+
+		 \param[in] segmentCount The number of segments to use for a full circle of the corner radius
+
+		 \sa getCurveRadius()
+
+		 \since v0.7.0
+		*/
+		virtual void applySegmentCount(size_t segmentCount) override final;
+		/*!
+		 \brief Copies the ae::RectangleShape without its children, its texture and geometry being shared with the copy.
+
+		 \return The copy of the ae::RectangleShape
+
+		 \sa clone()
+
+		 \since v0.7.0
+		*/
+		_NODISCARD virtual std::unique_ptr<Actor2D> cloneSelf() const override;
 
 	private:
 		// Private member(s)
-		Vector2f mSize;             //!< The size of the rectangle
-		float    mCornerRadius;     //!< The corner radius
-		size_t   mCornerPointCount; //!< The number of corner points
+		std::shared_ptr<const std::vector<Vector2f>> mUnitCornerPoints; //!< The shared points of the unit quarter circle of the same corner point count
+		Vector2f                                     mSize;             //!< The size of the rectangle
+		float                                        mCornerRadius;     //!< The corner radius
+		size_t                                       mCornerPointCount; //!< The number of corner points
 	};
 }
 #endif // Aeon_Graphics_RectangleShape_H_
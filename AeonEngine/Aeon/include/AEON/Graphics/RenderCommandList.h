@@ -0,0 +1,317 @@
+// MIT License
+// 
+// Copyright(c) 2019-2021 Filippos Gleglakos
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#ifndef Aeon_Graphics_RenderCommandList_H_
+#define Aeon_Graphics_RenderCommandList_H_
+
+#include <vector>
+#include <unordered_map>
+#include <functional>
+
+#include <AEON/Config.h>
+#include <AEON/Math/Matrix.h>
+#include <AEON/Graphics/Renderable2D.h>
+#include <AEON/Graphics/RenderStates.h>
+
+namespace ae
+{
+	// Forward declaration(s)
+	class Renderer2D;
+	class RenderTarget;
+
+	/*!
+	 \brief Class used to record 2D scenes and submissions without issuing any OpenGL calls so that they may be submitted later on.
+	*/
+	class _NODISCARD AEON_API RenderCommandList
+	{
+	public:
+		// Public enum(s)
+		/*!
+		 \brief The storage of the recorded geometry.
+		*/
+		enum class Storage
+		{
+			Reference, //!< The submitted vertices and indices are referenced, they must remain valid and unmodified until the list is submitted
+			Copy       //!< The submitted vertices and indices are copied (only when modified), the list is a snapshot independent of the submitters
+		};
+		/*!
+		 \brief The type of a recorded command.
+		*/
+		enum class Type
+		{
+			BeginScene, //!< A renderer begins a scene
+			Submit,     //!< Geometry is submitted to the active renderer
+			Draw,       //!< A custom drawcall is handed to the active renderer
+			EndScene    //!< A renderer ends its scene
+		};
+
+		// Public struct(s)
+		/*!
+		 \brief The struct representing a recorded command.
+		*/
+		struct AEON_API RenderCommand
+		{
+			Type                             type;     //!< The type of the command
+			Renderer2D*                      renderer; //!< The renderer whose scene begins or ends (scene commands only)
+			const Vertex2DList*              vertices; //!< The list of vertices to be rendered (submissions only)
+			const std::vector<unsigned int>* indices;  //!< The list of associated indices to be rendered (submissions only)
+			RenderStates                     states;   //!< The render states to be applied to the geometry (submissions only)
+			size_t                           scene;    //!< The index of the recorded scene or drawcall (scene beginnings and drawcalls only)
+		};
+		/*!
+		 \brief The struct representing the properties of a recorded scene.
+		 \details The camera's matrices are recorded so that the camera may be modified before the scene is submitted.
+		*/
+		struct AEON_API Scene
+		{
+			RenderTarget* target;           //!< The scene's render target
+			Matrix4f      viewMatrix;       //!< The view matrix of the target's camera when the scene was recorded
+			Matrix4f      projectionMatrix; //!< The projection matrix of the target's camera when the scene was recorded
+		};
+
+	public:
+		// Public constructor(s)
+		/*!
+		 \brief Constructs the ae::RenderCommandList by providing the storage of its geometry.
+		 \details Creates an empty command list.
+
+		 \param[in] storage The ae::RenderCommandList::Storage of the recorded geometry, ae::RenderCommandList::Storage::Reference by default
+
+		 \since v0.7.0
+		*/
+		explicit RenderCommandList(Storage storage = Storage::Reference);
+		/*!
+		 \brief Deleted copy constructor.
+
+		 \since v0.7.0
+		*/
+		RenderCommandList(const RenderCommandList&) = delete;
+		/*!
+		 \brief Move constructor.
+
+		 \param[in] rvalue The ae::RenderCommandList that will be moved
+
+		 \since v0.7.0
+		*/
+		RenderCommandList(RenderCommandList&& rvalue) noexcept = default;
+	public:
+		// Public operator(s)
+		/*!
+		 \brief Deleted assignment operator.
+
+		 \since v0.7.0
+		*/
+		RenderCommandList& operator=(const RenderCommandList&) = delete;
+		/*!
+		 \brief Move assignment operator.
+
+		 \param[in] rvalue The ae::RenderCommandList that will be moved
+
+		 \return The caller ae::RenderCommandList
+
+		 \since v0.7.0
+		*/
+		RenderCommandList& operator=(RenderCommandList&& rvalue) noexcept = default;
+	public:
+		// Public method(s)
+		/*!
+		 \brief Redirects the submissions made by the calling thread into the ae::RenderCommandList until endRecording() is called.
+		 \details The scenes begun by the renderers and the ae::Renderable2D instances rendered in the meantime are recorded instead of being executed,
+		 which allows worker threads to traverse a scene while the OpenGL calls remain on the context's thread.
+
+		 \par Example:
+		 \code
+		 // On a worker thread
+		 commandList.beginRecording();
+		 sceneChunk->render(ae::RenderStates());
+		 commandList.endRecording();
+
+		 // On the context's thread, once the worker has finished
+		 commandList.submit();
+		 \endcode
+
+		 \sa endRecording(), submit()
+
+		 \since v0.7.0
+		*/
+		void beginRecording();
+		/*!
+		 \brief Stops redirecting the calling thread's submissions into the ae::RenderCommandList.
+
+		 \sa beginRecording()
+
+		 \since v0.7.0
+		*/
+		void endRecording();
+		/*!
+		 \brief Appends a submission to the end of the list.
+		 \note This method is automatically called for the submissions made while recording.
+
+		 \param[in] vertices The list of vertices to be rendered
+		 \param[in] indices The list of associated indices to be rendered
+		 \param[in] states The ae::RenderStates to be applied to the geometry
+
+		 \since v0.7.0
+		*/
+		void record(const Vertex2DList& vertices, const std::vector<unsigned int>& indices, const RenderStates& states);
+		/*!
+		 \brief Appends a custom drawcall to the end of the list.
+		 \note This method is automatically called for the drawcalls handed to the renderer while recording.
+
+		 \param[in] drawcall The function issuing the OpenGL calls, it's executed on the OpenGL context's thread once the list is submitted
+
+		 \sa ae::Renderer2D::drawToActive()
+
+		 \since v0.7.0
+		*/
+		void recordDrawcall(std::function<void()> drawcall);
+		/*!
+		 \brief Appends the beginning of a scene to the end of the list.
+		 \note This method is automatically called when a renderer begins a scene while recording.
+
+		 \param[in] renderer The ae::Renderer2D beginning the scene
+		 \param[in] target The scene's ae::RenderTarget
+		 \param[in] viewMatrix The view matrix of the target's camera
+		 \param[in] projectionMatrix The projection matrix of the target's camera
+
+		 \sa recordSceneEnd()
+
+		 \since v0.7.0
+		*/
+		void recordSceneBegin(Renderer2D& renderer, RenderTarget& target, const Matrix4f& viewMatrix, const Matrix4f& projectionMatrix);
+		/*!
+		 \brief Appends the end of a scene to the end of the list.
+		 \note This method is automatically called when a renderer ends a scene while recording.
+
+		 \param[in] renderer The ae::Renderer2D ending its scene
+
+		 \sa recordSceneBegin()
+
+		 \since v0.7.0
+		*/
+		void recordSceneEnd(Renderer2D& renderer);
+		/*!
+		 \brief Submits the recorded commands, in the order of which they were recorded, and clears the list.
+		 \details The scenes are begun and ended with the recorded camera matrices and the submissions are sent to the active renderer.
+		 If the calling thread is itself recording, the commands are recorded into its recording list instead.
+
+		 \sa beginRecording()
+
+		 \since v0.7.0
+		*/
+		void submit();
+		/*!
+		 \brief Removes every recorded command while keeping the list's memory.
+		 \details The copies of the geometry recorded since the last submission are kept so that they're only copied again if they're modified.
+
+		 \since v0.7.0
+		*/
+		void clear() noexcept;
+		/*!
+		 \brief Retrieves the recorded commands.
+
+		 \return The list of recorded commands
+
+		 \since v0.7.0
+		*/
+		_NODISCARD const std::vector<RenderCommand>& getCommands() const noexcept;
+		/*!
+		 \brief Retrieves the properties of the recorded scenes.
+
+		 \return The list of recorded scenes, indexed by the scene beginnings' commands
+
+		 \since v0.7.0
+		*/
+		_NODISCARD const std::vector<Scene>& getScenes() const noexcept;
+
+		// Public static method(s)
+		/*!
+		 \brief Retrieves the command list into which the calling thread's submissions are currently recorded.
+
+		 \return A pointer to the calling thread's recording list, nullptr if the thread isn't recording
+
+		 \since v0.7.0
+		*/
+		_NODISCARD static RenderCommandList* const getRecordingList() noexcept;
+
+	private:
+		// Private struct(s)
+		/*!
+		 \brief The struct representing the copy of a submitter's geometry.
+		*/
+		struct Geometry
+		{
+			Vertex2DList              vertices; //!< The copied vertices
+			std::vector<unsigned int> indices;  //!< The copied indices
+			bool                      recorded; //!< Whether the geometry was recorded since the list was last submitted
+		};
+
+	private:
+		// Private method(s)
+		/*!
+		 \brief Removes every recorded command and releases the copies of the geometry that wasn't recorded since the last submission.
+
+		 \since v0.7.0
+		*/
+		void reset() noexcept;
+
+	private:
+		// Private member(s)
+		std::vector<RenderCommand>                                 mCommands;     //!< The recorded commands
+		std::vector<Scene>                                         mScenes;       //!< The recorded scenes
+		std::vector<std::function<void()>>                         mDrawcalls;    //!< The recorded custom drawcalls
+		std::unordered_map<const Vertex2DList*, Geometry>          mGeometries;   //!< The copies of the submitters' geometry, associated to the submitted vertices
+		Storage                                                    mStorage;      //!< The storage of the recorded geometry
+		RenderCommandList*                                         mPreviousList; //!< The calling thread's previous recording list, restored once the recording ends
+	};
+}
+#endif // Aeon_Graphics_RenderCommandList_H_
+
+/*!
+ \class ae::RenderCommandList
+ \ingroup graphics
+
+ The ae::RenderCommandList class records 2D scenes and submissions (vertices,
+ indices and render states) without issuing any OpenGL call. Once a thread
+ begins recording into a list, the scenes begun by the renderers and the
+ submissions of the ae::Renderable2D instances it renders are appended to that
+ list instead of being executed. The list may then be submitted from the OpenGL
+ context's thread, in the order of which the commands were recorded.
+
+ A list using the ae::RenderCommandList::Storage::Copy storage keeps its own
+ copy of the submitted geometry (only copying the geometry flagged as dirty),
+ which makes it a snapshot of the frame that remains valid while the submitters
+ are modified.
+
+ The custom drawcalls handed to ae::Renderer2D::drawToActive() are recorded as
+ well, in order with the submissions, and executed once the list is submitted.
+
+ This is used by ae::Actor2D::renderParallel() to split the traversal of large
+ scene graphs across worker threads, and by the ae::Application's pipelined
+ mode to execute a frame while the next one is being updated.
+
+ \author Filippos Gleglakos
+ \version v0.7.0
+ \date 2021.07.05
+ \copyright MIT License
+*/
\ No newline at end of file
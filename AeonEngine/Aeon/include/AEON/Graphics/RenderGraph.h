@@ -0,0 +1,385 @@
+// MIT License
+// 
+// Copyright(c) 2019-2021 Filippos Gleglakos
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef Aeon_Graphics_RenderGraph_H_
+#define Aeon_Graphics_RenderGraph_H_
+
+#include <vector>
+#include <string>
+#include <memory>
+#include <functional>
+
+#include <AEON/Config.h>
+#include <AEON/Math/Vector.h>
+#include <AEON/Graphics/Color.h>
+#include <AEON/Graphics/Texture2D.h>
+
+namespace ae
+{
+	// Forward declaration(s)
+	class Renderer2D;
+	class RenderTarget;
+	class RenderTexture;
+
+	/*!
+	 \brief Class used to order, cull and execute the off-screen rendering passes of a frame according to their dependencies.
+	*/
+	class _NODISCARD AEON_API RenderGraph
+	{
+	public:
+		// Public typedef(s)
+		using Resource = size_t;                                      //!< The identifier of a resource declared in the graph
+		using PassFunction = std::function<void(const RenderGraph&)>; //!< The function submitting a pass' geometry to the active renderer
+
+		// Public static member(s)
+		static constexpr Resource InvalidResource = static_cast<Resource>(-1); //!< The identifier of an invalid resource
+
+		// Public struct(s)
+		/*!
+		 \brief The struct representing the description of a transient render target.
+		 \details The transient render targets with identical descriptions and disjoint lifetimes share the same render texture.
+		*/
+		struct AEON_API TargetDescription
+		{
+			Vector2i                  size;          //!< The dimensions of the render target
+			Texture2D::InternalFormat colorFormat;   //!< The color buffer's internal format
+			Texture2D::InternalFormat depthFormat;   //!< The depth buffer's internal format, ae::Texture2D::InternalFormat::Native for none
+			Texture2D::InternalFormat stencilFormat; //!< The stencil buffer's internal format, ae::Texture2D::InternalFormat::Native for none
+			Color                     clearColor;    //!< The color with which the render target is cleared before its first pass
+
+			/*!
+			 \brief Constructs the ae::RenderGraph::TargetDescription by providing the dimensions and the optional formats.
+
+			 \param[in] size The dimensions of the render target
+			 \param[in] colorFormat The ae::Texture2D::InternalFormat of the color buffer, ae::Texture2D::InternalFormat::RGBA8 by default
+			 \param[in] depthFormat The ae::Texture2D::InternalFormat of the depth buffer, ae::Texture2D::InternalFormat::Native by default
+			 \param[in] stencilFormat The ae::Texture2D::InternalFormat of the stencil buffer, ae::Texture2D::InternalFormat::Native by default
+
+			 \since v0.7.0
+			*/
+			explicit TargetDescription(const Vector2i& size, Texture2D::InternalFormat colorFormat = Texture2D::InternalFormat::RGBA8,
+			                           Texture2D::InternalFormat depthFormat = Texture2D::InternalFormat::Native,
+			                           Texture2D::InternalFormat stencilFormat = Texture2D::InternalFormat::Native);
+			/*!
+			 \brief Checks if the render texture created for this description may be used for the \a other description.
+
+			 \param[in] other The ae::RenderGraph::TargetDescription that will be compared
+
+			 \return True if the dimensions and the formats are identical, false otherwise
+
+			 \since v0.7.0
+			*/
+			_NODISCARD bool isCompatible(const TargetDescription& other) const noexcept;
+		};
+
+	public:
+		// Public constructor(s)
+		/*!
+		 \brief Default constructor.
+		 \details Creates an empty render graph.
+
+		 \since v0.7.0
+		*/
+		RenderGraph();
+		/*!
+		 \brief Deleted copy constructor.
+
+		 \since v0.7.0
+		*/
+		RenderGraph(const RenderGraph&) = delete;
+		/*!
+		 \brief Move constructor.
+
+		 \param[in] rvalue The ae::RenderGraph that will be moved
+
+		 \since v0.7.0
+		*/
+		RenderGraph(RenderGraph&& rvalue) noexcept;
+		/*!
+		 \brief Destructor.
+		 \details Releases the transient render textures.
+
+		 \since v0.7.0
+		*/
+		~RenderGraph();
+	public:
+		// Public operator(s)
+		/*!
+		 \brief Deleted assignment operator.
+
+		 \since v0.7.0
+		*/
+		RenderGraph& operator=(const RenderGraph&) = delete;
+		/*!
+		 \brief Move assignment operator.
+
+		 \param[in] rvalue The ae::RenderGraph that will be moved
+
+		 \return The caller ae::RenderGraph
+
+		 \since v0.7.0
+		*/
+		RenderGraph& operator=(RenderGraph&& rvalue) noexcept;
+	public:
+		// Public method(s)
+		/*!
+		 \brief Imports a render target that's owned outside of the graph, such as the window.
+		 \details The passes writing into an imported render target are never culled.
+
+		 \param[in] target The ae::RenderTarget that will be imported, it must outlive the graph's execution
+
+		 \return The identifier of the imported resource
+
+		 \sa createTarget()
+
+		 \since v0.7.0
+		*/
+		Resource importTarget(RenderTarget& target);
+		/*!
+		 \brief Imports a persistent render texture that's owned outside of the graph.
+		 \details The passes writing into an imported render texture are never culled, and its texture may be read by the passes declaring it as an input.
+
+		 \param[in] texture The ae::RenderTexture that will be imported, it must outlive the graph's execution
+
+		 \return The identifier of the imported resource
+
+		 \sa createTarget()
+
+		 \since v0.7.0
+		*/
+		Resource importTarget(RenderTexture& texture);
+		/*!
+		 \brief Declares a transient render target, only valid during the graph's execution.
+		 \details The render texture is provided by the graph upon compilation, the transient targets whose lifetimes don't overlap sharing the same render texture if their descriptions are identical.
+
+		 \param[in] description The ae::RenderGraph::TargetDescription of the render target
+
+		 \return The identifier of the transient resource
+
+		 \par Example:
+		 \code
+		 ae::RenderGraph graph;
+		 const ae::RenderGraph::Resource WINDOW = graph.importTarget(window);
+		 const ae::RenderGraph::Resource SCENE = graph.createTarget(ae::RenderGraph::TargetDescription(window.getFramebufferSize()));
+
+		 graph.addPass("Scene", ae::BatchRenderer2D::getInstance(), {}, SCENE, [this](const ae::RenderGraph&) {
+			mSceneRoot.render(ae::RenderStates());
+		 });
+		 graph.addPass("Composite", ae::BatchRenderer2D::getInstance(), { SCENE }, WINDOW, [this, SCENE](const ae::RenderGraph& graph) {
+			mCompositeSprite.setTexture(*graph.getTexture(SCENE));
+			mCompositeSprite.render(ae::RenderStates());
+		 });
+		 graph.compile();
+
+		 // Every frame
+		 graph.execute();
+		 \endcode
+
+		 \sa importTarget(), addPass()
+
+		 \since v0.7.0
+		*/
+		Resource createTarget(const TargetDescription& description);
+		/*!
+		 \brief Adds a pass that's rendered into the \a output resource by the \a renderer provided.
+		 \details The \a inputs are the resources whose textures are read by the pass, the passes writing into them will be executed beforehand.
+		 The consecutive passes rendering into the same output with the same renderer are merged into a single scene, the framebuffer thus being bound and cleared only once.
+
+		 \param[in] name The name of the pass, used for its CPU and GPU profiling scopes
+		 \param[in] renderer The ae::Renderer2D that will begin and end the pass' scene
+		 \param[in] inputs The resources read by the pass
+		 \param[in] output The resource rendered into by the pass
+		 \param[in] function The function submitting the pass' geometry to the active renderer
+
+		 \sa compile(), execute()
+
+		 \since v0.7.0
+		*/
+		void addPass(const std::string& name, Renderer2D& renderer, const std::vector<Resource>& inputs, Resource output, PassFunction function);
+		/*!
+		 \brief Orders the passes, culls the ones that don't contribute to an imported resource and assigns the transient resources' render textures.
+		 \details The graph is compiled by execute() if it was modified since its last compilation.
+		 A resource read by a pass contains what the passes declared before it rendered into it, the passes are thus only reordered when their dependencies allow it.
+		 \note The render textures of the previous compilation are reused when their descriptions match.
+
+		 \sa execute()
+
+		 \since v0.7.0
+		*/
+		void compile();
+		/*!
+		 \brief Executes the passes that weren't culled in their dependency order.
+		 \details The graph is compiled beforehand if it was modified since its last compilation.
+
+		 \sa compile()
+
+		 \since v0.7.0
+		*/
+		void execute();
+		/*!
+		 \brief Removes every pass and resource but keeps the transient render textures so that they may be reused by the next compilation.
+
+		 \since v0.7.0
+		*/
+		void reset();
+		/*!
+		 \brief Retrieves the texture of a resource.
+		 \details A transient resource's texture is only valid during the execution of the passes reading it.
+
+		 \param[in] resource The identifier of the resource
+
+		 \return The color buffer's ae::Texture2D, nullptr if the resource is invalid, is the window or hasn't been assigned a render texture
+
+		 \since v0.7.0
+		*/
+		_NODISCARD const Texture2D* getTexture(Resource resource) const;
+		/*!
+		 \brief Retrieves the number of passes that will be executed, following the graph's compilation.
+
+		 \return The number of passes that weren't culled
+
+		 \sa getCulledPassCount()
+
+		 \since v0.7.0
+		*/
+		_NODISCARD size_t getExecutedPassCount() const noexcept;
+		/*!
+		 \brief Retrieves the number of passes culled by the graph's compilation.
+
+		 \return The number of passes that don't contribute to an imported resource
+
+		 \sa getExecutedPassCount()
+
+		 \since v0.7.0
+		*/
+		_NODISCARD size_t getCulledPassCount() const noexcept;
+		/*!
+		 \brief Retrieves the number of render textures allocated for the transient resources.
+		 \details This number is lower than the number of transient resources when some of them were aliased.
+
+		 \return The number of transient render textures
+
+		 \since v0.7.0
+		*/
+		_NODISCARD size_t getTransientTextureCount() const noexcept;
+
+	private:
+		// Private struct(s)
+		/*!
+		 \brief The struct representing a resource declared in the graph.
+		*/
+		struct ResourceNode
+		{
+			RenderTarget*     target;      //!< The render target, nullptr for a transient resource until it's compiled
+			RenderTexture*    texture;     //!< The render texture, nullptr for the window
+			TargetDescription description; //!< The description of a transient resource
+			size_t            physical;    //!< The index of the transient render texture assigned
+			bool              imported;    //!< Whether the resource is owned outside of the graph
+		};
+		/*!
+		 \brief The struct representing a declared pass.
+		*/
+		struct PassNode
+		{
+			std::string           name;     //!< The pass' name
+			Renderer2D*           renderer; //!< The renderer that begins and ends the pass' scene
+			std::vector<Resource> inputs;   //!< The resources read by the pass
+			Resource              output;   //!< The resource rendered into by the pass
+			PassFunction          function; //!< The function submitting the pass' geometry
+		};
+		/*!
+		 \brief The struct representing a transient render texture and its description.
+		*/
+		struct TransientTexture
+		{
+			std::unique_ptr<RenderTexture> texture;     //!< The render texture
+			TargetDescription              description; //!< The description for which it was created
+			size_t                         lastUse;     //!< The position of the last pass using it in the execution order
+		};
+
+		// Private method(s)
+		/*!
+		 \brief Checks that the \a resource identifier is valid.
+
+		 \param[in] resource The identifier of the resource
+
+		 \return True if the resource exists, false otherwise
+
+		 \since v0.7.0
+		*/
+		_NODISCARD bool isValid(Resource resource) const noexcept;
+		/*!
+		 \brief Sorts the passes in their dependency order, keeping the passes sharing an output adjacent when possible.
+
+		 \since v0.7.0
+		*/
+		void sortPasses();
+		/*!
+		 \brief Removes the passes that don't contribute to an imported resource from the execution order.
+
+		 \since v0.7.0
+		*/
+		void cullPasses();
+		/*!
+		 \brief Assigns a render texture to every transient resource, the resources with disjoint lifetimes sharing the compatible render textures.
+
+		 \since v0.7.0
+		*/
+		void assignTransientTextures();
+
+		// Private member(s)
+		std::vector<ResourceNode>     mResources;         //!< The declared resources
+		std::vector<PassNode>         mPasses;            //!< The declared passes
+		std::vector<size_t>           mOrder;             //!< The indices of the passes that will be executed, in their execution order
+		std::vector<TransientTexture> mTransientTextures; //!< The render textures of the transient resources
+		size_t                        mCulledCount;       //!< The number of passes culled by the last compilation
+		bool                          mCompiled;          //!< Whether the graph was compiled since its last modification
+	};
+}
+#endif // Aeon_Graphics_RenderGraph_H_
+
+/*!
+ \class ae::RenderGraph
+ \ingroup graphics
+
+ The ae::RenderGraph class orchestrates the scenes of a frame that are rendered
+ onto render textures before being composited. Each pass declares the resources
+ it reads and the one it renders into, which are either imported (the window or
+ a persistent ae::RenderTexture) or transient (a render texture only valid
+ during the graph's execution).
+
+ The graph's compilation orders the passes so that every resource is rendered
+ before being read, culls the passes whose output is never read nor imported,
+ and assigns the transient resources' render textures: the transient resources
+ with identical descriptions whose lifetimes don't overlap share the same
+ render texture, which reduces the video memory used. The consecutive passes
+ rendering into the same target with the same renderer are merged into a single
+ scene, their framebuffer being bound and cleared once.
+
+ The render textures are kept by reset() and reused by the next compilation if
+ the descriptions still match, which allows the graph to be rebuilt every frame.
+
+ \author Filippos Gleglakos
+ \version v0.7.0
+ \date 2021.07.05
+ \copyright MIT License
+*/
\ No newline at end of file
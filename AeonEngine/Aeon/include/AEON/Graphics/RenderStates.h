@@ -24,12 +24,14 @@
 #define Aeon_Graphics_RenderStates_H_
 
 #include <AEON/Math/Matrix.h>
+#include <AEON/Math/Vector.h>
 #include <AEON/Graphics/BlendMode.h>
 
 namespace ae
 {
 	// Forward declaration(s)
 	class Texture;
+	class Sampler;
 	class Shader;
 
 	/*!
@@ -37,17 +39,35 @@ namespace ae
 	*/
 	struct _NODISCARD AEON_API RenderStates
 	{
+		// Public enumeration(s)
+		/*!
+		 \brief The hint indicating whether the geometry will be rendered in the renderers' opaque pass or transparent pass.
+		 \details Opaque geometry is rendered front-to-back so that hidden fragments may be discarded by the depth test early on,
+		 transparent geometry is rendered back-to-front once every opaque geometry has been rendered.
+		*/
+		enum class Transparency
+		{
+			Auto,       //!< Deduced from the blend mode, the vertices' colors and the texture's ae::Texture2D::AlphaCoverage
+			Opaque,     //!< The geometry is fully opaque (it will occlude the geometry behind it)
+			Transparent //!< The geometry contains translucent fragments (e.g. a shader outputting an alpha below 1)
+		};
+
 		// Public member(s)
-		BlendMode      blendMode; //!< The blend mode to apply
-		Matrix4f       transform; //!< The transform that will be applied to the vertices
-		const Texture* texture;   //!< The texture to apply
-		const Shader*  shader;    //!< The shader used to display the vertices
-		bool           dirty;     //!< Whether the corresponding renderable is marked as dirty
+		BlendMode      blendMode;    //!< The blend mode to apply
+		Matrix4f       transform;    //!< The transform that will be applied to the vertices
+		const Texture* texture;      //!< The texture to apply
+		const Sampler* sampler;      //!< The sampler overriding the texture's filter and wrapping mode, nullptr to sample the texture with its own parameters
+		const Shader*  shader;       //!< The shader used to display the vertices
+		Transparency   transparency; //!< The hint indicating whether the geometry is opaque or transparent
+		int            layer;        //!< The layer in which the geometry is rendered (only used by the ae::BatchRenderer2D::Mode::Layered mode)
+		Vector4i       clipRect;     //!< The region of the render target (x, y from the bottom-left corner, width, height in pixels) outside of which the geometry is discarded, clipping is disabled if the region is empty
+		bool           dirty;        //!< Whether the corresponding renderable is marked as dirty
+		bool           culling;      //!< Whether the ae::Actor2D nodes situated outside the active scene's view are skipped
 
 		// Public constructor(s)
 		/*!
 		 \brief Default constructor.
-		 \details Creates a default set of render states wherein: BlendAlpha, identity transform, null texture and null shader are used.
+		 \details Creates a default set of render states wherein: BlendAlpha, identity transform, null texture, null sampler, null shader and automatic transparency in layer 0 without clipping are used.
 
 		 \since v0.6.0
 		*/
@@ -145,6 +165,14 @@ namespace ae
  High-level objects such as sprites will automatically fill these states if
  they haven't been manually filled (the texture will always be modified).
 
+ A sampler may be provided to render a texture with a filter and a wrapping
+ mode other than its own, the submissions using different samplers being
+ batched separately.
+
+ Scrolling containers may restrict their content to their visible area by
+ setting the clip rect, the renderers then apply it with OpenGL's scissor test
+ instead of rendering the content to an intermediate framebuffer.
+
  \author Filippos Gleglakos
  \version v0.6.0
  \date 2020.08.29
@@ -23,6 +23,9 @@
 #ifndef Aeon_Graphics_RenderTexture_H_
 #define Aeon_Graphics_RenderTexture_H_
 
+#include <cstdint>
+#include <vector>
+
 #include <AEON/Graphics/internal/RenderTarget.h>
 #include <AEON/Graphics/Texture2D.h>
 
@@ -30,12 +33,33 @@ namespace ae
 {
 	// Forward declaration(s)
 	class Framebuffer;
+	class Buffer;
 
 	/*!
 	 \brief Class used for off-screen rendering.
 	*/
 	class _NODISCARD AEON_API RenderTexture : public RenderTarget
 	{
+	public:
+		// Public enum(s)
+		/*!
+		 \brief The enumeration of the actions applied to the render texture's contents once it's activated for a scene.
+		*/
+		enum class LoadAction
+		{
+			Clear,   //!< The color and depth buffers are cleared
+			Keep,    //!< The contents are kept, the scene being rendered over the previous one
+			DontCare //!< The contents are invalidated, the scene being expected to cover every pixel
+		};
+		/*!
+		 \brief The enumeration of the actions applied to the render texture's contents once a scene has been rendered into it.
+		*/
+		enum class StoreAction
+		{
+			Store,   //!< The contents are preserved
+			DontCare //!< The contents are invalidated, saving the bandwidth needed to preserve them
+		};
+
 	public:
 		// Public constructor(s)
 		/*!
@@ -62,15 +86,28 @@ namespace ae
 		 \li Native (no stencil buffer will be created)
 		 \li STENCIL
 
+		 A \a sampleCount greater than 1 creates a multisampled render texture: the scenes are rendered into multisampled buffers whose color buffer is resolved into the texture at the end of each scene,
+		 which provides anti-aliasing without requiring a multisampled window.
+
 		 \note The buffer formats won't be checked, unexpected results may occur if the wrong format is chosen.
 
 		 \param[in] colorFormat The ae::Texture2D::InternalFormat of the color buffer's image data, ae::Texture2D::InternalFormat::RGBA8 by default
 		 \param[in] depthFormat The ae::Texture2D::InternalFormat of the depth buffer's data, ae::Texture2D::InternalFormat::Native by default
 		 \param[in] stencilFormat The ae::Texture2D::InternalFormat of the stencil buffer's data, ae::Texture2D::InternalFormat::Native by default
+		 \param[in] sampleCount The number of samples per pixel, 1 by default (not multisampled)
+
+		 \par Example:
+		 \code
+		 // Create a 4x multisampled render texture whose depth buffer is discarded after each scene
+		 ae::RenderTexture minimap(ae::Texture2D::InternalFormat::RGBA8, ae::Texture2D::InternalFormat::DEPTH24, ae::Texture2D::InternalFormat::Native, 4);
+		 minimap.setStoreActions(ae::RenderTexture::StoreAction::DontCare, ae::RenderTexture::StoreAction::DontCare);
+		 minimap.create(256, 256);
+		 \endcode
 
 		 \since v0.5.0
 		*/
-		explicit RenderTexture(Texture2D::InternalFormat colorFormat = Texture2D::InternalFormat::RGBA8, Texture2D::InternalFormat depthFormat = Texture2D::InternalFormat::Native, Texture2D::InternalFormat stencilFormat = Texture2D::InternalFormat::Native);
+		explicit RenderTexture(Texture2D::InternalFormat colorFormat = Texture2D::InternalFormat::RGBA8, Texture2D::InternalFormat depthFormat = Texture2D::InternalFormat::Native,
+		                       Texture2D::InternalFormat stencilFormat = Texture2D::InternalFormat::Native, int sampleCount = 1);
 		/*!
 		 \brief Deleted copy constructor.
 
@@ -107,7 +144,9 @@ namespace ae
 		// Public method(s)
 		/*!
 		 \brief Creates the render texture by providing the dimensions \a width x \a height.
-		 \note The dimensions provided should optimally be even numbers for correct results.
+		 \details The framebuffer and its textures are borrowed from the ae::GLResourceFactory's pool of render targets of the same dimensions and formats, the previous ones being returned to it.
+		 Recreating the render texture with dimensions it previously had, or that another render texture released, thus doesn't allocate any video memory.
+		 \note The dimensions provided should optimally be even numbers for correct results. The contents are undefined until the render texture is rendered onto.
 
 		 \param[in] width The render texture's width
 		 \param[in] height The render texture's height
@@ -127,7 +166,7 @@ namespace ae
 		 rtexture3.create(250, 250);
 		 \endcode
 
-		 \sa getTexture()
+		 \sa getTexture(), requestResize()
 
 		 \since v0.5.0
 		*/
@@ -143,6 +182,95 @@ namespace ae
 		 \since v0.5.0
 		*/
 		_NODISCARD const Texture2D* const getTexture() const noexcept;
+		/*!
+		 \brief Requests an asynchronous copy of the color buffer's texels into a pixel pack buffer.
+		 \details The copy is fenced and retrieved later on with retrieveReadback() without stalling the frame, a pending readback is replaced.
+		 The texels are converted to RGBA with 8 bits per channel.
+		 \note A pending readback should be retrieved before the render texture is destroyed.
+
+		 \par Example:
+		 \code
+		 // Request the screenshot once the scene has been rendered into the render texture
+		 renderTexture.requestReadback();
+		 ...
+		 // Retrieve it during one of the following frames
+		 std::vector<uint8_t> pixels;
+		 if (renderTexture.retrieveReadback(pixels)) {
+			// Save the screenshot
+		 }
+		 \endcode
+
+		 \sa retrieveReadback(), isReadbackPending()
+
+		 \since v0.7.0
+		*/
+		void requestReadback();
+		/*!
+		 \brief Retrieves the texels copied by the last readback requested once OpenGL has completed the copy.
+		 \details The texels are tightly packed and ordered from the bottom row to the top row, as they would be by OpenGL.
+
+		 \param[out] pixels The RGBA8 texels of the color buffer, left untouched if the readback isn't available
+		 \param[in] wait Whether to wait for the copy to complete instead of returning immediately, false by default
+
+		 \return True if the texels were retrieved, false if the copy hasn't completed yet or if no readback is pending
+
+		 \sa requestReadback()
+
+		 \since v0.7.0
+		*/
+		bool retrieveReadback(std::vector<uint8_t>& pixels, bool wait = false);
+		/*!
+		 \brief Checks whether a readback was requested and has yet to be retrieved.
+
+		 \return True if a readback is pending, false otherwise
+
+		 \sa requestReadback(), retrieveReadback()
+
+		 \since v0.7.0
+		*/
+		_NODISCARD bool isReadbackPending() const noexcept;
+		/*!
+		 \brief Sets the action applied to the render texture's contents once it's activated for a scene.
+		 \details The contents are cleared by default. The ae::RenderTexture::LoadAction::DontCare action skips the clear and lets the driver discard the previous contents
+		 instead of loading them, which is cheaper on tiled and integrated GPUs for the scenes covering every pixel.
+
+		 \param[in] action The ae::RenderTexture::LoadAction that will be applied
+
+		 \sa setStoreActions()
+
+		 \since v0.7.0
+		*/
+		void setLoadAction(LoadAction action) noexcept;
+		/*!
+		 \brief Sets the actions applied to the color buffer's and to the depth and stencil buffers' contents once a scene has been rendered.
+		 \details The contents are preserved by default. The depth and stencil buffers generally aren't needed once the scene has been rendered and may be invalidated.
+		 The color action of a multisampled render texture applies to its multisampled buffer, the resolved texture always being preserved.
+
+		 \param[in] color The ae::RenderTexture::StoreAction applied to the color buffer
+		 \param[in] depthStencil The ae::RenderTexture::StoreAction applied to the depth and stencil buffers
+
+		 \sa setLoadAction()
+
+		 \since v0.7.0
+		*/
+		void setStoreActions(StoreAction color, StoreAction depthStencil) noexcept;
+		/*!
+		 \brief Resolves the multisampled color buffer into the render texture's texture.
+		 \details The resolve is done automatically at the end of each scene, this is only needed if the multisampled buffer is rendered into outside of a scene. Nothing is done if the render texture isn't multisampled.
+
+		 \sa isMultisampled()
+
+		 \since v0.7.0
+		*/
+		void resolve() const;
+		/*!
+		 \brief Checks if the render texture renders into multisampled buffers.
+
+		 \return True if the sample count provided upon construction is greater than 1, false otherwise
+
+		 \since v0.7.0
+		*/
+		_NODISCARD bool isMultisampled() const noexcept;
 
 		// Public virtual method(s)
 		/*!
@@ -154,17 +282,74 @@ namespace ae
 		 \since v0.5.0
 		*/
 		_NODISCARD virtual unsigned int getFramebufferHandle() const noexcept override final;
+		/*!
+		 \brief Checks whether the ae::RenderTexture is rendered offscreen.
+
+		 \return True as render textures are always rendered offscreen
+
+		 \since v0.7.0
+		*/
+		_NODISCARD virtual bool isOffscreen() const noexcept override final;
+		/*!
+		 \brief Resolves the multisampled color buffer and invalidates the contents as requested by the store actions.
+		 \note This method is called by the renderers at the end of their scene.
+
+		 \sa setStoreActions()
+
+		 \since v0.7.0
+		*/
+		virtual void storeContents() override final;
+
+	private:
+		// Private virtual method(s)
+		/*!
+		 \brief Clears, keeps or invalidates the contents as requested by the load action.
+
+		 \sa setLoadAction()
+
+		 \since v0.7.0
+		*/
+		virtual void loadContents() override final;
+		/*!
+		 \brief Recreates the attachments with the \a size provided once a pending resize is applied.
+		 \details The attachments are kept if the size is invalid (a component is zero).
+
+		 \param[in] size The new dimensions of the render texture
+
+		 \sa requestResize()
+
+		 \since v0.7.0
+		*/
+		virtual void onResize(const Vector2i& size) override final;
+		/*!
+		 \brief Retrieves the framebuffer rendered into, the multisampled one if the render texture is multisampled.
+
+		 \return The ae::Framebuffer rendered into
+
+		 \since v0.7.0
+		*/
+		_NODISCARD const Framebuffer& getRenderFramebuffer() const;
 
 	private:
 		// Private member(s)
-		std::shared_ptr<Framebuffer> mFramebuffer;    //!< The OpenGL framebuffer object
-		std::shared_ptr<Texture2D>   mTexture;        //!< The color channel texture
-		std::shared_ptr<Texture2D>   mDepthTexture;   //!< The depth/stencil channel texture
-		std::shared_ptr<Texture2D>   mStencilTexture; //!< The stencil channel texture
-
-		Texture2D::InternalFormat    mColorFormat;    //!< The color buffer's internal format
-		Texture2D::InternalFormat    mDepthFormat;    //!< The depth buffer's internal format
-		Texture2D::InternalFormat    mStencilFormat;  //!< The stencil buffer's internal format
+		std::shared_ptr<Framebuffer> mFramebuffer;       //!< The OpenGL framebuffer object
+		std::shared_ptr<Texture2D>   mTexture;           //!< The color channel texture
+		std::shared_ptr<Texture2D>   mDepthTexture;      //!< The depth/stencil channel texture
+		std::shared_ptr<Texture2D>   mStencilTexture;    //!< The stencil channel texture
+		std::shared_ptr<Framebuffer> mMultisampled;      //!< The multisampled framebuffer rendered into and resolved into the color channel texture
+
+		Texture2D::InternalFormat    mColorFormat;       //!< The color buffer's internal format
+		Texture2D::InternalFormat    mDepthFormat;       //!< The depth buffer's internal format
+		Texture2D::InternalFormat    mStencilFormat;     //!< The stencil buffer's internal format
+		int                          mSampleCount;       //!< The number of samples per pixel
+		LoadAction                   mLoadAction;        //!< The action applied to the contents once activated
+		StoreAction                  mColorStore;        //!< The action applied to the color buffer once a scene has been rendered
+		StoreAction                  mDepthStencilStore; //!< The action applied to the depth and stencil buffers once a scene has been rendered
+
+		std::shared_ptr<Buffer>      mReadbackBuffer;    //!< The pixel pack buffer into which the color buffer is read back (created upon the first readback)
+		void*                        mReadbackFence;     //!< The fence placed after the pending readback, nullptr if there is none
+		Vector2i                     mReadbackSize;      //!< The dimensions of the pending readback
+		int                          mReadbackCapacity;  //!< The size in bytes of the pixel pack buffer's storage
 	};
 }
 #endif // Aeon_Graphics_RenderTexture_H_
@@ -23,7 +23,10 @@
 #ifndef Aeon_Graphics_Renderable2D_H_
 #define Aeon_Graphics_Renderable2D_H_
 
+#include <cstdint>
+#include <memory>
 #include <vector>
+#include <memory_resource>
 
 #include <AEON/Config.h>
 #include <AEON/Math/Vector.h>
@@ -45,6 +48,14 @@ namespace ae
 		Vector2f uv;       //!< The vertex's texture coordinates
 	};
 
+	/*!
+	 \brief The list of vertices of an ae::Renderable2D, allocated from the memory resource chosen once the renderable is created.
+	 \details The vertices are allocated from the global heap unless the renderable was created while its geometry is pooled.
+
+	 \sa ae::Renderable2D::setGeometryPooled()
+	*/
+	using Vertex2DList = std::pmr::vector<Vertex2D>;
+
 	/*!
 	 \brief Abstract base class representing entities which can be rendered / passed to a renderer.
 	 \note No direct instances of this class may be created.
@@ -69,15 +80,117 @@ namespace ae
 
 		 \since v0.4.0
 		*/
-		_NODISCARD const std::vector<Vertex2D>& getVertices() const noexcept;
+		_NODISCARD const Vertex2DList& getVertices() const noexcept;
 		/*!
 		 \brief Retrieves the list of indices defining the shape of the ae::Renderable2D.
+		 \details The shared list of indices is retrieved if one was set.
 
 		 \return The list of indices
 
+		 \sa setSharedIndices()
+
 		 \since v0.4.0
 		*/
 		_NODISCARD const std::vector<unsigned int>& getIndices() const noexcept;
+		/*!
+		 \brief Sets whether the ae::Renderable2D is retained by the ae::BatchRenderer2D instead of being resubmitted every frame.
+		 \details A retained renderable registers a proxy with the ae::BatchRenderer2D the first time it's rendered, the proxy then keeps
+		 being rendered every scene without the renderable being rendered again. Rendering the renderable afterwards only pushes its
+		 modifications (geometry, transform, render states) to the proxy, so only the renderables that were modified need to be rendered.
+		 \note The proxy keeps being rendered until the renderable is hidden (see setRetainedVisible()), destroyed or no longer retained.\n
+		 A moved or copied renderable registers its own proxy once it's rendered, and only the renderable's own geometry is retained (an
+		 ae::Shape's outline is still submitted whenever it's rendered). The submissions recorded by an ae::RenderCommandList are never retained.
+
+		 \param[in] flag True to retain the renderable, false to resubmit it every frame (default)
+
+		 \par Example:
+		 \code
+		 // The background is only rendered once, and whenever it's modified afterwards
+		 background->setRetained(true);
+		 background->render();
+		 \endcode
+
+		 \sa isRetained(), setRetainedVisible(), ae::BatchRenderer2D::registerProxy()
+
+		 \since v0.7.0
+		*/
+		void setRetained(bool flag);
+		/*!
+		 \brief Checks whether the ae::Renderable2D is retained by the ae::BatchRenderer2D.
+
+		 \return True if the renderable is retained, false otherwise
+
+		 \sa setRetained()
+
+		 \since v0.7.0
+		*/
+		_NODISCARD bool isRetained() const noexcept;
+		/*!
+		 \brief Sets whether the retained ae::Renderable2D's proxy is rendered.
+		 \details Hiding a retained renderable keeps its proxy registered, so showing it again doesn't re-upload its geometry.
+
+		 \param[in] flag True to render the retained renderable's proxy (default), false to hide it
+
+		 \sa setRetained()
+
+		 \since v0.7.0
+		*/
+		void setRetainedVisible(bool flag);
+
+		// Public static method(s)
+		/*!
+		 \brief Sets whether the vertices of the renderables created afterwards are allocated from a shared, chunked pool.
+		 \details The pool sorts the lists by size and carves them out of large chunks, so that a large number of small renderables don't each
+		 allocate their own heap block and their vertices lie next to one another when they're gathered into a batch. The pooled memory is
+		 recycled once a renderable is destroyed, but it's never returned to the global heap.
+		 \note The renderables created beforehand keep allocating from the global heap, the option is usually set once before the scene is built.
+
+		 \param[in] flag True to pool the vertices of the renderables created afterwards, false to allocate them from the global heap (default)
+
+		 \par Example:
+		 \code
+		 // The particles' vertices are pooled
+		 ae::Renderable2D::setGeometryPooled(true);
+		 for (int i = 0; i < 100000; ++i) {
+			mSceneRoot->attachChild(std::make_unique<ae::Sprite>(particleTexture));
+		 }
+		 \endcode
+
+		 \sa isGeometryPooled()
+
+		 \since v0.7.0
+		*/
+		static void setGeometryPooled(bool flag) noexcept;
+		/*!
+		 \brief Checks whether the vertices of the renderables created are allocated from the shared pool.
+
+		 \return True if the geometry is pooled, false otherwise
+
+		 \sa setGeometryPooled()
+
+		 \since v0.7.0
+		*/
+		_NODISCARD static bool isGeometryPooled() noexcept;
+		/*!
+		 \brief Sets the memory resource from which the vertices of the renderables created afterwards are allocated.
+		 \details The resource supplied takes precedence over the shared pool, it must outlive every renderable created while it's set.
+		 \note The renderables created beforehand keep allocating from their own resource, and a copy allocates from the resource set at the time of the copy.
+
+		 \param[in] resource The memory resource of the vertices, nullptr to restore the pool or the global heap (see setGeometryPooled())
+
+		 \par Example:
+		 \code
+		 // The level's vertices are allocated from a pool attributed to the scene graph
+		 static std::pmr::synchronized_pool_resource levelPool;
+		 static ae::TrackedResource levelResource(ae::MemoryTag::SceneGraph, &levelPool);
+		 ae::Renderable2D::setGeometryResource(&levelResource);
+		 \endcode
+
+		 \sa setGeometryPooled()
+
+		 \since v0.7.0
+		*/
+		static void setGeometryResource(std::pmr::memory_resource* resource) noexcept;
 		// Public virtual method(s)
 		/*!
 		 \brief Renders the ae::Renderable2D.
@@ -121,7 +234,7 @@ namespace ae
 
 		 \since v0.6.0
 		*/
-		Renderable2D(const Renderable2D& copy) = default;
+		Renderable2D(const Renderable2D& copy);
 		/*!
 		 \brief Move constructor.
 
@@ -141,7 +254,7 @@ namespace ae
 
 		 \since v0.6.0
 		*/
-		Renderable2D& operator=(const Renderable2D& other) = default;
+		Renderable2D& operator=(const Renderable2D& other);
 		/*!
 		 \brief Move assignment operator.
 
@@ -177,27 +290,95 @@ namespace ae
 		*/
 		_NODISCARD bool isDirty() const noexcept;
 		/*!
-		 \brief Retrieves the list of vertices defining the shape of the ae::Renderable2D.
+		 \brief Retrieves the list of vertices defining the shape of the ae::Renderable2D in order to modify it.
+		 \details If the vertices are shared with other renderables, they're first copied into the renderable's own list (copy-on-write).
+		 \note The read-only accessor must be used when the vertices are only read so that the shared list isn't copied.
 
-		 \return The list of vertices
+		 \return The renderable's own list of vertices
+
+		 \sa shareVertices()
 
 		 \since v0.5.0
 		*/
-		_NODISCARD std::vector<Vertex2D>& getVertices() noexcept;
+		_NODISCARD Vertex2DList& getVertices();
 		/*!
-		 \brief Retrieves the list of indices defining the shape of the ae::Renderable2D.
+		 \brief Retrieves the ae::Renderable2D's own list of indices defining its shape.
+		 \note This list is ignored while a shared list of indices is set.
 
 		 \return The list of indices
 
+		 \sa setSharedIndices()
+
 		 \since v0.5.0
 		*/
 		_NODISCARD std::vector<unsigned int>& getIndices() noexcept;
+		/*!
+		 \brief Sets an immutable list of indices shared with other renderables of the same topology.
+		 \details Renderables whose indices only depend on their vertex count (such as triangle fans) may share a single list instead of each storing their own copy.
+		 \note The renderable's own list of indices is used once again if nullptr is provided.
+
+		 \param[in] indices The shared list of indices, nullptr to use the renderable's own list
+
+		 \sa getIndices()
+
+		 \since v0.7.0
+		*/
+		void setSharedIndices(std::shared_ptr<const std::vector<unsigned int>> indices) noexcept;
+		/*!
+		 \brief Shares the ae::Renderable2D's vertices with the other renderables whose vertices are identical.
+		 \details The vertices are hashed and looked up amongst the lists currently shared, the renderable's own list then being released. The
+		 first renderable of a given geometry hands its list over to be shared. Derived classes should call this method once their geometry was
+		 entirely updated, so that the labels and shapes of identical content only store their local-space vertices once.
+		 \note The vertices of a retained renderable aren't shared as its proxy references its own list.
+
+		 \sa getVertices()
+
+		 \since v0.7.0
+		*/
+		void shareVertices();
+		/*!
+		 \brief Submits the ae::Renderable2D's vertices and indices to the active renderer, or pushes them to its proxy if it's retained.
+		 \details The proxy is registered the first time a retained renderable is submitted while the ae::BatchRenderer2D is active.
+
+		 \param[in] states The ae::RenderStates to be applied to the geometry
+
+		 \sa setRetained()
+
+		 \since v0.7.0
+		*/
+		void submitGeometry(const RenderStates& states) const;
+
+		// Protected static method(s)
+		/*!
+		 \brief Retrieves the memory resource from which the lists of vertices of a renderable being created are allocated.
+		 \details Derived classes storing additional lists of vertices must allocate them from this resource.
+
+		 \return The resource supplied if one was set, the shared pool if the geometry is pooled, the global heap otherwise
+
+		 \sa setGeometryResource(), setGeometryPooled()
+
+		 \since v0.7.0
+		*/
+		_NODISCARD static std::pmr::memory_resource* getGeometryResource();
+	private:
+		// Private method(s)
+		/*!
+		 \brief Unregisters the ae::Renderable2D's proxy from the ae::BatchRenderer2D if one was registered.
+
+		 \since v0.7.0
+		*/
+		void releaseProxy() const;
 
 	private:
 		// Private member(s)
-		std::vector<Vertex2D>     mVertices; //!< The list of vertices to be passed on to a renderer
-		std::vector<unsigned int> mIndices;  //!< The list of indices to be passed on to a renderer
-		mutable bool              mDirty;    //!< Whether the render properties need to be updated
+		Vertex2DList                                     mVertices;       //!< The list of vertices to be passed on to a renderer
+		std::shared_ptr<const Vertex2DList>              mSharedVertices; //!< The optional list of vertices shared with the renderables of identical geometry, used instead of the own list
+		std::vector<unsigned int>                        mIndices;        //!< The list of indices to be passed on to a renderer
+		std::shared_ptr<const std::vector<unsigned int>> mSharedIndices;  //!< The optional list of indices shared with other renderables, used instead of the own list
+		mutable uint32_t                                 mProxy;          //!< The handle of the retained proxy registered with the ae::BatchRenderer2D
+		mutable bool                                     mDirty;          //!< Whether the render properties need to be updated
+		bool                                             mRetained;       //!< Whether the renderable is retained by the ae::BatchRenderer2D
+		bool                                             mRetainedVisible; //!< Whether the retained renderable's proxy is rendered
 	};
 }
 #endif // Aeon_Graphics_Renderable2D_H_
@@ -211,6 +392,9 @@ namespace ae
  then be rendered to a render target. They hold a list of vertices (most often
  4) and a list of indices that will automatically be passed on to the GPU.
 
+ A renderable may also be retained by the ae::BatchRenderer2D, it then only
+ needs to be rendered again once it's modified (see setRetained()).
+
  \author Filippos Gleglakos
  \version v0.6.0
  \date 2020.08.31
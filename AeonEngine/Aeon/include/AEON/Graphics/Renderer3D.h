@@ -0,0 +1,250 @@
+// MIT License
+// 
+// Copyright(c) 2019-2021 Filippos Gleglakos
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef Aeon_Graphics_Renderer3D_H_
+#define Aeon_Graphics_Renderer3D_H_
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include <AEON/Config.h>
+#include <AEON/Math/Matrix.h>
+#include <AEON/Graphics/internal/RingBuffer.h>
+
+namespace ae
+{
+	// Forward declaration(s)
+	class Frustum;
+	class Material;
+	class Mesh;
+	class RenderTarget;
+	class Texture2D;
+	class UniformBuffer;
+	class VertexArray;
+
+	/*!
+	 \brief Singleton class used as the 3D renderer, drawing each mesh once per material with all of its instances.
+	*/
+	class AEON_API Renderer3D
+	{
+	public:
+		// Public struct(s)
+		/*!
+		 \brief The rendering statistics of a scene.
+		*/
+		struct Statistics
+		{
+			unsigned int drawCalls;     //!< The number of instanced drawcalls issued
+			unsigned int materialBinds; //!< The number of materials bound
+			unsigned int meshBinds;     //!< The number of meshes attached to the VAO
+			size_t       instanceCount; //!< The number of instances drawn
+			size_t       indexCount;    //!< The number of indices drawn (summed over the instances)
+			size_t       uploadedBytes; //!< The number of bytes uploaded to the GPU (the instances' transforms)
+			unsigned int submissions;   //!< The number of submissions received
+			unsigned int culled;        //!< The number of submissions culled as they were outside of the camera's view volume
+		};
+
+	private:
+		// Private struct(s)
+		/*!
+		 \brief The internal struct representing a submission awaiting the end of the scene.
+		*/
+		struct DrawCommand
+		{
+			uint64_t    key;       //!< The sort key, the material's sort key followed by the mesh's ID
+			const Mesh* mesh;      //!< The mesh to draw
+			Material*   material;  //!< The material to draw the mesh with
+			uint32_t    transform; //!< The index of the instance's transform
+		};
+
+	public:
+		// Public constructor(s)
+		/*!
+		 \brief Deleted copy constructor.
+
+		 \since v0.7.0
+		*/
+		Renderer3D(const Renderer3D&) = delete;
+		/*!
+		 \brief Deleted move constructor.
+
+		 \since v0.7.0
+		*/
+		Renderer3D(Renderer3D&&) = delete;
+	public:
+		// Public operator(s)
+		/*!
+		 \brief Deleted assignment operator.
+
+		 \since v0.7.0
+		*/
+		Renderer3D& operator=(const Renderer3D&) = delete;
+		/*!
+		 \brief Deleted move assignment operator.
+
+		 \since v0.7.0
+		*/
+		Renderer3D& operator=(Renderer3D&&) = delete;
+	public:
+		// Public method(s)
+		/*!
+		 \brief Setups the ae::Renderer3D for rendering to the \a target provided.
+		 \details Uploads the ae::RenderTarget's camera's matrices to the global transform UBO, enables depth-testing and back-face culling, and activates the \a target.
+		 \note Contrary to the 2D renderers, the 3D scenes can't be recorded by an ae::RenderCommandList and must be rendered by the rendering thread.
+
+		 \param[in] target The ae::RenderTarget which will act as the scene's framebuffer
+
+		 \sa submit(), endScene()
+
+		 \since v0.7.0
+		*/
+		void beginScene(RenderTarget& target);
+		/*!
+		 \brief Adds an instance of the \a mesh provided to the scene, which will be drawn with the \a material provided once the scene ends.
+		 \details The instance is culled if its world box is outside of the camera's view volume.\n
+		 The \a material's shader must declare the vertex inputs of the built-in "_AEON_Mesh3D" shader, the instance's model matrix being
+		 provided through the 4 consecutive attributes following the ae::Vertex3D's.
+		 \note The \a mesh and \a material must remain valid until the end of the scene.\n
+		 The beginScene() method must be called prior to calling this method for correct results.
+
+		 \param[in] mesh The ae::Mesh to draw
+		 \param[in] material The ae::Material with which the \a mesh will be shaded
+		 \param[in] transform The model matrix of the instance
+
+		 \par Example:
+		 \code
+		 auto shader = ae::GLResourceFactory::getInstance().get<ae::Shader>("_AEON_Mesh3D");
+		 ae::Material gold("Gold", shader);
+		 ...
+		 renderer.submit(mesh, gold, ae::Matrix4f::translate(ae::Vector3f(0.f, 2.f, -5.f)));
+		 \endcode
+
+		 \sa beginScene(), endScene()
+
+		 \since v0.7.0
+		*/
+		void submit(const Mesh& mesh, Material& material, const Matrix4f& transform);
+		/*!
+		 \brief Renders the instances submitted with one instanced drawcall per material and mesh.
+		 \details The submissions are sorted by their materials' sort keys and their meshes' IDs, so that each shader, material and mesh is bound once.
+		 The instances' transforms are streamed through a persistently-mapped ring buffer.
+		 \note The beginScene() and submit() methods must be called prior to calling this method for correct results.
+
+		 \sa beginScene(), submit()
+
+		 \since v0.7.0
+		*/
+		void endScene();
+		/*!
+		 \brief Retrieves the rendering statistics of the current scene or of the last scene if none is currently rendered.
+
+		 \return The ae::Renderer3D::Statistics of the scene
+
+		 \par Example:
+		 \code
+		 const ae::Renderer3D::Statistics& stats = ae::Renderer3D::getInstance().getStatistics();
+		 AEON_LOG_INFO("Scene statistics", std::to_string(stats.instanceCount) + " instances were drawn with " + std::to_string(stats.drawCalls) + " drawcalls.");
+		 \endcode
+
+		 \since v0.7.0
+		*/
+		_NODISCARD const Statistics& getStatistics() const noexcept;
+
+		// Public static method(s)
+		/*!
+		 \brief Retrieves the single instance of the ae::Renderer3D.
+
+		 \return The single instance of the ae::Renderer3D
+
+		 \par Example:
+		 \code
+		 ae::Renderer3D& renderer = ae::Renderer3D::getInstance();
+		 \endcode
+
+		 \since v0.7.0
+		*/
+		static Renderer3D& getInstance();
+	private:
+		// Private constructor(s)
+		/*!
+		 \brief Default constructor.
+		 \details Retrieves the mesh VAO and creates the ring buffer through which the instances' transforms are streamed.
+
+		 \since v0.7.0
+		*/
+		Renderer3D();
+
+		// Private method(s)
+		/*!
+		 \brief Uploads the transforms of the \a count commands provided to the ring buffer and issues their instanced drawcalls.
+		 \details The instances are split into as many drawcalls as necessary if they don't fit within the ring's regions.
+
+		 \param[in] commands The first of the commands sharing the same material and mesh
+		 \param[in] count The number of commands
+
+		 \since v0.7.0
+		*/
+		void drawInstances(const DrawCommand* commands, size_t count);
+
+	private:
+		// Private member(s)
+		std::vector<DrawCommand>       mCommands;     //!< The submissions of the current scene
+		std::vector<Matrix4f>          mTransforms;   //!< The instances' transforms of the current scene
+		std::shared_ptr<VertexArray>   mMeshVAO;      //!< The VAO to which the meshes are attached, alongside the per-instance attributes
+		std::shared_ptr<UniformBuffer> mTransformUBO; //!< The global transform UBO
+		std::shared_ptr<Texture2D>     mWhiteTexture; //!< The 1x1 white texture bound for the untextured materials
+		RingBuffer                     mInstanceRing; //!< The persistently-mapped ring used to stream the instances' transforms
+		Statistics                     mStatistics;   //!< The statistics of the current or last scene
+		RenderTarget*                  mRenderTarget; //!< The render target of the current scene
+		const Frustum*                 mFrustum;      //!< The view volume of the current scene's camera
+	};
+}
+#endif // Aeon_Graphics_Renderer3D_H_
+
+/*!
+ \class ae::Renderer3D
+ \ingroup graphics
+
+ The ae::Renderer3D singleton class renders the ae::Mesh instances submitted
+ during a scene. The submissions are sorted by material and by mesh so that
+ every instance of a mesh sharing the same material is drawn by a single
+ instanced drawcall, the instances' model matrices being streamed as
+ per-instance attributes. The materials' parameters reside in the
+ ae::MaterialLibrary's storage buffer, so switching between materials of the
+ same shader merely selects another material ID.
+
+ Usage example:
+ \code
+ ae::Renderer3D& renderer = ae::Renderer3D::getInstance();
+ renderer.beginScene(window);
+ for (const Tree& tree : forest) {
+	renderer.submit(treeMesh, barkMaterial, tree.getTransform());
+ }
+ renderer.endScene();
+ \endcode
+
+ \author Filippos Gleglakos
+ \version v0.7.0
+ \date 2021.07.27
+ \copyright MIT License
+*/
\ No newline at end of file
@@ -0,0 +1,179 @@
+// MIT License
+// 
+// Copyright(c) 2019-2021 Filippos Gleglakos
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef Aeon_Graphics_Sampler_H_
+#define Aeon_Graphics_Sampler_H_
+
+#include <AEON/Graphics/internal/GLResource.h>
+#include <AEON/Graphics/Texture.h>
+
+namespace ae
+{
+	/*!
+	 \brief The class representing an OpenGL sampler object, which overrides the filter and the wrapping mode of the textures bound alongside it.
+	*/
+	class AEON_API Sampler : public GLResource
+	{
+	public:
+		// Public constructor(s)
+		/*!
+		 \brief Constructs the ae::Sampler by providing the filter type and the wrapping mode it applies.
+		 \details The samplers are meant to be retrieved from ae::GLResourceFactory::getSampler() so that a single sampler exists per combination.
+		 \note The mip level filters should only be used to sample textures possessing a mipmap, the other textures being incomplete otherwise.
+
+		 \param[in] filter The ae::Texture::Filter applied to the textures sampled, ae::Texture::Filter::None is treated as ae::Texture::Filter::Linear
+		 \param[in] wrap The ae::Texture::Wrap mode applied to the textures sampled, ae::Texture::Wrap::None is treated as ae::Texture::Wrap::Repeat
+
+		 \par Example:
+		 \code
+		 ae::Sampler sampler(ae::Texture::Filter::Nearest, ae::Texture::Wrap::ClampToEdge);
+		 \endcode
+
+		 \sa ae::GLResourceFactory::getSampler()
+
+		 \since v0.7.0
+		*/
+		Sampler(Texture::Filter filter, Texture::Wrap wrap);
+		/*!
+		 \brief Deleted copy constructor.
+
+		 \since v0.7.0
+		*/
+		Sampler(const Sampler&) = delete;
+		/*!
+		 \brief Move constructor.
+
+		 \param[in] rvalue The ae::Sampler that will be moved
+
+		 \since v0.7.0
+		*/
+		Sampler(Sampler&& rvalue) noexcept;
+
+	public:
+		// Public operator(s)
+		/*!
+		 \brief Deleted assignment operator.
+
+		 \since v0.7.0
+		*/
+		Sampler& operator=(const Sampler&) = delete;
+		/*!
+		 \brief Move assignment operator.
+
+		 \param[in] rvalue The ae::Sampler that will be moved
+
+		 \return The caller ae::Sampler
+
+		 \since v0.7.0
+		*/
+		Sampler& operator=(Sampler&& rvalue) noexcept;
+
+		// Public method(s)
+		/*!
+		 \brief Binds the ae::Sampler to the texture \a unit provided, unless it's already bound to it.
+
+		 \param[in] unit The index of the texture unit
+
+		 \par Example:
+		 \code
+		 texture.bind(1);
+		 sampler.bind(1);
+		 \endcode
+
+		 \sa bind()
+
+		 \since v0.7.0
+		*/
+		void bind(int unit) const;
+		/*!
+		 \brief Retrieves the filter type applied by the ae::Sampler.
+
+		 \return The ae::Texture::Filter applied to the textures sampled
+
+		 \sa getWrap()
+
+		 \since v0.7.0
+		*/
+		_NODISCARD Texture::Filter getFilter() const noexcept;
+		/*!
+		 \brief Retrieves the wrapping mode applied by the ae::Sampler.
+
+		 \return The ae::Texture::Wrap mode applied to the textures sampled
+
+		 \sa getFilter()
+
+		 \since v0.7.0
+		*/
+		_NODISCARD Texture::Wrap getWrap() const noexcept;
+
+		// Public virtual method(s)
+		/*!
+		 \brief Deletes the OpenGL handle of the ae::Sampler.
+
+		 \since v0.7.0
+		*/
+		virtual void destroy() const override final;
+		/*!
+		 \brief Binds the ae::Sampler to the first texture unit.
+
+		 \sa unbind()
+
+		 \since v0.7.0
+		*/
+		virtual void bind() const override final;
+		/*!
+		 \brief Unbinds the sampler bound to the first texture unit, its texture being sampled with its own parameters once again.
+
+		 \sa bind()
+
+		 \since v0.7.0
+		*/
+		virtual void unbind() const override final;
+
+	private:
+		// Private member(s)
+		Texture::Filter mFilter; //!< The filtering type applied
+		Texture::Wrap   mWrap;   //!< The wrapping mode applied
+	};
+}
+#endif // Aeon_Graphics_Sampler_H_
+
+/*!
+ \class ae::Sampler
+ \ingroup graphics
+
+ The ae::Sampler class is used to sample a texture with a filter and a
+ wrapping mode other than its own, without duplicating the texture or
+ modifying its parameters before each drawcall. A pixel-art sprite may thus be
+ rendered with nearest filtering while a minimap displays the same texture
+ with linear filtering.
+
+ The samplers are provided to the renderers through ae::RenderStates::sampler,
+ the submissions using different samplers being batched separately. A single
+ sampler should be created per combination with
+ ae::GLResourceFactory::getSampler().
+
+ \author Filippos Gleglakos
+ \version v0.7.0
+ \date 2021.07.05
+ \copyright MIT License
+*/
\ No newline at end of file
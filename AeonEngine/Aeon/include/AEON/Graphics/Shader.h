@@ -24,6 +24,9 @@
 #define Aeon_Graphics_Shader_H_
 
 #include <map>
+#include <unordered_map>
+#include <vector>
+#include <string>
 
 #include <AEON/Math/Vector.h>
 #include <AEON/Math/Matrix.h>
@@ -34,6 +37,7 @@ namespace ae
 {
 	// Forward declaration(s)
 	class UniformBuffer;
+	class ShaderStorageBuffer;
 
 	/*!
 	 \brief The class representing an OpenGL shader program to which several shader stages can be attached.
@@ -65,6 +69,29 @@ namespace ae
 			TessControl    = 0x8E88, //!< GL_TESS_CONTROL_SHADER
 			Compute        = 0x91B9  //!< GL_COMPUTE_SHADER
 		};
+		/*!
+		 \brief The enumeration of the features that specialise a shader compiled from an uber shader's source code.
+		 \details Each feature is provided to the shader stages as a preprocessor define (AEON_TEXTURED, AEON_VERTEX_COLOR, AEON_OUTLINE, AEON_SDF, AEON_INSTANCED and AEON_ALPHA_MASK), the features may be combined.
+
+		 \sa getFeatureDefines(), ae::GLResourceFactory::getShaderVariant()
+		*/
+		enum Feature
+		{
+			Textured    = 1 << 0, //!< The fragments are modulated by the texture bound
+			VertexColor = 1 << 1, //!< The fragments are modulated by the vertices' color
+			Outline     = 1 << 2, //!< The texture's opaque regions are outlined
+			SDF         = 1 << 3, //!< The texture contains a signed distance field
+			Instanced   = 1 << 4, //!< The vertices are generated from per-instance attributes
+			AlphaMask   = 1 << 5  //!< The texture's red channel is used as the coverage
+		};
+		/*!
+		 \brief The struct representing a uniform's pre-resolved location, retrieved through getUniformHandle().
+		 \details Setting a uniform through its handle skips the lookup of its name.
+		*/
+		struct UniformHandle
+		{
+			int location = -1; //!< The location of the uniform in the shader program, -1 if it isn't active
+		};
 
 	private:
 		/*!
@@ -72,8 +99,10 @@ namespace ae
 		*/
 		struct Stage
 		{
-			std::string  source; //!< The source code of the shader stage
-			unsigned int handle; //!< The OpenGL identifier of the shader stage
+			std::string              source;   //!< The source code of the shader stage, defines included
+			unsigned int             handle;   //!< The OpenGL identifier of the shader stage
+			std::string              filepath; //!< The filepath from which the source code was read in, empty if it was provided directly
+			std::vector<std::string> defines;  //!< The preprocessor defines injected into the source code
 		};
 
 	public:
@@ -134,10 +163,13 @@ namespace ae
 		// Public method(s)
 		/*!
 		 \brief Loads in and attaches a shader stage that will be created by providing the \a type of the shader stage and its \a source code.
-		 \details A shader stage representing the same stage as an already attached one will be refused.
+		 \details A shader stage representing the same stage as an already attached one will be refused.\n
+		 The shader stage is only compiled by link(), and only if the program binary hasn't been cached.\n
+		 The \a defines are inserted as '#define' directives right after the '#version' directive, followed by a '#line' directive so that the compilation errors still refer to the lines of the source code provided.
 		 
 		 \param[in] type The ae::Shader::StageType indicating the type of the shader stage to create and attach
 		 \param[in] source A string containing the source code of the shader stage
+		 \param[in] defines The preprocessor defines (\"NAME\" or \"NAME value\") to inject, none by default
 
 		 \par Example:
 		 \code
@@ -156,19 +188,24 @@ namespace ae
 		 // Create the shader program and attach the shader stage that will be created within the shader program
 		 std::shared_ptr<ae::Shader> shader = glResourceFactory.create<ae::Shader>("myShader");
 		 shader->loadFromSource(ae::Shader::StageType::Vertex, vertShaderSource);
+
+		 // Specialise the fragment stage of an uber shader with the defines of some features
+		 shader->loadFromSource(ae::Shader::StageType::Fragment, uberShaderSource, ae::Shader::getFeatureDefines(ae::Shader::Textured | ae::Shader::Outline));
 		 \endcode
 
-		 \sa loadFromFile()
+		 \sa loadFromFile(), getFeatureDefines()
 
 		 \since v0.6.0
 		*/
-		void loadFromSource(StageType type, const std::string& source);
+		void loadFromSource(StageType type, const std::string& source, const std::vector<std::string>& defines = {});
 		/*!
 		 \brief Loads in and attaches the shader stage that will be created by providing the \a type of the shader stage and the path of the file containing the source code.
-		 \details A shader stage representing the same stage as an already attached one will be refused.
+		 \details A shader stage representing the same stage as an already attached one will be refused.\n
+		 The \a defines are injected like with loadFromSource(), and again whenever the file is reloaded.
 
 		 \param[in] type The ae::Shader::StageType indicating the type of the shader stage to create and attach
 		 \param[in] filename A string containing the path of the file containing the source code
+		 \param[in] defines The preprocessor defines (\"NAME\" or \"NAME value\") to inject, none by default
 
 		 \par Example:
 		 \code
@@ -184,11 +221,16 @@ namespace ae
 
 		 \since v0.6.0
 		*/
-		void loadFromFile(StageType type, const std::string& filename);
+		void loadFromFile(StageType type, const std::string& filename, const std::vector<std::string>& defines = {});
 		/*!
 		 \brief Links together all the attached shader stages.
+		 \details The program binary is loaded from the cache directory if a previous run has cached it for the same source code and driver, the shader stages are otherwise compiled and the program binary is cached once linked.\n
+		 The program is only validated in Debug mode.\n
+		 A deferred link only submits the compilation of every shader stage and the link to the driver: their status is only checked once the shader is first bound, so that several programs can be compiled in parallel (with GL_KHR_parallel_shader_compile) by linking them all before binding any.
 		 \note This method should only be called after having attached all the necessary shader stages.\n
-		 A GL_INVALID_VALUE error will be generated regarding a detached shader if a complete vertex shader and a complete fragment shader haven't been attached.
+		 A GL_INVALID_VALUE error will be generated regarding a detached shader if a complete vertex shader and a complete fragment shader haven't been attached, unless a single compute shader was attached.
+
+		 \param[in] deferred Whether the status checks should be deferred until the shader is first bound, false by default
 
 		 \par Example:
 		 \code
@@ -200,13 +242,18 @@ namespace ae
 		 shader->loadFromFile(ae::Shader::StageType::Fragment, "Shaders/fragShader.fs");
 		 ...
 		 shader->link();
+
+		 // Submit the link of a shader that will be compiled in the background during a loading screen
+		 std::shared_ptr<ae::Shader> shader2 = glResourceFactory.create<ae::Shader>("myShader2");
+		 ...
+		 shader2->link(true);
 		 \endcode
 
-		 \sa loadFromSource(), loadFromFile()
+		 \sa loadFromSource(), loadFromFile(), setBinaryCacheDirectory(), isReady()
 
 		 \since v0.6.0
 		*/
-		void link() const;
+		void link(bool deferred = false);
 		/*!
 		 \brief Attempts to reload the ae::Shader using the currently attached shader stages and their current source code.
 		 \details The 'destroy()' method should be called before calling this method as a new OpenGL identifier will be created for the new shader program and for every attached shader stage before linking them together.
@@ -238,6 +285,48 @@ namespace ae
 		 \since v0.4.0
 		*/
 		void reload();
+		/*!
+		 \brief Reads in the source code of the shader stages loaded from the file at the \a filename provided again and relinks the program.
+		 \details The new shader stages are compiled beforehand, the current program being kept if any of them fails to compile. The
+		 program is relinked in place, its OpenGL identifier thus remaining the same.
+		 \note The values of the uniforms are reset by the link, and the ae::Shader::UniformHandle and the uniform block bindings
+		 previously retrieved for it have to be retrieved again.
+
+		 \param[in] filename The filepath of the source code modified
+
+		 \return True if one of the shader stages was loaded from the file, false otherwise
+
+		 \par Example:
+		 \code
+		 shader->reloadFromFile("Shaders/fragShader.fs");
+		 \endcode
+
+		 \sa loadFromFile()
+
+		 \since v0.7.0
+		*/
+		bool reloadFromFile(const std::string& filename);
+		/*!
+		 \brief Checks if the driver has completed a deferred link without waiting for it.
+		 \details The completion is queried through GL_KHR_parallel_shader_compile, the ae::Shader is always considered ready if the extension isn't supported.
+
+		 \return True if the ae::Shader can be bound without stalling, false if the driver is still compiling it
+
+		 \par Example:
+		 \code
+		 // Keep displaying the loading screen until the shader has been compiled in the background
+		 shader->link(true);
+		 ...
+		 if (shader->isReady()) {
+			...
+		 }
+		 \endcode
+
+		 \sa link()
+
+		 \since v0.7.0
+		*/
+		_NODISCARD bool isReady() const;
 		/*!
 		 \brief Checks if the ae::Shader is currently bound.
 		 \details If this method returns false, it could mean that either another shader program is bound or that no shader programs are bound.
@@ -296,6 +385,49 @@ namespace ae
 		 \since v0.6.0
 		*/
 		void addUniformBuffer(const UniformBuffer& ubo);
+		/*!
+		 \brief Assigns the ae::ShaderStorageBuffer's binding point to the ae::Shader's shader storage block \a blockName.
+
+		 \param[in] ssbo The ae::ShaderStorageBuffer whose data store will be accessed by the shader storage block
+		 \param[in] blockName A string containing the name of the shader storage block
+
+		 \par Example:
+		 \code
+		 // Create the SSBO containing the per-instance transforms and associate it to the shader's storage block
+		 auto ssbo = glResourceFactory.create<ae::ShaderStorageBuffer>("transforms");
+		 ssbo->setElements(transforms);
+		 shader->addStorageBuffer(*ssbo, "uTransformBuffer");
+		 \endcode
+
+		 \since v0.7.0
+		*/
+		void addStorageBuffer(const ShaderStorageBuffer& ssbo, const std::string& blockName);
+		/*!
+		 \brief Binds the ae::Shader and launches its compute shader over the number of work groups provided.
+		 \details The ae::Shader must have been linked from a single ae::Shader::StageType::Compute stage.
+		 \note The writes performed by the compute shader aren't visible to the subsequent commands until a matching glMemoryBarrier() has been issued.
+
+		 \param[in] groupsX The number of work groups to launch in the X dimension
+		 \param[in] groupsY The number of work groups to launch in the Y dimension, 1 by default
+		 \param[in] groupsZ The number of work groups to launch in the Z dimension, 1 by default
+
+		 \par Example:
+		 \code
+		 std::shared_ptr<ae::Shader> compute = glResourceFactory.create<ae::Shader>("particleUpdate");
+		 compute->loadFromFile(ae::Shader::StageType::Compute, "Shaders/particleUpdate.cs");
+		 compute->link();
+		 compute->addStorageBuffer(*particles, "uParticleBuffer");
+
+		 // Launch one invocation per particle (the work groups contain 256 invocations)
+		 compute->dispatch((particleCount + 255) / 256);
+		 glMemoryBarrier(GL_SHADER_STORAGE_BARRIER_BIT);
+		 \endcode
+
+		 \sa addStorageBuffer()
+
+		 \since v0.7.0
+		*/
+		void dispatch(unsigned int groupsX, unsigned int groupsY = 1, unsigned int groupsZ = 1) const;
 
 		/*!
 		 \brief Sets the \a value provided to the uniform \a name.
@@ -457,6 +589,198 @@ namespace ae
 		 \since v0.6.0
 		*/
 		void setUniform(const std::string& name, const Matrix4f& mat);
+		/*!
+		 \brief Retrieves the handle of the uniform \a name so that it can be set without looking up its name.
+		 \details All active uniforms are introspected once the shader program is linked, so retrieving a handle doesn't query OpenGL in most cases.
+		 \note The handles should be retrieved again after the shader program is reloaded.
+
+		 \param[in] name A string containing the name of the uniform
+
+		 \return The ae::Shader::UniformHandle of the uniform, whose location is -1 if the uniform isn't active
+
+		 \par Example:
+		 \code
+		 // Retrieve the handle once and use it every frame
+		 const ae::Shader::UniformHandle colorUniform = shader->getUniformHandle("uColor");
+		 ...
+		 shader->setUniform(colorUniform, ae::Vector4f(1.f, 0.f, 0.f, 1.f));
+		 \endcode
+
+		 \sa setUniform()
+
+		 \since v0.7.0
+		*/
+		_NODISCARD UniformHandle getUniformHandle(const std::string& name);
+		/*!
+		 \brief Sets the \a value provided to the uniform associated to the \a handle.
+
+		 \param[in] handle The ae::Shader::UniformHandle retrieved with getUniformHandle()
+		 \param[in] value A float containing the uniform's new value
+
+		 \par Example:
+		 \code
+		 const ae::Shader::UniformHandle uniform = shader->getUniformHandle("uValue");
+		 shader->setUniform(uniform, 5.f);
+		 \endcode
+
+		 \sa getUniformHandle()
+
+		 \since v0.7.0
+		*/
+		void setUniform(UniformHandle handle, float value);
+		/*!
+		 \brief Sets the \a value provided to the uniform associated to the \a handle.
+
+		 \param[in] handle The ae::Shader::UniformHandle retrieved with getUniformHandle()
+		 \param[in] value An int containing the uniform's new value
+
+		 \par Example:
+		 \code
+		 const ae::Shader::UniformHandle uniform = shader->getUniformHandle("uValue");
+		 shader->setUniform(uniform, 5);
+		 \endcode
+
+		 \sa getUniformHandle()
+
+		 \since v0.7.0
+		*/
+		void setUniform(UniformHandle handle, int value);
+		/*!
+		 \brief Sets the \a value provided to the uniform associated to the \a handle.
+
+		 \param[in] handle The ae::Shader::UniformHandle retrieved with getUniformHandle()
+		 \param[in] value An unsigned int containing the uniform's new value
+
+		 \par Example:
+		 \code
+		 const ae::Shader::UniformHandle uniform = shader->getUniformHandle("uValue");
+		 shader->setUniform(uniform, 5u);
+		 \endcode
+
+		 \sa getUniformHandle()
+
+		 \since v0.7.0
+		*/
+		void setUniform(UniformHandle handle, unsigned int value);
+		/*!
+		 \brief Sets the \a vec provided to the uniform associated to the \a handle.
+
+		 \param[in] handle The ae::Shader::UniformHandle retrieved with getUniformHandle()
+		 \param[in] vec An ae::Vector2f containing the uniform's new values
+
+		 \par Example:
+		 \code
+		 const ae::Shader::UniformHandle uniform = shader->getUniformHandle("uValue");
+		 shader->setUniform(uniform, ae::Vector2f(1.f, 0.f));
+		 \endcode
+
+		 \sa getUniformHandle()
+
+		 \since v0.7.0
+		*/
+		void setUniform(UniformHandle handle, const Vector2f& vec);
+		/*!
+		 \brief Sets the \a vec provided to the uniform associated to the \a handle.
+
+		 \param[in] handle The ae::Shader::UniformHandle retrieved with getUniformHandle()
+		 \param[in] vec An ae::Vector3f containing the uniform's new values
+
+		 \par Example:
+		 \code
+		 const ae::Shader::UniformHandle uniform = shader->getUniformHandle("uValue");
+		 shader->setUniform(uniform, ae::Vector3f(1.f, 0.f, -0.5f));
+		 \endcode
+
+		 \sa getUniformHandle()
+
+		 \since v0.7.0
+		*/
+		void setUniform(UniformHandle handle, const Vector3f& vec);
+		/*!
+		 \brief Sets the \a vec provided to the uniform associated to the \a handle.
+
+		 \param[in] handle The ae::Shader::UniformHandle retrieved with getUniformHandle()
+		 \param[in] vec An ae::Vector4f containing the uniform's new values
+
+		 \par Example:
+		 \code
+		 const ae::Shader::UniformHandle uniform = shader->getUniformHandle("uValue");
+		 shader->setUniform(uniform, ae::Vector4f(1.f, 0.f, -0.5f, 1.f));
+		 \endcode
+
+		 \sa getUniformHandle()
+
+		 \since v0.7.0
+		*/
+		void setUniform(UniformHandle handle, const Vector4f& vec);
+		/*!
+		 \brief Sets the \a vec provided to the uniform associated to the \a handle.
+
+		 \param[in] handle The ae::Shader::UniformHandle retrieved with getUniformHandle()
+		 \param[in] vec An ae::Vector2i containing the uniform's new values
+
+		 \par Example:
+		 \code
+		 const ae::Shader::UniformHandle uniform = shader->getUniformHandle("uValue");
+		 shader->setUniform(uniform, ae::Vector2i(1, 0));
+		 \endcode
+
+		 \sa getUniformHandle()
+
+		 \since v0.7.0
+		*/
+		void setUniform(UniformHandle handle, const Vector2i& vec);
+		/*!
+		 \brief Sets the \a vec provided to the uniform associated to the \a handle.
+
+		 \param[in] handle The ae::Shader::UniformHandle retrieved with getUniformHandle()
+		 \param[in] vec An ae::Vector3i containing the uniform's new values
+
+		 \par Example:
+		 \code
+		 const ae::Shader::UniformHandle uniform = shader->getUniformHandle("uValue");
+		 shader->setUniform(uniform, ae::Vector3i(1, 0, -1));
+		 \endcode
+
+		 \sa getUniformHandle()
+
+		 \since v0.7.0
+		*/
+		void setUniform(UniformHandle handle, const Vector3i& vec);
+		/*!
+		 \brief Sets the \a vec provided to the uniform associated to the \a handle.
+
+		 \param[in] handle The ae::Shader::UniformHandle retrieved with getUniformHandle()
+		 \param[in] vec An ae::Vector4i containing the uniform's new values
+
+		 \par Example:
+		 \code
+		 const ae::Shader::UniformHandle uniform = shader->getUniformHandle("uValue");
+		 shader->setUniform(uniform, ae::Vector4i(1, 0, -1, 1));
+		 \endcode
+
+		 \sa getUniformHandle()
+
+		 \since v0.7.0
+		*/
+		void setUniform(UniformHandle handle, const Vector4i& vec);
+		/*!
+		 \brief Sets the \a mat provided to the uniform associated to the \a handle.
+
+		 \param[in] handle The ae::Shader::UniformHandle retrieved with getUniformHandle()
+		 \param[in] mat An ae::Matrix4f containing the uniform's new values
+
+		 \par Example:
+		 \code
+		 const ae::Shader::UniformHandle uniform = shader->getUniformHandle("uValue");
+		 shader->setUniform(uniform, ae::Matrix4f::identity());
+		 \endcode
+
+		 \sa getUniformHandle()
+
+		 \since v0.7.0
+		*/
+		void setUniform(UniformHandle handle, const Matrix4f& mat);
 
 		/*!
 		 \brief Retrieves a modifiable ae::VertexBuffer::Layout that's used to describe the data format of the ae::Shader's attributes.
@@ -483,6 +807,71 @@ namespace ae
 		 \since v0.6.0
 		*/
 		_NODISCARD VertexBuffer::Layout& getDataLayout() noexcept;
+		/*!
+		 \brief Retrieves the ae::Shader's compact ID.
+		 \details Unlike the OpenGL identifier, the ID is assigned sequentially to every ae::Shader created and never reused, so it stays small enough to be packed into the renderers' sort keys.
+
+		 \return The ae::Shader's ID
+
+		 \since v0.7.0
+		*/
+		_NODISCARD uint32_t getID() const noexcept;
+
+		// Public static method(s)
+		/*!
+		 \brief Retrieves the preprocessor defines of the \a features provided.
+
+		 \param[in] features The combination of ae::Shader::Feature flags
+
+		 \return The defines to provide to loadFromSource() or loadFromFile(), in the order of the flags
+
+		 \par Example:
+		 \code
+		 // Retrieves { "AEON_TEXTURED", "AEON_SDF" }
+		 const std::vector<std::string> DEFINES = ae::Shader::getFeatureDefines(ae::Shader::Textured | ae::Shader::SDF);
+		 \endcode
+
+		 \sa ae::GLResourceFactory::getShaderVariant()
+
+		 \since v0.7.0
+		*/
+		_NODISCARD static std::vector<std::string> getFeatureDefines(uint32_t features);
+		/*!
+		 \brief Sets the directory in which the linked program binaries are cached.
+		 \details The cache is keyed by the source code of the shader stages and the driver, so a modified shader or a driver update simply results in a new binary. The directory is \"ShaderCache/\" by default.
+		 \note The directory should be set before the creation of the ae::Application as the pre-compiled shaders are linked then.
+
+		 \param[in] directory The path of the directory in which to cache the program binaries, an empty string disables the cache
+
+		 \par Example:
+		 \code
+		 // Cache the program binaries in a dedicated directory
+		 ae::Shader::setBinaryCacheDirectory("Cache/Shaders");
+
+		 // Disable the cache
+		 ae::Shader::setBinaryCacheDirectory("");
+		 \endcode
+
+		 \sa getBinaryCacheDirectory(), link()
+
+		 \since v0.7.0
+		*/
+		static void setBinaryCacheDirectory(const std::string& directory);
+		/*!
+		 \brief Retrieves the directory in which the linked program binaries are cached.
+
+		 \return The path of the cache directory, or an empty string if the cache is disabled
+
+		 \par Example:
+		 \code
+		 const std::string& directory = ae::Shader::getBinaryCacheDirectory();
+		 \endcode
+
+		 \sa setBinaryCacheDirectory()
+
+		 \since v0.7.0
+		*/
+		_NODISCARD static const std::string& getBinaryCacheDirectory() noexcept;
 
 		// Public virtual method(s)
 		/*!
@@ -562,7 +951,7 @@ namespace ae
 		// Private method(s)
 		/*!
 		 \brief Compiles the source code of the shader associated to the \a handle provided.
-		 \details The status of the compilation will automatically be checked.
+		 \details The compilation is only submitted, its status is checked by finishLink().
 
 		 \param[in] stage The OpenGL identifier of the shader stage
 
@@ -571,6 +960,53 @@ namespace ae
 		 \since v0.4.0
 		*/
 		void compileShader(const Stage& stage) const;
+		/*!
+		 \brief Checks the status of the compiled shader stages and of the link, then detaches the shader stages and caches the program binary.
+		 \details This waits for the driver if it hasn't completed the compilation yet.
+
+		 \sa link()
+
+		 \since v0.7.0
+		*/
+		void finishLink() const;
+		/*!
+		 \brief Introspects all active uniforms of the linked shader program and caches their locations.
+
+		 \sa getUniformHandle()
+
+		 \since v0.7.0
+		*/
+		void queryUniforms() const;
+		/*!
+		 \brief Retrieves the path of the file in which the program binary is cached.
+
+		 \return The path of the cached program binary, or an empty string if the cache is disabled or unsupported
+
+		 \since v0.7.0
+		*/
+		_NODISCARD std::string getBinaryCachePath() const;
+		/*!
+		 \brief Attempts to load the program binary cached at the \a filepath provided.
+
+		 \param[in] filepath The path of the cached program binary
+
+		 \return True if the program binary was loaded and accepted by the driver, false otherwise
+
+		 \sa saveBinary()
+
+		 \since v0.7.0
+		*/
+		bool loadBinary(const std::string& filepath);
+		/*!
+		 \brief Caches the linked program binary at the \a filepath provided.
+
+		 \param[in] filepath The path of the file in which to cache the program binary
+
+		 \sa loadBinary()
+
+		 \since v0.7.0
+		*/
+		void saveBinary(const std::string& filepath) const;
 		/*!
 		 \brief Caches and retrieves the uniform's location in the shader.
 
@@ -607,10 +1043,12 @@ namespace ae
 
 	private:
 		// Private member(s)
-		std::map<StageType, Stage> mStages;     //!< The source code of all the loaded shader stages
-		std::map<std::string, int> mUniforms;   //!< The cached uniform names and locations
-		VertexBuffer::Layout       mDataLayout; //!< The shader's data layout
-		LinkType                   mLinkType;   //!< The link type of the shader
+		std::map<StageType, Stage>                   mStages;      //!< The source code of all the loaded shader stages
+		mutable std::unordered_map<std::string, int> mUniforms;    //!< The cached uniform names and locations
+		VertexBuffer::Layout                         mDataLayout;  //!< The shader's data layout
+		LinkType                                     mLinkType;    //!< The link type of the shader
+		mutable bool                                 mLinkPending; //!< Whether the status of the compilation and of the link still has to be checked
+		uint32_t                                     mID;          //!< The compact ID used by the sort keys
 	};
 }
 #endif // Aeon_Graphics_Shader_H_
@@ -646,6 +1084,16 @@ namespace ae
  meaning that the 'destroy()' method must be called when the resource is no
  longer needed.
 
+ The linked program binaries are cached on disk (see setBinaryCacheDirectory),
+ so the shader stages are only compiled during the first run or after they or
+ the driver have changed.
+
+ A single uber shader may be specialised into several variants by injecting
+ preprocessor defines into its shader stages (see ae::Shader::Feature and
+ getFeatureDefines), each combination of defines being compiled and cached as
+ a separate program. The ae::GLResourceFactory compiles these variants on
+ demand (see ae::GLResourceFactory::getShaderVariant).
+
  \author Filippos Gleglakos
  \version v0.6.0
  \date 2020.09.04
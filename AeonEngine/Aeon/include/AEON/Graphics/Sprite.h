@@ -23,13 +23,21 @@
 #ifndef Aeon_Graphics_Sprite_H_
 #define Aeon_Graphics_Sprite_H_
 
+#include <memory>
+
 #include <AEON/Graphics/Actor2D.h>
 #include <AEON/Graphics/Color.h>
 #include <AEON/Graphics/Texture2D.h>
 #include <AEON/Math/AABoxCollider.h>
+#include <AEON/System/Time.h>
 
 namespace ae
 {
+	// Forward declaration(s)
+	class Sampler;
+	class Shader;
+	class SpriteAnimation;
+
 	/*!
 	 \brief The class representing a drawable and transformable 2D object.
 	*/
@@ -165,6 +173,52 @@ namespace ae
 		 \since v0.4.0
 		*/
 		void setColor(const Color& color) noexcept;
+		/*!
+		 \brief Plays the ae::SpriteAnimation provided from its first frame.
+		 \details The animation's atlas texture is assigned to the sprite. Switching frames only rewrites the vertices' texture coordinates,
+		 the positions are only updated if the new frame's size differs from the previous one's.
+		 \note The \a animation must remain alive for as long as it's played, it may be shared by several sprites.
+
+		 \param[in] animation The ae::SpriteAnimation to play, nullptr to stop the current one (the current frame is retained)
+
+		 \par Example:
+		 \code
+		 auto sprite = std::make_unique<ae::Sprite>();
+		 sprite->setAnimation(&walkAnimation);
+		 \endcode
+
+		 \sa setAnimationPlaying(), getAnimation()
+
+		 \since v0.7.0
+		*/
+		void setAnimation(const SpriteAnimation* animation);
+		/*!
+		 \brief Pauses or resumes the ae::Sprite's current animation.
+
+		 \param[in] playing Whether the animation should advance
+
+		 \sa setAnimation(), isAnimationPlaying()
+
+		 \since v0.7.0
+		*/
+		void setAnimationPlaying(bool playing) noexcept;
+		/*!
+		 \brief Sets the sampler overriding the filter and the wrapping mode of the ae::Sprite's texture.
+		 \details This allows a texture to be rendered with nearest filtering by some sprites and with linear filtering by others without being duplicated.
+		 The sampler received through the render states is used if none is set.
+
+		 \param[in] sampler The ae::Sampler applied to the texture, nullptr to use the render states' one
+
+		 \par Example:
+		 \code
+		 sprite->setSampler(&ae::GLResourceFactory::getInstance().getSampler(ae::Texture::Filter::Nearest, ae::Texture::Wrap::ClampToEdge));
+		 \endcode
+
+		 \sa getSampler(), ae::GLResourceFactory::getSampler()
+
+		 \since v0.7.0
+		*/
+		void setSampler(const Sampler* sampler) noexcept;
 		/*!
 		 \brief Retrieves the ae::Sprite's assigned texture.
 		 \note If no texture was assigned, nullptr will be returned.
@@ -183,6 +237,16 @@ namespace ae
 		 \since v0.4.0
 		*/
 		_NODISCARD const Texture2D* const getTexture() const noexcept;
+		/*!
+		 \brief Retrieves the sampler overriding the parameters of the ae::Sprite's texture.
+
+		 \return The ae::Sampler applied to the texture, nullptr if none was set
+
+		 \sa setSampler()
+
+		 \since v0.7.0
+		*/
+		_NODISCARD const Sampler* getSampler() const noexcept;
 		/*!
 		 \brief Retrieves the ae::Sprite's texture rect.
 		 \details The texture rect represents the area of the assigned texture to display.
@@ -221,6 +285,37 @@ namespace ae
 		 \since v0.4.0
 		*/
 		_NODISCARD const Color& getColor() const noexcept;
+		/*!
+		 \brief Retrieves the ae::SpriteAnimation played by the ae::Sprite.
+
+		 \return The animation played or nullptr if there is none
+
+		 \sa setAnimation()
+
+		 \since v0.7.0
+		*/
+		_NODISCARD const SpriteAnimation* getAnimation() const noexcept;
+		/*!
+		 \brief Retrieves the index of the animation's frame currently displayed.
+
+		 \return The index of the current frame, 0 if there is no animation
+
+		 \sa setAnimation()
+
+		 \since v0.7.0
+		*/
+		_NODISCARD size_t getAnimationFrame() const noexcept;
+		/*!
+		 \brief Checks whether the ae::Sprite's animation is advancing.
+		 \details A non-looping animation stops playing once its last frame has been reached.
+
+		 \return True if the animation is playing, false if it's paused, over or if there is none
+
+		 \sa setAnimationPlaying()
+
+		 \since v0.7.0
+		*/
+		_NODISCARD bool isAnimationPlaying() const noexcept;
 
 		// Public virtual method(s)
 		/*!
@@ -242,6 +337,25 @@ namespace ae
 		 \since v0.5.0
 		*/
 		void updatePosUV();
+		/*!
+		 \brief Updates the stored vertices' texture coordinates only.
+		 \details Called when an animation switches to a frame of the same size as the previous one.
+
+		 \sa updatePosUV()
+
+		 \since v0.7.0
+		*/
+		void updateUV();
+		/*!
+		 \brief Advances the animation by \a dt and displays its new frame if it has changed.
+
+		 \param[in] dt The time difference between the previous frame and the current frame
+
+		 \sa setAnimation()
+
+		 \since v0.7.0
+		*/
+		void updateAnimation(const Time& dt);
 		/*!
 		 \brief Updates the stored vertices' color.
 		 \details Called when the vertices were attempted to be retrieved and the color had changed.
@@ -263,6 +377,24 @@ namespace ae
 		 \since v0.6.0
 		*/
 		virtual void updateSelf(const Time& dt) override final;
+		/*!
+		 \brief Checks whether the ae::Sprite's vertex data needs to be updated.
+
+		 \return True if one of the update flags is raised, false if the ae::Sprite may sleep
+
+		 \sa updateSelf()
+
+		 \since v0.7.0
+		*/
+		_NODISCARD virtual bool hasPendingUpdate() const override final;
+		/*!
+		 \brief Flags the ae::Sprite's vertex positions for an update as its depth was modified.
+
+		 \sa updateSelf()
+
+		 \since v0.7.0
+		*/
+		virtual void onDepthModified() override final;
 		/*!
 		 \brief Sends the vertex data and render states to the renderer.
 		 \details Sets the appropriate shader, blend mode and texture.
@@ -273,17 +405,34 @@ namespace ae
 
 		 \since v0.6.0
 		*/
-		virtual void renderSelf(RenderStates states) const override final;
+		virtual void renderSelf(const RenderStates& states) const override final;
+		/*!
+		 \brief Copies the ae::Sprite without its children, its texture and geometry being shared with the copy.
+
+		 \return The copy of the ae::Sprite
+
+		 \sa clone()
+
+		 \since v0.7.0
+		*/
+		_NODISCARD virtual std::unique_ptr<Actor2D> cloneSelf() const override;
 
 	private:
 		// Private member(s)
-		Box2f            mModelBounds; //!< The local model bounds of the sprite
-		Box2f            mTextureRect; //!< The texture rectangle containing the texture coordinates
-		const Texture2D* mTexture;     //!< The texture to assign to the sprite
-		Color            mColor;       //!< The color of the sprite
-
-		bool             mUpdatePosUV; //!< Whether the vertices' positions and texture coordinates need to be updated
-		bool             mUpdateColor; //!< Whether the vertices' color needs to be updated
+		Box2f                           mModelBounds;      //!< The local model bounds of the sprite
+		Box2f                           mTextureRect;      //!< The texture rectangle containing the texture coordinates
+		const Texture2D*                mTexture;          //!< The texture to assign to the sprite
+		const Sampler*                  mSampler;          //!< The sampler overriding the texture's parameters, nullptr if the render states' one is used
+		Color                           mColor;            //!< The color of the sprite
+		const SpriteAnimation*          mAnimation;        //!< The animation played by the sprite, nullptr if there is none
+		Time                            mAnimationTime;    //!< The time elapsed since the start of the animation
+		size_t                          mAnimationFrame;   //!< The index of the animation's frame displayed
+		bool                            mAnimationPlaying; //!< Whether the animation is advancing
+		mutable std::shared_ptr<Shader> mShader;           //!< The default shader, resolved from the ae::GLResourceFactory when the sprite is first rendered
+
+		bool                            mUpdatePosUV;      //!< Whether the vertices' positions and texture coordinates need to be updated
+		bool                            mUpdateUV;         //!< Whether only the vertices' texture coordinates need to be updated
+		bool                            mUpdateColor;      //!< Whether the vertices' color needs to be updated
 	};
 }
 #endif // Aeon_Graphics_Sprite_H_
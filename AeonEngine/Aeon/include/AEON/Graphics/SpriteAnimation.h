@@ -0,0 +1,237 @@
+// MIT License
+// 
+// Copyright(c) 2019-2021 Filippos Gleglakos
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#ifndef Aeon_Graphics_SpriteAnimation_H_
+#define Aeon_Graphics_SpriteAnimation_H_
+
+#include <string>
+#include <vector>
+
+#include <AEON/Config.h>
+#include <AEON/Math/AABoxCollider.h>
+#include <AEON/System/Time.h>
+
+namespace ae
+{
+	// Forward declaration(s)
+	class Texture2D;
+	class TextureAtlas;
+
+	/*!
+	 \brief The class representing a sequence of frames packed into an ae::TextureAtlas which may be played by ae::Sprite instances.
+	*/
+	class _NODISCARD AEON_API SpriteAnimation
+	{
+	public:
+		// Public constructor(s)
+		/*!
+		 \brief Constructs the ae::SpriteAnimation by providing the texture atlas containing its frames and the duration of each frame.
+		 \note The \a atlas must remain alive for as long as the ae::SpriteAnimation is used, and it must be packed before adding the frames.
+
+		 \param[in] atlas The packed ae::TextureAtlas containing the frames
+		 \param[in] frameDuration The ae::Time during which each frame is displayed
+		 \param[in] loop Whether the animation restarts once its last frame has been displayed, true by default
+
+		 \par Example:
+		 \code
+		 ae::SpriteAnimation walkAnimation(atlas, ae::Time::milliseconds(100));
+		 walkAnimation.addFrame("Resources/Textures/Hero/walk0.png");
+		 walkAnimation.addFrame("Resources/Textures/Hero/walk1.png");
+		 walkAnimation.addFrame("Resources/Textures/Hero/walk2.png");
+		 \endcode
+
+		 \since v0.7.0
+		*/
+		SpriteAnimation(const TextureAtlas& atlas, const Time& frameDuration, bool loop = true);
+		/*!
+		 \brief Copy constructor.
+
+		 \param[in] copy The ae::SpriteAnimation that will be copied
+
+		 \since v0.7.0
+		*/
+		SpriteAnimation(const SpriteAnimation& copy) = default;
+		/*!
+		 \brief Move constructor.
+
+		 \param[in] rvalue The ae::SpriteAnimation that will be moved
+
+		 \since v0.7.0
+		*/
+		SpriteAnimation(SpriteAnimation&& rvalue) noexcept = default;
+	public:
+		// Public operator(s)
+		/*!
+		 \brief Assignment operator.
+
+		 \param[in] other The ae::SpriteAnimation that will be copied
+
+		 \return The caller ae::SpriteAnimation
+
+		 \since v0.7.0
+		*/
+		SpriteAnimation& operator=(const SpriteAnimation& other) = default;
+		/*!
+		 \brief Move assignment operator.
+
+		 \param[in] rvalue The ae::SpriteAnimation that will be moved
+
+		 \return The caller ae::SpriteAnimation
+
+		 \since v0.7.0
+		*/
+		SpriteAnimation& operator=(SpriteAnimation&& rvalue) noexcept = default;
+	public:
+		// Public method(s)
+		/*!
+		 \brief Appends the texture packed into the texture atlas whose filepath is provided as the animation's next frame.
+		 \details The texture rect is retrieved once, the individual texture doesn't need to remain alive.
+
+		 \param[in] filepath The string containing the filepath of a texture packed into the atlas
+
+		 \sa addFrame(const Box2f&)
+
+		 \since v0.7.0
+		*/
+		void addFrame(const std::string& filepath);
+		/*!
+		 \brief Appends the texture packed into the texture atlas as the animation's next frame.
+
+		 \param[in] texture The ae::Texture2D that was packed into the atlas
+
+		 \sa addFrame(const Box2f&)
+
+		 \since v0.7.0
+		*/
+		void addFrame(const Texture2D& texture);
+		/*!
+		 \brief Appends the area of the texture atlas provided as the animation's next frame.
+
+		 \param[in] rect The ae::Box2f containing the starting position and the size of the frame within the atlas
+
+		 \par Example:
+		 \code
+		 // A strip of 8 frames of 32x32 pixels
+		 ae::SpriteAnimation animation(atlas, ae::Time::milliseconds(80));
+		 for (int i = 0; i < 8; ++i) {
+			animation.addFrame(ae::Box2f(i * 32.f, 0.f, 32.f, 32.f));
+		 }
+		 \endcode
+
+		 \since v0.7.0
+		*/
+		void addFrame(const Box2f& rect);
+		/*!
+		 \brief Retrieves the index of the frame displayed once the \a elapsed time has passed since the start of the animation.
+		 \details The last frame is retained once a non-looping animation has ended.
+
+		 \param[in] elapsed The ae::Time passed since the start of the animation
+
+		 \return The index of the frame to display, 0 if the animation has no frames
+
+		 \since v0.7.0
+		*/
+		_NODISCARD size_t getFrameIndex(const Time& elapsed) const noexcept;
+		/*!
+		 \brief Retrieves the texture rect of the frame whose index is provided.
+
+		 \param[in] index The index of the frame, situated within the range [0 ; getFrameCount() - 1]
+
+		 \return The ae::Box2f containing the starting position and the size of the frame within the atlas
+
+		 \since v0.7.0
+		*/
+		_NODISCARD const Box2f& getFrameRect(size_t index) const noexcept;
+		/*!
+		 \brief Retrieves the number of frames of the ae::SpriteAnimation.
+
+		 \return The number of frames
+
+		 \since v0.7.0
+		*/
+		_NODISCARD size_t getFrameCount() const noexcept;
+		/*!
+		 \brief Retrieves the duration during which each frame is displayed.
+
+		 \return The ae::Time of a single frame
+
+		 \sa getDuration()
+
+		 \since v0.7.0
+		*/
+		_NODISCARD const Time& getFrameDuration() const noexcept;
+		/*!
+		 \brief Retrieves the duration of the whole animation.
+
+		 \return The ae::Time of all the frames
+
+		 \sa getFrameDuration()
+
+		 \since v0.7.0
+		*/
+		_NODISCARD Time getDuration() const noexcept;
+		/*!
+		 \brief Retrieves the texture containing the frames.
+
+		 \return The texture of the ae::TextureAtlas
+
+		 \since v0.7.0
+		*/
+		_NODISCARD const Texture2D& getTexture() const noexcept;
+		/*!
+		 \brief Checks whether the animation restarts once its last frame has been displayed.
+
+		 \return True if the animation loops, false otherwise
+
+		 \since v0.7.0
+		*/
+		_NODISCARD bool isLooping() const noexcept;
+
+	private:
+		// Private member(s)
+		std::vector<Box2f>  mFrames;        //!< The texture rects of the frames within the atlas
+		const TextureAtlas* mAtlas;         //!< The texture atlas containing the frames
+		Time                mFrameDuration; //!< The duration during which each frame is displayed
+		bool                mLoop;          //!< Whether the animation restarts once its last frame has been displayed
+	};
+}
+#endif // Aeon_Graphics_SpriteAnimation_H_
+
+/*!
+ \class ae::SpriteAnimation
+ \ingroup graphics
+
+ The ae::SpriteAnimation class describes a sequence of frames packed into an
+ ae::TextureAtlas. It holds no playback state, a single instance may thus be
+ shared by any number of ae::Sprite instances, each playing it at their own
+ pace with ae::Sprite::setAnimation().
+
+ As all frames live in the same texture, switching frames only rewrites the
+ sprite's texture coordinates: its texture, batch and positions are left
+ untouched as long as the frames share the same size.
+
+ \author Filippos Gleglakos
+ \version v0.7.0
+ \date 2021.07.20
+ \copyright MIT License
+*/
\ No newline at end of file
@@ -23,6 +23,8 @@
 #ifndef Aeon_Graphics_Text_H_
 #define Aeon_Graphics_Text_H_
 
+#include <memory>
+
 #include <AEON/Graphics/Actor2D.h>
 
 namespace ae
@@ -30,6 +32,7 @@ namespace ae
 	// Forward declaration(s)
 	struct Glyph;
 	class Font;
+	class Shader;
 
 	/*!
 	 \brief The class representing a renderable string of text.
@@ -52,7 +55,7 @@ namespace ae
 
 		 \since v0.6.0
 		*/
-		Text(const Text& copy) = default;
+		Text(const Text& copy);
 		/*!
 		 \brief Move constructor.
 
@@ -61,6 +64,13 @@ namespace ae
 		 \since v0.5.0
 		*/
 		Text(Text&& rvalue) noexcept;
+		/*!
+		 \brief Destructor.
+		 \details Stops listening to the font's texture atlas updates.
+
+		 \since v0.7.0
+		*/
+		virtual ~Text();
 	public:
 		// Public operator(s)
 		/*!
@@ -72,7 +82,7 @@ namespace ae
 
 		 \since v0.6.0
 		*/
-		Text& operator=(const Text& other) = default;
+		Text& operator=(const Text& other);
 		/*!
 		 \brief Move assignment operator.
 
@@ -109,6 +119,7 @@ namespace ae
 		void setFont(Font& font) noexcept;
 		/*!
 		\brief Sets the string of characters that the ae::Text will hold.
+		\details The string is decoded as UTF-8, malformed sequences are displayed with the replacement character (U+FFFD).
 
 		\param[in] text A string of characters to assign to the ae::Text
 
@@ -124,6 +135,62 @@ namespace ae
 		\since v0.6.0
 		*/
 		void setText(const std::string& text) noexcept;
+		/*!
+		 \brief Appends the string of characters provided to the ae::Text's current string.
+		 \details Only the appended characters' glyphs are retrieved and laid out during the next update.
+
+		 \param[in] text The string of characters to append
+
+		 \par Example:
+		 \code
+		 auto text = std::make_unique<ae::Text>();
+		 text->setText("Some");
+		 text->append(" text");
+		 \endcode
+
+		 \sa insert(), erase(), setText()
+
+		 \since v0.7.0
+		*/
+		void append(const std::string& text);
+		/*!
+		 \brief Inserts the string of characters provided at the \a index provided.
+		 \details Only the glyphs from the \a index onward are laid out again during the next update.
+
+		 \param[in] index The position within the current string at which the characters will be inserted
+		 \param[in] text The string of characters to insert
+
+		 \par Example:
+		 \code
+		 auto text = std::make_unique<ae::Text>();
+		 text->setText("Some text");
+		 text->insert(5, "more ");
+		 \endcode
+
+		 \sa append(), erase(), setText()
+
+		 \since v0.7.0
+		*/
+		void insert(size_t index, std::string_view text);
+		/*!
+		 \brief Erases the \a count characters starting at the \a index provided.
+		 \details Only the glyphs from the \a index onward are laid out again during the next update.
+
+		 \param[in] index The position of the first character to erase
+		 \param[in] count The number of characters to erase, clamped to the end of the string
+
+		 \par Example:
+		 \code
+		 auto text = std::make_unique<ae::Text>();
+		 text->setText("Some text");
+		 text->erase(text->getText().size() - 1); // remove the last character
+		 \endcode
+
+		 \sa append(), insert(), setText()
+
+		 \since v0.7.0
+		*/
+		void erase(size_t index, size_t count = 1);
 		/*!
 		 \brief Sets the size of the ae::Text's characters.
 		 \details It's preferable to increase the text's character size rather than scaling it as the text quality will be significantly better.
@@ -162,9 +229,10 @@ namespace ae
 		/*!
 		 \brief Calculates and retrieves the position of the character at the \a index provided.
 		 \details The position retrieved is situated at the top-left and is in model coordinates.
+		 The characters' horizontal offsets are cached during the layout, so the retrieval is performed in constant time.
 		 \note The update() method needs to be called if this method is called during initialization.
 
-		 \param[in] index The character's position within the text string to retrieve
+		 \param[in] index The character's position within the decoded text string (a codepoint index rather than a byte index)
 
 		 \return The position of the character in model coordinates
 
@@ -251,6 +319,33 @@ namespace ae
 		 \since v0.6.0
 		*/
 		_NODISCARD const Color& getColor() const noexcept;
+		/*!
+		 \brief Retrieves the horizontal offset, in model space, of the character starting at the byte \a index provided.
+		 \details The offset is where a caret placed before the character is displayed, the string's size providing the offset following the last character.
+		 \note The offsets are those of the last update, the glyphs of the most recent edits being laid out during the next one.
+
+		 \param[in] index The byte index of the character's UTF-8 sequence
+
+		 \return The horizontal offset of the character, 0 if the ae::Text is empty
+
+		 \sa findCharacterIndex()
+
+		 \since v0.7.0
+		*/
+		_NODISCARD float getCharacterOffset(size_t index) const noexcept;
+		/*!
+		 \brief Retrieves the byte index of the character boundary closest to the horizontal \a offset provided.
+		 \details This can be used to place a caret under the mouse cursor.
+
+		 \param[in] offset The horizontal offset in model space
+
+		 \return The byte index of the closest character's UTF-8 sequence, or the string's size if the offset is past the middle of its last character
+
+		 \sa getCharacterOffset()
+
+		 \since v0.7.0
+		*/
+		_NODISCARD size_t findCharacterIndex(float offset) const noexcept;
 
 		// Public virtual method(s)
 		/*!
@@ -270,10 +365,33 @@ namespace ae
 		 \since v0.6.0
 		*/
 		_NODISCARD virtual Box2f getModelBounds() const override final;
+
+		// Public static method(s)
+		/*!
+		 \brief Encodes the unicode \a codepoint provided as a UTF-8 sequence.
+
+		 \param[in] codepoint The unicode codepoint to encode
+
+		 \return The string containing the codepoint's UTF-8 sequence, the replacement character (U+FFFD) for invalid codepoints
+
+		 \par Example:
+		 \code
+		 auto text = std::make_unique<ae::Text>();
+		 ...
+		 text->append(ae::Text::encodeUTF8(textEvent->unicode));
+		 \endcode
+
+		 \sa append()
+
+		 \since v0.7.0
+		*/
+		_NODISCARD static std::string encodeUTF8(uint32_t codepoint);
 	private:
 		// Private method(s)
 		/*!
 		 \brief Retrieves the appropriate glyphs and updates the vertices' positions.
+		 \details Only the glyphs from the first edited character onward are retrieved and laid out, their texture coordinates and
+		 colors are also updated if they aren't about to be entirely updated.
 
 		 \sa updateUV(), updateIndices(), updateColor()
 
@@ -283,11 +401,13 @@ namespace ae
 		/*!
 		 \brief Updates the vertices' texture coordinates.
 
+		 \param[in] first The index of the first glyph to update
+
 		 \sa updatePos(), updateColor()
 
 		 \since v0.6.0
 		*/
-		void updateUV();
+		void updateUV(size_t first = 0);
 		/*!
 		 \brief Updates the indices if necessary.
 
@@ -299,22 +419,36 @@ namespace ae
 		/*!
 		 \brief Updates the vertices' color.
 
+		 \param[in] first The index of the first glyph to update
+
 		 \sa updatePos(), updateUV()
 
 		 \since v0.6.0
 		*/
-		void updateColor();
+		void updateColor(size_t first = 0);
+		/*!
+		 \brief Marks the glyphs from the \a index provided onward to be laid out during the next update.
 
-		// Private virtual method(s)
+		 \param[in] index The index of the first edited character
+
+		 \sa updatePos()
+
+		 \since v0.7.0
+		*/
+		void invalidateLayout(size_t index);
 		/*!
-		 \brief Checks if the ae::Text's assigned font has been modified.
-		 \details If the font has been modified, the vertices' positions will be modified.
+		 \brief Assigns the \a font provided and listens to its texture atlas updates instead of the previous font's.
+		 \details The texture coordinates are updated when the font's texture atlas grows.
 
-		 \param[in] event The polled input ae::Event
+		 \param[in] font The ae::Font to assign, nullptr to stop listening
 
-		 \since v0.6.0
+		 \sa setFont()
+
+		 \since v0.7.0
 		*/
-		virtual void handleEventSelf(Event* const event) override final;
+		void listenToFont(Font* font);
+
+		// Private virtual method(s)
 		/*!
 		 \brief Updates the ae::Text's properties if necessary.
 
@@ -325,6 +459,24 @@ namespace ae
 		 \since v0.6.0
 		*/
 		virtual void updateSelf(const Time& dt) override final;
+		/*!
+		 \brief Checks whether the ae::Text's vertex data needs to be updated.
+
+		 \return True if one of the update flags is raised, false if the ae::Text may sleep
+
+		 \sa updateSelf()
+
+		 \since v0.7.0
+		*/
+		_NODISCARD virtual bool hasPendingUpdate() const override final;
+		/*!
+		 \brief Flags the ae::Text's glyphs' positions for an update as its depth was modified.
+
+		 \sa updateSelf()
+
+		 \since v0.7.0
+		*/
+		virtual void onDepthModified() override final;
 		/*!
 		 \brief Sets the appropriate render states and sends the ae::Text's glyphs to the renderer.
 
@@ -332,19 +484,34 @@ namespace ae
 
 		 \since v0.6.0
 		*/
-		virtual void renderSelf(RenderStates states) const override final;
+		virtual void renderSelf(const RenderStates& states) const override final;
+		/*!
+		 \brief Copies the ae::Text without its children, its font and geometry being shared with the copy.
+
+		 \return The copy of the ae::Text
+
+		 \sa clone()
+
+		 \since v0.7.0
+		*/
+		_NODISCARD virtual std::unique_ptr<Actor2D> cloneSelf() const override;
 
 	private:
 		// Private member(s)
-		std::string               mText;          //!< The text to render
-		std::vector<const Glyph*> mGlyphs;        //!< The collection of glyphs necessary to render the text
-		Box2f                     mModelBounds;   //!< The local model bounds of the text
-		Color                     mColor;         //!< The color of the text
-		Font*                     mFont;          //!< The font used to display the glyphs
-		unsigned int              mCharacterSize; //!< The font size to use
-		bool                      mUpdatePos;     //!< Whether the vertices' positions need to be updated
-		bool                      mUpdateUV;      //!< Whether the vertices' textures coordinates need to be updated
-		bool                      mUpdateColor;   //!< Whether the vertices' colors need to be updated
+		std::string                     mText;                //!< The text to render
+		std::vector<const Glyph*>       mGlyphs;              //!< The collection of glyphs necessary to render the text
+		std::vector<float>              mOffsets;             //!< The prefix sums of the glyphs' advances (the characters' horizontal offsets)
+		std::vector<size_t>             mCharIndices;         //!< The byte offsets of the characters' UTF-8 sequences (followed by the string's size)
+		size_t                          mLayoutStart;         //!< The index of the first glyph to lay out during the next update
+		Box2f                           mModelBounds;         //!< The local model bounds of the text
+		Color                           mColor;               //!< The color of the text
+		Font*                           mFont;                //!< The font used to display the glyphs
+		mutable std::shared_ptr<Shader> mShader;              //!< The default shader of the bitmap glyphs, resolved from the ae::GLResourceFactory when first needed
+		mutable std::shared_ptr<Shader> mDistanceFieldShader; //!< The default shader of the distance field glyphs, resolved from the ae::GLResourceFactory when first needed
+		unsigned int                    mCharacterSize;       //!< The font size to use
+		bool                            mUpdatePos;           //!< Whether the vertices' positions need to be updated
+		bool                            mUpdateUV;            //!< Whether the vertices' textures coordinates need to be updated
+		bool                            mUpdateColor;         //!< Whether the vertices' colors need to be updated
 	};
 }
 #endif // Aeon_Graphics_Text_H_
@@ -83,7 +83,25 @@ namespace ae
 			DEPTH16        = 0x81A5, //!< Depth channel of 16 bits
 			DEPTH32STENCIL = 0x8CAD, //!< Depth channel of 32 bits and stencil channel of 8 bits
 			DEPTH24STENCIL = 0x88F0, //!< Depth channel of 24 bits and stencil channel of 8 bits
-			STENCIL        = 0x8D48  //!< Stencil channel of 8 bits
+			STENCIL        = 0x8D48, //!< Stencil channel of 8 bits
+			BC1            = 0x83F1, //!< Block-compressed four-channel with a 1-bit alpha (4 bits per texel), only for pre-compressed images (.dds or .ktx2)
+			BC3            = 0x83F3, //!< Block-compressed four-channel (8 bits per texel), only for pre-compressed images (.dds or .ktx2)
+			BC7            = 0x8E8C, //!< High-quality block-compressed four-channel (8 bits per texel), only for pre-compressed images (.dds or .ktx2)
+			ASTC4x4        = 0x93B0  //!< ASTC-compressed four-channel in 4x4 blocks (8 bits per texel), only for pre-compressed images (.ktx2) on hardware supporting ASTC
+		};
+
+		// Public struct(s)
+		/*!
+		 \brief The struct describing the layout of the texels of a sized internal format, as transferred to and from the OpenGL texture.
+		*/
+		struct FormatInfo
+		{
+			uint32_t base;         //!< The OpenGL base format
+			uint32_t type;         //!< The OpenGL type of the texels' components
+			int      channelCount; //!< The number of channels
+			int      bitCount;     //!< The number of bits per channel
+			size_t   texelSize;    //!< The size in bytes of a texel, 0 if the format is compressed or has no channels
+			bool     compressed;   //!< Whether the texels are block-compressed
 		};
 
 	public:
@@ -114,6 +132,7 @@ namespace ae
 		/*!
 		 \brief Binds the ae::Texture to the context indicating to OpenGL that we're about to use it.
 		 \details The unit texture is necessary if multiple textures are to be used to draw a single entity.\n
+		 The ae::Texture is also marked as used during the current frame.
 		 \note The ae::Texture should be unbound at the end of its usage.
 
 		 \param[in] unit The unit texture index with which the ae::Texture will be bound
@@ -129,6 +148,8 @@ namespace ae
 		 Every mip level in a mipmap is generated by dividing the previous level's dimensions until the final level's size is 1x1.
 		 The textures generated can use more advanced filtering methods thus improving the visual quality as well as performance.
 
+		 \note Only the mip levels allocated in the texture's storage are generated, see ae::Texture2D::create() to allocate the whole chain.
+
 		 \param[in] filter The ae::Texture::Filter to apply to the texture, ae::Texture::Filter::Linear_MipLinear by default
 
 		 \sa setFilter(), hasMipmap()
@@ -187,6 +208,45 @@ namespace ae
 		 \since v0.4.0
 		*/
 		_NODISCARD bool hasMipmap() const noexcept;
+		/*!
+		 \brief Marks the ae::Texture as used during the current frame.
+		 \details Called by bind(), it should only be called manually when the texture's handle is bound directly.
+
+		 \sa getLastUsedFrame(), ae::TextureResidency
+
+		 \since v0.7.0
+		*/
+		void markUsed() const noexcept;
+		/*!
+		 \brief Retrieves the ae::TextureResidency frame during which the ae::Texture was last used.
+
+		 \return The index of the frame during which the texture was last bound
+
+		 \sa markUsed()
+
+		 \since v0.7.0
+		*/
+		_NODISCARD uint64_t getLastUsedFrame() const noexcept;
+
+		// Public static method(s)
+		/*!
+		 \brief Retrieves the layout of the texels of the sized internal \a format provided.
+		 \details Used to transfer the image data of a texture to and from the VRAM directly.
+
+		 \param[in] format The ae::Texture::InternalFormat whose layout will be retrieved
+
+		 \return The ae::Texture::FormatInfo of the \a format, whose texel size is 0 for the formats that can't be transferred texel by texel
+
+		 \par Example:
+		 \code
+		 const ae::Texture::FormatInfo INFO = ae::Texture::getFormatInfo(texture.getInternalFormat());
+		 std::vector<uint8_t> texels(width * height * INFO.texelSize);
+		 glGetTextureImage(texture.getHandle(), 0, INFO.base, INFO.type, static_cast<GLsizei>(texels.size()), texels.data());
+		 \endcode
+
+		 \since v0.7.0
+		*/
+		_NODISCARD static FormatInfo getFormatInfo(InternalFormat format) noexcept;
 
 		// Public virtual method(s)
 		/*!
@@ -200,6 +260,15 @@ namespace ae
 		 \since v0.4.0
 		*/
 		virtual void setWrap(Wrap wrap);
+		/*!
+		 \brief Checks whether every texel of the ae::Texture is known to be fully opaque.
+		 \details The renderers use this information to render textured geometry in their opaque pass (front-to-back) rather than their transparent pass.
+
+		 \return True if the texture is known to be fully opaque, false otherwise (by default)
+
+		 \since v0.7.0
+		*/
+		_NODISCARD virtual bool isOpaque() const noexcept;
 		/*!
 		 \brief Deletes the OpenGL identifier that was created.
 
@@ -272,6 +341,31 @@ namespace ae
 		*/
 		Texture& operator=(Texture&& rvalue) noexcept;
 
+	protected:
+		// Protected method(s)
+		/*!
+		 \brief Replaces the OpenGL texture by a new one (a texture's storage is immutable once allocated) and reapplies the filter type and the wrapping mode.
+		 \details A filter type using mip levels is replaced by its base filter if the new texture won't possess any mip levels.
+
+		 \param[in] levelCount The number of levels that will be allocated in the new texture's storage
+
+		 \since v0.7.0
+		*/
+		void recreate(int levelCount);
+
+		// Protected static method(s)
+		/*!
+		 \brief Calculates the number of levels of a complete mip chain for the dimensions \a width x \a height.
+
+		 \param[in] width The width of the base level
+		 \param[in] height The height of the base level
+
+		 \return The number of levels until the 1x1 level, floor(log2(max(width, height))) + 1
+
+		 \since v0.7.0
+		*/
+		_NODISCARD static int getMipLevelCount(unsigned int width, unsigned int height) noexcept;
+
 	protected:
 		// Protected struct(s)
 		/*!
@@ -284,6 +378,7 @@ namespace ae
 			uint32_t       base;            //!< The OpenGL base format
 			int            imposedChannels; //!< The number of imposed channels
 			int            bitCount;        //!< The number of bits per channel
+			bool           compressed;      //!< Whether the texels are block-compressed
 
 			// Public constructor(s)
 			/*!
@@ -330,13 +425,15 @@ namespace ae
 		};
 	protected:
 		// Protected member(s)
-		Format   mFormat;        //!< The information regarding the image data's format
-		Wrap     mWrap;          //!< The wrapping mode to employ once the normalized coordinates aren't in the range [0,1]
-		uint32_t mBindingTarget; //!< The binding target of the OpenGL texture
-		bool     mHasMipmap;     //!< Whether a mipmap has been generated
+		Format           mFormat;        //!< The information regarding the image data's format
+		Wrap             mWrap;          //!< The wrapping mode to employ once the normalized coordinates aren't in the range [0,1]
+		uint32_t         mBindingTarget; //!< The binding target of the OpenGL texture
+		int              mLevelCount;    //!< The number of mip levels allocated in the texture's storage
+		bool             mHasMipmap;     //!< Whether a mipmap has been generated
 	private:
 		// Private member(s)
-		Filter   mFilter;        //!< The filtering type to apply
+		Filter           mFilter;        //!< The filtering type to apply
+		mutable uint64_t mLastUsedFrame; //!< The frame during which the texture was last bound
 	};
 }
 #endif // Aeon_Graphics_Texture_H_
@@ -23,6 +23,11 @@
 #ifndef Aeon_Graphics_Texture2D_H_
 #define Aeon_Graphics_Texture2D_H_
 
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
 #include <AEON/Math/Vector.h>
 #include <AEON/Graphics/Texture.h>
 
@@ -33,6 +38,40 @@ namespace ae
 	*/
 	class _NODISCARD AEON_API Texture2D : public Texture
 	{
+	public:
+		// Public enumeration(s)
+		/*!
+		 \brief The enumeration representing what is known of the opacity of the texture's texels.
+		*/
+		enum class AlphaCoverage
+		{
+			Unknown,    //!< The texels haven't been scanned (or the texture's content was rendered by the GPU)
+			Opaque,     //!< Every texel is fully opaque
+			Translucent //!< At least one texel is partially or fully transparent
+		};
+
+		// Public struct(s)
+		/*!
+		 \brief The struct representing an image decoded from a file, ready to be uploaded to a texture.
+		 \details Images are decoded without any OpenGL calls so that they can be decoded on worker threads.\n
+		 The images read from .dds and .ktx2 containers keep their texels and their mip chain as they are, their format being the one of their container.
+		*/
+		struct Image
+		{
+			std::shared_ptr<void> pixels;    //!< The decoded texels, released once the last copy of the image is destroyed
+			std::string           filepath;  //!< The filepath of the image
+			std::string           error;     //!< The reason why the image couldn't be decoded, empty if it was decoded successfully
+			std::vector<size_t>   levels;    //!< The size in bytes of each of the pre-built mip levels stored consecutively, the base level first (empty if the image doesn't come from a .dds or .ktx2 container)
+			size_t                byteCount; //!< The total size of the texels in bytes
+			Vector2u              size;      //!< The dimensions of the image (of its base level)
+			InternalFormat        format;    //!< The internal format requested by the texture, or the compressed format of the container
+			int                   channels;  //!< The number of channels per texel
+			bool                  is16Bit;   //!< Whether each channel is stored in 16 bits rather than 8 bits
+		};
+
+		// Public typedef(s)
+		using Decoder = std::function<bool(const uint8_t*, size_t, int, bool, Image&)>; //!< The function decoding a file's contents with the channels (0 for the native ones) and the bit depth requested, false being returned if the image isn't supported
+
 	public:
 		// Public constructor(s)
 		/*!
@@ -92,6 +131,8 @@ namespace ae
 		 \param[in] width The texture's width
 		 \param[in] height The texture's height
 		 \param[in] data The pixel data that will be used to fill the texture, nullptr by default
+		 \param[in] scanAlpha Whether the pixel \a data will be scanned to determine the texture's ae::Texture2D::AlphaCoverage, true by default
+		 \param[in] mipmap Whether the whole mip chain is allocated (and generated from the \a data if provided), false by default
 
 		 \return True if the texture was created successfully, false otherwise
 
@@ -107,7 +148,7 @@ namespace ae
 
 		 \since v0.6.0
 		*/
-		bool create(unsigned int width, unsigned int height, const void* data = nullptr);
+		bool create(unsigned int width, unsigned int height, const void* data = nullptr, bool scanAlpha = true, bool mipmap = false);
 		/*!
 		 \brief Updates the ae::Texture's image data.
 		 \details This method is used to modify the texture's current data without recreating it.
@@ -117,6 +158,9 @@ namespace ae
 		 \param[in] width The width of the subimage
 		 \param[in] height The height of the subimage
 		 \param[in] data The pixel data that will be placed within the constraints provided
+		 \param[in] pixels The offset of the \a data's copy within the pixel unpack buffer bound, nullptr to source the texels from the \a data by default
+
+		 \note An opaque texture is rescanned within the constraints provided in case the new data contains translucent texels, and the mipmap is regenerated if there is one.
 
 		 \return True if the texture was updated successfully, false otherwise
 
@@ -130,11 +174,11 @@ namespace ae
 		 }
 		 \endcode
 		 
-		 \sa create()
+		 \sa create(), ae::TextureLoader::stream()
 
 		 \since v0.6.0
 		*/
-		bool update(unsigned int offsetX, unsigned int offsetY, unsigned int width, unsigned int height, const void* data);
+		bool update(unsigned int offsetX, unsigned int offsetY, unsigned int width, unsigned int height, const void* data, const void* pixels = nullptr);
 		/*!
 		 \brief Loads in a texture from a file on disk.
 		 \details The image types supported:
@@ -147,8 +191,15 @@ namespace ae
 		 \li .HDR
 		 \li .PIC
 		 \li .PNM
+		 \li .DDS (BC1, BC3 and BC7 along with their pre-built mip levels)
+		 \li .KTX2 (BC1, BC3, BC7 and ASTC 4x4 along with their pre-built mip levels, without supercompression)
+
+		 The pre-compressed images impose their own internal format, their texels aren't scanned (their coverage remains unknown).
+		 The .DDS and .KTX2 containers may also hold uncompressed RGBA8 texels along with their pre-built mip levels.
 
 		 \param[in] filename The string containing the filepath with the extension
+		 \param[in] scanAlpha Whether the loaded texels will be scanned to determine the texture's ae::Texture2D::AlphaCoverage, true by default
+		 \param[in] mipmap Whether the whole mip chain is allocated and generated (the pre-built mip levels are used instead if the file contains them), false by default
 		 
 		 \return True is the texture was created successfully, false otherwise
 
@@ -160,11 +211,91 @@ namespace ae
 		 }
 		 \endcode
 
-		 \sa create()
+		 \sa create(), decodeFromFile(), upload()
 
 		 \since v0.4.0
 		*/
-		bool loadFromFile(const std::string& filename);
+		bool loadFromFile(const std::string& filename, bool scanAlpha = true, bool mipmap = false);
+		/*!
+		 \brief Decodes the image of the file from which the texture was loaded again and uploads it in place.
+		 \details The texture's OpenGL identifier is kept if the image's dimensions, format and mip level count haven't changed, its
+		 texels being replaced within the current storage. The mip chain is generated again if the texture possessed one.
+
+		 \return True if the image was reloaded successfully, false otherwise
+
+		 \par Example:
+		 \code
+		 texture.loadFromFile("Textures/texture.png");
+		 ...
+		 // The file was modified
+		 texture.reloadFromFile();
+		 \endcode
+
+		 \sa loadFromFile()
+
+		 \since v0.7.0
+		*/
+		bool reloadFromFile();
+		/*!
+		 \brief (Re)Creates the texture from the \a image provided, the texture's format being deduced from the image's.
+		 \details The texels may be sourced from the pixel unpack buffer bound, in which case \a pixels is the offset of the texels in that buffer.
+
+		 \param[in] image The ae::Texture2D::Image decoded with decodeFromFile()
+		 \param[in] scanAlpha Whether the image's texels will be scanned to determine the texture's ae::Texture2D::AlphaCoverage, true by default
+		 \param[in] pixels The offset of the texels within the pixel unpack buffer bound, nullptr to source them from the \a image by default
+		 \param[in] mipmap Whether the whole mip chain is allocated and generated (the \a image's pre-built mip levels are used instead if it contains them), false by default
+
+		 \return True if the texture was created successfully, false otherwise
+
+		 \par Example:
+		 \code
+		 ae::Texture2D::Image image;
+		 if (ae::Texture2D::decodeFromFile("Textures/texture.png", ae::Texture2D::InternalFormat::Native, image)) {
+			texture.upload(image);
+		 }
+		 \endcode
+
+		 \sa decodeFromFile(), loadFromFile()
+
+		 \since v0.7.0
+		*/
+		bool upload(const Image& image, bool scanAlpha = true, const void* pixels = nullptr, bool mipmap = false);
+		/*!
+		 \brief Replaces the texture's storage by a low-resolution placeholder to free video memory.
+		 \details The coarsest mip level within the \a placeholderSize is kept, or a single texel of the base level if the texture has no such mip level.
+		 The texture's size and filepath are kept so that the normalized texture coordinates remain valid, the full image being restored by uploading it again.
+		 \note The compressed textures can only be evicted if they possess a mip level within the \a placeholderSize.
+
+		 \param[in] placeholderSize The maximum width and height of the placeholder in texels, 64 by default
+
+		 \return True if the texture was evicted, false if it's already evicted or can't be
+
+		 \sa isEvicted(), upload(), ae::TextureResidency
+
+		 \since v0.7.0
+		*/
+		bool evict(unsigned int placeholderSize = 64);
+		/*!
+		 \brief Checks whether the texture's storage was replaced by a low-resolution placeholder.
+
+		 \return True if the texture was evicted and hasn't been uploaded since, false otherwise
+
+		 \sa evict()
+
+		 \since v0.7.0
+		*/
+		_NODISCARD bool isEvicted() const noexcept;
+		/*!
+		 \brief Estimates the video memory occupied by the texture's full storage, its mip levels included.
+		 \details The estimation is based on the texture's size, so an evicted texture's estimation is the one of its full image.
+
+		 \return The estimated size in bytes
+
+		 \sa evict()
+
+		 \since v0.7.0
+		*/
+		_NODISCARD size_t getStorageSize() const noexcept;
 		/*!
 		 \brief Retrieves the ae::Texture2D's loaded image's filepath.
 
@@ -197,6 +328,27 @@ namespace ae
 		 \since v0.4.0
 		*/
 		_NODISCARD const Vector2u& getSize() const noexcept;
+		/*!
+		 \brief Retrieves what is known of the opacity of the ae::Texture2D's texels.
+		 \details The coverage is determined once when the texture is created or loaded in, textures without an alpha channel are always opaque.
+
+		 \return The ae::Texture2D::AlphaCoverage determined at the texture's creation
+
+		 \par Example:
+		 \code
+		 ae::Texture2D texture;
+		 texture.loadFromFile("Textures/texture.png");
+
+		 if (texture.getAlphaCoverage() == ae::Texture2D::AlphaCoverage::Translucent) {
+			...
+		 }
+		 \endcode
+
+		 \sa isOpaque()
+
+		 \since v0.7.0
+		*/
+		_NODISCARD AlphaCoverage getAlphaCoverage() const noexcept;
 
 		// Public virtual method(s)
 		/*!
@@ -217,11 +369,106 @@ namespace ae
 		 \since v0.4.0
 		*/
 		virtual void setWrap(Wrap wrap) override final;
+		/*!
+		 \brief Checks whether every texel of the ae::Texture2D is known to be fully opaque.
+
+		 \return True if the texture's ae::Texture2D::AlphaCoverage is Opaque, false otherwise
+
+		 \sa getAlphaCoverage()
+
+		 \since v0.7.0
+		*/
+		_NODISCARD virtual bool isOpaque() const noexcept override final;
+		/*!
+		 \brief Estimates the video memory currently occupied by the ae::Texture2D, its mip levels included.
+		 \details Contrary to getStorageSize(), an evicted texture or a texture whose storage wasn't created occupies 0 bytes.
+
+		 \return The estimated size in bytes
+
+		 \sa getStorageSize()
+
+		 \since v0.7.0
+		*/
+		_NODISCARD virtual size_t getMemorySize() const noexcept override final;
+
+		// Public static method(s)
+		/*!
+		 \brief Decodes an image from a file on disk without uploading it.
+		 \details No OpenGL calls are made so the image may be decoded on any thread, the image types supported are the ones of loadFromFile().
+
+		 \param[in] filename The string containing the filepath with the extension
+		 \param[in] internalFormat The ae::Texture::InternalFormat of the texture to which the image will be uploaded, which imposes its channels and bit depth
+		 \param[out] image The ae::Texture2D::Image that will contain the decoded texels (or the reason of the failure)
+
+		 \return True if the image was decoded successfully, false otherwise
+
+		 \sa decodeFromMemory(), upload()
+
+		 \since v0.7.0
+		*/
+		static bool decodeFromFile(const std::string& filename, InternalFormat internalFormat, Image& image);
+		/*!
+		 \brief Decodes an image from the contents of a file already read in, without uploading it.
+		 \details No OpenGL calls are made so the image may be decoded on any thread. This allows the file to be read in
+		 asynchronously with ae::FileSystem::readAsync() and decoded once its contents are available.
+
+		 \param[in] filename The string containing the filepath with the extension, which identifies the image's type
+		 \param[in] data The pointer to the file's contents
+		 \param[in] size The number of bytes of the file's contents
+		 \param[in] internalFormat The ae::Texture::InternalFormat of the texture to which the image will be uploaded, which imposes its channels and bit depth
+		 \param[out] image The ae::Texture2D::Image that will contain the decoded texels (or the reason of the failure)
+
+		 \return True if the image was decoded successfully, false otherwise
+
+		 \sa decodeFromFile(), upload()
+
+		 \since v0.7.0
+		*/
+		static bool decodeFromMemory(const std::string& filename, const uint8_t* data, size_t size, InternalFormat internalFormat, Image& image);
+		/*!
+		 \brief Registers a decoder used instead of the built-in one for the files of the extension provided.
+		 \details This allows faster decoders (libspng, libjpeg-turbo, wuffs, etc.) to be plugged in for the image types dominating the loading times.\n
+		 The decoder receives the file's contents, the number of channels imposed (0 if the image's own channels are kept) and whether
+		 16-bit channels are requested. It must fill in the image's texels, size, channels and bit depth, and may return false to let the built-in decoder handle the file.\n
+		 The decoders may be called concurrently from several worker threads. An empty decoder restores the built-in one.
+
+		 \param[in] extension The string containing the extension in lowercase (with the leading dot)
+		 \param[in] decoder The ae::Texture2D::Decoder to use for the extension
+
+		 \par Example:
+		 \code
+		 ae::Texture2D::setDecoder(".png", [](const uint8_t* data, size_t size, int channels, bool is16Bit, ae::Texture2D::Image& image) {
+			 return decodeWithSpng(data, size, channels, is16Bit, image);
+		 });
+		 \endcode
+
+		 \sa decodeFromMemory()
+
+		 \since v0.7.0
+		*/
+		static void setDecoder(const std::string& extension, Decoder decoder);
+
+	private:
+		// Private method(s)
+		/*!
+		 \brief Scans the texel data provided for partially or fully transparent texels.
+
+		 \param[in] data The texel data, laid out according to the texture's format
+		 \param[in] texelCount The number of texels contained in the \a data
+		 \param[in] is16Bit Whether each channel is stored on 16 bits rather than 8 bits
+
+		 \return The ae::Texture2D::AlphaCoverage of the \a data
+
+		 \since v0.7.0
+		*/
+		_NODISCARD AlphaCoverage scanAlphaCoverage(const void* data, size_t texelCount, bool is16Bit) const noexcept;
 
 	private:
 		// Private member(s)
-		std::string mFilepath; //!< The texture's filepath
-		Vector2u    mSize;     //!< The texture's size
+		std::string   mFilepath;      //!< The texture's filepath
+		Vector2u      mSize;          //!< The texture's size
+		AlphaCoverage mAlphaCoverage; //!< What is known of the opacity of the texture's texels
+		bool          mEvicted;       //!< Whether the texture's storage was replaced by a low-resolution placeholder
 	};
 }
 #endif // Aeon_Graphics_Texture2D_H_
@@ -24,6 +24,8 @@
 #define Aeon_Graphics_TextureAtlas_H_
 
 #include <map>
+#include <string>
+#include <vector>
 
 #include <AEON/Config.h>
 #include <AEON/Math/AABoxCollider.h>
@@ -33,7 +35,7 @@ namespace ae
 {
 	/*!
 	 \brief The class representing a dynamic texture atlas.
-	 \note Should only be used to create a texture atlas during runtime.
+	 \note Should only be used to create a texture atlas during runtime or to load one previously baked with saveToFile().
 	*/
 	class _NODISCARD AEON_API TextureAtlas
 	{
@@ -126,7 +128,37 @@ namespace ae
 		*/
 		void add(const Texture2D& texture);
 		/*!
-		 \brief Packs together the ae::Texture2D instances that have been added thus far into the texture atlas.
+		 \brief Decodes the image file provided into client memory to be packed into the texture atlas.
+		 \details Contrary to the ae::Texture2D instances added, the image is never uploaded as its own texture: its texels are uploaded straight into the texture atlas by pack(), which then becomes the only copy in video memory.
+		 The texture rect of the image is retrieved by providing its filepath.
+		 \note The image's format has to match the texture atlas' internal format (the channels are converted, but the pre-compressed containers aren't).
+
+		 \param[in] filename The string containing the filepath of the image file
+
+		 \return True if the image was decoded and added, false otherwise
+
+		 \par Example:
+		 \code
+		 ae::TextureAtlas atlas;
+		 atlas.add("Resources/Textures/hero.png");
+		 atlas.add("Resources/Textures/enemy.png");
+
+		 // Upload the images into the texture atlas and release their client copies
+		 atlas.pack();
+		 ae::Box2i heroRect = atlas.getTextureRect("Resources/Textures/hero.png");
+		 \endcode
+
+		 \sa pack(), getTextureRect()
+
+		 \since v0.7.0
+		*/
+		bool add(const std::string& filename);
+		/*!
+		 \brief Packs together the ae::Texture2D instances and the images that have been added thus far into the texture atlas.
+		 \details The decoded images added are released once they've been uploaded unless \a keepImages is set, in which case they're kept in client memory to be packed again.
+		 \note The images released and the texture rects loaded with loadFromFile() aren't part of the subsequent packings.
+
+		 \param[in] keepImages Whether the client copies of the images added are kept after the packing, false by default
 
 		 \par Example:
 		 \code
@@ -146,11 +178,89 @@ namespace ae
 		 ae::Box2i texture2Rect = atlas.getTextureRect(*texture2);
 		 \endcode
 
-		 \sa addTexture(), getTexture(), getTextureRect()
+		\sa addTexture(), getTexture(), getTextureRect()
 
 		 \since v0.6.0
 		*/
-		void pack();
+		void pack(bool keepImages = false);
+		/*!
+		 \brief Bakes the packed texture atlas and its texture rects into a binary file.
+		 \details The texture atlas' texels are read back and written along with the texture rect of each texture and image packed, identified by its filepath.
+		 The file produced is loaded with loadFromFile() without the individual textures having to be loaded or packed again.
+		 \note The texture atlas has to be packed with add() and pack() and every texture added must have a unique filepath.
+
+		 \param[in] filename The string containing the filepath of the file that will be written
+
+		 \return True if the texture atlas was baked successfully, false otherwise
+
+		 \par Example:
+		 \code
+		 // Pack the textures once (during a baking step for example) and bake the result
+		 ae::TextureAtlas atlas;
+		 atlas.add(*texture1);
+		 atlas.add(*texture2);
+		 atlas.pack();
+		 if (!atlas.saveToFile("Resources/Atlases/characters.aeatlas")) {
+			...
+		 }
+		 \endcode
+
+		 \sa loadFromFile(), pack()
+
+		 \since v0.7.0
+		*/
+		bool saveToFile(const std::string& filename) const;
+		/*!
+		 \brief Loads a texture atlas previously baked with saveToFile().
+		 \details The file is memory-mapped and its texels are uploaded directly into the texture atlas, no packing is done and no individual texture is required.
+		 The texture rects are then retrieved by providing the filepaths of the textures that were packed.
+		 \note The texture atlas' internal format is replaced by the one stored in the file.
+
+		 \param[in] filename The string containing the filepath of the baked texture atlas
+
+		 \return True if the texture atlas was loaded successfully, false otherwise
+
+		 \par Example:
+		 \code
+		 ae::TextureAtlas atlas;
+		 if (atlas.loadFromFile("Resources/Atlases/characters.aeatlas")) {
+			ae::Box2i heroRect = atlas.getTextureRect("Resources/Textures/hero.png");
+		 }
+		 \endcode
+
+		 \sa saveToFile(), getTextureRect()
+
+		 \since v0.7.0
+		*/
+		bool loadFromFile(const std::string& filename);
+		/*!
+		 \brief Inserts the image data provided directly into the texture atlas and retrieves its texture rectangle.
+		 \details The rectangle is allocated using a skyline packer and only its image data is uploaded, the previous insertions are left untouched.
+		 The texture atlas doubles one of its dimensions whenever the image data doesn't fit, which modifies the normalized coordinates of the previous insertions.
+		 \note Incremental insertions can't be mixed with textures packed with add() and pack() or with a texture atlas loaded with loadFromFile().
+
+		 \param[in] width The width of the image data in texels
+		 \param[in] height The height of the image data in texels
+		 \param[in] data The image data, in the texture atlas' internal format
+		 \param[out] grown Whether the texture atlas had to grow for the image data to fit, nullptr to ignore
+
+		 \return A std::pair containing whether the insertion succeeded and the texture rectangle of the image data
+
+		 \par Example:
+		 \code
+		 ae::TextureAtlas atlas(ae::Texture2D::InternalFormat::R8);
+		 bool grown = false;
+		 auto glyphRect = atlas.insert(bitmapWidth, bitmapHeight, bitmapBuffer, &grown);
+		 if (glyphRect.first && grown) {
+			// Recompute the normalized texture coordinates
+		 }
+		 \endcode
+
+		 \sa getTexture()
+
+		 \since v0.7.0
+		*/
+		_NODISCARD std::pair<bool, Box2i> insert(unsigned int width, unsigned int height, const void* data, bool* const grown = nullptr);
 		/*!
 		 \brief Retrieves the texture atlas containing all packed textures that have been added thus far.
 		 \note The textures to be packed have to be added prior to calling this method.
@@ -205,6 +315,26 @@ namespace ae
 		 \since v0.6.0
 		*/
 		_NODISCARD Box2i getTextureRect(const Texture2D& texture) const noexcept;
+		/*!
+		 \brief Retrieves the texture rect of the texture whose filepath is provided.
+		 \details The texture rects of a texture atlas loaded with loadFromFile() are searched first, followed by the textures packed.
+
+		 \param[in] filepath The string containing the filepath of a texture that was packed
+
+		 \return The texture rect of the texture requested, an empty rect if it's not found
+
+		 \par Example:
+		 \code
+		 ae::TextureAtlas atlas;
+		 atlas.loadFromFile("Resources/Atlases/characters.aeatlas");
+		 ae::Box2i heroRect = atlas.getTextureRect("Resources/Textures/hero.png");
+		 \endcode
+
+		 \sa loadFromFile(), getTexture()
+
+		 \since v0.7.0
+		*/
+		_NODISCARD Box2i getTextureRect(const std::string& filepath) const;
 	private:
 		// Private method(s)
 		/*!
@@ -217,11 +347,53 @@ namespace ae
 		 \since v0.5.0
 		*/
 		Vector2i computePacking();
+		/*!
+		 \brief Finds the lowest position of the skyline at which a rectangle of the dimensions provided fits.
+		 \details Ties are broken by choosing the narrowest skyline segment to reduce the wasted space.
+
+		 \param[in] width The width of the rectangle
+		 \param[in] height The height of the rectangle
+		 \param[out] position The position found
+		 \param[out] segmentIndex The index of the skyline segment on which the rectangle's left side rests
+
+		 \return True if a position was found, false if the texture atlas is full
+
+		 \sa insert()
+
+		 \since v0.7.0
+		*/
+		_NODISCARD bool findSkylinePosition(int width, int height, Vector2i& position, size_t& segmentIndex) const;
+		/*!
+		 \brief Raises the skyline over the rectangle placed at the \a position provided.
+
+		 \param[in] segmentIndex The index of the skyline segment on which the rectangle's left side rests
+		 \param[in] position The rectangle's position
+		 \param[in] width The width of the rectangle
+		 \param[in] height The height of the rectangle
+
+		 \sa findSkylinePosition()
+
+		 \since v0.7.0
+		*/
+		void addSkylineSegment(size_t segmentIndex, const Vector2i& position, int width, int height);
+		/*!
+		 \brief Doubles the texture atlas' smallest dimension while preserving its content.
+
+		 \return True if the texture atlas grew, false if it reached the maximum texture size
+
+		 \sa insert()
+
+		 \since v0.7.0
+		*/
+		bool grow();
 
 	private:
 		// Private member(s)
-		std::map<const Texture2D*, Box2i> mTextures; //!< The textures to be packed and associated rectangles to be computed
-		std::shared_ptr<Texture2D>        mAtlas;    //!< The texture that will serve as the texture atlas
+		std::map<const Texture2D*, Box2i>       mTextures; //!< The textures to be packed and associated rectangles to be computed
+		std::map<std::string, Box2i>            mRects;    //!< The texture rects of the images packed or loaded from a baked texture atlas, associated to their filepaths
+		std::map<std::string, Texture2D::Image> mImages;   //!< The decoded images to be packed, associated to their filepaths
+		std::shared_ptr<Texture2D>              mAtlas;    //!< The texture that will serve as the texture atlas
+		std::vector<Vector3i>                   mSkyline;  //!< The skyline's segments used by the incremental insertions (x, y and width)
 	};
 }
 #endif //Aeon_Graphics_TextureAtlas_H_
@@ -234,7 +406,11 @@ namespace ae
  several other textures. This class shouldn't be used to load in a premade
  texture atlas using third-party software (the API user should opt for a
  normal texture in that case) as the functionalities that it provides are
- purely suited for runtime-creation of a texture atlas.
+ suited for the creation of a texture atlas during runtime.
+
+ A packed texture atlas can however be baked into a binary file beforehand
+ and loaded back with a single upload, sparing the individual textures from
+ being loaded and packed at startup.
 
  \author Filippos Gleglakos
  \version v0.6.0
@@ -0,0 +1,532 @@
+// MIT License
+// 
+// Copyright(c) 2019-2021 Filippos Gleglakos
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+
+#ifndef Aeon_Graphics_TextureLoader_H_
+#define Aeon_Graphics_TextureLoader_H_
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <AEON/Config.h>
+#include <AEON/System/JobSystem.h>
+#include <AEON/System/Task.h>
+#include <AEON/System/Time.h>
+#include <AEON/Graphics/internal/RingBuffer.h>
+#include <AEON/Graphics/Texture2D.h>
+
+// Forward declaration(s)
+struct GLFWwindow;
+
+namespace ae
+{
+	// Forward declaration(s)
+	class Buffer;
+
+	/*!
+	 \brief Singleton class used to load textures asynchronously, their images being decoded on worker threads.
+	*/
+	class AEON_API TextureLoader
+	{
+	public:
+		// Public typedef(s)
+		using Callback = std::function<void(Texture2D&)>; //!< The function called once a texture's image has been uploaded
+
+#if AEON_COROUTINES
+		// Public class(es)
+		/*!
+		 \brief The awaitable suspending a task until a texture's image is uploaded or fails to load, returned by loadAsync().
+		*/
+		class _NODISCARD AEON_API LoadAwaiter
+		{
+		public:
+			// Public constructor(s)
+			/*!
+			 \brief Constructs the ae::TextureLoader::LoadAwaiter by providing the parameters of the load.
+			 \details The parameters are the ones of ae::TextureLoader::load().
+
+			 \since v0.7.0
+			*/
+			LoadAwaiter(const std::string& filename, Texture2D::Filter filter, Texture2D::Wrap wrap, Texture2D::InternalFormat internalFormat, bool scanAlpha, bool mipmap);
+			/*!
+			 \brief Deleted copy constructor.
+
+			 \since v0.7.0
+			*/
+			LoadAwaiter(const LoadAwaiter&) = delete;
+		public:
+			// Public operator(s)
+			/*!
+			 \brief Deleted assignment operator.
+
+			 \since v0.7.0
+			*/
+			LoadAwaiter& operator=(const LoadAwaiter&) = delete;
+		public:
+			// Public method(s)
+			/*!
+			 \brief Checks whether the task needs to be suspended, which is always the case.
+
+			 \return False
+
+			 \since v0.7.0
+			*/
+			_NODISCARD bool await_ready() const noexcept;
+			/*!
+			 \brief Requests the texture, the task being resumed once its request has been processed.
+
+			 \param[in] caller The handle of the suspended task
+
+			 \since v0.7.0
+			*/
+			void await_suspend(Task::Handle caller);
+			/*!
+			 \brief Retrieves the loaded texture.
+
+			 \return The texture whose image was uploaded, nullptr if the image failed to load
+
+			 \since v0.7.0
+			*/
+			_NODISCARD std::shared_ptr<Texture2D> await_resume() const noexcept;
+
+		private:
+			// Private member(s)
+			std::string                mFilename;       //!< The filepath of the image
+			std::shared_ptr<Texture2D> mTexture;        //!< The texture receiving the image
+			std::shared_ptr<bool>      mLoaded;         //!< Whether the image was uploaded, shared with the request's callback
+			Texture2D::Filter          mFilter;         //!< The filter of the texture
+			Texture2D::Wrap            mWrap;           //!< The wrapping mode of the texture
+			Texture2D::InternalFormat  mInternalFormat; //!< The internal format of the image data
+			bool                       mScanAlpha;      //!< Whether the decoded texels will be scanned
+			bool                       mMipmap;         //!< Whether the mip chain will be generated
+		};
+#endif // AEON_COROUTINES
+
+	public:
+		// Public constructor(s)
+		/*!
+		 \brief Deleted copy constructor.
+
+		 \since v0.7.0
+		*/
+		TextureLoader(const TextureLoader&) = delete;
+		/*!
+		 \brief Deleted move constructor.
+
+		 \since v0.7.0
+		*/
+		TextureLoader(TextureLoader&&) = delete;
+		/*!
+		 \brief Destructor.
+		 \details Waits for the images still being decoded.
+		 \note The destroy() method should be called beforehand as OpenGL's context will no longer be available.
+
+		 \since v0.7.0
+		*/
+		~TextureLoader();
+	public:
+		// Public operator(s)
+		/*!
+		 \brief Deleted assignment operator.
+
+		 \since v0.7.0
+		*/
+		TextureLoader& operator=(const TextureLoader&) = delete;
+		/*!
+		 \brief Deleted move assignment operator.
+
+		 \since v0.7.0
+		*/
+		TextureLoader& operator=(TextureLoader&&) = delete;
+	public:
+		// Public method(s)
+		/*!
+		 \brief Creates a texture whose image will be decoded from the file provided on a worker thread.
+		 \details The texture is returned immediately and contains a single white texel until its image is uploaded by update().\n
+		 The texture's size changes once its image is uploaded, so the entities using it may need to reset their texture rect in the \a callback.
+		 \note This method must be called from the thread owning OpenGL's context.
+
+		 \param[in] filename The string containing the filepath with the extension (the image types supported are the ones of ae::Texture2D::loadFromFile())
+		 \param[in] filter The ae::Texture::Filter that'll be applied to the texture, ae::Texture2D::Filter::Linear by default
+		 \param[in] wrap The ae::Texture::Wrap mode that will be employed once the normalized coordinates aren't in the range [0,1], ae::Texture2D::Wrap::ClampToEdge by default
+		 \param[in] internalFormat The ae::Texture::InternalFormat of the image data, ae::Texture2D::InternalFormat::Native by default
+		 \param[in] callback The function called once the image has been uploaded, nullptr by default
+		 \param[in] scanAlpha Whether the decoded texels will be scanned to determine the texture's ae::Texture2D::AlphaCoverage, true by default
+		 \param[in] mipmap Whether the whole mip chain is allocated and generated once the image is uploaded, false by default
+
+		 \return The texture that will receive the image
+
+		 \par Example:
+		 \code
+		 std::shared_ptr<ae::Texture2D> texture = ae::TextureLoader::getInstance().load("Textures/texture.png", ae::Texture2D::Filter::Linear, ae::Texture2D::Wrap::ClampToEdge,
+			ae::Texture2D::InternalFormat::Native, [&sprite](ae::Texture2D& loaded) { sprite.setTexture(loaded, true); });
+		 sprite.setTexture(*texture);
+		 \endcode
+
+		 \sa update()
+
+		 \since v0.7.0
+		*/
+		_NODISCARD std::shared_ptr<Texture2D> load(const std::string& filename, Texture2D::Filter filter = Texture2D::Filter::Linear, Texture2D::Wrap wrap = Texture2D::Wrap::ClampToEdge,
+		                                           Texture2D::InternalFormat internalFormat = Texture2D::InternalFormat::Native, Callback callback = nullptr, bool scanAlpha = true, bool mipmap = false);
+		/*!
+		 \brief Decodes the image of an existing texture from its filepath on a worker thread in order to upload it again.
+		 \details The texture keeps its current storage (an evicted texture's placeholder for example) until its image is uploaded by update().
+		 \note This method must be called from the thread owning OpenGL's context.
+
+		 \param[in] texture The texture whose image will be reloaded, it must have been loaded from a file
+		 \param[in] callback The function called once the image has been uploaded, nullptr by default
+		 \param[in] mipmap Whether the whole mip chain is allocated and generated once the image is uploaded, false by default
+
+		 \par Example:
+		 \code
+		 if (texture->isEvicted()) {
+			ae::TextureLoader::getInstance().reload(texture);
+		 }
+		 \endcode
+
+		 \sa load(), ae::Texture2D::evict()
+
+		 \since v0.7.0
+		*/
+		void reload(const std::shared_ptr<Texture2D>& texture, Callback callback = nullptr, bool mipmap = false);
+#if AEON_COROUTINES
+		/*!
+		 \brief Suspends the calling task until the texture of the file provided is loaded.
+		 \details The texture is requested like with load(), and the task is resumed by the ae::TaskScheduler during the fixed step following the
+		 upload of its image. The task is also resumed if the image fails to load, in which case the texture retrieved is nullptr.
+		 \note The texture is requested once the task is suspended, so the task must run on the thread owning OpenGL's context (the game loop
+		 mustn't be pipelined).
+
+		 \param[in] filename The string containing the filepath with the extension
+		 \param[in] filter The ae::Texture::Filter that'll be applied to the texture, ae::Texture2D::Filter::Linear by default
+		 \param[in] wrap The ae::Texture::Wrap mode of the texture, ae::Texture2D::Wrap::ClampToEdge by default
+		 \param[in] internalFormat The ae::Texture::InternalFormat of the image data, ae::Texture2D::InternalFormat::Native by default
+		 \param[in] scanAlpha Whether the decoded texels will be scanned to determine the texture's ae::Texture2D::AlphaCoverage, true by default
+		 \param[in] mipmap Whether the whole mip chain is allocated and generated once the image is uploaded, false by default
+
+		 \return The awaitable retrieving the loaded texture
+
+		 \par Example:
+		 \code
+		 ae::Task LevelState::loadBackground()
+		 {
+			mBackgroundTexture = co_await ae::TextureLoader::getInstance().loadAsync("Textures/background.png", ae::Texture2D::Filter::Nearest);
+			if (mBackgroundTexture) {
+				mBackground->setTexture(*mBackgroundTexture, true);
+			}
+		 }
+		 \endcode
+
+		 \sa load()
+
+		 \since v0.7.0
+		*/
+		_NODISCARD LoadAwaiter loadAsync(const std::string& filename, Texture2D::Filter filter = Texture2D::Filter::Linear, Texture2D::Wrap wrap = Texture2D::Wrap::ClampToEdge,
+		                                 Texture2D::InternalFormat internalFormat = Texture2D::InternalFormat::Native, bool scanAlpha = true, bool mipmap = false) const;
+#endif // AEON_COROUTINES
+		/*!
+		 \brief Updates a region of the \a texture by staging the \a data in the pixel unpack buffer instead of uploading it from client memory.
+		 \details The data is copied into the persistently-mapped ring and OpenGL sources the texels from it asynchronously, the client memory may therefore be modified immediately afterwards.
+		 It's suited to the textures updated every frame (video frames or minimaps for example), the data that doesn't fit within a region of the ring being uploaded directly.
+		 \note This method must be called from the thread owning OpenGL's context.
+
+		 \param[in] texture The texture to update
+		 \param[in] offsetX The horizontal texel offset to place the new data
+		 \param[in] offsetY The vertical texel offset to place the new data
+		 \param[in] width The width of the subimage
+		 \param[in] height The height of the subimage
+		 \param[in] data The tightly-packed pixel data, in the texture's internal format
+
+		 \return True if the texture was updated successfully, false otherwise
+
+		 \par Example:
+		 \code
+		 // Upload the decoded video frame without stalling the driver
+		 ae::TextureLoader::getInstance().stream(*videoTexture, 0, 0, frameWidth, frameHeight, frameData);
+		 \endcode
+
+		 \sa ae::Texture2D::update()
+
+		 \since v0.7.0
+		*/
+		bool stream(Texture2D& texture, unsigned int offsetX, unsigned int offsetY, unsigned int width, unsigned int height, const void* data);
+		/*!
+		 \brief Uploads the decoded images into their textures (in the order in which they were requested) until the upload budget is spent.
+		 \details The texels are staged into a persistently-mapped pixel unpack buffer, at least one image is uploaded per call.
+		 The ring's region is then fenced if texels were staged since the previous call.\n
+		 The images uploaded by the upload context are instead handed over to their textures once the GPU has completed their upload.\n
+		 The images of the textures that were destroyed in the meantime are discarded.
+		 \note This method is automatically called by the ae::Application at the beginning of each iteration of its game loop.
+
+		 \sa load(), reload(), setUploadBudget()
+
+		 \since v0.7.0
+		*/
+		void update();
+		/*!
+		 \brief Waits for the images still being decoded, disables the upload context and deletes the pixel unpack buffer, the pending textures keep their placeholder.
+		 \note This method is automatically called by the ae::Application once the window is closed.
+
+		 \since v0.7.0
+		*/
+		void destroy();
+		/*!
+		 \brief Sets the time that may be spent uploading the decoded images during each call to update().
+		 \details The budget is 2 milliseconds by default.
+
+		 \param[in] budget The ae::Time that may be spent per frame
+
+		 \sa getUploadBudget()
+
+		 \since v0.7.0
+		*/
+		void setUploadBudget(const Time& budget) noexcept;
+		/*!
+		 \brief Retrieves the time that may be spent uploading the decoded images per frame.
+
+		 \return The ae::Time that may be spent during each call to update()
+
+		 \sa setUploadBudget()
+
+		 \since v0.7.0
+		*/
+		_NODISCARD const Time& getUploadBudget() const noexcept;
+		/*!
+		 \brief Retrieves the number of textures whose image has yet to be uploaded.
+
+		 \return The number of textures still being decoded or waiting to be uploaded
+
+		 \since v0.7.0
+		*/
+		_NODISCARD size_t getPendingCount() const noexcept;
+		/*!
+		 \brief Enables or disables the upload context, used to upload the decoded images off the main thread.
+		 \details The upload context is a hidden context sharing the active window's OpenGL objects, owned by a dedicated upload thread.
+		 The decoded images are uploaded by the upload thread into new textures as soon as they're decoded, the main thread only handing them over to their textures once a fence signals that the GPU has completed their upload.
+		 The images requested before the upload context is enabled are still uploaded by update(), and the images left to the upload thread are uploaded by update() once the upload context is disabled.\n
+		 It's disabled by default.
+		 \note This method must be called from the main thread, after the ae::Application's window was created.
+
+		 \param[in] flag True to upload the images on the upload thread, false to upload them on the main thread
+
+		 \return True if the upload context is enabled as requested, false if it couldn't be created
+
+		 \par Example:
+		 \code
+		 ae::TextureLoader& loader = ae::TextureLoader::getInstance();
+		 if (!loader.enableUploadContext(true)) {
+			// The images will be uploaded by the main thread
+		 }
+		 \endcode
+
+		 \sa isUploadContextEnabled(), update()
+
+		 \since v0.7.0
+		*/
+		bool enableUploadContext(bool flag);
+		/*!
+		 \brief Checks whether the decoded images are uploaded by the upload context.
+
+		 \return True if the upload context is enabled, false otherwise
+
+		 \sa enableUploadContext()
+
+		 \since v0.7.0
+		*/
+		_NODISCARD bool isUploadContextEnabled() const noexcept;
+
+		// Public static method(s)
+		/*!
+		 \brief Retrieves the single instance of the ae::TextureLoader.
+
+		 \return The single instance of the ae::TextureLoader
+
+		 \since v0.7.0
+		*/
+		_NODISCARD static TextureLoader& getInstance();
+	private:
+		// Private struct(s)
+		/*!
+		 \brief The internal struct representing a texture whose image is being loaded.
+		*/
+		struct Request
+		{
+			std::weak_ptr<Texture2D>   texture;   //!< The texture that will receive the image
+			std::vector<uint8_t>       file;      //!< The contents of the image's file read in by an I/O thread
+			Texture2D::Image           image;     //!< The image decoded by the worker thread
+			Callback                   callback;  //!< The function called once the image has been uploaded
+			std::atomic<bool>          decoded;   //!< Whether the worker thread has finished decoding the image
+			bool                       scanAlpha; //!< Whether the decoded texels will be scanned
+			bool                       mipmap;    //!< Whether the mip chain will be generated once the image is uploaded
+			Texture2D::Filter          filter;    //!< The filter of the texture, applied to the texture uploaded by the upload context
+			Texture2D::Wrap            wrap;      //!< The wrapping mode of the texture, applied to the texture uploaded by the upload context
+			bool                       offscreen; //!< Whether the image is uploaded by the upload context
+			std::atomic<bool>          uploaded;  //!< Whether the upload thread has finished uploading the image
+			std::unique_ptr<Texture2D> staged;    //!< The texture uploaded by the upload context, handed over to the requested texture
+			void*                      fence;     //!< The fence placed after the upload context's upload, nullptr if the upload failed
+		};
+
+	private:
+		// Private constructor(s)
+		/*!
+		 \brief Default constructor.
+		 \details The ae::JobSystem is started beforehand so that it outlives the ae::TextureLoader.
+
+		 \since v0.7.0
+		*/
+		TextureLoader();
+	private:
+		// Private method(s)
+		/*!
+		 \brief Uploads the \a request's image into its texture, staging the texels in the pixel unpack buffer if they fit.
+		 \details The texels were decoded with a one-byte row alignment.
+
+		 \param[in] request The request whose image has been decoded
+
+		 \since v0.7.0
+		*/
+		void upload(Request& request);
+		/*!
+		 \brief Uploads the \a request's image into a new texture on the upload thread and fences the upload.
+		 \details The images are uploaded directly from the client memory as the pixel ring belongs to the main thread.
+
+		 \param[in] request The request whose image has been decoded
+
+		 \since v0.7.0
+		*/
+		void uploadOffscreen(Request& request);
+		/*!
+		 \brief Hands the texture uploaded by the upload context over to the \a request's texture, if the GPU has completed its upload.
+
+		 \param[in] request The request whose image has been uploaded by the upload thread
+
+		 \return True if the request was completed, false if its upload is still in progress
+
+		 \since v0.7.0
+		*/
+		bool adopt(Request& request);
+		/*!
+		 \brief Copies the \a data into the pixel ring's current region, moving on to the next region if the current one is full.
+
+		 \param[in] data The data to copy
+		 \param[in] size The size of the \a data in bytes
+		 \param[out] offset The offset of the copy within the pixel unpack buffer
+
+		 \return True if the data was staged, false if it doesn't fit within a region
+
+		 \since v0.7.0
+		*/
+		bool stage(const void* data, size_t size, int& offset);
+		/*!
+		 \brief Registers a request for the \a texture's image and decodes it on a worker thread.
+
+		 \param[in] texture The texture that will receive the image
+		 \param[in] filename The string containing the filepath of the image
+		 \param[in] internalFormat The ae::Texture::InternalFormat of the image data
+		 \param[in] callback The function called once the image has been uploaded
+		 \param[in] scanAlpha Whether the decoded texels will be scanned
+		 \param[in] mipmap Whether the mip chain will be generated once the image is uploaded
+
+		 \sa load(), reload()
+
+		 \since v0.7.0
+		*/
+		void enqueue(const std::shared_ptr<Texture2D>& texture, const std::string& filename, Texture2D::InternalFormat internalFormat, Callback callback, bool scanAlpha, bool mipmap);
+		/*!
+		 \brief Waits for the decoding jobs that are in flight to complete.
+
+		 \since v0.7.0
+		*/
+		void waitForJobs();
+		/*!
+		 \brief Makes the upload context current and uploads the requests that are queued until the upload thread is stopped.
+
+		 \since v0.7.0
+		*/
+		void runUploadThread();
+		/*!
+		 \brief Stops the upload thread and destroys the upload context, the requests left to it being uploaded by update() instead.
+
+		 \since v0.7.0
+		*/
+		void stopUploadThread();
+
+	private:
+		// Private member(s)
+		std::vector<std::unique_ptr<Request>> mRequests;        //!< The textures being loaded in the order in which they were requested
+		std::unique_ptr<Buffer>               mPixelBuffer;     //!< The pixel unpack buffer through which the texels are uploaded
+		RingBuffer                            mPixelRing;       //!< The persistently-mapped ring used to stream the texels (created upon the first upload)
+		JobSystem::Job*                       mBatchJob;        //!< The parent of the decoding jobs in flight, nullptr if there are none
+		Time                                  mBudget;          //!< The time that may be spent uploading images per frame
+		bool                                  mStaged;          //!< Whether texels were staged in the pixel ring since its last lock
+		GLFWwindow*                           mUploadContext;   //!< The hidden window owning the upload context, nullptr if it's disabled
+		std::thread                           mUploadThread;    //!< The thread owning the upload context
+		std::deque<Request*>                  mUploadQueue;     //!< The decoded requests waiting to be uploaded by the upload thread
+		std::mutex                            mUploadMutex;     //!< The mutex protecting the upload queue
+		std::condition_variable               mUploadCondition; //!< The condition on which the upload thread waits for decoded requests
+		bool                                  mUploadExit;      //!< Whether the upload thread was requested to stop
+	};
+}
+#endif // Aeon_Graphics_TextureLoader_H_
+
+/*!
+ \class ae::TextureLoader
+ \ingroup graphics
+
+ The ae::TextureLoader singleton class loads textures without stalling the
+ application: the textures are handed out immediately with a white texel as
+ their placeholder, their files are read in by the I/O threads of
+ ae::FileSystem::readAsync(), their images are decoded by the ae::JobSystem's
+ worker threads, and the decoded texels are uploaded through a pixel unpack
+ buffer at the beginning of the following frames within a per-frame time budget.
+
+ The uploads may also be moved off the main thread with the upload context,
+ a hidden context sharing the window's objects: the upload thread uploads
+ each image into a new texture as soon as it's decoded and places a fence
+ after it, the main thread handing the texture over once it's signaled.
+
+ Usage example:
+ \code
+ ae::TextureLoader& loader = ae::TextureLoader::getInstance();
+ for (const std::string& filename : filenames) {
+	mTextures.push_back(loader.load(filename));
+ }
+ ...
+ if (loader.getPendingCount() == 0) {
+	// Every texture has been loaded
+ }
+ \endcode
+
+ \author Filippos Gleglakos
+ \version v0.7.0
+ \date 2021.07.12
+ \copyright MIT License
+*/
\ No newline at end of file
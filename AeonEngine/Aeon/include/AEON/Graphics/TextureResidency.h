@@ -0,0 +1,219 @@
+// MIT License
+// 
+// Copyright(c) 2019-2021 Filippos Gleglakos
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+
+#ifndef Aeon_Graphics_TextureResidency_H_
+#define Aeon_Graphics_TextureResidency_H_
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include <AEON/Config.h>
+#include <AEON/Graphics/Texture2D.h>
+
+namespace ae
+{
+	/*!
+	 \brief Singleton class used to keep the textures loaded from files within a video memory budget.
+	*/
+	class AEON_API TextureResidency
+	{
+	public:
+		// Public constructor(s)
+		/*!
+		 \brief Deleted copy constructor.
+
+		 \since v0.7.0
+		*/
+		TextureResidency(const TextureResidency&) = delete;
+		/*!
+		 \brief Deleted move constructor.
+
+		 \since v0.7.0
+		*/
+		TextureResidency(TextureResidency&&) = delete;
+	public:
+		// Public operator(s)
+		/*!
+		 \brief Deleted assignment operator.
+
+		 \since v0.7.0
+		*/
+		TextureResidency& operator=(const TextureResidency&) = delete;
+		/*!
+		 \brief Deleted move assignment operator.
+
+		 \since v0.7.0
+		*/
+		TextureResidency& operator=(TextureResidency&&) = delete;
+	public:
+		// Public method(s)
+		/*!
+		 \brief Places the \a texture under the residency budget's management.
+		 \details The texture may then be evicted to a low-resolution placeholder once it hasn't been used for a few frames, and is streamed back in through the ae::TextureLoader when it's used again.
+		 \note Only the textures loaded from a file can be tracked as their image has to be reloaded.
+
+		 \param[in] texture The texture to track, which is no longer tracked once it's destroyed
+
+		 \par Example:
+		 \code
+		 ae::TextureResidency& residency = ae::TextureResidency::getInstance();
+		 residency.setBudget(256 * 1024 * 1024);
+		 residency.track(ae::TextureLoader::getInstance().load("Textures/Maps/forest.png"));
+		 \endcode
+
+		 \sa setBudget()
+
+		 \since v0.7.0
+		*/
+		void track(const std::shared_ptr<Texture2D>& texture);
+		/*!
+		 \brief Advances the frame and keeps the tracked textures within the budget.
+		 \details The evicted textures that were used during the previous frame are streamed back in, then the least recently used textures are evicted until the budget is respected.
+		 The textures used during the last few frames are never evicted.
+		 \note This method is automatically called by the ae::Application at the beginning of each iteration of its game loop.
+
+		 \sa track(), setBudget()
+
+		 \since v0.7.0
+		*/
+		void update();
+		/*!
+		 \brief Stops tracking every texture.
+		 \note This method is automatically called by the ae::Application once the window is closed.
+
+		 \since v0.7.0
+		*/
+		void destroy();
+		/*!
+		 \brief Sets the video memory that the tracked textures may occupy.
+		 \details The budget is 512 MiB by default, a budget of 0 disables the evictions.
+
+		 \param[in] bytes The budget in bytes
+
+		 \sa getBudget(), getResidentSize()
+
+		 \since v0.7.0
+		*/
+		void setBudget(size_t bytes) noexcept;
+		/*!
+		 \brief Retrieves the video memory that the tracked textures may occupy.
+
+		 \return The budget in bytes
+
+		 \sa setBudget()
+
+		 \since v0.7.0
+		*/
+		_NODISCARD size_t getBudget() const noexcept;
+		/*!
+		 \brief Retrieves the estimated video memory occupied by the tracked textures that aren't evicted.
+		 \details The estimation is updated by update().
+
+		 \return The size in bytes of the resident textures
+
+		 \sa getBudget()
+
+		 \since v0.7.0
+		*/
+		_NODISCARD size_t getResidentSize() const noexcept;
+		/*!
+		 \brief Retrieves the index of the current frame, which is recorded by the textures bound.
+
+		 \return The index of the current frame
+
+		 \sa ae::Texture::markUsed()
+
+		 \since v0.7.0
+		*/
+		_NODISCARD uint64_t getFrame() const noexcept;
+
+		// Public static method(s)
+		/*!
+		 \brief Retrieves the single instance of the ae::TextureResidency.
+
+		 \return The single instance of the ae::TextureResidency
+
+		 \since v0.7.0
+		*/
+		_NODISCARD static TextureResidency& getInstance();
+	private:
+		// Private struct(s)
+		/*!
+		 \brief The internal struct representing a tracked texture.
+		*/
+		struct Entry
+		{
+			std::weak_ptr<Texture2D> texture;   //!< The tracked texture
+			size_t                   size;      //!< The estimated size in bytes of the texture's full storage
+			bool                     mipmap;    //!< Whether the texture's mip chain is generated when it's streamed back in
+			bool                     streaming; //!< Whether the texture's image is being reloaded
+		};
+
+	private:
+		// Private constructor(s)
+		/*!
+		 \brief Default constructor.
+
+		 \since v0.7.0
+		*/
+		TextureResidency();
+
+	private:
+		// Private member(s)
+		std::vector<Entry> mEntries;      //!< The tracked textures
+		size_t             mBudget;       //!< The video memory that the tracked textures may occupy
+		size_t             mResidentSize; //!< The estimated video memory occupied by the resident textures
+		uint64_t           mFrame;        //!< The index of the current frame
+	};
+}
+#endif // Aeon_Graphics_TextureResidency_H_
+
+/*!
+ \class ae::TextureResidency
+ \ingroup graphics
+
+ The ae::TextureResidency singleton class keeps the textures loaded from
+ files within a video memory budget for the scenes in which only a fraction
+ of the textures is visible at once. Each texture records the frame during
+ which it was last bound; once the budget is exceeded, the least recently
+ used textures are evicted to a low-resolution placeholder, and the evicted
+ textures that are bound again are reloaded asynchronously through the
+ ae::TextureLoader.
+
+ Usage example:
+ \code
+ ae::TextureResidency& residency = ae::TextureResidency::getInstance();
+ residency.setBudget(256 * 1024 * 1024);
+ for (const std::string& filename : filenames) {
+	mTextures.push_back(ae::TextureLoader::getInstance().load(filename));
+	residency.track(mTextures.back());
+ }
+ \endcode
+
+ \author Filippos Gleglakos
+ \version v0.7.0
+ \date 2021.07.14
+ \copyright MIT License
+*/
\ No newline at end of file
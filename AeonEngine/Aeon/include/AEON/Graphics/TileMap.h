@@ -0,0 +1,328 @@
+// MIT License
+// 
+// Copyright(c) 2019-2021 Filippos Gleglakos
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#ifndef Aeon_Graphics_TileMap_H_
+#define Aeon_Graphics_TileMap_H_
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include <AEON/Graphics/Actor2D.h>
+#include <AEON/Graphics/Color.h>
+#include <AEON/Graphics/Texture2D.h>
+#include <AEON/Math/AABoxCollider.h>
+
+namespace ae
+{
+	// Forward declaration(s)
+	class IndexBuffer;
+	class Shader;
+	class VertexArray;
+
+	/*!
+	 \brief The class representing a grid of tiles taken from a tileset, rendered from static vertex buffers split into chunks.
+	*/
+	class _NODISCARD AEON_API TileMap : public Actor2D
+	{
+	public:
+		// Public static member(s)
+		static const uint32_t EmptyTile; //!< The tile index of the cells that don't display any tile
+
+	public:
+		// Public constructor(s)
+		/*!
+		 \brief Constructs the ae::TileMap by providing its tileset, the size of a tile and the number of tiles along each axis.
+		 \details Every cell starts out empty. The tiles of the tileset are indexed in row-major order, starting from its top-left tile.
+		 \note No OpenGL calls are issued, the chunks' vertex buffers are created once they're first visible.
+
+		 \param[in] tileset The ae::Texture2D containing the tiles
+		 \param[in] tileSize The size of a tile in pixels, both within the tileset and within the map
+		 \param[in] mapSize The number of tiles along the X and Y axes
+		 \param[in] layerCount The number of layers of tiles drawn on top of one another, 1 by default
+
+		 \par Example:
+		 \code
+		 auto map = std::make_unique<ae::TileMap>(tileset, ae::Vector2u(16, 16), ae::Vector2u(512, 512), 2);
+		 map->setTiles(groundTiles.data(), 0);
+		 map->setTile(10, 4, 37, 1);
+		 \endcode
+
+		 \since v0.7.0
+		*/
+		TileMap(const Texture2D& tileset, const Vector2u& tileSize, const Vector2u& mapSize, unsigned int layerCount = 1);
+		/*!
+		 \brief Deleted copy constructor.
+
+		 \since v0.7.0
+		*/
+		TileMap(const TileMap&) = delete;
+		/*!
+		 \brief Move constructor.
+
+		 \param[in] rvalue The ae::TileMap that will be moved
+
+		 \since v0.7.0
+		*/
+		TileMap(TileMap&& rvalue) noexcept = default;
+	public:
+		// Public operator(s)
+		/*!
+		 \brief Deleted assignment operator.
+
+		 \since v0.7.0
+		*/
+		TileMap& operator=(const TileMap&) = delete;
+		/*!
+		 \brief Move assignment operator.
+
+		 \param[in] rvalue The ae::TileMap that will be moved
+
+		 \return The caller ae::TileMap
+
+		 \since v0.7.0
+		*/
+		TileMap& operator=(TileMap&& rvalue) noexcept = default;
+	public:
+		// Public method(s)
+		/*!
+		 \brief Sets the tile displayed by a cell of one of the layers.
+		 \details Only the chunk containing the cell is rebuilt, and only if the tile has changed.
+
+		 \param[in] x The column of the cell, situated within the range [0 ; getMapSize().x - 1]
+		 \param[in] y The row of the cell, situated within the range [0 ; getMapSize().y - 1]
+		 \param[in] tile The index of the tile within the tileset, ae::TileMap::EmptyTile to clear the cell
+		 \param[in] layer The index of the layer, 0 by default
+
+		 \sa setTiles(), getTile()
+
+		 \since v0.7.0
+		*/
+		void setTile(unsigned int x, unsigned int y, uint32_t tile, unsigned int layer = 0);
+		/*!
+		 \brief Sets the tiles of every cell of one of the layers at once.
+
+		 \param[in] tiles The getMapSize().x * getMapSize().y tile indices of the layer in row-major order
+		 \param[in] layer The index of the layer, 0 by default
+
+		 \sa setTile()
+
+		 \since v0.7.0
+		*/
+		void setTiles(const uint32_t* tiles, unsigned int layer = 0);
+		/*!
+		 \brief Sets the color by which all the tiles are multiplied.
+
+		 \param[in] color The ae::Color multiplying the tileset's texels
+
+		 \sa getColor()
+
+		 \since v0.7.0
+		*/
+		void setColor(const Color& color) noexcept;
+		/*!
+		 \brief Retrieves the tile displayed by a cell of one of the layers.
+
+		 \param[in] x The column of the cell
+		 \param[in] y The row of the cell
+		 \param[in] layer The index of the layer, 0 by default
+
+		 \return The index of the tile within the tileset, ae::TileMap::EmptyTile if the cell is empty or outside of the map
+
+		 \sa setTile()
+
+		 \since v0.7.0
+		*/
+		_NODISCARD uint32_t getTile(unsigned int x, unsigned int y, unsigned int layer = 0) const noexcept;
+		/*!
+		 \brief Retrieves the number of tiles along the X and Y axes.
+
+		 \return The size of the map in tiles
+
+		 \since v0.7.0
+		*/
+		_NODISCARD const Vector2u& getMapSize() const noexcept;
+		/*!
+		 \brief Retrieves the size of a tile in pixels.
+
+		 \return The size of a tile
+
+		 \since v0.7.0
+		*/
+		_NODISCARD const Vector2u& getTileSize() const noexcept;
+		/*!
+		 \brief Retrieves the number of layers of tiles.
+
+		 \return The number of layers
+
+		 \since v0.7.0
+		*/
+		_NODISCARD unsigned int getLayerCount() const noexcept;
+		/*!
+		 \brief Retrieves the color by which all the tiles are multiplied.
+
+		 \return The ae::Color of the tiles
+
+		 \sa setColor()
+
+		 \since v0.7.0
+		*/
+		_NODISCARD const Color& getColor() const noexcept;
+		/*!
+		 \brief Retrieves the ae::TileMap's tileset.
+
+		 \return The ae::Texture2D containing the tiles
+
+		 \since v0.7.0
+		*/
+		_NODISCARD const Texture2D& getTileset() const noexcept;
+
+		// Public virtual method(s)
+		/*!
+		 \brief Retrieves the ae::TileMap's model bounding box.
+
+		 \return An ae::Box2f containing the whole grid of tiles
+
+		 \since v0.7.0
+		*/
+		_NODISCARD virtual Box2f getModelBounds() const override final;
+	private:
+		// Private struct(s)
+		/*!
+		 \brief The internal struct representing a vertex of a tile (16 bytes).
+		*/
+		struct TileVertex
+		{
+			Vector2f position; //!< The vertex's position within the map
+			Vector2f uv;       //!< The vertex's texture coordinates within the tileset
+		};
+		/*!
+		 \brief The struct holding the GPU-side state of a chunk shared with the drawcalls handed to the renderer.
+		 \details The drawcalls keep the state alive so that it outlives the map until they've been executed.
+		*/
+		struct Chunk
+		{
+			std::shared_ptr<VertexArray> vao;       //!< The VAO referencing the chunk's static VBO, created by the first drawcall
+			std::vector<TileVertex>      vertices;  //!< The rebuilt vertices waiting to be uploaded, released once uploaded
+			unsigned int                 quadCount; //!< The number of tiles stored in the VBO
+			bool                         upload;    //!< Whether the vertices need to be uploaded to the VBO
+		};
+
+	private:
+		// Private method(s)
+		/*!
+		 \brief Marks the chunk containing the cell provided as needing to be rebuilt.
+
+		 \param[in] x The column of the cell
+		 \param[in] y The row of the cell
+
+		 \since v0.7.0
+		*/
+		void invalidateChunk(unsigned int x, unsigned int y) noexcept;
+		/*!
+		 \brief Rebuilds the vertices of every layer's tiles within the chunk whose index is provided.
+
+		 \param[in] index The index of the chunk (in row-major order)
+
+		 \since v0.7.0
+		*/
+		void rebuildChunk(size_t index);
+
+		// Private virtual method(s)
+		/*!
+		 \brief Rebuilds the vertices of the chunks whose tiles have changed.
+
+		 \param[in] dt The time difference between the previous frame and the current frame
+
+		 \sa renderSelf()
+
+		 \since v0.7.0
+		*/
+		virtual void updateSelf(const Time& dt) override final;
+		/*!
+		 \brief Checks whether one of the chunks needs to be rebuilt.
+
+		 \return True if a chunk is waiting to be rebuilt, false if the ae::TileMap may sleep
+
+		 \since v0.7.0
+		*/
+		_NODISCARD virtual bool hasPendingUpdate() const override final;
+		/*!
+		 \brief Hands the drawcalls of the visible chunks over to the active renderer.
+		 \details The chunks outside of the camera's view are culled, the rebuilt ones are uploaded by the drawcall on the OpenGL context's thread.
+
+		 \param[in] states The ae::RenderStates defining the OpenGL state
+
+		 \sa updateSelf()
+
+		 \since v0.7.0
+		*/
+		virtual void renderSelf(const RenderStates& states) const override final;
+
+	private:
+		// Private member(s)
+		std::shared_ptr<std::vector<Chunk>>  mChunks;      //!< The GPU-side state of the chunks in row-major order
+		std::vector<uint32_t>                mTiles;       //!< The tile indices of every layer, one layer after the other in row-major order
+		std::vector<uint8_t>                 mDirtyChunks; //!< Whether each chunk needs to be rebuilt
+		Vector2u                             mTileSize;    //!< The size of a tile in pixels
+		Vector2u                             mMapSize;     //!< The number of tiles along the X and Y axes
+		Vector2u                             mChunkCount;  //!< The number of chunks along the X and Y axes
+		Color                                mColor;       //!< The color multiplying the tiles
+		const Texture2D*                     mTileset;     //!< The texture containing the tiles
+		unsigned int                         mLayerCount;  //!< The number of layers of tiles
+		bool                                 mRebuild;     //!< Whether at least one chunk needs to be rebuilt
+		mutable std::shared_ptr<Shader>      mShader;      //!< The tile map shader, resolved from the ae::GLResourceFactory when the map is first rendered
+		mutable std::shared_ptr<IndexBuffer> mQuadListIBO; //!< The IBO shared by the chunks' VAOs, resolved along with the shader
+	};
+}
+#endif // Aeon_Graphics_TileMap_H_
+
+/*!
+ \class ae::TileMap
+ \ingroup graphics
+
+ The ae::TileMap class renders a large grid of tiles as a single ae::Actor2D.
+ The grid is split into chunks of 32x32 cells, each one stored in its own
+ GL_STATIC_DRAW vertex buffer holding the tiles of every layer. A chunk is
+ only rebuilt when one of its cells changes and uploaded once it's visible.
+
+ When the map is rendered, the chunks outside of the camera's view are culled
+ and each visible chunk is drawn with a single drawcall from the engine's
+ static quad list index buffer. As with the ae::ParticleEmitter2D, the
+ drawcalls are handed to ae::Renderer2D::drawToActive() and are executed after
+ the rest of the scene's geometry. The layers share the map's depth and are
+ drawn in order, without occluding the lower ones.
+
+ \par Example:
+ \code
+ auto map = std::make_unique<ae::TileMap>(tileset, ae::Vector2u(16, 16), ae::Vector2u(1024, 1024), 2);
+ map->setTiles(groundLayer.data(), 0);
+ map->setTiles(decorationLayer.data(), 1);
+ scene->attachChild(std::move(map));
+ \endcode
+
+ \author Filippos Gleglakos
+ \version v0.7.0
+ \date 2021.08.02
+ \copyright MIT License
+*/
\ No newline at end of file
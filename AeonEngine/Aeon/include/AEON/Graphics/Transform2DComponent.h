@@ -25,7 +25,7 @@
 
 #include <climits>
 
-#include <AEON/Math/Matrix.h>
+#include <AEON/Math/Transform2D.h>
 #include <AEON/Graphics/Component.h>
 
 namespace ae
@@ -325,9 +325,10 @@ namespace ae
 		/*!
 		 \brief Retrieves the model transform.
 		 \details The model transform is used to convert from model/local coordinates to world coordinates.
-		 \note The model transform may be updated (if necessary) before being retrieved.
+		 \note The model transform may be updated (if necessary) before being retrieved. It's stored as a compact ae::Transform2D which should only
+		 be converted to an ae::Matrix4f (see ae::Transform2D::toMatrix4f()) when it's uploaded.
 
-		 \return The ae::Matrix4f containing the model transform
+		 \return The ae::Transform2D containing the model transform
 
 		 \par Example:
 		 \code
@@ -335,20 +336,20 @@ namespace ae
 		 ae::Transform2DComponent* spriteTransform = sprite->getComponent<ae::Transform2DComponent>();
 		 spriteTransform->setPosition(50.f, 25.f);                        // transform will be computed when requested
 
-		 const ae::Matrix4f& transform = spriteTransform->getTransform(); // transform computed
+		 const ae::Transform2D& transform = spriteTransform->getTransform(); // transform computed
 		 \endcode
 
 		 \sa getInverseTransform()
 
 		 \since v0.7.0
 		*/
-		const Matrix4f& getTransform();
+		const Transform2D& getTransform();
 		/*!
 		 \brief Retrieves the inverse model transform.
 		 \details The inverse model transform is used to convert from world coordinates back to model/local coordinates.
-		 \note The inverse model transform may be updated (if necessary) before being retrieved.
+		 \note The inverse model transform may be updated (if necessary) before being retrieved, it's computed in closed form.
 
-		 \return The ae::Matrix4f containing the inverse model transform
+		 \return The ae::Transform2D containing the inverse model transform
 
 		 \par Example:
 		 \code
@@ -356,14 +357,58 @@ namespace ae
 		 ae::Transform2DComponent* spriteTransform = sprite->getComponent<ae::Transform2DComponent>();
 		 spriteTransform->setPosition(50.f, 25.f);                                  // inverse transform will be computed when requested
 
-		 const ae::Matrix4f& invTransform = spriteTransform->getInverseTransform(); // inverse transform computed
+		 const ae::Transform2D& invTransform = spriteTransform->getInverseTransform(); // inverse transform computed
 		 \endcode
 
 		 \sa getTransform()
 
 		 \since v0.7.0
 		*/
-		const Matrix4f& getInverseTransform();
+		const Transform2D& getInverseTransform();
+		/*!
+		 \brief Saves the current position, rotation, scale and origin as the previous ones.
+		 \details The previous properties are the ones from which the interpolated transform starts, this method should therefore be called at the
+		 beginning of each fixed-step update before the properties are modified. It may also be called after teleporting the entity so that it isn't interpolated.
+
+		 \par Example:
+		 \code
+		 bool GameState::update(const ae::Time& dt)
+		 {
+			mPlayerTransform->savePrevious();
+			mPlayerTransform->move(mVelocity * static_cast<float>(dt.asSeconds()));
+			return true;
+		 }
+		 \endcode
+
+		 \sa getInterpolatedTransform()
+
+		 \since v0.7.0
+		*/
+		void savePrevious() noexcept;
+		/*!
+		 \brief Computes the model transform interpolated between the previous properties and the current ones.
+		 \details The interpolation factor provided to ae::State::draw(float) should be used so that entities simulated at a low fixed rate
+		 move smoothly regardless of the framerate.
+
+		 \param[in] interpolation The interpolation factor between 0 (previous properties) and 1 (current properties)
+
+		 \return The ae::Transform2D containing the interpolated model transform
+
+		 \par Example:
+		 \code
+		 bool GameState::draw(float interpolation)
+		 {
+			ae::RenderStates states;
+			states.transform = mPlayerTransform->getInterpolatedTransform(interpolation).toMatrix4f();
+			...
+		 }
+		 \endcode
+
+		 \sa savePrevious(), getTransform()
+
+		 \since v0.7.0
+		*/
+		_NODISCARD Transform2D getInterpolatedTransform(float interpolation) const;
 		/*!
 		 \brief Retrieves the position in world-space.
 
@@ -439,14 +484,18 @@ namespace ae
 
 	private:
 		// Private member(s)
-		Matrix4f mTransform;         //!< The model transform
-		Matrix4f mInvTransform;      //!< The inverse model transform
-		Vector3f mPosition;          //!< The position in world-space
-		Vector2f mScale;             //!< The scale factors
-		Vector2f mOrigin;            //!< The local origin or the anchor point
-		float    mRotation;          //!< The rotation in radians along the Z axis
-		bool     mTransformDirty;    //!< Whether the model transform needs to be updated
-		bool     mInvTransformDirty; //!< Whether the inverse model transform needs to be updated
+		Transform2D mTransform;         //!< The model transform
+		Transform2D mInvTransform;      //!< The inverse model transform
+		Vector3f    mPosition;          //!< The position in world-space
+		Vector2f    mScale;             //!< The scale factors
+		Vector2f    mOrigin;            //!< The local origin or the anchor point
+		float       mRotation;          //!< The rotation in radians along the Z axis
+		Vector3f    mPrevPosition;      //!< The position saved at the beginning of the last fixed-step update
+		Vector2f    mPrevScale;         //!< The scale factors saved at the beginning of the last fixed-step update
+		Vector2f    mPrevOrigin;        //!< The local origin saved at the beginning of the last fixed-step update
+		float       mPrevRotation;      //!< The rotation saved at the beginning of the last fixed-step update
+		bool        mTransformDirty;    //!< Whether the model transform needs to be updated
+		bool        mInvTransformDirty; //!< Whether the inverse model transform needs to be updated
 	};
 }
 #endif // Aeon_Graphics_Transform2DComponent_H_
@@ -0,0 +1,229 @@
+// MIT License
+// 
+// Copyright(c) 2019-2021 Filippos Gleglakos
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#ifndef Aeon_Graphics_TransformHierarchy2D_H_
+#define Aeon_Graphics_TransformHierarchy2D_H_
+
+#include <vector>
+#include <cstdint>
+
+#include <AEON/Config.h>
+#include <AEON/Math/Transform2D.h>
+
+namespace ae
+{
+	// Forward declaration(s)
+	class Actor2D;
+
+	/*!
+	 \brief Class storing the transforms of entire ae::Actor2D scene graphs in contiguous arrays to update their global transforms in linear passes.
+	 \details The nodes are laid out breadth-first so that every parent precedes its children and the nodes of a same depth are contiguous.
+	*/
+	class _NODISCARD AEON_API TransformHierarchy2D
+	{
+	public:
+		// Public constructor(s)
+		/*!
+		 \brief Default constructor.
+
+		 \since v0.7.0
+		*/
+		TransformHierarchy2D();
+		/*!
+		 \brief Deleted copy constructor.
+
+		 \since v0.7.0
+		*/
+		TransformHierarchy2D(const TransformHierarchy2D&) = delete;
+		/*!
+		 \brief Deleted move constructor.
+
+		 \since v0.7.0
+		*/
+		TransformHierarchy2D(TransformHierarchy2D&&) = delete;
+		/*!
+		 \brief Destructor.
+		 \details The registered ae::Actor2D nodes are detached from the hierarchy.
+
+		 \since v0.7.0
+		*/
+		~TransformHierarchy2D();
+	public:
+		// Public operator(s)
+		/*!
+		 \brief Deleted assignment operator.
+
+		 \since v0.7.0
+		*/
+		TransformHierarchy2D& operator=(const TransformHierarchy2D&) = delete;
+		/*!
+		 \brief Deleted move assignment operator.
+
+		 \since v0.7.0
+		*/
+		TransformHierarchy2D& operator=(TransformHierarchy2D&&) = delete;
+	public:
+		// Public method(s)
+		/*!
+		 \brief Registers the scene graph of the \a root node provided.
+		 \details The nodes attached to or detached from the scene graph afterwards are taken into account during the next update.
+
+		 \param[in] root The root ae::Actor2D of the scene graph
+
+		 \par Example:
+		 \code
+		 ae::TransformHierarchy2D hierarchy;
+		 hierarchy.addRoot(*mSceneRoot);
+		 ...
+
+		 // Inside the state's update() method, once the actors have moved
+		 mSceneRoot->update(dt);
+		 hierarchy.update(4);
+		 \endcode
+
+		 \sa removeRoot(), update()
+
+		 \since v0.7.0
+		*/
+		void addRoot(Actor2D& root);
+		/*!
+		 \brief Unregisters the scene graph of the \a root node provided.
+
+		 \param[in] root The root ae::Actor2D of a registered scene graph
+
+		 \sa addRoot()
+
+		 \since v0.7.0
+		*/
+		void removeRoot(Actor2D& root);
+		/*!
+		 \brief Recomputes the global transforms of the nodes whose transform or parent's transform was modified.
+		 \details The modified model transforms are gathered, then the global transforms are computed depth by depth in a single linear pass over contiguous arrays.
+		 The nodes of a same depth are independent, so large depths are split across several threads. The results are finally converted and stored in the nodes' cached global transforms.
+
+		 \param[in] threadCount The maximum number of threads (including the calling one) to use, 1 by default, 0 to use all of the ae::JobSystem's threads
+
+		 \sa addRoot()
+
+		 \since v0.7.0
+		*/
+		void update(unsigned int threadCount = 1);
+		/*!
+		 \brief Retrieves the global transform of the node situated at the \a index provided, computed during the last update.
+
+		 \param[in] index The index of the node in the hierarchy
+
+		 \return The node's global transform
+
+		 \since v0.7.0
+		*/
+		_NODISCARD const Transform2D& getWorldTransform(size_t index) const noexcept;
+		/*!
+		 \brief Retrieves the number of nodes stored in the hierarchy.
+
+		 \return The number of nodes registered during the last update
+
+		 \since v0.7.0
+		*/
+		_NODISCARD size_t getNodeCount() const noexcept;
+
+	private:
+		// Private method(s)
+		/*!
+		 \brief Lays out the registered scene graphs breadth-first in the arrays.
+
+		 \since v0.7.0
+		*/
+		void rebuild();
+		/*!
+		 \brief Computes the global transforms of the nodes situated in the range provided.
+		 \note The global transforms of the nodes' parents must already be up to date.
+
+		 \param[in] begin The index of the first node
+		 \param[in] end The index past the last node
+
+		 \since v0.7.0
+		*/
+		void updateRange(size_t begin, size_t end) noexcept;
+		/*!
+		 \brief Flags the model transform of the node situated at the \a index provided as modified.
+		 \note This method is called by the ae::Actor2D nodes.
+
+		 \param[in] index The index of the node in the hierarchy
+
+		 \since v0.7.0
+		*/
+		void markDirty(size_t index) noexcept;
+		/*!
+		 \brief Flags the scene graphs as restructured so that they're laid out again during the next update.
+		 \note This method is called by the ae::Actor2D nodes when children are attached or detached.
+
+		 \since v0.7.0
+		*/
+		void markStructureDirty() noexcept;
+		/*!
+		 \brief Removes the node situated at the \a index provided as it's being destroyed.
+		 \note This method is called by the ae::Actor2D nodes' destructor.
+
+		 \param[in] actor The ae::Actor2D being destroyed
+		 \param[in] index The index of the node in the hierarchy
+
+		 \since v0.7.0
+		*/
+		void detachActor(Actor2D& actor, size_t index) noexcept;
+
+	private:
+		// Private member(s)
+		std::vector<Actor2D*>    mRoots;           //!< The roots of the registered scene graphs
+		std::vector<Actor2D*>    mActors;          //!< The nodes laid out breadth-first
+		std::vector<int64_t>     mParents;         //!< The index of each node's parent, -1 for the roots
+		std::vector<size_t>      mDepthOffsets;    //!< The index of the first node of each depth (followed by the node count)
+		std::vector<Transform2D> mLocalTransforms; //!< The compact model transforms of the nodes
+		std::vector<Transform2D> mWorldTransforms; //!< The compact global transforms of the nodes
+		std::vector<uint8_t>     mLocalDirty;      //!< Whether each node's model transform was modified
+		std::vector<uint8_t>     mWorldDirty;      //!< Whether each node's global transform needs to be recomputed
+		bool                     mStructureDirty;  //!< Whether the scene graphs need to be laid out again
+		bool                     mAnyDirty;        //!< Whether at least one model transform was modified
+
+		// Friend class(es)
+		friend class Actor2D;
+	};
+}
+#endif // Aeon_Graphics_TransformHierarchy2D_H_
+
+/*!
+ \class ae::TransformHierarchy2D
+ \ingroup graphics
+
+ The ae::TransformHierarchy2D class is an optional data-oriented transform system for
+ large ae::Actor2D scene graphs. The model and global transforms of the registered
+ nodes are stored in contiguous arrays sorted parent-before-child, so that updating
+ them is a linear, cache-friendly and parallelisable pass instead of a pointer chase
+ through the scene graph. Each registered ae::Actor2D holds its index in the hierarchy
+ and flags it when its transform is modified.
+
+ \author Filippos Gleglakos
+ \version v0.7.0
+ \date 2021.07.05
+ \copyright MIT License
+*/
\ No newline at end of file
@@ -27,6 +27,7 @@
 
 #include <AEON/Config.h>
 #include <AEON/Math/Matrix.h>
+#include <AEON/Math/Transform2D.h>
 #include <AEON/Math/AABoxCollider.h>
 
 namespace ae
@@ -344,6 +345,18 @@ namespace ae
 		 \since v0.6.0
 		*/
 		const Matrix4f& getTransform();
+		/*!
+		 \brief Retrieves the ae::Transformable2D's model transform as a compact 2D affine transform.
+		 \details The compact transform is cheaper to combine and invert than the equivalent ae::Matrix4f.
+		 \note The model transform may be updated (if necessary) before being retrieved.
+
+		 \return The ae::Transform2D containing the ae::Transformable2D's model transform
+
+		 \sa getTransform()
+
+		 \since v0.7.0
+		*/
+		const Transform2D& getAffineTransform();
 		/*!
 		 \brief Retrieves the ae::Transformable2D's inverse model transform.
 		 \details The inverse model transform is used to convert the ae::Transformable2D from world coordinates back to local coordinates.
@@ -432,6 +445,27 @@ namespace ae
 		 \since v0.4.0
 		*/
 		_NODISCARD const Vector2f& getOrigin() const noexcept;
+		/*!
+		 \brief Retrieves the origin flags from which the ae::Transformable2D's local origin is resolved.
+
+		 \return The ae::Transformable2D::OriginFlag paired together, (OriginFlag::Left | OriginFlag::Top) by default
+
+		 \sa setOriginFlags()
+
+		 \since v0.7.0
+		*/
+		_NODISCARD uint32_t getOriginFlags() const noexcept;
+		/*!
+		 \brief Retrieves the version of the ae::Transformable2D's model transform.
+		 \details The version is incremented every time the model transform is recomputed, allowing dependent data to be refreshed only when it changes.
+
+		 \return The model transform's version
+
+		 \sa getTransform()
+
+		 \since v0.7.0
+		*/
+		_NODISCARD uint32_t getTransformVersion() const noexcept;
 		/*!
 		 \brief Retrieves the ae::Transformable2D's world bounding box.
 		 \details The world bounding box is the model bounding box transformed by the ae::Transformable2D's model transform.
@@ -527,18 +561,40 @@ namespace ae
 		 \since v0.5.0
 		*/
 		virtual void correctProperties();
+		/*!
+		 \brief Notifies the derived class that the ae::Transformable2D's model transform was modified by one of the setters.
+		 \details Derived classes can override this method to invalidate data that depends on the model transform.
+
+		 \sa getTransform()
+
+		 \since v0.7.0
+		*/
+		virtual void onTransformModified() noexcept;
+
+	private:
+		// Private method(s)
+		/*!
+		 \brief Flags the model transform for recomputation and notifies the derived class.
+
+		 \sa onTransformModified()
+
+		 \since v0.7.0
+		*/
+		void invalidateTransform() noexcept;
 
 	private:
 		// Private member(s)
-		Matrix4f mTransform;          //!< The model transform
-		Matrix4f mInvTransform;       //!< The inverse model transform
-		Vector3f mPosition;           //!< The position in world-space
-		Vector2f mScale;              //!< The scale factors
-		Vector2f mOrigin;             //!< The local origin or the anchor point
-		float    mRotation;           //!< The rotation in degrees along the Z axis
-		uint32_t mOriginFlags;        //!< The origin flags indicating the origin point
-		bool     mUpdateTransform;    //!< Whether the model transform needs to be updated
-		bool     mUpdateInvTransform; //!< Whether the inverse model transform needs to be updated
+		Transform2D mAffineTransform;    //!< The model transform as a compact affine transform
+		Matrix4f    mTransform;          //!< The model transform converted for the renderers
+		Matrix4f    mInvTransform;       //!< The inverse model transform
+		Vector3f    mPosition;           //!< The position in world-space
+		Vector2f    mScale;              //!< The scale factors
+		Vector2f    mOrigin;             //!< The local origin or the anchor point
+		float       mRotation;           //!< The rotation in degrees along the Z axis
+		uint32_t    mOriginFlags;        //!< The origin flags indicating the origin point
+		uint32_t    mTransformVersion;   //!< The number of times the model transform was recomputed
+		bool        mUpdateTransform;    //!< Whether the model transform needs to be updated
+		bool        mUpdateInvTransform; //!< Whether the inverse model transform needs to be updated
 	};
 }
 #endif // Aeon_Graphics_Transformable2D_H_
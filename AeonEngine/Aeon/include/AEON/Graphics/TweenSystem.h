@@ -0,0 +1,440 @@
+// MIT License
+// 
+// Copyright(c) 2019-2021 Filippos Gleglakos
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef Aeon_Graphics_TweenSystem_H_
+#define Aeon_Graphics_TweenSystem_H_
+
+#include <cstdint>
+#include <vector>
+
+#include <AEON/Config.h>
+#include <AEON/Graphics/Color.h>
+#include <AEON/Math/Vector.h>
+#include <AEON/System/Time.h>
+
+namespace ae
+{
+	// Forward declaration(s)
+	class Actor2D;
+	class Shape;
+
+	/*!
+	 \brief The enumeration of the easing functions applied to the progress of a tween.
+	*/
+	enum class Easing : uint8_t
+	{
+		Linear,     //!< Constant speed
+		QuadIn,     //!< Quadratic acceleration from zero speed
+		QuadOut,    //!< Quadratic deceleration to zero speed
+		QuadInOut,  //!< Quadratic acceleration until halfway, then deceleration
+		CubicIn,    //!< Cubic acceleration from zero speed
+		CubicOut,   //!< Cubic deceleration to zero speed
+		CubicInOut, //!< Cubic acceleration until halfway, then deceleration
+		SineIn,     //!< Sinusoidal acceleration from zero speed
+		SineOut,    //!< Sinusoidal deceleration to zero speed
+		SineInOut,  //!< Sinusoidal acceleration until halfway, then deceleration
+		BackOut,    //!< Deceleration overshooting the end value before settling on it
+		BounceOut   //!< Deceleration bouncing on the end value
+	};
+
+	/*!
+	 \brief Singleton class animating the positions, the scales, the rotations and the colors of ae::Actor2D nodes, driven by the application's fixed time step.
+	 \details The active tweens are stored in contiguous arrays and evaluated in a single pass per fixed step.
+	*/
+	class AEON_API TweenSystem
+	{
+	public:
+		// Public typedef(s)
+		using TweenId = uint64_t; //!< The identifier of an active tween (0 is never assigned)
+
+	public:
+		// Public constructor(s)
+		/*!
+		 \brief Deleted copy constructor.
+
+		 \since v0.7.0
+		*/
+		TweenSystem(const TweenSystem&) = delete;
+		/*!
+		 \brief Deleted move constructor.
+
+		 \since v0.7.0
+		*/
+		TweenSystem(TweenSystem&&) = delete;
+	public:
+		// Public operator(s)
+		/*!
+		 \brief Deleted assignment operator.
+
+		 \since v0.7.0
+		*/
+		TweenSystem& operator=(const TweenSystem&) = delete;
+		/*!
+		 \brief Deleted move assignment operator.
+
+		 \since v0.7.0
+		*/
+		TweenSystem& operator=(TweenSystem&&) = delete;
+	public:
+		// Public method(s)
+		/*!
+		 \brief Animates the \a actor's position from its current position to the \a position provided.
+		 \details The start value is the actor's position once the \a delay has elapsed, its Z position (its depth) is left untouched.
+		 \note Several tweens animating the same property of the same actor overwrite each other, the previous tween should be cancelled beforehand.
+
+		 \param[in] actor The ae::Actor2D to animate
+		 \param[in] position The ae::Vector2f position at the end of the tween
+		 \param[in] duration The ae::Time taken to reach the end position
+		 \param[in] easing The ae::Easing applied to the tween's progress, ae::Easing::Linear by default
+		 \param[in] delay The ae::Time to wait before starting, ae::Time::Zero by default
+
+		 \return The identifier of the tween, used to cancel it
+
+		 \par Example:
+		 \code
+		 // Slide the menu's panel in from the left
+		 ae::TweenSystem::getInstance().tweenPosition(*panel, ae::Vector2f(100.f, 200.f), ae::Time::milliseconds(400), ae::Easing::CubicOut);
+		 \endcode
+
+		 \sa tweenScale(), tweenRotation(), cancel()
+
+		 \since v0.7.0
+		*/
+		TweenId tweenPosition(Actor2D& actor, const Vector2f& position, const Time& duration, Easing easing = Easing::Linear, const Time& delay = Time::Zero);
+		/*!
+		 \brief Animates the \a actor's scale factors from their current values to the \a scale provided.
+		 \note Several tweens animating the same property of the same actor overwrite each other, the previous tween should be cancelled beforehand.
+
+		 \param[in] actor The ae::Actor2D to animate
+		 \param[in] scale The ae::Vector2f scale factors at the end of the tween
+		 \param[in] duration The ae::Time taken to reach the end scale factors
+		 \param[in] easing The ae::Easing applied to the tween's progress, ae::Easing::Linear by default
+		 \param[in] delay The ae::Time to wait before starting, ae::Time::Zero by default
+
+		 \return The identifier of the tween, used to cancel it
+
+		 \sa tweenPosition(), tweenRotation(), cancel()
+
+		 \since v0.7.0
+		*/
+		TweenId tweenScale(Actor2D& actor, const Vector2f& scale, const Time& duration, Easing easing = Easing::Linear, const Time& delay = Time::Zero);
+		/*!
+		 \brief Animates the \a actor's rotation from its current angle to the \a angle provided.
+		 \details The angle is interpolated as is, so an end angle past a full turn spins the actor several times.
+		 \note Several tweens animating the same property of the same actor overwrite each other, the previous tween should be cancelled beforehand.
+
+		 \param[in] actor The ae::Actor2D to animate
+		 \param[in] angle The angle in radians at the end of the tween
+		 \param[in] duration The ae::Time taken to reach the end angle
+		 \param[in] easing The ae::Easing applied to the tween's progress, ae::Easing::Linear by default
+		 \param[in] delay The ae::Time to wait before starting, ae::Time::Zero by default
+
+		 \return The identifier of the tween, used to cancel it
+
+		 \sa tweenPosition(), tweenScale(), cancel()
+
+		 \since v0.7.0
+		*/
+		TweenId tweenRotation(Actor2D& actor, float angle, const Time& duration, Easing easing = Easing::Linear, const Time& delay = Time::Zero);
+		/*!
+		 \brief Animates the \a actor's color from its current color to the \a color provided.
+		 \details The color animated is the color of an ae::Sprite, an ae::Text or an ae::TileMap, and the fill color of the shapes.
+		 The components are interpolated in their normalized form and rounded to the nearest integer when written back.
+		 \note Several tweens animating the same property of the same actor overwrite each other, the previous tween should be cancelled beforehand.
+
+		 \param[in] actor The ae::Actor2D to animate
+		 \param[in] color The ae::Color at the end of the tween
+		 \param[in] duration The ae::Time taken to reach the end color
+		 \param[in] easing The ae::Easing applied to the tween's progress, ae::Easing::Linear by default
+		 \param[in] delay The ae::Time to wait before starting, ae::Time::Zero by default
+
+		 \return The identifier of the tween used to cancel it, 0 if the actor has no color
+
+		 \par Example:
+		 \code
+		 // Fade the sprite out after a second
+		 ae::TweenSystem::getInstance().tweenColor(*sprite, ae::Color(255, 255, 255, 0), ae::Time::seconds(0.5), ae::Easing::QuadIn, ae::Time::seconds(1.0));
+		 \endcode
+
+		 \sa tweenOutlineColor(), cancel()
+
+		 \since v0.7.0
+		*/
+		TweenId tweenColor(Actor2D& actor, const Color& color, const Time& duration, Easing easing = Easing::Linear, const Time& delay = Time::Zero);
+		/*!
+		 \brief Animates the \a shape's outline color from its current color to the \a color provided.
+		 \note Several tweens animating the same property of the same actor overwrite each other, the previous tween should be cancelled beforehand.
+
+		 \param[in] shape The ae::Shape to animate
+		 \param[in] color The ae::Color of the outline at the end of the tween
+		 \param[in] duration The ae::Time taken to reach the end color
+		 \param[in] easing The ae::Easing applied to the tween's progress, ae::Easing::Linear by default
+		 \param[in] delay The ae::Time to wait before starting, ae::Time::Zero by default
+
+		 \return The identifier of the tween, used to cancel it
+
+		 \sa tweenColor(), cancel()
+
+		 \since v0.7.0
+		*/
+		TweenId tweenOutlineColor(Shape& shape, const Color& color, const Time& duration, Easing easing = Easing::Linear, const Time& delay = Time::Zero);
+		/*!
+		 \brief Cancels the tween of the identifier provided, leaving its property at its current value.
+		 \details Cancelling a tween is done in constant time.
+
+		 \param[in] tween The identifier returned by one of the tweening methods
+
+		 \return True if the tween was cancelled, false if it had already completed or been cancelled
+
+		 \sa cancelAll()
+
+		 \since v0.7.0
+		*/
+		bool cancel(TweenId tween);
+		/*!
+		 \brief Cancels all the tweens animating the \a actor provided.
+		 \note This method is automatically called by the destructor of the animated ae::Actor2D nodes.
+
+		 \param[in] actor The animated ae::Actor2D
+
+		 \sa cancel(), clear()
+
+		 \since v0.7.0
+		*/
+		void cancelAll(const Actor2D& actor);
+		/*!
+		 \brief Cancels all the active tweens.
+
+		 \sa cancelAll()
+
+		 \since v0.7.0
+		*/
+		void clear();
+		/*!
+		 \brief Advances every active tween by \a dt and writes their values back to the animated actors.
+		 \details The tweens' progress is advanced and the start values of the tweens whose delay elapsed are captured, then the eased values
+		 are computed in a single pass over the contiguous arrays (split across several threads for large numbers of tweens). The values are
+		 finally written back to the actors and the completed tweens are removed.
+		 \note This method is automatically called by the ae::Application during each fixed step, before the states are updated.
+
+		 \param[in] dt The time elapsed since the last update
+
+		 \since v0.7.0
+		*/
+		void update(const Time& dt);
+		/*!
+		 \brief Sets the maximum number of threads (including the calling one) used to evaluate the tweens.
+		 \details The worker threads are only used once there are enough tweens to amortize their synchronization.
+
+		 \param[in] threadCount The maximum number of threads, 1 by default, 0 to use all of the ae::JobSystem's threads
+
+		 \since v0.7.0
+		*/
+		void setThreadCount(unsigned int threadCount) noexcept;
+		/*!
+		 \brief Checks whether the tween of the identifier provided is still active.
+
+		 \param[in] tween The identifier returned by one of the tweening methods
+
+		 \return True if the tween is delayed or running, false if it has completed or been cancelled
+
+		 \since v0.7.0
+		*/
+		_NODISCARD bool isActive(TweenId tween) const noexcept;
+		/*!
+		 \brief Retrieves the number of active tweens.
+
+		 \return The number of active tweens
+
+		 \since v0.7.0
+		*/
+		_NODISCARD size_t getTweenCount() const noexcept;
+
+		// Public static method(s)
+		/*!
+		 \brief Evaluates the \a easing function provided at the progress \a t.
+
+		 \param[in] easing The ae::Easing to evaluate
+		 \param[in] t The progress, between 0 and 1
+
+		 \return The eased progress, 0 at the start and 1 at the end
+
+		 \since v0.7.0
+		*/
+		_NODISCARD static float ease(Easing easing, float t) noexcept;
+		/*!
+		 \brief Retrieves the single instance of the ae::TweenSystem.
+
+		 \return The single instance of the ae::TweenSystem
+
+		 \since v0.7.0
+		*/
+		_NODISCARD static TweenSystem& getInstance();
+
+	private:
+		// Private enum(s)
+		/*!
+		 \brief The enumeration of the animated properties, the kind of actor owning the color being resolved once upon the tween's creation.
+		*/
+		enum class Property : uint8_t
+		{
+			Position,
+			Scale,
+			Rotation,
+			SpriteColor,
+			TextColor,
+			TileMapColor,
+			FillColor,
+			OutlineColor
+		};
+
+	private:
+		// Private constructor(s)
+		/*!
+		 \brief Default constructor.
+
+		 \since v0.7.0
+		*/
+		TweenSystem();
+
+	private:
+		// Private method(s)
+		/*!
+		 \brief Adds a tween to the arrays and assigns it an identifier.
+
+		 \param[in] actor The ae::Actor2D to animate
+		 \param[in] property The animated property
+		 \param[in] end The ae::Vector4f value at the end of the tween
+		 \param[in] duration The ae::Time taken to reach the end value
+		 \param[in] easing The ae::Easing applied to the tween's progress
+		 \param[in] delay The ae::Time to wait before starting
+
+		 \return The identifier of the tween
+
+		 \since v0.7.0
+		*/
+		TweenId add(Actor2D& actor, Property property, const Vector4f& end, const Time& duration, Easing easing, const Time& delay);
+		/*!
+		 \brief Removes the tween situated at the \a index provided by moving the last tween in its place, which invalidates its identifier.
+
+		 \param[in] index The index of the tween in the arrays
+
+		 \since v0.7.0
+		*/
+		void remove(size_t index) noexcept;
+		/*!
+		 \brief Computes the eased values of the tweens situated in the range provided.
+
+		 \param[in] begin The index of the first tween
+		 \param[in] end The index past the last tween
+
+		 \since v0.7.0
+		*/
+		void evaluateRange(size_t begin, size_t end) noexcept;
+
+		// Private static method(s)
+		/*!
+		 \brief Retrieves the current value of the \a actor's \a property.
+
+		 \param[in] actor The animated ae::Actor2D
+		 \param[in] property The animated property
+
+		 \return The ae::Vector4f value of the property
+
+		 \since v0.7.0
+		*/
+		_NODISCARD static Vector4f readValue(const Actor2D& actor, Property property) noexcept;
+		/*!
+		 \brief Writes the \a value provided to the \a actor's \a property through its setter.
+
+		 \param[in] actor The animated ae::Actor2D
+		 \param[in] property The animated property
+		 \param[in] value The ae::Vector4f value of the property
+
+		 \since v0.7.0
+		*/
+		static void writeValue(Actor2D& actor, Property property, const Vector4f& value) noexcept;
+
+	private:
+		// Private static member(s)
+		static constexpr uint32_t INVALID_INDEX = static_cast<uint32_t>(-1); //!< The index denoting a released identifier
+
+		// Private member(s)
+		std::vector<Actor2D*> mTargets;           //!< The animated actors
+		std::vector<Property> mProperties;        //!< The animated properties
+		std::vector<Easing>   mEasings;           //!< The easing functions applied to the progress
+		std::vector<Vector4f> mStarts;            //!< The values at the start of the tweens, captured once their delay elapses
+		std::vector<Vector4f> mEnds;              //!< The values at the end of the tweens
+		std::vector<Vector4f> mValues;            //!< The values computed during the last evaluation
+		std::vector<float>    mElapsed;           //!< The time elapsed since the tweens' start in seconds, negative while delayed
+		std::vector<float>    mInverseDurations;  //!< The inverse of the tweens' duration in seconds
+		std::vector<uint8_t>  mStarted;           //!< Whether the tweens' start value was captured
+		std::vector<TweenId>  mIds;               //!< The identifiers of the tweens
+		std::vector<uint32_t> mIndices;           //!< The index of each identifier's tween in the arrays, indexed by the lower half of the identifiers
+		std::vector<uint32_t> mGenerations;       //!< The generation of each identifier, incremented whenever it's released
+		std::vector<uint32_t> mFreeHandles;       //!< The lower halves of the released identifiers
+		unsigned int          mThreadCount;       //!< The maximum number of threads used to evaluate the tweens
+	};
+}
+#endif // Aeon_Graphics_TweenSystem_H_
+
+/*!
+ \class ae::TweenSystem
+ \ingroup graphics
+
+ The ae::TweenSystem singleton class animates the positions, the scales, the
+ rotations and the colors of ae::Actor2D nodes from their current values to
+ end values over a duration, in place of overriding the actors' updateSelf()
+ method to call their setters every fixed step.
+
+ The active tweens are stored in contiguous arrays (the target, the property,
+ the start, end and current values, the progress and the easing function),
+ the values being stored as four-component vectors whatever the property so
+ that they're interpolated with SIMD arithmetic in a single linear pass. The
+ pass is split across the ae::JobSystem's threads once there are enough
+ tweens, and the values are then written back through the actors' setters in
+ bulk. The actors registered in an ae::TransformHierarchy2D flag their model
+ transforms as modified, so the animated transforms are gathered into the
+ hierarchy's arrays during its next update.
+
+ The tweens are updated by the ae::Application during each fixed step, before
+ the states are updated. The system isn't thread-safe: the tweens should be
+ created and cancelled by the thread updating the states. The tweens of an
+ actor are cancelled upon its destruction.
+
+ Usage example:
+ \code
+ ae::TweenSystem& tweens = ae::TweenSystem::getInstance();
+
+ // Pop the button in and make it pulse
+ button->setScale(0.f, 0.f);
+ tweens.tweenScale(*button, ae::Vector2f(1.f, 1.f), ae::Time::milliseconds(300), ae::Easing::BackOut);
+ mPulse = tweens.tweenColor(*button, ae::Color::Yellow, ae::Time::seconds(1.0), ae::Easing::SineInOut, ae::Time::milliseconds(300));
+ ...
+ tweens.cancel(mPulse);
+ \endcode
+
+ \author Filippos Gleglakos
+ \version v0.7.0
+ \date 2021.07.05
+ \copyright MIT License
+*/
\ No newline at end of file
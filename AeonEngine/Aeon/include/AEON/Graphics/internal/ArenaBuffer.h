@@ -0,0 +1,261 @@
+// MIT License
+// 
+// Copyright(c) 2019-2021 Filippos Gleglakos
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef Aeon_Graphics_ArenaBuffer_H_
+#define Aeon_Graphics_ArenaBuffer_H_
+
+#include <cstdint>
+#include <deque>
+#include <vector>
+
+#include <yvals_core.h>
+
+#include <AEON/Config.h>
+
+namespace ae
+{
+	// Forward declaration(s)
+	class Buffer;
+
+	/*!
+	 \brief The class used to keep long-lived data resident on the GPU in ranges suballocated from a persistently-mapped ae::Buffer.
+	 \note This class is considered to be internal but may still be used by the API user.
+	*/
+	class _NODISCARD AEON_API ArenaBuffer
+	{
+	public:
+		// Public constructor(s)
+		/*!
+		 \brief Default constructor.
+		 \details The ae::ArenaBuffer can't be used until the create() method is called.
+
+		 \since v0.7.0
+		*/
+		ArenaBuffer() noexcept;
+		/*!
+		 \brief Deleted copy constructor.
+
+		 \since v0.7.0
+		*/
+		ArenaBuffer(const ArenaBuffer&) = delete;
+		/*!
+		 \brief Move constructor.
+
+		 \param[in] rvalue The ae::ArenaBuffer that will be moved
+
+		 \since v0.7.0
+		*/
+		ArenaBuffer(ArenaBuffer&& rvalue) noexcept;
+	public:
+		// Public operator(s)
+		/*!
+		 \brief Deleted assignment operator.
+
+		 \since v0.7.0
+		*/
+		ArenaBuffer& operator=(const ArenaBuffer&) = delete;
+		/*!
+		 \brief Move assignment operator.
+
+		 \param[in] rvalue The ae::ArenaBuffer that will be moved
+
+		 \return The caller ae::ArenaBuffer
+
+		 \since v0.7.0
+		*/
+		ArenaBuffer& operator=(ArenaBuffer&& rvalue) noexcept;
+	public:
+		// Public method(s)
+		/*!
+		 \brief Creates the \a buffer's immutable data store of \a size bytes and maps it persistently.
+		 \note The \a buffer must not possess a data store prior to calling this method.
+
+		 \param[in] buffer The ae::Buffer (usually attached to an ae::VertexArray) whose data store will be created
+		 \param[in] size The size of the data store, measured in bytes
+
+		 \return True if the data store was created and mapped, false otherwise
+
+		 \par Example:
+		 \code
+		 ae::ArenaBuffer vertexArena;
+		 vertexArena.create(*arenaVBO, sizeof(ae::Vertex2D) * 262144);
+		 \endcode
+
+		 \sa allocate(), release()
+
+		 \since v0.7.0
+		*/
+		bool create(const Buffer& buffer, int size);
+		/*!
+		 \brief Reserves a range of \a size bytes and retrieves a pointer to write into it.
+		 \details The range remains reserved until it's released, the memory retrieved is directly visible to OpenGL.\n
+		 The range is searched for from the start of the data store (first-fit), the ranges released being merged with their free neighbours.
+
+		 \param[in] size The number of bytes to reserve
+		 \param[out] offset The offset in bytes from the start of the data store at which the range reserved begins
+		 \param[in] alignment The alignment in bytes of the \a offset (which needn't be a power of two), 1 by default
+
+		 \return A pointer to the memory reserved, or nullptr if no free range is large enough
+
+		 \par Example:
+		 \code
+		 int offset = 0;
+		 void* vertexData = vertexArena.allocate(sizeof(ae::Vertex2D) * vertices.size(), offset, sizeof(ae::Vertex2D));
+		 if (vertexData) {
+			std::memcpy(vertexData, vertices.data(), sizeof(ae::Vertex2D) * vertices.size());
+		 }
+		 \endcode
+
+		 \sa release()
+
+		 \since v0.7.0
+		*/
+		_NODISCARD void* allocate(int size, int& offset, int alignment = 1);
+		/*!
+		 \brief Releases a range previously reserved by allocate().
+		 \details The range can only be reserved again once OpenGL is done with the drawcalls issued until the next call to lock(),
+		 so it's safe to release a range that was drawn from during the current frame.
+
+		 \param[in] offset The offset of the range retrieved by allocate()
+		 \param[in] size The size of the range provided to allocate()
+
+		 \sa allocate(), lock()
+
+		 \since v0.7.0
+		*/
+		void release(int offset, int size);
+		/*!
+		 \brief Releases every range reserved.
+		 \details The ranges can only be reserved again once OpenGL is done with the drawcalls issued until the next call to lock().
+
+		 \sa release()
+
+		 \since v0.7.0
+		*/
+		void clear();
+		/*!
+		 \brief Fences the ranges released since the last call and reclaims the previously-fenced ranges that OpenGL is done with.
+		 \details The CPU never waits, the ranges whose fence hasn't yet been signaled are reclaimed during a later call.
+		 \note This method should be called once all the drawcalls of the frame have been issued.
+
+		 \sa release()
+
+		 \since v0.7.0
+		*/
+		void lock();
+		/*!
+		 \brief Deletes the fences that are still pending.
+		 \details The ae::Buffer's data store will be unmapped once the ae::Buffer is destroyed.
+
+		 \since v0.7.0
+		*/
+		void destroy();
+		/*!
+		 \brief Retrieves the number of bytes currently reserved or awaiting to be reclaimed.
+
+		 \return The number of bytes that can't be reserved
+
+		 \since v0.7.0
+		*/
+		_NODISCARD int getUsedSize() const noexcept;
+		/*!
+		 \brief Checks whether the ae::ArenaBuffer's data store has been created and mapped.
+
+		 \return True if the ae::ArenaBuffer can be used, false otherwise
+
+		 \since v0.7.0
+		*/
+		_NODISCARD bool isCreated() const noexcept;
+
+	private:
+		// Private struct(s)
+		/*!
+		 \brief The internal struct representing a range of the data store.
+		*/
+		struct Range {
+			int offset; //!< The offset of the range's first byte
+			int size;   //!< The number of bytes in the range
+		};
+		/*!
+		 \brief The internal struct representing the ranges released during a frame, awaiting for OpenGL to be done with them.
+		*/
+		struct RetiredRanges {
+			std::vector<Range> ranges; //!< The ranges released
+			void*              fence;  //!< The fence placed after the frame's last drawcall
+		};
+
+	private:
+		// Private method(s)
+		/*!
+		 \brief Returns a \a range to the list of free ranges, merging it with its free neighbours.
+
+		 \param[in] range The range that can be reserved again
+
+		 \since v0.7.0
+		*/
+		void reclaim(const Range& range);
+
+	private:
+		// Private member(s)
+		std::vector<Range>        mFreeRanges;     //!< The ranges that may be reserved, sorted by offset
+		std::vector<Range>        mReleasedRanges; //!< The ranges released since the last call to lock()
+		std::deque<RetiredRanges> mRetired;        //!< The ranges released during the previous frames, from the oldest frame
+		uint8_t*                  mData;           //!< The persistently-mapped data store
+		int                       mSize;           //!< The size of the data store, measured in bytes
+		int                       mUsedSize;       //!< The number of bytes reserved or awaiting to be reclaimed
+	};
+}
+#endif // Aeon_Graphics_ArenaBuffer_H_
+
+/*!
+ \class ae::ArenaBuffer
+ \ingroup graphics
+
+ The ae::ArenaBuffer class keeps data that rarely changes resident on the GPU.
+ Unlike the ae::RingBuffer whose regions are rewritten every frame, each
+ allocation is a range of the persistently-mapped data store which remains
+ valid until it's released, so the data doesn't need to be uploaded again as
+ long as it isn't modified. The ranges released are fenced and only reserved
+ again once OpenGL is done reading from them, so the CPU never overwrites data
+ still in use and never waits for OpenGL.
+
+ Usage example:
+ \code
+ ae::ArenaBuffer vertexArena;
+ vertexArena.create(*arenaVBO, sizeof(ae::Vertex2D) * 262144);
+ ...
+ // When the geometry is created or modified
+ vertexArena.release(offset, size);
+ void* vertexData = vertexArena.allocate(size, offset, sizeof(ae::Vertex2D));
+ std::memcpy(vertexData, vertices.data(), size);
+ ...
+ // Every frame
+ GLCall(glDrawArrays(GL_TRIANGLES, offset / sizeof(ae::Vertex2D), vertices.size()));
+ ...
+ vertexArena.lock();
+ \endcode
+
+ \author Filippos Gleglakos
+ \version v0.7.0
+ \date 2021.07.27
+ \copyright MIT License
+*/
\ No newline at end of file
@@ -187,7 +187,47 @@ namespace ae
 		 \since v0.4.0
 		*/
 		void unmap() const;
+		/*!
+		 \brief Creates an immutable data store for the ae::Buffer with the \a size in bytes specified and the optional \a data.
+		 \details Contrary to the derived classes' 'setData()' methods, the data store created can't be resized or recreated, but it may be mapped persistently.\n
+		 Available storage flags:
+		 \li GL_DYNAMIC_STORAGE_BIT - The data store's contents may be modified through calls to 'setSubData()'
+		 \li GL_MAP_READ_BIT        - The data store may be mapped for reading
+		 \li GL_MAP_WRITE_BIT       - The data store may be mapped for writing
+		 \li GL_MAP_PERSISTENT_BIT  - The data store may remain mapped while OpenGL is using it
+		 \li GL_MAP_COHERENT_BIT    - Writes to a persistent mapping are visible to OpenGL without an explicit flush
+		 \li GL_CLIENT_STORAGE_BIT  - Hints that the data store should be placed in client memory
+		 \note This method should only be called once per ae::Buffer.
+
+		 \param[in] size The size of the data store, measured in bytes
+		 \param[in] data An optional pointer to the data that will be placed in the data store
+		 \param[in] flags The combination of storage flags indicating the intended use of the data store
+
+		 \par Example:
+		 \code
+		 // Create a 1 MiB write-only data store which will remain mapped
+		 const GLbitfield FLAGS = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+		 ae::Buffer buffer(GL_ARRAY_BUFFER);
+		 buffer.setStorage(1024 * 1024, nullptr, FLAGS);
+
+		 // Map the entire data store once and write into it whenever necessary
+		 void* bufferData = buffer.mapRange(0, 1024 * 1024, FLAGS);
+		 \endcode
+
+		 \sa mapRange()
+
+		 \since v0.7.0
+		*/
+		void setStorage(int size, const void* data, uint32_t flags) const;
 		// Public virtual method(s)
+		/*!
+		 \brief Retrieves the size of the ae::Buffer's current data store.
+
+		 \return The size in bytes of the data store, 0 if none was created
+
+		 \since v0.7.0
+		*/
+		_NODISCARD virtual size_t getMemorySize() const noexcept override final;
 		/*!
 		 \brief Deletes the OpenGL handle to the ae::Buffer that was created.
 		 
@@ -238,7 +278,8 @@ namespace ae
 
 	protected:
 		// Protected member(s)
-		uint32_t mBindingTarget; //!< The binding target of the OpenGL buffer
+		uint32_t       mBindingTarget; //!< The binding target of the OpenGL buffer
+		mutable size_t mStorageSize;   //!< The size in bytes of the data store, updated by the (const) methods that create it
 	};
 }
 #endif // Aeon_Graphics_Buffer_H_
@@ -23,12 +23,19 @@
 #ifndef Aeon_Graphics_FontManager_H_
 #define Aeon_Graphics_FontManager_H_
 
+#include <string>
+#include <vector>
+#include <mutex>
+
 #include <yvals_core.h>
 
 #include <AEON/Config.h>
 
 namespace ae
 {
+	// Forward declaration(s)
+	class Font;
+
 	/*!
 	 \brief The singleton class responsible for the initialization of the FreeType library.
 	*/
@@ -86,6 +93,69 @@ namespace ae
 		 \since v0.5.0
 		*/
 		_NODISCARD void* getHandle() const noexcept;
+		/*!
+		 \brief Registers the \a font so that it's reloaded by reloadFonts() when its file is modified.
+		 \note Called by the ae::Font instances themselves when AEON_HOT_RELOAD is enabled.
+
+		 \param[in] font The ae::Font to register
+
+		 \sa unregisterFont(), reloadFonts()
+
+		 \since v0.7.0
+		*/
+		void registerFont(Font* font);
+		/*!
+		 \brief Unregisters the \a font registered with registerFont().
+
+		 \param[in] font The ae::Font to unregister
+
+		 \sa registerFont()
+
+		 \since v0.7.0
+		*/
+		void unregisterFont(Font* font);
+		/*!
+		 \brief Reloads the registered fonts that were loaded from the file provided.
+
+		 \param[in] filepath The normalized filepath of the modified file (see ae::FileWatcher::normalizePath())
+
+		 \return The number of fonts reloaded
+
+		 \sa registerFont()
+
+		 \since v0.7.0
+		*/
+		size_t reloadFonts(const std::string& filepath);
+		/*!
+		 \brief Inserts the glyphs rasterized by the worker threads into the atlases of their fonts.
+		 \note This method is automatically called by the ae::Application once per frame, on the thread owning the OpenGL context.
+
+		 \sa ae::Font::rasterizeAsync()
+
+		 \since v0.7.0
+		*/
+		void update();
+		/*!
+		 \brief Registers the \a font whose glyphs are being rasterized by the worker threads so that they're inserted by update().
+		 \note Called by ae::Font::rasterizeAsync(), the font is unregistered once all of its batches have been inserted.
+
+		 \param[in] font The ae::Font rasterizing glyphs asynchronously
+
+		 \sa update(), removeRasterizingFont()
+
+		 \since v0.7.0
+		*/
+		void addRasterizingFont(Font* font);
+		/*!
+		 \brief Unregisters the \a font registered with addRasterizingFont().
+
+		 \param[in] font The ae::Font to unregister
+
+		 \sa addRasterizingFont()
+
+		 \since v0.7.0
+		*/
+		void removeRasterizingFont(Font* font);
 
 		// Public static method(s)
 		/*!
@@ -113,7 +183,10 @@ namespace ae
 
 	private:
 		// Private member(s)
-		void* mLibrary; //!< The FreeType library pointer
+		void*              mLibrary;          //!< The FreeType library pointer
+		std::vector<Font*> mFonts;            //!< The fonts registered to be reloaded when their file is modified
+		std::mutex         mFontMutex;        //!< The mutex protecting the registered fonts
+		std::vector<Font*> mRasterizingFonts; //!< The fonts whose glyphs are being rasterized by the worker threads (only accessed by the thread owning the OpenGL context)
 	};
 }
 #endif // Aeon_Graphics_FontManager_H_
@@ -125,6 +198,13 @@ namespace ae
  The ae::FontManager singleton class is used to initialize the FreeType library
  which will be used to create the font faces.
 
+ It also keeps track of the fonts loaded so that they may be reloaded when their
+ file is modified (see AEON_HOT_RELOAD), and it inserts the glyphs rasterized
+ by the worker threads into their fonts once per frame.
+
+ The worker threads rasterize with their own FreeType library, the shared one
+ only being used by the fonts' faces.
+
  \author Filippos Gleglakos
  \version v0.5.0
  \date 2020.06.04
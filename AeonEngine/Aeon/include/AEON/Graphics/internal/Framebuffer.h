@@ -23,13 +23,14 @@
 #ifndef Aeon_Graphics_Framebuffer_H_
 #define Aeon_Graphics_Framebuffer_H_
 
+#include <vector>
+
+#include <AEON/Math/Vector.h>
 #include <AEON/Graphics/internal/GLResource.h>
+#include <AEON/Graphics/Texture.h>
 
 namespace ae
 {
-	// Forward declaration(s)
-	class Texture;
-
 	/*!
 	 \brief The class representing an OpenGL framebuffer object used for off-screen rendering.
 	 \note This class is considered to be internal but may still be used by the API user.
@@ -90,8 +91,55 @@ namespace ae
 		 \since v0.4.0
 		*/
 		void attachTexture(const Texture* const texture);
+		/*!
+		 \brief Attaches a multisampled renderbuffer that will serve as the storage for the rendering.
+		 \details The attachment type is based on the internal format provided, like attachTexture(). The renderbuffer is owned by the ae::Framebuffer.
+		 The multisampled contents are meant to be resolved into a single-sampled framebuffer with resolve().
+
+		 \param[in] size The dimensions of the renderbuffer
+		 \param[in] sampleCount The number of samples per pixel
+		 \param[in] format The ae::Texture::InternalFormat of the renderbuffer
+
+		 \sa resolve()
+
+		 \since v0.7.0
+		*/
+		void attachMultisampledStorage(const Vector2i& size, int sampleCount, Texture::InternalFormat format);
+		/*!
+		 \brief Indicates to OpenGL that the contents of the attachments requested are no longer needed.
+		 \details The invalidated contents are undefined afterwards, which saves the bandwidth needed to preserve them (notably on tiled and integrated GPUs).
+
+		 \param[in] color Whether the color attachments are invalidated
+		 \param[in] depthStencil Whether the depth and stencil attachments are invalidated
+
+		 \since v0.7.0
+		*/
+		void invalidate(bool color, bool depthStencil) const;
+		/*!
+		 \brief Resolves the first color attachment into the \a target framebuffer's.
+		 \details The multisampled contents are averaged into the target's single-sampled attachment with glBlitNamedFramebuffer().
+
+		 \param[in] target The ae::Framebuffer into which the contents will be resolved
+		 \param[in] size The dimensions of the region resolved
+
+		 \sa attachMultisampledStorage()
+
+		 \since v0.7.0
+		*/
+		void resolve(const Framebuffer& target, const Vector2i& size) const;
 
 		// Public virtual method(s)
+		/*!
+		 \brief Retrieves the size of the multisampled renderbuffers owned by the ae::Framebuffer.
+		 \details The attached textures aren't included as they're accounted for separately.
+
+		 \return The size in bytes of the renderbuffers' storage
+
+		 \sa attachMultisampledStorage()
+
+		 \since v0.7.0
+		*/
+		_NODISCARD virtual size_t getMemorySize() const noexcept override final;
 		/*!
 		 \brief Deletes the OpenGL handle to the ae::Framebuffer that was created.
 		 \details This method is called automatically when the ae::Framebuffer was created by the ae::GLResourceFactory instance.
@@ -116,7 +164,29 @@ namespace ae
 
 	private:
 		// Private member(s)
-		size_t mColorAttachmentCount; //!< The number of textures attached to a color buffer
+		// Private method(s)
+		/*!
+		 \brief Retrieves the attachment point of the next attachment of the internal format provided.
+
+		 \param[in] format The ae::Texture::InternalFormat of the attachment
+
+		 \return The OpenGL attachment point, the color attachment count being incremented for the color formats
+
+		 \since v0.7.0
+		*/
+		_NODISCARD unsigned int nextAttachmentPoint(Texture::InternalFormat format);
+		/*!
+		 \brief Sets the color attachments as the draw buffers and checks that the framebuffer is complete.
+
+		 \since v0.7.0
+		*/
+		void updateDrawBuffers() const;
+
+		// Private member(s)
+		std::vector<unsigned int> mAttachments;          //!< The attachment points in use
+		std::vector<unsigned int> mRenderbuffers;        //!< The multisampled renderbuffers owned by the framebuffer
+		size_t                    mRenderbufferSize;     //!< The size in bytes of the renderbuffers' storage
+		size_t                    mColorAttachmentCount; //!< The number of textures attached to a color buffer
 	};
 }
 #endif // Aeon_Graphics_Framebuffer_H_
@@ -23,14 +23,21 @@
 #ifndef Aeon_Graphics_GLCommon_H_
 #define Aeon_Graphics_GLCommon_H_
 
+#include <cstdint>
+
 #include <AEON/System/DebugLogger.h>
 
-#ifdef AEON_DEBUG
+// The synchronous error checks stall the pipeline after each call, so they're only compiled in if requested (the debug output reports the errors otherwise)
+#ifndef AEON_GL_CHECK_ERRORS
+	#define AEON_GL_CHECK_ERRORS 0
+#endif // AEON_GL_CHECK_ERRORS
+
+#if AEON_GL_CHECK_ERRORS
 	#define GLCall(x) x;\
 	                  ae::gl::checkError(#x);
 #else
 	#define GLCall(x) x;
-#endif // AEON_DEBUG
+#endif // AEON_GL_CHECK_ERRORS
 
 namespace ae
 {
@@ -48,13 +55,239 @@ namespace ae
 
 		 \par Example:
 		 \code
-		 // All OpenGL statements should be wrapped with the GLCall() macro (the macro is ignored in Release mode)
+		 // All OpenGL statements should be wrapped with the GLCall() macro (the check is only compiled in if AEON_GL_CHECK_ERRORS is defined to 1)
 		 GLCall(glCompileShader(vertexShader));
 		 \endcode
 
 		 \since v0.4.0
 		*/
 		void checkError(const char* statement);
+		/*!
+		 \brief Indicates whether the current OpenGL context was created with KHR_no_error, in which case checkError() does nothing.
+		 \details The errors are undefined in such a context, so the driver isn't queried for them.
+		 \note This function is automatically called by the ae::Application once the window is created, according to its ae::ContextSettings.
+
+		 \param[in] noError True if the context doesn't report errors, false otherwise
+
+		 \sa checkError(), ae::ContextSettings::setProfile()
+
+		 \since v0.7.0
+		*/
+		void setNoErrorContext(bool noError) noexcept;
+		/*!
+		 \brief Reports the messages of the OpenGL debug output (KHR_debug) to the ae::DebugLogger.
+		 \details The high-severity messages and the errors are logged as errors, the medium-severity ones as warnings and the low-severity ones as informational logs.
+		 The messages below the \a minimumSeverity are discarded by the driver, so they're never generated.\n
+		 The asynchronous mode lets the driver report the messages from its own threads without stalling the pipeline, the synchronous mode reports them
+		 during the faulting call so that a debugger's call stack points to it.
+		 \note This function is automatically called by the ae::Application once the window is created, if its ae::ContextSettings enable the debug output.
+
+		 \param[in] minimumSeverity The least severe messages reported (GL_DEBUG_SEVERITY_HIGH, _MEDIUM, _LOW or _NOTIFICATION), GL_DEBUG_SEVERITY_MEDIUM by default
+		 \param[in] synchronous Whether the messages are reported during the faulting call, false by default
+
+		 \return True if the debug output was enabled, false if the context doesn't support it
+
+		 \sa checkError(), ae::ContextSettings::setDebugOutputEnabled()
+
+		 \since v0.7.0
+		*/
+		bool enableDebugOutput(uint32_t minimumSeverity = 0x9147, bool synchronous = false);
+
+		// Struct(s)
+		/*!
+		 \brief Struct counting the state changes that were actually forwarded to OpenGL by the state cache.
+		 \details The counters are never reset, the number of state changes during a given period is given by the difference of two snapshots.
+		*/
+		struct StateCounters
+		{
+			unsigned int programChanges;     //!< The number of shader programs used
+			unsigned int textureChanges;     //!< The number of textures bound to a texture unit
+			unsigned int samplerChanges;     //!< The number of samplers bound to a texture unit
+			unsigned int vertexArrayChanges; //!< The number of VAOs bound
+			unsigned int blendChanges;       //!< The number of blending states (capability, equations and factors) set
+		};
+
+		// State cache
+		/*!
+		 \brief Retrieves the number of state changes forwarded to OpenGL by the state cache.
+
+		 \return The ae::gl::StateCounters containing the number of state changes since the application started
+
+		 \since v0.7.0
+		*/
+		_NODISCARD const StateCounters& getStateCounters() noexcept;
+		/*!
+		 \brief Sets the shader program used for the subsequent drawcalls, unless it's already in use.
+		 \note All of Aeon's shader program binds go through this function so that redundant binds are filtered out.
+
+		 \param[in] program The OpenGL identifier of the shader program, 0 to unbind the current one
+
+		 \sa getProgram()
+
+		 \since v0.7.0
+		*/
+		void useProgram(unsigned int program);
+		/*!
+		 \brief Retrieves the shader program currently in use from the state cache.
+
+		 \return The OpenGL identifier of the shader program in use, 0 if none is
+
+		 \sa useProgram()
+
+		 \since v0.7.0
+		*/
+		_NODISCARD unsigned int getProgram() noexcept;
+		/*!
+		 \brief Binds a texture to the texture \a unit provided, unless it's already bound to it.
+
+		 \param[in] unit The index of the texture unit
+		 \param[in] texture The OpenGL identifier of the texture, 0 to unbind the unit's current one
+
+		 \sa bindTextures()
+
+		 \since v0.7.0
+		*/
+		void bindTextureUnit(unsigned int unit, unsigned int texture);
+		/*!
+		 \brief Binds the \a textures provided to consecutive texture units, starting at the \a first unit.
+		 \details Only the units whose bound texture differs are rebound.
+
+		 \param[in] first The index of the first texture unit
+		 \param[in] count The number of textures
+		 \param[in] textures The OpenGL identifiers of the textures
+
+		 \sa bindTextureUnit()
+
+		 \since v0.7.0
+		*/
+		void bindTextures(unsigned int first, int count, const unsigned int* textures);
+		/*!
+		 \brief Binds a sampler to the texture \a unit provided, unless it's already bound to it.
+		 \details The sampler's filter and wrapping mode override the parameters of the texture bound to the same unit.
+
+		 \param[in] unit The index of the texture unit
+		 \param[in] sampler The OpenGL identifier of the sampler, 0 to sample the unit's texture with its own parameters
+
+		 \sa bindSamplers(), bindTextureUnit()
+
+		 \since v0.7.0
+		*/
+		void bindSampler(unsigned int unit, unsigned int sampler);
+		/*!
+		 \brief Binds the \a samplers provided to consecutive texture units, starting at the \a first unit.
+		 \details Only the units whose bound sampler differs are rebound.
+
+		 \param[in] first The index of the first texture unit
+		 \param[in] count The number of samplers
+		 \param[in] samplers The OpenGL identifiers of the samplers (0 for the units whose texture is sampled with its own parameters)
+
+		 \sa bindSampler(), bindTextures()
+
+		 \since v0.7.0
+		*/
+		void bindSamplers(unsigned int first, int count, const unsigned int* samplers);
+		/*!
+		 \brief Binds a vertex array object to the context, unless it's already bound.
+
+		 \param[in] vao The OpenGL identifier of the VAO, 0 to unbind the current one
+
+		 \since v0.7.0
+		*/
+		void bindVertexArray(unsigned int vao);
+		/*!
+		 \brief Enables or disables an OpenGL capability, unless it's already in the requested state.
+		 \note Only the GL_BLEND and GL_DEPTH_TEST capabilities are cached, the others are always forwarded to OpenGL.
+
+		 \param[in] capability The OpenGL capability (GL_BLEND, GL_DEPTH_TEST, etc.)
+		 \param[in] enabled True to enable the capability, false to disable it
+
+		 \since v0.7.0
+		*/
+		void setCapability(uint32_t capability, bool enabled);
+		/*!
+		 \brief Sets the blending equations and factors, unless they're already set.
+
+		 \param[in] colorEquation The blending equation for the color channels
+		 \param[in] alphaEquation The blending equation for the alpha channel
+		 \param[in] colorSrcFactor The source's blending factor for the color channels
+		 \param[in] colorDstFactor The destination's blending factor for the color channels
+		 \param[in] alphaSrcFactor The source's blending factor for the alpha channel
+		 \param[in] alphaDstFactor The destination's blending factor for the alpha channel
+
+		 \since v0.7.0
+		*/
+		void setBlendFunction(uint32_t colorEquation, uint32_t alphaEquation, uint32_t colorSrcFactor, uint32_t colorDstFactor, uint32_t alphaSrcFactor, uint32_t alphaDstFactor);
+		/*!
+		 \brief Restricts the subsequent drawcalls to the framebuffer region provided, unless it's already the active one.
+		 \details An empty region (null width or height) disables the scissor test so that the whole framebuffer is rendered to.
+
+		 \param[in] x The position of the region's left edge in pixels
+		 \param[in] y The position of the region's bottom edge in pixels
+		 \param[in] width The width of the region in pixels
+		 \param[in] height The height of the region in pixels
+
+		 \since v0.7.0
+		*/
+		void setScissor(int x, int y, int width, int height);
+		/*!
+		 \brief Restricts every subsequent drawcall and clear to the damaged framebuffer region provided, on top of the scissor regions set by setScissor().
+		 \details The scissor regions requested are intersected with the damaged region, and an empty region discards every fragment.
+		 \note This function is used by the render targets that only redraw their damaged region.
+
+		 \param[in] x The position of the region's left edge in pixels
+		 \param[in] y The position of the region's bottom edge in pixels
+		 \param[in] width The width of the region in pixels
+		 \param[in] height The height of the region in pixels
+
+		 \sa resetDamageRegion()
+
+		 \since v0.7.0
+		*/
+		void setDamageRegion(int x, int y, int width, int height);
+		/*!
+		 \brief Lifts the restriction to the damaged region set by setDamageRegion().
+
+		 \sa setDamageRegion()
+
+		 \since v0.7.0
+		*/
+		void resetDamageRegion();
+		/*!
+		 \brief Removes a deleted OpenGL object from the state cache.
+		 \details OpenGL unbinds the textures and VAOs that are deleted, and their identifiers may be reused by new objects.
+
+		 \param[in] texture The OpenGL identifier of the deleted texture, 0 if no texture was deleted
+		 \param[in] vao The OpenGL identifier of the deleted VAO, 0 if no VAO was deleted
+		 \param[in] program The OpenGL identifier of the deleted shader program, 0 if no shader program was deleted
+
+		 \since v0.7.0
+		*/
+		void releaseObject(unsigned int texture, unsigned int vao, unsigned int program);
+		/*!
+		 \brief Removes a deleted sampler from the state cache.
+		 \details OpenGL unbinds the samplers that are deleted from every texture unit.
+
+		 \param[in] sampler The OpenGL identifier of the deleted sampler
+
+		 \since v0.7.0
+		*/
+		void releaseSampler(unsigned int sampler);
+		/*!
+		 \brief Restores OpenGL's default state and resets the state cache accordingly.
+		 \details This should be called if the OpenGL state was modified without going through the state cache (by a third-party library for example).
+
+		 \par Example:
+		 \code
+		 // Render the third-party library's interface
+		 ImGui_ImplOpenGL3_RenderDrawData(ImGui::GetDrawData());
+
+		 // Inform Aeon that the OpenGL state was modified
+		 ae::gl::resetStateCache();
+		 \endcode
+
+		 \since v0.7.0
+		*/
+		void resetStateCache();
 	}
 }
 #endif // Aeon_Graphics_GLCommon_H_
@@ -67,12 +300,17 @@ namespace ae
  OpenGL and GLSL, the API user won't have need of this namespace unless they
  decide to write their own OpenGL code.
 
+ It also contains a cache of the OpenGL state (the shader program in use, the
+ textures bound per unit, the VAO bound, the blending, depth-testing and scissor states)
+ which filters out the redundant state changes, so there's no need to unbind
+ resources after each drawcall.
+
  This namespace contains enumerations in order to be able to use OpenGL types
  without including the necessary files so the average API user won't have to
  include OpenGL into his project if they don't have any intention of using it.
 
  \author Filippos Gleglakos
- \version v0.4.0
+ \version v0.7.0
  \date 2019.07.30
  \copyright MIT License
 */
\ No newline at end of file
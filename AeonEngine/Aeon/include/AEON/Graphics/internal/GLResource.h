@@ -23,6 +23,8 @@
 #ifndef Aeon_Graphics_GLResource_H_
 #define Aeon_Graphics_GLResource_H_
 
+#include <cstddef>
+
 #include <yvals_core.h>
 
 #include <AEON/Config.h>
@@ -88,6 +90,16 @@ namespace ae
 		*/
 		_NODISCARD unsigned int getHandle() const noexcept;
 		// Public virtual method(s)
+		/*!
+		 \brief Estimates the video memory occupied by the ae::GLResource's data stores.
+		 \details The resources that don't own any storage, such as vertex arrays and shaders, occupy 0 bytes.
+		 \note This is used by the ae::GLResourceFactory to account for the video memory of the resources created.
+
+		 \return The estimated size in bytes
+
+		 \since v0.7.0
+		*/
+		_NODISCARD virtual size_t getMemorySize() const noexcept;
 		/*!
 		 \brief Deletes the OpenGL identifier that was created.
 		 \note This virtual method has to be overloaded by all derived classes.
@@ -40,11 +40,10 @@ namespace ae
 	struct _NODISCARD AEON_API Glyph
 	{
 		// Public member(s)
-		Box2i                      textureRect;       //!< The position and size of the glyph within the texture
-		Vector2i                   bearing;           //!< The glyph's offset in pixels based on its origin
-		const Texture2D*           texture;           //!< The texture atlas containing the glyph
-		std::shared_ptr<Texture2D> individualTexture; //!< The glyph's individual texture
-		unsigned int               advance;           //!< The horizontal offset in 1/64 pixels to the next glyph's origin
+		Box2i            textureRect; //!< The position and size of the glyph within the texture
+		Vector2i         bearing;     //!< The glyph's offset in pixels based on its origin
+		const Texture2D* texture;     //!< The texture atlas containing the glyph
+		unsigned int     advance;     //!< The horizontal offset in 1/64 pixels to the next glyph's origin
 
 		// Public constructor(s)
 		/*!
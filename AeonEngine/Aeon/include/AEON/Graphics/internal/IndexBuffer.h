@@ -128,6 +128,27 @@ namespace ae
 		 \since v0.4.0
 		*/
 		void setData(unsigned int size, const unsigned int* data);
+		/*!
+		 \brief (Re)Creates a new data store for the ae::IndexBuffer with the \a size in bytes specified and the 16-bit indices themselves.
+		 \details The 16-bit indices halve the memory occupied by the geometry that doesn't exceed 65536 vertices.
+
+		 \param[in] size The size of the data store, measured in bytes
+		 \param[in] data A pointer to the 16-bit indices that will be placed in the data store
+
+		 \par Example:
+		 \code
+		 const uint16_t indices[] = { 0, 1, 2, 0, 2, 3 };
+		 auto ibo = std::make_unique<ae::IndexBuffer>(GL_STATIC_DRAW);
+		 ibo->setData(sizeof(indices), indices);
+		 ...
+		 glDrawElements(GL_TRIANGLES, ibo->getCount(), ibo->getType(), nullptr);
+		 \endcode
+
+		 \sa getType()
+
+		 \since v0.7.0
+		*/
+		void setData(unsigned int size, const uint16_t* data);
 		/*!
 		 \brief Retrieves the ae::IndexBuffer's total number of indices.
 
@@ -136,11 +157,20 @@ namespace ae
 		 \since v0.4.0
 		*/
 		_NODISCARD unsigned int getCount() const noexcept;
+		/*!
+		 \brief Retrieves the OpenGL type of the ae::IndexBuffer's indices, to be provided to the drawcalls.
+
+		 \return GL_UNSIGNED_SHORT if the indices are 16-bit, GL_UNSIGNED_INT otherwise
+
+		 \since v0.7.0
+		*/
+		_NODISCARD uint32_t getType() const noexcept;
 
 	private:
 		// Private member(s)
 		unsigned int mCount; //!< The total number of indices
 		uint32_t     mUsage; //!< The intended data store usage pattern
+		uint32_t     mType;  //!< The OpenGL type of the indices
 	};
 }
 #endif // Aeon_Graphics_IndexBuffer_H_
@@ -23,6 +23,8 @@
 #ifndef Aeon_Graphics_RenderTarget_H_
 #define Aeon_Graphics_RenderTarget_H_
 
+#include <mutex>
+
 #include <AEON/Config.h>
 #include <AEON/Math/Vector.h>
 #include <AEON/Math/AABoxCollider.h>
@@ -79,12 +81,15 @@ namespace ae
 		void clear();
 		/*!
 		 \brief Activates the ae::RenderTarget for rendering.
-		 \details This method binds the framebuffer, sets the appropriate viewport and clears the color and depth buffers.
+		 \details This method binds the framebuffer, sets the appropriate viewport and loads the existing contents (the color and depth buffers are cleared by default, see loadContents()).
+		 If the damage is tracked, the clear and the subsequent drawcalls are restricted to the damaged region, otherwise the restriction of the target previously activated is lifted.
 		 \note This method should only be used internally, its use by the API user isn't necessary.
 
+		 \param[in] load Whether the existing contents are loaded, false to render over the contents of the previous scene (for the composites), true by default
+
 		 \since v0.4.0
 		*/
-		void activate();
+		void activate(bool load = true);
 		/*!
 		 \brief Sets the ae::RenderTarget's clear color used for the color buffer.
 
@@ -95,6 +100,80 @@ namespace ae
 		 \since v0.4.0
 		*/
 		void setClearColor(const Color& color);
+		/*!
+		 \brief Marks a region of the ae::RenderTarget as damaged so that it's redrawn during the next frame.
+		 \details The damaged regions are accumulated and their union is redrawn by the next activation, the regions damaged after the frame's last activation are redrawn during the following frame.
+		 The ae::Actor2D instances automatically damage the regions they cover when they're modified, moved, hidden or removed.
+		 \note This method has no effect if the ae::RenderTarget doesn't track its damage, and it may be called from any thread.
+
+		 \param[in] bounds The ae::Box2f containing the damaged region in world coordinates
+
+		 \par Example:
+		 \code
+		 // A custom drawcall modified the region covered by the minimap
+		 window.addDamage(minimap.getGlobalBounds());
+		 \endcode
+
+		 \sa invalidate(), isDamageTracking()
+
+		 \since v0.7.0
+		*/
+		void addDamage(const Box2f& bounds);
+		/*!
+		 \brief Marks the entire ae::RenderTarget as damaged so that it's entirely redrawn during the next frame.
+		 \details The ae::RenderTarget is automatically invalidated when its camera or its size changes.
+
+		 \sa addDamage()
+
+		 \since v0.7.0
+		*/
+		void invalidate();
+		/*!
+		 \brief Requests the ae::RenderTarget to be resized to the \a size provided, the resize being deferred until applyPendingResize() is called.
+		 \details Only the last size requested is applied, so the successive sizes reported while the window's edge is dragged only recreate the attachments and the camera's projection once.
+		 The pending resize is applied at the latest by the next activation.
+		 \note Requesting the current size cancels the pending resize.
+
+		 \param[in] size The 2-dimensional ae::Vector containing the new framebuffer size in pixels
+
+		 \par Example:
+		 \code
+		 // Follow the window's size without recreating the texture for every sample
+		 void MyState::handleEvent(ae::Event* const event)
+		 {
+			if (event->type == ae::Event::Type::FramebufferResized) {
+				mSceneTexture.requestResize(event->as<ae::FramebufferResizeEvent>()->size);
+			}
+		 }
+		 \endcode
+
+		 \sa applyPendingResize(), hasPendingResize()
+
+		 \since v0.7.0
+		*/
+		void requestResize(const Vector2i& size) noexcept;
+		/*!
+		 \brief Applies the resize requested since the last call, if there is one.
+		 \details The attachments are recreated, the camera's projection is recomputed and the entire ae::RenderTarget is invalidated.
+		 \note This method is automatically called for the windows once the frame's events have been processed, and for every render target by its activation.
+
+		 \return True if the ae::RenderTarget was resized, false if no resize was pending
+
+		 \sa requestResize()
+
+		 \since v0.7.0
+		*/
+		bool applyPendingResize();
+		/*!
+		 \brief Checks whether a resize was requested but hasn't been applied yet.
+
+		 \return True if a resize is pending, false otherwise
+
+		 \sa requestResize()
+
+		 \since v0.7.0
+		*/
+		_NODISCARD bool hasPendingResize() const noexcept;
 		/*!
 		 \brief Converts a point from target coordinates to world coordinates.
 		 \details This method calculates the 2D position that matches the given pixel of the ae::RenderTarget.
@@ -158,6 +237,16 @@ namespace ae
 		 \since v0.4.0
 		*/
 		_NODISCARD const Vector2i& getFramebufferSize() const noexcept;
+		/*!
+		 \brief Checks whether the ae::RenderTarget tracks its damage in order to only redraw the regions that were modified.
+
+		 \return True if only the damaged regions are redrawn, false if the entire ae::RenderTarget is redrawn every frame
+
+		 \sa addDamage(), ae::Window::setDamageTracking()
+
+		 \since v0.7.0
+		*/
+		_NODISCARD bool isDamageTracking() const noexcept;
 		/*!
 		 \brief Sets a new camera to be used by the ae::RenderTarget.
 		 \details The \a camera provided will be copied, so it doesn't need to be kept alive.
@@ -186,6 +275,24 @@ namespace ae
 		 \since v0.4.0
 		*/
 		_NODISCARD virtual unsigned int getFramebufferHandle() const noexcept;
+		/*!
+		 \brief Checks whether the ae::RenderTarget is rendered offscreen instead of being presented.
+
+		 \return True if the render target is a render texture, false by default
+
+		 \since v0.7.0
+		*/
+		_NODISCARD virtual bool isOffscreen() const noexcept;
+		/*!
+		 \brief Stores the contents rendered into the ae::RenderTarget once a scene has been rendered.
+		 \details Nothing is done by default, the derived classes may discard or resolve their attachments.
+		 \note This method is called by the renderers at the end of their scene, its use by the API user isn't necessary.
+
+		 \sa loadContents()
+
+		 \since v0.7.0
+		*/
+		virtual void storeContents();
 	protected:
 		// Protected constructor(s)
 		/*!
@@ -216,13 +323,69 @@ namespace ae
 		*/
 		RenderTarget& operator=(RenderTarget&& rvalue) noexcept;
 
+	protected:
+		// Protected method(s)
+		/*!
+		 \brief Discards the damage redrawn during the frame once it has been presented.
+		 \note This method should be called by the derived classes that track their damage, once their content has been presented.
+
+		 \since v0.7.0
+		*/
+		void resetDamage();
+		/*!
+		 \brief Forces the next activation to bind the ae::RenderTarget's framebuffer once again.
+		 \details This should be called by the derived classes whose framebuffer handle changes.
+
+		 \since v0.7.0
+		*/
+		void deactivate() noexcept;
+
+		// Protected virtual method(s)
+		/*!
+		 \brief Loads the ae::RenderTarget's contents once it's activated.
+		 \details The color and depth buffers are cleared by default, the derived classes may keep or discard their previous contents instead.
+
+		 \sa storeContents()
+
+		 \since v0.7.0
+		*/
+		virtual void loadContents();
+		/*!
+		 \brief Resizes the ae::RenderTarget's attachments to the \a size provided when a pending resize is applied.
+		 \details The framebuffer size is updated by default, the derived classes may recreate their attachments instead.
+
+		 \param[in] size The new framebuffer size in pixels
+
+		 \sa applyPendingResize()
+
+		 \since v0.7.0
+		*/
+		virtual void onResize(const Vector2i& size);
+
+	private:
+		// Private method(s)
+		/*!
+		 \brief Restricts the clear and the subsequent drawcalls to the pixels covered by the damage accumulated during the frame.
+
+		 \since v0.7.0
+		*/
+		void applyDamage();
+
 	protected:
 		// Protected member(s)
-		Vector2i                mFramebufferSize; //!< The render target's framebuffer size
+		Vector2i                  mFramebufferSize;      //!< The render target's framebuffer size
+		bool                      mDamageTracking;       //!< Whether only the damaged regions are redrawn
 	private:
 		// Private member(s)
-		Vector4f                mClearColor;      //!< The normalized color used to clear the target's color buffer
-		std::unique_ptr<Camera> mCamera;          //!< The render target's camera
+		Vector4f                  mClearColor;           //!< The normalized color used to clear the target's color buffer
+		std::unique_ptr<Camera>   mCamera;               //!< The render target's camera
+		std::mutex                mDamageMutex;          //!< The mutex protecting the damage accumulated
+		std::pair<bool, Box2f>    mDamage;               //!< Whether a region was damaged since the last activation and the union of the damaged regions in world coordinates
+		std::pair<bool, Box2f>    mFrameDamage;          //!< Whether a region is redrawn during the current frame and the union of the regions redrawn in world coordinates
+		bool                      mFullDamage;           //!< Whether the entire render target was damaged since the last activation
+		bool                      mFrameFullDamage;      //!< Whether the entire render target is redrawn during the current frame
+		Matrix4f                  mDamageViewProjection; //!< The camera's view-projection matrix with which the damage was last applied
+		std::pair<bool, Vector2i> mPendingSize;          //!< Whether a resize was requested and the last size requested
 	};
 }
 #endif // Aeon_Graphics_RenderTarget_H_
@@ -235,6 +398,10 @@ namespace ae
  the render targets. They also possess a camera object that decides what is
  shown on the window / render texture.
 
+ The render targets that track their damage (see ae::Window::setDamageTracking())
+ only clear and redraw the union of the regions damaged since the last frame,
+ which saves fill rate when only a few widgets change.
+
  \author Filippos Gleglakos
  \version v0.5.0
  \date 2020.06.09
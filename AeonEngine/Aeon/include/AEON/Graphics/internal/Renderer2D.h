@@ -24,17 +24,26 @@
 #define Aeon_Graphics_Renderer2D_H_
 
 #include <vector>
+#include <array>
 #include <memory>
+#include <functional>
 
 #include <AEON/Config.h>
+#include <AEON/System/Time.h>
+#include <AEON/Math/Matrix.h>
+#include <AEON/Math/AABoxCollider.h>
+#include <AEON/Graphics/internal/GLCommon.h>
+#include <AEON/Graphics/Renderable2D.h>
 
 namespace ae
 {
 	// Forward declaration(s)
+	struct BlendMode;
 	struct RenderStates;
-	struct Vertex2D;
+	class Camera;
 	class RenderTarget;
-	class Renderable2D;
+	class Sampler;
+	class Texture;
 	class Texture2D;
 	class UniformBuffer;
 	class VertexArray;
@@ -44,6 +53,31 @@ namespace ae
 	*/
 	class AEON_API Renderer2D
 	{
+	public:
+		// Public struct(s)
+		/*!
+		 \brief Struct containing the rendering statistics of a scene.
+		 \details The statistics are reset when a scene begins and are complete once it ends.
+		*/
+		struct Statistics
+		{
+			unsigned int drawCalls;         //!< The number of drawcalls issued
+			unsigned int shaderBinds;       //!< The number of shader programs bound (the redundant binds filtered out by the state cache aren't counted)
+			unsigned int textureBinds;      //!< The number of textures bound (the redundant binds filtered out by the state cache aren't counted)
+			unsigned int blendChanges;      //!< The number of blending state changes (the redundant changes filtered out by the state cache aren't counted)
+			size_t       vertexCount;       //!< The number of vertices (or instances) uploaded
+			size_t       indexCount;        //!< The number of indices uploaded
+			size_t       uploadedBytes;     //!< The number of bytes uploaded to the GPU (vertices, indices, transforms, etc.)
+			unsigned int submissions;       //!< The number of submissions received
+			unsigned int cachedSubmissions; //!< The number of submissions that were already cached
+			unsigned int batchesRebuilt;    //!< The number of batches entirely rebuilt
+			unsigned int batchesUpdated;    //!< The number of batches whose modified submissions were rewritten in place
+			unsigned int batchesReused;     //!< The number of batches reused without any modifications
+			unsigned int batchesResident;   //!< The number of batches drawn from the GPU arenas without being uploaded
+			Time         submitTime;        //!< The CPU time spent between beginScene() and endScene(), submitting the scene
+			Time         endSceneTime;      //!< The CPU time spent in endScene(), flushing the scene to the GPU
+		};
+
 	private:
 		// Private static member(s)
 		static Renderer2D* activeInstance; //!< The currently active renderer instance
@@ -91,6 +125,71 @@ namespace ae
 		 \since v0.6.0
 		*/
 		void submit(const Renderable2D& renderable, const RenderStates& states);
+		/*!
+		 \brief Retrieves the rendering statistics of the current scene or of the last scene if none is currently rendered.
+		 \details The statistics may be used to set performance budgets and to detect regressions which break batches.
+
+		 \return The ae::Renderer2D::Statistics of the scene
+
+		 \par Example:
+		 \code
+		 ae::BatchRenderer2D& renderer = ae::BatchRenderer2D::getInstance();
+		 renderer.beginScene(window);
+		 ...
+		 renderer.endScene();
+
+		 const ae::Renderer2D::Statistics& stats = renderer.getStatistics();
+		 if (stats.drawCalls > 50) {
+			AEON_LOG_WARNING("Draw call budget exceeded", std::to_string(stats.drawCalls) + " drawcalls were issued.");
+		 }
+		 \endcode
+
+		 \since v0.7.0
+		*/
+		_NODISCARD const Statistics& getStatistics() const noexcept;
+		/*!
+		 \brief Sets the additional cameras through which the ae::Renderer2D's scenes are viewed alongside their render target's camera.
+		 \details Each camera is displayed in its own viewport on the render target (split-screens, minimaps, etc.). The geometry is batched and uploaded once
+		 per scene and drawn into every viewport: the vertex shaders select the view-projection matrix with the instance index and, where
+		 GL_ARB_shader_viewport_layer_array is supported, the viewport as well so that all views are drawn by a single drawcall.
+		 Otherwise, each drawcall is repeated for every view.\n
+		 The actors are only culled against the union of the views' bounds.
+		 \note Up to 7 additional cameras may be provided, their targets must be set to the scene's render target.\n
+		 The views are drawn by the ae::BatchRenderer2D, the other renderers and the custom drawcalls only draw through the render target's camera.
+		 Custom shaders must select their view and viewport from gl_InstanceID and uTransform.viewOffset, as the built-in shaders do.
+
+		 \param[in] cameras The additional cameras, an empty list to only view the scenes through their render target's camera
+
+		 \par Example:
+		 \code
+		 // Display the minimap in the top-right corner of the window
+		 ae::Camera2D minimap;
+		 minimap.setTarget(&window);
+		 minimap.setViewport(ae::Box2f(0.75f, 0.f, 0.25f, 0.25f));
+		 minimap.zoom(4.f);
+
+		 ae::BatchRenderer2D& renderer = ae::BatchRenderer2D::getInstance();
+		 renderer.setViews({ &minimap });
+		 renderer.beginScene(window);
+		 ...
+		 renderer.endScene();
+		 \endcode
+
+		 \sa getViews()
+
+		 \since v0.7.0
+		*/
+		void setViews(const std::vector<Camera*>& cameras);
+		/*!
+		 \brief Retrieves the additional cameras through which the ae::Renderer2D's scenes are viewed alongside their render target's camera.
+
+		 \return The additional cameras, empty if the scenes are only viewed through their render target's camera
+
+		 \sa setViews()
+
+		 \since v0.7.0
+		*/
+		_NODISCARD const std::vector<Camera*>& getViews() const noexcept;
 
 		// Public virtual method(s)
 		/*!
@@ -127,7 +226,7 @@ namespace ae
 
 		 \since v0.6.0
 		*/
-		virtual void submit(const std::vector<Vertex2D>& vertices, const std::vector<unsigned int>& indices, const RenderStates& states) = 0;
+		virtual void submit(const Vertex2DList& vertices, const std::vector<unsigned int>& indices, const RenderStates& states) = 0;
 
 		// Public static method(s)
 		/*!
@@ -140,6 +239,120 @@ namespace ae
 		 \since v0.6.0
 		*/
 		_NODISCARD static Renderer2D* const getActiveInstance() noexcept;
+		/*!
+		 \brief Submits the geometry to the active ae::Renderer2D instance, or records it if the calling thread is recording.
+		 \details The ae::Renderable2D instances should submit their geometry through this method rather than through the active renderer
+		 directly so that their submissions may be recorded by worker threads, see ae::RenderCommandList::beginRecording().
+		 \note The vertices and indices must remain valid until the end of the scene.
+
+		 \param[in] vertices The list of vertices to be rendered
+		 \param[in] indices The list of associated indices to be rendered
+		 \param[in] states The ae::RenderStates (texture, transform, blend mode, shader) to be applied to the geometry
+
+		 \sa getActiveInstance()
+
+		 \since v0.7.0
+		*/
+		static void submitToActive(const Vertex2DList& vertices, const std::vector<unsigned int>& indices, const RenderStates& states);
+		/*!
+		 \brief Hands a custom drawcall to the active ae::Renderer2D instance, or records it if the calling thread is recording.
+		 \details The drawcall is executed by the renderer's endScene(), once the scene's geometry has been rendered, and is given the OpenGL context to itself:
+		 it binds its own shader program, VAO, textures and blending states. The scene's render target remains active and depth-testing is left untouched.\n
+		 This is used by the ae::Actor2D instances whose rendering can't be expressed as vertices and indices, such as the ae::ParticleEmitter2D's compute dispatches.
+		 \note Everything captured by the drawcall must remain valid until the end of the scene, it should therefore be captured by value.
+
+		 \param[in] drawcall The function issuing the OpenGL calls
+
+		 \par Example:
+		 \code
+		 ae::Renderer2D::drawToActive([shader = mShader, vao = mVAO, count = mCount]() {
+			shader->bind();
+			vao->bind();
+			glDrawArrays(GL_POINTS, 0, count);
+		 });
+		 \endcode
+
+		 \sa submitToActive()
+
+		 \since v0.7.0
+		*/
+		static void drawToActive(std::function<void()> drawcall);
+		/*!
+		 \brief Retrieves the world-space bounds visible by the calling thread's current scene.
+		 \details The bounds are computed by beginScene() from the camera's matrices when the scene is viewed by an ae::Camera2D and are reset by endScene().
+		 The ae::Actor2D nodes whose bounds don't intersect these are culled before submitting their geometry.
+
+		 \return A std::pair containing whether view bounds are available and the world-space view bounds
+
+		 \sa setCullingBounds()
+
+		 \since v0.7.0
+		*/
+		_NODISCARD static const std::pair<bool, Box2f>& getCullingBounds() noexcept;
+		/*!
+		 \brief Sets the world-space bounds visible by the calling thread's current scene.
+		 \details Worker threads recording into an ae::RenderCommandList adopt the bounds of the thread that dispatched them.
+		 \note This static method is primarily of use to ae::Actor2D, the bounds are otherwise set by beginScene().
+
+		 \param[in] bounds A std::pair containing whether view bounds are available and the world-space view bounds
+
+		 \sa getCullingBounds()
+
+		 \since v0.7.0
+		*/
+		static void setCullingBounds(const std::pair<bool, Box2f>& bounds) noexcept;
+		/*!
+		 \brief Retrieves the render target of the calling thread's current scene if it tracks its damage.
+		 \details The target is set by beginScene() and reset by endScene(). The ae::Actor2D nodes damage the regions they cover on this target when they're modified.
+
+		 \return The pointer to the scene's damage-tracked render target, nullptr if the scene's target doesn't track its damage
+
+		 \sa setDamageTarget(), ae::RenderTarget::addDamage()
+
+		 \since v0.7.0
+		*/
+		_NODISCARD static RenderTarget* getDamageTarget() noexcept;
+		/*!
+		 \brief Sets the damage-tracked render target of the calling thread's current scene.
+		 \details Worker threads recording into an ae::RenderCommandList adopt the target of the thread that dispatched them.
+		 \note This static method is primarily of use to ae::Actor2D, the target is otherwise set by beginScene().
+
+		 \param[in] target The pointer to the damage-tracked render target, nullptr if there is none
+
+		 \sa getDamageTarget()
+
+		 \since v0.7.0
+		*/
+		static void setDamageTarget(RenderTarget* target) noexcept;
+		/*!
+		 \brief Retrieves the number of pixels covered by a world unit in the last scene rendered onto a window through an ae::Camera2D.
+		 \details The value is computed by beginScene() from the camera's matrices and viewport, the scenes rendered onto render textures are ignored.
+		 It's used by the ae::Shape instances to select their point count from their on-screen size.
+
+		 \return The number of pixels per world unit, 0 if no such scene has been rendered yet
+
+		 \sa ae::Shape::setLevelOfDetail()
+
+		 \since v0.7.0
+		*/
+		_NODISCARD static float getPixelsPerUnit() noexcept;
+		/*!
+		 \brief Retrieves the time elapsed since the renderers' clock started.
+		 \details beginScene() uploads this time to the transform UBO's \a time uniform, so that the shaders can animate the geometry without it being modified.
+
+		 \return The ae::Time elapsed since the first use of the renderers' clock
+
+		 \since v0.7.0
+		*/
+		_NODISCARD static Time getSceneTime() noexcept;
+		/*!
+		 \brief Notifies the 2D renderers that the camera matrices of the transform UBO were overwritten by another renderer.
+		 \details The next scene uploads its camera's matrices even if they were the last ones uploaded by a 2D renderer.
+		 \note This static method is primarily of use to the renderers sharing the transform UBO, such as the ae::Renderer3D.
+
+		 \since v0.7.0
+		*/
+		static void invalidateUploadedCamera() noexcept;
 	protected:
 		// Protected constructor(s)
 		/*!
@@ -150,14 +363,127 @@ namespace ae
 		*/
 		Renderer2D();
 
+		// Protected method(s)
+		/*!
+		 \brief Records a drawcall and the data uploaded for it in the scene's statistics.
+
+		 \param[in] vertexCount The number of vertices (or instances) uploaded
+		 \param[in] indexCount The number of indices uploaded
+		 \param[in] uploadedBytes The number of bytes uploaded to the GPU
+
+		 \since v0.7.0
+		*/
+		void recordDrawCall(size_t vertexCount, size_t indexCount, size_t uploadedBytes) noexcept;
+		/*!
+		 \brief Marks the beginning of the scene's termination so that the scene's submission and termination are timed separately.
+		 \details Derived renderers call it first thing in their endScene() (once they're known not to be recording), the base
+		 endScene() marking it otherwise.
+
+		 \since v0.7.0
+		*/
+		void markSceneEnd() noexcept;
+		/*!
+		 \brief Sets the viewports of the scene's views once its render target has been activated.
+		 \details Nothing is done if the scene is only viewed through its render target's camera.
+
+		 \sa setViews(), drawToViews()
+
+		 \since v0.7.0
+		*/
+		void applyViewports() const;
+		/*!
+		 \brief Draws the geometry into each of the scene's views.
+		 \details The \a drawcall is issued once with an instance per view if the vertex shaders can select the viewport,
+		 otherwise it's issued once per view with a single instance, the view being selected through the transform UBO and the first viewport.
+
+		 \param[in] drawcall The function issuing the OpenGL drawcall, given the number of instances to draw
+
+		 \sa applyViewports(), getViewInstanceCount()
+
+		 \since v0.7.0
+		*/
+		void drawToViews(const std::function<void(int)>& drawcall);
+		/*!
+		 \brief Retrieves the number of instances each drawcall issued by drawToViews() draws.
+		 \details The indirect drawing commands written beforehand must use this instance count.
+
+		 \return The number of views if they're all drawn by a single drawcall, 1 otherwise
+
+		 \sa drawToViews()
+
+		 \since v0.7.0
+		*/
+		_NODISCARD int getViewInstanceCount() const noexcept;
+		/*!
+		 \brief Checks whether the calling thread is recording its scenes and submissions into an ae::RenderCommandList.
+		 \details Derived renderers mustn't issue any OpenGL calls in their beginScene() and endScene() methods while recording.
+
+		 \return True if the calling thread is recording, false otherwise
+
+		 \sa ae::RenderCommandList::beginRecording()
+
+		 \since v0.7.0
+		*/
+		_NODISCARD static bool isRecording() noexcept;
+		/*!
+		 \brief Checks whether a submission needs to be rendered in the transparent pass.
+		 \details The ae::RenderStates' transparency hint is used if one is provided. Otherwise, geometry rendered without blending is opaque,
+		 and blended geometry is transparent if any of its vertices is translucent or if its texture isn't known to be opaque.
+
+		 \param[in] vertices The list of vertices submitted
+		 \param[in] states The ae::RenderStates submitted alongside the vertices
+
+		 \return True if the submission is transparent, false if it's opaque
+
+		 \since v0.7.0
+		*/
+		_NODISCARD bool isTransparent(const Vertex2DList& vertices, const RenderStates& states) const noexcept;
+		/*!
+		 \brief Binds the texture provided (the white texture if it's null) alongside its sampler to the texture \a unit provided.
+		 \details The unit's sampler is unbound if none is provided so that the texture is sampled with its own parameters.
+		 The state cache ignores the redundant binds.
+
+		 \param[in] texture The ae::Texture to bind, the 1x1 white texture is bound if it's nullptr
+		 \param[in] sampler The ae::Sampler overriding the texture's parameters, nullptr if the texture's own parameters are used
+		 \param[in] unit The index of the texture unit, 0 by default
+
+		 \sa ae::RenderStates::sampler
+
+		 \since v0.7.0
+		*/
+		void bindTexture(const Texture* texture, const Sampler* sampler, unsigned int unit = 0) const;
+		/*!
+		 \brief Enables and configures blending for the \a blendMode provided, or disables it if it's ae::BlendMode::BlendNone.
+		 \details The state cache ignores the blending states that are already set.
+
+		 \param[in] blendMode The ae::BlendMode to apply
+
+		 \since v0.7.0
+		*/
+		void applyBlendMode(const BlendMode& blendMode) const;
+
 	protected:
 		// Protected member(s)
 		std::shared_ptr<Texture2D>     mWhiteTexture; //!< A 1x1 white texture for untextured renderables
 		std::shared_ptr<VertexArray>   mVAO;          //!< The VAO used for all drawcalls
 		RenderTarget*                  mRenderTarget; //!< The scene's active render target
+		Statistics                     mStatistics;   //!< The rendering statistics of the current scene
 	private:
 		// Private member(s)
-		std::shared_ptr<UniformBuffer> mTransformUBO; //!< The global transform UBO
+		std::shared_ptr<UniformBuffer>                 mTransformUBO;     //!< The global transform UBO
+		std::array<int, 6>                             mTransformOffsets; //!< The offsets of the view, projection, view-projection matrices, views' matrices, view offset and scene time in the transform UBO
+		int                                            mViewStride;       //!< The stride between the views' view-projection matrices in the transform UBO
+		std::vector<Camera*>                           mViews;            //!< The additional cameras through which the scenes are viewed
+		std::vector<std::array<float, 4>>              mViewports;        //!< The viewports of the scene's views, empty if it's only viewed through its render target's camera
+		gl::StateCounters                              mSceneCounters;    //!< The OpenGL state counters when the scene began
+		bool                                           mProfiledPass;     //!< Whether a GPU scope was opened for the scene's render texture
+		std::pair<bool, std::pair<Matrix4f, Matrix4f>> mCameraSnapshot;   //!< The recorded view and projection matrices to use instead of the camera's when a scene is replayed
+		std::vector<std::function<void()>>             mDrawcalls;        //!< The custom drawcalls to execute once the scene's geometry has been rendered
+		Time                                           mSceneStart;       //!< The time at which the scene began
+		Time                                           mSceneEnd;         //!< The time at which the scene's termination began, zero until it's marked
+
+		// Friend class(es)
+		friend class RenderCommandList;
 	};
 }
 #endif // Aeon_Graphics_Renderer2D_H_
@@ -170,7 +496,7 @@ namespace ae
  all 2D renderers will have to adhere to. This class won't be of any use to the
  API user.
 
- \sa BatchRenderer2D, BasicRenderer2D
+ \sa BatchRenderer2D, BasicRenderer2D, InstancedRenderer2D
 
  \author Filippos Gleglakos
  \version v0.6.0
@@ -0,0 +1,228 @@
+// MIT License
+// 
+// Copyright(c) 2019-2021 Filippos Gleglakos
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef Aeon_Graphics_RingBuffer_H_
+#define Aeon_Graphics_RingBuffer_H_
+
+#include <cstdint>
+#include <vector>
+
+#include <yvals_core.h>
+
+#include <AEON/Config.h>
+
+namespace ae
+{
+	// Forward declaration(s)
+	class Buffer;
+
+	/*!
+	 \brief The class used to stream data to OpenGL through a persistently-mapped ae::Buffer divided into several regions.
+	 \note This class is considered to be internal but may still be used by the API user.
+	*/
+	class _NODISCARD AEON_API RingBuffer
+	{
+	public:
+		// Public constructor(s)
+		/*!
+		 \brief Default constructor.
+		 \details The ae::RingBuffer can't be used until the create() method is called.
+
+		 \since v0.7.0
+		*/
+		RingBuffer() noexcept;
+		/*!
+		 \brief Deleted copy constructor.
+
+		 \since v0.7.0
+		*/
+		RingBuffer(const RingBuffer&) = delete;
+		/*!
+		 \brief Move constructor.
+
+		 \param[in] rvalue The ae::RingBuffer that will be moved
+
+		 \since v0.7.0
+		*/
+		RingBuffer(RingBuffer&& rvalue) noexcept;
+	public:
+		// Public operator(s)
+		/*!
+		 \brief Deleted assignment operator.
+
+		 \since v0.7.0
+		*/
+		RingBuffer& operator=(const RingBuffer&) = delete;
+		/*!
+		 \brief Move assignment operator.
+
+		 \param[in] rvalue The ae::RingBuffer that will be moved
+
+		 \return The caller ae::RingBuffer
+
+		 \since v0.7.0
+		*/
+		RingBuffer& operator=(RingBuffer&& rvalue) noexcept;
+	public:
+		// Public method(s)
+		/*!
+		 \brief Creates the \a buffer's immutable data store and maps it persistently.
+		 \details The data store will be \a regionSize * \a regionCount bytes wide. Each frame writes into a single region while
+		 OpenGL reads from the others, so three regions are usually enough to never stall the CPU.
+		 \note The \a buffer must not possess a data store prior to calling this method.
+
+		 \param[in] buffer The ae::Buffer (usually attached to an ae::VertexArray) whose data store will be created
+		 \param[in] regionSize The size of a single region, measured in bytes
+		 \param[in] regionCount The number of regions in the ring, 3 by default
+
+		 \return True if the data store was created and mapped, false otherwise
+
+		 \par Example:
+		 \code
+		 ae::RingBuffer vertexRing;
+		 vertexRing.create(*vao->getVBO(0), sizeof(ae::Vertex2D) * 65536);
+		 \endcode
+
+		 \sa allocate(), lock()
+
+		 \since v0.7.0
+		*/
+		bool create(const Buffer& buffer, int regionSize, unsigned int regionCount = 3);
+		/*!
+		 \brief Reserves \a size bytes in the current region and retrieves a pointer to write into them.
+		 \details The memory retrieved is directly visible to OpenGL, there's no need to flush or unmap it.
+
+		 \param[in] size The number of bytes to reserve
+		 \param[out] offset The offset in bytes from the start of the data store at which the memory reserved begins
+		 \param[in] alignment The alignment in bytes of the \a offset (GL_SHADER_STORAGE_BUFFER_OFFSET_ALIGNMENT, for example), 1 by default
+
+		 \return A pointer to the memory reserved, or nullptr if the current region lacks the space
+
+		 \par Example:
+		 \code
+		 int offset = 0;
+		 void* vertexData = vertexRing.allocate(sizeof(ae::Vertex2D) * vertices.size(), offset);
+		 if (vertexData) {
+			std::memcpy(vertexData, vertices.data(), sizeof(ae::Vertex2D) * vertices.size());
+		 }
+		 \endcode
+
+		 \sa lock()
+
+		 \since v0.7.0
+		*/
+		_NODISCARD void* allocate(int size, int& offset, int alignment = 1) noexcept;
+		/*!
+		 \brief Fences the current region and moves on to the next one.
+		 \details The CPU will only wait if OpenGL is still reading from the next region.
+		 \note This method should be called once all the drawcalls sourcing from the current region have been issued.
+
+		 \par Example:
+		 \code
+		 // Write into the ring and issue the drawcalls
+		 ...
+		 // Move on to the next region for the next frame
+		 vertexRing.lock();
+		 \endcode
+
+		 \sa allocate()
+
+		 \since v0.7.0
+		*/
+		void lock();
+		/*!
+		 \brief Deletes the fences that are still pending.
+		 \details The ae::Buffer's data store will be unmapped once the ae::Buffer is destroyed.
+
+		 \since v0.7.0
+		*/
+		void destroy();
+		/*!
+		 \brief Retrieves the size of a single region of the ae::RingBuffer.
+
+		 \return The size of a region, measured in bytes
+
+		 \since v0.7.0
+		*/
+		_NODISCARD int getRegionSize() const noexcept;
+		/*!
+		 \brief Checks whether the ae::RingBuffer's data store has been created and mapped.
+
+		 \return True if the ae::RingBuffer can be used, false otherwise
+
+		 \since v0.7.0
+		*/
+		_NODISCARD bool isCreated() const noexcept;
+
+	private:
+		// Private method(s)
+		/*!
+		 \brief Waits for OpenGL to signal the \a fence provided and deletes it.
+
+		 \param[in,out] fence The fence that will be waited on, it will be set to nullptr
+
+		 \since v0.7.0
+		*/
+		void waitForFence(void*& fence) const;
+
+	private:
+		// Private member(s)
+		std::vector<void*> mFences;     //!< The fences placed after the last drawcall sourcing from each region
+		uint8_t*           mData;       //!< The persistently-mapped data store
+		int                mRegionSize; //!< The size of a single region, measured in bytes
+		int                mHead;       //!< The offset of the next available byte within the current region
+		unsigned int       mRegion;     //!< The index of the current region
+	};
+}
+#endif // Aeon_Graphics_RingBuffer_H_
+
+/*!
+ \class ae::RingBuffer
+ \ingroup graphics
+
+ The ae::RingBuffer class streams dynamic data to OpenGL without
+ reallocating the data store every time it's modified. The ae::Buffer's
+ immutable data store is mapped once with the persistent and coherent flags,
+ and is divided into several regions; the CPU writes into one region while
+ OpenGL may still be reading from the others. Fence objects are placed once
+ a region has been used so that it's never overwritten before OpenGL is
+ done with it.
+
+ Usage example:
+ \code
+ ae::RingBuffer vertexRing;
+ vertexRing.create(*vao->getVBO(0), sizeof(ae::Vertex2D) * 65536);
+ ...
+ // Every frame
+ int offset = 0;
+ void* vertexData = vertexRing.allocate(sizeof(ae::Vertex2D) * vertices.size(), offset);
+ std::memcpy(vertexData, vertices.data(), sizeof(ae::Vertex2D) * vertices.size());
+ GLCall(glDrawArrays(GL_TRIANGLES, offset / sizeof(ae::Vertex2D), vertices.size()));
+ ...
+ vertexRing.lock();
+ \endcode
+
+ \author Filippos Gleglakos
+ \version v0.7.0
+ \date 2021.07.05
+ \copyright MIT License
+*/
\ No newline at end of file
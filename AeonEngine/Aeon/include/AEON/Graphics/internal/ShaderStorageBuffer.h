@@ -0,0 +1,270 @@
+// MIT License
+// 
+// Copyright(c) 2019-2021 Filippos Gleglakos
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+
+#ifndef Aeon_Graphics_ShaderStorageBuffer_H_
+#define Aeon_Graphics_ShaderStorageBuffer_H_
+
+#include <vector>
+
+#include <AEON/Graphics/internal/Buffer.h>
+
+namespace ae
+{
+	/*!
+	 \brief The class representing an OpenGL buffer used to supply read-write storage to shaders.
+	 \details Contrary to an ae::UniformBuffer, its size isn't limited to a few kilobytes and the shaders may write to it, which allows per-instance data, GPU culling and particle simulations.
+	 \note This class is considered to be internal but may still be used by the API user.
+	*/
+	class _NODISCARD AEON_API ShaderStorageBuffer : public Buffer
+	{
+	public:
+		// Public constructor(s)
+		/*!
+		 \brief Constructs the ae::ShaderStorageBuffer by providing whether its data store will be persistently mapped.
+		 \details The ae::ShaderStorageBuffer is bound to a unique binding point right away but its data store is only created by the first call to setData() or resize().
+
+		 \param[in] persistent Whether the data store will remain mapped so that it can be written to directly, false by default
+
+		 \par Example:
+		 \code
+		 auto ssbo = ae::GLResourceFactory::getInstance().create<ae::ShaderStorageBuffer>("particles", true);
+		 \endcode
+
+		 \since v0.7.0
+		*/
+		explicit ShaderStorageBuffer(bool persistent = false);
+		/*!
+		 \brief Deleted copy constructor.
+
+		 \since v0.7.0
+		*/
+		ShaderStorageBuffer(const ShaderStorageBuffer&) = delete;
+		/*!
+		 \brief Move constructor.
+
+		 \param[in] rvalue The ae::ShaderStorageBuffer that will be moved
+
+		 \since v0.7.0
+		*/
+		ShaderStorageBuffer(ShaderStorageBuffer&& rvalue) noexcept;
+	public:
+		// Public operator(s)
+		/*!
+		 \brief Deleted assignment operator.
+
+		 \since v0.7.0
+		*/
+		ShaderStorageBuffer& operator=(const ShaderStorageBuffer&) = delete;
+		/*!
+		 \brief Move assignment operator.
+
+		 \param[in] rvalue The ae::ShaderStorageBuffer that will be moved
+
+		 \return The caller ae::ShaderStorageBuffer
+
+		 \since v0.7.0
+		*/
+		ShaderStorageBuffer& operator=(ShaderStorageBuffer&& rvalue) noexcept;
+	public:
+		// Public method(s)
+		/*!
+		 \brief Resizes the data store to the \a size in bytes provided while preserving its contents.
+		 \details As the data store is immutable, a new one is created and the previous contents are copied on the GPU. The binding point and the persistent mapping are updated accordingly.
+		 \note The OpenGL identifier is modified by this method.
+
+		 \param[in] size The new size in bytes of the data store
+
+		 \par Example:
+		 \code
+		 // Make room for 10'000 particles
+		 ssbo->resize(sizeof(Particle) * 10'000);
+		 \endcode
+
+		 \sa setData(), getSize()
+
+		 \since v0.7.0
+		*/
+		void resize(int size);
+		/*!
+		 \brief Replaces the contents of the data store by the \a data of the \a size in bytes provided.
+		 \details The data store grows (doubling in size) if it's too small, it never shrinks.
+
+		 \param[in] size The size in bytes of the \a data
+		 \param[in] data The pointer to the new data
+
+		 \par Example:
+		 \code
+		 std::vector<ae::Matrix4f> transforms = ...;
+		 ssbo->setData(static_cast<int>(sizeof(ae::Matrix4f) * transforms.size()), transforms.data());
+		 \endcode
+
+		 \sa setSubData(), setElements()
+
+		 \since v0.7.0
+		*/
+		void setData(int size, const void* data);
+		/*!
+		 \brief Modifies a part of the data store starting at the \a offset provided.
+		 \note The range modified must be contained within the data store.
+
+		 \param[in] offset The offset in bytes at which to start modifying the data store
+		 \param[in] size The size in bytes of the \a data
+		 \param[in] data The pointer to the new data
+
+		 \par Example:
+		 \code
+		 ssbo->setSubData(sizeof(ae::Matrix4f) * 3, sizeof(ae::Matrix4f), transform.elements.data());
+		 \endcode
+
+		 \sa setData(), setElement()
+
+		 \since v0.7.0
+		*/
+		void setSubData(int offset, int size, const void* data) const;
+		/*!
+		 \brief Replaces the contents of the data store by the \a elements provided.
+
+		 \param[in] elements The vector of elements, their type must match the layout of the shader's storage block
+
+		 \par Example:
+		 \code
+		 std::vector<ae::Matrix4f> transforms = ...;
+		 ssbo->setElements(transforms);
+		 \endcode
+
+		 \sa setElement(), setData()
+
+		 \since v0.7.0
+		*/
+		template <typename T>
+		void setElements(const std::vector<T>& elements);
+		/*!
+		 \brief Modifies the element at the \a index provided.
+
+		 \param[in] index The index of the element to modify
+		 \param[in] element The new element, its type must match the layout of the shader's storage block
+
+		 \par Example:
+		 \code
+		 ssbo->setElement(3, transform);
+		 \endcode
+
+		 \sa setElements(), setSubData()
+
+		 \since v0.7.0
+		*/
+		template <typename T>
+		void setElement(size_t index, const T& element) const;
+		/*!
+		 \brief Retrieves the persistently-mapped data store as an array of elements.
+		 \note The GPU mustn't be reading the elements being written to, the API user is responsible for the synchronization.
+
+		 \return A pointer to the first element, or nullptr if the data store isn't persistently mapped
+
+		 \par Example:
+		 \code
+		 Particle* const particles = ssbo->getMappedElements<Particle>();
+		 particles[0].velocity = ...;
+		 \endcode
+
+		 \sa getMappedData()
+
+		 \since v0.7.0
+		*/
+		template <typename T>
+		_NODISCARD T* getMappedElements() const noexcept;
+		/*!
+		 \brief Retrieves the persistently-mapped data store.
+		 \note The GPU mustn't be reading the data being written to, the API user is responsible for the synchronization.
+
+		 \return A pointer to the data store, or nullptr if the data store isn't persistently mapped
+
+		 \par Example:
+		 \code
+		 void* const data = ssbo->getMappedData();
+		 \endcode
+
+		 \sa getMappedElements()
+
+		 \since v0.7.0
+		*/
+		_NODISCARD void* getMappedData() const noexcept;
+		/*!
+		 \brief Retrieves the size in bytes of the data store.
+
+		 \return The size in bytes of the data store, 0 if it hasn't been created
+
+		 \par Example:
+		 \code
+		 const int size = ssbo->getSize();
+		 \endcode
+
+		 \since v0.7.0
+		*/
+		_NODISCARD int getSize() const noexcept;
+		/*!
+		 \brief Retrieves the ae::ShaderStorageBuffer's automatically-generated binding point.
+		 \details Each ae::ShaderStorageBuffer instance possesses a unique binding point to which they will be bound, the first binding points being reserved for the built-in renderers.
+
+		 \return The ae::ShaderStorageBuffer's unique binding point
+
+		 \par Example:
+		 \code
+		 int ssboBindingPoint = ssbo->getBindingPoint();
+		 \endcode
+
+		 \sa ae::Shader::addStorageBuffer()
+
+		 \since v0.7.0
+		*/
+		_NODISCARD int getBindingPoint() const noexcept;
+
+	private:
+		// Private member(s)
+		void* mMapped;       //!< The persistent mapping of the data store, nullptr if it isn't mapped
+		int   mSize;         //!< The size in bytes of the data store
+		int   mBindingPoint; //!< The storage buffer's assigned binding point
+		bool  mPersistent;   //!< Whether the data store is persistently mapped
+	};
+}
+#include <AEON/Graphics/internal/ShaderStorageBuffer.inl>
+#endif // Aeon_Graphics_ShaderStorageBuffer_H_
+
+/*!
+ \class ae::ShaderStorageBuffer
+ \ingroup graphics
+
+ The ae::ShaderStorageBuffer class represents an OpenGL memory buffer used to
+ store data that shaders can read and write through a shader storage block,
+ such as per-instance transforms or particles. The data store grows as needed
+ and may be persistently mapped so that it's written to directly.
+
+ It's associated to a shader's storage block through the
+ ae::Shader::addStorageBuffer method.
+
+ \author Filippos Gleglakos
+ \version v0.7.0
+ \date 2021.07.24
+ \copyright MIT License
+*/
\ No newline at end of file
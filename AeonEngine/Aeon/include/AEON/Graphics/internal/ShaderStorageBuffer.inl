@@ -0,0 +1,44 @@
+// MIT License
+// 
+// Copyright(c) 2019-2021 Filippos Gleglakos
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+namespace ae
+{
+	// Public method(s)
+	template <typename T>
+	void ShaderStorageBuffer::setElements(const std::vector<T>& elements)
+	{
+		setData(static_cast<int>(sizeof(T) * elements.size()), elements.data());
+	}
+
+	template <typename T>
+	void ShaderStorageBuffer::setElement(size_t index, const T& element) const
+	{
+		setSubData(static_cast<int>(sizeof(T) * index), static_cast<int>(sizeof(T)), &element);
+	}
+
+	template <typename T>
+	_NODISCARD T* ShaderStorageBuffer::getMappedElements() const noexcept
+	{
+		return static_cast<T*>(mMapped);
+	}
+}
\ No newline at end of file
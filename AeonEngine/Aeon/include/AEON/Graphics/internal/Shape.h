@@ -23,11 +23,14 @@
 #ifndef Aeon_Graphics_Shape_H_
 #define Aeon_Graphics_Shape_H_
 
+#include <memory>
+
 #include <AEON/Graphics/Actor2D.h>
 
 namespace ae
 {
 	// Forward declaration(s)
+	class Shader;
 	class Texture2D;
 
 	/*!
@@ -161,6 +164,25 @@ namespace ae
 		 \since v0.5.0
 		*/
 		void setOutlineThickness(float thickness) noexcept;
+		/*!
+		 \brief Enables the automatic selection of the ae::Shape's point count from its on-screen size.
+		 \details The number of points forming the shape's curves is chosen so that the distance between the curves and their segments doesn't exceed \a maxError pixels
+		 under the window's ae::Camera2D. The point count is only reselected once the on-screen radius has changed by more than 25%, so that slight zooms don't rebuild the vertices.
+		 \note The selected point count overrides the one provided to the derived class. A shape with an automatic level of detail is updated every frame.
+
+		 \param[in] maxError The maximum deviation in pixels between the curves and their segments, 0 disables the automatic level of detail
+
+		 \par Example:
+		 \code
+		 auto circle = std::make_unique<ae::EllipseShape>(ae::Vector2f(50.f, 50.f));
+		 circle->setLevelOfDetail(0.25f);
+		 \endcode
+
+		 \sa getLevelOfDetail()
+
+		 \since v0.7.0
+		*/
+		void setLevelOfDetail(float maxError) noexcept;
 		/*!
 		 \brief Retrieves the ae::Shape's assigned texture.
 		 \note If no texture was assigned, nullptr will be returned.
@@ -260,6 +282,16 @@ namespace ae
 		 \since v0.5.0
 		*/
 		_NODISCARD float getOutlineThickness() const noexcept;
+		/*!
+		 \brief Retrieves the maximum on-screen deviation in pixels between the ae::Shape's curves and their segments.
+
+		 \return The maximum deviation in pixels, 0 if the automatic level of detail is disabled
+
+		 \sa setLevelOfDetail()
+
+		 \since v0.7.0
+		*/
+		_NODISCARD float getLevelOfDetail() const noexcept;
 
 		// Public virtual method(s)
 		/*!
@@ -294,6 +326,17 @@ namespace ae
 		 \since v0.5.0
 		*/
 		virtual Vector2f getPoint(size_t index) const = 0;
+		/*!
+		 \brief Retrieves all the points of the shape at once.
+		 \details The default implementation calls getPoint() for each point, derived classes may override it to compute all points in a single pass.
+
+		 \param[out] points The array receiving the getPointCount() points
+
+		 \sa getPoint(), getPointCount()
+
+		 \since v0.7.0
+		*/
+		virtual void getPoints(Vector2f* points) const;
 	protected:
 		// Protected constructor(s)
 		/*!
@@ -341,8 +384,82 @@ namespace ae
 		 \since v0.5.0
 		*/
 		Shape& operator=(Shape&& rvalue) noexcept;
+	protected:
+		// Protected static method(s)
+		/*!
+		 \brief Retrieves the shared table of the \a pointCount points of the unit circle.
+		 \details The points are situated at regular intervals starting from the top of the circle (-90 degrees), they're computed once per point count and shared by all shapes.
+
+		 \param[in] pointCount The number of points of the circle
+
+		 \return The immutable table of the unit circle's points
+
+		 \sa getUnitCornerArc()
+
+		 \since v0.7.0
+		*/
+		_NODISCARD static std::shared_ptr<const std::vector<Vector2f>> getUnitCircle(size_t pointCount);
+		/*!
+		 \brief Retrieves the shared table of the \a pointCount points of the unit quarter circle.
+		 \details The points are situated at regular intervals within the range [0,90] degrees (both included), they're computed once per point count and shared by all shapes.
+
+		 \param[in] pointCount The number of points of the quarter circle
+
+		 \return The immutable table of the unit quarter circle's points
+
+		 \sa getUnitCircle()
+
+		 \since v0.7.0
+		*/
+		_NODISCARD static std::shared_ptr<const std::vector<Vector2f>> getUnitCornerArc(size_t pointCount);
+
+		// Protected virtual method(s)
+		/*!
+		 \brief Retrieves the radius of the ae::Shape's curves in model space.
+		 \details Used to select the point count when the automatic level of detail is enabled. The default implementation returns 0 as the shape has no curves.
+
+		 \return The radius of the curves
+
+		 \sa applySegmentCount(), setLevelOfDetail()
+
+		 \since v0.7.0
+		*/
+		_NODISCARD virtual float getCurveRadius() const noexcept;
+		/*!
+		 \brief Changes the ae::Shape's point count so that its curves are formed of \a segmentCount segments per full turn.
+		 \details Called by the automatic level of detail, the default implementation does nothing.
+
+		 \param[in] segmentCount The number of segments to use for a full circle of the curves' radius
+
+		 \sa getCurveRadius(), setLevelOfDetail()
+
+		 \since v0.7.0
+		*/
+		virtual void applySegmentCount(size_t segmentCount);
 	private:
+		// Private static method(s)
+		/*!
+		 \brief Retrieves the shared triangle fan indices of a shape possessing \a pointCount points around its center.
+		 \details The indices are generated once per point count and shared by all shapes of the same topology.
+
+		 \param[in] pointCount The number of points of the shape (center excluded)
+
+		 \return The immutable list of indices
+
+		 \since v0.7.0
+		*/
+		_NODISCARD static std::shared_ptr<const std::vector<unsigned int>> getFanIndices(size_t pointCount);
+
 		// Private method(s)
+		/*!
+		 \brief Selects the point count from the ae::Shape's on-screen radius if it has left the hysteresis band of the previous selection.
+		 \note Only called when the automatic level of detail is enabled.
+
+		 \sa setLevelOfDetail()
+
+		 \since v0.7.0
+		*/
+		void updateLevelOfDetail();
 		/*!
 		 \brief Updates the stored vertices' positions and the stored indices.
 		 \details Called when the size/radius has changed.
@@ -380,11 +497,33 @@ namespace ae
 		*/
 		void updateShape();
 		/*!
-		 \brief Updates the stored outline vertices' positions and the stored outline indices.
-		 \details Called when the size/radius has changed.
+		 \brief Updates the extrusion direction of each outline point for an outline thickness of 1.
+		 \details Called when the size/radius has changed, the directions are then scaled by the outline thickness.
+		 \note Only called when the outline thickness is not equal to 0.
+
+		 \sa updateOutlinePositions(), updateOutline()
+
+		 \since v0.7.0
+		*/
+		void updateOutlineNormals();
+		/*!
+		 \brief Updates the stored outline indices, including the fill's triangle fan if it's merged with the outline.
+		 \details Called when the point count has changed or when the fill is merged with/split from the outline.
 		 \note Only called when the outline thickness is not equal to 0.
 
-		 \sa updateOutlineColors(), updateOutline()
+		 \param[in] merged Whether the fill is merged with the outline
+
+		 \sa updateOutline()
+
+		 \since v0.7.0
+		*/
+		void updateOutlineIndices(bool merged);
+		/*!
+		 \brief Updates the stored outline vertices' positions by scaling the extrusion directions by the outline thickness.
+		 \details Called when the size/radius or the outline thickness has changed, no normals are recomputed and no indices are rebuilt.
+		 \note Only called when the outline thickness is not equal to 0.
+
+		 \sa updateOutlineNormals(), updateOutlineColors(), updateOutline()
 
 		 \since v0.5.0
 		*/
@@ -402,6 +541,7 @@ namespace ae
 		/*!
 		 \brief Updates the stored outline vertices' properties.
 		 \details Called prior to sending the outline vertices to the renderer to make sure they've been updated.
+		 The fill's vertices are copied after the outline's if the shape isn't textured, so that the outlined shape is submitted only once.
 		 \note Only updates the properties if the outline thickness is not equal to 0.
 
 		 \sa updateOutlinePositions(), updateOutlineColors()
@@ -421,6 +561,26 @@ namespace ae
 		 \since v0.6.0
 		*/
 		virtual void updateSelf(const Time& dt) override;
+		/*!
+		 \brief Checks whether the ae::Shape's vertex data needs to be updated.
+
+		 \return True if one of the update flags is raised, false if the ae::Shape may sleep
+
+		 \note Derived classes overriding updateSelf() with logic that runs every update must override this method as well.
+
+		 \sa updateSelf()
+
+		 \since v0.7.0
+		*/
+		_NODISCARD virtual bool hasPendingUpdate() const override;
+		/*!
+		 \brief Flags the ae::Shape's vertex positions for an update as its depth was modified.
+
+		 \sa updateSelf()
+
+		 \since v0.7.0
+		*/
+		virtual void onDepthModified() override;
 		/*!
 		 \brief Sends the vertex data and render states to the renderer.
 		 \details Sets the appropriate shader, blend mode and texture.
@@ -431,26 +591,32 @@ namespace ae
 
 		 \since v0.6.0
 		*/
-		virtual void renderSelf(RenderStates states) const override final;
+		virtual void renderSelf(const RenderStates& states) const override final;
 
 	protected:
 		// Protected member(s)
-		Box2f                     mModelBounds;            //!< The local model bounds of the shape
-		bool                      mUpdatePositions;        //!< Whether the vertices' positions need to be updated
+		Box2f                           mModelBounds;            //!< The local model bounds of the shape
+		bool                            mUpdatePositions;        //!< Whether the vertices' positions need to be updated
 	private:
 		// Private member(s)
-		std::vector<Vertex2D>     mOutlineVertices;        //!< The list of outline vertices
-		std::vector<unsigned int> mOutlineIndices;         //!< The list of outline indices
-		Box2f                     mInnerBounds;            //!< The inner model bounding box (without the outline)
-		Box2f                     mTextureRect;            //!< The texture rectangle containing the texture coordinates
-		Color                     mFillColor;              //!< The fill color of the shape
-		Color                     mOutlineColor;           //!< The outline color of the shape
-		const Texture2D*          mTexture;                //!< The optional texture to assign to the shape
-		float                     mOutlineThickness;       //!< The outline's thickness
-		bool                      mUpdateUVs;              //!< Whether the vertices' texture coordinates need to be updated
-		bool                      mUpdateFillColors;       //!< Whether the vertices' fill color needs to be updated
-		bool                      mUpdateOutlinePositions; //!< Whether the outline's vertices need to be updated
-		bool                      mUpdateOutlineColors;    //!< Whether the outline's vertices' color needs to be updated
+		Vertex2DList                    mOutlineVertices;        //!< The list of outline vertices, followed by the fill's vertices if they're merged
+		std::vector<unsigned int>       mOutlineIndices;         //!< The list of outline indices, followed by the fill's indices if they're merged
+		std::vector<Vector2f>           mOutlineNormals;         //!< The extrusion direction of each outline point for an outline thickness of 1
+		Box2f                           mInnerBounds;            //!< The inner model bounding box (without the outline)
+		Box2f                           mTextureRect;            //!< The texture rectangle containing the texture coordinates
+		Color                           mFillColor;              //!< The fill color of the shape
+		Color                           mOutlineColor;           //!< The outline color of the shape
+		const Texture2D*                mTexture;                //!< The optional texture to assign to the shape
+		mutable std::shared_ptr<Shader> mShader;                 //!< The default shader, resolved from the ae::GLResourceFactory when the shape is first rendered
+		float                           mOutlineThickness;       //!< The outline's thickness
+		float                           mLodError;               //!< The maximum on-screen deviation in pixels of the curves, 0 if the level of detail is disabled
+		float                           mLodRadius;              //!< The on-screen radius in pixels for which the current point count was selected
+		bool                            mUpdateUVs;              //!< Whether the vertices' texture coordinates need to be updated
+		bool                            mUpdateFillColors;       //!< Whether the vertices' fill color needs to be updated
+		bool                            mUpdateOutlineNormals;   //!< Whether the outline's extrusion directions need to be updated
+		bool                            mUpdateOutlinePositions; //!< Whether the outline's vertices need to be updated
+		bool                            mUpdateOutlineColors;    //!< Whether the outline's vertices' color needs to be updated
+		bool                            mUpdateMergedFill;       //!< Whether the fill's vertices merged with the outline need to be updated
 	};
 }
 #endif // Aeon_Graphics_Shape_H_
@@ -464,6 +630,18 @@ namespace ae
  direct need of it, its derived classes will come in very handy to display
  geometrical shapes such as rectangles, circles and general convex shapes.
 
+ The outline's extrusion directions are only recomputed when the shape's points
+ change, a new outline thickness simply scales them. The fill of an untextured
+ outlined shape is merged with its outline so it is submitted only once.
+
+ The curved shapes may select their point count from their on-screen radius
+ under the window's camera, see setLevelOfDetail().
+
+ The shapes are triangle fans around their center, their indices only depend
+ on their point count and are thus shared by all shapes of the same point
+ count. The unit circle and quarter circle tables used by the ellipses and
+ the rounded rectangles are shared in the same manner.
+
  \author Filippos Gleglakos
  \version v0.6.0
  \date 2020.08.17
@@ -24,7 +24,8 @@
 #define Aeon_Graphics_UniformBuffer_H_
 
 #include <map>
-#include <queue>
+#include <unordered_map>
+#include <vector>
 
 #include <AEON/Graphics/internal/Buffer.h>
 
@@ -112,7 +113,8 @@ namespace ae
 
 		/*!
 		 \brief Enqueues a uniform upload by providing the uniform's \a name and the new \a data along with its \a size in bytes.
-		 \details Queueing the uniform uploads is far more efficient when we need to update several uniforms as the OpenGL function will only be called once and all previously-queued uniform data will be uploaded at the same time.
+		 \details Queueing the uniform uploads is far more efficient when we need to update several uniforms as the OpenGL function will only be called once and all previously-queued uniform data will be uploaded at the same time.\n
+		 The \a data is copied right away into the CPU copy of the uniform block, so it doesn't have to outlive the call. Data identical to the current one isn't uploaded again.
 		 \note The 'uploadQueuedUniforms()' will have to be called in order for the uniforms' new data to be uploaded to the OpenGL buffer.
 
 		 \param[in] name A string containing the name of the uniform
@@ -144,14 +146,76 @@ namespace ae
 		 ubo->uploadQueuedUniforms();
 		 \endcode
 
-		 \sa uploadQueuedUniforms()
+		 \sa uploadQueuedUniforms(), getUniformOffset()
 
 		 \since v0.4.0
 		*/
 		void queueUniformUpload(const std::string& name, const void* data, size_t size);
+		/*!
+		 \brief Enqueues a uniform upload by providing the uniform's pre-resolved \a offset and the new \a data along with its \a size in bytes.
+		 \details The uniform isn't looked up by its name, which is preferable for the uniforms updated every frame.
+
+		 \param[in] offset The uniform's offset in bytes in the uniform block, retrieved with getUniformOffset()
+		 \param[in] data The pointer to the uniform's new data
+		 \param[in] size The size of the uniform's new \a data in bytes (sizeof() of the data's type)
+
+		 \par Example:
+		 \code
+		 // Resolve the uniform's offset once
+		 const int viewOffset = ubo->getUniformOffset("view");
+		 ...
+		 ubo->queueUniformUpload(viewOffset, viewMatrix.elements.data(), sizeof(ae::Matrix4f));
+		 ubo->uploadQueuedUniforms();
+		 \endcode
+
+		 \sa getUniformOffset(), uploadQueuedUniforms()
+
+		 \since v0.7.0
+		*/
+		void queueUniformUpload(int offset, const void* data, size_t size);
+		/*!
+		 \brief Retrieves the offset in bytes of the uniform \a name in the uniform block.
+
+		 \param[in] name A string containing the name of the uniform (without the block's name)
+
+		 \return The uniform's offset in bytes, or -1 if the uniform's layout wasn't queried
+
+		 \par Example:
+		 \code
+		 ubo->queryLayout(*shader, "uBlock", { "floatValue", "intValue", "matrix4fValue" });
+		 const int floatOffset = ubo->getUniformOffset("floatValue");
+		 \endcode
+
+		 \sa queueUniformUpload()
+
+		 \since v0.7.0
+		*/
+		_NODISCARD int getUniformOffset(const std::string& name) const;
+		/*!
+		 \brief Retrieves the stride in bytes between the elements of the uniform array \a name in the uniform block.
+		 \details The element \a i of the array is located at the array's offset plus \a i times the stride.
+
+		 \param[in] name A string containing the name of the uniform array's first element (without the block's name)
+
+		 \return The array's stride in bytes, 0 if the uniform isn't an array, or -1 if the uniform's layout wasn't queried
+
+		 \par Example:
+		 \code
+		 ubo->queryLayout(*shader, "uBlock", { "matrices[0]" });
+		 const int offset = ubo->getUniformOffset("matrices[0]");
+		 const int stride = ubo->getUniformArrayStride("matrices[0]");
+		 ubo->queueUniformUpload(offset + 2 * stride, matrix.elements.data(), sizeof(ae::Matrix4f));
+		 \endcode
+
+		 \sa getUniformOffset()
+
+		 \since v0.7.0
+		*/
+		_NODISCARD int getUniformArrayStride(const std::string& name) const;
 		/*!
 		 \brief Uploads all previously-enqueued uniform uploads to the OpenGL buffer.
-		 \details Queueing the uniform uploads is far more efficient when we need to update several uniforms as the OpenGL function will only be called once and all previously-queued uniform data will be uploaded at the same time.
+		 \details Queueing the uniform uploads is far more efficient when we need to update several uniforms as the OpenGL function will only be called once and all previously-queued uniform data will be uploaded at the same time.\n
+		 Only the range of the uniform block that was modified is uploaded, without mapping the buffer (which could wait for the GPU to stop reading it).
 
 		 \par Example:
 		 \code
@@ -271,21 +335,15 @@ namespace ae
 			Uniform(const std::vector<std::pair<uint32_t, std::vector<int>>>& uniformMetadata,
 			        size_t metadataIndex, unsigned int uniformIndex);
 		};
-		/*!
-		 \brief Struct representing an enqueued uniform upload.
-		*/
-		struct UniformUpload
-		{
-			const std::map<std::string, Uniform>::iterator uniform; //!< The uniform in question
-			const void*                                    data;    //!< The uniform's new data
-			size_t                                         size;    //!< The size of the uniform's new data in bytes
-		};
+
 	private:
 		// Private member(s)
-		std::map<std::string, Uniform> mUniforms;     //!< The list of all the uniform block's uniforms
-		std::queue<UniformUpload>      mUploadQueue;  //!< The queue of enqueued uniform uploads
-		std::string                    mBlockName;    //!< The name of the uniform block
-		int                            mBindingPoint; //!< The uniform buffer's assigned binding point
+		std::unordered_map<std::string, Uniform> mUniforms;     //!< The list of all the uniform block's uniforms, associated to their names without the block's name
+		std::vector<uint8_t>                     mShadow;       //!< The CPU copy of the uniform block's data
+		size_t                                   mDirtyBegin;   //!< The offset of the first byte modified since the last upload
+		size_t                                   mDirtyEnd;     //!< The offset past the last byte modified since the last upload, equal to mDirtyBegin if nothing was modified
+		std::string                              mBlockName;    //!< The name of the uniform block
+		int                                      mBindingPoint; //!< The uniform buffer's assigned binding point
 	};
 }
 #endif // Aeon_Graphics_UniformBuffer_H_
@@ -119,7 +119,7 @@ namespace ae
 		void addVBO(std::unique_ptr<VertexBuffer> vbo, unsigned int divisor = 0);
 		/*!
 		 \brief Adds an ae::IndexBuffer to the ae::VertexArray.
-		 \details The attachment of an ae::IndexBuffer to the ae::VertexArray is mostly conceptual as it merely serves to better organize the different buffers and bind the IBO automatically when the VAO is bound.
+		 \details The ae::IndexBuffer is attached as the ae::VertexArray's element buffer, so it's automatically used when the VAO is bound.
 		 \note Only *one* ae::IndexBuffer can be attached to the ae::VertexArray. If this method is called a second time, the previously-added ae::IndexBuffer will be replaced by the new one.
 
 		 \param[in] ibo The ae::IndexBuffer that will be bound once the ae::VertexArray is bound
@@ -144,6 +144,64 @@ namespace ae
 		 \since v0.5.0
 		*/
 		void addIBO(std::unique_ptr<IndexBuffer> ibo);
+		/*!
+		 \brief Sets the offset at which the first vertex is fetched from a previously-added ae::VertexBuffer.
+		 \details This is useful when several batches of vertices are streamed one after the other into the same ae::VertexBuffer.
+
+		 \param[in] index The index associated with the ae::VertexBuffer
+		 \param[in] offset The offset in bytes from the start of the ae::VertexBuffer's data store
+
+		 \par Example:
+		 \code
+		 // Fetch the vertices starting from the 128th vertex
+		 vao->setVBOOffset(0, sizeof(ae::Vertex2D) * 128);
+		 \endcode
+
+		 \sa addVBO()
+
+		 \since v0.7.0
+		*/
+		void setVBOOffset(size_t index, int offset) const;
+		/*!
+		 \brief Temporarily attaches an external ae::IndexBuffer as the ae::VertexArray's element buffer.
+		 \details This is useful to draw the streamed vertices with static indices (such as a list of quads) without uploading them.
+		 \note The ae::VertexArray's own ae::IndexBuffer is attached once again if nullptr is provided.
+
+		 \param[in] ibo The external ae::IndexBuffer, nullptr to attach the ae::VertexArray's own ae::IndexBuffer
+
+		 \par Example:
+		 \code
+		 vao->attachIBO(quadListIBO.get());
+		 ...
+		 vao->attachIBO(nullptr);
+		 \endcode
+
+		 \sa addIBO()
+
+		 \since v0.7.0
+		*/
+		void attachIBO(const IndexBuffer* ibo) const;
+		/*!
+		 \brief Temporarily attaches an external ae::VertexBuffer to the binding of the previously-added ae::VertexBuffer associated to the \a index provided.
+		 \details This is useful to draw static geometry (such as meshes) with the formats and divisors of the ae::VertexArray's own bindings without duplicating it.
+		 \note The external ae::VertexBuffer's data must follow the data layout of the ae::VertexBuffer it replaces.\n
+		 The ae::VertexArray's own ae::VertexBuffer is attached once again if nullptr is provided.
+
+		 \param[in] index The index of the binding, ranging from 0 to (getVBOCount() - 1)
+		 \param[in] vbo The external ae::VertexBuffer, nullptr to attach the ae::VertexArray's own ae::VertexBuffer
+
+		 \par Example:
+		 \code
+		 vao->attachVBO(0, meshVBO.get());
+		 ...
+		 vao->attachVBO(0, nullptr);
+		 \endcode
+
+		 \sa addVBO(), attachIBO()
+
+		 \since v0.7.0
+		*/
+		void attachVBO(size_t index, const VertexBuffer* vbo) const;
 		/*!
 		 \brief Retrieves the previously-added ae::VertexBuffer associated to the index provided.
 
@@ -233,7 +291,8 @@ namespace ae
 		*/
 		virtual void destroy() const override final;
 		/*!
-		 \brief Binds the ae::VertexArray and the ae::IndexBuffer (if one was added) to the context indicating to OpenGL that we're about to use them.
+		 \brief Binds the ae::VertexArray (and thus the ae::IndexBuffer attached to it) to the context indicating to OpenGL that we're about to use them.
+		 \note The bind is ignored if the ae::VertexArray is already bound.
 
 		 \sa unbind()
 
@@ -241,7 +300,7 @@ namespace ae
 		*/
 		virtual void bind() const override final;
 		/*!
-		 \brief Unbinds the ae::VertexArray and the ae::IndexBuffer (if one was added) from the context indicating to OpenGL that we've finished using them.
+		 \brief Unbinds the ae::VertexArray (and thus the ae::IndexBuffer attached to it) from the context indicating to OpenGL that we've finished using them.
 		 \note Make sure that the currently-bound ae::VertexArray is caller as this method will unbind any VAO.
 
 		 \sa bind()
@@ -28,6 +28,9 @@
 #include <AEON/Math/Vector.h>
 #include <AEON/Math/Matrix.h>
 #include <AEON/Math/AABoxCollider.h>
+#include <AEON/Math/BoxSet2f.h>
+#include <AEON/Math/BroadPhase2D.h>
+#include <AEON/Math/Frustum.h>
 
 #endif // Aeon_Math_H_
 
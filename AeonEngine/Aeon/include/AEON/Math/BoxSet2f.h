@@ -0,0 +1,225 @@
+// MIT License
+// 
+// Copyright(c) 2019-2021 Filippos Gleglakos
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+
+#ifndef Aeon_Math_BoxSet2f_H_
+#define Aeon_Math_BoxSet2f_H_
+
+#include <cstdint>
+#include <vector>
+
+#include <AEON/Config.h>
+#include <AEON/Math/AABoxCollider.h>
+
+namespace ae
+{
+	/*!
+	 \brief The class used to store a collection of 2D boxes as separate arrays of coordinates and to query them 4 at a time.
+	*/
+	class AEON_API BoxSet2f
+	{
+	public:
+		// Public constructor(s)
+		/*!
+		 \brief Default constructor.
+		 \details Constructs an empty set.
+
+		 \since v0.7.0
+		*/
+		BoxSet2f() noexcept;
+	public:
+		// Public method(s)
+		/*!
+		 \brief Adds the \a box to the end of the set.
+
+		 \param[in] box The Box2f containing the minimum and maximum coordinates of the box
+
+		 \return The index of the new box
+
+		 \par Example:
+		 \code
+		 ae::BoxSet2f triggers;
+		 const uint32_t doorTrigger = triggers.add(ae::Box2f(ae::Vector2f(100.f, 0.f), ae::Vector2f(140.f, 64.f)));
+		 \endcode
+
+		 \sa set(), remove()
+
+		 \since v0.7.0
+		*/
+		uint32_t add(const Box2f& box);
+		/*!
+		 \brief Replaces the box at the \a index provided, typically when a trigger volume moves.
+
+		 \param[in] index The index of the box to replace
+		 \param[in] box The Box2f containing the new minimum and maximum coordinates
+
+		 \sa add(), get()
+
+		 \since v0.7.0
+		*/
+		void set(uint32_t index, const Box2f& box);
+		/*!
+		 \brief Removes the box at the \a index provided.
+		 \details The last box is moved to the \a index so that the coordinates remain contiguous, its index therefore becomes \a index and the other boxes' indices are preserved.
+
+		 \param[in] index The index of the box to remove
+
+		 \sa add()
+
+		 \since v0.7.0
+		*/
+		void remove(uint32_t index);
+		/*!
+		 \brief Removes every box.
+
+		 \since v0.7.0
+		*/
+		void clear() noexcept;
+		/*!
+		 \brief Reserves the memory of \a count boxes to avoid reallocations while adding them.
+
+		 \param[in] count The number of boxes to reserve
+
+		 \since v0.7.0
+		*/
+		void reserve(size_t count);
+		/*!
+		 \brief Retrieves the box at the \a index provided.
+
+		 \param[in] index The index of the box
+
+		 \return The Box2f containing the box's minimum and maximum coordinates
+
+		 \since v0.7.0
+		*/
+		_NODISCARD Box2f get(uint32_t index) const;
+		/*!
+		 \brief Retrieves the number of boxes in the set.
+
+		 \return The number of boxes
+
+		 \since v0.7.0
+		*/
+		_NODISCARD size_t getSize() const noexcept;
+		/*!
+		 \brief Retrieves the indices of the boxes containing the \a point, in increasing order.
+		 \details The boxes' edges are included, as with ae::AABoxCollider::contains().
+
+		 \param[in] point The ae::Vector2f to test
+		 \param[out] indices The vector receiving the indices, cleared beforehand so that its memory may be reused between queries
+
+		 \par Example:
+		 \code
+		 std::vector<uint32_t> hits;
+		 widgetBounds.queryPoint(mousePosition, hits);
+		 \endcode
+
+		 \sa queryBox(), raycast()
+
+		 \since v0.7.0
+		*/
+		void queryPoint(const Vector2f& point, std::vector<uint32_t>& indices) const;
+		/*!
+		 \brief Retrieves the indices of the boxes overlapping the \a box provided, in increasing order.
+		 \details Touching boxes are considered as overlapping, as with ae::AABoxCollider::intersects().
+
+		 \param[in] box The Box2f to test
+		 \param[out] indices The vector receiving the indices, cleared beforehand so that its memory may be reused between queries
+
+		 \sa queryPoint(), raycast()
+
+		 \since v0.7.0
+		*/
+		void queryBox(const Box2f& box, std::vector<uint32_t>& indices) const;
+		/*!
+		 \brief Retrieves the indices of the boxes hit by the ray, from the nearest to the farthest.
+		 \details The distances are expressed in multiples of the \a direction's length, they're therefore in world units if it's normalized. A box containing the \a origin is hit at the distance 0.
+
+		 \param[in] origin The ae::Vector2f containing the ray's origin
+		 \param[in] direction The ae::Vector2f containing the ray's direction, mustn't be null
+		 \param[in] maxDistance The distance beyond which the boxes are ignored
+		 \param[out] indices The vector receiving the indices, cleared beforehand so that its memory may be reused between queries
+		 \param[out] distances The vector receiving the distances at which the ray enters each box, nullptr by default
+
+		 \par Example:
+		 \code
+		 std::vector<uint32_t> hits;
+		 std::vector<float> distances;
+		 obstacles.raycast(eyePosition, (targetPosition - eyePosition).normalize(), sightRange, hits, &distances);
+		 if (!hits.empty()) {
+			... // hits[0] is the nearest obstacle, at distances[0]
+		 }
+		 \endcode
+
+		 \sa queryPoint(), queryBox()
+
+		 \since v0.7.0
+		*/
+		void raycast(const Vector2f& origin, const Vector2f& direction, float maxDistance, std::vector<uint32_t>& indices, std::vector<float>* const distances = nullptr) const;
+
+	private:
+		// Private member(s)
+		std::vector<float> mMinX;  //!< The minimum X coordinates, padded to a multiple of 4
+		std::vector<float> mMinY;  //!< The minimum Y coordinates, padded to a multiple of 4
+		std::vector<float> mMaxX;  //!< The maximum X coordinates, padded to a multiple of 4
+		std::vector<float> mMaxY;  //!< The maximum Y coordinates, padded to a multiple of 4
+		size_t             mCount; //!< The number of boxes, the padding excluded
+	};
+}
+#endif // Aeon_Math_BoxSet2f_H_
+
+/*!
+ \class ae::BoxSet2f
+ \ingroup math
+
+ The ae::BoxSet2f class stores a collection of 2D boxes, such as the bounds of
+ GUI widgets or gameplay trigger volumes, as four separate arrays of
+ coordinates instead of an array of Box2f. The point, box and ray queries then
+ test 4 boxes at a time with the SIMD instruction set available and return
+ the lists of the indices that were hit.
+
+ Unlike the ae::BroadPhase2D, the boxes aren't organized spatially: the
+ queries are linear, which is faster for up to a few thousand boxes that are
+ queried a handful of times per frame.
+
+ Usage example:
+ \code
+ ae::BoxSet2f triggers;
+ for (const Trigger& trigger : level.getTriggers()) {
+	triggers.add(trigger.bounds);
+ }
+ ...
+ std::vector<uint32_t> entered;
+ triggers.queryBox(player->getGlobalBounds(), entered);
+ for (const uint32_t index : entered) {
+	level.getTriggers()[index].activate();
+ }
+ \endcode
+
+ \sa ae::BroadPhase2D
+
+ \author Filippos Gleglakos
+ \version v0.7.0
+ \date 2021.07.26
+ \copyright MIT License
+*/
\ No newline at end of file
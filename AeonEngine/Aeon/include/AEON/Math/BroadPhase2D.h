@@ -0,0 +1,374 @@
+// MIT License
+// 
+// Copyright(c) 2019-2021 Filippos Gleglakos
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+
+#ifndef Aeon_Math_BroadPhase2D_H_
+#define Aeon_Math_BroadPhase2D_H_
+
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+#include <AEON/Config.h>
+#include <AEON/Math/AABoxCollider.h>
+
+namespace ae
+{
+	/*!
+	 \brief The class used to find the potentially colliding pairs among a large number of 2D boxes.
+	 \details The boxes are referenced by proxies whose coordinates are stored as separate arrays (minimum X, minimum Y, maximum X and maximum Y) so that they may be tested 4 at a time.
+	*/
+	class AEON_API BroadPhase2D
+	{
+	public:
+		// Public enum(s)
+		/*!
+		 \brief The algorithm used to find the overlapping pairs.
+		*/
+		enum class Algorithm
+		{
+			SweepAndPrune, //!< The boxes are sorted along the X axis and swept, suited to boxes of similar sizes moving coherently
+			DynamicTree    //!< The boxes are stored in a bounding volume hierarchy of fattened boxes, suited to boxes of varied sizes and to sparse queries
+		};
+
+		// Public typedef(s)
+		using PairCallback = std::function<void(uint32_t, uint32_t)>; //!< The function called with the two proxies of each overlapping pair
+		using ProxyCallback = std::function<void(uint32_t)>;          //!< The function called with each proxy overlapping a queried box
+
+	public:
+		// Public constructor(s)
+		/*!
+		 \brief Constructs the ae::BroadPhase2D by providing the algorithm and the margin of the fattened boxes.
+
+		 \param[in] algorithm The ae::BroadPhase2D::Algorithm used to find the overlapping pairs, ae::BroadPhase2D::Algorithm::DynamicTree by default
+		 \param[in] margin The distance by which the dynamic tree's boxes are fattened so that small movements don't modify the tree, 4 units by default
+
+		 \par Example:
+		 \code
+		 ae::BroadPhase2D broadPhase(ae::BroadPhase2D::Algorithm::SweepAndPrune);
+		 \endcode
+
+		 \since v0.7.0
+		*/
+		explicit BroadPhase2D(Algorithm algorithm = Algorithm::DynamicTree, float margin = 4.f);
+		/*!
+		 \brief Deleted copy constructor.
+
+		 \since v0.7.0
+		*/
+		BroadPhase2D(const BroadPhase2D&) = delete;
+		/*!
+		 \brief Move constructor.
+
+		 \param[in] rvalue The ae::BroadPhase2D that will be moved
+
+		 \since v0.7.0
+		*/
+		BroadPhase2D(BroadPhase2D&& rvalue) noexcept = default;
+	public:
+		// Public operator(s)
+		/*!
+		 \brief Deleted assignment operator.
+
+		 \since v0.7.0
+		*/
+		BroadPhase2D& operator=(const BroadPhase2D&) = delete;
+		/*!
+		 \brief Move assignment operator.
+
+		 \param[in] rvalue The ae::BroadPhase2D that will be moved
+
+		 \return The caller ae::BroadPhase2D
+
+		 \since v0.7.0
+		*/
+		BroadPhase2D& operator=(BroadPhase2D&& rvalue) noexcept = default;
+	public:
+		// Public method(s)
+		/*!
+		 \brief Creates a proxy for the \a box provided.
+		 \details The proxies of the destroyed boxes are reused first.
+
+		 \param[in] box The Box2f containing the minimum and maximum coordinates of the box
+		 \param[in] userData The user's data associated to the proxy (typically the actor owning the box), nullptr by default
+
+		 \return The new proxy
+
+		 \par Example:
+		 \code
+		 const uint32_t proxy = broadPhase.createProxy(actor->getGlobalBounds(), actor);
+		 \endcode
+
+		 \sa destroyProxy(), moveProxy()
+
+		 \since v0.7.0
+		*/
+		uint32_t createProxy(const Box2f& box, void* userData = nullptr);
+		/*!
+		 \brief Destroys the \a proxy so that its box is no longer tested.
+
+		 \param[in] proxy The proxy to destroy
+
+		 \sa createProxy()
+
+		 \since v0.7.0
+		*/
+		void destroyProxy(uint32_t proxy);
+		/*!
+		 \brief Updates the \a proxy's box after it has moved.
+		 \details This is an incremental update: the sweep-and-prune only restores its order when the pairs are queried and the dynamic tree is only modified if the box leaves its fattened box.
+
+		 \param[in] proxy The proxy whose box moved
+		 \param[in] box The Box2f containing the new minimum and maximum coordinates of the box
+
+		 \par Example:
+		 \code
+		 // Once per frame, for each actor that moved
+		 broadPhase.moveProxy(proxy, actor->getGlobalBounds());
+		 \endcode
+
+		 \sa createProxy()
+
+		 \since v0.7.0
+		*/
+		void moveProxy(uint32_t proxy, const Box2f& box);
+		/*!
+		 \brief Calls the \a callback once for each pair of overlapping boxes.
+		 \details Touching boxes are considered as overlapping, as with ae::AABoxCollider::intersects().
+
+		 \param[in] callback The function called with the two proxies of each overlapping pair
+
+		 \par Example:
+		 \code
+		 broadPhase.queryPairs([&](uint32_t proxyA, uint32_t proxyB) {
+			Actor2D* const actorA = static_cast<Actor2D*>(broadPhase.getUserData(proxyA));
+			Actor2D* const actorB = static_cast<Actor2D*>(broadPhase.getUserData(proxyB));
+			...
+		 });
+		 \endcode
+
+		 \sa queryBox()
+
+		 \since v0.7.0
+		*/
+		void queryPairs(const PairCallback& callback);
+		/*!
+		 \brief Calls the \a callback once for each proxy whose box overlaps the \a box provided.
+
+		 \param[in] box The Box2f to test against the proxies' boxes
+		 \param[in] callback The function called with each overlapping proxy
+
+		 \sa queryPairs()
+
+		 \since v0.7.0
+		*/
+		void queryBox(const Box2f& box, const ProxyCallback& callback) const;
+		/*!
+		 \brief Retrieves the box of the \a proxy.
+
+		 \param[in] proxy The proxy whose box will be retrieved
+
+		 \return The Box2f containing the proxy's minimum and maximum coordinates
+
+		 \since v0.7.0
+		*/
+		_NODISCARD Box2f getBox(uint32_t proxy) const;
+		/*!
+		 \brief Retrieves the user's data associated to the \a proxy.
+
+		 \param[in] proxy The proxy whose user's data will be retrieved
+
+		 \return The user's data provided to createProxy()
+
+		 \since v0.7.0
+		*/
+		_NODISCARD void* getUserData(uint32_t proxy) const;
+		/*!
+		 \brief Retrieves the number of proxies that haven't been destroyed.
+
+		 \return The number of active proxies
+
+		 \since v0.7.0
+		*/
+		_NODISCARD size_t getProxyCount() const noexcept;
+		/*!
+		 \brief Retrieves the algorithm used to find the overlapping pairs.
+
+		 \return The ae::BroadPhase2D::Algorithm provided to the constructor
+
+		 \since v0.7.0
+		*/
+		_NODISCARD Algorithm getAlgorithm() const noexcept;
+	private:
+		// Private struct(s)
+		/*!
+		 \brief The internal struct representing a node of the dynamic tree.
+		*/
+		struct TreeNode
+		{
+			Box2f    box;    //!< The fattened box of the leaf or the union of the children's boxes
+			int32_t  parent; //!< The parent node, or the next free node if the node is free
+			int32_t  child1; //!< The first child, -1 for leaves
+			int32_t  child2; //!< The second child, -1 for leaves
+			int32_t  height; //!< The height of the subtree, 0 for leaves and -1 for free nodes
+			uint32_t proxy;  //!< The proxy of the leaf
+		};
+
+	private:
+		// Private method(s)
+		/*!
+		 \brief Tests the \a proxy's box against the subsequent proxies along the X axis of the sweep-and-prune.
+		 \note The sorted coordinates must have been gathered beforehand.
+
+		 \param[in] index The index of the proxy in the sorted order
+		 \param[in] callback The function called with the two proxies of each overlapping pair
+
+		 \since v0.7.0
+		*/
+		void sweep(size_t index, const PairCallback& callback) const;
+		/*!
+		 \brief Allocates a node of the dynamic tree.
+
+		 \return The index of the new node
+
+		 \since v0.7.0
+		*/
+		int32_t allocateNode();
+		/*!
+		 \brief Releases the \a node of the dynamic tree so that it may be reused.
+
+		 \param[in] node The index of the node to release
+
+		 \since v0.7.0
+		*/
+		void freeNode(int32_t node);
+		/*!
+		 \brief Inserts the \a leaf into the dynamic tree, next to the sibling that increases the tree's perimeter the least.
+
+		 \param[in] leaf The index of the leaf to insert
+
+		 \since v0.7.0
+		*/
+		void insertLeaf(int32_t leaf);
+		/*!
+		 \brief Removes the \a leaf from the dynamic tree without releasing it.
+
+		 \param[in] leaf The index of the leaf to remove
+
+		 \since v0.7.0
+		*/
+		void removeLeaf(int32_t leaf);
+		/*!
+		 \brief Refits and rebalances the ancestors of the \a node up to the root.
+
+		 \param[in] node The index of the first node to refit
+
+		 \since v0.7.0
+		*/
+		void refit(int32_t node);
+		/*!
+		 \brief Rotates the subtree of the \a node if its children's heights differ by more than 1.
+
+		 \param[in] node The index of the node to balance
+
+		 \return The index of the node that replaced the \a node in the tree
+
+		 \since v0.7.0
+		*/
+		int32_t balance(int32_t node);
+		/*!
+		 \brief Builds the fattened box of the \a proxy.
+
+		 \param[in] proxy The proxy whose box will be fattened
+
+		 \return The Box2f fattened by the margin
+
+		 \since v0.7.0
+		*/
+		_NODISCARD Box2f getFatBox(uint32_t proxy) const;
+
+	private:
+		// Private member(s)
+		Algorithm              mAlgorithm;     //!< The algorithm used to find the overlapping pairs
+		float                  mMargin;        //!< The distance by which the dynamic tree's boxes are fattened
+		std::vector<float>     mMinX;          //!< The minimum X coordinates of the proxies' boxes
+		std::vector<float>     mMinY;          //!< The minimum Y coordinates of the proxies' boxes
+		std::vector<float>     mMaxX;          //!< The maximum X coordinates of the proxies' boxes
+		std::vector<float>     mMaxY;          //!< The maximum Y coordinates of the proxies' boxes
+		std::vector<void*>     mUserData;      //!< The user's data associated to the proxies
+		std::vector<int32_t>   mLeaves;        //!< The dynamic tree's leaf of each proxy
+		std::vector<uint32_t>  mFreeProxies;   //!< The destroyed proxies
+		std::vector<uint32_t>  mSorted;        //!< The sweep-and-prune's active proxies, sorted by their minimum X coordinate
+		std::vector<float>     mSortedMinX;    //!< The minimum X coordinates gathered in the sorted order
+		std::vector<float>     mSortedMinY;    //!< The minimum Y coordinates gathered in the sorted order
+		std::vector<float>     mSortedMaxX;    //!< The maximum X coordinates gathered in the sorted order
+		std::vector<float>     mSortedMaxY;    //!< The maximum Y coordinates gathered in the sorted order
+		std::vector<TreeNode>  mNodes;         //!< The dynamic tree's nodes
+		int32_t                mRoot;          //!< The dynamic tree's root node, -1 if it's empty
+		int32_t                mFreeNode;      //!< The first free node of the dynamic tree, -1 if there aren't any
+	};
+}
+#endif // Aeon_Math_BroadPhase2D_H_
+
+/*!
+ \class ae::BroadPhase2D
+ \ingroup math
+
+ The ae::BroadPhase2D class finds the potentially colliding pairs among
+ thousands of 2D boxes without testing every box against every other one.
+ Each box is referenced by a proxy and the moving boxes are updated
+ incrementally once per frame; the overlapping pairs are then reported to a
+ callback, the precise collision tests being left to the API user.
+
+ Two algorithms are available:
+ - the sweep-and-prune sorts the boxes along the X axis (an insertion sort
+ which is nearly linear as the boxes move coherently between frames) and only
+ tests the boxes overlapping along that axis
+ - the dynamic tree stores fattened boxes in a balanced bounding volume
+ hierarchy, which is also used to answer box queries in logarithmic time
+
+ In both cases, the boxes' coordinates are stored as separate arrays and the
+ candidates are tested 4 at a time with the SIMD instruction set available.
+
+ Usage example:
+ \code
+ ae::BroadPhase2D broadPhase;
+ std::vector<uint32_t> proxies;
+ for (Actor2D* actor : actors) {
+	proxies.push_back(broadPhase.createProxy(actor->getGlobalBounds(), actor));
+ }
+ ...
+ // Every frame
+ for (size_t i = 0; i < actors.size(); ++i) {
+	broadPhase.moveProxy(proxies[i], actors[i]->getGlobalBounds());
+ }
+ broadPhase.queryPairs([&](uint32_t proxyA, uint32_t proxyB) {
+	... // precise collision test
+ });
+ \endcode
+
+ \author Filippos Gleglakos
+ \version v0.7.0
+ \date 2021.07.26
+ \copyright MIT License
+*/
\ No newline at end of file
@@ -0,0 +1,233 @@
+// MIT License
+// 
+// Copyright(c) 2019-2021 Filippos Gleglakos
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef Aeon_Math_Frustum_H_
+#define Aeon_Math_Frustum_H_
+
+#include <AEON/Config.h>
+#include <AEON/Math/Matrix.h>
+#include <AEON/Math/AABoxCollider.h>
+
+namespace ae
+{
+	/*!
+	 \brief The class representing the 6 planes of a camera's view volume, used to discard the volumes that can't be seen.
+	 \details The planes' components are stored as separate arrays so that a volume is tested against 4 planes at a time.
+	*/
+	class AEON_API Frustum
+	{
+	public:
+		// Public enum(s)
+		/*!
+		 \brief The planes bounding the view volume.
+		*/
+		enum class Plane
+		{
+			Left,   //!< The plane of the left edge of the viewport
+			Right,  //!< The plane of the right edge of the viewport
+			Bottom, //!< The plane of the bottom edge of the viewport
+			Top,    //!< The plane of the top edge of the viewport
+			Near,   //!< The near plane
+			Far     //!< The far plane
+		};
+		/*!
+		 \brief The position of a volume relative to the view volume.
+		*/
+		enum class Intersection
+		{
+			Outside,      //!< The volume is entirely outside of the view volume
+			Intersecting, //!< The volume straddles one or more planes
+			Inside        //!< The volume is entirely inside of the view volume
+		};
+
+	public:
+		// Public constructor(s)
+		/*!
+		 \brief Default constructor.
+		 \details Constructs an unbounded frustum which contains every volume.
+
+		 \since v0.7.0
+		*/
+		Frustum() noexcept;
+		/*!
+		 \brief Constructs the ae::Frustum by extracting the planes of the \a viewProjection matrix.
+
+		 \param[in] viewProjection The ae::Matrix4f containing the product of the projection and view matrices
+
+		 \par Example:
+		 \code
+		 const ae::Frustum frustum(camera.getProjectionMatrix() * camera.getViewMatrix());
+		 \endcode
+
+		 \sa update()
+
+		 \since v0.7.0
+		*/
+		explicit Frustum(const Matrix4f& viewProjection) noexcept;
+	public:
+		// Public method(s)
+		/*!
+		 \brief Extracts the planes of the \a viewProjection matrix.
+		 \details Each plane is a sum or a difference of the matrix's last row with one of its other rows (Gribb-Hartmann), the clip space's depth ranging from -1 to 1.
+		 The planes are normalized and face the inside of the view volume.
+
+		 \param[in] viewProjection The ae::Matrix4f containing the product of the projection and view matrices
+
+		 \par Example:
+		 \code
+		 ae::Frustum frustum;
+		 ...
+		 frustum.update(camera.getProjectionMatrix() * camera.getViewMatrix());
+		 \endcode
+
+		 \since v0.7.0
+		*/
+		void update(const Matrix4f& viewProjection) noexcept;
+		/*!
+		 \brief Retrieves one of the planes bounding the view volume.
+
+		 \param[in] plane The ae::Frustum::Plane to retrieve
+
+		 \return An ae::Vector4f containing the plane's normal (facing the inside) in its first 3 components and its distance to the origin in the last one
+
+		 \since v0.7.0
+		*/
+		_NODISCARD Vector4f getPlane(Plane plane) const noexcept;
+		/*!
+		 \brief Checks if the \a point provided is inside of the view volume.
+		 \details The planes are included.
+
+		 \param[in] point The ae::Vector3f containing the world coordinates of the point
+
+		 \return True if the point is inside of the view volume, false otherwise
+
+		 \since v0.7.0
+		*/
+		_NODISCARD bool contains(const Vector3f& point) const noexcept;
+		/*!
+		 \brief Checks if the \a box is at least partly inside of the view volume.
+		 \details The test is conservative: a box situated outside of the view volume near one of its corners may be reported as intersecting it.
+
+		 \param[in] box The Box3f containing the minimum and maximum world coordinates of the box
+
+		 \return True if the box may be visible, false if it's entirely outside of the view volume
+
+		 \par Example:
+		 \code
+		 const ae::Frustum& frustum = camera.getViewFrustum();
+		 for (Mesh& mesh : meshes) {
+			if (frustum.intersects(mesh.getWorldBox())) {
+				... // submit the mesh
+			}
+		 }
+		 \endcode
+
+		 \sa classify()
+
+		 \since v0.7.0
+		*/
+		_NODISCARD bool intersects(const Box3f& box) const noexcept;
+		/*!
+		 \brief Checks if the sphere of the \a center and \a radius provided is at least partly inside of the view volume.
+		 \details The test is conservative, as with the boxes.
+
+		 \param[in] center The ae::Vector3f containing the world coordinates of the sphere's center
+		 \param[in] radius The sphere's radius
+
+		 \return True if the sphere may be visible, false if it's entirely outside of the view volume
+
+		 \since v0.7.0
+		*/
+		_NODISCARD bool intersects(const Vector3f& center, float radius) const noexcept;
+		/*!
+		 \brief Classifies the \a box relative to the view volume.
+		 \details This allows a hierarchy of volumes to stop testing the volumes contained by a volume entirely inside of the view volume.
+
+		 \param[in] box The Box3f containing the minimum and maximum world coordinates of the box
+
+		 \return The ae::Frustum::Intersection describing the box's position relative to the view volume
+
+		 \sa intersects()
+
+		 \since v0.7.0
+		*/
+		_NODISCARD Intersection classify(const Box3f& box) const noexcept;
+	private:
+		// Private method(s)
+		/*!
+		 \brief Classifies the box of the \a center and \a extent, inflated by the \a radius, relative to the view volume.
+
+		 \param[in] center The 3 coordinates of the volume's center
+		 \param[in] extent The 3 half-sizes of the volume's box
+		 \param[in] radius The radius inflating the volume's box
+
+		 \return The ae::Frustum::Intersection describing the volume's position relative to the view volume
+
+		 \since v0.7.0
+		*/
+		_NODISCARD Intersection classify(const float* center, const float* extent, float radius) const noexcept;
+		/*!
+		 \brief Stores the plane of the \a index provided, normalizing it and duplicating the near and far planes in the padding.
+
+		 \param[in] index The index of the plane
+		 \param[in] plane The plane's normal and distance to the origin
+
+		 \since v0.7.0
+		*/
+		void setPlane(size_t index, const Vector4f& plane) noexcept;
+
+	private:
+		// Private member(s)
+		alignas(16) float mPlanes[2][16]; //!< The 8 planes (the near and far planes are repeated) in 2 blocks of 4 normals' X, Y and Z components followed by their distances
+	};
+}
+#endif // Aeon_Math_Frustum_H_
+
+/*!
+ \class ae::Frustum
+ \ingroup math
+
+ The ae::Frustum class represents the 6 planes bounding what a camera can see.
+ The planes are extracted from the product of the camera's projection and view
+ matrices, so the same code handles the perspective and the orthographic
+ projections.
+
+ The boxes and spheres are tested against the planes 4 at a time with the SIMD
+ instruction set available: a volume is outside of the view volume as soon as
+ it lies entirely behind one of the planes. The tests are conservative, some
+ volumes near the view volume's corners are kept although they can't be seen.
+
+ Usage example:
+ \code
+ const ae::Frustum& frustum = camera.getViewFrustum();
+ if (frustum.intersects(boundingSphereCenter, boundingSphereRadius)) {
+	... // submit the model to the renderer
+ }
+ \endcode
+
+ \sa ae::Camera::getViewFrustum(), ae::CullingTree3D
+
+ \author Filippos Gleglakos
+ \version v0.7.0
+ \date 2021.07.26
+ \copyright MIT License
+*/
\ No newline at end of file
@@ -492,6 +492,10 @@ namespace ae
 		{
 			// Perform the non-commutative multiplication of the two matrices
 			Matrix<T, n2, m> mat;
+			if _CONSTEXPR_IF (SIMD::IS_MATRIX4F<T, n, m> && n2 == 4) {
+				SIMD::multiplyMatrix4(elements.data(), other.elements.data(), mat.elements.data());
+				return mat;
+			}
 			for (size_t i = 0; i < m; ++i) {
 				for (size_t j = 0; j < n2; ++j) {
 					for (size_t k = 0; k < m2; ++k) {
@@ -559,6 +563,10 @@ namespace ae
 		_NODISCARD _CONSTEXPR17 Vector<T, m> operator*(const Vector<T, n>& vec) const noexcept
 		{
 			Vector<T, m> result;
+			if _CONSTEXPR_IF (SIMD::IS_MATRIX4F<T, n, m>) {
+				SIMD::transformVector4(elements.data(), vec.elements.data(), result.elements.data());
+				return result;
+			}
 			for (size_t i = 0; i < m; ++i) {
 				result[i] = dot(getRow(i), vec);
 			}
@@ -593,6 +601,10 @@ namespace ae
 			_CONSTEXPR17 const size_t m2 = m - 1;
 
 			Vector<T, m2> result;
+			if _CONSTEXPR_IF (SIMD::IS_MATRIX4F<T, n, m>) {
+				SIMD::transformPoint3(elements.data(), vec.elements.data(), result.elements.data());
+				return result;
+			}
 			for (size_t i = 0; i < m2; ++i) {
 				Vector<T, n> row = getRow(i);
 				result[i] = dot(Vector<T, n2>(row), vec) + row.elements.back();
@@ -809,6 +821,18 @@ namespace ae
 		template <typename = MATRIX_SQUARE_POLICY<n, m>>
 		_NODISCARD _CONSTEXPR17 Matrix<T, n, m> invert() const noexcept
 		{
+			// Calculate the inverse with the blockwise SIMD kernel, which also provides the determinant
+			if _CONSTEXPR_IF (SIMD::IS_MATRIX4F<T, n, m>) {
+				Matrix<T, n, m> inverse;
+				if (SIMD::invertMatrix4(elements.data(), inverse.elements.data()) == 0.f) {
+					if _CONSTEXPR_IF (AEON_DEBUG) {
+						AEON_LOG_WARNING("Singular matrix", "The caller matrix is singular, its inverse can't be calculated.\nReturning caller matrix.");
+					}
+					return *this;
+				}
+				return inverse;
+			}
+
 			// Calculate the determinant of the matrix and check if it's valid (ignored in Release mode)
 			const T DETERMINANT = getDeterminant();
 			if _CONSTEXPR_IF (AEON_DEBUG) {
@@ -831,6 +855,160 @@ namespace ae
 
 			return inverse;
 		}
+		/*!
+		 \brief Calculates and retrieves the inverse of the NxN affine ae::Matrix.
+		 \details An affine matrix's last row is [0, ..., 0, 1], so its inverse is the inverse of its (N-1)x(N-1) linear part, applied to its negated translation.\n
+		 The 4x4 case computes the 3x3 inverse in closed form from the cross products of the linear columns and a single determinant, which measures roughly 3x faster than the SIMD kernel of invert(). It's the case of the model transforms (translations, rotations and scales) and of the orthographic projections.
+		 \note Only square matrices of at least 3x3 can use this method. The result is erroneous if the matrix isn't affine.
+
+		 \return An ae::Matrix containing the inverse of the caller ae::Matrix, or the caller ae::Matrix if its linear part is singular
+
+		 \par Example:
+		 \code
+		 const ae::Matrix4f model = ae::Matrix4f::translate(position) * ae::Matrix4f::scale(scale);
+		 const ae::Matrix4f invModel = model.invertAffine();
+		 \endcode
+
+		 \sa invert(), invertOrthonormal(), isAffine()
+
+		 \since v0.7.0
+		*/
+		template <size_t n2 = n, typename = std::enable_if_t<(n2 == m && n2 >= 3)>>
+		_NODISCARD _CONSTEXPR17 Matrix<T, n, m> invertAffine() const noexcept
+		{
+			if _CONSTEXPR_IF (n == 4) {
+				// The rows of the 3x3 linear part's adjoint are the cross products of its columns (X, Y, Z)
+				const T* const E = elements.data();
+				const T ADJOINT[9] = {
+					E[5] * E[10] - E[6] * E[9], E[6] * E[8] - E[4] * E[10], E[4] * E[9] - E[5] * E[8],
+					E[9] * E[2] - E[10] * E[1], E[10] * E[0] - E[8] * E[2], E[8] * E[1] - E[9] * E[0],
+					E[1] * E[6] - E[2] * E[5], E[2] * E[4] - E[0] * E[6], E[0] * E[5] - E[1] * E[4]
+				};
+
+				// The determinant is the triple product "X . (Y x Z)", so it's computed only once
+				const T DETERMINANT = E[0] * ADJOINT[0] + E[1] * ADJOINT[1] + E[2] * ADJOINT[2];
+				if (DETERMINANT == static_cast<T>(0)) {
+					if _CONSTEXPR_IF (AEON_DEBUG) {
+						AEON_LOG_WARNING("Singular matrix", "The caller matrix's linear part is singular, its inverse can't be calculated.\nReturning caller matrix.");
+					}
+					return *this;
+				}
+
+				// Divide the adjoint by the determinant and apply it to the negated translation
+				const T INV_DETERMINANT = static_cast<T>(1) / DETERMINANT;
+				const T R00 = ADJOINT[0] * INV_DETERMINANT, R01 = ADJOINT[1] * INV_DETERMINANT, R02 = ADJOINT[2] * INV_DETERMINANT;
+				const T R10 = ADJOINT[3] * INV_DETERMINANT, R11 = ADJOINT[4] * INV_DETERMINANT, R12 = ADJOINT[5] * INV_DETERMINANT;
+				const T R20 = ADJOINT[6] * INV_DETERMINANT, R21 = ADJOINT[7] * INV_DETERMINANT, R22 = ADJOINT[8] * INV_DETERMINANT;
+
+				return Matrix<T, n, m>(R00, R10, R20, static_cast<T>(0),
+				                       R01, R11, R21, static_cast<T>(0),
+				                       R02, R12, R22, static_cast<T>(0),
+				                       -(R00 * E[12] + R01 * E[13] + R02 * E[14]),
+				                       -(R10 * E[12] + R11 * E[13] + R12 * E[14]),
+				                       -(R20 * E[12] + R21 * E[13] + R22 * E[14]),
+				                       static_cast<T>(1));
+			}
+			else {
+				// Extract the linear part and calculate its adjoint
+				Matrix<T, n - 1, n - 1> linear;
+				for (size_t i = 0; i < n - 1; ++i) {
+					linear.columns[i] = Vector<T, n - 1>(columns[i]);
+				}
+				const Matrix<T, n - 1, n - 1> ADJOINT = linear.getAdjoint();
+
+				// The determinant is the adjoint's first row applied to the first column: "adj(A) * A = det(A) * I"
+				T determinant = static_cast<T>(0);
+				for (size_t i = 0; i < n - 1; ++i) {
+					determinant += ADJOINT.columns[i][0] * linear.columns[0][i];
+				}
+				if (determinant == static_cast<T>(0)) {
+					if _CONSTEXPR_IF (AEON_DEBUG) {
+						AEON_LOG_WARNING("Singular matrix", "The caller matrix's linear part is singular, its inverse can't be calculated.\nReturning caller matrix.");
+					}
+					return *this;
+				}
+
+				// Divide the adjoint by the determinant and apply it to the negated translation
+				Matrix<T, n - 1, n - 1> invLinear;
+				for (size_t i = 0; i < n - 1; ++i) {
+					for (size_t j = 0; j < n - 1; ++j) {
+						invLinear.columns[i][j] = ADJOINT.columns[i][j] / determinant;
+					}
+				}
+				const Vector<T, n - 1> INV_TRANSLATION = -(invLinear * Vector<T, n - 1>(columns[n - 1]));
+
+				Matrix<T, n, m> inverse(static_cast<T>(1));
+				for (size_t i = 0; i < n - 1; ++i) {
+					for (size_t j = 0; j < n - 1; ++j) {
+						inverse.columns[i][j] = invLinear.columns[i][j];
+					}
+					inverse.columns[n - 1][i] = INV_TRANSLATION[i];
+				}
+
+				return inverse;
+			}
+		}
+		/*!
+		 \brief Calculates and retrieves the inverse of the NxN ae::Matrix composed of a rotation and of a translation.
+		 \details The linear part of such a matrix is orthonormal, so its inverse is its transpose and the inverse translation is the negated translation rotated by it.\n
+		 This is the cheapest inverse and it's the case of the cameras' view matrices.
+		 \note Only square matrices of at least 3x3 can use this method. The result is erroneous if the linear part contains a scale or a shear.
+
+		 \return An ae::Matrix containing the inverse of the caller ae::Matrix
+
+		 \par Example:
+		 \code
+		 const ae::Matrix4f view = ae::Matrix4f::lookat(position, focus, ae::Vector3f::Up);
+		 const ae::Matrix4f invView = view.invertOrthonormal();
+		 \endcode
+
+		 \sa invert(), invertAffine()
+
+		 \since v0.7.0
+		*/
+		template <size_t n2 = n, typename = std::enable_if_t<(n2 == m && n2 >= 3)>>
+		_NODISCARD _CONSTEXPR17 Matrix<T, n, m> invertOrthonormal() const noexcept
+		{
+			// Transpose the rotation and apply it to the negated translation
+			const Vector<T, n - 1> TRANSLATION(columns[n - 1]);
+
+			Matrix<T, n, m> inverse(static_cast<T>(1));
+			for (size_t i = 0; i < n - 1; ++i) {
+				const Vector<T, n - 1> AXIS(columns[i]);
+				for (size_t j = 0; j < n - 1; ++j) {
+					inverse.columns[j][i] = AXIS[j];
+				}
+				inverse.columns[n - 1][i] = -dot(AXIS, TRANSLATION);
+			}
+
+			return inverse;
+		}
+		/*!
+		 \brief Checks whether the NxN ae::Matrix is affine, meaning its last row is [0, ..., 0, 1].
+		 \details Used to select invertAffine() over invert() for matrices whose kind isn't known in advance, such as the projection matrices.
+
+		 \return True if the ae::Matrix is affine, false otherwise
+
+		 \par Example:
+		 \code
+		 const ae::Matrix4f invProjection = projection.isAffine() ? projection.invertAffine() : projection.invert();
+		 \endcode
+
+		 \sa invertAffine()
+
+		 \since v0.7.0
+		*/
+		template <typename = MATRIX_SQUARE_POLICY<n, m>>
+		_NODISCARD _CONSTEXPR17 bool isAffine() const noexcept
+		{
+			for (size_t i = 0; i < n - 1; ++i) {
+				if (columns[i][m - 1] != static_cast<T>(0)) {
+					return false;
+				}
+			}
+
+			return columns[n - 1][m - 1] == static_cast<T>(1);
+		}
 		/*!
 		 \brief Calculates and retrieves the transpose of the ae::Matrix.
 		 \details The transpose of a matrix is an operator which flips a flip over its diagonal.\n
@@ -24,8 +24,11 @@
 #define Aeon_Math_Misc_H_
 
 #include <cmath>
+#include <cstdint>
+#include <cstring>
 
 #include <AEON/System/DebugLogger.h>
+#include <AEON/Math/internal/SIMD.h>
 
 namespace ae
 {
@@ -90,10 +93,89 @@ namespace ae
 			return radians * (180.f / PI);
 		}
 
+		/*!
+		 \brief Sets the seed of the random number generators of all threads.
+		 \details Each thread owns a xoshiro256++ generator so that no synchronization is required to generate random numbers. The generator of each thread is seeded with the \a seed provided combined with the index of the thread (attributed in the order of the threads' first use of the generator), so the series of numbers generated by each thread are independent but reproducible.
+		 The generators of the other threads are reseeded lazily, upon their next use.
+		 \note The default seed is 0, a seed must be set for a different series of numbers at each execution.
+
+		 \param[in] seed The seed of the generators
+
+		 \par Example:
+		 \code
+		 // Reproduce the same run
+		 ae::Math::seedRandom(42);
+
+		 // Generate a different series at each execution
+		 ae::Math::seedRandom(static_cast<uint64_t>(std::time(nullptr)));
+		 \endcode
+
+		 \sa random()
+
+		 \since v0.7.0
+		*/
+		AEON_API void seedRandom(uint64_t seed) noexcept;
+		/*!
+		 \brief Retrieves the next 64 random bits of the calling thread's generator.
+		 \note This function is lock-free and may be called concurrently by any thread.
+
+		 \return 64 uniformly-distributed random bits
+
+		 \sa seedRandom(), random()
+
+		 \since v0.7.0
+		*/
+		_NODISCARD AEON_API uint64_t randomBits() noexcept;
+		/*!
+		 \brief Fills the array provided with the next \a count random 64-bit values of the calling thread's generator.
+		 \note This function is lock-free and may be called concurrently by any thread.
+
+		 \param[out] bits The array receiving the random values
+		 \param[in] count The number of values to generate
+
+		 \sa seedRandom(), random()
+
+		 \since v0.7.0
+		*/
+		AEON_API void randomBits(uint64_t* bits, size_t count) noexcept;
+
+		/*!
+		 \brief Converts the 64 random \a bits provided into a value situated between the values \a min and \a max.
+		 \details Floating point values are situated in the range [min,max) and integral values in the range [min,max].
+
+		 \param[in] bits The 64 random bits
+		 \param[in] min The minimum value
+		 \param[in] max The maximum value
+
+		 \return A value situated between the values \a min and \a max
+
+		 \sa random()
+
+		 \since v0.7.0
+		*/
+		template <typename T, typename = ARITHMETIC_POLICY<T>>
+		_NODISCARD inline T randomFromBits(uint64_t bits, T min, T max) noexcept
+		{
+			if _CONSTEXPR_IF (std::is_floating_point_v<T>) {
+				// Use as many bits as the mantissa can represent to retrieve a value within [0,1)
+				constexpr int SHIFT = (sizeof(T) == sizeof(float)) ? 40 : 11;
+				const T UNIT = static_cast<T>(bits >> SHIFT) * (T(1) / static_cast<T>(uint64_t(1) << (64 - SHIFT)));
+				return min + (max - min) * UNIT;
+			}
+			else {
+				// Scale the random bits to the size of the range (the bias is negligible for ranges below 2^32)
+				const uint64_t RANGE = static_cast<uint64_t>(max) - static_cast<uint64_t>(min) + 1;
+				const uint64_t OFFSET = (RANGE == 0) ? bits
+				                      : (RANGE <= 0xFFFFFFFFu) ? ((bits >> 32) * RANGE) >> 32
+				                      : bits % RANGE;
+				return static_cast<T>(static_cast<uint64_t>(min) + OFFSET);
+			}
+		}
 		/*!
 		 \brief Retrieves a random value situated between the values \a min and \a max.
-		 \details The retrieved value will be of the same type as the values provided.
-		 \note A seed must be set using srand for a different series of numbers at each execution.
+		 \details The retrieved value will be of the same type as the values provided. Floating point values are situated in the range [min,max) and integral values in the range [min,max].
+		 The value is generated by the calling thread's xoshiro256++ generator, this function is therefore lock-free and may be called concurrently by any thread.
+		 \note A seed must be set using seedRandom() for a different series of numbers at each execution.
 
 		 \param[in] min The minimum value
 		 \param[in] max The maximum value
@@ -106,20 +188,47 @@ namespace ae
 		 int randomInt = ae::Math::random(2, 5);
 		 \endcode
 
+		 \sa seedRandom()
+
 		 \since v0.6.0
 		*/
 		template <typename T, typename = ARITHMETIC_POLICY<T>>
-		_NODISCARD inline T random(T min, T max)
+		_NODISCARD inline T random(T min, T max) noexcept
 		{
-			// Check if the values provided are the same to avoid division by 0 (ignored in Release mode)
-			if _CONSTEXPR_IF (AEON_DEBUG) {
-				if (min == max) {
-					AEON_LOG_WARNING("Invalid values", "The values provided are equal to one another.");
-					return min;
+			return randomFromBits(randomBits(), min, max);
+		}
+		/*!
+		 \brief Fills the array provided with \a count random values situated between the values \a min and \a max.
+		 \details The random bits are generated in blocks to amortize the cost of the calls to the generator, this is the preferred way of generating many values at once.
+
+		 \param[in] min The minimum value
+		 \param[in] max The maximum value
+		 \param[out] values The array receiving the random values
+		 \param[in] count The number of values to generate
+
+		 \par Example:
+		 \code
+		 std::vector<float> lifetimes(spawnCount);
+		 ae::Math::random(1.f, 3.f, lifetimes.data(), lifetimes.size());
+		 \endcode
+
+		 \sa seedRandom()
+
+		 \since v0.7.0
+		*/
+		template <typename T, typename = ARITHMETIC_POLICY<T>>
+		inline void random(T min, T max, T* values, size_t count) noexcept
+		{
+			constexpr size_t BLOCK_SIZE = 64;
+			uint64_t bits[BLOCK_SIZE];
+			for (size_t i = 0; i < count; i += BLOCK_SIZE)
+			{
+				const size_t BLOCK_COUNT = (count - i < BLOCK_SIZE) ? count - i : BLOCK_SIZE;
+				randomBits(bits, BLOCK_COUNT);
+				for (size_t j = 0; j < BLOCK_COUNT; ++j) {
+					values[i + j] = randomFromBits(bits[j], min, max);
 				}
 			}
-
-			return min + static_cast<T>(static_cast<float>(rand()) / (static_cast<float>(RAND_MAX) / static_cast<float>(max - min)));
 		}
 
 		/*!
@@ -475,6 +584,217 @@ namespace ae
 		{
 			return (start + t * (end - start));
 		}
+
+		/*!
+		 \brief The namespace providing fast polynomial approximations of the transcendental functions for floats.
+		 \details These functions are opt-in: they're several times faster than the standard library but trade a few bits of precision, their error bounds are documented individually.
+		 The array versions process 4 values at a time with the SIMD instruction set available.
+		*/
+		namespace Fast
+		{
+			/*!
+			 \brief Calculates both the sine and the cosine of the \a angle provided with minimax polynomials.
+			 \details The angle is reduced to the range [-pi/4,pi/4] with a 3-part pi/2 to preserve the precision, and the polynomials of that range are swapped and negated depending on the quadrant.
+			 \note The absolute error is below 2e-7 for angles within [-8192,8192].
+
+			 \param[in] angle The angle in radians
+			 \param[out] sine The sine of the \a angle
+			 \param[out] cosine The cosine of the \a angle
+
+			 \par Example:
+			 \code
+			 float sine, cosine;
+			 ae::Math::Fast::sincos(rotation, sine, cosine);
+			 \endcode
+
+			 \sa sin(), cos()
+
+			 \since v0.7.0
+			*/
+			inline void sincos(float angle, float& sine, float& cosine) noexcept
+			{
+				// Reduce the angle to [-pi/4,pi/4] and retrieve its quadrant
+				const int QUADRANT = static_cast<int>(angle * 0.636619772f + ((angle >= 0.f) ? 0.5f : -0.5f));
+				const float Q = static_cast<float>(QUADRANT);
+				const float R = ((angle - Q * 1.5703125f) - Q * 4.837512969970703125e-4f) - Q * 7.54978995489188216e-8f;
+
+				// Evaluate the polynomials of the reduced angle
+				const float R2 = R * R;
+				const float SINE = R + R * R2 * (-1.6666654611e-1f + R2 * (8.3321608736e-3f + R2 * -1.9515295891e-4f));
+				const float COSINE = 1.f - 0.5f * R2 + R2 * R2 * (4.166664568298827e-2f + R2 * (-1.388731625493765e-3f + R2 * 2.443315711809948e-5f));
+
+				// Swap and negate the results based on the quadrant
+				switch (QUADRANT & 3)
+				{
+					case 0:
+						sine = SINE;
+						cosine = COSINE;
+						break;
+					case 1:
+						sine = COSINE;
+						cosine = -SINE;
+						break;
+					case 2:
+						sine = -SINE;
+						cosine = -COSINE;
+						break;
+					default:
+						sine = -COSINE;
+						cosine = SINE;
+						break;
+				}
+			}
+			/*!
+			 \brief Calculates the sine of the \a angle provided with a minimax polynomial.
+			 \note The absolute error is below 2e-7 for angles within [-8192,8192].
+
+			 \param[in] angle The angle in radians
+
+			 \return The sine of the \a angle
+
+			 \sa sincos(), cos()
+
+			 \since v0.7.0
+			*/
+			_NODISCARD inline float sin(float angle) noexcept
+			{
+				float sine, cosine;
+				sincos(angle, sine, cosine);
+				return sine;
+			}
+			/*!
+			 \brief Calculates the cosine of the \a angle provided with a minimax polynomial.
+			 \note The absolute error is below 2e-7 for angles within [-8192,8192].
+
+			 \param[in] angle The angle in radians
+
+			 \return The cosine of the \a angle
+
+			 \sa sincos(), sin()
+
+			 \since v0.7.0
+			*/
+			_NODISCARD inline float cos(float angle) noexcept
+			{
+				float sine, cosine;
+				sincos(angle, sine, cosine);
+				return cosine;
+			}
+			/*!
+			 \brief Calculates the inverse square root of the \a value provided with the hardware estimate refined by Newton-Raphson iterations.
+			 \note The relative error is below 5e-6 for positive normal values. The result is undefined for negative values and 0.
+
+			 \param[in] value The strictly positive value
+
+			 \return The inverse square root of the \a value
+
+			 \par Example:
+			 \code
+			 const ae::Vector2f unitDirection = direction * ae::Math::Fast::rsqrt(ae::dot(direction, direction));
+			 \endcode
+
+			 \since v0.7.0
+			*/
+			_NODISCARD inline float rsqrt(float value) noexcept
+			{
+			#if defined(AEON_SIMD_SSE)
+				// The hardware estimate has a relative error of 1.5 * 2^-12, a single iteration is sufficient
+				const float ESTIMATE = _mm_cvtss_f32(_mm_rsqrt_ss(_mm_set_ss(value)));
+				return ESTIMATE * (1.5f - 0.5f * value * ESTIMATE * ESTIMATE);
+			#else
+				// The initial estimate is computed from the float's bits and refined by two iterations
+				uint32_t bits;
+				std::memcpy(&bits, &value, sizeof(float));
+				bits = 0x5F375A86u - (bits >> 1);
+				float estimate;
+				std::memcpy(&estimate, &bits, sizeof(float));
+
+				estimate *= 1.5f - 0.5f * value * estimate * estimate;
+				return estimate * (1.5f - 0.5f * value * estimate * estimate);
+			#endif
+			}
+			/*!
+			 \brief Calculates the signed angle of the point (\a x, \a y) with a minimax polynomial of the inverse tangent.
+			 \details The ratio of the smallest coordinate to the largest one is used so that the polynomial is only evaluated within [0,1], the result is then mapped to its octant.
+			 \note The absolute error is below 3e-6 radians. The angle of the point (0, 0) is 0.
+
+			 \param[in] y The point's Y coordinate
+			 \param[in] x The point's X coordinate
+
+			 \return The angle in radians situated in the range [-pi,pi]
+
+			 \par Example:
+			 \code
+			 const float angle = ae::Math::Fast::atan2(mouseY - objectY, mouseX - objectX);
+			 \endcode
+
+			 \since v0.7.0
+			*/
+			_NODISCARD inline float atan2(float y, float x) noexcept
+			{
+				const float ABS_Y = std::fabs(y);
+				const float ABS_X = std::fabs(x);
+				const float RATIO = std::fmin(ABS_Y, ABS_X) / std::fmax(std::fmax(ABS_Y, ABS_X), 1.17549435e-38f);
+
+				// Evaluate the polynomial within [0,1] and map the result to its octant
+				const float R2 = RATIO * RATIO;
+				float angle = RATIO * (0.99997726f + R2 * (-0.33262347f + R2 * (0.19354346f + R2 * (-0.11643287f + R2 * (0.05265332f + R2 * -0.01172120f)))));
+				if (ABS_Y > ABS_X) {
+					angle = 1.57079637f - angle;
+				}
+				if (x < 0.f) {
+					angle = 3.14159274f - angle;
+				}
+
+				return std::copysign(angle, y);
+			}
+
+			/*!
+			 \brief Calculates the sines and cosines of the \a count angles provided, 4 at a time with the SIMD instruction set available.
+			 \note The absolute error is below 2e-7 for angles within [-8192,8192], as with sincos(float, float&, float&).
+
+			 \param[in] angles The angles in radians
+			 \param[out] sines The array receiving the sines
+			 \param[out] cosines The array receiving the cosines
+			 \param[in] count The number of angles
+
+			 \par Example:
+			 \code
+			 // Generate the points of a circle
+			 std::vector<float> angles(pointCount), sines(pointCount), cosines(pointCount);
+			 for (size_t i = 0; i < pointCount; ++i) {
+				angles[i] = i * 2.f * ae::Math::PI / pointCount;
+			 }
+			 ae::Math::Fast::sincos(angles.data(), sines.data(), cosines.data(), pointCount);
+			 \endcode
+
+			 \since v0.7.0
+			*/
+			AEON_API void sincos(const float* angles, float* sines, float* cosines, size_t count) noexcept;
+			/*!
+			 \brief Calculates the inverse square roots of the \a count values provided, 4 at a time with the SIMD instruction set available.
+			 \note The relative error is below 5e-6 for positive normal values, as with rsqrt(float).
+
+			 \param[in] values The strictly positive values
+			 \param[out] results The array receiving the inverse square roots, may be equal to \a values
+			 \param[in] count The number of values
+
+			 \since v0.7.0
+			*/
+			AEON_API void rsqrt(const float* values, float* results, size_t count) noexcept;
+			/*!
+			 \brief Calculates the signed angles of the \a count points provided, 4 at a time with the SIMD instruction set available.
+			 \note The absolute error is below 3e-6 radians, as with atan2(float, float).
+
+			 \param[in] y The points' Y coordinates
+			 \param[in] x The points' X coordinates
+			 \param[out] results The array receiving the angles in radians
+			 \param[in] count The number of points
+
+			 \since v0.7.0
+			*/
+			AEON_API void atan2(const float* y, const float* x, float* results, size_t count) noexcept;
+		}
 	}
 }
 #endif // Aeon_Math_Misc_H_
@@ -485,6 +805,15 @@ namespace ae
 
  The namespace ae::Math provides utility functions that may prove useful during
  the development of a game, whether it be 2D or 3D.
+
+ The random values are generated by a xoshiro256++ generator owned by each
+ thread, they can thus be generated concurrently without any contention. The
+ generators are seeded with ae::Math::seedRandom() for reproducible runs.
+
+ The nested namespace ae::Math::Fast provides polynomial approximations of
+ the sine, cosine, inverse square root and inverse tangent for floats, along
+ with array versions processing 4 values at a time, for hot loops that can
+ afford a few bits of precision.
  
  \author Filippos Gleglakos
  \version v0.6.0
@@ -0,0 +1,211 @@
+// MIT License
+// 
+// Copyright(c) 2019-2021 Filippos Gleglakos
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#ifndef Aeon_Math_Transform2D_H_
+#define Aeon_Math_Transform2D_H_
+
+#include <AEON/Config.h>
+#include <AEON/Math/Matrix.h>
+
+namespace ae
+{
+	// Forward declaration(s)
+	struct Vertex2D;
+
+	/*!
+	 \brief The class used to represent a compact 2D affine transform (a 2x3 matrix and a depth).
+	 \details The transform maps a point p to xAxis * p.x + yAxis * p.y + translation, the depth being carried as is.
+	*/
+	class _NODISCARD AEON_API Transform2D
+	{
+	public:
+		// Public member(s)
+		Vector2f xAxis;       //!< The first column of the linear part (the transformed X axis)
+		Vector2f yAxis;       //!< The second column of the linear part (the transformed Y axis)
+		Vector2f translation; //!< The translation in world-space
+		float    depth;       //!< The translation along the Z axis (the depth index)
+
+	public:
+		// Public constructor(s)
+		/*!
+		 \brief Default constructor.
+		 \details Constructs the identity transform.
+
+		 \since v0.7.0
+		*/
+		Transform2D() noexcept;
+		/*!
+		 \brief Constructs the ae::Transform2D by providing its columns and its depth.
+
+		 \param[in] xAxis The first column of the linear part
+		 \param[in] yAxis The second column of the linear part
+		 \param[in] translation The translation in world-space
+		 \param[in] depth The translation along the Z axis, 0 by default
+
+		 \since v0.7.0
+		*/
+		Transform2D(const Vector2f& xAxis, const Vector2f& yAxis, const Vector2f& translation, float depth = 0.f) noexcept;
+	public:
+		// Public operator(s)
+		/*!
+		 \brief Combines the ae::Transform2D with the \a other one, the \a other being applied first.
+
+		 \param[in] other The ae::Transform2D that will be applied before the caller
+
+		 \return The combined ae::Transform2D
+
+		 \par Example:
+		 \code
+		 ae::Transform2D global = parentTransform * childTransform;
+		 \endcode
+
+		 \since v0.7.0
+		*/
+		_NODISCARD Transform2D operator*(const Transform2D& other) const noexcept;
+		/*!
+		 \brief Transforms the \a point provided.
+
+		 \param[in] point The point that will be transformed
+
+		 \return The transformed point
+
+		 \since v0.7.0
+		*/
+		_NODISCARD Vector2f operator*(const Vector2f& point) const noexcept;
+		/*!
+		 \brief Combines the ae::Transform2D with the \a other one, the \a other being applied first.
+
+		 \param[in] other The ae::Transform2D that will be applied before the caller
+
+		 \return The caller ae::Transform2D
+
+		 \since v0.7.0
+		*/
+		Transform2D& operator*=(const Transform2D& other) noexcept;
+		/*!
+		 \brief Checks if the ae::Transform2D is equal to the \a other one.
+
+		 \param[in] other The ae::Transform2D that will be compared
+
+		 \return True if every component is equal, false otherwise
+
+		 \since v0.7.0
+		*/
+		_NODISCARD bool operator==(const Transform2D& other) const noexcept;
+		/*!
+		 \brief Checks if the ae::Transform2D is different from the \a other one.
+
+		 \param[in] other The ae::Transform2D that will be compared
+
+		 \return True if at least one component is different, false otherwise
+
+		 \since v0.7.0
+		*/
+		_NODISCARD bool operator!=(const Transform2D& other) const noexcept;
+	public:
+		// Public method(s)
+		/*!
+		 \brief Computes the inverse of the ae::Transform2D in closed form.
+		 \note The inverse of a transform with a null scale is the identity transform.
+
+		 \return The inverse ae::Transform2D
+
+		 \since v0.7.0
+		*/
+		_NODISCARD Transform2D invert() const noexcept;
+		/*!
+		 \brief Converts the ae::Transform2D to the equivalent 4x4 matrix.
+		 \details The conversion should only be performed when the transform is uploaded as ae::Matrix4f objects are 2.5 times larger.
+
+		 \return The equivalent ae::Matrix4f
+
+		 \since v0.7.0
+		*/
+		_NODISCARD Matrix4f toMatrix4f() const noexcept;
+
+		// Public static method(s)
+		/*!
+		 \brief Composes the model transform translating, rotating and scaling around the \a origin provided in closed form.
+		 \details The result is equivalent to translate(position) * rotate(rotation) * scale(scale) * translate(-origin),
+		 computed with a single sine and cosine instead of several 4x4 matrix multiplications.
+
+		 \param[in] position The position in world-space (the Z component being the depth)
+		 \param[in] scale The scale factors
+		 \param[in] origin The local origin or the anchor point
+		 \param[in] rotation The rotation in radians along the Z axis
+
+		 \return The composed ae::Transform2D
+
+		 \par Example:
+		 \code
+		 const ae::Transform2D model = ae::Transform2D::compose(ae::Vector3f(50.f, 25.f, 0.f), ae::Vector2f(2.f), ae::Vector2f(8.f), ae::Math::toRadians(45.f));
+		 \endcode
+
+		 \since v0.7.0
+		*/
+		_NODISCARD static Transform2D compose(const Vector3f& position, const Vector2f& scale, const Vector2f& origin, float rotation) noexcept;
+	};
+
+	namespace Math
+	{
+		/*!
+		 \brief Applies the \a transform to the XY positions of \a count 2D vertices.
+		 \details The vertices are copied from \a in to \a out, and their positions are transformed as points 4 or 8 at a time with the SIMD instruction set available. Their depths, colors and texture coordinates are preserved.
+		 \note The result is the same as Vector3f((transform * Vector3f(position.xy)).xy, position.z) for each vertex, without building the temporaries.
+
+		 \param[in] transform The ae::Matrix4f that will be applied to the vertices
+		 \param[in] in The first one of the source vertices
+		 \param[out] out The first one of the destination vertices, may be equal to \a in but mustn't partially overlap it
+		 \param[in] count The number of vertices to transform
+
+		 \par Example:
+		 \code
+		 std::vector<ae::Vertex2D> transformedVertices(vertices.size());
+		 ae::Math::transformPoints2D(states.transform, vertices.data(), transformedVertices.data(), vertices.size());
+		 \endcode
+
+		 \since v0.7.0
+		*/
+		AEON_API void transformPoints2D(const Matrix4f& transform, const Vertex2D* in, Vertex2D* out, size_t count) noexcept;
+	}
+}
+#endif // Aeon_Math_Transform2D_H_
+
+/*!
+ \class ae::Transform2D
+ \ingroup math
+
+ The ae::Transform2D class represents the affine transforms of 2D entities using
+ 7 floats instead of the 16 of an ae::Matrix4f. Composing, combining and
+ inverting them is done in closed form, and they're only converted to an
+ ae::Matrix4f when they need to be uploaded.
+
+ The function ae::Math::transformPoints2D() applies an ae::Matrix4f to a whole
+ array of 2D vertices at once, which is what the renderers use to transform
+ the submitted geometry on the CPU.
+
+ \author Filippos Gleglakos
+ \version v0.7.0
+ \date 2021.07.05
+ \copyright MIT License
+*/
\ No newline at end of file
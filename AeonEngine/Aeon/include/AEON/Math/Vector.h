@@ -26,6 +26,7 @@
 #include <array>
 
 #include <AEON/Math/Misc.h>
+#include <AEON/Math/internal/SIMD.h>
 
 namespace ae
 {
@@ -1869,6 +1870,10 @@ namespace ae
 	{
 		// Assign the sum of the two vectors to result
 		Vector<T, n> result = lhs;
+		if _CONSTEXPR_IF (SIMD::IS_VECTOR4F<T, n>) {
+			SIMD::combine4<'+'>(lhs.elements.data(), rhs.elements.data(), result.elements.data());
+			return result;
+		}
 		for (size_t i = 0; i < n; ++i) {
 			result.elements[i] += rhs.elements[i];
 		}
@@ -1902,6 +1907,10 @@ namespace ae
 	{
 		// Assign the difference of the two vectors to result
 		Vector<T, n> result = lhs;
+		if _CONSTEXPR_IF (SIMD::IS_VECTOR4F<T, n>) {
+			SIMD::combine4<'-'>(lhs.elements.data(), rhs.elements.data(), result.elements.data());
+			return result;
+		}
 		for (size_t i = 0; i < n; ++i) {
 			result.elements[i] -= rhs.elements[i];
 		}
@@ -1934,6 +1943,10 @@ namespace ae
 	{
 		// Assign the product of the two vectors to result
 		Vector<T, n> result = lhs;
+		if _CONSTEXPR_IF (SIMD::IS_VECTOR4F<T, n>) {
+			SIMD::combine4<'*'>(lhs.elements.data(), rhs.elements.data(), result.elements.data());
+			return result;
+		}
 		for (size_t i = 0; i < n; ++i) {
 			result.elements[i] *= rhs.elements[i];
 		}
@@ -1977,6 +1990,10 @@ namespace ae
 
 		// Assign the quotient of the two vectors to result
 		Vector<T, n> result = lhs;
+		if _CONSTEXPR_IF (SIMD::IS_VECTOR4F<T, n>) {
+			SIMD::combine4<'/'>(lhs.elements.data(), rhs.elements.data(), result.elements.data());
+			return result;
+		}
 		for (size_t i = 0; i < n; ++i) {
 			result.elements[i] /= rhs.elements[i];
 		}
@@ -2072,6 +2089,10 @@ namespace ae
 	{
 		// Assign the product of the vector and of the scalar to result
 		Vector<T, n> result = vec;
+		if _CONSTEXPR_IF (SIMD::IS_VECTOR4F<T, n>) {
+			SIMD::scale4(vec.elements.data(), scalar, result.elements.data());
+			return result;
+		}
 		for (T& element : result.elements) {
 			element *= scalar;
 		}
@@ -2145,6 +2166,10 @@ namespace ae
 	inline Vector<T, n>& operator+=(Vector<T, n>& lhs, const Vector<T, n>& rhs) noexcept
 	{
 		// Assign the sum of the two vectors to lhs
+		if _CONSTEXPR_IF (SIMD::IS_VECTOR4F<T, n>) {
+			SIMD::combine4<'+'>(lhs.elements.data(), rhs.elements.data(), lhs.elements.data());
+			return lhs;
+		}
 		for (size_t i = 0; i < n; ++i) {
 			lhs.elements[i] += rhs.elements[i];
 		}
@@ -2177,6 +2202,10 @@ namespace ae
 	inline Vector<T, n>& operator-=(Vector<T, n>& lhs, const Vector<T, n>& rhs) noexcept
 	{
 		// Assign the difference of the two vectors to lhs
+		if _CONSTEXPR_IF (SIMD::IS_VECTOR4F<T, n>) {
+			SIMD::combine4<'-'>(lhs.elements.data(), rhs.elements.data(), lhs.elements.data());
+			return lhs;
+		}
 		for (size_t i = 0; i < n; ++i) {
 			lhs.elements[i] -= rhs.elements[i];
 		}
@@ -2209,6 +2238,10 @@ namespace ae
 	inline Vector<T, n>& operator*=(Vector<T, n>& lhs, const Vector<T, n>& rhs) noexcept
 	{
 		// Assign the product of the two vectors to lhs
+		if _CONSTEXPR_IF (SIMD::IS_VECTOR4F<T, n>) {
+			SIMD::combine4<'*'>(lhs.elements.data(), rhs.elements.data(), lhs.elements.data());
+			return lhs;
+		}
 		for (size_t i = 0; i < n; ++i) {
 			lhs.elements[i] *= rhs.elements[i];
 		}
@@ -2252,6 +2285,10 @@ namespace ae
 		}
 
 		// Assign the quotient of the two vectors to lhs
+		if _CONSTEXPR_IF (SIMD::IS_VECTOR4F<T, n>) {
+			SIMD::combine4<'/'>(lhs.elements.data(), rhs.elements.data(), lhs.elements.data());
+			return lhs;
+		}
 		for (size_t i = 0; i < n; ++i) {
 			lhs.elements[i] /= rhs.elements[i];
 		}
@@ -2346,6 +2383,10 @@ namespace ae
 	inline Vector<T, n>& operator*=(Vector<T, n>& vec, T scalar) noexcept
 	{
 		// Multiply the scalar value with the vec's elements
+		if _CONSTEXPR_IF (SIMD::IS_VECTOR4F<T, n>) {
+			SIMD::scale4(vec.elements.data(), scalar, vec.elements.data());
+			return vec;
+		}
 		for (T& element : vec.elements) {
 			element *= scalar;
 		}
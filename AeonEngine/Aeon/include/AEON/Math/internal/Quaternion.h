@@ -673,6 +673,124 @@ namespace ae
 		 \since v0.3.0
 		*/
 		_NODISCARD static float dot(const Quaternion& q0, const Quaternion& q1) noexcept;
+		/*!
+		 \brief Interpolates linearly between the ae::Quaternion objects \a q0 and \a q1 and normalizes the result.
+		 \details The shortest path is taken. The angular velocity isn't constant, but it's much cheaper than slerp() and indistinguishable for small angles.
+
+		 \param[in] q0 The unit ae::Quaternion retrieved when \a t is 0
+		 \param[in] q1 The unit ae::Quaternion retrieved when \a t is 1
+		 \param[in] t The interpolation factor situated in the range [0,1]
+
+		 \return The interpolated unit ae::Quaternion
+
+		 \par Example:
+		 \code
+		 ae::Quaternion blended = ae::Quaternion::nlerp(idlePose, walkPose, 0.25f);
+		 \endcode
+
+		 \sa slerp()
+
+		 \since v0.7.0
+		*/
+		_NODISCARD static Quaternion nlerp(const Quaternion& q0, const Quaternion& q1, float t) noexcept;
+		/*!
+		 \brief Interpolates spherically between the ae::Quaternion objects \a q0 and \a q1.
+		 \details The shortest path is taken at a constant angular velocity. Nearly parallel quaternions are interpolated with nlerp() to avoid the division by a vanishing sine.
+
+		 \param[in] q0 The unit ae::Quaternion retrieved when \a t is 0
+		 \param[in] q1 The unit ae::Quaternion retrieved when \a t is 1
+		 \param[in] t The interpolation factor situated in the range [0,1]
+
+		 \return The interpolated unit ae::Quaternion
+
+		 \par Example:
+		 \code
+		 ae::Quaternion cameraRotation = ae::Quaternion::slerp(startRotation, endRotation, elapsed / duration);
+		 \endcode
+
+		 \sa nlerp()
+
+		 \since v0.7.0
+		*/
+		_NODISCARD static Quaternion slerp(const Quaternion& q0, const Quaternion& q1, float t) noexcept;
+		/*!
+		 \brief Multiplies the \a count pairs of ae::Quaternion objects, 4 at a time with the SIMD instruction set available.
+
+		 \param[in] lhs The left ae::Quaternion objects
+		 \param[in] rhs The right ae::Quaternion objects
+		 \param[out] result The ae::Quaternion objects receiving the products, may be equal to \a lhs or \a rhs
+		 \param[in] count The number of pairs
+
+		 \par Example:
+		 \code
+		 // Concatenate the local rotations of the bones to their parents' global rotations
+		 ae::Quaternion::multiply(parentRotations.data(), localRotations.data(), globalRotations.data(), boneCount);
+		 \endcode
+
+		 \since v0.7.0
+		*/
+		static void multiply(const Quaternion* lhs, const Quaternion* rhs, Quaternion* result, size_t count) noexcept;
+		/*!
+		 \brief Normalizes the \a count ae::Quaternion objects, 4 at a time with the SIMD instruction set available.
+		 \note The null quaternions are replaced by the identity quaternion, as with normalize().
+
+		 \param[in] quats The ae::Quaternion objects to normalize
+		 \param[out] result The ae::Quaternion objects receiving the unit quaternions, may be equal to \a quats
+		 \param[in] count The number of quaternions
+
+		 \since v0.7.0
+		*/
+		static void normalize(const Quaternion* quats, Quaternion* result, size_t count) noexcept;
+		/*!
+		 \brief Interpolates linearly between the \a count pairs of ae::Quaternion objects and normalizes the results, 4 at a time with the SIMD instruction set available.
+
+		 \param[in] q0 The unit ae::Quaternion objects retrieved when their factor is 0
+		 \param[in] q1 The unit ae::Quaternion objects retrieved when their factor is 1
+		 \param[in] t The interpolation factors of each pair situated in the range [0,1]
+		 \param[out] result The ae::Quaternion objects receiving the interpolated unit quaternions, may be equal to \a q0 or \a q1
+		 \param[in] count The number of pairs
+
+		 \sa nlerp(const Quaternion&, const Quaternion&, float)
+
+		 \since v0.7.0
+		*/
+		static void nlerp(const Quaternion* q0, const Quaternion* q1, const float* t, Quaternion* result, size_t count) noexcept;
+		/*!
+		 \brief Interpolates spherically between the \a count pairs of ae::Quaternion objects, 4 at a time with the SIMD instruction set available.
+		 \details The weights of each pair are computed separately, the blending and the normalization being vectorized.
+
+		 \param[in] q0 The unit ae::Quaternion objects retrieved when their factor is 0
+		 \param[in] q1 The unit ae::Quaternion objects retrieved when their factor is 1
+		 \param[in] t The interpolation factors of each pair situated in the range [0,1]
+		 \param[out] result The ae::Quaternion objects receiving the interpolated unit quaternions, may be equal to \a q0 or \a q1
+		 \param[in] count The number of pairs
+
+		 \par Example:
+		 \code
+		 // Blend the animation poses of every animated object
+		 ae::Quaternion::slerp(fromPoses.data(), toPoses.data(), blendFactors.data(), rotations.data(), rotations.size());
+		 \endcode
+
+		 \sa slerp(const Quaternion&, const Quaternion&, float)
+
+		 \since v0.7.0
+		*/
+		static void slerp(const Quaternion* q0, const Quaternion* q1, const float* t, Quaternion* result, size_t count) noexcept;
+	private:
+		// Private static method(s)
+		/*!
+		 \brief Computes the weights of the spherical interpolation between the ae::Quaternion objects \a q0 and \a q1.
+		 \details The second weight is negated if the quaternions lie in opposite hemispheres so that the shortest path is taken.
+
+		 \param[in] q0 The first unit ae::Quaternion
+		 \param[in] q1 The second unit ae::Quaternion
+		 \param[in] t The interpolation factor situated in the range [0,1]
+		 \param[out] weight0 The weight of \a q0
+		 \param[out] weight1 The weight of \a q1
+
+		 \since v0.7.0
+		*/
+		static void getSlerpWeights(const Quaternion& q0, const Quaternion& q1, float t, float& weight0, float& weight1) noexcept;
 
 	private:
 		// Member data
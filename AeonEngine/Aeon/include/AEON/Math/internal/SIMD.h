@@ -0,0 +1,643 @@
+// MIT License
+// 
+// Copyright(c) 2019-2021 Filippos Gleglakos
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+
+#ifndef Aeon_Math_SIMD_H_
+#define Aeon_Math_SIMD_H_
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+#include <AEON/Config.h>
+
+#if defined(AEON_SIMD_SSE)
+	#include <immintrin.h>
+#elif defined(AEON_SIMD_NEON)
+	#include <arm_neon.h>
+#endif
+
+namespace ae
+{
+	/*!
+	 \brief The namespace providing the SIMD kernels of the 4-dimensional vectors and 4x4 matrices of floats.
+	 \details The kernels operate on column-major arrays of floats and may be unaligned. They're only defined if an instruction set was selected by AEON_SIMD.
+	 \note This namespace is considered to be internal, the ae::Vector and ae::Matrix operators select the kernels at compile time.
+	*/
+	namespace SIMD
+	{
+		// Template policies
+		template <typename T, size_t n>
+		_CONSTEXPR17 const bool IS_VECTOR4F = (AEON_SIMD && std::is_same_v<T, float> && n == 4);              //!< Whether the SIMD kernels are used for an ae::Vector of type T with n dimensions
+		template <typename T, size_t n, size_t m>
+		_CONSTEXPR17 const bool IS_MATRIX4F = (AEON_SIMD && std::is_same_v<T, float> && n == 4 && m == 4);    //!< Whether the SIMD kernels are used for an ae::Matrix of type T with n columns and m rows
+
+#if AEON_SIMD
+		/*!
+		 \brief Adds, subtracts, multiplies or divides the 4 elements of \a lhs and \a rhs.
+
+		 \param[in] lhs The 4 elements of the left operand
+		 \param[in] rhs The 4 elements of the right operand
+		 \param[out] result The 4 elements receiving the results, may alias the operands
+
+		 \since v0.7.0
+		*/
+		template <char op>
+		inline void combine4(const float* lhs, const float* rhs, float* result) noexcept
+		{
+		#if defined(AEON_SIMD_SSE)
+			const __m128 LHS = _mm_loadu_ps(lhs), RHS = _mm_loadu_ps(rhs);
+			if _CONSTEXPR_IF (op == '+') { _mm_storeu_ps(result, _mm_add_ps(LHS, RHS)); }
+			else if _CONSTEXPR_IF (op == '-') { _mm_storeu_ps(result, _mm_sub_ps(LHS, RHS)); }
+			else if _CONSTEXPR_IF (op == '*') { _mm_storeu_ps(result, _mm_mul_ps(LHS, RHS)); }
+			else { _mm_storeu_ps(result, _mm_div_ps(LHS, RHS)); }
+		#else
+			const float32x4_t LHS = vld1q_f32(lhs), RHS = vld1q_f32(rhs);
+			if _CONSTEXPR_IF (op == '+') { vst1q_f32(result, vaddq_f32(LHS, RHS)); }
+			else if _CONSTEXPR_IF (op == '-') { vst1q_f32(result, vsubq_f32(LHS, RHS)); }
+			else if _CONSTEXPR_IF (op == '*') { vst1q_f32(result, vmulq_f32(LHS, RHS)); }
+			else {
+				// NEON doesn't provide a division on every ARM architecture, the scalar division is exact
+				for (size_t i = 0; i < 4; ++i) {
+					result[i] = lhs[i] / rhs[i];
+				}
+			}
+		#endif
+		}
+
+		/*!
+		 \brief Multiplies the 4 elements of \a vec by the \a scalar.
+
+		 \param[in] vec The 4 elements to scale
+		 \param[in] scalar The scale factor
+		 \param[out] result The 4 elements receiving the results, may alias \a vec
+
+		 \since v0.7.0
+		*/
+		inline void scale4(const float* vec, float scalar, float* result) noexcept
+		{
+		#if defined(AEON_SIMD_SSE)
+			_mm_storeu_ps(result, _mm_mul_ps(_mm_loadu_ps(vec), _mm_set1_ps(scalar)));
+		#else
+			vst1q_f32(result, vmulq_n_f32(vld1q_f32(vec), scalar));
+		#endif
+		}
+
+		/*!
+		 \brief Multiplies the column-major 4x4 matrices \a lhs and \a rhs.
+
+		 \param[in] lhs The 16 elements of the left matrix
+		 \param[in] rhs The 16 elements of the right matrix
+		 \param[out] result The 16 elements receiving the product, mustn't alias the operands
+
+		 \since v0.7.0
+		*/
+		inline void multiplyMatrix4(const float* lhs, const float* rhs, float* result) noexcept
+		{
+		#if defined(AEON_SIMD_AVX)
+			// Compute two columns of the product per iteration, each lane broadcasting the right matrix's elements of its own column
+			const __m256 C0 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(lhs));
+			const __m256 C1 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(lhs + 4));
+			const __m256 C2 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(lhs + 8));
+			const __m256 C3 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(lhs + 12));
+			for (size_t j = 0; j < 16; j += 8) {
+				const __m256 RHS = _mm256_loadu_ps(rhs + j);
+				__m256 column = _mm256_mul_ps(C0, _mm256_shuffle_ps(RHS, RHS, 0x00));
+				column = _mm256_add_ps(column, _mm256_mul_ps(C1, _mm256_shuffle_ps(RHS, RHS, 0x55)));
+				column = _mm256_add_ps(column, _mm256_mul_ps(C2, _mm256_shuffle_ps(RHS, RHS, 0xAA)));
+				column = _mm256_add_ps(column, _mm256_mul_ps(C3, _mm256_shuffle_ps(RHS, RHS, 0xFF)));
+				_mm256_storeu_ps(result + j, column);
+			}
+		#elif defined(AEON_SIMD_SSE)
+			// Each column of the product is the combination of the left matrix's columns weighted by the right matrix's column
+			const __m128 C0 = _mm_loadu_ps(lhs), C1 = _mm_loadu_ps(lhs + 4), C2 = _mm_loadu_ps(lhs + 8), C3 = _mm_loadu_ps(lhs + 12);
+			for (size_t j = 0; j < 16; j += 4) {
+				__m128 column = _mm_mul_ps(C0, _mm_set1_ps(rhs[j]));
+				column = _mm_add_ps(column, _mm_mul_ps(C1, _mm_set1_ps(rhs[j + 1])));
+				column = _mm_add_ps(column, _mm_mul_ps(C2, _mm_set1_ps(rhs[j + 2])));
+				column = _mm_add_ps(column, _mm_mul_ps(C3, _mm_set1_ps(rhs[j + 3])));
+				_mm_storeu_ps(result + j, column);
+			}
+		#else
+			const float32x4_t C0 = vld1q_f32(lhs), C1 = vld1q_f32(lhs + 4), C2 = vld1q_f32(lhs + 8), C3 = vld1q_f32(lhs + 12);
+			for (size_t j = 0; j < 16; j += 4) {
+				float32x4_t column = vmulq_n_f32(C0, rhs[j]);
+				column = vmlaq_n_f32(column, C1, rhs[j + 1]);
+				column = vmlaq_n_f32(column, C2, rhs[j + 2]);
+				column = vmlaq_n_f32(column, C3, rhs[j + 3]);
+				vst1q_f32(result + j, column);
+			}
+		#endif
+		}
+
+		/*!
+		 \brief Transforms the 4-dimensional vector \a vec by the column-major 4x4 matrix \a mat.
+
+		 \param[in] mat The 16 elements of the matrix
+		 \param[in] vec The 4 elements of the vector
+		 \param[out] result The 4 elements receiving the transformed vector, mustn't alias the operands
+
+		 \since v0.7.0
+		*/
+		inline void transformVector4(const float* mat, const float* vec, float* result) noexcept
+		{
+		#if defined(AEON_SIMD_SSE)
+			__m128 transformed = _mm_mul_ps(_mm_loadu_ps(mat), _mm_set1_ps(vec[0]));
+			transformed = _mm_add_ps(transformed, _mm_mul_ps(_mm_loadu_ps(mat + 4), _mm_set1_ps(vec[1])));
+			transformed = _mm_add_ps(transformed, _mm_mul_ps(_mm_loadu_ps(mat + 8), _mm_set1_ps(vec[2])));
+			transformed = _mm_add_ps(transformed, _mm_mul_ps(_mm_loadu_ps(mat + 12), _mm_set1_ps(vec[3])));
+			_mm_storeu_ps(result, transformed);
+		#else
+			float32x4_t transformed = vmulq_n_f32(vld1q_f32(mat), vec[0]);
+			transformed = vmlaq_n_f32(transformed, vld1q_f32(mat + 4), vec[1]);
+			transformed = vmlaq_n_f32(transformed, vld1q_f32(mat + 8), vec[2]);
+			transformed = vmlaq_n_f32(transformed, vld1q_f32(mat + 12), vec[3]);
+			vst1q_f32(result, transformed);
+		#endif
+		}
+
+		/*!
+		 \brief Transforms the 3-dimensional point \a point (with an implicit fourth coordinate of 1) by the column-major 4x4 matrix \a mat.
+
+		 \param[in] mat The 16 elements of the matrix
+		 \param[in] point The 3 coordinates of the point
+		 \param[out] result The 3 coordinates receiving the transformed point, mustn't alias the operands
+
+		 \since v0.7.0
+		*/
+		inline void transformPoint3(const float* mat, const float* point, float* result) noexcept
+		{
+			// The fourth column is the translation, added as is
+		#if defined(AEON_SIMD_SSE)
+			__m128 transformed = _mm_add_ps(_mm_loadu_ps(mat + 12), _mm_mul_ps(_mm_loadu_ps(mat), _mm_set1_ps(point[0])));
+			transformed = _mm_add_ps(transformed, _mm_mul_ps(_mm_loadu_ps(mat + 4), _mm_set1_ps(point[1])));
+			transformed = _mm_add_ps(transformed, _mm_mul_ps(_mm_loadu_ps(mat + 8), _mm_set1_ps(point[2])));
+
+			alignas(16) float elements[4];
+			_mm_store_ps(elements, transformed);
+		#else
+			float32x4_t transformed = vmlaq_n_f32(vld1q_f32(mat + 12), vld1q_f32(mat), point[0]);
+			transformed = vmlaq_n_f32(transformed, vld1q_f32(mat + 4), point[1]);
+			transformed = vmlaq_n_f32(transformed, vld1q_f32(mat + 8), point[2]);
+
+			float elements[4];
+			vst1q_f32(elements, transformed);
+		#endif
+			result[0] = elements[0];
+			result[1] = elements[1];
+			result[2] = elements[2];
+		}
+
+		/*!
+		 \brief Inverts the column-major 4x4 matrix \a mat.
+		 \details The inverse is computed blockwise from the four 2x2 submatrices' adjugates (SSE), or from the cofactors (NEON).
+		 \note The \a result is undefined if the matrix is singular.
+
+		 \param[in] mat The 16 elements of the matrix
+		 \param[out] result The 16 elements receiving the inverse, mustn't alias \a mat
+
+		 \return The determinant of the matrix, 0 if it's singular
+
+		 \since v0.7.0
+		*/
+		inline float invertMatrix4(const float* mat, float* result) noexcept
+		{
+		#if defined(AEON_SIMD_SSE)
+			// The columns are processed as rows, which inverts the transpose and stores the transposed inverse, the layout therefore doesn't matter
+			const __m128 R0 = _mm_loadu_ps(mat), R1 = _mm_loadu_ps(mat + 4), R2 = _mm_loadu_ps(mat + 8), R3 = _mm_loadu_ps(mat + 12);
+
+			// The 2x2 submatrices (stored row by row) and their determinants
+			const __m128 A = _mm_movelh_ps(R0, R1), B = _mm_movehl_ps(R1, R0);
+			const __m128 C = _mm_movelh_ps(R2, R3), D = _mm_movehl_ps(R3, R2);
+			const __m128 DETERMINANTS = _mm_sub_ps(
+				_mm_mul_ps(_mm_shuffle_ps(R0, R2, _MM_SHUFFLE(2, 0, 2, 0)), _mm_shuffle_ps(R1, R3, _MM_SHUFFLE(3, 1, 3, 1))),
+				_mm_mul_ps(_mm_shuffle_ps(R0, R2, _MM_SHUFFLE(3, 1, 3, 1)), _mm_shuffle_ps(R1, R3, _MM_SHUFFLE(2, 0, 2, 0)))
+			);
+			const __m128 DET_A = _mm_shuffle_ps(DETERMINANTS, DETERMINANTS, _MM_SHUFFLE(0, 0, 0, 0));
+			const __m128 DET_B = _mm_shuffle_ps(DETERMINANTS, DETERMINANTS, _MM_SHUFFLE(1, 1, 1, 1));
+			const __m128 DET_C = _mm_shuffle_ps(DETERMINANTS, DETERMINANTS, _MM_SHUFFLE(2, 2, 2, 2));
+			const __m128 DET_D = _mm_shuffle_ps(DETERMINANTS, DETERMINANTS, _MM_SHUFFLE(3, 3, 3, 3));
+
+			// The 2x2 products: X*Y, adj(X)*Y and X*adj(Y)
+			const auto MUL = [](__m128 x, __m128 y) {
+				return _mm_add_ps(_mm_mul_ps(x, _mm_shuffle_ps(y, y, _MM_SHUFFLE(3, 0, 3, 0))),
+				                  _mm_mul_ps(_mm_shuffle_ps(x, x, _MM_SHUFFLE(2, 3, 0, 1)), _mm_shuffle_ps(y, y, _MM_SHUFFLE(1, 2, 1, 2))));
+			};
+			const auto ADJ_MUL = [](__m128 x, __m128 y) {
+				return _mm_sub_ps(_mm_mul_ps(_mm_shuffle_ps(x, x, _MM_SHUFFLE(0, 0, 3, 3)), y),
+				                  _mm_mul_ps(_mm_shuffle_ps(x, x, _MM_SHUFFLE(2, 2, 1, 1)), _mm_shuffle_ps(y, y, _MM_SHUFFLE(1, 0, 3, 2))));
+			};
+			const auto MUL_ADJ = [](__m128 x, __m128 y) {
+				return _mm_sub_ps(_mm_mul_ps(x, _mm_shuffle_ps(y, y, _MM_SHUFFLE(0, 3, 0, 3))),
+				                  _mm_mul_ps(_mm_shuffle_ps(x, x, _MM_SHUFFLE(2, 3, 0, 1)), _mm_shuffle_ps(y, y, _MM_SHUFFLE(1, 2, 1, 2))));
+			};
+
+			// The adjugates of the inverse's blocks
+			const __m128 D_C = ADJ_MUL(D, C);
+			const __m128 A_B = ADJ_MUL(A, B);
+			__m128 x = _mm_sub_ps(_mm_mul_ps(DET_D, A), MUL(B, D_C));
+			__m128 w = _mm_sub_ps(_mm_mul_ps(DET_A, D), MUL(C, A_B));
+			__m128 y = _mm_sub_ps(_mm_mul_ps(DET_B, C), MUL_ADJ(D, A_B));
+			__m128 z = _mm_sub_ps(_mm_mul_ps(DET_C, B), MUL_ADJ(A, D_C));
+
+			// The determinant: det(A)det(D) + det(B)det(C) - tr(adj(A)B adj(D)C)
+			__m128 trace = _mm_mul_ps(A_B, _mm_shuffle_ps(D_C, D_C, _MM_SHUFFLE(3, 1, 2, 0)));
+			trace = _mm_add_ps(trace, _mm_shuffle_ps(trace, trace, _MM_SHUFFLE(1, 0, 3, 2)));
+			trace = _mm_add_ps(trace, _mm_shuffle_ps(trace, trace, _MM_SHUFFLE(2, 3, 0, 1)));
+			const __m128 DETERMINANT = _mm_sub_ps(_mm_add_ps(_mm_mul_ps(DET_A, DET_D), _mm_mul_ps(DET_B, DET_C)), trace);
+
+			const float DET = _mm_cvtss_f32(DETERMINANT);
+			if (DET == 0.f) {
+				return 0.f;
+			}
+
+			// Divide by the determinant, apply the adjugates' signs and store the blocks
+			const __m128 RECIPROCAL = _mm_div_ps(_mm_setr_ps(1.f, -1.f, -1.f, 1.f), DETERMINANT);
+			x = _mm_mul_ps(x, RECIPROCAL);
+			y = _mm_mul_ps(y, RECIPROCAL);
+			z = _mm_mul_ps(z, RECIPROCAL);
+			w = _mm_mul_ps(w, RECIPROCAL);
+			_mm_storeu_ps(result,      _mm_shuffle_ps(x, y, _MM_SHUFFLE(1, 3, 1, 3)));
+			_mm_storeu_ps(result + 4,  _mm_shuffle_ps(x, y, _MM_SHUFFLE(0, 2, 0, 2)));
+			_mm_storeu_ps(result + 8,  _mm_shuffle_ps(z, w, _MM_SHUFFLE(1, 3, 1, 3)));
+			_mm_storeu_ps(result + 12, _mm_shuffle_ps(z, w, _MM_SHUFFLE(0, 2, 0, 2)));
+			return DET;
+		#else
+			// Compute the 2x2 minors shared by the cofactors
+			const float S0 = mat[0] * mat[5] - mat[4] * mat[1];
+			const float S1 = mat[0] * mat[6] - mat[4] * mat[2];
+			const float S2 = mat[0] * mat[7] - mat[4] * mat[3];
+			const float S3 = mat[1] * mat[6] - mat[5] * mat[2];
+			const float S4 = mat[1] * mat[7] - mat[5] * mat[3];
+			const float S5 = mat[2] * mat[7] - mat[6] * mat[3];
+			const float C5 = mat[10] * mat[15] - mat[14] * mat[11];
+			const float C4 = mat[9] * mat[15] - mat[13] * mat[11];
+			const float C3 = mat[9] * mat[14] - mat[13] * mat[10];
+			const float C2 = mat[8] * mat[15] - mat[12] * mat[11];
+			const float C1 = mat[8] * mat[14] - mat[12] * mat[10];
+			const float C0 = mat[8] * mat[13] - mat[12] * mat[9];
+
+			const float DET = S0 * C5 - S1 * C4 + S2 * C3 + S3 * C2 - S4 * C1 + S5 * C0;
+			if (DET == 0.f) {
+				return 0.f;
+			}
+
+			const float ADJUGATE[16] = {
+				 mat[5] * C5 - mat[6] * C4 + mat[7] * C3,
+				-mat[1] * C5 + mat[2] * C4 - mat[3] * C3,
+				 mat[13] * S5 - mat[14] * S4 + mat[15] * S3,
+				-mat[9] * S5 + mat[10] * S4 - mat[11] * S3,
+				-mat[4] * C5 + mat[6] * C2 - mat[7] * C1,
+				 mat[0] * C5 - mat[2] * C2 + mat[3] * C1,
+				-mat[12] * S5 + mat[14] * S2 - mat[15] * S1,
+				 mat[8] * S5 - mat[10] * S2 + mat[11] * S1,
+				 mat[4] * C4 - mat[5] * C2 + mat[7] * C0,
+				-mat[0] * C4 + mat[1] * C2 - mat[3] * C0,
+				 mat[12] * S4 - mat[13] * S2 + mat[15] * S0,
+				-mat[8] * S4 + mat[9] * S2 - mat[11] * S0,
+				-mat[4] * C3 + mat[5] * C1 - mat[6] * C0,
+				 mat[0] * C3 - mat[1] * C1 + mat[2] * C0,
+				-mat[12] * S3 + mat[13] * S1 - mat[14] * S0,
+				 mat[8] * S3 - mat[9] * S1 + mat[10] * S0
+			};
+
+			const float32x4_t RECIPROCAL = vdupq_n_f32(1.f / DET);
+			for (size_t i = 0; i < 16; i += 4) {
+				vst1q_f32(result + i, vmulq_f32(vld1q_f32(ADJUGATE + i), RECIPROCAL));
+			}
+			return DET;
+		#endif
+		}
+
+		/*!
+		 \brief Tests 4 consecutive 2D boxes stored as separate arrays of coordinates against the box provided.
+		 \details The boxes are considered as overlapping if they're touching, as with ae::AABoxCollider::intersects().
+
+		 \param[in] minX The minimum X coordinates of the 4 boxes
+		 \param[in] minY The minimum Y coordinates of the 4 boxes
+		 \param[in] maxX The maximum X coordinates of the 4 boxes
+		 \param[in] maxY The maximum Y coordinates of the 4 boxes
+		 \param[in] box The minimum X, minimum Y, maximum X and maximum Y coordinates of the box tested
+
+		 \return A 4-bit mask whose bit i is set if the box i overlaps the box tested
+
+		 \since v0.7.0
+		*/
+		inline unsigned int overlapBoxes4(const float* minX, const float* minY, const float* maxX, const float* maxY, const float* box) noexcept
+		{
+		#if defined(AEON_SIMD_SSE)
+			const __m128 OVERLAP = _mm_and_ps(
+				_mm_and_ps(_mm_cmple_ps(_mm_loadu_ps(minX), _mm_set1_ps(box[2])), _mm_cmpge_ps(_mm_loadu_ps(maxX), _mm_set1_ps(box[0]))),
+				_mm_and_ps(_mm_cmple_ps(_mm_loadu_ps(minY), _mm_set1_ps(box[3])), _mm_cmpge_ps(_mm_loadu_ps(maxY), _mm_set1_ps(box[1])))
+			);
+			return static_cast<unsigned int>(_mm_movemask_ps(OVERLAP));
+		#else
+			const uint32x4_t OVERLAP = vandq_u32(
+				vandq_u32(vcleq_f32(vld1q_f32(minX), vdupq_n_f32(box[2])), vcgeq_f32(vld1q_f32(maxX), vdupq_n_f32(box[0]))),
+				vandq_u32(vcleq_f32(vld1q_f32(minY), vdupq_n_f32(box[3])), vcgeq_f32(vld1q_f32(maxY), vdupq_n_f32(box[1])))
+			);
+			uint32_t lanes[4];
+			vst1q_u32(lanes, OVERLAP);
+			return (lanes[0] & 1u) | (lanes[1] & 2u) | (lanes[2] & 4u) | (lanes[3] & 8u);
+		#endif
+		}
+
+		/*!
+		 \brief Intersects a 2D ray with 4 consecutive boxes stored as separate arrays of coordinates using the slab method.
+
+		 \param[in] minX The minimum X coordinates of the 4 boxes
+		 \param[in] minY The minimum Y coordinates of the 4 boxes
+		 \param[in] maxX The maximum X coordinates of the 4 boxes
+		 \param[in] maxY The maximum Y coordinates of the 4 boxes
+		 \param[in] ray The origin's X and Y coordinates, the inverse direction's X and Y components and the maximum distance of the ray
+		 \param[out] distances The 4 distances along the ray at which it enters the boxes, 0 if the origin is inside a box
+
+		 \return A 4-bit mask whose bit i is set if the ray hits the box i within its maximum distance
+
+		 \since v0.7.0
+		*/
+		inline unsigned int raycastBoxes4(const float* minX, const float* minY, const float* maxX, const float* maxY, const float* ray, float* distances) noexcept
+		{
+		#if defined(AEON_SIMD_SSE)
+			const __m128 ORIGIN_X = _mm_set1_ps(ray[0]), ORIGIN_Y = _mm_set1_ps(ray[1]);
+			const __m128 INV_DIR_X = _mm_set1_ps(ray[2]), INV_DIR_Y = _mm_set1_ps(ray[3]);
+
+			const __m128 T1X = _mm_mul_ps(_mm_sub_ps(_mm_loadu_ps(minX), ORIGIN_X), INV_DIR_X);
+			const __m128 T2X = _mm_mul_ps(_mm_sub_ps(_mm_loadu_ps(maxX), ORIGIN_X), INV_DIR_X);
+			const __m128 T1Y = _mm_mul_ps(_mm_sub_ps(_mm_loadu_ps(minY), ORIGIN_Y), INV_DIR_Y);
+			const __m128 T2Y = _mm_mul_ps(_mm_sub_ps(_mm_loadu_ps(maxY), ORIGIN_Y), INV_DIR_Y);
+
+			const __m128 T_ENTER = _mm_max_ps(_mm_max_ps(_mm_min_ps(T1X, T2X), _mm_min_ps(T1Y, T2Y)), _mm_setzero_ps());
+			const __m128 T_EXIT = _mm_min_ps(_mm_min_ps(_mm_max_ps(T1X, T2X), _mm_max_ps(T1Y, T2Y)), _mm_set1_ps(ray[4]));
+			_mm_storeu_ps(distances, T_ENTER);
+			return static_cast<unsigned int>(_mm_movemask_ps(_mm_cmple_ps(T_ENTER, T_EXIT)));
+		#else
+			const float32x4_t ORIGIN_X = vdupq_n_f32(ray[0]), ORIGIN_Y = vdupq_n_f32(ray[1]);
+
+			const float32x4_t T1X = vmulq_n_f32(vsubq_f32(vld1q_f32(minX), ORIGIN_X), ray[2]);
+			const float32x4_t T2X = vmulq_n_f32(vsubq_f32(vld1q_f32(maxX), ORIGIN_X), ray[2]);
+			const float32x4_t T1Y = vmulq_n_f32(vsubq_f32(vld1q_f32(minY), ORIGIN_Y), ray[3]);
+			const float32x4_t T2Y = vmulq_n_f32(vsubq_f32(vld1q_f32(maxY), ORIGIN_Y), ray[3]);
+
+			const float32x4_t T_ENTER = vmaxq_f32(vmaxq_f32(vminq_f32(T1X, T2X), vminq_f32(T1Y, T2Y)), vdupq_n_f32(0.f));
+			const float32x4_t T_EXIT = vminq_f32(vminq_f32(vmaxq_f32(T1X, T2X), vmaxq_f32(T1Y, T2Y)), vdupq_n_f32(ray[4]));
+			vst1q_f32(distances, T_ENTER);
+
+			uint32_t lanes[4];
+			vst1q_u32(lanes, vcleq_f32(T_ENTER, T_EXIT));
+			return (lanes[0] & 1u) | (lanes[1] & 2u) | (lanes[2] & 4u) | (lanes[3] & 8u);
+		#endif
+		}
+
+		/*!
+		 \brief Computes the Hamilton product of the quaternions \a lhs and \a rhs stored as [w, x, y, z].
+
+		 \param[in] lhs The 4 components of the left quaternion
+		 \param[in] rhs The 4 components of the right quaternion
+		 \param[out] result The 4 components receiving the product, may alias the operands
+
+		 \since v0.7.0
+		*/
+		inline void multiplyQuaternion(const float* lhs, const float* rhs, float* result) noexcept
+		{
+		#if defined(AEON_SIMD_SSE)
+			// r = lhs.w * rhs + lhs.x * [-x, w, -z, y] + lhs.y * [-y, z, w, -x] + lhs.z * [-z, -y, x, w]
+			const __m128 A = _mm_loadu_ps(lhs), B = _mm_loadu_ps(rhs);
+			const __m128 TERM_W = _mm_mul_ps(_mm_shuffle_ps(A, A, _MM_SHUFFLE(0, 0, 0, 0)), B);
+			const __m128 TERM_X = _mm_mul_ps(_mm_mul_ps(_mm_shuffle_ps(A, A, _MM_SHUFFLE(1, 1, 1, 1)), _mm_shuffle_ps(B, B, _MM_SHUFFLE(2, 3, 0, 1))), _mm_setr_ps(-1.f, 1.f, -1.f, 1.f));
+			const __m128 TERM_Y = _mm_mul_ps(_mm_mul_ps(_mm_shuffle_ps(A, A, _MM_SHUFFLE(2, 2, 2, 2)), _mm_shuffle_ps(B, B, _MM_SHUFFLE(1, 0, 3, 2))), _mm_setr_ps(-1.f, 1.f, 1.f, -1.f));
+			const __m128 TERM_Z = _mm_mul_ps(_mm_mul_ps(_mm_shuffle_ps(A, A, _MM_SHUFFLE(3, 3, 3, 3)), _mm_shuffle_ps(B, B, _MM_SHUFFLE(0, 1, 2, 3))), _mm_setr_ps(-1.f, -1.f, 1.f, 1.f));
+			_mm_storeu_ps(result, _mm_add_ps(_mm_add_ps(TERM_W, TERM_X), _mm_add_ps(TERM_Y, TERM_Z)));
+		#else
+			const float32x4_t B = vld1q_f32(rhs);
+			const float SHUFFLED_X[4] = { -rhs[1], rhs[0], -rhs[3], rhs[2] };
+			const float SHUFFLED_Y[4] = { -rhs[2], rhs[3], rhs[0], -rhs[1] };
+			const float SHUFFLED_Z[4] = { -rhs[3], -rhs[2], rhs[1], rhs[0] };
+
+			float32x4_t product = vmulq_n_f32(B, lhs[0]);
+			product = vmlaq_n_f32(product, vld1q_f32(SHUFFLED_X), lhs[1]);
+			product = vmlaq_n_f32(product, vld1q_f32(SHUFFLED_Y), lhs[2]);
+			product = vmlaq_n_f32(product, vld1q_f32(SHUFFLED_Z), lhs[3]);
+			vst1q_f32(result, product);
+		#endif
+		}
+
+		/*!
+		 \brief Computes the Hamilton products of 4 pairs of consecutive quaternions stored as [w, x, y, z].
+		 \details The quaternions are transposed so that each register contains the same component of the 4 quaternions, and transposed back once multiplied.
+
+		 \param[in] lhs The 16 components of the 4 left quaternions
+		 \param[in] rhs The 16 components of the 4 right quaternions
+		 \param[out] result The 16 components receiving the 4 products, may alias the operands
+
+		 \since v0.7.0
+		*/
+		inline void multiplyQuaternions4(const float* lhs, const float* rhs, float* result) noexcept
+		{
+		#if defined(AEON_SIMD_SSE)
+			__m128 aw = _mm_loadu_ps(lhs), ax = _mm_loadu_ps(lhs + 4), ay = _mm_loadu_ps(lhs + 8), az = _mm_loadu_ps(lhs + 12);
+			__m128 bw = _mm_loadu_ps(rhs), bx = _mm_loadu_ps(rhs + 4), by = _mm_loadu_ps(rhs + 8), bz = _mm_loadu_ps(rhs + 12);
+			_MM_TRANSPOSE4_PS(aw, ax, ay, az);
+			_MM_TRANSPOSE4_PS(bw, bx, by, bz);
+
+			__m128 rw = _mm_sub_ps(_mm_sub_ps(_mm_mul_ps(aw, bw), _mm_mul_ps(ax, bx)), _mm_add_ps(_mm_mul_ps(ay, by), _mm_mul_ps(az, bz)));
+			__m128 rx = _mm_add_ps(_mm_add_ps(_mm_mul_ps(aw, bx), _mm_mul_ps(ax, bw)), _mm_sub_ps(_mm_mul_ps(ay, bz), _mm_mul_ps(az, by)));
+			__m128 ry = _mm_add_ps(_mm_sub_ps(_mm_mul_ps(aw, by), _mm_mul_ps(ax, bz)), _mm_add_ps(_mm_mul_ps(ay, bw), _mm_mul_ps(az, bx)));
+			__m128 rz = _mm_add_ps(_mm_add_ps(_mm_mul_ps(aw, bz), _mm_mul_ps(ax, by)), _mm_sub_ps(_mm_mul_ps(az, bw), _mm_mul_ps(ay, bx)));
+
+			_MM_TRANSPOSE4_PS(rw, rx, ry, rz);
+			_mm_storeu_ps(result, rw);
+			_mm_storeu_ps(result + 4, rx);
+			_mm_storeu_ps(result + 8, ry);
+			_mm_storeu_ps(result + 12, rz);
+		#else
+			// The structured loads and stores deinterleave and interleave the components
+			const float32x4x4_t A = vld4q_f32(lhs), B = vld4q_f32(rhs);
+			float32x4x4_t r;
+			r.val[0] = vsubq_f32(vsubq_f32(vmulq_f32(A.val[0], B.val[0]), vmulq_f32(A.val[1], B.val[1])), vaddq_f32(vmulq_f32(A.val[2], B.val[2]), vmulq_f32(A.val[3], B.val[3])));
+			r.val[1] = vaddq_f32(vaddq_f32(vmulq_f32(A.val[0], B.val[1]), vmulq_f32(A.val[1], B.val[0])), vsubq_f32(vmulq_f32(A.val[2], B.val[3]), vmulq_f32(A.val[3], B.val[2])));
+			r.val[2] = vaddq_f32(vsubq_f32(vmulq_f32(A.val[0], B.val[2]), vmulq_f32(A.val[1], B.val[3])), vaddq_f32(vmulq_f32(A.val[2], B.val[0]), vmulq_f32(A.val[3], B.val[1])));
+			r.val[3] = vaddq_f32(vaddq_f32(vmulq_f32(A.val[0], B.val[3]), vmulq_f32(A.val[1], B.val[2])), vsubq_f32(vmulq_f32(A.val[3], B.val[0]), vmulq_f32(A.val[2], B.val[1])));
+			vst4q_f32(result, r);
+		#endif
+		}
+
+		/*!
+		 \brief Blends 4 pairs of consecutive quaternions stored as [w, x, y, z] with the weights provided and normalizes the results.
+		 \details Each result is normalize(q0 * weights0 + q1 * weights1), which is the normalized linear interpolation if the weights are 1 - t and t, and the spherical one if they're the slerp's weights.
+		 \note A null blend results in the identity quaternion.
+
+		 \param[in] q0 The 16 components of the 4 first quaternions
+		 \param[in] q1 The 16 components of the 4 second quaternions
+		 \param[in] weights0 The 4 weights of the first quaternions
+		 \param[in] weights1 The 4 weights of the second quaternions
+		 \param[out] result The 16 components receiving the 4 blended quaternions, may alias the quaternions
+
+		 \since v0.7.0
+		*/
+		inline void blendQuaternions4(const float* q0, const float* q1, const float* weights0, const float* weights1, float* result) noexcept
+		{
+		#if defined(AEON_SIMD_SSE)
+			__m128 aw = _mm_loadu_ps(q0), ax = _mm_loadu_ps(q0 + 4), ay = _mm_loadu_ps(q0 + 8), az = _mm_loadu_ps(q0 + 12);
+			__m128 bw = _mm_loadu_ps(q1), bx = _mm_loadu_ps(q1 + 4), by = _mm_loadu_ps(q1 + 8), bz = _mm_loadu_ps(q1 + 12);
+			_MM_TRANSPOSE4_PS(aw, ax, ay, az);
+			_MM_TRANSPOSE4_PS(bw, bx, by, bz);
+
+			const __m128 W0 = _mm_loadu_ps(weights0), W1 = _mm_loadu_ps(weights1);
+			__m128 rw = _mm_add_ps(_mm_mul_ps(aw, W0), _mm_mul_ps(bw, W1));
+			__m128 rx = _mm_add_ps(_mm_mul_ps(ax, W0), _mm_mul_ps(bx, W1));
+			__m128 ry = _mm_add_ps(_mm_mul_ps(ay, W0), _mm_mul_ps(by, W1));
+			__m128 rz = _mm_add_ps(_mm_mul_ps(az, W0), _mm_mul_ps(bz, W1));
+
+			// Normalize the 4 results, the null ones being replaced by the identity
+			const __m128 SQUARED_MAGNITUDE = _mm_add_ps(_mm_add_ps(_mm_mul_ps(rw, rw), _mm_mul_ps(rx, rx)), _mm_add_ps(_mm_mul_ps(ry, ry), _mm_mul_ps(rz, rz)));
+			const __m128 VALID = _mm_cmpgt_ps(SQUARED_MAGNITUDE, _mm_setzero_ps());
+			const __m128 INV_MAGNITUDE = _mm_and_ps(_mm_div_ps(_mm_set1_ps(1.f), _mm_sqrt_ps(SQUARED_MAGNITUDE)), VALID);
+			rw = _mm_or_ps(_mm_mul_ps(rw, INV_MAGNITUDE), _mm_andnot_ps(VALID, _mm_set1_ps(1.f)));
+			rx = _mm_mul_ps(rx, INV_MAGNITUDE);
+			ry = _mm_mul_ps(ry, INV_MAGNITUDE);
+			rz = _mm_mul_ps(rz, INV_MAGNITUDE);
+
+			_MM_TRANSPOSE4_PS(rw, rx, ry, rz);
+			_mm_storeu_ps(result, rw);
+			_mm_storeu_ps(result + 4, rx);
+			_mm_storeu_ps(result + 8, ry);
+			_mm_storeu_ps(result + 12, rz);
+		#else
+			const float32x4x4_t A = vld4q_f32(q0), B = vld4q_f32(q1);
+			const float32x4_t W0 = vld1q_f32(weights0), W1 = vld1q_f32(weights1);
+
+			float32x4x4_t r;
+			for (int i = 0; i < 4; ++i) {
+				r.val[i] = vmlaq_f32(vmulq_f32(A.val[i], W0), B.val[i], W1);
+			}
+
+			// Normalize the 4 results, the null ones being replaced by the identity
+			float32x4_t squaredMagnitude = vmulq_f32(r.val[0], r.val[0]);
+			for (int i = 1; i < 4; ++i) {
+				squaredMagnitude = vmlaq_f32(squaredMagnitude, r.val[i], r.val[i]);
+			}
+			float magnitudes[4];
+			vst1q_f32(magnitudes, squaredMagnitude);
+			for (float& magnitude : magnitudes) {
+				magnitude = (magnitude > 0.f) ? 1.f / std::sqrt(magnitude) : 0.f;
+			}
+			const float32x4_t INV_MAGNITUDE = vld1q_f32(magnitudes);
+			const uint32x4_t NULL_BLEND = vceqq_f32(INV_MAGNITUDE, vdupq_n_f32(0.f));
+			for (int i = 0; i < 4; ++i) {
+				r.val[i] = vmulq_f32(r.val[i], INV_MAGNITUDE);
+			}
+			r.val[0] = vbslq_f32(NULL_BLEND, vdupq_n_f32(1.f), r.val[0]);
+			vst4q_f32(result, r);
+		#endif
+		}
+
+		/*!
+		 \brief Classifies a volume (a box, a sphere or both combined) against 4 planes stored as separate arrays of components.
+		 \details Each plane is expressed as a normal and a distance to the origin: a point lies in front of it if dot(normal, point) + distance is positive.
+		 The volume is the box of center \a center and half-size \a extent, inflated by the \a radius (an extent of 0 tests a sphere, a radius of 0 tests a box).
+		 \note The normals must be normalized for the \a radius to be expressed in world units.
+
+		 \param[in] planes The 16 components of the 4 planes: their normals' X, Y and Z components followed by their distances
+		 \param[in] center The 3 coordinates of the volume's center
+		 \param[in] extent The 3 non-negative half-sizes of the volume's box
+		 \param[in] radius The non-negative radius of the volume's sphere
+		 \param[out] straddling The 4-bit mask whose bit i is set if the volume isn't entirely in front of the plane i
+
+		 \return A 4-bit mask whose bit i is set if the volume lies entirely behind the plane i
+
+		 \since v0.7.0
+		*/
+		inline unsigned int classifyPlanes4(const float* planes, const float* center, const float* extent, float radius, unsigned int& straddling) noexcept
+		{
+			// The volume is behind a plane if its center's distance is lower than the negated projected radius, and in front if it's greater than it
+		#if defined(AEON_SIMD_SSE)
+			const __m128 NX = _mm_loadu_ps(planes), NY = _mm_loadu_ps(planes + 4), NZ = _mm_loadu_ps(planes + 8);
+			__m128 distance = _mm_add_ps(_mm_loadu_ps(planes + 12), _mm_mul_ps(NX, _mm_set1_ps(center[0])));
+			distance = _mm_add_ps(distance, _mm_mul_ps(NY, _mm_set1_ps(center[1])));
+			distance = _mm_add_ps(distance, _mm_mul_ps(NZ, _mm_set1_ps(center[2])));
+
+			const __m128 ABS_MASK = _mm_castsi128_ps(_mm_set1_epi32(0x7FFFFFFF));
+			__m128 reach = _mm_add_ps(_mm_set1_ps(radius), _mm_mul_ps(_mm_and_ps(NX, ABS_MASK), _mm_set1_ps(extent[0])));
+			reach = _mm_add_ps(reach, _mm_mul_ps(_mm_and_ps(NY, ABS_MASK), _mm_set1_ps(extent[1])));
+			reach = _mm_add_ps(reach, _mm_mul_ps(_mm_and_ps(NZ, ABS_MASK), _mm_set1_ps(extent[2])));
+
+			straddling = static_cast<unsigned int>(_mm_movemask_ps(_mm_cmplt_ps(distance, reach)));
+			return static_cast<unsigned int>(_mm_movemask_ps(_mm_cmplt_ps(distance, _mm_sub_ps(_mm_setzero_ps(), reach))));
+		#else
+			const float32x4_t NX = vld1q_f32(planes), NY = vld1q_f32(planes + 4), NZ = vld1q_f32(planes + 8);
+			float32x4_t distance = vmlaq_n_f32(vld1q_f32(planes + 12), NX, center[0]);
+			distance = vmlaq_n_f32(distance, NY, center[1]);
+			distance = vmlaq_n_f32(distance, NZ, center[2]);
+
+			float32x4_t reach = vmlaq_n_f32(vdupq_n_f32(radius), vabsq_f32(NX), extent[0]);
+			reach = vmlaq_n_f32(reach, vabsq_f32(NY), extent[1]);
+			reach = vmlaq_n_f32(reach, vabsq_f32(NZ), extent[2]);
+
+			uint32_t lanes[4];
+			vst1q_u32(lanes, vcltq_f32(distance, reach));
+			straddling = (lanes[0] & 1u) | (lanes[1] & 2u) | (lanes[2] & 4u) | (lanes[3] & 8u);
+			vst1q_u32(lanes, vcltq_f32(distance, vnegq_f32(reach)));
+			return (lanes[0] & 1u) | (lanes[1] & 2u) | (lanes[2] & 4u) | (lanes[3] & 8u);
+		#endif
+		}
+#else
+		// Declarations only, the operators' branches that call the kernels are discarded at compile time
+		template <char op>
+		void combine4(const float* lhs, const float* rhs, float* result) noexcept;
+		void scale4(const float* vec, float scalar, float* result) noexcept;
+		void multiplyMatrix4(const float* lhs, const float* rhs, float* result) noexcept;
+		void transformVector4(const float* mat, const float* vec, float* result) noexcept;
+		void transformPoint3(const float* mat, const float* point, float* result) noexcept;
+		float invertMatrix4(const float* mat, float* result) noexcept;
+		unsigned int overlapBoxes4(const float* minX, const float* minY, const float* maxX, const float* maxY, const float* box) noexcept;
+		void multiplyQuaternion(const float* lhs, const float* rhs, float* result) noexcept;
+		void multiplyQuaternions4(const float* lhs, const float* rhs, float* result) noexcept;
+		void blendQuaternions4(const float* q0, const float* q1, const float* weights0, const float* weights1, float* result) noexcept;
+		unsigned int raycastBoxes4(const float* minX, const float* minY, const float* maxX, const float* maxY, const float* ray, float* distances) noexcept;
+		unsigned int classifyPlanes4(const float* planes, const float* center, const float* extent, float radius, unsigned int& straddling) noexcept;
+#endif // AEON_SIMD
+	}
+}
+#endif // Aeon_Math_SIMD_H_
+
+/*!
+ \namespace ae::SIMD
+ \ingroup math
+
+ The namespace ae::SIMD provides the SIMD kernels used by the 4-dimensional
+ vectors of floats (ae::Vector4f) and the 4x4 matrices of floats
+ (ae::Matrix4f). The instruction set (SSE, AVX or NEON) is selected at
+ compile time by the AEON_SIMD macros of the configuration; if none is
+ available or if AEON_NO_SIMD is defined, the scalar implementations of the
+ ae::Vector and ae::Matrix operators are used instead.
+
+ The API user doesn't interact with this namespace directly, the operators
+ select the kernels at compile time without any change to their interface.
+
+ \author Filippos Gleglakos
+ \version v0.7.0
+ \date 2021.07.25
+ \copyright MIT License
+*/
\ No newline at end of file
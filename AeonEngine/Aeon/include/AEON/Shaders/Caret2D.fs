@@ -0,0 +1,33 @@
+R"(
+#version 450 core
+
+in VS_OUT {
+	vec4 color;
+	vec2 uv;
+} fs_in;
+
+layout (shared) uniform uTransformBlock {
+	mat4 model;
+	mat4 view;
+	mat4 projection;
+	mat4 viewProjection;
+	mat4 mvp;
+	mat4 viewProjections[8];
+	int  viewOffset;
+	float time;
+} uTransform;
+
+uniform sampler2D uTexture;
+
+const float BLINK_PERIOD = 1.0;
+
+out vec4 color;
+
+void main()
+{
+	// The vertices flagged by their horizontal texture coordinate blink, their vertical one holding the phase at which the blink started
+	float visible = step(fract(uTransform.time / BLINK_PERIOD - fs_in.uv.y), 0.5);
+	color = fs_in.color * texture(uTexture, fs_in.uv);
+	color.a *= mix(1.0, visible, fs_in.uv.x);
+}
+)"
\ No newline at end of file
@@ -0,0 +1,93 @@
+R"(
+#version 450 core
+
+layout (local_size_x = 256) in;
+
+struct Instance {
+	vec2  axisX;
+	vec2  axisY;
+	vec2  origin;
+	vec2  uvMin;
+	vec2  uvMax;
+	uint  color;
+	float depth;
+};
+
+struct DrawCommand {
+	uint count;
+	uint instanceCount;
+	uint firstIndex;
+	int  baseVertex;
+	uint baseInstance;
+};
+
+layout (std430, binding = 1) readonly buffer uInstanceBlock {
+	Instance instances[];
+};
+
+layout (std430, binding = 2) writeonly buffer uCulledInstanceBlock {
+	Instance culledInstances[];
+};
+
+layout (std430, binding = 3) writeonly buffer uCommandBlock {
+	DrawCommand commands[];
+};
+
+layout (shared) uniform uTransformBlock {
+	mat4 model;
+	mat4 view;
+	mat4 projection;
+	mat4 viewProjection;
+	mat4 mvp;
+	mat4 viewProjections[8];
+	int  viewOffset;
+	float time;
+} uTransform;
+
+uniform uint uFirstInstance;
+uniform uint uInstanceCount;
+
+shared uint sPositions[256];
+
+bool isVisible(Instance instance)
+{
+	// Project the quad's corners and check whether their bounds overlap the view volume
+	vec4 corner0 = uTransform.viewProjection * vec4(instance.origin, instance.depth, 1.0);
+	vec4 axisX = uTransform.viewProjection * vec4(instance.axisX, 0.0, 0.0);
+	vec4 axisY = uTransform.viewProjection * vec4(instance.axisY, 0.0, 0.0);
+	vec2 ndc0 = corner0.xy / corner0.w;
+	vec2 ndc1 = (corner0.xy + axisX.xy) / (corner0.w + axisX.w);
+	vec2 ndc2 = (corner0.xy + axisY.xy) / (corner0.w + axisY.w);
+	vec2 ndc3 = (corner0.xy + axisX.xy + axisY.xy) / (corner0.w + axisX.w + axisY.w);
+
+	vec2 minNDC = min(min(ndc0, ndc1), min(ndc2, ndc3));
+	vec2 maxNDC = max(max(ndc0, ndc1), max(ndc2, ndc3));
+	return all(lessThanEqual(minNDC, vec2(1.0))) && all(greaterThanEqual(maxNDC, vec2(-1.0)));
+}
+
+void main()
+{
+	uint localIndex = gl_LocalInvocationID.x;
+	uint index = uFirstInstance + gl_GlobalInvocationID.x;
+	bool visible = gl_GlobalInvocationID.x < uInstanceCount && isVisible(instances[index]);
+
+	// Compute the position of each visible instance within the work group's range so that the instances keep their order
+	sPositions[localIndex] = (visible) ? 1u : 0u;
+	barrier();
+	for (uint stride = 1u; stride < 256u; stride <<= 1u) {
+		uint previous = (localIndex >= stride) ? sPositions[localIndex - stride] : 0u;
+		barrier();
+		sPositions[localIndex] += previous;
+		barrier();
+	}
+
+	// Compact the visible instances and write the work group's drawing command
+	uint groupFirst = uFirstInstance + gl_WorkGroupID.x * 256u;
+	if (visible) {
+		culledInstances[groupFirst + sPositions[localIndex] - 1u] = instances[index];
+	}
+	if (localIndex == 255u) {
+		commands[groupFirst / 256u] = DrawCommand(6u, sPositions[255], 0u, 0, groupFirst);
+	}
+}
+)"
\ No newline at end of file
@@ -0,0 +1,17 @@
+R"(
+#version 450 core
+
+in VS_OUT {
+	vec4 color;
+	vec2 offset;
+} fs_in;
+
+out vec4 color;
+
+void main()
+{
+	// Quadratic falloff reaching zero at the light's radius, the alpha channel holding the intensity
+	float attenuation = clamp(1.0 - length(fs_in.offset), 0.0, 1.0);
+	color = vec4(fs_in.color.rgb * fs_in.color.a * attenuation * attenuation, 0.0);
+}
+)"
\ No newline at end of file
@@ -0,0 +1,23 @@
+R"(
+#version 450 core
+
+layout (location = 0) in vec2  aCorner;
+layout (location = 1) in vec2  aCenter;
+layout (location = 2) in float aRadius;
+layout (location = 3) in vec4  aColor;
+
+uniform mat4 uViewProjection;
+
+out VS_OUT {
+	vec4 color;
+	vec2 offset;
+} vs_out;
+
+void main()
+{
+	// The quad circumscribes the light's radius, the offset being the fragment's position relative to the radius
+	vs_out.color = aColor;
+	vs_out.offset = aCorner * 2.0 - 1.0;
+	gl_Position = uViewProjection * vec4(aCenter + vs_out.offset * aRadius, 0.0, 1.0);
+}
+)"
\ No newline at end of file
@@ -0,0 +1,17 @@
+R"(
+#version 450 core
+
+in VS_OUT {
+	vec2 uv;
+} fs_in;
+
+layout (binding = 0) uniform sampler2D uLightBuffer;
+
+out vec4 color;
+
+void main()
+{
+	// The scene's colors are multiplied by the accumulated light through the blending
+	color = vec4(texture(uLightBuffer, fs_in.uv).rgb, 1.0);
+}
+)"
\ No newline at end of file
@@ -0,0 +1,43 @@
+R"(
+#version 450 core
+
+struct Material {
+	vec3  ambient;
+	float shininess;
+	vec3  diffuse;
+	vec3  specular;
+};
+
+layout (std430) readonly buffer uMaterialBuffer {
+	Material materials[];
+};
+
+in VS_OUT {
+	vec3 position;
+	vec3 normal;
+	vec2 uv;
+	vec3 cameraPosition;
+} fs_in;
+
+uniform uint      uMaterialID;
+uniform sampler2D uTexture;
+
+out vec4 color;
+
+// The direction towards the scene's single directional light
+const vec3 LIGHT_DIRECTION = normalize(vec3(0.3, 1.0, 0.5));
+
+void main()
+{
+	Material material = materials[uMaterialID];
+	vec4 albedo = texture(uTexture, fs_in.uv);
+
+	// Blinn-Phong shading
+	vec3 normal = normalize(fs_in.normal);
+	vec3 halfway = normalize(LIGHT_DIRECTION + normalize(fs_in.cameraPosition - fs_in.position));
+	float diffuse = max(dot(normal, LIGHT_DIRECTION), 0.0);
+	float specular = (diffuse > 0.0) ? pow(max(dot(normal, halfway), 0.0), material.shininess) : 0.0;
+
+	color = vec4((material.ambient + material.diffuse * diffuse) * albedo.rgb + material.specular * specular, albedo.a);
+}
+)"
\ No newline at end of file
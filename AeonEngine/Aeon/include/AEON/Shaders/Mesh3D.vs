@@ -0,0 +1,39 @@
+R"(
+#version 450 core
+
+layout (location = 0) in vec3 aPosition;
+layout (location = 1) in vec3 aNormal;
+layout (location = 2) in vec2 aUV;
+layout (location = 3) in mat4 aModel;
+
+layout (shared) uniform uTransformBlock {
+	mat4 model;
+	mat4 view;
+	mat4 projection;
+	mat4 viewProjection;
+	mat4 mvp;
+	mat4 viewProjections[8];
+	int  viewOffset;
+	float time;
+} uTransform;
+
+out VS_OUT {
+	vec3 position;
+	vec3 normal;
+	vec2 uv;
+	vec3 cameraPosition;
+} vs_out;
+
+void main()
+{
+	vec4 position = aModel * vec4(aPosition, 1.0);
+
+	// The models are expected to be scaled uniformly, their upper 3x3 matrix then transforms the normals
+	vs_out.position = position.xyz;
+	vs_out.normal = mat3(aModel) * aNormal;
+	vs_out.uv = aUV;
+	vs_out.cameraPosition = -transpose(mat3(uTransform.view)) * uTransform.view[3].xyz;
+
+	gl_Position = uTransform.viewProjection * position;
+}
+)"
\ No newline at end of file
@@ -0,0 +1,28 @@
+R"(
+#version 450 core
+
+in VS_OUT {
+	vec4 color;
+	vec2 uv;
+	flat int textureSlot;
+} fs_in;
+
+layout (binding = 0) uniform sampler2D uTextures[16];
+
+out vec4 color;
+
+void main()
+{
+	// The sampler array may only be indexed uniformly, so the texture is fetched with explicit gradients within the loop
+	vec2 dx = dFdx(fs_in.uv);
+	vec2 dy = dFdy(fs_in.uv);
+	vec4 texel = vec4(0.0);
+	for (int i = 0; i < 16; ++i) {
+		if (i == fs_in.textureSlot) {
+			texel = textureGrad(uTextures[i], fs_in.uv, dx, dy);
+		}
+	}
+
+	color = fs_in.color * texel;
+}
+)"
\ No newline at end of file
@@ -0,0 +1,39 @@
+R"(
+#version 450 core
+#extension GL_ARB_shader_viewport_layer_array : enable
+
+layout (location = 0) in vec3  aPosition;
+layout (location = 1) in vec4  aColor;
+layout (location = 2) in vec2  aUV;
+layout (location = 4) in float aTextureSlot;
+
+layout (shared) uniform uTransformBlock {
+	mat4 model;
+	mat4 view;
+	mat4 projection;
+	mat4 viewProjection;
+	mat4 mvp;
+	mat4 viewProjections[8];
+	int  viewOffset;
+	float time;
+} uTransform;
+
+out VS_OUT {
+	vec4 color;
+	vec2 uv;
+	flat int textureSlot;
+} vs_out;
+
+void main()
+{
+	vs_out.color = aColor;
+	vs_out.uv = aUV;
+	vs_out.textureSlot = int(aTextureSlot);
+	// Each instance draws the geometry into one of the scene's views
+	int view = gl_InstanceID + uTransform.viewOffset;
+	gl_Position = uTransform.viewProjections[view] * vec4(aPosition, 1.0);
+#ifdef GL_ARB_shader_viewport_layer_array
+	gl_ViewportIndex = view;
+#endif
+}
+)"
\ No newline at end of file
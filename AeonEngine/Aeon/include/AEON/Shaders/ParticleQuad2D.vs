@@ -0,0 +1,50 @@
+R"(
+#version 450 core
+
+layout (location = 0) in vec2 aCorner;
+
+struct Particle {
+	vec2  position;
+	vec2  velocity;
+	vec4  color;
+	float life;
+	float lifetime;
+	float size;
+	float padding;
+};
+
+layout (std430) readonly buffer uParticleBuffer {
+	int      spawnBudget;
+	Particle particles[];
+};
+
+layout (shared) uniform uTransformBlock {
+	mat4 model;
+	mat4 view;
+	mat4 projection;
+	mat4 viewProjection;
+	mat4 mvp;
+	mat4 viewProjections[8];
+	int  viewOffset;
+	float time;
+} uTransform;
+
+uniform float uDepth;
+
+out VS_OUT {
+	vec4 color;
+	vec2 uv;
+} vs_out;
+
+void main()
+{
+	Particle particle = particles[gl_InstanceID];
+	vs_out.color = particle.color;
+	vs_out.uv = aCorner;
+
+	// The dead particles are collapsed into degenerate quads
+	float size = (particle.life > 0.0) ? particle.size : 0.0;
+	vec2 position = particle.position + (aCorner - 0.5) * size;
+	gl_Position = uTransform.viewProjection * vec4(position, uDepth, 1.0);
+}
+)"
\ No newline at end of file
@@ -0,0 +1,81 @@
+R"(
+#version 450 core
+
+layout (local_size_x = 256) in;
+
+struct Particle {
+	vec2  position;
+	vec2  velocity;
+	vec4  color;
+	float life;
+	float lifetime;
+	float size;
+	float padding;
+};
+
+layout (std430) buffer uParticleBuffer {
+	int      spawnBudget;
+	Particle particles[];
+};
+
+uniform uint  uParticleCount;
+uniform uint  uSeed;
+uniform float uDeltaTime;
+uniform vec2  uEmitterPosition;
+uniform vec2  uGravity;
+uniform vec2  uSpeedRange;
+uniform vec2  uAngleRange;
+uniform vec2  uLifetimeRange;
+uniform vec2  uSizeRange;
+uniform vec4  uStartColor;
+uniform vec4  uEndColor;
+
+uint hash(uint x)
+{
+	x ^= x >> 16;
+	x *= 0x7feb352du;
+	x ^= x >> 15;
+	x *= 0x846ca68bu;
+	x ^= x >> 16;
+	return x;
+}
+
+float random(inout uint state)
+{
+	state = hash(state);
+	return float(state) / 4294967295.0;
+}
+
+void main()
+{
+	uint index = gl_GlobalInvocationID.x;
+	if (index >= uParticleCount) {
+		return;
+	}
+
+	Particle particle = particles[index];
+	if (particle.life > 0.0) {
+		particle.life -= uDeltaTime;
+		particle.velocity += uGravity * uDeltaTime;
+		particle.position += particle.velocity * uDeltaTime;
+	}
+	else if (atomicAdd(spawnBudget, -1) > 0) {
+		uint state = hash(index ^ hash(uSeed));
+		float angle = mix(uAngleRange.x, uAngleRange.y, random(state));
+		float speed = mix(uSpeedRange.x, uSpeedRange.y, random(state));
+
+		particle.position = uEmitterPosition;
+		particle.velocity = vec2(cos(angle), sin(angle)) * speed;
+		particle.lifetime = mix(uLifetimeRange.x, uLifetimeRange.y, random(state));
+		particle.life = particle.lifetime;
+	}
+	else {
+		return;
+	}
+
+	float progress = 1.0 - clamp(particle.life / particle.lifetime, 0.0, 1.0);
+	particle.color = mix(uStartColor, uEndColor, progress);
+	particle.size = mix(uSizeRange.x, uSizeRange.y, progress);
+	particles[index] = particle;
+}
+)"
\ No newline at end of file
@@ -0,0 +1,15 @@
+R"(
+#version 450 core
+
+out VS_OUT {
+	vec2 uv;
+} vs_out;
+
+void main()
+{
+	// A single triangle covering the whole viewport is generated from the vertex index
+	vec2 corner = vec2((gl_VertexID << 1) & 2, gl_VertexID & 2);
+	vs_out.uv = corner;
+	gl_Position = vec4(corner * 2.0 - 1.0, 0.0, 1.0);
+}
+)"
\ No newline at end of file
@@ -0,0 +1,13 @@
+R"(
+uniform vec2 uDirection;
+
+void main()
+{
+	// 9-tap gaussian kernel sampled in 5 fetches, the bilinear filtering weighting each pair of texels
+	vec2 offset1 = 1.3846153846 * uDirection * uTexelSize;
+	vec2 offset2 = 3.2307692308 * uDirection * uTexelSize;
+	color = texture(uSource, fs_in.uv) * 0.2270270270
+	      + (texture(uSource, fs_in.uv + offset1) + texture(uSource, fs_in.uv - offset1)) * 0.3162162162
+	      + (texture(uSource, fs_in.uv + offset2) + texture(uSource, fs_in.uv - offset2)) * 0.0702702703;
+}
+)"
\ No newline at end of file
@@ -0,0 +1,69 @@
+R"(
+#version 450 core
+
+in VS_OUT {
+	vec4 color;
+	vec2 uv;
+} fs_in;
+
+#ifdef AEON_TEXTURED
+uniform sampler2D uTexture;
+#endif
+#ifdef AEON_OUTLINE
+uniform float     uOutlineSize;
+uniform vec4      uOutlineColor;
+#endif
+
+out vec4 color;
+
+#ifdef AEON_TEXTURED
+#ifdef AEON_SDF
+// The smoothing width of the distance field, computed in uniform control flow as it relies on derivatives
+float smoothing;
+#endif
+
+// Retrieves the texel's coverage or color at the offset provided
+vec4 sampleTexel(vec2 offset)
+{
+	vec4 texel = texture(uTexture, fs_in.uv + offset);
+#if defined(AEON_SDF)
+	// The glyph's outline lies at the distance 0.5
+	return vec4(1.0, 1.0, 1.0, smoothstep(0.5 - smoothing, 0.5 + smoothing, texel.r));
+#elif defined(AEON_ALPHA_MASK)
+	return vec4(1.0, 1.0, 1.0, texel.r);
+#else
+	return texel;
+#endif
+}
+#endif
+
+void main()
+{
+#ifdef AEON_VERTEX_COLOR
+	color = fs_in.color;
+#else
+	color = vec4(1.0);
+#endif
+
+#ifdef AEON_TEXTURED
+#ifdef AEON_SDF
+	// The smoothing width follows the screen-space scale of the glyph
+	smoothing = max(fwidth(texture(uTexture, fs_in.uv).r) * 0.5, 0.0001);
+#endif
+	color *= sampleTexel(vec2(0.0));
+
+#ifdef AEON_OUTLINE
+	// The transparent fragments bordering an opaque texel are filled with the outline's color
+	if (color.a == 0.0) {
+		for (int x = -1; x <= 1; ++x) {
+			for (int y = -1; y <= 1; ++y) {
+				if ((x != 0 || y != 0) && sampleTexel(vec2(x, y) * uOutlineSize).a != 0.0) {
+					color = uOutlineColor;
+				}
+			}
+		}
+	}
+#endif
+#endif
+}
+)"
\ No newline at end of file
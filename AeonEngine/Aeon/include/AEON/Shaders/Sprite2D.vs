@@ -0,0 +1,53 @@
+R"(
+#version 450 core
+#extension GL_ARB_shader_viewport_layer_array : enable
+
+#ifdef AEON_INSTANCED
+layout (location = 0) in vec2  aCorner;
+layout (location = 1) in vec2  aAxisX;
+layout (location = 2) in vec2  aAxisY;
+layout (location = 3) in vec2  aOrigin;
+layout (location = 4) in vec4  aUVRect;
+layout (location = 5) in vec4  aColor;
+layout (location = 6) in float aDepth;
+#else
+layout (location = 0) in vec3 aPosition;
+layout (location = 1) in vec4 aColor;
+layout (location = 2) in vec2 aUV;
+#endif
+
+layout (shared) uniform uTransformBlock {
+	mat4 model;
+	mat4 view;
+	mat4 projection;
+	mat4 viewProjection;
+	mat4 mvp;
+	mat4 viewProjections[8];
+	int  viewOffset;
+	float time;
+} uTransform;
+
+out VS_OUT {
+	vec4 color;
+	vec2 uv;
+} vs_out;
+
+void main()
+{
+	vs_out.color = aColor;
+#ifdef AEON_INSTANCED
+	// The quad is expanded from its corner and the instance's axes
+	vs_out.uv = mix(aUVRect.xy, aUVRect.zw, aCorner);
+	vec2 position = aOrigin + aAxisX * aCorner.x + aAxisY * aCorner.y;
+	gl_Position = uTransform.viewProjection * vec4(position, aDepth, 1.0);
+#else
+	vs_out.uv = aUV;
+	// Each instance draws the geometry into one of the scene's views
+	int view = gl_InstanceID + uTransform.viewOffset;
+	gl_Position = uTransform.viewProjections[view] * vec4(aPosition, 1.0);
+#ifdef GL_ARB_shader_viewport_layer_array
+	gl_ViewportIndex = view;
+#endif
+#endif
+}
+)"
\ No newline at end of file
@@ -0,0 +1,36 @@
+R"(
+#version 450 core
+
+layout (location = 0) in vec2 aPosition;
+layout (location = 1) in vec2 aUV;
+
+layout (shared) uniform uTransformBlock {
+	mat4 model;
+	mat4 view;
+	mat4 projection;
+	mat4 viewProjection;
+	mat4 mvp;
+	mat4 viewProjections[8];
+	int  viewOffset;
+	float time;
+} uTransform;
+
+uniform mat4  uModel;
+uniform float uDepth;
+uniform vec4  uColor;
+
+out VS_OUT {
+	vec4 color;
+	vec2 uv;
+} vs_out;
+
+void main()
+{
+	vs_out.color = uColor;
+	vs_out.uv = aUV;
+
+	// The tiles are laid out in the map's local space, they all share the map's depth
+	vec4 position = uModel * vec4(aPosition, 0.0, 1.0);
+	gl_Position = uTransform.viewProjection * vec4(position.xy, uDepth, 1.0);
+}
+)"
\ No newline at end of file
@@ -25,8 +25,14 @@
 
 // Include all the necessary headers of the System module
 #include <AEON/System/FileSystem.h>
+#include <AEON/System/Archive.h>
+#include <AEON/System/FileWatcher.h>
 #include <AEON/System/Time.h>
 #include <AEON/System/Clock.h>
+#include <AEON/System/TimerWheel.h>
+#include <AEON/System/Task.h>
+#include <AEON/System/FrameStatistics.h>
+#include <AEON/System/Benchmark.h>
 
 #endif // Aeon_System_H_
 
@@ -0,0 +1,295 @@
+// MIT License
+// 
+// Copyright(c) 2019-2021 Filippos Gleglakos
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef Aeon_System_Archive_H_
+#define Aeon_System_Archive_H_
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <AEON/Config.h>
+#include <AEON/System/FileSystem.h>
+
+namespace ae
+{
+	/*!
+	 \brief Class representing a read-only archive of packed files, mapped in memory and indexed by the hash of their paths.
+	*/
+	class AEON_API Archive
+	{
+	public:
+		/*!
+		 \brief The compression applied to the archive's entries.
+		*/
+		enum class Compression : uint16_t
+		{
+			None = 0, //!< The entries are stored as-is
+			LZ4  = 1  //!< The entries are compressed with the LZ4 block format (an entry that doesn't shrink is stored as-is)
+		};
+
+	public:
+		// Public constructor(s)
+		/*!
+		 \brief Default constructor.
+		 \details Creates an empty archive which contains no entry.
+
+		 \since v0.7.0
+		*/
+		Archive() noexcept;
+		/*!
+		 \brief Deleted copy constructor.
+
+		 \since v0.7.0
+		*/
+		Archive(const Archive&) = delete;
+		/*!
+		 \brief Move constructor.
+
+		 \param[in] rvalue The ae::Archive that will be moved
+
+		 \since v0.7.0
+		*/
+		Archive(Archive&& rvalue) noexcept = default;
+
+		// Public operator(s)
+		/*!
+		 \brief Deleted assignment operator.
+
+		 \since v0.7.0
+		*/
+		Archive& operator=(const Archive&) = delete;
+		/*!
+		 \brief Move assignment operator.
+
+		 \param[in] rvalue The ae::Archive that will be moved
+
+		 \return The caller ae::Archive
+
+		 \since v0.7.0
+		*/
+		Archive& operator=(Archive&& rvalue) noexcept = default;
+
+		// Public method(s)
+		/*!
+		 \brief Opens the archive situated at the \a filepath provided.
+		 \details The archive is mapped in memory and its header and index are validated, the entries aren't accessed.
+
+		 \param[in] filepath The filepath of the archive
+
+		 \return True if the archive was opened, false otherwise
+
+		 \par Example:
+		 \code
+		 ae::Archive archive;
+		 if (archive.open("assets.pak")) {
+			...
+		 }
+		 \endcode
+
+		 \since v0.7.0
+		*/
+		bool open(const std::string& filepath);
+		/*!
+		 \brief Closes the archive.
+		 \details The views of uncompressed entries previously retrieved remain valid, the archive stays mapped until they're released.
+
+		 \since v0.7.0
+		*/
+		void close() noexcept;
+		/*!
+		 \brief Checks whether the archive contains an entry at the \a path provided.
+
+		 \param[in] path The path of the entry, backslashes and leading "./" being ignored
+
+		 \return True if the entry exists, false otherwise
+
+		 \since v0.7.0
+		*/
+		_NODISCARD bool contains(const std::string& path) const;
+		/*!
+		 \brief Retrieves the contents of the entry at the \a path provided.
+		 \details Uncompressed entries are viewed directly in the archive's mapping, compressed ones are decompressed into memory
+		 owned by the ae::FileSystem::MappedFile returned.
+
+		 \param[in] path The path of the entry, backslashes and leading "./" being ignored
+
+		 \return The ae::FileSystem::MappedFile, which isn't open if the entry doesn't exist or is corrupted
+
+		 \par Example:
+		 \code
+		 ae::FileSystem::MappedFile file = archive.map("Textures/player.png");
+		 \endcode
+
+		 \since v0.7.0
+		*/
+		_NODISCARD FileSystem::MappedFile map(const std::string& path) const;
+		/*!
+		 \brief Reads in the contents of the entry at the \a path provided into the \a buffer provided.
+
+		 \param[in] path The path of the entry, backslashes and leading "./" being ignored
+		 \param[out] buffer The buffer that will receive the entry's contents
+
+		 \return True if the entry was read in, false if it doesn't exist or is corrupted
+
+		 \since v0.7.0
+		*/
+		bool read(const std::string& path, std::vector<uint8_t>& buffer) const;
+		/*!
+		 \brief Checks whether the archive is open.
+
+		 \return True if the archive is open, false otherwise
+
+		 \since v0.7.0
+		*/
+		_NODISCARD bool isOpen() const noexcept;
+		/*!
+		 \brief Retrieves the number of entries of the archive.
+
+		 \return The number of entries, 0 if the archive isn't open
+
+		 \since v0.7.0
+		*/
+		_NODISCARD size_t getEntryCount() const noexcept;
+		/*!
+		 \brief Retrieves the filepath of the archive.
+
+		 \return The archive's filepath, empty if it isn't open
+
+		 \since v0.7.0
+		*/
+		_NODISCARD const std::string& getFilepath() const noexcept;
+
+		// Public static method(s)
+		/*!
+		 \brief Packs the files situated at the \a filepaths provided into a new archive at the \a archivePath provided.
+		 \details Each file is stored under its filepath, it's thus recommended to provide paths relative to the working directory
+		 which match the ones passed to the loaders.
+
+		 \param[in] archivePath The filepath of the archive created, an existing file is replaced
+		 \param[in] filepaths The filepaths of the files to pack
+		 \param[in] compression The ae::Archive::Compression applied to the entries, ae::Archive::Compression::LZ4 by default
+
+		 \return True if the archive was created, false otherwise
+
+		 \par Example:
+		 \code
+		 ae::Archive::pack("assets.pak", { "Textures/player.png", "Fonts/Roboto.ttf", "Shaders/sprite.vert" });
+		 \endcode
+
+		 \since v0.7.0
+		*/
+		static bool pack(const std::string& archivePath, const std::vector<std::string>& filepaths, Compression compression = Compression::LZ4);
+
+	private:
+		/*!
+		 \brief The structure representing an entry of the archive's index.
+		*/
+		struct Entry
+		{
+			// Public member(s)
+			uint64_t    hash;        //!< The hash of the entry's path
+			uint64_t    offset;      //!< The offset of the entry's contents within the archive
+			uint64_t    storedSize;  //!< The number of bytes stored in the archive
+			uint64_t    size;        //!< The number of bytes of the entry once decompressed
+			uint32_t    pathOffset;  //!< The offset of the entry's path within the string table
+			uint16_t    pathLength;  //!< The length of the entry's path
+			Compression compression; //!< The compression applied to the entry
+		};
+
+		// Private method(s)
+		/*!
+		 \brief Retrieves the index entry of the \a path provided.
+		 \details The index is sorted by hash, the entry is found with a binary search and its path is compared to resolve collisions.
+
+		 \param[in] path The path of the entry
+		 \param[out] entry The entry found
+
+		 \return True if the entry was found, false otherwise
+
+		 \since v0.7.0
+		*/
+		bool find(const std::string& path, Entry& entry) const;
+
+		// Private static method(s)
+		/*!
+		 \brief Normalizes the \a path provided so that it matches the paths stored in the index.
+		 \details Backslashes are replaced by slashes and the leading "./" are removed.
+
+		 \param[in] path The path to normalize
+
+		 \return The normalized path
+
+		 \since v0.7.0
+		*/
+		_NODISCARD static std::string normalizePath(const std::string& path);
+
+		// Private member(s)
+		std::shared_ptr<const FileSystem::MappedFile> mMapping;    //!< The archive mapped in memory, shared with the views of its entries
+		const uint8_t*                                mIndex;      //!< The pointer to the index within the mapping
+		const char*                                   mStrings;    //!< The pointer to the string table within the mapping
+		uint32_t                                      mStringSize; //!< The size of the string table
+		uint32_t                                      mEntryCount; //!< The number of entries
+		std::string                                   mFilepath;   //!< The archive's filepath
+	};
+}
+#endif // Aeon_System_Archive_H_
+
+/*!
+ \class ae::Archive
+ \ingroup system
+
+ The ae::Archive class packs many files into a single one so that they're
+ loaded with a single file open. The archive is mapped in memory and its index,
+ sorted by the 64-bit FNV-1a hash of the entries' paths, is searched directly
+ within the mapping when an entry is looked up.
+
+ Each entry may be compressed with the LZ4 block format, which is decompressed
+ fast enough for the archive to be read faster than the loose files. Entries
+ that don't shrink are stored as-is and are viewed without any copy.
+
+ Archives are usually mounted with ae::FileSystem::mountArchive(), in which
+ case every read performed through ae::FileSystem (and thus by the texture,
+ font, texture atlas and shader loaders) checks the mounted archives before
+ the files on disk.
+
+ Layout (little-endian):
+ \li Header: identifier "AEPK", version, entry count, string table size, index offset
+ \li Contents of the entries
+ \li Index: hash, offset, stored size, size, path offset, path length and compression of each entry, sorted by hash
+ \li String table: the entries' paths
+
+ Usage example:
+ \code
+ // Pack the assets (usually done with a build step)
+ ae::Archive::pack("assets.pak", { "Textures/player.png", "Fonts/Roboto.ttf" });
+
+ // Mount the archive, the loaders then read the assets from it
+ ae::FileSystem::mountArchive("assets.pak");
+ texture->loadFromFile("Textures/player.png");
+ \endcode
+
+ \author Filippos Gleglakos
+ \version v0.7.0
+ \date 2021.07.05
+ \copyright MIT License
+*/
\ No newline at end of file
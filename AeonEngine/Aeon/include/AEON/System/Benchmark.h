@@ -0,0 +1,227 @@
+// MIT License
+// 
+// Copyright(c) 2019-2021 Filippos Gleglakos
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef Aeon_System_Benchmark_H_
+#define Aeon_System_Benchmark_H_
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <AEON/Config.h>
+#include <AEON/System/Time.h>
+#include <AEON/System/Clock.h>
+
+namespace ae
+{
+	/*!
+	 \brief Class used to measure the average duration of small operations by running them repeatedly.
+	*/
+	class AEON_API Benchmark
+	{
+	public:
+		// Public struct(s)
+		/*!
+		 \brief The struct representing the measurements of a single benchmarked operation.
+		*/
+		struct Result
+		{
+			std::string name;       //!< The name of the operation
+			uint64_t    iterations; //!< The number of iterations run by each repetition
+			double      minimum;    //!< The fastest repetition's duration per iteration (in nanoseconds)
+			double      median;     //!< The median repetition's duration per iteration (in nanoseconds)
+			double      mean;       //!< The average duration per iteration over every repetition (in nanoseconds)
+		};
+
+	public:
+		// Public constructor(s)
+		/*!
+		 \brief Constructs the ae::Benchmark by providing the time spent measuring each operation and the number of repetitions.
+		 \details The number of iterations is calibrated so that each repetition lasts at least \a minTime / \a repetitions.
+
+		 \param[in] minTime The minimum time spent measuring each operation, 100 milliseconds by default
+		 \param[in] repetitions The number of repetitions from which the minimum and the median are retrieved, 5 by default
+
+		 \since v0.7.0
+		*/
+		explicit Benchmark(const Time& minTime = Time::milliseconds(100), unsigned int repetitions = 5);
+	public:
+		// Public method(s)
+		/*!
+		 \brief Measures the \a function provided, which runs a single iteration of the operation.
+		 \details The function is run a few times beforehand (warm-up) and the number of iterations is then doubled until a
+		 repetition is long enough to be measured reliably.
+		 \note The results computed by the function should be passed to doNotOptimize() so that they aren't optimized away.
+
+		 \param[in] name The name of the operation
+		 \param[in] function The callable running one iteration of the operation
+
+		 \return The ae::Benchmark::Result of the operation, which is also stored with the previous results
+
+		 \par Example:
+		 \code
+		 ae::Benchmark benchmark;
+		 const ae::Matrix4f MATRIX = ae::Matrix4f::translate(ae::Vector3f(1.f, 2.f, 3.f));
+		 benchmark.run("Matrix4f::invert", [&MATRIX]() {
+			ae::Benchmark::doNotOptimize(MATRIX.invert());
+		 });
+		 benchmark.exportJSON("Logs/math_benchmark.json");
+		 \endcode
+
+		 \sa getResults(), doNotOptimize()
+
+		 \since v0.7.0
+		*/
+		template <typename Function>
+		const Result& run(const std::string& name, Function&& function);
+		/*!
+		 \brief Clears the results measured so far.
+
+		 \since v0.7.0
+		*/
+		void clear() noexcept;
+		/*!
+		 \brief Retrieves the results measured so far, in the order in which the operations were run.
+
+		 \return The list of ae::Benchmark::Result
+
+		 \since v0.7.0
+		*/
+		_NODISCARD const std::vector<Result>& getResults() const noexcept;
+		/*!
+		 \brief Formats the results in a human-readable table (in nanoseconds per iteration).
+
+		 \return The string containing the results
+
+		 \sa toJSON()
+
+		 \since v0.7.0
+		*/
+		_NODISCARD std::string toString() const;
+		/*!
+		 \brief Formats the results as a JSON document so that they may be compared by tools.
+		 \details The document contains an array of objects with the fields "name", "iterations", "min_ns", "median_ns" and "mean_ns".
+
+		 \return The string containing the JSON document
+
+		 \sa exportJSON()
+
+		 \since v0.7.0
+		*/
+		_NODISCARD std::string toJSON() const;
+		/*!
+		 \brief Writes the results to the \a filepath provided as a JSON document.
+
+		 \param[in] filepath The path of the JSON file which will be created (or truncated)
+
+		 \sa toJSON()
+
+		 \since v0.7.0
+		*/
+		void exportJSON(const std::string& filepath) const;
+
+		// Public static method(s)
+		/*!
+		 \brief Prevents the compiler from optimizing away the computation of the \a value provided.
+
+		 \param[in] value The result of the computation measured
+
+		 \since v0.7.0
+		*/
+		template <typename T>
+		static void doNotOptimize(const T& value) noexcept;
+		/*!
+		 \brief Prevents the compiler from reordering or eliding the memory writes across this call.
+
+		 \since v0.7.0
+		*/
+		static void clobberMemory() noexcept;
+	private:
+		// Private method(s)
+		/*!
+		 \brief Computes the statistics of the repetitions' durations and stores the result.
+
+		 \param[in] name The name of the operation
+		 \param[in] iterations The number of iterations run by each repetition
+		 \param[in] durations The durations of the repetitions (in nanoseconds)
+
+		 \return The ae::Benchmark::Result stored
+
+		 \since v0.7.0
+		*/
+		const Result& addResult(const std::string& name, uint64_t iterations, std::vector<int64_t>& durations);
+
+		// Private static method(s)
+		/*!
+		 \brief Reads the address provided from another translation unit so that the value it points to is considered used.
+
+		 \param[in] pointer The address of the value
+
+		 \since v0.7.0
+		*/
+		static void useCharPointer(const volatile char* pointer) noexcept;
+
+	private:
+		// Private member(s)
+		std::vector<Result> mResults;     //!< The results measured so far
+		Time                mMinTime;     //!< The minimum time spent measuring each operation
+		unsigned int        mRepetitions; //!< The number of repetitions measured for each operation
+	};
+}
+#include <AEON/System/Benchmark.inl>
+#endif // Aeon_System_Benchmark_H_
+
+/*!
+ \class ae::Benchmark
+ \ingroup system
+
+ The ae::Benchmark class is a small microbenchmark harness in the style of
+ Google Benchmark: each operation is run in a loop whose iteration count is
+ calibrated to the operation's cost, and several repetitions are measured so
+ that the scheduler's noise may be filtered out with the minimum and the median.
+
+ The results may be exported as a JSON document so that the measurements of
+ different builds (for instance scalar and SIMD builds of the Math module) can
+ be compared for regressions.
+
+ Usage example:
+ \code
+ ae::Benchmark benchmark(ae::Time::milliseconds(200));
+
+ ae::Vector3f a(1.f, 2.f, 3.f), b(4.f, 5.f, 6.f);
+ benchmark.run("Vector3f::cross", [&]() {
+	ae::Benchmark::doNotOptimize(ae::cross(a, b));
+ });
+
+ const ae::Matrix4f MODEL = ae::Matrix4f::translate(ae::Vector3f(1.f, 2.f, 3.f));
+ benchmark.run("Matrix4f::invertAffine", [&]() {
+	ae::Benchmark::doNotOptimize(MODEL.invertAffine());
+ });
+
+ AEON_LOG_INFO("Math benchmark", benchmark.toString());
+ \endcode
+
+ \author Filippos Gleglakos
+ \version v0.7.0
+ \date 2021.07.05
+ \copyright MIT License
+*/
\ No newline at end of file
@@ -0,0 +1,78 @@
+// MIT License
+// 
+// Copyright(c) 2019-2021 Filippos Gleglakos
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+namespace ae
+{
+	// Public method(s)
+	template <typename Function>
+	const Benchmark::Result& Benchmark::run(const std::string& name, Function&& function)
+	{
+		// Warm the caches and the branch predictors up
+		for (int i = 0; i < 16; ++i) {
+			function();
+		}
+
+		// Double the number of iterations until a repetition lasts long enough to be measured
+		const int64_t TARGET = mMinTime.asNanoseconds() / static_cast<int64_t>(mRepetitions);
+		uint64_t iterations = 1;
+		while (true)
+		{
+			const Time START = Clock::getCurrentTime();
+			for (uint64_t i = 0; i < iterations; ++i) {
+				function();
+			}
+			const int64_t DURATION = (Clock::getCurrentTime() - START).asNanoseconds();
+
+			if (DURATION >= TARGET || iterations >= (1ull << 40)) {
+				break;
+			}
+
+			// Jump close to the target once the duration is significant, doubling otherwise
+			iterations = (DURATION > TARGET / 10) ? static_cast<uint64_t>(static_cast<double>(iterations) * 1.2 * static_cast<double>(TARGET) / static_cast<double>(DURATION)) + 1 : iterations * 2;
+		}
+
+		// Measure the repetitions
+		std::vector<int64_t> durations;
+		durations.reserve(mRepetitions);
+		for (unsigned int repetition = 0; repetition < mRepetitions; ++repetition) {
+			const Time START = Clock::getCurrentTime();
+			for (uint64_t i = 0; i < iterations; ++i) {
+				function();
+			}
+			durations.push_back((Clock::getCurrentTime() - START).asNanoseconds());
+		}
+
+		return addResult(name, iterations, durations);
+	}
+
+	// Public static method(s)
+	template <typename T>
+	void Benchmark::doNotOptimize(const T& value) noexcept
+	{
+	#if defined(__GNUC__) || defined(__clang__)
+		asm volatile("" : : "r,m"(value) : "memory");
+	#else
+		useCharPointer(&reinterpret_cast<const volatile char&>(value));
+	#endif
+	}
+}
\ No newline at end of file
@@ -24,6 +24,7 @@
 #define Aeon_System_Clipboard_H_
 
 #include <string>
+#include <string_view>
 
 #include <AEON/Config.h>
 
@@ -37,6 +38,7 @@ namespace ae
 		// Function(s)
 		/*!
 		 \brief Places a string into the system clipboard.
+		 \details The string is also kept as the cached clipboard contents.
 
 		 \param[in] string A std::string containing the new string
 
@@ -52,6 +54,7 @@ namespace ae
 		AEON_API void setString(const std::string& string);
 		/*!
 		 \brief Retrieves the string stored in the system clipboard.
+		 \note The contents are copied from the cache, getStringView() should be preferred for large contents.
 
 		 \return A std::string containing the clipboard's contents
 
@@ -60,11 +63,43 @@ namespace ae
 		 std::string clipboardContent = ae::Clipboard::getString();
 		 \endcode
 
-		 \sa setString()
+		 \sa setString(), getStringView()
 
 		 \since v0.6.1
 		*/
 		AEON_API std::string getString();
+		/*!
+		 \brief Retrieves a view of the cached contents of the system clipboard.
+		 \details The contents are only retrieved from the system if the cache was invalidated, which happens whenever a window regains the focus.
+		 \note The view remains valid until the clipboard's contents are next modified or retrieved from the system.
+
+		 \return A std::string_view of the clipboard's contents
+
+		 \par Example:
+		 \code
+		 const std::string_view clipboardContent = ae::Clipboard::getStringView();
+		 \endcode
+
+		 \sa getString(), invalidateCache()
+
+		 \since v0.7.0
+		*/
+		_NODISCARD AEON_API std::string_view getStringView();
+		/*!
+		 \brief Invalidates the cached clipboard contents, which will be retrieved from the system upon the next access.
+		 \note This function is called automatically when a window regains the focus.
+
+		 \par Example:
+		 \code
+		 // The clipboard was modified by a third-party library
+		 ae::Clipboard::invalidateCache();
+		 \endcode
+
+		 \sa getStringView()
+
+		 \since v0.7.0
+		*/
+		AEON_API void invalidateCache() noexcept;
 	}
 }
 #endif // Aeon_System_Clipboard_H_
@@ -75,7 +110,8 @@ namespace ae
 
  The ae::Clipboard namespace allows the API user to retrieve the string
  currently in the system clipboard and to set the string directly from the
- application.
+ application. The contents are cached so that consecutive retrievals don't
+ copy the whole clipboard each time.
 
  Usage example:
  \code
@@ -40,7 +40,7 @@ namespace ae
 
 		 \since v0.3.0
 		*/
-		Clock();
+		Clock() noexcept;
 		/*!
 		 \brief Copy constructor.
 
@@ -97,7 +97,7 @@ namespace ae
 
 		 \since v0.3.0
 		*/
-		_NODISCARD Time getElapsedTime() const;
+		_NODISCARD Time getElapsedTime() const noexcept;
 		/*!
 		 \brief Restarts the ae::Clock and retrieves the elapsed time since its last reinitiation or since its construction.
 
@@ -114,11 +114,30 @@ namespace ae
 
 		 \since v0.3.0
 		*/
-		Time restart();
+		Time restart() noexcept;
+
+		// Public static method(s)
+		/*!
+		 \brief Retrieves the current time of the monotonic clock used by the ae::Clock instances.
+		 \details The time is measured from an unspecified epoch with a nanosecond resolution, it's independent of the window and
+		 may be retrieved from any thread.
+
+		 \return An ae::Time containing the current time of the monotonic clock
+
+		 \par Example:
+		 \code
+		 const ae::Time START = ae::Clock::getCurrentTime();
+		 ...
+		 const ae::Time DURATION = ae::Clock::getCurrentTime() - START;
+		 \endcode
+
+		 \since v0.7.0
+		*/
+		_NODISCARD static Time getCurrentTime() noexcept;
 
 	private:
 		// Private member(s)
-		Time mStartTime; //!< The time value of clock's last reinitiation in seconds
+		Time mStartTime; //!< The time value of the clock's last reinitiation
 	};
 }
 #endif // Aeon_System_Clock_H_
@@ -135,6 +154,10 @@ namespace ae
  clock/timer was initiated. It's possible to retrieve the elapsed time without
  resetting the clock or completely restarting it.
 
+ The time is read from the monotonic std::chrono::steady_clock (the
+ QueryPerformanceCounter on Windows) in integer nanoseconds, so no window needs
+ to be created and the clocks may be used from the worker threads and the tools.
+
  Usage example:
  \code
  ae::Clock clock; // the timer was initiated
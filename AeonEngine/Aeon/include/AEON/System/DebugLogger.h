@@ -23,25 +23,87 @@
 #ifndef Aeon_System_DebugLogger_H_
 #define Aeon_System_DebugLogger_H_
 
+#include <atomic>
+#include <condition_variable>
+#include <fstream>
+#include <functional>
 #include <list>
+#include <memory>
+#include <memory_resource>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <tuple>
+#include <type_traits>
 
 #include <AEON/Config.h>
-
-// Define the logging macros
-#define AEON_LOG(level, title, description) ae::DebugLogger::getInstance().log(title, description, __FILE__, __func__, level, __LINE__)
-#define AEON_LOG_INFO(title, description) AEON_LOG(ae::DebugLogger::Log::Level::Info, title, description)
-#define AEON_LOG_WARNING(title, description) AEON_LOG(ae::DebugLogger::Log::Level::Warning, title, description)
-#define AEON_LOG_ERROR(title, description) AEON_LOG(ae::DebugLogger::Log::Level::Error, title, description)
+#include <AEON/System/Time.h>
+#include <AEON/System/MemoryResource.h>
+
+// Define the logging macros (the description is only evaluated if the level is enabled at runtime and the call site isn't rate-limited)
+// The call site's static state is declared within a lambda so that the macros remain usable within the constexpr functions
+#define AEON_LOG(level, title, description) do { \
+	ae::DebugLogger::CallSite& aeonCallSite = []() -> ae::DebugLogger::CallSite& { static ae::DebugLogger::CallSite callSite; return callSite; }(); \
+	ae::DebugLogger& aeonLogger = ae::DebugLogger::getInstance(); \
+	unsigned int aeonSuppressedCount = 0; \
+	if (aeonLogger.isLevelEnabled(level) && aeonLogger.acquire(aeonCallSite, aeonSuppressedCount)) { \
+		aeonLogger.log(title, description, __FILE__, __func__, level, __LINE__, aeonSuppressedCount); \
+	} \
+} while (false)
+#define AEON_LOG_F(level, title, format, ...) do { \
+	ae::DebugLogger::CallSite& aeonCallSite = []() -> ae::DebugLogger::CallSite& { static ae::DebugLogger::CallSite callSite; return callSite; }(); \
+	ae::DebugLogger& aeonLogger = ae::DebugLogger::getInstance(); \
+	unsigned int aeonSuppressedCount = 0; \
+	if (aeonLogger.isLevelEnabled(level) && aeonLogger.acquire(aeonCallSite, aeonSuppressedCount)) { \
+		aeonLogger.logFormat(title, format, __FILE__, __func__, level, __LINE__, aeonSuppressedCount, __VA_ARGS__); \
+	} \
+} while (false)
+
+// Define the logging macros of each level, the ones below the compile-time minimum level being removed along with their arguments
+#if AEON_LOG_LEVEL <= 0
+	#define AEON_LOG_INFO(title, description) AEON_LOG(ae::DebugLogger::Log::Level::Info, title, description)
+	#define AEON_LOG_INFO_F(title, format, ...) AEON_LOG_F(ae::DebugLogger::Log::Level::Info, title, format, __VA_ARGS__)
+#else
+	#define AEON_LOG_INFO(title, description) ((void)0)
+	#define AEON_LOG_INFO_F(title, format, ...) ((void)0)
+#endif // AEON_LOG_LEVEL
+#if AEON_LOG_LEVEL <= 1
+	#define AEON_LOG_WARNING(title, description) AEON_LOG(ae::DebugLogger::Log::Level::Warning, title, description)
+	#define AEON_LOG_WARNING_F(title, format, ...) AEON_LOG_F(ae::DebugLogger::Log::Level::Warning, title, format, __VA_ARGS__)
+#else
+	#define AEON_LOG_WARNING(title, description) ((void)0)
+	#define AEON_LOG_WARNING_F(title, format, ...) ((void)0)
+#endif // AEON_LOG_LEVEL
+#if AEON_LOG_LEVEL <= 2
+	#define AEON_LOG_ERROR(title, description) AEON_LOG(ae::DebugLogger::Log::Level::Error, title, description)
+	#define AEON_LOG_ERROR_F(title, format, ...) AEON_LOG_F(ae::DebugLogger::Log::Level::Error, title, format, __VA_ARGS__)
+#else
+	#define AEON_LOG_ERROR(title, description) ((void)0)
+	#define AEON_LOG_ERROR_F(title, format, ...) ((void)0)
+#endif // AEON_LOG_LEVEL
 
 namespace ae
 {
 	/*!
 	 \brief A singleton class used to log debug information concerning Aeon.
+	 \details The logs are pushed onto a lock-free ring and formatted and written by a background thread, the caller never waiting on the console or on the disk.
 	 \note This class may be used by the engine user if they so desire but the information formatting can't be modified.
 	*/
 	class AEON_API DebugLogger
 	{
 	public:
+		/*!
+		 \brief The structure holding the rate limit's state of a single call site, declared by the logging macros.
+		 \note The members are zero-initialized so that the call sites' static instances are constant-initialized.
+		*/
+		struct CallSite
+		{
+			std::atomic<int64_t>      windowStart{ 0 };     //!< The start of the current rate limit window in microseconds
+			std::atomic<unsigned int> windowCount{ 0 };     //!< The number of logs emitted during the current window
+			std::atomic<unsigned int> suppressedCount{ 0 }; //!< The number of logs suppressed since the last one emitted
+		};
+
 		/*!
 		 \brief The structure representing a debug log.
 		*/
@@ -57,8 +119,9 @@ namespace ae
 			std::string formattedInfo; //!< The log's formatted information
 			std::string metadata;      //!< The log's medata (file, line and function)
 			std::string description;   //!< The log's description
-			std::string title;         //!< The log's title
-			Level       level;         //!< The level of importance (Info, Warning, Error)
+			std::string  title;           //!< The log's title
+			Level        level;           //!< The level of importance (Info, Warning, Error)
+			unsigned int suppressedCount; //!< The number of logs of the same call site suppressed by the rate limit since the previous one
 
 			// Public constructor(s)
 			/*!
@@ -71,6 +134,7 @@ namespace ae
 			 \param[in] function The metadata of the function's name that will be automatically provided by using the macro
 			 \param[in] level The ae::DebugLogger::Log::Level containing the level of importance
 			 \param[in] line The metadata of the line that will be automatically provided by using the macro
+			 \param[in] suppressedCount The number of logs of the same call site suppressed since the previous one, 0 by default
 
 			 \par Example:
 			 \code
@@ -81,7 +145,7 @@ namespace ae
 			 \since v0.6.0
 			*/
 			Log(std::string&& title, std::string&& description, std::string&& file,
-			    std::string&& function, Log::Level level, int line);
+			    std::string&& function, Log::Level level, int line, unsigned int suppressedCount = 0);
 			/*!
 			 \brief Copy constructor.
 
@@ -145,6 +209,13 @@ namespace ae
 		 \since v0.6.0
 		*/
 		DebugLogger(DebugLogger&&) = delete;
+		/*!
+		 \brief Destructor.
+		 \details Writes the logs still in the ring, stops the background thread and closes the log file.
+
+		 \since v0.7.0
+		*/
+		~DebugLogger();
 	public:
 		// Public operator(s)
 		/*!
@@ -163,8 +234,11 @@ namespace ae
 		// Public method(s)
 		/*!
 		 \brief Logs a new debug log that will be kept until the list is retrieved.
-		 \details The log's information will be displayed to the console in Debug mode and stored on a file on disk on Debug and Release mode.
+		 \details The log's information will be displayed to the console in Debug mode and stored on a file on disk on Debug and Release mode.\n
+		 The log is only pushed onto the ring, it's formatted and written by the background thread shortly afterwards.
+		 If the ring is full, the log is dropped and the number of dropped logs is reported by the next log that's written.
 		 \note The metadata \a file, \a line and \a function will be automatically provided by using one of the available macros.
+		 This method may be called from any thread.
 
 		 \param[in] title An std::string rvalue containing the log's title
 		 \param[in] description An std::string rvalue containing the log's description
@@ -172,6 +246,7 @@ namespace ae
 		 \param[in] function The metadata of the function's name that will be automatically provided by using the macro
 		 \param[in] level The ae::DebugLogger::Log::Level containing the level of importance
 		 \param[in] line The metadata of the line that will be automatically provided by using the macro
+		 \param[in] suppressedCount The number of logs of the same call site suppressed by the rate limit since the previous one, 0 by default
 
 		 \par Example:
 		 \code
@@ -179,14 +254,108 @@ namespace ae
 		 AEON_LOG_ERROR("Title of the error message", "Description of the error message");
 		 \endcode
 
-		 \sa getLogs()
+		 \sa getLogs(), logFormat(), setRateLimit()
 
 		 \since v0.6.0
 		*/
 		void log(std::string&& title, std::string&& description, std::string&& file,
-		         std::string&& function, Log::Level level, int line);
+		         std::string&& function, Log::Level level, int line, unsigned int suppressedCount = 0);
+		/*!
+		 \brief Logs a new debug log whose description is formatted by the background thread.
+		 \details Each "{}" placeholder in the \a format is replaced by the next argument, which is written with the output stream operator.
+		 The arguments are captured by value (the C-strings are copied) only once the log is kept, the formatting itself being deferred to the background thread.
+		 \note The metadata \a file, \a line and \a function will be automatically provided by using one of the available macros.
+		 This method may be called from any thread.
+
+		 \param[in] title An std::string rvalue containing the log's title
+		 \param[in] format The format of the log's description, it must outlive the ae::DebugLogger (a string literal)
+		 \param[in] file The metadata of the file's name that will be automatically provided by using the macro
+		 \param[in] function The metadata of the function's name that will be automatically provided by using the macro
+		 \param[in] level The ae::DebugLogger::Log::Level containing the level of importance
+		 \param[in] line The metadata of the line that will be automatically provided by using the macro
+		 \param[in] suppressedCount The number of logs of the same call site suppressed by the rate limit since the previous one
+		 \param[in] args The arguments replacing the placeholders
+
+		 \par Example:
+		 \code
+		 // The metadata parameters will be automatically filled in and the description will only be formatted if the log is kept
+		 AEON_LOG_ERROR_F("Invalid index", "The index \"{}\" isn't associated with any VBOs.", index);
+		 \endcode
+
+		 \sa log()
+
+		 \since v0.7.0
+		*/
+		template <typename... Args>
+		void logFormat(std::string&& title, const char* format, std::string&& file,
+		               std::string&& function, Log::Level level, int line, unsigned int suppressedCount, Args&&... args);
+		/*!
+		 \brief Sets the minimum level of the logs that are kept at runtime, the arguments of the logs below it not being evaluated.
+		 \details The logs below the compile-time minimum level (the AEON_LOG_LEVEL macro defined before including Aeon) are removed entirely.\n
+		 The informational logs are kept by default.
+
+		 \param[in] level The ae::DebugLogger::Log::Level of the least important logs that are kept
+
+		 \par Example:
+		 \code
+		 // Only keep the errors
+		 ae::DebugLogger::getInstance().setMinimumLevel(ae::DebugLogger::Log::Level::Error);
+		 \endcode
+
+		 \sa isLevelEnabled()
+
+		 \since v0.7.0
+		*/
+		void setMinimumLevel(Log::Level level) noexcept;
+		/*!
+		 \brief Checks whether the logs of a certain \a level are kept at runtime.
+
+		 \param[in] level The ae::DebugLogger::Log::Level to check
+
+		 \return True if the logs of the \a level are kept, false otherwise
+
+		 \sa setMinimumLevel()
+
+		 \since v0.7.0
+		*/
+		_NODISCARD bool isLevelEnabled(Log::Level level) const noexcept;
+		/*!
+		 \brief Checks whether a log of the \a callSite may be emitted given the rate limit, counting it either way.
+		 \details Each call site of the logging macros may emit at most the rate limit's number of logs per interval, the following ones being suppressed and counted.
+		 The count of suppressed logs is reported by the next log emitted by the call site.
+		 \note This method is called by the logging macros before evaluating the log's arguments.
+
+		 \param[in, out] callSite The rate limit's state of the call site
+		 \param[out] suppressedCount The number of logs suppressed since the previous one, if the log may be emitted
+
+		 \return True if the log may be emitted, false if it's suppressed
+
+		 \sa setRateLimit()
+
+		 \since v0.7.0
+		*/
+		_NODISCARD bool acquire(CallSite& callSite, unsigned int& suppressedCount) const noexcept;
+		/*!
+		 \brief Sets the maximum number of logs that each call site may emit per \a interval, the identical logs flooding the console and the log file being suppressed.
+		 \details The rate limit is of 10 logs per second by default.
+
+		 \param[in] count The maximum number of logs per interval and per call site, 0 to disable the rate limit
+		 \param[in] interval The ae::Time duration of the interval
+
+		 \par Example:
+		 \code
+		 // Allow a single log per call site every 5 seconds
+		 ae::DebugLogger::getInstance().setRateLimit(1, ae::Time::seconds(5.0));
+		 \endcode
+
+		 \sa acquire()
+
+		 \since v0.7.0
+		*/
+		void setRateLimit(unsigned int count, const Time& interval) noexcept;
 		/*!
 		 \brief Retrieves the list of all the currently stored debug logs and empties the list.
+		 \details The logs pushed so far are written beforehand, and only the most recent logs are stored (see setHistoryCapacity()).
 
 		 \return The list of all the currently stored debug logs
 
@@ -203,6 +372,48 @@ namespace ae
 		 \since v0.6.0
 		*/
 		_NODISCARD std::list<Log> getLogs() noexcept;
+		/*!
+		 \brief Waits until the background thread has written the logs pushed so far and flushed the log file.
+
+		 \par Example:
+		 \code
+		 AEON_LOG_ERROR("Unrecoverable error", "The application will be terminated.");
+		 ae::DebugLogger::getInstance().flush();
+		 std::abort();
+		 \endcode
+
+		 \since v0.7.0
+		*/
+		void flush();
+		/*!
+		 \brief Sets the maximum number of logs stored until they're retrieved, the oldest ones being discarded first.
+		 \details The capacity is 512 logs by default.
+
+		 \param[in] capacity The maximum number of stored logs
+
+		 \sa getLogs()
+
+		 \since v0.7.0
+		*/
+		void setHistoryCapacity(size_t capacity);
+		/*!
+		 \brief Sets the memory resource from which the stored logs are allocated.
+		 \details The logs stored so far are moved to the new resource, which must outlive the ae::DebugLogger (or be replaced beforehand).
+
+		 \param[in] resource The memory resource of the stored logs, nullptr to allocate them from the default resource
+
+		 \par Example:
+		 \code
+		 // Attribute the stored logs to the logging tag
+		 static ae::TrackedResource logResource(ae::MemoryTag::Logging);
+		 ae::DebugLogger::getInstance().setMemoryResource(&logResource);
+		 \endcode
+
+		 \sa setHistoryCapacity()
+
+		 \since v0.7.0
+		*/
+		void setMemoryResource(std::pmr::memory_resource* resource);
 
 		// Public static method(s)
 		/*!
@@ -219,22 +430,120 @@ namespace ae
 		 \since v0.6.0
 		*/
 		_NODISCARD static DebugLogger& getInstance();
+	private:
+		// Private struct(s)
+		/*!
+		 \brief The internal struct representing a slot of the ring in which the logs are pushed, formatted later on by the background thread.
+		*/
+		struct Record
+		{
+			std::atomic<size_t>          sequence;    //!< The position at which the slot is next written (or read once it's one past it)
+			std::string                  title;       //!< The log's title
+			std::string                  description; //!< The log's description
+			std::string                  file;        //!< The file in which the log was emitted
+			std::string                  function;    //!< The function in which the log was emitted
+			Log::Level                   level;       //!< The log's level of importance
+			int                          line;        //!< The line at which the log was emitted
+			unsigned int                 suppressed;  //!< The number of logs of the same call site suppressed since the previous one
+			std::function<std::string()> formatter;   //!< The deferred formatting of the description, empty if the description was provided
+		};
+
 	private:
 		// Private constructor(s)
 		/*!
 		 \brief Default constructor.
-		 \details All error and warning logs will be written in the aeon_errors.log file.
+		 \details All error and warning logs will be written in the aeon_errors.log file, the background thread is started.
 
 		 \since v0.6.0
 		*/
 		DebugLogger();
+	private:
+		// Private method(s)
+		/*!
+		 \brief Pushes a log onto the ring, the log being dropped if the ring is full.
+
+		 \param[in] title An std::string rvalue containing the log's title
+		 \param[in] description An std::string rvalue containing the log's description
+		 \param[in] formatter The deferred formatting of the description, empty if the description was provided
+		 \param[in] file The metadata of the file's name
+		 \param[in] function The metadata of the function's name
+		 \param[in] level The ae::DebugLogger::Log::Level containing the level of importance
+		 \param[in] line The metadata of the line
+		 \param[in] suppressedCount The number of logs of the same call site suppressed since the previous one
+
+		 \since v0.7.0
+		*/
+		void push(std::string&& title, std::string&& description, std::function<std::string()>&& formatter, std::string&& file,
+		          std::string&& function, Log::Level level, int line, unsigned int suppressedCount);
+		/*!
+		 \brief Checks whether the ring's next slot holds a log, only called by the background thread.
+
+		 \return True if a log can be read, false if the ring is empty
+
+		 \since v0.7.0
+		*/
+		_NODISCARD bool hasPendingRecord() const noexcept;
+		/*!
+		 \brief Formats the logs in the ring, writes them to the console and to the log file and stores them in the history.
+
+		 \return The number of logs read from the ring
+
+		 \since v0.7.0
+		*/
+		size_t writePendingRecords();
+		/*!
+		 \brief Writes the logs pushed onto the ring until the ae::DebugLogger is destroyed, run by the background thread.
+
+		 \since v0.7.0
+		*/
+		void run();
+
+		// Private static method(s)
+		/*!
+		 \brief Writes the remainder of the \a format without any placeholder replaced.
+
+		 \param[in, out] stream The output stream receiving the description
+		 \param[in] format The remainder of the format
+
+		 \since v0.7.0
+		*/
+		static void appendFormat(std::ostringstream& stream, const char* format);
+		/*!
+		 \brief Writes the \a format up to its next placeholder, replaced by the \a value, and the remainder with the \a rest of the values.
+
+		 \param[in, out] stream The output stream receiving the description
+		 \param[in] format The remainder of the format
+		 \param[in] value The value replacing the next placeholder
+		 \param[in] rest The values replacing the following placeholders
+
+		 \since v0.7.0
+		*/
+		template <typename T, typename... Rest>
+		static void appendFormat(std::ostringstream& stream, const char* format, const T& value, const Rest&... rest);
 
 	private:
 		// Private member(s)
-		std::list<Log> mLogs;     //!< The list of currently stored debug logs
-		std::string    mErrorLog; //!< The name of the file in which the logs will be stored
+		std::unique_ptr<Record[]> mRing;            //!< The lock-free ring of logs waiting to be written
+		std::atomic<size_t>       mWritePosition;   //!< The position of the next slot reserved by a logging thread
+		size_t                    mReadPosition;    //!< The position of the next slot read by the background thread
+		std::atomic<size_t>       mDroppedCount;    //!< The number of logs dropped since the last report because the ring was full
+		std::atomic<int>          mMinimumLevel;    //!< The minimum level of the logs kept at runtime
+		std::atomic<unsigned int> mRateLimit;       //!< The maximum number of logs per call site and per interval, 0 if unlimited
+		std::atomic<int64_t>      mRateInterval;    //!< The duration of the rate limit's interval in microseconds
+		ForwardingResource        mLogResource;     //!< The resource forwarding the stored logs' allocations to the one supplied
+		std::pmr::list<Log>       mLogs;            //!< The list of currently stored debug logs, the most recent last
+		size_t                    mHistoryCapacity; //!< The maximum number of stored logs
+		size_t                    mWrittenCount;    //!< The number of logs read from the ring by the background thread
+		std::string               mErrorLog;        //!< The name of the file in which the logs will be stored
+		std::ofstream             mFile;            //!< The log file kept open by the background thread
+		std::mutex                mMutex;           //!< The mutex protecting the stored logs and the background thread's state
+		std::condition_variable   mWakeCondition;   //!< The condition on which the background thread waits for logs
+		std::condition_variable   mFlushCondition;  //!< The condition on which flush() waits for the logs to be written
+		bool                      mExit;            //!< Whether the background thread was requested to stop
+		std::thread               mThread;          //!< The background thread writing the logs
 	};
 }
+#include <AEON/System/DebugLogger.inl>
 #endif // Aeon_System_DebugLogger_H_
 
 /*!
@@ -246,6 +555,24 @@ namespace ae
  execution. It also logs the same information (apart from the informational
  messages) to the log file \b aeon_errors.log.
 
+ Logging is asynchronous: the logs are pushed onto a bounded lock-free ring
+ and a background thread formats them, writes them through a log file that's
+ kept open and stores a bounded history of the most recent ones.
+
+ The logs below the AEON_LOG_LEVEL macro (0: Info, 1: Warning, 2: Error,
+ 3: None) are removed at compile-time along with their arguments, and the
+ arguments of the logs below the runtime minimum level aren't evaluated.
+ The _F variants of the macros defer the formatting of the description to
+ the background thread, their arguments only being captured if the log is
+ kept:
+ \code
+ AEON_LOG_WARNING_F("Texture may not display correctly", "The dimensions ({}x{}) aren't even numbers", width, height);
+ \endcode
+
+ Each call site of the macros is rate-limited (10 logs per second by
+ default), the logs repeated every frame by a buggy asset being suppressed
+ and counted instead, the count being reported by the call site's next log.
+
  The log's format is the following:
  \code
  =====================================================
@@ -0,0 +1,58 @@
+// MIT License
+// 
+// Copyright(c) 2019-2021 Filippos Gleglakos
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <cstring>
+
+namespace ae
+{
+	// Public method(s)
+	template <typename... Args>
+	void DebugLogger::logFormat(std::string&& title, const char* format, std::string&& file,
+	                            std::string&& function, Log::Level level, int line, unsigned int suppressedCount, Args&&... args)
+	{
+		// Capture the arguments by value, the C-strings being copied as they may not outlive the log
+		using Values = std::tuple<std::conditional_t<std::is_convertible_v<std::decay_t<Args>, const char*>, std::string, std::decay_t<Args>>...>;
+		std::function<std::string()> formatter = [format, values = Values(std::forward<Args>(args)...)]() {
+			std::ostringstream stream;
+			std::apply([&stream, format](const auto&... value) { appendFormat(stream, format, value...); }, values);
+			return stream.str();
+		};
+
+		push(std::move(title), std::string(), std::move(formatter), std::move(file), std::move(function), level, line, suppressedCount);
+	}
+
+	// Private static method(s)
+	template <typename T, typename... Rest>
+	void DebugLogger::appendFormat(std::ostringstream& stream, const char* format, const T& value, const Rest&... rest)
+	{
+		// The extra values are ignored if there are less placeholders
+		const char* const PLACEHOLDER = std::strstr(format, "{}");
+		if (!PLACEHOLDER) {
+			stream << format;
+			return;
+		}
+
+		stream.write(format, PLACEHOLDER - format);
+		stream << value;
+		appendFormat(stream, PLACEHOLDER + 2, rest...);
+	}
+}
\ No newline at end of file
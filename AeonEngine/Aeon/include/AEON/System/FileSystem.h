@@ -23,18 +23,129 @@
 #ifndef Aeon_System_FileSystem_H_
 #define Aeon_System_FileSystem_H_
 
+#include <functional>
+#include <memory>
 #include <string>
+#include <vector>
+#include <cstddef>
 #include <cstdint>
 
 #include <AEON/Config.h>
 
 namespace ae
 {
+	// Forward declaration(s)
+	class Archive;
+
 	/*!
 	 \brief A static class that provides I/O access to system files.
 	*/
 	class AEON_API FileSystem
 	{
+	public:
+		/*!
+		 \brief The class representing a read-only view of a file mapped in memory.
+		 \details The file's contents are paged in by the operating system upon access, no copy is made. The view is released upon
+		 destruction. The entries of mounted archives are retrieved as views as well, which keep the archive's mapping alive.
+		*/
+		class AEON_API MappedFile
+		{
+		public:
+			// Public constructor(s)
+			/*!
+			 \brief Default constructor.
+			 \details Creates an empty view that isn't associated with any file.
+
+			 \since v0.7.0
+			*/
+			MappedFile() noexcept;
+			/*!
+			 \brief Deleted copy constructor.
+
+			 \since v0.7.0
+			*/
+			MappedFile(const MappedFile&) = delete;
+			/*!
+			 \brief Move constructor.
+
+			 \param[in] rvalue The ae::FileSystem::MappedFile that will be moved
+
+			 \since v0.7.0
+			*/
+			MappedFile(MappedFile&& rvalue) noexcept;
+			/*!
+			 \brief Destructor.
+			 \details Unmaps the file's view.
+
+			 \since v0.7.0
+			*/
+			~MappedFile();
+
+			// Public operator(s)
+			/*!
+			 \brief Deleted assignment operator.
+
+			 \since v0.7.0
+			*/
+			MappedFile& operator=(const MappedFile&) = delete;
+			/*!
+			 \brief Move assignment operator.
+			 \details The current view is unmapped beforehand.
+
+			 \param[in] rvalue The ae::FileSystem::MappedFile that will be moved
+
+			 \return The caller ae::FileSystem::MappedFile
+
+			 \since v0.7.0
+			*/
+			MappedFile& operator=(MappedFile&& rvalue) noexcept;
+
+			// Public method(s)
+			/*!
+			 \brief Unmaps the file's view.
+			 \details The pointer previously retrieved with data() mustn't be accessed afterwards.
+
+			 \since v0.7.0
+			*/
+			void close() noexcept;
+			/*!
+			 \brief Retrieves the pointer to the file's first byte.
+
+			 \return The pointer to the file's contents, nullptr if no file is mapped or if it's empty
+
+			 \since v0.7.0
+			*/
+			_NODISCARD const uint8_t* data() const noexcept;
+			/*!
+			 \brief Retrieves the size of the file mapped.
+
+			 \return The number of bytes of the file mapped
+
+			 \since v0.7.0
+			*/
+			_NODISCARD size_t size() const noexcept;
+			/*!
+			 \brief Checks whether a file was mapped successfully.
+			 \details An empty file is considered mapped, even though it contains no byte.
+
+			 \return True if a file is mapped, false otherwise
+
+			 \since v0.7.0
+			*/
+			_NODISCARD bool isOpen() const noexcept;
+
+		private:
+			// Private member(s)
+			std::shared_ptr<const void> mOwner; //!< The owner of the memory viewed (the view is unmapped if there's none)
+			const uint8_t*              mData;  //!< The pointer to the mapped view
+			size_t                      mSize;  //!< The size of the mapped view
+			bool                        mOpen;  //!< Whether a file is mapped
+
+			// Friend class(es)
+			friend class FileSystem;
+			friend class Archive;
+		};
+
 	public:
 		/*!
 		 \brief The enumeration providing the different ways of accessing a file.
@@ -48,6 +159,18 @@ namespace ae
 			Append   = 1 << 2, //!< All output operations are performed at the end of the file, appending the content to the current contect of the file
 			Truncate = 1 << 3  //!< If the file is opened for output operations and it already existed, its previous content is deleted and replaced by the new one
 		};
+		/*!
+		 \brief The priority of an asynchronous read, the pending reads of higher priority being performed first.
+		*/
+		enum class Priority
+		{
+			Low,    //!< Reads that can be delayed, like prefetching
+			Normal, //!< Regular reads
+			High    //!< Reads that are waited upon, like the assets needed by the next frame
+		};
+
+		// Public typedef(s)
+		using ReadCallback = std::function<void(bool, std::vector<uint8_t>&&)>; //!< The function called once an asynchronous read completes with its success and the file's contents
 
 	public:
 		/*!
@@ -85,6 +208,7 @@ namespace ae
 	public:
 		/*!
 		 \brief Reads in the file situated at the \a filepath provided using the \a openMode provided.
+		 \details The mounted archives are checked before the files on disk.
 
 		 \note Only the OpenMode::Default, OpenMode::Binary and OpenMode::AtEnd bit flags may be used and combined together.
 
@@ -102,6 +226,83 @@ namespace ae
 		 \since v0.4.0
 		*/
 		_NODISCARD static std::string readFile(const std::string& filepath, uint_fast16_t openMode = OpenMode::None);
+		/*!
+		 \brief Reads in the whole binary file situated at the \a filepath provided into the \a buffer provided.
+		 \details The file's size is retrieved beforehand so that it's read in a single operation. The buffer is resized to the file's
+		 size, its capacity being reused if it was large enough. The mounted archives are checked before the files on disk.
+
+		 \note No error is logged upon failure, the caller is expected to report it.
+
+		 \param[in] filepath The filepath of the file to read in
+		 \param[out] buffer The buffer that will receive the file's contents
+
+		 \return True if the file was read in entirely, false otherwise
+
+		 \par Example:
+		 \code
+		 std::vector<uint8_t> buffer;
+		 if (ae::FileSystem::readBinary("data.dat", buffer)) {
+			...
+		 }
+		 \endcode
+
+		 \sa mapFile()
+
+		 \since v0.7.0
+		*/
+		static bool readBinary(const std::string& filepath, std::vector<uint8_t>& buffer);
+		/*!
+		 \brief Maps the file situated at the \a filepath provided in memory, with read-only access.
+		 \details No copy of the file's contents is made, they're paged in by the operating system as they're accessed. This is the
+		 preferred way of reading large assets that are parsed once. The mounted archives are checked before the files on disk.
+
+		 \note No error is logged upon failure, the caller is expected to report it.
+
+		 \param[in] filepath The filepath of the file to map
+
+		 \return The ae::FileSystem::MappedFile, which isn't open if the file couldn't be mapped
+
+		 \par Example:
+		 \code
+		 ae::FileSystem::MappedFile file = ae::FileSystem::mapFile("data.dat");
+		 if (file.isOpen()) {
+			parse(file.data(), file.size());
+		 }
+		 \endcode
+
+		 \sa readBinary()
+
+		 \since v0.7.0
+		*/
+		_NODISCARD static MappedFile mapFile(const std::string& filepath);
+		/*!
+		 \brief Reads in the whole binary file situated at the \a filepath provided on an I/O thread.
+		 \details The read is queued and performed by a small pool of I/O threads, the pending reads being sorted by priority and then
+		 by submission order. The file's read in with readBinary(), the mounted archives thus being checked first. The reads still
+		 pending when the application exits are completed before the I/O threads are stopped.
+
+		 \note The \a callback is called on an I/O thread, the file's contents should be handed over to another thread (for example with
+		 a job of the ae::JobSystem) instead of being processed by the callback so that the other reads aren't delayed.
+
+		 \param[in] filepath The filepath of the file to read in
+		 \param[in] callback The function called with the success of the read and the file's contents
+		 \param[in] priority The ae::FileSystem::Priority of the read, ae::FileSystem::Priority::Normal by default
+
+		 \par Example:
+		 \code
+		 ae::FileSystem::readAsync("level.bin", [](bool success, std::vector<uint8_t>&& data) {
+			if (success) {
+				ae::JobSystem& jobSystem = ae::JobSystem::getInstance();
+				jobSystem.run(jobSystem.createJob([contents = std::move(data)]() { parseLevel(contents); }));
+			}
+		 }, ae::FileSystem::Priority::High);
+		 \endcode
+
+		 \sa readBinary()
+
+		 \since v0.7.0
+		*/
+		static void readAsync(const std::string& filepath, ReadCallback callback, Priority priority = Priority::Normal);
 		/*!
 		 \brief Writes into the file situated at the \a filepath provided, adding the \a content and using the \a openMode provided.
 
@@ -120,6 +321,46 @@ namespace ae
 		 \since v0.3.0
 		*/
 		static void writeFile(const std::string& filepath, const std::string& content, uint_fast16_t openMode = OpenMode::None);
+		/*!
+		 \brief Mounts the archive situated at the \a filepath provided.
+		 \details Every read performed afterwards checks the mounted archives first, the most recently mounted one taking precedence,
+		 before falling back to the files on disk. Writes always target the files on disk.
+
+		 \param[in] filepath The filepath of the ae::Archive to mount
+
+		 \return True if the archive was opened and mounted, false otherwise
+
+		 \par Example:
+		 \code
+		 ae::FileSystem::mountArchive("assets.pak");
+		 const std::string SOURCE = ae::FileSystem::readFile("Shaders/sprite.vert");
+		 \endcode
+
+		 \sa unmountArchive(), unmountArchives()
+
+		 \since v0.7.0
+		*/
+		static bool mountArchive(const std::string& filepath);
+		/*!
+		 \brief Unmounts the archive situated at the \a filepath provided.
+		 \details The views previously retrieved from it remain valid.
+
+		 \param[in] filepath The filepath of the mounted ae::Archive
+
+		 \sa mountArchive(), unmountArchives()
+
+		 \since v0.7.0
+		*/
+		static void unmountArchive(const std::string& filepath);
+		/*!
+		 \brief Unmounts every mounted archive.
+		 \details The views previously retrieved from them remain valid.
+
+		 \sa mountArchive(), unmountArchive()
+
+		 \since v0.7.0
+		*/
+		static void unmountArchives();
 	};
 }
 #endif // Aeon_System_FileSystem_H_
@@ -147,6 +388,18 @@ namespace ae
  \li OpenMode::Append (as long as OpenMode::AtEnd and OpenMode::Truncate aren't being used)
  \li OpenMode::Truncate (as long as OpenMode::AtEnd and OpenMode::Append aren't being used)
 
+ Binary files are better read in with readBinary(), which reads the whole file in
+ a single operation, or mapped in memory with mapFile() in which case no copy of
+ the contents is made at all.
+
+ Packed ae::Archive files may be mounted, in which case every read checks them
+ before the files on disk. The engine's loaders read their files through
+ ae::FileSystem, so their assets may be packed transparently.
+
+ Files may also be read in asynchronously with readAsync(), which queues the
+ read on a small pool of I/O threads so that disk accesses overlap with the
+ decoding of other files and with the game's updates.
+
  Usage example:
  \code
  // Reads in the contents of a binary file
@@ -158,6 +411,9 @@ namespace ae
  // Delete the contents of the text file and insert new content
  std::string newFileContents = "...";
  ae::FileSystem::writeFile("data.txt", newFileContents, ae::FileSystem::OpenMode::Truncate);
+
+ // Map a large asset in memory
+ ae::FileSystem::MappedFile asset = ae::FileSystem::mapFile("level.bin");
  \endcode
 
  \author Filippos Gleglakos
@@ -0,0 +1,214 @@
+// MIT License
+// 
+// Copyright(c) 2019-2021 Filippos Gleglakos
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef Aeon_System_FileWatcher_H_
+#define Aeon_System_FileWatcher_H_
+
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <AEON/Config.h>
+
+namespace ae
+{
+	/*!
+	 \brief Class used to watch directories for the files modified within them.
+	*/
+	class AEON_API FileWatcher
+	{
+	public:
+		// Public constructor(s)
+		/*!
+		 \brief Default constructor.
+		 \details No directory is watched until watch() is called.
+
+		 \since v0.7.0
+		*/
+		FileWatcher();
+		/*!
+		 \brief Deleted copy constructor.
+
+		 \since v0.7.0
+		*/
+		FileWatcher(const FileWatcher&) = delete;
+		/*!
+		 \brief Deleted move constructor.
+
+		 \since v0.7.0
+		*/
+		FileWatcher(FileWatcher&&) = delete;
+		/*!
+		 \brief Destructor.
+		 \details Stops watching every directory.
+
+		 \since v0.7.0
+		*/
+		~FileWatcher();
+
+		// Public operator(s)
+		/*!
+		 \brief Deleted assignment operator.
+
+		 \since v0.7.0
+		*/
+		FileWatcher& operator=(const FileWatcher&) = delete;
+		/*!
+		 \brief Deleted move assignment operator.
+
+		 \since v0.7.0
+		*/
+		FileWatcher& operator=(FileWatcher&&) = delete;
+
+		// Public method(s)
+		/*!
+		 \brief Starts watching the \a directory provided and its subdirectories.
+		 \details The files written to or moved into the directory are reported by poll().
+		 \note On Linux, the subdirectories created after the call aren't watched.
+
+		 \param[in] directory The path of the directory to watch
+
+		 \return True if the directory is watched, false otherwise
+
+		 \par Example:
+		 \code
+		 ae::FileWatcher watcher;
+		 watcher.watch("Assets");
+		 \endcode
+
+		 \since v0.7.0
+		*/
+		bool watch(const std::string& directory);
+		/*!
+		 \brief Retrieves the files modified since the last call, without blocking.
+		 \details A file is only reported once it hasn't been modified for the settle delay, so that the files which are saved in
+		 several writes are reported once they're complete. Each file is reported once per call.
+
+		 \return The normalized paths of the files modified
+
+		 \par Example:
+		 \code
+		 for (const std::string& filepath : watcher.poll()) {
+			...
+		 }
+		 \endcode
+
+		 \sa normalizePath(), setSettleDelay()
+
+		 \since v0.7.0
+		*/
+		_NODISCARD std::vector<std::string> poll();
+		/*!
+		 \brief Sets the time during which a file mustn't be modified anymore before being reported.
+
+		 \param[in] delay The settle delay, 100 milliseconds by default
+
+		 \sa poll()
+
+		 \since v0.7.0
+		*/
+		void setSettleDelay(std::chrono::milliseconds delay) noexcept;
+		/*!
+		 \brief Checks whether at least one directory is watched.
+
+		 \return True if a directory is watched, false otherwise
+
+		 \since v0.7.0
+		*/
+		_NODISCARD bool isWatching() const noexcept;
+
+		// Public static method(s)
+		/*!
+		 \brief Normalizes the \a filepath provided so that it may be compared to the paths reported by poll().
+		 \details The path is made absolute and lexically normal, with forward slashes as separators.
+
+		 \param[in] filepath The filepath to normalize
+
+		 \return The normalized filepath
+
+		 \since v0.7.0
+		*/
+		_NODISCARD static std::string normalizePath(const std::string& filepath);
+
+	private:
+		// Private method(s)
+		/*!
+		 \brief Reads in the notifications sent by the operating system and records the files modified.
+
+		 \since v0.7.0
+		*/
+		void readNotifications();
+
+	private:
+		/*!
+		 \brief The internal struct representing a watched directory.
+		*/
+		struct Directory
+		{
+			// Public member(s)
+			std::string          path;       //!< The normalized path of the directory
+			void*                handle;     //!< The handle of the directory (Windows only)
+			void*                overlapped; //!< The pending asynchronous read of the directory's changes (Windows only)
+			std::vector<uint8_t> buffer;     //!< The buffer receiving the directory's changes (Windows only)
+		};
+
+		// Private member(s)
+		std::unordered_map<int, Directory>                                       mDirectories; //!< The watched directories, keyed by their watch descriptor (an index on Windows)
+		std::unordered_map<std::string, std::chrono::steady_clock::time_point> mPending;     //!< The files modified and the time of their last modification
+		std::chrono::milliseconds                                                mDelay;       //!< The settle delay
+		int                                                                      mHandle;      //!< The inotify instance (Linux only)
+	};
+}
+#endif // Aeon_System_FileWatcher_H_
+
+/*!
+ \class ae::FileWatcher
+ \ingroup system
+
+ The ae::FileWatcher class watches directories for the files that are written
+ to or moved into them, relying on inotify on Linux and on
+ ReadDirectoryChangesW on Windows. The watcher doesn't own any thread, the
+ changes are collected whenever poll() is called, usually once per frame.
+
+ The engine uses it to reload the assets modified on disk (see
+ ae::GLResourceFactory::watchDirectory()).
+
+ Usage example:
+ \code
+ ae::FileWatcher watcher;
+ watcher.watch("Assets");
+
+ // Once per frame
+ for (const std::string& filepath : watcher.poll()) {
+	if (filepath == ae::FileWatcher::normalizePath("Assets/level.json")) {
+		reloadLevel();
+	}
+ }
+ \endcode
+
+ \author Filippos Gleglakos
+ \version v0.7.0
+ \date 2021.07.05
+ \copyright MIT License
+*/
\ No newline at end of file
@@ -0,0 +1,285 @@
+// MIT License
+// 
+// Copyright(c) 2019-2021 Filippos Gleglakos
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef Aeon_System_FrameArena_H_
+#define Aeon_System_FrameArena_H_
+
+#include <memory>
+#include <vector>
+#include <cstdint>
+
+#include <AEON/Config.h>
+
+namespace ae
+{
+	/*!
+	 \brief The class representing a thread's linear allocator of the temporaries that only live during the current frame.
+	 \details The memory is bumped out of large blocks and is never freed individually: the whole arena is reset once a new frame starts, the
+	 blocks used during the previous frame being merged into a single one so that the following frames are served without allocating.
+	 \note Each thread owns its own arena, it's usually used through the ae::FrameAllocator adaptor rather than directly.
+	*/
+	class AEON_API FrameArena
+	{
+	public:
+		// Public constructor(s)
+		/*!
+		 \brief Deleted copy constructor.
+
+		 \since v0.7.0
+		*/
+		FrameArena(const FrameArena&) = delete;
+		/*!
+		 \brief Deleted move constructor.
+
+		 \since v0.7.0
+		*/
+		FrameArena(FrameArena&&) = delete;
+	public:
+		// Public operator(s)
+		/*!
+		 \brief Deleted assignment operator.
+
+		 \since v0.7.0
+		*/
+		FrameArena& operator=(const FrameArena&) = delete;
+		/*!
+		 \brief Deleted move assignment operator.
+
+		 \since v0.7.0
+		*/
+		FrameArena& operator=(FrameArena&&) = delete;
+	public:
+		// Public method(s)
+		/*!
+		 \brief Retrieves uninitialized memory of \a size bytes which remains valid until the end of the current frame.
+		 \details The arena is first reset if a new frame started since its last allocation.
+
+		 \param[in] size The number of bytes
+		 \param[in] alignment The alignment of the memory, a power of two
+
+		 \return A pointer to the uninitialized memory
+
+		 \sa deallocate()
+
+		 \since v0.7.0
+		*/
+		_NODISCARD void* allocate(size_t size, size_t alignment);
+		/*!
+		 \brief Returns memory to the arena.
+		 \details Only the most recent allocation is reclaimed (so that a growing container reuses its previous storage), the other allocations are
+		 released once the frame ends.
+
+		 \param[in] ptr The memory previously retrieved with allocate()
+		 \param[in] size The number of bytes that were requested
+
+		 \sa allocate()
+
+		 \since v0.7.0
+		*/
+		void deallocate(void* ptr, size_t size) noexcept;
+		/*!
+		 \brief Retrieves the number of bytes handed out during the current frame.
+
+		 \return The number of bytes used
+
+		 \since v0.7.0
+		*/
+		_NODISCARD size_t getUsedSize() const noexcept;
+		/*!
+		 \brief Retrieves the total number of bytes of the blocks owned by the arena.
+
+		 \return The arena's capacity
+
+		 \since v0.7.0
+		*/
+		_NODISCARD size_t getCapacity() const noexcept;
+
+		// Public static method(s)
+		/*!
+		 \brief Retrieves the ae::FrameArena of the calling thread.
+
+		 \return The calling thread's ae::FrameArena
+
+		 \since v0.7.0
+		*/
+		_NODISCARD static FrameArena& getInstance();
+		/*!
+		 \brief Ends the current frame, the memory handed out by every thread's arena may be recycled afterwards.
+		 \details The arenas are reset lazily upon their thread's next allocation.
+		 \note Called by ae::Window::display(), the temporaries must therefore not outlive the frame in which they were allocated.
+
+		 \since v0.7.0
+		*/
+		static void nextFrame() noexcept;
+
+	private:
+		// Private constructor(s)
+		/*!
+		 \brief Default constructor.
+
+		 \since v0.7.0
+		*/
+		FrameArena() noexcept;
+
+	private:
+		// Private method(s)
+		/*!
+		 \brief Recycles the memory handed out during the previous frames, the blocks being merged into a single one if several were used.
+
+		 \since v0.7.0
+		*/
+		void reset();
+		/*!
+		 \brief Allocates a new block able to hold at least \a size bytes and makes it the current block.
+
+		 \param[in] size The minimum number of bytes
+
+		 \since v0.7.0
+		*/
+		void grow(size_t size);
+
+	private:
+		// Private member(s)
+		std::vector<std::unique_ptr<unsigned char[]>> mBlocks;     //!< The blocks allocated, the last one being the current block
+		size_t                                        mBlockSize;  //!< The size of the current block
+		size_t                                        mOffset;     //!< The offset of the current block's first free byte
+		size_t                                        mUsedSize;   //!< The number of bytes handed out during the current frame
+		size_t                                        mCapacity;   //!< The total size of the blocks
+		uint64_t                                      mFrame;      //!< The frame during which the arena was last used
+	};
+
+	/*!
+	 \brief The allocator template class which bumps the memory of standard containers out of the calling thread's ae::FrameArena.
+	 \details The containers using it must be destroyed before the end of the frame, the allocator is typically used for the temporaries of a
+	 function called during the update or the rendering.
+
+	 \par Example:
+	 \code
+	 // The transformed vertices are discarded once the frame ends
+	 ae::FrameVector<ae::Vertex2D> transformed(vertices.size());
+	 \endcode
+	*/
+	template <typename T>
+	class FrameAllocator
+	{
+	public:
+		// Public typedef(s)
+		using value_type = T; //!< The type of the elements allocated
+
+	public:
+		// Public constructor(s)
+		/*!
+		 \brief Default constructor.
+
+		 \since v0.7.0
+		*/
+		FrameAllocator() noexcept = default;
+		/*!
+		 \brief Converting constructor required by the containers rebinding the allocator to their nodes.
+
+		 \since v0.7.0
+		*/
+		template <typename U>
+		FrameAllocator(const FrameAllocator<U>&) noexcept
+		{
+		}
+
+	public:
+		// Public method(s)
+		/*!
+		 \brief Retrieves uninitialized memory for \a count elements from the calling thread's ae::FrameArena.
+
+		 \param[in] count The number of elements
+
+		 \return A pointer to the uninitialized memory
+
+		 \since v0.7.0
+		*/
+		_NODISCARD T* allocate(size_t count)
+		{
+			return static_cast<T*>(FrameArena::getInstance().allocate(sizeof(T) * count, alignof(T)));
+		}
+		/*!
+		 \brief Returns the memory of \a count elements to the calling thread's ae::FrameArena.
+
+		 \param[in] ptr The memory previously retrieved with allocate()
+		 \param[in] count The number of elements
+
+		 \since v0.7.0
+		*/
+		void deallocate(T* ptr, size_t count) noexcept
+		{
+			FrameArena::getInstance().deallocate(ptr, sizeof(T) * count);
+		}
+
+	public:
+		// Public operator(s)
+		/*!
+		 \brief Equality operator, every instance allocates from the same arena.
+
+		 \return True
+
+		 \since v0.7.0
+		*/
+		template <typename U>
+		_NODISCARD bool operator==(const FrameAllocator<U>&) const noexcept
+		{
+			return true;
+		}
+		/*!
+		 \brief Inequality operator, every instance allocates from the same arena.
+
+		 \return False
+
+		 \since v0.7.0
+		*/
+		template <typename U>
+		_NODISCARD bool operator!=(const FrameAllocator<U>&) const noexcept
+		{
+			return false;
+		}
+	};
+
+	/*!
+	 \brief The vector whose elements are allocated from the calling thread's ae::FrameArena.
+	*/
+	template <typename T>
+	using FrameVector = std::vector<T, FrameAllocator<T>>;
+}
+#endif // Aeon_System_FrameArena_H_
+
+/*!
+ \class ae::FrameArena
+ \ingroup system
+
+ The ae::FrameArena class is a thread-local linear allocator used for the
+ temporaries filled in and discarded within a single frame, such as the
+ renderers' transformed vertices or the lists gathered during a traversal.
+ Allocating from it is a bump of an offset and nothing is freed individually,
+ so these temporaries no longer go through the global heap. The arenas are
+ recycled once ae::Window::display() ends the frame.
+
+ \author Filippos Gleglakos
+ \version v0.7.0
+ \date 2021.07.05
+ \copyright MIT License
+*/
\ No newline at end of file
@@ -0,0 +1,243 @@
+// MIT License
+// 
+// Copyright(c) 2019-2021 Filippos Gleglakos
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef Aeon_System_FrameStatistics_H_
+#define Aeon_System_FrameStatistics_H_
+
+#include <string>
+#include <vector>
+
+#include <AEON/Config.h>
+#include <AEON/System/Time.h>
+
+namespace ae
+{
+	/*!
+	 \brief Class used to keep a rolling history of the frames' timings and to compute their percentiles.
+	*/
+	class AEON_API FrameStatistics
+	{
+	public:
+		// Public enum(s)
+		/*!
+		 \brief The phases of a frame whose duration is recorded.
+		*/
+		enum class Phase
+		{
+			Frame,  //!< The whole frame, from the processing of its events to the end of the frame rate limit
+			Events, //!< The processing of the events
+			Update, //!< The fixed time-step updates of the frame
+			Render  //!< The rendering and the presentation of the frame
+		};
+
+		// Public struct(s)
+		/*!
+		 \brief The struct representing the durations recorded for a single frame.
+		*/
+		struct Sample
+		{
+			Time frame;  //!< The duration of the whole frame
+			Time events; //!< The time spent processing the events
+			Time update; //!< The time spent in the updates
+			Time render; //!< The time spent rendering and presenting the frame
+		};
+		/*!
+		 \brief The struct representing the statistics of a phase over the frames of the history.
+		*/
+		struct Summary
+		{
+			Time average;       //!< The average duration
+			Time median;        //!< The 50th percentile
+			Time p95;           //!< The 95th percentile
+			Time p99;           //!< The 99th percentile
+			Time max;           //!< The longest duration
+			Time onePercentLow; //!< The average duration of the slowest 1% of the frames (the "1% low")
+		};
+
+	public:
+		// Public constructor(s)
+		/*!
+		 \brief Constructs the ae::FrameStatistics by providing the number of frames kept in the history.
+
+		 \param[in] capacity The number of most recent frames kept, 1024 by default
+
+		 \since v0.7.0
+		*/
+		explicit FrameStatistics(size_t capacity = 1024);
+	public:
+		// Public method(s)
+		/*!
+		 \brief Adds the durations of a frame to the history, the oldest frame being dropped if the history is full.
+		 \details The frame counts as a hitch if it lasted longer than the hitch threshold.
+		 \note This method is automatically called at the end of every frame by the ae::Application.
+
+		 \param[in] sample The durations recorded for the frame
+
+		 \sa setHitchThreshold()
+
+		 \since v0.7.0
+		*/
+		void addSample(const Sample& sample);
+		/*!
+		 \brief Clears the history and resets the hitch counter.
+
+		 \since v0.7.0
+		*/
+		void clear() noexcept;
+		/*!
+		 \brief Sets the number of most recent frames kept in the history.
+		 \note The history is cleared.
+
+		 \param[in] capacity The number of frames kept (at least 1)
+
+		 \since v0.7.0
+		*/
+		void setCapacity(size_t capacity);
+		/*!
+		 \brief Sets the duration beyond which a frame counts as a hitch.
+		 \details When set to zero, a hitch is a frame that lasted more than twice the average of the recent frames.
+
+		 \param[in] threshold The hitch threshold, zero by default
+
+		 \par Example:
+		 \code
+		 // Count the frames that missed a 60Hz refresh
+		 ae::Application::getInstance().getFrameStatistics().setHitchThreshold(ae::Time::seconds(1.0 / 60.0));
+		 \endcode
+
+		 \sa getHitchCount()
+
+		 \since v0.7.0
+		*/
+		void setHitchThreshold(const Time& threshold) noexcept;
+		/*!
+		 \brief Computes the statistics of the \a phase provided over the frames of the history.
+		 \details The percentiles are computed on demand by sorting a copy of the history, so this method shouldn't be called every frame.
+
+		 \param[in] phase The ae::FrameStatistics::Phase whose statistics to compute
+
+		 \return The ae::FrameStatistics::Summary of the durations, filled with zeros if no frame was recorded
+
+		 \par Example:
+		 \code
+		 const ae::FrameStatistics::Summary SUMMARY = statistics.getSummary(ae::FrameStatistics::Phase::Frame);
+		 const double ONE_PERCENT_LOW_FPS = 1.0 / SUMMARY.onePercentLow.asSeconds();
+		 \endcode
+
+		 \sa toString()
+
+		 \since v0.7.0
+		*/
+		_NODISCARD Summary getSummary(Phase phase) const;
+		/*!
+		 \brief Retrieves the number of hitches since the construction or the last clear().
+
+		 \return The number of frames that lasted longer than the hitch threshold
+
+		 \sa setHitchThreshold()
+
+		 \since v0.7.0
+		*/
+		_NODISCARD size_t getHitchCount() const noexcept;
+		/*!
+		 \brief Retrieves the number of frames currently held in the history.
+
+		 \return The number of frames recorded, up to the history's capacity
+
+		 \since v0.7.0
+		*/
+		_NODISCARD size_t getSampleCount() const noexcept;
+		/*!
+		 \brief Retrieves the frames of the history, from the oldest to the most recent.
+
+		 \return The list of ae::FrameStatistics::Sample recorded
+
+		 \since v0.7.0
+		*/
+		_NODISCARD std::vector<Sample> getSamples() const;
+		/*!
+		 \brief Formats the statistics of every phase in a human-readable table (in milliseconds).
+
+		 \return The string containing the statistics
+
+		 \par Example:
+		 \code
+		 AEON_LOG_INFO("Frame statistics", ae::Application::getInstance().getFrameStatistics().toString());
+		 \endcode
+
+		 \sa getSummary(), exportCSV()
+
+		 \since v0.7.0
+		*/
+		_NODISCARD std::string toString() const;
+		/*!
+		 \brief Writes the frames of the history to the \a filepath provided as comma-separated values (in milliseconds).
+
+		 \param[in] filepath The path of the CSV file which will be created (or truncated)
+
+		 \sa toString()
+
+		 \since v0.7.0
+		*/
+		void exportCSV(const std::string& filepath) const;
+
+	private:
+		// Private member(s)
+		std::vector<Sample> mSamples;        //!< The ring of the most recent frames
+		size_t              mCapacity;       //!< The maximum number of frames kept
+		size_t              mNext;           //!< The position in the ring of the next frame once it's full
+		size_t              mHitchCount;     //!< The number of hitches recorded
+		Time                mHitchThreshold; //!< The duration beyond which a frame is a hitch, zero to follow the recent average
+		Time                mAverage;        //!< The exponential moving average of the frame durations
+	};
+}
+#endif // Aeon_System_FrameStatistics_H_
+
+/*!
+ \class ae::FrameStatistics
+ \ingroup system
+
+ The ae::FrameStatistics class keeps the durations of the most recent frames:
+ the whole frame, the processing of its events, its updates and its rendering.
+ Unlike the averaged frames per second, the percentiles and the 1% low of the
+ history reveal the stutter, and the hitch counter tracks the frames that took
+ notably longer than the others.
+
+ The ae::Application fills in an instance every frame, which is retrieved with
+ ae::Application::getFrameStatistics().
+
+ Usage example:
+ \code
+ ae::FrameStatistics& statistics = ae::Application::getInstance().getFrameStatistics();
+ ...
+ const ae::FrameStatistics::Summary FRAME = statistics.getSummary(ae::FrameStatistics::Phase::Frame);
+ if (FRAME.p99 > ae::Time::milliseconds(33)) {
+	AEON_LOG_WARNING("Stutter detected", statistics.toString());
+ }
+ statistics.exportCSV("Logs/frames.csv");
+ \endcode
+
+ \author Filippos Gleglakos
+ \version v0.7.0
+ \date 2021.07.05
+ \copyright MIT License
+*/
\ No newline at end of file
@@ -0,0 +1,277 @@
+// MIT License
+// 
+// Copyright(c) 2019-2021 Filippos Gleglakos
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#ifndef Aeon_System_JobSystem_H_
+#define Aeon_System_JobSystem_H_
+
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <AEON/Config.h>
+
+namespace ae
+{
+	/*!
+	 \brief Singleton class used to execute jobs on a pool of worker threads which steal work from each other.
+	*/
+	class AEON_API JobSystem
+	{
+	public:
+		// Forward declaration(s)
+		struct Job;
+
+	public:
+		// Public constructor(s)
+		/*!
+		 \brief Deleted copy constructor.
+
+		 \since v0.7.0
+		*/
+		JobSystem(const JobSystem&) = delete;
+		/*!
+		 \brief Deleted move constructor.
+
+		 \since v0.7.0
+		*/
+		JobSystem(JobSystem&&) = delete;
+		/*!
+		 \brief Destructor.
+		 \details Stops and joins the worker threads, the jobs that haven't been executed yet are discarded.
+
+		 \since v0.7.0
+		*/
+		~JobSystem();
+	public:
+		// Public operator(s)
+		/*!
+		 \brief Deleted copy assignment operator.
+
+		 \since v0.7.0
+		*/
+		JobSystem& operator=(const JobSystem&) = delete;
+		/*!
+		 \brief Deleted move assignment operator.
+
+		 \since v0.7.0
+		*/
+		JobSystem& operator=(JobSystem&&) = delete;
+	public:
+		// Public method(s)
+		/*!
+		 \brief Creates a job which will execute the \a task provided once it's run.
+		 \details A job completes once its task and the tasks of all of its children jobs have been executed.
+		 The children must be created before their parent is run.
+		 \note Jobs without a parent must be waited upon with wait() which releases them, children jobs are released automatically.
+
+		 \param[in] task The function to execute, may be empty for jobs only gathering children jobs
+		 \param[in] parent The job which will only complete once the created job has completed, nullptr for none
+
+		 \return The created job
+
+		 \par Example:
+		 \code
+		 ae::JobSystem& jobSystem = ae::JobSystem::getInstance();
+		 ae::JobSystem::Job* root = jobSystem.createJob(nullptr);
+		 for (Chunk& chunk : chunks) {
+			jobSystem.run(jobSystem.createJob([&chunk]() { chunk.decode(); }, root));
+		 }
+		 jobSystem.run(root);
+		 jobSystem.wait(root);
+		 \endcode
+
+		 \sa run(), wait()
+
+		 \since v0.7.0
+		*/
+		_NODISCARD Job* createJob(std::function<void()> task, Job* parent = nullptr);
+		/*!
+		 \brief Queues the \a job provided into the calling thread's work queue so that it's executed by the first available thread.
+
+		 \param[in] job The job created with createJob()
+
+		 \sa createJob(), wait()
+
+		 \since v0.7.0
+		*/
+		void run(Job* const job);
+		/*!
+		 \brief Blocks the calling thread until the \a job provided and all of its children have completed, then releases it.
+		 \details The calling thread executes the queued jobs in the meantime instead of sleeping.
+
+		 \param[in] job The parentless job that was run
+
+		 \sa run(), createJob()
+
+		 \since v0.7.0
+		*/
+		void wait(Job* const job);
+		/*!
+		 \brief Executes the \a task provided over the range [0, \a count) split into batches executed by all threads, including the calling one.
+		 \details The calling thread is blocked until every batch has been executed.
+
+		 \param[in] count The number of elements of the range
+		 \param[in] task The function receiving the beginning and the end of each batch
+		 \param[in] grainSize The number of elements per batch, 0 to split the range into four batches per thread
+
+		 \par Example:
+		 \code
+		 ae::JobSystem::getInstance().parallelFor(particles.size(), [&particles, dt](size_t begin, size_t end) {
+			for (size_t i = begin; i < end; ++i) {
+				particles[i].update(dt);
+			}
+		 });
+		 \endcode
+
+		 \sa createJob()
+
+		 \since v0.7.0
+		*/
+		void parallelFor(size_t count, const std::function<void(size_t, size_t)>& task, size_t grainSize = 0);
+		/*!
+		 \brief Retrieves the number of worker threads, which doesn't include the threads waiting upon jobs.
+
+		 \return The number of worker threads
+
+		 \since v0.7.0
+		*/
+		_NODISCARD size_t getWorkerCount() const noexcept;
+
+		// Public static method(s)
+		/*!
+		 \brief Retrieves the single instance of the ae::JobSystem.
+		 \details The worker threads are started the first time the instance is retrieved.
+
+		 \return The single instance of the ae::JobSystem
+
+		 \since v0.7.0
+		*/
+		_NODISCARD static JobSystem& getInstance();
+
+	private:
+		// Forward declaration(s)
+		struct WorkQueue;
+
+	private:
+		// Private constructor(s)
+		/*!
+		 \brief Default constructor.
+		 \details Starts one worker thread per hardware thread except the calling one.
+
+		 \since v0.7.0
+		*/
+		JobSystem();
+
+	private:
+		// Private method(s)
+		/*!
+		 \brief Executes the jobs queued until the ae::JobSystem is destroyed, sleeping while there are none.
+
+		 \param[in] queueIndex The index of the worker thread's work queue
+
+		 \since v0.7.0
+		*/
+		void runWorker(size_t queueIndex);
+		/*!
+		 \brief Retrieves a job from the \a queueIndex's work queue, or steals one from another work queue if it's empty.
+		 \details The owning thread takes the most recently queued job whereas thieves take the oldest one.
+
+		 \param[in] queueIndex The index of the calling thread's work queue
+
+		 \return A job to execute, or nullptr if all work queues are empty
+
+		 \since v0.7.0
+		*/
+		_NODISCARD Job* getJob(size_t queueIndex);
+		/*!
+		 \brief Executes the \a job's task and completes it if it has no pending children.
+
+		 \param[in] job The job to execute
+
+		 \since v0.7.0
+		*/
+		void execute(Job* const job);
+		/*!
+		 \brief Decrements the \a job's number of unfinished jobs and, once it reaches zero, completes its parent and releases it if it's a child.
+
+		 \param[in] job The job whose task or one of its children's tasks was executed
+
+		 \since v0.7.0
+		*/
+		void finish(Job* const job);
+		/*!
+		 \brief Retrieves the index of the calling thread's work queue.
+		 \details Threads that aren't worker threads share the first work queue.
+
+		 \return The index of the calling thread's work queue
+
+		 \since v0.7.0
+		*/
+		_NODISCARD size_t getQueueIndex() const noexcept;
+
+	private:
+		// Private member(s)
+		std::vector<std::unique_ptr<WorkQueue>> mQueues;         //!< The work queues (the first one is shared by the threads that aren't workers)
+		std::vector<std::thread>                mWorkers;        //!< The worker threads
+		std::mutex                              mSleepMutex;     //!< The mutex associated to the sleep condition
+		std::condition_variable                 mSleepCondition; //!< The condition on which idle worker threads sleep
+		std::atomic<size_t>                     mQueuedJobs;     //!< The number of jobs currently queued
+		std::atomic<bool>                       mRunning;        //!< Whether the worker threads keep running
+	};
+}
+#endif // Aeon_System_JobSystem_H_
+
+/*!
+ \class ae::JobSystem
+ \ingroup system
+
+ The ae::JobSystem singleton class executes jobs on a pool of worker threads,
+ one per hardware thread except the main one. Each worker owns a work queue
+ from which it takes its most recent job, and steals the oldest jobs of the
+ other queues once its own is empty. Threads that wait upon a job execute the
+ queued jobs in the meantime, so jobs may create and wait upon other jobs.
+
+ Jobs may be grouped under a parent job which only completes once all of its
+ children have completed, and parallelFor() splits a range into batches which
+ are executed by all threads. The parallel traversals of ae::Actor2D are built
+ on top of it.
+
+ Usage example:
+ \code
+ ae::JobSystem& jobSystem = ae::JobSystem::getInstance();
+
+ ae::JobSystem::Job* job = jobSystem.createJob([&texture, &path]() { texture.decode(path); });
+ jobSystem.run(job);
+ ...
+ jobSystem.wait(job);
+ \endcode
+
+ \author Filippos Gleglakos
+ \version v0.7.0
+ \date 2021.07.05
+ \copyright MIT License
+*/
\ No newline at end of file
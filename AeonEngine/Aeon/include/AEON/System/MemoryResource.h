@@ -0,0 +1,307 @@
+// MIT License
+// 
+// Copyright(c) 2019-2021 Filippos Gleglakos
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef Aeon_System_MemoryResource_H_
+#define Aeon_System_MemoryResource_H_
+
+#include <atomic>
+#include <cstddef>
+#include <memory_resource>
+
+#include <AEON/Config.h>
+#include <AEON/System/MemoryTracker.h>
+
+namespace ae
+{
+	/*!
+	 \brief The polymorphic memory resource attributing the allocations made through it to a tag before forwarding them to its upstream resource.
+	 \details Supplied to the engine's containers, it accounts for their memory under the tag provided whatever the thread or the scope in which
+	 they grow. The blocks allocated are only tracked if the upstream resource allocates them through the global new operators (like the default
+	 resource does) and the memory tracking is enabled (see AEON_MEMORY_TRACKING).
+	 \note The resource must outlive every container using it.
+	*/
+	class AEON_API TrackedResource : public std::pmr::memory_resource
+	{
+	public:
+		// Public constructor(s)
+		/*!
+		 \brief Constructs the ae::TrackedResource by providing the tag and the upstream resource.
+
+		 \param[in] tag The ae::MemoryTag to which the allocations are attributed
+		 \param[in] upstream The memory resource that allocates the blocks, the default resource by default
+
+		 \par Example:
+		 \code
+		 // Attribute the logs' memory to the logging tag
+		 static ae::TrackedResource logResource(ae::MemoryTag::Logging);
+		 ae::DebugLogger::getInstance().setMemoryResource(&logResource);
+		 \endcode
+
+		 \since v0.7.0
+		*/
+		explicit TrackedResource(MemoryTag tag, std::pmr::memory_resource* upstream = std::pmr::get_default_resource()) noexcept;
+		/*!
+		 \brief Deleted copy constructor.
+
+		 \since v0.7.0
+		*/
+		TrackedResource(const TrackedResource&) = delete;
+		/*!
+		 \brief Deleted move constructor.
+
+		 \since v0.7.0
+		*/
+		TrackedResource(TrackedResource&&) = delete;
+	public:
+		// Public operator(s)
+		/*!
+		 \brief Deleted assignment operator.
+
+		 \since v0.7.0
+		*/
+		TrackedResource& operator=(const TrackedResource&) = delete;
+		/*!
+		 \brief Deleted move assignment operator.
+
+		 \since v0.7.0
+		*/
+		TrackedResource& operator=(TrackedResource&&) = delete;
+
+		// Public method(s)
+		/*!
+		 \brief Retrieves the tag to which the allocations are attributed.
+
+		 \return The ae::MemoryTag of the resource
+
+		 \since v0.7.0
+		*/
+		_NODISCARD MemoryTag getTag() const noexcept;
+		/*!
+		 \brief Retrieves the resource to which the allocations are forwarded.
+
+		 \return The upstream memory resource
+
+		 \since v0.7.0
+		*/
+		_NODISCARD std::pmr::memory_resource* getUpstream() const noexcept;
+
+	private:
+		// Private virtual method(s)
+		/*!
+		 \brief Allocates \a bytes bytes from the upstream resource within a scope of the resource's tag.
+
+		 \param[in] bytes The number of bytes to allocate
+		 \param[in] alignment The alignment of the block
+
+		 \return The pointer to the block allocated
+
+		 \since v0.7.0
+		*/
+		_NODISCARD virtual void* do_allocate(size_t bytes, size_t alignment) override final;
+		/*!
+		 \brief Deallocates a block previously allocated from the resource.
+
+		 \param[in] ptr The pointer to the block
+		 \param[in] bytes The number of bytes provided to do_allocate()
+		 \param[in] alignment The alignment provided to do_allocate()
+
+		 \since v0.7.0
+		*/
+		virtual void do_deallocate(void* ptr, size_t bytes, size_t alignment) override final;
+		/*!
+		 \brief Checks whether the memory allocated from the resource may be deallocated by the \a other resource.
+
+		 \param[in] other The other memory resource
+
+		 \return True if both resources are the same object, false otherwise
+
+		 \since v0.7.0
+		*/
+		_NODISCARD virtual bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override final;
+
+	private:
+		// Private member(s)
+		std::pmr::memory_resource* const mUpstream; //!< The resource that allocates the blocks
+		const MemoryTag                  mTag;      //!< The tag to which the allocations are attributed
+	};
+
+	/*!
+	 \brief The polymorphic memory resource forwarding the allocations to an upstream resource that may be replaced.
+	 \details The engine's long-lived containers are constructed with this resource so that the resource actually supplying their memory may be
+	 changed after their creation. The upstream resource may only be replaced once every block allocated from the previous one has been
+	 deallocated, the owner of the containers clearing them beforehand.
+	 \note The resource is internal to the engine's systems, the ones supplying their own memory resources don't need to use it.
+	*/
+	class AEON_API ForwardingResource : public std::pmr::memory_resource
+	{
+	public:
+		// Public constructor(s)
+		/*!
+		 \brief Default constructor.
+		 \details The allocations are forwarded to the default resource.
+
+		 \since v0.7.0
+		*/
+		ForwardingResource() noexcept;
+		/*!
+		 \brief Deleted copy constructor.
+
+		 \since v0.7.0
+		*/
+		ForwardingResource(const ForwardingResource&) = delete;
+		/*!
+		 \brief Deleted move constructor.
+
+		 \since v0.7.0
+		*/
+		ForwardingResource(ForwardingResource&&) = delete;
+	public:
+		// Public operator(s)
+		/*!
+		 \brief Deleted assignment operator.
+
+		 \since v0.7.0
+		*/
+		ForwardingResource& operator=(const ForwardingResource&) = delete;
+		/*!
+		 \brief Deleted move assignment operator.
+
+		 \since v0.7.0
+		*/
+		ForwardingResource& operator=(ForwardingResource&&) = delete;
+
+		// Public method(s)
+		/*!
+		 \brief Replaces the resource to which the allocations are forwarded.
+		 \details The replacement is refused if blocks allocated from the current upstream resource are still live.
+
+		 \param[in] upstream The new upstream memory resource, nullptr to forward to the default resource
+
+		 \return True if the upstream resource was replaced, false otherwise
+
+		 \sa getUpstream()
+
+		 \since v0.7.0
+		*/
+		bool setUpstream(std::pmr::memory_resource* upstream) noexcept;
+		/*!
+		 \brief Retrieves the resource to which the allocations are forwarded.
+
+		 \return The upstream memory resource
+
+		 \sa setUpstream()
+
+		 \since v0.7.0
+		*/
+		_NODISCARD std::pmr::memory_resource* getUpstream() const noexcept;
+		/*!
+		 \brief Retrieves the number of bytes currently allocated through the resource.
+
+		 \return The number of live bytes
+
+		 \since v0.7.0
+		*/
+		_NODISCARD size_t getLiveBytes() const noexcept;
+
+	private:
+		// Private virtual method(s)
+		/*!
+		 \brief Allocates \a bytes bytes from the upstream resource.
+
+		 \param[in] bytes The number of bytes to allocate
+		 \param[in] alignment The alignment of the block
+
+		 \return The pointer to the block allocated
+
+		 \since v0.7.0
+		*/
+		_NODISCARD virtual void* do_allocate(size_t bytes, size_t alignment) override final;
+		/*!
+		 \brief Deallocates a block previously allocated from the resource.
+
+		 \param[in] ptr The pointer to the block
+		 \param[in] bytes The number of bytes provided to do_allocate()
+		 \param[in] alignment The alignment provided to do_allocate()
+
+		 \since v0.7.0
+		*/
+		virtual void do_deallocate(void* ptr, size_t bytes, size_t alignment) override final;
+		/*!
+		 \brief Checks whether the memory allocated from the resource may be deallocated by the \a other resource.
+
+		 \param[in] other The other memory resource
+
+		 \return True if both resources are the same object, false otherwise
+
+		 \since v0.7.0
+		*/
+		_NODISCARD virtual bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override final;
+
+	private:
+		// Private member(s)
+		std::atomic<std::pmr::memory_resource*> mUpstream;  //!< The resource that allocates the blocks
+		std::atomic<size_t>                     mLiveBytes; //!< The number of bytes currently allocated through the resource
+	};
+}
+#endif // Aeon_System_MemoryResource_H_
+
+/*!
+ \class ae::TrackedResource
+ \ingroup system
+
+ The ae::TrackedResource class is a polymorphic memory resource that
+ attributes the memory of the containers using it to an ae::MemoryTag. Along
+ with the standard std::pmr resources (arenas, pools), it may be supplied to
+ the engine's containers that accept a memory resource:
+ ae::Renderable2D::setGeometryResource(), ae::BatchRenderer2D::setMemoryResource(),
+ ae::DebugLogger::setMemoryResource() and ae::Font::setPageResource().
+
+ Usage example:
+ \code
+ // Pool the logs' memory and attribute it to the logging tag
+ static std::pmr::synchronized_pool_resource logPool;
+ static ae::TrackedResource logResource(ae::MemoryTag::Logging, &logPool);
+ ae::DebugLogger::getInstance().setMemoryResource(&logResource);
+ \endcode
+
+ \author Filippos Gleglakos
+ \version v0.7.0
+ \date 2021.07.05
+ \copyright MIT License
+*/
+
+/*!
+ \class ae::ForwardingResource
+ \ingroup system
+
+ The ae::ForwardingResource class is a polymorphic memory resource that
+ forwards the allocations to another resource which may be replaced once
+ nothing is allocated from it. It allows the engine's singletons to change
+ the memory resource of containers that were created with them, but as the
+ memory resource of a std::pmr container can't change, they must be emptied
+ beforehand.
+
+ \author Filippos Gleglakos
+ \version v0.7.0
+ \date 2021.07.05
+ \copyright MIT License
+*/
\ No newline at end of file
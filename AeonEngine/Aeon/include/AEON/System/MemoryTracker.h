@@ -0,0 +1,381 @@
+// MIT License
+// 
+// Copyright(c) 2019-2021 Filippos Gleglakos
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef Aeon_System_MemoryTracker_H_
+#define Aeon_System_MemoryTracker_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <new>
+
+#include <AEON/Config.h>
+
+// Define the memory tagging macro (it's removed entirely if the memory tracking is disabled)
+#if AEON_MEMORY_TRACKING
+	#define AEON_MEMORY_SCOPE(tag) ae::MemoryTracker::Scope AEON_CONCAT(aeonMemoryScope, __LINE__)(tag)
+#else
+	#define AEON_MEMORY_SCOPE(tag) ((void)0)
+#endif // AEON_MEMORY_TRACKING
+
+namespace ae
+{
+	/*!
+	 \brief The enumeration of the subsystems to which the tracked allocations are attributed.
+	*/
+	enum class MemoryTag : uint8_t
+	{
+		Untagged,   //!< The allocations made outside of any tagged scope
+		Renderer,   //!< The renderers' submissions, batches and flushes
+		SceneGraph, //!< The actors' creation, updates and traversals
+		Text,       //!< The texts' geometry and the fonts' glyphs
+		GUI,        //!< The widgets' updates and event handling
+		Events,     //!< The events' creation, queuing and dispatch
+		Logging,    //!< The logs' creation and formatting
+		Count       //!< The number of tags (not a tag)
+	};
+
+	/*!
+	 \brief A static class used to account for the heap allocations of each subsystem.
+	*/
+	class AEON_API MemoryTracker
+	{
+	public:
+		// Public struct(s)
+		/*!
+		 \brief The struct representing the allocations attributed to a tag.
+		*/
+		struct AEON_API Statistics
+		{
+			size_t   liveBytes;        //!< The number of bytes currently allocated
+			size_t   peakBytes;        //!< The highest number of bytes allocated at once since the last call to resetPeaks()
+			uint64_t allocationCount;  //!< The number of allocations made since the application's start
+			uint64_t frameAllocations; //!< The number of allocations made during the last complete frame
+		};
+
+		/*!
+		 \brief RAII class attributing the calling thread's allocations to a tag until its destruction.
+		 \details The scopes may be nested, the innermost scope's tag being the one applied.
+		 Prefer using the AEON_MEMORY_SCOPE macro, which is removed when the memory tracking is disabled, over instantiating this class directly.
+		*/
+		class _NODISCARD AEON_API Scope
+		{
+		public:
+			// Public constructor(s)
+			/*!
+			 \brief Attributes the calling thread's allocations to the \a tag provided.
+
+			 \param[in] tag The ae::MemoryTag of the allocations made within the scope
+
+			 \since v0.7.0
+			*/
+			explicit Scope(MemoryTag tag) noexcept;
+			/*!
+			 \brief Deleted copy constructor.
+
+			 \since v0.7.0
+			*/
+			Scope(const Scope&) = delete;
+			/*!
+			 \brief Deleted move constructor.
+
+			 \since v0.7.0
+			*/
+			Scope(Scope&&) = delete;
+			/*!
+			 \brief Destructor.
+			 \details Restores the tag that was applied before the scope's construction.
+
+			 \since v0.7.0
+			*/
+			~Scope();
+		public:
+			// Public operator(s)
+			/*!
+			 \brief Deleted assignment operator.
+
+			 \since v0.7.0
+			*/
+			Scope& operator=(const Scope&) = delete;
+			/*!
+			 \brief Deleted move assignment operator.
+
+			 \since v0.7.0
+			*/
+			Scope& operator=(Scope&&) = delete;
+
+		private:
+			// Private member(s)
+			MemoryTag mPreviousTag; //!< The tag applied before the scope's construction
+		};
+
+	public:
+		// Public constructor(s)
+		/*!
+		 \brief Deleted default constructor.
+		 \details No instance of this class may be created.
+
+		 \since v0.7.0
+		*/
+		MemoryTracker() = delete;
+		/*!
+		 \brief Deleted copy constructor.
+
+		 \since v0.7.0
+		*/
+		MemoryTracker(const MemoryTracker&) = delete;
+		/*!
+		 \brief Deleted move constructor.
+
+		 \since v0.7.0
+		*/
+		MemoryTracker(MemoryTracker&&) = delete;
+	public:
+		// Public operator(s)
+		/*!
+		 \brief Deleted assignment operator.
+
+		 \since v0.7.0
+		*/
+		MemoryTracker& operator=(const MemoryTracker&) = delete;
+		/*!
+		 \brief Deleted move assignment operator.
+
+		 \since v0.7.0
+		*/
+		MemoryTracker& operator=(MemoryTracker&&) = delete;
+	public:
+		// Public static method(s)
+		/*!
+		 \brief Accounts for an allocation of \a size bytes attributed to the \a tag provided.
+		 \details This method is called by the global new operators, it only needs to be called directly for the allocations made through other means (like std::malloc()).
+		 \note This method may be called concurrently by several threads, it doesn't allocate.
+
+		 \param[in] tag The ae::MemoryTag to which the allocation is attributed
+		 \param[in] size The number of bytes allocated
+
+		 \sa recordDeallocation()
+
+		 \since v0.7.0
+		*/
+		static void recordAllocation(MemoryTag tag, size_t size) noexcept;
+		/*!
+		 \brief Accounts for the deallocation of \a size bytes previously attributed to the \a tag provided.
+		 \note This method may be called concurrently by several threads, it doesn't allocate.
+
+		 \param[in] tag The ae::MemoryTag to which the allocation was attributed
+		 \param[in] size The number of bytes deallocated
+
+		 \sa recordAllocation()
+
+		 \since v0.7.0
+		*/
+		static void recordDeallocation(MemoryTag tag, size_t size) noexcept;
+		/*!
+		 \brief Completes the current frame's allocation counts and starts counting the next frame's.
+		 \note This method is automatically called at the end of every frame by the ae::Application.
+
+		 \sa getStatistics()
+
+		 \since v0.7.0
+		*/
+		static void endFrame() noexcept;
+		/*!
+		 \brief Resets the peaks to the number of bytes currently allocated.
+		 \details Typically used when the application's state changes so that the peak of each state is measured separately.
+
+		 \since v0.7.0
+		*/
+		static void resetPeaks() noexcept;
+		/*!
+		 \brief Retrieves the allocations attributed to the \a tag provided.
+		 \note The statistics remain at zero if the memory tracking is disabled (see AEON_MEMORY_TRACKING), save for the calls made to recordAllocation() directly.
+
+		 \param[in] tag The ae::MemoryTag whose allocations will be retrieved
+
+		 \return The ae::MemoryTracker::Statistics of the tag
+
+		 \par Example:
+		 \code
+		 // Verify that the submissions to the renderer don't allocate every frame
+		 const ae::MemoryTracker::Statistics RENDERER = ae::MemoryTracker::getStatistics(ae::MemoryTag::Renderer);
+		 if (RENDERER.frameAllocations > 0) {
+			AEON_LOG_WARNING("Renderer allocations", std::to_string(RENDERER.frameAllocations) + " allocations during the last frame.");
+		 }
+		 \endcode
+
+		 \since v0.7.0
+		*/
+		_NODISCARD static Statistics getStatistics(MemoryTag tag) noexcept;
+		/*!
+		 \brief Retrieves the allocations of every tag combined.
+		 \details The peak is the highest number of bytes allocated at once across all tags, not the sum of the tags' peaks.
+
+		 \return The combined ae::MemoryTracker::Statistics
+
+		 \since v0.7.0
+		*/
+		_NODISCARD static Statistics getStatistics() noexcept;
+		/*!
+		 \brief Retrieves the tag to which the calling thread's allocations are currently attributed.
+
+		 \return The innermost ae::MemoryTag applied by a scope, ae::MemoryTag::Untagged if none is open
+
+		 \since v0.7.0
+		*/
+		_NODISCARD static MemoryTag getCurrentTag() noexcept;
+		/*!
+		 \brief Retrieves the readable name of the \a tag provided.
+
+		 \param[in] tag The ae::MemoryTag
+
+		 \return The tag's name, "Unknown" if the tag is invalid
+
+		 \since v0.7.0
+		*/
+		_NODISCARD static const char* getTagName(MemoryTag tag) noexcept;
+	};
+
+	/*!
+	 \brief The allocator adaptor attributing the allocations of a standard container to the tag provided.
+	 \details The allocations go through the global new operators within a scope of the tag, so they're tracked like any other.
+	 It's equivalent to std::allocator if the memory tracking is disabled.
+	*/
+	template <typename T, MemoryTag Tag>
+	class TrackedAllocator
+	{
+	public:
+		// Public typedef(s)
+		using value_type = T; //!< The type of the elements allocated
+
+		/*!
+		 \brief The struct used to retrieve the same allocator adaptor for another type of element.
+		*/
+		template <typename U>
+		struct rebind
+		{
+			using other = TrackedAllocator<U, Tag>; //!< The allocator adaptor of the type U
+		};
+
+	public:
+		// Public constructor(s)
+		/*!
+		 \brief Default constructor.
+
+		 \since v0.7.0
+		*/
+		TrackedAllocator() noexcept = default;
+		/*!
+		 \brief Converting constructor used by the containers to allocate their internal nodes.
+
+		 \since v0.7.0
+		*/
+		template <typename U>
+		TrackedAllocator(const TrackedAllocator<U, Tag>&) noexcept;
+	public:
+		// Public method(s)
+		/*!
+		 \brief Allocates the uninitialized storage of \a count elements.
+
+		 \param[in] count The number of elements
+
+		 \return The pointer to the storage allocated
+
+		 \since v0.7.0
+		*/
+		_NODISCARD T* allocate(size_t count);
+		/*!
+		 \brief Deallocates the storage of \a count elements previously allocated.
+
+		 \param[in] ptr The pointer returned by allocate()
+		 \param[in] count The number of elements provided to allocate()
+
+		 \since v0.7.0
+		*/
+		void deallocate(T* ptr, size_t count) noexcept;
+	};
+
+	// Public operator(s)
+	/*!
+	 \brief Checks whether two allocator adaptors are interchangeable, which is always the case.
+
+	 \return True
+
+	 \since v0.7.0
+	*/
+	template <typename T, typename U, MemoryTag Tag>
+	_NODISCARD bool operator==(const TrackedAllocator<T, Tag>&, const TrackedAllocator<U, Tag>&) noexcept;
+	/*!
+	 \brief Checks whether two allocator adaptors aren't interchangeable, which is never the case.
+
+	 \return False
+
+	 \since v0.7.0
+	*/
+	template <typename T, typename U, MemoryTag Tag>
+	_NODISCARD bool operator!=(const TrackedAllocator<T, Tag>&, const TrackedAllocator<U, Tag>&) noexcept;
+}
+#include <AEON/System/MemoryTracker.inl>
+#endif // Aeon_System_MemoryTracker_H_
+
+/*!
+ \class ae::MemoryTracker
+ \ingroup system
+
+ The ae::MemoryTracker static class accounts for the heap allocations made by
+ each subsystem: the number of bytes currently allocated, their peak and the
+ number of allocations made during the last frame. It's used to measure the
+ allocation churn of the engine's hot paths and to catch its regressions.
+
+ The tracking is only compiled if AEON_MEMORY_TRACKING is defined to 1 (it's
+ disabled by default). The global new and delete operators are then replaced
+ so that every allocation is attributed to the tag of the innermost
+ ae::MemoryTracker::Scope open on the calling thread, each block storing its
+ size and tag in a small header. The replacement operators only apply to the
+ allocations of the module that Aeon is linked into, so a dynamically-linked
+ Aeon only tracks its own allocations on Windows.
+
+ Aeon already tags the processing of the events, the updates of the states and
+ of the actors, the rendering, the texts, the widgets and the logs. The
+ standard containers may be attributed to a tag regardless of where they grow
+ with the ae::TrackedAllocator adaptor.
+
+ Usage example:
+ \code
+ // Attribute the allocations of a system to a tag
+ void ParticleSystem::update(const ae::Time& dt)
+ {
+	AEON_MEMORY_SCOPE(ae::MemoryTag::SceneGraph);
+	...
+ }
+
+ // Attribute a container's allocations to a tag wherever it grows
+ std::vector<ae::Vertex2D, ae::TrackedAllocator<ae::Vertex2D, ae::MemoryTag::Renderer>> vertices;
+
+ const ae::MemoryTracker::Statistics STATISTICS = ae::MemoryTracker::getStatistics(ae::MemoryTag::SceneGraph);
+ std::cout << STATISTICS.liveBytes << " bytes, " << STATISTICS.frameAllocations << " allocations during the last frame\n";
+ \endcode
+
+ \author Filippos Gleglakos
+ \version v0.7.0
+ \date 2021.07.05
+ \copyright MIT License
+*/
\ No newline at end of file
@@ -0,0 +1,68 @@
+// MIT License
+// 
+// Copyright(c) 2019-2021 Filippos Gleglakos
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+namespace ae
+{
+	// Public constructor(s)
+	template <typename T, MemoryTag Tag>
+	template <typename U>
+	TrackedAllocator<T, Tag>::TrackedAllocator(const TrackedAllocator<U, Tag>&) noexcept
+	{
+	}
+
+	// Public method(s)
+	template <typename T, MemoryTag Tag>
+	_NODISCARD T* TrackedAllocator<T, Tag>::allocate(size_t count)
+	{
+		// The new operator attributes the allocation to the scope's tag
+		AEON_MEMORY_SCOPE(Tag);
+		if _CONSTEXPR_IF (alignof(T) > __STDCPP_DEFAULT_NEW_ALIGNMENT__) {
+			return static_cast<T*>(::operator new(count * sizeof(T), std::align_val_t(alignof(T))));
+		}
+		return static_cast<T*>(::operator new(count * sizeof(T)));
+	}
+
+	template <typename T, MemoryTag Tag>
+	void TrackedAllocator<T, Tag>::deallocate(T* ptr, size_t count) noexcept
+	{
+		// The block's header holds the tag to which it was attributed
+		if _CONSTEXPR_IF (alignof(T) > __STDCPP_DEFAULT_NEW_ALIGNMENT__) {
+			::operator delete(ptr, count * sizeof(T), std::align_val_t(alignof(T)));
+		}
+		else {
+			::operator delete(ptr, count * sizeof(T));
+		}
+	}
+
+	// Public operator(s)
+	template <typename T, typename U, MemoryTag Tag>
+	_NODISCARD bool operator==(const TrackedAllocator<T, Tag>&, const TrackedAllocator<U, Tag>&) noexcept
+	{
+		return true;
+	}
+
+	template <typename T, typename U, MemoryTag Tag>
+	_NODISCARD bool operator!=(const TrackedAllocator<T, Tag>&, const TrackedAllocator<U, Tag>&) noexcept
+	{
+		return false;
+	}
+}
\ No newline at end of file
@@ -0,0 +1,257 @@
+// MIT License
+// 
+// Copyright(c) 2019-2021 Filippos Gleglakos
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#ifndef Aeon_System_ObjectPool_H_
+#define Aeon_System_ObjectPool_H_
+
+#include <new>
+#include <mutex>
+#include <memory>
+#include <vector>
+
+#include <AEON/Config.h>
+
+namespace ae
+{
+	/*!
+	 \brief The singleton template class used to recycle the memory of objects of type T through a free list.
+	 \details The memory is allocated in chunks of growing size and is never returned to the global heap until the pool is destroyed,
+	 so creating and destroying many objects doesn't fragment the memory.
+	 \note The pool is usually used through the ae::PoolAllocated mixin rather than directly.
+	*/
+	template <typename T>
+	class ObjectPool
+	{
+	public:
+		// Public constructor(s)
+		/*!
+		 \brief Deleted copy constructor.
+
+		 \since v0.7.0
+		*/
+		ObjectPool(const ObjectPool<T>&) = delete;
+		/*!
+		 \brief Deleted move constructor.
+
+		 \since v0.7.0
+		*/
+		ObjectPool(ObjectPool<T>&&) = delete;
+	public:
+		// Public operator(s)
+		/*!
+		 \brief Deleted assignment operator.
+
+		 \since v0.7.0
+		*/
+		ObjectPool<T>& operator=(const ObjectPool<T>&) = delete;
+		/*!
+		 \brief Deleted move assignment operator.
+
+		 \since v0.7.0
+		*/
+		ObjectPool<T>& operator=(ObjectPool<T>&&) = delete;
+	public:
+		// Public method(s)
+		/*!
+		 \brief Retrieves uninitialized memory for one object of type T.
+		 \details A recycled slot is used if one is available, otherwise a new chunk of slots is allocated.
+
+		 \return A pointer to the uninitialized memory
+
+		 \sa deallocate()
+
+		 \since v0.7.0
+		*/
+		_NODISCARD void* allocate();
+		/*!
+		 \brief Returns the memory of a destroyed object to the pool so that it may be recycled.
+
+		 \param[in] ptr The memory previously retrieved with allocate()
+
+		 \sa allocate()
+
+		 \since v0.7.0
+		*/
+		void deallocate(void* ptr) noexcept;
+		/*!
+		 \brief Allocates enough slots upfront so that \a count objects may be alive at the same time without the pool growing.
+
+		 \param[in] count The number of objects
+
+		 \par Example:
+		 \code
+		 // Prepare the bullets' memory before the level starts
+		 ae::ObjectPool<Bullet>::getInstance().reserve(5000);
+		 \endcode
+
+		 \since v0.7.0
+		*/
+		void reserve(size_t count);
+		/*!
+		 \brief Retrieves the total number of slots allocated by the pool.
+
+		 \return The number of slots, used and free
+
+		 \since v0.7.0
+		*/
+		_NODISCARD size_t getCapacity() const noexcept;
+		/*!
+		 \brief Retrieves the number of slots available for recycling.
+
+		 \return The number of free slots
+
+		 \since v0.7.0
+		*/
+		_NODISCARD size_t getFreeCount() const noexcept;
+
+		// Public static method(s)
+		/*!
+		 \brief Retrieves the single instance of the ae::ObjectPool associated to the type T.
+
+		 \return The single instance of the ae::ObjectPool
+
+		 \since v0.7.0
+		*/
+		_NODISCARD static ObjectPool<T>& getInstance();
+
+	private:
+		// Private union(s)
+		/*!
+		 \brief The storage of one object which holds the next free slot while it's unused.
+		*/
+		union Slot
+		{
+			Slot*                    next;               //!< The next free slot
+			alignas(T) unsigned char storage[sizeof(T)]; //!< The storage of the object
+		};
+
+	private:
+		// Private constructor(s)
+		/*!
+		 \brief Default constructor.
+
+		 \since v0.7.0
+		*/
+		ObjectPool() noexcept;
+
+	private:
+		// Private method(s)
+		/*!
+		 \brief Allocates a new chunk of \a count slots and adds them to the free list.
+
+		 \param[in] count The number of slots
+
+		 \since v0.7.0
+		*/
+		void grow(size_t count);
+
+	private:
+		// Private member(s)
+		std::vector<std::unique_ptr<Slot[]>> mChunks;    //!< The chunks of slots allocated
+		Slot*                                mFreeList;  //!< The first free slot
+		size_t                               mCapacity;  //!< The total number of slots
+		size_t                               mFreeCount; //!< The number of free slots
+		mutable std::mutex                   mMutex;     //!< The mutex protecting the free list
+	};
+
+	/*!
+	 \brief Mixin template class which makes the derived class T allocate its instances from the ae::ObjectPool associated to it.
+	 \details Only the class-specific allocation functions are replaced, so the instances are still created with std::make_unique and destroyed
+	 by the default deleter of std::unique_ptr (as long as T has a virtual destructor when destroyed through a base pointer, as ae::Actor2D does).
+
+	 \par Example:
+	 \code
+	 class Bullet : public ae::Sprite, public ae::PoolAllocated<Bullet>
+	 {
+		...
+	 };
+
+	 // The bullet's memory comes from ae::ObjectPool<Bullet> and it's recycled once the bullet is removed from the scene
+	 mSceneRoot->attachChild(std::make_unique<Bullet>(bulletTexture));
+	 \endcode
+	*/
+	template <typename T>
+	class PoolAllocated
+	{
+	public:
+		// Public static operator(s)
+		/*!
+		 \brief Allocates the memory of an instance of T from its ae::ObjectPool.
+		 \note Classes derived from T that are larger than T are allocated on the global heap.
+
+		 \param[in] size The size of the instance
+
+		 \return A pointer to the uninitialized memory
+
+		 \since v0.7.0
+		*/
+		_NODISCARD static void* operator new(size_t size)
+		{
+			return (size == sizeof(T)) ? ObjectPool<T>::getInstance().allocate() : ::operator new(size);
+		}
+		/*!
+		 \brief Returns the memory of a destroyed instance of T to its ae::ObjectPool.
+
+		 \param[in] ptr The memory of the destroyed instance
+		 \param[in] size The size of the destroyed instance
+
+		 \since v0.7.0
+		*/
+		static void operator delete(void* ptr, size_t size) noexcept
+		{
+			if (size == sizeof(T)) {
+				ObjectPool<T>::getInstance().deallocate(ptr);
+			}
+			else {
+				::operator delete(ptr);
+			}
+		}
+
+	protected:
+		// Protected constructor(s)
+		/*!
+		 \brief Default constructor.
+
+		 \since v0.7.0
+		*/
+		PoolAllocated() noexcept = default;
+	};
+}
+#include <AEON/System/ObjectPool.inl>
+#endif // Aeon_System_ObjectPool_H_
+
+/*!
+ \class ae::ObjectPool
+ \ingroup system
+
+ The ae::ObjectPool singleton template class stores a free list of recycled
+ memory slots for a specific type. Combined with the ae::PoolAllocated mixin,
+ it allows objects that are frequently spawned and despawned (bullets,
+ particles, etc.) to be created with std::make_unique and attached to the scene
+ graph as usual, while their memory no longer goes through the global heap.
+
+ \author Filippos Gleglakos
+ \version v0.7.0
+ \date 2021.07.05
+ \copyright MIT License
+*/
\ No newline at end of file
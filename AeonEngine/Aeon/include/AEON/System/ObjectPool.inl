@@ -0,0 +1,117 @@
+// MIT License
+// 
+// Copyright(c) 2019-2021 Filippos Gleglakos
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+namespace ae
+{
+	// Public method(s)
+	template <typename T>
+	_NODISCARD void* ObjectPool<T>::allocate()
+	{
+		std::lock_guard<std::mutex> lock(mMutex);
+
+		// Double the pool's capacity if there aren't any free slots left
+		if (!mFreeList) {
+			grow((mCapacity == 0) ? 64 : mCapacity);
+		}
+
+		Slot* const slot = mFreeList;
+		mFreeList = slot->next;
+		--mFreeCount;
+
+		return slot->storage;
+	}
+
+	template <typename T>
+	void ObjectPool<T>::deallocate(void* ptr) noexcept
+	{
+		if (!ptr) {
+			return;
+		}
+
+		std::lock_guard<std::mutex> lock(mMutex);
+
+		Slot* const slot = reinterpret_cast<Slot*>(ptr);
+		slot->next = mFreeList;
+		mFreeList = slot;
+		++mFreeCount;
+	}
+
+	template <typename T>
+	void ObjectPool<T>::reserve(size_t count)
+	{
+		std::lock_guard<std::mutex> lock(mMutex);
+
+		if (count > mCapacity) {
+			grow(count - mCapacity);
+		}
+	}
+
+	template <typename T>
+	_NODISCARD size_t ObjectPool<T>::getCapacity() const noexcept
+	{
+		std::lock_guard<std::mutex> lock(mMutex);
+		return mCapacity;
+	}
+
+	template <typename T>
+	_NODISCARD size_t ObjectPool<T>::getFreeCount() const noexcept
+	{
+		std::lock_guard<std::mutex> lock(mMutex);
+		return mFreeCount;
+	}
+
+	// Public static method(s)
+	template <typename T>
+	_NODISCARD ObjectPool<T>& ObjectPool<T>::getInstance()
+	{
+		static ObjectPool<T> instance;
+		return instance;
+	}
+
+	// Private constructor(s)
+	template <typename T>
+	ObjectPool<T>::ObjectPool() noexcept
+		: mChunks()
+		, mFreeList(nullptr)
+		, mCapacity(0)
+		, mFreeCount(0)
+		, mMutex()
+	{
+	}
+
+	// Private method(s)
+	template <typename T>
+	void ObjectPool<T>::grow(size_t count)
+	{
+		// Allocate the chunk and link its slots in front of the free list
+		mChunks.push_back(std::make_unique<Slot[]>(count));
+		Slot* const chunk = mChunks.back().get();
+		for (size_t i = 0; i < count; ++i) {
+			chunk[i].next = (i + 1 < count) ? &chunk[i + 1] : mFreeList;
+		}
+
+		mFreeList = chunk;
+		mCapacity += count;
+		mFreeCount += count;
+	}
+}
\ No newline at end of file
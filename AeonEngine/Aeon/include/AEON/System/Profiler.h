@@ -0,0 +1,343 @@
+// MIT License
+// 
+// Copyright(c) 2019-2021 Filippos Gleglakos
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#ifndef Aeon_System_Profiler_H_
+#define Aeon_System_Profiler_H_
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include <AEON/Config.h>
+
+// Define the profiling macros
+#define AEON_PROFILE_SCOPE(name) ae::Profiler::Scope AEON_CONCAT(aeonProfileScope, __LINE__)(name)
+#define AEON_PROFILE_FUNCTION() AEON_PROFILE_SCOPE(__func__)
+
+namespace ae
+{
+	/*!
+	 \brief Singleton class used to record the CPU time spent in named scopes across all threads.
+	*/
+	class AEON_API Profiler
+	{
+	public:
+		// Public struct(s)
+		/*!
+		 \brief The struct representing a scope that has been closed.
+		*/
+		struct AEON_API Event
+		{
+			const char* name;     //!< The name of the scope (a string literal)
+			int64_t     start;    //!< The number of nanoseconds elapsed between the profiler's creation and the scope's beginning
+			int64_t     duration; //!< The number of nanoseconds spent within the scope
+			uint32_t    depth;    //!< The number of scopes that were open when this scope began
+		};
+
+		/*!
+		 \brief RAII class opening a named scope upon construction and closing it upon destruction.
+		 \details Prefer using the AEON_PROFILE_SCOPE and AEON_PROFILE_FUNCTION macros over instantiating this class directly.
+		*/
+		class _NODISCARD AEON_API Scope
+		{
+		public:
+			// Public constructor(s)
+			/*!
+			 \brief Opens the scope \a name.
+
+			 \param[in] name The name of the scope, which must outlive the profiler (a string literal)
+
+			 \since v0.7.0
+			*/
+			explicit Scope(const char* name) noexcept;
+			/*!
+			 \brief Deleted copy constructor.
+
+			 \since v0.7.0
+			*/
+			Scope(const Scope&) = delete;
+			/*!
+			 \brief Deleted move constructor.
+
+			 \since v0.7.0
+			*/
+			Scope(Scope&&) = delete;
+			/*!
+			 \brief Destructor.
+			 \details Closes the scope opened upon construction.
+
+			 \since v0.7.0
+			*/
+			~Scope();
+		public:
+			// Public operator(s)
+			/*!
+			 \brief Deleted assignment operator.
+
+			 \since v0.7.0
+			*/
+			Scope& operator=(const Scope&) = delete;
+			/*!
+			 \brief Deleted move assignment operator.
+
+			 \since v0.7.0
+			*/
+			Scope& operator=(Scope&&) = delete;
+
+		private:
+			// Private member(s)
+			bool mRecorded; //!< Whether the scope was opened while the profiler was enabled
+		};
+
+	public:
+		// Public constructor(s)
+		/*!
+		 \brief Deleted copy constructor.
+
+		 \since v0.7.0
+		*/
+		Profiler(const Profiler&) = delete;
+		/*!
+		 \brief Deleted move constructor.
+
+		 \since v0.7.0
+		*/
+		Profiler(Profiler&&) = delete;
+		/*!
+		 \brief Destructor.
+
+		 \since v0.7.0
+		*/
+		~Profiler();
+	public:
+		// Public operator(s)
+		/*!
+		 \brief Deleted assignment operator.
+
+		 \since v0.7.0
+		*/
+		Profiler& operator=(const Profiler&) = delete;
+		/*!
+		 \brief Deleted move assignment operator.
+
+		 \since v0.7.0
+		*/
+		Profiler& operator=(Profiler&&) = delete;
+	public:
+		// Public method(s)
+		/*!
+		 \brief Opens a named scope on the calling thread.
+		 \details Scopes may be nested, and every scope opened must be closed with endScope() by the same thread.\n
+		 Nothing is recorded if the ae::Profiler is disabled.
+
+		 \param[in] name The name of the scope, which must outlive the profiler (a string literal)
+
+		 \par Example:
+		 \code
+		 void MyState::update(const ae::Time& dt)
+		 {
+			AEON_PROFILE_FUNCTION();
+			...
+			{
+				AEON_PROFILE_SCOPE("Pathfinding");
+				...
+			}
+		 }
+		 \endcode
+
+		 \sa endScope()
+
+		 \since v0.7.0
+		*/
+		void beginScope(const char* name) noexcept;
+		/*!
+		 \brief Closes the last scope opened by the calling thread and records it into the thread's ring buffer.
+		 \details Once the ring buffer is full, the oldest events are overwritten.
+		 \note The scopes are closed even if the ae::Profiler has been disabled since they were opened.
+
+		 \sa beginScope()
+
+		 \since v0.7.0
+		*/
+		void endScope() noexcept;
+		/*!
+		 \brief Sets the name of the calling thread which will appear in the exported traces.
+		 \details The threads are otherwise named by the order in which they first recorded a scope.
+
+		 \param[in] name The name of the calling thread
+
+		 \since v0.7.0
+		*/
+		void setThreadName(const std::string& name);
+		/*!
+		 \brief Discards every event recorded thus far by all threads.
+
+		 \since v0.7.0
+		*/
+		void clear();
+		/*!
+		 \brief Writes the events recorded by all threads to the \a filepath provided in Chrome's trace event format.
+		 \details The file may be opened with chrome://tracing or https://ui.perfetto.dev.\n
+		 Events may be exported while the threads are still recording, the events overwritten during the export are skipped.
+
+		 \param[in] filepath The path of the JSON file which will be created (or truncated)
+
+		 \par Example:
+		 \code
+		 ae::Profiler& profiler = ae::Profiler::getInstance();
+		 profiler.setEnabled(true);
+		 ...
+		 profiler.exportChromeTrace("Logs/trace.json");
+		 \endcode
+
+		 \sa getEvents()
+
+		 \since v0.7.0
+		*/
+		void exportChromeTrace(const std::string& filepath);
+		/*!
+		 \brief Sets whether the ae::Profiler will record the scopes opened.
+		 \details The ae::Profiler is disabled by default, in which case scopes cost a single comparison.
+
+		 \param[in] flag True to enable the profiler, false to disable it
+
+		 \sa isEnabled()
+
+		 \since v0.7.0
+		*/
+		void setEnabled(bool flag) noexcept;
+		/*!
+		 \brief Retrieves the events recorded by the calling thread which are still held by its ring buffer.
+		 \details The events are listed in the order of which their scopes were closed.
+
+		 \return The list of events held by the calling thread's ring buffer
+
+		 \sa exportChromeTrace()
+
+		 \since v0.7.0
+		*/
+		_NODISCARD std::vector<Event> getEvents();
+		/*!
+		 \brief Checks whether the ae::Profiler records the scopes opened.
+
+		 \return True if the profiler is enabled, false otherwise
+
+		 \sa setEnabled()
+
+		 \since v0.7.0
+		*/
+		_NODISCARD bool isEnabled() const noexcept;
+
+		// Public static method(s)
+		/*!
+		 \brief Retrieves the single instance of the ae::Profiler.
+
+		 \return The single instance of the ae::Profiler
+
+		 \since v0.7.0
+		*/
+		_NODISCARD static Profiler& getInstance();
+	private:
+		// Forward declaration(s)
+		struct ThreadRing;
+
+	private:
+		// Private constructor(s)
+		/*!
+		 \brief Default constructor.
+
+		 \since v0.7.0
+		*/
+		Profiler();
+	private:
+		// Private method(s)
+		/*!
+		 \brief Retrieves the ring buffer of the calling thread, creating it if it's the thread's first scope.
+
+		 \return The calling thread's ring buffer
+
+		 \since v0.7.0
+		*/
+		_NODISCARD ThreadRing& getThreadRing();
+		/*!
+		 \brief Copies the events held by the \a ring provided.
+
+		 \param[in] ring The ring buffer whose events will be copied
+		 \param[out] events The list to which the events will be appended
+
+		 \since v0.7.0
+		*/
+		void copyEvents(const ThreadRing& ring, std::vector<Event>& events) const;
+		/*!
+		 \brief Retrieves the number of nanoseconds elapsed since the ae::Profiler's creation.
+
+		 \return The current timestamp in nanoseconds
+
+		 \since v0.7.0
+		*/
+		_NODISCARD int64_t getTimestamp() const noexcept;
+
+	private:
+		// Private member(s)
+		std::vector<std::unique_ptr<ThreadRing>> mRings;     //!< The ring buffers of every thread that has recorded a scope
+		std::mutex                               mRingMutex; //!< The mutex protecting the list of ring buffers (not the rings themselves)
+		int64_t                                  mEpoch;     //!< The timestamp of the profiler's creation in nanoseconds
+		std::atomic<bool>                        mEnabled;   //!< Whether the scopes opened are recorded
+	};
+}
+#endif // Aeon_System_Profiler_H_
+
+/*!
+ \class ae::Profiler
+ \ingroup system
+
+ The ae::Profiler singleton class records the CPU time spent in named scopes.
+ Each thread records its closed scopes into its own fixed-size ring buffer
+ without any locking, the oldest events being overwritten once the ring is
+ full, so that the profiler may be left enabled in production builds.
+
+ Aeon already opens scopes around the ae::Application's event processing,
+ updating and rendering, around the dispatch of the user-created states,
+ around the update and rendering of each ae::Actor2D and around the renderers'
+ flushes. The events recorded may be exported to Chrome's trace event format
+ and inspected with chrome://tracing or Perfetto.
+
+ Usage example:
+ \code
+ ae::Profiler::getInstance().setEnabled(true);
+
+ void MyState::update(const ae::Time& dt)
+ {
+	AEON_PROFILE_FUNCTION();
+	...
+ }
+ \endcode
+
+ \author Filippos Gleglakos
+ \version v0.7.0
+ \date 2021.07.05
+ \copyright MIT License
+*/
\ No newline at end of file
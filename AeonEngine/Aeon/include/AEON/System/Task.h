@@ -0,0 +1,470 @@
+// MIT License
+// 
+// Copyright(c) 2019-2021 Filippos Gleglakos
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef Aeon_System_Task_H_
+#define Aeon_System_Task_H_
+
+#include <AEON/Config.h>
+
+#if AEON_COROUTINES
+#include <coroutine>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include <AEON/System/Time.h>
+#include <AEON/System/TimerWheel.h>
+
+namespace ae
+{
+	/*!
+	 \brief The class representing a coroutine whose execution is suspended while it awaits time, assets, events or other tasks.
+	 \details A function returning an ae::Task may use co_await, its execution starting immediately until it first suspends.
+	*/
+	class _NODISCARD AEON_API Task
+	{
+	public:
+		// Public struct(s)
+		/*!
+		 \brief The struct shared with the awaited operations to resume the task, the handle being reset once the task is destroyed.
+		*/
+		struct Continuation
+		{
+			std::coroutine_handle<> handle; //!< The handle of the suspended coroutine, null once it's destroyed or completed
+		};
+
+		/*!
+		 \brief The struct through which the compiler creates and completes the coroutine.
+		*/
+		struct AEON_API promise_type
+		{
+			// Public member(s)
+			std::shared_ptr<Continuation> continuation = std::make_shared<Continuation>(); //!< The continuation resuming the coroutine
+			std::weak_ptr<Continuation>   waiter;                                          //!< The continuation of the task awaiting this one, if any
+
+			// Public method(s)
+			/*!
+			 \brief Creates the ae::Task owning the coroutine.
+
+			 \return The ae::Task owning the coroutine
+
+			 \since v0.7.0
+			*/
+			_NODISCARD Task get_return_object() noexcept;
+			/*!
+			 \brief Starts the coroutine's execution immediately.
+
+			 \return The awaitable never suspending
+
+			 \since v0.7.0
+			*/
+			_NODISCARD std::suspend_never initial_suspend() const noexcept;
+			/*!
+			 \brief Resets the continuation and resumes the task awaiting this one (if any) once the coroutine completes.
+			 \details The coroutine remains suspended at its end until its ae::Task is destroyed.
+
+			 \return The awaitable transferring the execution to the awaiting task
+
+			 \since v0.7.0
+			*/
+			_NODISCARD auto final_suspend() noexcept
+			{
+				struct FinalAwaiter
+				{
+					bool await_ready() const noexcept { return false; }
+					std::coroutine_handle<> await_suspend(std::coroutine_handle<>) const noexcept { return next; }
+					void await_resume() const noexcept {}
+
+					std::coroutine_handle<> next;
+				};
+
+				continuation->handle = nullptr;
+				const std::shared_ptr<Continuation> WAITER = waiter.lock();
+				return FinalAwaiter{ (WAITER && WAITER->handle) ? WAITER->handle : std::noop_coroutine() };
+			}
+			/*!
+			 \brief Completes the coroutine once it reaches its end or a co_return statement.
+
+			 \since v0.7.0
+			*/
+			void return_void() const noexcept;
+			/*!
+			 \brief Terminates the application, the exceptions aren't used by the engine.
+
+			 \since v0.7.0
+			*/
+			void unhandled_exception() const noexcept;
+		};
+
+	public:
+		// Public typedef(s)
+		using Handle = std::coroutine_handle<promise_type>; //!< The handle of the coroutine owned by an ae::Task
+
+	public:
+		// Public constructor(s)
+		/*!
+		 \brief Default constructor.
+		 \details Constructs an empty task owning no coroutine.
+
+		 \since v0.7.0
+		*/
+		Task() noexcept;
+		/*!
+		 \brief Constructs the ae::Task owning the coroutine of the \a handle provided.
+		 \note The tasks are constructed by the compiler, the API user doesn't need to call this constructor.
+
+		 \param[in] handle The handle of the coroutine
+
+		 \since v0.7.0
+		*/
+		explicit Task(Handle handle) noexcept;
+		/*!
+		 \brief Deleted copy constructor.
+
+		 \since v0.7.0
+		*/
+		Task(const Task&) = delete;
+		/*!
+		 \brief Move constructor.
+
+		 \param[in] rvalue The ae::Task that will be moved
+
+		 \since v0.7.0
+		*/
+		Task(Task&& rvalue) noexcept;
+		/*!
+		 \brief Destructor.
+		 \details Cancels the coroutine if it hasn't completed.
+
+		 \sa cancel()
+
+		 \since v0.7.0
+		*/
+		~Task();
+	public:
+		// Public operator(s)
+		/*!
+		 \brief Deleted assignment operator.
+
+		 \since v0.7.0
+		*/
+		Task& operator=(const Task&) = delete;
+		/*!
+		 \brief Move assignment operator.
+		 \details The caller's coroutine is cancelled if it hasn't completed.
+
+		 \param[in] rvalue The ae::Task that will be moved
+
+		 \return The caller ae::Task
+
+		 \since v0.7.0
+		*/
+		Task& operator=(Task&& rvalue) noexcept;
+		/*!
+		 \brief Suspends the calling task until the ae::Task completes.
+		 \details The calling task is resumed immediately once the ae::Task completes, or isn't suspended at all if it has already completed.
+
+		 \return The awaitable completing along with the ae::Task
+
+		 \par Example:
+		 \code
+		 ae::Task LoadingState::load()
+		 {
+			co_await loadTextures();
+			co_await loadLevel();
+			requestStatePush(GAME_STATE_ID);
+		 }
+		 \endcode
+
+		 \since v0.7.0
+		*/
+		_NODISCARD auto operator co_await() const noexcept
+		{
+			struct TaskAwaiter
+			{
+				bool await_ready() const noexcept { return !handle || handle.done(); }
+				void await_suspend(Handle caller) const noexcept { handle.promise().waiter = caller.promise().continuation; }
+				void await_resume() const noexcept {}
+
+				Handle handle;
+			};
+
+			return TaskAwaiter{ mHandle };
+		}
+	public:
+		// Public method(s)
+		/*!
+		 \brief Cancels the coroutine by destroying it, the objects it holds and the operations it awaits.
+		 \note A task mustn't be cancelled from within its own coroutine.
+
+		 \since v0.7.0
+		*/
+		void cancel() noexcept;
+		/*!
+		 \brief Checks whether the ae::Task's coroutine has completed.
+
+		 \return True if the coroutine has completed or if the ae::Task is empty, false if it's suspended
+
+		 \since v0.7.0
+		*/
+		_NODISCARD bool isDone() const noexcept;
+
+	private:
+		// Private member(s)
+		Handle mHandle; //!< The handle of the owned coroutine
+	};
+
+	/*!
+	 \brief Singleton class resuming the suspended tasks whose awaited operations completed, driven by the application's fixed time step.
+	*/
+	class AEON_API TaskScheduler
+	{
+	public:
+		// Public constructor(s)
+		/*!
+		 \brief Deleted copy constructor.
+
+		 \since v0.7.0
+		*/
+		TaskScheduler(const TaskScheduler&) = delete;
+		/*!
+		 \brief Deleted move constructor.
+
+		 \since v0.7.0
+		*/
+		TaskScheduler(TaskScheduler&&) = delete;
+	public:
+		// Public operator(s)
+		/*!
+		 \brief Deleted assignment operator.
+
+		 \since v0.7.0
+		*/
+		TaskScheduler& operator=(const TaskScheduler&) = delete;
+		/*!
+		 \brief Deleted move assignment operator.
+
+		 \since v0.7.0
+		*/
+		TaskScheduler& operator=(TaskScheduler&&) = delete;
+	public:
+		// Public method(s)
+		/*!
+		 \brief Queues the task of the \a continuation provided to be resumed during the next fixed step.
+		 \details The awaitables call this method once their operation completes. The tasks destroyed in the meantime aren't resumed.
+		 \note This method may be called concurrently by several threads.
+
+		 \param[in] continuation The ae::Task::Continuation of the suspended task
+
+		 \since v0.7.0
+		*/
+		void schedule(std::weak_ptr<Task::Continuation> continuation);
+		/*!
+		 \brief Resumes the tasks queued before the call in a single batch.
+		 \details The tasks queued while they're being resumed are resumed during the next call.
+		 \note This method is automatically called by the ae::Application during each fixed step, once the timers have expired and before the
+		 states are updated.
+
+		 \since v0.7.0
+		*/
+		void update();
+
+		// Public static method(s)
+		/*!
+		 \brief Retrieves the single instance of the ae::TaskScheduler.
+
+		 \return The single instance of the ae::TaskScheduler
+
+		 \since v0.7.0
+		*/
+		_NODISCARD static TaskScheduler& getInstance();
+
+	private:
+		// Private constructor(s)
+		/*!
+		 \brief Default constructor.
+
+		 \since v0.7.0
+		*/
+		TaskScheduler();
+
+	private:
+		// Private member(s)
+		std::mutex                                     mMutex;   //!< The mutex protecting the queued continuations
+		std::vector<std::weak_ptr<Task::Continuation>> mQueued;  //!< The continuations of the tasks to resume
+		std::vector<std::weak_ptr<Task::Continuation>> mResumed; //!< The continuations being resumed (kept to reuse their storage)
+	};
+
+	/*!
+	 \brief The awaitable suspending a task for a duration, returned by ae::wait().
+	*/
+	class _NODISCARD AEON_API WaitAwaiter
+	{
+	public:
+		// Public constructor(s)
+		/*!
+		 \brief Constructs the ae::WaitAwaiter by providing the \a duration to wait.
+
+		 \param[in] duration The ae::Time during which the task is suspended
+
+		 \since v0.7.0
+		*/
+		explicit WaitAwaiter(const Time& duration) noexcept;
+		/*!
+		 \brief Deleted copy constructor.
+
+		 \since v0.7.0
+		*/
+		WaitAwaiter(const WaitAwaiter&) = delete;
+		/*!
+		 \brief Destructor.
+		 \details Cancels the timer if the task is destroyed before the duration elapses.
+
+		 \since v0.7.0
+		*/
+		~WaitAwaiter();
+	public:
+		// Public operator(s)
+		/*!
+		 \brief Deleted assignment operator.
+
+		 \since v0.7.0
+		*/
+		WaitAwaiter& operator=(const WaitAwaiter&) = delete;
+	public:
+		// Public method(s)
+		/*!
+		 \brief Checks whether the task needs to be suspended, which is always the case.
+
+		 \return False
+
+		 \since v0.7.0
+		*/
+		_NODISCARD bool await_ready() const noexcept;
+		/*!
+		 \brief Schedules the timer resuming the task once the duration has elapsed.
+
+		 \param[in] caller The handle of the suspended task
+
+		 \since v0.7.0
+		*/
+		void await_suspend(Task::Handle caller);
+		/*!
+		 \brief Called once the task is resumed.
+
+		 \since v0.7.0
+		*/
+		void await_resume() const noexcept;
+
+	private:
+		// Private member(s)
+		Time                mDuration; //!< The duration during which the task is suspended
+		TimerWheel::TimerId mTimer;    //!< The identifier of the timer resuming the task
+	};
+
+	/*!
+	 \brief Suspends the calling task during the \a duration provided.
+	 \details The task is resumed by the ae::TaskScheduler during the fixed step in which the duration elapses.
+	 A suspended task doesn't cost anything per frame, the timer being stored in the ae::TimerWheel.
+
+	 \param[in] duration The ae::Time during which the task is suspended (a zero duration suspends it until the next fixed step)
+
+	 \return The awaitable suspending the task
+
+	 \par Example:
+	 \code
+	 ae::Task IntroState::playIntro()
+	 {
+		mLogo->activateFunctionality(ae::Actor2D::Func::Render, ae::Actor2D::Target::Self, true);
+		co_await ae::wait(ae::Time::seconds(2.0));
+		mTitle->activateFunctionality(ae::Actor2D::Func::Render, ae::Actor2D::Target::Self, true);
+	 }
+	 \endcode
+
+	 \since v0.7.0
+	*/
+	_NODISCARD AEON_API WaitAwaiter wait(const Time& duration) noexcept;
+}
+#endif // AEON_COROUTINES
+#endif // Aeon_System_Task_H_
+
+/*!
+ \class ae::Task
+ \ingroup system
+
+ The ae::Task class owns a coroutine used to write sequenced logic (cutscenes,
+ transitions, loading flows) as a single function instead of a state machine
+ polled during each update. The coroutine may await a duration with
+ ae::wait(), the textures loaded in the background with
+ ae::TextureLoader::loadAsync(), the next event of a type with
+ ae::EventBus::nextEvent() and other tasks, and it's suspended meanwhile,
+ costing nothing per frame.
+
+ The tasks are resumed by the ae::TaskScheduler during the application's fixed
+ steps, on the thread updating the states, so they may safely modify the
+ states and their actors. The awaited events are the exception: the task is
+ resumed during their dispatch so that it may use them.
+
+ An ae::Task is typically stored by the ae::State or the ae::Actor2D running
+ it. Destroying it cancels its coroutine along with the operations it awaits,
+ so the objects captured by the coroutine must outlive the ae::Task.
+
+ The tasks are only available if the compiler supports the C++20 coroutines
+ (see AEON_COROUTINES).
+
+ Usage example:
+ \code
+ class LoadingState : public ae::State
+ {
+ public:
+	LoadingState()
+		: ae::State()
+		, mLoading(load())
+	{
+	}
+
+ private:
+	ae::Task load()
+	{
+		// Load the textures in the background and wait for them
+		mBackgroundTexture = co_await ae::TextureLoader::getInstance().loadAsync("Textures/background.png");
+		if (mBackgroundTexture) {
+			mBackground->setTexture(*mBackgroundTexture);
+		}
+
+		// Wait for a key press before moving on
+		co_await ae::EventBus::getInstance().nextEvent(ae::Event::Type::KeyPressed);
+		co_await ae::wait(ae::Time::milliseconds(500));
+		requestStatePush(GAME_STATE_ID);
+	}
+
+	std::shared_ptr<ae::Texture2D> mBackgroundTexture;
+	ae::Sprite*                    mBackground;
+	ae::Task                       mLoading;
+ };
+ \endcode
+
+ \author Filippos Gleglakos
+ \version v0.7.0
+ \date 2021.07.05
+ \copyright MIT License
+*/
\ No newline at end of file
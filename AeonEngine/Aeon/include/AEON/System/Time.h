@@ -43,7 +43,7 @@ namespace ae
 		// Public constructor(s)
 		/*!
 		 \brief Default constructor.
-		 \details Sets the time value to 0.0.
+		 \details Sets the time value to 0.
 
 		 \since v0.3.0
 		*/
@@ -475,11 +475,28 @@ namespace ae
 		 int_fast64_t microseconds = seconds.asMicroseconds(); // 2'000'000 microseconds
 		 \endcode
 
-		 \sa asSeconds(), asMilliseconds()
+		 \sa asSeconds(), asMilliseconds(), asNanoseconds()
 
 		 \since v0.3.0
 		*/
 		_NODISCARD int_fast64_t asMicroseconds() const noexcept;
+		/*!
+		 \brief Retrieves the ae::Time's time value in nanoseconds.
+		 \details The time value is stored as an integer number of nanoseconds, so this conversion is exact.
+
+		 \return The time value in nanoseconds
+
+		 \par Example:
+		 \code
+		 ae::Time seconds = ae::Time::seconds(2.0);
+		 int64_t nanoseconds = seconds.asNanoseconds(); // 2'000'000'000 nanoseconds
+		 \endcode
+
+		 \sa asSeconds(), asMicroseconds()
+
+		 \since v0.7.0
+		*/
+		_NODISCARD int64_t asNanoseconds() const noexcept;
 		/*!
 		 \brief Retrieves the ae::Time's time value in seconds.
 
@@ -544,11 +561,28 @@ namespace ae
 		 ae::Time time = ae::Time::microseconds(2'000'000); // 2 seconds
 		 \endcode
 
-		 \sa seconds(), milliseconds()
+		 \sa seconds(), milliseconds(), nanoseconds()
 
 		 \since v0.3.0
 		*/
 		_NODISCARD static Time microseconds(int_fast64_t microseconds) noexcept;
+		/*!
+		 \brief Constructs the ae::Time by providing a time value in nanoseconds.
+
+		 \param[in] nanoseconds The time value in nanoseconds
+
+		 \return An ae::Time containing the time value provided
+
+		 \par Example:
+		 \code
+		 ae::Time time = ae::Time::nanoseconds(2'000'000'000); // 2 seconds
+		 \endcode
+
+		 \sa seconds(), microseconds()
+
+		 \since v0.7.0
+		*/
+		_NODISCARD static Time nanoseconds(int64_t nanoseconds) noexcept;
 
 		/*!
 		 \brief Retrieves a formatted string containing the current system date.
@@ -585,18 +619,18 @@ namespace ae
 	private:
 		// Private constructor(s)
 		/*!
-		 \brief Constructs the ae::Time by providing a time value in seconds.
+		 \brief Constructs the ae::Time by providing a time value in nanoseconds.
 		 \details The API user can't use this constructor, but they can use the available static methods.
 
-		 \param[in] seconds The time value in seconds
+		 \param[in] nanoseconds The time value in nanoseconds
 
-		 \since v0.4.0
+		 \since v0.7.0
 		*/
-		explicit Time(double seconds) noexcept;
+		explicit Time(int64_t nanoseconds) noexcept;
 
 	private:
 		// Private member(s)
-		double mSeconds; //!< The time value in seconds
+		int64_t mNanoseconds; //!< The time value in nanoseconds
 	};
 }
 #endif // Aeon_System_Time_H_
@@ -608,7 +642,11 @@ namespace ae
  The ae::Time class is used to encapsulate a time value in a flexible manner.
  It permits the definition of a time value in seconds, in milliseconds or in
  microseconds. This also works the other way around: the API user can read a
- time value in seconds, in microseconds and in microseconds.
+ time value in seconds, in milliseconds, in microseconds and in nanoseconds.
+
+ The time value is stored as an integer number of nanoseconds so that adding up
+ frame times doesn't lose precision over long sessions, the conversion to
+ floating-point seconds only happening when asSeconds() is called.
 
  The ae::Time objects support the standard mathematical operations, such as:
  adding and subtracting ae::Time objects, multiplying or dividing (essentially
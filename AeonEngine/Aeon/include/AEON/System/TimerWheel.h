@@ -0,0 +1,298 @@
+// MIT License
+// 
+// Copyright(c) 2019-2021 Filippos Gleglakos
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef Aeon_System_TimerWheel_H_
+#define Aeon_System_TimerWheel_H_
+
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+#include <AEON/Config.h>
+#include <AEON/System/Time.h>
+
+namespace ae
+{
+	/*!
+	 \brief Singleton class used to call functions after a delay or periodically, driven by the application's fixed time step.
+	*/
+	class AEON_API TimerWheel
+	{
+	public:
+		// Public typedef(s)
+		using Callback = std::function<void()>; //!< The function called once a timer expires
+		using TimerId = uint64_t;               //!< The identifier of a scheduled timer (0 is never assigned)
+
+	public:
+		// Public constructor(s)
+		/*!
+		 \brief Deleted copy constructor.
+
+		 \since v0.7.0
+		*/
+		TimerWheel(const TimerWheel&) = delete;
+		/*!
+		 \brief Deleted move constructor.
+
+		 \since v0.7.0
+		*/
+		TimerWheel(TimerWheel&&) = delete;
+	public:
+		// Public operator(s)
+		/*!
+		 \brief Deleted assignment operator.
+
+		 \since v0.7.0
+		*/
+		TimerWheel& operator=(const TimerWheel&) = delete;
+		/*!
+		 \brief Deleted move assignment operator.
+
+		 \since v0.7.0
+		*/
+		TimerWheel& operator=(TimerWheel&&) = delete;
+	public:
+		// Public method(s)
+		/*!
+		 \brief Schedules the \a callback to be called once the \a delay has elapsed, and then every \a period if one is provided.
+		 \details The delay and the period are rounded up to the wheel's resolution of a millisecond, so a timer never expires early.
+		 Scheduling a timer is done in constant time regardless of the number of timers scheduled.
+		 \note The callbacks are called by the thread updating the application's states, at the start of the fixed step during which they
+		 expire (before the states are updated).
+
+		 \param[in] delay The ae::Time to wait before the first call
+		 \param[in] callback The function to call
+		 \param[in] period The ae::Time between the subsequent calls, ae::Time::Zero by default for a single call
+
+		 \return The identifier of the timer, used to cancel it
+
+		 \par Example:
+		 \code
+		 // Resume an actor's updates once its cooldown is over instead of polling the time in its update
+		 actor->activateFunctionality(ae::Actor2D::Func::Update, ae::Actor2D::Target::Self, false);
+		 ae::TimerWheel::getInstance().schedule(ae::Time::seconds(2.0), [actor]() {
+			actor->activateFunctionality(ae::Actor2D::Func::Update, ae::Actor2D::Target::Self, true);
+		 });
+
+		 // Regenerate the player's health every half second
+		 mRegenTimer = ae::TimerWheel::getInstance().schedule(ae::Time::milliseconds(500), [this]() { regenerate(); }, ae::Time::milliseconds(500));
+		 \endcode
+
+		 \sa cancel()
+
+		 \since v0.7.0
+		*/
+		TimerId schedule(const Time& delay, Callback callback, const Time& period = Time::Zero);
+		/*!
+		 \brief Cancels the timer of the identifier provided so that its callback is no longer called.
+		 \details Cancelling a timer is done in constant time, and it may be done from within a callback (including the timer's own).
+		 \note The objects captured by a timer's callback should cancel it upon their destruction.
+
+		 \param[in] timer The identifier returned by schedule()
+
+		 \return True if the timer was cancelled, false if it had already expired or been cancelled
+
+		 \sa schedule()
+
+		 \since v0.7.0
+		*/
+		bool cancel(TimerId timer);
+		/*!
+		 \brief Cancels all the timers scheduled.
+
+		 \sa cancel()
+
+		 \since v0.7.0
+		*/
+		void clear();
+		/*!
+		 \brief Advances the wheel by \a dt and calls the callbacks of the timers that expired in a single batch.
+		 \details Only the slots of the wheel reached are inspected, the timers being moved to the finer slots as their expiry approaches.
+		 The periodic timers are rescheduled from their previous expiry so they don't drift, but they're called at most once per advancement.
+		 \note This method is automatically called by the ae::Application during each fixed step.
+
+		 \param[in] dt The time elapsed since the last advancement
+
+		 \since v0.7.0
+		*/
+		void advance(const Time& dt);
+		/*!
+		 \brief Checks whether the timer of the identifier provided is still scheduled.
+
+		 \param[in] timer The identifier returned by schedule()
+
+		 \return True if the timer will expire, false if it has expired or been cancelled
+
+		 \since v0.7.0
+		*/
+		_NODISCARD bool isScheduled(TimerId timer) const noexcept;
+		/*!
+		 \brief Retrieves the number of timers currently scheduled.
+
+		 \return The number of timers scheduled
+
+		 \since v0.7.0
+		*/
+		_NODISCARD size_t getTimerCount() const noexcept;
+
+		// Public static method(s)
+		/*!
+		 \brief Retrieves the single instance of the ae::TimerWheel.
+
+		 \return The single instance of the ae::TimerWheel
+
+		 \since v0.7.0
+		*/
+		_NODISCARD static TimerWheel& getInstance();
+
+	private:
+		// Private struct(s)
+		/*!
+		 \brief The struct representing a timer, linked to the other timers of its slot.
+		*/
+		struct Timer
+		{
+			Callback callback;   //!< The function called once the timer expires
+			uint64_t expiry;     //!< The tick at which the timer expires
+			uint64_t period;     //!< The number of ticks between the periodic calls (0 for a single call)
+			uint32_t previous;   //!< The index of the previous timer of the slot
+			uint32_t next;       //!< The index of the next timer of the slot, or of the next free timer
+			uint32_t generation; //!< The generation of the timer, incremented whenever it's released
+			uint16_t slot;       //!< The index of the slot storing the timer, its level being the index's upper byte
+			bool     linked;     //!< Whether the timer is stored in a slot (it's otherwise expired or released)
+			bool     active;     //!< Whether the timer is scheduled or expired but not yet called (it's otherwise released)
+		};
+
+	private:
+		// Private constructor(s)
+		/*!
+		 \brief Default constructor.
+
+		 \since v0.7.0
+		*/
+		TimerWheel();
+
+	private:
+		// Private method(s)
+		/*!
+		 \brief Stores the timer of the \a index provided in the slot that will be reached closest to its expiry.
+		 \details The level is the finest one whose span contains the timer's remaining delay, the slot being selected by the expiry's byte of that level.
+
+		 \param[in] index The index of the timer
+
+		 \sa unlink()
+
+		 \since v0.7.0
+		*/
+		void link(uint32_t index) noexcept;
+		/*!
+		 \brief Removes the timer of the \a index provided from its slot.
+
+		 \param[in] index The index of the linked timer
+
+		 \sa link()
+
+		 \since v0.7.0
+		*/
+		void unlink(uint32_t index) noexcept;
+		/*!
+		 \brief Releases the timer of the \a index provided so that it may be reused, which invalidates its identifier.
+
+		 \param[in] index The index of the timer
+
+		 \since v0.7.0
+		*/
+		void release(uint32_t index);
+		/*!
+		 \brief Advances the wheel by a single tick, moving the timers of the coarse slots reached to finer ones and collecting the expired timers.
+
+		 \since v0.7.0
+		*/
+		void tick();
+		/*!
+		 \brief Retrieves the index of the timer of the identifier provided.
+
+		 \param[in] timer The identifier returned by schedule()
+
+		 \return The index of the timer, or the invalid index if the identifier is no longer valid
+
+		 \since v0.7.0
+		*/
+		_NODISCARD uint32_t getIndex(TimerId timer) const noexcept;
+
+	private:
+		// Private static member(s)
+		static constexpr size_t   LEVEL_COUNT = 4;                           //!< The number of levels of the wheel
+		static constexpr size_t   SLOT_BITS = 8;                             //!< The number of bits of a tick selecting a level's slot
+		static constexpr size_t   SLOT_COUNT = size_t(1) << SLOT_BITS;       //!< The number of slots of each level
+		static constexpr uint32_t INVALID_INDEX = static_cast<uint32_t>(-1); //!< The index denoting the end of a list or an invalid timer
+
+		// Private member(s)
+		std::vector<Timer>    mTimers;                          //!< The timers, indexed by the lower half of their identifiers
+		std::vector<TimerId>  mExpired;                         //!< The identifiers of the timers expired during the current advancement
+		uint32_t              mSlots[LEVEL_COUNT * SLOT_COUNT]; //!< The index of the first timer of each slot, level after level
+		uint32_t              mFreeTimer;                       //!< The index of the first released timer
+		uint64_t              mCurrentTick;                     //!< The number of ticks elapsed since the wheel's creation
+		int64_t               mElapsedMicroseconds;             //!< The time elapsed since the last tick, in microseconds
+		size_t                mTimerCount;                      //!< The number of timers scheduled
+	};
+}
+#endif // Aeon_System_TimerWheel_H_
+
+/*!
+ \class ae::TimerWheel
+ \ingroup system
+
+ The ae::TimerWheel singleton class calls functions after a delay or
+ periodically. It's used in place of polling the time in the actors' updates:
+ an actor waiting for a delay may disable its updates until a timer's callback
+ enables them again.
+
+ The timers are stored in a hierarchical wheel of four levels of 256 slots
+ each, the first level's slots spanning a millisecond and each following
+ level's slots spanning the entire preceding level. A timer is placed in the
+ slot of the coarsest level whose span contains its remaining delay, and it's
+ moved to a finer level once that slot is reached. Scheduling and cancelling a
+ timer are thus done in constant time, and an advancement only inspects the
+ slots reached regardless of the number of timers scheduled. The timers that
+ expire during an advancement have their callbacks called in a single batch
+ once the wheel has been advanced.
+
+ The wheel is advanced by the ae::Application during each fixed step, before
+ the states are updated. It isn't thread-safe: the timers should be scheduled
+ and cancelled by the thread updating the states.
+
+ Usage example:
+ \code
+ ae::TimerWheel& timers = ae::TimerWheel::getInstance();
+
+ // Spawn a wave of enemies every ten seconds, starting in three seconds
+ const ae::TimerWheel::TimerId SPAWN_TIMER = timers.schedule(ae::Time::seconds(3.0), [this]() { spawnWave(); }, ae::Time::seconds(10.0));
+ ...
+ timers.cancel(SPAWN_TIMER);
+ \endcode
+
+ \author Filippos Gleglakos
+ \version v0.7.0
+ \date 2021.07.05
+ \copyright MIT License
+*/
\ No newline at end of file
@@ -30,8 +30,10 @@
 #include <AEON/Window/ContextSettings.h>
 #include <AEON/Window/Window.h>
 #include <AEON/Window/Event.h>
+#include <AEON/Window/EventBus.h>
 #include <AEON/Window/Keyboard.h>
 #include <AEON/Window/Application.h>
+#include <AEON/Window/InputRecorder.h>
 #include <AEON/Window/Mouse.h>
 #include <AEON/Window/State.h>
 
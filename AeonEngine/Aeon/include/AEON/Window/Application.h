@@ -24,20 +24,31 @@
 #define Aeon_Window_Application_H_
 
 #include <yvals_core.h>
+#include <atomic>
+#include <thread>
+#include <vector>
 
 #include <AEON/Config.h>
 #include <AEON/System/Time.h>
+#include <AEON/System/FrameStatistics.h>
 #include <AEON/Window/Window.h>
+#include <AEON/Window/InputRecorder.h>
 #include <AEON/Window/internal/StateStack.h>
+#include <AEON/Graphics/RenderCommandList.h>
 
 namespace ae
 {
 	// Forward declaration(s)
+	class Clock;
 	class EventQueue;
 
 	/*!
 	 \brief The singleton class used to manage the entire application.
 	 \details The single instance of this class may be retrieved by calling the static method 'getInstance()'.
+
+ Besides the frames per second, the game loop records the duration of every
+ frame and of its phases into an ae::FrameStatistics (see getFrameStatistics())
+ so that the stutter may be measured.
 	*/
 	class AEON_API Application
 	{
@@ -79,6 +90,9 @@ namespace ae
 		// Public method(s)
 		/*!
 		 \brief Creates the ae::Window that will be the ae::Application's active window.
+		 \details The duration of each startup phase (the initialization of GLFW and of the font library, the window's creation, GLEW's initialization and the creation of the built-in resources) is
+		 reported to the ae::Profiler and logged once the window has been created (ignored in Release mode). The font library is initialized by a worker thread during the window's creation.
+		 The ae::Window::Style::Headless flag creates a hidden window whose scenes are rendered offscreen, which is used to run the benchmarks and the input replays without showing a window.
 
 		 \param[in] vidMode The ae::VideoMode containing the properties of the video mode to use
 		 \param[in] title The string indicating the name of the window
@@ -89,12 +103,41 @@ namespace ae
 		 \code
 		 ae::Application& app = ae::Application::getInstance();
 		 app.createWindow(ae::VideoMode(1280, 720), "My Application");
+
+		 // Replay a recorded session offscreen on a CI runner
+		 app.createWindow(ae::VideoMode(1920, 1080), "Benchmark", ae::Window::Style::Headless);
+		 app.getInputRecorder().startReplay("benchmark.aeinput");
 		 \endcode
 
 		 \since v0.3.0
 		*/
 		void createWindow(const VideoMode& vidMode, const std::string& title, uint32_t style = Window::Style::Default,
 		                  const ContextSettings& settings = ContextSettings());
+		/*!
+		 \brief Creates a secondary ae::Window sharing the OpenGL context of the ae::Application's active window.
+		 \details The secondary window's scenes are rendered by the primary context like the active window's, which is why the ae::GLResourceFactory's resources, the renderers and the textures are usable in every window.
+		 Each secondary window is then presented through its own context at the end of the frame, once the primary context's commands have been submitted.
+		 The events generated by a window can be told apart with ae::Event::window, and the secondary window is destroyed at the end of the frame during which it was closed.
+		 \note The active window must have been created beforehand.
+
+		 \param[in] vidMode The ae::VideoMode containing the properties of the video mode to use
+		 \param[in] title The string indicating the name of the window
+		 \param[in] style The optional ae::Window::Style flags that will define the window's appearance, resizable and decorated by default
+
+		 \return A pointer to the secondary ae::Window, valid until it's closed, or nullptr if there's no active window
+
+		 \par Example:
+		 \code
+		 ae::Application& app = ae::Application::getInstance();
+		 app.createWindow(ae::VideoMode(1280, 720), "My Editor");
+		 ae::Window* const inspector = app.createSecondaryWindow(ae::VideoMode(400, 720), "Inspector");
+		 \endcode
+
+		 \sa createWindow(), ae::Window::isSecondary()
+
+		 \since v0.7.0
+		*/
+		Window* createSecondaryWindow(const VideoMode& vidMode, const std::string& title, uint32_t style = Window::Style::Default);
 		/*!
 		 \brief Pushes in (activates) a previously registered state that had been associated with the \a stateID provided.
 		 \note A state must only be pushed in if it has previously been registered.
@@ -189,6 +232,132 @@ namespace ae
 		 \since v0.3.0
 		*/
 		void setFixedTimeStep(int timeStep);
+		/*!
+		 \brief Sets whether the fixed timestep follows the refresh rate of the monitor displaying the active window.
+		 \details Each rendered frame then displays exactly one logic update when the vertical synchronization is activated, instead of alternating between a varying number of updates
+		 (a 60 Hz timestep displayed on a 144 Hz monitor for example), which judders.
+		 The timestep is updated whenever the window moves to another monitor or a monitor is (dis)connected.
+		 \note The timestep doesn't follow the monitor's refresh rate by default, the timesteps set with setFixedTimeStep() are overwritten while it does.
+
+		 \param[in] flag True to drive the fixed timestep from the monitor's refresh rate, false to keep the current timestep
+
+		 \par Example:
+		 \code
+		 ae::Application& app = ae::Application::getInstance();
+		 app.createWindow(ae::VideoMode(1280, 720), "My Application");
+		 app.getWindow().enableVerticalSync(true, true);
+		 app.setRefreshRateTimeStep(true);
+		 \endcode
+
+		 \sa setFixedTimeStep(), ae::Window::getDisplayRefreshRate()
+
+		 \since v0.7.0
+		*/
+		void setRefreshRateTimeStep(bool flag);
+		/*!
+		 \brief Sets the maximum number of fixed-step updates that may be run in a single frame to catch up with the time elapsed.
+		 \details If an update takes longer than the fixed time-step, the time accumulated grows each frame and more updates are needed to catch up with it,
+		 which in turn take even longer. Once the maximum is reached, the time that couldn't be caught up with is dropped so that the simulation slows down
+		 instead of freezing the application.
+		 \note The default maximum is 5 updates per frame.
+
+		 \param[in] stepCount The maximum number of updates per frame, must be at least 1
+
+		 \sa setMaxFrameTime()
+
+		 \since v0.7.0
+		*/
+		void setMaxCatchUpSteps(int stepCount) noexcept;
+		/*!
+		 \brief Sets the maximum frame duration accumulated for the fixed-step updates.
+		 \details The frames taking longer (breakpoints, window dragging, loading hitches, etc.) are considered to have lasted this duration.
+		 \note The default maximum is 0.25 seconds.
+
+		 \param[in] frameTime The maximum ae::Time accumulated per frame
+
+		 \sa setMaxCatchUpSteps()
+
+		 \since v0.7.0
+		*/
+		void setMaxFrameTime(const Time& frameTime) noexcept;
+		/*!
+		 \brief Limits the number of frames rendered per second by waiting at the end of each frame.
+		 \details The application sleeps for most of the remaining frame duration and then yields until the frame's deadline so that the CPU isn't kept busy
+		 while the framerate remains precise. The limit is ignored while the window's vertical synchronization is activated as the buffer swaps already pace the frames.
+		 \note The framerate isn't limited by default.
+
+		 \param[in] frameRate The maximum frames per second, 0 to disable the limit
+
+		 \par Example:
+		 \code
+		 ae::Application& app = ae::Application::getInstance();
+		 app.createWindow(ae::VideoMode(1280, 720), "My Application");
+		 app.setFrameRateLimit(144);
+		 \endcode
+
+		 \sa ae::Window::enableVerticalSync()
+
+		 \since v0.7.0
+		*/
+		void setFrameRateLimit(int frameRate) noexcept;
+		/*!
+		 \brief Sets whether the game loop pipelines the logic updates with the rendering.
+		 \details In the pipelined mode, the states' rendering is recorded into a snapshot of the frame which is then executed on the OpenGL context's thread
+		 while the fixed-step updates run on a game thread. The frame displayed is therefore the one preceding the updates, which adds a frame of latency.
+		 \note The states' update() methods mustn't issue any OpenGL calls when the game loop is pipelined (this includes the creation or the modification of
+		 OpenGL resources such as textures, fonts and pushed states loading resources), and the states' draw() methods must render through the renderers.
+
+		 \param[in] flag True to pipeline the updates with the rendering, false to run them serially
+
+		 \par Example:
+		 \code
+		 ae::Application& app = ae::Application::getInstance();
+		 app.createWindow(ae::VideoMode(1280, 720), "My Application");
+		 app.setPipelined(true);
+		 \endcode
+
+		 \sa isPipelined(), run()
+
+		 \since v0.7.0
+		*/
+		void setPipelined(bool flag) noexcept;
+		/*!
+		 \brief Sets whether the frames are only rendered on demand, the game loop then waits for events while nothing changes.
+		 \details A frame is rendered whenever events were received, a redraw was requested with requestRedraw() or a state reports that it's animating (see ae::State::isAnimating()).
+		 Otherwise, the game loop blocks until an event is received, a redraw is requested or the \a timeout elapses, so idle tool windows barely use the CPU and GPU.
+		 The time spent waiting isn't passed on to the states' updates.
+		 \note The frames are rendered continuously by default.
+
+		 \param[in] flag True to render the frames on demand, false to render them continuously
+		 \param[in] timeout The maximum duration to wait before rendering a frame anyway (blinking carets, etc.), half a second by default
+
+		 \par Example:
+		 \code
+		 ae::Application& app = ae::Application::getInstance();
+		 app.createWindow(ae::VideoMode(1280, 720), "My Editor");
+		 app.setOnDemandRendering(true);
+		 \endcode
+
+		 \sa isOnDemandRendering(), requestRedraw()
+
+		 \since v0.7.0
+		*/
+		void setOnDemandRendering(bool flag, const Time& timeout = Time::seconds(0.5)) noexcept;
+		/*!
+		 \brief Requests a frame to be rendered when the frames are rendered on demand, waking the game loop up if it's waiting.
+		 \note This method may be called from any thread.
+
+		 \par Example:
+		 \code
+		 // Once a worker thread has finished generating the preview
+		 ae::Application::getInstance().requestRedraw();
+		 \endcode
+
+		 \sa setOnDemandRendering()
+
+		 \since v0.7.0
+		*/
+		void requestRedraw() noexcept;
 		/*!
 		 \brief Retrieves the current frames per second (FPS).
 
@@ -197,6 +366,44 @@ namespace ae
 		 \since v0.3.0
 		*/
 		_NODISCARD int getFPS() const noexcept;
+		/*!
+		 \brief Retrieves the rolling history of the frames' timings.
+		 \details Every frame's duration is recorded along with the time spent processing its events, updating and rendering, from
+		 which the percentiles, the 1% low and the hitches are retrieved.
+
+		 \return The ae::FrameStatistics filled in by the game loop
+
+		 \par Example:
+		 \code
+		 ae::FrameStatistics& statistics = ae::Application::getInstance().getFrameStatistics();
+		 AEON_LOG_INFO("Frame statistics", statistics.toString());
+		 \endcode
+
+		 \sa getFPS()
+
+		 \since v0.7.0
+		*/
+		_NODISCARD FrameStatistics& getFrameStatistics() noexcept;
+		/*!
+		 \brief Checks whether the game loop pipelines the logic updates with the rendering.
+
+		 \return True if the game loop is pipelined, false otherwise
+
+		 \sa setPipelined()
+
+		 \since v0.7.0
+		*/
+		_NODISCARD bool isPipelined() const noexcept;
+		/*!
+		 \brief Checks whether the frames are only rendered on demand.
+
+		 \return True if the game loop waits for events while nothing changes, false if the frames are rendered continuously
+
+		 \sa setOnDemandRendering()
+
+		 \since v0.7.0
+		*/
+		_NODISCARD bool isOnDemandRendering() const noexcept;
 		/*!
 		 \brief Retrieves the ae::Application's active window.
 
@@ -209,6 +416,22 @@ namespace ae
 		 \endcode
 		*/
 		_NODISCARD Window& getWindow() noexcept;
+		/*!
+		 \brief Retrieves the recorder of the input events processed by the game loop, also used to replay the sessions recorded.
+		 \details A replayed session runs the recorded fixed steps of each frame with the recorded input, so the frame timings of different runs and builds are comparable.
+
+		 \return The ae::InputRecorder used by the game loop
+
+		 \par Example:
+		 \code
+		 ae::Application& app = ae::Application::getInstance();
+		 app.getInputRecorder().startReplay("benchmark.aeinput");
+		 app.run();
+		 \endcode
+
+		 \since v0.7.0
+		*/
+		_NODISCARD InputRecorder& getInputRecorder() noexcept;
 
 		// Public static method(s)
 		/*!
@@ -237,17 +460,31 @@ namespace ae
 	private:
 		// Private method(s)
 		/*!
-		 \brief Initializes the GLFW library.
+		 \brief Initializes the GLFW library and starts the font library's initialization on a worker thread.
 
 		 \since v0.3.0
 		*/
-		void init() const;
+		void init();
 		/*!
 		 \brief Processes the events generated and distributes them to the API user's states.
 
+		 \return True if at least one event was processed, false otherwise
+
 		 \since v0.3.0
 		*/
-		void processEvents();
+		bool processEvents();
+		/*!
+		 \brief Checks whether the next frame may wait for events instead of being rendered right away.
+
+		 \param[in] eventsProcessed Whether events were processed during the current frame
+
+		 \return True if the frames are rendered on demand and nothing requires a new frame, false otherwise
+
+		 \sa setOnDemandRendering()
+
+		 \since v0.7.0
+		*/
+		_NODISCARD bool canIdle(bool eventsProcessed);
 		/*!
 		 \brief Sends the command to the API user's states to update their elements.
 
@@ -259,19 +496,104 @@ namespace ae
 		/*!
 		 \brief Sends the command to the API user's states to render their elements and the application prepares for the next frame.
 
+		 \param[in] interpolation The fraction of the fixed time-step elapsed since the last update, between 0 and 1
+
 		 \since v0.3.0
 		*/
-		void render();
+		void render(float interpolation);
+		/*!
+		 \brief Records the states' rendering into the frame's snapshot, and executes it while the fixed-step updates run on a game thread.
 
-	private:
-		std::unique_ptr<Window>     mWindow;      //!< The application's active window
-		StateStack&                 mStateStack;  //!< The manager of the application's user-created states
+		 \param[in] stepCount The number of fixed-step updates run by the frame
+		 \param[in] timeStep The duration of the fixed time-step
+		 \param[in] interpolation The fraction of the fixed time-step elapsed since the updates displayed by the frame, between 0 and 1
+
+		 \sa setPipelined()
+
+		 \since v0.7.0
+		*/
+		void runPipelinedFrame(int stepCount, const Time& timeStep, float interpolation);
+		/*!
+		 \brief Computes the fraction of the fixed time-step represented by the time accumulated since the last update.
+
+		 \param[in] timeSinceLastUpdate The ae::Time accumulated since the last update
+
+		 \return The interpolation factor between 0 and 1
+
+		 \since v0.7.0
+		*/
+		_NODISCARD float getInterpolation(const Time& timeSinceLastUpdate) const noexcept;
+		/*!
+		 \brief Consumes the fixed time-steps accumulated since the last update, dropping the time that exceeds the maximum number of catch-up steps.
+
+		 \param[in,out] timeSinceLastUpdate The ae::Time accumulated since the last update, the time-steps consumed are subtracted from it
+
+		 \return The number of fixed-step updates to run
+
+		 \sa setMaxCatchUpSteps()
 
-		std::unique_ptr<Event>      mPolledEvent; //!< The event that represents the event that's currently being handled
-		EventQueue&                 mEventQueue;  //!< The queue holding all the unhandled input events
+		 \since v0.7.0
+		*/
+		_NODISCARD int consumeTimeSteps(Time& timeSinceLastUpdate) const;
+		/*!
+		 \brief Waits until the frame's duration reaches the one imposed by the frame rate limit.
+
+		 \param[in] clock The ae::Clock restarted at the beginning of the frame
+
+		 \sa setFrameRateLimit()
+
+		 \since v0.7.0
+		*/
+		void limitFrameRate(const Clock& clock) const;
+		/*!
+		 \brief Renders the ae::GPUProfiler's overlay, finishes the frame's GPU timings and displays the frame.
+
+		 \since v0.7.0
+		*/
+		void present();
+		/*!
+		 \brief Presents the secondary windows through their own contexts once the primary context's commands have been submitted.
+
+		 \sa createSecondaryWindow()
+
+		 \since v0.7.0
+		*/
+		void presentSecondaryWindows();
+		/*!
+		 \brief Sets the fixed timestep to the refresh rate of the monitor displaying the active window.
 
-		int                         mCurrentFPS;  //!< The last recorded frames per second
-		Time                        mTimeStep;    //!< The fixed duration between frames
+		 \sa setRefreshRateTimeStep()
+
+		 \since v0.7.0
+		*/
+		void applyRefreshRateTimeStep();
+
+	private:
+		std::unique_ptr<Window>              mWindow;           //!< The application's active window
+		std::vector<std::unique_ptr<Window>> mSecondaryWindows; //!< The windows sharing the active window's context
+		StateStack&                          mStateStack;       //!< The manager of the application's user-created states
+
+		Event*                               mPolledEvent;      //!< The event that's currently being handled, owned by the event queue
+		EventQueue&                          mEventQueue;       //!< The queue holding all the unhandled input events
+
+		int                                  mCurrentFPS;       //!< The last recorded frames per second
+		FrameStatistics                      mFrameStatistics;  //!< The rolling history of the frames' timings
+		FrameStatistics::Sample              mFrameSample;      //!< The timings of the current frame
+		InputRecorder                        mInputRecorder;    //!< The recorder and player of the input sessions
+		Time                                 mTimeStep;         //!< The fixed duration between frames
+		Time                                 mMaxFrameTime;     //!< The maximum frame duration accumulated for the updates
+		Time                                 mFrameTimeLimit;   //!< The minimum frame duration imposed by the frame rate limit, zero if unlimited
+		int                                  mMaxCatchUpSteps;  //!< The maximum number of updates run per frame
+		bool                                 mRefreshRateStep;  //!< Whether the fixed timestep follows the monitor's refresh rate
+
+		RenderCommandList                    mFrameSnapshot;    //!< The recorded rendering of the frame in the pipelined mode
+		bool                                 mPipelined;        //!< Whether the logic updates are pipelined with the rendering
+		bool                                 mOnDemand;         //!< Whether the frames are only rendered on demand
+		Time                                 mIdleTimeout;      //!< The maximum duration waited for events when the frames are rendered on demand
+		std::atomic<bool>                    mRedrawRequested;  //!< Whether a frame was requested to be rendered
+
+		std::thread                          mStartupThread;    //!< The worker thread initializing the font library during the window's creation
+		Time                                 mInitTime;         //!< The duration of GLFW's initialization
 	};
 }
 #endif // Aeon_Window_Application_H_
@@ -23,6 +23,8 @@
 #ifndef Aeon_Window_ContextSettings_H_
 #define Aeon_Window_ContextSettings_H_
 
+#include <cstdint>
+
 #include <yvals_core.h>
 
 #include <AEON/Config.h>
@@ -34,6 +36,17 @@ namespace ae
 	*/
 	class _NODISCARD AEON_API ContextSettings
 	{
+	public:
+		// Public enum(s)
+		/*!
+		 \brief The enumeration of the profiles determining how much checking the OpenGL context performs.
+		*/
+		enum class Profile : uint8_t
+		{
+			Default,           //!< The errors are reported through the debug output (and a debug context is created in Debug mode)
+			ReleasePerformance //!< The context is created with KHR_no_error in Release mode, the driver skipping the validation of every call
+		};
+
 	public:
 		// Public constructor(s)
 		/*!
@@ -266,15 +279,85 @@ namespace ae
 		 \since v0.3.0
 		*/
 		_NODISCARD bool isSrgbEnabled() const noexcept;
+		/*!
+		 \brief Sets whether the OpenGL errors and warnings are reported to the ae::DebugLogger through the debug output (KHR_debug).
+		 \details The driver reports the errors asynchronously through a callback, which stays cheap enough to be kept in Release mode.
+		 Disabling it in Release mode creates the context with KHR_no_error, the driver no longer checking for errors at all.
+		 \note The debug output is enabled by default.
+
+		 \param[in] flag True to report the OpenGL errors, false to disable the debug output in Release mode
+
+		 \sa isDebugOutputEnabled(), setProfile(), ae::gl::enableDebugOutput()
+
+		 \since v0.7.0
+		*/
+		void setDebugOutputEnabled(bool flag) noexcept;
+		/*!
+		 \brief Checks whether the OpenGL errors and warnings are reported through the debug output.
+
+		 \return True if the debug output is enabled, false otherwise
+
+		 \sa setDebugOutputEnabled()
+
+		 \since v0.7.0
+		*/
+		_NODISCARD bool isDebugOutputEnabled() const noexcept;
+		/*!
+		 \brief Sets the profile determining how much checking the OpenGL context performs.
+		 \details The ae::ContextSettings::Profile::ReleasePerformance profile creates the context with KHR_no_error in Release mode: the
+		 driver no longer validates the calls, which lowers the CPU overhead of every call made by the renderers. The debug output is
+		 then left disabled and the ae::gl::checkError() checks compiled in with AEON_GL_CHECK_ERRORS are skipped, as the errors
+		 are undefined in such a context. The validation of the shader programs upon their link is only ever performed in Debug mode.
+		 \note The profile has no effect in Debug mode, where the debug context is kept so that the errors are still reported. So the
+		 profile is meant to be set unconditionally by the shipped application.
+
+		 \param[in] profile The ae::ContextSettings::Profile of the context, ae::ContextSettings::Profile::Default by default
+
+		 \par Example:
+		 \code
+		 // The Debug builds are checked, the Release builds skip the driver's validation
+		 ae::ContextSettings settings;
+		 settings.setProfile(ae::ContextSettings::Profile::ReleasePerformance);
+		 app.createWindow(ae::VideoMode(1280, 720), "My Application", ae::Window::Style::Default, settings);
+		 \endcode
+
+		 \sa getProfile(), isNoErrorEnabled()
+
+		 \since v0.7.0
+		*/
+		void setProfile(Profile profile) noexcept;
+		/*!
+		 \brief Retrieves the profile determining how much checking the OpenGL context performs.
+
+		 \return The ae::ContextSettings::Profile of the context
+
+		 \sa setProfile()
+
+		 \since v0.7.0
+		*/
+		_NODISCARD Profile getProfile() const noexcept;
+		/*!
+		 \brief Checks whether the context is created with KHR_no_error.
+		 \details That's the case in Release mode if the ae::ContextSettings::Profile::ReleasePerformance profile is set or if the debug output is disabled.
+
+		 \return True if the driver doesn't validate the calls, false otherwise
+
+		 \sa setProfile(), setDebugOutputEnabled()
+
+		 \since v0.7.0
+		*/
+		_NODISCARD bool isNoErrorEnabled() const noexcept;
 
 	private:
 		// Private member(s)
-		int  mAntialiasingLevel; //!< The anti-aliasing samples to use
-		int  mMajorVersion;      //!< The major number of the context version
-		int  mMinorVersion;      //!< The minor version of the context version
-		int  mDepthBits;         //!< The number of bits of the depth buffer
-		int  mStencilBits;       //!< The number of bits of the stencil buffer
-		bool mSrgbCapable;       //!< If the the framebuffer is sRGB-compatible
+		int     mAntialiasingLevel; //!< The anti-aliasing samples to use
+		int     mMajorVersion;      //!< The major number of the context version
+		int     mMinorVersion;      //!< The minor version of the context version
+		int     mDepthBits;         //!< The number of bits of the depth buffer
+		int     mStencilBits;       //!< The number of bits of the stencil buffer
+		bool    mSrgbCapable;       //!< If the the framebuffer is sRGB-compatible
+		bool    mDebugOutput;       //!< Whether the OpenGL errors are reported through the debug output
+		Profile mProfile;           //!< The profile determining how much checking the context performs
 	};
 }
 #endif // Aeon_Window_ContextSettings_H_
@@ -24,8 +24,8 @@
 #define Aeon_Window_Event_H_
 
 #include <yvals_core.h>
+#include <string_view>
 #include <type_traits>
-#include <vector>
 
 #include <AEON/Config.h>
 #include <AEON/Math/Vector.h>
@@ -37,7 +37,7 @@
 namespace ae
 {
 	// Forward declaration(s)
-	class Font;
+	class Window;
 
 	/*!
 	 \brief The base class representing a system event and its properties.
@@ -78,15 +78,24 @@ namespace ae
 			MouseWheelScrolled,        //!< A mouse wheel was scrolled (data in MouseWheelEvent)
 
 			JoystickConnected,         //!< A joystick/controller was connected (data in JoystickEvent)
-			JoystickDisconnected,      //!< A joystick/controller was disconnected (data in JoystickEvent)
-
-			FontUpdated                //!< A font's texture atlas was updated (data in FontEvent)
+			JoystickDisconnected       //!< A joystick/controller was disconnected (data in JoystickEvent)
+		};
+		/*!
+		 \brief The enumeration of the phases of an event's propagation through the ae::Actor2D trees.
+		*/
+		enum class Phase {
+			None,    //!< The event isn't being propagated through an actor tree
+			Capture, //!< The event is descending the tree, the ancestors receive it before their descendants
+			Target,  //!< The event is received by an actor without descending further (a leaf, a routed widget or a subscribed actor)
+			Bubble   //!< The event is ascending the tree, the ancestors receive it after their descendants
 		};
 
 	public:
 		// Public member(s)
 		const Type type;    //!< The type of the event generated
 		bool       handled; //!< Whether the event has already been handled by another element
+		Window*    window;  //!< The window that generated the event, nullptr if it isn't tied to a window (monitors, posted events, etc.)
+		Phase      phase;   //!< The current phase of the event's propagation through an actor tree
 
 	public:
 		// Public constructor(s)
@@ -134,6 +143,38 @@ namespace ae
 		Event& operator=(Event&&) = delete;
 	public:
 		// Public method(s)
+		/*!
+		 \brief Stops the event's propagation, the event is also marked as handled.
+		 \details The remaining actors of the tree being traversed, the remaining widgets of the ae::WidgetIndex, the remaining listeners of the ae::EventBus and the lower states are skipped.
+		 \note The event is still sent to the window that generated it.
+
+		 \par Example:
+		 \code
+		 // A click consumed by the HUD doesn't reach the world's actors
+		 void Minimap::handleEventSelf(ae::Event* const event)
+		 {
+			if (event->type == ae::Event::Type::MouseButtonPressed && isHoveredOver(ae::Mouse::getPosition())) {
+				...
+				event->stopPropagation();
+			}
+		 }
+		 \endcode
+
+		 \sa isPropagationStopped()
+
+		 \since v0.7.0
+		*/
+		void stopPropagation() noexcept;
+		/*!
+		 \brief Checks whether the event's propagation was stopped.
+
+		 \return True if stopPropagation() was called, false otherwise
+
+		 \sa stopPropagation()
+
+		 \since v0.7.0
+		*/
+		_NODISCARD bool isPropagationStopped() const noexcept;
 		/*!
 		 \brief Retrieves the converted pointer to the derived class of the ae::Event.
 		 \details If the ae::Event's base pointer isn't convertible to the class provided, nullptr will be returned.
@@ -169,6 +210,10 @@ namespace ae
 
 			return Tptr;
 		}
+
+	private:
+		// Private member(s)
+		bool mPropagationStopped; //!< Whether the event's propagation was stopped
 	};
 
 	/*!
@@ -426,24 +471,49 @@ namespace ae
 	 \brief The derived class representing a filepath drop and its properties.
 	 \details An ae::PathDropEvent's associated types are: Type::PathDrop.\n
 	 This class inherits the ae::Event base class.
+	 \note The paths aren't owned by the event, the ones generated by the window are stored in the ae::EventQueue's payload arena and remain valid
+	 until the queue has been emptied.
 	*/
 	class _NODISCARD AEON_API PathDropEvent : public Event
 	{
 	public:
 		// Public member(s)
-		std::vector<std::string> paths;
+		const std::string_view* const paths; //!< The null-terminated filepaths dropped
+		const size_t                  count; //!< The number of filepaths dropped
 
 	public:
 		// Public constructor(s)
 		/*!
-		 \brief Constructs the ae::PathDropEvent by providing the number of paths and the \a paths themselves.
+		 \brief Constructs the ae::PathDropEvent by providing the \a paths and their number.
+		 \details The paths aren't copied, they must outlive the event.
 
+		 \param[in] paths The views of the paths dropped
 		 \param[in] count The number of paths dropped
-		 \param[in] paths The C-style strings of the paths dropped
 
-		 \since v0.6.0
+		 \since v0.7.0
 		*/
-		PathDropEvent(int count, const char** paths) noexcept;
+		PathDropEvent(const std::string_view* paths, size_t count) noexcept;
+		/*!
+		 \brief Retrieves the first of the filepaths dropped.
+		 \details Along with end(), the filepaths may be iterated over with a range-based for loop.
+
+		 \return A pointer to the first filepath's view
+
+		 \sa end()
+
+		 \since v0.7.0
+		*/
+		_NODISCARD const std::string_view* begin() const noexcept;
+		/*!
+		 \brief Retrieves the end of the filepaths dropped.
+
+		 \return A pointer past the last filepath's view
+
+		 \sa begin()
+
+		 \since v0.7.0
+		*/
+		_NODISCARD const std::string_view* end() const noexcept;
 		/*!
 		 \brief Deleted copy constructor.
 
@@ -735,55 +805,6 @@ namespace ae
 		*/
 		MouseWheelEvent& operator=(MouseWheelEvent&&) = delete;
 	};
-
-	/*!
-	 \brief The derived class representing a font update event and the associated font's properties.
-	 \details An ae::FontEvent's associated types are: Type::FontUpdated.\n
-	 This class inherits the ae::Event base class.
-	*/
-	class _NODISCARD AEON_API FontEvent : public Event
-	{
-	public:
-		// Public member(s)
-		const Font* const font; //!< The pointer to the affected font
-
-	public:
-		// Public constructor(s)
-		/*!
-		 \brief Constructs the ae::FontEvent by providing the affected font.
-
-		 \param[in] font A pointer to the affected ae::Font
-
-		 \since v0.5.0
-		*/
-		FontEvent(const Font* const font) noexcept;
-		/*!
-		 \brief Deleted copy constructor.
-
-		 \since v0.5.0
-		*/
-		FontEvent(const FontEvent&) = delete;
-		/*!
-		 \brief Deleted move constructor.
-
-		 \since v0.5.0
-		*/
-		FontEvent(FontEvent&&) = delete;
-	public:
-		// Public operator(s)
-		/*!
-		 \brief Deleted assignment operator.
-
-		 \since v0.5.0
-		*/
-		FontEvent& operator=(const FontEvent&) = delete;
-		/*!
-		 \brief Deleted move assignment operator.
-
-		 \since v0.5.0
-		*/
-		FontEvent& operator=(FontEvent&&) = delete;
-	};
 }
 #endif // Aeon_Window_Event_H_
 
@@ -804,6 +825,12 @@ namespace ae
  retrieved. The conversion can be done manually using a dynamic_cast or using
  the as() template function.
 
+ The handled flag is advisory, whereas stopPropagation() ends the event's
+ propagation: an ae::Actor2D tree is traversed in the capture phase on the way
+ down (see ae::Actor2D::captureEventSelf()) and in the bubble phase on the way
+ up (see ae::Actor2D::handleEventSelf()), and the traversal is short-circuited
+ as soon as the propagation is stopped.
+
  Usage example:
  \code
  ae::Event::Type type = event->type;
@@ -971,15 +998,17 @@ namespace ae
  \ingroup window
 
  The ae::PathDropEvent is used to represent a drop of one or multiple filepaths
- on the window. It contains the list of all the filepaths dropped in a stl
- vector.
+ on the window. It contains views of all the filepaths dropped, which are
+ stored in the event queue's arena instead of being copied into new strings.
 
  Usage example:
  \code
   // The 'event' parameter is provided by the overloaded method 'handleEvent()' of the ae::State class
  if (event->type == ae::Event::Type::PathDrop) {
 	auto pathDropEvent = event->as<ae::PathDropEvent>();
-	const std::vector<std::string>& paths = pathDropEvent->paths;
+	for (const std::string_view path : *pathDropEvent) {
+		...
+	}
  }
  \endcode
 
@@ -1135,32 +1164,4 @@ namespace ae
  \version v0.3.0
  \date 2019.07.22
  \copyright MIT License
-*/
-
-/*!
- \class ae::FontEvent
- \ingroup window
-
- The ae::FontEvent class is used to represent an API event that was generated
- concerning the update of the specified font's texture atlas. It contains a
- pointer to the affected font.
-
- This event is primarily used internally in order for all ae::Text instances to
- be informed when they should update their uv coordinates.
-
- Usage example:
- \code
- // The 'event' parameter is provided by the overloaded method 'handleEvent()' of the ae::State class
- if (event->type == ae::Event::Type::FontUpdated) {
-	auto fontEvent = event->as<ae::FontEvent>();
-	if (fontEvent->font == mFont) {
-		updateTextUVCoordinates();
-	}
- }
- \endcode
-
- \author Filippos Gleglakos
- \version v0.5.0
- \date 2020.08.07
- \copyright MIT License
 */
\ No newline at end of file
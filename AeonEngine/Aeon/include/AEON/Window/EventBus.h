@@ -0,0 +1,309 @@
+// MIT License
+// 
+// Copyright(c) 2019-2021 Filippos Gleglakos
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#ifndef Aeon_Window_EventBus_H_
+#define Aeon_Window_EventBus_H_
+
+#include <array>
+#include <vector>
+#include <functional>
+#include <unordered_map>
+
+#include <AEON/Config.h>
+#include <AEON/System/Task.h>
+#include <AEON/Window/Event.h>
+
+namespace ae
+{
+	/*!
+	 \brief The singleton class dispatching the polled events to the listeners subscribed to their specific type.
+	 \details Unlike the tree-order dispatch through the ae::State and ae::Actor2D instances, only the listeners subscribed to the event's type are visited.
+	*/
+	class AEON_API EventBus
+	{
+	public:
+		// Public typedef(s)
+		using Listener = std::function<void(Event* const)>;
+
+#if AEON_COROUTINES
+		// Public class(es)
+		/*!
+		 \brief The awaitable suspending a task until the next event of a type is dispatched, returned by nextEvent().
+		*/
+		class _NODISCARD AEON_API EventAwaiter
+		{
+		public:
+			// Public constructor(s)
+			/*!
+			 \brief Constructs the ae::EventBus::EventAwaiter by providing the \a type of the awaited event.
+
+			 \param[in] type The ae::Event::Type of the awaited event
+
+			 \since v0.7.0
+			*/
+			explicit EventAwaiter(Event::Type type) noexcept;
+			/*!
+			 \brief Deleted copy constructor.
+
+			 \since v0.7.0
+			*/
+			EventAwaiter(const EventAwaiter&) = delete;
+			/*!
+			 \brief Destructor.
+			 \details Unsubscribes the listener if the task is destroyed before the event is dispatched.
+
+			 \since v0.7.0
+			*/
+			~EventAwaiter();
+		public:
+			// Public operator(s)
+			/*!
+			 \brief Deleted assignment operator.
+
+			 \since v0.7.0
+			*/
+			EventAwaiter& operator=(const EventAwaiter&) = delete;
+		public:
+			// Public method(s)
+			/*!
+			 \brief Checks whether the task needs to be suspended, which is always the case.
+
+			 \return False
+
+			 \since v0.7.0
+			*/
+			_NODISCARD bool await_ready() const noexcept;
+			/*!
+			 \brief Subscribes the listener resuming the task once the event is dispatched.
+
+			 \param[in] caller The handle of the suspended task
+
+			 \since v0.7.0
+			*/
+			void await_suspend(Task::Handle caller);
+			/*!
+			 \brief Retrieves the event that resumed the task.
+
+			 \return The dispatched ae::Event, only valid until the task is suspended again
+
+			 \since v0.7.0
+			*/
+			_NODISCARD Event* await_resume() const noexcept;
+
+		private:
+			// Private member(s)
+			Event::Type mType;       //!< The type of the awaited event
+			Event*      mEvent;      //!< The event that resumed the task
+			size_t      mListenerID; //!< The identifier of the listener's subscription
+			bool        mSubscribed; //!< Whether the listener is subscribed
+		};
+#endif // AEON_COROUTINES
+
+	public:
+		// Public constructor(s)
+		/*!
+		 \brief Deleted copy constructor.
+
+		 \since v0.7.0
+		*/
+		EventBus(const EventBus&) = delete;
+		/*!
+		 \brief Deleted move constructor.
+
+		 \since v0.7.0
+		*/
+		EventBus(EventBus&&) = delete;
+	public:
+		// Public operator(s)
+		/*!
+		 \brief Deleted assignment operator.
+
+		 \since v0.7.0
+		*/
+		EventBus& operator=(const EventBus&) = delete;
+		/*!
+		 \brief Deleted move assignment operator.
+
+		 \since v0.7.0
+		*/
+		EventBus& operator=(EventBus&&) = delete;
+	public:
+		// Public method(s)
+		/*!
+		 \brief Subscribes the \a listener provided to the events of the \a type provided.
+		 \details The listeners are invoked in the order in which they subscribed, all of them receive the event even if it was handled by a previous one.
+		 The listeners subscribed during a dispatch only receive the subsequent events.
+		 \note The listener must be unsubscribed before the objects it references are destroyed.
+
+		 \param[in] type The ae::Event::Type of the events that the \a listener will receive
+		 \param[in] listener The function receiving the events
+
+		 \return The identifier of the subscription, used by unsubscribe()
+
+		 \par Example:
+		 \code
+		 // Within the state's constructor
+		 mResizeListener = ae::EventBus::getInstance().subscribe(ae::Event::Type::FramebufferResized, [this](ae::Event* const event) {
+			mCamera.setViewport(event->as<ae::FramebufferResizeEvent>()->size);
+		 });
+
+		 // Within the state's destructor
+		 ae::EventBus::getInstance().unsubscribe(mResizeListener);
+		 \endcode
+
+		 \sa unsubscribe()
+
+		 \since v0.7.0
+		*/
+		_NODISCARD size_t subscribe(Event::Type type, Listener listener);
+		/*!
+		 \brief Unsubscribes the listener associated with the identifier provided.
+		 \details The listener is no longer invoked, even if it's unsubscribed during a dispatch.
+
+		 \param[in] listenerID The identifier returned by subscribe()
+
+		 \sa subscribe()
+
+		 \since v0.7.0
+		*/
+		void unsubscribe(size_t listenerID);
+		/*!
+		 \brief Invokes the listeners subscribed to the \a event's type, until one of them stops the event's propagation.
+		 \note This method is automatically called by the ae::Application for each polled event, before the tree-order dispatch to the states.
+
+		 \param[in] event The polled ae::Event
+
+		 \since v0.7.0
+		*/
+		void dispatch(Event* const event);
+		/*!
+		 \brief Retrieves the number of listeners subscribed to the events of the \a type provided.
+
+		 \param[in] type The ae::Event::Type
+
+		 \return The number of listeners subscribed
+
+		 \since v0.7.0
+		*/
+		_NODISCARD size_t getListenerCount(Event::Type type) const noexcept;
+#if AEON_COROUTINES
+		/*!
+		 \brief Suspends the calling task until the next event of the \a type provided is dispatched.
+		 \details Unlike the other awaited operations, the task is resumed during the event's dispatch so that it may use the event.
+		 The ae::Event is retrieved by the co_await expression and remains valid until the task is suspended again.
+
+		 \param[in] type The ae::Event::Type of the awaited event
+
+		 \return The awaitable suspending the task
+
+		 \par Example:
+		 \code
+		 ae::Task GameOverState::run()
+		 {
+			// Wait for the player to click before returning to the menu
+			ae::Event* const event = co_await ae::EventBus::getInstance().nextEvent(ae::Event::Type::MouseButtonPressed);
+			if (event->as<ae::MouseButtonEvent>()->button == ae::Mouse::Button::Left) {
+				requestStateClear();
+			}
+		 }
+		 \endcode
+
+		 \sa subscribe()
+
+		 \since v0.7.0
+		*/
+		_NODISCARD EventAwaiter nextEvent(Event::Type type) const noexcept;
+#endif // AEON_COROUTINES
+
+		// Public static method(s)
+		/*!
+		 \brief Retrieves the single instance of the ae::EventBus.
+
+		 \return The single instance of the ae::EventBus
+
+		 \since v0.7.0
+		*/
+		_NODISCARD static EventBus& getInstance() noexcept;
+	private:
+		// Private struct(s)
+		/*!
+		 \brief The internal struct representing a subscribed listener.
+		*/
+		struct Subscriber
+		{
+			size_t   id;       //!< The identifier of the subscription
+			Listener listener; //!< The function receiving the events
+			bool     active;   //!< Whether the listener is still subscribed (it's only removed once the dispatches are over)
+		};
+
+	private:
+		// Private constructor(s)
+		/*!
+		 \brief Default constructor.
+		 \details Initializes an empty list of listeners for each event type.
+
+		 \since v0.7.0
+		*/
+		EventBus() noexcept;
+	private:
+		// Private method(s)
+		/*!
+		 \brief Removes the listeners that were unsubscribed and adds the ones that subscribed during the dispatch.
+
+		 \since v0.7.0
+		*/
+		void applyPendingChanges();
+
+	private:
+		// Private static member(s)
+		static constexpr size_t TYPE_COUNT = static_cast<size_t>(Event::Type::JoystickDisconnected) + 1;
+
+		// Private member(s)
+		std::array<std::vector<Subscriber>, TYPE_COUNT> mSubscribers; //!< The listeners subscribed to each event type
+		std::vector<std::pair<Event::Type, Subscriber>> mPending;     //!< The listeners that subscribed during a dispatch
+		std::unordered_map<size_t, Event::Type>         mTypes;       //!< The event type of each subscription
+		size_t                                          mNextID;      //!< The identifier of the next subscription
+		unsigned int                                    mDepth;       //!< The number of dispatches in progress
+		bool                                            mRemoved;     //!< Whether listeners were unsubscribed during a dispatch
+	};
+}
+#endif // Aeon_Window_EventBus_H_
+
+/*!
+ \class ae::EventBus
+ \ingroup window
+
+ The ae::EventBus singleton class dispatches the polled events to the
+ listeners that subscribed to their specific type. Most nodes of a scene
+ ignore most event types, so the notifications that only concern a few of
+ them (window movements, resizes, etc.) are better delivered through the bus
+ than through the full tree-order dispatch.
+
+ The tree-order dispatch through the ae::State and ae::Actor2D instances
+ remains available for the input that needs to be intercepted in order.
+
+ \author Filippos Gleglakos
+ \version v0.7.0
+ \date 2021.08.20
+ \copyright MIT License
+*/
\ No newline at end of file
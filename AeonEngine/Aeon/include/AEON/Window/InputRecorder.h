@@ -0,0 +1,306 @@
+// MIT License
+// 
+// Copyright(c) 2019-2021 Filippos Gleglakos
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef Aeon_Window_InputRecorder_H_
+#define Aeon_Window_InputRecorder_H_
+
+#include <yvals_core.h>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <AEON/Config.h>
+#include <AEON/System/Time.h>
+
+namespace ae
+{
+	// Forward declaration(s)
+	class Event;
+
+	/*!
+	 \brief Class used to record the input events processed by the game loop along with its fixed-step boundaries, and to replay them.
+	 \details The recorded sessions are replayed at the exact same fixed steps regardless of the time elapsed, so every run simulates the same frames.
+	*/
+	class AEON_API InputRecorder
+	{
+	public:
+		// Public constructor(s)
+		/*!
+		 \brief Default constructor.
+		 \details Neither records nor replays any input.
+
+		 \since v0.7.0
+		*/
+		InputRecorder() noexcept;
+		/*!
+		 \brief Deleted copy constructor.
+
+		 \since v0.7.0
+		*/
+		InputRecorder(const InputRecorder&) = delete;
+		/*!
+		 \brief Deleted move constructor.
+
+		 \since v0.7.0
+		*/
+		InputRecorder(InputRecorder&&) = delete;
+		/*!
+		 \brief Destructor.
+		 \details Stops the replay, the session being recorded isn't written.
+
+		 \since v0.7.0
+		*/
+		~InputRecorder();
+	public:
+		// Public operator(s)
+		/*!
+		 \brief Deleted assignment operator.
+
+		 \since v0.7.0
+		*/
+		InputRecorder& operator=(const InputRecorder&) = delete;
+		/*!
+		 \brief Deleted move assignment operator.
+
+		 \since v0.7.0
+		*/
+		InputRecorder& operator=(InputRecorder&&) = delete;
+	public:
+		// Public method(s)
+		/*!
+		 \brief Starts recording the input events processed from the next frame onwards, the file being written once the recording is stopped.
+		 \details The keyboard, text, mouse and close events of the active window are recorded with the number of fixed steps run by each frame.
+		 The recording is kept in memory so that no file operation takes place during the frames.
+
+		 \param[in] filepath The filepath of the recording written by stopRecording()
+
+		 \return True if the recording started, false if an input replay is in progress
+
+		 \par Example:
+		 \code
+		 ae::Application& app = ae::Application::getInstance();
+		 app.getInputRecorder().startRecording("benchmark.aeinput");
+		 app.run();
+		 app.getInputRecorder().stopRecording();
+		 \endcode
+
+		 \sa stopRecording(), startReplay()
+
+		 \since v0.7.0
+		*/
+		bool startRecording(const std::string& filepath);
+		/*!
+		 \brief Stops the recording and writes the recorded session to the filepath provided to startRecording().
+
+		 \return True if the recording was written, false if nothing was being recorded or if the file couldn't be written
+
+		 \sa startRecording()
+
+		 \since v0.7.0
+		*/
+		bool stopRecording();
+		/*!
+		 \brief Starts replaying the session recorded at the \a filepath provided from the next frame onwards.
+		 \details The live keyboard and mouse input is ignored during the replay, the recorded events being fed back to the ae::InputManager in their place.
+		 Each frame runs the number of fixed steps that was recorded with the recorded time-step, so the simulation is identical across runs and builds.
+		 The live input resumes once every frame has been replayed.
+		 \note The recorded session should be replayed with the same window size and states as when it was recorded.
+
+		 \param[in] filepath The filepath of the recording
+
+		 \return True if the replay started, false if the file is invalid or if an input recording is in progress
+
+		 \par Example:
+		 \code
+		 // Capture comparable frame timings across builds
+		 ae::Application& app = ae::Application::getInstance();
+		 if (app.getInputRecorder().startReplay("benchmark.aeinput")) {
+			app.run();
+			AEON_LOG_INFO("Frame statistics", app.getFrameStatistics().toString());
+		 }
+		 \endcode
+
+		 \sa stopReplay(), startRecording()
+
+		 \since v0.7.0
+		*/
+		bool startReplay(const std::string& filepath);
+		/*!
+		 \brief Stops the replay, the live input resuming from the next frame.
+
+		 \sa startReplay()
+
+		 \since v0.7.0
+		*/
+		void stopReplay() noexcept;
+		/*!
+		 \brief Records the \a event processed during the current frame if it's an input event and a recording is in progress.
+		 \note This method is automatically called by the ae::Application for every event polled.
+
+		 \param[in] event The ae::Event processed
+
+		 \since v0.7.0
+		*/
+		void recordEvent(const Event& event);
+		/*!
+		 \brief Completes the current frame's recording with the number of fixed steps it ran.
+		 \note This method is automatically called by the ae::Application once the frame's time-steps have been consumed.
+
+		 \param[in] stepCount The number of fixed-step updates run by the frame
+		 \param[in] interpolation The interpolation factor used to render the frame
+		 \param[in] timeStep The duration of the fixed time-step
+
+		 \since v0.7.0
+		*/
+		void recordFrame(int stepCount, float interpolation, const Time& timeStep);
+		/*!
+		 \brief Feeds the next recorded frame's events to the ae::InputManager if a replay is in progress.
+		 \details The replay is stopped once every frame has been replayed.
+		 \note This method is automatically called by the ae::Application at the beginning of every frame, before the input snapshot is published.
+
+		 \return True if a frame was replayed, false otherwise
+
+		 \sa getReplayedStepCount(), getReplayedInterpolation()
+
+		 \since v0.7.0
+		*/
+		bool replayFrame();
+		/*!
+		 \brief Checks whether the processed events are being recorded.
+
+		 \return True if a recording is in progress, false otherwise
+
+		 \since v0.7.0
+		*/
+		_NODISCARD bool isRecording() const noexcept;
+		/*!
+		 \brief Checks whether a recorded session is being replayed.
+
+		 \return True if a replay is in progress, false otherwise
+
+		 \since v0.7.0
+		*/
+		_NODISCARD bool isReplaying() const noexcept;
+		/*!
+		 \brief Retrieves the number of fixed steps recorded for the frame last replayed.
+
+		 \return The number of fixed-step updates to run
+
+		 \since v0.7.0
+		*/
+		_NODISCARD int getReplayedStepCount() const noexcept;
+		/*!
+		 \brief Retrieves the interpolation factor recorded for the frame last replayed.
+
+		 \return The interpolation factor between 0 and 1
+
+		 \since v0.7.0
+		*/
+		_NODISCARD float getReplayedInterpolation() const noexcept;
+		/*!
+		 \brief Retrieves the duration of the fixed time-step of the session recorded or replayed.
+
+		 \return The recorded fixed time-step, ae::Time::Zero if no frame was recorded
+
+		 \since v0.7.0
+		*/
+		_NODISCARD const Time& getTimeStep() const noexcept;
+		/*!
+		 \brief Retrieves the number of frames recorded or replayed thus far.
+
+		 \return The number of frames
+
+		 \sa getTotalFrameCount()
+
+		 \since v0.7.0
+		*/
+		_NODISCARD uint32_t getFrameCount() const noexcept;
+		/*!
+		 \brief Retrieves the number of frames of the session being replayed.
+
+		 \return The number of recorded frames, 0 if no replay is in progress
+
+		 \sa getFrameCount()
+
+		 \since v0.7.0
+		*/
+		_NODISCARD uint32_t getTotalFrameCount() const noexcept;
+
+	private:
+		// Private member(s)
+		std::vector<uint8_t> mData;                  //!< The encoded frames of the session recorded or replayed
+		std::vector<uint8_t> mFrameEvents;           //!< The encoded events of the frame being recorded
+		std::string          mFilepath;              //!< The filepath of the recording
+		size_t               mReadOffset;            //!< The offset of the next frame replayed within the encoded frames
+		Time                 mTimeStep;              //!< The fixed time-step of the session
+		uint32_t             mFrameCount;            //!< The number of frames recorded or replayed
+		uint32_t             mTotalFrameCount;       //!< The number of frames of the session replayed
+		uint16_t             mFrameEventCount;       //!< The number of events of the frame being recorded
+		int                  mReplayedSteps;         //!< The number of fixed steps of the frame last replayed
+		float                mReplayedInterpolation; //!< The interpolation factor of the frame last replayed
+		bool                 mRecording;             //!< Whether a recording is in progress
+		bool                 mReplaying;             //!< Whether a replay is in progress
+	};
+}
+#endif // Aeon_Window_InputRecorder_H_
+
+/*!
+ \class ae::InputRecorder
+ \ingroup window
+
+ The ae::InputRecorder class records the input events processed by the
+ ae::Application's game loop along with the number of fixed steps run by each
+ frame into a compact binary file, and replays them. A replayed session is
+ simulated at the exact same fixed steps regardless of the time that elapses,
+ its events being fed back to the ae::InputManager while the live keyboard and
+ mouse input is ignored, which makes the frame timings captured by the
+ ae::Profiler and the ae::GPUProfiler comparable across runs and builds.
+
+ The instance used by the game loop is retrieved with
+ ae::Application::getInputRecorder().
+
+ The keyboard, text, mouse and close events of the active window are recorded,
+ the window events (resizes, moves, focus, etc.) remaining live as they
+ reflect the actual window. The file is written in the machine's native byte
+ order.
+
+ Usage example:
+ \code
+ ae::Application& app = ae::Application::getInstance();
+ app.createWindow(ae::VideoMode(1280, 720), "Benchmark");
+ app.pushState(StateID::Game);
+
+ // Record a session, or replay it if it exists
+ ae::InputRecorder& recorder = app.getInputRecorder();
+ if (!recorder.startReplay("benchmark.aeinput")) {
+	recorder.startRecording("benchmark.aeinput");
+ }
+
+ app.run();
+ recorder.stopRecording();
+ \endcode
+
+ \author Filippos Gleglakos
+ \version v0.7.0
+ \date 2021.07.05
+ \copyright MIT License
+*/
\ No newline at end of file
@@ -23,6 +23,8 @@
 #ifndef Aeon_Window_MonitorManager_H_
 #define Aeon_Window_MonitorManager_H_
 
+#include <cstdint>
+#include <memory>
 #include <vector>
 
 #include <AEON/Config.h>
@@ -72,7 +74,8 @@ namespace ae
 		// Public method(s)
 		/*!
 		 \brief Updates the list of connected monitors.
-		 \details This method is automatically called when a monitor is connected or disconnected.
+		 \details This method is automatically called when a monitor is connected or disconnected, it's the only time the system is queried for the list of monitors.
+		 The generation is incremented once the list has been updated.
 
 		 \param[in] monitorEvent The pointer to the ae::MonitorEvent containing the monitor that was (dis)connected
 
@@ -131,6 +134,47 @@ namespace ae
 		 \since v0.3.0
 		*/
 		_NODISCARD const Monitor* const getPrimaryMonitor() const;
+		/*!
+		 \brief Retrieves the list of connected monitors, the primary monitor being the first one.
+		 \details The list is cached and only rebuilt when a monitor is connected or disconnected, so it may be iterated over each frame without querying the system.
+		 The monitors (and their video modes) aren't moved when the setup changes, a pointer to a monitor remains valid until it's disconnected.
+
+		 \return The list of pointers to the connected ae::Monitor instances
+
+		 \par Example:
+		 \code
+		 for (const ae::Monitor* const monitor : ae::MonitorManager::getInstance().getMonitors()) {
+			const std::vector<ae::VideoMode>& modes = monitor->getFullscreenModes();
+			...
+		 }
+		 \endcode
+
+		 \sa getGeneration(), getMonitor()
+
+		 \since v0.7.0
+		*/
+		_NODISCARD const std::vector<const Monitor*>& getMonitors() const noexcept;
+		/*!
+		 \brief Retrieves the generation of the list of connected monitors.
+		 \details The generation is incremented each time a monitor is connected or disconnected, the lists derived from the monitors (such as a settings menu's list of resolutions)
+		 only need to be rebuilt when the generation has changed.
+
+		 \return The current generation of the list of connected monitors
+
+		 \par Example:
+		 \code
+		 const uint64_t GENERATION = ae::MonitorManager::getInstance().getGeneration();
+		 if (mResolutionGeneration != GENERATION) {
+			mResolutionGeneration = GENERATION;
+			rebuildResolutionList();
+		 }
+		 \endcode
+
+		 \sa getMonitors()
+
+		 \since v0.7.0
+		*/
+		_NODISCARD uint64_t getGeneration() const noexcept;
 
 		// Public static method(s)
 		/*!
@@ -159,8 +203,8 @@ namespace ae
 	private:
 		// Private method(s)
 		/*!
-		 \brief Sorts the list of connected monitors and the monitors' properties.
-		 \details Called when a monitor is connected or disconnected.
+		 \brief Sorts the list of connected monitors in the system's order and updates the monitors' properties.
+		 \details Called when a monitor is connected or disconnected, the cached list of monitors is rebuilt and the generation is incremented.
 
 		 \since v0.6.0
 		*/
@@ -168,7 +212,9 @@ namespace ae
 
 	private:
 		// Private member(s)
-		std::vector<Monitor> mMonitors; //!< The list of monitors
+		std::vector<std::unique_ptr<Monitor>> mMonitors;    //!< The list of monitors, allocated individually so that their addresses remain stable
+		std::vector<const Monitor*>           mMonitorList; //!< The cached list of pointers to the monitors
+		uint64_t                              mGeneration;  //!< The number of times the list of monitors was modified
 	};
 }
 #endif // Aeon_Window_MonitorManager_H_
@@ -24,10 +24,13 @@
 #define Aeon_Window_State_H_
 
 #include <yvals_core.h>
+#include <vector>
 
 #include <AEON/Config.h>
 #include <AEON/System/Time.h>
 #include <AEON/Window/Event.h>
+#include <AEON/Window/EventBus.h>
+#include <AEON/Graphics/GUI/WidgetIndex.h>
 
 namespace ae
 {
@@ -82,6 +85,7 @@ namespace ae
 		/*!
 		 \brief Receives the polled input \a event to be handled.
 		 \details Derived classes can override this method to handle the \a event in a specific way.
+		 \note This method isn't called if the event's propagation was stopped by the state's widgets or by a higher state (see ae::Event::stopPropagation()).
 
 		 \param[in] event A pointer to the polled input ae::Event that was generated
 
@@ -90,6 +94,17 @@ namespace ae
 		 \since v0.3.0
 		*/
 		_NODISCARD virtual bool handleEvent(Event* const event);
+		/*!
+		 \brief Routes the polled mouse \a event to the GUI widgets attached to the ae::State's ae::WidgetIndex that are situated under the cursor.
+		 \note This method is called by the ae::StateStack right before handleEvent(), the API user shouldn't call it.
+
+		 \param[in] event A pointer to the polled input ae::Event that was generated
+
+		 \sa handleEvent()
+
+		 \since v0.7.0
+		*/
+		void routeEvent(Event* const event);
 		/*!
 		 \brief Updates the elements that belong to the ae::State.
 		 \details Derived classes can override this method to update the user-created game elements.
@@ -110,6 +125,102 @@ namespace ae
 		 \since v0.3.0
 		*/
 		_NODISCARD virtual bool draw();
+		/*!
+		 \brief Submits the elements that belong to the ae::State to the appropriate renderer, interpolated between the last two fixed-step updates.
+		 \details The \a interpolation factor is the fraction of the fixed time-step that has elapsed since the last update, it allows the elements to be
+		 rendered between their previous and current states (see ae::Transform2DComponent::getInterpolatedTransform()) so that the simulation may run at a
+		 low fixed rate without any visible judder.\n
+		 Derived classes can override this method instead of draw(), which is called by default.
+
+		 \param[in] interpolation The interpolation factor between 0 (previous update) and 1 (last update)
+
+		 \return True if the other ae::State instances should be allowed to submit their elements to a renderer, false otherwise
+
+		 \sa draw()
+
+		 \since v0.7.0
+		*/
+		_NODISCARD virtual bool draw(float interpolation);
+		/*!
+		 \brief Loads the CPU-side resources of the ae::State (level data, audio, decoded images, etc.).
+		 \details This method is called once after the state's construction, on a worker thread if the state was preloaded with ae::StateStack::preloadState(),
+		 or synchronously when the state is pushed otherwise. Derived classes can override it to move their lengthy loading out of their constructor.
+		 \note As the method may be executed on a worker thread, it mustn't issue any OpenGL calls (the textures should be requested from the ae::TextureLoader in the constructor instead).
+
+		 \sa ae::StateStack::preloadState()
+
+		 \since v0.7.0
+		*/
+		virtual void preload();
+		/*!
+		 \brief Called once the ae::State stops being drawn because a state before it in the ae::StateStack blocks the drawing.
+		 \details Derived classes can override this method to pause their elements. The state is still updated and still receives events while it's suspended.
+
+		 \sa onResume(), onTrimMemory()
+
+		 \since v0.7.0
+		*/
+		virtual void onSuspend();
+		/*!
+		 \brief Called right before the suspended ae::State is drawn again.
+		 \details Derived classes can override this method to restore the resources released by onTrimMemory().
+
+		 \param[in] trimmed Whether onTrimMemory() was called during the suspension
+
+		 \sa onSuspend(), onTrimMemory()
+
+		 \since v0.7.0
+		*/
+		virtual void onResume(bool trimmed);
+		/*!
+		 \brief Called right after onSuspend() if the ae::StateStack's memory trimming is enabled.
+		 \details Derived classes can override this method to release the memory they don't need while they're not drawn
+		 (render textures, the geometry baked by the ae::Actor2D nodes flagged as static, large textures, etc.), and restore it in onResume().
+		 The OpenGL resources that are no longer referenced are destroyed by the ae::StateStack afterwards.
+
+		 \par Example:
+		 \code
+		 void GameState::onTrimMemory()
+		 {
+			mMinimap.reset();
+			mLevel->setStatic(false);
+		 }
+
+		 void GameState::onResume(bool trimmed)
+		 {
+			if (trimmed) {
+				mMinimap = std::make_unique<ae::RenderTexture>();
+				mMinimap->create(256, 256);
+				mLevel->setStatic(true);
+			}
+		 }
+		 \endcode
+
+		 \sa onSuspend(), onResume(), ae::StateStack::setMemoryTrimming()
+
+		 \since v0.7.0
+		*/
+		virtual void onTrimMemory();
+		/*!
+		 \brief Checks whether the ae::State is animating and therefore requires new frames to be rendered.
+		 \details This method is only used when the ae::Application renders the frames on demand: the game loop waits for events as long as none of the states are animating.
+		 Derived classes showing animations or transitions, or whose render data is modified without any event, should return true while it's the case.
+
+		 \return True if the state requires new frames, false by default
+
+		 \par Example:
+		 \code
+		 bool PreviewState::isAnimating() const
+		 {
+			return mTransitionTime < mTransitionDuration;
+		 }
+		 \endcode
+
+		 \sa ae::Application::setOnDemandRendering()
+
+		 \since v0.7.0
+		*/
+		_NODISCARD virtual bool isAnimating() const;
 	protected:
 		// Protected constructor(s)
 		/*!
@@ -133,6 +244,18 @@ namespace ae
 		 \since v0.3.0
 		*/
 		void requestStatePush(uint32_t stateID);
+		/*!
+		 \brief Sends a request to the ae::StateStack instance to preload the state associated with the identifier provided.
+		 \details The state is constructed and its resources are loaded on a worker thread so that it may be pushed instantly later on.
+		 \note The identifier has to be associated with a previously registered ae::State.
+
+		 \param[in] stateID The identifier associated with the registered state
+
+		 \sa requestStatePush(), ae::StateStack::preloadState()
+
+		 \since v0.7.0
+		*/
+		void requestStatePreload(uint32_t stateID);
 		/*!
 		 \brief Sends a request to the ae::StateStack instance to remove (deactivate) the state associated with the identifier provided.
 		 \note The identifier has to be associated with a previously registered ae::State.
@@ -173,14 +296,36 @@ namespace ae
 		 \since v0.3.0
 		*/
 		_NODISCARD State* const requestState(uint32_t stateID);
+		/*!
+		 \brief Subscribes the \a listener provided to the events of the \a type provided through the ae::EventBus.
+		 \details The listener only receives the events of this type, without going through the tree-order dispatch. The subscription is released along with the ae::State.
+
+		 \param[in] type The ae::Event::Type of the events that the \a listener will receive
+		 \param[in] listener The function receiving the events
+
+		 \par Example:
+		 \code
+		 // Within the state's constructor
+		 subscribeEvent(ae::Event::Type::WindowFocusLost, [this](ae::Event* const event) {
+			pauseGame();
+		 });
+		 \endcode
+
+		 \sa ae::EventBus::subscribe()
+
+		 \since v0.7.0
+		*/
+		void subscribeEvent(Event::Type type, EventBus::Listener listener);
 
 	protected:
 		// Protected member(s)
 		Application& mApplication; //!< The single instance of the application
 		Window&      mWindow;      //!< The active window of the application
+		WidgetIndex  mWidgetIndex; //!< The spatial index routing the mouse events to the state's GUI widgets
 	private:
 		// Private member(s)
-		StateStack& mStack; //!< The single instance of the stack managing all the state instances
+		StateStack&         mStack;         //!< The single instance of the stack managing all the state instances
+		std::vector<size_t> mSubscriptions; //!< The identifiers of the listeners that subscribed through the ae::EventBus
 	};
 }
 #endif // Aeon_Window_State_H_
@@ -30,6 +30,7 @@
 #include <AEON/Window/ContextSettings.h>
 #include <AEON/Window/Event.h>
 #include <AEON/Graphics/Color.h>
+#include <AEON/Graphics/PostProcessChain.h>
 #include <AEON/Graphics/internal/RenderTarget.h>
 
 // Forward declaration(s)
@@ -37,6 +38,9 @@ struct GLFWwindow;
 
 namespace ae
 {
+	// Forward declaration(s)
+	class RenderTexture;
+
 	/*!
 	 \brief The class representing the application's window.
 	*/
@@ -46,12 +50,14 @@ namespace ae
 		/*!
 		 \brief The style flags defining the window's appearance.
 		 \details The flags Resizable and Decorated can be combined together.
+		 The flag Headless creates a hidden window whose scenes are rendered offscreen into its persistent back buffer at the video mode's resolution, it's never presented.
 		*/
 		enum Style {
 			Fullscreen         = 0,
 			WindowedFullscreen = 1,
 			Resizable          = 2 << 0,
 			Decorated          = 2 << 1,
+			Headless           = 2 << 2,
 
 			Default = Resizable | Decorated
 		};
@@ -66,6 +72,7 @@ namespace ae
 		 \param[in] title The string indicating the name of the window
 		 \param[in] style The optional ae::Window::Style flags that will define the window's appearance, resizable and decorated by default
 		 \param[in] settings The optional ae::ContextSettings containing the settings of the OpenGL context
+		 \param[in] sharedWindow The optional primary ae::Window whose OpenGL context is shared, the window is then a secondary window (see ae::Application::createSecondaryWindow())
 
 		 \par Example:
 		 \code
@@ -76,7 +83,7 @@ namespace ae
 		 \since v0.4.0
 		*/
 		Window(const VideoMode& vidMode, const std::string& title, uint32_t style = Style::Default,
-		       const ContextSettings& settings = ContextSettings());
+		       const ContextSettings& settings = ContextSettings(), const Window* sharedWindow = nullptr);
 		/*!
 		 \brief Deleted copy constructor.
 
@@ -144,7 +151,11 @@ namespace ae
 		/*!
 		 \brief Displays onto the screen what has been rendered to the window thus far.
 		 \details This method swaps the backbuffer with the frontbuffer currently displayed on the screen.
-		 \note This method should primarily be used internally.
+		 If the damage is tracked, the persistent back buffer is first copied onto the window's backbuffer.
+		 A headless window only submits the frame's commands and polls the events as it has nothing to present.
+		 \note This method should primarily be used internally. The secondary windows are presented by the ae::Application while their own context is current.
+
+		 \sa isSecondary()
 
 		 \since v0.7.0
 		*/
@@ -152,6 +163,7 @@ namespace ae
 		/*!
 		 \brief Handles the polled input \a event received if it's of concern to the window.
 		 \details This method is automatically called internally.
+		 \note The framebuffer's new size is only applied once the frame's events have been processed, the event's size should be used by the handlers in the meantime.
 
 		 \param[in] event A pointer to the polled input ae::Event that was generated
 
@@ -266,19 +278,109 @@ namespace ae
 		 \brief (De)activates vertical synchronization, deactivated by default.
 		 \details The activation of vertical synchronization will limit the number of frames displayed to the refresh rate of the monitor.\n
 		 This can avoid certain visual artifacts and limit the framerate to a stable value.\n
-		 One of the disadvantages is that it can introduce input lag.
+		 One of the disadvantages is that it can introduce input lag.\n
+		 Adaptive vertical synchronization swaps the late frames immediately instead of waiting for the next refresh, which tears briefly rather than halving the framerate,
+		 and lets variable refresh rate displays (G-Sync, FreeSync) follow the framerate. It falls back on regular vertical synchronization if the driver doesn't support it.
 
 		 \param[in] flag True to enable vertical synchronization, false to deactivate it
+		 \param[in] adaptive Whether the late frames are swapped without waiting (WGL/GLX_EXT_swap_control_tear), false by default
 
 		 \par Example:
 		 \code
 		 // The protected member 'mWindow' is provided by the ae::Layer class, all derived classes have access to this member
-		 mWindow.enableVerticalSync(true);
+		 mWindow.enableVerticalSync(true, true);
 		 \endcode
 
+		 \sa isAdaptiveSyncEnabled()
+
 		 \since v0.5.0
 		*/
-		void enableVerticalSync(bool flag) const;
+		void enableVerticalSync(bool flag, bool adaptive = false);
+		/*!
+		 \brief Checks whether vertical synchronization is activated.
+
+		 \return True if vertical synchronization is activated, false otherwise
+
+		 \sa enableVerticalSync()
+
+		 \since v0.7.0
+		*/
+		_NODISCARD bool isVerticalSyncEnabled() const noexcept;
+		/*!
+		 \brief Checks whether adaptive vertical synchronization is activated.
+
+		 \return True if vertical synchronization is adaptive, false if it's deactivated, regular or if adaptive synchronization isn't supported
+
+		 \sa enableVerticalSync()
+
+		 \since v0.7.0
+		*/
+		_NODISCARD bool isAdaptiveSyncEnabled() const noexcept;
+		/*!
+		 \brief Sets whether the ae::Window tracks its damage in order to only redraw the regions that were modified.
+		 \details The scenes are then rendered into a persistent back buffer that keeps the previous frames' content, of which only the union of the damaged regions is cleared and redrawn (see ae::RenderTarget::addDamage()).
+		 The back buffer is then copied onto the window's backbuffer before being displayed, which is cheaper than redrawing the entire window when only a few widgets change (caret blinking, hovered buttons, etc.).
+		 \note The ae::Actor2D instances automatically damage the regions they cover when they're modified, moved, hidden or removed, but custom drawcalls have to damage the regions they modify themselves.
+
+		 \param[in] flag True to only redraw the damaged regions, false to redraw the entire window every frame
+
+		 \par Example:
+		 \code
+		 // The protected member 'mWindow' is provided by the ae::State class, all derived classes have access to this member
+		 mWindow.setDamageTracking(true);
+		 \endcode
+
+		 \sa ae::RenderTarget::isDamageTracking()
+
+		 \since v0.7.0
+		*/
+		void setDamageTracking(bool flag);
+		/*!
+		 \brief Retrieves the ae::Window's chain of post-processing effects, which are applied to every frame once it's been rendered.
+		 \details As soon as an effect is enabled, the scenes are rendered into a persistent back buffer to which the effects are applied before the result is blitted onto the window's backbuffer.
+		 The back buffer is released once every effect is disabled, unless the damage is tracked.
+		 \note The effects are only applied to the primary window.
+
+		 \return The ae::PostProcessChain applied to the ae::Window's frames
+
+		 \par Example:
+		 \code
+		 // The protected member 'mWindow' is provided by the ae::State class, all derived classes have access to this member
+		 mWindow.getPostProcessChain().addBlurEffect("MenuBlur", 0.25f);
+		 \endcode
+
+		 \since v0.7.0
+		*/
+		_NODISCARD PostProcessChain& getPostProcessChain() noexcept;
+		/*!
+		 \brief Checks whether the ae::Window is a secondary window sharing the primary window's OpenGL context.
+		 \details A secondary window's scenes are rendered by the primary context into a persistent back buffer, whose texture is shared with the secondary context that presents it.
+		 The GLResourceFactory's resources, the renderers and the OpenGL state cache are thereby shared by every window.
+
+		 \return True if the window is a secondary window, false if it's the primary window
+
+		 \sa ae::Application::createSecondaryWindow()
+
+		 \since v0.7.0
+		*/
+		_NODISCARD bool isSecondary() const noexcept;
+		/*!
+		 \brief Checks whether the ae::Window is a headless window, created with the ae::Window::Style::Headless flag.
+		 \details A headless window is hidden and its scenes are always rendered into its persistent back buffer (an ae::RenderTexture), which is
+		 never presented, so the benchmarks and the input replays may run without showing a window (on CI runners through a virtual display for instance).
+		 The frames rendered may be dumped with the ae::FrameCapture, which reads them back from the back buffer.
+
+		 \return True if the window is headless, false otherwise
+
+		 \par Example:
+		 \code
+		 ae::Application& app = ae::Application::getInstance();
+		 app.createWindow(ae::VideoMode(1920, 1080), "Benchmark", ae::Window::Style::Headless);
+		 \endcode
+
+		 \since v0.7.0
+		*/
+		_NODISCARD bool isHeadless() const noexcept;
 		/*!
 		 \brief Sets the ae::Window's title displayed on decorated windows and in a task bar.
 		 
@@ -621,6 +723,35 @@ namespace ae
 		 \since v0.3.0
 		*/
 		_NODISCARD const Monitor* const getMonitor() const noexcept;
+		/*!
+		 \brief Retrieves the monitor on which the ae::Window is currently displayed.
+		 \details A windowed window is considered to be displayed on the monitor containing its center, the primary monitor being retrieved if none contains it.
+		 A fullscreen window is always displayed on its assigned monitor.
+
+		 \return The pointer to the ae::Monitor displaying the ae::Window
+
+		 \sa getMonitor(), getDisplayRefreshRate()
+
+		 \since v0.7.0
+		*/
+		_NODISCARD const Monitor* const getCurrentMonitor() const;
+		/*!
+		 \brief Retrieves the refresh rate at which the ae::Window is displayed.
+		 \details The refresh rate is the fullscreen video mode's, or the desktop mode's of the monitor currently displaying the window.
+
+		 \return The refresh rate in hertz
+
+		 \par Example:
+		 \code
+		 // Update the logic as often as the monitor refreshes
+		 ae::Application::getInstance().setFixedTimeStep(mWindow.getDisplayRefreshRate());
+		 \endcode
+
+		 \sa getCurrentMonitor(), getRefreshRate(), ae::Application::setRefreshRateTimeStep()
+
+		 \since v0.7.0
+		*/
+		_NODISCARD int getDisplayRefreshRate() const;
 		/*!
 		 \brief Retrieves the internal pointer to the GLFW handle to the window.
 		 \note This method doesn't have to be used by the API user.
@@ -636,19 +767,83 @@ namespace ae
 		 \since v0.3.0
 		*/
 		_NODISCARD GLFWwindow* const getHandle() const noexcept;
+		/*!
+		 \brief Creates a hidden offscreen context sharing the window's OpenGL objects.
+		 \details The context is created with the window's ae::ContextSettings and may be made current on another thread in order to upload resources in the background.
+		 The framebuffers and vertex arrays aren't shared between contexts, the textures, buffers, shaders and sync objects are.
+		 \note This method must be called from the main thread, the returned handle is owned by the caller who destroys it with glfwDestroyWindow().
+
+		 \return The GLFW handle to the hidden window owning the context, nullptr if it couldn't be created
+
+		 \sa ae::TextureLoader::enableUploadContext()
+
+		 \since v0.7.0
+		*/
+		_NODISCARD GLFWwindow* createSharedContext() const;
+
+		// Public virtual method(s)
+		/*!
+		 \brief Retrieves the ae::Window's internal framebuffer handle.
+		 \note This shouldn't be needed by the API user.
+
+		 \return The handle of the persistent back buffer if the damage is tracked or if post-processing effects are enabled, 0 (the window's backbuffer) otherwise
+
+		 \since v0.7.0
+		*/
+		_NODISCARD virtual unsigned int getFramebufferHandle() const noexcept override final;
+
+	private:
+		// Private virtual method(s)
+		/*!
+		 \brief Applies the framebuffer's new \a size once the frame's resize events have been coalesced.
+		 \details Sets the viewport and recreates the persistent back buffer, if there is one.
+
+		 \param[in] size The new framebuffer size in pixels
+
+		 \since v0.7.0
+		*/
+		virtual void onResize(const Vector2i& size) override final;
+
+		// Private method(s)
+		/*!
+		 \brief (Re)Creates the persistent back buffer with the current framebuffer size.
+
+		 \since v0.7.0
+		*/
+		void createBackBuffer();
+		/*!
+		 \brief Copies the persistent back buffer onto the window's backbuffer, if the damage is tracked.
+
+		 \since v0.7.0
+		*/
+		void blitBackBuffer() const;
+		/*!
+		 \brief Copies the shared texture of the persistent back buffer onto the secondary window's backbuffer through the secondary context.
+		 \note The secondary window's context must be current.
+
+		 \since v0.7.0
+		*/
+		void presentSharedBackBuffer();
 
 	private:
 		// Private member(s)
-		std::string     mTitle;           //!< The window's title
-		VideoMode       mVideoMode;       //!< The window's video mode
-		ContextSettings mContextSettings; //!< The OpenGL context's settings
-		Box2i           mSizeLimits;      //!< The minimum and maximum size of the window's content area
-		Vector2i        mAspectRatio;     //!< The aspect ratio of the window's content area
-		Vector2i        mPosition;        //!< The position of the window in screen coordinates
-		Vector2f        mContentScale;    //!< The content scale (current DPI / default DPI)
-		uint32_t        mStyle;           //!< The window's appearance
-		const Monitor*  mMonitor;         //!< The pointer to the monitor to which the window belongs
-		GLFWwindow*     mHandle;          //!< The GLFW handle to the window
+		std::string                    mTitle;              //!< The window's title
+		VideoMode                      mVideoMode;          //!< The window's video mode
+		ContextSettings                mContextSettings;    //!< The OpenGL context's settings
+		Box2i                          mSizeLimits;         //!< The minimum and maximum size of the window's content area
+		Vector2i                       mAspectRatio;        //!< The aspect ratio of the window's content area
+		Vector2i                       mPosition;           //!< The position of the window in screen coordinates
+		Vector2f                       mContentScale;       //!< The content scale (current DPI / default DPI)
+		uint32_t                       mStyle;              //!< The window's appearance
+		const Monitor*                 mMonitor;            //!< The pointer to the monitor to which the window belongs
+		GLFWwindow*                    mHandle;             //!< The GLFW handle to the window
+		bool                           mVerticalSync;       //!< Whether vertical synchronization is activated
+		bool                           mAdaptiveSync;       //!< Whether vertical synchronization is adaptive
+		std::unique_ptr<RenderTexture> mBackBuffer;         //!< The persistent back buffer into which the scenes are rendered if the damage is tracked or if the window is a secondary window
+		const Window*                  mSharedWindow;       //!< The primary window whose context is shared, nullptr if the window is the primary window
+		unsigned int                   mPresentFramebuffer; //!< The secondary context's framebuffer to which the back buffer's texture is attached
+		unsigned int                   mPresentTexture;     //!< The handle of the texture attached to the secondary context's framebuffer
+		PostProcessChain               mPostProcessChain;   //!< The post-processing effects applied to the frames
 	};
 }
 #endif // Aeon_Window_Window_H_
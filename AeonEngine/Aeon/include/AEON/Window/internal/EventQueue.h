@@ -24,16 +24,20 @@
 #define Aeon_Window_EventQueue_H_
 
 #include <yvals_core.h>
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <new>
 #include <queue>
 #include <memory>
+#include <vector>
 
 #include <AEON/Config.h>
+#include <AEON/Window/Event.h>
 
 namespace ae
 {
-	// Forward declaration(s)
-	class Event;
-
 	/*!
 	 \brief The singleton class representing the queue of system events generated that will be retrieved automatically by Aeon.
 	 \note This class is considered to be internal but may still be used by the API user.
@@ -71,7 +75,67 @@ namespace ae
 	public:
 		// Public method(s)
 		/*!
-		 \brief Enqueues a new \a event at the end of the queue to be processed.
+		 \brief Constructs a new event of type T at the end of the queue to be processed.
+		 \details The event is constructed in one of the queue's preallocated slots so that no memory is allocated, the slot is recycled once the event has been polled and handled.
+		 If every slot is occupied, the event is allocated on the heap instead.\n
+		 If coalescing is enabled, a cursor movement replaces the one at the end of the queue and a wheel scroll is added to the one at the end of the queue (if it's the same wheel).
+		 A window or framebuffer resize replaces the unpolled resize of the same type and window wherever it is in the queue, so only the last size is dispatched.
+
+		 \param[in] args The arguments forwarded to the event's constructor
+
+		 \par Example:
+		 \code
+		 ae::EventQueue::getInstance().enqueueEvent<ae::WindowResizeEvent>(640, 480);
+		 \endcode
+
+		 \sa pollEvent()
+
+		 \since v0.7.0
+		*/
+		template <class T, typename... Args, typename = std::enable_if_t<std::is_base_of_v<Event, T>>>
+		void enqueueEvent(Args&&... args)
+		{
+			static_assert(sizeof(T) <= SLOT_SIZE && alignof(T) <= alignof(Slot), "The event doesn't fit in the queue's slots.");
+
+			// Merge the consecutive cursor movements and wheel scrolls into the last unpolled event
+			if constexpr (std::is_same_v<T, MouseMoveEvent>) {
+				if (Event* const lastEvent = getCoalescableEvent(Event::Type::MouseMoved)) {
+					lastEvent->~Event();
+					new (lastEvent) MouseMoveEvent(std::forward<Args>(args)...);
+					lastEvent->window = mEventSource;
+					return;
+				}
+			}
+			else if constexpr (std::is_same_v<T, MouseWheelEvent>) {
+				const MouseWheelEvent SCROLL(std::forward<Args>(args)...);
+				MouseWheelEvent* const lastScroll = static_cast<MouseWheelEvent*>(getCoalescableEvent(Event::Type::MouseWheelScrolled));
+				if (lastScroll && lastScroll->wheel == SCROLL.wheel) {
+					const double OFFSET = lastScroll->offset + SCROLL.offset;
+					lastScroll->~MouseWheelEvent();
+					new (lastScroll) MouseWheelEvent(SCROLL.wheel, OFFSET);
+					lastScroll->window = mEventSource;
+				}
+				else {
+					emplaceEvent<MouseWheelEvent>(SCROLL.wheel, SCROLL.offset);
+				}
+				return;
+			}
+			else if constexpr (std::is_same_v<T, WindowResizeEvent> || std::is_same_v<T, FramebufferResizeEvent>) {
+				// The window and framebuffer resizes alternate while the window's edge is dragged, so the pending resize isn't necessarily the last event
+				constexpr Event::Type TYPE = (std::is_same_v<T, WindowResizeEvent>) ? Event::Type::WindowResized : Event::Type::FramebufferResized;
+				if (Event* const pendingResize = getPendingEvent(TYPE)) {
+					pendingResize->~Event();
+					new (pendingResize) T(std::forward<Args>(args)...);
+					pendingResize->window = mEventSource;
+					return;
+				}
+			}
+
+			emplaceEvent<T>(std::forward<Args>(args)...);
+		}
+		/*!
+		 \brief Enqueues a new \a event, allocated by the caller, at the end of the queue to be processed.
+		 \note The templated enqueueEvent() should be preferred as it avoids allocating the event.
 
 		 \param[in] event The ae::Event to enqueue
 
@@ -86,16 +150,118 @@ namespace ae
 		 \since v0.3.0
 		*/
 		void enqueueEvent(std::unique_ptr<Event> event);
+		/*!
+		 \brief Constructs a new event of type T and posts it to the queue from any thread.
+		 \details Unlike enqueueEvent() which may only be called from the main thread, the posted events are pushed onto a lock-free list
+		 that the main thread collects at the beginning of each frame. Several threads (texture loaders, network threads, etc.) may post events simultaneously.
+		 \note The posted events are allocated on the heap and they're never coalesced.
+
+		 \param[in] args The arguments forwarded to the event's constructor
+
+		 \par Example:
+		 \code
+		 // Within a worker thread, once the level's data has been loaded
+		 ae::EventQueue::getInstance().postEvent<ae::Event>(ae::Event::Type::WindowDamaged);
+		 \endcode
+
+		 \sa collectPostedEvents()
+
+		 \since v0.7.0
+		*/
+		template <class T, typename... Args, typename = std::enable_if_t<std::is_base_of_v<Event, T>>>
+		void postEvent(Args&&... args)
+		{
+			postEvent(std::make_unique<T>(std::forward<Args>(args)...));
+		}
+		/*!
+		 \brief Posts an \a event, allocated by the caller, to the queue from any thread.
+
+		 \param[in] event The ae::Event to post
+
+		 \sa collectPostedEvents()
+
+		 \since v0.7.0
+		*/
+		void postEvent(std::unique_ptr<Event> event);
+		/*!
+		 \brief Moves the events posted by the other threads to the end of the queue, in the order in which they were posted.
+		 \note This method is automatically called by the ae::Application on the main thread before the events are polled.
+
+		 \sa postEvent()
+
+		 \since v0.7.0
+		*/
+		void collectPostedEvents();
+		/*!
+		 \brief Sets whether the high-frequency input events are coalesced, enabled by default.
+		 \details The consecutive cursor movements enqueued between two frames are merged into the last one, the consecutive scrolls of a same wheel are summed
+		 and the resizes of a same window are replaced by the last one, which avoids dispatching every sample to the window, the states and their actors. Consumers needing every raw sample (drawing applications,
+		 gesture recognition, etc.) may disable the coalescing.
+
+		 \param[in] flag True to coalesce the high-frequency input events, false to enqueue every sample
+
+		 \par Example:
+		 \code
+		 // Receive every cursor position reported by the system
+		 ae::EventQueue::getInstance().setCoalescing(false);
+		 \endcode
+
+		 \sa isCoalescing()
+
+		 \since v0.7.0
+		*/
+		void setCoalescing(bool flag) noexcept;
+		/*!
+		 \brief Checks whether the high-frequency input events are coalesced.
+
+		 \return True if the cursor movements and wheel scrolls are coalesced, false otherwise
+
+		 \sa setCoalescing()
+
+		 \since v0.7.0
+		*/
+		_NODISCARD bool isCoalescing() const noexcept;
+		/*!
+		 \brief Sets the window generating the events that are subsequently enqueued.
+		 \details The events enqueued are tagged with this window (see ae::Event::window) and the events of different windows are never coalesced.
+		 \note This method is used internally by the window callbacks.
+
+		 \param[in] window The pointer to the window generating the events, nullptr if they aren't tied to a window
+
+		 \since v0.7.0
+		*/
+		void setEventSource(Window* window) noexcept;
+		/*!
+		 \brief Allocates \a size bytes in the queue's payload arena, in which the variable-length data of the enqueued events is stored.
+		 \details The arena is made up of blocks that are reused once every event has been polled, so only the first payloads of a given size allocate memory.
+		 The memory therefore remains valid until pollEvent() reports that the queue is empty.
+		 \note This method may only be called from the main thread, the events posted by the other threads must own their data.
+
+		 \param[in] size The number of bytes to allocate
+		 \param[in] alignment The alignment of the memory, std::max_align_t's alignment by default
+
+		 \return A pointer to the allocated memory
+
+		 \par Example:
+		 \code
+		 auto views = static_cast<std::string_view*>(ae::EventQueue::getInstance().allocatePayload(count * sizeof(std::string_view), alignof(std::string_view)));
+		 \endcode
+
+		 \since v0.7.0
+		*/
+		_NODISCARD void* allocatePayload(size_t size, size_t alignment = alignof(std::max_align_t));
 		/*!
 		 \brief Assigns the ae::Event at the front of the queue to the \a event parameter provided and removes it from the queue.
+		 \details The event previously polled is destroyed and its slot is recycled, the event polled therefore remains valid until the next call to this method.
+		 The payload arena is reset once the queue is empty.
 
-		 \param[in] event The ae::Event that will be assigned to the event at the front of the queue
+		 \param[in] event The pointer that will be assigned to the event at the front of the queue
 
 		 \return True if there are still events stored in the queue, false otherwise
 
 		 \par Example:
 		 \code
-		 std::unique_ptr<ae::Event> event;
+		 ae::Event* event = nullptr;
 		 while (ae::EventQueue::getInstance().pollEvent(event)) {
 			if (event->type == ae::Event::Type::KeyPressed) {
 				auto keyEvent = event->as<ae::KeyEvent>();
@@ -110,7 +276,7 @@ namespace ae
 
 		 \since v0.3.0
 		*/
-		_NODISCARD bool pollEvent(std::unique_ptr<Event>& event);
+		_NODISCARD bool pollEvent(Event*& event);
 
 		// Public static method(s)
 		/*!
@@ -136,10 +302,112 @@ namespace ae
 		 \since v0.3.0
 		*/
 		EventQueue() noexcept;
+		/*!
+		 \brief Destructor.
+		 \details Destroys the events that haven't been polled.
+
+		 \since v0.7.0
+		*/
+		~EventQueue();
+
+		// Private method(s)
+		/*!
+		 \brief Constructs a new event of type T at the end of the queue.
+
+		 \param[in] args The arguments forwarded to the event's constructor
+
+		 \since v0.7.0
+		*/
+		template <class T, typename... Args>
+		void emplaceEvent(Args&&... args)
+		{
+			// The events stored on the heap must be polled first to preserve the order of the events
+			if (mOverflowQueue.empty() && mCount < CAPACITY) {
+				T* const event = new (mSlots[(mFront + mCount) % CAPACITY].data) T(std::forward<Args>(args)...);
+				event->window = mEventSource;
+				++mCount;
+			}
+			else {
+				std::unique_ptr<T> event = std::make_unique<T>(std::forward<Args>(args)...);
+				event->window = mEventSource;
+				mOverflowQueue.push(std::move(event));
+			}
+		}
+		/*!
+		 \brief Retrieves the event at the end of the queue if it may be merged with a new event of the \a type provided.
+
+		 \param[in] type The ae::Event::Type of the new event
+
+		 \return The last unpolled event if coalescing is enabled and it's of the same \a type and window, nullptr otherwise
+
+		 \since v0.7.0
+		*/
+		_NODISCARD Event* getCoalescableEvent(Event::Type type) noexcept;
+		/*!
+		 \brief Retrieves the most recent unpolled event of the \a type provided that was generated by the current event source.
+		 \details Only the events stored in the slots are searched, the heap-allocated events are never replaced.
+
+		 \param[in] type The ae::Event::Type of the new event
+
+		 \return The unpolled event if coalescing is enabled and one of the same \a type and window is found, nullptr otherwise
+
+		 \since v0.7.0
+		*/
+		_NODISCARD Event* getPendingEvent(Event::Type type) noexcept;
+		/*!
+		 \brief Destroys the event that was last polled, recycling its slot.
+
+		 \since v0.7.0
+		*/
+		void releasePolledEvent() noexcept;
+
+	private:
+		// Private static member(s)
+		static constexpr size_t CAPACITY = 1024;                //!< The number of preallocated event slots
+		static constexpr size_t PAYLOAD_BLOCK_SIZE = 64 * 1024; //!< The default size of the payload arena's blocks
+		static constexpr size_t SLOT_SIZE = std::max({ sizeof(Event), sizeof(MonitorEvent), sizeof(WindowResizeEvent), sizeof(FramebufferResizeEvent),
+		                                               sizeof(WindowContentScaleEvent), sizeof(WindowMoveEvent), sizeof(PathDropEvent), sizeof(KeyEvent),
+		                                               sizeof(TextEvent), sizeof(MouseMoveEvent), sizeof(MouseButtonEvent), sizeof(MouseWheelEvent) }); //!< The size of the largest event
+
+		// Private struct(s)
+		/*!
+		 \brief The storage of a single event.
+		*/
+		struct alignas(std::max_align_t) Slot
+		{
+			unsigned char data[SLOT_SIZE]; //!< The raw storage in which the event is constructed
+		};
+		/*!
+		 \brief The block of memory of the payload arena.
+		*/
+		struct PayloadBlock
+		{
+			std::unique_ptr<unsigned char[]> data; //!< The block's memory
+			size_t                           size; //!< The number of bytes in the block
+		};
+		/*!
+		 \brief The node of the lock-free list of posted events.
+		*/
+		struct PostedEvent
+		{
+			std::unique_ptr<Event> event; //!< The posted event
+			PostedEvent*           next;  //!< The event posted beforehand
+		};
 
 	private:
 		// Private member(s)
-		std::queue<std::unique_ptr<Event>> mQueue; //!< The queue that stores the unpolled events
+		std::array<Slot, CAPACITY>         mSlots;          //!< The ring of slots that stores the unpolled events
+		size_t                             mFront;          //!< The index of the slot storing the event at the front of the queue
+		size_t                             mCount;          //!< The number of occupied slots (including the one of the event last polled)
+		std::queue<std::unique_ptr<Event>> mOverflowQueue;  //!< The heap-allocated events enqueued while every slot was occupied
+		std::unique_ptr<Event>             mPolledOverflow; //!< The heap-allocated event that was last polled
+		bool                               mPolledSlot;     //!< Whether the event last polled occupies the front slot
+		bool                               mCoalescing;     //!< Whether the cursor movements and wheel scrolls are coalesced
+		std::atomic<PostedEvent*>          mPostedEvents;   //!< The events posted by any thread and not yet collected, from the most recent one
+		Window*                            mEventSource;    //!< The window generating the events being enqueued
+		std::vector<PayloadBlock>          mPayloadBlocks;  //!< The blocks of the payload arena, kept across frames
+		size_t                             mPayloadBlock;   //!< The index of the block currently being filled
+		size_t                             mPayloadOffset;  //!< The number of bytes used in the block currently being filled
 	};
 }
 #endif // Aeon_Window_EventQueue_H_
@@ -153,7 +421,13 @@ namespace ae
  to distribute all the generated events to the API user's states.
 
  It stores the generated events in a queue wherein Aeon retrieves each event
- one at a time and sends them out to the user-created ae::State instances.
+ one at a time and sends them out to the user-created ae::State instances. The
+ events are constructed in a fixed ring of preallocated slots which are
+ recycled as the events are polled, so that high-frequency input (such as the
+ cursor's movements) doesn't allocate any memory.
+
+ Any thread may additionally post events: they're pushed onto a lock-free list
+ which the main thread collects into the queue at the beginning of each frame.
 
  \author Filippos Gleglakos
  \version v0.3.0
@@ -24,6 +24,8 @@
 #define Aeon_Window_InputManager_H_
 
 #include <AEON/Config.h>
+#include <AEON/Window/Keyboard.h>
+#include <AEON/Window/Mouse.h>
 
 // Forward declaration(s)
 struct GLFWmonitor;
@@ -220,6 +222,122 @@ namespace ae
 		 \since v0.3.0
 		*/
 		AEON_API void scroll_callback(GLFWwindow* glfwWindow, double xoffset, double yoffset);
+
+		// Function(s)
+		/*!
+		 \brief Publishes the keys' and the mouse buttons' states received by the callbacks since the previous frame into the input snapshot.
+		 \details The snapshot contains the state of every key and button along with the ones that were pressed or released since the previous snapshot.
+		 It remains unchanged until the next call, so it may be read from the game thread while the callbacks receive the next frame's input.
+		 \note This function is automatically called at the beginning of each frame by the ae::Application.
+
+		 \sa isKeyDown(), wasKeyPressed(), wasKeyReleased()
+
+		 \since v0.7.0
+		*/
+		AEON_API void updateSnapshot() noexcept;
+		/*!
+		 \brief Sets whether recorded input is being replayed, the keyboard and mouse input received from GLFW being ignored meanwhile.
+		 \details The input callbacks only accept the input that's provided without a window (nullptr as the GLFW handle) during the replay.
+		 The held keys and buttons are released when the replay starts and ends.
+		 \note This function is automatically called by the ae::InputRecorder.
+
+		 \param[in] flag True to ignore the live keyboard and mouse input, false to resume it
+
+		 \sa updateSnapshot()
+
+		 \since v0.7.0
+		*/
+		AEON_API void setReplaying(bool flag) noexcept;
+		/*!
+		 \brief Checks if the \a key was held down when the input snapshot was taken.
+		 \details Unlike ae::Keyboard::isKeyPressed(), no GLFW query is made.
+
+		 \param[in] key The ae::Keyboard::Key to check
+
+		 \return True if the \a key is held down, false otherwise
+
+		 \par Example:
+		 \code
+		 if (ae::InputManager::isKeyDown(ae::Keyboard::Key::W)) {
+			...
+		 }
+		 \endcode
+
+		 \sa wasKeyPressed(), wasKeyReleased()
+
+		 \since v0.7.0
+		*/
+		_NODISCARD AEON_API bool isKeyDown(Keyboard::Key key) noexcept;
+		/*!
+		 \brief Checks if the \a key was pressed down during the previous frame.
+		 \details The edge is only reported during the frame that follows the press, a key pressed and released within the same frame is reported as pressed and released.
+		 \note The edges are captured per frame, so they're reported to every fixed-step update of the frame.
+
+		 \param[in] key The ae::Keyboard::Key to check
+
+		 \return True if the \a key was pressed, false otherwise
+
+		 \par Example:
+		 \code
+		 if (ae::InputManager::wasKeyPressed(ae::Keyboard::Key::Space)) {
+			player.jump();
+		 }
+		 \endcode
+
+		 \sa isKeyDown(), wasKeyReleased()
+
+		 \since v0.7.0
+		*/
+		_NODISCARD AEON_API bool wasKeyPressed(Keyboard::Key key) noexcept;
+		/*!
+		 \brief Checks if the \a key was released during the previous frame.
+
+		 \param[in] key The ae::Keyboard::Key to check
+
+		 \return True if the \a key was released, false otherwise
+
+		 \sa isKeyDown(), wasKeyPressed()
+
+		 \since v0.7.0
+		*/
+		_NODISCARD AEON_API bool wasKeyReleased(Keyboard::Key key) noexcept;
+		/*!
+		 \brief Checks if the mouse \a button was held down when the input snapshot was taken.
+		 \details Unlike ae::Mouse::isButtonPressed(), no GLFW query is made.
+
+		 \param[in] button The ae::Mouse::Button to check
+
+		 \return True if the \a button is held down, false otherwise
+
+		 \sa wasButtonPressed(), wasButtonReleased()
+
+		 \since v0.7.0
+		*/
+		_NODISCARD AEON_API bool isButtonDown(Mouse::Button button) noexcept;
+		/*!
+		 \brief Checks if the mouse \a button was pressed down during the previous frame.
+
+		 \param[in] button The ae::Mouse::Button to check
+
+		 \return True if the \a button was pressed, false otherwise
+
+		 \sa isButtonDown(), wasButtonReleased()
+
+		 \since v0.7.0
+		*/
+		_NODISCARD AEON_API bool wasButtonPressed(Mouse::Button button) noexcept;
+		/*!
+		 \brief Checks if the mouse \a button was released during the previous frame.
+
+		 \param[in] button The ae::Mouse::Button to check
+
+		 \return True if the \a button was released, false otherwise
+
+		 \sa isButtonDown(), wasButtonPressed()
+
+		 \since v0.7.0
+		*/
+		_NODISCARD AEON_API bool wasButtonReleased(Mouse::Button button) noexcept;
 	}
 }
 #endif // Aeon_Window_InputManager_H_
@@ -233,6 +351,14 @@ namespace ae
  responsible for creating the appropriate event and enqueuing it in the
  ae::EventQueue instance's queue.
 
+ The callbacks also record the keys' and mouse buttons' states into bitsets
+ which are published once per frame as a snapshot, so that gameplay code may
+ poll any number of keys and their press/release edges without any GLFW
+ queries nor event traversals.
+
+ The ae::InputRecorder replays the recorded input by calling the input
+ callbacks without a window, the live input being ignored meanwhile.
+
  This namespace is considered an internal namespace meaning that the API user
  doesn't need to by concerned with it .
 
@@ -25,10 +25,13 @@
 
 #include <map>
 #include <queue>
+#include <atomic>
+#include <memory>
 #include <functional>
 
 #include <AEON/Config.h>
 #include <AEON/System/DebugLogger.h>
+#include <AEON/System/JobSystem.h>
 #include <AEON/Window/State.h>
 
 namespace ae
@@ -133,10 +136,15 @@ namespace ae
 		void update(const Time& dt);
 		/*!
 		 \brief Sends the command to the active ae::State instances to submit their elements to a renderer.
+		 \details The states which stop being drawn because a state before them blocks the drawing are suspended, and they're resumed right before they're drawn again.
+
+		 \param[in] interpolation The fraction of the fixed time-step elapsed since the last update, between 0 and 1
+
+		 \sa ae::State::onSuspend(), ae::State::onResume()
 
 		 \since v0.3.0
 		*/
-		void draw();
+		void draw(float interpolation);
 
 		/*!
 		 \brief Creates a previously registered state that was associated with the identifier provided.
@@ -149,6 +157,33 @@ namespace ae
 		 \since v0.3.0
 		*/
 		void pushState(uint32_t stateID);
+		/*!
+		 \brief Constructs a previously registered state ahead of time and loads its resources on a worker thread so that it may be pushed instantly.
+		 \details The state is constructed right away and its ae::State::preload() method is executed by one of the ae::JobSystem's threads.
+		 The state is then kept in the ready pool until it's pushed with pushState(), which only waits for the preloading to complete if it's still in progress.
+		 \note The textures requested from the ae::TextureLoader within the state's constructor are decoded in the background as well,
+		 so the progress of a loading screen may be deduced from isPreloading() and from ae::TextureLoader::getPendingCount().
+
+		 \param[in] stateID The identifier associated with the registered state
+
+		 \par Example:
+		 \code
+		 // Within the loading state's constructor
+		 ae::StateStack::getInstance().preloadState(StateID::Level1);
+
+		 // Within the loading state's update()
+		 ae::StateStack& stateStack = ae::StateStack::getInstance();
+		 if (!stateStack.isPreloading(StateID::Level1) && ae::TextureLoader::getInstance().getPendingCount() == 0) {
+			requestStateRemove(StateID::Loading);
+			requestStatePush(StateID::Level1);
+		 }
+		 \endcode
+
+		 \sa pushState(), isPreloading(), ae::State::preload()
+
+		 \since v0.7.0
+		*/
+		void preloadState(uint32_t stateID);
 		/*!
 		 \brief Remove a previously pushed state that is associated with the identifier provided.
 		 \note The identifier has to be associated with a previously pushed ae::State.
@@ -180,6 +215,47 @@ namespace ae
 		 \since v0.3.0
 		*/
 		_NODISCARD State* const getState(uint32_t stateID) const;
+		/*!
+		 \brief Checks whether the state associated with the identifier provided is still being preloaded.
+
+		 \param[in] stateID The identifier associated with the registered state
+
+		 \return True if the state's preload() method is still being executed, false if it has completed or if the state wasn't preloaded
+
+		 \sa preloadState()
+
+		 \since v0.7.0
+		*/
+		_NODISCARD bool isPreloading(uint32_t stateID) const;
+		/*!
+		 \brief Sets whether the states are asked to release their memory once they're suspended.
+		 \details The suspended states' ae::State::onTrimMemory() method is called right after their ae::State::onSuspend() method,
+		 and the OpenGL resources they no longer reference are then queued for destruction with ae::GLResourceFactory::destroyUnused().
+		 The states restore their resources lazily once they're resumed. The batches cached by the ae::BatchRenderer2D are released either way as the suspended states stop resubmitting them.
+		 \note This policy bounds the memory used by deep stacks of states (menus over a game for example), at the cost of reloading the resources upon resumption.
+
+		 \param[in] flag True to trim the suspended states' memory, false to keep them fully resident (default)
+
+		 \par Example:
+		 \code
+		 ae::StateStack::getInstance().setMemoryTrimming(true);
+		 \endcode
+
+		 \sa isMemoryTrimming(), ae::State::onTrimMemory()
+
+		 \since v0.7.0
+		*/
+		void setMemoryTrimming(bool flag) noexcept;
+		/*!
+		 \brief Checks whether the states are asked to release their memory once they're suspended.
+
+		 \return True if the suspended states' memory is trimmed, false otherwise
+
+		 \sa setMemoryTrimming()
+
+		 \since v0.7.0
+		*/
+		_NODISCARD bool isMemoryTrimming() const noexcept;
 
 		/*!
 		 \brief Checks if the ae::StateStack doesn't possess any pushed ae::State instances.
@@ -190,6 +266,17 @@ namespace ae
 		 \since v0.3.0
 		*/
 		_NODISCARD bool isEmpty() const noexcept;
+		/*!
+		 \brief Checks if one of the pushed ae::State instances is animating and therefore requires new frames to be rendered.
+		 \details This method is used internally when the frames are only rendered on demand.
+
+		 \return True if at least one of the pushed states is animating, false otherwise
+
+		 \sa ae::State::isAnimating(), ae::Application::setOnDemandRendering()
+
+		 \since v0.7.0
+		*/
+		_NODISCARD bool isAnimating() const;
 
 		// Public static method(s)
 		/*!
@@ -227,6 +314,22 @@ namespace ae
 		 \since v0.3.0
 		*/
 		_NODISCARD std::unique_ptr<State> createState(uint32_t stateID) const;
+		/*!
+		 \brief Retrieves the state associated with the identifier provided from the ready pool, waiting for its preloading to complete if need be.
+
+		 \param[in] stateID The identifier associated with the registered state
+
+		 \return The preloaded ae::State or nullptr if it wasn't preloaded
+
+		 \since v0.7.0
+		*/
+		_NODISCARD std::unique_ptr<State> takePreloadedState(uint32_t stateID);
+		/*!
+		 \brief Releases the jobs of the states whose preloading has completed.
+
+		 \since v0.7.0
+		*/
+		void releasePreloadJobs();
 		/*!
 		 \brief Applies the pending actions to apply to the pushed ae::State instances.
 
@@ -257,11 +360,24 @@ namespace ae
 			explicit PendingChange(Action action, uint32_t stateID = 0);
 		};
 
+		/*!
+		 \brief The struct representing a state being preloaded or waiting in the ready pool to be pushed.
+		*/
+		struct PreloadedState
+		{
+			std::unique_ptr<State> state;  //!< The constructed state
+			JobSystem::Job*        job;    //!< The job executing the state's preload() method, nullptr once it has been released
+			std::atomic<bool>      loaded; //!< Whether the state's preload() method has completed
+		};
+
 	private:
 		// Private member(s)
 		std::map<uint32_t, std::unique_ptr<State>>                  mStates;         //!< The pushed states
 		std::map<uint32_t, std::function<std::unique_ptr<State>()>> mStateFactories; //!< The factories containing the creation of the registered states
+		std::map<uint32_t, std::unique_ptr<PreloadedState>>         mReadyPool;      //!< The preloaded states waiting to be pushed
+		std::map<uint32_t, bool>                                    mSuspended;      //!< The pushed states that have stopped being drawn and whether their memory was trimmed
 		std::queue<PendingChange>                                   mPendingQueue;   //!< The queue of actions to apply to the pushed states
+		bool                                                        mMemoryTrimming; //!< Whether the suspended states are asked to release their memory
 	};
 }
 #endif // Aeon_Window_StateStack_H_
@@ -275,6 +391,13 @@ namespace ae
  instance to pass on polled input events, to update the states and to send
  them the command to render their respective elements.
 
+ States may also be preloaded ahead of time: their resources are then loaded
+ on a worker thread and they're kept in a ready pool so that pushing them
+ doesn't stall the application.
+
+ The states that stop being drawn are suspended and resumed once they're drawn
+ again; they may optionally be asked to release their memory while suspended.
+
  \author Filippos Gleglakos
  \version v0.3.0
  \date 2019.07.28
@@ -22,8 +22,122 @@
 
 #include <AEON/Graphics/Actor2D.h>
 
+#include <mutex>
+#include <limits>
+#include <typeinfo>
+#include <iterator>
+#include <algorithm>
+#include <utility>
+
+#include <AEON/Graphics/RenderCommandList.h>
+#include <AEON/Graphics/internal/Renderer2D.h>
+#include <AEON/Graphics/internal/RenderTarget.h>
+#include <AEON/Graphics/TransformHierarchy2D.h>
+#include <AEON/Graphics/TweenSystem.h>
+#include <AEON/Math/Transform2D.h>
+#include <AEON/System/FrameArena.h>
+#include <AEON/System/JobSystem.h>
+#include <AEON/System/MemoryTracker.h>
+#include <AEON/System/Profiler.h>
+#include <AEON/Window/EventBus.h>
+
 namespace ae
 {
+	namespace
+	{
+		// The structural changes requested by the worker threads of an ae::Actor2D::updateParallel() call
+		struct SyncPoint
+		{
+			explicit SyncPoint(const Actor2D& syncNode)
+				: node(syncNode)
+				, mutex()
+				, attachments()
+				, removals()
+			{
+			}
+
+			const Actor2D&                        node;        //!< The node calling updateParallel()
+			std::mutex                            mutex;       //!< The mutex protecting the deferred changes
+			std::vector<std::unique_ptr<Actor2D>> attachments; //!< The children to attach to the node
+			std::vector<Actor2D*>                 removals;    //!< The node's children to mark for removal
+		};
+
+		// The sync point of the worker thread's current parallel update, if any
+		thread_local SyncPoint* activeSyncPoint = nullptr;
+
+		// The state of a thread's render traversal, the parents' transforms being pushed onto a preallocated stack instead of copying the render states
+		struct TraversalState
+		{
+			TraversalState()
+				: transforms()
+				, globalTransforms(false)
+			{
+				transforms.reserve(64);
+			}
+
+			std::vector<Matrix4f> transforms;       //!< The transforms accumulated by the parents of the nodes being traversed
+			bool                  globalTransforms; //!< Whether the accumulated transforms match the nodes' cached global transforms
+		};
+
+		// The state of the calling thread's render traversal
+		thread_local TraversalState traversalState;
+
+		// Checks whether the node is the one running the calling worker thread's parallel update
+		bool isSyncNode(const Actor2D* node) noexcept
+		{
+			return activeSyncPoint && node == &activeSyncPoint->node;
+		}
+
+		// The mutex protecting the lookup indices from the structural changes made by the worker threads of parallel updates
+		std::mutex indexMutex;
+
+		// The list returned by the lookups of a tag borne by no node
+		const std::vector<Actor2D*> NO_ACTORS;
+
+		// Locks the lookup indices if the calling thread is running a parallel update (the main thread's changes aren't contended)
+		std::unique_lock<std::mutex> lockIndex()
+		{
+			return activeSyncPoint ? std::unique_lock<std::mutex>(indexMutex) : std::unique_lock<std::mutex>();
+		}
+
+		// Adds the node provided to the entries of the key
+		void addIndexEntry(std::unordered_map<std::string, std::vector<Actor2D*>>& entries, const std::string& key, Actor2D* node)
+		{
+			entries[key].push_back(node);
+		}
+
+		// Removes the node provided from the entries of the key, the key being erased once no node bears it
+		void removeIndexEntry(std::unordered_map<std::string, std::vector<Actor2D*>>& entries, const std::string& key, const Actor2D* node) noexcept
+		{
+			const auto FOUND_ITR = entries.find(key);
+			if (FOUND_ITR == entries.end()) {
+				return;
+			}
+
+			std::vector<Actor2D*>& nodes = FOUND_ITR->second;
+			const auto NODE_ITR = std::find(nodes.begin(), nodes.end(), node);
+			if (NODE_ITR != nodes.end()) {
+				*NODE_ITR = nodes.back();
+				nodes.pop_back();
+			}
+			if (nodes.empty()) {
+				entries.erase(FOUND_ITR);
+			}
+		}
+
+		// Merges the bounds provided into the damaged regions
+		void mergeDamage(std::pair<bool, Box2f>& damage, const Box2f& bounds) noexcept
+		{
+			if (damage.first) {
+				damage.second.min = min(damage.second.min, bounds.min);
+				damage.second.max = max(damage.second.max, bounds.max);
+			}
+			else {
+				damage = std::make_pair(true, bounds);
+			}
+		}
+	}
+
 	// Public constructor(s)
 	Actor2D::Actor2D()
 		: Transformable2D()
@@ -31,11 +145,40 @@ namespace ae
 		, mGlobalTransform(1.f)
 		, mParent(nullptr)
 		, mChildren()
-		, mFuncs({
-			{ Func::EventHandle, { { Target::Self, true }, { Target::Children, true } } },
-			{ Func::Update,      { { Target::Self, true }, { Target::Children, true } } },
-			{ Func::Render,      { { Target::Self, true }, { Target::Children, true } } }})
+		, mFuncs(getFuncMask(Func::EventHandle | Func::Update | Func::Render, Target::Self | Target::Children))
 		, mAlignment(std::make_pair(false, std::make_pair(OriginFlag::Top | OriginFlag::Left, Vector2f(0.f))))
+		, mLayer(std::make_pair(false, 0))
+		, mDepth(0)
+		, mSubtreeBounds(true, Box2f())
+		, mLayoutBounds()
+		, mStaticGroups()
+		, mDamageBounds(false, Box2f())
+		, mPendingDamage(false, Box2f())
+		, mDamageTransform()
+		, mDamageTracked(false)
+		, mUpdateGlobalTransform(true)
+		, mUpdateSubtreeBounds(true)
+		, mUpdateLayout(true)
+		, mUpdateSubtreeLayout(true)
+		, mUpdateDepth(false)
+		, mUpdateSubtreeDepth(false)
+		, mCullable(true)
+		, mStatic(false)
+		, mUpdateStaticGeometry(true)
+		, mAwake(true)
+		, mSubtreeAwake(true)
+		, mMarkedForRemoval(false)
+		, mPendingRemovals(0)
+		, mThreadSafeUpdate(false)
+		, mSubscriptions()
+		, mSubscribedTypes(0)
+		, mHierarchy(nullptr)
+		, mHierarchyIndex(0)
+		, mTweened(false)
+		, mName()
+		, mTags()
+		, mIndexedNodes(0)
+		, mIndex()
 	{
 	}
 
@@ -47,6 +190,38 @@ namespace ae
 		, mChildren()
 		, mFuncs(copy.mFuncs)
 		, mAlignment(copy.mAlignment)
+		, mLayer(copy.mLayer)
+		, mDepth(copy.mDepth)
+		, mSubtreeBounds(true, Box2f())
+		, mLayoutBounds()
+		, mStaticGroups()
+		, mDamageBounds(false, Box2f())
+		, mPendingDamage(false, Box2f())
+		, mDamageTransform()
+		, mDamageTracked(false)
+		, mUpdateGlobalTransform(true)
+		, mUpdateSubtreeBounds(true)
+		, mUpdateLayout(true)
+		, mUpdateSubtreeLayout(true)
+		, mUpdateDepth(false)
+		, mUpdateSubtreeDepth(false)
+		, mCullable(copy.mCullable)
+		, mStatic(copy.mStatic)
+		, mUpdateStaticGeometry(true)
+		, mAwake(true)
+		, mSubtreeAwake(true)
+		, mMarkedForRemoval(false)
+		, mPendingRemovals(0)
+		, mThreadSafeUpdate(copy.mThreadSafeUpdate)
+		, mSubscriptions()
+		, mSubscribedTypes(0)
+		, mHierarchy(nullptr)
+		, mHierarchyIndex(0)
+		, mTweened(false)
+		, mName(copy.mName)
+		, mTags(copy.mTags)
+		, mIndexedNodes((!copy.mName.empty() || !copy.mTags.empty()) ? 1 : 0)
+		, mIndex()
 	{
 	}
 
@@ -56,9 +231,86 @@ namespace ae
 		, mParent(rvalue.mParent)
 		, mGlobalTransform(std::move(rvalue.mGlobalTransform))
 		, mChildren(std::move(rvalue.mChildren))
-		, mFuncs(std::move(rvalue.mFuncs))
+		, mFuncs(rvalue.mFuncs)
 		, mAlignment(std::move(rvalue.mAlignment))
+		, mLayer(rvalue.mLayer)
+		, mDepth(rvalue.mDepth)
+		, mSubtreeBounds(rvalue.mSubtreeBounds)
+		, mLayoutBounds()
+		, mStaticGroups(std::move(rvalue.mStaticGroups))
+		, mDamageBounds(false, Box2f())
+		, mPendingDamage(false, Box2f())
+		, mDamageTransform()
+		, mDamageTracked(false)
+		, mUpdateGlobalTransform(false)
+		, mUpdateSubtreeBounds(true)
+		, mUpdateLayout(true)
+		, mUpdateSubtreeLayout(true)
+		, mUpdateDepth(rvalue.mUpdateDepth)
+		, mUpdateSubtreeDepth(rvalue.mUpdateSubtreeDepth)
+		, mCullable(rvalue.mCullable)
+		, mStatic(rvalue.mStatic)
+		, mUpdateStaticGeometry(true)
+		, mAwake(true)
+		, mSubtreeAwake(true)
+		, mMarkedForRemoval(false)
+		, mPendingRemovals(0)
+		, mThreadSafeUpdate(rvalue.mThreadSafeUpdate)
+		, mSubscriptions()
+		, mSubscribedTypes(0)
+		, mHierarchy(nullptr)
+		, mHierarchyIndex(0)
+		, mTweened(false)
+		, mName()
+		, mTags()
+		, mIndexedNodes(0)
+		, mIndex()
+	{
+		// Unregister an attached moved node's subtree from its tree's index (the moved children are handed back for the traversal)
+		if (rvalue.mParent && rvalue.mIndexedNodes != 0) {
+			rvalue.mChildren.swap(mChildren);
+			rvalue.unindexSubtree(false);
+			rvalue.mChildren.swap(mChildren);
+		}
+
+		// Take over the moved node's name, tags and lookup index (only owned if it's a root node)
+		mName = std::exchange(rvalue.mName, std::string());
+		mTags = std::exchange(rvalue.mTags, std::vector<std::string>());
+		mIndexedNodes = std::exchange(rvalue.mIndexedNodes, 0);
+		mIndex = std::move(rvalue.mIndex);
+		if (mIndex) {
+			repointIndexEntries(*mIndex, &rvalue);
+		}
+
+		// Reassign the moved children's parent
+		for (auto& child : mChildren) {
+			child->mParent = this;
+		}
+		invalidateGlobalTransform();
+		invalidateBounds();
+		rvalue.invalidateBounds();
+		mPendingRemovals = std::exchange(rvalue.mPendingRemovals, 0);
+		wake();
+
+		// The moved node's transform hierarchy needs to be laid out again
+		if (rvalue.mHierarchy) {
+			rvalue.mHierarchy->markStructureDirty();
+		}
+	}
+
+	Actor2D::~Actor2D()
 	{
+		EventBus& eventBus = EventBus::getInstance();
+		for (const auto& subscription : mSubscriptions) {
+			eventBus.unsubscribe(subscription.second);
+		}
+
+		if (mHierarchy) {
+			mHierarchy->detachActor(*this, mHierarchyIndex);
+		}
+		if (mTweened) {
+			TweenSystem::getInstance().cancelAll(*this);
+		}
 	}
 
 	// Public operator(s)
@@ -79,20 +331,77 @@ namespace ae
 		mParent = other.mParent;
 		mFuncs = other.mFuncs;
 		mAlignment = other.mAlignment;
+		mLayer = other.mLayer;
+		mDepth = other.mDepth;
+		mCullable = other.mCullable;
+		mStatic = other.mStatic;
+		mStaticGroups.clear();
+		mUpdateStaticGeometry = true;
+		mUpdateGlobalTransform = false;
+		invalidateGlobalTransform();
+		invalidateBounds();
+		wake();
+		invalidateLayout();
+		if (mHierarchy) {
+			mHierarchy->markDirty(mHierarchyIndex);
+		}
 
 		return *this;
 	}
 
 	Actor2D& Actor2D::operator=(Actor2D&& rvalue) noexcept
 	{
+		// Unregister the caller's subtree which is replaced, as well as the moved node's subtree if it's attached
+		if (mParent && mIndexedNodes != 0) {
+			unindexSubtree(false);
+		}
+		if (rvalue.mParent && rvalue.mIndexedNodes != 0) {
+			rvalue.unindexSubtree(false);
+		}
+
 		// Copy the trival data and move the rest
 		Transformable2D::operator=(std::move(rvalue));
 		Renderable2D::operator=(std::move(rvalue));
 		mParent = rvalue.mParent;
 		mGlobalTransform = std::move(rvalue.mGlobalTransform);
 		mChildren = std::move(rvalue.mChildren);
-		mFuncs = std::move(rvalue.mFuncs);
+		mFuncs = rvalue.mFuncs;
 		mAlignment = std::move(rvalue.mAlignment);
+		mLayer = rvalue.mLayer;
+		mDepth = rvalue.mDepth;
+		mCullable = rvalue.mCullable;
+		mStatic = rvalue.mStatic;
+		mStaticGroups = std::move(rvalue.mStaticGroups);
+		mUpdateStaticGeometry = true;
+
+		// Take over the moved node's name, tags and lookup index (only owned if it's a root node)
+		mName = std::exchange(rvalue.mName, std::string());
+		mTags = std::exchange(rvalue.mTags, std::vector<std::string>());
+		mIndexedNodes = std::exchange(rvalue.mIndexedNodes, 0);
+		mIndex = std::move(rvalue.mIndex);
+		if (mIndex) {
+			repointIndexEntries(*mIndex, &rvalue);
+		}
+
+		// Reassign the moved children's parent
+		for (auto& child : mChildren) {
+			child->mParent = this;
+		}
+		mUpdateGlobalTransform = false;
+		invalidateGlobalTransform();
+		invalidateBounds();
+		rvalue.invalidateBounds();
+		mPendingRemovals = std::exchange(rvalue.mPendingRemovals, 0);
+		wake();
+		invalidateLayout();
+
+		// The transform hierarchies need to be laid out again
+		if (mHierarchy) {
+			mHierarchy->markStructureDirty();
+		}
+		if (rvalue.mHierarchy) {
+			rvalue.mHierarchy->markStructureDirty();
+		}
 
 		return *this;
 	}
@@ -100,16 +409,49 @@ namespace ae
 	// Public method(s)
 	void Actor2D::attachChild(std::unique_ptr<Actor2D> child)
 	{
+		AEON_MEMORY_SCOPE(MemoryTag::SceneGraph);
+
+		// Defer the attachment if the caller is being updated in parallel
+		if (isSyncNode(this)) {
+			std::lock_guard<std::mutex> lock(activeSyncPoint->mutex);
+			activeSyncPoint->attachments.push_back(std::move(child));
+			return;
+		}
+		AEON_PROFILE_SCOPE("Actor2D::attachChild");
+
 		child->mParent = this;
+		child->invalidateGlobalTransform();
 		mChildren.push_back(std::move(child));
+		invalidateBounds();
+		invalidateStaticGeometry();
+
+		// The attached child's subtree is woken so that it's updated and laid out at least once
+		Actor2D& attached = *mChildren.back();
+		attached.wake();
+		attached.invalidateLayout();
+		if (attached.mMarkedForRemoval) {
+			++mPendingRemovals;
+		}
+		if (mHierarchy) {
+			mHierarchy->markStructureDirty();
+		}
 
-		// Update Z-ordering
-		const int Z_INDEX = (mParent) ? static_cast<int>(getPosition().z) : 0;
-		updateZOrdering(Z_INDEX);
+		// The attached subtree's depths are resolved before the next update or rendering
+		attached.invalidateDepth();
+
+		// The attached subtree's named and tagged nodes are registered in the tree's index
+		attached.indexSubtree();
 	}
 
 	std::unique_ptr<Actor2D> Actor2D::detachChild(const Actor2D& child)
 	{
+		// Check if the caller is being updated in parallel as the child can't be returned at a later time
+		if (isSyncNode(this)) {
+			AEON_LOG_ERROR("Invalid detachment", "Children can't be detached from a node from within its parallel update. Returning null.");
+			return nullptr;
+		}
+		AEON_PROFILE_SCOPE("Actor2D::detachChild");
+
 		// Retrieve the stored child and check if it was found
 		auto found = std::find_if(mChildren.begin(), mChildren.end(), [&child](std::unique_ptr<Actor2D>& p) {
 			return p.get() == &child;
@@ -119,15 +461,198 @@ namespace ae
 			return nullptr;
 		}
 
-		// Nullify the child's parent, remove it from the list and return it
+		// Nullify the child's parent, remove it from the list and return it (the region it covered is redrawn and its indexed nodes are moved to its own index)
 		std::unique_ptr<Actor2D> result = std::move(*found);
+		result->releaseDamage(mPendingDamage);
+		result->unindexSubtree(true);
 		result->mParent = nullptr;
-		result->updateZOrdering(0);
+		result->invalidateGlobalTransform();
+		invalidateBounds();
+		invalidateStaticGeometry();
+		if (mHierarchy) {
+			mHierarchy->markStructureDirty();
+		}
+		result->invalidateDepth();
+		result->invalidateLayout();
+		if (isLayoutDependentOnChildren()) {
+			invalidateLayout();
+		}
+		if (result->mMarkedForRemoval) {
+			--mPendingRemovals;
+		}
 		mChildren.erase(found);
 
 		return result;
 	}
 
+	std::unique_ptr<Actor2D> Actor2D::clone()
+	{
+		// Check if the caller is being updated in parallel as the subtree's geometry is handed over to be shared
+		if (isSyncNode(this)) {
+			AEON_LOG_ERROR("Invalid clone", "A node can't be cloned from within its parallel update. Returning nullptr.");
+			return nullptr;
+		}
+		AEON_MEMORY_SCOPE(MemoryTag::SceneGraph);
+		AEON_PROFILE_SCOPE("Actor2D::clone");
+
+		// Copies the node provided, its geometry being shared with the copy (nullptr if its class doesn't override cloneSelf())
+		auto cloneNode = [](Actor2D& node) -> std::unique_ptr<Actor2D> {
+			node.shareVertices();
+			std::unique_ptr<Actor2D> copy = node.cloneSelf();
+			if (copy && typeid(*copy) != typeid(node)) {
+				AEON_LOG_ERROR("Invalid clone", std::string("The class ") + typeid(node).name() + " doesn't override cloneSelf(). Discarding the node's subtree.");
+				return nullptr;
+			}
+			return copy;
+		};
+
+		std::unique_ptr<Actor2D> root = cloneNode(*this);
+		if (!root) {
+			return nullptr;
+		}
+		root->mParent = nullptr;
+
+		// Clone the subtree iteratively, each entry holding a prototype node and its copy
+		std::vector<std::pair<Actor2D*, Actor2D*>> stack{ { this, root.get() } };
+		while (!stack.empty()) {
+			const auto [PROTOTYPE, COPY] = stack.back();
+			stack.pop_back();
+
+			COPY->mChildren.reserve(PROTOTYPE->mChildren.size());
+			for (const std::unique_ptr<Actor2D>& child : PROTOTYPE->mChildren) {
+				if (child->mMarkedForRemoval) {
+					continue;
+				}
+
+				std::unique_ptr<Actor2D> childCopy = cloneNode(*child);
+				if (!childCopy) {
+					continue;
+				}
+
+				// Link the copy directly, its depth being resolved once the clone is attached
+				childCopy->mParent = COPY;
+				childCopy->mUpdateDepth = true;
+				COPY->mUpdateSubtreeDepth = true;
+				if (childCopy->mIndexedNodes != 0) {
+					for (Actor2D* node = COPY; node; node = node->mParent) {
+						++node->mIndexedNodes;
+					}
+				}
+				stack.emplace_back(child.get(), childCopy.get());
+				COPY->mChildren.push_back(std::move(childCopy));
+			}
+		}
+
+		// The clone's named and tagged nodes are registered in its own index
+		if (root->mIndexedNodes != 0) {
+			root->mIndex = std::make_unique<LookupIndex>();
+			root->registerSubtree(*root->mIndex);
+		}
+
+		return root;
+	}
+
+	void Actor2D::setName(const std::string& name)
+	{
+		if (name == mName) {
+			return;
+		}
+		std::unique_lock<std::mutex> lock = lockIndex();
+
+		// Replace the node's entry in its tree's index
+		LookupIndex* index = getRootNode().mIndex.get();
+		if (index && !mName.empty()) {
+			removeIndexEntry(index->names, mName, this);
+		}
+
+		const bool WAS_INDEXED = !mName.empty() || !mTags.empty();
+		mName = name;
+		updateIndexedNodes(WAS_INDEXED);
+
+		index = getRootNode().mIndex.get();
+		if (index && !mName.empty()) {
+			addIndexEntry(index->names, mName, this);
+		}
+	}
+
+	const std::string& Actor2D::getName() const noexcept
+	{
+		return mName;
+	}
+
+	void Actor2D::addTag(const std::string& tag)
+	{
+		// Check if the tag is empty (ignored in Release mode)
+		if _CONSTEXPR_IF (AEON_DEBUG) {
+			if (tag.empty()) {
+				AEON_LOG_ERROR("Invalid tag", "The tag provided is empty.\nAborting operation.");
+				return;
+			}
+		}
+
+		if (hasTag(tag)) {
+			return;
+		}
+		std::unique_lock<std::mutex> lock = lockIndex();
+
+		const bool WAS_INDEXED = !mName.empty() || !mTags.empty();
+		mTags.push_back(tag);
+		updateIndexedNodes(WAS_INDEXED);
+
+		LookupIndex* const INDEX = getRootNode().mIndex.get();
+		if (INDEX) {
+			addIndexEntry(INDEX->tags, tag, this);
+		}
+	}
+
+	void Actor2D::removeTag(const std::string& tag)
+	{
+		const auto FOUND_ITR = std::find(mTags.begin(), mTags.end(), tag);
+		if (FOUND_ITR == mTags.end()) {
+			return;
+		}
+		std::unique_lock<std::mutex> lock = lockIndex();
+
+		LookupIndex* const INDEX = getRootNode().mIndex.get();
+		if (INDEX) {
+			removeIndexEntry(INDEX->tags, tag, this);
+		}
+		mTags.erase(FOUND_ITR);
+		updateIndexedNodes(true);
+	}
+
+	bool Actor2D::hasTag(const std::string& tag) const noexcept
+	{
+		return std::find(mTags.begin(), mTags.end(), tag) != mTags.end();
+	}
+
+	const std::vector<std::string>& Actor2D::getTags() const noexcept
+	{
+		return mTags;
+	}
+
+	Actor2D* Actor2D::findByName(const std::string& name) const
+	{
+		const LookupIndex* const INDEX = getRootNode().mIndex.get();
+		if (!INDEX) {
+			return nullptr;
+		}
+
+		const auto FOUND_ITR = INDEX->names.find(name);
+		return (FOUND_ITR != INDEX->names.end()) ? FOUND_ITR->second.front() : nullptr;
+	}
+
+	const std::vector<Actor2D*>& Actor2D::findByTag(const std::string& tag) const
+	{
+		const LookupIndex* const INDEX = getRootNode().mIndex.get();
+		if (!INDEX) {
+			return NO_ACTORS;
+		}
+
+		const auto FOUND_ITR = INDEX->tags.find(tag);
+		return (FOUND_ITR != INDEX->tags.end()) ? FOUND_ITR->second : NO_ACTORS;
+	}
+
 	void Actor2D::setRelativeAlignment(uint32_t alignmentFlags, const Vector2f& padding)
 	{
 		// Check if the caller has a parent
@@ -166,149 +691,1094 @@ namespace ae
 
 	void Actor2D::handleEvent(Event* const event)
 	{
-		if (mFuncs[Func::EventHandle][Target::Children]) {
+		// The event's propagation may have been stopped by an ancestor or by a sibling's subtree
+		if (event->isPropagationStopped()) {
+			return;
+		}
+
+		// The subscribed event types are delivered by the event bus
+		const bool SUBSCRIBED = (mSubscribedTypes & (1u << static_cast<uint32_t>(event->type))) != 0;
+		const bool SELF = !SUBSCRIBED && isFunctionalityActive(Func::EventHandle, Target::Self);
+		if (SELF) {
+			event->phase = Event::Phase::Capture;
+			captureEventSelf(event);
+			if (event->isPropagationStopped()) {
+				return;
+			}
+		}
+
+		const bool CHILDREN = !mChildren.empty() && isFunctionalityActive(Func::EventHandle, Target::Children);
+		if (CHILDREN) {
 			handleEventChildren(event);
+			if (event->isPropagationStopped()) {
+				return;
+			}
 		}
-		if (mFuncs[Func::EventHandle][Target::Self]) {
+
+		if (SELF) {
+			event->phase = (CHILDREN) ? Event::Phase::Bubble : Event::Phase::Target;
 			handleEventSelf(event);
 		}
 	}
 
 	void Actor2D::update(const Time& dt)
 	{
+		// Skip the subtree if all of its nodes are sleeping
+		if (!mSubtreeAwake) {
+			return;
+		}
+		AEON_PROFILE_SCOPE("Actor2D::update");
+
+		// The root node resolves the depths of the reparented subtrees
+		if (!mParent) {
+			updateDepth(0, false);
+		}
 		removeChildrenMarkedForRemoval();
 
-		if (mFuncs[Func::Update][Target::Self]) {
+		// Update the node if it has pending work and let it fall asleep otherwise
+		if (mAwake && isFunctionalityActive(Func::Update, Target::Self)) {
 			updateSelf(dt);
 		}
-		if (mFuncs[Func::Update][Target::Children]) {
-			updateChildren(dt);
+		mAwake = hasPendingUpdate();
+
+		// The subtree stays awake as long as one of its nodes is awake or a removal is pending
+		const bool CHILDREN_AWAKE = isFunctionalityActive(Func::Update, Target::Children) && updateChildren(dt);
+		mSubtreeAwake = mAwake || CHILDREN_AWAKE || mPendingRemovals != 0;
+
+		// The root node lays out the nodes invalidated during the update
+		if (!mParent) {
+			updateLayout();
 		}
 	}
 
-	void Actor2D::activateFunctionality(uint32_t func, uint32_t target, bool flag)
+	void Actor2D::markForRemoval()
 	{
-		for (auto& funcItr : mFuncs) {
-			for (auto& targetItr : funcItr.second) {
-				if (func & funcItr.first && target & targetItr.first) {
-					targetItr.second = flag;
-				}
+		if (mMarkedForRemoval) {
+			return;
+		}
+
+		// Defer the removal if the parent is being updated in parallel
+		if (isSyncNode(mParent)) {
+			std::lock_guard<std::mutex> lock(activeSyncPoint->mutex);
+			activeSyncPoint->removals.push_back(this);
+			return;
+		}
+
+		// Inform the parent so that the removal is processed during its next update
+		mMarkedForRemoval = true;
+		if (mParent) {
+			++mParent->mPendingRemovals;
+			for (Actor2D* node = mParent; node && !node->mSubtreeAwake && !isSyncNode(node); node = node->mParent) {
+				node->mSubtreeAwake = true;
 			}
 		}
 	}
 
-	Matrix4f Actor2D::getGlobalTransform()
+	void Actor2D::updateParallel(const Time& dt, unsigned int threadCount)
 	{
-		//if (mUpdateGlobalTransform) {
-			//mUpdateGlobalTransform = false;
-			mGlobalTransform = Matrix4f::identity();
-			for (Actor2D* node = this; node != nullptr; node = node->mParent) {
-				mGlobalTransform = node->getTransform() * mGlobalTransform;
-			}
-	//	}
+		// Skip the subtree if all of its nodes are sleeping
+		if (!mSubtreeAwake) {
+			return;
+		}
+		AEON_PROFILE_SCOPE("Actor2D::updateParallel");
 
-		return mGlobalTransform;
-	}
+		// The root node resolves the depths of the reparented subtrees
+		if (!mParent) {
+			updateDepth(0, false);
+		}
+		removeChildrenMarkedForRemoval();
 
-	Box2f Actor2D::getGlobalBounds()
-	{
-		const Box2f MODEL_BOUNDS = getModelBounds();
-		const Matrix4f GLOBAL_TRANSFORM = getGlobalTransform();
+		// Update the node if it has pending work and let it fall asleep otherwise
+		if (mAwake && isFunctionalityActive(Func::Update, Target::Self)) {
+			updateSelf(dt);
+		}
+		mAwake = hasPendingUpdate();
+		if (!isFunctionalityActive(Func::Update, Target::Children)) {
+			mSubtreeAwake = mAwake || mPendingRemovals != 0;
+			if (!mParent) {
+				updateLayout();
+			}
+			return;
+		}
 
-		return Box2f(Vector2f(GLOBAL_TRANSFORM * Vector3f(MODEL_BOUNDS.min)), Vector2f(GLOBAL_TRANSFORM * Vector3f(MODEL_BOUNDS.max)));
-	}
+		// Gather the awake thread-safe children
+		FrameVector<Actor2D*> parallelChildren;
+		for (const auto& child : mChildren) {
+			if (child->mThreadSafeUpdate && child->mSubtreeAwake) {
+				parallelChildren.push_back(child.get());
+			}
+		}
 
-	Vector2f Actor2D::getGlobalPosition()
-	{
-		return Vector2f(getGlobalTransform() * Vector3f(getPosition()));
-	}
+		// Update each contiguous group of thread-safe children as a job
+		JobSystem& jobSystem = JobSystem::getInstance();
+		if (threadCount == 0) {
+			threadCount = static_cast<unsigned int>(jobSystem.getWorkerCount() + 1);
+		}
+		const size_t GROUP_COUNT = std::min(static_cast<size_t>(threadCount), parallelChildren.size());
+		SyncPoint syncPoint(*this);
+		const auto updateGroup = [&dt, &parallelChildren, &syncPoint, GROUP_COUNT](size_t group) {
+			const size_t BEGIN = parallelChildren.size() * group / GROUP_COUNT;
+			const size_t END = parallelChildren.size() * (group + 1) / GROUP_COUNT;
 
-	// Public virtual method(s)
-	bool Actor2D::isMarkedForRemoval() const
-	{
-		return isDestroyed();
-	}
+			// The previous sync point is restored as the executing thread may be waiting upon a job within another parallel update
+			SyncPoint* const PREVIOUS_SYNC_POINT = std::exchange(activeSyncPoint, &syncPoint);
+			for (size_t i = BEGIN; i < END; ++i) {
+				parallelChildren[i]->update(dt);
+			}
+			activeSyncPoint = PREVIOUS_SYNC_POINT;
+		};
 
-	bool Actor2D::isDestroyed() const
-	{
-		return false;
-	}
+		// The groups are updated by the job system's threads, including the calling one
+		jobSystem.parallelFor(GROUP_COUNT, [&updateGroup](size_t firstGroup, size_t lastGroup) {
+			for (size_t group = firstGroup; group < lastGroup; ++group) {
+				updateGroup(group);
+			}
+		}, 1);
 
-	void Actor2D::correctProperties()
-	{
-		// Correct caller node's properties
-		Transformable2D::correctProperties();
-		if (mAlignment.first) {
-			setRelativeAlignment(mAlignment.second.first, mAlignment.second.second);
+		// Sync point: apply the deferred structural changes and gather the thread-safe children's states
+		for (std::unique_ptr<Actor2D>& child : syncPoint.attachments) {
+			attachChild(std::move(child));
+		}
+		for (Actor2D* const child : syncPoint.removals) {
+			child->markForRemoval();
 		}
 
-		// Correct the children nodes' properties
-		for (const auto& child : mChildren) {
-			child->correctProperties();
+		bool childrenAwake = false;
+		for (Actor2D* const child : parallelChildren) {
+			if (child->isMarkedForRemoval()) {
+				child->markForRemoval();
+			}
+			if (child->mUpdateSubtreeBounds) {
+				invalidateBounds();
+			}
+			if (child->mUpdateLayout || child->mUpdateSubtreeLayout) {
+				child->invalidateLayout();
+			}
+			if (child->mUpdateDepth || child->mUpdateSubtreeDepth) {
+				child->invalidateDepth();
+			}
+			childrenAwake = childrenAwake || child->mSubtreeAwake;
 		}
-	}
 
-	void Actor2D::render(RenderStates states)
-	{
-		states.transform *= getTransform();
+		// Update the remaining children on the calling thread
+		for (auto& child : mChildren) {
+			if (child->mThreadSafeUpdate || !child->mSubtreeAwake) {
+				childrenAwake = childrenAwake || child->mSubtreeAwake;
+				continue;
+			}
 
-		if (mFuncs[Func::Render][Target::Self]) {
-			renderSelf(states);
+			child->update(dt);
+			if (child->isMarkedForRemoval()) {
+				child->markForRemoval();
+			}
+			childrenAwake = childrenAwake || child->mSubtreeAwake;
 		}
-		if (mFuncs[Func::Render][Target::Children]) {
-			renderChildren(states);
+
+		mSubtreeAwake = mAwake || childrenAwake || mPendingRemovals != 0;
+		if (!mParent) {
+			updateLayout();
 		}
 	}
 
-	Box2f Actor2D::getModelBounds() const
+	void Actor2D::invalidateLayout() noexcept
 	{
-		return Box2f();
+		// The containers arranging their children are laid out alongside them
+		Actor2D* node = this;
+		node->mUpdateLayout = true;
+		while (node->mParent && !isSyncNode(node->mParent) && node->mParent->isLayoutDependentOnChildren()) {
+			node = node->mParent;
+			node->mUpdateLayout = true;
+		}
+
+		// The parents' propagation stops at the first node already flagged as its parents are flagged as well
+		for (Actor2D* parent = node->mParent; parent && !parent->mUpdateSubtreeLayout && !isSyncNode(parent); parent = parent->mParent) {
+			parent->mUpdateSubtreeLayout = true;
+		}
 	}
 
-	// Protected method(s)
-	void Actor2D::updateZOrdering(int zIndex)
+	void Actor2D::updateLayout()
 	{
-		// Set the z index provided to this node and raise flag to update global transform
-		const Vector3f& pos = getPosition();
-		setPosition(pos.x, pos.y, zIndex);
+		// Skip the subtree if none of its nodes were invalidated
+		if (!mUpdateLayout && !mUpdateSubtreeLayout) {
+			return;
+		}
+		AEON_PROFILE_SCOPE("Actor2D::updateLayout");
 
-		// Set superior z index to all children nodes, and they'll pass the next z index to their children
-		const int NEXT_ZINDEX = zIndex + 1;
-		for (auto& child : mChildren) {
-			child->updateZOrdering(NEXT_ZINDEX);
+		if (mUpdateLayout) {
+			// The invalidated children's origins are resolved first as they're arranged by their model bounds
+			if (isLayoutDependentOnChildren()) {
+				for (const auto& child : mChildren) {
+					if (child->mUpdateLayout) {
+						child->Transformable2D::correctProperties();
+					}
+				}
+			}
+			arrangeChildren();
+
+			// Resolve the node's origin and alignment (the alignment is kept if the node was detached)
+			Transformable2D::correctProperties();
+			if (mAlignment.first && mParent) {
+				setRelativeAlignment(mAlignment.second.first, mAlignment.second.second);
+			}
+
+			// The children aligned relative to the node need to be laid out again if its model bounds changed
+			const Box2f MODEL_BOUNDS = getModelBounds();
+			if (MODEL_BOUNDS != mLayoutBounds) {
+				mLayoutBounds = MODEL_BOUNDS;
+				for (const auto& child : mChildren) {
+					child->mUpdateLayout = child->mUpdateLayout || child->mAlignment.first;
+				}
+			}
+		}
+		mUpdateLayout = false;
+		mUpdateSubtreeLayout = false;
+
+		for (const auto& child : mChildren) {
+			child->updateLayout();
 		}
 	}
 
-	// Private method(s)
-	void Actor2D::removeChildrenMarkedForRemoval()
+	void Actor2D::setThreadSafeUpdate(bool flag) noexcept
 	{
-		mChildren.erase(std::remove_if(mChildren.begin(), mChildren.end(), [](const std::unique_ptr<Actor2D>& child) {
-			return child->isMarkedForRemoval();
-		}), mChildren.end());
+		mThreadSafeUpdate = flag;
 	}
 
-	void Actor2D::handleEventChildren(Event* const event)
+	bool Actor2D::isThreadSafeUpdate() const noexcept
 	{
-		for (auto& child : mChildren) {
-			child->handleEvent(event);
-		}
+		return mThreadSafeUpdate;
 	}
 
-	void Actor2D::updateChildren(const Time& dt)
+	void Actor2D::activateFunctionality(uint32_t func, uint32_t target, bool flag)
 	{
-		for (auto& child : mChildren) {
-			child->update(dt);
+		const uint8_t MASK = getFuncMask(func, target);
+		mFuncs = static_cast<uint8_t>((flag) ? (mFuncs | MASK) : (mFuncs & ~MASK));
+
+		// The reactivated nodes may have pending work
+		if (flag && (func & Func::Update)) {
+			wake();
 		}
 	}
 
-	void Actor2D::renderChildren(RenderStates states) const
+	void Actor2D::subscribeEvent(Event::Type type)
 	{
-		for (const auto& child : mChildren) {
-			child->render(states);
+		const uint32_t MASK = 1u << static_cast<uint32_t>(type);
+		if (mSubscribedTypes & MASK) {
+			return;
+		}
+
+		const size_t ID = EventBus::getInstance().subscribe(type, [this](Event* const event) {
+			if (isFunctionalityActive(Func::EventHandle, Target::Self)) {
+				event->phase = Event::Phase::Target;
+				handleEventSelf(event);
+			}
+		});
+		mSubscriptions.emplace_back(type, ID);
+		mSubscribedTypes |= MASK;
+	}
+
+	void Actor2D::unsubscribeEvent(Event::Type type)
+	{
+		auto subscriptionItr = std::find_if(mSubscriptions.begin(), mSubscriptions.end(), [type](const std::pair<Event::Type, size_t>& subscription) {
+			return subscription.first == type;
+		});
+		if (subscriptionItr == mSubscriptions.end()) {
+			return;
+		}
+
+		EventBus::getInstance().unsubscribe(subscriptionItr->second);
+		mSubscriptions.erase(subscriptionItr);
+		mSubscribedTypes &= ~(1u << static_cast<uint32_t>(type));
+	}
+
+	void Actor2D::setLayer(int layer) noexcept
+	{
+		mLayer = std::make_pair(true, layer);
+	}
+
+	void Actor2D::resetLayer() noexcept
+	{
+		mLayer = std::make_pair(false, 0);
+	}
+
+	int Actor2D::getLayer() const noexcept
+	{
+		return mLayer.second;
+	}
+
+	int Actor2D::getDepth() const noexcept
+	{
+		return mDepth;
+	}
+
+	const Matrix4f& Actor2D::getGlobalTransform()
+	{
+		// Only recompute the global transform if this node's or a parent's transform was modified
+		if (mUpdateGlobalTransform) {
+			mGlobalTransform = (mParent) ? mParent->getGlobalTransform() * getTransform() : getTransform();
+			mUpdateGlobalTransform = false;
+		}
+
+		return mGlobalTransform;
+	}
+
+	uint64_t Actor2D::getGlobalTransformStamp()
+	{
+		uint64_t stamp = 0;
+		for (Actor2D* node = this; node != nullptr; node = node->mParent) {
+			node->getTransform(); // recompute the transform if it was modified
+			stamp = stamp * 1000003 + node->getTransformVersion() + 1;
+		}
+
+		return stamp;
+	}
+
+	Box2f Actor2D::getGlobalBounds()
+	{
+		const Box2f MODEL_BOUNDS = getModelBounds();
+		const Matrix4f& GLOBAL_TRANSFORM = getGlobalTransform();
+
+		return Box2f(Vector2f(GLOBAL_TRANSFORM * Vector3f(MODEL_BOUNDS.min)), Vector2f(GLOBAL_TRANSFORM * Vector3f(MODEL_BOUNDS.max)));
+	}
+
+	Vector2f Actor2D::getGlobalPosition()
+	{
+		return Vector2f(getGlobalTransform() * Vector3f(getPosition()));
+	}
+
+	void Actor2D::setCullable(bool flag) noexcept
+	{
+		mCullable = flag;
+		invalidateBounds();
+	}
+
+	bool Actor2D::isCullable() const noexcept
+	{
+		return mCullable;
+	}
+
+	const std::pair<bool, Box2f>& Actor2D::getSubtreeBounds()
+	{
+		// The global transform is retrieved beforehand so that the descendants may read their parent's cached transform
+		const Matrix4f& GLOBAL_TRANSFORM = getGlobalTransform();
+		if (!mUpdateSubtreeBounds) {
+			return mSubtreeBounds;
+		}
+
+		// Start from an empty box and enclose the four transformed corners of the model bounds (if any)
+		bool cullable = mCullable;
+		Box2f bounds(Vector2f(std::numeric_limits<float>::max()), Vector2f(std::numeric_limits<float>::lowest()));
+		const Box2f MODEL_BOUNDS = getModelBounds();
+		if (cullable && MODEL_BOUNDS.size != Vector2f(0.f)) {
+			const Vector2f& MIN = MODEL_BOUNDS.position;
+			const Vector2f MAX = MODEL_BOUNDS.position + MODEL_BOUNDS.size;
+			for (const Vector2f& corner : { MIN, Vector2f(MAX.x, MIN.y), Vector2f(MIN.x, MAX.y), MAX }) {
+				const Vector2f POSITION(GLOBAL_TRANSFORM * Vector3f(corner));
+				bounds.min = min(bounds.min, POSITION);
+				bounds.max = max(bounds.max, POSITION);
+			}
+		}
+
+		// Enclose the children's subtrees (all of them are recomputed so that no descendant is left flagged)
+		for (const auto& child : mChildren) {
+			const std::pair<bool, Box2f>& CHILD_BOUNDS = child->getSubtreeBounds();
+			cullable = cullable && CHILD_BOUNDS.first;
+			bounds.min = min(bounds.min, CHILD_BOUNDS.second.min);
+			bounds.max = max(bounds.max, CHILD_BOUNDS.second.max);
+		}
+
+		mSubtreeBounds = std::make_pair(cullable, bounds);
+		mUpdateSubtreeBounds = false;
+		return mSubtreeBounds;
+	}
+
+	void Actor2D::setStatic(bool flag)
+	{
+		// The baked geometry is released when the subtree is traversed again
+		mStatic = flag;
+		mUpdateStaticGeometry = true;
+		if (!mStatic) {
+			mStaticGroups.clear();
+			mStaticGroups.shrink_to_fit();
+		}
+	}
+
+	bool Actor2D::isStatic() const noexcept
+	{
+		return mStatic;
+	}
+
+	void Actor2D::invalidateStaticGeometry() noexcept
+	{
+		// All of the static ancestors are flagged as the nested static nodes are baked into their static ancestors as well
+		for (Actor2D* node = this; node; node = node->mParent) {
+			node->mUpdateStaticGeometry = node->mUpdateStaticGeometry || node->mStatic;
+		}
+	}
+
+	// Public virtual method(s)
+	bool Actor2D::isMarkedForRemoval() const
+	{
+		return mMarkedForRemoval || isDestroyed();
+	}
+
+	bool Actor2D::isDestroyed() const
+	{
+		return false;
+	}
+
+	void Actor2D::correctProperties()
+	{
+		// The origin and alignment are resolved by the next layout pass
+		invalidateLayout();
+	}
+
+	void Actor2D::onTransformModified() noexcept
+	{
+		invalidateGlobalTransform();
+		invalidateBounds();
+		if (mHierarchy) {
+			mHierarchy->markDirty(mHierarchyIndex);
+		}
+	}
+
+	void Actor2D::render(RenderStates states)
+	{
+		AEON_PROFILE_SCOPE("Actor2D::render");
+
+		// The depths of the subtrees reparented since the last update are resolved before their geometry is submitted
+		if (!mParent) {
+			updateDepth(0, false);
+		}
+
+		// The cached global transforms replace the products of the transforms if the traversal starts from the parent's global transform
+		const bool GLOBAL_TRANSFORMS = traversalState.globalTransforms;
+		traversalState.globalTransforms = (mParent) ? (states.transform == mParent->getGlobalTransform()) : (states.transform == Matrix4f::identity());
+		renderNode(states);
+		traversalState.globalTransforms = GLOBAL_TRANSFORMS;
+	}
+
+	void Actor2D::renderParallel(RenderStates states, unsigned int threadCount)
+	{
+		AEON_PROFILE_SCOPE("Actor2D::renderParallel");
+
+		// Traverse the subtree sequentially if there aren't enough children to be split (the baked geometry of a static subtree is submitted as is)
+		JobSystem& jobSystem = JobSystem::getInstance();
+		if (threadCount == 0) {
+			threadCount = static_cast<unsigned int>(jobSystem.getWorkerCount() + 1);
+		}
+		const size_t GROUP_COUNT = std::min(static_cast<size_t>(threadCount), mChildren.size());
+		if (GROUP_COUNT <= 1 || mStatic || !isFunctionalityActive(Func::Render, Target::Children)) {
+			render(states);
+			return;
+		}
+
+		// Skip the subtree if it's situated outside the scene's view (the subtree's bounds are computed before the children are split)
+		const bool GLOBAL_TRANSFORMS = traversalState.globalTransforms;
+		traversalState.globalTransforms = (mParent) ? (states.transform == mParent->getGlobalTransform()) : (states.transform == Matrix4f::identity());
+		RenderTarget* const DAMAGE_TARGET = Renderer2D::getDamageTarget();
+		if (isCulled(states)) {
+			traversalState.globalTransforms = GLOBAL_TRANSFORMS;
+			if (DAMAGE_TARGET) {
+				std::pair<bool, Box2f> damage(false, Box2f());
+				releaseDamage(damage);
+				if (damage.first) {
+					DAMAGE_TARGET->addDamage(damage.second);
+				}
+			}
+			return;
+		}
+
+		states.transform *= getTransform();
+		if (mLayer.first) {
+			states.layer = mLayer.second;
+		}
+		if (DAMAGE_TARGET) {
+			trackDamage(*DAMAGE_TARGET, states.transform);
+		}
+
+		if (isFunctionalityActive(Func::Render, Target::Self)) {
+			renderSelf(states);
+		}
+		traversalState.globalTransforms = GLOBAL_TRANSFORMS;
+
+		// Record each contiguous group of children into its own command list (the children compare the traversal's transform with the node's global transform)
+		static_cast<void>(getGlobalTransform());
+		std::vector<RenderCommandList> commandLists(GROUP_COUNT);
+		const std::pair<bool, Box2f> CULLING_BOUNDS = Renderer2D::getCullingBounds();
+		const auto recordGroup = [this, &states, &commandLists, &CULLING_BOUNDS, DAMAGE_TARGET, GROUP_COUNT](size_t group) {
+			const size_t BEGIN = mChildren.size() * group / GROUP_COUNT;
+			const size_t END = mChildren.size() * (group + 1) / GROUP_COUNT;
+
+			// The executing thread adopts the caller thread's view bounds and damage target for the duration of the group
+			const std::pair<bool, Box2f> PREVIOUS_BOUNDS = Renderer2D::getCullingBounds();
+			RenderTarget* const PREVIOUS_TARGET = Renderer2D::getDamageTarget();
+			Renderer2D::setCullingBounds(CULLING_BOUNDS);
+			Renderer2D::setDamageTarget(DAMAGE_TARGET);
+			commandLists[group].beginRecording();
+			for (size_t i = BEGIN; i < END; ++i) {
+				mChildren[i]->render(states);
+			}
+			commandLists[group].endRecording();
+			Renderer2D::setCullingBounds(PREVIOUS_BOUNDS);
+			Renderer2D::setDamageTarget(PREVIOUS_TARGET);
+		};
+
+		// The groups are recorded by the job system's threads, including the calling one
+		jobSystem.parallelFor(GROUP_COUNT, [&recordGroup](size_t firstGroup, size_t lastGroup) {
+			for (size_t group = firstGroup; group < lastGroup; ++group) {
+				recordGroup(group);
+			}
+		}, 1);
+
+		// Submit the recorded lists in the groups' order to preserve the traversal order
+		for (RenderCommandList& commandList : commandLists) {
+			commandList.submit();
+		}
+	}
+
+	Box2f Actor2D::getModelBounds() const
+	{
+		return Box2f();
+	}
+
+	// Protected method(s)
+	void Actor2D::invalidateBounds() noexcept
+	{
+		// The parents' propagation stops at the first node already flagged as its parents are flagged as well
+		mUpdateSubtreeBounds = true;
+		for (Actor2D* node = mParent; node && !node->mUpdateSubtreeBounds && !isSyncNode(node); node = node->mParent) {
+			node->mUpdateSubtreeBounds = true;
+		}
+	}
+
+	void Actor2D::wake() noexcept
+	{
+		// The parents' propagation stops at the first node already awake as its parents are awake as well
+		mAwake = true;
+		mSubtreeAwake = true;
+		for (Actor2D* node = mParent; node && !node->mSubtreeAwake && !isSyncNode(node); node = node->mParent) {
+			node->mSubtreeAwake = true;
+		}
+	}
+
+	bool Actor2D::isLayoutDirty() const noexcept
+	{
+		return mUpdateLayout;
+	}
+
+	const std::vector<std::unique_ptr<Actor2D>>& Actor2D::getChildren() const noexcept
+	{
+		return mChildren;
+	}
+
+	// Protected virtual method(s)
+	bool Actor2D::hasPendingUpdate() const
+	{
+		// The update logic of derived classes is unknown
+		return typeid(*this) != typeid(Actor2D);
+	}
+
+	void Actor2D::onDepthModified()
+	{
+	}
+
+	void Actor2D::arrangeChildren()
+	{
+	}
+
+	bool Actor2D::isLayoutDependentOnChildren() const noexcept
+	{
+		return false;
+	}
+
+	// Private method(s)
+	void Actor2D::removeChildrenMarkedForRemoval()
+	{
+		// Only scan the children if at least one of them was marked for removal
+		if (mPendingRemovals == 0) {
+			return;
+		}
+		AEON_PROFILE_SCOPE("Actor2D::removeChildrenMarkedForRemoval");
+
+		// The regions covered by the removed children are redrawn and their indexed nodes are unregistered
+		mChildren.erase(std::remove_if(mChildren.begin(), mChildren.end(), [this](const std::unique_ptr<Actor2D>& child) {
+			if (child->mMarkedForRemoval) {
+				child->releaseDamage(mPendingDamage);
+				child->unindexSubtree(false);
+				return true;
+			}
+			return false;
+		}), mChildren.end());
+		mPendingRemovals = 0;
+		invalidateBounds();
+		invalidateStaticGeometry();
+	}
+
+	void Actor2D::invalidateDepth() noexcept
+	{
+		// The parents' propagation stops at the first node already flagged as its parents are flagged as well
+		mUpdateDepth = true;
+		for (Actor2D* node = mParent; node && !node->mUpdateSubtreeDepth && !isSyncNode(node); node = node->mParent) {
+			node->mUpdateSubtreeDepth = true;
+		}
+	}
+
+	void Actor2D::updateDepth(int depth, bool force)
+	{
+		// Skip the subtree if none of its nodes were reparented
+		if (!force && !mUpdateDepth && !mUpdateSubtreeDepth) {
+			return;
+		}
+
+		// Only the nodes whose depth changed rebuild their geometry, and their descendants are assigned the next depths
+		const bool MODIFIED = (force || mUpdateDepth) && mDepth != depth;
+		if (MODIFIED) {
+			mDepth = depth;
+			onDepthModified();
+		}
+		mUpdateDepth = false;
+		mUpdateSubtreeDepth = false;
+
+		for (auto& child : mChildren) {
+			child->updateDepth(mDepth + 1, MODIFIED);
+		}
+	}
+
+	void Actor2D::invalidateGlobalTransform() noexcept
+	{
+		if (mUpdateGlobalTransform) {
+			return;
+		}
+
+		mUpdateGlobalTransform = true;
+		mUpdateSubtreeBounds = true;
+		for (auto& child : mChildren) {
+			child->invalidateGlobalTransform();
+		}
+	}
+
+	void Actor2D::handleEventChildren(Event* const event)
+	{
+		for (auto& child : mChildren) {
+			child->handleEvent(event);
+			if (event->isPropagationStopped()) {
+				break;
+			}
+		}
+	}
+
+	bool Actor2D::updateChildren(const Time& dt)
+	{
+		bool childrenAwake = false;
+		for (auto& child : mChildren) {
+			if (!child->mSubtreeAwake) {
+				continue;
+			}
+
+			// The removal condition is polled after the update so that the child is removed during the next update
+			child->update(dt);
+			if (child->isMarkedForRemoval()) {
+				child->markForRemoval();
+			}
+			childrenAwake = childrenAwake || child->mSubtreeAwake;
+		}
+
+		return childrenAwake;
+	}
+
+	void Actor2D::renderChildren(RenderStates& states) const
+	{
+		for (const auto& child : mChildren) {
+			child->renderNode(states);
+		}
+	}
+
+	void Actor2D::renderNode(RenderStates& states)
+	{
+		// Skip the subtree if it's situated outside the scene's view (the regions it covered are redrawn)
+		RenderTarget* const DAMAGE_TARGET = Renderer2D::getDamageTarget();
+		const bool CULLING = states.culling;
+		if (isCulled(states)) {
+			if (DAMAGE_TARGET) {
+				std::pair<bool, Box2f> damage(false, Box2f());
+				releaseDamage(damage);
+				if (damage.first) {
+					DAMAGE_TARGET->addDamage(damage.second);
+				}
+			}
+			return;
+		}
+
+		// Push the parent's transform (the cached global transform is only recomputed if it was invalidated)
+		traversalState.transforms.push_back(states.transform);
+		const int LAYER = states.layer;
+		if (traversalState.globalTransforms) {
+			states.transform = getGlobalTransform();
+		}
+		else {
+			states.transform *= getTransform();
+		}
+		if (mLayer.first) {
+			states.layer = mLayer.second;
+		}
+		if (DAMAGE_TARGET) {
+			trackDamage(*DAMAGE_TARGET, states.transform);
+		}
+
+		// Submit the baked geometry instead of traversing the subtree if it's static
+		if (mStatic) {
+			renderStatic(states);
+		}
+		else {
+			if (isFunctionalityActive(Func::Render, Target::Self)) {
+				renderSelf(states);
+			}
+			if (isFunctionalityActive(Func::Render, Target::Children)) {
+				renderChildren(states);
+			}
+		}
+
+		// Restore the parent's states for its next children
+		states.transform = traversalState.transforms.back();
+		traversalState.transforms.pop_back();
+		states.layer = LAYER;
+		states.culling = CULLING;
+	}
+
+	void Actor2D::renderStatic(const RenderStates& states)
+	{
+		if (mUpdateStaticGeometry) {
+			bakeStaticGeometry(states);
+		}
+
+		// The groups are only flagged as dirty the first time they're submitted after being baked
+		for (StaticGroup& group : mStaticGroups) {
+			group.states.transform = states.transform;
+			Renderer2D::submitToActive(group.vertices, group.indices, group.states);
+			group.states.dirty = false;
+		}
+	}
+
+	void Actor2D::bakeStaticGeometry(const RenderStates& states)
+	{
+		AEON_PROFILE_SCOPE("Actor2D::bakeStaticGeometry");
+
+		// Record the subtree's submissions relative to the static node, without culling any of them (the static node damages the subtree's bounds as a whole)
+		RenderStates bakeStates(states);
+		bakeStates.transform = Matrix4f::identity();
+		bakeStates.culling = false;
+		const bool GLOBAL_TRANSFORMS = std::exchange(traversalState.globalTransforms, false);
+
+		RenderTarget* const DAMAGE_TARGET = Renderer2D::getDamageTarget();
+		Renderer2D::setDamageTarget(nullptr);
+		RenderCommandList commandList(RenderCommandList::Storage::Reference);
+		commandList.beginRecording();
+		if (isFunctionalityActive(Func::Render, Target::Self)) {
+			renderSelf(bakeStates);
+		}
+		if (isFunctionalityActive(Func::Render, Target::Children)) {
+			renderChildren(bakeStates);
+		}
+		commandList.endRecording();
+		Renderer2D::setDamageTarget(DAMAGE_TARGET);
+		traversalState.globalTransforms = GLOBAL_TRANSFORMS;
+
+		// Merge the submissions sharing the same render states (and the same translucency so that the opaque ones remain in the opaque pass)
+		mStaticGroups.clear();
+		bool skippedDrawcalls = false;
+		for (const RenderCommandList::RenderCommand& command : commandList.getCommands()) {
+			if (command.type != RenderCommandList::Type::Submit) {
+				skippedDrawcalls = skippedDrawcalls || command.type == RenderCommandList::Type::Draw;
+				continue;
+			}
+
+			const RenderStates& SUBMISSION_STATES = command.states;
+			const bool TRANSLUCENT = std::any_of(command.vertices->begin(), command.vertices->end(), [](const Vertex2D& vertex) {
+				return vertex.color.w < 1.f;
+			});
+			auto groupItr = std::find_if(mStaticGroups.begin(), mStaticGroups.end(), [&SUBMISSION_STATES, TRANSLUCENT](const StaticGroup& group) {
+				return group.translucent == TRANSLUCENT && group.states.shader == SUBMISSION_STATES.shader && group.states.texture == SUBMISSION_STATES.texture
+				    && group.states.sampler == SUBMISSION_STATES.sampler && group.states.blendMode == SUBMISSION_STATES.blendMode && group.states.clipRect == SUBMISSION_STATES.clipRect
+				    && group.states.transparency == SUBMISSION_STATES.transparency && group.states.layer == SUBMISSION_STATES.layer;
+			});
+			if (groupItr == mStaticGroups.end()) {
+				mStaticGroups.push_back(StaticGroup{ {}, {}, SUBMISSION_STATES, TRANSLUCENT });
+				groupItr = std::prev(mStaticGroups.end());
+			}
+
+			// Append the transformed vertices and the offset indices
+			StaticGroup& group = *groupItr;
+			const unsigned int VERTEX_OFFSET = static_cast<unsigned int>(group.vertices.size());
+			group.vertices.resize(group.vertices.size() + command.vertices->size());
+			Math::transformPoints2D(SUBMISSION_STATES.transform, command.vertices->data(), group.vertices.data() + VERTEX_OFFSET, command.vertices->size());
+			group.indices.reserve(group.indices.size() + command.indices->size());
+			for (const unsigned int INDEX : *command.indices) {
+				group.indices.push_back(INDEX + VERTEX_OFFSET);
+			}
+		}
+
+		// The groups are resubmitted as modified once
+		for (StaticGroup& group : mStaticGroups) {
+			group.states.dirty = true;
+		}
+		mUpdateStaticGeometry = false;
+
+		// Inform the user that the custom drawcalls were skipped (ignored in Release mode)
+		if _CONSTEXPR_IF (AEON_DEBUG) {
+			if (skippedDrawcalls) {
+				AEON_LOG_WARNING("Unbaked drawcalls", "The static subtree contains custom drawcalls which can't be baked.\nThey won't be rendered.");
+			}
+		}
+	}
+
+	void Actor2D::trackDamage(RenderTarget& target, const Matrix4f& transform)
+	{
+		mDamageTracked = true;
+
+		// The children that are no longer rendered damage the regions they covered
+		if (!mStatic && !isFunctionalityActive(Func::Render, Target::Children)) {
+			for (auto& child : mChildren) {
+				child->releaseDamage(mPendingDamage);
+			}
+		}
+
+		// The geometry damages the region it covered and the one it now covers if it was modified or moved (a static node's geometry is its entire subtree)
+		const bool RENDERED = mStatic || isFunctionalityActive(Func::Render, Target::Self);
+		const bool MODIFIED = (mStatic) ? mUpdateStaticGeometry : isDirty();
+		if (!RENDERED || MODIFIED || transform != mDamageTransform) {
+			if (mDamageBounds.first) {
+				mergeDamage(mPendingDamage, mDamageBounds.second);
+				mDamageBounds.first = false;
+			}
+
+			if (RENDERED && mStatic) {
+				// The region covered by a subtree that can't be culled is unknown
+				mDamageBounds = getSubtreeBounds();
+				if (!mDamageBounds.first) {
+					target.invalidate();
+				}
+			}
+			else if (RENDERED) {
+				const Box2f MODEL_BOUNDS = getModelBounds();
+				if (MODEL_BOUNDS.min != MODEL_BOUNDS.max) {
+					const Vector2f CORNERS[4] = {
+						Vector2f(transform * Vector3f(MODEL_BOUNDS.min)), Vector2f(transform * Vector3f(MODEL_BOUNDS.max)),
+						Vector2f(transform * Vector3f(MODEL_BOUNDS.min.x, MODEL_BOUNDS.max.y, 0.f)), Vector2f(transform * Vector3f(MODEL_BOUNDS.max.x, MODEL_BOUNDS.min.y, 0.f))
+					};
+					mDamageBounds = std::make_pair(true, Box2f(min(min(CORNERS[0], CORNERS[1]), min(CORNERS[2], CORNERS[3])), max(max(CORNERS[0], CORNERS[1]), max(CORNERS[2], CORNERS[3]))));
+				}
+			}
+
+			if (mDamageBounds.first) {
+				mergeDamage(mPendingDamage, mDamageBounds.second);
+			}
+			mDamageTransform = (RENDERED) ? transform : Matrix4f();
+		}
+
+		if (mPendingDamage.first) {
+			target.addDamage(mPendingDamage.second);
+			mPendingDamage.first = false;
+		}
+	}
+
+	void Actor2D::releaseDamage(std::pair<bool, Box2f>& damage) noexcept
+	{
+		// The subtrees that weren't rendered onto a damage-tracked target since their last release are skipped
+		if (!mDamageTracked) {
+			return;
+		}
+
+		if (mDamageBounds.first) {
+			mergeDamage(damage, mDamageBounds.second);
+			mDamageBounds.first = false;
+		}
+		if (mPendingDamage.first) {
+			mergeDamage(damage, mPendingDamage.second);
+			mPendingDamage.first = false;
+		}
+		mDamageTransform = Matrix4f();
+
+		for (auto& child : mChildren) {
+			child->releaseDamage(damage);
+		}
+		mDamageTracked = false;
+	}
+
+	bool Actor2D::isCulled(RenderStates& states)
+	{
+		const std::pair<bool, Box2f>& VIEW_BOUNDS = Renderer2D::getCullingBounds();
+		if (!states.culling || !VIEW_BOUNDS.first) {
+			return false;
+		}
+
+		// The cached bounds are only valid if the traversal's transform matches the parent's cached global transform (which is known if the traversal uses them)
+		if (!traversalState.globalTransforms) {
+			states.culling = (mParent) ? (states.transform == mParent->getGlobalTransform()) : (states.transform == Matrix4f::identity());
+			if (!states.culling) {
+				return false;
+			}
+		}
+
+		const std::pair<bool, Box2f>& SUBTREE_BOUNDS = getSubtreeBounds();
+		return SUBTREE_BOUNDS.first && !SUBTREE_BOUNDS.second.intersects(VIEW_BOUNDS.second);
+	}
+
+	bool Actor2D::isFunctionalityActive(uint32_t func, uint32_t target) const noexcept
+	{
+		const uint8_t MASK = getFuncMask(func, target);
+		return (mFuncs & MASK) == MASK;
+	}
+
+	const Actor2D& Actor2D::getRootNode() const noexcept
+	{
+		const Actor2D* root = this;
+		while (root->mParent) {
+			root = root->mParent;
+		}
+		return *root;
+	}
+
+	void Actor2D::indexSubtree()
+	{
+		if (mIndexedNodes == 0) {
+			return;
+		}
+		std::unique_lock<std::mutex> lock = lockIndex();
+
+		// Retrieve the new root's index, creating it if the tree had no indexed nodes
+		std::unique_ptr<LookupIndex>& index = const_cast<Actor2D&>(getRootNode()).mIndex;
+		if (!index) {
+			index = std::make_unique<LookupIndex>();
+		}
+
+		// Merge the subtree's own index if it was a root node, otherwise traverse its indexed branches
+		if (mIndex) {
+			for (const auto& [NAME, NODES] : mIndex->names) {
+				std::vector<Actor2D*>& nodes = index->names[NAME];
+				nodes.insert(nodes.end(), NODES.begin(), NODES.end());
+			}
+			for (const auto& [TAG, NODES] : mIndex->tags) {
+				std::vector<Actor2D*>& nodes = index->tags[TAG];
+				nodes.insert(nodes.end(), NODES.begin(), NODES.end());
+			}
+			mIndex.reset();
+		}
+		else {
+			registerSubtree(*index);
+		}
+
+		for (Actor2D* node = mParent; node; node = node->mParent) {
+			node->mIndexedNodes += mIndexedNodes;
+		}
+	}
+
+	void Actor2D::unindexSubtree(bool keepIndex)
+	{
+		if (mIndexedNodes == 0) {
+			return;
+		}
+		std::unique_lock<std::mutex> lock = lockIndex();
+
+		// Move the subtree's entries from the root's index to the subtree's own index if it's kept
+		Actor2D& root = const_cast<Actor2D&>(getRootNode());
+		if (root.mIndex) {
+			unregisterSubtree(*root.mIndex);
+		}
+		if (keepIndex) {
+			mIndex = std::make_unique<LookupIndex>();
+			registerSubtree(*mIndex);
+		}
+
+		for (Actor2D* node = mParent; node; node = node->mParent) {
+			node->mIndexedNodes -= mIndexedNodes;
+		}
+
+		// The root's index is released once its tree has no indexed nodes left
+		if (root.mIndexedNodes == 0) {
+			root.mIndex.reset();
+		}
+	}
+
+	void Actor2D::registerSubtree(LookupIndex& index) const
+	{
+		if (mIndexedNodes == 0) {
+			return;
+		}
+
+		Actor2D* const NODE = const_cast<Actor2D*>(this);
+		if (!mName.empty()) {
+			addIndexEntry(index.names, mName, NODE);
+		}
+		for (const std::string& tag : mTags) {
+			addIndexEntry(index.tags, tag, NODE);
+		}
+		for (const auto& child : mChildren) {
+			child->registerSubtree(index);
+		}
+	}
+
+	void Actor2D::unregisterSubtree(LookupIndex& index) const
+	{
+		if (mIndexedNodes == 0) {
+			return;
+		}
+
+		if (!mName.empty()) {
+			removeIndexEntry(index.names, mName, this);
+		}
+		for (const std::string& tag : mTags) {
+			removeIndexEntry(index.tags, tag, this);
+		}
+		for (const auto& child : mChildren) {
+			child->unregisterSubtree(index);
+		}
+	}
+
+	void Actor2D::updateIndexedNodes(bool wasIndexed) noexcept
+	{
+		const bool INDEXED = !mName.empty() || !mTags.empty();
+		if (INDEXED == wasIndexed) {
+			return;
+		}
+
+		// Update the counts of the node and of every parent until the root node is reached
+		for (Actor2D* node = this; node; node = node->mParent) {
+			node->mIndexedNodes = INDEXED ? node->mIndexedNodes + 1 : node->mIndexedNodes - 1;
+		}
+
+		// The root's index is created alongside the tree's first indexed node and released alongside its last
+		Actor2D& root = const_cast<Actor2D&>(getRootNode());
+		if (INDEXED && !root.mIndex) {
+			root.mIndex = std::make_unique<LookupIndex>();
+		}
+		else if (root.mIndexedNodes == 0) {
+			root.mIndex.reset();
+		}
+	}
+
+	void Actor2D::repointIndexEntries(LookupIndex& index, const Actor2D* previous) const noexcept
+	{
+		// Replaces the previous node by the caller in the entries of the key
+		auto repoint = [this, previous](std::unordered_map<std::string, std::vector<Actor2D*>>& entries, const std::string& key) {
+			const auto FOUND_ITR = entries.find(key);
+			if (FOUND_ITR != entries.end()) {
+				std::replace(FOUND_ITR->second.begin(), FOUND_ITR->second.end(), const_cast<Actor2D*>(previous), const_cast<Actor2D*>(this));
+			}
+		};
+
+		if (!mName.empty()) {
+			repoint(index.names, mName);
+		}
+		for (const std::string& tag : mTags) {
+			repoint(index.tags, tag);
 		}
 	}
 
 	// Private virtual method(s)
+	void Actor2D::captureEventSelf(Event* const event)
+	{
+	}
+
 	void Actor2D::handleEventSelf(Event* const event)
 	{
 	}
@@ -317,7 +1787,12 @@ namespace ae
 	{
 	}
 
-	void Actor2D::renderSelf(RenderStates states) const
+	void Actor2D::renderSelf(const RenderStates& states) const
+	{
+	}
+
+	std::unique_ptr<Actor2D> Actor2D::cloneSelf() const
 	{
+		return std::make_unique<Actor2D>(*this);
 	}
 }
\ No newline at end of file
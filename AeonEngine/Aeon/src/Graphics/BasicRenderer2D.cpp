@@ -24,6 +24,7 @@
 
 #include <GL/glew.h>
 
+#include <AEON/Math/Transform2D.h>
 #include <AEON/Graphics/internal/GLCommon.h>
 #include <AEON/Graphics/internal/RenderTarget.h>
 #include <AEON/Graphics/internal/VertexArray.h>
@@ -33,23 +34,30 @@
 #include <AEON/Graphics/Shader.h>
 #include <AEON/Graphics/Texture2D.h>
 #include <AEON/Graphics/Renderable2D.h>
+#include <AEON/System/FrameArena.h>
+#include <AEON/System/MemoryTracker.h>
 
 namespace ae
 {
 	// Public virtual method(s)
 	void BasicRenderer2D::beginScene(RenderTarget& target)
 	{
-		// Assign the new render target and uploads its camera's properties
+		// Assign the new render target and uploads its camera's properties (the scene is only recorded if the calling thread is recording)
 		Renderer2D::beginScene(target);
+		if (isRecording()) {
+			return;
+		}
 
 		// Enable depth-testing, activate the render target and bind the VAO used for the drawcalls
-		GLCall(glEnable(GL_DEPTH_TEST));
+		gl::setCapability(GL_DEPTH_TEST, true);
 		mRenderTarget->activate();
 		mVAO->bind();
 	}
 
-	void BasicRenderer2D::submit(const std::vector<Vertex2D>& vertices, const std::vector<unsigned int>& indices, const RenderStates& states)
+	void BasicRenderer2D::submit(const Vertex2DList& vertices, const std::vector<unsigned int>& indices, const RenderStates& states)
 	{
+		AEON_MEMORY_SCOPE(MemoryTag::Renderer);
+
 		// Check if the shader provided is valid (ignored in Release mode)
 		if _CONSTEXPR_IF (AEON_DEBUG) {
 			if (!states.shader) {
@@ -62,32 +70,17 @@ namespace ae
 		states.shader->bind();
 
 		// Set the appropriate blending
-		if (states.blendMode != BlendMode::BlendNone) {
-			GLCall(glEnable(GL_BLEND));
-			GLCall(glBlendEquationSeparate(states.blendMode.colorEquation, states.blendMode.alphaEquation));
-			GLCall(glBlendFuncSeparate(states.blendMode.colorSrcFactor, states.blendMode.colorDstFactor,
-			                           states.blendMode.alphaSrcFactor, states.blendMode.alphaDstFactor));
-		}
-		else {
-			GLCall(glDisable(GL_BLEND));
-		}
+		applyBlendMode(states.blendMode);
 
-		// Bind the texture provided or the 1x1 white texture for untextured geometry
-		const Texture* const texture = (!states.texture) ? mWhiteTexture.get() : states.texture;
-		texture->bind();
-
-		// Apply the transform to the vertices
-		std::vector<Vertex2D> transformVertices;
-		transformVertices.reserve(vertices.size());
-		for (const Vertex2D& vertex : vertices) {
-			transformVertices.emplace_back(
-				Vertex2D {
-					Vector3f((states.transform * Vector3f(vertex.position.xy)).xy, vertex.position.z),
-					vertex.color,
-					vertex.uv
-				}
-			);
-		}
+		// Bind the texture provided or the 1x1 white texture for untextured geometry, alongside its sampler
+		bindTexture(states.texture, states.sampler);
+
+		// Restrict the drawcall to the clip rect (an empty one disables the scissor test)
+		gl::setScissor(states.clipRect.x, states.clipRect.y, states.clipRect.z, states.clipRect.w);
+
+		// Apply the transform to the vertices (the transformed copy is discarded once the frame ends)
+		FrameVector<Vertex2D> transformVertices(vertices.size());
+		Math::transformPoints2D(states.transform, vertices.data(), transformVertices.data(), vertices.size());
 
 		// Upload the vertices
 		VertexBuffer* const vbo = mVAO->getVBO(0);
@@ -99,12 +92,8 @@ namespace ae
 
 		// Render the geometry
 		GLCall(glDrawElements(GL_TRIANGLES, ibo->getCount(), GL_UNSIGNED_INT, nullptr));
-
-		// Unbind the texture
-		texture->unbind();
-
-		// Unbind the shader
-		states.shader->unbind();
+		++mStatistics.submissions;
+		recordDrawCall(vertices.size(), indices.size(), sizeof(Vertex2D) * vertices.size() + sizeof(GLuint) * indices.size());
 	}
 
 	// Public static method(s)
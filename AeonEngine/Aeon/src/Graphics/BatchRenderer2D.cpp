@@ -22,83 +22,466 @@
 
 #include <AEON/Graphics/BatchRenderer2D.h>
 
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+
 #include <GL/glew.h>
 
+#include <AEON/System/MemoryTracker.h>
+#include <AEON/System/Profiler.h>
+#include <AEON/Math/Transform2D.h>
 #include <AEON/Graphics/internal/GLCommon.h>
 #include <AEON/Graphics/internal/RenderTarget.h>
 #include <AEON/Graphics/BlendMode.h>
 #include <AEON/Graphics/Camera.h>
 #include <AEON/Graphics/GLResourceFactory.h>
+#include <AEON/Graphics/GPUProfiler.h>
 #include <AEON/Graphics/Renderable2D.h>
 #include <AEON/Graphics/RenderStates.h>
 
 namespace ae
 {
+	namespace
+	{
+		// The number of vertices and indices that the GPU arenas can keep resident
+		constexpr int ARENA_VERTEX_CAPACITY = 262144;
+		constexpr int ARENA_INDEX_CAPACITY = 393216;
+		// The index terminating the chains of submissions sharing a list of vertices
+		constexpr size_t NO_SUBMISSION = SIZE_MAX;
+		// The number of submissions from which a batch is radix sorted instead of comparison sorted
+		constexpr size_t RADIX_SORT_THRESHOLD = 256;
+
+		// Retrieve the depth of a list of vertices' first vertex
+		float getFrontDepth(const Vertex2DList& vertices) noexcept
+		{
+			return (vertices.empty()) ? 0.f : vertices.front().position.z;
+		}
+
+		// Convert a depth to an unsigned integer preserving the floating point order
+		uint32_t getDepthKey(float depth) noexcept
+		{
+			uint32_t key = 0;
+			std::memcpy(&key, &depth, sizeof(key));
+			return (key & 0x80000000u) ? ~key : key | 0x80000000u;
+		}
+
+		// Retrieve the key of a clip pass (all empty regions share the same key)
+		std::array<int, 4> getClipKey(const Vector4i& clipRect) noexcept
+		{
+			if (clipRect.z <= 0 || clipRect.w <= 0) {
+				return { 0, 0, 0, 0 };
+			}
+			return { clipRect.x, clipRect.y, clipRect.z, clipRect.w };
+		}
+
+		// Checks whether the indices provided form a list of quads (0, 1, 2, 0, 2, 3, offset by 4 for each quad)
+		bool isQuadList(const std::vector<unsigned int>& indices, size_t vertexCount) noexcept
+		{
+			if (vertexCount % 4 != 0 || indices.size() != vertexCount / 4 * 6) {
+				return false;
+			}
+
+			constexpr unsigned int PATTERN[6] = { 0, 1, 2, 0, 2, 3 };
+			for (size_t i = 0; i < indices.size(); ++i) {
+				if (indices[i] != static_cast<unsigned int>(i / 6 * 4) + PATTERN[i % 6]) {
+					return false;
+				}
+			}
+			return true;
+		}
+	}
+
+	// Public method(s)
+	void BatchRenderer2D::setMode(Mode mode)
+	{
+		if (mMode == mode) {
+			return;
+		}
+
+		// Discard the cached batches and the pending draw commands
+		mOpaqueCalls.clear();
+		mTransparentCalls.clear();
+		mCommands.clear();
+		mSortEntries.clear();
+		mLayers.clear();
+		mVertexArena.clear();
+		mIndexArena.clear();
+
+		mMode = mode;
+		restoreProxies();
+	}
+
+	BatchRenderer2D::Mode BatchRenderer2D::getMode() const noexcept
+	{
+		return mMode;
+	}
+
+	void BatchRenderer2D::setGPUTransforms(bool enabled)
+	{
+		if (mGPUTransforms == enabled) {
+			return;
+		}
+
+		// Discard the cached batches as their shaders and vertices differ
+		mOpaqueCalls.clear();
+		mTransparentCalls.clear();
+		mVertexArena.clear();
+		mIndexArena.clear();
+
+		mGPUTransforms = enabled;
+		restoreProxies();
+	}
+
+	bool BatchRenderer2D::hasGPUTransforms() const noexcept
+	{
+		return mGPUTransforms;
+	}
+
+	void BatchRenderer2D::setMemoryResource(std::pmr::memory_resource* resource)
+	{
+		// Discard the cached batches so that nothing is allocated from the previous resource
+		mOpaqueCalls.clear();
+		mTransparentCalls.clear();
+		mVertexArena.clear();
+		mIndexArena.clear();
+
+		mPassResource.setUpstream(resource);
+		restoreProxies();
+	}
+
+	void BatchRenderer2D::setMultiTextureBatching(bool enabled) noexcept
+	{
+		mMultiTexture = enabled;
+	}
+
+	bool BatchRenderer2D::hasMultiTextureBatching() const noexcept
+	{
+		return mMultiTexture;
+	}
+
+	void BatchRenderer2D::setVertexFormat(VertexFormat format) noexcept
+	{
+		mVertexFormat = format;
+	}
+
+	BatchRenderer2D::VertexFormat BatchRenderer2D::getVertexFormat() const noexcept
+	{
+		return mVertexFormat;
+	}
+
+	void BatchRenderer2D::setIndirectDrawing(bool enabled) noexcept
+	{
+		mIndirect = enabled;
+	}
+
+	bool BatchRenderer2D::hasIndirectDrawing() const noexcept
+	{
+		return mIndirect;
+	}
+
+	uint32_t BatchRenderer2D::registerProxy(const Vertex2DList& vertices, const std::vector<unsigned int>& indices, const RenderStates& states)
+	{
+		// Reuse the slot of an unregistered proxy if there's one
+		uint32_t proxy = 0;
+		if (!mFreeProxies.empty()) {
+			proxy = mFreeProxies.back();
+			mFreeProxies.pop_back();
+		}
+		else {
+			proxy = static_cast<uint32_t>(mProxies.size());
+			mProxies.emplace_back();
+		}
+
+		ProxyData& data = mProxies[proxy];
+		data.states = states;
+		data.vertexList = &vertices;
+		data.indexList = &indices;
+		data.batch = nullptr;
+		data.transparent = isTransparent(vertices, states);
+		data.visible = true;
+		data.registered = true;
+
+		// The proxy's submission is laid out in its batch once the scene ends
+		if (mMode == Mode::Cached) {
+			insertProxy(data);
+		}
+
+		return proxy;
+	}
+
+	void BatchRenderer2D::unregisterProxy(uint32_t proxy)
+	{
+		// Check if the proxy is registered (ignored in Release mode)
+		if _CONSTEXPR_IF (AEON_DEBUG) {
+			if (!isProxyRegistered(proxy)) {
+				AEON_LOG_ERROR("Invalid proxy", "The proxy provided isn't registered.\nAborting operation.");
+				return;
+			}
+		}
+
+		ProxyData& data = mProxies[proxy];
+		removeProxy(data);
+		data.vertexList = nullptr;
+		data.indexList = nullptr;
+		data.registered = false;
+		mFreeProxies.push_back(proxy);
+	}
+
+	void BatchRenderer2D::updateProxy(uint32_t proxy, const Vertex2DList& vertices, const std::vector<unsigned int>& indices, const RenderStates& states)
+	{
+		// Check if the proxy is registered (ignored in Release mode)
+		if _CONSTEXPR_IF (AEON_DEBUG) {
+			if (!isProxyRegistered(proxy)) {
+				AEON_LOG_ERROR("Invalid proxy", "The proxy provided isn't registered.\nAborting operation.");
+				return;
+			}
+		}
+
+		// The transparency only needs to be deduced anew if the geometry or the states it depends on were modified
+		ProxyData& data = mProxies[proxy];
+		const bool PASS_MODIFIED = states.shader != data.states.shader || states.blendMode != data.states.blendMode || states.texture != data.states.texture || states.sampler != data.states.sampler
+		                        || getClipKey(states.clipRect) != getClipKey(data.states.clipRect) || states.transparency != data.states.transparency;
+		const bool TRANSPARENT = (PASS_MODIFIED || states.dirty) ? isTransparent(vertices, states) : data.transparent;
+
+		// Move the proxy to another batch if it no longer belongs to the same one (or if its geometry is now stored elsewhere)
+		if (PASS_MODIFIED || TRANSPARENT != data.transparent || &vertices != data.vertexList) {
+			removeProxy(data);
+			data.states = states;
+			data.vertexList = &vertices;
+			data.indexList = &indices;
+			data.transparent = TRANSPARENT;
+			if (data.visible && mMode == Mode::Cached) {
+				insertProxy(data);
+			}
+			return;
+		}
+
+		data.states = states;
+		data.indexList = &indices;
+		if (!data.batch) {
+			return;
+		}
+
+		// Only flag the proxy's submission as modified if its geometry or its transform changed
+		SubmissionData& submission = data.batch->submissions[data.batch->lookup.find(data.vertexList)->second];
+		if (states.dirty) {
+			submission.indexList = &indices;
+			submission.depth = getFrontDepth(vertices);
+			submission.dirty = true;
+			data.batch->retainedModified = true;
+		}
+		if (submission.transform != states.transform) {
+			submission.transform = states.transform;
+			submission.transformDirty = true;
+			data.batch->retainedModified = true;
+		}
+	}
+
+	void BatchRenderer2D::setProxyTransform(uint32_t proxy, const Matrix4f& transform)
+	{
+		// Check if the proxy is registered (ignored in Release mode)
+		if _CONSTEXPR_IF (AEON_DEBUG) {
+			if (!isProxyRegistered(proxy)) {
+				AEON_LOG_ERROR("Invalid proxy", "The proxy provided isn't registered.\nAborting operation.");
+				return;
+			}
+		}
+
+		ProxyData& data = mProxies[proxy];
+		data.states.transform = transform;
+		if (!data.batch) {
+			return;
+		}
+
+		SubmissionData& submission = data.batch->submissions[data.batch->lookup.find(data.vertexList)->second];
+		if (submission.transform != transform) {
+			submission.transform = transform;
+			submission.transformDirty = true;
+			data.batch->retainedModified = true;
+		}
+	}
+
+	void BatchRenderer2D::setProxyVisible(uint32_t proxy, bool visible)
+	{
+		// Check if the proxy is registered (ignored in Release mode)
+		if _CONSTEXPR_IF (AEON_DEBUG) {
+			if (!isProxyRegistered(proxy)) {
+				AEON_LOG_ERROR("Invalid proxy", "The proxy provided isn't registered.\nAborting operation.");
+				return;
+			}
+		}
+
+		ProxyData& data = mProxies[proxy];
+		if (data.visible == visible) {
+			return;
+		}
+
+		data.visible = visible;
+		if (!visible) {
+			removeProxy(data);
+		}
+		else if (mMode == Mode::Cached) {
+			insertProxy(data);
+		}
+	}
+
 	// Public virtual method(s)
 	void BatchRenderer2D::endScene()
 	{
-		GLCall(glEnable(GL_DEPTH_TEST));
+		AEON_MEMORY_SCOPE(MemoryTag::Renderer);
+
+		// Only record the scene's termination if the calling thread is recording
+		if (isRecording()) {
+			Renderer2D::endScene();
+			return;
+		}
+		markSceneEnd();
+
+		// The retained proxies aren't cached in the sort key and layered modes, they're recorded along with the scene's submissions
+		if (mMode != Mode::Cached) {
+			for (const ProxyData& proxy : mProxies) {
+				if (!proxy.registered || !proxy.visible) {
+					continue;
+				}
+
+				if (mMode == Mode::SortKey) {
+					submitCommand(*proxy.vertexList, *proxy.indexList, proxy.states);
+				}
+				else {
+					submitLayered(*proxy.vertexList, *proxy.indexList, proxy.states);
+				}
+			}
+		}
+
+		// The layered mode relies on the layers' order instead of the depth buffer
+		gl::setCapability(GL_DEPTH_TEST, mMode != Mode::Layered);
+		gl::setScissor(0, 0, 0, 0);
 		mRenderTarget->activate();
-		mVAO->bind();
+		applyViewports();
+		mStreamVAO->bind();
+
+		if (mMode == Mode::Layered) {
+			// Render the layers from the lowest to the highest, each in submission order
+			AEON_PROFILE_SCOPE("BatchRenderer2D layered flush");
+			AEON_PROFILE_GPU_SCOPE("BatchRenderer2D layered flush");
+			flushLayers();
+		}
+		else if (mMode == Mode::SortKey) {
+			// Render the sorted draw commands (opaque entities front-to-back followed by transparent entities back-to-front)
+			AEON_PROFILE_SCOPE("BatchRenderer2D sorted flush");
+			AEON_PROFILE_GPU_SCOPE("BatchRenderer2D sorted flush");
+			flushCommands();
+		}
+		else {
+			// Render opaque entities front-to-back
+			Profiler& profiler = Profiler::getInstance();
+			GPUProfiler& gpuProfiler = GPUProfiler::getInstance();
+			profiler.beginScope("BatchRenderer2D opaque flush");
+			gpuProfiler.beginScope("BatchRenderer2D opaque flush");
+			flush(mOpaqueCalls, true);
+			gpuProfiler.endScope();
+			profiler.endScope();
+
+			// Render transparent entities back-to-front
+			profiler.beginScope("BatchRenderer2D transparent flush");
+			gpuProfiler.beginScope("BatchRenderer2D transparent flush");
+			flush(mTransparentCalls, false);
+			gpuProfiler.endScope();
+			profiler.endScope();
+		}
 
-		// Render opaque entities front-to-back
-		flush(mOpaqueCalls, true);
+		// Fence the rings' current regions so that they're not overwritten while OpenGL is still reading from them
+		mVertexRing.lock();
+		mIndexRing.lock();
+		mPackedVertexRing.lock();
+		mPackedIndexRing.lock();
+		mDrawIDRing.lock();
+		mModelRing.lock();
+		mTextureSlotRing.lock();
+		mIndirectRing.lock();
+		mStreamVAO->unbind();
 
-		// Render transparent entities back-to-front
-		flush(mTransparentCalls, false);
+		// Fence the ranges released by the modified batches and reclaim the ones that OpenGL is done with
+		mVertexArena.lock();
+		mIndexArena.lock();
 
 		// Unbind the VAO, disable depth-testing and invalidate scene-specific pointers
 		Renderer2D::endScene();
 	}
 
-	void BatchRenderer2D::submit(const std::vector<Vertex2D>& vertices, const std::vector<unsigned int>& indices, const RenderStates& states)
+	void BatchRenderer2D::submit(const Vertex2DList& vertices, const std::vector<unsigned int>& indices, const RenderStates& states)
 	{
-		// Check if the submission is opaque or transparent
-		ShaderPasses& drawcalls = (vertices.front().color.w < 1.f) ? mTransparentCalls : mOpaqueCalls;
+		AEON_MEMORY_SCOPE(MemoryTag::Renderer);
 
-		// Find an existing shader pass or create one
-		auto shaderItr = drawcalls.find(states.shader);
-		if (shaderItr == drawcalls.end()) {
-			shaderItr = drawcalls.emplace(states.shader, BlendPasses()).first;
-		}
+		++mStatistics.submissions;
 
-		// Find an existing blend pass or create one
-		BlendPasses& blendPasses = shaderItr->second;
-		auto blendItr = blendPasses.find(states.blendMode);
-		if (blendItr == blendPasses.end()) {
-			blendItr = blendPasses.emplace(states.blendMode, TexturePasses()).first;
+		// Simply record the submission if the sort key mode or the layered mode is active
+		if (mMode == Mode::SortKey) {
+			submitCommand(vertices, indices, states);
+			return;
+		}
+		if (mMode == Mode::Layered) {
+			submitLayered(vertices, indices, states);
+			return;
 		}
 
-		// Find an existing texture pass or create one
-		TexturePasses& texturePasses = blendItr->second;
-		const Texture* const texture = (!states.texture) ? mWhiteTexture.get() : states.texture;
-		auto textureItr = texturePasses.find(texture);
-		if (textureItr == texturePasses.end()) {
-			textureItr = texturePasses.emplace(texture, RenderData()).first;
+		// Retrieve the batch in which the submission is cached
+		RenderData& data = getBatch(states, isTransparent(vertices, states));
+
+		// Check if submission is cached (the renderables sharing a list of vertices are matched to its submissions in the order they're submitted)
+		auto submissionItr = data.lookup.find(&vertices);
+		size_t index = (submissionItr != data.lookup.end()) ? submissionItr->second : NO_SUBMISSION;
+		size_t previous = NO_SUBMISSION;
+		if (index != NO_SUBMISSION && data.submissions[index].resubmitted) {
+			auto cursorItr = data.sharedCursors.try_emplace(&vertices, index).first;
+			previous = cursorItr->second;
+			index = data.submissions[previous].nextShared;
+			cursorItr->second = (index != NO_SUBMISSION) ? index : data.submissions.size();
 		}
 
-		// Check if submission is cached
-		auto submissionItr = textureItr->second.lookup.find(&vertices);
-		if (submissionItr != textureItr->second.lookup.end()) {
-			if (states.dirty || submissionItr->second->transform != states.transform) {
-				submissionItr->second->transform = states.transform;
-				submissionItr->second->vertexList = &vertices;
-				submissionItr->second->indexList = &indices;
-				submissionItr->second->dirty = true;
+		if (index != NO_SUBMISSION) {
+			SubmissionData& submission = data.submissions[index];
+			data.retainedModified = data.retainedModified || submission.retained;
+			if (states.dirty) {
+				submission.vertexList = &vertices;
+				submission.depth = getFrontDepth(vertices);
+				submission.dirty = true;
 			}
-			else {
-				submissionItr->second->resubmitted = true;
+			// The renderables sharing a list of vertices share its topology, so the submission only references the current submitter's indices
+			submission.indexList = &indices;
+			if (submission.transform != states.transform) {
+				submission.transform = states.transform;
+				submission.transformDirty = true;
 			}
+			submission.resubmitted = true;
+			++mStatistics.cachedSubmissions;
 		}
 		else {
-			// Create the submission
-			textureItr->second.submissions.emplace_back(
+			// Create the submission (its geometry will be laid out in the batch once the scene ends), chained to the previous one sharing its vertices
+			if (previous != NO_SUBMISSION) {
+				data.submissions[previous].nextShared = data.submissions.size();
+			}
+			else {
+				data.lookup.try_emplace(&vertices, data.submissions.size());
+			}
+			const float DEPTH = getFrontDepth(vertices);
+			data.submissions.emplace_back(
 				SubmissionData{
 					states.transform, // transform
 					&vertices,        // vertexList
 					&indices,         // indexList
+					0,                // vertexOffset
+					0,                // vertexCount
+					0,                // indexOffset
+					0,                // indexCount
+					NO_SUBMISSION,    // nextShared
+					DEPTH,            // depth
 					true,             // resubmitted
-					false             // dirty
+					false,            // dirty
+					false,            // transformDirty
+					false,            // quads
+					false             // retained
 				}
 			);
 		}
@@ -114,146 +497,1037 @@ namespace ae
 	// Private constructor(s)
 	BatchRenderer2D::BatchRenderer2D()
 		: Renderer2D()
-		, mOpaqueCalls()
-		, mTransparentCalls()
+		, mPassResource()
+		, mOpaqueCalls(&mPassResource)
+		, mTransparentCalls(&mPassResource)
+		, mStreamVAO(GLResourceFactory::getInstance().get<VertexArray>("_AEON_StreamVAO"))
+		, mVertexRing()
+		, mIndexRing()
+		, mPackedStreamVAO(GLResourceFactory::getInstance().get<VertexArray>("_AEON_PackedStreamVAO"))
+		, mPackedVertexRing()
+		, mPackedIndexRing()
+		, mQuadListIBO(GLResourceFactory::getInstance().get<IndexBuffer>("_AEON_QuadListIBO"))
+		, mQuadListCapacity(mQuadListIBO->getCount() / 6)
+		, mArenaVBO(std::make_unique<VertexBuffer>(GL_STATIC_DRAW))
+		, mArenaIBO(std::make_unique<IndexBuffer>(GL_STATIC_DRAW))
+		, mVertexArena()
+		, mIndexArena()
+		, mDrawIDRing()
+		, mModelRing()
+		, mModelBuffer(std::make_unique<Buffer>(GL_SHADER_STORAGE_BUFFER))
+		, mTransformShaders()
+		, mModelAlignment(1)
+		, mTextureSlotRing()
+		, mTextureGroup()
+		, mGroupCounts()
+		, mGroupIndexOffsets()
+		, mGroupBaseVertices()
+		, mGroupTextures()
+		, mGroupSamplers()
+		, mIndirectBuffer(std::make_unique<Buffer>(GL_DRAW_INDIRECT_BUFFER))
+		, mIndirectRing()
+		, mBasicShader(GLResourceFactory::getInstance().get<Shader>("_AEON_Basic2D").get())
+		, mMultiTextureShader(GLResourceFactory::getInstance().get<Shader>("_AEON_MultiTexture2D").get())
+		, mTextureUnitCount(16)
+		, mCommands()
+		, mSortEntries()
+		, mSortScratch()
+		, mDepthEntries()
+		, mSubmissionScratch()
+		, mBlendModes()
+		, mCommandBatch()
+		, mLayers()
+		, mProxies()
+		, mFreeProxies()
+		, mMode(Mode::Cached)
+		, mVertexFormat(VertexFormat::Standard)
+		, mGPUTransforms(false)
+		, mMultiTexture(false)
+		, mIndirect(false)
 	{
+		// Create the ring buffers (each region can hold 65536 vertices and 98304 indices, and 16384 transforms)
+		mVertexRing.create(*mStreamVAO->getVBO(0), static_cast<int>(sizeof(Vertex2D)) * 65536);
+		mIndexRing.create(*mStreamVAO->getIBO(), static_cast<int>(sizeof(GLuint)) * 98304);
+		mPackedVertexRing.create(*mPackedStreamVAO->getVBO(0), static_cast<int>(sizeof(PackedVertex2D)) * 65536);
+		mPackedIndexRing.create(*mPackedStreamVAO->getIBO(), static_cast<int>(sizeof(GLushort)) * 98304);
+		mDrawIDRing.create(*mStreamVAO->getVBO(1), static_cast<int>(sizeof(float)) * 65536);
+		mModelRing.create(*mModelBuffer, static_cast<int>(sizeof(Matrix4f)) * 16384);
+		mTextureSlotRing.create(*mStreamVAO->getVBO(2), static_cast<int>(sizeof(float)) * 65536);
+		mIndirectRing.create(*mIndirectBuffer, static_cast<int>(sizeof(IndirectCommand)) * 4096);
+
+		// Create the arenas in which the unchanged batches remain resident
+		mVertexArena.create(*mArenaVBO, static_cast<int>(sizeof(Vertex2D)) * ARENA_VERTEX_CAPACITY);
+		mIndexArena.create(*mArenaIBO, static_cast<int>(sizeof(GLuint)) * ARENA_INDEX_CAPACITY);
+		GLCall(glGetIntegerv(GL_SHADER_STORAGE_BUFFER_OFFSET_ALIGNMENT, &mModelAlignment));
+
+		// The texture groups are limited by the multi-texture shader's sampler array and by the texture units available
+		GLint textureUnitCount = 0;
+		GLCall(glGetIntegerv(GL_MAX_TEXTURE_IMAGE_UNITS, &textureUnitCount));
+		mTextureUnitCount = std::min(mTextureUnitCount, static_cast<size_t>(textureUnitCount));
+
+		// Associate the built-in shaders with their counterparts applying the transforms on the GPU
+		GLResourceFactory& glResourceFactory = GLResourceFactory::getInstance();
+		mTransformShaders.emplace(glResourceFactory.get<Shader>("_AEON_Basic2D").get(), glResourceFactory.get<Shader>("_AEON_BatchBasic2D").get());
+		mTransformShaders.emplace(glResourceFactory.get<Shader>("_AEON_Text2D").get(), glResourceFactory.get<Shader>("_AEON_BatchText2D").get());
+		mTransformShaders.emplace(glResourceFactory.get<Shader>("_AEON_TextSDF2D").get(), glResourceFactory.get<Shader>("_AEON_BatchTextSDF2D").get());
 	}
 
 	// Private method(s)
+	BatchRenderer2D::RenderData& BatchRenderer2D::getBatch(const RenderStates& states, bool transparent)
+	{
+		// Select the opaque or the transparent passes
+		ShaderPasses& drawcalls = (transparent) ? mTransparentCalls : mOpaqueCalls;
+
+		// Substitute the built-in shaders by their counterparts applying the transforms on the GPU
+		const Shader* shader = states.shader;
+		if (mGPUTransforms) {
+			auto transformItr = mTransformShaders.find(shader);
+			if (transformItr != mTransformShaders.end()) {
+				shader = transformItr->second;
+			}
+		}
+
+		// Find an existing shader pass or create one
+		auto shaderItr = drawcalls.find(shader);
+		if (shaderItr == drawcalls.end()) {
+			shaderItr = drawcalls.try_emplace(shader).first;
+		}
+
+		// Find an existing blend pass or create one
+		BlendPasses& blendPasses = shaderItr->second;
+		auto blendItr = blendPasses.find(states.blendMode);
+		if (blendItr == blendPasses.end()) {
+			blendItr = blendPasses.try_emplace(states.blendMode).first;
+		}
+
+		// Find an existing clip pass or create one
+		ClipPasses& clipPasses = blendItr->second;
+		const std::array<int, 4> CLIP_KEY = getClipKey(states.clipRect);
+		auto clipItr = clipPasses.find(CLIP_KEY);
+		if (clipItr == clipPasses.end()) {
+			clipItr = clipPasses.try_emplace(CLIP_KEY).first;
+		}
+
+		// Find an existing texture pass or create one (the same texture sampled with different samplers is batched separately)
+		TexturePasses& texturePasses = clipItr->second;
+		const TextureKey TEXTURE_KEY((!states.texture) ? mWhiteTexture.get() : states.texture, states.sampler);
+		auto textureItr = texturePasses.find(TEXTURE_KEY);
+		if (textureItr == texturePasses.end()) {
+			textureItr = texturePasses.try_emplace(TEXTURE_KEY).first;
+			textureItr->second.fallbackShader = (shader != states.shader) ? states.shader : nullptr;
+		}
+
+		return textureItr->second;
+	}
+
+	void BatchRenderer2D::insertProxy(ProxyData& proxy)
+	{
+		RenderData& data = getBatch(proxy.states, proxy.transparent);
+
+		// Revive the proxy's submission if it was removed this frame, its geometry is rewritten in any case
+		auto submissionItr = data.lookup.find(proxy.vertexList);
+		if (submissionItr != data.lookup.end()) {
+			SubmissionData& submission = data.submissions[submissionItr->second];
+			submission.transform = proxy.states.transform;
+			submission.indexList = proxy.indexList;
+			submission.depth = getFrontDepth(*proxy.vertexList);
+			submission.resubmitted = true;
+			submission.dirty = true;
+			if (!submission.retained) {
+				submission.retained = true;
+				++data.retainedCount;
+			}
+		}
+		else {
+			data.lookup.try_emplace(proxy.vertexList, data.submissions.size());
+			const float DEPTH = getFrontDepth(*proxy.vertexList);
+			data.submissions.emplace_back(
+				SubmissionData{
+					proxy.states.transform, // transform
+					proxy.vertexList,       // vertexList
+					proxy.indexList,        // indexList
+					0,                      // vertexOffset
+					0,                      // vertexCount
+					0,                      // indexOffset
+					0,                      // indexCount
+					NO_SUBMISSION,          // nextShared
+					DEPTH,                  // depth
+					true,                   // resubmitted
+					false,                  // dirty
+					false,                  // transformDirty
+					false,                  // quads
+					true                    // retained
+				}
+			);
+			++data.retainedCount;
+		}
+
+		data.retainedModified = true;
+		proxy.batch = &data;
+	}
+
+	void BatchRenderer2D::removeProxy(ProxyData& proxy)
+	{
+		if (!proxy.batch) {
+			return;
+		}
+
+		// The submission will be compacted away as it's no longer resubmitted
+		RenderData& data = *proxy.batch;
+		SubmissionData& submission = data.submissions[data.lookup.find(proxy.vertexList)->second];
+		submission.retained = false;
+		submission.resubmitted = false;
+		--data.retainedCount;
+		data.retainedModified = true;
+		proxy.batch = nullptr;
+	}
+
+	void BatchRenderer2D::restoreProxies()
+	{
+		for (ProxyData& proxy : mProxies) {
+			proxy.batch = nullptr;
+			if (proxy.registered && proxy.visible && mMode == Mode::Cached) {
+				insertProxy(proxy);
+			}
+		}
+	}
+
+	bool BatchRenderer2D::isProxyRegistered(uint32_t proxy) const noexcept
+	{
+		return proxy < mProxies.size() && mProxies[proxy].registered;
+	}
+
 	void BatchRenderer2D::flush(ShaderPasses& drawcalls, bool frontToBack)
 	{
 		for (auto& shaderPass : drawcalls)
 		{
-			// Bind the shader
-			shaderPass.first->bind();
+			// Bind the shader (the multi-texture shader replaces the built-in one if the batches are merged across textures)
+			const bool MULTI_TEXTURE = mMultiTexture && shaderPass.first == mBasicShader;
+			const Shader* const shader = (MULTI_TEXTURE) ? mMultiTextureShader : shaderPass.first;
+			shader->bind();
 
 			for (auto& blendPass : shaderPass.second)
 			{
 				// Set the appropriate blending
-				if (blendPass.first != BlendMode::BlendNone) {
-					GLCall(glEnable(GL_BLEND));
-					GLCall(glBlendEquationSeparate(blendPass.first.colorEquation, blendPass.first.alphaEquation));
-					GLCall(glBlendFuncSeparate(blendPass.first.colorSrcFactor, blendPass.first.colorDstFactor,
-					                           blendPass.first.alphaSrcFactor, blendPass.first.alphaDstFactor));
-				}
-				else {
-					GLCall(glDisable(GL_BLEND));
-				}
+				applyBlendMode(blendPass.first);
 
-				for (auto& texturePass : blendPass.second)
+				for (auto clipPass = blendPass.second.begin(); clipPass != blendPass.second.end();)
 				{
-					// Bind the texture
-					texturePass.first->bind();
+					// Restrict the drawcalls to the clip pass' region (the state cache ignores the region if it's already set)
+					const std::array<int, 4>& CLIP_RECT = clipPass->first;
+					gl::setScissor(CLIP_RECT[0], CLIP_RECT[1], CLIP_RECT[2], CLIP_RECT[3]);
 
-					// Sort the submissions
-					sortSubmissions(texturePass.second, frontToBack);
+					TexturePasses& texturePasses = clipPass->second;
+					for (auto texturePass = texturePasses.begin(); texturePass != texturePasses.end();)
+					{
+						// Remove the submissions that weren't resubmitted and sort the remaining ones
+						sortSubmissions(texturePass->second, frontToBack);
 
-					// Upload the vertices
-					VertexBuffer* const vboPtr = mVAO->getVBO(0);
-					vboPtr->setData(static_cast<int>(sizeof(Vertex2D) * texturePass.second.vertices.size()), texturePass.second.vertices.data());
+						// Delete the texture pass if none of its submissions remain
+						if (texturePass->second.submissions.empty()) {
+							releaseResidency(texturePass->second);
+							texturePass = texturePasses.erase(texturePass);
+							continue;
+						}
 
-					// Upload the indices
-					IndexBuffer* const iboPtr = mVAO->getIBO();
-					iboPtr->setData(texturePass.second.indices.size() * sizeof(GLuint), texturePass.second.indices.data());
+						// Reset the submissions' resubmission flags
+						resetSubmissions(texturePass->second);
 
-					// Draw the indices
-					GLCall(glDrawElements(GL_TRIANGLES, iboPtr->getCount(), GL_UNSIGNED_INT, nullptr));
+						if (MULTI_TEXTURE) {
+							// Add the batch to the pending group and render the group once all texture units are occupied
+							mTextureGroup.emplace_back(texturePass->first, &texturePass->second);
+							if (mTextureGroup.size() == mTextureUnitCount) {
+								flushTextureGroup();
+							}
+						}
+						else {
+							// Bind the texture and its sampler (the state cache ignores redundant binds), and draw the batch from the arenas if it's unchanged
+							// or upload the vertices and indices and draw them otherwise
+							bindTexture(texturePass->first.first, texturePass->first.second);
+							if (!drawResidentBatch(texturePass->second)) {
+								drawBatch(texturePass->second);
+							}
+						}
+						++texturePass;
+					}
 
-					// Unbind the texture
-					texturePass.first->unbind();
+					// Render the remaining texture passes of the clip pass before the region changes
+					flushTextureGroup();
 
-					// Reset the submissions' resubmission flags
-					resetSubmissions(texturePass.second);
+					// Delete the clip pass if none of its texture passes remain (scrolling containers may move their region)
+					if (texturePasses.empty()) {
+						clipPass = blendPass.second.erase(clipPass);
+						continue;
+					}
+					++clipPass;
 				}
 			}
-
-			// Unbind the shader
-			shaderPass.first->unbind();
 		}
 	}
 
 	void BatchRenderer2D::sortSubmissions(RenderData& data, bool frontToBack)
 	{
-		bool dirtySubmissionFound = false;
+		// A batch solely made up of unmodified retained proxies is drawn as it is without inspecting its submissions
+		if (data.retainedCount == data.submissions.size() && !data.retainedModified) {
+			data.unchanged = true;
+			++mStatistics.batchesReused;
+			return;
+		}
 
-		// Retrieve the vertex and index count of all submissions, and check if any submission is dirty
-		size_t vertexCount = 0, indexCount = 0;
-		for (const auto& submission : data.submissions) {
-			vertexCount += submission.vertexList->size();
-			indexCount += submission.indexList->size();
+		// Remove the submissions that weren't resubmitted this frame
+		const bool REMOVED = compactSubmissions(data);
 
+		// Check if a laid out submission's geometry was resized, or if new submissions were received
+		bool rebuild = false, modified = REMOVED || data.placedCount != data.submissions.size();
+		for (size_t i = 0; i < data.placedCount && !rebuild; ++i) {
+			const SubmissionData& submission = data.submissions[i];
 			if (submission.dirty) {
-				dirtySubmissionFound = true;
+				rebuild = submission.vertexList->size() != submission.vertexCount || submission.indexList->size() != submission.indexCount;
+				modified = true;
 			}
+			else if (submission.transformDirty && !data.fallbackShader) {
+				modified = true;
+			}
+		}
+
+		// The batch's resident copy is outdated if it was modified
+		data.unchanged = !modified;
+		if (modified) {
+			releaseResidency(data);
 		}
 
-		// Check if the submissions need to be sorted
-		if (!dirtySubmissionFound && data.vertices.size() == vertexCount && data.indices.size() == indexCount) {
+		// Nothing needs to be updated if no submission was modified, added or removed
+		if (!modified) {
+			++mStatistics.batchesReused;
 			return;
 		}
 
-		// Sort the submissions
-		if (frontToBack) {
-			std::sort(data.submissions.begin(), data.submissions.end(), [](SubmissionData& data1, SubmissionData& data2) {
-				return data1.vertexList->front().position.z > data2.vertexList->front().position.z;
-			});
+		// The batch also needs to be rebuilt if the submissions are no longer in the rendering order
+		auto compare = [frontToBack](const SubmissionData& data1, const SubmissionData& data2) {
+			return (frontToBack) ? data1.depth > data2.depth : data1.depth < data2.depth;
+		};
+		rebuild = rebuild || !std::is_sorted(data.submissions.begin(), data.submissions.end(), compare);
+
+		if (rebuild) {
+			++mStatistics.batchesRebuilt;
+
+			// Sort the submissions (the equal ones keep their relative order to avoid flickering)
+			if (data.submissions.size() < RADIX_SORT_THRESHOLD) {
+				std::stable_sort(data.submissions.begin(), data.submissions.end(), compare);
+			}
+			else {
+				radixSortSubmissions(data, frontToBack);
+			}
+
+			// Clear the stored vertices and indices, and lay out every submission anew
+			data.vertices.clear();
+			data.indices.clear();
+			data.drawIDs.clear();
+			data.placedCount = 0;
+			linkSubmissions(data);
 		}
 		else {
-			std::sort(data.submissions.begin(), data.submissions.end(), [](SubmissionData& data1, SubmissionData& data2) {
-				return data1.vertexList->front().position.z < data2.vertexList->front().position.z;
-			});
+			++mStatistics.batchesUpdated;
+
+			// Only rewrite the dirty submissions' ranges (a moved submission's vertices are left untouched if transformed on the GPU)
+			for (size_t i = 0; i < data.placedCount; ++i) {
+				SubmissionData& submission = data.submissions[i];
+				if (submission.dirty || (submission.transformDirty && !data.fallbackShader)) {
+					submission.quads = isQuadList(*submission.indexList, submission.vertexCount);
+					writeGeometry(data, submission);
+				}
+			}
 		}
 
-		// Clear the stored vertices and indices, and reset the index offset
-		data.vertices.clear();
-		data.indices.clear();
-		data.lookup.clear();
-		data.indexOffset = 0;
+		// Lay out the submissions that aren't yet part of the batch at its end
+		for (size_t i = data.placedCount; i < data.submissions.size(); ++i) {
+			SubmissionData& submission = data.submissions[i];
+			submission.vertexOffset = static_cast<unsigned int>(data.vertices.size());
+			submission.vertexCount = static_cast<unsigned int>(submission.vertexList->size());
+			submission.indexOffset = static_cast<unsigned int>(data.indices.size());
+			submission.indexCount = static_cast<unsigned int>(submission.indexList->size());
+
+			data.vertices.resize(data.vertices.size() + submission.vertexCount);
+			data.indices.resize(data.indices.size() + submission.indexCount);
+			if (data.fallbackShader) {
+				data.drawIDs.resize(data.vertices.size());
+			}
+			submission.quads = isQuadList(*submission.indexList, submission.vertexCount);
+			writeGeometry(data, submission);
+		}
+		data.placedCount = data.submissions.size();
+
+		// The submissions are laid out contiguously, so the batch's indices also form a list of quads if every submission's do
+		data.quadList = std::all_of(data.submissions.begin(), data.submissions.end(), [](const SubmissionData& submission) {
+			return submission.quads;
+		});
+	}
 
-		// Store the submissions' vertices and indices
-		data.vertices.reserve(vertexCount);
-		data.indices.reserve(indexCount);
-		for (auto& submission : data.submissions)
+	bool BatchRenderer2D::compactSubmissions(RenderData& data)
+	{
+		size_t kept = 0, keptPlaced = 0;
+		unsigned int vertexShift = 0, indexShift = 0;
+		for (size_t i = 0; i < data.submissions.size(); ++i)
 		{
-			// Store the vertices
-			for (const Vertex2D& vertex : *submission.vertexList) {
-				data.vertices.emplace_back(
-					Vertex2D{
-						Vector3f((submission.transform * Vector3f(vertex.position.xy)).xy, vertex.position.z),
-						vertex.color,
-						vertex.uv
-					}
-				);
+			SubmissionData& submission = data.submissions[i];
+			const bool PLACED = i < data.placedCount;
+
+			// Remove the submission and accumulate the space freed
+			if (!submission.resubmitted) {
+				if (PLACED) {
+					vertexShift += submission.vertexCount;
+					indexShift += submission.indexCount;
+				}
+				continue;
 			}
 
-			// Store the indices
-			for (const unsigned int& index : *submission.indexList) {
-				data.indices.emplace_back(index + data.indexOffset);
+			// Move the kept submission's geometry over the space freed by the previous removals
+			if (PLACED && (vertexShift != 0 || indexShift != 0)) {
+				std::copy(data.vertices.begin() + submission.vertexOffset, data.vertices.begin() + submission.vertexOffset + submission.vertexCount,
+				          data.vertices.begin() + (submission.vertexOffset - vertexShift));
+				const auto INDEX_BEGIN = data.indices.begin() + submission.indexOffset;
+				std::transform(INDEX_BEGIN, INDEX_BEGIN + submission.indexCount, INDEX_BEGIN - indexShift, [vertexShift](unsigned int index) {
+					return index - vertexShift;
+				});
+
+				submission.vertexOffset -= vertexShift;
+				submission.indexOffset -= indexShift;
+			}
+
+			// Move the submission's metadata
+			if (kept != i) {
+				data.submissions[kept] = submission;
+
+				// Update the draw IDs referencing the submission's transform
+				if (PLACED && data.fallbackShader) {
+					const auto DRAW_ID_BEGIN = data.drawIDs.begin() + submission.vertexOffset;
+					std::fill(DRAW_ID_BEGIN, DRAW_ID_BEGIN + submission.vertexCount, static_cast<float>(kept));
+				}
 			}
+			++kept;
+			keptPlaced += PLACED;
+		}
 
-			// Update the index offset by retrieving the max element of the submission's indices
-			auto maxIndex = std::max_element(submission.indexList->begin(), submission.indexList->end());
-			data.indexOffset += *maxIndex + 1;
+		// Check if any submissions were removed
+		if (kept == data.submissions.size()) {
+			return false;
+		}
 
-			// Update the lookup table to detect if a submission was resubmitted faster
-			data.lookup.try_emplace(submission.vertexList, &submission);
+		data.submissions.resize(kept);
+		data.vertices.resize(data.vertices.size() - vertexShift);
+		data.indices.resize(data.indices.size() - indexShift);
+		if (data.fallbackShader) {
+			data.drawIDs.resize(data.vertices.size());
+		}
+		data.placedCount = keptPlaced;
+		linkSubmissions(data);
+
+		return true;
+	}
+
+	void BatchRenderer2D::linkSubmissions(RenderData& data)
+	{
+		// The submissions are iterated backwards so that each chain starts with the first submission of its list of vertices
+		data.lookup.clear();
+		for (size_t i = data.submissions.size(); i-- > 0;) {
+			auto [lookupItr, inserted] = data.lookup.try_emplace(data.submissions[i].vertexList, i);
+			data.submissions[i].nextShared = (inserted) ? NO_SUBMISSION : lookupItr->second;
+			lookupItr->second = i;
+		}
+	}
+
+	void BatchRenderer2D::writeGeometry(RenderData& data, const SubmissionData& submission) const
+	{
+		if (data.fallbackShader) {
+			// Store the untransformed vertices in the submission's range, each one referencing the submission's transform
+			std::copy(submission.vertexList->begin(), submission.vertexList->end(), data.vertices.begin() + submission.vertexOffset);
+
+			const float DRAW_ID = static_cast<float>(&submission - data.submissions.data());
+			const auto DRAW_ID_BEGIN = data.drawIDs.begin() + submission.vertexOffset;
+			std::fill(DRAW_ID_BEGIN, DRAW_ID_BEGIN + submission.vertexCount, DRAW_ID);
+		}
+		else {
+			// Store the transformed vertices in the submission's range
+			Math::transformPoints2D(submission.transform, submission.vertexList->data(), data.vertices.data() + submission.vertexOffset, submission.vertexList->size());
+		}
+
+		// Store the indices offset by the submission's position in the batch
+		unsigned int* index = data.indices.data() + submission.indexOffset;
+		for (const unsigned int srcIndex : *submission.indexList) {
+			*index++ = srcIndex + submission.vertexOffset;
 		}
 	}
 
 	void BatchRenderer2D::resetSubmissions(RenderData& data)
 	{
-		// Delete the submissions if at least one wasn't resubmitted this frame
-		for (const auto& submission : data.submissions) {
-			if (!submission.resubmitted) {
-				data = RenderData();
-				break;
-			}
+		// The flags of a batch solely made up of unmodified retained proxies were already reset
+		if (data.retainedCount == data.submissions.size() && !data.retainedModified) {
+			return;
 		}
 
-		// Reset the submissions' flags
+		// Reset the submissions' flags (the ones that won't be resubmitted next frame will be removed then, unless they're retained)
 		for (auto& submission : data.submissions) {
-			submission.resubmitted = false;
+			submission.resubmitted = submission.retained;
 			submission.dirty = false;
+			submission.transformDirty = false;
+		}
+		data.sharedCursors.clear();
+		data.retainedModified = false;
+	}
+
+	void BatchRenderer2D::drawBatch(const RenderData& data)
+	{
+		// Attempt to upload the batch in the packed vertex format (only for batches transformed on the CPU)
+		if (mVertexFormat == VertexFormat::Packed && !data.fallbackShader && drawPackedBatch(data)) {
+			return;
+		}
+		mStreamVAO->bind();
+
+		// The indices of a batch of quads are read from the static quad list IBO instead of being uploaded
+		const bool QUAD_LIST = data.quadList && data.vertices.size() / 4 <= mQuadListCapacity;
+
+		const int VERTEX_SIZE = static_cast<int>(sizeof(Vertex2D) * data.vertices.size());
+		const int INDEX_SIZE = (QUAD_LIST) ? 0 : static_cast<int>(sizeof(GLuint) * data.indices.size());
+		const int DRAW_ID_SIZE = static_cast<int>(sizeof(float) * data.drawIDs.size());
+		const int MODEL_SIZE = static_cast<int>(sizeof(Matrix4f) * data.submissions.size());
+
+		// Reserve the necessary memory in the rings' current regions
+		int vertexOffset = 0, indexOffset = 0, drawIDOffset = 0, modelOffset = 0;
+		void* const vertexData = mVertexRing.allocate(VERTEX_SIZE, vertexOffset);
+		void* const indexData = (vertexData && !QUAD_LIST) ? mIndexRing.allocate(INDEX_SIZE, indexOffset) : nullptr;
+		const bool INDICES_READY = (vertexData && QUAD_LIST) || indexData;
+		void* const drawIDData = (INDICES_READY && data.fallbackShader) ? mDrawIDRing.allocate(DRAW_ID_SIZE, drawIDOffset) : nullptr;
+		void* const modelData = (drawIDData) ? mModelRing.allocate(MODEL_SIZE, modelOffset, mModelAlignment) : nullptr;
+
+		if (INDICES_READY && (!data.fallbackShader || modelData)) {
+			// Write the batch directly into the mapped memory
+			std::memcpy(vertexData, data.vertices.data(), VERTEX_SIZE);
+			if (QUAD_LIST) {
+				mStreamVAO->attachIBO(mQuadListIBO.get());
+			}
+			else {
+				std::memcpy(indexData, data.indices.data(), INDEX_SIZE);
+			}
+			mStreamVAO->setVBOOffset(0, vertexOffset);
+
+			// Write the draw IDs and the submissions' transforms, and bind the transforms' range to the shader storage block
+			if (data.fallbackShader) {
+				std::memcpy(drawIDData, data.drawIDs.data(), DRAW_ID_SIZE);
+				float* model = static_cast<float*>(modelData);
+				for (const SubmissionData& submission : data.submissions) {
+					std::memcpy(model, submission.transform.elements.data(), sizeof(Matrix4f));
+					model += 16;
+				}
+
+				mStreamVAO->setVBOOffset(1, drawIDOffset);
+				GLCall(glBindBufferRange(GL_SHADER_STORAGE_BUFFER, 0, mModelBuffer->getHandle(), modelOffset, MODEL_SIZE));
+			}
+			else {
+				// Keep the unused draw IDs' fetches within the ring's bounds
+				mStreamVAO->setVBOOffset(1, 0);
+			}
+
+			drawToViews([&data, indexOffset](int instanceCount) {
+				GLCall(glDrawElementsInstanced(GL_TRIANGLES, static_cast<GLsizei>(data.indices.size()), GL_UNSIGNED_INT,
+				                               reinterpret_cast<const void*>(static_cast<intptr_t>(indexOffset)), instanceCount));
+			});
+			recordDrawCall(data.vertices.size(), data.indices.size(), VERTEX_SIZE + INDEX_SIZE + ((data.fallbackShader) ? DRAW_ID_SIZE + MODEL_SIZE : 0));
+
+			// Reattach the index ring
+			if (QUAD_LIST) {
+				mStreamVAO->attachIBO(nullptr);
+			}
+		}
+		else if (data.fallbackShader) {
+			// The batch doesn't fit within the rings, so transform it on the CPU with the original shader instead
+			mCommandBatch.vertices.clear();
+			mCommandBatch.indices.clear();
+			for (const SubmissionData& submission : data.submissions) {
+				appendGeometry(mCommandBatch, submission.transform, *submission.vertexList, *submission.indexList);
+			}
+
+			data.fallbackShader->bind();
+			drawBatch(mCommandBatch);
+			mCommandBatch.vertices.clear();
+			mCommandBatch.indices.clear();
+
+			const Shader* const gpuShader = mTransformShaders.at(data.fallbackShader);
+			gpuShader->bind();
+		}
+		else {
+			// The batch doesn't fit within the rings, so reallocate the general-purpose VAO's data stores instead
+			mVAO->bind();
+
+			VertexBuffer* const vboPtr = mVAO->getVBO(0);
+			vboPtr->setData(VERTEX_SIZE, data.vertices.data());
+
+			IndexBuffer* const iboPtr = mVAO->getIBO();
+			iboPtr->setData(INDEX_SIZE, data.indices.data());
+
+			drawToViews([iboPtr](int instanceCount) {
+				GLCall(glDrawElementsInstanced(GL_TRIANGLES, iboPtr->getCount(), GL_UNSIGNED_INT, nullptr, instanceCount));
+			});
+			recordDrawCall(data.vertices.size(), data.indices.size(), VERTEX_SIZE + INDEX_SIZE);
+
+			mStreamVAO->bind();
+		}
+	}
+
+	void BatchRenderer2D::flushTextureGroup()
+	{
+		if (mTextureGroup.empty()) {
+			return;
+		}
+
+		// Calculate the size of the merged batches and check if they're all lists of quads (their indices then aren't uploaded)
+		size_t vertexCount = 0, indexCount = 0;
+		bool quadList = true;
+		for (const auto& texturePass : mTextureGroup) {
+			vertexCount += texturePass.second->vertices.size();
+			indexCount += texturePass.second->indices.size();
+			quadList = quadList && texturePass.second->quadList && texturePass.second->vertices.size() / 4 <= mQuadListCapacity;
+		}
+
+		// Reserve the necessary memory in the rings' current regions
+		mStreamVAO->bind();
+		int vertexOffset = 0, indexOffset = 0, slotOffset = 0;
+		uint8_t* const vertexData = static_cast<uint8_t*>(mVertexRing.allocate(static_cast<int>(sizeof(Vertex2D) * vertexCount), vertexOffset));
+		uint8_t* const indexData = (vertexData && !quadList) ? static_cast<uint8_t*>(mIndexRing.allocate(static_cast<int>(sizeof(GLuint) * indexCount), indexOffset)) : nullptr;
+		float* const slotData = ((vertexData && quadList) || indexData) ? static_cast<float*>(mTextureSlotRing.allocate(static_cast<int>(sizeof(float) * vertexCount), slotOffset)) : nullptr;
+
+		// The drawing commands are submitted directly if they don't fit within the indirect ring
+		int indirectOffset = 0;
+		IndirectCommand* const indirectData = (slotData && mIndirect)
+			? static_cast<IndirectCommand*>(mIndirectRing.allocate(static_cast<int>(sizeof(IndirectCommand) * mTextureGroup.size()), indirectOffset))
+			: nullptr;
+
+		if (slotData) {
+			mGroupCounts.clear();
+			mGroupIndexOffsets.clear();
+			mGroupBaseVertices.clear();
+			mGroupTextures.clear();
+			mGroupSamplers.clear();
+
+			// Write each batch after the previous one along with its texture slot, its indices being offset by its base vertex
+			// (the batches of quads all start from the beginning of the static quad list IBO)
+			size_t vertexCursor = 0, indexCursor = 0;
+			for (const auto& texturePass : mTextureGroup) {
+				const RenderData& data = *texturePass.second;
+				std::memcpy(vertexData + sizeof(Vertex2D) * vertexCursor, data.vertices.data(), sizeof(Vertex2D) * data.vertices.size());
+				if (!quadList) {
+					std::memcpy(indexData + sizeof(GLuint) * indexCursor, data.indices.data(), sizeof(GLuint) * data.indices.size());
+				}
+				std::fill(slotData + vertexCursor, slotData + vertexCursor + data.vertices.size(), static_cast<float>(mGroupTextures.size()));
+
+				const size_t FIRST_INDEX = (quadList) ? 0 : indexOffset / sizeof(GLuint) + indexCursor;
+				mGroupCounts.push_back(static_cast<int>(data.indices.size()));
+				mGroupIndexOffsets.push_back(reinterpret_cast<const void*>(static_cast<intptr_t>(sizeof(GLuint) * FIRST_INDEX)));
+				mGroupBaseVertices.push_back(static_cast<int>(vertexCursor));
+				mGroupTextures.push_back(texturePass.first.first->getHandle());
+				mGroupSamplers.push_back((texturePass.first.second) ? texturePass.first.second->getHandle() : 0);
+				texturePass.first.first->markUsed();
+				if (indirectData) {
+					indirectData[mGroupTextures.size() - 1] = IndirectCommand{
+						static_cast<unsigned int>(data.indices.size()),                        // count
+						static_cast<unsigned int>(getViewInstanceCount()),                     // instanceCount
+						static_cast<unsigned int>(FIRST_INDEX),                                // firstIndex
+						static_cast<int>(vertexCursor),                                        // baseVertex
+						0                                                                      // baseInstance
+					};
+				}
+
+				vertexCursor += data.vertices.size();
+				indexCursor += data.indices.size();
+			}
+
+			// Bind the textures and their samplers to consecutive units and render the whole group
+			if (quadList) {
+				mStreamVAO->attachIBO(mQuadListIBO.get());
+			}
+			mStreamVAO->setVBOOffset(0, vertexOffset);
+			mStreamVAO->setVBOOffset(2, slotOffset);
+			gl::bindTextures(0, static_cast<int>(mGroupTextures.size()), mGroupTextures.data());
+			gl::bindSamplers(0, static_cast<int>(mGroupSamplers.size()), mGroupSamplers.data());
+			if (indirectData) {
+				mIndirectBuffer->bind();
+				drawToViews([this, indirectOffset](int) {
+					GLCall(glMultiDrawElementsIndirect(GL_TRIANGLES, GL_UNSIGNED_INT, reinterpret_cast<const void*>(static_cast<intptr_t>(indirectOffset)),
+					                                   static_cast<GLsizei>(mTextureGroup.size()), 0));
+				});
+				mIndirectBuffer->unbind();
+			}
+			else {
+				drawToViews([this](int instanceCount) {
+					// There's no instanced variant of the multi-draw, each batch is then drawn separately if several views are drawn at once
+					if (instanceCount == 1) {
+						GLCall(glMultiDrawElementsBaseVertex(GL_TRIANGLES, mGroupCounts.data(), GL_UNSIGNED_INT, mGroupIndexOffsets.data(),
+						                                     static_cast<GLsizei>(mGroupCounts.size()), mGroupBaseVertices.data()));
+						return;
+					}
+					for (size_t i = 0; i < mGroupCounts.size(); ++i) {
+						GLCall(glDrawElementsInstancedBaseVertex(GL_TRIANGLES, mGroupCounts[i], GL_UNSIGNED_INT, mGroupIndexOffsets[i], instanceCount, mGroupBaseVertices[i]));
+					}
+				});
+			}
+			recordDrawCall(vertexCount, indexCount, (sizeof(Vertex2D) + sizeof(float)) * vertexCount + ((quadList) ? 0 : sizeof(GLuint) * indexCount)
+			                                        + ((indirectData) ? sizeof(IndirectCommand) * mTextureGroup.size() : 0));
+
+			// Keep the unused texture slots' fetches within the ring's bounds and reattach the index ring
+			mStreamVAO->setVBOOffset(2, 0);
+			if (quadList) {
+				mStreamVAO->attachIBO(nullptr);
+			}
+		}
+		else {
+			// The group doesn't fit within the rings, so render each texture pass separately with the built-in shader
+			mBasicShader->bind();
+			for (const auto& texturePass : mTextureGroup) {
+				bindTexture(texturePass.first.first, texturePass.first.second);
+				drawBatch(*texturePass.second);
+			}
+			mMultiTextureShader->bind();
+		}
+
+		mTextureGroup.clear();
+	}
+
+	bool BatchRenderer2D::drawResidentBatch(RenderData& data)
+	{
+		// Only the unchanged batches transformed on the CPU in the standard vertex format are kept resident
+		if (!data.unchanged || data.fallbackShader || mVertexFormat != VertexFormat::Standard || !mVertexArena.isCreated() || !mIndexArena.isCreated()) {
+			return false;
+		}
+
+		// Upload the batch into its own ranges of the arenas the first time it's drawn unchanged
+		int uploadedBytes = 0;
+		if (data.arenaVertexSize == 0) {
+			const int VERTEX_SIZE = static_cast<int>(sizeof(Vertex2D) * data.vertices.size());
+			const int INDEX_SIZE = static_cast<int>(sizeof(GLuint) * data.indices.size());
+			void* const vertexData = mVertexArena.allocate(VERTEX_SIZE, data.arenaVertexOffset, static_cast<int>(sizeof(Vertex2D)));
+			void* const indexData = (vertexData) ? mIndexArena.allocate(INDEX_SIZE, data.arenaIndexOffset, static_cast<int>(sizeof(GLuint))) : nullptr;
+
+			// The batch keeps being streamed through the rings if the arenas lack the space
+			if (!indexData) {
+				if (vertexData) {
+					mVertexArena.release(data.arenaVertexOffset, VERTEX_SIZE);
+				}
+				return false;
+			}
+
+			std::memcpy(vertexData, data.vertices.data(), VERTEX_SIZE);
+			std::memcpy(indexData, data.indices.data(), INDEX_SIZE);
+			data.arenaVertexSize = VERTEX_SIZE;
+			data.arenaIndexSize = INDEX_SIZE;
+			uploadedBytes = VERTEX_SIZE + INDEX_SIZE;
+		}
+		else {
+			++mStatistics.batchesResident;
+		}
+
+		// Draw the batch from the arenas, its indices being relative to its first vertex
+		mStreamVAO->bind();
+		mStreamVAO->attachVBO(0, mArenaVBO.get());
+		mStreamVAO->attachIBO(mArenaIBO.get());
+		mStreamVAO->setVBOOffset(1, 0);
+
+		const GLint BASE_VERTEX = data.arenaVertexOffset / static_cast<GLint>(sizeof(Vertex2D));
+		const intptr_t INDEX_OFFSET = data.arenaIndexOffset;
+		drawToViews([&data, BASE_VERTEX, INDEX_OFFSET](int instanceCount) {
+			GLCall(glDrawElementsInstancedBaseVertex(GL_TRIANGLES, static_cast<GLsizei>(data.indices.size()), GL_UNSIGNED_INT,
+			                                         reinterpret_cast<const void*>(INDEX_OFFSET), instanceCount, BASE_VERTEX));
+		});
+		recordDrawCall(data.vertices.size(), data.indices.size(), uploadedBytes);
+
+		// Reattach the rings
+		mStreamVAO->attachVBO(0, nullptr);
+		mStreamVAO->attachIBO(nullptr);
+
+		return true;
+	}
+
+	void BatchRenderer2D::releaseResidency(RenderData& data)
+	{
+		if (data.arenaVertexSize == 0) {
+			return;
+		}
+
+		mVertexArena.release(data.arenaVertexOffset, data.arenaVertexSize);
+		mIndexArena.release(data.arenaIndexOffset, data.arenaIndexSize);
+		data.arenaVertexSize = 0;
+		data.arenaIndexSize = 0;
+	}
+
+	bool BatchRenderer2D::drawPackedBatch(const RenderData& data)
+	{
+		// The indices must fit within 16 bits
+		if (data.vertices.size() > 65536) {
+			return false;
+		}
+
+		// The texture coordinates outside of the range [0,1] can't be packed, so they're checked before any ring space is reserved
+		const bool PACKABLE = std::all_of(data.vertices.begin(), data.vertices.end(), [](const Vertex2D& vertex) {
+			return vertex.uv.x >= 0.f && vertex.uv.x <= 1.f && vertex.uv.y >= 0.f && vertex.uv.y <= 1.f;
+		});
+		if (!PACKABLE) {
+			return false;
+		}
+
+		// Reserve the necessary memory in the packed rings' current regions
+		int vertexOffset = 0, indexOffset = 0;
+		PackedVertex2D* const vertexData = static_cast<PackedVertex2D*>(mPackedVertexRing.allocate(static_cast<int>(sizeof(PackedVertex2D) * data.vertices.size()), vertexOffset));
+		GLushort* const indexData = (vertexData) ? static_cast<GLushort*>(mPackedIndexRing.allocate(static_cast<int>(sizeof(GLushort) * data.indices.size()), indexOffset)) : nullptr;
+		if (!indexData) {
+			return false;
+		}
+
+		// Convert the vertices directly into the mapped memory
+		PackedVertex2D* packedVertex = vertexData;
+		for (const Vertex2D& vertex : data.vertices) {
+			packedVertex->position = vertex.position;
+			for (int i = 0; i < 4; ++i) {
+				packedVertex->color[i] = static_cast<uint8_t>(std::clamp(vertex.color.elements[i], 0.f, 1.f) * 255.f + 0.5f);
+			}
+			packedVertex->uv[0] = static_cast<uint16_t>(vertex.uv.x * 65535.f + 0.5f);
+			packedVertex->uv[1] = static_cast<uint16_t>(vertex.uv.y * 65535.f + 0.5f);
+			++packedVertex;
+		}
+
+		// Narrow the indices
+		GLushort* packedIndex = indexData;
+		for (const unsigned int index : data.indices) {
+			*packedIndex++ = static_cast<GLushort>(index);
+		}
+
+		// Draw the indices from the packed VAO
+		mPackedStreamVAO->bind();
+		mPackedStreamVAO->setVBOOffset(0, vertexOffset);
+		drawToViews([&data, indexOffset](int instanceCount) {
+			GLCall(glDrawElementsInstanced(GL_TRIANGLES, static_cast<GLsizei>(data.indices.size()), GL_UNSIGNED_SHORT,
+			                               reinterpret_cast<const void*>(static_cast<intptr_t>(indexOffset)), instanceCount));
+		});
+		recordDrawCall(data.vertices.size(), data.indices.size(), sizeof(PackedVertex2D) * data.vertices.size() + sizeof(GLushort) * data.indices.size());
+
+		return true;
+	}
+
+	void BatchRenderer2D::appendGeometry(RenderData& data, const Matrix4f& transform, const Vertex2DList& vertices, const std::vector<unsigned int>& indices) const
+	{
+		// Store the transformed vertices
+		const unsigned int BASE_VERTEX = static_cast<unsigned int>(data.vertices.size());
+		data.vertices.resize(data.vertices.size() + vertices.size());
+		Math::transformPoints2D(transform, vertices.data(), data.vertices.data() + BASE_VERTEX, vertices.size());
+
+		// Store the indices offset by the position of the submission's first vertex
+		for (const unsigned int& index : indices) {
+			data.indices.emplace_back(index + BASE_VERTEX);
+		}
+	}
+
+	void BatchRenderer2D::submitCommand(const Vertex2DList& vertices, const std::vector<unsigned int>& indices, const RenderStates& states)
+	{
+		// Skip the empty submissions, they wouldn't produce any primitive
+		if (vertices.empty() || indices.empty()) {
+			return;
+		}
+
+		const unsigned int BLEND_INDEX = getBlendIndex(states.blendMode);
+
+		// Record the draw command
+		const Texture* const texture = (!states.texture) ? mWhiteTexture.get() : states.texture;
+		mCommands.emplace_back(
+			DrawCommand{
+				states.transform, // transform
+				&vertices,        // vertexList
+				&indices,         // indexList
+				states.shader,    // shader
+				texture,          // texture
+				states.sampler,   // sampler
+				BLEND_INDEX,      // blendMode
+				states.clipRect   // clipRect
+			}
+		);
+
+		// Convert the depth to an unsigned integer preserving the floating point order
+		uint32_t depth = getDepthKey(getFrontDepth(vertices));
+
+		// Opaque submissions are rendered front-to-back (descending depth) and transparent ones back-to-front (ascending depth)
+		const bool IS_TRANSPARENT = isTransparent(vertices, states);
+		if (!IS_TRANSPARENT) {
+			depth = ~depth;
+		}
+		const unsigned int SAMPLER = (states.sampler) ? states.sampler->getHandle() : 0;
+
+		// Pack the sort key, the sampler being mixed into the texture's field (the fields' collisions only affect the sorting, the batches are split based on the actual states including the clip rect and the sampler)
+		const uint64_t KEY = (static_cast<uint64_t>(IS_TRANSPARENT) << 63)
+		                   | (static_cast<uint64_t>(states.shader->getID() & 0x7ffu) << 52)
+		                   | (static_cast<uint64_t>(BLEND_INDEX & 0xfu) << 48)
+		                   | (static_cast<uint64_t>((texture->getHandle() ^ (SAMPLER << 8)) & 0xffffu) << 32)
+		                   | static_cast<uint64_t>(depth);
+		mSortEntries.emplace_back(SortEntry{ KEY, static_cast<unsigned int>(mCommands.size() - 1) });
+	}
+
+	void BatchRenderer2D::flushCommands()
+	{
+		// Sort the draw commands once
+		radixSortEntries(mSortEntries);
+
+		// Batch consecutive commands sharing the same states
+		CommandStates active{ nullptr, nullptr, nullptr, static_cast<unsigned int>(mBlendModes.size()), Vector4i(0, 0, 0, 0), false };
+		for (const SortEntry& entry : mSortEntries) {
+			batchCommand(mCommands[entry.command], (entry.key >> 63) != 0, active);
+		}
+		renderCommandBatch();
+
+		// Clear the draw commands while keeping their memory for the next frame
+		mCommands.clear();
+		mSortEntries.clear();
+	}
+
+	void BatchRenderer2D::submitLayered(const Vertex2DList& vertices, const std::vector<unsigned int>& indices, const RenderStates& states)
+	{
+		// Append the draw command to its layer's list (the lists are kept between frames so that their memory is reused)
+		const Texture* const texture = (!states.texture) ? mWhiteTexture.get() : states.texture;
+		mLayers[states.layer].emplace_back(
+			DrawCommand{
+				states.transform,                // transform
+				&vertices,                       // vertexList
+				&indices,                        // indexList
+				states.shader,                   // shader
+				texture,                         // texture
+				states.sampler,                  // sampler
+				getBlendIndex(states.blendMode), // blendMode
+				states.clipRect                  // clipRect
+			}
+		);
+	}
+
+	void BatchRenderer2D::flushLayers()
+	{
+		// Batch consecutive commands sharing the same states, the layers being iterated in ascending order
+		CommandStates active{ nullptr, nullptr, nullptr, static_cast<unsigned int>(mBlendModes.size()), Vector4i(0, 0, 0, 0), false };
+		for (auto layerItr = mLayers.begin(); layerItr != mLayers.end();)
+		{
+			// Remove the layers that didn't receive any submissions this frame
+			std::vector<DrawCommand>& commands = layerItr->second;
+			if (commands.empty()) {
+				layerItr = mLayers.erase(layerItr);
+				continue;
+			}
+
+			for (const DrawCommand& command : commands) {
+				batchCommand(command, false, active);
+			}
+			commands.clear();
+			++layerItr;
+		}
+		renderCommandBatch();
+	}
+
+	unsigned int BatchRenderer2D::getBlendIndex(const BlendMode& blendMode)
+	{
+		// Retrieve the index of the blend mode (there are usually only a handful of distinct blend modes)
+		auto blendItr = std::find(mBlendModes.begin(), mBlendModes.end(), blendMode);
+		if (blendItr == mBlendModes.end()) {
+			blendItr = mBlendModes.insert(mBlendModes.end(), blendMode);
+		}
+
+		return static_cast<unsigned int>(blendItr - mBlendModes.begin());
+	}
+
+	void BatchRenderer2D::batchCommand(const DrawCommand& command, bool transparent, CommandStates& active)
+	{
+		// Render the pending batch and apply the new states if they differ from the active ones
+		const std::array<int, 4> CLIP_KEY = getClipKey(command.clipRect);
+		const bool CLIP_CHANGED = CLIP_KEY != getClipKey(active.clipRect);
+		const bool TEXTURE_CHANGED = command.texture != active.texture || command.sampler != active.sampler;
+		if (command.shader != active.shader || command.blendMode != active.blendMode || TEXTURE_CHANGED || transparent != active.transparent || CLIP_CHANGED) {
+			renderCommandBatch();
+
+			if (command.shader != active.shader) {
+				command.shader->bind();
+				active.shader = command.shader;
+			}
+			if (command.blendMode != active.blendMode) {
+				applyBlendMode(mBlendModes[command.blendMode]);
+				active.blendMode = command.blendMode;
+			}
+			if (TEXTURE_CHANGED) {
+				bindTexture(command.texture, command.sampler);
+				active.texture = command.texture;
+				active.sampler = command.sampler;
+			}
+			if (CLIP_CHANGED) {
+				gl::setScissor(CLIP_KEY[0], CLIP_KEY[1], CLIP_KEY[2], CLIP_KEY[3]);
+				active.clipRect = command.clipRect;
+			}
+			active.transparent = transparent;
+		}
+
+		// Add the command's geometry to the pending batch
+		appendGeometry(mCommandBatch, command.transform, *command.vertexList, *command.indexList);
+	}
+
+	void BatchRenderer2D::renderCommandBatch()
+	{
+		if (!mCommandBatch.indices.empty()) {
+			drawBatch(mCommandBatch);
+		}
+		mCommandBatch.vertices.clear();
+		mCommandBatch.indices.clear();
+	}
+
+	void BatchRenderer2D::radixSortEntries(std::vector<SortEntry>& entries)
+	{
+		const size_t COUNT = entries.size();
+		if (COUNT < 2) {
+			return;
+		}
+		mSortScratch.resize(COUNT);
+
+		for (unsigned int shift = 0; shift < 64; shift += 8)
+		{
+			// Count the occurrences of each byte value
+			size_t offsets[256] = {};
+			for (const SortEntry& entry : entries) {
+				++offsets[(entry.key >> shift) & 0xff];
+			}
+
+			// Skip this byte if all entries share the same value
+			if (offsets[(entries.front().key >> shift) & 0xff] == COUNT) {
+				continue;
+			}
+
+			// Compute the starting offset of each byte value and scatter the entries
+			size_t total = 0;
+			for (size_t& offset : offsets) {
+				const size_t BUCKET_COUNT = offset;
+				offset = total;
+				total += BUCKET_COUNT;
+			}
+			for (const SortEntry& entry : entries) {
+				mSortScratch[offsets[(entry.key >> shift) & 0xff]++] = entry;
+			}
+			entries.swap(mSortScratch);
+		}
+	}
+
+	void BatchRenderer2D::radixSortSubmissions(RenderData& data, bool frontToBack)
+	{
+		// Gather the depth keys (inverted to sort in descending order of depth)
+		const size_t COUNT = data.submissions.size();
+		mDepthEntries.resize(COUNT);
+		for (size_t i = 0; i < COUNT; ++i) {
+			const uint32_t KEY = getDepthKey(data.submissions[i].depth);
+			mDepthEntries[i] = SortEntry{ static_cast<uint64_t>((frontToBack) ? ~KEY : KEY) << 32, static_cast<unsigned int>(i) };
+		}
+		radixSortEntries(mDepthEntries);
+
+		// Move the submissions in their sorted order
+		mSubmissionScratch.clear();
+		mSubmissionScratch.reserve(COUNT);
+		for (const SortEntry& entry : mDepthEntries) {
+			mSubmissionScratch.push_back(std::move(data.submissions[entry.command]));
 		}
+		data.submissions.swap(mSubmissionScratch);
 	}
 }
\ No newline at end of file
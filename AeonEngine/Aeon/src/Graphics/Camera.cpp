@@ -22,8 +22,21 @@
 
 #include <AEON/Graphics/Camera.h>
 
+#include <atomic>
+#include <cmath>
+#include <limits>
+
 namespace ae
 {
+	namespace
+	{
+		// The last version assigned to a camera's matrices (shared by all cameras so that the versions are unique)
+		std::atomic<uint64_t> lastVersion(0);
+
+		// The deviation of the rotation's squared magnitude from 1 beyond which the rotation is renormalized
+		constexpr float ROTATION_DRIFT_THRESHOLD = 1e-4f;
+	}
+
 	// Public constructor(s)
 	Camera::~Camera()
 	{
@@ -103,6 +116,7 @@ namespace ae
 	{
 		// The 'getRotation()' method is used as derived classes calculate it differently
 		mRotation = Quaternion::rotation(angle, axes) * getRotation();
+		renormalizeRotation();
 		mUpdateViewMatrix = true;
 	}
 
@@ -111,6 +125,7 @@ namespace ae
 		mViewMatrix = Matrix4f::lookat(mPosition, focus, Vector3f::Up);
 		mUpdateViewMatrix = false;
 		mUpdateInvViewMatrix = true;
+		updateVersion();
 	}
 
 	void Camera::setTarget(const RenderTarget* const target) noexcept
@@ -118,6 +133,11 @@ namespace ae
 		mTarget = target;
 	}
 
+	void Camera::invalidateProjection() noexcept
+	{
+		mUpdateProjectionMatrix = true;
+	}
+
 	Vector3f Camera::getLocalRight()
 	{
 		// The 'getRotation()' method is used as derived classes calculate it differently
@@ -156,7 +176,7 @@ namespace ae
 	{
 		// Update the stored inverse view matrix if necessary
 		if (mUpdateViewMatrix || mUpdateInvViewMatrix) {
-			mInvViewMatrix = getViewMatrix().invert();
+			mInvViewMatrix = getViewMatrix().invertOrthonormal();
 			mUpdateInvViewMatrix = false;
 		}
 
@@ -167,13 +187,44 @@ namespace ae
 	{
 		// Update the stored inverse projection matrix if necessary
 		if (mUpdateProjectionMatrix || mUpdateInvProjectionMatrix) {
-			mInvProjectionMatrix = getProjectionMatrix().invert();
+			const Matrix4f& PROJECTION = getProjectionMatrix();
+			mInvProjectionMatrix = PROJECTION.isAffine() ? PROJECTION.invertAffine() : PROJECTION.invert();
 			mUpdateInvProjectionMatrix = false;
 		}
 
 		return mInvProjectionMatrix;
 	}
 
+	const Matrix4f& Camera::getInverseViewProjectionMatrix()
+	{
+		// Retrieve the matrices first as they may be recomputed, which changes the version
+		const Matrix4f& INV_PROJECTION = getInverseProjectionMatrix();
+		const Matrix4f& INV_VIEW = getInverseViewMatrix();
+		if (mInvViewProjVersion != mVersion) {
+			mInvViewProjMatrix = INV_VIEW * INV_PROJECTION;
+			mInvViewProjVersion = mVersion;
+		}
+
+		return mInvViewProjMatrix;
+	}
+
+	uint64_t Camera::getVersion() const noexcept
+	{
+		return mVersion;
+	}
+
+	const Frustum& Camera::getViewFrustum()
+	{
+		// Retrieve the matrices first as they may be recomputed, which changes the version
+		const Matrix4f VIEW_PROJECTION = getProjectionMatrix() * getViewMatrix();
+		if (mFrustumVersion != mVersion) {
+			mFrustum.update(VIEW_PROJECTION);
+			mFrustumVersion = mVersion;
+		}
+
+		return mFrustum;
+	}
+
 	// Public virtual method(s)
 	const Quaternion& Camera::getRotation()
 	{
@@ -192,6 +243,7 @@ namespace ae
 			// Update the view matrix
 			mViewMatrix = Matrix4f::lookat(mPosition, mPosition + FORWARD, UP);
 			mUpdateInvViewMatrix = std::exchange(mUpdateViewMatrix, false);
+			updateVersion();
 		}
 
 		return mViewMatrix;
@@ -213,6 +265,11 @@ namespace ae
 		, mPosition()
 		, mNearPlane(nearPlane)
 		, mFarPlane(farPlane)
+		, mVersion(0)
+		, mFrustum()
+		, mFrustumVersion(std::numeric_limits<uint64_t>::max())
+		, mInvViewProjMatrix()
+		, mInvViewProjVersion(std::numeric_limits<uint64_t>::max())
 	{
 	}
 
@@ -231,6 +288,11 @@ namespace ae
 		, mPosition(std::move(rvalue.mPosition))
 		, mNearPlane(rvalue.mNearPlane)
 		, mFarPlane(rvalue.mFarPlane)
+		, mVersion(rvalue.mVersion)
+		, mFrustum(std::move(rvalue.mFrustum))
+		, mFrustumVersion(rvalue.mFrustumVersion)
+		, mInvViewProjMatrix(std::move(rvalue.mInvViewProjMatrix))
+		, mInvViewProjVersion(rvalue.mInvViewProjVersion)
 	{
 	}
 
@@ -252,7 +314,25 @@ namespace ae
 		mPosition = std::move(rvalue.mPosition);
 		mNearPlane = rvalue.mNearPlane;
 		mFarPlane = rvalue.mFarPlane;
+		mVersion = rvalue.mVersion;
+		mFrustum = std::move(rvalue.mFrustum);
+		mFrustumVersion = rvalue.mFrustumVersion;
+		mInvViewProjMatrix = std::move(rvalue.mInvViewProjMatrix);
+		mInvViewProjVersion = rvalue.mInvViewProjVersion;
 
 		return *this;
 	}
+
+	// Protected method(s)
+	void Camera::updateVersion() noexcept
+	{
+		mVersion = lastVersion.fetch_add(1, std::memory_order_relaxed) + 1;
+	}
+
+	void Camera::renormalizeRotation() noexcept
+	{
+		if (std::abs(Quaternion::dot(mRotation, mRotation) - 1.f) > ROTATION_DRIFT_THRESHOLD) {
+			mRotation = mRotation.normalize();
+		}
+	}
 }
\ No newline at end of file
@@ -109,6 +109,7 @@ namespace ae
 			Vector2f viewCoordsY = (mFlippedY) ? Vector2f(0.f, FRAME_SIZE.y) : Vector2f(FRAME_SIZE.y, 0.f);
 			mProjectionMatrix = Matrix4f::orthographic(0.f, FRAME_SIZE.x, viewCoordsY[0], viewCoordsY[1], nearPlane, farPlane);
 			mUpdateInvProjectionMatrix = std::exchange(mUpdateProjectionMatrix, false);
+			updateVersion();
 		}
 
 		return mProjectionMatrix;
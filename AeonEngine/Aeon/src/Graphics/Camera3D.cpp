@@ -66,6 +66,7 @@ namespace ae
 			// Update the projection matrix
 			mProjectionMatrix = Matrix4f::perspective(mFOV, HALF_FRAME_SIZE.x / HALF_FRAME_SIZE.y, nearPlane, farPlane);
 			mUpdateInvProjectionMatrix = std::exchange(mUpdateProjectionMatrix, false);
+			updateVersion();
 		}
 
 		return mProjectionMatrix;
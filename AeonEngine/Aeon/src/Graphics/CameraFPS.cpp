@@ -23,6 +23,7 @@
 #include <AEON/Graphics/CameraFPS.h>
 
 #include <AEON/Window/Mouse.h>
+#include <AEON/Window/Event.h>
 
 namespace ae
 {
@@ -30,7 +31,10 @@ namespace ae
 	CameraFPS::CameraFPS(float nearPlane, float farPlane, float fov, float sensitivity)
 		: Camera3D(nearPlane, farPlane, fov)
 		, mLastMousePos()
+		, mPendingMousePos()
 		, mSensitivity(sensitivity)
+		, mMouseInputPending(false)
+		, mEventDriven(false)
 	{
 		// Hide and lock the mouse cursor to the active window
 		Mouse::grabMouse(true);
@@ -47,14 +51,27 @@ namespace ae
 		return mSensitivity;
 	}
 
+	bool CameraFPS::handleEvent(Event* const event)
+	{
+		// Only the latest position is kept, the rotation being updated once when it's next retrieved
+		if (event->type == Event::Type::MouseMoved) {
+			mPendingMousePos = static_cast<Vector2f>(event->as<MouseMoveEvent>()->position);
+			mMouseInputPending = true;
+			mEventDriven = true;
+		}
+
+		return false;
+	}
+
 	// Public virtual method(s)
 	const Quaternion& CameraFPS::getRotation()
 	{
-		// Only modify the rotation if the mouse is locked to the window
-		if (Mouse::isMouseGrabbed()) {
+		// The mouse is only polled if no movement was received, otherwise the pending movement is applied once
+		if ((!mEventDriven || mMouseInputPending) && Mouse::isMouseGrabbed()) {
 			// Retrieve the current mouse position
 			const Vector2f& STORED_FRAME_SIZE = updateInternalFrameSize();
-			const Vector2f MOUSE_POS = static_cast<Vector2f>(Mouse::getPosition()) - (STORED_FRAME_SIZE / 2.f);
+			const Vector2f MOUSE_POS = (mEventDriven ? mPendingMousePos : static_cast<Vector2f>(Mouse::getPosition())) - (STORED_FRAME_SIZE / 2.f);
+			mMouseInputPending = false;
 
 			// Update the rotation if the mouse cursor is no longer in the same position
 			if (mLastMousePos != MOUSE_POS) {
@@ -63,7 +80,9 @@ namespace ae
 				const float YAW = MOUSE_POS.x * mSensitivity;
 				const float PITCH = MOUSE_POS.y * mSensitivity;
 
-				mRotation = (Quaternion::rotationY(-YAW) * Quaternion::rotationX(-PITCH)).normalize();
+				// The product of two unit quaternions is only renormalized once its drift becomes noticeable
+				mRotation = Quaternion::rotationY(-YAW) * Quaternion::rotationX(-PITCH);
+				renormalizeRotation();
 				mUpdateViewMatrix = true;
 			}
 		}
@@ -77,6 +96,7 @@ namespace ae
 		if (mUpdateViewMatrix) {
 			mViewMatrix = Matrix4f::rotate(getRotation()) * Matrix4f::translate(-getPosition());
 			mUpdateInvViewMatrix = std::exchange(mUpdateViewMatrix, false);
+			updateVersion();
 		}
 
 		return mViewMatrix;
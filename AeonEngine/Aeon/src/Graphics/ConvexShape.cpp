@@ -52,6 +52,7 @@ namespace ae
 	{
 		mPoints.emplace_back(point);
 		mUpdatePositions = true;
+		wake();
 	}
 
 	void ConvexShape::setPoint(size_t index, const Vector2f& point)
@@ -67,6 +68,7 @@ namespace ae
 		// Modify the point's position
 		mPoints[index] = point;
 		mUpdatePositions = true;
+		wake();
 	}
 
 	// Public virtual method(s)
@@ -87,4 +89,10 @@ namespace ae
 
 		return mPoints[index];
 	}
+
+	// Private virtual method(s)
+	std::unique_ptr<Actor2D> ConvexShape::cloneSelf() const
+	{
+		return std::make_unique<ConvexShape>(*this);
+	}
 }
\ No newline at end of file
@@ -0,0 +1,430 @@
+// MIT License
+// 
+// Copyright(c) 2019-2021 Filippos Gleglakos
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <AEON/Graphics/CullingTree3D.h>
+
+#include <algorithm>
+#include <cmath>
+#include <utility>
+
+#include <AEON/Graphics/Transformable.h>
+#include <AEON/System/DebugLogger.h>
+
+namespace ae
+{
+	namespace
+	{
+		// Combines two boxes into the box containing both of them
+		Box3f combine(const Box3f& box1, const Box3f& box2) noexcept
+		{
+			return Box3f(min(box1.min, box2.min), max(box1.max, box2.max));
+		}
+
+		// Computes the surface area of a box, used as the cost of the tree's nodes
+		float getSurfaceArea(const Box3f& box) noexcept
+		{
+			const Vector3f SIZE = box.max - box.min;
+			return 2.f * (SIZE.x * SIZE.y + SIZE.y * SIZE.z + SIZE.z * SIZE.x);
+		}
+
+		// Computes the world box enclosing the transformable's model bounds (a position and a size) once transformed
+		Box3f computeWorldBox(Transformable& transformable)
+		{
+			const Box3f MODEL_BOUNDS = transformable.getModelBounds();
+			const Vector3f HALF_SIZE = MODEL_BOUNDS.max * 0.5f;
+			const Vector3f EXTENT(std::abs(HALF_SIZE.x), std::abs(HALF_SIZE.y), std::abs(HALF_SIZE.z));
+			const Matrix4f& transform = transformable.getTransform();
+
+			// The center is transformed as a point and each axis' extent is the sum of the transformed half-sizes' absolute components
+			const Vector3f MODEL_CENTER = MODEL_BOUNDS.min + HALF_SIZE;
+			const Vector4f CENTER = transform * Vector4f(MODEL_CENTER.x, MODEL_CENTER.y, MODEL_CENTER.z, 1.f);
+			Vector3f worldExtent;
+			for (size_t i = 0; i < 3; ++i) {
+				worldExtent[i] = std::abs(transform.columns[0][i]) * EXTENT.x + std::abs(transform.columns[1][i]) * EXTENT.y + std::abs(transform.columns[2][i]) * EXTENT.z;
+			}
+
+			const Vector3f WORLD_CENTER(CENTER.x, CENTER.y, CENTER.z);
+			return Box3f(WORLD_CENTER - worldExtent, WORLD_CENTER + worldExtent);
+		}
+	}
+
+	// Public constructor(s)
+	CullingTree3D::CullingTree3D(float margin)
+		: mMargin(margin)
+		, mBoxes()
+		, mTransformables()
+		, mLeaves()
+		, mFreeProxies()
+		, mNodes()
+		, mRoot(-1)
+		, mFreeNode(-1)
+	{
+	}
+
+	// Public method(s)
+	uint32_t CullingTree3D::insert(Transformable& transformable)
+	{
+		// Reuse a removed proxy or append a new one
+		uint32_t proxy;
+		if (!mFreeProxies.empty()) {
+			proxy = mFreeProxies.back();
+			mFreeProxies.pop_back();
+		}
+		else {
+			proxy = static_cast<uint32_t>(mBoxes.size());
+			mBoxes.emplace_back();
+			mTransformables.push_back(nullptr);
+			mLeaves.push_back(-1);
+		}
+
+		mBoxes[proxy] = computeWorldBox(transformable);
+		mTransformables[proxy] = &transformable;
+
+		// Insert the proxy's fattened box into the tree
+		const int32_t LEAF = allocateNode();
+		mNodes[LEAF].box = getFatBox(proxy);
+		mNodes[LEAF].proxy = proxy;
+		insertLeaf(LEAF);
+		mLeaves[proxy] = LEAF;
+
+		return proxy;
+	}
+
+	void CullingTree3D::remove(uint32_t proxy)
+	{
+		// Check if the proxy exists (ignored in Release mode)
+		if _CONSTEXPR_IF (AEON_DEBUG) {
+			if (proxy >= mTransformables.size() || !mTransformables[proxy]) {
+				AEON_LOG_ERROR("Invalid proxy", "The proxy provided doesn't exist.\nAborting operation.");
+				return;
+			}
+		}
+
+		removeLeaf(mLeaves[proxy]);
+		freeNode(mLeaves[proxy]);
+		mLeaves[proxy] = -1;
+		mTransformables[proxy] = nullptr;
+		mFreeProxies.push_back(proxy);
+	}
+
+	void CullingTree3D::update(uint32_t proxy)
+	{
+		// Check if the proxy exists (ignored in Release mode)
+		if _CONSTEXPR_IF (AEON_DEBUG) {
+			if (proxy >= mTransformables.size() || !mTransformables[proxy]) {
+				AEON_LOG_ERROR("Invalid proxy", "The proxy provided doesn't exist.\nAborting operation.");
+				return;
+			}
+		}
+
+		const Box3f BOX = computeWorldBox(*mTransformables[proxy]);
+		mBoxes[proxy] = BOX;
+
+		// Only reinsert the leaf if the box left its fattened box
+		const int32_t LEAF = mLeaves[proxy];
+		const Box3f& FAT_BOX = mNodes[LEAF].box;
+		if (BOX.min.x < FAT_BOX.min.x || BOX.min.y < FAT_BOX.min.y || BOX.min.z < FAT_BOX.min.z ||
+		    BOX.max.x > FAT_BOX.max.x || BOX.max.y > FAT_BOX.max.y || BOX.max.z > FAT_BOX.max.z) {
+			removeLeaf(LEAF);
+			mNodes[LEAF].box = getFatBox(proxy);
+			insertLeaf(LEAF);
+		}
+	}
+
+	void CullingTree3D::query(const Frustum& frustum, std::vector<Transformable*>& visible) const
+	{
+		visible.clear();
+		if (mRoot == -1) {
+			return;
+		}
+
+		// Traverse the tree, the nodes entirely inside of the frustum being flagged so that their descendants aren't tested
+		std::vector<std::pair<int32_t, bool>> stack;
+		stack.reserve(64);
+		stack.emplace_back(mRoot, false);
+		while (!stack.empty())
+		{
+			const std::pair<int32_t, bool> ENTRY = stack.back();
+			const TreeNode& node = mNodes[ENTRY.first];
+			stack.pop_back();
+
+			bool inside = ENTRY.second;
+			if (!inside) {
+				const Frustum::Intersection INTERSECTION = frustum.classify(node.box);
+				if (INTERSECTION == Frustum::Intersection::Outside) {
+					continue;
+				}
+				inside = (INTERSECTION == Frustum::Intersection::Inside);
+			}
+
+			if (node.child1 == -1) {
+				// Test the exact box of the leaf's proxy unless its fattened box is entirely visible
+				if (inside || frustum.intersects(mBoxes[node.proxy])) {
+					visible.push_back(mTransformables[node.proxy]);
+				}
+			}
+			else {
+				stack.emplace_back(node.child1, inside);
+				stack.emplace_back(node.child2, inside);
+			}
+		}
+	}
+
+	Box3f CullingTree3D::getBox(uint32_t proxy) const
+	{
+		return mBoxes[proxy];
+	}
+
+	Transformable* CullingTree3D::getTransformable(uint32_t proxy) const
+	{
+		return mTransformables[proxy];
+	}
+
+	size_t CullingTree3D::getProxyCount() const noexcept
+	{
+		return mTransformables.size() - mFreeProxies.size();
+	}
+
+	// Private method(s)
+	int32_t CullingTree3D::allocateNode()
+	{
+		// Reuse a free node or append a new one
+		int32_t node;
+		if (mFreeNode != -1) {
+			node = mFreeNode;
+			mFreeNode = mNodes[node].parent;
+		}
+		else {
+			node = static_cast<int32_t>(mNodes.size());
+			mNodes.emplace_back();
+		}
+
+		TreeNode& treeNode = mNodes[node];
+		treeNode.parent = -1;
+		treeNode.child1 = -1;
+		treeNode.child2 = -1;
+		treeNode.height = 0;
+		treeNode.proxy = 0;
+
+		return node;
+	}
+
+	void CullingTree3D::freeNode(int32_t node)
+	{
+		mNodes[node].parent = mFreeNode;
+		mNodes[node].height = -1;
+		mFreeNode = node;
+	}
+
+	void CullingTree3D::insertLeaf(int32_t leaf)
+	{
+		if (mRoot == -1) {
+			mRoot = leaf;
+			mNodes[leaf].parent = -1;
+			return;
+		}
+
+		// Descend towards the sibling whose combination with the leaf increases the tree's surface area the least
+		const Box3f LEAF_BOX = mNodes[leaf].box;
+		int32_t index = mRoot;
+		while (mNodes[index].child1 != -1)
+		{
+			const TreeNode& node = mNodes[index];
+			const float AREA = getSurfaceArea(node.box);
+			const float COMBINED_AREA = getSurfaceArea(combine(node.box, LEAF_BOX));
+
+			// The cost of creating a new parent for this node and the leaf, and the minimum cost of descending further
+			const float COST = 2.f * COMBINED_AREA;
+			const float INHERITANCE_COST = 2.f * (COMBINED_AREA - AREA);
+
+			// The cost of descending into each child
+			const auto getDescentCost = [&](int32_t child) {
+				const TreeNode& childNode = mNodes[child];
+				const float CHILD_COMBINED = getSurfaceArea(combine(childNode.box, LEAF_BOX));
+				return ((childNode.child1 == -1) ? CHILD_COMBINED : CHILD_COMBINED - getSurfaceArea(childNode.box)) + INHERITANCE_COST;
+			};
+			const float COST1 = getDescentCost(node.child1);
+			const float COST2 = getDescentCost(node.child2);
+
+			if (COST < COST1 && COST < COST2) {
+				break;
+			}
+			index = (COST1 < COST2) ? node.child1 : node.child2;
+		}
+
+		// Create a new parent for the sibling and the leaf (the allocation may invalidate the references to the nodes)
+		const int32_t SIBLING = index;
+		const int32_t OLD_PARENT = mNodes[SIBLING].parent;
+		const int32_t NEW_PARENT = allocateNode();
+
+		TreeNode& newParent = mNodes[NEW_PARENT];
+		newParent.parent = OLD_PARENT;
+		newParent.box = combine(LEAF_BOX, mNodes[SIBLING].box);
+		newParent.height = mNodes[SIBLING].height + 1;
+		newParent.child1 = SIBLING;
+		newParent.child2 = leaf;
+
+		if (OLD_PARENT != -1) {
+			TreeNode& oldParent = mNodes[OLD_PARENT];
+			((oldParent.child1 == SIBLING) ? oldParent.child1 : oldParent.child2) = NEW_PARENT;
+		}
+		else {
+			mRoot = NEW_PARENT;
+		}
+		mNodes[SIBLING].parent = NEW_PARENT;
+		mNodes[leaf].parent = NEW_PARENT;
+
+		refit(NEW_PARENT);
+	}
+
+	void CullingTree3D::removeLeaf(int32_t leaf)
+	{
+		if (leaf == mRoot) {
+			mRoot = -1;
+			return;
+		}
+
+		// Replace the leaf's parent by the leaf's sibling
+		const int32_t PARENT = mNodes[leaf].parent;
+		const int32_t GRAND_PARENT = mNodes[PARENT].parent;
+		const int32_t SIBLING = (mNodes[PARENT].child1 == leaf) ? mNodes[PARENT].child2 : mNodes[PARENT].child1;
+
+		mNodes[SIBLING].parent = GRAND_PARENT;
+		freeNode(PARENT);
+		if (GRAND_PARENT != -1) {
+			TreeNode& grandParent = mNodes[GRAND_PARENT];
+			((grandParent.child1 == PARENT) ? grandParent.child1 : grandParent.child2) = SIBLING;
+			refit(GRAND_PARENT);
+		}
+		else {
+			mRoot = SIBLING;
+		}
+	}
+
+	void CullingTree3D::refit(int32_t node)
+	{
+		// Rebalance the ancestors and update their boxes and heights
+		while (node != -1)
+		{
+			node = balance(node);
+
+			TreeNode& treeNode = mNodes[node];
+			const TreeNode& child1 = mNodes[treeNode.child1];
+			const TreeNode& child2 = mNodes[treeNode.child2];
+			treeNode.height = 1 + std::max(child1.height, child2.height);
+			treeNode.box = combine(child1.box, child2.box);
+
+			node = treeNode.parent;
+		}
+	}
+
+	int32_t CullingTree3D::balance(int32_t iA)
+	{
+		TreeNode& a = mNodes[iA];
+		if (a.child1 == -1 || a.height < 2) {
+			return iA;
+		}
+
+		const int32_t iB = a.child1;
+		const int32_t iC = a.child2;
+		TreeNode& b = mNodes[iB];
+		TreeNode& c = mNodes[iC];
+		const int32_t BALANCE = c.height - b.height;
+
+		// Replaces A by its child X in A's parent
+		const auto promote = [&](int32_t iX, TreeNode& x) {
+			x.parent = a.parent;
+			a.parent = iX;
+			if (x.parent != -1) {
+				TreeNode& parent = mNodes[x.parent];
+				((parent.child1 == iA) ? parent.child1 : parent.child2) = iX;
+			}
+			else {
+				mRoot = iX;
+			}
+		};
+
+		// Rotate C up
+		if (BALANCE > 1) {
+			const int32_t iF = c.child1;
+			const int32_t iG = c.child2;
+			TreeNode& f = mNodes[iF];
+			TreeNode& g = mNodes[iG];
+
+			c.child1 = iA;
+			promote(iC, c);
+
+			// The highest of C's children stays under C, the other one replaces C under A
+			const bool F_HIGHER = (f.height > g.height);
+			const int32_t iHigh = F_HIGHER ? iF : iG;
+			const int32_t iLow = F_HIGHER ? iG : iF;
+			TreeNode& high = mNodes[iHigh];
+			TreeNode& low = mNodes[iLow];
+
+			c.child2 = iHigh;
+			a.child2 = iLow;
+			low.parent = iA;
+			a.box = combine(b.box, low.box);
+			c.box = combine(a.box, high.box);
+			a.height = 1 + std::max(b.height, low.height);
+			c.height = 1 + std::max(a.height, high.height);
+
+			return iC;
+		}
+
+		// Rotate B up
+		if (BALANCE < -1) {
+			const int32_t iD = b.child1;
+			const int32_t iE = b.child2;
+			TreeNode& d = mNodes[iD];
+			TreeNode& e = mNodes[iE];
+
+			b.child1 = iA;
+			promote(iB, b);
+
+			// The highest of B's children stays under B, the other one replaces B under A
+			const bool D_HIGHER = (d.height > e.height);
+			const int32_t iHigh = D_HIGHER ? iD : iE;
+			const int32_t iLow = D_HIGHER ? iE : iD;
+			TreeNode& high = mNodes[iHigh];
+			TreeNode& low = mNodes[iLow];
+
+			b.child2 = iHigh;
+			a.child1 = iLow;
+			low.parent = iA;
+			a.box = combine(c.box, low.box);
+			b.box = combine(a.box, high.box);
+			a.height = 1 + std::max(c.height, low.height);
+			b.height = 1 + std::max(a.height, high.height);
+
+			return iB;
+		}
+
+		return iA;
+	}
+
+	Box3f CullingTree3D::getFatBox(uint32_t proxy) const
+	{
+		const Vector3f MARGIN(mMargin, mMargin, mMargin);
+		return Box3f(mBoxes[proxy].min - MARGIN, mBoxes[proxy].max + MARGIN);
+	}
+}
\ No newline at end of file
@@ -27,6 +27,7 @@ namespace ae
 	// Public constructor(s)
 	EllipseShape::EllipseShape(const Vector2f& radius, size_t pointCount)
 		: Shape()
+		, mUnitPoints(getUnitCircle(pointCount))
 		, mRadius(radius)
 		, mPointCount(pointCount)
 	{
@@ -34,6 +35,7 @@ namespace ae
 
 	EllipseShape::EllipseShape(EllipseShape&& rvalue) noexcept
 		: Shape(std::move(rvalue))
+		, mUnitPoints(std::move(rvalue.mUnitPoints))
 		, mRadius(std::move(rvalue.mRadius))
 		, mPointCount(rvalue.mPointCount)
 	{
@@ -44,6 +46,7 @@ namespace ae
 	{
 		// Copy the rvalue's trivial data and move the rest
 		Shape::operator=(std::move(rvalue));
+		mUnitPoints = std::move(rvalue.mUnitPoints);
 		mRadius = std::move(rvalue.mRadius);
 		mPointCount = rvalue.mPointCount;
 
@@ -55,6 +58,7 @@ namespace ae
 	{
 		mRadius = radius;
 		mUpdatePositions = true;
+		wake();
 	}
 
 	void EllipseShape::setRadius(float radiusX, float radiusY) noexcept
@@ -62,12 +66,15 @@ namespace ae
 		mRadius.x = radiusX;
 		mRadius.y = radiusY;
 		mUpdatePositions = true;
+		wake();
 	}
 
 	void EllipseShape::setPointCount(size_t count) noexcept
 	{
+		mUnitPoints = getUnitCircle(count);
 		mPointCount = count;
 		mUpdatePositions = true;
+		wake();
 	}
 
 	const Vector2f& EllipseShape::getRadius() const noexcept
@@ -90,7 +97,32 @@ namespace ae
 			}
 		}
 
-		const float ANGLE = index * 2.f * Math::PI / mPointCount - Math::PI / 2.f;
-		return mRadius + Vector2f(Math::cos(ANGLE) * mRadius.x, Math::sin(ANGLE) * mRadius.y);
+		return mRadius + (*mUnitPoints)[index] * mRadius;
+	}
+
+	void EllipseShape::getPoints(Vector2f* points) const
+	{
+		// Scale and offset the unit circle
+		const std::vector<Vector2f>& UNIT_POINTS = *mUnitPoints;
+		for (size_t i = 0; i < mPointCount; ++i) {
+			points[i] = mRadius + UNIT_POINTS[i] * mRadius;
+		}
+	}
+	// Private virtual method(s)
+	float EllipseShape::getCurveRadius() const noexcept
+	{
+		return Math::max(mRadius.x, mRadius.y);
+	}
+
+	void EllipseShape::applySegmentCount(size_t segmentCount)
+	{
+		if (segmentCount != mPointCount) {
+			setPointCount(segmentCount);
+		}
+	}
+
+	std::unique_ptr<Actor2D> EllipseShape::cloneSelf() const
+	{
+		return std::make_unique<EllipseShape>(*this);
 	}
 }
\ No newline at end of file
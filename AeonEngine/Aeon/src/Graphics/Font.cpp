@@ -22,83 +22,307 @@
 
 #include <AEON/Graphics/Font.h>
 
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+
 #include <GL/glew.h>
 
 #include <ft2build.h>
 #include FT_FREETYPE_H
+#include FT_MODULE_H
+#include FT_SIZES_H
 
 #include <AEON/System/DebugLogger.h>
-#include <AEON/Window/internal/EventQueue.h>
-#include <AEON/Window/Event.h>
+#include <AEON/System/MemoryTracker.h>
+#include <AEON/System/Profiler.h>
 #include <AEON/Graphics/internal/FontManager.h>
 #include <AEON/Graphics/internal/Glyph.h>
-#include <AEON/Graphics/GLResourceFactory.h>
 
 namespace ae
 {
+	namespace
+	{
+		// The mutex protecting the creation and destruction of faces, which use the shared FreeType library
+		std::mutex libraryMutex;
+
+		// The memory resource supplied for the glyph pages of the fonts created, nullptr if none was
+		std::atomic<std::pmr::memory_resource*> pageResource(nullptr);
+
+		// Retrieves the memory resource from which the glyph pages of a font being created are allocated
+		std::pmr::memory_resource* getPageResource() noexcept
+		{
+			std::pmr::memory_resource* const RESOURCE = pageResource.load(std::memory_order_acquire);
+			return (RESOURCE) ? RESOURCE : std::pmr::get_default_resource();
+		}
+
+		// The number of glyphs rasterized by each job of rasterizeAsync()
+		constexpr size_t ASYNC_BATCH_SIZE = 64;
+
+		// The character size at which the distance fields are rasterized and their spread (in pixels) around the outlines
+		constexpr unsigned int DISTANCE_FIELD_SIZE = 48;
+		constexpr FT_UInt DISTANCE_FIELD_SPREAD = 6;
+
+		// The key marking the glyph cache's empty slots and the maximum number of glyph runs cached by each page
+		constexpr uint64_t EMPTY_GLYPH_KEY = ~0ull;
+		constexpr size_t MAX_GLYPH_RUNS = 512;
+
+		// Scatters the glyph cache's keys over the table's slots
+		inline size_t hashGlyphKey(uint64_t key, size_t capacity) noexcept
+		{
+			key *= 0x9E3779B97F4A7C15ull;
+			return static_cast<size_t>(key ^ (key >> 32)) & (capacity - 1);
+		}
+
+		// Creates a FreeType face reading the font from the memory provided (the memory must outlive the face)
+		FT_Error openMemoryFace(const FileSystem::MappedFile& data, FT_Face& ftFace)
+		{
+			FT_Library ftLib = static_cast<FT_Library>(FontManager::getInstance().getHandle());
+			std::lock_guard<std::mutex> lock(libraryMutex);
+			return FT_New_Memory_Face(ftLib, data.data(), static_cast<FT_Long>(data.size()), 0, &ftFace);
+		}
+
+		// The FreeType library owned by a thread, so that the threads rasterizing glyphs don't contend over the shared library
+		struct ThreadLibrary
+		{
+			FT_Library handle = nullptr;
+
+			~ThreadLibrary()
+			{
+				if (handle) {
+					FT_Done_FreeType(handle);
+				}
+			}
+		};
+
+		// Retrieves the calling thread's FreeType library, initialized upon the first call (nullptr if it couldn't be initialized)
+		FT_Library getThreadLibrary()
+		{
+			thread_local ThreadLibrary library;
+			if (!library.handle) {
+				FT_Library ftLibrary;
+				if (FT_Init_FreeType(&ftLibrary)) {
+					return nullptr;
+				}
+
+				// Widen the distance fields' spread before any face is created
+				const FT_UInt SPREAD = DISTANCE_FIELD_SPREAD;
+				FT_Property_Set(ftLibrary, "sdf", "spread", &SPREAD);
+				library.handle = ftLibrary;
+			}
+
+			return library.handle;
+		}
+
+		// Loads and rasterizes the glyph in the face's glyph slot
+		FT_Error renderGlyph(FT_Face ftFace, uint32_t codepoint, Font::RenderMode mode)
+		{
+			if (mode == Font::RenderMode::Bitmap) {
+				return FT_Load_Char(ftFace, codepoint, FT_LOAD_RENDER);
+			}
+
+			// Widen the distance fields' spread (shared by the library, so it's only set once)
+			static std::once_flag spreadFlag;
+			std::call_once(spreadFlag, []() {
+				const FT_UInt SPREAD = DISTANCE_FIELD_SPREAD;
+				std::lock_guard<std::mutex> lock(libraryMutex);
+				FT_Property_Set(static_cast<FT_Library>(FontManager::getInstance().getHandle()), "sdf", "spread", &SPREAD);
+			});
+
+			FT_Error ftError = FT_Load_Char(ftFace, codepoint, FT_LOAD_DEFAULT);
+			if (!ftError) {
+				ftError = FT_Render_Glyph(ftFace->glyph, FT_RENDER_MODE_SDF);
+			}
+			return ftError;
+		}
+
+		// Copies the FreeType glyph's metadata and its bitmap without the row padding
+		Font::GlyphBitmap copyGlyphBitmap(uint32_t codepoint, const FT_GlyphSlot ftGlyph)
+		{
+			Font::GlyphBitmap bitmap;
+			bitmap.codepoint = codepoint;
+			bitmap.size = Vector2i(ftGlyph->bitmap.width, ftGlyph->bitmap.rows);
+			bitmap.bearing = Vector2i(ftGlyph->bitmap_left, ftGlyph->bitmap_top);
+			bitmap.advance = static_cast<unsigned int>(ftGlyph->advance.x);
+
+			if (ftGlyph->bitmap.buffer) {
+				bitmap.pixels.resize(static_cast<size_t>(bitmap.size.x) * bitmap.size.y);
+				for (int row = 0; row < bitmap.size.y; ++row) {
+					const unsigned char* const SOURCE = ftGlyph->bitmap.buffer + static_cast<ptrdiff_t>(row) * ftGlyph->bitmap.pitch;
+					std::copy(SOURCE, SOURCE + bitmap.size.x, bitmap.pixels.begin() + static_cast<ptrdiff_t>(row) * bitmap.size.x);
+				}
+			}
+
+			return bitmap;
+		}
+	}
+
 	// Font::Page
 		// Public constructor(s)
-	Font::Page::Page(const std::string& filename, bool& success)
+	Font::Page::Page(void* face, bool& success)
 		: glyphs()
-		, face(nullptr)
+		, runs()
+		, size(nullptr)
 	{
-		// Retrieve the pointer to the FreeType library
-		FT_Library ftLib = static_cast<FT_Library>(FontManager::getInstance().getHandle());
-
-		// Load in the new font face and check for eventual errors
-		FT_Face ftFace;
-		FT_Error ftError = FT_New_Face(ftLib, filename.c_str(), 0, &ftFace);
-		if (ftError == FT_Err_Unknown_File_Format) {
-			AEON_LOG_ERROR("Failed to load font from file", "The font file was read, but its format is unsupported.");
-			success = false;
-			return;
-		}
-		else if (ftError) {
-			AEON_LOG_ERROR("Failed to load font from file", "The filepath \"" + filename + "\" may be incorrect.\nError code: " + std::to_string(ftError) + '.');
+		// Create a size object for the page so that every page may share the same face
+		FT_Size ftSize;
+		FT_Error ftError = FT_New_Size(static_cast<FT_Face>(face), &ftSize);
+		if (ftError) {
+			AEON_LOG_ERROR("Failed to create glyph page", "The FreeType size object couldn't be created.\nError code: " + std::to_string(ftError) + '.');
 			success = false;
 			return;
 		}
 
-		// Store the pointer to the font face
-		face = static_cast<void*>(ftFace);
+		// Store the pointer to the size object
+		size = static_cast<void*>(ftSize);
 		success = true;
 	}
 
-	Font::Page::Page(Page&& rvalue) noexcept
-		: glyphs(std::move(rvalue.glyphs))
-		, face(rvalue.face)
+	// Font::Face
+		// Public constructor(s)
+	Font::Face::Face() noexcept
+		: data()
+		, handle(nullptr)
 	{
 	}
 
-	Font::Page::~Page()
+	Font::Face::Face(Face&& rvalue) noexcept
+		: data(std::move(rvalue.data))
+		, handle(std::exchange(rvalue.handle, nullptr))
 	{
-		// Release the FreeType resources allocated
-		if (face) {
-			FT_Face ftFace = static_cast<FT_Face>(face);
-			FT_Error ftError = FT_Done_Face(ftFace);
-			if (ftError) {
-				AEON_LOG_WARNING("Failed to terminate FreeType face", "Unable to properly release internal resources.\nError code: " + std::to_string(ftError) + '.');
-			}
-		}
+	}
+
+	Font::Face::~Face()
+	{
+		close();
 	}
 
 		// Public operator(s)
-	Font::Page& Font::Page::operator=(Page&& rvalue) noexcept
+	Font::Face& Font::Face::operator=(Face&& rvalue) noexcept
 	{
-		// Copy the rvalue's trivial data and move the rest
-		glyphs = std::move(rvalue.glyphs);
-		face = rvalue.face;
+		// Release the current face and take over the rvalue's
+		close();
+		data = std::move(rvalue.data);
+		handle = std::exchange(rvalue.handle, nullptr);
 
 		return *this;
 	}
 
+		// Public method(s)
+	bool Font::Face::open(const std::string& filename)
+	{
+		AEON_PROFILE_SCOPE("Font::Face::open");
+		close();
+
+		// Map the font file's contents once, the FreeType faces created from them don't access the file
+		data = FileSystem::mapFile(filename);
+		if (!data.isOpen()) {
+			AEON_LOG_ERROR("Failed to load font from file", "The filepath \"" + filename + "\" may be incorrect.");
+			return false;
+		}
+
+		// Create the font face and check for eventual errors
+		FT_Face ftFace;
+		FT_Error ftError = openMemoryFace(data, ftFace);
+		if (ftError == FT_Err_Unknown_File_Format) {
+			AEON_LOG_ERROR("Failed to load font from file", "The font file was read, but its format is unsupported.");
+			data.close();
+			return false;
+		}
+		else if (ftError) {
+			AEON_LOG_ERROR("Failed to load font from file", "The font \"" + filename + "\" couldn't be opened.\nError code: " + std::to_string(ftError) + '.');
+			data.close();
+			return false;
+		}
+
+		// Store the pointer to the font face
+		handle = static_cast<void*>(ftFace);
+		return true;
+	}
+
+	void Font::Face::close()
+	{
+		// Release the FreeType resources allocated (the pages' size objects are released along with the face)
+		if (handle) {
+			std::unique_lock<std::mutex> lock(libraryMutex);
+			FT_Error ftError = FT_Done_Face(static_cast<FT_Face>(handle));
+			lock.unlock();
+			if (ftError) {
+				AEON_LOG_WARNING("Failed to terminate FreeType face", "Unable to properly release internal resources.\nError code: " + std::to_string(ftError) + '.');
+			}
+			handle = nullptr;
+		}
+		data.close();
+	}
+
 	// Font
 		// Public constructor(s)
 	Font::Font() noexcept
-		: mPages()
+		: mPages(getPageResource())
 		, mAtlas(Texture2D::InternalFormat::R8)
 		, mFilename("")
+		, mMode(RenderMode::Bitmap)
+		, mFace()
+		, mGlyphCache()
+		, mGlyphCacheCount(0)
+		, mListeners()
+		, mRasterized()
+		, mRasterMutex()
+		, mRasterJob(nullptr)
+		, mPendingBatches(0)
+	{
+		if _CONSTEXPR_IF (AEON_HOT_RELOAD) {
+			FontManager::getInstance().registerFont(this);
+		}
+	}
+
+	Font::Font(Font&& rvalue) noexcept
+		: mPages((rvalue.finishRasterization(true), std::move(rvalue.mPages))) // the rvalue's jobs complete before its face is moved
+		, mAtlas(std::move(rvalue.mAtlas))
+		, mFilename(std::move(rvalue.mFilename))
+		, mMode(rvalue.mMode)
+		, mFace(std::move(rvalue.mFace))
+		, mGlyphCache(std::move(rvalue.mGlyphCache))
+		, mGlyphCacheCount(std::exchange(rvalue.mGlyphCacheCount, 0))
+		, mListeners(std::move(rvalue.mListeners))
+		, mRasterized()
+		, mRasterMutex()
+		, mRasterJob(nullptr)
+		, mPendingBatches(0)
+	{
+		if _CONSTEXPR_IF (AEON_HOT_RELOAD) {
+			FontManager::getInstance().registerFont(this);
+		}
+	}
+
+	Font::~Font()
 	{
+		// The glyphs rasterized by the jobs in flight are discarded
+		finishRasterization(false);
+
+		if _CONSTEXPR_IF (AEON_HOT_RELOAD) {
+			FontManager::getInstance().unregisterFont(this);
+		}
+	}
+
+		// Public operator(s)
+	Font& Font::operator=(Font&& rvalue) noexcept
+	{
+		// Complete the rasterization jobs in flight before their face is replaced
+		finishRasterization(false);
+		rvalue.finishRasterization(true);
+
+		// The face is released after the pages whose size objects it owns
+		mPages = std::move(rvalue.mPages);
+		mAtlas = std::move(rvalue.mAtlas);
+		mFilename = std::move(rvalue.mFilename);
+		mMode = rvalue.mMode;
+		mFace = std::move(rvalue.mFace);
+		mGlyphCache = std::move(rvalue.mGlyphCache);
+		mGlyphCacheCount = std::exchange(rvalue.mGlyphCacheCount, 0);
+		mListeners = std::move(rvalue.mListeners);
+
+		return *this;
 	}
 
 		// Public method(s)
@@ -109,22 +333,53 @@ namespace ae
 			return;
 		}
 
-		// Reinitialize the glyph pages and the atlas if necessary
+		// Reinitialize the glyph pages and the atlas if necessary (the glyphs being rasterized from the previous font are discarded)
 		if (!mFilename.empty()) {
-			std::map<unsigned int, Page>().swap(mPages);
+			finishRasterization(false);
+			mPages.clear();
+			std::vector<std::pair<uint64_t, const Glyph*>>().swap(mGlyphCache);
+			mGlyphCacheCount = 0;
 			mAtlas = TextureAtlas(Texture2D::InternalFormat::R8);
 		}
 
-		// Set the new filename
+		// Set the new filename and read in the font shared by the glyph pages
 		mFilename = filename;
+		mFace.open(mFilename);
+	}
+
+	bool Font::reloadFromFile()
+	{
+		// Open the new face first so that the current font is kept if the file can't be read
+		Face face;
+		if (mFilename.empty() || !face.open(mFilename)) {
+			return false;
+		}
+
+		// Recreate the glyph pages and the atlas from the new face, the previously retrieved glyphs being invalidated
+		finishRasterization(false);
+		mPages.clear();
+		std::vector<std::pair<uint64_t, const Glyph*>>().swap(mGlyphCache);
+		mGlyphCacheCount = 0;
+		mAtlas = TextureAtlas(Texture2D::InternalFormat::R8);
+		mFace = std::move(face);
+
+		notifyListeners(true);
+		return true;
 	}
 
 	const Glyph& Font::getGlyph(uint32_t codepoint, unsigned int characterSize)
 	{
+		// Check if the glyph has already been retrieved
+		const unsigned int PAGE_SIZE = getPageSize(characterSize);
+		const uint64_t KEY = (static_cast<uint64_t>(PAGE_SIZE) << 32) | codepoint;
+		if (const Glyph* const cachedGlyph = findCachedGlyph(KEY)) {
+			return *cachedGlyph;
+		}
+
 		// Check if the corresponding glyph page exists, create it otherwise
-		PageItr pageItr = mPages.find(characterSize);
+		PageItr pageItr = mPages.find(PAGE_SIZE);
 		if (pageItr == mPages.end()) {
-			pageItr = createPage(characterSize);
+			pageItr = createPage(PAGE_SIZE);
 		}
 
 		// Check if the glyph requested exists, create it otherwise
@@ -133,16 +388,240 @@ namespace ae
 		if (glyphItr == glyphMap.end()) {
 			glyphItr = loadGlyph(pageItr, codepoint);
 		}
+		if (glyphItr != glyphMap.end()) {
+			cacheGlyph(KEY, &glyphItr->second);
+		}
 
 		return glyphItr->second;
 	}
 
+	const Font::GlyphRun& Font::getGlyphRun(const std::u32string& codepoints, unsigned int characterSize)
+	{
+		// Check if the corresponding glyph page exists, create it otherwise
+		static const GlyphRun EMPTY_RUN;
+		const unsigned int PAGE_SIZE = getPageSize(characterSize);
+		PageItr pageItr = mPages.find(PAGE_SIZE);
+		if (pageItr == mPages.end()) {
+			pageItr = createPage(PAGE_SIZE);
+			if (pageItr == mPages.end()) {
+				return EMPTY_RUN;
+			}
+		}
+
+		// Check if the run has already been laid out
+		std::unordered_map<std::u32string, GlyphRun>& runs = pageItr->second.runs;
+		auto runItr = runs.find(codepoints);
+		if (runItr != runs.end()) {
+			return runItr->second;
+		}
+
+		// Lay out the new run (the cache is emptied once it's full so that rarely-used strings don't accumulate)
+		if (runs.size() >= MAX_GLYPH_RUNS) {
+			runs.clear();
+		}
+		GlyphRun& run = runs[codepoints];
+		run.glyphs.reserve(codepoints.size());
+		run.offsets.reserve(codepoints.size() + 1);
+		run.offsets.push_back(0.f);
+		for (const char32_t codepoint : codepoints) {
+			const Glyph& glyph = getGlyph(codepoint, PAGE_SIZE);
+			run.glyphs.push_back(&glyph);
+			run.offsets.push_back(run.offsets.back() + static_cast<float>(glyph.advance >> 6));
+		}
+
+		return run;
+	}
+
+	void Font::setRenderMode(RenderMode mode)
+	{
+		// Check if the glyphs have already been rasterized in the previous mode
+		if (mMode != mode && !mPages.empty()) {
+			AEON_LOG_ERROR("Glyphs already loaded", "The render mode must be set before the first glyph is loaded.\nAborting operation.");
+			return;
+		}
+
+		mMode = mode;
+	}
+
+	Font::RenderMode Font::getRenderMode() const noexcept
+	{
+		return mMode;
+	}
+
+	const std::string& Font::getFilename() const noexcept
+	{
+		return mFilename;
+	}
+
+	float Font::getGlyphScale(unsigned int characterSize) const noexcept
+	{
+		return static_cast<float>(characterSize) / static_cast<float>(getPageSize(characterSize));
+	}
+
+	void Font::preload(const std::u32string& codepoints, unsigned int characterSize)
+	{
+		upload(rasterize(codepoints, characterSize));
+	}
+
+	Font::GlyphBatch Font::rasterize(const std::u32string& codepoints, unsigned int characterSize) const
+	{
+		AEON_PROFILE_SCOPE("Font::rasterize");
+		AEON_MEMORY_SCOPE(MemoryTag::Text);
+		GlyphBatch batch;
+		batch.characterSize = getPageSize(characterSize);
+		batch.glyphs.reserve(codepoints.size());
+
+		// Open a face dedicated to the batch from the calling thread's library so that the rasterization may be executed by any thread
+		// without sharing the library (the font file isn't read again)
+		FT_Library ftLibrary = getThreadLibrary();
+		FT_Face ftFace;
+		FT_Error ftError = (!mFace.handle) ? FT_Err_Invalid_Handle
+		                 : (!ftLibrary) ? FT_Err_Cannot_Open_Resource
+		                 : FT_New_Memory_Face(ftLibrary, mFace.data.data(), static_cast<FT_Long>(mFace.data.size()), 0, &ftFace);
+		if (ftError) {
+			AEON_LOG_ERROR("Failed to rasterize glyphs", "The font \"" + mFilename + "\" couldn't be opened.\nError code: " + std::to_string(ftError) + '.');
+			return batch;
+		}
+
+		// Rasterize the glyphs requested
+		if (FT_Set_Pixel_Sizes(ftFace, 0, batch.characterSize)) {
+			AEON_LOG_ERROR("Failed to set font size", "The character size '" + std::to_string(batch.characterSize) + "' couldn't be extracted.");
+		}
+		else {
+			for (const char32_t codepoint : codepoints) {
+				if (renderGlyph(ftFace, codepoint, mMode)) {
+					AEON_LOG_WARNING("Failed to load glyph", "Unable to load the glyph '" + std::to_string(static_cast<uint32_t>(codepoint)) + "', it was skipped.");
+					continue;
+				}
+				batch.glyphs.push_back(copyGlyphBitmap(codepoint, ftFace->glyph));
+			}
+		}
+
+		FT_Done_Face(ftFace);
+		return batch;
+	}
+
+	void Font::upload(const GlyphBatch& batch)
+	{
+		AEON_PROFILE_SCOPE("Font::upload");
+		// Check if the corresponding glyph page exists, create it otherwise
+		const unsigned int PAGE_SIZE = getPageSize(batch.characterSize);
+		PageItr pageItr = mPages.find(PAGE_SIZE);
+		if (pageItr == mPages.end()) {
+			pageItr = createPage(PAGE_SIZE);
+			if (pageItr == mPages.end()) {
+				return;
+			}
+		}
+
+		// Store the glyphs that haven't been loaded yet
+		bool grown = false;
+		for (const GlyphBitmap& bitmap : batch.glyphs) {
+			if (pageItr->second.glyphs.find(bitmap.codepoint) == pageItr->second.glyphs.end()) {
+				storeGlyph(pageItr, bitmap, grown);
+			}
+		}
+
+		// Notify the listeners once that they should update their uv coordinates as the atlas' size changed
+		if (grown) {
+			notifyListeners(false);
+		}
+	}
+
+	void Font::rasterizeAsync(const std::u32string& codepoints, unsigned int characterSize)
+	{
+		// Make sure that the font was loaded
+		if (!mFace.handle) {
+			AEON_LOG_ERROR("Failed to rasterize glyphs", "The font \"" + mFilename + "\" hasn't been loaded.\nAborting operation.");
+			return;
+		}
+
+		// Skip the glyphs already loaded
+		const PageItr PAGE_ITR = mPages.find(getPageSize(characterSize));
+		std::u32string remaining;
+		remaining.reserve(codepoints.size());
+		for (const char32_t codepoint : codepoints) {
+			if (PAGE_ITR == mPages.end() || PAGE_ITR->second.glyphs.find(codepoint) == PAGE_ITR->second.glyphs.end()) {
+				remaining.push_back(codepoint);
+			}
+		}
+		if (remaining.empty()) {
+			return;
+		}
+
+		// Rasterize the batches in parallel, the jobs in flight sharing a parent so that they can be waited upon
+		JobSystem& jobSystem = JobSystem::getInstance();
+		if (!mRasterJob) {
+			mRasterJob = jobSystem.createJob(nullptr);
+		}
+		for (size_t first = 0; first < remaining.size(); first += ASYNC_BATCH_SIZE) {
+			jobSystem.run(jobSystem.createJob([this, batchCodepoints = remaining.substr(first, ASYNC_BATCH_SIZE), characterSize]() {
+				GlyphBatch batch = rasterize(batchCodepoints, characterSize);
+
+				// Hand the batch over to the thread owning the OpenGL context (the empty batches are handed over as well so that they're accounted for)
+				std::lock_guard<std::mutex> lock(mRasterMutex);
+				mRasterized.push_back(std::move(batch));
+			}, mRasterJob));
+			++mPendingBatches;
+		}
+
+		// The batches are inserted into the atlas as they complete, once per frame
+		FontManager::getInstance().addRasterizingFont(this);
+	}
+
+	bool Font::isRasterizing() const noexcept
+	{
+		return mPendingBatches != 0;
+	}
+
+	void Font::addListener(const void* listener, std::function<void(bool)> callback) const
+	{
+		mListeners.emplace_back(listener, std::move(callback));
+	}
+
+	void Font::removeListener(const void* listener) const
+	{
+		// Swap the listener with the last one as the notification order doesn't matter
+		for (auto listenerItr = mListeners.begin(); listenerItr != mListeners.end(); ++listenerItr) {
+			if (listenerItr->first == listener) {
+				std::iter_swap(listenerItr, mListeners.end() - 1);
+				mListeners.pop_back();
+				return;
+			}
+		}
+	}
+
+	// Public static method(s)
+	std::u32string Font::getCodepointRange(uint32_t first, uint32_t last)
+	{
+		std::u32string codepoints;
+		if (first <= last) {
+			codepoints.reserve(last - first + 1);
+			for (uint32_t codepoint = first; codepoint <= last && codepoint >= first; ++codepoint) {
+				codepoints.push_back(static_cast<char32_t>(codepoint));
+			}
+		}
+
+		return codepoints;
+	}
+
+	void Font::setPageResource(std::pmr::memory_resource* resource) noexcept
+	{
+		pageResource.store(resource, std::memory_order_release);
+	}
+
 		// Private method(s)
 	Font::PageItr Font::createPage(unsigned int characterSize)
 	{
+		// Make sure that the font was loaded
+		if (!mFace.handle) {
+			AEON_LOG_ERROR("Failed to create glyph page", "The font \"" + mFilename + "\" hasn't been loaded.");
+			return mPages.end();
+		}
+
 		// Create the glyph page
 		bool success;
-		PageItr pageItr = mPages.try_emplace(characterSize, mFilename, success).first;
+		PageItr pageItr = mPages.try_emplace(characterSize, mFace.handle, success).first;
 
 		// Delete the glyph page if it wasn't successfully created
 		if (!success) {
@@ -152,8 +631,9 @@ namespace ae
 			return mPages.end();
 		}
 
-		// Set the font size that the user wishes to extract from the FreeType face
-		FT_Face ftFace = static_cast<FT_Face>(pageItr->second.face);
+		// Set the font size that the user wishes to extract from the FreeType face through the page's size object
+		FT_Face ftFace = static_cast<FT_Face>(mFace.handle);
+		FT_Activate_Size(static_cast<FT_Size>(pageItr->second.size));
 		FT_Error ftError = FT_Set_Pixel_Sizes(ftFace, 0, characterSize);
 		if (ftError) {
 			AEON_LOG_ERROR("Failed to set font size", "The character size '" + std::to_string(characterSize) + "' couldn't be extracted.");
@@ -164,65 +644,159 @@ namespace ae
 		return pageItr;
 	}
 
+	unsigned int Font::getPageSize(unsigned int characterSize) const noexcept
+	{
+		return (mMode == RenderMode::DistanceField) ? DISTANCE_FIELD_SIZE : characterSize;
+	}
+
 	Font::GlyphItr Font::loadGlyph(PageItr& page, uint32_t codepoint)
 	{
-		// Load in the FreeType glyph
-		FT_Face ftFace = static_cast<FT_Face>(page->second.face);
-		FT_Error ftError = FT_Load_Char(ftFace, codepoint, FT_LOAD_RENDER);
+		AEON_PROFILE_SCOPE("Font::loadGlyph");
+
+		// Load in the FreeType glyph at the page's size
+		FT_Face ftFace = static_cast<FT_Face>(mFace.handle);
+		FT_Activate_Size(static_cast<FT_Size>(page->second.size));
+		FT_Error ftError = renderGlyph(ftFace, codepoint, mMode);
 		if (ftError) {
 			AEON_LOG_ERROR("Failed to load glyph", "Unable to load the glyph '" + std::to_string(static_cast<char>(codepoint)) + "'.");
 			return page->second.glyphs.end();
 		}
 
-		// Create the glyph
-			// Create and store the glyph's texture within the texture atlas
-		FT_GlyphSlot ftGlyph = ftFace->glyph;
-		std::shared_ptr<Texture2D> glyphTexture = nullptr;
-		if (ftGlyph->bitmap.buffer) {
-			glyphTexture = GLResourceFactory::getInstance().create<Texture2D>("", Texture2D::Filter::Linear, Texture2D::Wrap::ClampToEdge, Texture2D::InternalFormat::R8);
-			if (glyphTexture->create(ftGlyph->bitmap.width, ftGlyph->bitmap.rows, ftGlyph->bitmap.buffer)) {
-				mAtlas.add(*glyphTexture);
-			}
+		// Create the glyph and insert its bitmap into the texture atlas
+		bool grown = false;
+		GlyphItr glyphItr = storeGlyph(page, copyGlyphBitmap(codepoint, ftFace->glyph), grown);
+
+		// Notify the listeners that they should update their uv coordinates as the atlas' size changed
+		if (grown) {
+			notifyListeners(false);
 		}
 
-			// Set the glyph's metadata
-		GlyphItr glyphItr = page->second.glyphs.emplace(codepoint, Glyph()).first;
+		// Return the loaded glyph's iterator
+		return glyphItr;
+	}
+
+	Font::GlyphItr Font::storeGlyph(PageItr& page, const GlyphBitmap& bitmap, bool& grown)
+	{
+		// Set the glyph's metadata
+		GlyphItr glyphItr = page->second.glyphs.emplace(bitmap.codepoint, Glyph()).first;
 		Glyph& glyph = glyphItr->second;
-		glyph.textureRect.size.x = ftGlyph->bitmap.width;
-		glyph.textureRect.size.y = ftGlyph->bitmap.rows;
-		glyph.bearing.x = ftGlyph->bitmap_left;
-		glyph.bearing.y = ftGlyph->bitmap_top;
-		glyph.individualTexture = (ftGlyph->bitmap.buffer) ? glyphTexture : nullptr;
-		glyph.advance = ftGlyph->advance.x;
+		glyph.textureRect.size = bitmap.size;
+		glyph.bearing = bitmap.bearing;
+		glyph.texture = &mAtlas.getTexture();
+		glyph.advance = bitmap.advance;
 
-		// Pack together all individual textures and assign the packed positions to the glyphs
-		updateAtlasTexture();
+		// Insert the glyph's bitmap into the texture atlas (only the bitmap is uploaded)
+		if (!bitmap.pixels.empty()) {
+			bool insertionGrown = false;
+			const std::pair<bool, Box2i> TEXTURE_RECT = mAtlas.insert(bitmap.size.x, bitmap.size.y, bitmap.pixels.data(), &insertionGrown);
+			if (TEXTURE_RECT.first) {
+				glyph.textureRect.position = TEXTURE_RECT.second.position;
+			}
+			grown = grown || insertionGrown;
+		}
 
-		// Return the loaded glyph's iterator
 		return glyphItr;
 	}
 
-	void Font::updateAtlasTexture()
+	const Glyph* Font::findCachedGlyph(uint64_t key) const noexcept
 	{
-		// Pack together all individual textures amassed thus far
-		mAtlas.pack();
+		if (mGlyphCache.empty()) {
+			return nullptr;
+		}
 
-		// Assign the packed position and texture atlas to all glyphs inside the page
-		const Texture2D& atlasTexture = mAtlas.getTexture();
-		for (auto& pageItr : mPages)
-		{
-			for (auto& glyphItr : pageItr.second.glyphs)
-			{
-				Glyph& glyph = glyphItr.second;
-				if (glyph.individualTexture) {
-					glyph.textureRect.position = mAtlas.getTextureRect(*glyph.individualTexture).position;
+		// Probe the slots linearly until the key or an empty slot is found
+		const size_t CAPACITY = mGlyphCache.size();
+		for (size_t slot = hashGlyphKey(key, CAPACITY);; slot = (slot + 1) & (CAPACITY - 1)) {
+			const std::pair<uint64_t, const Glyph*>& entry = mGlyphCache[slot];
+			if (entry.first == key) {
+				return entry.second;
+			}
+			if (entry.first == EMPTY_GLYPH_KEY) {
+				return nullptr;
+			}
+		}
+	}
+
+	void Font::cacheGlyph(uint64_t key, const Glyph* glyph)
+	{
+		// Double the table's capacity (a power of two) when it's three-quarters full and reinsert the glyphs
+		if ((mGlyphCacheCount + 1) * 4 > mGlyphCache.size() * 3) {
+			std::vector<std::pair<uint64_t, const Glyph*>> previous(std::max(mGlyphCache.size() * 2, size_t(128)), std::make_pair(EMPTY_GLYPH_KEY, nullptr));
+			previous.swap(mGlyphCache);
+			mGlyphCacheCount = 0;
+			for (const std::pair<uint64_t, const Glyph*>& entry : previous) {
+				if (entry.first != EMPTY_GLYPH_KEY) {
+					cacheGlyph(entry.first, entry.second);
 				}
-				glyph.texture = &atlasTexture;
 			}
 		}
 
-		// Enqueue an event indicating that corresponding texts should update their uv coordinates
-		auto event = std::make_unique<FontEvent>(this);
-		EventQueue::getInstance().enqueueEvent(std::move(event));
+		// Insert the glyph in the first empty slot
+		const size_t CAPACITY = mGlyphCache.size();
+		size_t slot = hashGlyphKey(key, CAPACITY);
+		while (mGlyphCache[slot].first != EMPTY_GLYPH_KEY && mGlyphCache[slot].first != key) {
+			slot = (slot + 1) & (CAPACITY - 1);
+		}
+		if (mGlyphCache[slot].first == EMPTY_GLYPH_KEY) {
+			++mGlyphCacheCount;
+		}
+		mGlyphCache[slot] = std::make_pair(key, glyph);
+	}
+
+	void Font::notifyListeners(bool reloaded) const
+	{
+		for (const std::pair<const void*, std::function<void(bool)>>& listener : mListeners) {
+			listener.second(reloaded);
+		}
+	}
+
+	bool Font::uploadRasterized()
+	{
+		AEON_PROFILE_SCOPE("Font::uploadRasterized");
+		// Take over the batches completed so far so that the worker threads aren't blocked by their insertion
+		std::vector<GlyphBatch> batches;
+		{
+			std::lock_guard<std::mutex> lock(mRasterMutex);
+			batches.swap(mRasterized);
+		}
+
+		for (const GlyphBatch& batch : batches) {
+			upload(batch);
+		}
+		mPendingBatches -= std::min(batches.size(), mPendingBatches);
+		if (mPendingBatches != 0) {
+			return false;
+		}
+
+		// Every batch was handed over, so the parent job completes right away
+		if (mRasterJob) {
+			JobSystem& jobSystem = JobSystem::getInstance();
+			jobSystem.run(mRasterJob);
+			jobSystem.wait(mRasterJob);
+			mRasterJob = nullptr;
+		}
+		return true;
+	}
+
+	void Font::finishRasterization(bool upload)
+	{
+		if (!mRasterJob) {
+			return;
+		}
+
+		// Wait for the jobs in flight, the batches can then be accessed without locking
+		JobSystem& jobSystem = JobSystem::getInstance();
+		jobSystem.run(mRasterJob);
+		jobSystem.wait(mRasterJob);
+		mRasterJob = nullptr;
+
+		if (upload) {
+			for (const GlyphBatch& batch : mRasterized) {
+				this->upload(batch);
+			}
+		}
+		std::vector<GlyphBatch>().swap(mRasterized);
+		mPendingBatches = 0;
+		FontManager::getInstance().removeRasterizingFont(this);
 	}
 }
\ No newline at end of file
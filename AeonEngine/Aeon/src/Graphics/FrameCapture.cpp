@@ -0,0 +1,447 @@
+// MIT License
+// 
+// Copyright(c) 2019-2021 Filippos Gleglakos
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <AEON/Graphics/FrameCapture.h>
+
+#include <cstring>
+
+#include <GL/glew.h>
+
+#define STB_IMAGE_WRITE_IMPLEMENTATION
+#include <stb_image_write.h>
+
+#include <AEON/System/DebugLogger.h>
+#include <AEON/System/Profiler.h>
+#include <AEON/Graphics/GLResourceFactory.h>
+#include <AEON/Graphics/internal/Buffer.h>
+#include <AEON/Graphics/internal/GLCommon.h>
+
+namespace ae
+{
+	namespace
+	{
+		// The number of tasks the encoder thread may lag behind before the video's frames are dropped, which bounds the memory of the pool
+		constexpr size_t MAX_PENDING_TASKS = 8;
+
+		// Open a pipe to the standard input of the command provided
+		std::FILE* openPipe(const std::string& command)
+		{
+		#ifdef _WIN32
+			return _popen(command.c_str(), "wb");
+		#else
+			return popen(command.c_str(), "w");
+		#endif // _WIN32
+		}
+
+		// Close a pipe opened with openPipe(), waiting for the command to exit
+		void closePipe(std::FILE* pipe)
+		{
+		#ifdef _WIN32
+			_pclose(pipe);
+		#else
+			pclose(pipe);
+		#endif // _WIN32
+		}
+	}
+
+	// Public method(s)
+	void FrameCapture::requestScreenshot(const std::string& filepath)
+	{
+		mScreenshot = filepath;
+	}
+
+	bool FrameCapture::startVideo(const std::string& filepath, VideoEncoder encoder, int frameRate)
+	{
+		// Check that no video is being captured
+		if (mVideo) {
+			AEON_LOG_ERROR("Video capture in progress", "A video is already being captured, it must be stopped beforehand.\nAborting operation.");
+			return false;
+		}
+
+		// The previous video's last frames need to be handed over before the new video starts
+		if (mVideoEnding) {
+			retrieveReadbacks(true);
+		}
+
+		std::unique_ptr<EncoderTask> task = acquireTask(Task::VideoStart);
+		task->filepath = filepath;
+		task->encoder = encoder;
+		task->frameRate = (frameRate > 0) ? frameRate : 60;
+		submitTask(std::move(task));
+
+		mVideo = true;
+		mCapturedFrames = 0;
+		mDroppedFrames = 0;
+		return true;
+	}
+
+	void FrameCapture::stopVideo()
+	{
+		if (!mVideo) {
+			return;
+		}
+
+		// The video is completed once its frames in flight have been handed over
+		mVideo = false;
+		mVideoEnding = true;
+		retrieveReadbacks(false);
+	}
+
+	void FrameCapture::captureFrame(unsigned int framebuffer, const Vector2i& size)
+	{
+		// Hand the completed copies over to the encoder thread
+		if (mReadbackCount > 0 || mVideoEnding) {
+			retrieveReadbacks(false);
+		}
+
+		const bool SCREENSHOT = !mScreenshot.empty();
+		if ((!mVideo && !SCREENSHOT) || size.x <= 0 || size.y <= 0) {
+			return;
+		}
+
+		// Drop the video's frame rather than stalling if every readback is in flight or if the encoder thread lags behind (the screenshot is taken during the next frame)
+		bool video = mVideo;
+		if (mReadbackCount == READBACK_COUNT) {
+			mDroppedFrames += (video) ? 1 : 0;
+			return;
+		}
+		if (video) {
+			std::lock_guard<std::mutex> lock(mMutex);
+			if (mTasks.size() >= MAX_PENDING_TASKS) {
+				video = false;
+				++mDroppedFrames;
+			}
+		}
+		if (!video && !SCREENSHOT) {
+			return;
+		}
+
+		AEON_PROFILE_SCOPE("FrameCapture::captureFrame");
+
+		// (Re)Create the pixel pack buffer if the frame doesn't fit (the previous one is released by the resource factory once it's unused)
+		Readback& readback = mReadbacks[(mFirstReadback + mReadbackCount) % READBACK_COUNT];
+		const int BYTE_SIZE = size.x * size.y * 4;
+		if (!readback.buffer || readback.capacity < BYTE_SIZE) {
+			readback.buffer = GLResourceFactory::getInstance().create<Buffer>("", GL_PIXEL_PACK_BUFFER);
+			readback.buffer->setStorage(BYTE_SIZE, nullptr, GL_MAP_READ_BIT);
+			readback.capacity = BYTE_SIZE;
+		}
+
+		// Copy the color buffer into the pixel pack buffer and fence the copy (the read framebuffer binding isn't used elsewhere, every blit being named)
+		GLCall(glNamedFramebufferReadBuffer(framebuffer, (framebuffer) ? GL_COLOR_ATTACHMENT0 : GL_BACK));
+		GLCall(glBindFramebuffer(GL_READ_FRAMEBUFFER, framebuffer));
+		readback.buffer->bind();
+		GLCall(glReadPixels(0, 0, size.x, size.y, GL_RGBA, GL_UNSIGNED_BYTE, nullptr));
+		readback.buffer->unbind();
+		readback.fence = GLCall(glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0));
+
+		readback.size = size;
+		readback.screenshot = std::move(mScreenshot);
+		readback.video = video;
+		mScreenshot.clear();
+		++mReadbackCount;
+	}
+
+	void FrameCapture::destroy()
+	{
+		// Hand every frame in flight over and complete the video
+		retrieveReadbacks(true);
+		if (mVideo) {
+			mVideo = false;
+			submitTask(acquireTask(Task::VideoEnd));
+		}
+		stopEncoderThread();
+
+		for (Readback& readback : mReadbacks) {
+			readback.buffer.reset();
+			readback.capacity = 0;
+		}
+		mFirstReadback = 0;
+		mReadbackCount = 0;
+		mScreenshot.clear();
+	}
+
+	bool FrameCapture::isCapturingVideo() const noexcept
+	{
+		return mVideo;
+	}
+
+	uint64_t FrameCapture::getCapturedFrameCount() const noexcept
+	{
+		return mCapturedFrames;
+	}
+
+	uint64_t FrameCapture::getDroppedFrameCount() const noexcept
+	{
+		return mDroppedFrames;
+	}
+
+	// Public static method(s)
+	FrameCapture& FrameCapture::getInstance()
+	{
+		static FrameCapture instance;
+		return instance;
+	}
+
+	// Private constructor(s)
+	FrameCapture::FrameCapture()
+		: mReadbacks()
+		, mFirstReadback(0)
+		, mReadbackCount(0)
+		, mScreenshot()
+		, mVideo(false)
+		, mVideoEnding(false)
+		, mCapturedFrames(0)
+		, mDroppedFrames(0)
+		, mEncoderThread()
+		, mTasks()
+		, mFreeTasks()
+		, mMutex()
+		, mCondition()
+		, mEncoderExit(false)
+		, mVideoOutput(nullptr)
+		, mVideoPath()
+		, mVideoEncoder(VideoEncoder::Raw)
+		, mVideoFrameRate(60)
+		, mVideoSize()
+	{
+		for (Readback& readback : mReadbacks) {
+			readback.fence = nullptr;
+			readback.capacity = 0;
+			readback.video = false;
+		}
+	}
+
+	FrameCapture::~FrameCapture()
+	{
+		// The context no longer exists, only the tasks already handed over are completed
+		stopEncoderThread();
+		if (mVideoOutput) {
+			closeVideo();
+		}
+	}
+
+	// Private method(s)
+	void FrameCapture::retrieveReadbacks(bool wait)
+	{
+		while (mReadbackCount > 0) {
+			// Poll the oldest copy's fence (the buffer swap has flushed it), or wait for up to a second at a time
+			Readback& readback = mReadbacks[mFirstReadback];
+			GLsync sync = static_cast<GLsync>(readback.fence);
+			const GLuint64 TIMEOUT = (wait) ? 1000000000 : 0;
+			GLenum result;
+			do {
+				result = GLCall(glClientWaitSync(sync, (wait) ? GL_SYNC_FLUSH_COMMANDS_BIT : 0, TIMEOUT));
+			} while (wait && result == GL_TIMEOUT_EXPIRED);
+
+			if (result == GL_TIMEOUT_EXPIRED) {
+				break;
+			}
+			GLCall(glDeleteSync(sync));
+			readback.fence = nullptr;
+			mFirstReadback = (mFirstReadback + 1) % READBACK_COUNT;
+			--mReadbackCount;
+			if (result == GL_WAIT_FAILED) {
+				AEON_LOG_ERROR("Failed frame capture", "The readback's fence couldn't be waited upon.\nThe frame is dropped.");
+				continue;
+			}
+
+			// Copy the pixels out of the pixel pack buffer into a recycled task
+			const int BYTE_SIZE = readback.size.x * readback.size.y * 4;
+			const void* const DATA = readback.buffer->mapRange(0, BYTE_SIZE, GL_MAP_READ_BIT);
+			if (!DATA) {
+				continue;
+			}
+
+			std::unique_ptr<EncoderTask> task = acquireTask(Task::Frame);
+			task->pixels.resize(static_cast<size_t>(BYTE_SIZE));
+			std::memcpy(task->pixels.data(), DATA, task->pixels.size());
+			readback.buffer->unmap();
+
+			task->size = readback.size;
+			task->filepath = std::move(readback.screenshot);
+			task->video = readback.video;
+			readback.screenshot.clear();
+			mCapturedFrames += (task->video) ? 1 : 0;
+			submitTask(std::move(task));
+		}
+
+		// Complete the stopped video once none of its frames remain in flight
+		if (mVideoEnding) {
+			for (size_t i = 0; i < mReadbackCount; ++i) {
+				if (mReadbacks[(mFirstReadback + i) % READBACK_COUNT].video) {
+					return;
+				}
+			}
+
+			mVideoEnding = false;
+			submitTask(acquireTask(Task::VideoEnd));
+		}
+	}
+
+	std::unique_ptr<FrameCapture::EncoderTask> FrameCapture::acquireTask(Task task)
+	{
+		std::unique_ptr<EncoderTask> encoderTask;
+		{
+			std::lock_guard<std::mutex> lock(mMutex);
+			if (!mFreeTasks.empty()) {
+				encoderTask = std::move(mFreeTasks.back());
+				mFreeTasks.pop_back();
+			}
+		}
+
+		if (!encoderTask) {
+			encoderTask = std::make_unique<EncoderTask>();
+		}
+		encoderTask->task = task;
+		encoderTask->video = false;
+		return encoderTask;
+	}
+
+	void FrameCapture::submitTask(std::unique_ptr<EncoderTask> task)
+	{
+		if (!mEncoderThread.joinable()) {
+			mEncoderThread = std::thread(&FrameCapture::encodeTasks, this);
+		}
+
+		{
+			std::lock_guard<std::mutex> lock(mMutex);
+			mTasks.push_back(std::move(task));
+		}
+		mCondition.notify_one();
+	}
+
+	void FrameCapture::stopEncoderThread()
+	{
+		if (!mEncoderThread.joinable()) {
+			return;
+		}
+
+		{
+			std::lock_guard<std::mutex> lock(mMutex);
+			mEncoderExit = true;
+		}
+		mCondition.notify_one();
+		mEncoderThread.join();
+		mEncoderExit = false;
+	}
+
+	void FrameCapture::encodeTasks()
+	{
+		Profiler::getInstance().setThreadName("Capture thread");
+
+		// The pixels read back start with the bottom row
+		stbi_flip_vertically_on_write(1);
+
+		// Encode the tasks until the thread is requested to stop, the remaining tasks being completed beforehand
+		std::unique_lock<std::mutex> lock(mMutex);
+		while (true) {
+			mCondition.wait(lock, [this]() { return mEncoderExit || !mTasks.empty(); });
+			if (mTasks.empty()) {
+				break;
+			}
+
+			std::unique_ptr<EncoderTask> task = std::move(mTasks.front());
+			mTasks.pop_front();
+			lock.unlock();
+			encode(*task);
+			lock.lock();
+
+			// Recycle the task along with its pixel storage
+			task->filepath.clear();
+			mFreeTasks.push_back(std::move(task));
+		}
+	}
+
+	void FrameCapture::encode(EncoderTask& task)
+	{
+		AEON_PROFILE_SCOPE("FrameCapture::encode");
+
+		switch (task.task)
+		{
+		case Task::VideoStart:
+			// The video's output is opened with its first frame, once its size is known
+			if (mVideoOutput) {
+				closeVideo();
+			}
+			mVideoPath = task.filepath;
+			mVideoEncoder = task.encoder;
+			mVideoFrameRate = task.frameRate;
+			mVideoSize = Vector2i();
+			break;
+		case Task::VideoEnd:
+			if (mVideoOutput) {
+				closeVideo();
+			}
+			mVideoPath.clear();
+			break;
+		case Task::Frame:
+		{
+			const int STRIDE = task.size.x * 4;
+			if (!task.filepath.empty() && !stbi_write_png(task.filepath.c_str(), task.size.x, task.size.y, 4, task.pixels.data(), STRIDE)) {
+				AEON_LOG_ERROR("Invalid filepath", "Unable to write the screenshot at \"" + task.filepath + "\".\nAborting operation.");
+			}
+			if (!task.video || mVideoPath.empty()) {
+				break;
+			}
+
+			// Open the video's output with the size of its first frame
+			if (!mVideoOutput) {
+				mVideoSize = task.size;
+				if (mVideoEncoder == VideoEncoder::FFmpeg) {
+					mVideoOutput = openPipe("ffmpeg -y -loglevel error -f rawvideo -pix_fmt rgba -s " + std::to_string(mVideoSize.x) + "x" + std::to_string(mVideoSize.y) +
+					                        " -r " + std::to_string(mVideoFrameRate) + " -i - -c:v libx264 -pix_fmt yuv420p \"" + mVideoPath + "\"");
+				}
+				else {
+					mVideoOutput = std::fopen(mVideoPath.c_str(), "wb");
+				}
+
+				if (!mVideoOutput) {
+					AEON_LOG_ERROR("Video capture failed", "Unable to open the video's output at \"" + mVideoPath + "\".\nThe video's frames are discarded.");
+					mVideoPath.clear();
+					break;
+				}
+			}
+
+			// Write the rows from the top one, skipping the frames whose size differs from the video's
+			if (task.size == mVideoSize) {
+				for (int y = task.size.y - 1; y >= 0; --y) {
+					std::fwrite(task.pixels.data() + static_cast<size_t>(y) * STRIDE, 1, static_cast<size_t>(STRIDE), mVideoOutput);
+				}
+			}
+			break;
+		}
+		}
+	}
+
+	void FrameCapture::closeVideo()
+	{
+		// Closing the pipe waits for ffmpeg to finish encoding the video
+		if (mVideoEncoder == VideoEncoder::FFmpeg) {
+			closePipe(mVideoOutput);
+		}
+		else {
+			std::fclose(mVideoOutput);
+		}
+		mVideoOutput = nullptr;
+	}
+}
\ No newline at end of file
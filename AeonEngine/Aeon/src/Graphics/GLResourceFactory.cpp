@@ -23,36 +23,136 @@
 #include <AEON/Graphics/GLResourceFactory.h>
 
 #include <string>
+#include <algorithm>
 
 #include <GL/glew.h>
 
 #include <AEON/System/DebugLogger.h>
+#include <AEON/Graphics/internal/GLCommon.h>
+#include <AEON/Graphics/internal/FontManager.h>
 
 namespace ae
 {
+	namespace
+	{
+		// The minimum number of frames during which the queued resources are kept alive
+		constexpr uint64_t DELETION_DELAY = 2;
+
+		// The number of frames after which a pooled render target that isn't borrowed is destroyed
+		constexpr uint64_t RENDER_TARGET_LIFETIME = 180;
+
+		// The number of quads contained in the static quad list index buffer (the vertices of a ring region)
+		constexpr size_t QUAD_LIST_CAPACITY = 16384;
+
+		// Fills the list provided with the indices of the quads [first, last)
+		void appendQuadIndices(std::vector<unsigned int>& indices, size_t first, size_t last)
+		{
+			indices.reserve(last * 6);
+			for (size_t i = first; i < last; ++i) {
+				const unsigned int BASE = static_cast<unsigned int>(i * 4);
+				indices.emplace_back(BASE + 0);
+				indices.emplace_back(BASE + 1);
+				indices.emplace_back(BASE + 2);
+
+				indices.emplace_back(BASE + 0);
+				indices.emplace_back(BASE + 2);
+				indices.emplace_back(BASE + 3);
+			}
+		}
+	}
+
 	// Public method(s)
 	void GLResourceFactory::destroyUnused()
 	{
-		// Destroy all unused resources in the hashmaps
+		// Move all unused resources out of the hashmaps (only the factory holds a reference to them)
+		PendingDeletion pendingDeletion{ {}, nullptr, mFrame };
 		for (auto& resourceMap : mResourceMaps) {
-			for (auto itr = resourceMap.second.begin(); itr != resourceMap.second.end(); ++itr) {
+			for (auto itr = resourceMap.second.begin(); itr != resourceMap.second.end();) {
 				if (itr->second.use_count() == 1) {
-					itr->second->destroy();
-					resourceMap.second.erase(itr);
-					itr = resourceMap.second.begin();
+					pendingDeletion.resources.push_back(std::move(itr->second));
+					itr = resourceMap.second.erase(itr);
+				}
+				else {
+					++itr;
 				}
 			}
 		}
+
+		// Fence the commands submitted so far as they may still be reading from the unused resources
+		if (!pendingDeletion.resources.empty()) {
+			pendingDeletion.fence = GLCall(glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0));
+			mDeletionQueue.push_back(std::move(pendingDeletion));
+		}
 	}
 
-	void GLResourceFactory::destroy() const
+	void GLResourceFactory::update()
 	{
+		++mFrame;
+
+		// Destroy the queued resources once they're old enough and the GPU has completed the commands that used them
+		while (!mDeletionQueue.empty())
+		{
+			PendingDeletion& pendingDeletion = mDeletionQueue.front();
+			if (pendingDeletion.frame + DELETION_DELAY > mFrame) {
+				break;
+			}
+
+			GLsync sync = static_cast<GLsync>(pendingDeletion.fence);
+			const GLenum RESULT = GLCall(glClientWaitSync(sync, 0, 0));
+			if (RESULT == GL_TIMEOUT_EXPIRED) {
+				break;
+			}
+
+			for (const auto& resource : pendingDeletion.resources) {
+				resource->destroy();
+			}
+			GLCall(glDeleteSync(sync));
+			mDeletionQueue.pop_front();
+		}
+
+		trimRenderTargetPool();
+
+		if _CONSTEXPR_IF (AEON_HOT_RELOAD) {
+			reloadModifiedAssets();
+		}
+	}
+
+	void GLResourceFactory::destroy()
+	{
+		// Destroy the queued resources without waiting for the GPU
+		for (const PendingDeletion& pendingDeletion : mDeletionQueue) {
+			for (const auto& resource : pendingDeletion.resources) {
+				resource->destroy();
+			}
+			GLCall(glDeleteSync(static_cast<GLsync>(pendingDeletion.fence)));
+		}
+		mDeletionQueue.clear();
+
 		// Destroy all resources in the hashmaps
 		for (const auto& resourceMap : mResourceMaps) {
 			for (const auto& resource : resourceMap.second) {
 				resource.second->destroy();
 			}
 		}
+
+		// Destroy the pooled render targets, even the borrowed ones
+		for (const auto& bucket : mRenderTargets) {
+			for (const PooledRenderTarget& renderTarget : bucket.second) {
+				const RenderTargetAttachments& attachments = renderTarget.attachments;
+				attachments.framebuffer->destroy();
+				attachments.color->destroy();
+				if (attachments.depth) attachments.depth->destroy();
+				if (attachments.stencil) attachments.stencil->destroy();
+				if (attachments.multisampled) attachments.multisampled->destroy();
+			}
+		}
+		mRenderTargets.clear();
+
+		// Destroy the samplers
+		for (const auto& sampler : mSamplers) {
+			sampler.second->destroy();
+		}
+		mSamplers.clear();
 	}
 
 	void GLResourceFactory::reload()
@@ -60,79 +160,584 @@ namespace ae
 		// Destroy and reload all shaders
 		ResourceMap& shaderMap = mResourceMaps[ResourceType::Shader];
 		for (const auto& shaderResource : shaderMap) {
-			auto shaderPtr = std::dynamic_pointer_cast<Shader>(shaderResource.second);
+			auto shaderPtr = std::static_pointer_cast<Shader>(shaderResource.second);
 			shaderPtr->destroy();
 			shaderPtr->reload();
 		}
 	}
 
+	bool GLResourceFactory::watchDirectory(const std::string& directory)
+	{
+		if _CONSTEXPR_IF (!AEON_HOT_RELOAD) {
+			AEON_LOG_WARNING("Hot reload disabled", "AEON_HOT_RELOAD must be enabled to reload the modified assets.\nAborting operation.");
+			return false;
+		}
+
+		return mFileWatcher.watch(directory);
+	}
+
+	std::shared_ptr<const std::vector<unsigned int>> GLResourceFactory::getQuadIndices(size_t quadCount)
+	{
+		std::lock_guard<std::mutex> lock(mQuadIndexMutex);
+		std::shared_ptr<const std::vector<unsigned int>>& indices = mQuadIndices[quadCount];
+		if (!indices) {
+			auto generated = std::make_shared<std::vector<unsigned int>>();
+			appendQuadIndices(*generated, 0, quadCount);
+			indices = std::move(generated);
+		}
+
+		return indices;
+	}
+
+	const Sampler& GLResourceFactory::getSampler(Texture::Filter filter, Texture::Wrap wrap)
+	{
+		std::unique_ptr<Sampler>& sampler = mSamplers[std::make_pair(filter, wrap)];
+		if (!sampler) {
+			sampler = std::make_unique<Sampler>(filter, wrap);
+		}
+
+		return *sampler;
+	}
+
+	void GLResourceFactory::registerShaderVariants(const std::string& name, const std::map<Shader::StageType, std::string>& sources, const VertexBuffer::Layout& layout,
+	                                               const VertexBuffer::Layout& instancedLayout)
+	{
+		// The variants already compiled are kept under their names
+		ShaderVariants& variants = mShaderVariants[name];
+		variants.sources = sources;
+		variants.layout = layout;
+		variants.instancedLayout = instancedLayout;
+	}
+
+	std::shared_ptr<Shader> GLResourceFactory::getShaderVariant(const std::string& name, uint32_t features, const std::string& variantName)
+	{
+		// Check that the uber shader has been registered
+		const auto VARIANTS_ITR = mShaderVariants.find(name);
+		if (VARIANTS_ITR == mShaderVariants.end()) {
+			AEON_LOG_ERROR("Unknown uber shader", "The uber shader \"" + name + "\" hasn't been registered.\nReturning nullptr.");
+			return nullptr;
+		}
+
+		// Retrieve the variant if it's already been compiled (it may have since been destroyed as unused)
+		ShaderVariants& variants = VARIANTS_ITR->second;
+		auto nameItr = variants.names.find(features);
+		if (nameItr == variants.names.end()) {
+			nameItr = variants.names.emplace(features, !variantName.empty() ? variantName : name + '#' + std::to_string(features)).first;
+		}
+		if (std::shared_ptr<Shader> variant = get<Shader>(nameItr->second)) {
+			return variant;
+		}
+
+		// Compile the variant with the features' defines
+		const std::vector<std::string> DEFINES = Shader::getFeatureDefines(features);
+		std::shared_ptr<Shader> variant = create<Shader>(nameItr->second);
+		for (const auto& source : variants.sources) {
+			variant->loadFromSource(source.first, source.second, DEFINES);
+		}
+		variant->link(true);
+		variant->getDataLayout() = (features & Shader::Instanced) ? variants.instancedLayout : variants.layout;
+
+		// Attach the transform UBO (it's only created after the first pre-compiled shaders)
+		if (std::shared_ptr<UniformBuffer> transformUBO = get<UniformBuffer>("_AEON_TransformUBO")) {
+			variant->addUniformBuffer(*transformUBO);
+		}
+
+		return variant;
+	}
+
+	GLResourceFactory::RenderTargetAttachments GLResourceFactory::acquireRenderTarget(const Vector2i& size, Texture2D::InternalFormat colorFormat,
+	                                                                                  Texture2D::InternalFormat depthFormat, Texture2D::InternalFormat stencilFormat, int sampleCount)
+	{
+		// Borrow a render target of the bucket that isn't borrowed
+		std::vector<PooledRenderTarget>& bucket = mRenderTargets[RenderTargetKey(size.x, size.y, colorFormat, depthFormat, stencilFormat, std::max(sampleCount, 1))];
+		for (PooledRenderTarget& renderTarget : bucket) {
+			if (!isBorrowed(renderTarget)) {
+				renderTarget.freeSince = 0;
+				return renderTarget.attachments;
+			}
+		}
+
+		// Create the framebuffer and its textures otherwise
+		const bool MULTISAMPLED = sampleCount > 1;
+		RenderTargetAttachments attachments{ std::make_shared<Framebuffer>(), nullptr, nullptr, nullptr, nullptr };
+		auto createTexture = [&size](Texture2D::InternalFormat format) {
+			auto texture = std::make_shared<Texture2D>(Texture2D::Filter::Nearest, Texture2D::Wrap::None, format);
+			return (texture->create(size.x, size.y)) ? texture : nullptr;
+		};
+
+		attachments.color = createTexture(colorFormat);
+		bool created = attachments.color != nullptr;
+		if (created && !MULTISAMPLED && depthFormat != Texture2D::InternalFormat::Native) {
+			attachments.depth = createTexture(depthFormat);
+			created = attachments.depth != nullptr;
+		}
+		if (created && !MULTISAMPLED && stencilFormat != Texture2D::InternalFormat::Native) {
+			attachments.stencil = createTexture(stencilFormat);
+			created = attachments.stencil != nullptr;
+		}
+		if (!created) {
+			attachments.framebuffer->destroy();
+			if (attachments.color) attachments.color->destroy();
+			if (attachments.depth) attachments.depth->destroy();
+			return RenderTargetAttachments{ nullptr, nullptr, nullptr, nullptr, nullptr };
+		}
+
+		// Attach the textures created to the framebuffer
+		attachments.framebuffer->attachTexture(attachments.color.get());
+		if (attachments.depth) attachments.framebuffer->attachTexture(attachments.depth.get());
+		if (attachments.stencil) attachments.framebuffer->attachTexture(attachments.stencil.get());
+
+		// Create the multisampled framebuffer that will be resolved into the color buffer texture (its depth and stencil buffers are multisampled as well)
+		if (MULTISAMPLED) {
+			attachments.multisampled = std::make_shared<Framebuffer>();
+			attachments.multisampled->attachMultisampledStorage(size, sampleCount, colorFormat);
+			if (depthFormat != Texture2D::InternalFormat::Native) attachments.multisampled->attachMultisampledStorage(size, sampleCount, depthFormat);
+			if (stencilFormat != Texture2D::InternalFormat::Native) attachments.multisampled->attachMultisampledStorage(size, sampleCount, stencilFormat);
+		}
+
+		bucket.push_back(PooledRenderTarget{ attachments, 0 });
+		return attachments;
+	}
+
+	GLResourceFactory::MemoryUsage GLResourceFactory::getMemoryUsage(ResourceType type) const
+	{
+		MemoryUsage usage{ 0, 0 };
+		const auto MAP_ITR = mResourceMaps.find(type);
+		if (MAP_ITR != mResourceMaps.end()) {
+			for (const auto& resource : MAP_ITR->second) {
+				usage.bytes += resource.second->getMemorySize();
+				++usage.count;
+			}
+		}
+
+		accumulatePoolMemory(type, usage);
+		return usage;
+	}
+
+	GLResourceFactory::MemoryUsage GLResourceFactory::getMemoryUsage() const
+	{
+		// Add up the stored resources of every type
+		MemoryUsage usage{ 0, 0 };
+		for (const auto& resourceMap : mResourceMaps) {
+			for (const auto& resource : resourceMap.second) {
+				usage.bytes += resource.second->getMemorySize();
+				++usage.count;
+			}
+		}
+
+		// Add the pooled render targets and the resources whose storage hasn't yet been released
+		accumulatePoolMemory(ResourceType::Texture, usage);
+		accumulatePoolMemory(ResourceType::Framebuffer, usage);
+		for (const PendingDeletion& pendingDeletion : mDeletionQueue) {
+			for (const auto& resource : pendingDeletion.resources) {
+				usage.bytes += resource->getMemorySize();
+				++usage.count;
+			}
+		}
+
+		return usage;
+	}
+
+	std::vector<std::pair<std::string, size_t>> GLResourceFactory::getMemoryUsageByName(ResourceType type) const
+	{
+		std::vector<std::pair<std::string, size_t>> usages;
+		const auto MAP_ITR = mResourceMaps.find(type);
+		if (MAP_ITR != mResourceMaps.end()) {
+			usages.reserve(MAP_ITR->second.size() + 1);
+			for (const auto& resource : MAP_ITR->second) {
+				usages.emplace_back(resource.first, resource.second->getMemorySize());
+			}
+		}
+
+		// Aggregate the pooled render targets under a single entry
+		MemoryUsage poolUsage{ 0, 0 };
+		accumulatePoolMemory(type, poolUsage);
+		if (poolUsage.count != 0) {
+			usages.emplace_back("_AEON_RenderTargetPool", poolUsage.bytes);
+		}
+
+		std::sort(usages.begin(), usages.end(), [](const std::pair<std::string, size_t>& a, const std::pair<std::string, size_t>& b) {
+			return a.second > b.second;
+		});
+		return usages;
+	}
+
 	// Public static method(s)
 	GLResourceFactory& GLResourceFactory::getInstance() noexcept
 	{
 		static GLResourceFactory instance;
 		return instance;
 	}
+
+	GLResourceFactory::VideoMemoryInfo GLResourceFactory::queryVideoMemory()
+	{
+		// Both extensions report kibibytes
+		VideoMemoryInfo info{ 0, 0, false };
+		if (GLEW_NVX_gpu_memory_info) {
+			GLint dedicated = 0, available = 0;
+			GLCall(glGetIntegerv(GL_GPU_MEMORY_INFO_DEDICATED_VIDMEM_NVX, &dedicated));
+			GLCall(glGetIntegerv(GL_GPU_MEMORY_INFO_CURRENT_AVAILABLE_VIDMEM_NVX, &available));
+			info.total = static_cast<size_t>(dedicated) * 1024;
+			info.available = static_cast<size_t>(available) * 1024;
+			info.supported = true;
+		}
+		else if (GLEW_ATI_meminfo) {
+			// The first value is the total memory available in the texture pool
+			GLint freeMemory[4] = { 0, 0, 0, 0 };
+			GLCall(glGetIntegerv(GL_TEXTURE_FREE_MEMORY_ATI, freeMemory));
+			info.available = static_cast<size_t>(freeMemory[0]) * 1024;
+			info.supported = true;
+		}
+
+		return info;
+	}
 	
 	// Private constructor(s)
 	GLResourceFactory::GLResourceFactory()
 		: mResourceMaps()
+		, mDeletionQueue()
+		, mQuadIndices()
+		, mQuadIndexMutex()
+		, mFrame(0)
+		, mFileWatcher()
+		, mRenderTargets()
+		, mSamplers()
 	{
 		createPrecompiledShaders();
 	}
 
 	// Private method(s)
+	void GLResourceFactory::reloadModifiedAssets()
+	{
+		if (!mFileWatcher.isWatching()) {
+			return;
+		}
+
+		for (const std::string& filepath : mFileWatcher.poll())
+		{
+			// Reload the shaders with a stage read from the file and the 2D textures loaded from it
+			size_t reloadCount = 0;
+			for (const auto& shaderResource : mResourceMaps[ResourceType::Shader]) {
+				if (std::static_pointer_cast<Shader>(shaderResource.second)->reloadFromFile(filepath)) {
+					++reloadCount;
+				}
+			}
+			for (const auto& textureResource : mResourceMaps[ResourceType::Texture]) {
+				std::shared_ptr<Texture2D> texture = std::dynamic_pointer_cast<Texture2D>(textureResource.second);
+				if (texture && !texture->getFilepath().empty() && FileWatcher::normalizePath(texture->getFilepath()) == filepath && texture->reloadFromFile()) {
+					++reloadCount;
+				}
+			}
+			reloadCount += FontManager::getInstance().reloadFonts(filepath);
+
+			if (reloadCount > 0) {
+				AEON_LOG_INFO("Asset reloaded", "The file \"" + filepath + "\" was modified, " + std::to_string(reloadCount) + " resource(s) reloaded.");
+			}
+		}
+	}
+
+	void GLResourceFactory::trimRenderTargetPool()
+	{
+		// Stamp the render targets returned to the pool and move out the ones that weren't borrowed for long enough
+		PendingDeletion pendingDeletion{ {}, nullptr, mFrame };
+		for (auto bucketItr = mRenderTargets.begin(); bucketItr != mRenderTargets.end();) {
+			std::vector<PooledRenderTarget>& bucket = bucketItr->second;
+			for (auto renderTargetItr = bucket.begin(); renderTargetItr != bucket.end();) {
+				PooledRenderTarget& renderTarget = *renderTargetItr;
+				if (isBorrowed(renderTarget)) {
+					renderTarget.freeSince = 0;
+				}
+				else if (renderTarget.freeSince == 0) {
+					renderTarget.freeSince = mFrame;
+				}
+				else if (mFrame - renderTarget.freeSince >= RENDER_TARGET_LIFETIME) {
+					RenderTargetAttachments& attachments = renderTarget.attachments;
+					pendingDeletion.resources.push_back(std::move(attachments.framebuffer));
+					pendingDeletion.resources.push_back(std::move(attachments.color));
+					if (attachments.depth) pendingDeletion.resources.push_back(std::move(attachments.depth));
+					if (attachments.stencil) pendingDeletion.resources.push_back(std::move(attachments.stencil));
+					if (attachments.multisampled) pendingDeletion.resources.push_back(std::move(attachments.multisampled));
+					renderTargetItr = bucket.erase(renderTargetItr);
+					continue;
+				}
+				++renderTargetItr;
+			}
+
+			bucketItr = (bucket.empty()) ? mRenderTargets.erase(bucketItr) : std::next(bucketItr);
+		}
+
+		// Fence the commands submitted so far as they may still be sampling the render targets
+		if (!pendingDeletion.resources.empty()) {
+			pendingDeletion.fence = GLCall(glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0));
+			mDeletionQueue.push_back(std::move(pendingDeletion));
+		}
+	}
+
+	void GLResourceFactory::accumulatePoolMemory(ResourceType type, MemoryUsage& usage) const
+	{
+		const auto accumulate = [&usage](const GLResource* const resource) {
+			if (resource) {
+				usage.bytes += resource->getMemorySize();
+				++usage.count;
+			}
+		};
+
+		for (const auto& bucket : mRenderTargets) {
+			for (const PooledRenderTarget& renderTarget : bucket.second) {
+				const RenderTargetAttachments& attachments = renderTarget.attachments;
+				if (type == ResourceType::Texture) {
+					accumulate(attachments.color.get());
+					accumulate(attachments.depth.get());
+					accumulate(attachments.stencil.get());
+				}
+				else if (type == ResourceType::Framebuffer) {
+					accumulate(attachments.framebuffer.get());
+					accumulate(attachments.multisampled.get());
+				}
+			}
+		}
+	}
+
 	void GLResourceFactory::createPrecompiledShaders()
 	{
 		// Shaders
 			// Retrieve the shader sources
-				// Basic2D Shader
-		std::string basic2DShaderVertSource =
-		#include <AEON/Shaders/Basic2D.vs>
+				// Sprite2D uber shader (specialised by the shader features)
+		std::string sprite2DShaderVertSource =
+		#include <AEON/Shaders/Sprite2D.vs>
 		;
-		std::string basic2DShaderFragSource =
-		#include <AEON/Shaders/Basic2D.fs>
+		std::string sprite2DShaderFragSource =
+		#include <AEON/Shaders/Sprite2D.fs>
 		;
 
-				// Text2D Shader
-		std::string text2DShaderVertSource =
-		#include <AEON/Shaders/Text2D.vs>
+				// Caret2D Shader (the text carets blink on the GPU)
+		std::string caret2DShaderFragSource =
+		#include <AEON/Shaders/Caret2D.fs>
 		;
-		std::string text2DShaderFragSource =
-		#include <AEON/Shaders/Text2D.fs>
+
+				// Batch shaders (the transforms are applied on the GPU)
+		std::string batchTransform2DShaderVertSource =
+		#include <AEON/Shaders/BatchTransform2D.vs>
 		;
 
-			// Create the shaders
-				// Basic2D Shader
-		std::shared_ptr<Shader> basic2DShader = create<Shader>("_AEON_Basic2D");
-		basic2DShader->loadFromSource(Shader::StageType::Vertex, basic2DShaderVertSource);
-		basic2DShader->loadFromSource(Shader::StageType::Fragment, basic2DShaderFragSource);
-		basic2DShader->link();
-
-				// Text2D Shader
-		std::shared_ptr<Shader> text2DShader = create<Shader>("_AEON_Text2D");
-		text2DShader->loadFromSource(Shader::StageType::Vertex, text2DShaderVertSource);
-		text2DShader->loadFromSource(Shader::StageType::Fragment, text2DShaderFragSource);
-		text2DShader->link();
-
-			// Set the shaders' data layouts
+				// MultiTexture2D Shader (the batches are merged across textures)
+		std::string multiTexture2DShaderVertSource =
+		#include <AEON/Shaders/MultiTexture2D.vs>
+		;
+		std::string multiTexture2DShaderFragSource =
+		#include <AEON/Shaders/MultiTexture2D.fs>
+		;
+
+				// Instanced shaders (the instances are culled on the GPU)
+		std::string instanceCull2DShaderCompSource =
+		#include <AEON/Shaders/InstanceCull2D.cs>
+		;
+
+				// Particle shaders (the particles are simulated and rendered straight from their shader storage buffer)
+		std::string particleUpdate2DShaderCompSource =
+		#include <AEON/Shaders/ParticleUpdate2D.cs>
+		;
+		std::string particleQuad2DShaderVertSource =
+		#include <AEON/Shaders/ParticleQuad2D.vs>
+		;
+
+				// Tile map shader (the chunks' static tiles are laid out in the map's local space)
+		std::string tileMap2DShaderVertSource =
+		#include <AEON/Shaders/TileMap2D.vs>
+		;
+
+				// Light shaders (the lights are accumulated at a reduced resolution and composited over the scene)
+		std::string light2DShaderVertSource =
+		#include <AEON/Shaders/Light2D.vs>
+		;
+		std::string light2DShaderFragSource =
+		#include <AEON/Shaders/Light2D.fs>
+		;
+		std::string fullscreen2DShaderVertSource =
+		#include <AEON/Shaders/PostProcess2D.vs>
+		;
+		std::string lightComposite2DShaderFragSource =
+		#include <AEON/Shaders/LightComposite2D.fs>
+		;
+
+				// Mesh shaders (the meshes are instanced with per-instance model matrices and shaded with the materials' parameters)
+		std::string mesh3DShaderVertSource =
+		#include <AEON/Shaders/Mesh3D.vs>
+		;
+		std::string mesh3DShaderFragSource =
+		#include <AEON/Shaders/Mesh3D.fs>
+		;
+
+			// Register the uber shaders
+				// Sprite2D uber shader
+		VertexBuffer::Layout sprite2DShaderLayout;
+		sprite2DShaderLayout.addElement(GL_FLOAT, 3, GL_FALSE);
+		sprite2DShaderLayout.addElement(GL_FLOAT, 4, GL_FALSE);
+		sprite2DShaderLayout.addElement(GL_FLOAT, 2, GL_FALSE);
+
+		VertexBuffer::Layout instancedSprite2DShaderLayout;
+		instancedSprite2DShaderLayout.addElement(GL_FLOAT, 2, GL_FALSE);
+		instancedSprite2DShaderLayout.addElement(GL_FLOAT, 2, GL_FALSE);
+		instancedSprite2DShaderLayout.addElement(GL_FLOAT, 2, GL_FALSE);
+		instancedSprite2DShaderLayout.addElement(GL_FLOAT, 2, GL_FALSE);
+		instancedSprite2DShaderLayout.addElement(GL_FLOAT, 4, GL_FALSE);
+		instancedSprite2DShaderLayout.addElement(GL_UNSIGNED_BYTE, 4, GL_TRUE);
+		instancedSprite2DShaderLayout.addElement(GL_FLOAT, 1, GL_FALSE);
+
+		registerShaderVariants("_AEON_Sprite2D", { { Shader::StageType::Vertex, sprite2DShaderVertSource }, { Shader::StageType::Fragment, sprite2DShaderFragSource } },
+		                       sprite2DShaderLayout, instancedSprite2DShaderLayout);
+		const std::vector<std::string> BASIC_DEFINES = Shader::getFeatureDefines(Shader::Textured | Shader::VertexColor);
+		const std::vector<std::string> TEXT_DEFINES = Shader::getFeatureDefines(Shader::Textured | Shader::VertexColor | Shader::AlphaMask);
+		const std::vector<std::string> TEXT_SDF_DEFINES = Shader::getFeatureDefines(Shader::Textured | Shader::VertexColor | Shader::SDF);
+
+			// Create the shaders (their links are deferred so that the driver can compile them in parallel)
 				// Basic2D Shader
-		VertexBuffer::Layout& basic2DShaderLayout = basic2DShader->getDataLayout();
-		basic2DShaderLayout.addElement(GL_FLOAT, 3, GL_FALSE);
-		basic2DShaderLayout.addElement(GL_FLOAT, 4, GL_FALSE);
-		basic2DShaderLayout.addElement(GL_FLOAT, 2, GL_FALSE);
+		std::shared_ptr<Shader> basic2DShader = getShaderVariant("_AEON_Sprite2D", Shader::Textured | Shader::VertexColor, "_AEON_Basic2D");
+
+				// Text2D Shader (the glyphs' coverage is stored in the red channel)
+		std::shared_ptr<Shader> text2DShader = getShaderVariant("_AEON_Sprite2D", Shader::Textured | Shader::VertexColor | Shader::AlphaMask, "_AEON_Text2D");
+
+				// TextSDF2D Shader (the glyphs are signed distance fields)
+		std::shared_ptr<Shader> textSDF2DShader = getShaderVariant("_AEON_Sprite2D", Shader::Textured | Shader::VertexColor | Shader::SDF, "_AEON_TextSDF2D");
+
+				// Caret2D Shader
+		std::shared_ptr<Shader> caret2DShader = create<Shader>("_AEON_Caret2D");
+		caret2DShader->loadFromSource(Shader::StageType::Vertex, sprite2DShaderVertSource);
+		caret2DShader->loadFromSource(Shader::StageType::Fragment, caret2DShaderFragSource);
+		caret2DShader->link(true);
+
+				// BatchBasic2D Shader
+		std::shared_ptr<Shader> batchBasic2DShader = create<Shader>("_AEON_BatchBasic2D");
+		batchBasic2DShader->loadFromSource(Shader::StageType::Vertex, batchTransform2DShaderVertSource);
+		batchBasic2DShader->loadFromSource(Shader::StageType::Fragment, sprite2DShaderFragSource, BASIC_DEFINES);
+		batchBasic2DShader->link(true);
+
+				// BatchText2D Shader
+		std::shared_ptr<Shader> batchText2DShader = create<Shader>("_AEON_BatchText2D");
+		batchText2DShader->loadFromSource(Shader::StageType::Vertex, batchTransform2DShaderVertSource);
+		batchText2DShader->loadFromSource(Shader::StageType::Fragment, sprite2DShaderFragSource, TEXT_DEFINES);
+		batchText2DShader->link(true);
+
+				// BatchTextSDF2D Shader
+		std::shared_ptr<Shader> batchTextSDF2DShader = create<Shader>("_AEON_BatchTextSDF2D");
+		batchTextSDF2DShader->loadFromSource(Shader::StageType::Vertex, batchTransform2DShaderVertSource);
+		batchTextSDF2DShader->loadFromSource(Shader::StageType::Fragment, sprite2DShaderFragSource, TEXT_SDF_DEFINES);
+		batchTextSDF2DShader->link(true);
+
+				// MultiTexture2D Shader
+		std::shared_ptr<Shader> multiTexture2DShader = create<Shader>("_AEON_MultiTexture2D");
+		multiTexture2DShader->loadFromSource(Shader::StageType::Vertex, multiTexture2DShaderVertSource);
+		multiTexture2DShader->loadFromSource(Shader::StageType::Fragment, multiTexture2DShaderFragSource);
+		multiTexture2DShader->link(true);
+
+				// InstancedBasic2D Shader
+		std::shared_ptr<Shader> instancedBasic2DShader = getShaderVariant("_AEON_Sprite2D", Shader::Textured | Shader::VertexColor | Shader::Instanced, "_AEON_InstancedBasic2D");
+
+				// InstanceCull2D Shader
+		std::shared_ptr<Shader> instanceCull2DShader = create<Shader>("_AEON_InstanceCull2D");
+		instanceCull2DShader->loadFromSource(Shader::StageType::Compute, instanceCull2DShaderCompSource);
+		instanceCull2DShader->link(true);
+
+				// ParticleUpdate2D Shader
+		std::shared_ptr<Shader> particleUpdate2DShader = create<Shader>("_AEON_ParticleUpdate2D");
+		particleUpdate2DShader->loadFromSource(Shader::StageType::Compute, particleUpdate2DShaderCompSource);
+		particleUpdate2DShader->link(true);
+
+				// Particle2D Shader
+		std::shared_ptr<Shader> particle2DShader = create<Shader>("_AEON_Particle2D");
+		particle2DShader->loadFromSource(Shader::StageType::Vertex, particleQuad2DShaderVertSource);
+		particle2DShader->loadFromSource(Shader::StageType::Fragment, sprite2DShaderFragSource, BASIC_DEFINES);
+		particle2DShader->link(true);
+
+				// TileMap2D Shader
+		std::shared_ptr<Shader> tileMap2DShader = create<Shader>("_AEON_TileMap2D");
+		tileMap2DShader->loadFromSource(Shader::StageType::Vertex, tileMap2DShaderVertSource);
+		tileMap2DShader->loadFromSource(Shader::StageType::Fragment, sprite2DShaderFragSource, BASIC_DEFINES);
+		tileMap2DShader->link(true);
+
+				// Light2D Shader
+		std::shared_ptr<Shader> light2DShader = create<Shader>("_AEON_Light2D");
+		light2DShader->loadFromSource(Shader::StageType::Vertex, light2DShaderVertSource);
+		light2DShader->loadFromSource(Shader::StageType::Fragment, light2DShaderFragSource);
+		light2DShader->link(true);
+
+				// LightComposite2D Shader
+		std::shared_ptr<Shader> lightComposite2DShader = create<Shader>("_AEON_LightComposite2D");
+		lightComposite2DShader->loadFromSource(Shader::StageType::Vertex, fullscreen2DShaderVertSource);
+		lightComposite2DShader->loadFromSource(Shader::StageType::Fragment, lightComposite2DShaderFragSource);
+		lightComposite2DShader->link(true);
+
+				// Mesh3D Shader
+		std::shared_ptr<Shader> mesh3DShader = create<Shader>("_AEON_Mesh3D");
+		mesh3DShader->loadFromSource(Shader::StageType::Vertex, mesh3DShaderVertSource);
+		mesh3DShader->loadFromSource(Shader::StageType::Fragment, mesh3DShaderFragSource);
+		mesh3DShader->link(true);
+
+			// Set the shaders' data layouts (the variants' layouts are set by getShaderVariant())
+				// Caret2D Shader
+		VertexBuffer::Layout& caret2DShaderLayout = caret2DShader->getDataLayout();
+		caret2DShaderLayout.addElement(GL_FLOAT, 3, GL_FALSE);
+		caret2DShaderLayout.addElement(GL_FLOAT, 4, GL_FALSE);
+		caret2DShaderLayout.addElement(GL_FLOAT, 2, GL_FALSE);
+
+				// BatchBasic2D Shader
+		VertexBuffer::Layout& batchBasic2DShaderLayout = batchBasic2DShader->getDataLayout();
+		batchBasic2DShaderLayout.addElement(GL_FLOAT, 3, GL_FALSE);
+		batchBasic2DShaderLayout.addElement(GL_FLOAT, 4, GL_FALSE);
+		batchBasic2DShaderLayout.addElement(GL_FLOAT, 2, GL_FALSE);
+		batchBasic2DShaderLayout.addElement(GL_FLOAT, 1, GL_FALSE);
+
+				// BatchText2D Shader
+		VertexBuffer::Layout& batchText2DShaderLayout = batchText2DShader->getDataLayout();
+		batchText2DShaderLayout.addElement(GL_FLOAT, 3, GL_FALSE);
+		batchText2DShaderLayout.addElement(GL_FLOAT, 4, GL_FALSE);
+		batchText2DShaderLayout.addElement(GL_FLOAT, 2, GL_FALSE);
+		batchText2DShaderLayout.addElement(GL_FLOAT, 1, GL_FALSE);
+
+				// BatchTextSDF2D Shader
+		VertexBuffer::Layout& batchTextSDF2DShaderLayout = batchTextSDF2DShader->getDataLayout();
+		batchTextSDF2DShaderLayout.addElement(GL_FLOAT, 3, GL_FALSE);
+		batchTextSDF2DShaderLayout.addElement(GL_FLOAT, 4, GL_FALSE);
+		batchTextSDF2DShaderLayout.addElement(GL_FLOAT, 2, GL_FALSE);
+		batchTextSDF2DShaderLayout.addElement(GL_FLOAT, 1, GL_FALSE);
+
+				// MultiTexture2D Shader
+		VertexBuffer::Layout& multiTexture2DShaderLayout = multiTexture2DShader->getDataLayout();
+		multiTexture2DShaderLayout.addElement(GL_FLOAT, 3, GL_FALSE);
+		multiTexture2DShaderLayout.addElement(GL_FLOAT, 4, GL_FALSE);
+		multiTexture2DShaderLayout.addElement(GL_FLOAT, 2, GL_FALSE);
+		multiTexture2DShaderLayout.addElement(GL_FLOAT, 1, GL_FALSE);
+
+				// Light2D Shader
+		VertexBuffer::Layout& light2DShaderLayout = light2DShader->getDataLayout();
+		light2DShaderLayout.addElement(GL_FLOAT, 2, GL_FALSE);
+		light2DShaderLayout.addElement(GL_FLOAT, 2, GL_FALSE);
+		light2DShaderLayout.addElement(GL_FLOAT, 1, GL_FALSE);
+		light2DShaderLayout.addElement(GL_FLOAT, 4, GL_FALSE);
 
-				// Text2D Shader
-		VertexBuffer::Layout& text2DShaderLayout = text2DShader->getDataLayout();
-		text2DShaderLayout.addElement(GL_FLOAT, 3, GL_FALSE);
-		text2DShaderLayout.addElement(GL_FLOAT, 4, GL_FALSE);
-		text2DShaderLayout.addElement(GL_FLOAT, 2, GL_FALSE);
+				// Mesh3D Shader
+		VertexBuffer::Layout& mesh3DShaderLayout = mesh3DShader->getDataLayout();
+		mesh3DShaderLayout.addElement(GL_FLOAT, 3, GL_FALSE);
+		mesh3DShaderLayout.addElement(GL_FLOAT, 3, GL_FALSE);
+		mesh3DShaderLayout.addElement(GL_FLOAT, 2, GL_FALSE);
 
 			// Create the UBOs and attach them to the shaders
 				// Transform UBO
 		auto transformUBO = create<UniformBuffer>("_AEON_TransformUBO");
-		transformUBO->queryLayout(*basic2DShader, "uTransformBlock", { "model", "view", "projection", "viewProjection", "mvp" });
+		transformUBO->queryLayout(*basic2DShader, "uTransformBlock", { "model", "view", "projection", "viewProjection", "mvp", "viewProjections[0]", "viewOffset", "time" });
 		basic2DShader->addUniformBuffer(*transformUBO);
 		text2DShader->addUniformBuffer(*transformUBO);
+		textSDF2DShader->addUniformBuffer(*transformUBO);
+		caret2DShader->addUniformBuffer(*transformUBO);
+		batchBasic2DShader->addUniformBuffer(*transformUBO);
+		batchText2DShader->addUniformBuffer(*transformUBO);
+		batchTextSDF2DShader->addUniformBuffer(*transformUBO);
+		multiTexture2DShader->addUniformBuffer(*transformUBO);
+		instancedBasic2DShader->addUniformBuffer(*transformUBO);
+		instanceCull2DShader->addUniformBuffer(*transformUBO);
+		particle2DShader->addUniformBuffer(*transformUBO);
+		tileMap2DShader->addUniformBuffer(*transformUBO);
+		mesh3DShader->addUniformBuffer(*transformUBO);
 
 		// VAOs
 			// Create the IBOs
@@ -149,10 +754,132 @@ namespace ae
 		vao->addVBO(std::move(vbo));
 		vao->addIBO(std::move(ibo));
 
+			// Create the empty VAO (the full-screen passes generate their vertices from their index, they retrieve it by its name as the factory stores it)
+		static_cast<void>(create<VertexArray>("_AEON_EmptyVAO"));
+
+			// Create the streaming VAO (its buffers' data stores are created by the ae::BatchRenderer2D's ring buffers)
+		auto streamVBO = std::make_unique<VertexBuffer>(GL_STREAM_DRAW);
+		streamVBO->getLayout().addElement(GL_FLOAT, 3, GL_FALSE);
+		streamVBO->getLayout().addElement(GL_FLOAT, 4, GL_FALSE);
+		streamVBO->getLayout().addElement(GL_FLOAT, 2, GL_FALSE);
+
+		auto streamDrawIDVBO = std::make_unique<VertexBuffer>(GL_STREAM_DRAW);
+		streamDrawIDVBO->getLayout().addElement(GL_FLOAT, 1, GL_FALSE);
+
+		auto streamTextureSlotVBO = std::make_unique<VertexBuffer>(GL_STREAM_DRAW);
+		streamTextureSlotVBO->getLayout().addElement(GL_FLOAT, 1, GL_FALSE);
+
+		auto streamVAO = create<VertexArray>("_AEON_StreamVAO");
+		streamVAO->addVBO(std::move(streamVBO));
+		streamVAO->addVBO(std::move(streamDrawIDVBO));
+		streamVAO->addVBO(std::move(streamTextureSlotVBO));
+		streamVAO->addIBO(std::make_unique<IndexBuffer>(GL_STREAM_DRAW));
+
+			// Create the packed streaming VAO (normalized 8-bit colors, normalized 16-bit texture coordinates and 16-bit indices)
+		auto packedStreamVBO = std::make_unique<VertexBuffer>(GL_STREAM_DRAW);
+		packedStreamVBO->getLayout().addElement(GL_FLOAT, 3, GL_FALSE);
+		packedStreamVBO->getLayout().addElement(GL_UNSIGNED_BYTE, 4, GL_TRUE);
+		packedStreamVBO->getLayout().addElement(GL_UNSIGNED_SHORT, 2, GL_TRUE);
+
+		auto packedStreamVAO = create<VertexArray>("_AEON_PackedStreamVAO");
+		packedStreamVAO->addVBO(std::move(packedStreamVBO));
+		packedStreamVAO->addIBO(std::make_unique<IndexBuffer>(GL_STREAM_DRAW));
+
+			// Create the static quad list IBO (attached to the streaming VAO in place of its ring when a batch is only made up of quads)
+		std::vector<unsigned int> quadListIndices;
+		appendQuadIndices(quadListIndices, 0, QUAD_LIST_CAPACITY);
+		auto quadListIBO = create<IndexBuffer>("_AEON_QuadListIBO", GL_STATIC_DRAW);
+		quadListIBO->setData(static_cast<unsigned int>(sizeof(unsigned int) * quadListIndices.size()), quadListIndices.data());
+
+			// Create the instancing VAO (the unit quad is static and the instances' data store is created by the ae::InstancedRenderer2D's ring buffer)
+		const float QUAD_CORNERS[] = {
+			0.f, 0.f,
+			0.f, 1.f,
+			1.f, 1.f,
+			1.f, 0.f
+		};
+		auto quadVBO = std::make_unique<VertexBuffer>(GL_STATIC_DRAW);
+		quadVBO->getLayout().addElement(GL_FLOAT, 2, GL_FALSE);
+		quadVBO->setData(sizeof(QUAD_CORNERS), QUAD_CORNERS);
+
+		const unsigned int QUAD_INDICES[] = {
+			0, 1, 2,
+			0, 2, 3
+		};
+		auto quadIBO = std::make_unique<IndexBuffer>(GL_STATIC_DRAW);
+		quadIBO->setData(sizeof(QUAD_INDICES), QUAD_INDICES);
+
+		auto instanceVBO = std::make_unique<VertexBuffer>(GL_STREAM_DRAW);
+		instanceVBO->getLayout().addElement(GL_FLOAT, 2, GL_FALSE);
+		instanceVBO->getLayout().addElement(GL_FLOAT, 2, GL_FALSE);
+		instanceVBO->getLayout().addElement(GL_FLOAT, 2, GL_FALSE);
+		instanceVBO->getLayout().addElement(GL_FLOAT, 4, GL_FALSE);
+		instanceVBO->getLayout().addElement(GL_UNSIGNED_BYTE, 4, GL_TRUE);
+		instanceVBO->getLayout().addElement(GL_FLOAT, 1, GL_FALSE);
+
+		auto instancedVAO = create<VertexArray>("_AEON_InstancedVAO");
+		instancedVAO->addVBO(std::move(quadVBO));
+		instancedVAO->addVBO(std::move(instanceVBO), 1);
+		instancedVAO->addIBO(std::move(quadIBO));
+
+			// Create the light VAO (the unit quad is instanced once per light, the lights' data store being updated by the ae::LightRenderer2D every scene)
+		auto lightQuadVBO = std::make_unique<VertexBuffer>(GL_STATIC_DRAW);
+		lightQuadVBO->getLayout().addElement(GL_FLOAT, 2, GL_FALSE);
+		lightQuadVBO->setData(sizeof(QUAD_CORNERS), QUAD_CORNERS);
+
+		auto lightQuadIBO = std::make_unique<IndexBuffer>(GL_STATIC_DRAW);
+		lightQuadIBO->setData(sizeof(QUAD_INDICES), QUAD_INDICES);
+
+		auto lightVBO = std::make_unique<VertexBuffer>(GL_STREAM_DRAW);
+		lightVBO->getLayout().addElement(GL_FLOAT, 2, GL_FALSE);
+		lightVBO->getLayout().addElement(GL_FLOAT, 1, GL_FALSE);
+		lightVBO->getLayout().addElement(GL_FLOAT, 4, GL_FALSE);
+
+		auto lightVAO = create<VertexArray>("_AEON_LightVAO");
+		lightVAO->addVBO(std::move(lightQuadVBO));
+		lightVAO->addVBO(std::move(lightVBO), 1);
+		lightVAO->addIBO(std::move(lightQuadIBO));
+
+			// Create the particle VAO (the unit quad is instanced once per particle, the particles themselves are fetched from their emitter's SSBO)
+		auto particleQuadVBO = std::make_unique<VertexBuffer>(GL_STATIC_DRAW);
+		particleQuadVBO->getLayout().addElement(GL_FLOAT, 2, GL_FALSE);
+		particleQuadVBO->setData(sizeof(QUAD_CORNERS), QUAD_CORNERS);
+
+		auto particleQuadIBO = std::make_unique<IndexBuffer>(GL_STATIC_DRAW);
+		particleQuadIBO->setData(sizeof(QUAD_INDICES), QUAD_INDICES);
+
+		auto particleVAO = create<VertexArray>("_AEON_ParticleVAO");
+		particleVAO->addVBO(std::move(particleQuadVBO));
+		particleVAO->addIBO(std::move(particleQuadIBO));
+
+			// Create the mesh VAO (the meshes' own VBOs and IBOs are attached when they're drawn, the instances' data store is created by the ae::Renderer3D's ring buffer)
+		auto meshVBO = std::make_unique<VertexBuffer>(GL_STATIC_DRAW);
+		meshVBO->getLayout().addElement(GL_FLOAT, 3, GL_FALSE);
+		meshVBO->getLayout().addElement(GL_FLOAT, 3, GL_FALSE);
+		meshVBO->getLayout().addElement(GL_FLOAT, 2, GL_FALSE);
+
+		auto meshInstanceVBO = std::make_unique<VertexBuffer>(GL_STREAM_DRAW);
+		for (int i = 0; i < 4; ++i) {
+			meshInstanceVBO->getLayout().addElement(GL_FLOAT, 4, GL_FALSE);
+		}
+
+		auto meshVAO = create<VertexArray>("_AEON_MeshVAO");
+		meshVAO->addVBO(std::move(meshVBO));
+		meshVAO->addVBO(std::move(meshInstanceVBO), 1);
+
 		// Textures
 			// White Texture
 		uint32_t hexWhite = 0xffffffff;
 		auto whiteTexture = create<Texture2D>("_AEON_WhiteTexture", Texture2D::Filter::Nearest, Texture2D::Wrap::Repeat, Texture2D::InternalFormat::RGBA8);
 		whiteTexture->create(1, 1, &hexWhite);
 	}
+
+	// Private static method(s)
+	bool GLResourceFactory::isBorrowed(const PooledRenderTarget& renderTarget) noexcept
+	{
+		// The pool holds the single reference to each attachment of a render target that isn't borrowed (the absent ones have none)
+		const RenderTargetAttachments& attachments = renderTarget.attachments;
+		return attachments.framebuffer.use_count() > 1 || attachments.color.use_count() > 1 ||
+		       attachments.depth.use_count() > 1 || attachments.stencil.use_count() > 1 || attachments.multisampled.use_count() > 1;
+	}
 }
\ No newline at end of file
@@ -0,0 +1,380 @@
+// MIT License
+// 
+// Copyright(c) 2019-2021 Filippos Gleglakos
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <AEON/Graphics/GPUProfiler.h>
+
+#include <algorithm>
+#include <iomanip>
+#include <sstream>
+
+#include <GL/glew.h>
+
+#include <AEON/Graphics/internal/GLCommon.h>
+#include <AEON/Graphics/internal/RenderTarget.h>
+#include <AEON/Graphics/BasicRenderer2D.h>
+#include <AEON/Graphics/GLResourceFactory.h>
+#include <AEON/Graphics/RectangleShape.h>
+#include <AEON/Graphics/RenderStates.h>
+#include <AEON/Graphics/Text.h>
+
+namespace ae
+{
+	namespace
+	{
+		// Formats the overlay's line displaying the video memory estimated by the factory (and the memory available if the driver reports it)
+		std::string formatMemoryLine()
+		{
+			using ResourceType = GLResourceFactory::ResourceType;
+			const GLResourceFactory& factory = GLResourceFactory::getInstance();
+			const auto toMebibytes = [](size_t bytes) { return static_cast<double>(bytes) / (1024.0 * 1024.0); };
+
+			const size_t BUFFERS = factory.getMemoryUsage(ResourceType::VBO).bytes + factory.getMemoryUsage(ResourceType::IBO).bytes
+			                     + factory.getMemoryUsage(ResourceType::UBO).bytes + factory.getMemoryUsage(ResourceType::PBO).bytes
+			                     + factory.getMemoryUsage(ResourceType::SSBO).bytes;
+
+			std::ostringstream stream;
+			stream << std::fixed << std::setprecision(2)
+			       << "GPU memory: " << toMebibytes(factory.getMemoryUsage().bytes) << " MiB"
+			       << " (textures " << toMebibytes(factory.getMemoryUsage(ResourceType::Texture).bytes)
+			       << ", buffers " << toMebibytes(BUFFERS)
+			       << ", framebuffers " << toMebibytes(factory.getMemoryUsage(ResourceType::Framebuffer).bytes) << ")";
+
+			const GLResourceFactory::VideoMemoryInfo VIDEO_MEMORY = GLResourceFactory::queryVideoMemory();
+			if (VIDEO_MEMORY.supported) {
+				stream << ", " << toMebibytes(VIDEO_MEMORY.available) << " MiB available";
+				if (VIDEO_MEMORY.total != 0) {
+					stream << " of " << toMebibytes(VIDEO_MEMORY.total);
+				}
+			}
+
+			return stream.str();
+		}
+	}
+
+	// Scope
+		// Public constructor(s)
+	GPUProfiler::Scope::Scope(const std::string& name)
+	{
+		GPUProfiler::getInstance().beginScope(name);
+	}
+
+	GPUProfiler::Scope::~Scope()
+	{
+		GPUProfiler::getInstance().endScope();
+	}
+
+	// GPUProfiler
+		// Public destructor
+	GPUProfiler::~GPUProfiler()
+	{
+	}
+
+		// Public method(s)
+	void GPUProfiler::beginFrame()
+	{
+		mRecording = mEnabled;
+		if (!mRecording) {
+			return;
+		}
+
+		// Retrieve the results of the frame recorded two frames ago before reusing its queries
+		FrameQueries& frame = mFrames[mFrameIndex];
+		if (frame.pending) {
+			resolveFrame(frame);
+		}
+
+		// Create the frame's queries the first time that it's recorded
+		if (!frame.frameBegin) {
+			GLCall(glCreateQueries(GL_TIMESTAMP, 1, &frame.frameBegin));
+			GLCall(glCreateQueries(GL_TIMESTAMP, 1, &frame.frameEnd));
+		}
+
+		frame.scopeCount = 0;
+		mOpenScopes.clear();
+		GLCall(glQueryCounter(frame.frameBegin, GL_TIMESTAMP));
+	}
+
+	void GPUProfiler::endFrame()
+	{
+		if (!mRecording) {
+			return;
+		}
+
+		// Check if scopes have been left open (ignored in Release mode)
+		FrameQueries& frame = mFrames[mFrameIndex];
+		if _CONSTEXPR_IF (AEON_DEBUG) {
+			if (!mOpenScopes.empty()) {
+				AEON_LOG_WARNING("Unclosed GPU scope", "The GPU scope \"" + frame.scopes[mOpenScopes.back()].name + "\" wasn't closed before the end of the frame.");
+			}
+		}
+
+		// Close the remaining scopes so that the frame's results may be resolved
+		while (!mOpenScopes.empty()) {
+			endScope();
+		}
+
+		GLCall(glQueryCounter(frame.frameEnd, GL_TIMESTAMP));
+		frame.pending = true;
+		mRecording = false;
+
+		// Alternate the frame being recorded
+		mFrameIndex = (mFrameIndex + 1) % mFrames.size();
+	}
+
+	void GPUProfiler::beginScope(const std::string& name)
+	{
+		if (!mRecording) {
+			return;
+		}
+
+		// Create a new pair of queries if all of the frame's queries have already been used
+		FrameQueries& frame = mFrames[mFrameIndex];
+		if (frame.scopeCount == frame.scopes.size()) {
+			ScopeQuery query;
+			GLCall(glCreateQueries(GL_TIMESTAMP, 1, &query.begin));
+			GLCall(glCreateQueries(GL_TIMESTAMP, 1, &query.end));
+			frame.scopes.emplace_back(std::move(query));
+		}
+
+		// Record the scope's beginning
+		ScopeQuery& query = frame.scopes[frame.scopeCount];
+		query.name = name;
+		query.depth = static_cast<int>(mOpenScopes.size());
+		GLCall(glQueryCounter(query.begin, GL_TIMESTAMP));
+
+		mOpenScopes.push_back(frame.scopeCount++);
+	}
+
+	void GPUProfiler::endScope()
+	{
+		if (!mRecording) {
+			return;
+		}
+
+		// Check if there's an open scope to be closed (ignored in Release mode)
+		if _CONSTEXPR_IF (AEON_DEBUG) {
+			if (mOpenScopes.empty()) {
+				AEON_LOG_WARNING("Invalid GPU scope termination", "There are no open GPU scopes left to be closed.\nAborting operation.");
+				return;
+			}
+		}
+
+		// Record the scope's end
+		GLCall(glQueryCounter(mFrames[mFrameIndex].scopes[mOpenScopes.back()].end, GL_TIMESTAMP));
+		mOpenScopes.pop_back();
+	}
+
+	void GPUProfiler::renderOverlay(RenderTarget& target)
+	{
+		if (!mOverlayFont) {
+			return;
+		}
+
+		// Update the overlay's entities if new results have been retrieved
+		if (mOverlayDirty) {
+			updateOverlay();
+			mOverlayDirty = false;
+		}
+
+		// Render the overlay over the target's current content
+		BasicRenderer2D& renderer = BasicRenderer2D::getInstance();
+		renderer.beginScene(target);
+		GLCall(glClear(GL_DEPTH_BUFFER_BIT));
+		mOverlayBackground->render(RenderStates());
+		renderer.endScene();
+	}
+
+	void GPUProfiler::destroy()
+	{
+		// Delete the queries of both frames
+		for (FrameQueries& frame : mFrames) {
+			for (const ScopeQuery& query : frame.scopes) {
+				GLCall(glDeleteQueries(1, &query.begin));
+				GLCall(glDeleteQueries(1, &query.end));
+			}
+			if (frame.frameBegin) {
+				GLCall(glDeleteQueries(1, &frame.frameBegin));
+				GLCall(glDeleteQueries(1, &frame.frameEnd));
+			}
+
+			frame = FrameQueries();
+		}
+
+		// Destroy the overlay's entities (the lines of text are owned by the background)
+		mOverlayLines.clear();
+		mOverlayBackground.reset();
+		mOverlayFont = nullptr;
+		mEnabled = false;
+		mRecording = false;
+	}
+
+	void GPUProfiler::setEnabled(bool flag) noexcept
+	{
+		mEnabled = flag;
+	}
+
+	void GPUProfiler::showOverlay(Font& font)
+	{
+		// Create the overlay's background the first time that it's shown
+		if (!mOverlayBackground) {
+			mOverlayBackground = std::make_unique<RectangleShape>();
+			mOverlayBackground->setFillColor(Color(0, 0, 0, 180));
+		}
+
+		// Assign the font to the lines of text already created
+		mOverlayFont = &font;
+		for (Text* const line : mOverlayLines) {
+			line->setFont(font);
+		}
+
+		mEnabled = true;
+		mOverlayDirty = true;
+	}
+
+	void GPUProfiler::hideOverlay() noexcept
+	{
+		mOverlayFont = nullptr;
+	}
+
+	const std::vector<GPUProfiler::Result>& GPUProfiler::getResults() const noexcept
+	{
+		return mResults;
+	}
+
+	const Time& GPUProfiler::getFrameTime() const noexcept
+	{
+		return mFrameTime;
+	}
+
+	bool GPUProfiler::isEnabled() const noexcept
+	{
+		return mEnabled;
+	}
+
+	bool GPUProfiler::isOverlayVisible() const noexcept
+	{
+		return mOverlayFont != nullptr;
+	}
+
+		// Public static method(s)
+	GPUProfiler& GPUProfiler::getInstance()
+	{
+		static GPUProfiler instance;
+		return instance;
+	}
+
+		// Private constructor(s)
+	GPUProfiler::GPUProfiler()
+		: mFrames()
+		, mResults()
+		, mOpenScopes()
+		, mFrameTime()
+		, mFrameIndex(0)
+		, mOverlayBackground(nullptr)
+		, mOverlayLines()
+		, mOverlayFont(nullptr)
+		, mEnabled(false)
+		, mRecording(false)
+		, mOverlayDirty(false)
+	{
+	}
+
+		// Private method(s)
+	void GPUProfiler::resolveFrame(FrameQueries& frame)
+	{
+		// Keep the previous results if the GPU hasn't yet reached the frame's end (the queries will simply be overwritten)
+		GLint available = GL_FALSE;
+		GLCall(glGetQueryObjectiv(frame.frameEnd, GL_QUERY_RESULT_AVAILABLE, &available));
+		if (!available) {
+			frame.pending = false;
+			return;
+		}
+
+		// Retrieve the frame's duration
+		GLuint64 begin = 0, end = 0;
+		GLCall(glGetQueryObjectui64v(frame.frameBegin, GL_QUERY_RESULT, &begin));
+		GLCall(glGetQueryObjectui64v(frame.frameEnd, GL_QUERY_RESULT, &end));
+		mFrameTime = Time::nanoseconds(static_cast<int64_t>(end - begin));
+
+		// Retrieve the scopes' durations
+		mResults.resize(frame.scopeCount);
+		for (size_t i = 0; i < frame.scopeCount; ++i) {
+			const ScopeQuery& query = frame.scopes[i];
+			GLCall(glGetQueryObjectui64v(query.begin, GL_QUERY_RESULT, &begin));
+			GLCall(glGetQueryObjectui64v(query.end, GL_QUERY_RESULT, &end));
+
+			Result& result = mResults[i];
+			result.name = query.name;
+			result.duration = Time::nanoseconds(static_cast<int64_t>(end - begin));
+			result.depth = query.depth;
+		}
+
+		frame.pending = false;
+		mOverlayDirty = true;
+	}
+
+	void GPUProfiler::updateOverlay()
+	{
+		const unsigned int CHARACTER_SIZE = 14;
+		const float LINE_HEIGHT = 18.f;
+		const float PADDING = 8.f;
+
+		// Create the lines of text missing (the frame's line and the video memory's line followed by one line per result)
+		const size_t LINE_COUNT = mResults.size() + 2;
+		while (mOverlayLines.size() < LINE_COUNT) {
+			auto line = std::make_unique<Text>();
+			line->setFont(*mOverlayFont);
+			line->setCharacterSize(CHARACTER_SIZE);
+			line->setPosition(PADDING, PADDING + LINE_HEIGHT * mOverlayLines.size());
+			mOverlayLines.push_back(line.get());
+			mOverlayBackground->attachChild(std::move(line));
+		}
+
+		// Format the frame's duration and the results' durations (indented by their depth)
+		std::ostringstream stream;
+		stream << std::fixed << std::setprecision(3);
+		const auto formatLine = [&stream](const std::string& name, const Time& duration, int depth) {
+			stream.str("");
+			stream << std::string(static_cast<size_t>(depth) * 2, ' ') << name << ": " << duration.asSeconds() * 1000.0 << " ms";
+			return stream.str();
+		};
+		mOverlayLines.front()->setText(formatLine("GPU frame", mFrameTime, 0));
+		mOverlayLines[1]->setText(formatMemoryLine());
+		for (size_t i = 0; i < mResults.size(); ++i) {
+			mOverlayLines[i + 2]->setText(formatLine(mResults[i].name, mResults[i].duration, mResults[i].depth + 1));
+		}
+
+		// Clear the lines that are no longer needed
+		for (size_t i = LINE_COUNT; i < mOverlayLines.size(); ++i) {
+			mOverlayLines[i]->setText("");
+		}
+
+		// Resize the background so that it encompasses the lines of text
+		mOverlayBackground->update(Time::Zero);
+		float maxWidth = 0.f;
+		for (size_t i = 0; i < LINE_COUNT; ++i) {
+			maxWidth = std::max(maxWidth, mOverlayLines[i]->getModelBounds().size.x);
+		}
+		mOverlayBackground->setSize(maxWidth + PADDING * 2.f, LINE_HEIGHT * LINE_COUNT + PADDING * 2.f);
+		mOverlayBackground->update(Time::Zero);
+	}
+}
\ No newline at end of file
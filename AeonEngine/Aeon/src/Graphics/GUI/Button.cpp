@@ -30,10 +30,10 @@ namespace ae
 		: Widget()
 		, mText(nullptr)
 	{
-		// Attach a text instance to the active state
+		// Attach a text instance to the shape
 		auto text = std::make_unique<Text>();
 		mText = text.get();
-		getState(getActiveState()).attachChild(std::move(text));
+		getShape().attachChild(std::move(text));
 
 		// Set the button's origin to its center
 		setOriginFlags(OriginFlag::Center);
@@ -66,18 +66,6 @@ namespace ae
 	}
 
 	// Private virtual method(s)
-	void Button::enableState(State state)
-	{
-		// Detach the text from the currently-active state
-		auto text = getState(getActiveState()).detachChild(*mText);
-
-		// Activate the new state requested
-		Widget::enableState(state);
-
-		// Attach the previously-detached text to the active state
-		getState(getActiveState()).attachChild(std::move(text));
-	}
-
 	void Button::updateSelf(const Time& dt)
 	{
 		// Set the active state to hover if it's currently clicked
@@ -91,9 +79,11 @@ namespace ae
 
 	void Button::handleEventSelf(Event* const event)
 	{
-		// Check if the button has been disabled
+		AEON_MEMORY_SCOPE(MemoryTag::GUI);
+
+		// Check if the button has been disabled or if the event is routed to other widgets
 		const State ACTIVE_STATE = getActiveState();
-		if (ACTIVE_STATE == State::Disabled) {
+		if (ACTIVE_STATE == State::Disabled || !isEventRouted(event)) {
 			return;
 		}
 
@@ -115,7 +105,7 @@ namespace ae
 			auto mouseButtonEvent = event->as<MouseButtonEvent>();
 			if (mouseButtonEvent->button == Mouse::Button::Left) {
 				enableState(State::Click);
-				event->handled = true;
+				consumeEvent(event);
 			}
 		}
 	}
@@ -0,0 +1,166 @@
+// MIT License
+// 
+// Copyright(c) 2019-2021 Filippos Gleglakos
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <AEON/Graphics/GUI/FlexLayout.h>
+
+#include <algorithm>
+#include <cmath>
+
+namespace ae
+{
+	namespace
+	{
+		// Retrieves the size covered by the child's model bounds once scaled
+		Vector2f getScaledSize(const Actor2D& child)
+		{
+			const Vector2f& SCALE = child.getScale();
+			const Box2f MODEL_BOUNDS = child.getModelBounds();
+			return Vector2f(MODEL_BOUNDS.max.x * std::fabs(SCALE.x), MODEL_BOUNDS.max.y * std::fabs(SCALE.y));
+		}
+	}
+
+	// Public constructor(s)
+	FlexLayout::FlexLayout(Direction direction)
+		: Actor2D()
+		, mContentBounds()
+		, mPadding(0.f)
+		, mSpacing(0.f)
+		, mDirection(direction)
+		, mAlignment(Alignment::Start)
+	{
+	}
+
+	// Public method(s)
+	void FlexLayout::setDirection(Direction direction) noexcept
+	{
+		mDirection = direction;
+		invalidateLayout();
+	}
+
+	void FlexLayout::setSpacing(float spacing) noexcept
+	{
+		mSpacing = spacing;
+		invalidateLayout();
+	}
+
+	void FlexLayout::setPadding(const Vector2f& padding) noexcept
+	{
+		mPadding = padding;
+		invalidateLayout();
+	}
+
+	void FlexLayout::setAlignment(Alignment alignment) noexcept
+	{
+		mAlignment = alignment;
+		invalidateLayout();
+	}
+
+	FlexLayout::Direction FlexLayout::getDirection() const noexcept
+	{
+		return mDirection;
+	}
+
+	float FlexLayout::getSpacing() const noexcept
+	{
+		return mSpacing;
+	}
+
+	const Vector2f& FlexLayout::getPadding() const noexcept
+	{
+		return mPadding;
+	}
+
+	FlexLayout::Alignment FlexLayout::getAlignment() const noexcept
+	{
+		return mAlignment;
+	}
+
+	// Public virtual method(s)
+	Box2f FlexLayout::getModelBounds() const
+	{
+		// The children may have been resized since the last layout pass
+		return (isLayoutDirty()) ? measure() : mContentBounds;
+	}
+
+	// Protected virtual method(s)
+	void FlexLayout::arrangeChildren()
+	{
+		mContentBounds = measure();
+
+		const size_t MAIN = (mDirection == Direction::Row) ? 0 : 1;
+		const size_t CROSS = 1 - MAIN;
+		const float CROSS_EXTENT = mContentBounds.max[CROSS] - mPadding[CROSS] * 2.f;
+		float cursor = mPadding[MAIN];
+		for (const auto& child : getChildren())
+		{
+			// Place the top left corner of the child's scaled model bounds
+			const Vector2f SIZE = getScaledSize(*child);
+			Vector2f corner;
+			corner[MAIN] = cursor;
+			corner[CROSS] = mPadding[CROSS];
+			if (mAlignment == Alignment::Center) {
+				corner[CROSS] += (CROSS_EXTENT - SIZE[CROSS]) / 2.f;
+			}
+			else if (mAlignment == Alignment::End) {
+				corner[CROSS] += CROSS_EXTENT - SIZE[CROSS];
+			}
+
+			// The child's position is offset by its origin relative to its model bounds
+			const Vector2f& SCALE = child->getScale();
+			const Vector2f OFFSET = child->getOrigin() - child->getModelBounds().min;
+			child->setPosition(corner + Vector2f(OFFSET.x * std::fabs(SCALE.x), OFFSET.y * std::fabs(SCALE.y)));
+
+			cursor += SIZE[MAIN] + mSpacing;
+		}
+	}
+
+	bool FlexLayout::isLayoutDependentOnChildren() const noexcept
+	{
+		return true;
+	}
+
+	bool FlexLayout::hasPendingUpdate() const
+	{
+		return false;
+	}
+
+	// Private method(s)
+	Box2f FlexLayout::measure() const
+	{
+		const size_t MAIN = (mDirection == Direction::Row) ? 0 : 1;
+		const size_t CROSS = 1 - MAIN;
+
+		// The children are placed one after the other along the main axis, the largest one defining the cross extent
+		Vector2f content(0.f);
+		const auto& CHILDREN = getChildren();
+		for (const auto& child : CHILDREN) {
+			const Vector2f SIZE = getScaledSize(*child);
+			content[MAIN] += SIZE[MAIN];
+			content[CROSS] = std::max(content[CROSS], SIZE[CROSS]);
+		}
+		if (CHILDREN.size() > 1) {
+			content[MAIN] += mSpacing * static_cast<float>(CHILDREN.size() - 1);
+		}
+
+		return Box2f(Vector2f(0.f), content + mPadding * 2.f);
+	}
+}
\ No newline at end of file
@@ -0,0 +1,351 @@
+// MIT License
+// 
+// Copyright(c) 2019-2021 Filippos Gleglakos
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <AEON/Graphics/GUI/ListView.h>
+
+#include <algorithm>
+#include <cmath>
+
+#include <AEON/Graphics/GUI/Scrollbar.h>
+#include <AEON/System/Profiler.h>
+
+namespace ae
+{
+	namespace
+	{
+		// The default width of the scrollbar's thumb
+		constexpr float SCROLLBAR_WIDTH = 8.f;
+		// The number of entries scrolled by a notch of the mouse wheel
+		constexpr float WHEEL_ENTRIES = 3.f;
+	}
+
+	// ListView::Content
+	/*!
+	 \brief The internal class clipping the item widgets to the viewport of the ae::ListView with the scissor test.
+	*/
+	class ListView::Content : public Actor2D
+	{
+	public:
+		// Public constructor(s)
+		explicit Content(const RenderTarget& target)
+			: Actor2D()
+			, mTarget(&target)
+			, mSize(0.f)
+		{
+			// The item widgets are rendered by the node itself with the clip rect
+			activateFunctionality(Func::Render, Target::Children, false);
+		}
+
+	public:
+		// Public method(s)
+		void setSize(const Vector2f& size) noexcept
+		{
+			mSize = size;
+		}
+
+	private:
+		// Private virtual method(s)
+		virtual bool hasPendingUpdate() const override final
+		{
+			return false;
+		}
+
+		virtual void renderSelf(const RenderStates& states) const override final
+		{
+			// Convert the viewport to a pixel region from the bottom-left corner of the render target
+			const Vector2f CORNER0 = mTarget->mapCoordsToPixel(Vector2f(states.transform * Vector3f(0.f, 0.f, 0.f)));
+			const Vector2f CORNER1 = mTarget->mapCoordsToPixel(Vector2f(states.transform * Vector3f(mSize.x, mSize.y, 0.f)));
+			const float TARGET_HEIGHT = static_cast<float>(mTarget->getFramebufferSize().y);
+			int minX = static_cast<int>(std::floor(std::min(CORNER0.x, CORNER1.x)));
+			int maxX = static_cast<int>(std::ceil(std::max(CORNER0.x, CORNER1.x)));
+			int minY = static_cast<int>(std::floor(TARGET_HEIGHT - std::max(CORNER0.y, CORNER1.y)));
+			int maxY = static_cast<int>(std::ceil(TARGET_HEIGHT - std::min(CORNER0.y, CORNER1.y)));
+
+			// Stay within the region of an enclosing clipped container
+			if (states.clipRect.z > 0 && states.clipRect.w > 0) {
+				minX = std::max(minX, states.clipRect.x);
+				minY = std::max(minY, states.clipRect.y);
+				maxX = std::min(maxX, states.clipRect.x + states.clipRect.z);
+				maxY = std::min(maxY, states.clipRect.y + states.clipRect.w);
+			}
+
+			// An empty region would disable the clipping instead of discarding the item widgets
+			if (maxX <= minX || maxY <= minY) {
+				return;
+			}
+
+			RenderStates itemStates(states);
+			itemStates.clipRect = Vector4i(minX, minY, maxX - minX, maxY - minY);
+			for (const auto& item : getChildren()) {
+				item->render(itemStates);
+			}
+		}
+
+	private:
+		// Private member(s)
+		const RenderTarget* mTarget; //!< The render target onto which the list is displayed
+		Vector2f            mSize;   //!< The size of the viewport
+	};
+
+	// ListView
+		// Public constructor(s)
+	ListView::ListView(const Vector2f& size, float itemHeight, ItemFactory factory, ItemBinder binder)
+		: Widget()
+		, mFactory(std::move(factory))
+		, mBinder(std::move(binder))
+		, mItems()
+		, mFreeItems()
+		, mContent(nullptr)
+		, mScrollbar(nullptr)
+		, mViewportSize(0.f)
+		, mScrollOffset(0.0)
+		, mScrollRatio(0.f)
+		, mItemHeight(itemHeight)
+		, mItemCount(0)
+		, mMargin(2)
+		, mFirstIndex(0)
+		, mLastIndex(0)
+		, mUpdateItems(true)
+		, mRebindItems(false)
+	{
+		RectangleShape& shape = getShape();
+		shape.setSize(size);
+
+		// The item widgets are clipped to the viewport, the scrollbar being displayed above them
+		auto content = std::make_unique<Content>(*mTarget);
+		mContent = content.get();
+		shape.attachChild(std::move(content));
+
+		auto scrollbar = std::make_unique<Scrollbar>(0.f);
+		mScrollbar = scrollbar.get();
+		mScrollbar->getShape().setSize(SCROLLBAR_WIDTH, 0.f);
+		shape.attachChild(std::move(scrollbar));
+	}
+
+		// Public method(s)
+	void ListView::setItemCount(size_t count)
+	{
+		mItemCount = count;
+		updateScrollbar();
+	}
+
+	void ListView::setItemHeight(float height)
+	{
+		mItemHeight = height;
+		mRebindItems = true;
+		updateScrollbar();
+	}
+
+	void ListView::setMargin(size_t margin)
+	{
+		mMargin = margin;
+		mUpdateItems = true;
+	}
+
+	void ListView::scrollTo(float offset)
+	{
+		const double MAX_OFFSET = getMaxScrollOffset();
+		mScrollOffset = Math::clamp(static_cast<double>(offset), 0.0, MAX_OFFSET);
+		mScrollbar->setScrollRatio((MAX_OFFSET > 0.0) ? static_cast<float>(mScrollOffset / MAX_OFFSET) : 0.f);
+		mScrollRatio = mScrollbar->getScrollRatio();
+		mUpdateItems = true;
+	}
+
+	void ListView::scroll(float delta)
+	{
+		scrollTo(static_cast<float>(mScrollOffset + delta));
+	}
+
+	void ListView::refresh()
+	{
+		mRebindItems = true;
+		mUpdateItems = true;
+	}
+
+	void ListView::refreshItem(size_t index)
+	{
+		for (const auto& item : mItems) {
+			if (item.first == index) {
+				mBinder(*item.second, index);
+				return;
+			}
+		}
+	}
+
+	size_t ListView::getItemCount() const noexcept
+	{
+		return mItemCount;
+	}
+
+	float ListView::getItemHeight() const noexcept
+	{
+		return mItemHeight;
+	}
+
+	size_t ListView::getMargin() const noexcept
+	{
+		return mMargin;
+	}
+
+	float ListView::getScrollOffset() const noexcept
+	{
+		return static_cast<float>(mScrollOffset);
+	}
+
+	std::pair<size_t, size_t> ListView::getBoundRange() const noexcept
+	{
+		return std::make_pair(mFirstIndex, mLastIndex);
+	}
+
+	Scrollbar& ListView::getScrollbar() noexcept
+	{
+		return *mScrollbar;
+	}
+
+		// Private method(s)
+	void ListView::updateItems()
+	{
+		AEON_PROFILE_SCOPE("ListView::updateItems");
+
+		// Determine the range of the visible entries, extended by the margin on both sides
+		size_t first = 0, last = 0;
+		if (mItemCount > 0 && mItemHeight > 0.f) {
+			const size_t FIRST_VISIBLE = static_cast<size_t>(mScrollOffset / mItemHeight);
+			const size_t LAST_VISIBLE = static_cast<size_t>(std::ceil((mScrollOffset + mViewportSize.y) / mItemHeight));
+			first = std::min(FIRST_VISIBLE - std::min(FIRST_VISIBLE, mMargin), mItemCount);
+			last = std::min(LAST_VISIBLE + mMargin, mItemCount);
+		}
+
+		// Recycle the item widgets whose entries left the range
+		size_t keptCount = 0;
+		for (const auto& item : mItems) {
+			if (!mRebindItems && item.first >= first && item.first < last) {
+				mItems[keptCount++] = item;
+			}
+			else {
+				mFreeItems.push_back(mContent->detachChild(*item.second));
+			}
+		}
+		mItems.resize(keptCount);
+
+		// Bind the entries that entered the range, the item widgets only being created if none can be recycled
+		for (size_t index = first; index < last; ++index) {
+			if (!mRebindItems && index >= mFirstIndex && index < mLastIndex) {
+				continue;
+			}
+
+			std::unique_ptr<Actor2D> item;
+			if (mFreeItems.empty()) {
+				item = mFactory();
+			}
+			else {
+				item = std::move(mFreeItems.back());
+				mFreeItems.pop_back();
+			}
+			mBinder(*item, index);
+			mItems.emplace_back(index, item.get());
+			mContent->attachChild(std::move(item));
+		}
+		mFirstIndex = first;
+		mLastIndex = last;
+		mRebindItems = false;
+		mUpdateItems = false;
+
+		// Position the bound item widgets relative to the scroll offset
+		for (const auto& item : mItems) {
+			item.second->setPosition(0.f, static_cast<float>(static_cast<double>(item.first) * mItemHeight - mScrollOffset));
+		}
+	}
+
+	void ListView::updateScrollbar()
+	{
+		// Resize the thumb to the content and keep it along the right edge of the viewport
+		mScrollbar->updateSize(static_cast<float>(static_cast<double>(mItemCount) * mItemHeight), mViewportSize.y);
+		mScrollbar->setPosition(mViewportSize.x, mScrollbar->getPosition().y);
+
+		// The scroll offset is clamped to the new content
+		scrollTo(static_cast<float>(mScrollOffset));
+	}
+
+	double ListView::getMaxScrollOffset() const noexcept
+	{
+		return std::max(static_cast<double>(mItemCount) * mItemHeight - mViewportSize.y, 0.0);
+	}
+
+		// Private virtual method(s)
+	void ListView::updateSelf(const Time& dt)
+	{
+		Widget::updateSelf(dt);
+
+		// Fit the scrollbar and the clipped region to the viewport if it was resized
+		const Vector2f& SIZE = getShape().getSize();
+		if (SIZE != mViewportSize) {
+			mViewportSize = SIZE;
+			mContent->setSize(SIZE);
+			updateScrollbar();
+		}
+
+		// Follow the scrollbar's thumb if it was dragged
+		const float RATIO = mScrollbar->getScrollRatio();
+		if (RATIO != mScrollRatio) {
+			mScrollOffset = RATIO * getMaxScrollOffset();
+			mScrollRatio = RATIO;
+			mUpdateItems = true;
+		}
+
+		if (mUpdateItems) {
+			updateItems();
+		}
+	}
+
+	void ListView::handleEventSelf(Event* const event)
+	{
+		AEON_MEMORY_SCOPE(MemoryTag::GUI);
+
+		// Check if the list has been disabled or if the event is routed to other widgets
+		const State ACTIVE_STATE = getActiveState();
+		if (ACTIVE_STATE == State::Disabled || !isEventRouted(event)) {
+			return;
+		}
+
+		// Check if the list is being hovered over
+		if (event->type == Event::Type::MouseMoved && (ACTIVE_STATE == State::Idle || ACTIVE_STATE == State::Hover)) {
+			auto mouseMoveEvent = event->as<MouseMoveEvent>();
+
+			const bool HOVERED_OVER = isHoveredOver(mouseMoveEvent->position);
+			if (HOVERED_OVER && ACTIVE_STATE == State::Idle) {
+				enableState(State::Hover);
+			}
+			else if (!HOVERED_OVER && ACTIVE_STATE == State::Hover) {
+				enableState(State::Idle);
+			}
+		}
+		// Scroll the hovered list with the vertical mouse wheel
+		else if (event->type == Event::Type::MouseWheelScrolled && !event->handled && ACTIVE_STATE == State::Hover) {
+			auto mouseWheelEvent = event->as<MouseWheelEvent>();
+			if (mouseWheelEvent->wheel == Mouse::Wheel::Vertical) {
+				scroll(static_cast<float>(-mouseWheelEvent->offset) * WHEEL_ENTRIES * mItemHeight);
+				consumeEvent(event);
+			}
+		}
+	}
+}
\ No newline at end of file
@@ -22,15 +22,23 @@
 
 #include <AEON/Graphics/GUI/Scrollbar.h>
 
+#include <algorithm>
+
 namespace ae
 {
+	namespace
+	{
+		// The minimum length of the thumb, so that it remains visible for long contents
+		constexpr float MIN_THUMB_LENGTH = 16.f;
+	}
+
 	// Public constructor(s)
 	Scrollbar::Scrollbar(float actualSize)
 		: Widget()
 		, mActualSize(actualSize)
 		, mVisibleSize(actualSize)
 	{
-		// Set the states' size
+		// Set the thumb's size
 		updateSize(actualSize, actualSize);
 
 		setOriginFlags(OriginFlag::Right | OriginFlag::Top);
@@ -39,32 +47,51 @@ namespace ae
 	// Public method(s)
 	void Scrollbar::scrollTo(float pos)
 	{
-		setPosition(getPosition().x, Math::clamp(pos, 0.f, mActualSize));
+		setPosition(getPosition().x, Math::clamp(pos, 0.f, getTrackLength()));
 	}
 
 	void Scrollbar::scroll(float offset)
 	{
-		setPosition(getPosition().x, Math::clamp(offset, 0.f, mActualSize));
+		scrollTo(getPosition().y + offset);
 	}
 
 	void Scrollbar::updateSize(float actualSize, float visibleSize)
 	{
-		// Set the states' size
-		for (size_t i = 0; i < State::StateCount; ++i) {
-			RectangleShape& state = getState(static_cast<State>(i));
-			state.setSize(state.getSize().x, visibleSize * visibleSize / actualSize);
-		}
+		// Set the thumb's size (it covers the whole track if the content is entirely visible)
+		RectangleShape& shape = getShape();
+		const float THUMB_LENGTH = (actualSize > visibleSize) ? std::min(std::max(visibleSize * visibleSize / actualSize, MIN_THUMB_LENGTH), visibleSize) : visibleSize;
+		shape.setSize(shape.getSize().x, THUMB_LENGTH);
 
 		mActualSize = actualSize;
 		mVisibleSize = visibleSize;
+		scrollTo(getPosition().y);
+	}
+
+	void Scrollbar::setScrollRatio(float ratio)
+	{
+		scrollTo(ratio * getTrackLength());
+	}
+
+	float Scrollbar::getScrollRatio() const noexcept
+	{
+		const float TRACK_LENGTH = getTrackLength();
+		return (TRACK_LENGTH > 0.f) ? getPosition().y / TRACK_LENGTH : 0.f;
+	}
+
+	// Private method(s)
+	float Scrollbar::getTrackLength() const noexcept
+	{
+		return std::max(mVisibleSize - getShape().getSize().y, 0.f);
 	}
 
 	// Private virtual method(s)
 	void Scrollbar::handleEventSelf(Event* const event)
 	{
-		// Check if the scrollbar has been disabled
+		AEON_MEMORY_SCOPE(MemoryTag::GUI);
+
+		// Check if the scrollbar has been disabled or if the event is routed to other widgets
 		const State ACTIVE_STATE = getActiveState();
-		if (ACTIVE_STATE == State::Disabled) {
+		if (ACTIVE_STATE == State::Disabled || !isEventRouted(event)) {
 			return;
 		}
 
@@ -89,7 +116,7 @@ namespace ae
 			auto mouseButtonEvent = event->as<MouseButtonEvent>();
 			if (mouseButtonEvent->button == Mouse::Button::Left) {
 				enableState(State::Click);
-				event->handled = true;
+				consumeEvent(event);
 			}
 		}
 		// Check if the scrollbar is released
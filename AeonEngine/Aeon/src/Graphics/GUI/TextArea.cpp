@@ -23,7 +23,10 @@
 #include <AEON/Graphics/GUI/TextArea.h>
 
 #include <AEON/Graphics/Text.h>
+#include <AEON/Graphics/Font.h>
+#include <AEON/Graphics/Sprite.h>
 #include <AEON/Graphics/BasicRenderer2D.h>
+#include <AEON/Graphics/GPUProfiler.h>
 
 namespace ae
 {
@@ -35,10 +38,25 @@ namespace ae
 		, mMaxSize(0.f, 0.f)
 		, mProperties(0)
 		, mUpdateContent(true)
+		, mFont(nullptr)
+		, mContentSprite(nullptr)
 	{
 		auto firstLine = std::make_unique<Text>();
 		mLines.emplace_back(firstLine.get());
-		getState(getActiveState()).attachChild(std::move(firstLine));
+		getShape().attachChild(std::move(firstLine));
+
+		// The content is displayed above the shape's fill, so the state changes don't require the lines to be rendered again
+		auto contentSprite = std::make_unique<Sprite>();
+		mContentSprite = contentSprite.get();
+		getShape().attachChild(std::move(contentSprite));
+		mContent.setClearColor(Color::Transparent);
+	}
+
+	TextArea::~TextArea()
+	{
+		if (mFont) {
+			mFont->removeListener(this);
+		}
 	}
 
 	void TextArea::setProperties(uint32_t properties)
@@ -56,9 +74,9 @@ namespace ae
 		// Remove all current lines except the first
 		if (mLines.size() > 1)
 		{
-			ae::RectangleShape& activeState = getState(getActiveState());
+			ae::RectangleShape& shape = getShape();
 			for (size_t i = 1; i < mLines.size(); ++i) {
-				activeState.detachChild(*mLines[i]);
+				shape.detachChild(*mLines[i]);
 			}
 			mLines.erase(mLines.begin() + 1, mLines.end());
 		}
@@ -82,11 +100,22 @@ namespace ae
 	{
 		Widget::updateSelf(dt);
 
-		if (isDirty())
-		{
-			// Set the render texture's clear color to the active state's fill color
-			mContent.setClearColor(getState(getActiveState()).getFillColor());
+		// Listen to the texture atlas updates of the lines' font so that the content is rendered again with the new uv coordinates
+		const Font* const FONT = mLines.front()->getFont();
+		if (FONT != mFont) {
+			if (mFont) {
+				mFont->removeListener(this);
+			}
+			mFont = FONT;
+			if (mFont) {
+				mFont->addListener(this, [this](bool) { mUpdateContent = true; });
+			}
+		}
 
+		// Render the lines again if the text was modified or if the content area's size changed
+		const Vector2f& currentSize = getShape().getSize();
+		const Vector2i ACTUAL_SIZE(static_cast<int>(Math::ceil(currentSize.x)), static_cast<int>(Math::ceil(currentSize.y)));
+		if (isDirty() || ACTUAL_SIZE != mContent.getFramebufferSize()) {
 			mUpdateContent = true;
 			setDirty(false);
 		}
@@ -99,16 +128,11 @@ namespace ae
 
 	void TextArea::handleEventSelf(Event* const event)
 	{
-		if (event->type == Event::Type::FontUpdated) {
-			auto fontEvent = event->as<FontEvent>();
-			if (fontEvent->font == mLines.front()->getFont()) {
-				mUpdateContent = true;
-			}
-		}
+		AEON_MEMORY_SCOPE(MemoryTag::GUI);
 
-		// Check if the text area has been disabled
+		// Check if the text area has been disabled or if the event is routed to other widgets
 		const State ACTIVE_STATE = getActiveState();
-		if (ACTIVE_STATE == State::Disabled) {
+		if (ACTIVE_STATE == State::Disabled || !isEventRouted(event)) {
 			return;
 		}
 
@@ -130,11 +154,14 @@ namespace ae
 	// Private method(s)
 	void TextArea::renderLines()
 	{
-		// Recreate the content area if the optimal size has changed
-		const Vector2f& currentSize = getState(getActiveState()).getSize();
+		AEON_PROFILE_GPU_SCOPE("TextArea::renderLines");
+
+		// Recreate the content area if the optimal size has changed and display it with the content sprite
+		const Vector2f& currentSize = getShape().getSize();
 		const Vector2i ACTUAL_SIZE(static_cast<int>(Math::ceil(currentSize.x)), static_cast<int>(Math::ceil(currentSize.y)));
 		if (ACTUAL_SIZE != mContent.getFramebufferSize()) {
 			mContent.create(ACTUAL_SIZE.x, ACTUAL_SIZE.y);
+			mContentSprite->setTexture(*mContent.getTexture(), true);
 		}
 
 		// Enable automatic rendering for the lines (so that they may be rendered onto the content area)
@@ -150,12 +177,6 @@ namespace ae
 		}
 		renderer.endScene();
 
-		// Set the content texture to the text area's states
-		const Texture2D* const contentTexture = mContent.getTexture();
-		for (size_t i = 0; i < State::StateCount; ++i) {
-			getState(static_cast<State>(i)).setTexture(contentTexture, true);
-		}
-
 		// Disable automatic rendering for the lines
 		for (Text* const line : mLines) {
 			line->activateFunctionality(Func::Render, Target::Self, false);
@@ -183,7 +204,7 @@ namespace ae
 		// Wrap words to the next line once the horizontal length limit is reached
 		if (mProperties & Property::MultiLine && mProperties & Property::WordWrap)
 		{
-			const Vector2f& size = getState(getActiveState()).getSize();
+			const Vector2f& size = getShape().getSize();
 
 			for (size_t i = 0; i < mLines.size(); )
 			{
@@ -197,7 +218,7 @@ namespace ae
 						newLine->setText("");
 						newLine->move(0.f, mLines.front()->getCharacterSize() * mLines.front()->getScale().y * mLines.size());
 						mLines.emplace_back(newLine.get());
-						getState(getActiveState()).attachChild(std::move(newLine));
+						getShape().attachChild(std::move(newLine));
 					}
 
 					// Attempt to locate the last space character to cut off the last word
@@ -244,7 +265,7 @@ namespace ae
 				if (lineIndex >= mLines.size()) {
 					auto newLine = std::make_unique<Text>(*mLines.front());
 					mLines.emplace_back(newLine.get());
-					getState(getActiveState()).attachChild(std::move(newLine));
+					getShape().attachChild(std::move(newLine));
 				}
 
 				// Set the text found after the newline to the next line
@@ -253,28 +274,4 @@ namespace ae
 			}
 		}
 	}
-
-	// Private virtual method(s)
-	void TextArea::enableState(State state)
-	{
-		// Detach the lines from the currently-active state
-		ae::RectangleShape& previousState = getState(getActiveState());
-		std::vector<std::unique_ptr<Actor2D>> detachedLines;
-		detachedLines.reserve(mLines.size());
-		for (const Text* const line : mLines) {
-			detachedLines.push_back(previousState.detachChild(*line));
-		}
-
-		// Activate the new state requested
-		Widget::enableState(state);
-
-		// Attach the previously-detached lines to the active state
-		ae::RectangleShape& currentState = getState(getActiveState());
-		for (std::unique_ptr<Actor2D>& line : detachedLines) {
-			currentState.attachChild(std::move(line));
-		}
-
-		// Set the render texture's clear color to the active state's fill color
-		mContent.setClearColor(currentState.getFillColor());
-	}
 }
\ No newline at end of file
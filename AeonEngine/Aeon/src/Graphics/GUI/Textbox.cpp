@@ -22,31 +22,267 @@
 
 #include <AEON/Graphics/GUI/Textbox.h>
 
+#include <algorithm>
+#include <cmath>
+#include <memory>
+
 #include <AEON/System/Clipboard.h>
+#include <AEON/Window/Application.h>
 
 #include <AEON/Graphics/Text.h>
+#include <AEON/Graphics/GLResourceFactory.h>
+#include <AEON/Graphics/internal/Renderer2D.h>
 
 namespace ae
 {
+	namespace
+	{
+		// The width of the caret, in the text's model units
+		constexpr float CARET_WIDTH = 1.f;
+		// The caret's extents around the baseline, relative to the character size
+		constexpr float CARET_ASCENT = 0.8f;
+		constexpr float CARET_DESCENT = 0.2f;
+
+		// Checks if the byte provided is a UTF-8 continuation byte
+		bool isContinuationByte(char byte) noexcept
+		{
+			return (static_cast<unsigned char>(byte) & 0xC0) == 0x80;
+		}
+
+		// Retrieves the position of the character preceding the index provided
+		size_t getPreviousBoundary(const std::string& text, size_t index) noexcept
+		{
+			if (index == 0) {
+				return 0;
+			}
+
+			--index;
+			while (index > 0 && isContinuationByte(text[index])) {
+				--index;
+			}
+			return index;
+		}
+
+		// Retrieves the position of the character following the index provided
+		size_t getNextBoundary(const std::string& text, size_t index) noexcept
+		{
+			if (index >= text.size()) {
+				return text.size();
+			}
+
+			++index;
+			while (index < text.size() && isContinuationByte(text[index])) {
+				++index;
+			}
+			return index;
+		}
+
+		// Clamps the index provided to the string's size and moves it back to the start of its character
+		size_t clampToBoundary(const std::string& text, size_t index) noexcept
+		{
+			index = std::min(index, text.size());
+			while (index > 0 && index < text.size() && isContinuationByte(text[index])) {
+				--index;
+			}
+			return index;
+		}
+	}
+
+	// Textbox::Overlay
+	/*
+	 The caret and the selection highlight are two quads attached to the text, so
+	 they're laid out in its model space. They're only rebuilt when the caret is
+	 moved or the text's layout has changed, the blink being driven by the caret
+	 shader: the caret's vertices are flagged by their horizontal UV coordinate and
+	 their vertical one holds the phase at which the blink started.
+	*/
+	class Textbox::Overlay : public Actor2D
+	{
+	public:
+		// Public constructor(s)
+		explicit Overlay(const Text& text)
+			: Actor2D()
+			, mText(text)
+			, mBounds()
+			, mCaretColor(Color::White)
+			, mSelectionColor(51, 153, 255, 102)
+			, mCaret(0)
+			, mAnchor(0)
+			, mCaretOffset(0.f)
+			, mAnchorOffset(0.f)
+			, mCharacterSize(0)
+			, mBlinkPhase(0.f)
+			, mUpdateGeometry(true)
+			, mShader(nullptr)
+		{
+			getVertices().resize(8);
+			setSharedIndices(GLResourceFactory::getInstance().getQuadIndices(2));
+		}
+
+		// Public method(s)
+		void setCaretColor(const Color& color)
+		{
+			mCaretColor = color;
+			requestGeometry();
+		}
+
+		void setSelectionColor(const Color& color)
+		{
+			mSelectionColor = color;
+			requestGeometry();
+		}
+
+		void setRange(size_t caret, size_t anchor)
+		{
+			// Restart the blink so that the caret is visible while it's moved
+			const float SECONDS = Renderer2D::getSceneTime().asSeconds();
+			mBlinkPhase = SECONDS - std::floor(SECONDS);
+			mCaret = caret;
+			mAnchor = anchor;
+			requestGeometry();
+		}
+
+		void track()
+		{
+			// Rebuild the quads if the text's layout has moved the caret or the selection
+			if (mText.getCharacterSize() != mCharacterSize || mText.getCharacterOffset(mCaret) != mCaretOffset || mText.getCharacterOffset(mAnchor) != mAnchorOffset) {
+				requestGeometry();
+			}
+		}
+
+		// Public virtual method(s)
+		_NODISCARD virtual Box2f getModelBounds() const override
+		{
+			return mBounds;
+		}
+
+	private:
+		// Private method(s)
+		void requestGeometry() noexcept
+		{
+			mUpdateGeometry = true;
+			wake();
+		}
+
+		void setQuad(size_t first, float left, float right, float top, float bottom, const Vector4f& color, const Vector2f& uv)
+		{
+			Vertex2DList& vertices = getVertices();
+			const float POS_Z = static_cast<float>(getDepth());
+			vertices[first + 0].position = Vector3f(left,  top,    POS_Z);
+			vertices[first + 1].position = Vector3f(left,  bottom, POS_Z);
+			vertices[first + 2].position = Vector3f(right, bottom, POS_Z);
+			vertices[first + 3].position = Vector3f(right, top,    POS_Z);
+			for (size_t i = first; i < first + 4; ++i) {
+				vertices[i].color = color;
+				vertices[i].uv = uv;
+			}
+		}
+
+		// Private virtual method(s)
+		virtual void updateSelf(const Time&) override
+		{
+			if (!mUpdateGeometry) {
+				return;
+			}
+
+			mCharacterSize = mText.getCharacterSize();
+			mCaretOffset = mText.getCharacterOffset(mCaret);
+			mAnchorOffset = mText.getCharacterOffset(mAnchor);
+
+			// The selection is drawn first so that the caret is displayed above it
+			const float TOP = -CARET_ASCENT * static_cast<float>(mCharacterSize);
+			const float BOTTOM = CARET_DESCENT * static_cast<float>(mCharacterSize);
+			const float SELECTION_LEFT = std::min(mCaretOffset, mAnchorOffset);
+			const float SELECTION_RIGHT = std::max(mCaretOffset, mAnchorOffset);
+			const float CARET_LEFT = mCaretOffset - CARET_WIDTH * 0.5f;
+			const float CARET_RIGHT = mCaretOffset + CARET_WIDTH * 0.5f;
+			setQuad(0, SELECTION_LEFT, SELECTION_RIGHT, TOP, BOTTOM, mSelectionColor.normalize(), Vector2f(0.f, 0.f));
+			setQuad(4, CARET_LEFT, CARET_RIGHT, TOP, BOTTOM, mCaretColor.normalize(), Vector2f(1.f, mBlinkPhase));
+
+			const float LEFT = std::min(SELECTION_LEFT, CARET_LEFT);
+			mBounds = Box2f(Vector2f(LEFT, TOP), Vector2f(std::max(SELECTION_RIGHT, CARET_RIGHT) - LEFT, BOTTOM - TOP));
+			invalidateBounds();
+
+			mUpdateGeometry = false;
+			setDirty(true);
+		}
+
+		virtual void onDepthModified() override
+		{
+			requestGeometry();
+		}
+
+		_NODISCARD virtual bool hasPendingUpdate() const override
+		{
+			return mUpdateGeometry;
+		}
+
+		virtual void renderSelf(const RenderStates& nodeStates) const override
+		{
+			// Setup the appropriate render states on a copy, the caret shader blinking the caret
+			RenderStates states(nodeStates);
+			if (!states.shader) {
+				if (!mShader) {
+					mShader = GLResourceFactory::getInstance().get<Shader>("_AEON_Caret2D");
+				}
+				states.shader = mShader.get();
+			}
+			states.blendMode = BlendMode::BlendAlpha;
+			states.transparency = RenderStates::Transparency::Transparent;
+			states.dirty = isDirty();
+
+			// Send the overlay to the renderer
+			submitGeometry(states);
+
+			// Drop the dirty render flag
+			setDirty(false);
+		}
+
+	private:
+		// Private member(s)
+		const Text&                     mText;           //!< The text over which the caret and the selection are displayed
+		Box2f                           mBounds;         //!< The model bounds covering both quads
+		Color                           mCaretColor;     //!< The caret's color
+		Color                           mSelectionColor; //!< The selection highlight's color
+		size_t                          mCaret;          //!< The caret's byte position
+		size_t                          mAnchor;         //!< The selection anchor's byte position
+		float                           mCaretOffset;    //!< The caret's horizontal offset used by the current quads
+		float                           mAnchorOffset;   //!< The anchor's horizontal offset used by the current quads
+		unsigned int                    mCharacterSize;  //!< The character size used by the current quads
+		float                           mBlinkPhase;     //!< The phase of the scene time at which the blink started
+		bool                            mUpdateGeometry; //!< Whether the quads need to be rebuilt
+		mutable std::shared_ptr<Shader> mShader;         //!< The caret shader, resolved from the ae::GLResourceFactory when the overlay is first rendered
+	};
+
+	// Textbox
 	Textbox::Textbox()
 		: Widget()
 		, mText(nullptr)
 		, mPlaceholder(nullptr)
+		, mOverlay(nullptr)
+		, mCaret(0)
+		, mAnchor(0)
 	{		
-		// Attach a text instance to the active state
+		// Attach a text instance to the shape
 		auto text = std::make_unique<Text>();
 		mText = text.get();
-		getState(getActiveState()).attachChild(std::move(text));
+		getShape().attachChild(std::move(text));
 
 		// Set the text's origin to its top center and align it relative to the textbox's top center
 		mText->setOriginFlags(OriginFlag::Left | OriginFlag::CenterY);
 		mText->setRelativeAlignment(OriginFlag::Left | OriginFlag::CenterY, Vector2f(2.f, 0.f));
 		mText->activateFunctionality(Func::Render, Target::Self, false);
 
-		// Attach a placeholder instance to the active state
+		// Attach the caret and selection overlay to the text, it's only displayed while the textbox is focused
+		auto overlay = std::make_unique<Overlay>(*mText);
+		mOverlay = overlay.get();
+		mText->attachChild(std::move(overlay));
+		mOverlay->activateFunctionality(Func::Render, Target::Self, false);
+
+		// Attach a placeholder instance to the shape
 		auto placeholder = std::make_unique<Text>();
 		mPlaceholder = placeholder.get();
-		getState(getActiveState()).attachChild(std::move(placeholder));
+		getShape().attachChild(std::move(placeholder));
 
 		// Set the placeholder's origin to its top center and align it relative to the textbox's top center
 		mPlaceholder->setOriginFlags(OriginFlag::Left | OriginFlag::CenterY);
@@ -63,18 +299,96 @@ namespace ae
 		return *mPlaceholder;
 	}
 
-	void Textbox::enableState(State state)
+	void Textbox::setCaretColor(const Color& color)
+	{
+		mOverlay->setCaretColor(color);
+	}
+
+	void Textbox::setSelectionColor(const Color& color)
+	{
+		mOverlay->setSelectionColor(color);
+	}
+
+	void Textbox::setCaretPosition(size_t index)
+	{
+		moveCaret(index, false);
+	}
+
+	size_t Textbox::getCaretPosition() const noexcept
+	{
+		return mCaret;
+	}
+
+	void Textbox::select(size_t anchor, size_t caret)
+	{
+		mAnchor = clampToBoundary(mText->getText(), anchor);
+		moveCaret(caret, true);
+	}
+
+	std::pair<size_t, size_t> Textbox::getSelection() const noexcept
+	{
+		return std::minmax(mAnchor, mCaret);
+	}
+
+	// Private method(s)
+	void Textbox::moveCaret(size_t index, bool extend)
+	{
+		mCaret = clampToBoundary(mText->getText(), index);
+		if (!extend) {
+			mAnchor = mCaret;
+		}
+		mOverlay->setRange(mCaret, mAnchor);
+	}
+
+	void Textbox::insertText(std::string_view text)
+	{
+		eraseSelection();
+		mText->insert(mCaret, text);
+		moveCaret(mCaret + text.size(), false);
+		updatePlaceholder();
+	}
+
+	bool Textbox::eraseSelection()
+	{
+		const std::pair<size_t, size_t> SELECTION = getSelection();
+		if (SELECTION.first == SELECTION.second) {
+			return false;
+		}
+
+		mText->erase(SELECTION.first, SELECTION.second - SELECTION.first);
+		moveCaret(SELECTION.first, false);
+		updatePlaceholder();
+		return true;
+	}
+
+	void Textbox::updatePlaceholder()
+	{
+		if (mText->getText().empty()) {
+			mText->activateFunctionality(Func::Render, Target::Self, false);
+			mPlaceholder->activateFunctionality(Func::EventHandle | Func::Update | Func::Render, Target::Self, true);
+		}
+		else {
+			mText->activateFunctionality(Func::EventHandle | Func::Update | Func::Render, Target::Self, true);
+			mPlaceholder->activateFunctionality(Func::Render, Target::Self, false);
+		}
+	}
+
+	size_t Textbox::findCaretPosition() const
 	{
-		// Detach the text and placeholder from the currently-active state
-		auto text = getState(getActiveState()).detachChild(*mText);
-		auto placeholder = getState(getActiveState()).detachChild(*mPlaceholder);
+		// Bring the mouse cursor's position into the text's model space
+		const Vector2f WORLD_POS = Application::getInstance().getWindow().mapPixelToCoords(Mouse::getPosition());
+		const Vector4f MODEL_POS = mText->getGlobalTransform().invertAffine() * Vector4f(WORLD_POS.x, WORLD_POS.y, 0.f, 1.f);
+		return mText->findCharacterIndex(MODEL_POS.x);
+	}
 
-		// Activate the new state requested
+	void Textbox::enableState(State state)
+	{
 		Widget::enableState(state);
 
-		// Attach the previously-detached text and placeholder to the active state
-		getState(getActiveState()).attachChild(std::move(text));
-		getState(getActiveState()).attachChild(std::move(placeholder));
+		// Only display the caret while the textbox is focused
+		if (mOverlay) {
+			mOverlay->activateFunctionality(Func::Render, Target::Self, state == State::Click);
+		}
 	}
 
 	void Textbox::updateSelf(const Time& dt)
@@ -83,14 +397,25 @@ namespace ae
 			mText->activateFunctionality(Func::EventHandle | Func::Update | Func::Render, Target::Self, true);
 			mPlaceholder->activateFunctionality(Func::Render, Target::Self, false);
 		}
+
+		// Keep the caret within the text if it was modified directly, and follow its layout
+		const size_t SIZE = mText->getText().size();
+		if (mCaret > SIZE || mAnchor > SIZE) {
+			mAnchor = std::min(mAnchor, SIZE);
+			moveCaret(mCaret, true);
+		}
+		mOverlay->track();
+
 		Widget::updateSelf(dt);
 	}
 
 	void Textbox::handleEventSelf(Event* const event)
 	{
-		// Check if the toggle button has been disabled
+		AEON_MEMORY_SCOPE(MemoryTag::GUI);
+
+		// Check if the toggle button has been disabled or if the event is routed to other widgets
 		const State ACTIVE_STATE = getActiveState();
-		if (ACTIVE_STATE == State::Disabled) {
+		if (ACTIVE_STATE == State::Disabled || !isEventRouted(event)) {
 			return;
 		}
 
@@ -113,42 +438,95 @@ namespace ae
 			if (mouseButtonEvent->button == Mouse::Button::Left) {
 				if (ACTIVE_STATE == State::Hover && !event->handled) {
 					enableState(State::Click);
-					event->handled = true;
+					moveCaret(findCaretPosition(), false);
+					consumeEvent(event);
 				}
 				else if (!isHoveredOver(Mouse::getPosition())) {
 					enableState(State::Idle);
 				}
+				// Move the caret under the mouse cursor, extending the selection if shift is held down
+				else if (ACTIVE_STATE == State::Click && !event->handled) {
+					moveCaret(findCaretPosition(), mouseButtonEvent->shift);
+					consumeEvent(event);
+				}
 			}
 		}
 
 		if (event->type == Event::Type::TextEntered && !event->handled && ACTIVE_STATE == State::Click) {
 			auto textEvent = event->as<TextEvent>();
-			const std::string& currentText = mText->getText();
 			if (getGlobalBounds().max.x > mText->getGlobalBounds().max.x + mText->getAlignmentPadding().x * 2.f) {
-				mText->activateFunctionality(Func::EventHandle | Func::Update | Func::Render, Target::Self, true);
-				mPlaceholder->activateFunctionality(Func::Render, Target::Self, false);
-				mText->setText(currentText + static_cast<char>(textEvent->unicode));
-				event->handled = true;
+				insertText(Text::encodeUTF8(textEvent->unicode));
+				consumeEvent(event);
 			}
 		}
 
 		if (event->type == Event::Type::KeyPressed && !event->handled && ACTIVE_STATE == State::Click) {
 			auto keyEvent = event->as<KeyEvent>();
-			if (keyEvent->key == Keyboard::Key::Backspace) {
-				const std::string& currentText = mText->getText();
-				if (!currentText.empty()) {
-					mText->setText(currentText.substr(0, currentText.size() - 1));
-					if (mText->getText().empty()) {
-						mText->activateFunctionality(Func::Render, Target::Self, false);
-						mPlaceholder->activateFunctionality(Func::EventHandle | Func::Update | Func::Render, Target::Self, true);
+			const std::string& currentText = mText->getText();
+			const std::pair<size_t, size_t> SELECTION = getSelection();
+			const bool SELECTED = SELECTION.first != SELECTION.second;
+
+			switch (keyEvent->key)
+			{
+			case Keyboard::Key::Backspace:
+				// Erase the selection or the preceding character's whole UTF-8 sequence
+				if (!eraseSelection() && mCaret > 0) {
+					const size_t PREVIOUS = getPreviousBoundary(currentText, mCaret);
+					mText->erase(PREVIOUS, mCaret - PREVIOUS);
+					moveCaret(PREVIOUS, false);
+					updatePlaceholder();
+				}
+				consumeEvent(event);
+				break;
+			case Keyboard::Key::Delete:
+				// Erase the selection or the following character's whole UTF-8 sequence
+				if (!eraseSelection() && mCaret < currentText.size()) {
+					mText->erase(mCaret, getNextBoundary(currentText, mCaret) - mCaret);
+					moveCaret(mCaret, false);
+					updatePlaceholder();
+				}
+				consumeEvent(event);
+				break;
+			case Keyboard::Key::Left:
+				moveCaret((SELECTED && !keyEvent->shift) ? SELECTION.first : getPreviousBoundary(currentText, mCaret), keyEvent->shift);
+				consumeEvent(event);
+				break;
+			case Keyboard::Key::Right:
+				moveCaret((SELECTED && !keyEvent->shift) ? SELECTION.second : getNextBoundary(currentText, mCaret), keyEvent->shift);
+				consumeEvent(event);
+				break;
+			case Keyboard::Key::Home:
+				moveCaret(0, keyEvent->shift);
+				consumeEvent(event);
+				break;
+			case Keyboard::Key::End:
+				moveCaret(currentText.size(), keyEvent->shift);
+				consumeEvent(event);
+				break;
+			case Keyboard::Key::A:
+				if (keyEvent->control) {
+					select(0, currentText.size());
+					consumeEvent(event);
+				}
+				break;
+			case Keyboard::Key::C:
+			case Keyboard::Key::X:
+				if (keyEvent->control && SELECTED) {
+					Clipboard::setString(currentText.substr(SELECTION.first, SELECTION.second - SELECTION.first));
+					if (keyEvent->key == Keyboard::Key::X) {
+						eraseSelection();
 					}
-					event->handled = true;
+					consumeEvent(event);
 				}
-			}
-			else if (keyEvent->key == Keyboard::Key::V && keyEvent->control) {
-				const std::string& currentText = mText->getText();
-				mText->setText(currentText + Clipboard::getString());
-				event->handled = true;
+				break;
+			case Keyboard::Key::V:
+				if (keyEvent->control) {
+					insertText(Clipboard::getStringView());
+					consumeEvent(event);
+				}
+				break;
+			default:
+				break;
 			}
 		}
 	}
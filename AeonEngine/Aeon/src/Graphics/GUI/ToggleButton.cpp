@@ -30,10 +30,10 @@ namespace ae
 		: Widget()
 		, mText(nullptr)
 	{
-		// Attach a text instance to the active state
+		// Attach a text instance to the shape
 		auto text = std::make_unique<Text>();
 		mText = text.get();
-		getState(getActiveState()).attachChild(std::move(text));
+		getShape().attachChild(std::move(text));
 
 		// Set the toggle button's origin to its center
 		setOriginFlags(OriginFlag::Center);
@@ -66,23 +66,13 @@ namespace ae
 	}
 
 	// Private virtual method(s)
-	void ToggleButton::enableState(State state)
-	{
-		// Detach the text from the currently-active state
-		auto text = std::move(getState(getActiveState()).detachChild(*mText));
-
-		// Activate the new state requested
-		Widget::enableState(state);
-
-		// Attach the previously-detached text to the active state
-		getState(getActiveState()).attachChild(std::move(text));
-	}
-
 	void ToggleButton::handleEventSelf(Event* const event)
 	{
-		// Check if the toggle button has been disabled
+		AEON_MEMORY_SCOPE(MemoryTag::GUI);
+
+		// Check if the toggle button has been disabled or if the event is routed to other widgets
 		const State ACTIVE_STATE = getActiveState();
-		if (ACTIVE_STATE == State::Disabled) {
+		if (ACTIVE_STATE == State::Disabled || !isEventRouted(event)) {
 			return;
 		}
 
@@ -105,11 +95,11 @@ namespace ae
 			if (mouseButtonEvent->button == Mouse::Button::Left) {
 				if (ACTIVE_STATE == State::Hover) {
 					enableState(State::Click);
-					event->handled = true;
+					consumeEvent(event);
 				}
 				else if (isHoveredOver(Mouse::getPosition())) {
 					enableState(State::Hover);
-					event->handled = true;
+					consumeEvent(event);
 				}
 			}
 		}
@@ -0,0 +1,210 @@
+// MIT License
+// 
+// Copyright(c) 2019-2021 Filippos Gleglakos
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#include <AEON/Graphics/GUI/WidgetIndex.h>
+
+#include <cmath>
+#include <algorithm>
+
+#include <AEON/Window/Application.h>
+#include <AEON/Graphics/Actor2D.h>
+
+namespace ae
+{
+	// Public constructor(s)
+	WidgetIndex::WidgetIndex(float cellSize)
+		: mEntries()
+		, mCells()
+		, mEngaged()
+		, mCandidates()
+		, mRoutedWidget(nullptr)
+		, mCellSize(std::max(cellSize, 1.f))
+		, mNextOrder(0)
+	{
+	}
+
+	// Public method(s)
+	void WidgetIndex::insert(Actor2D& widget, const Box2f& bounds)
+	{
+		// Update the widget if it's already registered
+		if (mEntries.find(&widget) != mEntries.end()) {
+			update(widget, bounds);
+			return;
+		}
+
+		Entry& entry = mEntries[&widget];
+		entry.bounds = bounds;
+		entry.order = mNextOrder++;
+		entry.engaged = false;
+		bin(widget, entry);
+	}
+
+	void WidgetIndex::update(Actor2D& widget, const Box2f& bounds)
+	{
+		const auto FOUND_ITR = mEntries.find(&widget);
+		if (FOUND_ITR == mEntries.end()) {
+			insert(widget, bounds);
+			return;
+		}
+
+		// Only move the widget between the cells if its bounds changed
+		Entry& entry = FOUND_ITR->second;
+		if (entry.bounds == bounds) {
+			return;
+		}
+
+		unbin(widget, entry);
+		entry.bounds = bounds;
+		bin(widget, entry);
+	}
+
+	void WidgetIndex::remove(Actor2D& widget)
+	{
+		const auto FOUND_ITR = mEntries.find(&widget);
+		if (FOUND_ITR == mEntries.end()) {
+			return;
+		}
+
+		unbin(widget, FOUND_ITR->second);
+		mEngaged.erase(std::remove(mEngaged.begin(), mEngaged.end(), &widget), mEngaged.end());
+		mEntries.erase(FOUND_ITR);
+	}
+
+	void WidgetIndex::setEngaged(Actor2D& widget, bool flag)
+	{
+		const auto FOUND_ITR = mEntries.find(&widget);
+		if (FOUND_ITR == mEntries.end() || FOUND_ITR->second.engaged == flag) {
+			return;
+		}
+
+		FOUND_ITR->second.engaged = flag;
+		if (flag) {
+			mEngaged.push_back(&widget);
+		}
+		else {
+			mEngaged.erase(std::remove(mEngaged.begin(), mEngaged.end(), &widget), mEngaged.end());
+		}
+	}
+
+	void WidgetIndex::handleEvent(Event* const event)
+	{
+		if (!isRoutedEvent(*event) || mEntries.empty()) {
+			return;
+		}
+
+		// Retrieve the cursor's position in the application window's world coordinates
+		const Vector2d MOUSE_POS = (event->type == Event::Type::MouseMoved) ? event->as<MouseMoveEvent>()->position : Mouse::getPosition();
+		const Vector2f WORLD_POS = Application::getInstance().getWindow().mapPixelToCoords(MOUSE_POS);
+
+		// Gather the widgets under the cursor and the engaged widgets
+		mCandidates = mEngaged;
+		const auto CELL_ITR = mCells.find(getCellKey(static_cast<int>(std::floor(WORLD_POS.x / mCellSize)), static_cast<int>(std::floor(WORLD_POS.y / mCellSize))));
+		if (CELL_ITR != mCells.end()) {
+			for (Actor2D* const widget : CELL_ITR->second) {
+				const Entry& ENTRY = mEntries.at(widget);
+				if (!ENTRY.engaged && ENTRY.bounds.contains(WORLD_POS)) {
+					mCandidates.push_back(widget);
+				}
+			}
+		}
+
+		// Route the event to the engaged widgets first so that they react to a click elsewhere even if another widget consumes it, then in the widgets' registration order (a widget may unregister others while handling it)
+		std::sort(mCandidates.begin(), mCandidates.end(), [this](Actor2D* const lhs, Actor2D* const rhs) {
+			const Entry& LHS = mEntries.at(lhs);
+			const Entry& RHS = mEntries.at(rhs);
+			return (LHS.engaged != RHS.engaged) ? LHS.engaged : LHS.order < RHS.order;
+		});
+		for (Actor2D* const widget : mCandidates) {
+			if (event->isPropagationStopped()) {
+				break;
+			}
+			if (mEntries.find(widget) != mEntries.end()) {
+				mRoutedWidget = widget;
+				widget->handleEvent(event);
+			}
+		}
+		mRoutedWidget = nullptr;
+	}
+
+	std::pair<bool, Box2f> WidgetIndex::getBounds(const Actor2D& widget) const
+	{
+		const auto FOUND_ITR = mEntries.find(const_cast<Actor2D*>(&widget));
+		if (FOUND_ITR == mEntries.end()) {
+			return std::make_pair(false, Box2f());
+		}
+
+		return std::make_pair(true, FOUND_ITR->second.bounds);
+	}
+
+	bool WidgetIndex::isRouting(const Actor2D& widget) const noexcept
+	{
+		return mRoutedWidget == &widget;
+	}
+
+	// Public static method(s)
+	bool WidgetIndex::isRoutedEvent(const Event& event) noexcept
+	{
+		return event.type == Event::Type::MouseMoved || event.type == Event::Type::MouseButtonPressed || event.type == Event::Type::MouseButtonReleased;
+	}
+
+	// Private method(s)
+	void WidgetIndex::bin(Actor2D& widget, Entry& entry)
+	{
+		const int MIN_X = static_cast<int>(std::floor(std::min(entry.bounds.min.x, entry.bounds.max.x) / mCellSize));
+		const int MIN_Y = static_cast<int>(std::floor(std::min(entry.bounds.min.y, entry.bounds.max.y) / mCellSize));
+		const int MAX_X = static_cast<int>(std::floor(std::max(entry.bounds.min.x, entry.bounds.max.x) / mCellSize));
+		const int MAX_Y = static_cast<int>(std::floor(std::max(entry.bounds.min.y, entry.bounds.max.y) / mCellSize));
+
+		entry.cells.clear();
+		for (int y = MIN_Y; y <= MAX_Y; ++y) {
+			for (int x = MIN_X; x <= MAX_X; ++x) {
+				const int64_t KEY = getCellKey(x, y);
+				mCells[KEY].push_back(&widget);
+				entry.cells.push_back(KEY);
+			}
+		}
+	}
+
+	void WidgetIndex::unbin(Actor2D& widget, Entry& entry)
+	{
+		for (const int64_t KEY : entry.cells) {
+			const auto CELL_ITR = mCells.find(KEY);
+			if (CELL_ITR == mCells.end()) {
+				continue;
+			}
+
+			std::vector<Actor2D*>& cell = CELL_ITR->second;
+			cell.erase(std::remove(cell.begin(), cell.end(), &widget), cell.end());
+			if (cell.empty()) {
+				mCells.erase(CELL_ITR);
+			}
+		}
+		entry.cells.clear();
+	}
+
+	// Private static method(s)
+	int64_t WidgetIndex::getCellKey(int x, int y) noexcept
+	{
+		return (static_cast<int64_t>(x) << 32) | static_cast<uint32_t>(y);
+	}
+}
\ No newline at end of file
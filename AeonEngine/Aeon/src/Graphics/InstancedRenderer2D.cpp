@@ -0,0 +1,366 @@
+// MIT License
+// 
+// Copyright(c) 2019-2021 Filippos Gleglakos
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#include <AEON/Graphics/InstancedRenderer2D.h>
+
+#include <algorithm>
+#include <cstring>
+
+#include <GL/glew.h>
+
+#include <AEON/System/Profiler.h>
+#include <AEON/Math/Transform2D.h>
+#include <AEON/Graphics/internal/GLCommon.h>
+#include <AEON/Graphics/internal/RenderTarget.h>
+#include <AEON/Graphics/internal/VertexArray.h>
+#include <AEON/Graphics/internal/VertexBuffer.h>
+#include <AEON/Graphics/internal/IndexBuffer.h>
+#include <AEON/Graphics/GLResourceFactory.h>
+#include <AEON/Graphics/GPUProfiler.h>
+#include <AEON/Graphics/RenderStates.h>
+#include <AEON/Graphics/Renderable2D.h>
+#include <AEON/Graphics/Shader.h>
+#include <AEON/Graphics/Texture2D.h>
+
+namespace ae
+{
+	namespace
+	{
+		// The number of instances held by each region of the ring
+		constexpr int RING_INSTANCE_CAPACITY = 16384;
+		// The number of regions of the ring
+		constexpr unsigned int RING_REGION_COUNT = 3;
+		// The number of instances culled by each work group of the culling shader, each group writing its own drawing command
+		constexpr int CULL_GROUP_SIZE = 256;
+
+		// The drawing command written by the culling shader for each work group (DrawElementsIndirectCommand)
+		struct DrawCommand
+		{
+			GLuint count;
+			GLuint instanceCount;
+			GLuint firstIndex;
+			GLint  baseVertex;
+			GLuint baseInstance;
+		};
+	}
+
+	// Public virtual method(s)
+	void InstancedRenderer2D::beginScene(RenderTarget& target)
+	{
+		// Assign the new render target and uploads its camera's properties (the scene is only recorded if the calling thread is recording)
+		Renderer2D::beginScene(target);
+		if (isRecording()) {
+			return;
+		}
+
+		// Enable depth-testing and activate the render target
+		gl::setCapability(GL_DEPTH_TEST, true);
+		mRenderTarget->activate();
+	}
+
+	void InstancedRenderer2D::endScene()
+	{
+		// Only record the scene's termination if the calling thread is recording
+		if (isRecording()) {
+			Renderer2D::endScene();
+			return;
+		}
+		markSceneEnd();
+
+		// The clipped submissions were rendered immediately, so the instances are never clipped
+		mInstanceVAO->bind();
+		gl::setScissor(0, 0, 0, 0);
+		if (mGPUCulling) {
+			prepareGPUCulling();
+		}
+
+		// Render opaque quads front-to-back
+		Profiler& profiler = Profiler::getInstance();
+		GPUProfiler& gpuProfiler = GPUProfiler::getInstance();
+		profiler.beginScope("InstancedRenderer2D opaque flush");
+		gpuProfiler.beginScope("InstancedRenderer2D opaque flush");
+		flush(mOpaqueCalls, true);
+		gpuProfiler.endScope();
+		profiler.endScope();
+
+		// Render transparent quads back-to-front
+		profiler.beginScope("InstancedRenderer2D transparent flush");
+		gpuProfiler.beginScope("InstancedRenderer2D transparent flush");
+		flush(mTransparentCalls, false);
+		gpuProfiler.endScope();
+		profiler.endScope();
+
+		// Fence the ring's current region so that it's not overwritten while OpenGL is still reading from it
+		mInstanceRing.lock();
+		if (mGPUCulling) {
+			mInstanceVAO->attachVBO(1, nullptr);
+			mCommandBuffer->unbind();
+		}
+		mInstanceVAO->unbind();
+
+		// Unbind the VAO, disable depth-testing and invalidate scene-specific pointers
+		Renderer2D::endScene();
+	}
+
+	void InstancedRenderer2D::submit(const Vertex2DList& vertices, const std::vector<unsigned int>& indices, const RenderStates& states)
+	{
+		// Check if the shader provided is valid (ignored in Release mode)
+		if _CONSTEXPR_IF (AEON_DEBUG) {
+			if (!states.shader) {
+				AEON_LOG_WARNING("Null shader", "The shader provided is null.\nAborting rendering.");
+				return;
+			}
+		}
+
+		++mStatistics.submissions;
+
+		// Render the submission immediately if its shader has no instanced counterpart, if it isn't a quad or if it's clipped
+		auto shaderItr = mInstanceShaders.find(states.shader);
+		InstanceData instance;
+		const bool CLIPPED = states.clipRect.z > 0 && states.clipRect.w > 0;
+		if (CLIPPED || shaderItr == mInstanceShaders.end() || !extractInstance(vertices, indices, states.transform, instance)) {
+			drawGeometry(vertices, indices, states);
+			return;
+		}
+
+		// Add the instance to the appropriate pass
+		ShaderPasses& drawcalls = isTransparent(vertices, states) ? mTransparentCalls : mOpaqueCalls;
+		const Texture* const texture = (!states.texture) ? mWhiteTexture.get() : states.texture;
+		drawcalls[shaderItr->second][states.blendMode][std::make_pair(texture, states.sampler)].push_back(instance);
+	}
+
+	// Public method(s)
+	void InstancedRenderer2D::setGPUCulling(bool enabled) noexcept
+	{
+		mGPUCulling = enabled;
+	}
+
+	bool InstancedRenderer2D::hasGPUCulling() const noexcept
+	{
+		return mGPUCulling;
+	}
+
+	// Public static method(s)
+	InstancedRenderer2D& InstancedRenderer2D::getInstance()
+	{
+		static InstancedRenderer2D instance;
+		return instance;
+	}
+
+	// Private constructor(s)
+	InstancedRenderer2D::InstancedRenderer2D()
+		: Renderer2D()
+		, mOpaqueCalls()
+		, mTransparentCalls()
+		, mInstanceVAO(GLResourceFactory::getInstance().get<VertexArray>("_AEON_InstancedVAO"))
+		, mInstanceRing()
+		, mInstanceShaders()
+		, mVertexScratch()
+		, mCullShader(GLResourceFactory::getInstance().get<Shader>("_AEON_InstanceCull2D"))
+		, mCulledInstances(nullptr)
+		, mCommandBuffer(nullptr)
+		, mGPUCulling(false)
+	{
+		// Create the ring buffer
+		mInstanceRing.create(*mInstanceVAO->getVBO(1), static_cast<int>(sizeof(InstanceData)) * RING_INSTANCE_CAPACITY, RING_REGION_COUNT);
+
+		// Associate the built-in shaders with their instanced counterparts
+		GLResourceFactory& glResourceFactory = GLResourceFactory::getInstance();
+		mInstanceShaders.emplace(glResourceFactory.get<Shader>("_AEON_Basic2D").get(), glResourceFactory.get<Shader>("_AEON_InstancedBasic2D").get());
+	}
+
+	// Private method(s)
+	void InstancedRenderer2D::flush(ShaderPasses& drawcalls, bool frontToBack)
+	{
+		auto compare = [frontToBack](const InstanceData& instance1, const InstanceData& instance2) {
+			return (frontToBack) ? instance1.depth > instance2.depth : instance1.depth < instance2.depth;
+		};
+
+		for (auto& shaderPass : drawcalls)
+		{
+			// Bind the shader
+			const Shader& shader = *shaderPass.first;
+			shader.bind();
+
+			for (auto& blendPass : shaderPass.second)
+			{
+				// Set the appropriate blending
+				applyBlendMode(blendPass.first);
+
+				for (auto texturePass = blendPass.second.begin(); texturePass != blendPass.second.end();)
+				{
+					// Delete the texture pass if it didn't receive any instances this frame
+					std::vector<InstanceData>& instances = texturePass->second;
+					if (instances.empty()) {
+						texturePass = blendPass.second.erase(texturePass);
+						continue;
+					}
+
+					// Sort the instances (the equal ones keep their relative order to avoid flickering)
+					std::stable_sort(instances.begin(), instances.end(), compare);
+
+					// Bind the texture and its sampler (the state cache ignores redundant binds) and render the instances
+					bindTexture(texturePass->first.first, texturePass->first.second);
+					drawInstances(instances, shader);
+
+					// Clear the instances while keeping their memory for the next frame
+					instances.clear();
+					++texturePass;
+				}
+			}
+		}
+	}
+
+	void InstancedRenderer2D::drawInstances(const std::vector<InstanceData>& instances, const Shader& shader)
+	{
+		const int INSTANCE_SIZE = static_cast<int>(sizeof(InstanceData));
+		const size_t CAPACITY = static_cast<size_t>(mInstanceRing.getRegionSize() / INSTANCE_SIZE);
+
+		// The culled instances start at the beginning of a culling group so that each group of the ring owns a single drawing command
+		const int ALIGNMENT = (mGPUCulling) ? INSTANCE_SIZE * CULL_GROUP_SIZE : INSTANCE_SIZE;
+
+		for (size_t first = 0, count = 0; first < instances.size(); first += count)
+		{
+			// Reserve the memory in the ring's current region, moving on to the next region if the current one is full
+			count = std::min(instances.size() - first, CAPACITY);
+			const int SIZE = INSTANCE_SIZE * static_cast<int>(count);
+			int offset = 0;
+			void* data = mInstanceRing.allocate(SIZE, offset, ALIGNMENT);
+			if (!data) {
+				mInstanceRing.lock();
+				data = mInstanceRing.allocate(SIZE, offset, ALIGNMENT);
+				if (!data) {
+					return;
+				}
+			}
+
+			// Write the instances directly into the mapped memory
+			std::memcpy(data, instances.data() + first, SIZE);
+			const GLuint FIRST_INSTANCE = static_cast<GLuint>(offset / INSTANCE_SIZE);
+			if (!mGPUCulling) {
+				// Render the instances, the base instance locating them within the ring
+				GLCall(glDrawElementsInstancedBaseInstance(GL_TRIANGLES, 6, GL_UNSIGNED_INT, nullptr, static_cast<GLsizei>(count), FIRST_INSTANCE));
+				recordDrawCall(count, 0, SIZE);
+				continue;
+			}
+
+			// Cull and compact the instances, then make the culling shader's writes visible to the vertex fetches and the indirect drawcall
+			const GLsizei GROUP_COUNT = static_cast<GLsizei>((count + CULL_GROUP_SIZE - 1) / CULL_GROUP_SIZE);
+			mCullShader->setUniform("uFirstInstance", static_cast<unsigned int>(FIRST_INSTANCE));
+			mCullShader->setUniform("uInstanceCount", static_cast<unsigned int>(count));
+			mCullShader->dispatch(static_cast<unsigned int>(GROUP_COUNT));
+			GLCall(glMemoryBarrier(GL_VERTEX_ATTRIB_ARRAY_BARRIER_BIT | GL_COMMAND_BARRIER_BIT));
+
+			// Render the visible instances of each group with their drawing command, the CPU never reading back how many are visible
+			shader.bind();
+			const intptr_t COMMAND_OFFSET = static_cast<intptr_t>(FIRST_INSTANCE / CULL_GROUP_SIZE) * static_cast<intptr_t>(sizeof(DrawCommand));
+			GLCall(glMultiDrawElementsIndirect(GL_TRIANGLES, GL_UNSIGNED_INT, reinterpret_cast<const void*>(COMMAND_OFFSET), GROUP_COUNT, 0));
+			recordDrawCall(count, 0, SIZE);
+		}
+	}
+
+	void InstancedRenderer2D::prepareGPUCulling()
+	{
+		// Create the culled instances and the drawing commands of the entire ring, so that each region's culled data is fenced along with it
+		if (!mCulledInstances) {
+			const int RING_SIZE = mInstanceRing.getRegionSize() * static_cast<int>(RING_REGION_COUNT);
+			mCulledInstances = std::make_unique<VertexBuffer>(GL_DYNAMIC_COPY);
+			mCulledInstances->setData(RING_SIZE, nullptr);
+
+			mCommandBuffer = std::make_unique<Buffer>(GL_DRAW_INDIRECT_BUFFER);
+			mCommandBuffer->setStorage(RING_SIZE / static_cast<int>(sizeof(InstanceData)) / CULL_GROUP_SIZE * static_cast<int>(sizeof(DrawCommand)), nullptr, 0);
+		}
+
+		// Bind the buffers to the culling shader's binding points (reserved for the built-in renderers), and source the instances from the culled ones
+		GLCall(glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 1, mInstanceVAO->getVBO(1)->getHandle()));
+		GLCall(glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 2, mCulledInstances->getHandle()));
+		GLCall(glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 3, mCommandBuffer->getHandle()));
+		mInstanceVAO->attachVBO(1, mCulledInstances.get());
+		mCommandBuffer->bind();
+	}
+
+	void InstancedRenderer2D::drawGeometry(const Vertex2DList& vertices, const std::vector<unsigned int>& indices, const RenderStates& states)
+	{
+		// Bind the shader provided, set the appropriate blending and restrict the drawcall to the clip rect
+		states.shader->bind();
+		applyBlendMode(states.blendMode);
+		gl::setScissor(states.clipRect.x, states.clipRect.y, states.clipRect.z, states.clipRect.w);
+
+		// Bind the texture provided or the 1x1 white texture for untextured geometry, alongside its sampler
+		bindTexture(states.texture, states.sampler);
+
+		// Apply the transform to the vertices
+		mVertexScratch.resize(vertices.size());
+		Math::transformPoints2D(states.transform, vertices.data(), mVertexScratch.data(), vertices.size());
+
+		// Upload the vertices and indices, and render the geometry
+		mVAO->bind();
+
+		VertexBuffer* const vbo = mVAO->getVBO(0);
+		vbo->setData(static_cast<int>(sizeof(Vertex2D) * mVertexScratch.size()), mVertexScratch.data());
+
+		IndexBuffer* const ibo = mVAO->getIBO();
+		ibo->setData(sizeof(GLuint) * indices.size(), indices.data());
+
+		GLCall(glDrawElements(GL_TRIANGLES, ibo->getCount(), GL_UNSIGNED_INT, nullptr));
+		recordDrawCall(vertices.size(), indices.size(), sizeof(Vertex2D) * vertices.size() + sizeof(GLuint) * indices.size());
+	}
+
+	bool InstancedRenderer2D::extractInstance(const Vertex2DList& vertices, const std::vector<unsigned int>& indices, const Matrix4f& transform, InstanceData& instance) const
+	{
+		// Check if the geometry is a quad whose triangles are laid out like the unit quad's
+		static const unsigned int QUAD_INDICES[6] = { 0, 1, 2, 0, 2, 3 };
+		if (vertices.size() != 4 || indices.size() != 6 || !std::equal(indices.begin(), indices.end(), QUAD_INDICES)) {
+			return false;
+		}
+
+		// Check if the quad is a parallelogram sharing a single color and depth, and whose texture coordinates form a rectangle
+		const Vertex2D& v0 = vertices[0];
+		const Vertex2D& v1 = vertices[1];
+		const Vertex2D& v2 = vertices[2];
+		const Vertex2D& v3 = vertices[3];
+		if (v0.color != v1.color || v0.color != v2.color || v0.color != v3.color
+		 || v0.position.z != v1.position.z || v0.position.z != v2.position.z || v0.position.z != v3.position.z
+		 || v2.position.xy - v1.position.xy != v3.position.xy - v0.position.xy
+		 || v1.uv != Vector2f(v0.uv.x, v2.uv.y) || v3.uv != Vector2f(v2.uv.x, v0.uv.y))
+		{
+			return false;
+		}
+
+		// Transform the quad's corners and store its edges
+		const Vector2f ORIGIN = (transform * Vector3f(v0.position.xy)).xy;
+		instance.axisX = (transform * Vector3f(v3.position.xy)).xy - ORIGIN;
+		instance.axisY = (transform * Vector3f(v1.position.xy)).xy - ORIGIN;
+		instance.origin = ORIGIN;
+
+		// Store the texture rectangle, the color as normalized bytes and the depth
+		instance.uvMin = v0.uv;
+		instance.uvMax = v2.uv;
+		for (int i = 0; i < 4; ++i) {
+			instance.color[i] = static_cast<uint8_t>(std::clamp(v0.color.elements[i], 0.f, 1.f) * 255.f + 0.5f);
+		}
+		instance.depth = v0.position.z;
+
+		return true;
+	}
+}
\ No newline at end of file
@@ -0,0 +1,179 @@
+// MIT License
+// 
+// Copyright(c) 2019-2021 Filippos Gleglakos
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <AEON/Graphics/LightRenderer2D.h>
+
+#include <GL/glew.h>
+
+#include <algorithm>
+#include <cmath>
+
+#include <AEON/System/Profiler.h>
+#include <AEON/Graphics/Camera.h>
+#include <AEON/Graphics/GPUProfiler.h>
+#include <AEON/Graphics/GLResourceFactory.h>
+#include <AEON/Graphics/RenderTexture.h>
+#include <AEON/Graphics/internal/GLCommon.h>
+#include <AEON/Graphics/internal/RenderTarget.h>
+
+namespace ae
+{
+	// Public method(s)
+	void LightRenderer2D::beginScene(RenderTarget& target)
+	{
+		// Check that the previous scene was ended (ignored in Release mode)
+		if _CONSTEXPR_IF (AEON_DEBUG) {
+			if (mRenderTarget) {
+				AEON_LOG_WARNING("Attempt to begin a new light scene", "The previous light scene wasn't ended, its lights are discarded.");
+			}
+		}
+
+		mRenderTarget = &target;
+		mLights.clear();
+	}
+
+	void LightRenderer2D::submit(const Vector2f& position, float radius, const Color& color, float intensity)
+	{
+		// Check that a scene has begun (ignored in Release mode)
+		if _CONSTEXPR_IF (AEON_DEBUG) {
+			if (!mRenderTarget) {
+				AEON_LOG_WARNING("Light submitted outside of a scene", "The light renderer's beginScene() must be called before submitting lights.\nAborting operation.");
+				return;
+			}
+		}
+
+		const Vector4f COLOR = color.normalize();
+		mLights.push_back(LightData{ position, radius, Vector4f(COLOR.x, COLOR.y, COLOR.z, COLOR.w * intensity) });
+	}
+
+	void LightRenderer2D::endScene()
+	{
+		if (!mRenderTarget) {
+			return;
+		}
+
+		AEON_PROFILE_SCOPE("LightRenderer2D::endScene");
+		AEON_PROFILE_GPU_SCOPE("LightRenderer2D");
+		RenderTarget& target = *mRenderTarget;
+		mRenderTarget = nullptr;
+		mLightCount = mLights.size();
+
+		// Skip the lighting while the target is minimized
+		const Vector2i& TARGET_SIZE = target.getFramebufferSize();
+		if (TARGET_SIZE.x <= 0 || TARGET_SIZE.y <= 0) {
+			mLights.clear();
+			return;
+		}
+
+		// Resize the light buffer along with the target, its attachments being borrowed from the render target pool
+		const Vector2i SIZE(std::max(static_cast<int>(std::round(TARGET_SIZE.x * mResolutionScale)), 1),
+		                    std::max(static_cast<int>(std::round(TARGET_SIZE.y * mResolutionScale)), 1));
+		if (!mLightBuffer) {
+			mLightBuffer = std::make_unique<RenderTexture>();
+			mLightBuffer->setLoadAction(RenderTexture::LoadAction::Clear);
+			mLightBuffer->setStoreActions(RenderTexture::StoreAction::Store, RenderTexture::StoreAction::DontCare);
+		}
+		if (mLightBuffer->getFramebufferSize() != SIZE) {
+			mLightBuffer->create(static_cast<unsigned int>(SIZE.x), static_cast<unsigned int>(SIZE.y));
+		}
+
+		// Accumulate every light additively over the ambient light in a single instanced drawcall
+		gl::setCapability(GL_DEPTH_TEST, false);
+		gl::setScissor(0, 0, 0, 0);
+		mLightBuffer->setClearColor(mAmbientColor);
+		mLightBuffer->activate();
+		if (!mLights.empty()) {
+			Camera* const camera = target.getCamera();
+			const Matrix4f VIEW_PROJECTION = camera->getProjectionMatrix() * camera->getViewMatrix();
+
+			mLightVAO->getVBO(1)->setData(static_cast<int>(sizeof(LightData) * mLights.size()), mLights.data());
+			gl::setCapability(GL_BLEND, true);
+			gl::setBlendFunction(GL_FUNC_ADD, GL_FUNC_ADD, GL_ONE, GL_ONE, GL_ONE, GL_ONE);
+			mLightShader->bind();
+			mLightShader->setUniform("uViewProjection", VIEW_PROJECTION);
+			mLightVAO->bind();
+			GLCall(glDrawElementsInstanced(GL_TRIANGLES, 6, GL_UNSIGNED_INT, nullptr, static_cast<GLsizei>(mLights.size())));
+		}
+		mLightBuffer->storeContents();
+		mLights.clear();
+
+		// Multiply the scene's colors by the upscaled light buffer, the scene's contents being kept
+		GLResourceFactory& glResourceFactory = GLResourceFactory::getInstance();
+		target.activate(false);
+		gl::setCapability(GL_BLEND, true);
+		gl::setBlendFunction(GL_FUNC_ADD, GL_FUNC_ADD, GL_DST_COLOR, GL_ZERO, GL_ZERO, GL_ONE);
+		mCompositeShader->bind();
+		gl::bindTextureUnit(0, mLightBuffer->getTexture()->getHandle());
+		gl::bindSampler(0, glResourceFactory.getSampler(Texture::Filter::Linear, Texture::Wrap::ClampToEdge).getHandle());
+		glResourceFactory.get<VertexArray>("_AEON_EmptyVAO")->bind();
+		GLCall(glDrawArrays(GL_TRIANGLES, 0, 3));
+		target.storeContents();
+	}
+
+	void LightRenderer2D::setResolutionScale(float scale) noexcept
+	{
+		mResolutionScale = std::clamp(scale, 0.01f, 1.f);
+	}
+
+	void LightRenderer2D::setAmbientColor(const Color& color)
+	{
+		mAmbientColor = color;
+	}
+
+	float LightRenderer2D::getResolutionScale() const noexcept
+	{
+		return mResolutionScale;
+	}
+
+	const Color& LightRenderer2D::getAmbientColor() const noexcept
+	{
+		return mAmbientColor;
+	}
+
+	size_t LightRenderer2D::getLightCount() const noexcept
+	{
+		return mLightCount;
+	}
+
+	// Public static method(s)
+	LightRenderer2D& LightRenderer2D::getInstance()
+	{
+		static LightRenderer2D instance;
+		return instance;
+	}
+
+	// Private constructor(s)
+	LightRenderer2D::LightRenderer2D()
+		: mLights()
+		, mLightBuffer(nullptr)
+		, mLightShader(GLResourceFactory::getInstance().get<Shader>("_AEON_Light2D"))
+		, mCompositeShader(GLResourceFactory::getInstance().get<Shader>("_AEON_LightComposite2D"))
+		, mLightVAO(GLResourceFactory::getInstance().get<VertexArray>("_AEON_LightVAO"))
+		, mRenderTarget(nullptr)
+		, mAmbientColor(Color::Black)
+		, mResolutionScale(0.5f)
+		, mLightCount(0)
+	{
+	}
+
+	LightRenderer2D::~LightRenderer2D() = default;
+}
\ No newline at end of file
@@ -22,8 +22,10 @@
 
 #include <AEON/Graphics/Material.h>
 
-#include <AEON/Graphics/GLResourceFactory.h>
-#include <AEON/Graphics/internal/UniformBuffer.h>
+#include <cstring>
+
+#include <AEON/Graphics/MaterialLibrary.h>
+#include <AEON/Graphics/Texture.h>
 
 namespace ae
 {
@@ -32,16 +34,101 @@ namespace ae
 		: mName(name)
 		, mTextures()
 		, mShader(shader)
-		, mUBO(GLResourceFactory::getInstance().create<UniformBuffer>(name))
+		, mIDHandle(shader->getUniformHandle("uMaterialID"))
+		, mID(MaterialLibrary::getInstance().allocate())
+	{
+		// Give the shader access to the materials' parameters
+		MaterialLibrary::getInstance().attach(*mShader);
+	}
+
+	Material::~Material()
 	{
-		// Retrieve the UBO's uniform information
-		mUBO->queryLayout(*shader, "uMaterialBlock", { "ambient", "diffuse", "specular", "shininess" });
+		MaterialLibrary::getInstance().release(mID);
 	}
 
 	// Public method(s)
 	void Material::setUniform(const std::string& name, const void* data, size_t size)
 	{
-		mUBO->queueUniformUpload(name, data, size);
+		// Copy the data into the matching parameter
+		MaterialLibrary& library = MaterialLibrary::getInstance();
+		MaterialLibrary::MaterialData materialData = library.getData(mID);
+		void* destination = nullptr;
+		if (name == "ambient") {
+			destination = &materialData.ambient;
+		}
+		else if (name == "diffuse") {
+			destination = &materialData.diffuse;
+		}
+		else if (name == "specular") {
+			destination = &materialData.specular;
+		}
+		else if (name == "shininess") {
+			destination = &materialData.shininess;
+		}
+
+		// Check that the uniform exists and that the data fits (ignored in Release mode)
+		if _CONSTEXPR_IF (AEON_DEBUG) {
+			if (!destination || size > ((name == "shininess") ? sizeof(float) : sizeof(Vector3f))) {
+				AEON_LOG_ERROR("Invalid material uniform", "The material doesn't possess a uniform \"" + name + "\" of this size.\nAborting operation.");
+				return;
+			}
+		}
+
+		if (destination) {
+			std::memcpy(destination, data, size);
+			library.setData(mID, materialData);
+		}
+	}
+
+	void Material::setAmbient(const Vector3f& ambient)
+	{
+		MaterialLibrary& library = MaterialLibrary::getInstance();
+		MaterialLibrary::MaterialData materialData = library.getData(mID);
+		materialData.ambient = ambient;
+		library.setData(mID, materialData);
+	}
+
+	void Material::setDiffuse(const Vector3f& diffuse)
+	{
+		MaterialLibrary& library = MaterialLibrary::getInstance();
+		MaterialLibrary::MaterialData materialData = library.getData(mID);
+		materialData.diffuse = diffuse;
+		library.setData(mID, materialData);
+	}
+
+	void Material::setSpecular(const Vector3f& specular)
+	{
+		MaterialLibrary& library = MaterialLibrary::getInstance();
+		MaterialLibrary::MaterialData materialData = library.getData(mID);
+		materialData.specular = specular;
+		library.setData(mID, materialData);
+	}
+
+	void Material::setShininess(float shininess)
+	{
+		MaterialLibrary& library = MaterialLibrary::getInstance();
+		MaterialLibrary::MaterialData materialData = library.getData(mID);
+		materialData.shininess = shininess;
+		library.setData(mID, materialData);
+	}
+
+	void Material::setTexture(const std::shared_ptr<Texture>& texture)
+	{
+		mTextures.push_back(texture);
+	}
+
+	void Material::bind()
+	{
+		// Upload the materials' modified parameters
+		MaterialLibrary::getInstance().upload();
+
+		// Bind the shader (the state cache ignores redundant binds) and select the material's parameters
+		mShader->bind();
+		mShader->setUniform(mIDHandle, static_cast<unsigned int>(mID));
+
+		for (size_t i = 0; i < mTextures.size(); ++i) {
+			mTextures[i]->bind(static_cast<int>(i));
+		}
 	}
 
 	const std::string& Material::getName() const noexcept
@@ -53,4 +140,14 @@ namespace ae
 	{
 		return *mShader;
 	}
+
+	uint16_t Material::getID() const noexcept
+	{
+		return mID;
+	}
+
+	uint32_t Material::getSortKey() const noexcept
+	{
+		return ((mShader->getID() & 0xffffu) << 16) | mID;
+	}
 }
\ No newline at end of file
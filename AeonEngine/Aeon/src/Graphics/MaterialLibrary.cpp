@@ -0,0 +1,136 @@
+// MIT License
+// 
+// Copyright(c) 2019-2021 Filippos Gleglakos
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+
+#include <AEON/Graphics/MaterialLibrary.h>
+
+#include <algorithm>
+#include <limits>
+
+#include <AEON/Graphics/internal/ShaderStorageBuffer.h>
+#include <AEON/Graphics/GLResourceFactory.h>
+#include <AEON/Graphics/Shader.h>
+
+namespace ae
+{
+	static_assert(sizeof(MaterialLibrary::MaterialData) == 48, "The material data must match the shaders' std430 layout.");
+
+	// Public method(s)
+	uint16_t MaterialLibrary::allocate()
+	{
+		// Reuse the most recently released ID
+		if (!mFreeIDs.empty()) {
+			const uint16_t ID = mFreeIDs.back();
+			mFreeIDs.pop_back();
+			return ID;
+		}
+
+		// Check that a new ID is available (ignored in Release mode)
+		if _CONSTEXPR_IF (AEON_DEBUG) {
+			if (mMaterials.size() > std::numeric_limits<uint16_t>::max()) {
+				AEON_LOG_ERROR("Material limit reached", "No more than 65536 materials may exist at once.\nThe last material's ID will be shared.");
+				return std::numeric_limits<uint16_t>::max();
+			}
+		}
+
+		mMaterials.emplace_back(MaterialData{ Vector3f(0.f), 0.f, Vector3f(0.f), 0.f, Vector3f(0.f), 0.f });
+		return static_cast<uint16_t>(mMaterials.size() - 1);
+	}
+
+	void MaterialLibrary::release(uint16_t id)
+	{
+		mFreeIDs.push_back(id);
+	}
+
+	void MaterialLibrary::setData(uint16_t id, const MaterialData& data)
+	{
+		// Check that the material exists (ignored in Release mode)
+		if _CONSTEXPR_IF (AEON_DEBUG) {
+			if (id >= mMaterials.size()) {
+				AEON_LOG_ERROR("Invalid material ID", "The material " + std::to_string(id) + " wasn't allocated.\nAborting operation.");
+				return;
+			}
+		}
+
+		// Copy the parameters and extend the modified range
+		mMaterials[id] = data;
+		const size_t BEGIN = id, END = BEGIN + 1;
+		if (mDirtyBegin == mDirtyEnd) {
+			mDirtyBegin = BEGIN;
+			mDirtyEnd = END;
+		}
+		else {
+			mDirtyBegin = std::min(mDirtyBegin, BEGIN);
+			mDirtyEnd = std::max(mDirtyEnd, END);
+		}
+	}
+
+	const MaterialLibrary::MaterialData& MaterialLibrary::getData(uint16_t id) const
+	{
+		return mMaterials[id];
+	}
+
+	void MaterialLibrary::upload()
+	{
+		// Grow the buffer if materials were allocated beyond its size (every material is then uploaded as the new data store is created)
+		const int SIZE = static_cast<int>(mMaterials.size() * sizeof(MaterialData));
+		if (SIZE > mBuffer->getSize()) {
+			mBuffer->setData(SIZE, mMaterials.data());
+			mDirtyBegin = mDirtyEnd = 0;
+			return;
+		}
+
+		// Upload the modified range of materials in a single call
+		if (mDirtyBegin != mDirtyEnd) {
+			mBuffer->setSubData(static_cast<int>(mDirtyBegin * sizeof(MaterialData)), static_cast<int>((mDirtyEnd - mDirtyBegin) * sizeof(MaterialData)), mMaterials.data() + mDirtyBegin);
+			mDirtyBegin = mDirtyEnd = 0;
+		}
+	}
+
+	void MaterialLibrary::attach(Shader& shader) const
+	{
+		shader.addStorageBuffer(*mBuffer, "uMaterialBuffer");
+	}
+
+	size_t MaterialLibrary::getCapacity() const noexcept
+	{
+		return mMaterials.size();
+	}
+
+	// Public static method(s)
+	MaterialLibrary& MaterialLibrary::getInstance()
+	{
+		static MaterialLibrary instance;
+		return instance;
+	}
+
+	// Private constructor(s)
+	MaterialLibrary::MaterialLibrary()
+		: mMaterials()
+		, mFreeIDs()
+		, mBuffer(GLResourceFactory::getInstance().create<ShaderStorageBuffer>("_AEON_MaterialBuffer"))
+		, mDirtyBegin(0)
+		, mDirtyEnd(0)
+	{
+	}
+}
\ No newline at end of file
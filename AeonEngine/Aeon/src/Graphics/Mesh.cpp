@@ -0,0 +1,365 @@
+// MIT License
+// 
+// Copyright(c) 2019-2021 Filippos Gleglakos
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <AEON/Graphics/Mesh.h>
+
+#include <atomic>
+#include <cstring>
+#include <fstream>
+
+#include <GL/glew.h>
+
+#include <AEON/System/FileSystem.h>
+#include <AEON/Graphics/internal/VertexBuffer.h>
+#include <AEON/Graphics/internal/IndexBuffer.h>
+
+namespace ae
+{
+	namespace
+	{
+		// The ID assigned to the next mesh created (0 is never assigned)
+		std::atomic<uint32_t> nextID(1);
+
+		// The identifier and version of the binary mesh files
+		// Layout: identifier, version, vertex stride, attribute count, vertex count, index size, index count, submesh count, bounds
+		//         | attributes (type, count, normalized) | submeshes (first index, index count, bounds) | vertices | indices
+		constexpr char     MESH_IDENTIFIER[4] = { 'A', 'E', 'M', 'S' };
+		constexpr uint32_t MESH_VERSION = 1;
+		constexpr size_t   HEADER_SIZE = sizeof(MESH_IDENTIFIER) + sizeof(uint32_t) * 7 + sizeof(float) * 6;
+		constexpr size_t   ATTRIBUTE_SIZE = sizeof(uint32_t) * 3;
+		constexpr size_t   SUBMESH_SIZE = sizeof(uint32_t) * 2 + sizeof(float) * 6;
+
+		// Append a little-endian value to the mesh file's contents
+		template <typename T>
+		void appendValue(std::string& contents, T value)
+		{
+			contents.append(reinterpret_cast<const char*>(&value), sizeof(T));
+		}
+
+		// Append a box's position and size to the mesh file's contents
+		void appendBox(std::string& contents, const Box3f& box)
+		{
+			for (size_t i = 0; i < 3; ++i) {
+				appendValue<float>(contents, box.position[i]);
+			}
+			for (size_t i = 0; i < 3; ++i) {
+				appendValue<float>(contents, box.size[i]);
+			}
+		}
+
+		// Read a little-endian value from the mesh file's data (the offset is assumed to be within bounds)
+		template <typename T>
+		T readValue(const uint8_t* data, size_t offset) noexcept
+		{
+			T value = 0;
+			std::memcpy(&value, data + offset, sizeof(T));
+			return value;
+		}
+
+		// Read a box's position and size from the mesh file's data (the offset is assumed to be within bounds)
+		Box3f readBox(const uint8_t* data, size_t offset) noexcept
+		{
+			Box3f box;
+			for (size_t i = 0; i < 3; ++i) {
+				box.position[i] = readValue<float>(data, offset + sizeof(float) * i);
+				box.size[i] = readValue<float>(data, offset + sizeof(float) * (i + 3));
+			}
+
+			return box;
+		}
+
+		// Round the offset provided up to the next multiple of 4 bytes
+		constexpr size_t alignOffset(size_t offset) noexcept
+		{
+			return (offset + 3) & ~size_t(3);
+		}
+
+		// Compute the box enclosing the vertices referenced by the range of indices provided
+		Box3f computeBounds(const std::vector<Vertex3D>& vertices, const unsigned int* indices, size_t indexCount) noexcept
+		{
+			if (indexCount == 0) {
+				return Box3f();
+			}
+
+			Vector3f minPosition(vertices[indices[0]].position);
+			Vector3f maxPosition(minPosition);
+			for (size_t i = 1; i < indexCount; ++i) {
+				minPosition = min(minPosition, vertices[indices[i]].position);
+				maxPosition = max(maxPosition, vertices[indices[i]].position);
+			}
+
+			return Box3f(minPosition, maxPosition - minPosition);
+		}
+	}
+
+	// Public constructor(s)
+	Mesh::Mesh()
+		: mVBO(nullptr)
+		, mIBO(nullptr)
+		, mSubmeshes()
+		, mBounds()
+		, mIndexCount(0)
+		, mID(nextID.fetch_add(1, std::memory_order_relaxed))
+	{
+	}
+
+	Mesh::~Mesh()
+	{
+		destroy();
+	}
+
+	// Public method(s)
+	void Mesh::create(const std::vector<Vertex3D>& vertices, const std::vector<unsigned int>& indices)
+	{
+		// Check if the geometry provided is valid (ignored in Release mode)
+		if _CONSTEXPR_IF (AEON_DEBUG) {
+			if (vertices.empty() || indices.empty()) {
+				AEON_LOG_ERROR("Invalid mesh geometry", "The lists of vertices and indices mustn't be empty.\nAborting operation.");
+				return;
+			}
+		}
+
+		// Delete the previous geometry and create the vertex buffer with the layout of the ae::Vertex3D struct
+		destroy();
+		mVBO = std::make_unique<VertexBuffer>(GL_STATIC_DRAW);
+		VertexBuffer::Layout& layout = mVBO->getLayout();
+		layout.addElement(GL_FLOAT, 3, GL_FALSE);
+		layout.addElement(GL_FLOAT, 3, GL_FALSE);
+		layout.addElement(GL_FLOAT, 2, GL_FALSE);
+		mVBO->setData(static_cast<int>(sizeof(Vertex3D) * vertices.size()), vertices.data());
+
+		mIBO = std::make_unique<IndexBuffer>(GL_STATIC_DRAW);
+		mIBO->setData(static_cast<unsigned int>(sizeof(unsigned int) * indices.size()), indices.data());
+		mIndexCount = static_cast<unsigned int>(indices.size());
+
+		// Compute the box enclosing the vertices, which is also the single submesh's
+		Vector3f minPosition(vertices.front().position);
+		Vector3f maxPosition(minPosition);
+		for (const Vertex3D& vertex : vertices) {
+			minPosition = min(minPosition, vertex.position);
+			maxPosition = max(maxPosition, vertex.position);
+		}
+		mBounds = Box3f(minPosition, maxPosition - minPosition);
+		mSubmeshes.assign(1, Submesh{ 0, mIndexCount, mBounds });
+	}
+
+	bool Mesh::loadFromFile(const std::string& filename)
+	{
+		// Map the mesh file and check its header
+		const FileSystem::MappedFile MAPPING = FileSystem::mapFile(filename);
+		const uint8_t* const DATA = MAPPING.data();
+		if (!MAPPING.isOpen()) {
+			AEON_LOG_ERROR("Invalid filepath", "Unable to map the mesh file at \"" + filename + "\".\nAborting operation.");
+			return false;
+		}
+		if (MAPPING.size() < HEADER_SIZE || std::memcmp(DATA, MESH_IDENTIFIER, sizeof(MESH_IDENTIFIER)) != 0
+		                               || readValue<uint32_t>(DATA, 4) != MESH_VERSION) {
+			AEON_LOG_ERROR("Invalid mesh file", "The file at \"" + filename + "\" isn't a mesh file or was written by another version.\nAborting operation.");
+			return false;
+		}
+
+		const uint32_t STRIDE = readValue<uint32_t>(DATA, 8);
+		const uint32_t ATTRIBUTE_COUNT = readValue<uint32_t>(DATA, 12);
+		const uint32_t VERTEX_COUNT = readValue<uint32_t>(DATA, 16);
+		const uint32_t INDEX_SIZE = readValue<uint32_t>(DATA, 20);
+		const uint32_t INDEX_COUNT = readValue<uint32_t>(DATA, 24);
+		const uint32_t SUBMESH_COUNT = readValue<uint32_t>(DATA, 28);
+
+		// Check that the tables and the geometry are within the file's bounds (the counts are widened so that they can't overflow)
+		const size_t TABLES_END = HEADER_SIZE + size_t(ATTRIBUTE_COUNT) * ATTRIBUTE_SIZE + size_t(SUBMESH_COUNT) * SUBMESH_SIZE;
+		const size_t VERTICES_OFFSET = alignOffset(TABLES_END);
+		const size_t VERTICES_SIZE = size_t(STRIDE) * VERTEX_COUNT;
+		const size_t INDICES_OFFSET = alignOffset(VERTICES_OFFSET + VERTICES_SIZE);
+		const size_t INDICES_SIZE = size_t(INDEX_SIZE) * INDEX_COUNT;
+		if ((INDEX_SIZE != sizeof(uint16_t) && INDEX_SIZE != sizeof(uint32_t)) || ATTRIBUTE_COUNT == 0 || VERTICES_SIZE == 0 || INDEX_COUNT == 0
+		 || INDICES_OFFSET + INDICES_SIZE > MAPPING.size())
+		{
+			AEON_LOG_ERROR("Corrupted mesh file", "The mesh file at \"" + filename + "\" is truncated or corrupted.\nAborting operation.");
+			return false;
+		}
+
+		// Rebuild the vertex buffer's layout, which must be as large as the stored stride
+		auto vbo = std::make_unique<VertexBuffer>(GL_STATIC_DRAW);
+		VertexBuffer::Layout& layout = vbo->getLayout();
+		for (uint32_t i = 0; i < ATTRIBUTE_COUNT; ++i) {
+			const size_t OFFSET = HEADER_SIZE + ATTRIBUTE_SIZE * i;
+			layout.addElement(readValue<uint32_t>(DATA, OFFSET), static_cast<int>(readValue<uint32_t>(DATA, OFFSET + 4)), readValue<uint32_t>(DATA, OFFSET + 8) != 0);
+		}
+		if (layout.getStride() != static_cast<int>(STRIDE)) {
+			vbo->destroy();
+			AEON_LOG_ERROR("Corrupted mesh file", "The vertex attributes of the mesh file at \"" + filename + "\" don't match its vertex stride.\nAborting operation.");
+			return false;
+		}
+
+		// Read the submeshes, which must remain within the indices
+		std::vector<Submesh> submeshes(SUBMESH_COUNT);
+		for (uint32_t i = 0; i < SUBMESH_COUNT; ++i) {
+			const size_t OFFSET = HEADER_SIZE + ATTRIBUTE_SIZE * ATTRIBUTE_COUNT + SUBMESH_SIZE * i;
+			submeshes[i].firstIndex = readValue<uint32_t>(DATA, OFFSET);
+			submeshes[i].indexCount = readValue<uint32_t>(DATA, OFFSET + 4);
+			submeshes[i].bounds = readBox(DATA, OFFSET + 8);
+			if (size_t(submeshes[i].firstIndex) + submeshes[i].indexCount > INDEX_COUNT) {
+				vbo->destroy();
+				AEON_LOG_ERROR("Corrupted mesh file", "A submesh of the mesh file at \"" + filename + "\" exceeds its indices.\nAborting operation.");
+				return false;
+			}
+		}
+
+		// Upload the mapped vertices and indices directly, replacing the previous geometry
+		destroy();
+		mVBO = std::move(vbo);
+		mVBO->setData(static_cast<int>(VERTICES_SIZE), DATA + VERTICES_OFFSET);
+
+		mIBO = std::make_unique<IndexBuffer>(GL_STATIC_DRAW);
+		if (INDEX_SIZE == sizeof(uint16_t)) {
+			mIBO->setData(static_cast<unsigned int>(INDICES_SIZE), reinterpret_cast<const uint16_t*>(DATA + INDICES_OFFSET));
+		}
+		else {
+			mIBO->setData(static_cast<unsigned int>(INDICES_SIZE), reinterpret_cast<const unsigned int*>(DATA + INDICES_OFFSET));
+		}
+
+		mIndexCount = INDEX_COUNT;
+		mBounds = readBox(DATA, 32);
+		mSubmeshes = std::move(submeshes);
+
+		return true;
+	}
+
+	const std::vector<Mesh::Submesh>& Mesh::getSubmeshes() const noexcept
+	{
+		return mSubmeshes;
+	}
+
+	const VertexBuffer* Mesh::getVBO() const noexcept
+	{
+		return mVBO.get();
+	}
+
+	const IndexBuffer* Mesh::getIBO() const noexcept
+	{
+		return mIBO.get();
+	}
+
+	unsigned int Mesh::getIndexCount() const noexcept
+	{
+		return mIndexCount;
+	}
+
+	uint32_t Mesh::getIndexType() const noexcept
+	{
+		return (mIBO) ? mIBO->getType() : GL_UNSIGNED_INT;
+	}
+
+	const Box3f& Mesh::getModelBounds() const noexcept
+	{
+		return mBounds;
+	}
+
+	uint32_t Mesh::getID() const noexcept
+	{
+		return mID;
+	}
+
+	// Public static method(s)
+	bool Mesh::saveToFile(const std::string& filename, const std::vector<Vertex3D>& vertices, const std::vector<unsigned int>& indices, const std::vector<Submesh>& submeshes)
+	{
+		// Check if the geometry provided is valid
+		if (vertices.empty() || indices.empty()) {
+			AEON_LOG_ERROR("Invalid mesh geometry", "The lists of vertices and indices mustn't be empty.\nAborting operation.");
+			return false;
+		}
+		for (const unsigned int INDEX : indices) {
+			if (INDEX >= vertices.size()) {
+				AEON_LOG_ERROR("Invalid mesh geometry", "The index \"" + std::to_string(INDEX) + "\" doesn't refer to any vertex.\nAborting operation.");
+				return false;
+			}
+		}
+		for (const Submesh& submesh : submeshes) {
+			if (size_t(submesh.firstIndex) + submesh.indexCount > indices.size()) {
+				AEON_LOG_ERROR("Invalid submesh", "A submesh exceeds the list of indices.\nAborting operation.");
+				return false;
+			}
+		}
+
+		// The indices are stored as 16-bit integers if they can all be represented
+		const uint32_t INDEX_SIZE = (vertices.size() <= 65536) ? sizeof(uint16_t) : sizeof(uint32_t);
+		const Box3f BOUNDS = computeBounds(vertices, indices.data(), indices.size());
+
+		// Write the header, the attributes of the ae::Vertex3D struct and the submeshes
+		std::string contents(MESH_IDENTIFIER, sizeof(MESH_IDENTIFIER));
+		appendValue<uint32_t>(contents, MESH_VERSION);
+		appendValue<uint32_t>(contents, sizeof(Vertex3D));
+		appendValue<uint32_t>(contents, 3);
+		appendValue<uint32_t>(contents, static_cast<uint32_t>(vertices.size()));
+		appendValue<uint32_t>(contents, INDEX_SIZE);
+		appendValue<uint32_t>(contents, static_cast<uint32_t>(indices.size()));
+		appendValue<uint32_t>(contents, static_cast<uint32_t>(submeshes.empty() ? 1 : submeshes.size()));
+		appendBox(contents, BOUNDS);
+
+		const uint32_t COMPONENT_COUNTS[3] = { 3, 3, 2 };
+		for (const uint32_t COUNT : COMPONENT_COUNTS) {
+			appendValue<uint32_t>(contents, GL_FLOAT);
+			appendValue<uint32_t>(contents, COUNT);
+			appendValue<uint32_t>(contents, GL_FALSE);
+		}
+
+		if (submeshes.empty()) {
+			appendValue<uint32_t>(contents, 0);
+			appendValue<uint32_t>(contents, static_cast<uint32_t>(indices.size()));
+			appendBox(contents, BOUNDS);
+		}
+		for (const Submesh& submesh : submeshes) {
+			appendValue<uint32_t>(contents, submesh.firstIndex);
+			appendValue<uint32_t>(contents, submesh.indexCount);
+			appendBox(contents, computeBounds(vertices, indices.data() + submesh.firstIndex, submesh.indexCount));
+		}
+
+		// Write the interleaved vertices and the indices, each aligned to 4 bytes so that they may be uploaded straight from the mapped file
+		contents.resize(alignOffset(contents.size()), '\0');
+		contents.append(reinterpret_cast<const char*>(vertices.data()), sizeof(Vertex3D) * vertices.size());
+		contents.resize(alignOffset(contents.size()), '\0');
+		if (INDEX_SIZE == sizeof(uint16_t)) {
+			for (const unsigned int INDEX : indices) {
+				appendValue<uint16_t>(contents, static_cast<uint16_t>(INDEX));
+			}
+		}
+		else {
+			contents.append(reinterpret_cast<const char*>(indices.data()), sizeof(unsigned int) * indices.size());
+		}
+
+		// Write the mesh file
+		std::ofstream file(filename, std::ios::binary | std::ios::trunc);
+		if (!file || !file.write(contents.data(), static_cast<std::streamsize>(contents.size()))) {
+			AEON_LOG_ERROR("Invalid filepath", "Unable to write the mesh file at \"" + filename + "\".\nAborting operation.");
+			return false;
+		}
+
+		return true;
+	}
+
+	// Private method(s)
+	void Mesh::destroy()
+	{
+		if (mVBO) mVBO->destroy();
+		if (mIBO) mIBO->destroy();
+	}
+}
\ No newline at end of file
@@ -0,0 +1,325 @@
+// MIT License
+// 
+// Copyright(c) 2019-2021 Filippos Gleglakos
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+
+#include <AEON/Graphics/ParticleEmitter2D.h>
+
+#include <algorithm>
+#include <cmath>
+#include <string>
+#include <vector>
+
+#include <GL/glew.h>
+
+#include <AEON/Math/Misc.h>
+#include <AEON/Graphics/internal/GLCommon.h>
+#include <AEON/Graphics/internal/Renderer2D.h>
+#include <AEON/Graphics/internal/ShaderStorageBuffer.h>
+#include <AEON/Graphics/internal/VertexArray.h>
+#include <AEON/Graphics/GLResourceFactory.h>
+#include <AEON/Graphics/Shader.h>
+
+namespace ae
+{
+	namespace
+	{
+		// The size of the SSBO's header (the spawn budget padded to the particles' alignment)
+		constexpr int HEADER_SIZE = 16;
+		// The size of a single particle within the SSBO (std430 layout of the shaders' Particle struct)
+		constexpr int PARTICLE_SIZE = 48;
+		// The number of invocations per work group of the update compute shader
+		constexpr unsigned int WORK_GROUP_SIZE = 256;
+		// The largest time step simulated at once, so that an emitter that wasn't rendered for a while doesn't teleport its particles
+		constexpr float MAX_TIME_STEP = 0.1f;
+
+		// Used to assign a unique name to each emitter's SSBO
+		unsigned int particleBufferCounter = 0;
+	}
+
+	// Public constructor(s)
+	ParticleEmitter2D::ParticleEmitter2D(unsigned int capacity)
+		: Actor2D()
+		, mSimulation(std::make_shared<Simulation>(Simulation{ nullptr, 0, 0, nullptr, nullptr, nullptr, nullptr }))
+		, mModelBounds()
+		, mLifetime(1.f, 1.f)
+		, mSpeed(0.f, 100.f)
+		, mAngle(0.f, Math::toRadians(360.f))
+		, mSizes(4.f, 4.f)
+		, mGravity(0.f, 0.f)
+		, mStartColor(Color::White)
+		, mEndColor(Color::Transparent)
+		, mBlendMode(BlendMode::BlendAlpha)
+		, mTexture(nullptr)
+		, mCapacity(capacity)
+		, mEmissionRate(0.f)
+		, mElapsedTime(0.f)
+		, mEmissions(0.f)
+	{
+		updateBounds();
+	}
+
+	// Public method(s)
+	void ParticleEmitter2D::setCapacity(unsigned int capacity)
+	{
+		mCapacity = capacity;
+		mEmissions = std::min(mEmissions, static_cast<float>(mCapacity));
+	}
+
+	void ParticleEmitter2D::setEmissionRate(float rate) noexcept
+	{
+		mEmissionRate = std::max(rate, 0.f);
+	}
+
+	void ParticleEmitter2D::burst(unsigned int count) noexcept
+	{
+		mEmissions = std::min(mEmissions + static_cast<float>(count), static_cast<float>(mCapacity));
+	}
+
+	void ParticleEmitter2D::setLifetime(float min, float max)
+	{
+		// Check that the lifetimes are positive (ignored in Release mode)
+		if _CONSTEXPR_IF (AEON_DEBUG) {
+			if (min <= 0.f || max < min) {
+				AEON_LOG_ERROR("Invalid particle lifetime", "The lifetimes must be positive and the maximum can't be inferior to the minimum.\nAborting operation.");
+				return;
+			}
+		}
+
+		mLifetime = Vector2f(min, max);
+		updateBounds();
+	}
+
+	void ParticleEmitter2D::setSpeed(float min, float max)
+	{
+		mSpeed = Vector2f(min, max);
+		updateBounds();
+	}
+
+	void ParticleEmitter2D::setAngle(float min, float max)
+	{
+		mAngle = Vector2f(Math::toRadians(min), Math::toRadians(max));
+	}
+
+	void ParticleEmitter2D::setColors(const Color& start, const Color& end) noexcept
+	{
+		mStartColor = start;
+		mEndColor = end;
+	}
+
+	void ParticleEmitter2D::setSizes(float start, float end)
+	{
+		mSizes = Vector2f(start, end);
+		updateBounds();
+	}
+
+	void ParticleEmitter2D::setGravity(const Vector2f& gravity)
+	{
+		mGravity = gravity;
+		updateBounds();
+	}
+
+	void ParticleEmitter2D::setTexture(const Texture2D& texture) noexcept
+	{
+		mTexture = &texture;
+	}
+
+	void ParticleEmitter2D::setBlendMode(const BlendMode& blendMode) noexcept
+	{
+		mBlendMode = blendMode;
+	}
+
+	unsigned int ParticleEmitter2D::getCapacity() const noexcept
+	{
+		return mCapacity;
+	}
+
+	float ParticleEmitter2D::getEmissionRate() const noexcept
+	{
+		return mEmissionRate;
+	}
+
+	const Vector2f& ParticleEmitter2D::getLifetime() const noexcept
+	{
+		return mLifetime;
+	}
+
+	const Vector2f& ParticleEmitter2D::getSpeed() const noexcept
+	{
+		return mSpeed;
+	}
+
+	Vector2f ParticleEmitter2D::getAngle() const noexcept
+	{
+		return Vector2f(Math::toDegrees(mAngle.x), Math::toDegrees(mAngle.y));
+	}
+
+	const Color& ParticleEmitter2D::getStartColor() const noexcept
+	{
+		return mStartColor;
+	}
+
+	const Color& ParticleEmitter2D::getEndColor() const noexcept
+	{
+		return mEndColor;
+	}
+
+	const Vector2f& ParticleEmitter2D::getSizes() const noexcept
+	{
+		return mSizes;
+	}
+
+	const Vector2f& ParticleEmitter2D::getGravity() const noexcept
+	{
+		return mGravity;
+	}
+
+	const Texture2D* const ParticleEmitter2D::getTexture() const noexcept
+	{
+		return mTexture;
+	}
+
+	// Public virtual method(s)
+	Box2f ParticleEmitter2D::getModelBounds() const
+	{
+		return mModelBounds;
+	}
+
+	// Private method(s)
+	void ParticleEmitter2D::updateBounds()
+	{
+		// The furthest a particle can travel is reached with the highest speed and the longest lifetime
+		const float LIFETIME = mLifetime.y;
+		const float REACH = std::max(std::abs(mSpeed.x), std::abs(mSpeed.y)) * LIFETIME
+		                  + 0.5f * mGravity.magnitude() * LIFETIME * LIFETIME
+		                  + std::max(mSizes.x, mSizes.y) / 2.f;
+
+		mModelBounds = Box2f(-REACH, -REACH, REACH * 2.f, REACH * 2.f);
+		invalidateBounds();
+	}
+
+	// Private virtual method(s)
+	void ParticleEmitter2D::updateSelf(const Time& dt)
+	{
+		// The simulation step is only dispatched once the emitter is rendered
+		const float DT = static_cast<float>(dt.asSeconds());
+		mElapsedTime += DT;
+		mEmissions = std::min(mEmissions + mEmissionRate * DT, static_cast<float>(mCapacity));
+	}
+
+	void ParticleEmitter2D::renderSelf(const RenderStates& states) const
+	{
+		if (mCapacity == 0) {
+			return;
+		}
+
+		// Consume the time and the whole emissions accumulated since the last simulation step (the fractional emission is kept for the next one)
+		const float TIME_STEP = std::min(mElapsedTime, MAX_TIME_STEP);
+		const float EMISSIONS = std::floor(mEmissions);
+		mElapsedTime = 0.f;
+		mEmissions -= EMISSIONS;
+
+		// Capture the emission properties by value as the drawcall is executed once the scene ends, possibly on another thread
+		Renderer2D::drawToActive([simulation = mSimulation,
+		                          capacity = mCapacity,
+		                          spawnBudget = static_cast<int>(EMISSIONS),
+		                          timeStep = TIME_STEP,
+		                          origin = (states.transform * Vector3f(0.f, 0.f, 0.f)).xy,
+		                          depth = static_cast<float>(getDepth()),
+		                          lifetime = mLifetime,
+		                          speed = mSpeed,
+		                          angle = mAngle,
+		                          sizes = mSizes,
+		                          gravity = mGravity,
+		                          startColor = mStartColor.normalize(),
+		                          endColor = mEndColor.normalize(),
+		                          blendMode = mBlendMode,
+		                          texture = mTexture]()
+		{
+			// Retrieve the shared resources once, the simulation releasing them alongside its SSBO
+			if (!simulation->updateShader || !simulation->particleShader || !simulation->vao || !simulation->whiteTexture) {
+				GLResourceFactory& glResourceFactory = GLResourceFactory::getInstance();
+				simulation->updateShader = glResourceFactory.get<Shader>("_AEON_ParticleUpdate2D");
+				simulation->particleShader = glResourceFactory.get<Shader>("_AEON_Particle2D");
+				simulation->vao = glResourceFactory.get<VertexArray>("_AEON_ParticleVAO");
+				simulation->whiteTexture = glResourceFactory.get<Texture2D>("_AEON_WhiteTexture");
+			}
+			Shader& updateShader = *simulation->updateShader;
+			Shader& particleShader = *simulation->particleShader;
+			VertexArray& vao = *simulation->vao;
+			const Texture2D& particleTexture = (texture) ? *texture : *simulation->whiteTexture;
+
+			// Create the particles' storage or recreate it if the capacity has changed (every particle starts dead)
+			if (!simulation->buffer || simulation->capacity != capacity) {
+				if (!simulation->buffer) {
+					simulation->buffer = GLResourceFactory::getInstance().create<ShaderStorageBuffer>("_AEON_ParticleBuffer" + std::to_string(particleBufferCounter++));
+				}
+
+				const int SIZE = HEADER_SIZE + PARTICLE_SIZE * static_cast<int>(capacity);
+				const std::vector<uint8_t> ZEROES(SIZE, 0);
+				simulation->buffer->resize(SIZE);
+				simulation->buffer->setSubData(0, SIZE, ZEROES.data());
+				simulation->capacity = capacity;
+			}
+			ShaderStorageBuffer& buffer = *simulation->buffer;
+
+			// Advance the particles and respawn the dead ones within the spawn budget
+			buffer.setSubData(0, sizeof(int), &spawnBudget);
+			updateShader.addStorageBuffer(buffer, "uParticleBuffer");
+			updateShader.setUniform("uParticleCount", capacity);
+			updateShader.setUniform("uSeed", simulation->seed++);
+			updateShader.setUniform("uDeltaTime", timeStep);
+			updateShader.setUniform("uEmitterPosition", origin);
+			updateShader.setUniform("uGravity", gravity);
+			updateShader.setUniform("uSpeedRange", speed);
+			updateShader.setUniform("uAngleRange", angle);
+			updateShader.setUniform("uLifetimeRange", lifetime);
+			updateShader.setUniform("uSizeRange", sizes);
+			updateShader.setUniform("uStartColor", startColor);
+			updateShader.setUniform("uEndColor", endColor);
+			updateShader.dispatch((capacity + WORK_GROUP_SIZE - 1) / WORK_GROUP_SIZE);
+
+			// Make the compute shader's writes visible to the vertex shader's reads
+			GLCall(glMemoryBarrier(GL_SHADER_STORAGE_BARRIER_BIT));
+
+			// Render one quad per particle, the dead ones being collapsed by the vertex shader
+			particleShader.addStorageBuffer(buffer, "uParticleBuffer");
+			particleShader.setUniform("uDepth", depth);
+			particleShader.bind();
+			vao.bind();
+			particleTexture.bind();
+
+			gl::setCapability(GL_BLEND, blendMode != BlendMode::BlendNone);
+			if (blendMode != BlendMode::BlendNone) {
+				gl::setBlendFunction(static_cast<GLenum>(blendMode.colorEquation), static_cast<GLenum>(blendMode.alphaEquation),
+				                     static_cast<GLenum>(blendMode.colorSrcFactor), static_cast<GLenum>(blendMode.colorDstFactor),
+				                     static_cast<GLenum>(blendMode.alphaSrcFactor), static_cast<GLenum>(blendMode.alphaDstFactor));
+			}
+
+			// The particles share the emitter's depth, they're depth-tested against the scene without occluding one another
+			GLCall(glDepthMask(GL_FALSE));
+			GLCall(glDrawElementsInstanced(GL_TRIANGLES, 6, GL_UNSIGNED_INT, nullptr, static_cast<GLsizei>(capacity)));
+			GLCall(glDepthMask(GL_TRUE));
+			vao.unbind();
+		});
+	}
+}
\ No newline at end of file
@@ -0,0 +1,272 @@
+// MIT License
+// 
+// Copyright(c) 2019-2021 Filippos Gleglakos
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <AEON/Graphics/PostProcessChain.h>
+
+#include <GL/glew.h>
+
+#include <algorithm>
+#include <cmath>
+
+#include <AEON/System/Profiler.h>
+#include <AEON/Graphics/GPUProfiler.h>
+#include <AEON/Graphics/GLResourceFactory.h>
+#include <AEON/Graphics/RenderTexture.h>
+#include <AEON/Graphics/internal/GLCommon.h>
+
+namespace ae
+{
+	namespace
+	{
+		// The vertex shader generating the full-screen triangle shared by every pass
+		const char* const VERTEX_SOURCE =
+		#include <AEON/Shaders/PostProcess2D.vs>
+		;
+
+		// The fragment shader of the gaussian blur's passes
+		const char* const BLUR_SOURCE =
+		#include <AEON/Shaders/PostProcessBlur2D.fs>
+		;
+
+		// The version and interface prepended to the effects' source code
+		const char* const INTERFACE_SOURCE = R"(
+#version 450 core
+
+in VS_OUT {
+	vec2 uv;
+} fs_in;
+
+layout (binding = 0) uniform sampler2D uSource;
+uniform vec2 uTexelSize;
+
+out vec4 color;
+)";
+	}
+
+	// Public constructor(s)
+	PostProcessChain::PostProcessChain()
+		: mEffects()
+		, mPasses()
+		, mTargets()
+		, mShaders()
+		, mDirty(false)
+	{
+	}
+
+	PostProcessChain::PostProcessChain(PostProcessChain&& rvalue) noexcept = default;
+
+	PostProcessChain::~PostProcessChain() = default;
+
+	// Public operator(s)
+	PostProcessChain& PostProcessChain::operator=(PostProcessChain&& rvalue) noexcept = default;
+
+	// Public method(s)
+	void PostProcessChain::addEffect(const std::string& name, const std::string& source, float resolutionScale, SetupFunction setup)
+	{
+		mEffects.push_back(Effect{ name, source, std::move(setup), resolutionScale, false, true });
+		mDirty = true;
+	}
+
+	void PostProcessChain::addColorEffect(const std::string& name, const std::string& source, float resolutionScale, SetupFunction setup)
+	{
+		mEffects.push_back(Effect{ name, source, std::move(setup), resolutionScale, true, true });
+		mDirty = true;
+	}
+
+	void PostProcessChain::addBlurEffect(const std::string& name, float resolutionScale, float radius)
+	{
+		// Both passes share the same shader program, only their direction differs
+		addEffect(name, BLUR_SOURCE, resolutionScale, [radius](Shader& shader) {
+			shader.setUniform("uDirection", Vector2f(radius, 0.f));
+		});
+		addEffect(name, BLUR_SOURCE, resolutionScale, [radius](Shader& shader) {
+			shader.setUniform("uDirection", Vector2f(0.f, radius));
+		});
+	}
+
+	void PostProcessChain::setEffectEnabled(const std::string& name, bool enabled)
+	{
+		for (Effect& effect : mEffects) {
+			if (effect.name == name && effect.enabled != enabled) {
+				effect.enabled = enabled;
+				mDirty = true;
+			}
+		}
+	}
+
+	void PostProcessChain::removeEffect(const std::string& name)
+	{
+		const size_t COUNT = mEffects.size();
+		mEffects.erase(std::remove_if(mEffects.begin(), mEffects.end(), [&name](const Effect& effect) { return effect.name == name; }), mEffects.end());
+		mDirty = mDirty || mEffects.size() != COUNT;
+	}
+
+	void PostProcessChain::clear()
+	{
+		mEffects.clear();
+		mPasses.clear();
+		mTargets.clear();
+		mShaders.clear();
+		mDirty = false;
+	}
+
+	void PostProcessChain::apply(const Texture2D& source, unsigned int outputFramebuffer, const Vector2i& outputSize)
+	{
+		AEON_PROFILE_SCOPE("PostProcessChain::apply");
+		AEON_PROFILE_GPU_SCOPE("Post-processing");
+
+		if (mDirty) {
+			buildPasses();
+		}
+		if (mPasses.empty() || outputSize.x <= 0 || outputSize.y <= 0) {
+			return;
+		}
+
+		// Every pass overwrites its entire render texture
+		gl::setCapability(GL_BLEND, false);
+		gl::setCapability(GL_DEPTH_TEST, false);
+		gl::setScissor(0, 0, 0, 0);
+		GLResourceFactory& glResourceFactory = GLResourceFactory::getInstance();
+		glResourceFactory.get<VertexArray>("_AEON_EmptyVAO")->bind();
+		const Sampler& SAMPLER = glResourceFactory.getSampler(Texture::Filter::Linear, Texture::Wrap::ClampToEdge);
+
+		for (Target& target : mTargets) {
+			target.used = false;
+		}
+
+		// Render each pass from the previous pass' result
+		const Texture2D* input = &source;
+		const RenderTexture* inputTarget = nullptr;
+		for (const Pass& pass : mPasses) {
+			const Vector2i SIZE(std::max(static_cast<int>(std::round(outputSize.x * pass.resolutionScale)), 1),
+			                    std::max(static_cast<int>(std::round(outputSize.y * pass.resolutionScale)), 1));
+			RenderTexture& target = acquireTarget(SIZE, inputTarget);
+			target.activate();
+
+			pass.shader->bind();
+			for (const size_t EFFECT : pass.effects) {
+				if (mEffects[EFFECT].setup) {
+					mEffects[EFFECT].setup(*pass.shader);
+				}
+			}
+			pass.shader->setUniform("uTexelSize", Vector2f(1.f / input->getSize().x, 1.f / input->getSize().y));
+			gl::bindTextureUnit(0, input->getHandle());
+			gl::bindSampler(0, SAMPLER.getHandle());
+			GLCall(glDrawArrays(GL_TRIANGLES, 0, 3));
+			target.storeContents();
+
+			input = target.getTexture();
+			inputTarget = &target;
+		}
+
+		// Blit the last pass' result, the blit being subject to the scissor test and the damage region
+		gl::resetDamageRegion();
+		const Vector2i& SIZE = inputTarget->getFramebufferSize();
+		const GLenum FILTER = (SIZE == outputSize) ? GL_NEAREST : GL_LINEAR;
+		GLCall(glBlitNamedFramebuffer(inputTarget->getFramebufferHandle(), outputFramebuffer, 0, 0, SIZE.x, SIZE.y, 0, 0, outputSize.x, outputSize.y, GL_COLOR_BUFFER_BIT, FILTER));
+
+		// Return the render textures that are no longer used (following a resize or a modification of the effects) to the pool
+		mTargets.erase(std::remove_if(mTargets.begin(), mTargets.end(), [](const Target& target) { return !target.used; }), mTargets.end());
+	}
+
+	bool PostProcessChain::isEmpty() const noexcept
+	{
+		return std::none_of(mEffects.begin(), mEffects.end(), [](const Effect& effect) { return effect.enabled; });
+	}
+
+	size_t PostProcessChain::getPassCount() const noexcept
+	{
+		return mPasses.size();
+	}
+
+	// Private method(s)
+	void PostProcessChain::buildPasses()
+	{
+		// Group the consecutive color effects of the same resolution scale
+		mPasses.clear();
+		for (size_t i = 0; i < mEffects.size(); ++i) {
+			const Effect& EFFECT = mEffects[i];
+			if (!EFFECT.enabled) {
+				continue;
+			}
+
+			if (EFFECT.fusable && !mPasses.empty() && mEffects[mPasses.back().effects.front()].fusable && mPasses.back().resolutionScale == EFFECT.resolutionScale) {
+				mPasses.back().effects.push_back(i);
+			}
+			else {
+				mPasses.push_back(Pass{ nullptr, { i }, EFFECT.resolutionScale });
+			}
+		}
+
+		// Generate the passes' fragment shaders, the fused effects' functions being renamed so that they can be chained
+		for (Pass& pass : mPasses) {
+			std::string source = INTERFACE_SOURCE;
+			if (!mEffects[pass.effects.front()].fusable) {
+				source += mEffects[pass.effects.front()].source;
+			}
+			else {
+				std::string body;
+				for (size_t i = 0; i < pass.effects.size(); ++i) {
+					const std::string FUNCTION = "aeonEffect" + std::to_string(i);
+					source += "\n#define apply " + FUNCTION + '\n' + mEffects[pass.effects[i]].source + "\n#undef apply\n";
+					body += "\ttexel = " + FUNCTION + "(texel, fs_in.uv);\n";
+				}
+				source += "\nvoid main()\n{\n\tvec4 texel = texture(uSource, fs_in.uv);\n" + body + "\tcolor = texel;\n}\n";
+			}
+			pass.shader = getShader(source);
+		}
+
+		mDirty = false;
+	}
+
+	std::shared_ptr<Shader> PostProcessChain::getShader(const std::string& source)
+	{
+		std::shared_ptr<Shader>& shader = mShaders[source];
+		if (!shader) {
+			shader = GLResourceFactory::getInstance().create<Shader>("");
+			shader->loadFromSource(Shader::StageType::Vertex, VERTEX_SOURCE);
+			shader->loadFromSource(Shader::StageType::Fragment, source);
+			shader->link(true);
+		}
+
+		return shader;
+	}
+
+	RenderTexture& PostProcessChain::acquireTarget(const Vector2i& size, const RenderTexture* input)
+	{
+		// The passes of the same size alternate between two render textures
+		for (Target& target : mTargets) {
+			if (target.texture.get() != input && target.texture->getFramebufferSize() == size) {
+				target.used = true;
+				return *target.texture;
+			}
+		}
+
+		// The render texture's attachments are borrowed from the pool, its contents are entirely overwritten by each pass
+		auto texture = std::make_unique<RenderTexture>();
+		texture->setLoadAction(RenderTexture::LoadAction::DontCare);
+		texture->setStoreActions(RenderTexture::StoreAction::Store, RenderTexture::StoreAction::DontCare);
+		texture->create(size.x, size.y);
+		mTargets.push_back(Target{ std::move(texture), true });
+		return *mTargets.back().texture;
+	}
+}
\ No newline at end of file
@@ -0,0 +1,552 @@
+// MIT License
+// 
+// Copyright(c) 2019-2021 Filippos Gleglakos
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <AEON/Graphics/Prefab.h>
+
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <typeinfo>
+#include <unordered_map>
+#include <utility>
+
+#include <AEON/Graphics/Actor2D.h>
+#include <AEON/Graphics/EllipseShape.h>
+#include <AEON/Graphics/Font.h>
+#include <AEON/Graphics/GLResourceFactory.h>
+#include <AEON/Graphics/RectangleShape.h>
+#include <AEON/Graphics/Sprite.h>
+#include <AEON/Graphics/Text.h>
+#include <AEON/Graphics/Texture2D.h>
+#include <AEON/System/DebugLogger.h>
+#include <AEON/System/MemoryTracker.h>
+#include <AEON/System/Profiler.h>
+
+namespace ae
+{
+	namespace
+	{
+		// The identifier and version of the prefabs
+		// Layout: identifier, version, node count, resource count, string table size | resources | nodes | string table
+		constexpr char     PREFAB_IDENTIFIER[4] = { 'A', 'E', 'P', 'F' };
+		constexpr uint32_t PREFAB_VERSION = 1;
+		constexpr size_t   HEADER_SIZE = sizeof(PREFAB_IDENTIFIER) + sizeof(uint32_t) * 4;
+		// Resource entry: path offset, path length, type
+		constexpr size_t   RESOURCE_SIZE = sizeof(uint32_t) + sizeof(uint16_t) * 2;
+
+		// The parent of the root node and the resource of the nodes that don't reference any
+		constexpr uint32_t NO_PARENT = std::numeric_limits<uint32_t>::max();
+		constexpr uint32_t NO_RESOURCE = std::numeric_limits<uint32_t>::max();
+
+		// The types of nodes stored, the nodes of the other types being stored as plain actors
+		enum class NodeType : uint8_t
+		{
+			Actor,
+			Sprite,
+			Text,
+			Rectangle,
+			Ellipse,
+			Count
+		};
+
+		// The flags of the nodes
+		enum NodeFlag : uint8_t
+		{
+			Static   = 1 << 0,
+			Cullable = 1 << 1,
+			Layered  = 1 << 2
+		};
+
+		// The types of resources referenced by the nodes
+		enum class ResourceType : uint16_t
+		{
+			Texture,
+			Font,
+			Count
+		};
+
+		// The record of a node, stored as-is (its members are laid out so that it holds no padding)
+		struct NodeRecord
+		{
+			uint32_t parent;           // The index of the parent node, NO_PARENT for the root node
+			uint32_t childCount;       // The number of children
+			uint8_t  type;             // The NodeType
+			uint8_t  flags;            // The NodeFlag paired together
+			uint16_t pointCount;       // The ellipse's point count or the rectangle's corner point count
+			int32_t  layer;            // The layer declared, if the node is layered
+			uint32_t originFlags;      // The origin flags
+			float    position[2];      // The position
+			float    rotation;         // The rotation in degrees
+			float    scale[2];         // The scale factors
+			uint32_t resource;         // The index of the texture or of the font, NO_RESOURCE if there is none
+			float    textureRect[4];   // The texture rectangle's minimum and maximum coordinates
+			float    size[2];          // The rectangle's size or the ellipse's radius
+			float    cornerRadius;     // The rectangle's corner radius
+			float    outlineThickness; // The shape's outline thickness
+			float    levelOfDetail;    // The shape's maximum on-screen deviation
+			uint32_t color;            // The sprite's color, the text's color or the shape's fill color
+			uint32_t outlineColor;     // The shape's outline color
+			uint32_t textOffset;       // The offset of the text's string within the string table
+			uint32_t textLength;       // The length of the text's string
+			uint32_t characterSize;    // The text's character size
+		};
+		constexpr size_t NODE_SIZE = sizeof(NodeRecord);
+		static_assert(NODE_SIZE == 100, "The node records mustn't hold any padding.");
+
+		// The entry of a resource written to the prefab
+		struct ResourceEntry
+		{
+			uint32_t     offset; // The offset of the resource's path within the string table
+			uint16_t     length; // The length of the resource's path
+			ResourceType type;   // The type of the resource
+		};
+
+		// Read a little-endian value from the data (the pointer is assumed to be within bounds)
+		template <typename T>
+		T readValue(const uint8_t* data) noexcept
+		{
+			T value = 0;
+			std::memcpy(&value, data, sizeof(T));
+			return value;
+		}
+
+		// Append a little-endian value to the contents
+		template <typename T>
+		void appendValue(std::string& contents, T value)
+		{
+			contents.append(reinterpret_cast<const char*>(&value), sizeof(T));
+		}
+
+		// Read the record of the node at the index provided (the records aren't necessarily aligned within the mapping)
+		NodeRecord readRecord(const uint8_t* nodes, size_t index) noexcept
+		{
+			NodeRecord record;
+			std::memcpy(&record, nodes + index * NODE_SIZE, NODE_SIZE);
+			return record;
+		}
+
+		// Apply the render data shared by the shapes
+		void applyShape(Shape& shape, const NodeRecord& record, const Texture2D* texture)
+		{
+			if (texture) {
+				shape.setTexture(texture);
+				shape.setTextureRect(Box2f(Vector2f(record.textureRect[0], record.textureRect[1]), Vector2f(record.textureRect[2], record.textureRect[3])));
+			}
+			shape.setFillColor(Color(record.color));
+			shape.setOutlineColor(Color(record.outlineColor));
+			shape.setOutlineThickness(record.outlineThickness);
+			shape.setLevelOfDetail(record.levelOfDetail);
+		}
+
+		// Create the node described by the record along with its render data
+		std::unique_ptr<Actor2D> createNode(const NodeRecord& record, const Texture2D* texture, Font* font, const char* strings)
+		{
+			switch (static_cast<NodeType>(record.type))
+			{
+			case NodeType::Sprite:
+			{
+				const Box2f RECT(Vector2f(record.textureRect[0], record.textureRect[1]), Vector2f(record.textureRect[2], record.textureRect[3]));
+				auto sprite = (texture) ? std::make_unique<Sprite>(*texture, RECT) : std::make_unique<Sprite>();
+				sprite->setColor(Color(record.color));
+				return sprite;
+			}
+			case NodeType::Text:
+			{
+				auto text = std::make_unique<Text>();
+				if (font) {
+					text->setFont(*font);
+				}
+				text->setCharacterSize(record.characterSize);
+				text->setColor(Color(record.color));
+				text->setText(std::string(strings + record.textOffset, record.textLength));
+				return text;
+			}
+			case NodeType::Rectangle:
+			{
+				auto rectangle = std::make_unique<RectangleShape>(Vector2f(record.size[0], record.size[1]), record.cornerRadius, record.pointCount);
+				applyShape(*rectangle, record, texture);
+				return rectangle;
+			}
+			case NodeType::Ellipse:
+			{
+				auto ellipse = std::make_unique<EllipseShape>(Vector2f(record.size[0], record.size[1]), record.pointCount);
+				applyShape(*ellipse, record, texture);
+				return ellipse;
+			}
+			default:
+				return std::make_unique<Actor2D>();
+			}
+		}
+
+		// Store the render data shared by the shapes
+		void recordShape(NodeRecord& record, const Shape& shape)
+		{
+			const Box2f& RECT = shape.getTextureRect();
+			record.textureRect[0] = RECT.min.x;
+			record.textureRect[1] = RECT.min.y;
+			record.textureRect[2] = RECT.max.x;
+			record.textureRect[3] = RECT.max.y;
+			record.color = shape.getFillColor().toHexcode();
+			record.outlineColor = shape.getOutlineColor().toHexcode();
+			record.outlineThickness = shape.getOutlineThickness();
+			record.levelOfDetail = shape.getLevelOfDetail();
+		}
+	}
+
+	// Public constructor(s)
+	Prefab::Prefab() noexcept
+		: mMapping()
+		, mNodes(nullptr)
+		, mStrings(nullptr)
+		, mStringSize(0)
+		, mNodeCount(0)
+		, mResources()
+		, mFilepath()
+	{
+	}
+
+	// Public method(s)
+	bool Prefab::loadFromFile(const std::string& filepath)
+	{
+		AEON_PROFILE_SCOPE("Prefab::loadFromFile");
+		unload();
+
+		// Map the prefab and check its header
+		FileSystem::MappedFile mapping = FileSystem::mapFile(filepath);
+		const uint8_t* const DATA = mapping.data();
+		const size_t SIZE = mapping.size();
+		if (!mapping.isOpen() || SIZE < HEADER_SIZE || std::memcmp(DATA, PREFAB_IDENTIFIER, sizeof(PREFAB_IDENTIFIER)) != 0
+		                      || readValue<uint32_t>(DATA + 4) != PREFAB_VERSION) {
+			AEON_LOG_ERROR("Invalid prefab", "The file at \"" + filepath + "\" isn't a prefab or was saved by another version.\nAborting operation.");
+			return false;
+		}
+
+		// Check that the resources, the nodes and the string table fill the prefab
+		const uint32_t NODE_COUNT = readValue<uint32_t>(DATA + 8);
+		const uint32_t RESOURCE_COUNT = readValue<uint32_t>(DATA + 12);
+		const uint32_t STRING_SIZE = readValue<uint32_t>(DATA + 16);
+		if (NODE_COUNT == 0 || SIZE != HEADER_SIZE + static_cast<uint64_t>(RESOURCE_COUNT) * RESOURCE_SIZE + static_cast<uint64_t>(NODE_COUNT) * NODE_SIZE + STRING_SIZE) {
+			AEON_LOG_ERROR("Corrupted prefab", "The size of the prefab \"" + filepath + "\" doesn't match its contents.\nAborting operation.");
+			return false;
+		}
+
+		mNodes = DATA + HEADER_SIZE + static_cast<size_t>(RESOURCE_COUNT) * RESOURCE_SIZE;
+		mStrings = reinterpret_cast<const char*>(DATA + SIZE - STRING_SIZE);
+		mStringSize = STRING_SIZE;
+		mNodeCount = NODE_COUNT;
+		mMapping = std::move(mapping);
+
+		// Read in the paths of the resources
+		mResources.reserve(RESOURCE_COUNT);
+		for (uint32_t i = 0; i < RESOURCE_COUNT; ++i) {
+			const uint8_t* const ENTRY = DATA + HEADER_SIZE + static_cast<size_t>(i) * RESOURCE_SIZE;
+			const uint32_t OFFSET = readValue<uint32_t>(ENTRY);
+			const uint16_t LENGTH = readValue<uint16_t>(ENTRY + 4);
+			const uint16_t TYPE = readValue<uint16_t>(ENTRY + 6);
+			if (static_cast<uint64_t>(OFFSET) + LENGTH > mStringSize || TYPE >= static_cast<uint16_t>(ResourceType::Count)) {
+				AEON_LOG_ERROR("Corrupted prefab", "A resource of the prefab \"" + filepath + "\" is invalid.\nAborting operation.");
+				unload();
+				return false;
+			}
+
+			mResources.push_back(Resource{ std::string(mStrings + OFFSET, LENGTH), nullptr, nullptr, TYPE == static_cast<uint16_t>(ResourceType::Font) });
+		}
+
+		// The nodes are only validated once so that the instantiations read them as-is
+		if (!validateNodes()) {
+			AEON_LOG_ERROR("Corrupted prefab", "A node of the prefab \"" + filepath + "\" is invalid.\nAborting operation.");
+			unload();
+			return false;
+		}
+
+		// Retrieve the textures shared with the rest of the application, the missing ones being loaded
+		GLResourceFactory& glResourceFactory = GLResourceFactory::getInstance();
+		for (Resource& resource : mResources) {
+			if (resource.isFont) {
+				continue;
+			}
+
+			resource.texture = glResourceFactory.get<Texture2D>(resource.path);
+			if (!resource.texture) {
+				resource.texture = glResourceFactory.create<Texture2D>(resource.path);
+				if (resource.texture) {
+					resource.texture->loadFromFile(resource.path);
+				}
+			}
+		}
+
+		mFilepath = filepath;
+		return true;
+	}
+
+	bool Prefab::bindFont(const std::string& filename, Font& font)
+	{
+		bool referenced = false;
+		for (Resource& resource : mResources) {
+			if (resource.isFont && resource.path == filename) {
+				resource.font = &font;
+				referenced = true;
+			}
+		}
+
+		return referenced;
+	}
+
+	std::unique_ptr<Actor2D> Prefab::instantiate() const
+	{
+		// Check if a prefab was loaded
+		if (!isLoaded()) {
+			AEON_LOG_ERROR("No prefab loaded", "A prefab must be loaded before being instantiated.\nReturning nullptr.");
+			return nullptr;
+		}
+		AEON_PROFILE_SCOPE("Prefab::instantiate");
+		AEON_MEMORY_SCOPE(MemoryTag::SceneGraph);
+
+		// The nodes are created in pre-order, so each node's parent was created beforehand
+		std::vector<Actor2D*> nodes(mNodeCount);
+		std::unique_ptr<Actor2D> root;
+		size_t unboundCount = 0;
+		for (uint32_t i = 0; i < mNodeCount; ++i)
+		{
+			const NodeRecord RECORD = readRecord(mNodes, i);
+			const Texture2D* texture = nullptr;
+			Font* font = nullptr;
+			if (RECORD.resource != NO_RESOURCE) {
+				const Resource& RESOURCE = mResources[RECORD.resource];
+				texture = RESOURCE.texture.get();
+				font = RESOURCE.font;
+				unboundCount += (RESOURCE.isFont && !font);
+			}
+
+			// Create the node and apply its properties
+			std::unique_ptr<Actor2D> node = createNode(RECORD, texture, font, mStrings);
+			node->setPosition(RECORD.position[0], RECORD.position[1]);
+			node->setRotation(RECORD.rotation);
+			node->setScale(RECORD.scale[0], RECORD.scale[1]);
+			node->setOriginFlags(RECORD.originFlags);
+			node->mStatic = (RECORD.flags & NodeFlag::Static) != 0;
+			node->mCullable = (RECORD.flags & NodeFlag::Cullable) != 0;
+			node->mLayer = std::make_pair((RECORD.flags & NodeFlag::Layered) != 0, static_cast<int>(RECORD.layer));
+			node->mChildren.reserve(RECORD.childCount);
+			nodes[i] = node.get();
+
+			if (i == 0) {
+				root = std::move(node);
+				continue;
+			}
+
+			// Link the node to its parent, the new nodes being already flagged for their first update, layout and rendering
+			Actor2D* const parent = nodes[RECORD.parent];
+			node->mParent = parent;
+			node->mUpdateDepth = true;
+			parent->mUpdateSubtreeDepth = true;
+			parent->mChildren.push_back(std::move(node));
+		}
+
+		if (unboundCount > 0) {
+			AEON_LOG_WARNING("Unbound prefab fonts", std::to_string(unboundCount) + " texts of the prefab \"" + mFilepath + "\" reference a font that wasn't bound.");
+		}
+
+		return root;
+	}
+
+	bool Prefab::isLoaded() const noexcept
+	{
+		return mMapping.isOpen();
+	}
+
+	size_t Prefab::getNodeCount() const noexcept
+	{
+		return (isLoaded()) ? mNodeCount : 0;
+	}
+
+	const std::string& Prefab::getFilepath() const noexcept
+	{
+		return mFilepath;
+	}
+
+	// Public static method(s)
+	bool Prefab::save(const Actor2D& root, const std::string& filepath)
+	{
+		AEON_PROFILE_SCOPE("Prefab::save");
+
+		std::vector<NodeRecord> records;
+		std::vector<ResourceEntry> resources;
+		std::unordered_map<std::string, uint32_t> resourceIndices[static_cast<size_t>(ResourceType::Count)];
+		std::string strings;
+		size_t unsupportedCount = 0;
+
+		// Store each resource's path once
+		auto addResource = [&](const std::string& path, ResourceType type) -> uint32_t {
+			if (path.empty() || path.size() > std::numeric_limits<uint16_t>::max()) {
+				return NO_RESOURCE;
+			}
+
+			auto inserted = resourceIndices[static_cast<size_t>(type)].try_emplace(path, static_cast<uint32_t>(resources.size()));
+			if (inserted.second) {
+				resources.push_back(ResourceEntry{ static_cast<uint32_t>(strings.size()), static_cast<uint16_t>(path.size()), type });
+				strings += path;
+			}
+			return inserted.first->second;
+		};
+
+		// Traverse the tree in pre-order, the children being pushed in reverse so that they're stored in their order
+		std::vector<std::pair<const Actor2D*, uint32_t>> stack{ std::make_pair(&root, NO_PARENT) };
+		while (!stack.empty())
+		{
+			const auto [NODE, PARENT] = stack.back();
+			stack.pop_back();
+
+			NodeRecord record{};
+			record.parent = PARENT;
+			record.type = static_cast<uint8_t>(NodeType::Actor);
+			record.flags = static_cast<uint8_t>((NODE->isStatic() ? NodeFlag::Static : 0) | (NODE->isCullable() ? NodeFlag::Cullable : 0) | (NODE->mLayer.first ? NodeFlag::Layered : 0));
+			record.layer = NODE->mLayer.second;
+			record.originFlags = NODE->getOriginFlags();
+			record.position[0] = NODE->getPosition().x;
+			record.position[1] = NODE->getPosition().y;
+			record.rotation = NODE->getRotation();
+			record.scale[0] = NODE->getScale().x;
+			record.scale[1] = NODE->getScale().y;
+			record.resource = NO_RESOURCE;
+
+			// Store the render data of the built-in types
+			const std::type_info& TYPE = typeid(*NODE);
+			if (TYPE == typeid(Sprite)) {
+				const Sprite& SPRITE = static_cast<const Sprite&>(*NODE);
+				const Box2f& RECT = SPRITE.getTextureRect();
+				record.type = static_cast<uint8_t>(NodeType::Sprite);
+				record.resource = (SPRITE.getTexture()) ? addResource(SPRITE.getTexture()->getFilepath(), ResourceType::Texture) : NO_RESOURCE;
+				record.textureRect[0] = RECT.min.x;
+				record.textureRect[1] = RECT.min.y;
+				record.textureRect[2] = RECT.max.x;
+				record.textureRect[3] = RECT.max.y;
+				record.color = SPRITE.getColor().toHexcode();
+			}
+			else if (TYPE == typeid(Text)) {
+				const Text& TEXT = static_cast<const Text&>(*NODE);
+				record.type = static_cast<uint8_t>(NodeType::Text);
+				record.resource = (TEXT.getFont()) ? addResource(TEXT.getFont()->getFilename(), ResourceType::Font) : NO_RESOURCE;
+				record.color = TEXT.getColor().toHexcode();
+				record.characterSize = TEXT.getCharacterSize();
+				record.textOffset = static_cast<uint32_t>(strings.size());
+				record.textLength = static_cast<uint32_t>(TEXT.getText().size());
+				strings += TEXT.getText();
+			}
+			else if (TYPE == typeid(RectangleShape)) {
+				const RectangleShape& RECTANGLE = static_cast<const RectangleShape&>(*NODE);
+				record.type = static_cast<uint8_t>(NodeType::Rectangle);
+				record.resource = (RECTANGLE.getTexture()) ? addResource(RECTANGLE.getTexture()->getFilepath(), ResourceType::Texture) : NO_RESOURCE;
+				record.pointCount = static_cast<uint16_t>(RECTANGLE.getPointCount() / 4);
+				record.size[0] = RECTANGLE.getSize().x;
+				record.size[1] = RECTANGLE.getSize().y;
+				record.cornerRadius = RECTANGLE.getCornerRadius();
+				recordShape(record, RECTANGLE);
+			}
+			else if (TYPE == typeid(EllipseShape)) {
+				const EllipseShape& ELLIPSE = static_cast<const EllipseShape&>(*NODE);
+				record.type = static_cast<uint8_t>(NodeType::Ellipse);
+				record.resource = (ELLIPSE.getTexture()) ? addResource(ELLIPSE.getTexture()->getFilepath(), ResourceType::Texture) : NO_RESOURCE;
+				record.pointCount = static_cast<uint16_t>(ELLIPSE.getPointCount());
+				record.size[0] = ELLIPSE.getRadius().x;
+				record.size[1] = ELLIPSE.getRadius().y;
+				recordShape(record, ELLIPSE);
+			}
+			else if (TYPE != typeid(Actor2D)) {
+				++unsupportedCount;
+			}
+
+			const uint32_t INDEX = static_cast<uint32_t>(records.size());
+			if (PARENT != NO_PARENT) {
+				++records[PARENT].childCount;
+			}
+			records.push_back(record);
+
+			for (auto child = NODE->mChildren.rbegin(); child != NODE->mChildren.rend(); ++child) {
+				stack.emplace_back(child->get(), INDEX);
+			}
+		}
+
+		// Check that the string table can be indexed
+		if (strings.size() > std::numeric_limits<uint32_t>::max()) {
+			AEON_LOG_ERROR("Prefab too large", "The texts of the tree don't fit in a prefab.\nAborting operation.");
+			return false;
+		}
+
+		// Write out the header, the resources, the nodes and the string table
+		std::ofstream file(filepath, std::ios::binary | std::ios::trunc);
+		if (!file) {
+			AEON_LOG_ERROR("Invalid filepath", "Unable to create the prefab at \"" + filepath + "\".\nAborting operation.");
+			return false;
+		}
+
+		std::string header(PREFAB_IDENTIFIER, sizeof(PREFAB_IDENTIFIER));
+		appendValue<uint32_t>(header, PREFAB_VERSION);
+		appendValue<uint32_t>(header, static_cast<uint32_t>(records.size()));
+		appendValue<uint32_t>(header, static_cast<uint32_t>(resources.size()));
+		appendValue<uint32_t>(header, static_cast<uint32_t>(strings.size()));
+		for (const ResourceEntry& RESOURCE : resources) {
+			appendValue<uint32_t>(header, RESOURCE.offset);
+			appendValue<uint16_t>(header, RESOURCE.length);
+			appendValue<uint16_t>(header, static_cast<uint16_t>(RESOURCE.type));
+		}
+		file.write(header.data(), static_cast<std::streamsize>(header.size()));
+		file.write(reinterpret_cast<const char*>(records.data()), static_cast<std::streamsize>(records.size() * NODE_SIZE));
+		file.write(strings.data(), static_cast<std::streamsize>(strings.size()));
+
+		if (unsupportedCount > 0) {
+			AEON_LOG_WARNING("Unsupported prefab nodes", std::to_string(unsupportedCount) + " nodes aren't of a built-in type, they were saved as plain actors.");
+		}
+
+		return static_cast<bool>(file);
+	}
+
+	// Private method(s)
+	bool Prefab::validateNodes() const
+	{
+		for (uint32_t i = 0; i < mNodeCount; ++i) {
+			const NodeRecord RECORD = readRecord(mNodes, i);
+			const bool IS_TEXT = RECORD.type == static_cast<uint8_t>(NodeType::Text);
+			const bool VALID_PARENT = (i == 0) ? RECORD.parent == NO_PARENT : RECORD.parent < i;
+			const bool VALID_TYPE = RECORD.type < static_cast<uint8_t>(NodeType::Count);
+			const bool VALID_RESOURCE = RECORD.resource == NO_RESOURCE || (RECORD.type != static_cast<uint8_t>(NodeType::Actor)
+			                                                              && RECORD.resource < mResources.size() && mResources[RECORD.resource].isFont == IS_TEXT);
+			const bool VALID_TEXT = !IS_TEXT || static_cast<uint64_t>(RECORD.textOffset) + RECORD.textLength <= mStringSize;
+			if (!VALID_PARENT || !VALID_TYPE || !VALID_RESOURCE || !VALID_TEXT) {
+				return false;
+			}
+		}
+
+		return true;
+	}
+
+	void Prefab::unload() noexcept
+	{
+		mMapping.close();
+		mNodes = nullptr;
+		mStrings = nullptr;
+		mStringSize = 0;
+		mNodeCount = 0;
+		mResources.clear();
+		mFilepath.clear();
+	}
+}
\ No newline at end of file
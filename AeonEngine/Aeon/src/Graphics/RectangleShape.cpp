@@ -24,9 +24,30 @@
 
 namespace ae
 {
+	namespace
+	{
+		// Rotates the point of the unit quarter circle provided by a quarter turn for each corner, counter-clockwise starting from the top-right one
+		Vector2f rotateToCorner(const Vector2f& point, size_t corner) noexcept
+		{
+			switch (corner)
+			{
+			default:
+			case 0:
+				return point;
+			case 1:
+				return Vector2f(-point.y,  point.x);
+			case 2:
+				return Vector2f(-point.x, -point.y);
+			case 3:
+				return Vector2f( point.y, -point.x);
+			}
+		}
+	}
+
 	// Public constructor(s)
 	RectangleShape::RectangleShape(const Vector2f& size, float cornerRadius, size_t cornerPointCount)
 		: Shape()
+		, mUnitCornerPoints(getUnitCornerArc(cornerPointCount))
 		, mSize(size)
 		, mCornerRadius(cornerRadius)
 		, mCornerPointCount(cornerPointCount)
@@ -35,6 +56,7 @@ namespace ae
 
 	RectangleShape::RectangleShape(RectangleShape&& rvalue) noexcept
 		: Shape(std::move(rvalue))
+		, mUnitCornerPoints(std::move(rvalue.mUnitCornerPoints))
 		, mSize(std::move(rvalue.mSize))
 		, mCornerRadius(rvalue.mCornerRadius)
 		, mCornerPointCount(rvalue.mCornerPointCount)
@@ -46,6 +68,7 @@ namespace ae
 	{
 		// Copy the rvalue's trivial data and move the rest
 		Shape::operator=(std::move(rvalue));
+		mUnitCornerPoints = std::move(rvalue.mUnitCornerPoints);
 		mSize = std::move(rvalue.mSize);
 		mCornerRadius = rvalue.mCornerRadius;
 		mCornerPointCount = rvalue.mCornerPointCount;
@@ -58,6 +81,7 @@ namespace ae
 	{
 		mSize = size;
 		mUpdatePositions = true;
+		wake();
 	}
 
 	void RectangleShape::setSize(float sizeX, float sizeY) noexcept
@@ -65,18 +89,22 @@ namespace ae
 		mSize.x = sizeX;
 		mSize.y = sizeY;
 		mUpdatePositions = true;
+		wake();
 	}
 
 	void RectangleShape::setCornerRadius(float radius) noexcept
 	{
 		mCornerRadius = radius;
 		mUpdatePositions = true;
+		wake();
 	}
 
 	void RectangleShape::setCornerPointCount(size_t count) noexcept
 	{
+		mUnitCornerPoints = getUnitCornerArc(count);
 		mCornerPointCount = count;
 		mUpdatePositions = true;
+		wake();
 	}
 
 	const Vector2f& RectangleShape::getSize() const noexcept
@@ -104,10 +132,8 @@ namespace ae
 			}
 		}
 
-		const float DELTA_ANGLE = 90.f / (Math::max(static_cast<int>(mCornerPointCount) - 1, 1));
 		const size_t CENTER_INDEX = index / mCornerPointCount;
-		const size_t DELTA_INDEX = index - CENTER_INDEX;
-		const float FINAL_ANGLE = Math::toRadians(DELTA_ANGLE * DELTA_INDEX);
+		const Vector2f DIRECTION = rotateToCorner((*mUnitCornerPoints)[index - CENTER_INDEX * mCornerPointCount], CENTER_INDEX);
 
 		Vector2f center;
 		switch (CENTER_INDEX)
@@ -126,7 +152,46 @@ namespace ae
 			center = Vector2f(mSize.x - mCornerRadius, mSize.y - mCornerRadius);
 		}
 
-		return Vector2f( mCornerRadius * Math::cos(FINAL_ANGLE) + center.x,
-		                -mCornerRadius * Math::sin(FINAL_ANGLE) + center.y);
+		return Vector2f( mCornerRadius * DIRECTION.x + center.x,
+		                -mCornerRadius * DIRECTION.y + center.y);
+	}
+
+	void RectangleShape::getPoints(Vector2f* points) const
+	{
+		// Scale, rotate and offset the unit quarter circle for each corner
+		const std::vector<Vector2f>& UNIT_POINTS = *mUnitCornerPoints;
+		const Vector2f CENTERS[4] = {
+			Vector2f(mSize.x - mCornerRadius, mCornerRadius),
+			Vector2f(mCornerRadius,           mCornerRadius),
+			Vector2f(mCornerRadius,           mSize.y - mCornerRadius),
+			Vector2f(mSize.x - mCornerRadius, mSize.y - mCornerRadius)
+		};
+
+		for (size_t corner = 0; corner < 4; ++corner) {
+			for (size_t i = 0; i < mCornerPointCount; ++i) {
+				const Vector2f DIRECTION = rotateToCorner(UNIT_POINTS[i], corner);
+				points[corner * mCornerPointCount + i] = Vector2f( mCornerRadius * DIRECTION.x + CENTERS[corner].x,
+				                                                  -mCornerRadius * DIRECTION.y + CENTERS[corner].y);
+			}
+		}
+	}
+	// Private virtual method(s)
+	float RectangleShape::getCurveRadius() const noexcept
+	{
+		return mCornerRadius;
+	}
+
+	void RectangleShape::applySegmentCount(size_t segmentCount)
+	{
+		// Each corner spans a quarter turn and includes both of its end points
+		const size_t CORNER_POINT_COUNT = (segmentCount + 3) / 4 + 1;
+		if (CORNER_POINT_COUNT != mCornerPointCount) {
+			setCornerPointCount(CORNER_POINT_COUNT);
+		}
+	}
+
+	std::unique_ptr<Actor2D> RectangleShape::cloneSelf() const
+	{
+		return std::make_unique<RectangleShape>(*this);
 	}
 }
\ No newline at end of file
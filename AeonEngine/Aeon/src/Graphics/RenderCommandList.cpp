@@ -0,0 +1,188 @@
+// MIT License
+// 
+// Copyright(c) 2019-2021 Filippos Gleglakos
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <AEON/Graphics/RenderCommandList.h>
+
+#include <AEON/Graphics/internal/Renderer2D.h>
+
+namespace ae
+{
+	// The command list into which the calling thread's submissions are recorded
+	static thread_local RenderCommandList* recordingList = nullptr;
+
+	// Public constructor(s)
+	RenderCommandList::RenderCommandList(Storage storage)
+		: mCommands()
+		, mScenes()
+		, mDrawcalls()
+		, mGeometries()
+		, mStorage(storage)
+		, mPreviousList(nullptr)
+	{
+	}
+
+	// Public method(s)
+	void RenderCommandList::beginRecording()
+	{
+		// Check if the list is already recording (ignored in Release mode)
+		if _CONSTEXPR_IF (AEON_DEBUG) {
+			if (recordingList == this) {
+				AEON_LOG_WARNING("Invalid recording", "The command list is already recording the calling thread's submissions.\nAborting operation.");
+				return;
+			}
+		}
+
+		mPreviousList = recordingList;
+		recordingList = this;
+	}
+
+	void RenderCommandList::endRecording()
+	{
+		// Check if the list is the calling thread's active recording list (ignored in Release mode)
+		if _CONSTEXPR_IF (AEON_DEBUG) {
+			if (recordingList != this) {
+				AEON_LOG_WARNING("Invalid recording termination", "The command list isn't recording the calling thread's submissions.\nAborting operation.");
+				return;
+			}
+		}
+
+		recordingList = mPreviousList;
+		mPreviousList = nullptr;
+	}
+
+	void RenderCommandList::record(const Vertex2DList& vertices, const std::vector<unsigned int>& indices, const RenderStates& states)
+	{
+		if (mStorage == Storage::Reference) {
+			mCommands.emplace_back(RenderCommand{ Type::Submit, nullptr, &vertices, &indices, states, 0 });
+			return;
+		}
+
+		// Only copy the geometry that's new or that has been modified since it was last copied
+		auto [geometryItr, inserted] = mGeometries.try_emplace(&vertices);
+		Geometry& geometry = geometryItr->second;
+		if (inserted || states.dirty) {
+			geometry.vertices = vertices;
+			geometry.indices = indices;
+		}
+		geometry.recorded = true;
+
+		mCommands.emplace_back(RenderCommand{ Type::Submit, nullptr, &geometry.vertices, &geometry.indices, states, 0 });
+	}
+
+	void RenderCommandList::recordDrawcall(std::function<void()> drawcall)
+	{
+		mCommands.emplace_back(RenderCommand{ Type::Draw, nullptr, nullptr, nullptr, RenderStates(), mDrawcalls.size() });
+		mDrawcalls.push_back(std::move(drawcall));
+	}
+
+	void RenderCommandList::recordSceneBegin(Renderer2D& renderer, RenderTarget& target, const Matrix4f& viewMatrix, const Matrix4f& projectionMatrix)
+	{
+		mCommands.emplace_back(RenderCommand{ Type::BeginScene, &renderer, nullptr, nullptr, RenderStates(), mScenes.size() });
+		mScenes.emplace_back(Scene{ &target, viewMatrix, projectionMatrix });
+	}
+
+	void RenderCommandList::recordSceneEnd(Renderer2D& renderer)
+	{
+		mCommands.emplace_back(RenderCommand{ Type::EndScene, &renderer, nullptr, nullptr, RenderStates(), 0 });
+	}
+
+	void RenderCommandList::submit()
+	{
+		// Forward the commands to the calling thread's recording list if it's recording
+		RenderCommandList* const recordingList = getRecordingList();
+
+		for (const RenderCommand& command : mCommands)
+		{
+			switch (command.type)
+			{
+			case Type::BeginScene:
+			{
+				const Scene& scene = mScenes[command.scene];
+				if (recordingList) {
+					recordingList->recordSceneBegin(*command.renderer, *scene.target, scene.viewMatrix, scene.projectionMatrix);
+				}
+				else {
+					command.renderer->mCameraSnapshot = std::make_pair(true, std::make_pair(scene.viewMatrix, scene.projectionMatrix));
+					command.renderer->beginScene(*scene.target);
+				}
+				break;
+			}
+			case Type::EndScene:
+				if (recordingList) {
+					recordingList->recordSceneEnd(*command.renderer);
+				}
+				else {
+					command.renderer->endScene();
+				}
+				break;
+			case Type::Draw:
+				Renderer2D::drawToActive(std::move(mDrawcalls[command.scene]));
+				break;
+			default:
+				Renderer2D::submitToActive(*command.vertices, *command.indices, command.states);
+				break;
+			}
+		}
+
+		reset();
+	}
+
+	void RenderCommandList::clear() noexcept
+	{
+		reset();
+	}
+
+	const std::vector<RenderCommandList::RenderCommand>& RenderCommandList::getCommands() const noexcept
+	{
+		return mCommands;
+	}
+
+	const std::vector<RenderCommandList::Scene>& RenderCommandList::getScenes() const noexcept
+	{
+		return mScenes;
+	}
+
+	// Public static method(s)
+	RenderCommandList* const RenderCommandList::getRecordingList() noexcept
+	{
+		return recordingList;
+	}
+
+	// Private method(s)
+	void RenderCommandList::reset() noexcept
+	{
+		mCommands.clear();
+		mScenes.clear();
+		mDrawcalls.clear();
+
+		// Release the copies of the submitters that are no longer rendered
+		for (auto geometryItr = mGeometries.begin(); geometryItr != mGeometries.end();) {
+			if (!geometryItr->second.recorded) {
+				geometryItr = mGeometries.erase(geometryItr);
+			}
+			else {
+				geometryItr->second.recorded = false;
+				++geometryItr;
+			}
+		}
+	}
+}
\ No newline at end of file
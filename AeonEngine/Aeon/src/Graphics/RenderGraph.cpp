@@ -0,0 +1,350 @@
+// MIT License
+// 
+// Copyright(c) 2019-2021 Filippos Gleglakos
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <AEON/Graphics/RenderGraph.h>
+
+#include <algorithm>
+
+#include <AEON/System/Profiler.h>
+#include <AEON/Graphics/RenderTexture.h>
+#include <AEON/Graphics/GPUProfiler.h>
+#include <AEON/Graphics/internal/Renderer2D.h>
+
+namespace ae
+{
+	// RenderGraph::TargetDescription
+		// Public constructor(s)
+	RenderGraph::TargetDescription::TargetDescription(const Vector2i& size, Texture2D::InternalFormat colorFormat,
+	                                                  Texture2D::InternalFormat depthFormat, Texture2D::InternalFormat stencilFormat)
+		: size(size)
+		, colorFormat(colorFormat)
+		, depthFormat(depthFormat)
+		, stencilFormat(stencilFormat)
+		, clearColor(Color::Transparent)
+	{
+	}
+
+		// Public method(s)
+	bool RenderGraph::TargetDescription::isCompatible(const TargetDescription& other) const noexcept
+	{
+		return size == other.size && colorFormat == other.colorFormat && depthFormat == other.depthFormat && stencilFormat == other.stencilFormat;
+	}
+
+	// RenderGraph
+		// Public constructor(s)
+	RenderGraph::RenderGraph()
+		: mResources()
+		, mPasses()
+		, mOrder()
+		, mTransientTextures()
+		, mCulledCount(0)
+		, mCompiled(false)
+	{
+	}
+
+	RenderGraph::RenderGraph(RenderGraph&& rvalue) noexcept = default;
+
+	RenderGraph::~RenderGraph() = default;
+
+		// Public operator(s)
+	RenderGraph& RenderGraph::operator=(RenderGraph&& rvalue) noexcept = default;
+
+		// Public method(s)
+	RenderGraph::Resource RenderGraph::importTarget(RenderTarget& target)
+	{
+		mResources.push_back(ResourceNode{ &target, nullptr, TargetDescription(target.getFramebufferSize()), InvalidResource, true });
+		mCompiled = false;
+		return mResources.size() - 1;
+	}
+
+	RenderGraph::Resource RenderGraph::importTarget(RenderTexture& texture)
+	{
+		mResources.push_back(ResourceNode{ &texture, &texture, TargetDescription(texture.getFramebufferSize()), InvalidResource, true });
+		mCompiled = false;
+		return mResources.size() - 1;
+	}
+
+	RenderGraph::Resource RenderGraph::createTarget(const TargetDescription& description)
+	{
+		// Check that the dimensions are valid
+		if (description.size.x <= 0 || description.size.y <= 0) {
+			AEON_LOG_ERROR("Invalid dimensions", "The dimensions " + std::to_string(description.size.x) + "x" + std::to_string(description.size.y) + " of the transient render target are invalid.\nReturning an invalid resource.");
+			return InvalidResource;
+		}
+
+		mResources.push_back(ResourceNode{ nullptr, nullptr, description, InvalidResource, false });
+		mCompiled = false;
+		return mResources.size() - 1;
+	}
+
+	void RenderGraph::addPass(const std::string& name, Renderer2D& renderer, const std::vector<Resource>& inputs, Resource output, PassFunction function)
+	{
+		// Check that the resources exist and that the pass doesn't read its own output
+		if (!isValid(output)) {
+			AEON_LOG_ERROR("Invalid pass output", "The output of the pass \"" + name + "\" isn't a resource of the graph.\nAborting operation.");
+			return;
+		}
+		for (const Resource input : inputs) {
+			if (!isValid(input) || (mResources[input].imported && !mResources[input].texture)) {
+				AEON_LOG_ERROR("Invalid pass input", "An input of the pass \"" + name + "\" isn't a texture resource of the graph.\nAborting operation.");
+				return;
+			}
+			if (input == output) {
+				AEON_LOG_ERROR("Invalid pass input", "The pass \"" + name + "\" can't read the resource it renders into.\nAborting operation.");
+				return;
+			}
+		}
+
+		mPasses.push_back(PassNode{ name, &renderer, inputs, output, std::move(function) });
+		mCompiled = false;
+	}
+
+	void RenderGraph::compile()
+	{
+		AEON_PROFILE_SCOPE("RenderGraph::compile");
+
+		sortPasses();
+		cullPasses();
+		assignTransientTextures();
+		mCompiled = true;
+	}
+
+	void RenderGraph::execute()
+	{
+		AEON_PROFILE_SCOPE("RenderGraph::execute");
+
+		if (!mCompiled) {
+			compile();
+		}
+
+		// Execute the passes, the consecutive ones sharing an output and a renderer being merged into a single scene
+		for (size_t i = 0; i < mOrder.size();)
+		{
+			const PassNode& first = mPasses[mOrder[i]];
+			ResourceNode& output = mResources[first.output];
+			if (!output.imported) {
+				output.target->setClearColor(output.description.clearColor);
+			}
+
+			AEON_PROFILE_GPU_SCOPE(first.name);
+			first.renderer->beginScene(*output.target);
+			size_t j = i;
+			for (; j < mOrder.size(); ++j) {
+				const PassNode& pass = mPasses[mOrder[j]];
+				if (pass.output != first.output || pass.renderer != first.renderer) {
+					break;
+				}
+				pass.function(*this);
+			}
+			first.renderer->endScene();
+			i = j;
+		}
+	}
+
+	void RenderGraph::reset()
+	{
+		mResources.clear();
+		mPasses.clear();
+		mOrder.clear();
+		mCulledCount = 0;
+		mCompiled = false;
+	}
+
+	const Texture2D* RenderGraph::getTexture(Resource resource) const
+	{
+		if (!isValid(resource) || !mResources[resource].texture) {
+			return nullptr;
+		}
+		return mResources[resource].texture->getTexture();
+	}
+
+	size_t RenderGraph::getExecutedPassCount() const noexcept
+	{
+		return mOrder.size();
+	}
+
+	size_t RenderGraph::getCulledPassCount() const noexcept
+	{
+		return mCulledCount;
+	}
+
+	size_t RenderGraph::getTransientTextureCount() const noexcept
+	{
+		return mTransientTextures.size();
+	}
+
+		// Private method(s)
+	bool RenderGraph::isValid(Resource resource) const noexcept
+	{
+		return resource < mResources.size();
+	}
+
+	void RenderGraph::sortPasses()
+	{
+		// A pass depends on the earlier passes writing into the resources it reads or writes, and on the earlier passes reading the resource it writes
+		const size_t PASS_COUNT = mPasses.size();
+		std::vector<std::vector<size_t>> dependents(PASS_COUNT);
+		std::vector<size_t> dependencyCounts(PASS_COUNT, 0);
+		for (size_t j = 0; j < PASS_COUNT; ++j) {
+			const PassNode& later = mPasses[j];
+			for (size_t i = 0; i < j; ++i) {
+				const PassNode& earlier = mPasses[i];
+				const bool WRITE_AFTER_WRITE = earlier.output == later.output;
+				const bool READ_AFTER_WRITE = std::find(later.inputs.begin(), later.inputs.end(), earlier.output) != later.inputs.end();
+				const bool WRITE_AFTER_READ = std::find(earlier.inputs.begin(), earlier.inputs.end(), later.output) != earlier.inputs.end();
+				if (WRITE_AFTER_WRITE || READ_AFTER_WRITE || WRITE_AFTER_READ) {
+					dependents[i].push_back(j);
+					++dependencyCounts[j];
+				}
+			}
+		}
+
+		// Schedule the ready passes, preferring the one continuing the previous pass' scene and the declaration order otherwise
+		mOrder.clear();
+		mOrder.reserve(PASS_COUNT);
+		std::vector<size_t> ready;
+		for (size_t i = 0; i < PASS_COUNT; ++i) {
+			if (dependencyCounts[i] == 0) {
+				ready.push_back(i);
+			}
+		}
+		while (!ready.empty())
+		{
+			auto selected = ready.begin();
+			if (!mOrder.empty()) {
+				const PassNode& previous = mPasses[mOrder.back()];
+				auto continuing = std::find_if(ready.begin(), ready.end(), [this, &previous](size_t index) {
+					return mPasses[index].output == previous.output && mPasses[index].renderer == previous.renderer;
+				});
+				if (continuing != ready.end()) {
+					selected = continuing;
+				}
+			}
+
+			const size_t INDEX = *selected;
+			ready.erase(selected);
+			mOrder.push_back(INDEX);
+			for (const size_t dependent : dependents[INDEX]) {
+				if (--dependencyCounts[dependent] == 0) {
+					ready.insert(std::upper_bound(ready.begin(), ready.end(), dependent), dependent);
+				}
+			}
+		}
+	}
+
+	void RenderGraph::cullPasses()
+	{
+		// Walk the passes backwards, a pass being kept if it renders into an imported resource or into one read by a pass kept
+		std::vector<bool> required(mResources.size(), false);
+		std::vector<size_t> kept;
+		kept.reserve(mOrder.size());
+		for (auto passItr = mOrder.rbegin(); passItr != mOrder.rend(); ++passItr) {
+			const PassNode& pass = mPasses[*passItr];
+			if (!mResources[pass.output].imported && !required[pass.output]) {
+				continue;
+			}
+
+			kept.push_back(*passItr);
+			for (const Resource input : pass.inputs) {
+				required[input] = true;
+			}
+		}
+
+		mCulledCount = mOrder.size() - kept.size();
+		mOrder.assign(kept.rbegin(), kept.rend());
+	}
+
+	void RenderGraph::assignTransientTextures()
+	{
+		// Compute the lifetime of every transient resource (the positions of the first and last passes using it)
+		std::vector<std::pair<size_t, size_t>> lifetimes(mResources.size(), std::make_pair(InvalidResource, 0));
+		for (size_t position = 0; position < mOrder.size(); ++position) {
+			const PassNode& pass = mPasses[mOrder[position]];
+			auto extendLifetime = [&lifetimes, position](Resource resource) {
+				lifetimes[resource].first = std::min(lifetimes[resource].first, position);
+				lifetimes[resource].second = position;
+			};
+
+			extendLifetime(pass.output);
+			for (const Resource input : pass.inputs) {
+				extendLifetime(input);
+			}
+		}
+
+		// Assign the transient resources by order of first use, reusing a compatible texture whose last use precedes it
+		std::vector<Resource> transients;
+		for (Resource resource = 0; resource < mResources.size(); ++resource) {
+			ResourceNode& node = mResources[resource];
+			if (!node.imported) {
+				node.target = nullptr;
+				node.texture = nullptr;
+				node.physical = InvalidResource;
+				if (lifetimes[resource].first != InvalidResource) {
+					transients.push_back(resource);
+				}
+			}
+		}
+		std::sort(transients.begin(), transients.end(), [&lifetimes](Resource a, Resource b) { return lifetimes[a].first < lifetimes[b].first; });
+
+		std::vector<bool> used(mTransientTextures.size(), false);
+		for (const Resource resource : transients) {
+			ResourceNode& node = mResources[resource];
+			size_t physical = 0;
+			for (; physical < mTransientTextures.size(); ++physical) {
+				const TransientTexture& transient = mTransientTextures[physical];
+				if ((!used[physical] || transient.lastUse < lifetimes[resource].first) && transient.description.isCompatible(node.description)) {
+					break;
+				}
+			}
+
+			// Create a new render texture if none are available
+			if (physical == mTransientTextures.size()) {
+				auto texture = std::make_unique<RenderTexture>(node.description.colorFormat, node.description.depthFormat, node.description.stencilFormat);
+				texture->create(node.description.size.x, node.description.size.y);
+				mTransientTextures.push_back(TransientTexture{ std::move(texture), node.description, 0 });
+				used.push_back(false);
+			}
+
+			used[physical] = true;
+			mTransientTextures[physical].lastUse = lifetimes[resource].second;
+			node.physical = physical;
+		}
+
+		// Release the render textures no longer used and assign the remaining ones to their resources
+		std::vector<size_t> remapping(mTransientTextures.size(), InvalidResource);
+		size_t usedCount = 0;
+		for (size_t physical = 0; physical < mTransientTextures.size(); ++physical) {
+			if (used[physical]) {
+				remapping[physical] = usedCount;
+				mTransientTextures[usedCount++] = std::move(mTransientTextures[physical]);
+			}
+		}
+		mTransientTextures.erase(mTransientTextures.begin() + usedCount, mTransientTextures.end());
+
+		for (const Resource resource : transients) {
+			ResourceNode& node = mResources[resource];
+			node.physical = remapping[node.physical];
+			node.texture = mTransientTextures[node.physical].texture.get();
+			node.target = node.texture;
+		}
+	}
+}
\ No newline at end of file
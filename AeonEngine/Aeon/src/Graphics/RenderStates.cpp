@@ -29,8 +29,13 @@ namespace ae
 		: blendMode(BlendMode::BlendAlpha)
 		, transform(Matrix4f::identity())
 		, texture(nullptr)
+		, sampler(nullptr)
 		, shader(nullptr)
+		, transparency(Transparency::Auto)
+		, layer(0)
+		, clipRect(0, 0, 0, 0)
 		, dirty(false)
+		, culling(true)
 	{
 	}
 
@@ -38,8 +43,13 @@ namespace ae
 		: blendMode(blendMode)
 		, transform(Matrix4f::identity())
 		, texture(nullptr)
+		, sampler(nullptr)
 		, shader(nullptr)
+		, transparency(Transparency::Auto)
+		, layer(0)
+		, clipRect(0, 0, 0, 0)
 		, dirty(false)
+		, culling(true)
 	{
 	}
 
@@ -47,8 +57,13 @@ namespace ae
 		: blendMode(BlendMode::BlendAlpha)
 		, transform(transform)
 		, texture(nullptr)
+		, sampler(nullptr)
 		, shader(nullptr)
+		, transparency(Transparency::Auto)
+		, layer(0)
+		, clipRect(0, 0, 0, 0)
 		, dirty(false)
+		, culling(true)
 	{
 	}
 
@@ -56,8 +71,13 @@ namespace ae
 		: blendMode(BlendMode::BlendAlpha)
 		, transform(Matrix4f::identity())
 		, texture(&texture)
+		, sampler(nullptr)
 		, shader(nullptr)
+		, transparency(Transparency::Auto)
+		, layer(0)
+		, clipRect(0, 0, 0, 0)
 		, dirty(false)
+		, culling(true)
 	{
 	}
 
@@ -65,8 +85,13 @@ namespace ae
 		: blendMode(BlendMode::BlendAlpha)
 		, transform(Matrix4f::identity())
 		, texture(nullptr)
+		, sampler(nullptr)
 		, shader(&shader)
+		, transparency(Transparency::Auto)
+		, layer(0)
+		, clipRect(0, 0, 0, 0)
 		, dirty(false)
+		, culling(true)
 	{
 	}
 
@@ -74,8 +99,13 @@ namespace ae
 		: blendMode(blendMode)
 		, transform(transform)
 		, texture(&texture)
+		, sampler(nullptr)
 		, shader(&shader)
+		, transparency(Transparency::Auto)
+		, layer(0)
+		, clipRect(0, 0, 0, 0)
 		, dirty(false)
+		, culling(true)
 	{
 	}
 
@@ -83,8 +113,13 @@ namespace ae
 		: blendMode(std::move(rvalue.blendMode))
 		, transform(std::move(rvalue.transform))
 		, texture(rvalue.texture)
+		, sampler(rvalue.sampler)
 		, shader(rvalue.shader)
+		, transparency(rvalue.transparency)
+		, layer(rvalue.layer)
+		, clipRect(rvalue.clipRect)
 		, dirty(rvalue.dirty)
+		, culling(rvalue.culling)
 	{
 	}
 
@@ -95,8 +130,13 @@ namespace ae
 		blendMode = std::move(rvalue.blendMode);
 		transform = std::move(rvalue.transform);
 		texture = rvalue.texture;
+		sampler = rvalue.sampler;
 		shader = rvalue.shader;
+		transparency = rvalue.transparency;
+		layer = rvalue.layer;
+		clipRect = rvalue.clipRect;
 		dirty = rvalue.dirty;
+		culling = rvalue.culling;
 
 		return *this;
 	}
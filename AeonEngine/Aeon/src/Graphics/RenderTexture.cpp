@@ -22,22 +22,37 @@
 
 #include <AEON/Graphics/RenderTexture.h>
 
+#include <cstring>
+#include <algorithm>
+
+#include <GL/glew.h>
+
 #include <AEON/Window/ContextSettings.h>
+#include <AEON/Graphics/internal/GLCommon.h>
 #include <AEON/Graphics/GLResourceFactory.h>
 #include <AEON/Graphics/Camera2D.h>
 
 namespace ae
 {
 	// Public constructor(s)
-	RenderTexture::RenderTexture(Texture2D::InternalFormat colorFormat, Texture2D::InternalFormat depthFormat, Texture2D::InternalFormat stencilFormat)
+	RenderTexture::RenderTexture(Texture2D::InternalFormat colorFormat, Texture2D::InternalFormat depthFormat, Texture2D::InternalFormat stencilFormat, int sampleCount)
 		: RenderTarget()
 		, mFramebuffer(nullptr)
 		, mTexture(nullptr)
 		, mDepthTexture(nullptr)
 		, mStencilTexture(nullptr)
+		, mMultisampled(nullptr)
 		, mColorFormat((colorFormat == Texture2D::InternalFormat::Native) ? Texture2D::InternalFormat::RGBA8 : colorFormat)
 		, mDepthFormat(depthFormat)
 		, mStencilFormat(stencilFormat)
+		, mSampleCount(std::max(sampleCount, 1))
+		, mLoadAction(LoadAction::Clear)
+		, mColorStore(StoreAction::Store)
+		, mDepthStencilStore(StoreAction::Store)
+		, mReadbackBuffer(nullptr)
+		, mReadbackFence(nullptr)
+		, mReadbackSize()
+		, mReadbackCapacity(0)
 	{
 		// Assign a 2D camera to the render target
 		setCamera(Camera2D(true));
@@ -49,10 +64,20 @@ namespace ae
 		, mTexture(std::move(rvalue.mTexture))
 		, mDepthTexture(std::move(rvalue.mDepthTexture))
 		, mStencilTexture(std::move(rvalue.mStencilTexture))
+		, mMultisampled(std::move(rvalue.mMultisampled))
 		, mColorFormat(rvalue.mColorFormat)
 		, mDepthFormat(rvalue.mDepthFormat)
 		, mStencilFormat(rvalue.mStencilFormat)
+		, mSampleCount(rvalue.mSampleCount)
+		, mLoadAction(rvalue.mLoadAction)
+		, mColorStore(rvalue.mColorStore)
+		, mDepthStencilStore(rvalue.mDepthStencilStore)
+		, mReadbackBuffer(std::move(rvalue.mReadbackBuffer))
+		, mReadbackFence(rvalue.mReadbackFence)
+		, mReadbackSize(std::move(rvalue.mReadbackSize))
+		, mReadbackCapacity(rvalue.mReadbackCapacity)
 	{
+		rvalue.mReadbackFence = nullptr;
 	}
 
 	// Public operator(s)
@@ -64,9 +89,19 @@ namespace ae
 		mTexture = std::move(rvalue.mTexture);
 		mDepthTexture = std::move(rvalue.mDepthTexture);
 		mStencilTexture = std::move(rvalue.mStencilTexture);
+		mMultisampled = std::move(rvalue.mMultisampled);
 		mColorFormat = rvalue.mColorFormat;
 		mDepthFormat = rvalue.mDepthFormat;
 		mStencilFormat = rvalue.mStencilFormat;
+		mSampleCount = rvalue.mSampleCount;
+		mLoadAction = rvalue.mLoadAction;
+		mColorStore = rvalue.mColorStore;
+		mDepthStencilStore = rvalue.mDepthStencilStore;
+		mReadbackBuffer = std::move(rvalue.mReadbackBuffer);
+		mReadbackFence = rvalue.mReadbackFence;
+		mReadbackSize = std::move(rvalue.mReadbackSize);
+		mReadbackCapacity = rvalue.mReadbackCapacity;
+		rvalue.mReadbackFence = nullptr;
 
 		return *this;
 	}
@@ -74,37 +109,26 @@ namespace ae
 	// Public method(s)
 	void RenderTexture::create(unsigned int width, unsigned int height)
 	{
-		// Create the framebuffer object
-		GLResourceFactory& factory = GLResourceFactory::getInstance();
-		mFramebuffer = factory.create<Framebuffer>("");
-		
-		// Create the color buffer texture
-		mTexture = factory.create<Texture2D>("", Texture2D::Filter::Nearest, Texture2D::Wrap::None, mColorFormat);
-		if (!mTexture->create(width, height)) {
-			AEON_LOG_ERROR("Invalid dimensions", "The dimensions " + std::to_string(width) + "x" + std::to_string(height) + " provided for the color buffer are invalid.");
-			return;
-		}
+		// Return the previous framebuffer and textures to the resource factory's pool so that they may be borrowed again
+		mFramebuffer.reset();
+		mTexture.reset();
+		mDepthTexture.reset();
+		mStencilTexture.reset();
+		mMultisampled.reset();
+		deactivate();
 
-		// Create the depth buffer and stencil buffer texture (if requested)
-		if (mDepthFormat != Texture2D::InternalFormat::Native) {
-			mDepthTexture = factory.create<Texture2D>("", Texture2D::Filter::Nearest, Texture2D::Wrap::None, mDepthFormat);
-			if (!mDepthTexture->create(width, height)) {
-				AEON_LOG_ERROR("Invalid dimensions", "The dimensions " + std::to_string(width) + "x" + std::to_string(height) + " provided for the depth buffer are invalid.");
-				return;
-			}
-		}
-		if (mStencilFormat != Texture2D::InternalFormat::Native) {
-			mStencilTexture = factory.create<Texture2D>("", Texture2D::Filter::Nearest, Texture2D::Wrap::None, mStencilFormat);
-			if (!mStencilTexture->create(width, height)) {
-				AEON_LOG_ERROR("Invalid dimensions", "The dimensions " + std::to_string(width) + "x" + std::to_string(height) + " provided for the stencil buffer are invalid.");
-				return;
-			}
+		// Borrow a framebuffer with its textures attached of the same dimensions, formats and sample count
+		GLResourceFactory::RenderTargetAttachments attachments = GLResourceFactory::getInstance().acquireRenderTarget(Vector2i(width, height), mColorFormat, mDepthFormat, mStencilFormat, mSampleCount);
+		if (!attachments.framebuffer) {
+			AEON_LOG_ERROR("Invalid dimensions", "The dimensions " + std::to_string(width) + "x" + std::to_string(height) + " provided for the render texture are invalid.");
+			return;
 		}
 
-		// Attach the textures created to the framebuffer
-		mFramebuffer->attachTexture(mTexture.get());
-		if (mDepthTexture) mFramebuffer->attachTexture(mDepthTexture.get());
-		if (mStencilTexture) mFramebuffer->attachTexture(mStencilTexture.get());
+		mFramebuffer = std::move(attachments.framebuffer);
+		mTexture = std::move(attachments.color);
+		mDepthTexture = std::move(attachments.depth);
+		mStencilTexture = std::move(attachments.stencil);
+		mMultisampled = std::move(attachments.multisampled);
 
 		// Set the framebuffer size
 		mFramebufferSize.x = width;
@@ -116,9 +140,156 @@ namespace ae
 		return mTexture.get();
 	}
 
+	void RenderTexture::requestReadback()
+	{
+		// Check if the render texture was created
+		if (!mTexture) {
+			AEON_LOG_ERROR("Invalid readback", "The render texture has yet to be created.\nAborting operation.");
+			return;
+		}
+
+		// (Re)Create the pixel pack buffer if the color buffer doesn't fit (the previous one is released by the resource factory once it's unused)
+		const int SIZE = mFramebufferSize.x * mFramebufferSize.y * 4;
+		if (!mReadbackBuffer || mReadbackCapacity < SIZE) {
+			mReadbackBuffer = GLResourceFactory::getInstance().create<Buffer>("", GL_PIXEL_PACK_BUFFER);
+			mReadbackBuffer->setStorage(SIZE, nullptr, GL_MAP_READ_BIT);
+			mReadbackCapacity = SIZE;
+		}
+
+		// Replace the pending readback
+		if (mReadbackFence) {
+			GLCall(glDeleteSync(static_cast<GLsync>(mReadbackFence)));
+		}
+
+		// Copy the color buffer into the pixel pack buffer and fence the copy
+		mReadbackBuffer->bind();
+		GLCall(glGetTextureImage(mTexture->getHandle(), 0, GL_RGBA, GL_UNSIGNED_BYTE, SIZE, nullptr));
+		mReadbackBuffer->unbind();
+		mReadbackFence = GLCall(glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0));
+		mReadbackSize = mFramebufferSize;
+	}
+
+	bool RenderTexture::retrieveReadback(std::vector<uint8_t>& pixels, bool wait)
+	{
+		if (!mReadbackFence) {
+			return false;
+		}
+
+		// Poll the fence (flushing the pending commands), or wait for up to a second at a time
+		GLsync sync = static_cast<GLsync>(mReadbackFence);
+		const GLuint64 TIMEOUT = (wait) ? 1000000000 : 0;
+		GLenum result;
+		do {
+			result = GLCall(glClientWaitSync(sync, GL_SYNC_FLUSH_COMMANDS_BIT, TIMEOUT));
+		} while (wait && result == GL_TIMEOUT_EXPIRED);
+
+		if (result == GL_TIMEOUT_EXPIRED) {
+			return false;
+		}
+		GLCall(glDeleteSync(sync));
+		mReadbackFence = nullptr;
+		if (result == GL_WAIT_FAILED) {
+			AEON_LOG_ERROR("Failed readback", "The readback's fence couldn't be waited upon.\nAborting operation.");
+			return false;
+		}
+
+		// Copy the texels out of the pixel pack buffer
+		const int SIZE = mReadbackSize.x * mReadbackSize.y * 4;
+		const void* const DATA = mReadbackBuffer->mapRange(0, SIZE, GL_MAP_READ_BIT);
+		if (!DATA) {
+			return false;
+		}
+
+		pixels.resize(static_cast<size_t>(SIZE));
+		std::memcpy(pixels.data(), DATA, pixels.size());
+		mReadbackBuffer->unmap();
+		return true;
+	}
+
+	bool RenderTexture::isReadbackPending() const noexcept
+	{
+		return mReadbackFence != nullptr;
+	}
+
+	void RenderTexture::setLoadAction(LoadAction action) noexcept
+	{
+		mLoadAction = action;
+	}
+
+	void RenderTexture::setStoreActions(StoreAction color, StoreAction depthStencil) noexcept
+	{
+		mColorStore = color;
+		mDepthStencilStore = depthStencil;
+	}
+
+	void RenderTexture::resolve() const
+	{
+		if (mMultisampled) {
+			mMultisampled->resolve(*mFramebuffer, mFramebufferSize);
+		}
+	}
+
+	bool RenderTexture::isMultisampled() const noexcept
+	{
+		return mSampleCount > 1;
+	}
+
 	// Public virtual method(s)
 	unsigned int RenderTexture::getFramebufferHandle() const noexcept
 	{
-		return mFramebuffer->getHandle();
+		return (mMultisampled) ? mMultisampled->getHandle() : mFramebuffer->getHandle();
+	}
+
+	bool RenderTexture::isOffscreen() const noexcept
+	{
+		return true;
+	}
+
+	void RenderTexture::storeContents()
+	{
+		if (!mFramebuffer) {
+			return;
+		}
+
+		// Resolve the multisampled color buffer before its contents may be invalidated
+		resolve();
+
+		// Invalidate the contents that aren't needed anymore
+		const bool INVALIDATE_COLOR = mColorStore == StoreAction::DontCare;
+		const bool INVALIDATE_DEPTH_STENCIL = mDepthStencilStore == StoreAction::DontCare;
+		if (INVALIDATE_COLOR || INVALIDATE_DEPTH_STENCIL) {
+			getRenderFramebuffer().invalidate(INVALIDATE_COLOR, INVALIDATE_DEPTH_STENCIL);
+		}
+	}
+
+	// Private virtual method(s)
+	void RenderTexture::loadContents()
+	{
+		switch (mLoadAction)
+		{
+		case LoadAction::Clear:
+			RenderTarget::loadContents();
+			break;
+		case LoadAction::DontCare:
+			getRenderFramebuffer().invalidate(true, true);
+			break;
+		default:
+			break;
+		}
+	}
+
+	void RenderTexture::onResize(const Vector2i& size)
+	{
+		// The previous attachments are kept rather than being destroyed by an invalid size (a minimized window's)
+		if (size.x <= 0 || size.y <= 0) {
+			return;
+		}
+
+		create(size.x, size.y);
+	}
+
+	const Framebuffer& RenderTexture::getRenderFramebuffer() const
+	{
+		return (mMultisampled) ? *mMultisampled : *mFramebuffer;
 	}
 }
\ No newline at end of file
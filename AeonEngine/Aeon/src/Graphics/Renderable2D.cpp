@@ -22,46 +22,174 @@
 
 #include <AEON/Graphics/Renderable2D.h>
 
+#include <mutex>
+#include <atomic>
+#include <algorithm>
+#include <cstring>
+#include <unordered_map>
+
+#include <AEON/Graphics/BatchRenderer2D.h>
+#include <AEON/Graphics/RenderCommandList.h>
+
 namespace ae
 {
+	namespace
+	{
+		// Whether the vertices of the renderables created are pooled
+		std::atomic<bool> geometryPooled(false);
+
+		// The memory resource supplied for the vertices of the renderables created, nullptr if none was
+		std::atomic<std::pmr::memory_resource*> geometryResource(nullptr);
+
+		// The lists of vertices shared by the renderables of identical geometry, associated to the hash of their vertices
+		std::unordered_multimap<uint64_t, std::weak_ptr<const Vertex2DList>> sharedVertexLists;
+		std::mutex sharedVertexMutex;
+		size_t sharedVertexSweep = 64;
+
+		// Compute the 64-bit FNV-1a hash of a list of vertices
+		uint64_t hashVertices(const Vertex2DList& vertices) noexcept
+		{
+			uint64_t hash = 0xCBF29CE484222325ull;
+			const uint8_t* const BYTES = reinterpret_cast<const uint8_t*>(vertices.data());
+			const size_t SIZE = sizeof(Vertex2D) * vertices.size();
+			for (size_t i = 0; i < SIZE; ++i) {
+				hash ^= BYTES[i];
+				hash *= 0x100000001B3ull;
+			}
+
+			return hash;
+		}
+	}
+
 	// Public constructor(s)
 	Renderable2D::~Renderable2D()
 	{
+		releaseProxy();
 	}
 
 	// Public method(s)
-	const std::vector<Vertex2D>& Renderable2D::getVertices() const noexcept
+	const Vertex2DList& Renderable2D::getVertices() const noexcept
 	{
-		return mVertices;
+		return (mSharedVertices) ? *mSharedVertices : mVertices;
 	}
 
 	const std::vector<unsigned int>& Renderable2D::getIndices() const noexcept
 	{
-		return mIndices;
+		return (mSharedIndices) ? *mSharedIndices : mIndices;
+	}
+
+	void Renderable2D::setRetained(bool flag)
+	{
+		mRetained = flag;
+		if (!mRetained) {
+			releaseProxy();
+		}
+		else if (mSharedVertices) {
+			// Copy the shared vertices as the proxy references the renderable's own list
+			static_cast<void>(getVertices());
+		}
+	}
+
+	bool Renderable2D::isRetained() const noexcept
+	{
+		return mRetained;
+	}
+
+	void Renderable2D::setRetainedVisible(bool flag)
+	{
+		mRetainedVisible = flag;
+		if (mProxy != BatchRenderer2D::InvalidProxy) {
+			BatchRenderer2D::getInstance().setProxyVisible(mProxy, mRetainedVisible);
+		}
+	}
+
+	// Public static method(s)
+	void Renderable2D::setGeometryPooled(bool flag) noexcept
+	{
+		geometryPooled.store(flag, std::memory_order_relaxed);
+	}
+
+	bool Renderable2D::isGeometryPooled() noexcept
+	{
+		return geometryPooled.load(std::memory_order_relaxed);
+	}
+
+	void Renderable2D::setGeometryResource(std::pmr::memory_resource* resource) noexcept
+	{
+		geometryResource.store(resource, std::memory_order_release);
 	}
 
 	// Protected constructor(s)
 	Renderable2D::Renderable2D() noexcept
-		: mVertices()
+		: mVertices(getGeometryResource())
+		, mSharedVertices(nullptr)
 		, mIndices()
+		, mSharedIndices(nullptr)
+		, mProxy(BatchRenderer2D::InvalidProxy)
 		, mDirty(true)
+		, mRetained(false)
+		, mRetainedVisible(true)
+	{
+	}
+
+	Renderable2D::Renderable2D(const Renderable2D& copy)
+		: mVertices(copy.mVertices, getGeometryResource())
+		, mSharedVertices(copy.mSharedVertices)
+		, mIndices(copy.mIndices)
+		, mSharedIndices(copy.mSharedIndices)
+		, mProxy(BatchRenderer2D::InvalidProxy)
+		, mDirty(copy.mDirty)
+		, mRetained(copy.mRetained)
+		, mRetainedVisible(copy.mRetainedVisible)
 	{
 	}
 
 	Renderable2D::Renderable2D(Renderable2D&& rvalue) noexcept
 		: mVertices(std::move(rvalue.mVertices))
+		, mSharedVertices(std::move(rvalue.mSharedVertices))
 		, mIndices(std::move(rvalue.mIndices))
+		, mSharedIndices(std::move(rvalue.mSharedIndices))
+		, mProxy(BatchRenderer2D::InvalidProxy)
 		, mDirty(rvalue.mDirty)
+		, mRetained(rvalue.mRetained)
+		, mRetainedVisible(rvalue.mRetainedVisible)
 	{
+		// The rvalue's proxy references the rvalue's lists, so a new proxy is registered once the renderable is rendered
+		rvalue.releaseProxy();
 	}
 
 	// Protected operator(s)
+	Renderable2D& Renderable2D::operator=(const Renderable2D& other)
+	{
+		// The own proxy is kept as it references the own lists, its geometry is rewritten once the renderable is rendered
+		mVertices = other.mVertices;
+		mSharedVertices = other.mSharedVertices;
+		mIndices = other.mIndices;
+		mSharedIndices = other.mSharedIndices;
+		mRetained = other.mRetained;
+		mRetainedVisible = other.mRetainedVisible;
+		if (!mRetained) {
+			releaseProxy();
+		}
+		mDirty = other.mDirty || mProxy != BatchRenderer2D::InvalidProxy;
+
+		return *this;
+	}
+
 	Renderable2D& Renderable2D::operator=(Renderable2D&& rvalue) noexcept
 	{
-		// Copy the rvalue's trivial data and move the rest
+		// Copy the rvalue's trivial data and move the rest (the rvalue's proxy references the rvalue's lists so it's released, the own one is kept)
 		mVertices = std::move(rvalue.mVertices);
+		mSharedVertices = std::move(rvalue.mSharedVertices);
 		mIndices = std::move(rvalue.mIndices);
-		mDirty = rvalue.mDirty;
+		mSharedIndices = std::move(rvalue.mSharedIndices);
+		mRetained = rvalue.mRetained;
+		mRetainedVisible = rvalue.mRetainedVisible;
+		if (!mRetained) {
+			releaseProxy();
+		}
+		mDirty = rvalue.mDirty || mProxy != BatchRenderer2D::InvalidProxy;
+		rvalue.releaseProxy();
 
 		return *this;
 	}
@@ -77,8 +205,14 @@ namespace ae
 		return mDirty;
 	}
 
-	std::vector<Vertex2D>& Renderable2D::getVertices() noexcept
+	Vertex2DList& Renderable2D::getVertices()
 	{
+		// Copy the shared vertices before they're modified
+		if (mSharedVertices) {
+			mVertices.assign(mSharedVertices->begin(), mSharedVertices->end());
+			mSharedVertices.reset();
+		}
+
 		return mVertices;
 	}
 
@@ -86,4 +220,90 @@ namespace ae
 	{
 		return mIndices;
 	}
+
+	void Renderable2D::setSharedIndices(std::shared_ptr<const std::vector<unsigned int>> indices) noexcept
+	{
+		mSharedIndices = std::move(indices);
+	}
+
+	void Renderable2D::shareVertices()
+	{
+		// The retained renderables' proxies reference their own list
+		if (mRetained || mSharedVertices || mVertices.empty()) {
+			return;
+		}
+
+		const uint64_t HASH = hashVertices(mVertices);
+		std::lock_guard<std::mutex> lock(sharedVertexMutex);
+
+		// Look for an identical list amongst the ones sharing the hash
+		auto range = sharedVertexLists.equal_range(HASH);
+		for (auto listItr = range.first; listItr != range.second; ++listItr) {
+			std::shared_ptr<const Vertex2DList> shared = listItr->second.lock();
+			if (shared && shared->size() == mVertices.size() && std::memcmp(shared->data(), mVertices.data(), sizeof(Vertex2D) * mVertices.size()) == 0) {
+				mSharedVertices = std::move(shared);
+				mVertices.clear();
+				mVertices.shrink_to_fit();
+				return;
+			}
+		}
+
+		// Remove the lists that are no longer shared once the table doubled in size
+		if (sharedVertexLists.size() >= sharedVertexSweep) {
+			for (auto listItr = sharedVertexLists.begin(); listItr != sharedVertexLists.end();) {
+				listItr = (listItr->second.expired()) ? sharedVertexLists.erase(listItr) : std::next(listItr);
+			}
+			sharedVertexSweep = std::max(sharedVertexLists.size() * 2, size_t(64));
+		}
+
+		// Hand the own list over to be shared
+		mSharedVertices = std::make_shared<const Vertex2DList>(std::move(mVertices));
+		sharedVertexLists.emplace(HASH, mSharedVertices);
+	}
+
+	void Renderable2D::submitGeometry(const RenderStates& states) const
+	{
+		// The recorded submissions are replayed by their command lists, so they're never retained
+		BatchRenderer2D* const renderer = (mRetained && !RenderCommandList::getRecordingList()) ? dynamic_cast<BatchRenderer2D*>(Renderer2D::getActiveInstance()) : nullptr;
+		if (!renderer) {
+			Renderer2D::submitToActive(getVertices(), getIndices(), states);
+			return;
+		}
+
+		// Register the proxy the first time it's submitted, only its modifications are pushed afterwards
+		if (mProxy == BatchRenderer2D::InvalidProxy) {
+			mProxy = renderer->registerProxy(getVertices(), getIndices(), states);
+			if (!mRetainedVisible) {
+				renderer->setProxyVisible(mProxy, false);
+			}
+		}
+		else {
+			renderer->updateProxy(mProxy, getVertices(), getIndices(), states);
+		}
+	}
+
+	// Protected static method(s)
+	std::pmr::memory_resource* Renderable2D::getGeometryResource()
+	{
+		std::pmr::memory_resource* const RESOURCE = geometryResource.load(std::memory_order_acquire);
+		if (RESOURCE) {
+			return RESOURCE;
+		}
+		if (!geometryPooled.load(std::memory_order_relaxed)) {
+			return std::pmr::new_delete_resource();
+		}
+
+		// The pool is never destroyed as renderables may outlive it otherwise (the lists larger than 64 KiB are allocated from the global heap)
+		static std::pmr::synchronized_pool_resource* const POOL = new std::pmr::synchronized_pool_resource(std::pmr::pool_options{ 4096, 64 * 1024 });
+		return POOL;
+	}
+
+	// Private method(s)
+	void Renderable2D::releaseProxy() const
+	{
+		if (mProxy != BatchRenderer2D::InvalidProxy) {
+			BatchRenderer2D::getInstance().unregisterProxy(mProxy);
+			mProxy = BatchRenderer2D::InvalidProxy;
+		}
+	}
 }
\ No newline at end of file
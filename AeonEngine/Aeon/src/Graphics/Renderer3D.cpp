@@ -0,0 +1,271 @@
+// MIT License
+// 
+// Copyright(c) 2019-2021 Filippos Gleglakos
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <AEON/Graphics/Renderer3D.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+#include <GL/glew.h>
+
+#include <AEON/System/Profiler.h>
+#include <AEON/Math/Frustum.h>
+#include <AEON/Graphics/internal/GLCommon.h>
+#include <AEON/Graphics/internal/RenderTarget.h>
+#include <AEON/Graphics/internal/Renderer2D.h>
+#include <AEON/Graphics/internal/UniformBuffer.h>
+#include <AEON/Graphics/internal/VertexArray.h>
+#include <AEON/Graphics/internal/VertexBuffer.h>
+#include <AEON/Graphics/internal/IndexBuffer.h>
+#include <AEON/Graphics/Camera.h>
+#include <AEON/Graphics/GLResourceFactory.h>
+#include <AEON/Graphics/GPUProfiler.h>
+#include <AEON/Graphics/Material.h>
+#include <AEON/Graphics/Mesh.h>
+#include <AEON/Graphics/Texture2D.h>
+
+namespace ae
+{
+	namespace
+	{
+		// Computes the world box enclosing the model box provided once transformed
+		Box3f computeWorldBox(const Box3f& modelBounds, const Matrix4f& transform) noexcept
+		{
+			const Vector3f HALF_SIZE = modelBounds.size * 0.5f;
+			const Vector3f MODEL_CENTER = modelBounds.position + HALF_SIZE;
+			const Vector4f CENTER = transform * Vector4f(MODEL_CENTER.x, MODEL_CENTER.y, MODEL_CENTER.z, 1.f);
+
+			// Each axis' extent is the sum of the transformed half-sizes' absolute components
+			Vector3f worldExtent;
+			for (size_t i = 0; i < 3; ++i) {
+				worldExtent[i] = std::abs(transform.columns[0][i]) * HALF_SIZE.x + std::abs(transform.columns[1][i]) * HALF_SIZE.y + std::abs(transform.columns[2][i]) * HALF_SIZE.z;
+			}
+
+			const Vector3f WORLD_CENTER(CENTER.x, CENTER.y, CENTER.z);
+			return Box3f(WORLD_CENTER - worldExtent, WORLD_CENTER + worldExtent);
+		}
+	}
+
+	// Public method(s)
+	void Renderer3D::beginScene(RenderTarget& target)
+	{
+		// Check if a scene is already being rendered (ignored in Release mode)
+		if _CONSTEXPR_IF (AEON_DEBUG) {
+			if (mRenderTarget) {
+				AEON_LOG_WARNING("Attempt to overwrite active scene", "A scene can't begin when another is currently being rendered.\nAborting operation.");
+				return;
+			}
+		}
+
+		mStatistics = Statistics();
+		mRenderTarget = &target;
+
+		// Upload the camera's matrices to the UBO, the 2D renderers will upload their own once again
+		Camera* const camera = mRenderTarget->getCamera();
+		const Matrix4f& VIEW_MATRIX = camera->getViewMatrix();
+		const Matrix4f& PROJ_MATRIX = camera->getProjectionMatrix();
+		const Matrix4f VIEW_PROJECTION = PROJ_MATRIX * VIEW_MATRIX;
+		mTransformUBO->queueUniformUpload("view", VIEW_MATRIX.elements.data(), sizeof(Matrix4f));
+		mTransformUBO->queueUniformUpload("projection", PROJ_MATRIX.elements.data(), sizeof(Matrix4f));
+		mTransformUBO->queueUniformUpload("viewProjection", VIEW_PROJECTION.elements.data(), sizeof(Matrix4f));
+		mTransformUBO->uploadQueuedUniforms();
+		Renderer2D::invalidateUploadedCamera();
+
+		// Retrieve the view volume against which the instances will be culled
+		mFrustum = &camera->getViewFrustum();
+
+		// Enable depth-testing and back-face culling, and activate the render target
+		gl::setCapability(GL_DEPTH_TEST, true);
+		gl::setCapability(GL_CULL_FACE, true);
+		gl::setCapability(GL_BLEND, false);
+		mRenderTarget->activate();
+	}
+
+	void Renderer3D::submit(const Mesh& mesh, Material& material, const Matrix4f& transform)
+	{
+		// Check if a scene is being rendered and if the mesh was created (ignored in Release mode)
+		if _CONSTEXPR_IF (AEON_DEBUG) {
+			if (!mRenderTarget) {
+				AEON_LOG_WARNING("Invalid render submission", "A submission was made while no scene was being rendered.\nAborting submission.");
+				return;
+			}
+			if (!mesh.getVBO()) {
+				AEON_LOG_WARNING("Invalid mesh", "The mesh submitted doesn't possess any geometry.\nAborting submission.");
+				return;
+			}
+			if (mesh.getVBO()->getLayout().getStride() != static_cast<int>(sizeof(Vertex3D))) {
+				AEON_LOG_WARNING("Invalid mesh", "The vertices of the mesh submitted aren't laid out as the ae::Vertex3D struct.\nAborting submission.");
+				return;
+			}
+		}
+
+		++mStatistics.submissions;
+
+		// Cull the instance if it's outside of the camera's view volume
+		if (!mFrustum->intersects(computeWorldBox(mesh.getModelBounds(), transform))) {
+			++mStatistics.culled;
+			return;
+		}
+
+		// The material's sort key occupies the most significant bits so that the meshes sharing a material are drawn consecutively
+		const uint64_t KEY = (static_cast<uint64_t>(material.getSortKey()) << 32) | mesh.getID();
+		mCommands.push_back({ KEY, &mesh, &material, static_cast<uint32_t>(mTransforms.size()) });
+		mTransforms.push_back(transform);
+	}
+
+	void Renderer3D::endScene()
+	{
+		// Check if a scene is being rendered (ignored in Release mode)
+		if _CONSTEXPR_IF (AEON_DEBUG) {
+			if (!mRenderTarget) {
+				AEON_LOG_WARNING("Invalid scene termination", "No scene is currently being rendered.\nAborting operation.");
+				return;
+			}
+		}
+
+		Profiler& profiler = Profiler::getInstance();
+		GPUProfiler& gpuProfiler = GPUProfiler::getInstance();
+		profiler.beginScope("Renderer3D flush");
+		gpuProfiler.beginScope("Renderer3D flush");
+
+		// Sort the submissions by material then by mesh (the instances keep their submission order to keep the results deterministic)
+		std::sort(mCommands.begin(), mCommands.end(), [](const DrawCommand& command1, const DrawCommand& command2) {
+			return (command1.key != command2.key) ? command1.key < command2.key : command1.transform < command2.transform;
+		});
+
+		// Render each group of submissions sharing the same material and mesh with a single instanced drawcall
+		mMeshVAO->bind();
+		const Material* boundMaterial = nullptr;
+		const Mesh* boundMesh = nullptr;
+		for (size_t first = 0, last = 0; first < mCommands.size(); first = last)
+		{
+			const DrawCommand& COMMAND = mCommands[first];
+			for (last = first + 1; last < mCommands.size() && mCommands[last].key == COMMAND.key; ++last);
+
+			// Bind the white texture for the untextured materials beforehand, the material's textures replacing it
+			if (COMMAND.material != boundMaterial) {
+				mWhiteTexture->bind(0);
+				COMMAND.material->bind();
+				boundMaterial = COMMAND.material;
+				++mStatistics.materialBinds;
+			}
+
+			// Attach the mesh's geometry to the VAO's vertex binding
+			if (COMMAND.mesh != boundMesh) {
+				mMeshVAO->attachVBO(0, COMMAND.mesh->getVBO());
+				mMeshVAO->attachIBO(COMMAND.mesh->getIBO());
+				boundMesh = COMMAND.mesh;
+				++mStatistics.meshBinds;
+			}
+
+			drawInstances(mCommands.data() + first, last - first);
+		}
+
+		// Fence the ring's current region so that it's not overwritten while OpenGL is still reading from it
+		mInstanceRing.lock();
+		mMeshVAO->attachVBO(0, nullptr);
+		mMeshVAO->attachIBO(nullptr);
+		mMeshVAO->unbind();
+
+		gpuProfiler.endScope();
+		profiler.endScope();
+
+		// Disable depth-testing and back-face culling, and let the target resolve or discard its contents
+		gl::setCapability(GL_DEPTH_TEST, false);
+		gl::setCapability(GL_CULL_FACE, false);
+		mRenderTarget->storeContents();
+
+		// Clear the submissions while keeping their memory for the next scene
+		mCommands.clear();
+		mTransforms.clear();
+		mRenderTarget = nullptr;
+		mFrustum = nullptr;
+	}
+
+	const Renderer3D::Statistics& Renderer3D::getStatistics() const noexcept
+	{
+		return mStatistics;
+	}
+
+	// Public static method(s)
+	Renderer3D& Renderer3D::getInstance()
+	{
+		static Renderer3D instance;
+		return instance;
+	}
+
+	// Private constructor(s)
+	Renderer3D::Renderer3D()
+		: mCommands()
+		, mTransforms()
+		, mMeshVAO(GLResourceFactory::getInstance().get<VertexArray>("_AEON_MeshVAO"))
+		, mTransformUBO(GLResourceFactory::getInstance().get<UniformBuffer>("_AEON_TransformUBO"))
+		, mWhiteTexture(GLResourceFactory::getInstance().get<Texture2D>("_AEON_WhiteTexture"))
+		, mInstanceRing()
+		, mStatistics()
+		, mRenderTarget(nullptr)
+		, mFrustum(nullptr)
+	{
+		// Create the ring buffer (each region can hold 16384 transforms)
+		mInstanceRing.create(*mMeshVAO->getVBO(1), static_cast<int>(sizeof(Matrix4f)) * 16384);
+	}
+
+	// Private method(s)
+	void Renderer3D::drawInstances(const DrawCommand* commands, size_t count)
+	{
+		const int INSTANCE_SIZE = static_cast<int>(sizeof(Matrix4f));
+		const size_t CAPACITY = static_cast<size_t>(mInstanceRing.getRegionSize() / INSTANCE_SIZE);
+		const unsigned int INDEX_COUNT = commands->mesh->getIndexCount();
+		const GLenum INDEX_TYPE = static_cast<GLenum>(commands->mesh->getIndexType());
+
+		for (size_t first = 0, drawn = 0; first < count; first += drawn)
+		{
+			// Reserve the memory in the ring's current region, moving on to the next region if the current one is full
+			drawn = std::min(count - first, CAPACITY);
+			const int SIZE = INSTANCE_SIZE * static_cast<int>(drawn);
+			int offset = 0;
+			void* data = mInstanceRing.allocate(SIZE, offset, INSTANCE_SIZE);
+			if (!data) {
+				mInstanceRing.lock();
+				data = mInstanceRing.allocate(SIZE, offset, INSTANCE_SIZE);
+				if (!data) {
+					return;
+				}
+			}
+
+			// Write the transforms directly into the mapped memory and render the instances, the base instance locating them within the ring
+			float* const instances = static_cast<float*>(data);
+			for (size_t i = 0; i < drawn; ++i) {
+				const auto& ELEMENTS = mTransforms[commands[first + i].transform].elements;
+				std::memcpy(instances + i * ELEMENTS.size(), ELEMENTS.data(), sizeof(ELEMENTS));
+			}
+			GLCall(glDrawElementsInstancedBaseInstance(GL_TRIANGLES, static_cast<GLsizei>(INDEX_COUNT), INDEX_TYPE, nullptr, static_cast<GLsizei>(drawn),
+			                                           static_cast<GLuint>(offset / INSTANCE_SIZE)));
+
+			++mStatistics.drawCalls;
+			mStatistics.instanceCount += drawn;
+			mStatistics.indexCount += INDEX_COUNT * drawn;
+			mStatistics.uploadedBytes += SIZE;
+		}
+	}
+}
\ No newline at end of file
@@ -0,0 +1,114 @@
+// MIT License
+// 
+// Copyright(c) 2019-2021 Filippos Gleglakos
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <AEON/Graphics/Sampler.h>
+
+#include <GL/glew.h>
+
+#include <AEON/Graphics/internal/GLCommon.h>
+
+namespace ae
+{
+	// Public constructor(s)
+	Sampler::Sampler(Texture::Filter filter, Texture::Wrap wrap)
+		: GLResource()
+		, mFilter((filter != Texture::Filter::None) ? filter : Texture::Filter::Linear)
+		, mWrap((wrap != Texture::Wrap::None) ? wrap : Texture::Wrap::Repeat)
+	{
+		// Create the sampler object
+		GLCall(glCreateSamplers(1, &mHandle));
+
+		// Find the appropriate magnification filter as it can only use GL_NEAREST or GL_LINEAR
+		const GLint GL_MAG_FILTER = (mFilter == Texture::Filter::Linear
+		                          || mFilter == Texture::Filter::Linear_MipLinear
+		                          || mFilter == Texture::Filter::Linear_MipNearest) ? GL_LINEAR : GL_NEAREST;
+
+		// Apply the filter and the wrapping mode to every coordinate
+		const GLint GL_WRAP = static_cast<GLint>(mWrap);
+		GLCall(glSamplerParameteri(mHandle, GL_TEXTURE_MIN_FILTER, static_cast<GLint>(mFilter)));
+		GLCall(glSamplerParameteri(mHandle, GL_TEXTURE_MAG_FILTER, GL_MAG_FILTER));
+		GLCall(glSamplerParameteri(mHandle, GL_TEXTURE_WRAP_S, GL_WRAP));
+		GLCall(glSamplerParameteri(mHandle, GL_TEXTURE_WRAP_T, GL_WRAP));
+		GLCall(glSamplerParameteri(mHandle, GL_TEXTURE_WRAP_R, GL_WRAP));
+	}
+
+	Sampler::Sampler(Sampler&& rvalue) noexcept
+		: GLResource(std::move(rvalue))
+		, mFilter(rvalue.mFilter)
+		, mWrap(rvalue.mWrap)
+	{
+	}
+
+	// Public operator(s)
+	Sampler& Sampler::operator=(Sampler&& rvalue) noexcept
+	{
+		// Copy the rvalue's trivial data and move the rest
+		GLResource::operator=(std::move(rvalue));
+		mFilter = rvalue.mFilter;
+		mWrap = rvalue.mWrap;
+
+		return *this;
+	}
+
+	// Public method(s)
+	void Sampler::bind(int unit) const
+	{
+		gl::bindSampler(unit, mHandle);
+	}
+
+	Texture::Filter Sampler::getFilter() const noexcept
+	{
+		return mFilter;
+	}
+
+	Texture::Wrap Sampler::getWrap() const noexcept
+	{
+		return mWrap;
+	}
+
+	// Public virtual method(s)
+	void Sampler::destroy() const
+	{
+		// Check if the OpenGL identifier is valid (ignored in Release mode)
+		if _CONSTEXPR_IF (AEON_DEBUG) {
+			if (!mHandle) {
+				AEON_LOG_ERROR("Attempt to delete invalid sampler", "The sampler's OpenGL identifier is invalid.\nAborting operation.");
+				return;
+			}
+		}
+
+		gl::releaseSampler(mHandle);
+		GLCall(glDeleteSamplers(1, &mHandle));
+	}
+
+	void Sampler::bind() const
+	{
+		// Bind the sampler to the first texture unit
+		bind(0);
+	}
+
+	void Sampler::unbind() const
+	{
+		// Unbind the sampler currently bound to the first texture unit
+		gl::bindSampler(0, 0);
+	}
+}
\ No newline at end of file
@@ -24,12 +24,104 @@
 
 #include <GL/glew.h>
 
+#include <filesystem>
+#include <fstream>
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <cstdio>
+
 #include <AEON/System/FileSystem.h>
+#include <AEON/System/FileWatcher.h>
 #include <AEON/Graphics/internal/GLCommon.h>
 #include <AEON/Graphics/internal/UniformBuffer.h>
+#include <AEON/Graphics/internal/ShaderStorageBuffer.h>
 
 namespace ae
 {
+	namespace
+	{
+		// The identifier and version that start every cached program binary
+		constexpr char BINARY_MAGIC[4] = { 'A', 'E', 'S', 'B' };
+		constexpr uint32_t BINARY_VERSION = 1;
+
+		// The ID assigned to the next shader created
+		std::atomic<uint32_t> nextID(1);
+
+		std::string& getCacheDirectory()
+		{
+			static std::string directory = "ShaderCache/";
+			return directory;
+		}
+
+		uint64_t hashString(uint64_t hash, const std::string& str)
+		{
+			// FNV-1a hash, the string's size is also hashed so that the sequences of strings don't collide
+			for (const char CHARACTER : str + std::to_string(str.size())) {
+				hash ^= static_cast<uint8_t>(CHARACTER);
+				hash *= 1099511628211ull;
+			}
+			return hash;
+		}
+
+		const std::string& getDriverString()
+		{
+			// A driver or GPU change invalidates the program binaries, so the strings identifying them are part of the key
+			static const std::string DRIVER = std::string(reinterpret_cast<const char*>(glGetString(GL_VENDOR))) + '/'
+				+ reinterpret_cast<const char*>(glGetString(GL_RENDERER)) + '/'
+				+ reinterpret_cast<const char*>(glGetString(GL_VERSION));
+			return DRIVER;
+		}
+
+		bool isBinaryCacheSupported()
+		{
+			static const bool SUPPORTED = [] {
+				GLint formatCount = 0;
+				GLCall(glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &formatCount));
+				return formatCount > 0;
+			}();
+			return SUPPORTED;
+		}
+
+		bool isParallelCompileSupported()
+		{
+			// Let the driver use as many compiler threads as it sees fit the first time the extension is requested
+			static const bool SUPPORTED = [] {
+				if (!GLEW_KHR_parallel_shader_compile) {
+					return false;
+				}
+				GLCall(glMaxShaderCompilerThreadsKHR(0xFFFFFFFF));
+				return true;
+			}();
+			return SUPPORTED;
+		}
+
+		std::string injectDefines(const std::string& source, const std::vector<std::string>& defines)
+		{
+			if (defines.empty()) {
+				return source;
+			}
+
+			// The defines follow the version directive, which has to come first, or are placed at the top if there's none
+			size_t position = 0;
+			const size_t VERSION = source.find("#version");
+			if (VERSION != std::string::npos) {
+				const size_t LINE_END = source.find('\n', VERSION);
+				position = (LINE_END != std::string::npos) ? LINE_END + 1 : source.size();
+			}
+
+			// Reset the line number so that the compilation errors refer to the source code's lines
+			const size_t NEXT_LINE = std::count(source.begin(), source.begin() + position, '\n') + 1;
+			std::string directives = (position > 0 && source[position - 1] != '\n') ? "\n" : "";
+			for (const std::string& define : defines) {
+				directives += "#define " + define + '\n';
+			}
+			directives += "#line " + std::to_string(NEXT_LINE) + '\n';
+
+			return std::string(source).insert(position, directives);
+		}
+	}
+
 	// Public constructor(s)
 	Shader::Shader(LinkType linkType)
 		: GLResource()
@@ -37,6 +129,8 @@ namespace ae
 		, mUniforms()
 		, mDataLayout()
 		, mLinkType(linkType)
+		, mLinkPending(false)
+		, mID(nextID.fetch_add(1, std::memory_order_relaxed))
 	{
 		// Create the shader program object
 		mHandle = GLCall(glCreateProgram());
@@ -48,7 +142,10 @@ namespace ae
 		, mUniforms(std::move(rvalue.mUniforms))
 		, mDataLayout(std::move(rvalue.mDataLayout))
 		, mLinkType(rvalue.mLinkType)
+		, mLinkPending(rvalue.mLinkPending)
+		, mID(rvalue.mID)
 	{
+		rvalue.mLinkPending = false;
 	}
 
 	// Public operator(s)
@@ -60,12 +157,15 @@ namespace ae
 		mUniforms = std::move(rvalue.mUniforms);
 		mDataLayout = std::move(rvalue.mDataLayout);
 		mLinkType = rvalue.mLinkType;
+		mLinkPending = rvalue.mLinkPending;
+		mID = rvalue.mID;
+		rvalue.mLinkPending = false;
 
 		return *this;
 	}
 
 	// Public method(s)
-	void Shader::loadFromSource(StageType type, const std::string& source)
+	void Shader::loadFromSource(StageType type, const std::string& source, const std::vector<std::string>& defines)
 	{
 		// Check if a shader stage of the same type has already been attached and that the source provided is valid (ignored in Release mode)
 		if _CONSTEXPR_IF (AEON_DEBUG) {
@@ -79,16 +179,11 @@ namespace ae
 			}
 		}
 
-		// Create the shader object and compile it
-		unsigned int stageHandle = GLCall(glCreateShader(type));
-		auto stage = mStages.emplace(type, Stage({ source, stageHandle })).first;
-		compileShader(stage->second);
-
-		// Attach the shader stage to the shader program
-		GLCall(glAttachShader(mHandle, stageHandle));
+		// Store the source code, the shader stage is only compiled when linking if the program binary isn't cached
+		mStages.emplace(type, Stage({ injectDefines(source, defines), 0, "", defines }));
 	}
 
-	void Shader::loadFromFile(StageType type, const std::string& filename)
+	void Shader::loadFromFile(StageType type, const std::string& filename, const std::vector<std::string>& defines)
 	{
 		// Read in the contents of the file
 		const std::string SOURCE = FileSystem::readFile(filename);
@@ -101,16 +196,21 @@ namespace ae
 			}
 		}
 
-		// Create and attach the shader object from the source code retrieved
-		loadFromSource(type, SOURCE);
+		// Create and attach the shader object from the source code retrieved, remembering its file so that it may be reloaded
+		loadFromSource(type, SOURCE, defines);
+		const auto STAGE = mStages.find(type);
+		if (STAGE != mStages.end() && STAGE->second.filepath.empty() && STAGE->second.source == injectDefines(SOURCE, defines)) {
+			STAGE->second.filepath = filename;
+		}
 	}
 
-	void Shader::link() const
+	void Shader::link(bool deferred)
 	{
-		// Verify that at least two shader stages have been attached (ignored in Release mode)
+		// Verify that at least two shader stages have been attached, or a single compute shader (ignored in Release mode)
 		if _CONSTEXPR_IF (AEON_DEBUG) {
-			if (mStages.size() < 2) {
-				AEON_LOG_ERROR("Incomplete shader program", "At least two shader stages have to be attached before linking a program, a vertex shader and a fragment shader.\nAborting operation.");
+			const bool COMPUTE_ONLY = (mStages.size() == 1 && mStages.begin()->first == StageType::Compute);
+			if (mStages.size() < 2 && !COMPUTE_ONLY) {
+				AEON_LOG_ERROR("Incomplete shader program", "At least two shader stages have to be attached before linking a program, a vertex shader and a fragment shader, unless it's a compute program.\nAborting operation.");
 				return;
 			}
 		}
@@ -120,43 +220,108 @@ namespace ae
 			GLCall(glProgramParameteri(mHandle, GL_PROGRAM_SEPARABLE, GL_TRUE));
 		}
 
-		// Link together all the attached shader stages
+		// Skip the compilation entirely if the program binary was cached by a previous run
+		const std::string CACHE_PATH = getBinaryCachePath();
+		if (!CACHE_PATH.empty()) {
+			if (loadBinary(CACHE_PATH)) {
+				queryUniforms();
+				return;
+			}
+			GLCall(glProgramParameteri(mHandle, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE));
+		}
+
+		// Submit the compilation of all the shader stages and the link without querying their status, which would otherwise wait for the driver
+		if (deferred) {
+			isParallelCompileSupported();
+		}
+		for (auto& stage : mStages) {
+			stage.second.handle = GLCall(glCreateShader(stage.first));
+			compileShader(stage.second);
+			GLCall(glAttachShader(mHandle, stage.second.handle));
+		}
 		GLCall(glLinkProgram(mHandle));
-		checkProgramStatus(GL_LINK_STATUS);
-		GLCall(glValidateProgram(mHandle));
-		checkProgramStatus(GL_VALIDATE_STATUS);
 
-		// Raise the shader stages' deletion flag and detach all shader stages
-		for (const auto& stage : mStages) {
-			GLCall(glDeleteShader(stage.second.handle));
-			checkShaderStatus(stage.second.handle, GL_DELETE_STATUS);
-			GLCall(glDetachShader(mHandle, stage.second.handle));
+		// Check the results right away unless they've been deferred until the shader is first bound
+		mLinkPending = true;
+		if (!deferred) {
+			finishLink();
 		}
 	}
 
 	void Shader::reload()
 	{
-		// Create a new OpenGL shader program
+		// Create a new OpenGL shader program and link it (the program binary cached will be used if it's available)
 		mHandle = GLCall(glCreateProgram());
+		link();
+	}
 
-		// Reload and reattach the shader stages
-		for (auto& stage : mStages) {
+	bool Shader::reloadFromFile(const std::string& filename)
+	{
+		// Read in the source code of the shader stages loaded from the file
+		const std::string FILEPATH = FileWatcher::normalizePath(filename);
+		std::map<StageType, Stage> stages = mStages;
+		bool modified = false;
+		for (auto& stage : stages) {
+			if (!stage.second.filepath.empty() && FileWatcher::normalizePath(stage.second.filepath) == FILEPATH) {
+				stage.second.source = injectDefines(FileSystem::readFile(stage.second.filepath), stage.second.defines);
+				modified = true;
+			}
+		}
+		if (!modified) {
+			return false;
+		}
+
+		// Compile every shader stage before modifying the program so that the current one is kept if a shader stage is invalid
+		bool compiled = true;
+		for (auto& stage : stages) {
 			stage.second.handle = GLCall(glCreateShader(stage.first));
 			compileShader(stage.second);
+
+			GLint status = GL_FALSE;
+			GLCall(glGetShaderiv(stage.second.handle, GL_COMPILE_STATUS, &status));
+			if (status != GL_TRUE) {
+				checkShaderStatus(stage.second.handle, GL_COMPILE_STATUS);
+				compiled = false;
+			}
+		}
+		if (!compiled) {
+			for (const auto& stage : stages) {
+				GLCall(glDeleteShader(stage.second.handle));
+			}
+			AEON_LOG_ERROR("Failed to reload shader", "The shader stages of \"" + filename + "\" couldn't be compiled, the previous program is kept.");
+			return true;
+		}
+
+		// Relink the program in place with the new shader stages (the link still pending is completed beforehand)
+		if (mLinkPending) {
+			finishLink();
+		}
+		for (const auto& stage : stages) {
 			GLCall(glAttachShader(mHandle, stage.second.handle));
 		}
+		GLCall(glLinkProgram(mHandle));
+		mStages = std::move(stages);
+		finishLink();
 
-		// Link together the shader program
-		link();
+		return true;
 	}
 
-	bool Shader::isBound() const
+	bool Shader::isReady() const
 	{
-		// Retrieve the identifier of the currently bound shader program
-		GLint boundProgram;
-		GLCall(glGetIntegerv(GL_CURRENT_PROGRAM, &boundProgram));
+		// Without the extension, the driver can only be queried by waiting for it
+		if (!mLinkPending || !isParallelCompileSupported()) {
+			return true;
+		}
 
-		return (boundProgram == mHandle);
+		GLint completed = GL_FALSE;
+		GLCall(glGetProgramiv(mHandle, GL_COMPLETION_STATUS_KHR, &completed));
+		return completed == GL_TRUE;
+	}
+
+	bool Shader::isBound() const
+	{
+		// Compare the identifier of the shader program in use (according to the state cache) with the caller's
+		return (gl::getProgram() == mHandle);
 	}
 
 	void Shader::addUniformBuffer(const UniformBuffer& ubo)
@@ -166,83 +331,153 @@ namespace ae
 		GLCall(glUniformBlockBinding(mHandle, blockIndex, ubo.getBindingPoint()));
 	}
 
-	void Shader::setUniform(const std::string& name, float value)
+	void Shader::addStorageBuffer(const ShaderStorageBuffer& ssbo, const std::string& blockName)
 	{
-		GLint location = cacheUniformLocation(name);
-		if (location != -1) {
-			GLCall(glProgramUniform1f(mHandle, location, value));
+		// Retrieve the shader storage block's index from the shader and assign the buffer's binding point to it
+		const GLuint BLOCK_INDEX = GLCall(glGetProgramResourceIndex(mHandle, GL_SHADER_STORAGE_BLOCK, blockName.c_str()));
+		if (BLOCK_INDEX == GL_INVALID_INDEX) {
+			AEON_LOG_WARNING("Invalid shader storage block", "The shader doesn't possess the shader storage block \"" + blockName + "\".\nAborting operation.");
+			return;
 		}
+		GLCall(glShaderStorageBlockBinding(mHandle, BLOCK_INDEX, ssbo.getBindingPoint()));
 	}
 
-	void Shader::setUniform(const std::string& name, int value)
+	void Shader::dispatch(unsigned int groupsX, unsigned int groupsY, unsigned int groupsZ) const
 	{
-		GLint location = cacheUniformLocation(name);
-		if (location != -1) {
-			GLCall(glProgramUniform1i(mHandle, location, value));
+		// Check that the work group counts are valid (ignored in Release mode)
+		if _CONSTEXPR_IF (AEON_DEBUG) {
+			if (groupsX == 0 || groupsY == 0 || groupsZ == 0) {
+				AEON_LOG_WARNING("Empty compute dispatch", "At least one work group has to be launched in every dimension.\nAborting operation.");
+				return;
+			}
 		}
+
+		bind();
+		GLCall(glDispatchCompute(groupsX, groupsY, groupsZ));
+	}
+
+	void Shader::setUniform(const std::string& name, float value)
+	{
+		setUniform(UniformHandle{ cacheUniformLocation(name) }, value);
+	}
+
+	void Shader::setUniform(const std::string& name, int value)
+	{
+		setUniform(UniformHandle{ cacheUniformLocation(name) }, value);
 	}
 
 	void Shader::setUniform(const std::string& name, unsigned int value)
 	{
-		GLint location = cacheUniformLocation(name);
-		if (location != -1) {
-			GLCall(glProgramUniform1ui(mHandle, location, value));
-		}
+		setUniform(UniformHandle{ cacheUniformLocation(name) }, value);
 	}
 
 	void Shader::setUniform(const std::string& name, const Vector2f& vec)
 	{
-		GLint location = cacheUniformLocation(name);
-		if (location != -1) {
-			GLCall(glProgramUniform2fv(mHandle, location, 1, vec.elements.data()));
-		}
+		setUniform(UniformHandle{ cacheUniformLocation(name) }, vec);
 	}
 
 	void Shader::setUniform(const std::string& name, const Vector3f& vec)
 	{
-		GLint location = cacheUniformLocation(name);
-		if (location != -1) {
-			GLCall(glProgramUniform3fv(mHandle, location, 1, vec.elements.data()));
-		}
+		setUniform(UniformHandle{ cacheUniformLocation(name) }, vec);
 	}
 
 	void Shader::setUniform(const std::string& name, const Vector4f& vec)
 	{
-		GLint location = cacheUniformLocation(name);
-		if (location != -1) {
-			GLCall(glProgramUniform4fv(mHandle, location, 1, vec.elements.data()));
-		}
+		setUniform(UniformHandle{ cacheUniformLocation(name) }, vec);
 	}
 
 	void Shader::setUniform(const std::string& name, const Vector2i& vec)
 	{
-		GLint location = cacheUniformLocation(name);
-		if (location != -1) {
-			GLCall(glProgramUniform2iv(mHandle, location, 1, vec.elements.data()));
-		}
+		setUniform(UniformHandle{ cacheUniformLocation(name) }, vec);
 	}
 
 	void Shader::setUniform(const std::string& name, const Vector3i& vec)
 	{
-		GLint location = cacheUniformLocation(name);
-		if (location != -1) {
-			GLCall(glProgramUniform3iv(mHandle, location, 1, vec.elements.data()));
-		}
+		setUniform(UniformHandle{ cacheUniformLocation(name) }, vec);
 	}
 
 	void Shader::setUniform(const std::string& name, const Vector4i& vec)
 	{
-		GLint location = cacheUniformLocation(name);
-		if (location != -1) {
-			GLCall(glProgramUniform4iv(mHandle, location, 1, vec.elements.data()));
-		}
+		setUniform(UniformHandle{ cacheUniformLocation(name) }, vec);
 	}
 
 	void Shader::setUniform(const std::string& name, const Matrix4f& mat)
 	{
-		GLint location = cacheUniformLocation(name);
-		if (location != -1) {
-			GLCall(glProgramUniformMatrix4fv(mHandle, location, 1, GL_FALSE, mat.elements.data()));
+		setUniform(UniformHandle{ cacheUniformLocation(name) }, mat);
+	}
+
+	Shader::UniformHandle Shader::getUniformHandle(const std::string& name)
+	{
+		return UniformHandle{ cacheUniformLocation(name) };
+	}
+
+	void Shader::setUniform(UniformHandle handle, float value)
+	{
+		if (handle.location != -1) {
+			GLCall(glProgramUniform1f(mHandle, handle.location, value));
+		}
+	}
+
+	void Shader::setUniform(UniformHandle handle, int value)
+	{
+		if (handle.location != -1) {
+			GLCall(glProgramUniform1i(mHandle, handle.location, value));
+		}
+	}
+
+	void Shader::setUniform(UniformHandle handle, unsigned int value)
+	{
+		if (handle.location != -1) {
+			GLCall(glProgramUniform1ui(mHandle, handle.location, value));
+		}
+	}
+
+	void Shader::setUniform(UniformHandle handle, const Vector2f& vec)
+	{
+		if (handle.location != -1) {
+			GLCall(glProgramUniform2fv(mHandle, handle.location, 1, vec.elements.data()));
+		}
+	}
+
+	void Shader::setUniform(UniformHandle handle, const Vector3f& vec)
+	{
+		if (handle.location != -1) {
+			GLCall(glProgramUniform3fv(mHandle, handle.location, 1, vec.elements.data()));
+		}
+	}
+
+	void Shader::setUniform(UniformHandle handle, const Vector4f& vec)
+	{
+		if (handle.location != -1) {
+			GLCall(glProgramUniform4fv(mHandle, handle.location, 1, vec.elements.data()));
+		}
+	}
+
+	void Shader::setUniform(UniformHandle handle, const Vector2i& vec)
+	{
+		if (handle.location != -1) {
+			GLCall(glProgramUniform2iv(mHandle, handle.location, 1, vec.elements.data()));
+		}
+	}
+
+	void Shader::setUniform(UniformHandle handle, const Vector3i& vec)
+	{
+		if (handle.location != -1) {
+			GLCall(glProgramUniform3iv(mHandle, handle.location, 1, vec.elements.data()));
+		}
+	}
+
+	void Shader::setUniform(UniformHandle handle, const Vector4i& vec)
+	{
+		if (handle.location != -1) {
+			GLCall(glProgramUniform4iv(mHandle, handle.location, 1, vec.elements.data()));
+		}
+	}
+
+	void Shader::setUniform(UniformHandle handle, const Matrix4f& mat)
+	{
+		if (handle.location != -1) {
+			GLCall(glProgramUniformMatrix4fv(mHandle, handle.location, 1, GL_FALSE, mat.elements.data()));
 		}
 	}
 
@@ -251,6 +486,47 @@ namespace ae
 		return mDataLayout;
 	}
 
+	uint32_t Shader::getID() const noexcept
+	{
+		return mID;
+	}
+
+	// Public static method(s)
+	std::vector<std::string> Shader::getFeatureDefines(uint32_t features)
+	{
+		static const std::pair<Feature, const char*> FEATURE_DEFINES[] = {
+			{ Feature::Textured, "AEON_TEXTURED" },
+			{ Feature::VertexColor, "AEON_VERTEX_COLOR" },
+			{ Feature::Outline, "AEON_OUTLINE" },
+			{ Feature::SDF, "AEON_SDF" },
+			{ Feature::Instanced, "AEON_INSTANCED" },
+			{ Feature::AlphaMask, "AEON_ALPHA_MASK" }
+		};
+
+		std::vector<std::string> defines;
+		for (const auto& featureDefine : FEATURE_DEFINES) {
+			if (features & featureDefine.first) {
+				defines.emplace_back(featureDefine.second);
+			}
+		}
+		return defines;
+	}
+
+	void Shader::setBinaryCacheDirectory(const std::string& directory)
+	{
+		// Add the trailing separator so that the filenames can simply be appended
+		std::string& cacheDirectory = getCacheDirectory();
+		cacheDirectory = directory;
+		if (!cacheDirectory.empty() && cacheDirectory.back() != '/' && cacheDirectory.back() != '\\') {
+			cacheDirectory += '/';
+		}
+	}
+
+	const std::string& Shader::getBinaryCacheDirectory() noexcept
+	{
+		return getCacheDirectory();
+	}
+
 	// Public virtual method(s)
 	void Shader::destroy() const
 	{
@@ -262,7 +538,16 @@ namespace ae
 			}
 		}
 
-		// Delete the OpenGL identifier
+		// Delete the shader stages that are still attached to a pending link
+		if (mLinkPending) {
+			for (const auto& stage : mStages) {
+				GLCall(glDeleteShader(stage.second.handle));
+			}
+			mLinkPending = false;
+		}
+
+		// Stop using the shader program if it's in use and delete the OpenGL identifier
+		gl::releaseObject(0, 0, mHandle);
 		GLCall(glDeleteProgram(mHandle));
 
 		// Check if it was successfully deleted only if it was currently bound (ignored in Release mode)
@@ -283,7 +568,12 @@ namespace ae
 			}
 		}
 
-		GLCall(glUseProgram(mHandle));
+		// Check the results of a deferred link now that the shader program is required
+		if (mLinkPending) {
+			finishLink();
+		}
+
+		gl::useProgram(mHandle);
 	}
 
 	void Shader::unbind() const
@@ -295,7 +585,7 @@ namespace ae
 			}
 		}
 
-		GLCall(glUseProgram(0));
+		gl::useProgram(0);
 	}
 
 	// Private method(s)
@@ -305,9 +595,158 @@ namespace ae
 		const GLchar* const sourceContent[] = { stage.source.c_str() };
 		GLCall(glShaderSource(stage.handle, 1, sourceContent, nullptr));
 
-		// Compile the shader and check if it successfully compiled
+		// Submit the compilation, its status is checked by finishLink()
 		GLCall(glCompileShader(stage.handle));
-		checkShaderStatus(stage.handle, GL_COMPILE_STATUS);
+	}
+
+	void Shader::finishLink() const
+	{
+		mLinkPending = false;
+
+		// Check that every shader stage compiled and that they were linked together (the validation is only used to diagnose issues)
+		for (const auto& stage : mStages) {
+			checkShaderStatus(stage.second.handle, GL_COMPILE_STATUS);
+		}
+		checkProgramStatus(GL_LINK_STATUS);
+		if _CONSTEXPR_IF (AEON_DEBUG) {
+			GLCall(glValidateProgram(mHandle));
+			checkProgramStatus(GL_VALIDATE_STATUS);
+		}
+		queryUniforms();
+
+		// Raise the shader stages' deletion flag and detach all shader stages
+		for (const auto& stage : mStages) {
+			GLCall(glDeleteShader(stage.second.handle));
+			checkShaderStatus(stage.second.handle, GL_DELETE_STATUS);
+			GLCall(glDetachShader(mHandle, stage.second.handle));
+		}
+
+		// Cache the program binary for the next runs
+		const std::string CACHE_PATH = getBinaryCachePath();
+		if (!CACHE_PATH.empty()) {
+			saveBinary(CACHE_PATH);
+		}
+	}
+
+	std::string Shader::getBinaryCachePath() const
+	{
+		// Check that the cache is enabled and that the driver supports at least one program binary format
+		const std::string& CACHE_DIRECTORY = getCacheDirectory();
+		if (CACHE_DIRECTORY.empty() || !isBinaryCacheSupported()) {
+			return "";
+		}
+
+		// Hash the source code of every shader stage along with the link type and the driver
+		uint64_t hash = 14695981039346656037ull;
+		for (const auto& stage : mStages) {
+			hash = hashString(hash, std::to_string(stage.first));
+			hash = hashString(hash, stage.second.source);
+		}
+		hash = hashString(hash, std::to_string(static_cast<int>(mLinkType)));
+		hash = hashString(hash, getDriverString());
+
+		char filename[17];
+		std::snprintf(filename, sizeof(filename), "%016llx", static_cast<unsigned long long>(hash));
+		return CACHE_DIRECTORY + filename + ".bin";
+	}
+
+	bool Shader::loadBinary(const std::string& filepath)
+	{
+		// A missing file simply means that the program hasn't been cached yet
+		std::ifstream file(filepath, std::ios::binary | std::ios::ate);
+		if (!file) {
+			return false;
+		}
+
+		// Read in and check the header
+		const std::streamoff FILE_SIZE = file.tellg();
+		const std::streamoff HEADER_SIZE = sizeof(BINARY_MAGIC) + sizeof(uint32_t) * 2;
+		if (FILE_SIZE <= HEADER_SIZE) {
+			return false;
+		}
+
+		char magic[sizeof(BINARY_MAGIC)];
+		uint32_t version = 0, binaryFormat = 0;
+		file.seekg(0);
+		file.read(magic, sizeof(magic));
+		file.read(reinterpret_cast<char*>(&version), sizeof(version));
+		file.read(reinterpret_cast<char*>(&binaryFormat), sizeof(binaryFormat));
+		if (std::memcmp(magic, BINARY_MAGIC, sizeof(BINARY_MAGIC)) != 0 || version != BINARY_VERSION) {
+			return false;
+		}
+
+		// Read in the program binary and provide it to OpenGL
+		std::vector<char> binary(static_cast<size_t>(FILE_SIZE - HEADER_SIZE));
+		if (!file.read(binary.data(), binary.size())) {
+			return false;
+		}
+		GLCall(glProgramBinary(mHandle, binaryFormat, binary.data(), static_cast<GLsizei>(binary.size())));
+
+		// The driver may refuse the binary (after an update for example), the stages will then be compiled instead
+		GLint status = GL_FALSE;
+		GLCall(glGetProgramiv(mHandle, GL_LINK_STATUS, &status));
+		return status == GL_TRUE;
+	}
+
+	void Shader::saveBinary(const std::string& filepath) const
+	{
+		// Retrieve the program binary
+		GLint length = 0;
+		GLCall(glGetProgramiv(mHandle, GL_PROGRAM_BINARY_LENGTH, &length));
+		if (length <= 0) {
+			return;
+		}
+
+		std::vector<char> binary(length);
+		GLenum binaryFormat = GL_NONE;
+		GLCall(glGetProgramBinary(mHandle, length, &length, &binaryFormat, binary.data()));
+
+		// Create the cache directory if needed and write out the header followed by the binary
+		std::error_code error;
+		std::filesystem::create_directories(std::filesystem::path(filepath).parent_path(), error);
+
+		std::ofstream file(filepath, std::ios::binary | std::ios::trunc);
+		if (!file) {
+			AEON_LOG_WARNING("Failed to cache shader program", "Unable to open file at \"" + filepath + "\".\nThe program will be compiled on every run.");
+			return;
+		}
+
+		const uint32_t FORMAT = binaryFormat;
+		file.write(BINARY_MAGIC, sizeof(BINARY_MAGIC));
+		file.write(reinterpret_cast<const char*>(&BINARY_VERSION), sizeof(BINARY_VERSION));
+		file.write(reinterpret_cast<const char*>(&FORMAT), sizeof(FORMAT));
+		file.write(binary.data(), length);
+	}
+
+	void Shader::queryUniforms() const
+	{
+		// The locations may have changed if the shader program was relinked
+		mUniforms.clear();
+
+		GLint uniformCount = 0;
+		GLCall(glGetProgramInterfaceiv(mHandle, GL_UNIFORM, GL_ACTIVE_RESOURCES, &uniformCount));
+
+		const GLenum PROPERTIES[] = { GL_NAME_LENGTH, GL_LOCATION };
+		std::string name;
+		for (GLint i = 0; i < uniformCount; ++i) {
+			GLint values[2];
+			GLCall(glGetProgramResourceiv(mHandle, GL_UNIFORM, i, 2, PROPERTIES, 2, nullptr, values));
+
+			// The members of uniform blocks don't possess a location
+			if (values[1] == -1) {
+				continue;
+			}
+
+			name.resize(values[0]);
+			GLCall(glGetProgramResourceName(mHandle, GL_UNIFORM, i, values[0], nullptr, &name[0]));
+			name.resize(values[0] - 1);
+			mUniforms.emplace(name, values[1]);
+
+			// Arrays are reported by their first element, but they can also be set through their name
+			if (name.size() > 3 && name.compare(name.size() - 3, 3, "[0]") == 0) {
+				mUniforms.emplace(name.substr(0, name.size() - 3), values[1]);
+			}
+		}
 	}
 
 	int Shader::cacheUniformLocation(const std::string& name)
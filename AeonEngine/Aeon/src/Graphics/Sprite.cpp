@@ -22,8 +22,8 @@
 
 #include <AEON/Graphics/Sprite.h>
 
-#include <AEON/Graphics/internal/Renderer2D.h>
 #include <AEON/Graphics/GLResourceFactory.h>
+#include <AEON/Graphics/SpriteAnimation.h>
 
 namespace ae
 {
@@ -33,8 +33,15 @@ namespace ae
 		, mModelBounds()
 		, mTextureRect(0.f, 0.f, 0.f, 0.f)
 		, mTexture(nullptr)
+		, mSampler(nullptr)
 		, mColor(Color::White)
+		, mAnimation(nullptr)
+		, mAnimationTime()
+		, mAnimationFrame(0)
+		, mAnimationPlaying(false)
+		, mShader(nullptr)
 		, mUpdatePosUV(true)
+		, mUpdateUV(false)
 		, mUpdateColor(true)
 	{
 	}
@@ -44,8 +51,15 @@ namespace ae
 		, mModelBounds()
 		, mTextureRect()
 		, mTexture(&texture)
+		, mSampler(nullptr)
 		, mColor(Color::White)
+		, mAnimation(nullptr)
+		, mAnimationTime()
+		, mAnimationFrame(0)
+		, mAnimationPlaying(false)
+		, mShader(nullptr)
 		, mUpdatePosUV(true)
+		, mUpdateUV(false)
 		, mUpdateColor(true)
 	{
 		// Setup the appropriate texture rect
@@ -57,8 +71,15 @@ namespace ae
 		, mModelBounds(std::move(rvalue.mModelBounds))
 		, mTextureRect(std::move(rvalue.mTextureRect))
 		, mTexture(rvalue.mTexture)
+		, mSampler(rvalue.mSampler)
 		, mColor(std::move(rvalue.mColor))
+		, mAnimation(rvalue.mAnimation)
+		, mAnimationTime(std::move(rvalue.mAnimationTime))
+		, mAnimationFrame(rvalue.mAnimationFrame)
+		, mAnimationPlaying(rvalue.mAnimationPlaying)
+		, mShader(std::move(rvalue.mShader))
 		, mUpdatePosUV(rvalue.mUpdatePosUV)
+		, mUpdateUV(rvalue.mUpdateUV)
 		, mUpdateColor(rvalue.mUpdateColor)
 	{
 	}
@@ -71,8 +92,15 @@ namespace ae
 		mModelBounds = std::move(rvalue.mModelBounds);
 		mTextureRect = std::move(rvalue.mTextureRect);
 		mTexture = rvalue.mTexture;
+		mSampler = rvalue.mSampler;
 		mColor = std::move(rvalue.mColor);
+		mAnimation = rvalue.mAnimation;
+		mAnimationTime = std::move(rvalue.mAnimationTime);
+		mAnimationFrame = rvalue.mAnimationFrame;
+		mAnimationPlaying = rvalue.mAnimationPlaying;
+		mShader = std::move(rvalue.mShader);
 		mUpdatePosUV = rvalue.mUpdatePosUV;
+		mUpdateUV = rvalue.mUpdateUV;
 		mUpdateColor = rvalue.mUpdateColor;
 
 		return *this;
@@ -87,6 +115,7 @@ namespace ae
 		}
 		else {
 			mUpdatePosUV = true;
+			wake();
 		}
 	}
 
@@ -104,12 +133,41 @@ namespace ae
 		// Set the new texture and indicate that the uv coordinates need to be updated
 		mTextureRect = rect;
 		mUpdatePosUV = true;
+		wake();
 	}
 
 	void Sprite::setColor(const Color& color) noexcept
 	{
 		mColor = color;
 		mUpdateColor = true;
+		wake();
+	}
+
+	void Sprite::setAnimation(const SpriteAnimation* animation)
+	{
+		mAnimation = animation;
+		mAnimationTime = Time::Zero;
+		mAnimationFrame = 0;
+		mAnimationPlaying = (mAnimation && mAnimation->getFrameCount() != 0);
+
+		// Display the first frame
+		if (mAnimationPlaying) {
+			mTexture = &mAnimation->getTexture();
+			setTextureRect(mAnimation->getFrameRect(0));
+		}
+	}
+
+	void Sprite::setAnimationPlaying(bool playing) noexcept
+	{
+		mAnimationPlaying = playing && mAnimation && mAnimation->getFrameCount() != 0;
+		if (mAnimationPlaying) {
+			wake();
+		}
+	}
+
+	void Sprite::setSampler(const Sampler* sampler) noexcept
+	{
+		mSampler = sampler;
 	}
 
 	const Texture2D* const Sprite::getTexture() const noexcept
@@ -117,6 +175,11 @@ namespace ae
 		return mTexture;
 	}
 
+	const Sampler* Sprite::getSampler() const noexcept
+	{
+		return mSampler;
+	}
+
 	const Box2f& Sprite::getTextureRect() const noexcept
 	{
 		return mTextureRect;
@@ -127,6 +190,21 @@ namespace ae
 		return mColor;
 	}
 
+	const SpriteAnimation* Sprite::getAnimation() const noexcept
+	{
+		return mAnimation;
+	}
+
+	size_t Sprite::getAnimationFrame() const noexcept
+	{
+		return mAnimationFrame;
+	}
+
+	bool Sprite::isAnimationPlaying() const noexcept
+	{
+		return mAnimationPlaying;
+	}
+
 	// Public virtual method(s)
 	Box2f Sprite::getModelBounds() const
 	{
@@ -136,13 +214,13 @@ namespace ae
 	// Private method(s)
 	void Sprite::updatePosUV()
 	{
-		std::vector<Vertex2D>& vertices = getVertices();
+		Vertex2DList& vertices = getVertices();
 		if (vertices.empty()) {
 			vertices.resize(4);
 		}
 
 			// Update the positions
-		const float POS_Z = getPosition().z;
+		const float POS_Z = static_cast<float>(getDepth());
 		vertices[0].position = Vector3f(Vector2f(0.f,                0.f)               , POS_Z);
 		vertices[1].position = Vector3f(Vector2f(0.f,                mTextureRect.max.y), POS_Z);
 		vertices[2].position = Vector3f(Vector2f(mTextureRect.max.x, mTextureRect.max.y), POS_Z);
@@ -150,21 +228,49 @@ namespace ae
 
 			// Update the model bounding box's position and size based on the minimum and maximum vertex positions
 		mModelBounds = Box2f(vertices[0].position.xy, vertices[2].position.xy - vertices[0].position.xy);
+		invalidateBounds();
 
 			// Update the UV coordinates
+		updateUV();
+
+		// Reference the quad indices shared by all sprites (if necessary)
+		const Renderable2D& renderable = *this;
+		if (renderable.getIndices().size() != 6) {
+			setSharedIndices(GLResourceFactory::getInstance().getQuadIndices(1));
+		}
+	}
+
+	void Sprite::updateUV()
+	{
+		Vertex2DList& vertices = getVertices();
 		const Vector2f TEXTURE_SIZE = (mTexture) ? Vector2f(mTexture->getSize()) : Vector2f(1.f, 1.f);
 		vertices[0].uv = Vector2f(mTextureRect.min.x,                      mTextureRect.min.y)                      / TEXTURE_SIZE;
 		vertices[1].uv = Vector2f(mTextureRect.min.x,                      mTextureRect.min.y + mTextureRect.max.y) / TEXTURE_SIZE;
 		vertices[2].uv = Vector2f(mTextureRect.min.x + mTextureRect.max.x, mTextureRect.min.y + mTextureRect.max.y) / TEXTURE_SIZE;
 		vertices[3].uv = Vector2f(mTextureRect.min.x + mTextureRect.max.x, mTextureRect.min.y)                      / TEXTURE_SIZE;
+	}
+
+	void Sprite::updateAnimation(const Time& dt)
+	{
+		// Advance the animation, a non-looping one stops once its last frame has been reached
+		mAnimationTime += dt;
+		if (!mAnimation->isLooping() && mAnimationTime >= mAnimation->getDuration()) {
+			mAnimationPlaying = false;
+		}
 
-		// Update indices (if necessary)
-		std::vector<unsigned int>& indices = getIndices();
-		if (indices.size() != 6) {
-			indices = {
-				0, 1, 2,
-				0, 2, 3
-			};
+		// Display the new frame (only the texture coordinates change if it's of the same size)
+		const size_t FRAME = mAnimation->getFrameIndex(mAnimationTime);
+		if (FRAME != mAnimationFrame) {
+			mAnimationFrame = FRAME;
+			const Box2f& RECT = mAnimation->getFrameRect(FRAME);
+			if (RECT.size == mTextureRect.size) {
+				mTextureRect = RECT;
+				mUpdateUV = true;
+			}
+			else {
+				mTextureRect = RECT;
+				mUpdatePosUV = true;
+			}
 		}
 	}
 
@@ -174,7 +280,7 @@ namespace ae
 		const Vector4f COLOR = mColor.normalize();
 
 		// Assign the normalized color to all the vertices
-		std::vector<Vertex2D>& vertices = getVertices();
+		Vertex2DList& vertices = getVertices();
 		for (Vertex2D& vertex : vertices) {
 			vertex.color = COLOR;
 		}
@@ -183,36 +289,70 @@ namespace ae
 	// Private virtual method(s)
 	void Sprite::updateSelf(const Time& dt)
 	{
+		// Advance the animation (if there is one playing)
+		if (mAnimationPlaying) {
+			updateAnimation(dt);
+		}
+
 		// Update the sprite's properties which may raise the dirty render flag
 		if (mUpdatePosUV) {
 			updatePosUV();
 			correctProperties();
+			mUpdateUV = false;
 			setDirty(std::exchange(mUpdatePosUV, false));
 		}
+		if (mUpdateUV) {
+			updateUV();
+			setDirty(std::exchange(mUpdateUV, false));
+		}
 		if (mUpdateColor) {
 			updateColor();
 			setDirty(std::exchange(mUpdateColor, false));
 		}
 	}
 
-	void Sprite::renderSelf(RenderStates states) const
+	bool Sprite::hasPendingUpdate() const
+	{
+		return mUpdatePosUV || mUpdateUV || mUpdateColor || mAnimationPlaying;
+	}
+
+	void Sprite::onDepthModified()
+	{
+		mUpdatePosUV = true;
+		wake();
+	}
+
+	void Sprite::renderSelf(const RenderStates& nodeStates) const
 	{
 		// Only render the sprite if a texture has been assigned
 		if (mTexture)
 		{
-			// Setup the appropriate render states
+			// Setup the appropriate render states (on a copy as the node's states are shared with the rest of the traversal)
+			RenderStates states(nodeStates);
 			if (!states.shader) {
-				states.shader = GLResourceFactory::getInstance().get<Shader>("_AEON_Basic2D").get();
+				// The default shader is resolved once per sprite, the factory reloading it in place
+				if (!mShader) {
+					mShader = GLResourceFactory::getInstance().get<Shader>("_AEON_Basic2D");
+				}
+				states.shader = mShader.get();
 			}
 			states.blendMode = BlendMode::BlendAlpha;
 			states.texture = mTexture;
+			if (mSampler) {
+				states.sampler = mSampler;
+			}
 			states.dirty = isDirty();
 
 			// Send the sprite to the renderer
-			Renderer2D::getActiveInstance()->submit(getVertices(), getIndices(), states);
+			submitGeometry(states);
 
 			// Drop the dirty render flag
 			setDirty(false);
 		}
 	}
+
+	std::unique_ptr<Actor2D> Sprite::cloneSelf() const
+	{
+		return std::make_unique<Sprite>(*this);
+	}
 }
\ No newline at end of file
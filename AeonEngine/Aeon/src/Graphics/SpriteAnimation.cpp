@@ -0,0 +1,110 @@
+// MIT License
+// 
+// Copyright(c) 2019-2021 Filippos Gleglakos
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#include <AEON/Graphics/SpriteAnimation.h>
+
+#include <AEON/Graphics/TextureAtlas.h>
+
+namespace ae
+{
+	// Public constructor(s)
+	SpriteAnimation::SpriteAnimation(const TextureAtlas& atlas, const Time& frameDuration, bool loop)
+		: mFrames()
+		, mAtlas(&atlas)
+		, mFrameDuration(frameDuration)
+		, mLoop(loop)
+	{
+		// Check if the frame duration provided is valid (ignored in Release mode)
+		if _CONSTEXPR_IF (AEON_DEBUG) {
+			if (mFrameDuration.asMicroseconds() <= 0) {
+				AEON_LOG_WARNING("Invalid frame duration", "The duration of the animation's frames must be positive.\nOnly the first frame will be displayed.");
+			}
+		}
+	}
+
+	// Public method(s)
+	void SpriteAnimation::addFrame(const std::string& filepath)
+	{
+		const Box2i RECT = mAtlas->getTextureRect(filepath);
+
+		// Check if the texture was found in the atlas (ignored in Release mode)
+		if _CONSTEXPR_IF (AEON_DEBUG) {
+			if (RECT == Box2i()) {
+				AEON_LOG_WARNING("Frame not found", "The texture \"" + filepath + "\" wasn't found in the animation's texture atlas.");
+			}
+		}
+
+		addFrame(Box2f(RECT));
+	}
+
+	void SpriteAnimation::addFrame(const Texture2D& texture)
+	{
+		addFrame(Box2f(mAtlas->getTextureRect(texture)));
+	}
+
+	void SpriteAnimation::addFrame(const Box2f& rect)
+	{
+		mFrames.push_back(rect);
+	}
+
+	size_t SpriteAnimation::getFrameIndex(const Time& elapsed) const noexcept
+	{
+		const int_fast64_t FRAME_DURATION = mFrameDuration.asMicroseconds();
+		if (mFrames.empty() || FRAME_DURATION <= 0 || elapsed.asMicroseconds() <= 0) {
+			return 0;
+		}
+
+		const size_t INDEX = static_cast<size_t>(elapsed.asMicroseconds() / FRAME_DURATION);
+		return (mLoop) ? INDEX % mFrames.size() : std::min(INDEX, mFrames.size() - 1);
+	}
+
+	const Box2f& SpriteAnimation::getFrameRect(size_t index) const noexcept
+	{
+		return mFrames[index];
+	}
+
+	size_t SpriteAnimation::getFrameCount() const noexcept
+	{
+		return mFrames.size();
+	}
+
+	const Time& SpriteAnimation::getFrameDuration() const noexcept
+	{
+		return mFrameDuration;
+	}
+
+	Time SpriteAnimation::getDuration() const noexcept
+	{
+		return mFrameDuration * static_cast<double>(mFrames.size());
+	}
+
+	const Texture2D& SpriteAnimation::getTexture() const noexcept
+	{
+		return mAtlas->getTexture();
+	}
+
+	bool SpriteAnimation::isLooping() const noexcept
+	{
+		return mLoop;
+	}
+}
\ No newline at end of file
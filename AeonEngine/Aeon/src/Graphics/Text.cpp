@@ -22,21 +22,73 @@
 
 #include <AEON/Graphics/Text.h>
 
+#include <algorithm>
+
+#include <AEON/System/MemoryTracker.h>
+#include <AEON/System/Profiler.h>
 #include <AEON/Graphics/internal/Glyph.h>
-#include <AEON/Graphics/internal/Renderer2D.h>
 #include <AEON/Graphics/Font.h>
 #include <AEON/Graphics/GLResourceFactory.h>
 
 namespace ae
 {
+	namespace
+	{
+		// The codepoint substituted to malformed UTF-8 sequences
+		constexpr uint32_t REPLACEMENT_CODEPOINT = 0xFFFD;
+
+		// Decodes the UTF-8 sequence starting at the index provided and moves the index to the following sequence
+		uint32_t decodeUTF8(const std::string& text, size_t& index) noexcept
+		{
+			const unsigned char LEAD = static_cast<unsigned char>(text[index++]);
+			if (LEAD < 0x80) {
+				return LEAD;
+			}
+
+			// Find the number of continuation bytes based on the lead byte
+			size_t continuationCount;
+			uint32_t codepoint;
+			if ((LEAD & 0xE0) == 0xC0) {
+				continuationCount = 1;
+				codepoint = LEAD & 0x1F;
+			}
+			else if ((LEAD & 0xF0) == 0xE0) {
+				continuationCount = 2;
+				codepoint = LEAD & 0x0F;
+			}
+			else if ((LEAD & 0xF8) == 0xF0) {
+				continuationCount = 3;
+				codepoint = LEAD & 0x07;
+			}
+			else {
+				return REPLACEMENT_CODEPOINT;
+			}
+
+			// Accumulate the continuation bytes' payloads
+			for (; continuationCount > 0; --continuationCount) {
+				if (index >= text.size() || (static_cast<unsigned char>(text[index]) & 0xC0) != 0x80) {
+					return REPLACEMENT_CODEPOINT;
+				}
+				codepoint = (codepoint << 6) | (static_cast<unsigned char>(text[index++]) & 0x3F);
+			}
+
+			return codepoint;
+		}
+	}
+
 	// Public constructor(s)
 	Text::Text()
 		: Actor2D()
 		, mText("")
 		, mGlyphs()
+		, mOffsets()
+		, mCharIndices()
+		, mLayoutStart(0)
 		, mModelBounds()
 		, mColor(Color::White)
 		, mFont(nullptr)
+		, mShader(nullptr)
+		, mDistanceFieldShader(nullptr)
 		, mCharacterSize(48)
 		, mUpdatePos(false)
 		, mUpdateUV(false)
@@ -44,35 +96,99 @@ namespace ae
 	{
 	}
 
+	Text::Text(const Text& copy)
+		: Actor2D(copy)
+		, mText(copy.mText)
+		, mGlyphs(copy.mGlyphs)
+		, mOffsets(copy.mOffsets)
+		, mCharIndices(copy.mCharIndices)
+		, mLayoutStart(copy.mLayoutStart)
+		, mModelBounds(copy.mModelBounds)
+		, mColor(copy.mColor)
+		, mFont(nullptr)
+		, mShader(copy.mShader)
+		, mDistanceFieldShader(copy.mDistanceFieldShader)
+		, mCharacterSize(copy.mCharacterSize)
+		, mUpdatePos(copy.mUpdatePos)
+		, mUpdateUV(copy.mUpdateUV)
+		, mUpdateColor(copy.mUpdateColor)
+	{
+		listenToFont(copy.mFont);
+	}
+
 	Text::Text(Text&& rvalue) noexcept
 		: Actor2D(std::move(rvalue))
 		, mText(std::move(rvalue.mText))
 		, mGlyphs(std::move(rvalue.mGlyphs))
+		, mOffsets(std::move(rvalue.mOffsets))
+		, mCharIndices(std::move(rvalue.mCharIndices))
+		, mLayoutStart(rvalue.mLayoutStart)
 		, mModelBounds(std::move(rvalue.mModelBounds))
 		, mColor(std::move(rvalue.mColor))
-		, mFont(rvalue.mFont)
+		, mFont(nullptr)
+		, mShader(std::move(rvalue.mShader))
+		, mDistanceFieldShader(std::move(rvalue.mDistanceFieldShader))
 		, mCharacterSize(rvalue.mCharacterSize)
 		, mUpdatePos(rvalue.mUpdatePos)
 		, mUpdateUV(rvalue.mUpdateUV)
 		, mUpdateColor(rvalue.mUpdateColor)
 	{
+		// Take over the rvalue's font listener
+		Font* const font = rvalue.mFont;
+		rvalue.listenToFont(nullptr);
+		listenToFont(font);
+	}
+
+	Text::~Text()
+	{
+		listenToFont(nullptr);
 	}
 
 	// Public operator(s)
+	Text& Text::operator=(const Text& other)
+	{
+		Actor2D::operator=(other);
+		mText = other.mText;
+		mGlyphs = other.mGlyphs;
+		mOffsets = other.mOffsets;
+		mCharIndices = other.mCharIndices;
+		mLayoutStart = other.mLayoutStart;
+		mModelBounds = other.mModelBounds;
+		mColor = other.mColor;
+		mShader = other.mShader;
+		mDistanceFieldShader = other.mDistanceFieldShader;
+		mCharacterSize = other.mCharacterSize;
+		mUpdatePos = other.mUpdatePos;
+		mUpdateUV = other.mUpdateUV;
+		mUpdateColor = other.mUpdateColor;
+		listenToFont(other.mFont);
+
+		return *this;
+	}
+
 	Text& Text::operator=(Text&& rvalue) noexcept
 	{
 		// Copy the rvalue's trivial data and move the rest
 		Actor2D::operator=(std::move(rvalue));
 		mText = std::move(rvalue.mText);
 		mGlyphs = std::move(rvalue.mGlyphs);
+		mOffsets = std::move(rvalue.mOffsets);
+		mCharIndices = std::move(rvalue.mCharIndices);
+		mLayoutStart = rvalue.mLayoutStart;
 		mModelBounds = std::move(rvalue.mModelBounds);
 		mColor = std::move(rvalue.mColor);
-		mFont = rvalue.mFont;
+		mShader = std::move(rvalue.mShader);
+		mDistanceFieldShader = std::move(rvalue.mDistanceFieldShader);
 		mCharacterSize = rvalue.mCharacterSize;
 		mUpdatePos = rvalue.mUpdatePos;
 		mUpdateUV = rvalue.mUpdateUV;
 		mUpdateColor = rvalue.mUpdateColor;
 
+		// Take over the rvalue's font listener
+		Font* const font = rvalue.mFont;
+		rvalue.listenToFont(nullptr);
+		listenToFont(font);
+
 		return *this;
 	}
 
@@ -87,13 +203,17 @@ namespace ae
 			}
 		}
 
-		mFont = &font;
+		listenToFont(&font);
+		mLayoutStart = 0;
 		mUpdatePos = true;
 		mUpdateUV = true;
+		wake();
 	}
 
 	void Text::setText(const std::string& text) noexcept
 	{
+		AEON_MEMORY_SCOPE(MemoryTag::Text);
+
 		// Check if the same text is being set (ignored in Release mode)
 		if _CONSTEXPR_IF (AEON_DEBUG) {
 			if (mText == text) {
@@ -103,8 +223,47 @@ namespace ae
 		}
 
 		mText = text;
+		mLayoutStart = 0;
 		mUpdatePos = true;
 		mUpdateUV = true;
+		wake();
+	}
+
+	void Text::append(const std::string& text)
+	{
+		insert(mText.size(), text);
+	}
+
+	void Text::insert(size_t index, std::string_view text)
+	{
+		// Check if the index is valid (ignored in Release mode)
+		if _CONSTEXPR_IF (AEON_DEBUG) {
+			if (index > mText.size()) {
+				AEON_LOG_ERROR("Invalid index", "The index provided is beyond the end of the text string.\nAborting operation.");
+				return;
+			}
+		}
+
+		if (!text.empty()) {
+			mText.insert(index, text);
+			invalidateLayout(index);
+		}
+	}
+
+	void Text::erase(size_t index, size_t count)
+	{
+		// Check if the index is valid (ignored in Release mode)
+		if _CONSTEXPR_IF (AEON_DEBUG) {
+			if (index >= mText.size()) {
+				AEON_LOG_ERROR("Invalid index", "The index provided is beyond the end of the text string.\nAborting operation.");
+				return;
+			}
+		}
+
+		if (count > 0) {
+			mText.erase(index, count);
+			invalidateLayout(index);
+		}
 	}
 
 	void Text::setCharacterSize(unsigned int characterSize) noexcept
@@ -118,8 +277,10 @@ namespace ae
 		}
 
 		mCharacterSize = characterSize;
+		mLayoutStart = 0;
 		mUpdatePos = true;
 		mUpdateUV = true;
+		wake();
 	}
 
 	void Text::setColor(const Color& color) noexcept
@@ -134,6 +295,7 @@ namespace ae
 
 		mColor = color;
 		mUpdateColor = true;
+		wake();
 	}
 
 	Vector2f Text::findCharPos(size_t index) const
@@ -150,15 +312,10 @@ namespace ae
 			}
 		}
 
-		// Calculate the character's horizontal advance
-		float offsetX = 0.f;
-		for (size_t i = 0; i < index; ++i) {
-			offsetX += static_cast<float>(mGlyphs[i]->advance >> 6);
-		}
-
-		// Calculate the character's top-left position and return it
-		return Vector2f(offsetX + static_cast<float>(mGlyphs[index]->bearing.x),
-		                -static_cast<float>(mGlyphs[index]->bearing.y));
+		// Calculate the character's top-left position based on its cached horizontal offset and return it
+		const float SCALE = mFont->getGlyphScale(mCharacterSize);
+		return Vector2f(mOffsets[index] + static_cast<float>(mGlyphs[index]->bearing.x) * SCALE,
+		                -static_cast<float>(mGlyphs[index]->bearing.y) * SCALE);
 	}
 
 	const Font* const Text::getFont() const noexcept
@@ -181,15 +338,70 @@ namespace ae
 		return mColor;
 	}
 
+	float Text::getCharacterOffset(size_t index) const noexcept
+	{
+		if (mOffsets.empty()) {
+			return 0.f;
+		}
+
+		// The byte offsets are followed by the string's size, as the glyphs' offsets are followed by the width
+		const size_t CHARACTER = std::lower_bound(mCharIndices.begin(), mCharIndices.end(), index) - mCharIndices.begin();
+		return mOffsets[std::min(CHARACTER, mOffsets.size() - 1)];
+	}
+
+	size_t Text::findCharacterIndex(float offset) const noexcept
+	{
+		// Select the boundary of the character whose middle follows the offset
+		for (size_t i = 0; i + 1 < mOffsets.size() && i + 1 < mCharIndices.size(); ++i) {
+			if (offset < (mOffsets[i] + mOffsets[i + 1]) / 2.f) {
+				return mCharIndices[i];
+			}
+		}
+		return mText.size();
+	}
+
 	// Public virtual method(s)
 	Box2f Text::getModelBounds() const
 	{
 		return mModelBounds;
 	}
 
+	// Public static method(s)
+	std::string Text::encodeUTF8(uint32_t codepoint)
+	{
+		// Substitute the surrogates and the codepoints beyond the unicode range
+		if ((codepoint >= 0xD800 && codepoint <= 0xDFFF) || codepoint > 0x10FFFF) {
+			codepoint = REPLACEMENT_CODEPOINT;
+		}
+
+		std::string sequence;
+		if (codepoint < 0x80) {
+			sequence.push_back(static_cast<char>(codepoint));
+		}
+		else if (codepoint < 0x800) {
+			sequence.push_back(static_cast<char>(0xC0 | (codepoint >> 6)));
+			sequence.push_back(static_cast<char>(0x80 | (codepoint & 0x3F)));
+		}
+		else if (codepoint < 0x10000) {
+			sequence.push_back(static_cast<char>(0xE0 | (codepoint >> 12)));
+			sequence.push_back(static_cast<char>(0x80 | ((codepoint >> 6) & 0x3F)));
+			sequence.push_back(static_cast<char>(0x80 | (codepoint & 0x3F)));
+		}
+		else {
+			sequence.push_back(static_cast<char>(0xF0 | (codepoint >> 18)));
+			sequence.push_back(static_cast<char>(0x80 | ((codepoint >> 12) & 0x3F)));
+			sequence.push_back(static_cast<char>(0x80 | ((codepoint >> 6) & 0x3F)));
+			sequence.push_back(static_cast<char>(0x80 | (codepoint & 0x3F)));
+		}
+
+		return sequence;
+	}
+
 	// Private method(s)
 	void Text::updatePos()
 	{
+		AEON_PROFILE_SCOPE("Text::updatePos");
+
 		// Make sure that a font has been set (ignored in Release mode)
 		if _CONSTEXPR_IF (AEON_DEBUG) {
 			if (!mFont) {
@@ -200,6 +412,9 @@ namespace ae
 
 		if (mText.empty()) {
 			mGlyphs.clear();
+			mOffsets.clear();
+			mCharIndices.clear();
+			mLayoutStart = std::string::npos;
 			getVertices().clear();
 			getIndices().clear();
 			mUpdateUV = false;
@@ -207,36 +422,65 @@ namespace ae
 			return;
 		}
 
-		// Retrieve the glyphs required to display the text
-		mGlyphs.clear();
-		mGlyphs.reserve(mText.size());
-		for (const char& character : mText) {
-			const uint32_t CODEPOINT = static_cast<uint32_t>(character);
-			const Glyph& glyph = mFont->getGlyph(CODEPOINT, mCharacterSize);
-			mGlyphs.emplace_back(&glyph);
+		// Find the first glyph affected by the edits (the glyphs whose UTF-8 sequence ends before the first edited byte are kept)
+		const size_t FIRST_BYTE = std::min(mLayoutStart, mText.size());
+		mLayoutStart = std::string::npos;
+		const size_t FIRST = (mCharIndices.empty()) ? 0 : std::min(static_cast<size_t>(std::upper_bound(mCharIndices.begin() + 1, mCharIndices.end(), FIRST_BYTE) - (mCharIndices.begin() + 1)), mGlyphs.size());
+
+		// Retrieve the glyphs required to display the text from the first edited character onward
+		const float SCALE = mFont->getGlyphScale(mCharacterSize);
+		if (FIRST == 0)
+		{
+			// Decode the whole string and reuse the font's layout of identical strings
+			std::u32string codepoints;
+			codepoints.reserve(mText.size());
+			mCharIndices.clear();
+			for (size_t index = 0; index < mText.size();) {
+				mCharIndices.push_back(index);
+				codepoints.push_back(decodeUTF8(mText, index));
+			}
+
+			const Font::GlyphRun& run = mFont->getGlyphRun(codepoints, mCharacterSize);
+			mGlyphs = run.glyphs;
+			mOffsets.resize(run.offsets.size());
+			std::transform(run.offsets.begin(), run.offsets.end(), mOffsets.begin(), [SCALE](float offset) { return offset * SCALE; });
+			mCharIndices.resize(mGlyphs.size());
+		}
+		else
+		{
+			// Decode the characters following the kept glyphs
+			mGlyphs.resize(FIRST);
+			mOffsets.resize(FIRST + 1);
+			mCharIndices.resize(FIRST + 1);
+			for (size_t index = mCharIndices.back(); index < mText.size(); mCharIndices.push_back(index)) {
+				const Glyph& glyph = mFont->getGlyph(decodeUTF8(mText, index), mCharacterSize);
+				mGlyphs.emplace_back(&glyph);
+				mOffsets.emplace_back(mOffsets.back() + static_cast<float>(glyph.advance >> 6) * SCALE);
+			}
+			mCharIndices.pop_back();
 		}
+		mCharIndices.push_back(mText.size());
 
-		// Raise the flag indicating that the colors will need to be updated if the vertex count is different
-		std::vector<Vertex2D>& vertices = getVertices();
-		if (vertices.size() != mGlyphs.size() * 4) {
-			vertices.resize(mGlyphs.size() * 4);
-			mUpdateColor = true;
+		// Resize the vertices, the ones preceding the first edited character are left untouched
+		Vertex2DList& vertices = getVertices();
+		vertices.resize(mGlyphs.size() * 4);
+		if (vertices.empty()) {
+			getIndices().clear();
+			return;
 		}
 
-		// Update the vertices
-		const float POS_Z = getPosition().z;
-		float offsetX = 0.f;
-		for (size_t i = 0; i < mGlyphs.size(); ++i) {
+		// Update the vertices (the glyphs' metrics are scaled if they were rasterized at another size)
+		const float POS_Z = static_cast<float>(getDepth());
+		for (size_t i = FIRST; i < mGlyphs.size(); ++i) {
 			// Update the positions
-			const Vector2f RECT_SIZE = mGlyphs[i]->textureRect.size;
-			Vector2f startPos(offsetX + mGlyphs[i]->bearing.x, -mGlyphs[i]->bearing.y);
+			const float offsetX = mOffsets[i];
+			const Vector2f RECT_SIZE = Vector2f(mGlyphs[i]->textureRect.size) * SCALE;
+			Vector2f startPos(offsetX + mGlyphs[i]->bearing.x * SCALE, -mGlyphs[i]->bearing.y * SCALE);
 
 			vertices[i * 4 + 0].position = Vector3f(Vector2f(startPos.x,               startPos.y)              , POS_Z);
 			vertices[i * 4 + 1].position = Vector3f(Vector2f(startPos.x,               startPos.y + RECT_SIZE.y), POS_Z);
 			vertices[i * 4 + 2].position = Vector3f(Vector2f(startPos.x + RECT_SIZE.x, startPos.y + RECT_SIZE.y), POS_Z);
 			vertices[i * 4 + 3].position = Vector3f(Vector2f(startPos.x + RECT_SIZE.x, startPos.y)              , POS_Z);
-
-			offsetX += static_cast<float>(mGlyphs[i]->advance >> 6);
 		}
 
 		// Update the model bounding box's position and size based on the minimum and maximum vertex positions
@@ -246,19 +490,26 @@ namespace ae
 			maxPos = max(maxPos, vertexItr->position.xy);
 		}
 		mModelBounds = Box2f(minPos, maxPos - minPos);
+		invalidateBounds();
 
-		// Update the indices (if necessary)
+		// Update the indices (if necessary) and the edited glyphs' remaining attributes if they aren't about to be entirely updated
 		updateIndices();
+		if (!mUpdateUV) {
+			updateUV(FIRST);
+		}
+		if (!mUpdateColor) {
+			updateColor(FIRST);
+		}
 	}
 
-	void Text::updateUV()
+	void Text::updateUV(size_t first)
 	{
 		if (!mGlyphs.empty()) {
 			const Vector2f TEXTURE_SIZE = mGlyphs.front()->texture->getSize();
 
 			// Update the vertices' uv coordinates
-			std::vector<Vertex2D>& vertices = getVertices();
-			for (size_t i = 0; i < mGlyphs.size(); ++i) {
+			Vertex2DList& vertices = getVertices();
+			for (size_t i = first; i < mGlyphs.size(); ++i) {
 				const Vector2f RECT_POS = mGlyphs[i]->textureRect.position;
 				const Vector2f RECT_SIZE = mGlyphs[i]->textureRect.size;
 
@@ -274,14 +525,16 @@ namespace ae
 	{
 		const size_t GLYPH_COUNT = mGlyphs.size();
 
-		// Check if the indices need to be updated based on the current number of glyphs
+		// Check if the indices need to be updated based on the current number of glyphs (each glyph's indices only depend on its index)
 		std::vector<unsigned int>& indices = getIndices();
-		if (indices.size() != GLYPH_COUNT * 6)
+		if (indices.size() > GLYPH_COUNT * 6) {
+			indices.resize(GLYPH_COUNT * 6);
+		}
+		else if (indices.size() < GLYPH_COUNT * 6)
 		{
-			// Recalculate the appropriate indices
-			indices.clear();
+			// Append the missing indices
 			indices.reserve(GLYPH_COUNT * 6);
-			for (size_t i = 0; i < GLYPH_COUNT; ++i) {
+			for (size_t i = indices.size() / 6; i < GLYPH_COUNT; ++i) {
 				indices.emplace_back(i * 4 + 0);
 				indices.emplace_back(i * 4 + 1);
 				indices.emplace_back(i * 4 + 2);
@@ -293,29 +546,59 @@ namespace ae
 		}
 	}
 
-	void Text::updateColor()
+	void Text::updateColor(size_t first)
 	{
 		const Vector4f COLOR = mColor.normalize();
 
-		std::vector<Vertex2D>& vertices = getVertices();
-		for (Vertex2D& vertex : vertices) {
-			vertex.color = COLOR;
+		Vertex2DList& vertices = getVertices();
+		for (auto vertexItr = vertices.begin() + first * 4; vertexItr != vertices.end(); ++vertexItr) {
+			vertexItr->color = COLOR;
 		}
 	}
 
-	// Private virtual method(s)
-	void Text::handleEventSelf(Event* const event)
+	void Text::invalidateLayout(size_t index)
 	{
-		if (event->type == Event::Type::FontUpdated) {
-			auto fontEvent = event->as<FontEvent>();
-			if (fontEvent->font == mFont) {
+		mLayoutStart = std::min(mLayoutStart, index);
+		mUpdatePos = true;
+		wake();
+	}
+
+	void Text::listenToFont(Font* font)
+	{
+		if (mFont) {
+			mFont->removeListener(this);
+		}
+
+		mFont = font;
+		if (mFont) {
+			mFont->addListener(this, [this](bool reloaded) {
+				// The glyphs are retrieved again if the font was reloaded
+				if (reloaded) {
+					mLayoutStart = 0;
+					mUpdatePos = true;
+				}
 				mUpdateUV = true;
-			}
+				wake();
+			});
 		}
 	}
 
+	// Private virtual method(s)
+	bool Text::hasPendingUpdate() const
+	{
+		return mUpdatePos || mUpdateUV || mUpdateColor;
+	}
+
+	void Text::onDepthModified()
+	{
+		mUpdatePos = true;
+		wake();
+	}
+
 	void Text::updateSelf(const Time& dt)
 	{
+		AEON_MEMORY_SCOPE(MemoryTag::Text);
+
 		// Update the text's properties which may raise the dirty render flag
 		if (mUpdatePos) {
 			updatePos();
@@ -330,25 +613,41 @@ namespace ae
 			updateColor();
 			setDirty(std::exchange(mUpdateColor, false));
 		}
+
+		// The labels of identical string, font, size and color share their vertices
+		shareVertices();
 	}
 
-	void Text::renderSelf(RenderStates states) const
+	void Text::renderSelf(const RenderStates& nodeStates) const
 	{
 		if (!mGlyphs.empty())
 		{
-			// Setup the appropriate render states
+			// Setup the appropriate render states on a copy (the distance fields are rendered with their dedicated shader)
+			RenderStates states(nodeStates);
 			if (!states.shader) {
-				states.shader = GLResourceFactory::getInstance().get<Shader>("_AEON_Text2D").get();
+				// The default shaders are resolved once per text, the factory reloading them in place
+				const bool DISTANCE_FIELD = (mFont->getRenderMode() == Font::RenderMode::DistanceField);
+				std::shared_ptr<Shader>& shader = (DISTANCE_FIELD) ? mDistanceFieldShader : mShader;
+				if (!shader) {
+					shader = GLResourceFactory::getInstance().get<Shader>((DISTANCE_FIELD) ? "_AEON_TextSDF2D" : "_AEON_Text2D");
+				}
+				states.shader = shader.get();
 			}
 			states.blendMode = BlendMode::BlendAlpha;
+			states.transparency = RenderStates::Transparency::Transparent;
 			states.texture = mGlyphs.front()->texture;
 			states.dirty = isDirty();
 		
 			// Submit the glyphs
-			Renderer2D::getActiveInstance()->submit(getVertices(), getIndices(), states);
+			submitGeometry(states);
 
 			// Drop the dirty render flag
 			setDirty(false);
 		}
 	}
+
+	std::unique_ptr<Actor2D> Text::cloneSelf() const
+	{
+		return std::make_unique<Text>(*this);
+	}
 }
\ No newline at end of file
@@ -22,11 +22,13 @@
 
 #include <AEON/Graphics/Texture.h>
 
+#include <algorithm>
 #include <string>
 
 #include <GL/glew.h>
 
 #include <AEON/Graphics/internal/GLCommon.h>
+#include <AEON/Graphics/TextureResidency.h>
 
 namespace ae
 {
@@ -41,17 +43,25 @@ namespace ae
 		// Check if the OpenGL handle is valid before attempting to bind it (ignored in Release mode)
 		if _CONSTEXPR_IF (AEON_DEBUG) {
 			if (!mHandle) {
-				AEON_LOG_ERROR("Invalid OpenGL handle", "The texture's OpenGL handle \"" + std::to_string(mHandle) + "\" is invalid.\nAborting binding.");
+				AEON_LOG_ERROR_F("Invalid OpenGL handle", "The texture's OpenGL handle \"{}\" is invalid.\nAborting binding.", mHandle);
 				return;
 			}
 		}
 
 		// Select the unit texture index provided and bind it to the context
-		GLCall(glBindTextureUnit(unit, mHandle));
+		gl::bindTextureUnit(unit, mHandle);
+		markUsed();
 	}
 
 	void Texture::generateMipmap(Filter filter)
 	{
+		// Warn that only the base level will be used if no other mip levels were allocated (ignored in Release mode)
+		if _CONSTEXPR_IF (AEON_DEBUG) {
+			if (mLevelCount < 2) {
+				AEON_LOG_WARNING("Incomplete mipmap", "The texture's storage only possesses its base level, it should be created with its mip levels allocated.");
+			}
+		}
+
 		// Generate the mipmap
 		GLCall(glGenerateTextureMipmap(mHandle));
 
@@ -97,6 +107,31 @@ namespace ae
 		return mHasMipmap;
 	}
 
+	void Texture::markUsed() const noexcept
+	{
+		mLastUsedFrame = TextureResidency::getInstance().getFrame();
+	}
+
+	uint64_t Texture::getLastUsedFrame() const noexcept
+	{
+		return mLastUsedFrame;
+	}
+
+	// Public static method(s)
+	Texture::FormatInfo Texture::getFormatInfo(InternalFormat format) noexcept
+	{
+		const Format FORMAT(format);
+		const int BYTE_COUNT = (FORMAT.compressed) ? 0 : FORMAT.imposedChannels * (FORMAT.bitCount / 8);
+		return FormatInfo{
+			FORMAT.base,
+			static_cast<uint32_t>((FORMAT.bitCount == 16) ? GL_UNSIGNED_SHORT : GL_UNSIGNED_BYTE),
+			FORMAT.imposedChannels,
+			FORMAT.bitCount,
+			static_cast<size_t>(BYTE_COUNT),
+			FORMAT.compressed
+		};
+	}
+
 	// Public virtual method(s)
 	void Texture::setWrap(Wrap wrap)
 	{
@@ -108,6 +143,11 @@ namespace ae
 		}
 	}
 
+	bool Texture::isOpaque() const noexcept
+	{
+		return false;
+	}
+
 	void Texture::destroy() const
 	{
 		// Check if the OpenGL identifier is valid (ignored in Release mode)
@@ -118,6 +158,7 @@ namespace ae
 			}
 		}
 
+		gl::releaseObject(mHandle, 0, 0);
 		GLCall(glDeleteTextures(1, &mHandle));
 	}
 
@@ -130,7 +171,7 @@ namespace ae
 	void Texture::unbind() const
 	{
 		// Unbind the currently-bound texture at the first unit texture
-		GLCall(glBindTextureUnit(0, 0));
+		gl::bindTextureUnit(0, 0);
 	}
 
 	// Protected constructor(s)
@@ -139,8 +180,10 @@ namespace ae
 		, mFormat(internalFormat)
 		, mWrap(Wrap::None)
 		, mBindingTarget(target)
+		, mLevelCount(1)
 		, mHasMipmap(false)
 		, mFilter(Filter::None)
+		, mLastUsedFrame(0)
 	{
 		// Create the texture object
 		GLCall(glCreateTextures(mBindingTarget, 1, &mHandle));
@@ -159,8 +202,10 @@ namespace ae
 		, mFormat(std::move(rvalue.mFormat))
 		, mWrap(rvalue.mWrap)
 		, mBindingTarget(rvalue.mBindingTarget)
+		, mLevelCount(rvalue.mLevelCount)
 		, mHasMipmap(rvalue.mHasMipmap)
 		, mFilter(rvalue.mFilter)
+		, mLastUsedFrame(rvalue.mLastUsedFrame)
 	{
 	}
 
@@ -172,12 +217,49 @@ namespace ae
 		mFormat = std::move(rvalue.mFormat);
 		mWrap = rvalue.mWrap;
 		mBindingTarget = rvalue.mBindingTarget;
+		mLevelCount = rvalue.mLevelCount;
 		mHasMipmap = rvalue.mHasMipmap;
 		mFilter = rvalue.mFilter;
+		mLastUsedFrame = rvalue.mLastUsedFrame;
 
 		return *this;
 	}
 
+	// Protected method(s)
+	void Texture::recreate(int levelCount)
+	{
+		// Replace the OpenGL texture
+		destroy();
+		GLCall(glCreateTextures(mBindingTarget, 1, &mHandle));
+
+		// Reapply the filter type (falling back on its base filter without mip levels) and the wrapping mode
+		const Filter FILTER = mFilter;
+		const Wrap WRAP = mWrap;
+		mFilter = Filter::None;
+		mWrap = Wrap::None;
+		mLevelCount = levelCount;
+		mHasMipmap = levelCount > 1;
+		if (FILTER != Filter::None) {
+			const bool LINEAR = FILTER == Filter::Linear || FILTER == Filter::Linear_MipNearest || FILTER == Filter::Linear_MipLinear;
+			setFilter((mHasMipmap) ? FILTER : (LINEAR) ? Filter::Linear : Filter::Nearest);
+		}
+		if (WRAP != Wrap::None) {
+			setWrap(WRAP);
+		}
+	}
+
+	// Protected static method(s)
+	int Texture::getMipLevelCount(unsigned int width, unsigned int height) noexcept
+	{
+		// Count the halvings until the largest dimension reaches 1
+		int levelCount = 1;
+		for (unsigned int size = std::max(width, height); size > 1; size /= 2) {
+			++levelCount;
+		}
+
+		return levelCount;
+	}
+
 	// Texture::Format
 		// Public constructor(s)
 	Texture::Format::Format(InternalFormat internalFormat) noexcept
@@ -185,6 +267,7 @@ namespace ae
 		, base(GL_RGBA)
 		, imposedChannels(0)
 		, bitCount(8)
+		, compressed(false)
 	{
 		switch (internal)
 		{
@@ -216,6 +299,13 @@ namespace ae
 		case InternalFormat::RGBA16:
 			imposedChannels = 4;
 			bitCount = 16;
+			break;
+		case InternalFormat::BC1:
+		case InternalFormat::BC3:
+		case InternalFormat::BC7:
+		case InternalFormat::ASTC4x4:
+			imposedChannels = 4;
+			compressed = true;
 		}
 	}
 
@@ -224,6 +314,7 @@ namespace ae
 		, base(rvalue.base)
 		, imposedChannels(rvalue.imposedChannels)
 		, bitCount(rvalue.bitCount)
+		, compressed(rvalue.compressed)
 	{
 	}
 
@@ -235,6 +326,7 @@ namespace ae
 		base = rvalue.base;
 		imposedChannels = rvalue.imposedChannels;
 		bitCount = rvalue.bitCount;
+		compressed = rvalue.compressed;
 
 		return *this;
 	}
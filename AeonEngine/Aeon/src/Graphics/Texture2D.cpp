@@ -22,7 +22,13 @@
 
 #include <AEON/Graphics/Texture2D.h>
 
+#include <algorithm>
+#include <cctype>
+#include <climits>
+#include <cstring>
+#include <mutex>
 #include <string>
+#include <utility>
 
 #include <GL/glew.h>
 #define STB_IMAGE_IMPLEMENTATION
@@ -30,14 +36,254 @@
 #include <stb_image.h>
 
 #include <AEON/Graphics/internal/GLCommon.h>
+#include <AEON/System/FileSystem.h>
 
 namespace ae
 {
+	namespace
+	{
+		// The signature of the KTX2 containers
+		constexpr uint8_t KTX2_IDENTIFIER[12] = { 0xAB, 'K', 'T', 'X', ' ', '2', '0', 0xBB, '\r', '\n', 0x1A, '\n' };
+
+		// The decoders registered per extension, guarded by their mutex as the images are decoded on worker threads
+		struct DecoderRegistry
+		{
+			std::vector<std::pair<std::string, Texture2D::Decoder>> decoders;
+			std::mutex                                              mutex;
+		};
+
+		DecoderRegistry& getDecoderRegistry()
+		{
+			static DecoderRegistry registry;
+			return registry;
+		}
+
+		// Check whether the filepath provided possesses the extension provided (in lowercase)
+		bool hasExtension(const std::string& filename, const std::string& extension)
+		{
+			if (filename.size() < extension.size()) {
+				return false;
+			}
+
+			return std::equal(extension.rbegin(), extension.rend(), filename.rbegin(), [](char c1, char c2) {
+				return c1 == std::tolower(static_cast<unsigned char>(c2));
+			});
+		}
+
+		// Read a little-endian value from the file's data (the offset is assumed to be within bounds)
+		template <typename T>
+		T readValue(const uint8_t* data, size_t offset) noexcept
+		{
+			T value = 0;
+			std::memcpy(&value, data + offset, sizeof(T));
+			return value;
+		}
+
+		// Retrieve the filter sampling the mip levels that corresponds to the filter provided
+		Texture::Filter getMipFilter(Texture::Filter filter) noexcept
+		{
+			switch (filter)
+			{
+			case Texture::Filter::Nearest:
+				return Texture::Filter::Nearest_MipNearest;
+			case Texture::Filter::None:
+			case Texture::Filter::Linear:
+				return Texture::Filter::Linear_MipLinear;
+			default:
+				return filter;
+			}
+		}
+
+		// Calculate the size of a pre-built mip level (every compressed format supported is stored in 4x4 blocks)
+		size_t getLevelSize(Texture::InternalFormat format, unsigned int width, unsigned int height) noexcept
+		{
+			if (format == Texture::InternalFormat::RGBA8) {
+				return static_cast<size_t>(width) * height * 4;
+			}
+
+			const size_t BLOCK_SIZE = (format == Texture::InternalFormat::BC1) ? 8 : 16;
+			return static_cast<size_t>(std::max((width + 3) / 4, 1u)) * std::max((height + 3) / 4, 1u) * BLOCK_SIZE;
+		}
+
+		// Calculate the size of an uncompressed texel (the depth and stencil formats don't impose any channels)
+		size_t getTexelSize(Texture::InternalFormat format, int imposedChannels, int bitCount) noexcept
+		{
+			switch (format)
+			{
+			case Texture::InternalFormat::DEPTH32:
+			case Texture::InternalFormat::DEPTH24:
+			case Texture::InternalFormat::DEPTH24STENCIL:
+				return 4;
+			case Texture::InternalFormat::DEPTH16:
+				return 2;
+			case Texture::InternalFormat::DEPTH32STENCIL:
+				return 8;
+			case Texture::InternalFormat::STENCIL:
+				return 1;
+			default:
+				return static_cast<size_t>(imposedChannels) * (bitCount / 8);
+			}
+		}
+
+		// Copy the mip levels located at the ranges provided consecutively into the image
+		bool storeLevels(const uint8_t* file, size_t fileSize, const std::vector<std::pair<uint64_t, uint64_t>>& ranges, Texture2D::Image& image)
+		{
+			// Check that each level lies within the file and possesses the size expected
+			size_t byteCount = 0;
+			unsigned int width = image.size.x, height = image.size.y;
+			for (const auto& range : ranges) {
+				if (range.first > fileSize || range.second > fileSize - range.first || range.second != getLevelSize(image.format, width, height)) {
+					image.error = "The container's mip levels are truncated or invalid.";
+					return false;
+				}
+
+				byteCount += static_cast<size_t>(range.second);
+				width = std::max(width / 2, 1u);
+				height = std::max(height / 2, 1u);
+			}
+
+			// Copy the levels with the base level first
+			uint8_t* const pixels = new uint8_t[byteCount];
+			image.pixels.reset(pixels, std::default_delete<uint8_t[]>());
+			image.levels.clear();
+			size_t offset = 0;
+			for (const auto& range : ranges) {
+				std::memcpy(pixels + offset, file + range.first, static_cast<size_t>(range.second));
+				image.levels.push_back(static_cast<size_t>(range.second));
+				offset += static_cast<size_t>(range.second);
+			}
+			image.byteCount = byteCount;
+
+			return true;
+		}
+
+		// Decode a DDS container holding BC1, BC3 or BC7 blocks or RGBA8 texels (the legacy and the DX10 headers are supported)
+		bool decodeDDS(const uint8_t* file, size_t fileSize, Texture2D::Image& image)
+		{
+			if (fileSize < 128 || std::memcmp(file, "DDS ", 4) != 0) {
+				image.error = "The file isn't a valid DDS container.";
+				return false;
+			}
+
+			// Retrieve the compressed format from the pixel format's FourCC code or from the DX10 header's DXGI format
+			size_t dataOffset = 128;
+			const char* const FOUR_CC = reinterpret_cast<const char*>(file + 84);
+			if (std::memcmp(FOUR_CC, "DXT1", 4) == 0) {
+				image.format = Texture::InternalFormat::BC1;
+			}
+			else if (std::memcmp(FOUR_CC, "DXT5", 4) == 0) {
+				image.format = Texture::InternalFormat::BC3;
+			}
+			else if (std::memcmp(FOUR_CC, "DX10", 4) == 0 && fileSize >= 148) {
+				dataOffset = 148;
+				switch (readValue<uint32_t>(file, 128))
+				{
+				case 28: // DXGI_FORMAT_R8G8B8A8_UNORM
+					image.format = Texture::InternalFormat::RGBA8;
+					break;
+				case 71: // DXGI_FORMAT_BC1_UNORM
+					image.format = Texture::InternalFormat::BC1;
+					break;
+				case 77: // DXGI_FORMAT_BC3_UNORM
+					image.format = Texture::InternalFormat::BC3;
+					break;
+				case 98: // DXGI_FORMAT_BC7_UNORM
+					image.format = Texture::InternalFormat::BC7;
+					break;
+				default:
+					dataOffset = 0;
+				}
+			}
+			else {
+				dataOffset = 0;
+			}
+
+			if (dataOffset == 0) {
+				image.error = "The DDS container's format isn't supported (only BC1, BC3, BC7 and RGBA8 are).";
+				return false;
+			}
+
+			// The mip levels are stored consecutively after the headers, the base level first
+			image.size = Vector2u(readValue<uint32_t>(file, 16), readValue<uint32_t>(file, 12));
+			const uint32_t LEVEL_COUNT = std::max(readValue<uint32_t>(file, 28), 1u);
+			std::vector<std::pair<uint64_t, uint64_t>> ranges;
+			unsigned int width = image.size.x, height = image.size.y;
+			for (uint32_t i = 0; i < LEVEL_COUNT; ++i) {
+				ranges.emplace_back(dataOffset, getLevelSize(image.format, width, height));
+				dataOffset += static_cast<size_t>(ranges.back().second);
+				width = std::max(width / 2, 1u);
+				height = std::max(height / 2, 1u);
+			}
+
+			return storeLevels(file, fileSize, ranges, image);
+		}
+
+		// Decode a KTX2 container holding BC1, BC3, BC7 or ASTC 4x4 blocks or RGBA8 texels (supercompressed containers aren't supported)
+		bool decodeKTX2(const uint8_t* file, size_t fileSize, Texture2D::Image& image)
+		{
+			if (fileSize < 80 || std::memcmp(file, KTX2_IDENTIFIER, sizeof(KTX2_IDENTIFIER)) != 0) {
+				image.error = "The file isn't a valid KTX2 container.";
+				return false;
+			}
+
+			// Only two-dimensional textures without any supercompression are supported
+			if (readValue<uint32_t>(file, 28) > 1 || readValue<uint32_t>(file, 32) > 1 || readValue<uint32_t>(file, 36) != 1) {
+				image.error = "The KTX2 container doesn't hold a 2D texture.";
+				return false;
+			}
+			if (readValue<uint32_t>(file, 44) != 0) {
+				image.error = "The KTX2 container is supercompressed, which isn't supported.";
+				return false;
+			}
+
+			// Retrieve the compressed format from the Vulkan format
+			switch (readValue<uint32_t>(file, 12))
+			{
+			case 37: // VK_FORMAT_R8G8B8A8_UNORM
+				image.format = Texture::InternalFormat::RGBA8;
+				break;
+			case 131: // VK_FORMAT_BC1_RGB_UNORM_BLOCK
+			case 133: // VK_FORMAT_BC1_RGBA_UNORM_BLOCK
+				image.format = Texture::InternalFormat::BC1;
+				break;
+			case 137: // VK_FORMAT_BC3_UNORM_BLOCK
+				image.format = Texture::InternalFormat::BC3;
+				break;
+			case 145: // VK_FORMAT_BC7_UNORM_BLOCK
+				image.format = Texture::InternalFormat::BC7;
+				break;
+			case 157: // VK_FORMAT_ASTC_4x4_UNORM_BLOCK
+				image.format = Texture::InternalFormat::ASTC4x4;
+				break;
+			default:
+				image.error = "The KTX2 container's format isn't supported (only BC1, BC3, BC7, ASTC 4x4 and RGBA8 are).";
+				return false;
+			}
+
+			// Retrieve the mip levels' ranges from the level index (which lists the base level first)
+			image.size = Vector2u(readValue<uint32_t>(file, 20), readValue<uint32_t>(file, 24));
+			const uint32_t LEVEL_COUNT = std::max(readValue<uint32_t>(file, 40), 1u);
+			if (80 + static_cast<size_t>(LEVEL_COUNT) * 24 > fileSize) {
+				image.error = "The KTX2 container's level index is truncated.";
+				return false;
+			}
+
+			std::vector<std::pair<uint64_t, uint64_t>> ranges;
+			for (uint32_t i = 0; i < LEVEL_COUNT; ++i) {
+				ranges.emplace_back(readValue<uint64_t>(file, 80 + i * 24), readValue<uint64_t>(file, 88 + i * 24));
+			}
+
+			return storeLevels(file, fileSize, ranges, image);
+		}
+	}
+
 	// Public constructor(s)
 	Texture2D::Texture2D(Filter filter, Wrap wrap, InternalFormat internalFormat)
 		: Texture(GL_TEXTURE_2D, filter, wrap, internalFormat)
 		, mFilepath("")
 		, mSize(0, 0)
+		, mAlphaCoverage(AlphaCoverage::Unknown)
+		, mEvicted(false)
 	{
 	}
 
@@ -45,6 +291,8 @@ namespace ae
 		: Texture(std::move(rvalue))
 		, mFilepath(std::move(rvalue.mFilepath))
 		, mSize(std::move(rvalue.mSize))
+		, mAlphaCoverage(rvalue.mAlphaCoverage)
+		, mEvicted(rvalue.mEvicted)
 	{
 	}
 
@@ -55,12 +303,14 @@ namespace ae
 		Texture::operator=(std::move(rvalue));
 		mFilepath = std::move(rvalue.mFilepath);
 		mSize = std::move(rvalue.mSize);
+		mAlphaCoverage = rvalue.mAlphaCoverage;
+		mEvicted = rvalue.mEvicted;
 
 		return *this;
 	}
 
 	// Public method(s)
-	bool Texture2D::create(unsigned int width, unsigned int height, const void* data)
+	bool Texture2D::create(unsigned int width, unsigned int height, const void* data, bool scanAlpha, bool mipmap)
 	{
 		// Check that the dimensions provided are valid (ignored in Release mode)
 		if _CONSTEXPR_IF (AEON_DEBUG)
@@ -73,15 +323,17 @@ namespace ae
 		}
 
 		// Recreate the texture if necessary
+		const int LEVEL_COUNT = (mipmap) ? getMipLevelCount(width, height) : 1;
 		if (mSize.x != 0) {
-			destroy();
-			GLCall(glCreateTextures(mBindingTarget, 1, &mHandle));
+			recreate(LEVEL_COUNT);
 		}
 
 		// Modify the texture's metadata
 		mSize.x = width;
 		mSize.y = height;
+		mLevelCount = LEVEL_COUNT;
 		mHasMipmap = false;
+		mEvicted = false;
 		if (mFormat.internal == InternalFormat::Native) {
 			mFormat = Format(InternalFormat::RGBA8);
 		}
@@ -91,12 +343,18 @@ namespace ae
 			GLCall(glPixelStorei(GL_UNPACK_ALIGNMENT, 1));
 		}
 
-		// Create the OpenGL texture with the dimensions width x height and fill it with the image data provided
-		GLCall(glTextureStorage2D(mHandle, 1, static_cast<GLenum>(mFormat.internal), width, height));
+		// Create the OpenGL texture with the dimensions width x height and fill it with the image data provided (generating the mip levels from it)
+		GLCall(glTextureStorage2D(mHandle, LEVEL_COUNT, static_cast<GLenum>(mFormat.internal), width, height));
 		if (data) {
 			GLCall(glTextureSubImage2D(mHandle, 0, 0, 0, width, height, mFormat.base, GL_UNSIGNED_BYTE, data));
+			if (mipmap) {
+				generateMipmap(getMipFilter(getFilter()));
+			}
 		}
 
+		// Determine the texture's alpha coverage (the content of a texture created without data is unknown)
+		mAlphaCoverage = (data && scanAlpha) ? scanAlphaCoverage(data, static_cast<size_t>(width) * height, false) : AlphaCoverage::Unknown;
+
 		// Reactivate the byte alignment restriction if necessary
 		if (mFormat.internal == InternalFormat::R8 || mFormat.internal == InternalFormat::R16) {
 			GLCall(glPixelStorei(GL_UNPACK_ALIGNMENT, 4));
@@ -105,7 +363,7 @@ namespace ae
 		return true;
 	}
 
-	bool Texture2D::update(unsigned int offsetX, unsigned int offsetY, unsigned int width, unsigned int height, const void* data)
+	bool Texture2D::update(unsigned int offsetX, unsigned int offsetY, unsigned int width, unsigned int height, const void* data, const void* pixels)
 	{
 		// Check that the parameters provided are valid (ignored in Release mode)
 		if _CONSTEXPR_IF (AEON_DEBUG)
@@ -115,6 +373,11 @@ namespace ae
 				AEON_LOG_ERROR("Failed to update texture", "The texture has yet to be created.");
 				return false;
 			}
+			// Emit error if the texture's storage is a placeholder
+			if (mEvicted) {
+				AEON_LOG_ERROR("Failed to update texture", "The texture " + mFilepath + " was evicted, it has to be uploaded again beforehand.");
+				return false;
+			}
 			// Emit error if the offsets provided are greater than the texture's size
 			if (offsetX >= mSize.x || offsetY >= mSize.y) {
 				AEON_LOG_ERROR("Failed to update texture", "The offsets (" + std::to_string(offsetX) + ", " + std::to_string(offsetY) + ") are invalid.");
@@ -132,8 +395,16 @@ namespace ae
 			GLCall(glPixelStorei(GL_UNPACK_ALIGNMENT, 1));
 		}
 
-		// Modify the texture's image data
-		GLCall(glTextureSubImage2D(mHandle, 0, offsetX, offsetY, width, height, mFormat.base, GL_UNSIGNED_BYTE, data));
+		// Modify the texture's image data (sourced from the pixel unpack buffer bound if an offset was provided) and regenerate the mip levels from it
+		GLCall(glTextureSubImage2D(mHandle, 0, offsetX, offsetY, width, height, mFormat.base, GL_UNSIGNED_BYTE, (pixels) ? pixels : data));
+		if (mHasMipmap) {
+			GLCall(glGenerateTextureMipmap(mHandle));
+		}
+
+		// Check whether an opaque texture has become translucent
+		if (mAlphaCoverage == AlphaCoverage::Opaque) {
+			mAlphaCoverage = scanAlphaCoverage(data, static_cast<size_t>(width) * height, false);
+		}
 
 		// Reactivate the byte alignment restriction if necessary
 		if (mFormat.internal == InternalFormat::R8 || mFormat.internal == InternalFormat::R16) {
@@ -143,63 +414,200 @@ namespace ae
 		return true;
 	}
 
-	bool Texture2D::loadFromFile(const std::string& filename)
+	bool Texture2D::loadFromFile(const std::string& filename, bool scanAlpha, bool mipmap)
 	{
-		// Store filepath
-		mFilepath = filename;
+		// Decode the image and upload it (the data is released once the image is destroyed)
+		Image image;
+		if (!decodeFromFile(filename, mFormat.internal, image)) {
+			mFilepath = filename;
+			AEON_LOG_ERROR("Failed to load texture " + filename + " from file", std::move(image.error));
+			return false;
+		}
 
-		// Load in the image data
-		int width, height, channels;
-		stbi_uc* pixels8 = (mFormat.bitCount == 8) ? stbi_load(filename.c_str(), &width, &height, &channels, mFormat.imposedChannels) : nullptr;
-		stbi_us* pixels16 = (mFormat.bitCount == 16 || !pixels8) ? stbi_load_16(filename.c_str(), &width, &height, &channels, mFormat.imposedChannels) : nullptr;
+		return upload(image, scanAlpha, nullptr, mipmap);
+	}
+
+	bool Texture2D::reloadFromFile()
+	{
+		// Check that the texture was loaded from a file (ignored in Release mode)
+		if _CONSTEXPR_IF (AEON_DEBUG) {
+			if (mFilepath.empty()) {
+				AEON_LOG_ERROR("Failed to reload texture", "The texture wasn't loaded from a file.\nAborting operation.");
+				return false;
+			}
+		}
+
+		// The mip chain is generated again if the texture possessed one, the pre-built levels being reloaded as they are
+		const std::string FILEPATH = mFilepath;
+		return loadFromFile(FILEPATH, mAlphaCoverage != AlphaCoverage::Unknown, mLevelCount > 1);
+	}
+
+	bool Texture2D::upload(const Image& image, bool scanAlpha, const void* pixels, bool mipmap)
+	{
+		// Check that the image provided was decoded (ignored in Release mode)
+		const bool PREBUILT = !image.levels.empty();
+		if _CONSTEXPR_IF (AEON_DEBUG) {
+			if (!image.pixels) {
+				AEON_LOG_ERROR("Failed to upload texture", "The image " + image.filepath + " hasn't been decoded.\nAborting operation.");
+				return false;
+			}
+			if (!PREBUILT && Format(image.format).compressed) {
+				AEON_LOG_ERROR("Failed to upload texture", "The compressed internal formats are reserved to pre-compressed images (.dds or .ktx2), " + image.filepath + " isn't one.\nAborting operation.");
+				return false;
+			}
+		}
 
-		// Log an error message if the image couldn't be loaded in
-		if (!pixels8 && !pixels16) {
-			AEON_LOG_ERROR("Failed to load texture " + filename + " from file", stbi_failure_reason());
+		// Check that the hardware supports ASTC compression
+		if (image.format == InternalFormat::ASTC4x4 && !GLEW_KHR_texture_compression_astc_ldr) {
+			AEON_LOG_ERROR("Failed to upload texture", "The image " + image.filepath + " is ASTC-compressed, which isn't supported by the hardware.\nAborting operation.");
 			return false;
 		}
+
 		// Log a warning message if the image's dimensions aren't even numbers (ignored in Release mode)
 		if _CONSTEXPR_IF (AEON_DEBUG) {
-			if (width % 2 != 0 || height % 2 != 0) {
-				AEON_LOG_WARNING("Texture may not display correctly", "The dimensions (" + std::to_string(width) + "x" + std::to_string(height) + ") aren't even numbers");
+			if (image.size.x % 2 != 0 || image.size.y % 2 != 0) {
+				AEON_LOG_WARNING("Texture may not display correctly", "The dimensions (" + std::to_string(image.size.x) + "x" + std::to_string(image.size.y) + ") aren't even numbers");
 			}
 		}
 
-		// Modify the texture's metadata
-		mSize.x = width;
-		mSize.y = height;
-		mHasMipmap = false;
-		if (mFormat.internal == InternalFormat::Native) {
-			switch (channels)
+		// Resolve the native format from the image's channels and bit depth
+		InternalFormat format = image.format;
+		if (format == InternalFormat::Native) {
+			switch (image.channels)
 			{
 			case 4:
-				mFormat = Format((pixels8) ? InternalFormat::RGBA8 : InternalFormat::RGBA16);
+				format = (!image.is16Bit) ? InternalFormat::RGBA8 : InternalFormat::RGBA16;
 				break;
 			case 1:
-				mFormat = Format((pixels8) ? InternalFormat::R8 : InternalFormat::R16);
+				format = (!image.is16Bit) ? InternalFormat::R8 : InternalFormat::R16;
 				break;
 			case 3:
-				mFormat = Format(InternalFormat::RGB8);
+				format = InternalFormat::RGB8;
 				break;
 			case 2:
-				mFormat = Format((pixels8) ? InternalFormat::RG8 : InternalFormat::RG16);
+				format = (!image.is16Bit) ? InternalFormat::RG8 : InternalFormat::RG16;
 			}
 		}
 
-		// Create the OpenGL texture with the loaded texture data and release the data
-		GLCall(glTextureStorage2D(mHandle, 1, static_cast<GLenum>(mFormat.internal), width, height));
-		if (mFormat.bitCount == 8) {
-			GLCall(glTextureSubImage2D(mHandle, 0, 0, 0, width, height, mFormat.base, GL_UNSIGNED_BYTE, pixels8));
-			stbi_image_free(pixels8);
+		// Keep the current storage if it matches the image's (as when an image is reloaded), the texture is recreated otherwise as its storage is immutable
+		const int LEVEL_COUNT = (PREBUILT) ? static_cast<int>(image.levels.size()) : (mipmap) ? getMipLevelCount(image.size.x, image.size.y) : 1;
+		const bool KEEP_STORAGE = mSize.x != 0 && !mEvicted && mSize == image.size && mLevelCount == LEVEL_COUNT && mFormat.internal == format;
+		if (mSize.x != 0 && !KEEP_STORAGE) {
+			recreate(LEVEL_COUNT);
+		}
+
+		// Modify the texture's metadata (the generated mip levels are only available once they've been generated)
+		mFilepath = image.filepath;
+		mSize = image.size;
+		mLevelCount = LEVEL_COUNT;
+		mHasMipmap = PREBUILT && LEVEL_COUNT > 1;
+		mEvicted = false;
+		mFormat = Format(format);
+
+		// Determine the texture's alpha coverage (the compressed texels aren't scanned)
+		if (scanAlpha && !mFormat.compressed) {
+			mAlphaCoverage = scanAlphaCoverage(image.pixels.get(), static_cast<size_t>(image.size.x) * image.size.y, image.is16Bit);
 		}
 		else {
-			GLCall(glTextureSubImage2D(mHandle, 0, 0, 0, width, height, mFormat.base, GL_UNSIGNED_SHORT, pixels16));
-			stbi_image_free(pixels16);
+			mAlphaCoverage = AlphaCoverage::Unknown;
+		}
+
+		// Create the OpenGL texture (the texels are sourced from the pixel unpack buffer bound if an offset was provided)
+		const void* const DATA = (pixels) ? pixels : image.pixels.get();
+		if (!KEEP_STORAGE) {
+			GLCall(glTextureStorage2D(mHandle, LEVEL_COUNT, static_cast<GLenum>(mFormat.internal), image.size.x, image.size.y));
+		}
+		if (!PREBUILT) {
+			// Fill the base level with the image's texels and generate the other levels from it
+			GLCall(glTextureSubImage2D(mHandle, 0, 0, 0, image.size.x, image.size.y, mFormat.base, (image.is16Bit) ? GL_UNSIGNED_SHORT : GL_UNSIGNED_BYTE, DATA));
+			if (mipmap) {
+				generateMipmap(getMipFilter(getFilter()));
+			}
+
+			return true;
+		}
+
+		// Upload the pre-built mip levels as they are
+		const uint8_t* level = static_cast<const uint8_t*>(DATA);
+		unsigned int width = image.size.x, height = image.size.y;
+		for (int i = 0; i < LEVEL_COUNT; ++i) {
+			const GLsizei LEVEL_SIZE = static_cast<GLsizei>(image.levels[i]);
+			if (mFormat.compressed) {
+				GLCall(glCompressedTextureSubImage2D(mHandle, i, 0, 0, width, height, static_cast<GLenum>(mFormat.internal), LEVEL_SIZE, level));
+			}
+			else {
+				GLCall(glTextureSubImage2D(mHandle, i, 0, 0, width, height, mFormat.base, GL_UNSIGNED_BYTE, level));
+			}
+			level += LEVEL_SIZE;
+			width = std::max(width / 2, 1u);
+			height = std::max(height / 2, 1u);
+		}
+
+		// Sample the pre-built mip levels
+		if (mHasMipmap) {
+			setFilter(getMipFilter(getFilter()));
 		}
 
 		return true;
 	}
 
+	bool Texture2D::evict(unsigned int placeholderSize)
+	{
+		if (mEvicted || mSize.x == 0) {
+			return false;
+		}
+
+		// Find the coarsest mip level within the placeholder size
+		int level = 0;
+		Vector2u levelSize = mSize;
+		while (level + 1 < mLevelCount && std::max(levelSize.x, levelSize.y) > placeholderSize) {
+			++level;
+			levelSize.x = std::max(levelSize.x / 2, 1u);
+			levelSize.y = std::max(levelSize.y / 2, 1u);
+		}
+
+		// Keep the base level's central texel if there's no such mip level (the compressed blocks can't be split)
+		Vector2u offset;
+		if (std::max(levelSize.x, levelSize.y) > placeholderSize) {
+			if (mFormat.compressed) {
+				return false;
+			}
+
+			offset = Vector2u(mSize.x / 2, mSize.y / 2);
+			levelSize = Vector2u(1, 1);
+		}
+
+		// Preserve the placeholder's texels in a temporary texture while the texture's storage is recreated (the instance doesn't change)
+		GLuint placeholder;
+		GLCall(glCreateTextures(GL_TEXTURE_2D, 1, &placeholder));
+		GLCall(glTextureStorage2D(placeholder, 1, static_cast<GLenum>(mFormat.internal), levelSize.x, levelSize.y));
+		GLCall(glCopyImageSubData(mHandle, GL_TEXTURE_2D, level, offset.x, offset.y, 0, placeholder, GL_TEXTURE_2D, 0, 0, 0, 0, levelSize.x, levelSize.y, 1));
+
+		recreate(1);
+		GLCall(glTextureStorage2D(mHandle, 1, static_cast<GLenum>(mFormat.internal), levelSize.x, levelSize.y));
+		GLCall(glCopyImageSubData(placeholder, GL_TEXTURE_2D, 0, 0, 0, 0, mHandle, GL_TEXTURE_2D, 0, 0, 0, 0, levelSize.x, levelSize.y, 1));
+		GLCall(glDeleteTextures(1, &placeholder));
+
+		// The size is kept so that the normalized texture coordinates remain valid
+		mEvicted = true;
+		return true;
+	}
+
+	bool Texture2D::isEvicted() const noexcept
+	{
+		return mEvicted;
+	}
+
+	size_t Texture2D::getStorageSize() const noexcept
+	{
+		// The compressed formats are stored in 4x4 blocks
+		const size_t BASE_SIZE = (mFormat.compressed) ? getLevelSize(mFormat.internal, mSize.x, mSize.y)
+		                                             : static_cast<size_t>(mSize.x) * mSize.y * getTexelSize(mFormat.internal, mFormat.imposedChannels, mFormat.bitCount);
+
+		// The mip chain adds a third of the base level
+		return (mLevelCount > 1 || mHasMipmap) ? BASE_SIZE + BASE_SIZE / 3 : BASE_SIZE;
+	}
+
 	const std::string& Texture2D::getFilepath() const noexcept
 	{
 		return mFilepath;
@@ -210,6 +618,11 @@ namespace ae
 		return mSize;
 	}
 
+	Texture2D::AlphaCoverage Texture2D::getAlphaCoverage() const noexcept
+	{
+		return mAlphaCoverage;
+	}
+
 	// Public virtual method(s)
 	void Texture2D::setWrap(Wrap wrap)
 	{
@@ -222,4 +635,156 @@ namespace ae
 			GLCall(glTextureParameteri(mHandle, GL_TEXTURE_WRAP_T, GLWrap));
 		}
 	}
+
+	bool Texture2D::isOpaque() const noexcept
+	{
+		return mAlphaCoverage == AlphaCoverage::Opaque;
+	}
+
+	size_t Texture2D::getMemorySize() const noexcept
+	{
+		return (mEvicted || mSize.x == 0) ? 0 : getStorageSize();
+	}
+
+	// Public static method(s)
+	bool Texture2D::decodeFromFile(const std::string& filename, InternalFormat internalFormat, Image& image)
+	{
+		// Map the file so that it's decoded without being copied
+		const FileSystem::MappedFile MAPPING = FileSystem::mapFile(filename);
+		if (!MAPPING.isOpen()) {
+			image.filepath = filename;
+			image.levels.clear();
+			image.error = "The file couldn't be opened.";
+			return false;
+		}
+
+		return decodeFromMemory(filename, MAPPING.data(), MAPPING.size(), internalFormat, image);
+	}
+
+	bool Texture2D::decodeFromMemory(const std::string& filename, const uint8_t* data, size_t size, InternalFormat internalFormat, Image& image)
+	{
+		image.filepath = filename;
+		image.format = internalFormat;
+		image.levels.clear();
+
+		// Copy the pre-compressed containers' blocks directly (their format replaces the one requested)
+		const bool IS_DDS = hasExtension(filename, ".dds");
+		if (IS_DDS || hasExtension(filename, ".ktx2")) {
+			if (!((IS_DDS) ? decodeDDS(data, size, image) : decodeKTX2(data, size, image))) {
+				image.pixels.reset();
+				return false;
+			}
+
+			image.error.clear();
+			image.channels = 4;
+			image.is16Bit = false;
+			return true;
+		}
+
+		// Hand the file to the decoder registered for its extension, if any (the built-in decoder handles the files it declines)
+		const Format FORMAT(internalFormat);
+		const bool IS_16_BIT = FORMAT.bitCount != 8;
+		Decoder decoder;
+		{
+			DecoderRegistry& registry = getDecoderRegistry();
+			std::lock_guard<std::mutex> lock(registry.mutex);
+			auto decoderItr = std::find_if(registry.decoders.begin(), registry.decoders.end(), [&filename](const std::pair<std::string, Decoder>& entry) {
+				return hasExtension(filename, entry.first);
+			});
+			if (decoderItr != registry.decoders.end()) {
+				decoder = decoderItr->second;
+			}
+		}
+		if (decoder && decoder(data, size, FORMAT.imposedChannels, IS_16_BIT, image) && image.pixels) {
+			image.error.clear();
+			image.byteCount = static_cast<size_t>(image.size.x) * image.size.y * image.channels * ((image.is16Bit) ? 2 : 1);
+			return true;
+		}
+		image.pixels.reset();
+
+		// Probe the image's header so that the unsupported files are rejected without being decoded
+		if (size > static_cast<size_t>(INT_MAX)) {
+			image.error = "The file is too large to be decoded.";
+			return false;
+		}
+		const int FILE_SIZE = static_cast<int>(size);
+		int width, height, channels;
+		if (!stbi_info_from_memory(data, FILE_SIZE, &width, &height, &channels)) {
+			image.error = stbi_failure_reason();
+			return false;
+		}
+
+		// Load in the image data once with the channels and the bit depth imposed by the format
+		void* pixels = (IS_16_BIT) ? static_cast<void*>(stbi_load_16_from_memory(data, FILE_SIZE, &width, &height, &channels, FORMAT.imposedChannels))
+		                           : static_cast<void*>(stbi_load_from_memory(data, FILE_SIZE, &width, &height, &channels, FORMAT.imposedChannels));
+
+		// Store the reason of the failure if the image couldn't be loaded in
+		if (!pixels) {
+			image.error = stbi_failure_reason();
+			return false;
+		}
+
+		image.pixels.reset(pixels, stbi_image_free);
+		image.error.clear();
+		image.is16Bit = IS_16_BIT;
+		image.size = Vector2u(width, height);
+		image.channels = (FORMAT.imposedChannels != 0) ? FORMAT.imposedChannels : channels;
+		image.byteCount = static_cast<size_t>(width) * height * image.channels * ((image.is16Bit) ? 2 : 1);
+
+		return true;
+	}
+
+	void Texture2D::setDecoder(const std::string& extension, Decoder decoder)
+	{
+		DecoderRegistry& registry = getDecoderRegistry();
+		std::lock_guard<std::mutex> lock(registry.mutex);
+
+		// Replace or remove the decoder already registered for the extension
+		auto decoderItr = std::find_if(registry.decoders.begin(), registry.decoders.end(), [&extension](const std::pair<std::string, Decoder>& entry) {
+			return entry.first == extension;
+		});
+		if (decoderItr != registry.decoders.end()) {
+			if (decoder) {
+				decoderItr->second = std::move(decoder);
+			}
+			else {
+				registry.decoders.erase(decoderItr);
+			}
+		}
+		else if (decoder) {
+			registry.decoders.emplace_back(extension, std::move(decoder));
+		}
+	}
+
+	// Private method(s)
+	Texture2D::AlphaCoverage Texture2D::scanAlphaCoverage(const void* data, size_t texelCount, bool is16Bit) const noexcept
+	{
+		// Textures without an alpha channel are sampled with an alpha of 1 (depth and stencil textures aren't sampled for their colors)
+		if (mFormat.base == GL_RED || mFormat.base == GL_RG || mFormat.base == GL_RGB) {
+			return AlphaCoverage::Opaque;
+		}
+		if (mFormat.imposedChannels != 4) {
+			return AlphaCoverage::Unknown;
+		}
+
+		// Search for the first texel whose alpha channel isn't at its maximum value
+		if (is16Bit) {
+			const uint16_t* const texels = static_cast<const uint16_t*>(data);
+			for (size_t i = 0; i < texelCount; ++i) {
+				if (texels[i * 4 + 3] != UINT16_MAX) {
+					return AlphaCoverage::Translucent;
+				}
+			}
+		}
+		else {
+			const uint8_t* const texels = static_cast<const uint8_t*>(data);
+			for (size_t i = 0; i < texelCount; ++i) {
+				if (texels[i * 4 + 3] != UINT8_MAX) {
+					return AlphaCoverage::Translucent;
+				}
+			}
+		}
+
+		return AlphaCoverage::Opaque;
+	}
 }
\ No newline at end of file
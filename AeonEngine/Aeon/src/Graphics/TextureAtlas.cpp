@@ -24,25 +24,65 @@
 
 #include <GL/glew.h>
 
+#include <climits>
+#include <cstring>
+#include <fstream>
+
 #include <rectpack2D/finders_interface.h>
 
 #include <AEON/Graphics/internal/GLCommon.h>
 #include <AEON/Graphics/GLResourceFactory.h>
 #include <AEON/Graphics/Sprite.h>
 #include <AEON/Graphics/BasicRenderer2D.h>
+#include <AEON/System/FileSystem.h>
+#include <AEON/System/Profiler.h>
 
 namespace ae
 {
+	namespace
+	{
+		// The width and height of the texture atlas created by the first incremental insertion
+		constexpr unsigned int INITIAL_SIZE = 256;
+
+		// The identifier and version of the baked texture atlases
+		// Layout: identifier, version, internal format, width, height, rect count | rects (filepath length, filepath, x, y, width, height) | texels
+		constexpr char     BAKED_IDENTIFIER[4] = { 'A', 'E', 'A', 'T' };
+		constexpr uint32_t BAKED_VERSION = 1;
+		constexpr size_t   BAKED_HEADER_SIZE = sizeof(BAKED_IDENTIFIER) + sizeof(uint32_t) * 5;
+
+		// Append a little-endian value to the baked file's contents
+		template <typename T>
+		void appendValue(std::string& contents, T value)
+		{
+			contents.append(reinterpret_cast<const char*>(&value), sizeof(T));
+		}
+
+		// Read a little-endian value from the baked file's data (the offset is assumed to be within bounds)
+		template <typename T>
+		T readValue(const uint8_t* data, size_t offset) noexcept
+		{
+			T value = 0;
+			std::memcpy(&value, data + offset, sizeof(T));
+			return value;
+		}
+	}
+
 	// Public constructor(s)
 	TextureAtlas::TextureAtlas(Texture2D::InternalFormat format)
 		: mTextures()
+		, mRects()
+		, mImages()
 		, mAtlas(GLResourceFactory::getInstance().create<Texture2D>("", Texture2D::Filter::Linear, Texture2D::Wrap::ClampToEdge, format))
+		, mSkyline()
 	{
 	}
 
 	TextureAtlas::TextureAtlas(TextureAtlas&& rvalue) noexcept
 		: mTextures(std::move(rvalue.mTextures))
+		, mRects(std::move(rvalue.mRects))
+		, mImages(std::move(rvalue.mImages))
 		, mAtlas(std::move(rvalue.mAtlas))
+		, mSkyline(std::move(rvalue.mSkyline))
 	{
 	}
 
@@ -51,7 +91,10 @@ namespace ae
 	{
 		// Move the rvalue's data
 		mTextures = std::move(rvalue.mTextures);
+		mRects = std::move(rvalue.mRects);
+		mImages = std::move(rvalue.mImages);
 		mAtlas = std::move(rvalue.mAtlas);
+		mSkyline = std::move(rvalue.mSkyline);
 
 		return *this;
 	}
@@ -59,6 +102,14 @@ namespace ae
 	// Public method(s)
 	void TextureAtlas::add(const Texture2D& texture)
 	{
+		// Check if the texture atlas is filled incrementally (ignored in Release mode)
+		if _CONSTEXPR_IF (AEON_DEBUG) {
+			if (!mSkyline.empty()) {
+				AEON_LOG_ERROR("Invalid texture addition", "Textures can't be added to a texture atlas filled with incremental insertions.\nAborting operation.");
+				return;
+			}
+		}
+
 		// Add the texture and its size to the hashmap
 		const Vector2u& textureSize = texture.getSize();
 		const bool SUCCESS = mTextures.try_emplace(&texture, 0, 0, textureSize.x, textureSize.y).second;
@@ -69,15 +120,54 @@ namespace ae
 		}
 	}
 
-	void TextureAtlas::pack()
+	bool TextureAtlas::add(const std::string& filename)
 	{
-		// Check if there is at least one texture added
-		if (mTextures.empty()) {
+		// Check if the texture atlas is filled incrementally (ignored in Release mode)
+		if _CONSTEXPR_IF (AEON_DEBUG) {
+			if (!mSkyline.empty()) {
+				AEON_LOG_ERROR("Invalid image addition", "Images can't be added to a texture atlas filled with incremental insertions.\nAborting operation.");
+				return false;
+			}
+		}
+
+		// Decode the image into client memory with the texture atlas' format
+		const Texture::InternalFormat FORMAT = mAtlas->getInternalFormat();
+		Texture2D::Image image;
+		if (!Texture2D::decodeFromFile(filename, FORMAT, image)) {
+			AEON_LOG_ERROR("Failed to decode image " + filename, std::move(image.error));
+			return false;
+		}
+		if (image.format != FORMAT || image.is16Bit != (Texture::getFormatInfo(FORMAT).bitCount == 16)) {
+			AEON_LOG_ERROR("Invalid image format", "The format of the image " + filename + " doesn't match the texture atlas' internal format.\nAborting operation.");
+			return false;
+		}
+
+		// Add the image and its size to the hashmaps
+		if (!mImages.try_emplace(filename, std::move(image)).second) {
+			AEON_LOG_WARNING("Image emplacement failed", "The image " + filename + " may have already been previously added.");
+			return false;
+		}
+		mRects[filename] = Box2i(Vector2i(), Vector2i(mImages[filename].size));
+
+		return true;
+	}
+
+	void TextureAtlas::pack(bool keepImages)
+	{
+		AEON_PROFILE_SCOPE("TextureAtlas::pack");
+
+		// Check if there is at least one texture or image added
+		if (mTextures.empty() && mImages.empty()) {
 			AEON_LOG_WARNING("No textures added", "No textures have yet been added to the texture atlas.\nAborting packing.");
 			return;
 		}
 
-		// Calculate the optimal positions for each texture within the texture atlas and create it
+		// Discard the rects of a previously-loaded texture atlas and of the images released by a previous packing
+		for (auto itr = mRects.begin(); itr != mRects.end();) {
+			itr = (mImages.count(itr->first)) ? std::next(itr) : mRects.erase(itr);
+		}
+
+		// Calculate the optimal positions for each texture and image within the texture atlas and create it
 		const Vector2i ATLAS_SIZE = computePacking();
 
 		// (Re)Create the texture atlas and copy each individual texture's image data
@@ -87,6 +177,191 @@ namespace ae
 			                          mAtlas->getHandle(), GL_TEXTURE_2D, 0, texture.second.position.x, texture.second.position.y, 0,
 			                          texture.second.size.x, texture.second.size.y, 1));
 		}
+
+		// Upload each image's texels straight from client memory (decoded with a one-byte row alignment)
+		const Texture::FormatInfo FORMAT = Texture::getFormatInfo(mAtlas->getInternalFormat());
+		GLCall(glPixelStorei(GL_UNPACK_ALIGNMENT, 1));
+		for (const auto& image : mImages) {
+			const Box2i& RECT = mRects[image.first];
+			GLCall(glTextureSubImage2D(mAtlas->getHandle(), 0, RECT.position.x, RECT.position.y, RECT.size.x, RECT.size.y,
+			                           FORMAT.base, FORMAT.type, image.second.pixels.get()));
+		}
+		GLCall(glPixelStorei(GL_UNPACK_ALIGNMENT, 4));
+
+		// Release the client copies, the texture atlas now being their only copy
+		if (!keepImages) {
+			mImages.clear();
+		}
+	}
+
+	bool TextureAtlas::saveToFile(const std::string& filename) const
+	{
+		// Check if the texture atlas was packed and if its format can be baked
+		const Vector2u& ATLAS_SIZE = mAtlas->getSize();
+		if ((mTextures.empty() && mRects.empty()) || ATLAS_SIZE.x == 0) {
+			AEON_LOG_ERROR("Unpacked texture atlas", "Only a texture atlas packed with add() and pack() can be baked.\nAborting operation.");
+			return false;
+		}
+
+		const Texture::FormatInfo FORMAT = Texture::getFormatInfo(mAtlas->getInternalFormat());
+		if (FORMAT.compressed) {
+			AEON_LOG_ERROR("Invalid texture atlas format", "A texture atlas with a compressed format can't be baked.\nAborting operation.");
+			return false;
+		}
+
+		// Gather the texture rects identified by their filepaths
+		std::map<std::string, Box2i> rects(mRects);
+		for (const auto& texture : mTextures) {
+			const std::string& filepath = texture.first->getFilepath();
+			if (filepath.empty() || !rects.try_emplace(filepath, texture.second).second) {
+				AEON_LOG_ERROR("Unidentifiable texture", "Every texture packed must have a unique filepath for the texture atlas to be baked.\nAborting operation.");
+				return false;
+			}
+		}
+
+		// Write the header and the texture rects
+		std::string contents(BAKED_IDENTIFIER, sizeof(BAKED_IDENTIFIER));
+		appendValue<uint32_t>(contents, BAKED_VERSION);
+		appendValue<uint32_t>(contents, static_cast<uint32_t>(mAtlas->getInternalFormat()));
+		appendValue<uint32_t>(contents, ATLAS_SIZE.x);
+		appendValue<uint32_t>(contents, ATLAS_SIZE.y);
+		appendValue<uint32_t>(contents, static_cast<uint32_t>(rects.size()));
+		for (const auto& rect : rects) {
+			appendValue<uint32_t>(contents, static_cast<uint32_t>(rect.first.size()));
+			contents += rect.first;
+			appendValue<int32_t>(contents, rect.second.position.x);
+			appendValue<int32_t>(contents, rect.second.position.y);
+			appendValue<int32_t>(contents, rect.second.size.x);
+			appendValue<int32_t>(contents, rect.second.size.y);
+		}
+
+		// Read back the texture atlas' texels tightly packed
+		const size_t HEADER_SIZE = contents.size();
+		const size_t TEXEL_SIZE = static_cast<size_t>(ATLAS_SIZE.x) * ATLAS_SIZE.y * FORMAT.texelSize;
+		contents.resize(HEADER_SIZE + TEXEL_SIZE);
+		GLCall(glPixelStorei(GL_PACK_ALIGNMENT, 1));
+		GLCall(glGetTextureImage(mAtlas->getHandle(), 0, FORMAT.base, FORMAT.type, static_cast<GLsizei>(TEXEL_SIZE), &contents[HEADER_SIZE]));
+		GLCall(glPixelStorei(GL_PACK_ALIGNMENT, 4));
+
+		// Write the baked texture atlas
+		std::ofstream file(filename, std::ios::binary | std::ios::trunc);
+		if (!file || !file.write(contents.data(), static_cast<std::streamsize>(contents.size()))) {
+			AEON_LOG_ERROR("Invalid filepath", "Unable to write the baked texture atlas at \"" + filename + "\".\nAborting operation.");
+			return false;
+		}
+
+		return true;
+	}
+
+	bool TextureAtlas::loadFromFile(const std::string& filename)
+	{
+		// Map the baked texture atlas and check its header
+		const FileSystem::MappedFile MAPPING = FileSystem::mapFile(filename);
+		const uint8_t* const DATA = MAPPING.data();
+		if (!MAPPING.isOpen()) {
+			AEON_LOG_ERROR("Invalid filepath", "Unable to map the baked texture atlas at \"" + filename + "\".\nAborting operation.");
+			return false;
+		}
+		if (MAPPING.size() < BAKED_HEADER_SIZE || std::memcmp(DATA, BAKED_IDENTIFIER, sizeof(BAKED_IDENTIFIER)) != 0
+		                                    || readValue<uint32_t>(DATA, 4) != BAKED_VERSION) {
+			AEON_LOG_ERROR("Invalid baked texture atlas", "The file at \"" + filename + "\" isn't a baked texture atlas or was baked by another version.\nAborting operation.");
+			return false;
+		}
+
+		const Texture2D::InternalFormat FORMAT = static_cast<Texture2D::InternalFormat>(readValue<uint32_t>(DATA, 8));
+		const Vector2u ATLAS_SIZE(readValue<uint32_t>(DATA, 12), readValue<uint32_t>(DATA, 16));
+		const uint32_t RECT_COUNT = readValue<uint32_t>(DATA, 20);
+
+		// Read the texture rects, checking that they're within the file's bounds
+		std::map<std::string, Box2i> rects;
+		size_t offset = BAKED_HEADER_SIZE;
+		for (uint32_t i = 0; i < RECT_COUNT; ++i) {
+			if (offset + sizeof(uint32_t) > MAPPING.size()) {
+				break;
+			}
+			const size_t LENGTH = readValue<uint32_t>(DATA, offset);
+			offset += sizeof(uint32_t);
+			if (offset + LENGTH + sizeof(int32_t) * 4 > MAPPING.size()) {
+				offset = MAPPING.size() + 1;
+				break;
+			}
+
+			std::string filepath(reinterpret_cast<const char*>(DATA + offset), LENGTH);
+			offset += LENGTH;
+			rects.try_emplace(std::move(filepath), Vector2i(readValue<int32_t>(DATA, offset), readValue<int32_t>(DATA, offset + 4)),
+			                                       Vector2i(readValue<int32_t>(DATA, offset + 8), readValue<int32_t>(DATA, offset + 12)));
+			offset += sizeof(int32_t) * 4;
+		}
+
+		const size_t TEXEL_SIZE = static_cast<size_t>(ATLAS_SIZE.x) * ATLAS_SIZE.y * Texture::getFormatInfo(FORMAT).texelSize;
+		if (rects.size() != RECT_COUNT || TEXEL_SIZE == 0 || offset + TEXEL_SIZE > MAPPING.size()) {
+			AEON_LOG_ERROR("Corrupted baked texture atlas", "The baked texture atlas at \"" + filename + "\" is truncated or corrupted.\nAborting operation.");
+			return false;
+		}
+
+		// Recreate the texture atlas with the baked format if necessary and upload the mapped texels directly
+		if (mAtlas->getInternalFormat() != FORMAT) {
+			mAtlas = GLResourceFactory::getInstance().create<Texture2D>("", mAtlas->getFilter(), mAtlas->getWrap(), FORMAT);
+		}
+		mAtlas->create(ATLAS_SIZE.x, ATLAS_SIZE.y, nullptr, false);
+
+		const Texture::FormatInfo TEXTURE_FORMAT = Texture::getFormatInfo(FORMAT);
+		GLCall(glPixelStorei(GL_UNPACK_ALIGNMENT, 1));
+		GLCall(glTextureSubImage2D(mAtlas->getHandle(), 0, 0, 0, ATLAS_SIZE.x, ATLAS_SIZE.y, TEXTURE_FORMAT.base, TEXTURE_FORMAT.type, DATA + offset));
+		GLCall(glPixelStorei(GL_UNPACK_ALIGNMENT, 4));
+
+		// Replace the previous textures, images and insertions by the baked texture rects
+		mTextures.clear();
+		mImages.clear();
+		mSkyline.clear();
+		mRects = std::move(rects);
+
+		return true;
+	}
+
+	std::pair<bool, Box2i> TextureAtlas::insert(unsigned int width, unsigned int height, const void* data, bool* const grown)
+	{
+		if (grown) {
+			*grown = false;
+		}
+
+		// Check if textures were added to be packed (ignored in Release mode)
+		if _CONSTEXPR_IF (AEON_DEBUG) {
+			if (!mTextures.empty() || !mRects.empty() || !mImages.empty()) {
+				AEON_LOG_ERROR("Invalid texture insertion", "Image data can't be inserted into a texture atlas packed with add() and pack() or loaded from a file.\nAborting operation.");
+				return std::make_pair(false, Box2i());
+			}
+		}
+
+		// Create the cleared texture atlas and its flat skyline during the first insertion
+		if (mSkyline.empty()) {
+			mAtlas->create(INITIAL_SIZE, INITIAL_SIZE);
+			GLCall(glClearTexImage(mAtlas->getHandle(), 0, GL_RED, GL_UNSIGNED_BYTE, nullptr));
+			mSkyline.emplace_back(0, 0, static_cast<int>(INITIAL_SIZE));
+		}
+
+		// Find a position for the rectangle (padded by one texel to avoid bleeding) and grow the texture atlas until it fits
+		const int PADDED_WIDTH = static_cast<int>(width) + 1;
+		const int PADDED_HEIGHT = static_cast<int>(height) + 1;
+		Vector2i position;
+		size_t segmentIndex = 0;
+		while (!findSkylinePosition(PADDED_WIDTH, PADDED_HEIGHT, position, segmentIndex)) {
+			if (!grow()) {
+				AEON_LOG_ERROR("Texture atlas full", "The texture atlas reached the maximum texture size supported.\nAborting insertion.");
+				return std::make_pair(false, Box2i());
+			}
+			if (grown) {
+				*grown = true;
+			}
+		}
+		addSkylineSegment(segmentIndex, position, PADDED_WIDTH, PADDED_HEIGHT);
+
+		// Only upload the inserted image data
+		if (data && width != 0 && height != 0) {
+			mAtlas->update(position.x, position.y, width, height, data);
+		}
+
+		return std::make_pair(true, Box2i(position, Vector2i(width, height)));
 	}
 
 	const Texture2D& TextureAtlas::getTexture() const noexcept
@@ -107,6 +382,25 @@ namespace ae
 		return itr->second;
 	}
 
+	Box2i TextureAtlas::getTextureRect(const std::string& filepath) const
+	{
+		// Search the rects of the images and of the baked texture atlas first
+		auto itr = mRects.find(filepath);
+		if (itr != mRects.end()) {
+			return itr->second;
+		}
+
+		// Search the packed textures by their filepath
+		for (const auto& texture : mTextures) {
+			if (texture.first->getFilepath() == filepath) {
+				return texture.second;
+			}
+		}
+
+		AEON_LOG_WARNING("Invalid texture filepath", "No texture with the filepath \"" + filepath + "\" was packed into the texture atlas.\nReturning empty rect.");
+		return Box2i();
+	}
+
 	// Private method(s)
 	Vector2i TextureAtlas::computePacking()
 	{
@@ -116,12 +410,15 @@ namespace ae
 		int rp2d_maxSize;
 		GLCall(glGetIntegerv(GL_MAX_TEXTURE_SIZE, &rp2d_maxSize));
 
-		// Create the rectpack2D rectangles
+		// Create the rectpack2D rectangles (the textures followed by the images)
 		std::vector<rp2d_rectType> rp2d_rects;
-		rp2d_rects.reserve(mTextures.size());
+		rp2d_rects.reserve(mTextures.size() + mImages.size());
 		for (const auto& texture : mTextures) {
 			rp2d_rects.emplace_back(0, 0, texture.second.size.x + 1, texture.second.size.y + 1);
 		}
+		for (const auto& image : mImages) {
+			rp2d_rects.emplace_back(0, 0, static_cast<int>(image.second.size.x) + 1, static_cast<int>(image.second.size.y) + 1);
+		}
 
 		// Calculate the optimal positions for the rectpack2D rectangles
 		const auto rp2d_textureAtlas = rectpack2D::find_best_packing<rp2d_spacesType>(
@@ -141,8 +438,111 @@ namespace ae
 			itr->second.position.x = rp2dItr->x;
 			itr->second.position.y = rp2dItr->y;
 		}
+		for (auto itr = mImages.begin(); itr != mImages.end(); ++itr, ++rp2dItr) {
+			Box2i& rect = mRects[itr->first];
+			rect.position.x = rp2dItr->x;
+			rect.position.y = rp2dItr->y;
+		}
 
 		// Return the dimensions of the texture atlas required to store all textures
 		return Vector2i(rp2d_textureAtlas.w, rp2d_textureAtlas.h);
 	}
+
+	bool TextureAtlas::findSkylinePosition(int width, int height, Vector2i& position, size_t& segmentIndex) const
+	{
+		const Vector2i ATLAS_SIZE(mAtlas->getSize());
+		int bestY = INT_MAX;
+		int bestWidth = INT_MAX;
+
+		for (size_t i = 0; i < mSkyline.size(); ++i) {
+			// Check if the rectangle fits horizontally from the segment's beginning
+			const int X = mSkyline[i].x;
+			if (X + width > ATLAS_SIZE.x) {
+				break;
+			}
+
+			// The rectangle rests on the highest segment it spans
+			int y = 0;
+			int remaining = width;
+			for (size_t j = i; j < mSkyline.size() && remaining > 0; ++j) {
+				y = std::max(y, mSkyline[j].y);
+				remaining -= mSkyline[j].z;
+			}
+
+			// Keep the lowest fitting position
+			if (y + height <= ATLAS_SIZE.y && (y < bestY || (y == bestY && mSkyline[i].z < bestWidth))) {
+				bestY = y;
+				bestWidth = mSkyline[i].z;
+				position = Vector2i(X, y);
+				segmentIndex = i;
+			}
+		}
+
+		return bestY != INT_MAX;
+	}
+
+	void TextureAtlas::addSkylineSegment(size_t segmentIndex, const Vector2i& position, int width, int height)
+	{
+		// Insert the segment covering the rectangle's top side
+		mSkyline.emplace(mSkyline.begin() + segmentIndex, position.x, position.y + height, width);
+
+		// Shrink or remove the following segments which are covered by the new segment
+		const int RIGHT = position.x + width;
+		for (size_t i = segmentIndex + 1; i < mSkyline.size();) {
+			Vector3i& segment = mSkyline[i];
+			if (segment.x >= RIGHT) {
+				break;
+			}
+
+			const int OVERLAP = RIGHT - segment.x;
+			if (OVERLAP < segment.z) {
+				segment.x += OVERLAP;
+				segment.z -= OVERLAP;
+				break;
+			}
+			mSkyline.erase(mSkyline.begin() + i);
+		}
+
+		// Merge the neighbouring segments of the same height
+		for (size_t i = 0; i + 1 < mSkyline.size();) {
+			if (mSkyline[i].y == mSkyline[i + 1].y) {
+				mSkyline[i].z += mSkyline[i + 1].z;
+				mSkyline.erase(mSkyline.begin() + i + 1);
+			}
+			else {
+				++i;
+			}
+		}
+	}
+
+	bool TextureAtlas::grow()
+	{
+		AEON_PROFILE_SCOPE("TextureAtlas::grow");
+
+		// Double the smallest dimension (the width if they're equal) within the maximum texture size
+		int maxSize;
+		GLCall(glGetIntegerv(GL_MAX_TEXTURE_SIZE, &maxSize));
+		const Vector2u OLD_SIZE = mAtlas->getSize();
+		const bool GROW_WIDTH = (OLD_SIZE.x <= OLD_SIZE.y);
+		const Vector2u NEW_SIZE = (GROW_WIDTH) ? Vector2u(OLD_SIZE.x * 2, OLD_SIZE.y) : Vector2u(OLD_SIZE.x, OLD_SIZE.y * 2);
+		if (NEW_SIZE.x > static_cast<unsigned int>(maxSize) || NEW_SIZE.y > static_cast<unsigned int>(maxSize)) {
+			return false;
+		}
+
+		// Preserve the current content in a temporary texture while the texture atlas is recreated (the texture atlas' instance doesn't change)
+		std::shared_ptr<Texture2D> previous = GLResourceFactory::getInstance().create<Texture2D>("", mAtlas->getFilter(), mAtlas->getWrap(), mAtlas->getInternalFormat());
+		previous->create(OLD_SIZE.x, OLD_SIZE.y);
+		GLCall(glCopyImageSubData(mAtlas->getHandle(), GL_TEXTURE_2D, 0, 0, 0, 0, previous->getHandle(), GL_TEXTURE_2D, 0, 0, 0, 0, OLD_SIZE.x, OLD_SIZE.y, 1));
+
+		mAtlas->create(NEW_SIZE.x, NEW_SIZE.y);
+		GLCall(glClearTexImage(mAtlas->getHandle(), 0, GL_RED, GL_UNSIGNED_BYTE, nullptr));
+		GLCall(glCopyImageSubData(previous->getHandle(), GL_TEXTURE_2D, 0, 0, 0, 0, mAtlas->getHandle(), GL_TEXTURE_2D, 0, 0, 0, 0, OLD_SIZE.x, OLD_SIZE.y, 1));
+
+		// Extend the skyline over the new columns
+		if (GROW_WIDTH) {
+			mSkyline.emplace_back(static_cast<int>(OLD_SIZE.x), 0, static_cast<int>(OLD_SIZE.x));
+		}
+
+		return true;
+	}
 }
\ No newline at end of file
@@ -0,0 +1,548 @@
+// MIT License
+// 
+// Copyright(c) 2019-2021 Filippos Gleglakos
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#include <AEON/Graphics/TextureLoader.h>
+
+#include <algorithm>
+#include <cstring>
+
+#include <GL/glew.h>
+#include <GLFW/glfw3.h>
+
+#include <AEON/System/Clock.h>
+#include <AEON/System/FileSystem.h>
+#include <AEON/System/Profiler.h>
+#include <AEON/Window/Application.h>
+#include <AEON/Graphics/internal/Buffer.h>
+#include <AEON/Graphics/internal/GLCommon.h>
+
+namespace ae
+{
+	namespace
+	{
+		// The size of each of the pixel ring's regions (larger images are uploaded directly from the client memory)
+		constexpr int PIXEL_REGION_SIZE = 16 * 1024 * 1024;
+
+#if AEON_COROUTINES
+		// Queues the resumption of a task awaiting a texture once it's destroyed along with the texture's request, whether the image was uploaded or not
+		struct LoadResumer
+		{
+			explicit LoadResumer(std::weak_ptr<Task::Continuation> taskContinuation) noexcept
+				: continuation(std::move(taskContinuation))
+			{
+			}
+
+			~LoadResumer()
+			{
+				TaskScheduler::getInstance().schedule(std::move(continuation));
+			}
+
+			std::weak_ptr<Task::Continuation> continuation;
+		};
+#endif // AEON_COROUTINES
+	}
+
+	// Public destructor
+	TextureLoader::~TextureLoader()
+	{
+		waitForJobs();
+		stopUploadThread();
+	}
+
+	// Public method(s)
+	std::shared_ptr<Texture2D> TextureLoader::load(const std::string& filename, Texture2D::Filter filter, Texture2D::Wrap wrap,
+	                                               Texture2D::InternalFormat internalFormat, Callback callback, bool scanAlpha, bool mipmap)
+	{
+		// Create the texture with a white texel as its placeholder
+		const uint8_t WHITE_TEXEL[4] = { 255, 255, 255, 255 };
+		auto texture = std::make_shared<Texture2D>(filter, wrap, Texture2D::InternalFormat::RGBA8);
+		texture->create(1, 1, WHITE_TEXEL);
+
+		// The image's format is the one requested rather than the placeholder's
+		enqueue(texture, filename, internalFormat, std::move(callback), scanAlpha, mipmap);
+		return texture;
+	}
+
+	void TextureLoader::reload(const std::shared_ptr<Texture2D>& texture, Callback callback, bool mipmap)
+	{
+		// Check that the texture's image can be found (ignored in Release mode)
+		if _CONSTEXPR_IF (AEON_DEBUG) {
+			if (texture->getFilepath().empty()) {
+				AEON_LOG_ERROR("Failed to reload texture", "The texture wasn't loaded from a file.\nAborting operation.");
+				return;
+			}
+		}
+
+		enqueue(texture, texture->getFilepath(), texture->getInternalFormat(), std::move(callback), true, mipmap);
+	}
+
+#if AEON_COROUTINES
+	TextureLoader::LoadAwaiter TextureLoader::loadAsync(const std::string& filename, Texture2D::Filter filter, Texture2D::Wrap wrap,
+	                                                    Texture2D::InternalFormat internalFormat, bool scanAlpha, bool mipmap) const
+	{
+		return LoadAwaiter(filename, filter, wrap, internalFormat, scanAlpha, mipmap);
+	}
+#endif // AEON_COROUTINES
+
+	bool TextureLoader::stream(Texture2D& texture, unsigned int offsetX, unsigned int offsetY, unsigned int width, unsigned int height, const void* data)
+	{
+		// Count the channels of the texture's format (ae::Texture2D::update() sources one byte per channel)
+		size_t channelCount = 4;
+		switch (texture.getInternalFormat())
+		{
+		case Texture2D::InternalFormat::R8:
+		case Texture2D::InternalFormat::R16:
+			channelCount = 1;
+			break;
+		case Texture2D::InternalFormat::RG8:
+		case Texture2D::InternalFormat::RG16:
+			channelCount = 2;
+			break;
+		case Texture2D::InternalFormat::RGB8:
+			channelCount = 3;
+			break;
+		default:
+			break;
+		}
+
+		// Stage the data in the pixel ring and source the texels from it, the data is uploaded directly if it doesn't fit
+		int offset = 0;
+		if (!stage(data, static_cast<size_t>(width) * height * channelCount, offset)) {
+			return texture.update(offsetX, offsetY, width, height, data);
+		}
+
+		mPixelBuffer->bind();
+		const bool SUCCESS = texture.update(offsetX, offsetY, width, height, data, reinterpret_cast<const void*>(static_cast<intptr_t>(offset)));
+		mPixelBuffer->unbind();
+		return SUCCESS;
+	}
+
+	void TextureLoader::update()
+	{
+		if (mRequests.empty()) {
+			// Fence the texels staged by stream() so that they're not overwritten while OpenGL is still reading from them
+			if (mStaged) {
+				mPixelRing.lock();
+				mStaged = false;
+			}
+			return;
+		}
+
+		AEON_PROFILE_SCOPE("TextureLoader::update");
+
+		// Upload the decoded images in the order in which they were requested until the budget is spent (the ones uploaded by the upload context are handed over)
+		Clock clock;
+		auto requestItr = mRequests.begin();
+		while (requestItr != mRequests.end())
+		{
+			Request& request = **requestItr;
+			if (request.offscreen) {
+				if (!request.uploaded.load(std::memory_order_acquire) || !adopt(request)) {
+					break;
+				}
+			}
+			else if (request.decoded.load(std::memory_order_acquire)) {
+				upload(request);
+			}
+			else {
+				break;
+			}
+			++requestItr;
+
+			if (clock.getElapsedTime() >= mBudget) {
+				break;
+			}
+		}
+		mRequests.erase(mRequests.begin(), requestItr);
+
+		// Fence the ring's current region so that it's not overwritten while OpenGL is still reading from it
+		mPixelRing.lock();
+		mStaged = false;
+
+		// The decoding jobs have all completed once every request has been decoded
+		if (mRequests.empty()) {
+			waitForJobs();
+		}
+	}
+
+	void TextureLoader::destroy()
+	{
+		// The pending textures keep their placeholder (the textures uploaded by the upload context are discarded)
+		waitForJobs();
+		stopUploadThread();
+		for (const auto& request : mRequests) {
+			if (request->staged) {
+				request->staged->destroy();
+			}
+			if (request->fence) {
+				GLCall(glDeleteSync(static_cast<GLsync>(request->fence)));
+			}
+		}
+		mRequests.clear();
+
+		mPixelRing.destroy();
+		mPixelRing = RingBuffer();
+		mPixelBuffer->destroy();
+	}
+
+	void TextureLoader::setUploadBudget(const Time& budget) noexcept
+	{
+		mBudget = budget;
+	}
+
+	const Time& TextureLoader::getUploadBudget() const noexcept
+	{
+		return mBudget;
+	}
+
+	size_t TextureLoader::getPendingCount() const noexcept
+	{
+		return mRequests.size();
+	}
+
+	bool TextureLoader::enableUploadContext(bool flag)
+	{
+		if (flag == isUploadContextEnabled()) {
+			return true;
+		}
+
+		if (!flag) {
+			stopUploadThread();
+			return true;
+		}
+
+		// Create the hidden context sharing the window's objects and hand it over to the upload thread
+		mUploadContext = Application::getInstance().getWindow().createSharedContext();
+		if (!mUploadContext) {
+			return false;
+		}
+
+		mUploadExit = false;
+		mUploadThread = std::thread(&TextureLoader::runUploadThread, this);
+		return true;
+	}
+
+	bool TextureLoader::isUploadContextEnabled() const noexcept
+	{
+		return mUploadContext != nullptr;
+	}
+
+	// Public static method(s)
+	TextureLoader& TextureLoader::getInstance()
+	{
+		static TextureLoader instance;
+		return instance;
+	}
+
+	// Private constructor(s)
+	TextureLoader::TextureLoader()
+		: mRequests()
+		, mPixelBuffer(std::make_unique<Buffer>(GL_PIXEL_UNPACK_BUFFER))
+		, mPixelRing()
+		, mBatchJob(nullptr)
+		, mBudget(Time::milliseconds(2))
+		, mStaged(false)
+		, mUploadContext(nullptr)
+		, mUploadThread()
+		, mUploadQueue()
+		, mUploadMutex()
+		, mUploadCondition()
+		, mUploadExit(false)
+	{
+		// Start the job system beforehand so that it's destroyed after the loader
+		static_cast<void>(JobSystem::getInstance());
+	}
+
+	// Private method(s)
+	void TextureLoader::upload(Request& request)
+	{
+		// Discard the image if the texture was destroyed in the meantime
+		const std::shared_ptr<Texture2D> texture = request.texture.lock();
+		if (!texture) {
+			return;
+		}
+
+		const Texture2D::Image& image = request.image;
+		if (!image.pixels) {
+			AEON_LOG_ERROR("Failed to load texture " + image.filepath + " from file", image.error + "\nThe placeholder is kept.");
+			return;
+		}
+
+		// Stage the texels in the pixel ring (the texels were decoded with a one-byte row alignment)
+		int offset = 0;
+		const bool STAGED = stage(image.pixels.get(), image.byteCount, offset);
+		GLCall(glPixelStorei(GL_UNPACK_ALIGNMENT, 1));
+		if (STAGED) {
+			mPixelBuffer->bind();
+			texture->upload(image, request.scanAlpha, reinterpret_cast<const void*>(static_cast<intptr_t>(offset)), request.mipmap);
+			mPixelBuffer->unbind();
+		}
+		else {
+			// The image doesn't fit within the ring, so it's uploaded directly from the client memory
+			texture->upload(image, request.scanAlpha, nullptr, request.mipmap);
+		}
+		GLCall(glPixelStorei(GL_UNPACK_ALIGNMENT, 4));
+
+		if (request.callback) {
+			request.callback(*texture);
+		}
+	}
+
+	void TextureLoader::uploadOffscreen(Request& request)
+	{
+		AEON_PROFILE_SCOPE("TextureLoader upload");
+
+		// The texture is only retrieved to check that it wasn't destroyed in the meantime, its properties were copied beforehand
+		if (request.texture.lock() && request.image.pixels) {
+			// The requested texture is still in use by the main thread, so the image is uploaded into a new one (the texels were decoded with a one-byte row alignment)
+			request.staged = std::make_unique<Texture2D>(request.filter, request.wrap, Texture2D::InternalFormat::RGBA8);
+			if (request.staged->upload(request.image, request.scanAlpha, nullptr, request.mipmap)) {
+				// The flush submits the fence so that the main thread's context can wait on it
+				request.fence = GLCall(glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0));
+				GLCall(glFlush());
+			}
+		}
+
+		request.uploaded.store(true, std::memory_order_release);
+	}
+
+	bool TextureLoader::adopt(Request& request)
+	{
+		// Wait for the upload context's commands to complete
+		if (request.fence) {
+			GLsync sync = static_cast<GLsync>(request.fence);
+			const GLenum RESULT = GLCall(glClientWaitSync(sync, 0, 0));
+			if (RESULT == GL_TIMEOUT_EXPIRED) {
+				return false;
+			}
+			GLCall(glDeleteSync(sync));
+			request.fence = nullptr;
+		}
+		else if (request.staged) {
+			// The upload failed, the placeholder is kept
+			request.staged->destroy();
+			return true;
+		}
+
+		// Discard the image if the texture was destroyed in the meantime
+		const std::shared_ptr<Texture2D> texture = request.texture.lock();
+		if (!texture) {
+			if (request.staged) {
+				request.staged->destroy();
+			}
+			return true;
+		}
+
+		if (!request.staged) {
+			AEON_LOG_ERROR("Failed to load texture " + request.image.filepath + " from file", request.image.error + "\nThe placeholder is kept.");
+			return true;
+		}
+
+		// Replace the placeholder by the uploaded texture
+		texture->destroy();
+		*texture = std::move(*request.staged);
+		request.staged.reset();
+
+		if (request.callback) {
+			request.callback(*texture);
+		}
+		return true;
+	}
+
+	bool TextureLoader::stage(const void* data, size_t size, int& offset)
+	{
+		if (size > static_cast<size_t>(PIXEL_REGION_SIZE)) {
+			return false;
+		}
+
+		// Create the pixel ring upon the first staging
+		if (!mPixelRing.isCreated()) {
+			mPixelRing.create(*mPixelBuffer, PIXEL_REGION_SIZE);
+		}
+
+		// Allocate the data within the ring's current region, moving on to the next region if the current one is full
+		void* staged = mPixelRing.allocate(static_cast<int>(size), offset, 4);
+		if (!staged) {
+			mPixelRing.lock();
+			staged = mPixelRing.allocate(static_cast<int>(size), offset, 4);
+		}
+
+		std::memcpy(staged, data, size);
+		mStaged = true;
+		return true;
+	}
+
+	void TextureLoader::enqueue(const std::shared_ptr<Texture2D>& texture, const std::string& filename, Texture2D::InternalFormat internalFormat, Callback callback, bool scanAlpha, bool mipmap)
+	{
+		// Register the request
+		mRequests.emplace_back(std::make_unique<Request>());
+		Request* const request = mRequests.back().get();
+		request->texture = texture;
+		request->image.format = internalFormat;
+		request->callback = std::move(callback);
+		request->decoded.store(false, std::memory_order_relaxed);
+		request->scanAlpha = scanAlpha;
+		request->mipmap = mipmap;
+		request->filter = texture->getFilter();
+		request->wrap = texture->getWrap();
+		request->offscreen = isUploadContextEnabled();
+		request->uploaded.store(false, std::memory_order_relaxed);
+		request->fence = nullptr;
+
+		// Decode the image on a worker thread, the decoding jobs in flight sharing a parent so that they can be waited upon
+		JobSystem& jobSystem = JobSystem::getInstance();
+		if (!mBatchJob) {
+			mBatchJob = jobSystem.createJob(nullptr);
+		}
+		JobSystem::Job* const decodeJob = jobSystem.createJob([this, request, filename]() {
+			AEON_PROFILE_SCOPE("TextureLoader decode");
+			if (request->image.error.empty()) {
+				Texture2D::decodeFromMemory(filename, request->file.data(), request->file.size(), request->image.format, request->image);
+			}
+			std::vector<uint8_t>().swap(request->file);
+			request->decoded.store(true, std::memory_order_release);
+
+			// Hand the decoded image over to the upload thread
+			if (request->offscreen) {
+				{
+					std::lock_guard<std::mutex> lock(mUploadMutex);
+					mUploadQueue.push_back(request);
+				}
+				mUploadCondition.notify_one();
+			}
+		}, mBatchJob);
+
+		// Read in the file on an I/O thread so that the workers only decode, the decoding job being run once the contents are available
+		FileSystem::readAsync(filename, [request, filename, decodeJob](bool success, std::vector<uint8_t>&& data) {
+			if (success) {
+				request->file = std::move(data);
+			}
+			else {
+				request->image.filepath = filename;
+				request->image.error = "The file couldn't be opened.";
+			}
+			JobSystem::getInstance().run(decodeJob);
+		});
+	}
+
+	void TextureLoader::waitForJobs()
+	{
+		if (!mBatchJob) {
+			return;
+		}
+
+		JobSystem& jobSystem = JobSystem::getInstance();
+		jobSystem.run(mBatchJob);
+		jobSystem.wait(mBatchJob);
+		mBatchJob = nullptr;
+	}
+
+	void TextureLoader::runUploadThread()
+	{
+		Profiler::getInstance().setThreadName("Upload thread");
+		glfwMakeContextCurrent(mUploadContext);
+
+		std::unique_lock<std::mutex> lock(mUploadMutex);
+		while (true)
+		{
+			mUploadCondition.wait(lock, [this]() { return mUploadExit || !mUploadQueue.empty(); });
+			if (mUploadExit) {
+				break;
+			}
+
+			// Upload the request without holding the lock so that the decoding jobs can keep queueing
+			Request* const request = mUploadQueue.front();
+			mUploadQueue.pop_front();
+			lock.unlock();
+			uploadOffscreen(*request);
+			lock.lock();
+		}
+
+		// Release the context so that its window can be destroyed by the main thread
+		glfwMakeContextCurrent(nullptr);
+	}
+
+	void TextureLoader::stopUploadThread()
+	{
+		if (!mUploadContext) {
+			return;
+		}
+
+		// The decoding jobs may still be queueing requests
+		waitForJobs();
+		{
+			std::lock_guard<std::mutex> lock(mUploadMutex);
+			mUploadExit = true;
+		}
+		mUploadCondition.notify_one();
+		mUploadThread.join();
+
+		// The requests that were left to the upload thread (or are still being decoded) are uploaded by the main thread
+		mUploadQueue.clear();
+		for (const auto& request : mRequests) {
+			if (request->offscreen && !request->uploaded.load(std::memory_order_acquire)) {
+				request->offscreen = false;
+			}
+		}
+
+		glfwDestroyWindow(mUploadContext);
+		mUploadContext = nullptr;
+	}
+
+#if AEON_COROUTINES
+	// TextureLoader::LoadAwaiter
+		// Public constructor(s)
+	TextureLoader::LoadAwaiter::LoadAwaiter(const std::string& filename, Texture2D::Filter filter, Texture2D::Wrap wrap, Texture2D::InternalFormat internalFormat, bool scanAlpha, bool mipmap)
+		: mFilename(filename)
+		, mTexture(nullptr)
+		, mLoaded(std::make_shared<bool>(false))
+		, mFilter(filter)
+		, mWrap(wrap)
+		, mInternalFormat(internalFormat)
+		, mScanAlpha(scanAlpha)
+		, mMipmap(mipmap)
+	{
+	}
+
+		// Public method(s)
+	bool TextureLoader::LoadAwaiter::await_ready() const noexcept
+	{
+		return false;
+	}
+
+	void TextureLoader::LoadAwaiter::await_suspend(Task::Handle caller)
+	{
+		// The callback only references shared objects as the task may be destroyed before the request is processed
+		auto resumer = std::make_shared<LoadResumer>(caller.promise().continuation);
+		mTexture = TextureLoader::getInstance().load(mFilename, mFilter, mWrap, mInternalFormat, [loaded = mLoaded, resumer = std::move(resumer)](Texture2D&) {
+			*loaded = true;
+		}, mScanAlpha, mMipmap);
+	}
+
+	std::shared_ptr<Texture2D> TextureLoader::LoadAwaiter::await_resume() const noexcept
+	{
+		return (*mLoaded) ? mTexture : nullptr;
+	}
+
+#endif // AEON_COROUTINES
+}
\ No newline at end of file
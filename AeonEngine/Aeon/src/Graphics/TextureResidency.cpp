@@ -0,0 +1,151 @@
+// MIT License
+// 
+// Copyright(c) 2019-2021 Filippos Gleglakos
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+
+#include <AEON/Graphics/TextureResidency.h>
+
+#include <algorithm>
+
+#include <AEON/System/Profiler.h>
+#include <AEON/Graphics/TextureLoader.h>
+
+namespace ae
+{
+	namespace
+	{
+		// The number of frames during which a texture that was used can't be evicted
+		constexpr uint64_t EVICTION_DELAY = 3;
+	}
+
+	// Public method(s)
+	void TextureResidency::track(const std::shared_ptr<Texture2D>& texture)
+	{
+		// Check if the texture is already tracked
+		for (const Entry& entry : mEntries) {
+			if (entry.texture.lock() == texture) {
+				AEON_LOG_WARNING("Texture already tracked", "The texture " + texture->getFilepath() + " is already tracked by the residency manager.");
+				return;
+			}
+		}
+
+		mEntries.push_back(Entry{ texture, texture->getStorageSize(), false, false });
+	}
+
+	void TextureResidency::update()
+	{
+		++mFrame;
+		if (mEntries.empty()) {
+			return;
+		}
+
+		AEON_PROFILE_SCOPE("TextureResidency::update");
+
+		// Forget the textures that were destroyed
+		mEntries.erase(std::remove_if(mEntries.begin(), mEntries.end(), [](const Entry& entry) { return entry.texture.expired(); }), mEntries.end());
+
+		// Stream back in the evicted textures used during the previous frame and gather the resident textures that may be evicted
+		std::vector<std::pair<Entry*, std::shared_ptr<Texture2D>>> candidates;
+		mResidentSize = 0;
+		for (Entry& entry : mEntries) {
+			std::shared_ptr<Texture2D> texture = entry.texture.lock();
+			if (texture->isEvicted()) {
+				if (!entry.streaming && texture->getLastUsedFrame() + 1 >= mFrame) {
+					TextureLoader::getInstance().reload(texture, nullptr, entry.mipmap);
+					entry.streaming = true;
+				}
+				continue;
+			}
+
+			// The size changes once the image is uploaded
+			entry.streaming = false;
+			entry.size = texture->getStorageSize();
+			mResidentSize += entry.size;
+
+			// Only the textures loaded from files can be reloaded once evicted
+			if (texture->getLastUsedFrame() + EVICTION_DELAY < mFrame && !texture->getFilepath().empty()) {
+				candidates.emplace_back(&entry, std::move(texture));
+			}
+		}
+
+		// Evict the least recently used textures until the budget is respected
+		if (mBudget == 0 || mResidentSize <= mBudget) {
+			return;
+		}
+
+		std::sort(candidates.begin(), candidates.end(), [](const auto& a, const auto& b) {
+			return a.second->getLastUsedFrame() < b.second->getLastUsedFrame();
+		});
+		for (auto& candidate : candidates) {
+			if (mResidentSize <= mBudget) {
+				break;
+			}
+
+			candidate.first->mipmap = candidate.second->hasMipmap();
+			if (candidate.second->evict()) {
+				mResidentSize -= candidate.first->size;
+			}
+		}
+	}
+
+	void TextureResidency::destroy()
+	{
+		mEntries.clear();
+		mResidentSize = 0;
+	}
+
+	void TextureResidency::setBudget(size_t bytes) noexcept
+	{
+		mBudget = bytes;
+	}
+
+	size_t TextureResidency::getBudget() const noexcept
+	{
+		return mBudget;
+	}
+
+	size_t TextureResidency::getResidentSize() const noexcept
+	{
+		return mResidentSize;
+	}
+
+	uint64_t TextureResidency::getFrame() const noexcept
+	{
+		return mFrame;
+	}
+
+	// Public static method(s)
+	TextureResidency& TextureResidency::getInstance()
+	{
+		static TextureResidency instance;
+		return instance;
+	}
+
+	// Private constructor(s)
+	TextureResidency::TextureResidency()
+		: mEntries()
+		, mBudget(512 * 1024 * 1024)
+		, mResidentSize(0)
+		, mFrame(0)
+	{
+	}
+}
\ No newline at end of file
@@ -0,0 +1,340 @@
+// MIT License
+// 
+// Copyright(c) 2019-2021 Filippos Gleglakos
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#include <AEON/Graphics/TileMap.h>
+
+#include <algorithm>
+#include <cmath>
+#include <string>
+
+#include <GL/glew.h>
+
+#include <AEON/Graphics/internal/GLCommon.h>
+#include <AEON/Graphics/internal/IndexBuffer.h>
+#include <AEON/Graphics/internal/Renderer2D.h>
+#include <AEON/Graphics/internal/VertexArray.h>
+#include <AEON/Graphics/internal/VertexBuffer.h>
+#include <AEON/Graphics/BlendMode.h>
+#include <AEON/Graphics/GLResourceFactory.h>
+#include <AEON/Graphics/Shader.h>
+
+namespace ae
+{
+	namespace
+	{
+		// The number of cells along each axis of a chunk
+		constexpr unsigned int CHUNK_SIZE = 32;
+
+		// Used to assign a unique name to each chunk's VAO
+		unsigned int tileChunkCounter = 0;
+	}
+
+	// Public static member(s)
+	const uint32_t TileMap::EmptyTile = UINT32_MAX;
+
+	// Public constructor(s)
+	TileMap::TileMap(const Texture2D& tileset, const Vector2u& tileSize, const Vector2u& mapSize, unsigned int layerCount)
+		: Actor2D()
+		, mChunks(nullptr)
+		, mTiles(static_cast<size_t>(mapSize.x) * mapSize.y * layerCount, EmptyTile)
+		, mDirtyChunks()
+		, mTileSize(tileSize)
+		, mMapSize(mapSize)
+		, mChunkCount((mapSize.x + CHUNK_SIZE - 1) / CHUNK_SIZE, (mapSize.y + CHUNK_SIZE - 1) / CHUNK_SIZE)
+		, mColor(Color::White)
+		, mTileset(&tileset)
+		, mLayerCount(layerCount)
+		, mRebuild(false)
+		, mShader(nullptr)
+		, mQuadListIBO(nullptr)
+	{
+		const size_t CHUNK_COUNT = static_cast<size_t>(mChunkCount.x) * mChunkCount.y;
+		mChunks = std::make_shared<std::vector<Chunk>>(CHUNK_COUNT, Chunk{ nullptr, {}, 0, false });
+		mDirtyChunks.resize(CHUNK_COUNT, 0);
+	}
+
+	// Public method(s)
+	void TileMap::setTile(unsigned int x, unsigned int y, uint32_t tile, unsigned int layer)
+	{
+		// Check if the cell provided is within the map (ignored in Release mode)
+		if _CONSTEXPR_IF (AEON_DEBUG) {
+			if (x >= mMapSize.x || y >= mMapSize.y || layer >= mLayerCount) {
+				AEON_LOG_ERROR("Invalid tile cell", "The cell (" + std::to_string(x) + ", " + std::to_string(y) + ") of the layer " + std::to_string(layer) + " is outside of the map.\nAborting operation.");
+				return;
+			}
+		}
+
+		uint32_t& cell = mTiles[(static_cast<size_t>(layer) * mMapSize.y + y) * mMapSize.x + x];
+		if (cell != tile) {
+			cell = tile;
+			invalidateChunk(x, y);
+		}
+	}
+
+	void TileMap::setTiles(const uint32_t* tiles, unsigned int layer)
+	{
+		// Check if the layer provided exists (ignored in Release mode)
+		if _CONSTEXPR_IF (AEON_DEBUG) {
+			if (layer >= mLayerCount) {
+				AEON_LOG_ERROR("Invalid tile layer", "The layer " + std::to_string(layer) + " doesn't exist.\nAborting operation.");
+				return;
+			}
+		}
+
+		// Only the chunks whose cells have changed are rebuilt
+		const size_t LAYER_OFFSET = static_cast<size_t>(layer) * mMapSize.x * mMapSize.y;
+		for (unsigned int y = 0; y < mMapSize.y; ++y) {
+			for (unsigned int x = 0; x < mMapSize.x; ++x) {
+				const size_t INDEX = static_cast<size_t>(y) * mMapSize.x + x;
+				uint32_t& cell = mTiles[LAYER_OFFSET + INDEX];
+				if (cell != tiles[INDEX]) {
+					cell = tiles[INDEX];
+					invalidateChunk(x, y);
+				}
+			}
+		}
+	}
+
+	void TileMap::setColor(const Color& color) noexcept
+	{
+		mColor = color;
+	}
+
+	uint32_t TileMap::getTile(unsigned int x, unsigned int y, unsigned int layer) const noexcept
+	{
+		if (x >= mMapSize.x || y >= mMapSize.y || layer >= mLayerCount) {
+			return EmptyTile;
+		}
+
+		return mTiles[(static_cast<size_t>(layer) * mMapSize.y + y) * mMapSize.x + x];
+	}
+
+	const Vector2u& TileMap::getMapSize() const noexcept
+	{
+		return mMapSize;
+	}
+
+	const Vector2u& TileMap::getTileSize() const noexcept
+	{
+		return mTileSize;
+	}
+
+	unsigned int TileMap::getLayerCount() const noexcept
+	{
+		return mLayerCount;
+	}
+
+	const Color& TileMap::getColor() const noexcept
+	{
+		return mColor;
+	}
+
+	const Texture2D& TileMap::getTileset() const noexcept
+	{
+		return *mTileset;
+	}
+
+	// Public virtual method(s)
+	Box2f TileMap::getModelBounds() const
+	{
+		return Box2f(Vector2f(0.f, 0.f), Vector2f(mMapSize * mTileSize));
+	}
+
+	// Private method(s)
+	void TileMap::invalidateChunk(unsigned int x, unsigned int y) noexcept
+	{
+		mDirtyChunks[static_cast<size_t>(y / CHUNK_SIZE) * mChunkCount.x + x / CHUNK_SIZE] = 1;
+		mRebuild = true;
+		wake();
+	}
+
+	void TileMap::rebuildChunk(size_t index)
+	{
+		// Retrieve the cells covered by the chunk
+		const unsigned int FIRST_X = static_cast<unsigned int>(index % mChunkCount.x) * CHUNK_SIZE;
+		const unsigned int FIRST_Y = static_cast<unsigned int>(index / mChunkCount.x) * CHUNK_SIZE;
+		const unsigned int LAST_X = std::min(FIRST_X + CHUNK_SIZE, mMapSize.x);
+		const unsigned int LAST_Y = std::min(FIRST_Y + CHUNK_SIZE, mMapSize.y);
+
+		// The tiles are laid out in the tileset in row-major order
+		const Vector2f TILESET_SIZE(mTileset->getSize());
+		const Vector2f TILE_SIZE(mTileSize);
+		const uint32_t COLUMNS = std::max(static_cast<uint32_t>(TILESET_SIZE.x) / std::max(mTileSize.x, 1u), 1u);
+		const Vector2f UV_SIZE = TILE_SIZE / TILESET_SIZE;
+
+		// Lay out a quad per non-empty cell, one layer after the other so that the upper layers are drawn last
+		Chunk& chunk = (*mChunks)[index];
+		chunk.vertices.clear();
+		for (unsigned int layer = 0; layer < mLayerCount; ++layer) {
+			const uint32_t* const LAYER = mTiles.data() + static_cast<size_t>(layer) * mMapSize.x * mMapSize.y;
+			for (unsigned int y = FIRST_Y; y < LAST_Y; ++y) {
+				for (unsigned int x = FIRST_X; x < LAST_X; ++x) {
+					const uint32_t TILE = LAYER[static_cast<size_t>(y) * mMapSize.x + x];
+					if (TILE == EmptyTile) {
+						continue;
+					}
+
+					const Vector2f POSITION = Vector2f(static_cast<float>(x), static_cast<float>(y)) * TILE_SIZE;
+					const Vector2f UV = Vector2f(static_cast<float>(TILE % COLUMNS), static_cast<float>(TILE / COLUMNS)) * UV_SIZE;
+					chunk.vertices.push_back({ POSITION,                                    UV });
+					chunk.vertices.push_back({ POSITION + Vector2f(0.f,         TILE_SIZE.y), UV + Vector2f(0.f,       UV_SIZE.y) });
+					chunk.vertices.push_back({ POSITION + TILE_SIZE,                        UV + UV_SIZE });
+					chunk.vertices.push_back({ POSITION + Vector2f(TILE_SIZE.x, 0.f),         UV + Vector2f(UV_SIZE.x, 0.f) });
+				}
+			}
+		}
+		chunk.upload = true;
+	}
+
+	// Private virtual method(s)
+	void TileMap::updateSelf(const Time&)
+	{
+		if (!mRebuild) {
+			return;
+		}
+
+		// Rebuild the chunks whose cells have changed, they're uploaded once they're rendered
+		for (size_t i = 0; i < mDirtyChunks.size(); ++i) {
+			if (mDirtyChunks[i]) {
+				rebuildChunk(i);
+				mDirtyChunks[i] = 0;
+			}
+		}
+		mRebuild = false;
+	}
+
+	bool TileMap::hasPendingUpdate() const
+	{
+		return mRebuild;
+	}
+
+	void TileMap::renderSelf(const RenderStates& states) const
+	{
+		if (mChunks->empty()) {
+			return;
+		}
+
+		// Retrieve the range of chunks covered by the camera's view in the map's local space (every chunk is visible if there's no view bounds)
+		Vector2u firstChunk(0, 0), lastChunk(mChunkCount);
+		const std::pair<bool, Box2f>& VIEW_BOUNDS = Renderer2D::getCullingBounds();
+		if (VIEW_BOUNDS.first) {
+			const Matrix4f INV_TRANSFORM = states.transform.invertAffine();
+			const Box2f& VIEW = VIEW_BOUNDS.second;
+			Vector2f minPos(INV_TRANSFORM * Vector3f(VIEW.min, 0.f));
+			Vector2f maxPos(minPos);
+			for (const Vector2f& corner : { Vector2f(VIEW.max.x, VIEW.min.y), Vector2f(VIEW.min.x, VIEW.max.y), VIEW.max }) {
+				const Vector2f POSITION(INV_TRANSFORM * Vector3f(corner, 0.f));
+				minPos = min(minPos, POSITION);
+				maxPos = max(maxPos, POSITION);
+			}
+
+			const Vector2f CHUNK_EXTENT = Vector2f(mTileSize) * static_cast<float>(CHUNK_SIZE);
+			const Vector2f FIRST = minPos / CHUNK_EXTENT, LAST = maxPos / CHUNK_EXTENT;
+			const Vector2f CHUNK_COUNT(mChunkCount);
+			firstChunk = Vector2u(clamp(Vector2f(std::floor(FIRST.x), std::floor(FIRST.y)), Vector2f(0.f, 0.f), CHUNK_COUNT));
+			lastChunk = Vector2u(clamp(Vector2f(std::floor(LAST.x) + 1.f, std::floor(LAST.y) + 1.f), Vector2f(0.f, 0.f), CHUNK_COUNT));
+		}
+
+		// List the visible chunks that hold tiles or that are waiting to be uploaded
+		std::vector<unsigned int> visibleChunks;
+		for (unsigned int y = firstChunk.y; y < lastChunk.y; ++y) {
+			for (unsigned int x = firstChunk.x; x < lastChunk.x; ++x) {
+				const unsigned int INDEX = y * mChunkCount.x + x;
+				const Chunk& CHUNK = (*mChunks)[INDEX];
+				if (CHUNK.quadCount != 0 || CHUNK.upload) {
+					visibleChunks.push_back(INDEX);
+				}
+			}
+		}
+		if (visibleChunks.empty()) {
+			return;
+		}
+
+		// The shared resources are resolved once per map, the drawcalls keeping them alive as long as the chunks' VAOs reference the IBO
+		if (!mShader || !mQuadListIBO) {
+			mShader = GLResourceFactory::getInstance().get<Shader>("_AEON_TileMap2D");
+			mQuadListIBO = GLResourceFactory::getInstance().get<IndexBuffer>("_AEON_QuadListIBO");
+		}
+
+		// Capture the render properties by value as the drawcall is executed once the scene ends, possibly on another thread
+		Renderer2D::drawToActive([chunks = mChunks,
+		                          visibleChunks = std::move(visibleChunks),
+		                          model = states.transform,
+		                          depth = static_cast<float>(getDepth()),
+		                          color = mColor.normalize(),
+		                          tileset = mTileset,
+		                          shader = mShader,
+		                          quadListIBO = mQuadListIBO]()
+		{
+			shader->setUniform("uModel", model);
+			shader->setUniform("uDepth", depth);
+			shader->setUniform("uColor", color);
+			shader->bind();
+			tileset->bind();
+
+			const BlendMode& BLEND_MODE = BlendMode::BlendAlpha;
+			gl::setCapability(GL_BLEND, true);
+			gl::setBlendFunction(static_cast<GLenum>(BLEND_MODE.colorEquation), static_cast<GLenum>(BLEND_MODE.alphaEquation),
+			                     static_cast<GLenum>(BLEND_MODE.colorSrcFactor), static_cast<GLenum>(BLEND_MODE.colorDstFactor),
+			                     static_cast<GLenum>(BLEND_MODE.alphaSrcFactor), static_cast<GLenum>(BLEND_MODE.alphaDstFactor));
+
+			// The layers share the map's depth, they're depth-tested against the scene without occluding one another
+			GLCall(glDepthMask(GL_FALSE));
+			const unsigned int QUAD_CAPACITY = quadListIBO->getCount() / 6;
+			for (const unsigned int INDEX : visibleChunks) {
+				Chunk& chunk = (*chunks)[INDEX];
+
+				// Upload the rebuilt vertices to the chunk's static VBO (created along with its VAO by the first upload)
+				if (chunk.upload) {
+					if (!chunk.vao) {
+						auto vbo = std::make_unique<VertexBuffer>(GL_STATIC_DRAW);
+						vbo->getLayout().addElement(GL_FLOAT, 2, GL_FALSE);
+						vbo->getLayout().addElement(GL_FLOAT, 2, GL_FALSE);
+
+						chunk.vao = GLResourceFactory::getInstance().create<VertexArray>("_AEON_TileChunk" + std::to_string(tileChunkCounter++));
+						chunk.vao->addVBO(std::move(vbo));
+						chunk.vao->attachIBO(quadListIBO.get());
+					}
+
+					chunk.vao->getVBO(0)->setData(static_cast<int>(sizeof(TileVertex) * chunk.vertices.size()), chunk.vertices.data());
+					chunk.quadCount = static_cast<unsigned int>(chunk.vertices.size() / 4);
+					chunk.vertices.clear();
+					chunk.vertices.shrink_to_fit();
+					chunk.upload = false;
+				}
+				if (chunk.quadCount == 0) {
+					continue;
+				}
+
+				// Draw the chunk's tiles from the quad list, in as many drawcalls as the quad list's capacity requires
+				chunk.vao->bind();
+				for (unsigned int first = 0; first < chunk.quadCount; first += QUAD_CAPACITY) {
+					const unsigned int COUNT = std::min(chunk.quadCount - first, QUAD_CAPACITY);
+					GLCall(glDrawElementsBaseVertex(GL_TRIANGLES, static_cast<GLsizei>(COUNT * 6), GL_UNSIGNED_INT, nullptr, static_cast<GLint>(first * 4)));
+				}
+				chunk.vao->unbind();
+			}
+			GLCall(glDepthMask(GL_TRUE));
+		});
+	}
+}
\ No newline at end of file
@@ -26,12 +26,16 @@ namespace ae
 {
 	// Public constructor(s)
 	Transform2DComponent::Transform2DComponent() noexcept
-		: mTransform(Matrix4f::identity())
-		, mInvTransform(Matrix4f::identity())
+		: mTransform()
+		, mInvTransform()
 		, mPosition(0.f, 0.f, 0.f)
 		, mScale(1.f, 1.f)
 		, mOrigin(0.f, 0.f)
 		, mRotation(0.f)
+		, mPrevPosition(0.f, 0.f, 0.f)
+		, mPrevScale(1.f, 1.f)
+		, mPrevOrigin(0.f, 0.f)
+		, mPrevRotation(0.f)
 		, mTransformDirty(false)
 		, mInvTransformDirty(false)
 	{
@@ -122,31 +126,17 @@ namespace ae
 		mTransformDirty = true;
 	}
 
-	const Matrix4f& Transform2DComponent::getTransform()
+	const Transform2D& Transform2DComponent::getTransform()
 	{
 		if (mTransformDirty) {
-			// Calculate the base rotation and scale
-			Matrix4f rotation = Matrix4f::rotate(mRotation, Vector3f::ZAxis);
-			Matrix4f scale = Matrix4f::scale(Vector3f(mScale));
-
-			// Calculate the final rotation and scale based on the origin
-			if (mOrigin.x != 0.f && mOrigin.y != 0.f) {
-				const Matrix4f ORIGIN_POS_OFFSET = Matrix4f::translate(Vector3f(mOrigin));
-				const Matrix4f ORIGIN_NEG_OFFSET = Matrix4f::translate(Vector3f(-mOrigin));
-
-				rotation = ORIGIN_POS_OFFSET * rotation * ORIGIN_NEG_OFFSET;
-				scale = ORIGIN_POS_OFFSET * scale * ORIGIN_NEG_OFFSET;
-			}
-
-			// Calculate the model transform
-			mTransform = Matrix4f::translate(mPosition - Vector3f(mOrigin)) * rotation * scale;
+			mTransform = Transform2D::compose(mPosition, mScale, mOrigin, mRotation);
 			mInvTransformDirty = std::exchange(mTransformDirty, false);
 		}
 
 		return mTransform;
 	}
 
-	const Matrix4f& Transform2DComponent::getInverseTransform()
+	const Transform2D& Transform2DComponent::getInverseTransform()
 	{
 		if (mTransformDirty || mInvTransformDirty) {
 			mInvTransform = getTransform().invert();
@@ -155,4 +145,20 @@ namespace ae
 		
 		return mInvTransform;
 	}
+
+	void Transform2DComponent::savePrevious() noexcept
+	{
+		mPrevPosition = mPosition;
+		mPrevScale = mScale;
+		mPrevOrigin = mOrigin;
+		mPrevRotation = mRotation;
+	}
+
+	Transform2D Transform2DComponent::getInterpolatedTransform(float interpolation) const
+	{
+		// Interpolate the properties rather than the matrices so that rotations and scales are blended correctly
+		const float T = Math::clamp(interpolation, 0.f, 1.f);
+		return Transform2D::compose(lerp(mPrevPosition, mPosition, T), lerp(mPrevScale, mScale, T), lerp(mPrevOrigin, mOrigin, T),
+		                            Math::lerp(mPrevRotation, mRotation, T));
+	}
 }
\ No newline at end of file
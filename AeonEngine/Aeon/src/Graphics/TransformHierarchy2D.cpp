@@ -0,0 +1,228 @@
+// MIT License
+// 
+// Copyright(c) 2019-2021 Filippos Gleglakos
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#include <AEON/Graphics/TransformHierarchy2D.h>
+
+#include <algorithm>
+
+#include <AEON/Graphics/Actor2D.h>
+#include <AEON/System/JobSystem.h>
+#include <AEON/System/Profiler.h>
+
+namespace ae
+{
+	// The minimum number of nodes of a same depth for which worker threads are spawned
+	static constexpr size_t MIN_PARALLEL_NODES = 4096;
+
+	// Public constructor(s)
+	TransformHierarchy2D::TransformHierarchy2D()
+		: mRoots()
+		, mActors()
+		, mParents()
+		, mDepthOffsets()
+		, mLocalTransforms()
+		, mWorldTransforms()
+		, mLocalDirty()
+		, mWorldDirty()
+		, mStructureDirty(false)
+		, mAnyDirty(false)
+	{
+	}
+
+	TransformHierarchy2D::~TransformHierarchy2D()
+	{
+		for (Actor2D* const actor : mActors) {
+			if (actor && actor->mHierarchy == this) {
+				actor->mHierarchy = nullptr;
+			}
+		}
+	}
+
+	// Public method(s)
+	void TransformHierarchy2D::addRoot(Actor2D& root)
+	{
+		// Check if the scene graph was already registered (ignored in Release mode)
+		if _CONSTEXPR_IF (AEON_DEBUG) {
+			if (std::find(mRoots.begin(), mRoots.end(), &root) != mRoots.end()) {
+				AEON_LOG_WARNING("Root already registered", "The scene graph provided is already stored in the hierarchy.\nAborting operation.");
+				return;
+			}
+		}
+
+		mRoots.push_back(&root);
+		root.mHierarchy = this;
+		mStructureDirty = true;
+	}
+
+	void TransformHierarchy2D::removeRoot(Actor2D& root)
+	{
+		mRoots.erase(std::remove(mRoots.begin(), mRoots.end(), &root), mRoots.end());
+		mStructureDirty = true;
+	}
+
+	void TransformHierarchy2D::update(unsigned int threadCount)
+	{
+		AEON_PROFILE_SCOPE("TransformHierarchy2D::update");
+
+		if (mStructureDirty) {
+			rebuild();
+		}
+		if (!mAnyDirty) {
+			return;
+		}
+
+		// Gather the modified model transforms
+		const size_t NODE_COUNT = mActors.size();
+		for (size_t i = 0; i < NODE_COUNT; ++i) {
+			if (mLocalDirty[i]) {
+				mLocalTransforms[i] = mActors[i]->getAffineTransform();
+				mWorldDirty[i] = 1;
+			}
+		}
+
+		// Compute the global transforms depth by depth, the nodes of a same depth only depend on the previous one
+		JobSystem& jobSystem = JobSystem::getInstance();
+		if (threadCount == 0) {
+			threadCount = static_cast<unsigned int>(jobSystem.getWorkerCount() + 1);
+		}
+		for (size_t depth = 0; depth + 1 < mDepthOffsets.size(); ++depth) {
+			const size_t BEGIN = mDepthOffsets[depth];
+			const size_t END = mDepthOffsets[depth + 1];
+			const size_t GROUP_COUNT = std::min(static_cast<size_t>(threadCount), (END - BEGIN) / MIN_PARALLEL_NODES);
+			if (GROUP_COUNT <= 1) {
+				updateRange(BEGIN, END);
+				continue;
+			}
+
+			// The groups are executed by the job system's threads, including the calling one
+			jobSystem.parallelFor(GROUP_COUNT, [this, BEGIN, END, GROUP_COUNT](size_t firstGroup, size_t lastGroup) {
+				updateRange(BEGIN + (END - BEGIN) * firstGroup / GROUP_COUNT, BEGIN + (END - BEGIN) * lastGroup / GROUP_COUNT);
+			}, 1);
+		}
+
+		// Store the recomputed global transforms in the nodes' caches
+		for (size_t i = 0; i < NODE_COUNT; ++i) {
+			if (mWorldDirty[i]) {
+				mActors[i]->mGlobalTransform = mWorldTransforms[i].toMatrix4f();
+				mActors[i]->mUpdateGlobalTransform = false;
+			}
+		}
+		std::fill(mLocalDirty.begin(), mLocalDirty.end(), static_cast<uint8_t>(0));
+		std::fill(mWorldDirty.begin(), mWorldDirty.end(), static_cast<uint8_t>(0));
+		mAnyDirty = false;
+	}
+
+	const Transform2D& TransformHierarchy2D::getWorldTransform(size_t index) const noexcept
+	{
+		return mWorldTransforms[index];
+	}
+
+	size_t TransformHierarchy2D::getNodeCount() const noexcept
+	{
+		return mActors.size();
+	}
+
+	// Private method(s)
+	void TransformHierarchy2D::rebuild()
+	{
+		// Detach the previously-registered nodes, those that are still part of the scene graphs will be registered again
+		for (Actor2D* const actor : mActors) {
+			if (actor && actor->mHierarchy == this) {
+				actor->mHierarchy = nullptr;
+			}
+		}
+		mActors.clear();
+		mParents.clear();
+		mDepthOffsets.clear();
+
+		// Lay out the scene graphs breadth-first
+		std::vector<std::pair<Actor2D*, int64_t>> depth, nextDepth;
+		for (Actor2D* const root : mRoots) {
+			depth.emplace_back(root, -1);
+		}
+		while (!depth.empty()) {
+			mDepthOffsets.push_back(mActors.size());
+			for (const auto& node : depth) {
+				const int64_t INDEX = static_cast<int64_t>(mActors.size());
+				node.first->mHierarchy = this;
+				node.first->mHierarchyIndex = static_cast<size_t>(INDEX);
+				mActors.push_back(node.first);
+				mParents.push_back(node.second);
+
+				for (const auto& child : node.first->mChildren) {
+					nextDepth.emplace_back(child.get(), INDEX);
+				}
+			}
+			depth.swap(nextDepth);
+			nextDepth.clear();
+		}
+		mDepthOffsets.push_back(mActors.size());
+
+		// Every node's transform needs to be gathered
+		const size_t NODE_COUNT = mActors.size();
+		mLocalTransforms.resize(NODE_COUNT);
+		mWorldTransforms.resize(NODE_COUNT);
+		mLocalDirty.assign(NODE_COUNT, 1);
+		mWorldDirty.assign(NODE_COUNT, 1);
+		mStructureDirty = false;
+		mAnyDirty = true;
+	}
+
+	void TransformHierarchy2D::updateRange(size_t begin, size_t end) noexcept
+	{
+		for (size_t i = begin; i < end; ++i) {
+			const int64_t PARENT = mParents[i];
+			if (PARENT < 0) {
+				if (mWorldDirty[i]) {
+					mWorldTransforms[i] = mLocalTransforms[i];
+				}
+			}
+			else if (mWorldDirty[i] || mWorldDirty[PARENT]) {
+				mWorldTransforms[i] = mWorldTransforms[PARENT] * mLocalTransforms[i];
+				mWorldDirty[i] = 1;
+			}
+		}
+	}
+
+	void TransformHierarchy2D::markDirty(size_t index) noexcept
+	{
+		if (!mStructureDirty) {
+			mLocalDirty[index] = 1;
+			mAnyDirty = true;
+		}
+	}
+
+	void TransformHierarchy2D::markStructureDirty() noexcept
+	{
+		mStructureDirty = true;
+	}
+
+	void TransformHierarchy2D::detachActor(Actor2D& actor, size_t index) noexcept
+	{
+		if (index < mActors.size() && mActors[index] == &actor) {
+			mActors[index] = nullptr;
+		}
+		mRoots.erase(std::remove(mRoots.begin(), mRoots.end(), &actor), mRoots.end());
+		mStructureDirty = true;
+	}
+}
\ No newline at end of file
@@ -124,7 +124,7 @@ namespace ae
 	{
 		// Update the inverse model transform if necessary
 		if (mUpdateTransform || mUpdateInvTransform) {
-			mInvTransform = getTransform().invert();
+			mInvTransform = getTransform().invertAffine();
 			mUpdateInvTransform = false;
 		}
 
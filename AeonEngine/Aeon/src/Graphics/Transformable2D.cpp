@@ -28,7 +28,7 @@ namespace ae
 	void Transformable2D::setPosition(const Vector2f& position, int zIndex) noexcept
 	{
 		mPosition.xy = position;
-		mUpdateTransform = true;
+		invalidateTransform();
 
 		// Only modify the z position if it was manually set
 		if (zIndex != INT_MAX) {
@@ -40,7 +40,7 @@ namespace ae
 	{
 		mPosition.x = posX;
 		mPosition.y = posY;
-		mUpdateTransform = true;
+		invalidateTransform();
 
 		// Only modify the z position if it was manually set
 		if (zIndex != INT_MAX) {
@@ -51,20 +51,20 @@ namespace ae
 	void Transformable2D::setRotation(float angle) noexcept
 	{
 		mRotation = angle;
-		mUpdateTransform = true;
+		invalidateTransform();
 	}
 
 	void Transformable2D::setScale(const Vector2f& scale) noexcept
 	{
 		mScale = scale;
-		mUpdateTransform = true;
+		invalidateTransform();
 	}
 
 	void Transformable2D::setScale(float scaleX, float scaleY) noexcept
 	{
 		mScale.x = scaleX;
 		mScale.y = scaleY;
-		mUpdateTransform = true;
+		invalidateTransform();
 	}
 
 	void Transformable2D::setOriginFlags(uint32_t flags)
@@ -98,33 +98,33 @@ namespace ae
 	void Transformable2D::move(const Vector2f& offset) noexcept
 	{
 		mPosition.xy += offset;
-		mUpdateTransform = true;
+		invalidateTransform();
 	}
 
 	void Transformable2D::move(float offsetX, float offsetY) noexcept
 	{
 		mPosition.x += offsetX;
 		mPosition.y += offsetY;
-		mUpdateTransform = true;
+		invalidateTransform();
 	}
 
 	void Transformable2D::rotate(float angle) noexcept
 	{
 		mRotation += angle;
-		mUpdateTransform = true;
+		invalidateTransform();
 	}
 
 	void Transformable2D::scale(const Vector2f& scale) noexcept
 	{
 		mScale *= scale;
-		mUpdateTransform = true;
+		invalidateTransform();
 	}
 
 	void Transformable2D::scale(float scaleX, float scaleY) noexcept
 	{
 		mScale.x *= scaleX;
 		mScale.y *= scaleY;
-		mUpdateTransform = true;
+		invalidateTransform();
 	}
 
 	void Transformable2D::lookat(const Vector2f& focus)
@@ -136,39 +136,33 @@ namespace ae
 	void Transformable2D::setOrigin(const Vector2f& origin) noexcept
 	{
 		mOrigin = origin;
-		mUpdateTransform = true;
+		invalidateTransform();
 	}
 
 	const Matrix4f& Transformable2D::getTransform()
 	{
-		// Update the model transform if necessary
-		if (mUpdateTransform) {
-			// Calculate the base rotation and scale
-			Matrix4f rotation = Matrix4f::rotate(Math::toRadians(mRotation), Vector3f::ZAxis);
-			Matrix4f scale = Matrix4f::scale(Vector3f(mScale));
-
-			// Calculate the final rotation and scale based on the origin
-			if (mOrigin.x != 0.f && mOrigin.y != 0.f) {
-				const Matrix4f ORIGIN_POS_OFFSET = Matrix4f::translate(Vector3f(mOrigin));
-				const Matrix4f ORIGIN_NEG_OFFSET = Matrix4f::translate(Vector3f(-mOrigin));
-
-				rotation = ORIGIN_POS_OFFSET * rotation * ORIGIN_NEG_OFFSET;
-				scale = ORIGIN_POS_OFFSET * scale * ORIGIN_NEG_OFFSET;
-			}
+		getAffineTransform();
+		return mTransform;
+	}
 
-			// Calculate the model transform
-			mTransform = Matrix4f::translate(mPosition - Vector3f(mOrigin)) * rotation * scale;
+	const Transform2D& Transformable2D::getAffineTransform()
+	{
+		// Update the model transform if necessary, it's composed in closed form and then converted for the renderers
+		if (mUpdateTransform) {
+			mAffineTransform = Transform2D::compose(mPosition, mScale, mOrigin, Math::toRadians(mRotation));
+			mTransform = mAffineTransform.toMatrix4f();
 			mUpdateInvTransform = std::exchange(mUpdateTransform, false);
+			++mTransformVersion;
 		}
 
-		return mTransform;
+		return mAffineTransform;
 	}
 
 	const Matrix4f& Transformable2D::getInverseTransform()
 	{
 		// Update the inverse model transform if necessary
 		if (mUpdateTransform || mUpdateInvTransform) {
-			mInvTransform = getTransform().invert();
+			mInvTransform = getAffineTransform().invert().toMatrix4f();
 			mUpdateInvTransform = false;
 		}
 
@@ -195,6 +189,16 @@ namespace ae
 		return mOrigin;
 	}
 
+	uint32_t Transformable2D::getOriginFlags() const noexcept
+	{
+		return mOriginFlags;
+	}
+
+	uint32_t Transformable2D::getTransformVersion() const noexcept
+	{
+		return mTransformVersion;
+	}
+
 	Box2f Transformable2D::getWorldBounds()
 	{
 		const Box2f MODEL_BOUNDS = getModelBounds();
@@ -205,13 +209,15 @@ namespace ae
 
 	// Protected constructor(s)
 	Transformable2D::Transformable2D() noexcept
-		: mTransform(1.f)
+		: mAffineTransform()
+		, mTransform(1.f)
 		, mInvTransform(1.f)
 		, mPosition(0.f, 0.f, 0.f)
 		, mScale(1.f, 1.f)
 		, mOrigin(0.f, 0.f)
 		, mRotation(0.f)
 		, mOriginFlags(OriginFlag::Left | OriginFlag::Top)
+		, mTransformVersion(0)
 		, mUpdateTransform(false)
 		, mUpdateInvTransform(false)
 	{
@@ -222,4 +228,15 @@ namespace ae
 	{
 		setOriginFlags(mOriginFlags);
 	}
+
+	void Transformable2D::onTransformModified() noexcept
+	{
+	}
+
+	// Private method(s)
+	void Transformable2D::invalidateTransform() noexcept
+	{
+		mUpdateTransform = true;
+		onTransformModified();
+	}
 }
\ No newline at end of file
@@ -0,0 +1,415 @@
+// MIT License
+// 
+// Copyright(c) 2019-2021 Filippos Gleglakos
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <AEON/Graphics/TweenSystem.h>
+
+#include <algorithm>
+#include <limits>
+
+#include <AEON/Graphics/Actor2D.h>
+#include <AEON/Graphics/Sprite.h>
+#include <AEON/Graphics/Text.h>
+#include <AEON/Graphics/TileMap.h>
+#include <AEON/Graphics/internal/Shape.h>
+#include <AEON/Math/Misc.h>
+#include <AEON/System/DebugLogger.h>
+#include <AEON/System/JobSystem.h>
+#include <AEON/System/Profiler.h>
+
+namespace ae
+{
+	namespace
+	{
+		// The minimum number of tweens for which worker threads are spawned
+		constexpr size_t MIN_PARALLEL_TWEENS = 4096;
+
+		// Assembles the identifier of a tween from its handle and its generation
+		TweenSystem::TweenId makeTweenId(uint32_t handle, uint32_t generation) noexcept
+		{
+			return (static_cast<TweenSystem::TweenId>(generation) << 32) | handle;
+		}
+
+		// Converts the normalized components provided into a color, clamping them as the overshooting easing functions may exceed them
+		Color toColor(const Vector4f& value) noexcept
+		{
+			const auto toComponent = [](float component) noexcept {
+				return static_cast<uint8_t>(Math::clamp(component, 0.f, 1.f) * 255.f + 0.5f);
+			};
+			return Color(toComponent(value.x), toComponent(value.y), toComponent(value.z), toComponent(value.w));
+		}
+
+		// Computes the bounce easing function's progress
+		float bounceOut(float t) noexcept
+		{
+			constexpr float N = 7.5625f;
+			constexpr float D = 2.75f;
+			if (t < 1.f / D) {
+				return N * t * t;
+			}
+			if (t < 2.f / D) {
+				t -= 1.5f / D;
+				return N * t * t + 0.75f;
+			}
+			if (t < 2.5f / D) {
+				t -= 2.25f / D;
+				return N * t * t + 0.9375f;
+			}
+			t -= 2.625f / D;
+			return N * t * t + 0.984375f;
+		}
+	}
+
+	// Public method(s)
+	TweenSystem::TweenId TweenSystem::tweenPosition(Actor2D& actor, const Vector2f& position, const Time& duration, Easing easing, const Time& delay)
+	{
+		return add(actor, Property::Position, Vector4f(position.x, position.y, 0.f, 0.f), duration, easing, delay);
+	}
+
+	TweenSystem::TweenId TweenSystem::tweenScale(Actor2D& actor, const Vector2f& scale, const Time& duration, Easing easing, const Time& delay)
+	{
+		return add(actor, Property::Scale, Vector4f(scale.x, scale.y, 0.f, 0.f), duration, easing, delay);
+	}
+
+	TweenSystem::TweenId TweenSystem::tweenRotation(Actor2D& actor, float angle, const Time& duration, Easing easing, const Time& delay)
+	{
+		return add(actor, Property::Rotation, Vector4f(angle, 0.f, 0.f, 0.f), duration, easing, delay);
+	}
+
+	TweenSystem::TweenId TweenSystem::tweenColor(Actor2D& actor, const Color& color, const Time& duration, Easing easing, const Time& delay)
+	{
+		// Resolve the kind of actor owning the color once so that the updates don't need to
+		Property property;
+		if (dynamic_cast<Sprite*>(&actor)) {
+			property = Property::SpriteColor;
+		}
+		else if (dynamic_cast<Text*>(&actor)) {
+			property = Property::TextColor;
+		}
+		else if (dynamic_cast<TileMap*>(&actor)) {
+			property = Property::TileMapColor;
+		}
+		else if (dynamic_cast<Shape*>(&actor)) {
+			property = Property::FillColor;
+		}
+		else {
+			AEON_LOG_ERROR("Invalid actor", "The actor provided has no color to animate.\nAborting operation.");
+			return 0;
+		}
+
+		return add(actor, property, color.normalize(), duration, easing, delay);
+	}
+
+	TweenSystem::TweenId TweenSystem::tweenOutlineColor(Shape& shape, const Color& color, const Time& duration, Easing easing, const Time& delay)
+	{
+		return add(shape, Property::OutlineColor, color.normalize(), duration, easing, delay);
+	}
+
+	bool TweenSystem::cancel(TweenId tween)
+	{
+		const uint32_t HANDLE = static_cast<uint32_t>(tween);
+		if (HANDLE >= mIndices.size() || mGenerations[HANDLE] != static_cast<uint32_t>(tween >> 32) || mIndices[HANDLE] == INVALID_INDEX) {
+			return false;
+		}
+
+		remove(mIndices[HANDLE]);
+		return true;
+	}
+
+	void TweenSystem::cancelAll(const Actor2D& actor)
+	{
+		// Iterate backwards so that the tweens moved in place of the removed ones were already inspected
+		for (size_t i = mTargets.size(); i-- > 0;) {
+			if (mTargets[i] == &actor) {
+				remove(i);
+			}
+		}
+	}
+
+	void TweenSystem::clear()
+	{
+		for (size_t i = mTargets.size(); i-- > 0;) {
+			remove(i);
+		}
+	}
+
+	void TweenSystem::update(const Time& dt)
+	{
+		AEON_PROFILE_SCOPE("TweenSystem::update");
+
+		const size_t TWEEN_COUNT = mTargets.size();
+		if (TWEEN_COUNT == 0) {
+			return;
+		}
+
+		// Advance the tweens and capture the start values of those whose delay elapsed
+		const float DT = static_cast<float>(dt.asSeconds());
+		for (size_t i = 0; i < TWEEN_COUNT; ++i) {
+			mElapsed[i] += DT;
+			if (!mStarted[i] && mElapsed[i] >= 0.f) {
+				mStarts[i] = readValue(*mTargets[i], mProperties[i]);
+				mStarted[i] = 1;
+			}
+		}
+
+		// Compute the eased values, the tweens being independent of one another
+		JobSystem& jobSystem = JobSystem::getInstance();
+		const unsigned int THREAD_COUNT = (mThreadCount == 0) ? static_cast<unsigned int>(jobSystem.getWorkerCount() + 1) : mThreadCount;
+		const size_t GROUP_COUNT = std::min(static_cast<size_t>(THREAD_COUNT), TWEEN_COUNT / MIN_PARALLEL_TWEENS);
+		if (GROUP_COUNT <= 1) {
+			evaluateRange(0, TWEEN_COUNT);
+		}
+		else {
+			jobSystem.parallelFor(GROUP_COUNT, [this, TWEEN_COUNT, GROUP_COUNT](size_t firstGroup, size_t lastGroup) {
+				evaluateRange(TWEEN_COUNT * firstGroup / GROUP_COUNT, TWEEN_COUNT * lastGroup / GROUP_COUNT);
+			}, 1);
+		}
+
+		// Write the values back and remove the completed tweens, iterating backwards so that the tweens moved in place of the removed ones were already written
+		for (size_t i = TWEEN_COUNT; i-- > 0;) {
+			if (!mStarted[i]) {
+				continue;
+			}
+
+			writeValue(*mTargets[i], mProperties[i], mValues[i]);
+			if (mElapsed[i] * mInverseDurations[i] >= 1.f) {
+				remove(i);
+			}
+		}
+	}
+
+	void TweenSystem::setThreadCount(unsigned int threadCount) noexcept
+	{
+		mThreadCount = threadCount;
+	}
+
+	bool TweenSystem::isActive(TweenId tween) const noexcept
+	{
+		const uint32_t HANDLE = static_cast<uint32_t>(tween);
+		return (HANDLE < mIndices.size() && mGenerations[HANDLE] == static_cast<uint32_t>(tween >> 32) && mIndices[HANDLE] != INVALID_INDEX);
+	}
+
+	size_t TweenSystem::getTweenCount() const noexcept
+	{
+		return mTargets.size();
+	}
+
+	// Public static method(s)
+	float TweenSystem::ease(Easing easing, float t) noexcept
+	{
+		switch (easing)
+		{
+		case Easing::QuadIn:
+			return t * t;
+		case Easing::QuadOut:
+			return t * (2.f - t);
+		case Easing::QuadInOut:
+			return (t < 0.5f) ? 2.f * t * t : 1.f - 2.f * (1.f - t) * (1.f - t);
+		case Easing::CubicIn:
+			return t * t * t;
+		case Easing::CubicOut:
+			t = 1.f - t;
+			return 1.f - t * t * t;
+		case Easing::CubicInOut:
+			return (t < 0.5f) ? 4.f * t * t * t : 1.f - 4.f * (1.f - t) * (1.f - t) * (1.f - t);
+		case Easing::SineIn:
+			return 1.f - Math::cos(t * Math::PI * 0.5f);
+		case Easing::SineOut:
+			return Math::sin(t * Math::PI * 0.5f);
+		case Easing::SineInOut:
+			return 0.5f - 0.5f * Math::cos(t * Math::PI);
+		case Easing::BackOut:
+		{
+			constexpr float OVERSHOOT = 1.70158f;
+			t -= 1.f;
+			return 1.f + t * t * ((OVERSHOOT + 1.f) * t + OVERSHOOT);
+		}
+		case Easing::BounceOut:
+			return bounceOut(t);
+		default:
+			return t;
+		}
+	}
+
+	TweenSystem& TweenSystem::getInstance()
+	{
+		static TweenSystem instance;
+		return instance;
+	}
+
+	// Private constructor(s)
+	TweenSystem::TweenSystem()
+		: mTargets()
+		, mProperties()
+		, mEasings()
+		, mStarts()
+		, mEnds()
+		, mValues()
+		, mElapsed()
+		, mInverseDurations()
+		, mStarted()
+		, mIds()
+		, mIndices()
+		, mGenerations()
+		, mFreeHandles()
+		, mThreadCount(1)
+	{
+	}
+
+	// Private method(s)
+	TweenSystem::TweenId TweenSystem::add(Actor2D& actor, Property property, const Vector4f& end, const Time& duration, Easing easing, const Time& delay)
+	{
+		// Reuse a released handle if possible, its generation was incremented upon its release
+		uint32_t handle;
+		if (!mFreeHandles.empty()) {
+			handle = mFreeHandles.back();
+			mFreeHandles.pop_back();
+		}
+		else {
+			handle = static_cast<uint32_t>(mIndices.size());
+			mIndices.push_back(INVALID_INDEX);
+			mGenerations.push_back(1);
+		}
+
+		// A tween without duration completes during the next update
+		const float DURATION = static_cast<float>(duration.asSeconds());
+		const TweenId ID = makeTweenId(handle, mGenerations[handle]);
+		mIndices[handle] = static_cast<uint32_t>(mTargets.size());
+		mTargets.push_back(&actor);
+		mProperties.push_back(property);
+		mEasings.push_back(easing);
+		mStarts.push_back(end);
+		mEnds.push_back(end);
+		mValues.push_back(end);
+		mElapsed.push_back(-static_cast<float>(delay.asSeconds()));
+		mInverseDurations.push_back((DURATION > 0.f) ? 1.f / DURATION : std::numeric_limits<float>::max());
+		mStarted.push_back(0);
+		mIds.push_back(ID);
+
+		actor.mTweened = true;
+		return ID;
+	}
+
+	void TweenSystem::remove(size_t index) noexcept
+	{
+		// Release the tween's identifier
+		const uint32_t HANDLE = static_cast<uint32_t>(mIds[index]);
+		mIndices[HANDLE] = INVALID_INDEX;
+		++mGenerations[HANDLE];
+		mFreeHandles.push_back(HANDLE);
+
+		// Move the last tween in the removed tween's place
+		const size_t LAST = mTargets.size() - 1;
+		if (index != LAST) {
+			mTargets[index] = mTargets[LAST];
+			mProperties[index] = mProperties[LAST];
+			mEasings[index] = mEasings[LAST];
+			mStarts[index] = mStarts[LAST];
+			mEnds[index] = mEnds[LAST];
+			mValues[index] = mValues[LAST];
+			mElapsed[index] = mElapsed[LAST];
+			mInverseDurations[index] = mInverseDurations[LAST];
+			mStarted[index] = mStarted[LAST];
+			mIds[index] = mIds[LAST];
+			mIndices[static_cast<uint32_t>(mIds[index])] = static_cast<uint32_t>(index);
+		}
+
+		mTargets.pop_back();
+		mProperties.pop_back();
+		mEasings.pop_back();
+		mStarts.pop_back();
+		mEnds.pop_back();
+		mValues.pop_back();
+		mElapsed.pop_back();
+		mInverseDurations.pop_back();
+		mStarted.pop_back();
+		mIds.pop_back();
+	}
+
+	void TweenSystem::evaluateRange(size_t begin, size_t end) noexcept
+	{
+		for (size_t i = begin; i < end; ++i) {
+			const float T = Math::clamp(mElapsed[i] * mInverseDurations[i], 0.f, 1.f);
+			mValues[i] = mStarts[i] + (mEnds[i] - mStarts[i]) * ease(mEasings[i], T);
+		}
+	}
+
+	// Private static method(s)
+	Vector4f TweenSystem::readValue(const Actor2D& actor, Property property) noexcept
+	{
+		switch (property)
+		{
+		case Property::Position:
+		{
+			const Vector3f& POSITION = actor.getPosition();
+			return Vector4f(POSITION.x, POSITION.y, 0.f, 0.f);
+		}
+		case Property::Scale:
+		{
+			const Vector2f& SCALE = actor.getScale();
+			return Vector4f(SCALE.x, SCALE.y, 0.f, 0.f);
+		}
+		case Property::Rotation:
+			return Vector4f(actor.getRotation(), 0.f, 0.f, 0.f);
+		case Property::SpriteColor:
+			return static_cast<const Sprite&>(actor).getColor().normalize();
+		case Property::TextColor:
+			return static_cast<const Text&>(actor).getColor().normalize();
+		case Property::TileMapColor:
+			return static_cast<const TileMap&>(actor).getColor().normalize();
+		case Property::FillColor:
+			return static_cast<const Shape&>(actor).getFillColor().normalize();
+		default:
+			return static_cast<const Shape&>(actor).getOutlineColor().normalize();
+		}
+	}
+
+	void TweenSystem::writeValue(Actor2D& actor, Property property, const Vector4f& value) noexcept
+	{
+		switch (property)
+		{
+		case Property::Position:
+			actor.setPosition(value.x, value.y);
+			break;
+		case Property::Scale:
+			actor.setScale(value.x, value.y);
+			break;
+		case Property::Rotation:
+			actor.setRotation(value.x);
+			break;
+		case Property::SpriteColor:
+			static_cast<Sprite&>(actor).setColor(toColor(value));
+			break;
+		case Property::TextColor:
+			static_cast<Text&>(actor).setColor(toColor(value));
+			break;
+		case Property::TileMapColor:
+			static_cast<TileMap&>(actor).setColor(toColor(value));
+			break;
+		case Property::FillColor:
+			static_cast<Shape&>(actor).setFillColor(toColor(value));
+			break;
+		default:
+			static_cast<Shape&>(actor).setOutlineColor(toColor(value));
+			break;
+		}
+	}
+}
\ No newline at end of file
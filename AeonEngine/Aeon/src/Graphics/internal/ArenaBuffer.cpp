@@ -0,0 +1,228 @@
+// MIT License
+// 
+// Copyright(c) 2019-2021 Filippos Gleglakos
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <AEON/Graphics/internal/ArenaBuffer.h>
+
+#include <algorithm>
+
+#include <GL/glew.h>
+
+#include <AEON/Graphics/internal/Buffer.h>
+#include <AEON/Graphics/internal/GLCommon.h>
+
+namespace ae
+{
+	// Public constructor(s)
+	ArenaBuffer::ArenaBuffer() noexcept
+		: mFreeRanges()
+		, mReleasedRanges()
+		, mRetired()
+		, mData(nullptr)
+		, mSize(0)
+		, mUsedSize(0)
+	{
+	}
+
+	ArenaBuffer::ArenaBuffer(ArenaBuffer&& rvalue) noexcept
+		: mFreeRanges(std::move(rvalue.mFreeRanges))
+		, mReleasedRanges(std::move(rvalue.mReleasedRanges))
+		, mRetired(std::move(rvalue.mRetired))
+		, mData(rvalue.mData)
+		, mSize(rvalue.mSize)
+		, mUsedSize(rvalue.mUsedSize)
+	{
+		rvalue.mData = nullptr;
+	}
+
+	// Public operator(s)
+	ArenaBuffer& ArenaBuffer::operator=(ArenaBuffer&& rvalue) noexcept
+	{
+		// Copy the rvalue's trivial data and move the rest
+		mFreeRanges = std::move(rvalue.mFreeRanges);
+		mReleasedRanges = std::move(rvalue.mReleasedRanges);
+		mRetired = std::move(rvalue.mRetired);
+		mData = rvalue.mData;
+		mSize = rvalue.mSize;
+		mUsedSize = rvalue.mUsedSize;
+
+		rvalue.mData = nullptr;
+
+		return *this;
+	}
+
+	// Public method(s)
+	bool ArenaBuffer::create(const Buffer& buffer, int size)
+	{
+		// Check if the arena has already been created (ignored in Release mode)
+		if _CONSTEXPR_IF (AEON_DEBUG) {
+			if (mData) {
+				AEON_LOG_ERROR("Failed to create arena buffer", "The arena buffer has already been created.\nAborting operation.");
+				return false;
+			}
+			if (size <= 0) {
+				AEON_LOG_ERROR("Failed to create arena buffer", "The size must be greater than 0.\nAborting operation.");
+				return false;
+			}
+		}
+
+		// Create the immutable data store and map it persistently
+		const GLbitfield FLAGS = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+		buffer.setStorage(size, nullptr, FLAGS);
+		mData = static_cast<uint8_t*>(buffer.mapRange(0, size, FLAGS));
+		if (!mData) {
+			AEON_LOG_ERROR("Failed to create arena buffer", "The buffer's data store couldn't be mapped persistently.\nAborting operation.");
+			return false;
+		}
+
+		// The whole data store is free
+		mFreeRanges.assign(1, Range{ 0, size });
+		mReleasedRanges.clear();
+		mSize = size;
+		mUsedSize = 0;
+
+		return true;
+	}
+
+	void* ArenaBuffer::allocate(int size, int& offset, int alignment)
+	{
+		if (!mData || size <= 0) {
+			return nullptr;
+		}
+
+		// Find the first free range able to hold the aligned memory requested
+		for (auto itr = mFreeRanges.begin(); itr != mFreeRanges.end(); ++itr) {
+			const int ALIGNED = (itr->offset + alignment - 1) / alignment * alignment;
+			const int PADDING = ALIGNED - itr->offset;
+			if (PADDING + size > itr->size) {
+				continue;
+			}
+
+			// Keep the padding and the remainder of the range free
+			const Range REMAINDER{ ALIGNED + size, itr->size - PADDING - size };
+			if (PADDING > 0) {
+				itr->size = PADDING;
+				if (REMAINDER.size > 0) {
+					mFreeRanges.insert(itr + 1, REMAINDER);
+				}
+			}
+			else if (REMAINDER.size > 0) {
+				*itr = REMAINDER;
+			}
+			else {
+				mFreeRanges.erase(itr);
+			}
+
+			offset = ALIGNED;
+			mUsedSize += size;
+			return mData + ALIGNED;
+		}
+
+		return nullptr;
+	}
+
+	void ArenaBuffer::release(int offset, int size)
+	{
+		if (size > 0) {
+			mReleasedRanges.push_back(Range{ offset, size });
+		}
+	}
+
+	void ArenaBuffer::clear()
+	{
+		if (!mData) {
+			return;
+		}
+
+		// The whole data store is released at once, the next fence also covers the ranges still awaiting to be reclaimed
+		destroy();
+		mRetired.clear();
+		mFreeRanges.clear();
+		mReleasedRanges.assign(1, Range{ 0, mSize });
+		mUsedSize = mSize;
+	}
+
+	void ArenaBuffer::lock()
+	{
+		// Fence the ranges released during this frame
+		if (!mReleasedRanges.empty()) {
+			void* const fence = GLCall(glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0));
+			mRetired.push_back(RetiredRanges{ std::move(mReleasedRanges), fence });
+			mReleasedRanges.clear();
+		}
+
+		// Reclaim the ranges that OpenGL is done with without waiting (the fences are signaled in order)
+		while (!mRetired.empty())
+		{
+			GLsync sync = static_cast<GLsync>(mRetired.front().fence);
+			const GLenum RESULT = GLCall(glClientWaitSync(sync, 0, 0));
+			if (RESULT != GL_ALREADY_SIGNALED && RESULT != GL_CONDITION_SATISFIED) {
+				break;
+			}
+
+			GLCall(glDeleteSync(sync));
+			for (const Range& range : mRetired.front().ranges) {
+				reclaim(range);
+			}
+			mRetired.pop_front();
+		}
+	}
+
+	void ArenaBuffer::destroy()
+	{
+		for (RetiredRanges& retired : mRetired) {
+			if (retired.fence) {
+				GLCall(glDeleteSync(static_cast<GLsync>(retired.fence)));
+				retired.fence = nullptr;
+			}
+		}
+	}
+
+	int ArenaBuffer::getUsedSize() const noexcept
+	{
+		return mUsedSize;
+	}
+
+	bool ArenaBuffer::isCreated() const noexcept
+	{
+		return mData != nullptr;
+	}
+
+	// Private method(s)
+	void ArenaBuffer::reclaim(const Range& range)
+	{
+		mUsedSize -= range.size;
+
+		// Insert the range in order and merge it with its neighbours if they're contiguous
+		auto itr = std::lower_bound(mFreeRanges.begin(), mFreeRanges.end(), range.offset, [](const Range& freeRange, int offset) {
+			return freeRange.offset < offset;
+		});
+		itr = mFreeRanges.insert(itr, range);
+		if (itr + 1 != mFreeRanges.end() && itr->offset + itr->size == (itr + 1)->offset) {
+			itr->size += (itr + 1)->size;
+			mFreeRanges.erase(itr + 1);
+		}
+		if (itr != mFreeRanges.begin() && (itr - 1)->offset + (itr - 1)->size == itr->offset) {
+			(itr - 1)->size += itr->size;
+			mFreeRanges.erase(itr);
+		}
+	}
+}
\ No newline at end of file
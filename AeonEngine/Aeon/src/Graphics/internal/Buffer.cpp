@@ -34,6 +34,7 @@ namespace ae
 	Buffer::Buffer(uint32_t target)
 		: GLResource()
 		, mBindingTarget(target)
+		, mStorageSize(0)
 	{
 		// Create the OpenGL buffer
 		GLCall(glCreateBuffers(1, &mHandle));
@@ -42,6 +43,7 @@ namespace ae
 	Buffer::Buffer(Buffer&& rvalue) noexcept
 		: GLResource(std::move(rvalue))
 		, mBindingTarget(rvalue.mBindingTarget)
+		, mStorageSize(rvalue.mStorageSize)
 	{
 	}
 
@@ -55,6 +57,7 @@ namespace ae
 		// Copy the rvalue's trivial data and move the rest
 		GLResource::operator=(std::move(rvalue));
 		mBindingTarget = rvalue.mBindingTarget;
+		mStorageSize = rvalue.mStorageSize;
 
 		return *this;
 	}
@@ -75,7 +78,18 @@ namespace ae
 		GLCall(glUnmapNamedBuffer(mHandle));
 	}
 
+	void Buffer::setStorage(int size, const void* data, uint32_t flags) const
+	{
+		GLCall(glNamedBufferStorage(mHandle, size, data, flags));
+		mStorageSize = static_cast<size_t>(size);
+	}
+
 	// Public virtual method(s)
+	size_t Buffer::getMemorySize() const noexcept
+	{
+		return mStorageSize;
+	}
+
 	void Buffer::destroy() const
 	{
 		// Check if the OpenGL handle is valid before attempting to delete it (ignored in Release mode)
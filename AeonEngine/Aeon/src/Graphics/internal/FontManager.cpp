@@ -23,11 +23,14 @@
 #include <AEON/Graphics/internal/FontManager.h>
 
 #include <string>
+#include <algorithm>
 
 #include <ft2build.h>
 #include FT_FREETYPE_H
 
 #include <AEON/System/DebugLogger.h>
+#include <AEON/System/FileWatcher.h>
+#include <AEON/Graphics/Font.h>
 
 namespace ae
 {
@@ -50,6 +53,66 @@ namespace ae
 		return mLibrary;
 	}
 
+	void FontManager::registerFont(Font* font)
+	{
+		std::lock_guard<std::mutex> lock(mFontMutex);
+		mFonts.push_back(font);
+	}
+
+	void FontManager::unregisterFont(Font* font)
+	{
+		// Swap the font with the last one as the order doesn't matter
+		std::lock_guard<std::mutex> lock(mFontMutex);
+		auto fontItr = std::find(mFonts.begin(), mFonts.end(), font);
+		if (fontItr != mFonts.end()) {
+			std::iter_swap(fontItr, mFonts.end() - 1);
+			mFonts.pop_back();
+		}
+	}
+
+	size_t FontManager::reloadFonts(const std::string& filepath)
+	{
+		std::lock_guard<std::mutex> lock(mFontMutex);
+		size_t reloadCount = 0;
+		for (Font* font : mFonts) {
+			if (!font->getFilename().empty() && FileWatcher::normalizePath(font->getFilename()) == filepath && font->reloadFromFile()) {
+				++reloadCount;
+			}
+		}
+
+		return reloadCount;
+	}
+
+	void FontManager::update()
+	{
+		// Insert the completed batches, the fonts being unregistered once all of their batches have been inserted
+		for (size_t i = 0; i < mRasterizingFonts.size();) {
+			if (mRasterizingFonts[i]->uploadRasterized()) {
+				std::swap(mRasterizingFonts[i], mRasterizingFonts.back());
+				mRasterizingFonts.pop_back();
+				continue;
+			}
+			++i;
+		}
+	}
+
+	void FontManager::addRasterizingFont(Font* font)
+	{
+		if (std::find(mRasterizingFonts.begin(), mRasterizingFonts.end(), font) == mRasterizingFonts.end()) {
+			mRasterizingFonts.push_back(font);
+		}
+	}
+
+	void FontManager::removeRasterizingFont(Font* font)
+	{
+		// Swap the font with the last one as the order doesn't matter
+		auto fontItr = std::find(mRasterizingFonts.begin(), mRasterizingFonts.end(), font);
+		if (fontItr != mRasterizingFonts.end()) {
+			std::iter_swap(fontItr, mRasterizingFonts.end() - 1);
+			mRasterizingFonts.pop_back();
+		}
+	}
+
 	// Public static method(s)
 	FontManager& FontManager::getInstance()
 	{
@@ -60,6 +123,9 @@ namespace ae
 	// Private constructor(s)
 	FontManager::FontManager()
 		: mLibrary(nullptr)
+		, mFonts()
+		, mFontMutex()
+		, mRasterizingFonts()
 	{
 		// Initialize the FreeType library and make sure that no errors occurred
 		FT_Library ftLibrary;
@@ -22,6 +22,7 @@
 
 #include <AEON/Graphics/internal/Framebuffer.h>
 
+#include <algorithm>
 #include <string>
 #include <vector>
 
@@ -35,6 +36,9 @@ namespace ae
 	// Public constructor(s)
 	Framebuffer::Framebuffer()
 		: GLResource()
+		, mAttachments()
+		, mRenderbuffers()
+		, mRenderbufferSize(0)
 		, mColorAttachmentCount(0)
 	{
 		GLCall(glCreateFramebuffers(1, &mHandle));
@@ -42,6 +46,9 @@ namespace ae
 
 	Framebuffer::Framebuffer(Framebuffer&& rvalue) noexcept
 		: GLResource(std::move(rvalue))
+		, mAttachments(std::move(rvalue.mAttachments))
+		, mRenderbuffers(std::move(rvalue.mRenderbuffers))
+		, mRenderbufferSize(rvalue.mRenderbufferSize)
 		, mColorAttachmentCount(rvalue.mColorAttachmentCount)
 	{
 	}
@@ -51,6 +58,9 @@ namespace ae
 	{
 		// Copy the rvalue's trivial data and move the rest
 		GLResource::operator=(std::move(rvalue));
+		mAttachments = std::move(rvalue.mAttachments);
+		mRenderbuffers = std::move(rvalue.mRenderbuffers);
+		mRenderbufferSize = rvalue.mRenderbufferSize;
 		mColorAttachmentCount = rvalue.mColorAttachmentCount;
 
 		return *this;
@@ -67,10 +77,104 @@ namespace ae
 			}
 		}
 
-		// Find the attachment type of the texture provided
-		const Texture::InternalFormat FORMAT = texture->getInternalFormat();
+		// Attach the texture based on its internal format
+		const GLenum ATTACHMENT = nextAttachmentPoint(texture->getInternalFormat());
+		GLCall(glNamedFramebufferTexture(mHandle, ATTACHMENT, texture->getHandle(), 0));
+		updateDrawBuffers();
+	}
+
+	void Framebuffer::attachMultisampledStorage(const Vector2i& size, int sampleCount, Texture::InternalFormat format)
+	{
+		// Make sure that there aren't more than 15 renderbuffers attached to a color buffer (ignored in Release mode)
+		if _CONSTEXPR_IF (AEON_DEBUG) {
+			if (mColorAttachmentCount > 15) {
+				AEON_LOG_ERROR("Max color attachments reached", "Attempt to attach more than 15 renderbuffers to a color buffer.\nAborting operation.");
+				return;
+			}
+		}
+
+		// Create the multisampled renderbuffer and attach it based on its internal format
+		GLuint renderbuffer;
+		GLCall(glCreateRenderbuffers(1, &renderbuffer));
+		GLCall(glNamedRenderbufferStorageMultisample(renderbuffer, sampleCount, static_cast<GLenum>(format), size.x, size.y));
+		mRenderbuffers.push_back(renderbuffer);
+
+		// Account for the storage actually allocated by the driver (the sample count may have been rounded up)
+		const GLenum SIZE_PARAMETERS[] = { GL_RENDERBUFFER_RED_SIZE, GL_RENDERBUFFER_GREEN_SIZE, GL_RENDERBUFFER_BLUE_SIZE, GL_RENDERBUFFER_ALPHA_SIZE,
+		                                   GL_RENDERBUFFER_DEPTH_SIZE, GL_RENDERBUFFER_STENCIL_SIZE };
+		GLint bitCount = 0;
+		for (const GLenum PARAMETER : SIZE_PARAMETERS) {
+			GLint bits = 0;
+			GLCall(glGetNamedRenderbufferParameteriv(renderbuffer, PARAMETER, &bits));
+			bitCount += bits;
+		}
+		GLint samples = sampleCount;
+		GLCall(glGetNamedRenderbufferParameteriv(renderbuffer, GL_RENDERBUFFER_SAMPLES, &samples));
+		mRenderbufferSize += static_cast<size_t>(size.x) * size.y * std::max(samples, 1) * ((bitCount + 7) / 8);
+
+		const GLenum ATTACHMENT = nextAttachmentPoint(format);
+		GLCall(glNamedFramebufferRenderbuffer(mHandle, ATTACHMENT, GL_RENDERBUFFER, renderbuffer));
+		updateDrawBuffers();
+	}
+
+	void Framebuffer::invalidate(bool color, bool depthStencil) const
+	{
+		// Gather the attachment points requested
+		std::vector<GLenum> attachments;
+		attachments.reserve(mAttachments.size());
+		for (const GLenum attachment : mAttachments) {
+			const bool IS_COLOR = attachment >= GL_COLOR_ATTACHMENT0 && attachment <= GL_COLOR_ATTACHMENT15;
+			if ((IS_COLOR) ? color : depthStencil) {
+				attachments.push_back(attachment);
+			}
+		}
+
+		if (!attachments.empty()) {
+			GLCall(glInvalidateNamedFramebufferData(mHandle, static_cast<GLsizei>(attachments.size()), attachments.data()));
+		}
+	}
+
+	void Framebuffer::resolve(const Framebuffer& target, const Vector2i& size) const
+	{
+		GLCall(glBlitNamedFramebuffer(mHandle, target.mHandle, 0, 0, size.x, size.y, 0, 0, size.x, size.y, GL_COLOR_BUFFER_BIT, GL_NEAREST));
+	}
+
+	// Public virtual method(s)
+	size_t Framebuffer::getMemorySize() const noexcept
+	{
+		return mRenderbufferSize;
+	}
+
+	void Framebuffer::destroy() const
+	{
+		// Check if the OpenGL handle is valid before attempting to delete it (ignored in Release mode)
+		if _CONSTEXPR_IF (AEON_DEBUG) {
+			if (!mHandle) {
+				AEON_LOG_ERROR("Invalid OpenGL handle", "Attempt to destroy default back buffer.\nAborting destruction.");
+				return;
+			}
+		}
+
+		GLCall(glDeleteFramebuffers(1, &mHandle));
+		if (!mRenderbuffers.empty()) {
+			GLCall(glDeleteRenderbuffers(static_cast<GLsizei>(mRenderbuffers.size()), mRenderbuffers.data()));
+		}
+	}
+
+	void Framebuffer::bind() const
+	{
+		GLCall(glBindFramebuffer(GL_FRAMEBUFFER, mHandle));
+	}
+
+	void Framebuffer::unbind() const
+	{
+		GLCall(glBindFramebuffer(GL_FRAMEBUFFER, 0));
+	}
+	// Private method(s)
+	unsigned int Framebuffer::nextAttachmentPoint(Texture::InternalFormat format)
+	{
 		GLenum attachment;
-		switch (FORMAT)
+		switch (format)
 		{
 		case Texture::InternalFormat::DEPTH32:
 		case Texture::InternalFormat::DEPTH24:
@@ -85,52 +189,31 @@ namespace ae
 			attachment = GL_STENCIL_ATTACHMENT;
 			break;
 		default:
-			attachment = GL_COLOR_ATTACHMENT0 + mColorAttachmentCount++;
+			attachment = GL_COLOR_ATTACHMENT0 + static_cast<GLenum>(mColorAttachmentCount++);
 		}
 
-		// Attach the texture
-		GLCall(glNamedFramebufferTexture(mHandle, attachment, texture->getHandle(), 0));
+		mAttachments.push_back(attachment);
+		return attachment;
+	}
 
+	void Framebuffer::updateDrawBuffers() const
+	{
 		// Set the buffers that will be rendered into
 		if (mColorAttachmentCount > 0) {
 			std::vector<GLenum> drawBuffers;
 			drawBuffers.reserve(mColorAttachmentCount);
 			for (size_t i = 0; i < mColorAttachmentCount; ++i) {
-				drawBuffers.emplace_back(GL_COLOR_ATTACHMENT0 + i);
+				drawBuffers.emplace_back(GL_COLOR_ATTACHMENT0 + static_cast<GLenum>(i));
 			}
 
 			GLCall(glNamedFramebufferDrawBuffers(mHandle, static_cast<GLsizei>(drawBuffers.size()), drawBuffers.data()));
 
 			// Check that the framebuffer is complete (ignored in Release mode)
 			if _CONSTEXPR_IF (AEON_DEBUG) {
-				if (glCheckFramebufferStatus(GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE) {
+				if (glCheckNamedFramebufferStatus(mHandle, GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE) {
 					AEON_LOG_ERROR("Incomplete framebuffer", "The framebuffer wasn't correctly set up.");
 				}
 			}
 		}
 	}
-
-	// Public virtual method(s)
-	void Framebuffer::destroy() const
-	{
-		// Check if the OpenGL handle is valid before attempting to delete it (ignored in Release mode)
-		if _CONSTEXPR_IF (AEON_DEBUG) {
-			if (!mHandle) {
-				AEON_LOG_ERROR("Invalid OpenGL handle", "Attempt to destroy default back buffer.\nAborting destruction.");
-				return;
-			}
-		}
-
-		GLCall(glDeleteFramebuffers(1, &mHandle));
-	}
-
-	void Framebuffer::bind() const
-	{
-		GLCall(glBindFramebuffer(GL_FRAMEBUFFER, mHandle));
-	}
-
-	void Framebuffer::unbind() const
-	{
-		GLCall(glBindFramebuffer(GL_FRAMEBUFFER, 0));
-	}
 }
\ No newline at end of file
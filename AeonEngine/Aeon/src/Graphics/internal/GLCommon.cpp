@@ -22,15 +22,146 @@
 
 #include <AEON/Graphics/internal/GLCommon.h>
 
+#include <algorithm>
+#include <array>
+
 #include <GL/glew.h>
 
 namespace ae
 {
 	namespace gl
 	{
+		namespace
+		{
+			// The cached OpenGL state (matches OpenGL's default state)
+			struct StateCache
+			{
+				std::array<GLuint, 32> textures = {};       //!< The texture bound to each of the first 32 texture units
+				std::array<GLuint, 32> samplers = {};       //!< The sampler bound to each of the first 32 texture units
+				std::array<GLenum, 6>  blendFunction = {
+					GL_FUNC_ADD, GL_FUNC_ADD, GL_ONE, GL_ZERO, GL_ONE, GL_ZERO
+				};                                          //!< The blending equations and factors
+				GLuint                 program = 0;         //!< The shader program in use
+				std::array<GLint, 4>   scissor = {};        //!< The region of the scissor test (x, y, width, height)
+				GLuint                 vao = 0;             //!< The VAO bound
+				bool                   blend = false;       //!< Whether blending is enabled
+				bool                   depthTest = false;   //!< Whether depth-testing is enabled
+				bool                   scissorTest = false; //!< Whether the scissor test is enabled
+			};
+
+			// The damaged region to which every drawcall is restricted (x, y, width, height), alongside the scissor region last requested
+			struct DamageRegion
+			{
+				std::array<GLint, 4> region = {};     //!< The damaged region of the framebuffer
+				std::array<GLint, 4> requested = {};  //!< The scissor region last requested by setScissor()
+				bool                 enabled = false; //!< Whether the drawcalls are restricted to the damaged region
+			};
+
+			StateCache    state;
+			StateCounters counters = {};
+			DamageRegion  damage;
+			bool          noErrorContext = false;
+
+			// Applies the scissor region requested restricted to the damaged region (an empty intersection discards every fragment)
+			void applyScissor()
+			{
+				std::array<GLint, 4> scissor = damage.requested;
+				bool enabled = scissor[2] > 0 && scissor[3] > 0;
+				if (damage.enabled) {
+					if (enabled) {
+						const GLint LEFT = std::max(scissor[0], damage.region[0]);
+						const GLint BOTTOM = std::max(scissor[1], damage.region[1]);
+						const GLint RIGHT = std::min(scissor[0] + scissor[2], damage.region[0] + damage.region[2]);
+						const GLint TOP = std::min(scissor[1] + scissor[3], damage.region[1] + damage.region[3]);
+						scissor = { LEFT, BOTTOM, std::max(RIGHT - LEFT, 0), std::max(TOP - BOTTOM, 0) };
+					}
+					else {
+						scissor = damage.region;
+					}
+					enabled = true;
+				}
+
+				if (state.scissorTest != enabled) {
+					if (enabled) {
+						GLCall(glEnable(GL_SCISSOR_TEST));
+					}
+					else {
+						GLCall(glDisable(GL_SCISSOR_TEST));
+					}
+					state.scissorTest = enabled;
+				}
+
+				if (enabled && state.scissor != scissor) {
+					GLCall(glScissor(scissor[0], scissor[1], scissor[2], scissor[3]));
+					state.scissor = scissor;
+				}
+			}
+
+			// Retrieves the name of the source of a debug message
+			const char* getDebugSourceName(GLenum source) noexcept
+			{
+				switch (source)
+				{
+				case GL_DEBUG_SOURCE_API:
+					return "API";
+				case GL_DEBUG_SOURCE_WINDOW_SYSTEM:
+					return "Window system";
+				case GL_DEBUG_SOURCE_SHADER_COMPILER:
+					return "Shader compiler";
+				case GL_DEBUG_SOURCE_THIRD_PARTY:
+					return "Third party";
+				case GL_DEBUG_SOURCE_APPLICATION:
+					return "Application";
+				default:
+					return "Other";
+				}
+			}
+
+			// Retrieves the name of the type of a debug message
+			const char* getDebugTypeName(GLenum type) noexcept
+			{
+				switch (type)
+				{
+				case GL_DEBUG_TYPE_ERROR:
+					return "Error";
+				case GL_DEBUG_TYPE_DEPRECATED_BEHAVIOR:
+					return "Deprecated behavior";
+				case GL_DEBUG_TYPE_UNDEFINED_BEHAVIOR:
+					return "Undefined behavior";
+				case GL_DEBUG_TYPE_PORTABILITY:
+					return "Portability";
+				case GL_DEBUG_TYPE_PERFORMANCE:
+					return "Performance";
+				case GL_DEBUG_TYPE_MARKER:
+					return "Marker";
+				default:
+					return "Other";
+				}
+			}
+
+			// Reports the debug messages to the logger (the message is copied as it's only valid during the callback, which may run on one of the driver's threads)
+			void GLAPIENTRY debugMessageCallback(GLenum source, GLenum type, GLuint id, GLenum severity, GLsizei, const GLchar* message, const void*)
+			{
+				if (type == GL_DEBUG_TYPE_ERROR || severity == GL_DEBUG_SEVERITY_HIGH) {
+					AEON_LOG_ERROR_F("OpenGL Error", "Source: {}\nType: {}\nID: {}\nMessage: {}", getDebugSourceName(source), getDebugTypeName(type), id, message);
+				}
+				else if (severity == GL_DEBUG_SEVERITY_MEDIUM) {
+					AEON_LOG_WARNING_F("OpenGL Warning", "Source: {}\nType: {}\nID: {}\nMessage: {}", getDebugSourceName(source), getDebugTypeName(type), id, message);
+				}
+				else {
+					AEON_LOG_INFO_F("OpenGL Message", "Source: {}\nType: {}\nID: {}\nMessage: {}", getDebugSourceName(source), getDebugTypeName(type), id, message);
+				}
+			}
+		}
+
 		// Function(s)
 		void checkError(const char* statement)
 		{
+			// A context created with KHR_no_error doesn't report its errors
+			if (noErrorContext) {
+				return;
+			}
+
 			// Retrieve the OpenGL error (if one occurred)
 			GLenum GLError = glGetError();
 
@@ -65,8 +196,259 @@ namespace ae
 				}
 
 				// Log the OpenGL error message
-				AEON_LOG_ERROR("OpenGL Error", "Type: " + errorTypeStr + "\nOpenGL Statement: " + statement);
+				AEON_LOG_ERROR_F("OpenGL Error", "Type: {}\nOpenGL Statement: {}", errorTypeStr, statement);
 			}
 		}
+
+		void setNoErrorContext(bool noError) noexcept
+		{
+			noErrorContext = noError;
+		}
+
+		bool enableDebugOutput(uint32_t minimumSeverity, bool synchronous)
+		{
+			if (!GLEW_KHR_debug) {
+				return false;
+			}
+
+			GLCall(glEnable(GL_DEBUG_OUTPUT));
+			if (synchronous) {
+				GLCall(glEnable(GL_DEBUG_OUTPUT_SYNCHRONOUS));
+			}
+			else {
+				GLCall(glDisable(GL_DEBUG_OUTPUT_SYNCHRONOUS));
+			}
+			GLCall(glDebugMessageCallback(debugMessageCallback, nullptr));
+
+			// Only let the driver generate the messages from the most severe down to the minimum severity
+			const GLenum SEVERITIES[] = { GL_DEBUG_SEVERITY_HIGH, GL_DEBUG_SEVERITY_MEDIUM, GL_DEBUG_SEVERITY_LOW, GL_DEBUG_SEVERITY_NOTIFICATION };
+			GLCall(glDebugMessageControl(GL_DONT_CARE, GL_DONT_CARE, GL_DONT_CARE, 0, nullptr, GL_FALSE));
+			for (const GLenum SEVERITY : SEVERITIES) {
+				GLCall(glDebugMessageControl(GL_DONT_CARE, GL_DONT_CARE, SEVERITY, 0, nullptr, GL_TRUE));
+				if (SEVERITY == minimumSeverity) {
+					break;
+				}
+			}
+
+			return true;
+		}
+
+		const StateCounters& getStateCounters() noexcept
+		{
+			return counters;
+		}
+
+		void useProgram(unsigned int program)
+		{
+			if (state.program != program) {
+				GLCall(glUseProgram(program));
+				state.program = program;
+				++counters.programChanges;
+			}
+		}
+
+		unsigned int getProgram() noexcept
+		{
+			return state.program;
+		}
+
+		void bindTextureUnit(unsigned int unit, unsigned int texture)
+		{
+			// The units beyond the ones cached are always rebound
+			if (unit >= state.textures.size()) {
+				GLCall(glBindTextureUnit(unit, texture));
+				++counters.textureChanges;
+				return;
+			}
+
+			if (state.textures[unit] != texture) {
+				GLCall(glBindTextureUnit(unit, texture));
+				state.textures[unit] = texture;
+				++counters.textureChanges;
+			}
+		}
+
+		void bindTextures(unsigned int first, int count, const unsigned int* textures)
+		{
+			// Find the range of units whose bound texture differs, and rebind it with a single call
+			int begin = count, end = 0;
+			for (int i = 0; i < count; ++i) {
+				const unsigned int UNIT = first + i;
+				if (UNIT >= state.textures.size() || state.textures[UNIT] != textures[i]) {
+					begin = std::min(begin, i);
+					end = i + 1;
+				}
+			}
+
+			if (begin < end) {
+				GLCall(glBindTextures(first + begin, end - begin, textures + begin));
+				counters.textureChanges += end - begin;
+				for (int i = begin; i < end && first + i < state.textures.size(); ++i) {
+					state.textures[first + i] = textures[i];
+				}
+			}
+		}
+
+		void bindSampler(unsigned int unit, unsigned int sampler)
+		{
+			// The units beyond the ones cached are always rebound
+			if (unit >= state.samplers.size()) {
+				GLCall(glBindSampler(unit, sampler));
+				++counters.samplerChanges;
+				return;
+			}
+
+			if (state.samplers[unit] != sampler) {
+				GLCall(glBindSampler(unit, sampler));
+				state.samplers[unit] = sampler;
+				++counters.samplerChanges;
+			}
+		}
+
+		void bindSamplers(unsigned int first, int count, const unsigned int* samplers)
+		{
+			// Find the range of units whose bound sampler differs, and rebind it with a single call
+			int begin = count, end = 0;
+			for (int i = 0; i < count; ++i) {
+				const unsigned int UNIT = first + i;
+				if (UNIT >= state.samplers.size() || state.samplers[UNIT] != samplers[i]) {
+					begin = std::min(begin, i);
+					end = i + 1;
+				}
+			}
+
+			if (begin < end) {
+				GLCall(glBindSamplers(first + begin, end - begin, samplers + begin));
+				counters.samplerChanges += end - begin;
+				for (int i = begin; i < end && first + i < state.samplers.size(); ++i) {
+					state.samplers[first + i] = samplers[i];
+				}
+			}
+		}
+
+		void bindVertexArray(unsigned int vao)
+		{
+			if (state.vao != vao) {
+				GLCall(glBindVertexArray(vao));
+				state.vao = vao;
+				++counters.vertexArrayChanges;
+			}
+		}
+
+		void setCapability(uint32_t capability, bool enabled)
+		{
+			// Retrieve the cached capability's state
+			bool* cached = nullptr;
+			switch (capability)
+			{
+			case GL_BLEND:
+				cached = &state.blend;
+				break;
+			case GL_DEPTH_TEST:
+				cached = &state.depthTest;
+				break;
+			default:
+				break;
+			}
+
+			if (cached && *cached == enabled) {
+				return;
+			}
+
+			if (enabled) {
+				GLCall(glEnable(capability));
+			}
+			else {
+				GLCall(glDisable(capability));
+			}
+
+			if (cached) {
+				*cached = enabled;
+			}
+			if (capability == GL_BLEND) {
+				++counters.blendChanges;
+			}
+		}
+
+		void setBlendFunction(uint32_t colorEquation, uint32_t alphaEquation, uint32_t colorSrcFactor, uint32_t colorDstFactor, uint32_t alphaSrcFactor, uint32_t alphaDstFactor)
+		{
+			const std::array<GLenum, 6> BLEND_FUNCTION = { colorEquation, alphaEquation, colorSrcFactor, colorDstFactor, alphaSrcFactor, alphaDstFactor };
+			if (state.blendFunction == BLEND_FUNCTION) {
+				return;
+			}
+
+			GLCall(glBlendEquationSeparate(colorEquation, alphaEquation));
+			GLCall(glBlendFuncSeparate(colorSrcFactor, colorDstFactor, alphaSrcFactor, alphaDstFactor));
+			state.blendFunction = BLEND_FUNCTION;
+			++counters.blendChanges;
+		}
+
+		void setScissor(int x, int y, int width, int height)
+		{
+			// An empty region disables the scissor test (the region set previously is kept), unless a damaged region is active
+			damage.requested = { x, y, width, height };
+			applyScissor();
+		}
+
+		void setDamageRegion(int x, int y, int width, int height)
+		{
+			damage.region = { x, y, std::max(width, 0), std::max(height, 0) };
+			damage.enabled = true;
+			applyScissor();
+		}
+
+		void resetDamageRegion()
+		{
+			damage.enabled = false;
+			applyScissor();
+		}
+
+		void releaseObject(unsigned int texture, unsigned int vao, unsigned int program)
+		{
+			// OpenGL unbinds the deleted textures from all units and the deleted VAO from the context
+			if (texture != 0) {
+				for (GLuint& boundTexture : state.textures) {
+					if (boundTexture == texture) {
+						boundTexture = 0;
+					}
+				}
+			}
+			if (vao != 0 && state.vao == vao) {
+				state.vao = 0;
+			}
+
+			// A deleted shader program remains in use until another one is used, so it's explicitly unbound
+			if (program != 0 && state.program == program) {
+				useProgram(0);
+			}
+		}
+
+		void releaseSampler(unsigned int sampler)
+		{
+			for (GLuint& boundSampler : state.samplers) {
+				if (boundSampler == sampler) {
+					boundSampler = 0;
+				}
+			}
+		}
+
+		void resetStateCache()
+		{
+			// Restore OpenGL's default state so that the cache is accurate once again
+			state = StateCache();
+			GLCall(glUseProgram(state.program));
+			GLCall(glBindTextures(0, static_cast<GLsizei>(state.textures.size()), nullptr));
+			GLCall(glBindSamplers(0, static_cast<GLsizei>(state.samplers.size()), nullptr));
+			GLCall(glBindVertexArray(state.vao));
+			GLCall(glDisable(GL_BLEND));
+			GLCall(glDisable(GL_DEPTH_TEST));
+			GLCall(glDisable(GL_SCISSOR_TEST));
+			GLCall(glBlendEquationSeparate(state.blendFunction[0], state.blendFunction[1]));
+			GLCall(glBlendFuncSeparate(state.blendFunction[2], state.blendFunction[3], state.blendFunction[4], state.blendFunction[5]));
+
+			// Restrict the drawcalls to the damaged region once again
+			damage.requested = {};
+			applyScissor();
+		}
 	}
 }
\ No newline at end of file
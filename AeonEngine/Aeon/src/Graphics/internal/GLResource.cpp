@@ -49,6 +49,12 @@ namespace ae
 		return mHandle;
 	}
 
+	// Public virtual method(s)
+	size_t GLResource::getMemorySize() const noexcept
+	{
+		return 0;
+	}
+
 	// Protected constructor(s)
 	GLResource::GLResource()
 		: mHandle(0)
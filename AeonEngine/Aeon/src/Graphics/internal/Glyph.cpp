@@ -37,7 +37,6 @@ namespace ae
 		: textureRect(std::move(rvalue.textureRect))
 		, bearing(std::move(rvalue.bearing))
 		, texture(rvalue.texture)
-		, individualTexture(std::move(rvalue.individualTexture))
 		, advance(rvalue.advance)
 	{
 	}
@@ -49,7 +48,6 @@ namespace ae
 		textureRect = std::move(rvalue.textureRect);
 		bearing = std::move(rvalue.bearing);
 		texture = rvalue.texture;
-		individualTexture = std::move(rvalue.individualTexture);
 		advance = rvalue.advance;
 
 		return *this;
@@ -33,6 +33,7 @@ namespace ae
 		: Buffer(GL_ELEMENT_ARRAY_BUFFER)
 		, mCount(0)
 		, mUsage(usage)
+		, mType(GL_UNSIGNED_INT)
 	{
 	}
 
@@ -40,6 +41,7 @@ namespace ae
 		: Buffer(std::move(rvalue))
 		, mCount(rvalue.mCount)
 		, mUsage(rvalue.mUsage)
+		, mType(rvalue.mType)
 	{
 	}
 
@@ -50,6 +52,7 @@ namespace ae
 		Buffer::operator=(std::move(rvalue));
 		mCount = rvalue.mCount;
 		mUsage = rvalue.mUsage;
+		mType = rvalue.mType;
 
 		return *this;
 	}
@@ -58,11 +61,26 @@ namespace ae
 	void IndexBuffer::setData(unsigned int size, const unsigned int* data)
 	{
 		mCount = size / sizeof(unsigned int);
+		mType = GL_UNSIGNED_INT;
 		GLCall(glNamedBufferData(mHandle, size, data, mUsage));
+		mStorageSize = size;
+	}
+
+	void IndexBuffer::setData(unsigned int size, const uint16_t* data)
+	{
+		mCount = size / sizeof(uint16_t);
+		mType = GL_UNSIGNED_SHORT;
+		GLCall(glNamedBufferData(mHandle, size, data, mUsage));
+		mStorageSize = size;
 	}
 
 	unsigned int IndexBuffer::getCount() const noexcept
 	{
 		return mCount;
 	}
+
+	uint32_t IndexBuffer::getType() const noexcept
+	{
+		return mType;
+	}
 }
\ No newline at end of file
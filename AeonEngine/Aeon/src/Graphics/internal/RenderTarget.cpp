@@ -22,6 +22,10 @@
 
 #include <AEON/Graphics/internal/RenderTarget.h>
 
+#include <array>
+#include <cmath>
+#include <limits>
+
 #include <GL/glew.h>
 
 #include <AEON/Window/Application.h>
@@ -56,15 +60,28 @@ namespace ae
 		GLCall(glClearNamedFramebufferfi(fboHandle, GL_DEPTH_STENCIL, 0, depthValue, 0));
 	}
 
-	void RenderTarget::activate()
+	void RenderTarget::activate(bool load)
 	{
+		// Apply the resize requested since the last activation before the framebuffer is bound
+		applyPendingResize();
+
 		if (activeTarget != this) {
 			activeTarget = this;
 
 			GLCall(glBindFramebuffer(GL_FRAMEBUFFER, getFramebufferHandle()));
 			GLCall(glViewport(0, 0, mFramebufferSize.x, mFramebufferSize.y));
 		}
-		clear();
+
+		// Only clear and redraw the damaged region
+		if (mDamageTracking) {
+			applyDamage();
+		}
+		else {
+			gl::resetDamageRegion();
+		}
+		if (load) {
+			loadContents();
+		}
 	}
 
 	void RenderTarget::setClearColor(const Color& color)
@@ -72,6 +89,59 @@ namespace ae
 		mClearColor = color.normalize();
 	}
 
+	void RenderTarget::addDamage(const Box2f& bounds)
+	{
+		if (!mDamageTracking) {
+			return;
+		}
+
+		std::lock_guard<std::mutex> lock(mDamageMutex);
+		if (mDamage.first) {
+			mDamage.second.min = min(mDamage.second.min, bounds.min);
+			mDamage.second.max = max(mDamage.second.max, bounds.max);
+		}
+		else {
+			mDamage = std::make_pair(true, bounds);
+		}
+	}
+
+	void RenderTarget::invalidate()
+	{
+		std::lock_guard<std::mutex> lock(mDamageMutex);
+		mFullDamage = true;
+	}
+
+	void RenderTarget::requestResize(const Vector2i& size) noexcept
+	{
+		// Only the last size requested is kept
+		mPendingSize = std::make_pair(size != mFramebufferSize, size);
+	}
+
+	bool RenderTarget::applyPendingResize()
+	{
+		if (!mPendingSize.first) {
+			return false;
+		}
+		mPendingSize.first = false;
+
+		// Recreate the attachments, the framebuffer handle and the viewport may have changed
+		onResize(mPendingSize.second);
+		deactivate();
+
+		// The camera's projection depends on the framebuffer size and every pixel has to be redrawn
+		if (mCamera) {
+			mCamera->invalidateProjection();
+		}
+		invalidate();
+
+		return true;
+	}
+
+	bool RenderTarget::hasPendingResize() const noexcept
+	{
+		return mPendingSize.first;
+	}
+
 	Vector2f RenderTarget::mapPixelToCoords(const Vector2f& pixel) const
 	{
 		// Check that a camera has been assigned to the render target (ignored in Release mode)
@@ -87,8 +157,8 @@ namespace ae
 		const Vector2f NDC(-1.f + 2.f * (pixel.x - VIEWPORT.min.x) / VIEWPORT.max.x,
 		                    1.f - 2.f * (pixel.y - VIEWPORT.min.y) / VIEWPORT.max.y);
 
-		// Transform the homogeneous coordinates by the inverse of the view and the inverse of the projection matrices
-		return Vector2f(mCamera->getInverseViewMatrix() * mCamera->getInverseProjectionMatrix() * Vector3f(NDC));
+		// Transform the homogeneous coordinates by the camera's cached inverse view-projection matrix
+		return Vector2f(mCamera->getInverseViewProjectionMatrix() * Vector3f(NDC));
 	}
 
 	Vector2f RenderTarget::mapCoordsToPixel(const Vector2f& point) const
@@ -144,24 +214,54 @@ namespace ae
 		return mFramebufferSize;
 	}
 
+	bool RenderTarget::isDamageTracking() const noexcept
+	{
+		return mDamageTracking;
+	}
+
 	// Public virtual method(s)
 	unsigned int RenderTarget::getFramebufferHandle() const noexcept
 	{
 		return 0;
 	}
 
+	bool RenderTarget::isOffscreen() const noexcept
+	{
+		return false;
+	}
+
+	void RenderTarget::storeContents()
+	{
+	}
+
 	// Protected constructor(s)
 	RenderTarget::RenderTarget() noexcept
 		: mFramebufferSize(0, 0)
+		, mDamageTracking(false)
 		, mClearColor(Color::Black.normalize())
 		, mCamera(nullptr)
+		, mDamageMutex()
+		, mDamage(false, Box2f())
+		, mFrameDamage(false, Box2f())
+		, mFullDamage(true)
+		, mFrameFullDamage(false)
+		, mDamageViewProjection()
+		, mPendingSize(false, Vector2i())
 	{
 	}
 
 	RenderTarget::RenderTarget(RenderTarget&& rvalue) noexcept
 		: mFramebufferSize(std::move(rvalue.mFramebufferSize))
+		, mDamageTracking(rvalue.mDamageTracking)
 		, mClearColor(std::move(rvalue.mClearColor))
 		, mCamera(std::move(rvalue.mCamera))
+		, mDamageMutex()
+		, mDamage(false, Box2f())
+		, mFrameDamage(false, Box2f())
+		, mFullDamage(true)
+		, mFrameFullDamage(false)
+		, mDamageViewProjection()
+		, mPendingSize(std::move(rvalue.mPendingSize))
 	{
 	}
 
@@ -170,9 +270,104 @@ namespace ae
 	{
 		// Move the rvalue's data
 		mFramebufferSize = std::move(rvalue.mFramebufferSize);
+		mDamageTracking = rvalue.mDamageTracking;
 		mClearColor = std::move(rvalue.mClearColor);
 		mCamera = std::move(rvalue.mCamera);
+		mDamage.first = false;
+		mFrameDamage.first = false;
+		mFullDamage = true;
+		mFrameFullDamage = false;
+		mPendingSize = std::move(rvalue.mPendingSize);
 
 		return *this;
 	}
+
+	// Protected method(s)
+	void RenderTarget::resetDamage()
+	{
+		// The regions damaged after the frame's last activation are kept for the next frame (the OpenGL state is left untouched as another context may be current)
+		std::lock_guard<std::mutex> lock(mDamageMutex);
+		mFrameDamage.first = false;
+		mFrameFullDamage = false;
+	}
+
+	void RenderTarget::deactivate() noexcept
+	{
+		if (activeTarget == this) {
+			activeTarget = nullptr;
+		}
+	}
+
+	// Protected virtual method(s)
+	void RenderTarget::loadContents()
+	{
+		clear();
+	}
+
+	void RenderTarget::onResize(const Vector2i& size)
+	{
+		mFramebufferSize = size;
+	}
+
+	// Private method(s)
+	void RenderTarget::applyDamage()
+	{
+		std::lock_guard<std::mutex> lock(mDamageMutex);
+
+		// Redraw everything if the camera moved as every pixel is likely to have changed
+		if (mCamera) {
+			const Matrix4f VIEW_PROJECTION = mCamera->getProjectionMatrix() * mCamera->getViewMatrix();
+			if (VIEW_PROJECTION != mDamageViewProjection) {
+				mDamageViewProjection = VIEW_PROJECTION;
+				mFullDamage = true;
+			}
+		}
+
+		// Move the damage accumulated since the last activation into the frame's damage
+		mFrameFullDamage = mFrameFullDamage || mFullDamage || !mCamera;
+		mFullDamage = false;
+		if (mDamage.first) {
+			if (mFrameDamage.first) {
+				mFrameDamage.second.min = min(mFrameDamage.second.min, mDamage.second.min);
+				mFrameDamage.second.max = max(mFrameDamage.second.max, mDamage.second.max);
+			}
+			else {
+				mFrameDamage = mDamage;
+			}
+			mDamage.first = false;
+		}
+
+		if (mFrameFullDamage) {
+			gl::resetDamageRegion();
+			return;
+		}
+
+		// Nothing is redrawn if nothing was damaged (the previous frame's content is kept)
+		if (!mFrameDamage.first) {
+			gl::setDamageRegion(0, 0, 0, 0);
+			return;
+		}
+
+		// Project the corners of the damaged region onto the framebuffer (the viewport covers the entire framebuffer)
+		const Vector2f SIZE(mFramebufferSize);
+		const Box2f& damage = mFrameDamage.second;
+		const std::array<Vector2f, 4> CORNERS = {
+			damage.min, Vector2f(damage.max.x, damage.min.y), damage.max, Vector2f(damage.min.x, damage.max.y)
+		};
+
+		Box2f region(Vector2f(std::numeric_limits<float>::max()), Vector2f(std::numeric_limits<float>::lowest()));
+		for (const Vector2f& corner : CORNERS) {
+			const Vector4f CLIP = mDamageViewProjection * Vector4f(corner.x, corner.y, 0.f, 1.f);
+			const Vector2f PIXEL = (Vector2f(CLIP.x, CLIP.y) / CLIP.w + 1.f) / 2.f * SIZE;
+			region.min = min(region.min, PIXEL);
+			region.max = max(region.max, PIXEL);
+		}
+
+		// Round the region outwards with a pixel of margin for the antialiased edges, and keep it within the framebuffer
+		const int LEFT = std::max(static_cast<int>(std::floor(region.min.x)) - 1, 0);
+		const int BOTTOM = std::max(static_cast<int>(std::floor(region.min.y)) - 1, 0);
+		const int RIGHT = std::min(static_cast<int>(std::ceil(region.max.x)) + 1, mFramebufferSize.x);
+		const int TOP = std::min(static_cast<int>(std::ceil(region.max.y)) + 1, mFramebufferSize.y);
+		gl::setDamageRegion(LEFT, BOTTOM, RIGHT - LEFT, TOP - BOTTOM);
+	}
 }
\ No newline at end of file
@@ -22,22 +22,95 @@
 
 #include <AEON/Graphics/internal/Renderer2D.h>
 
+#include <atomic>
+
 #include <GL/glew.h>
 
+#include <AEON/System/Clock.h>
+#include <AEON/System/Profiler.h>
 #include <AEON/Graphics/internal/GLCommon.h>
 #include <AEON/Graphics/internal/RenderTarget.h>
-#include <AEON/Graphics/Camera.h>
+#include <AEON/Graphics/Camera2D.h>
 #include <AEON/Graphics/GLResourceFactory.h>
+#include <AEON/Graphics/GPUProfiler.h>
+#include <AEON/Graphics/RenderCommandList.h>
 #include <AEON/Graphics/Renderable2D.h>
+#include <AEON/Graphics/RenderStates.h>
+#include <AEON/Graphics/Sampler.h>
+#include <AEON/Graphics/Texture.h>
 
 namespace ae
 {
+	namespace
+	{
+		// The world-space bounds visible by the calling thread's current scene
+		thread_local std::pair<bool, Box2f> cullingBounds(false, Box2f());
+
+		// The render target of the calling thread's current scene if it tracks its damage
+		thread_local RenderTarget* damageTarget = nullptr;
+
+		// The number of pixels covered by a world unit in the last scene rendered onto a window by a 2D camera (read by the updating threads)
+		std::atomic<float> pixelsPerUnit(0.f);
+
+		// The camera whose matrices were last uploaded to the transform UBO (shared by all renderers), alongside the values derived from them
+		struct UploadedCamera
+		{
+			const Camera*          camera = nullptr;
+			uint64_t               version = 0;
+			Matrix4f               viewProjection;
+			std::pair<bool, Box2f> cullingBounds;
+		} uploadedCamera;
+
+		// The time at which the renderers' clock started, from which the scenes' time is measured
+		const Time clockStart = Clock::getCurrentTime();
+
+		// The maximum number of views of a scene (the size of the transform UBO's array of view-projection matrices)
+		constexpr size_t MAX_VIEW_COUNT = 8;
+
+		// Computes the world-space bounds covered by the normalized device coordinates
+		std::pair<bool, Box2f> computeCullingBounds(const Camera* const camera, const Matrix4f& viewMatrix, const Matrix4f& projMatrix)
+		{
+			// Only the 2D cameras' views are associated to the actors' plane
+			if (!dynamic_cast<const Camera2D*>(camera)) {
+				return std::make_pair(false, Box2f());
+			}
+
+			// The 2D cameras' orthographic projection and view are affine
+			const Matrix4f INV_VIEW_PROJ = (projMatrix * viewMatrix).invertAffine();
+			Vector2f minPos(Vector2f(INV_VIEW_PROJ * Vector3f(-1.f, -1.f, 0.f)));
+			Vector2f maxPos(minPos);
+			for (const Vector3f& corner : { Vector3f(1.f, -1.f, 0.f), Vector3f(-1.f, 1.f, 0.f), Vector3f(1.f, 1.f, 0.f) }) {
+				const Vector2f POSITION(INV_VIEW_PROJ * corner);
+				minPos = min(minPos, POSITION);
+				maxPos = max(maxPos, POSITION);
+			}
+
+			return std::make_pair(true, Box2f(minPos, maxPos));
+		}
+
+		// Computes the viewport of a camera on a framebuffer (the camera's factors are relative to the top-left corner)
+		std::array<float, 4> computeViewport(const Camera& camera, const Vector2f& framebufferSize)
+		{
+			const Box2f& viewport = camera.getViewport();
+			const Vector2f POSITION = framebufferSize * viewport.min;
+			const Vector2f SIZE = framebufferSize * viewport.max;
+
+			return { POSITION.x, framebufferSize.y - POSITION.y - SIZE.y, SIZE.x, SIZE.y };
+		}
+	}
+
 	// Private static member(s)
 	Renderer2D* Renderer2D::activeInstance = nullptr;
 
 	// Public method(s)
 	void Renderer2D::submit(const Renderable2D& renderable, const RenderStates& states)
 	{
+		// Record the submission if the calling thread is recording
+		if (isRecording()) {
+			submitToActive(renderable.getVertices(), renderable.getIndices(), states);
+			return;
+		}
+
 		// Check if an inactive renderer received a submission (ignored in Release mode)
 		if _CONSTEXPR_IF (AEON_DEBUG) {
 			if (this != activeInstance) {
@@ -49,9 +122,49 @@ namespace ae
 		submit(renderable.getVertices(), renderable.getIndices(), states);
 	}
 
+	const Renderer2D::Statistics& Renderer2D::getStatistics() const noexcept
+	{
+		return mStatistics;
+	}
+
+	void Renderer2D::setViews(const std::vector<Camera*>& cameras)
+	{
+		// Check that the views can be uploaded and that none are invalid (ignored in Release mode)
+		if _CONSTEXPR_IF (AEON_DEBUG) {
+			if (cameras.size() >= MAX_VIEW_COUNT) {
+				AEON_LOG_ERROR("Invalid view count", "Up to " + std::to_string(MAX_VIEW_COUNT - 1) + " additional views are supported, " + std::to_string(cameras.size()) + " were provided.\nAborting operation.");
+				return;
+			}
+			if (std::find(cameras.begin(), cameras.end(), nullptr) != cameras.end()) {
+				AEON_LOG_ERROR("Invalid view", "One of the cameras provided is null.\nAborting operation.");
+				return;
+			}
+			if (mRenderTarget) {
+				AEON_LOG_WARNING("Invalid view modification", "The views can't be modified during a scene.\nAborting operation.");
+				return;
+			}
+		}
+
+		mViews = cameras;
+	}
+
+	const std::vector<Camera*>& Renderer2D::getViews() const noexcept
+	{
+		return mViews;
+	}
+
 	// Public virtual method(s)
 	void Renderer2D::beginScene(RenderTarget& target)
 	{
+		// Record the scene alongside its camera's current matrices if the calling thread is recording
+		if (RenderCommandList* const recordingList = RenderCommandList::getRecordingList()) {
+			Camera* const camera = target.getCamera();
+			recordingList->recordSceneBegin(*this, target, camera->getViewMatrix(), camera->getProjectionMatrix());
+			cullingBounds = computeCullingBounds(camera, camera->getViewMatrix(), camera->getProjectionMatrix());
+			damageTarget = (target.isDamageTracking()) ? &target : nullptr;
+			return;
+		}
+
 		// Check if there is already an active renderer (ignored in Release mode)
 		if _CONSTEXPR_IF (AEON_DEBUG) {
 			if (activeInstance) {
@@ -63,23 +176,90 @@ namespace ae
 		// Set the caller renderer as the active renderer
 		activeInstance = this;
 
+		// Reset the statistics and record the state counters so that the scene's state changes may be counted
+		mStatistics = Statistics();
+		mSceneCounters = gl::getStateCounters();
+		mSceneStart = Clock::getCurrentTime();
+		mSceneEnd = Time::Zero;
+
 		// Assign the new render target for this scene
 		mRenderTarget = &target;
 
-		// Retrieve the camera's matrices
+		// Time the scenes rendered onto render textures
+		mProfiledPass = mRenderTarget->isOffscreen();
+		if (mProfiledPass) {
+			GPUProfiler::getInstance().beginScope("RenderTexture pass");
+		}
+
+		// Retrieve the camera's matrices (the recorded ones are used if the scene is replayed from a command list)
 		Camera* const camera = mRenderTarget->getCamera();
-		const Matrix4f& viewMatrix = camera->getViewMatrix();
-		const Matrix4f& projMatrix = camera->getProjectionMatrix();
+		const Matrix4f& viewMatrix = (mCameraSnapshot.first) ? mCameraSnapshot.second.first : camera->getViewMatrix();
+		const Matrix4f& projMatrix = (mCameraSnapshot.first) ? mCameraSnapshot.second.second : camera->getProjectionMatrix();
 
-		// Upload the camera's properties to the UBO
-		mTransformUBO->queueUniformUpload("view", viewMatrix.elements.data(), sizeof(viewMatrix));
-		mTransformUBO->queueUniformUpload("projection", projMatrix.elements.data(), sizeof(projMatrix));
-		mTransformUBO->queueUniformUpload("viewProjection", (projMatrix * viewMatrix).elements.data(), sizeof(Matrix4f));
+		// Upload the camera's properties to the UBO and compute the world-space bounds against which the actors will be culled
+		// These are skipped if the UBO already holds the camera's current matrices (the recorded ones are always uploaded)
+		// The scene's time is always uploaded so that the shaders may animate the cached batches
+		const bool UP_TO_DATE = !mCameraSnapshot.first && uploadedCamera.camera == camera && uploadedCamera.version == camera->getVersion();
+		const float SCENE_TIME = getSceneTime().asSeconds();
+		mTransformUBO->queueUniformUpload(mTransformOffsets[5], &SCENE_TIME, sizeof(float));
+		if (!UP_TO_DATE) {
+			uploadedCamera.viewProjection = projMatrix * viewMatrix;
+			mTransformUBO->queueUniformUpload(mTransformOffsets[0], viewMatrix.elements.data(), sizeof(viewMatrix));
+			mTransformUBO->queueUniformUpload(mTransformOffsets[1], projMatrix.elements.data(), sizeof(projMatrix));
+			mTransformUBO->queueUniformUpload(mTransformOffsets[2], uploadedCamera.viewProjection.elements.data(), sizeof(Matrix4f));
+			mTransformUBO->queueUniformUpload(mTransformOffsets[3], uploadedCamera.viewProjection.elements.data(), sizeof(Matrix4f));
+			uploadedCamera.cullingBounds = computeCullingBounds(camera, viewMatrix, projMatrix);
+			uploadedCamera.camera = (mCameraSnapshot.first) ? nullptr : camera;
+			uploadedCamera.version = camera->getVersion();
+		}
 		mTransformUBO->uploadQueuedUniforms();
+		const Matrix4f& VIEW_PROJECTION = uploadedCamera.viewProjection;
+		mCameraSnapshot.first = false;
+
+		// Set the culling bounds and the target the modified actors will damage
+		cullingBounds = uploadedCamera.cullingBounds;
+		damageTarget = (mRenderTarget->isDamageTracking()) ? mRenderTarget : nullptr;
+
+		// Compute the pixel size of a world unit along the X axis for the window's scenes
+		if (!mProfiledPass && cullingBounds.first) {
+			const Vector2f HALF_VIEWPORT = mRenderTarget->getViewport().max / 2.f;
+			const Vector2f UNIT_AXIS(VIEW_PROJECTION.elements[0] * HALF_VIEWPORT.x, VIEW_PROJECTION.elements[1] * HALF_VIEWPORT.y);
+			pixelsPerUnit.store(UNIT_AXIS.magnitude(), std::memory_order_relaxed);
+		}
+
+		// Upload the additional views' matrices and compute their viewports, the actors being culled against the union of the views' bounds
+		mViewports.clear();
+		if (!mViews.empty()) {
+			const Vector2f FRAMEBUFFER_SIZE(mRenderTarget->getFramebufferSize());
+			mViewports.push_back(computeViewport(*camera, FRAMEBUFFER_SIZE));
+
+			const size_t VIEW_COUNT = std::min(mViews.size(), MAX_VIEW_COUNT - 1);
+			for (size_t i = 0; i < VIEW_COUNT; ++i) {
+				Camera* const view = mViews[i];
+				const Matrix4f& VIEW_MATRIX = view->getViewMatrix();
+				const Matrix4f& PROJ_MATRIX = view->getProjectionMatrix();
+				const Matrix4f VIEW_PROJ = PROJ_MATRIX * VIEW_MATRIX;
+				mTransformUBO->queueUniformUpload(mTransformOffsets[3] + static_cast<int>(i + 1) * mViewStride, VIEW_PROJ.elements.data(), sizeof(Matrix4f));
+				mViewports.push_back(computeViewport(*view, FRAMEBUFFER_SIZE));
+
+				const std::pair<bool, Box2f> VIEW_BOUNDS = computeCullingBounds(view, VIEW_MATRIX, PROJ_MATRIX);
+				cullingBounds.first = cullingBounds.first && VIEW_BOUNDS.first;
+				cullingBounds.second = Box2f(min(cullingBounds.second.min, VIEW_BOUNDS.second.min), max(cullingBounds.second.max, VIEW_BOUNDS.second.max));
+			}
+			mTransformUBO->uploadQueuedUniforms();
+		}
 	}
 
 	void Renderer2D::endScene()
 	{
+		// Record the scene's termination if the calling thread is recording
+		if (RenderCommandList* const recordingList = RenderCommandList::getRecordingList()) {
+			recordingList->recordSceneEnd(*this);
+			cullingBounds.first = false;
+			damageTarget = nullptr;
+			return;
+		}
+
 		// Check if the caller renderer isn't the active renderer (ignored in Release mode)
 		if _CONSTEXPR_IF (AEON_DEBUG) {
 			if (this != activeInstance) {
@@ -88,14 +268,55 @@ namespace ae
 			}
 		}
 
-		// Unbinds the VAO used for the drawcalls, and disables depth-testing and blending
+		// The renderers without their own termination are timed from here
+		if (mSceneEnd == Time::Zero) {
+			markSceneEnd();
+		}
+
+		// Execute the custom drawcalls now that the scene's geometry has been rendered
+		if (!mDrawcalls.empty()) {
+			AEON_PROFILE_SCOPE("Renderer2D custom drawcalls");
+			gl::setScissor(0, 0, 0, 0);
+			for (const std::function<void()>& drawcall : mDrawcalls) {
+				drawcall();
+			}
+			mDrawcalls.clear();
+		}
+
+		// Unbinds the VAO used for the drawcalls, and disables depth-testing, blending and the scissor test
 		mVAO->unbind();
-		GLCall(glDisable(GL_DEPTH_TEST));
-		GLCall(glDisable(GL_BLEND));
+		gl::setCapability(GL_DEPTH_TEST, false);
+		gl::setCapability(GL_BLEND, false);
+		gl::setScissor(0, 0, 0, 0);
+
+		// Let the target resolve or discard its contents now that the scene has been rendered (the blits are otherwise restricted by the scissor test)
+		mRenderTarget->storeContents();
+
+		// Complete the statistics with the state changes forwarded to OpenGL during the scene
+		const gl::StateCounters& counters = gl::getStateCounters();
+		mStatistics.shaderBinds = counters.programChanges - mSceneCounters.programChanges;
+		mStatistics.textureBinds = counters.textureChanges - mSceneCounters.textureChanges;
+		mStatistics.blendChanges = counters.blendChanges - mSceneCounters.blendChanges;
+		mStatistics.endSceneTime = Clock::getCurrentTime() - mSceneEnd;
+
+		// Close the render texture's GPU scope
+		if (mProfiledPass) {
+			GPUProfiler::getInstance().endScope();
+			mProfiledPass = false;
+		}
+
+		// Restore the viewport covering the entire framebuffer if the scene was split into several views
+		if (!mViewports.empty()) {
+			const Vector2i& FRAMEBUFFER_SIZE = mRenderTarget->getFramebufferSize();
+			GLCall(glViewport(0, 0, FRAMEBUFFER_SIZE.x, FRAMEBUFFER_SIZE.y));
+			mViewports.clear();
+		}
 
 		// Invalidate the pointer to the render target and to the active renderer
 		mRenderTarget = nullptr;
 		activeInstance = nullptr;
+		cullingBounds.first = false;
+		damageTarget = nullptr;
 	}
 
 	// Public static method(s)
@@ -104,12 +325,196 @@ namespace ae
 		return activeInstance;
 	}
 
+	void Renderer2D::submitToActive(const Vertex2DList& vertices, const std::vector<unsigned int>& indices, const RenderStates& states)
+	{
+		// Record the submission if the calling thread is recording
+		if (RenderCommandList* const recordingList = RenderCommandList::getRecordingList()) {
+			recordingList->record(vertices, indices, states);
+			return;
+		}
+
+		// Check if there's an active renderer (ignored in Release mode)
+		if _CONSTEXPR_IF (AEON_DEBUG) {
+			if (!activeInstance) {
+				AEON_LOG_WARNING("Invalid render submission", "A submission was made while no renderer was active.\nAborting submission.");
+				return;
+			}
+		}
+
+		activeInstance->submit(vertices, indices, states);
+	}
+
+	void Renderer2D::drawToActive(std::function<void()> drawcall)
+	{
+		// Record the drawcall if the calling thread is recording
+		if (RenderCommandList* const recordingList = RenderCommandList::getRecordingList()) {
+			recordingList->recordDrawcall(std::move(drawcall));
+			return;
+		}
+
+		// Check if there's an active renderer (ignored in Release mode)
+		if _CONSTEXPR_IF (AEON_DEBUG) {
+			if (!activeInstance) {
+				AEON_LOG_WARNING("Invalid drawcall", "A drawcall was handed over while no renderer was active.\nAborting operation.");
+				return;
+			}
+		}
+
+		activeInstance->mDrawcalls.push_back(std::move(drawcall));
+	}
+
+	const std::pair<bool, Box2f>& Renderer2D::getCullingBounds() noexcept
+	{
+		return cullingBounds;
+	}
+
+	void Renderer2D::setCullingBounds(const std::pair<bool, Box2f>& bounds) noexcept
+	{
+		cullingBounds = bounds;
+	}
+
+	RenderTarget* Renderer2D::getDamageTarget() noexcept
+	{
+		return damageTarget;
+	}
+
+	void Renderer2D::setDamageTarget(RenderTarget* target) noexcept
+	{
+		damageTarget = target;
+	}
+
+	float Renderer2D::getPixelsPerUnit() noexcept
+	{
+		return pixelsPerUnit.load(std::memory_order_relaxed);
+	}
+
+	Time Renderer2D::getSceneTime() noexcept
+	{
+		return Clock::getCurrentTime() - clockStart;
+	}
+
+	void Renderer2D::invalidateUploadedCamera() noexcept
+	{
+		uploadedCamera.camera = nullptr;
+	}
+
 	// Protected constructor(s)
 	Renderer2D::Renderer2D()
 		: mWhiteTexture(GLResourceFactory::getInstance().get<Texture2D>("_AEON_WhiteTexture"))
 		, mVAO(GLResourceFactory::getInstance().get<VertexArray>("_AEON_VAO"))
 		, mRenderTarget(nullptr)
+		, mStatistics()
 		, mTransformUBO(GLResourceFactory::getInstance().get<UniformBuffer>("_AEON_TransformUBO"))
+		, mTransformOffsets{ mTransformUBO->getUniformOffset("view"), mTransformUBO->getUniformOffset("projection"), mTransformUBO->getUniformOffset("viewProjection"),
+		                     mTransformUBO->getUniformOffset("viewProjections[0]"), mTransformUBO->getUniformOffset("viewOffset"),
+		                     mTransformUBO->getUniformOffset("time") }
+		, mViewStride(mTransformUBO->getUniformArrayStride("viewProjections[0]"))
+		, mViews()
+		, mViewports()
+		, mSceneCounters()
+		, mProfiledPass(false)
+		, mCameraSnapshot(false, std::make_pair(Matrix4f::identity(), Matrix4f::identity()))
+		, mDrawcalls()
+		, mSceneStart()
+		, mSceneEnd()
+	{
+	}
+
+	// Protected method(s)
+	bool Renderer2D::isRecording() noexcept
+	{
+		return RenderCommandList::getRecordingList() != nullptr;
+	}
+
+	void Renderer2D::recordDrawCall(size_t vertexCount, size_t indexCount, size_t uploadedBytes) noexcept
+	{
+		++mStatistics.drawCalls;
+		mStatistics.vertexCount += vertexCount;
+		mStatistics.indexCount += indexCount;
+		mStatistics.uploadedBytes += uploadedBytes;
+	}
+
+	void Renderer2D::markSceneEnd() noexcept
+	{
+		mSceneEnd = Clock::getCurrentTime();
+		mStatistics.submitTime = mSceneEnd - mSceneStart;
+	}
+
+	void Renderer2D::applyViewports() const
+	{
+		if (!mViewports.empty()) {
+			GLCall(glViewportArrayv(0, static_cast<GLsizei>(mViewports.size()), mViewports.front().data()));
+		}
+	}
+
+	void Renderer2D::drawToViews(const std::function<void(int)>& drawcall)
+	{
+		// All of the views are drawn at once if the vertex shaders select the viewports themselves
+		const int INSTANCE_COUNT = getViewInstanceCount();
+		if (mViewports.empty() || INSTANCE_COUNT > 1) {
+			drawcall(INSTANCE_COUNT);
+			return;
+		}
+
+		// Otherwise, repeat the drawcall for each view, selected through the view offset and drawn into the first viewport
+		for (size_t i = 0; i < mViewports.size(); ++i) {
+			const int VIEW_OFFSET = static_cast<int>(i);
+			mTransformUBO->queueUniformUpload(mTransformOffsets[4], &VIEW_OFFSET, sizeof(int));
+			mTransformUBO->uploadQueuedUniforms();
+			GLCall(glViewportIndexedfv(0, mViewports[i].data()));
+			drawcall(1);
+		}
+
+		// Restore the first view
+		const int FIRST_VIEW = 0;
+		mTransformUBO->queueUniformUpload(mTransformOffsets[4], &FIRST_VIEW, sizeof(int));
+		mTransformUBO->uploadQueuedUniforms();
+		GLCall(glViewportIndexedfv(0, mViewports.front().data()));
+	}
+
+	int Renderer2D::getViewInstanceCount() const noexcept
 	{
+		return (GLEW_ARB_shader_viewport_layer_array && !mViewports.empty()) ? static_cast<int>(mViewports.size()) : 1;
+	}
+
+	bool Renderer2D::isTransparent(const Vertex2DList& vertices, const RenderStates& states) const noexcept
+	{
+		// Use the hint provided by the submitter
+		if (states.transparency != RenderStates::Transparency::Auto) {
+			return states.transparency == RenderStates::Transparency::Transparent;
+		}
+
+		// Geometry rendered without blending replaces the destination
+		if (states.blendMode == BlendMode::BlendNone) {
+			return false;
+		}
+
+		// Check the texture's alpha coverage then each vertex's opacity
+		if (states.texture && !states.texture->isOpaque()) {
+			return true;
+		}
+		for (const Vertex2D& vertex : vertices) {
+			if (vertex.color.w < 1.f) {
+				return true;
+			}
+		}
+
+		return false;
+	}
+
+	void Renderer2D::bindTexture(const Texture* texture, const Sampler* sampler, unsigned int unit) const
+	{
+		((texture) ? texture : mWhiteTexture.get())->bind(static_cast<int>(unit));
+		gl::bindSampler(unit, (sampler) ? sampler->getHandle() : 0);
+	}
+
+	void Renderer2D::applyBlendMode(const BlendMode& blendMode) const
+	{
+		gl::setCapability(GL_BLEND, blendMode != BlendMode::BlendNone);
+		if (blendMode != BlendMode::BlendNone) {
+			gl::setBlendFunction(static_cast<GLenum>(blendMode.colorEquation), static_cast<GLenum>(blendMode.alphaEquation),
+			                     static_cast<GLenum>(blendMode.colorSrcFactor), static_cast<GLenum>(blendMode.colorDstFactor),
+			                     static_cast<GLenum>(blendMode.alphaSrcFactor), static_cast<GLenum>(blendMode.alphaDstFactor));
+		}
 	}
 }
\ No newline at end of file
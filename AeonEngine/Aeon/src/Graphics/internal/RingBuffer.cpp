@@ -0,0 +1,191 @@
+// MIT License
+// 
+// Copyright(c) 2019-2021 Filippos Gleglakos
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <AEON/Graphics/internal/RingBuffer.h>
+
+#include <GL/glew.h>
+
+#include <AEON/Graphics/internal/Buffer.h>
+#include <AEON/Graphics/internal/GLCommon.h>
+
+namespace ae
+{
+	// Public constructor(s)
+	RingBuffer::RingBuffer() noexcept
+		: mFences()
+		, mData(nullptr)
+		, mRegionSize(0)
+		, mHead(0)
+		, mRegion(0)
+	{
+	}
+
+	RingBuffer::RingBuffer(RingBuffer&& rvalue) noexcept
+		: mFences(std::move(rvalue.mFences))
+		, mData(rvalue.mData)
+		, mRegionSize(rvalue.mRegionSize)
+		, mHead(rvalue.mHead)
+		, mRegion(rvalue.mRegion)
+	{
+		rvalue.mFences.clear();
+		rvalue.mData = nullptr;
+	}
+
+	// Public operator(s)
+	RingBuffer& RingBuffer::operator=(RingBuffer&& rvalue) noexcept
+	{
+		// Release the caller's fences before taking over the rvalue's regions (the data store is unmapped alongside its ae::Buffer)
+		if (this == &rvalue) {
+			return *this;
+		}
+		destroy();
+
+		// Copy the rvalue's trivial data and move the rest
+		mFences = std::move(rvalue.mFences);
+		mData = rvalue.mData;
+		mRegionSize = rvalue.mRegionSize;
+		mHead = rvalue.mHead;
+		mRegion = rvalue.mRegion;
+
+		rvalue.mFences.clear();
+		rvalue.mData = nullptr;
+
+		return *this;
+	}
+
+	// Public method(s)
+	bool RingBuffer::create(const Buffer& buffer, int regionSize, unsigned int regionCount)
+	{
+		// Check if the ring has already been created (ignored in Release mode)
+		if _CONSTEXPR_IF (AEON_DEBUG) {
+			if (mData) {
+				AEON_LOG_ERROR("Failed to create ring buffer", "The ring buffer has already been created.\nAborting operation.");
+				return false;
+			}
+			if (regionSize <= 0 || regionCount == 0) {
+				AEON_LOG_ERROR("Failed to create ring buffer", "The region size and the region count must be greater than 0.\nAborting operation.");
+				return false;
+			}
+		}
+
+		// Create the immutable data store and map it persistently
+		const GLbitfield FLAGS = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+		const int TOTAL_SIZE = regionSize * static_cast<int>(regionCount);
+		buffer.setStorage(TOTAL_SIZE, nullptr, FLAGS);
+		mData = static_cast<uint8_t*>(buffer.mapRange(0, TOTAL_SIZE, FLAGS));
+		if (!mData) {
+			AEON_LOG_ERROR("Failed to create ring buffer", "The buffer's data store couldn't be mapped persistently.\nAborting operation.");
+			return false;
+		}
+
+		mFences.assign(regionCount, nullptr);
+		mRegionSize = regionSize;
+		mHead = 0;
+		mRegion = 0;
+
+		return true;
+	}
+
+	void* RingBuffer::allocate(int size, int& offset, int alignment) noexcept
+	{
+		// Align the start of the memory requested (the regions' starting offsets are assumed to be aligned)
+		const int HEAD = (mHead + alignment - 1) / alignment * alignment;
+
+		// Check if the current region possesses enough space
+		if (!mData || HEAD + size > mRegionSize) {
+			return nullptr;
+		}
+
+		// Reserve the memory requested
+		offset = static_cast<int>(mRegion) * mRegionSize + HEAD;
+		mHead = HEAD + size;
+
+		return mData + offset;
+	}
+
+	void RingBuffer::lock()
+	{
+		// Nothing could be sourced from the current region if nothing was written into it
+		if (mHead == 0) {
+			return;
+		}
+
+		// Fence the current region and move on to the next one
+		mFences[mRegion] = GLCall(glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0));
+		mRegion = (mRegion + 1) % static_cast<unsigned int>(mFences.size());
+		mHead = 0;
+
+		// Make sure that OpenGL has finished reading from the next region
+		waitForFence(mFences[mRegion]);
+	}
+
+	void RingBuffer::destroy()
+	{
+		for (void*& fence : mFences) {
+			if (fence) {
+				GLCall(glDeleteSync(static_cast<GLsync>(fence)));
+				fence = nullptr;
+			}
+		}
+	}
+
+	int RingBuffer::getRegionSize() const noexcept
+	{
+		return mRegionSize;
+	}
+
+	bool RingBuffer::isCreated() const noexcept
+	{
+		return mData != nullptr;
+	}
+
+	// Private method(s)
+	void RingBuffer::waitForFence(void*& fence) const
+	{
+		// Regions that haven't been used yet aren't fenced
+		if (!fence) {
+			return;
+		}
+
+		// Poll the fence first, then flush the pending commands and wait for up to a second at a time
+		GLsync sync = static_cast<GLsync>(fence);
+		GLbitfield waitFlags = 0;
+		GLuint64 timeout = 0;
+		while (true)
+		{
+			const GLenum RESULT = GLCall(glClientWaitSync(sync, waitFlags, timeout));
+			if (RESULT == GL_ALREADY_SIGNALED || RESULT == GL_CONDITION_SATISFIED) {
+				break;
+			}
+			if (RESULT == GL_WAIT_FAILED) {
+				AEON_LOG_ERROR("Failed to wait for fence", "The ring buffer's region couldn't be synchronized.");
+				break;
+			}
+
+			waitFlags = GL_SYNC_FLUSH_COMMANDS_BIT;
+			timeout = 1'000'000'000;
+		}
+
+		GLCall(glDeleteSync(sync));
+		fence = nullptr;
+	}
+}
\ No newline at end of file
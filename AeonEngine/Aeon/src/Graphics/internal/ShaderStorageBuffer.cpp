@@ -0,0 +1,155 @@
+// MIT License
+// 
+// Copyright(c) 2019-2021 Filippos Gleglakos
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#include <AEON/Graphics/internal/ShaderStorageBuffer.h>
+
+#include <algorithm>
+
+#include <GL/glew.h>
+
+#include <AEON/Graphics/internal/GLCommon.h>
+
+namespace ae
+{
+	namespace
+	{
+		// The number of binding points reserved for the explicit bindings of the built-in renderers' shaders
+		constexpr int RESERVED_BINDING_POINTS = 4;
+
+		// Used to assign an incrementing binding point to each SSBO created
+		int storageBindingPointCounter = RESERVED_BINDING_POINTS;
+	}
+
+	// Public constructor(s)
+	ShaderStorageBuffer::ShaderStorageBuffer(bool persistent)
+		: Buffer(GL_SHADER_STORAGE_BUFFER)
+		, mMapped(nullptr)
+		, mSize(0)
+		, mBindingPoint(storageBindingPointCounter++)
+		, mPersistent(persistent)
+	{
+		// Bind the SSBO to the assigned binding point
+		GLCall(glBindBufferBase(GL_SHADER_STORAGE_BUFFER, mBindingPoint, mHandle));
+	}
+
+	ShaderStorageBuffer::ShaderStorageBuffer(ShaderStorageBuffer&& rvalue) noexcept
+		: Buffer(std::move(rvalue))
+		, mMapped(rvalue.mMapped)
+		, mSize(rvalue.mSize)
+		, mBindingPoint(rvalue.mBindingPoint)
+		, mPersistent(rvalue.mPersistent)
+	{
+		rvalue.mMapped = nullptr;
+	}
+
+	// Public operator(s)
+	ShaderStorageBuffer& ShaderStorageBuffer::operator=(ShaderStorageBuffer&& rvalue) noexcept
+	{
+		// Copy the rvalue's trivial data and move the rest
+		Buffer::operator=(std::move(rvalue));
+		mMapped = rvalue.mMapped;
+		mSize = rvalue.mSize;
+		mBindingPoint = rvalue.mBindingPoint;
+		mPersistent = rvalue.mPersistent;
+		rvalue.mMapped = nullptr;
+
+		return *this;
+	}
+
+	// Public method(s)
+	void ShaderStorageBuffer::resize(int size)
+	{
+		// Check that the size provided is valid (ignored in Release mode)
+		if _CONSTEXPR_IF (AEON_DEBUG) {
+			if (size <= 0) {
+				AEON_LOG_ERROR("Invalid storage size", "The size of the shader storage buffer's data store must be positive.\nAborting operation.");
+				return;
+			}
+		}
+
+		// Create the new immutable data store (it can still be modified through setSubData())
+		GLuint handle = 0;
+		GLCall(glCreateBuffers(1, &handle));
+
+		GLbitfield flags = GL_DYNAMIC_STORAGE_BIT;
+		if (mPersistent) {
+			flags |= GL_MAP_READ_BIT | GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+		}
+		GLCall(glNamedBufferStorage(handle, size, nullptr, flags));
+
+		// Copy the previous contents on the GPU and delete the previous data store (OpenGL keeps it alive until the commands using it have completed)
+		if (mSize > 0) {
+			GLCall(glCopyNamedBufferSubData(mHandle, handle, 0, 0, std::min(mSize, size)));
+		}
+		GLCall(glDeleteBuffers(1, &mHandle));
+		mHandle = handle;
+		mSize = size;
+		mStorageSize = static_cast<size_t>(size);
+
+		// Map the new data store and bind it to the assigned binding point
+		if (mPersistent) {
+			mMapped = GLCall(glMapNamedBufferRange(mHandle, 0, size, flags & ~GL_DYNAMIC_STORAGE_BIT));
+		}
+		GLCall(glBindBufferBase(GL_SHADER_STORAGE_BUFFER, mBindingPoint, mHandle));
+	}
+
+	void ShaderStorageBuffer::setData(int size, const void* data)
+	{
+		// Grow the data store geometrically so that a steadily-growing number of elements doesn't reallocate it every time
+		if (size > mSize) {
+			resize(std::max(size, mSize * 2));
+		}
+
+		if (size > 0) {
+			setSubData(0, size, data);
+		}
+	}
+
+	void ShaderStorageBuffer::setSubData(int offset, int size, const void* data) const
+	{
+		// Check that the range is contained within the data store (ignored in Release mode)
+		if _CONSTEXPR_IF (AEON_DEBUG) {
+			if (offset < 0 || offset + size > mSize) {
+				AEON_LOG_ERROR("Invalid storage range", "The range provided exceeds the shader storage buffer's data store.\nAborting operation.");
+				return;
+			}
+		}
+
+		GLCall(glNamedBufferSubData(mHandle, offset, size, data));
+	}
+
+	void* ShaderStorageBuffer::getMappedData() const noexcept
+	{
+		return mMapped;
+	}
+
+	int ShaderStorageBuffer::getSize() const noexcept
+	{
+		return mSize;
+	}
+
+	int ShaderStorageBuffer::getBindingPoint() const noexcept
+	{
+		return mBindingPoint;
+	}
+}
\ No newline at end of file
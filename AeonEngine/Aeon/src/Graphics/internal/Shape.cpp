@@ -22,12 +22,56 @@
 
 #include <AEON/Graphics/internal/Shape.h>
 
+#include <mutex>
+#include <utility>
+#include <unordered_map>
+
 #include <AEON/Graphics/internal/Renderer2D.h>
 #include <AEON/Graphics/GLResourceFactory.h>
 #include <AEON/Graphics/Texture2D.h>
 
 namespace ae
 {
+	namespace
+	{
+		// The bounds of the number of segments per full turn selected by the automatic level of detail
+		constexpr size_t MIN_LOD_SEGMENTS = 8;
+		constexpr size_t MAX_LOD_SEGMENTS = 512;
+
+		// The factor by which the on-screen radius must change before a new point count is selected
+		constexpr float LOD_HYSTERESIS = 1.25f;
+
+		// The internal struct containing the geometry tables shared by all shapes, indexed by their point count
+		struct GeometryCache
+		{
+			std::mutex                                                                   mutex;      //!< The mutex protecting the tables as shapes may be updated by several threads
+			std::unordered_map<size_t, std::shared_ptr<const std::vector<Vector2f>>>     circles;    //!< The points of the unit circles
+			std::unordered_map<size_t, std::shared_ptr<const std::vector<Vector2f>>>     cornerArcs; //!< The points of the unit quarter circles
+			std::unordered_map<size_t, std::shared_ptr<const std::vector<unsigned int>>> fanIndices; //!< The triangle fan indices
+		};
+
+		GeometryCache& getGeometryCache()
+		{
+			static GeometryCache cache;
+			return cache;
+		}
+
+		// Retrieves the table of the point count provided, generating it with the functor provided if it doesn't exist yet
+		template <typename T, typename Generator>
+		std::shared_ptr<const std::vector<T>> getTable(std::unordered_map<size_t, std::shared_ptr<const std::vector<T>>>& tables, size_t pointCount, Generator generator)
+		{
+			std::lock_guard<std::mutex> lock(getGeometryCache().mutex);
+			std::shared_ptr<const std::vector<T>>& table = tables[pointCount];
+			if (!table) {
+				auto generated = std::make_shared<std::vector<T>>();
+				generator(*generated);
+				table = std::move(generated);
+			}
+
+			return table;
+		}
+	}
+
 	// Public constructor(s)
 	Shape::~Shape()
 	{
@@ -36,6 +80,12 @@ namespace ae
 	// Public method(s)
 	void Shape::setTexture(const Texture2D* const texture, bool resetRect)
 	{
+		// Merge the fill with the outline or split them if the shape becomes textured/untextured
+		if (!mTexture != !texture) {
+			mUpdateMergedFill = true;
+			wake();
+		}
+
 		// Assign the new texture
 		mTexture = texture;
 
@@ -46,6 +96,7 @@ namespace ae
 			}
 			else {
 				mUpdateUVs = true;
+				wake();
 			}
 		}
 	}
@@ -62,24 +113,35 @@ namespace ae
 		// Set the new texture and indicate that the uv coordinates need to be updated
 		mTextureRect = rect;
 		mUpdateUVs = true;
+		wake();
 	}
 
 	void Shape::setFillColor(const Color& color) noexcept
 	{
 		mFillColor = color;
 		mUpdateFillColors = true;
+		wake();
 	}
 
 	void Shape::setOutlineColor(const Color& color) noexcept
 	{
 		mOutlineColor = color;
 		mUpdateOutlineColors = true;
+		wake();
 	}
 
 	void Shape::setOutlineThickness(float thickness) noexcept
 	{
 		mOutlineThickness = thickness;
 		mUpdateOutlinePositions = true;
+		wake();
+	}
+
+	void Shape::setLevelOfDetail(float maxError) noexcept
+	{
+		mLodError = Math::max(maxError, 0.f);
+		mLodRadius = 0.f;
+		wake();
 	}
 
 	const Texture2D* const Shape::getTexture() const noexcept
@@ -107,29 +169,48 @@ namespace ae
 		return mOutlineThickness;
 	}
 
+	float Shape::getLevelOfDetail() const noexcept
+	{
+		return mLodError;
+	}
+
 	// Public virtual method(s)
 	Box2f Shape::getModelBounds() const
 	{
 		return mModelBounds;
 	}
 
+	void Shape::getPoints(Vector2f* points) const
+	{
+		const size_t COUNT = getPointCount();
+		for (size_t i = 0; i < COUNT; ++i) {
+			points[i] = getPoint(i);
+		}
+	}
+
 	// Protected constructor(s)
 	Shape::Shape()
 		: Actor2D()
 		, mModelBounds(0.f, 0.f, 0.f, 0.f)
 		, mUpdatePositions(true)
-		, mOutlineVertices()
+		, mOutlineVertices(getGeometryResource())
 		, mOutlineIndices()
+		, mOutlineNormals()
 		, mInnerBounds(0.f, 0.f, 0.f, 0.f)
 		, mTextureRect(0.f, 0.f, 0.f, 0.f)
 		, mFillColor(Color::White)
 		, mOutlineColor(Color::White)
 		, mTexture(nullptr)
+		, mShader(nullptr)
 		, mOutlineThickness(0.f)
+		, mLodError(0.f)
+		, mLodRadius(0.f)
 		, mUpdateUVs(true)
 		, mUpdateFillColors(true)
+		, mUpdateOutlineNormals(true)
 		, mUpdateOutlinePositions(true)
 		, mUpdateOutlineColors(true)
+		, mUpdateMergedFill(true)
 	{
 	}
 
@@ -139,16 +220,22 @@ namespace ae
 		, mUpdatePositions(rvalue.mUpdatePositions)
 		, mOutlineVertices(std::move(rvalue.mOutlineVertices))
 		, mOutlineIndices(std::move(rvalue.mOutlineIndices))
+		, mOutlineNormals(std::move(rvalue.mOutlineNormals))
 		, mInnerBounds(std::move(rvalue.mInnerBounds))
 		, mTextureRect(std::move(rvalue.mTextureRect))
 		, mFillColor(std::move(rvalue.mFillColor))
 		, mOutlineColor(std::move(rvalue.mOutlineColor))
 		, mTexture(rvalue.mTexture)
+		, mShader(std::move(rvalue.mShader))
 		, mOutlineThickness(rvalue.mOutlineThickness)
+		, mLodError(rvalue.mLodError)
+		, mLodRadius(rvalue.mLodRadius)
 		, mUpdateUVs(rvalue.mUpdateUVs)
 		, mUpdateFillColors(rvalue.mUpdateFillColors)
+		, mUpdateOutlineNormals(rvalue.mUpdateOutlineNormals)
 		, mUpdateOutlinePositions(rvalue.mUpdateOutlinePositions)
 		, mUpdateOutlineColors(rvalue.mUpdateOutlineColors)
+		, mUpdateMergedFill(rvalue.mUpdateMergedFill)
 	{
 	}
 
@@ -161,28 +248,112 @@ namespace ae
 		mUpdatePositions = rvalue.mUpdatePositions;
 		mOutlineVertices = std::move(rvalue.mOutlineVertices);
 		mOutlineIndices = std::move(rvalue.mOutlineIndices);
+		mOutlineNormals = std::move(rvalue.mOutlineNormals);
 		mInnerBounds = std::move(rvalue.mInnerBounds);
 		mTextureRect = std::move(rvalue.mTextureRect);
 		mFillColor = std::move(rvalue.mFillColor);
 		mOutlineColor = std::move(rvalue.mOutlineColor);
 		mTexture = rvalue.mTexture;
+		mShader = std::move(rvalue.mShader);
 		mOutlineThickness = rvalue.mOutlineThickness;
+		mLodError = rvalue.mLodError;
+		mLodRadius = rvalue.mLodRadius;
 		mUpdateUVs = rvalue.mUpdateUVs;
 		mUpdateFillColors = rvalue.mUpdateFillColors;
+		mUpdateOutlineNormals = rvalue.mUpdateOutlineNormals;
 		mUpdateOutlinePositions = rvalue.mUpdateOutlinePositions;
 		mUpdateOutlineColors = rvalue.mUpdateOutlineColors;
+		mUpdateMergedFill = rvalue.mUpdateMergedFill;
 
 		return *this;
 	}
 
+	// Protected static method(s)
+	std::shared_ptr<const std::vector<Vector2f>> Shape::getUnitCircle(size_t pointCount)
+	{
+		return getTable(getGeometryCache().circles, pointCount, [pointCount](std::vector<Vector2f>& points) {
+			points.resize(pointCount);
+			for (size_t i = 0; i < pointCount; ++i) {
+				const float ANGLE = i * 2.f * Math::PI / pointCount - Math::PI / 2.f;
+				Math::Fast::sincos(ANGLE, points[i].y, points[i].x);
+			}
+		});
+	}
+
+	std::shared_ptr<const std::vector<Vector2f>> Shape::getUnitCornerArc(size_t pointCount)
+	{
+		return getTable(getGeometryCache().cornerArcs, pointCount, [pointCount](std::vector<Vector2f>& points) {
+			const float DELTA_ANGLE = 90.f / (Math::max(static_cast<int>(pointCount) - 1, 1));
+			points.resize(pointCount);
+			for (size_t i = 0; i < pointCount; ++i) {
+				Math::Fast::sincos(Math::toRadians(DELTA_ANGLE * i), points[i].y, points[i].x);
+			}
+		});
+	}
+
+	// Protected virtual method(s)
+	float Shape::getCurveRadius() const noexcept
+	{
+		return 0.f;
+	}
+
+	void Shape::applySegmentCount(size_t)
+	{
+	}
+
+	// Private static method(s)
+	std::shared_ptr<const std::vector<unsigned int>> Shape::getFanIndices(size_t pointCount)
+	{
+		return getTable(getGeometryCache().fanIndices, pointCount, [pointCount](std::vector<unsigned int>& indices) {
+			indices.reserve(pointCount * 3);
+			for (size_t i = 1; i <= pointCount; ++i) {
+				indices.emplace_back(0);
+				indices.emplace_back(static_cast<unsigned int>(i));
+				indices.emplace_back(static_cast<unsigned int>((i == pointCount) ? 1 : i + 1));
+			}
+		});
+	}
+
 	// Private method(s)
+	void Shape::updateLevelOfDetail()
+	{
+		// The pixel size of a world unit is only known once a scene has been rendered onto the window
+		const float PIXELS_PER_UNIT = Renderer2D::getPixelsPerUnit();
+		if (PIXELS_PER_UNIT <= 0.f) {
+			return;
+		}
+
+		// Project the curves' radius onto the screen by taking into account the global scale
+		const Matrix4f& TRANSFORM = getGlobalTransform();
+		const float SCALE = Math::max(Vector2f(TRANSFORM.elements[0], TRANSFORM.elements[1]).magnitude(),
+		                              Vector2f(TRANSFORM.elements[4], TRANSFORM.elements[5]).magnitude());
+		const float RADIUS = getCurveRadius() * SCALE * PIXELS_PER_UNIT;
+		if (RADIUS <= 0.f) {
+			return;
+		}
+
+		// Keep the current point count while the radius remains within the hysteresis band
+		if (mLodRadius > 0.f && RADIUS * LOD_HYSTERESIS > mLodRadius && RADIUS < mLodRadius * LOD_HYSTERESIS) {
+			return;
+		}
+		mLodRadius = RADIUS;
+
+		// Select the number of segments whose sagitta (r * (1 - cos(pi / n))) doesn't exceed the maximum error
+		size_t segmentCount = MIN_LOD_SEGMENTS;
+		if (mLodError < RADIUS) {
+			const float SEGMENTS = Math::PI / std::acos(1.f - mLodError / RADIUS);
+			segmentCount = static_cast<size_t>(Math::clamp(std::ceil(SEGMENTS), static_cast<float>(MIN_LOD_SEGMENTS), static_cast<float>(MAX_LOD_SEGMENTS)));
+		}
+		applySegmentCount(segmentCount);
+	}
+
 	void Shape::updatePositions()
 	{
 		// Retrieve the total number of points and raise the flags indicating that uv coordinates and colors need to
 		const size_t COUNT = getPointCount();
 
 		// Raise the flags indicating that uv coordinates and colors will need to be updated if the point count is different
-		std::vector<Vertex2D>& vertices = getVertices();
+		Vertex2DList& vertices = getVertices();
 		if (COUNT != vertices.size() + 1) {
 			mUpdateUVs = true;
 			mUpdateFillColors = true;
@@ -193,8 +364,12 @@ namespace ae
 		vertices.resize(COUNT + 1); // + 1 for the center point
 
 			// Update the vertex positions
+		thread_local std::vector<Vector2f> points;
+		points.resize(COUNT);
+		getPoints(points.data());
+		const float DEPTH = static_cast<float>(getDepth());
 		for (size_t i = 0; i < COUNT; ++i) {
-			vertices[i + 1].position = Vector3f(getPoint(i), getPosition().z);
+			vertices[i + 1].position = Vector3f(points[i], DEPTH);
 		}
 
 			// Update the inner bounding box
@@ -205,26 +380,15 @@ namespace ae
 		}
 		mInnerBounds = Box2f(minPos, maxPos - minPos);
 		mModelBounds = mInnerBounds;
+		invalidateBounds();
 
 			// Compute the center for the first vertex
-		vertices[0].position = Vector3f(mInnerBounds.min + mInnerBounds.max / 2.f, getPosition().z);
-
-		// Update indices (if necessary)
-		const size_t INDEX_COUNT = vertices.size() * 2 + 2;
-		std::vector<unsigned int>& indices = getIndices();
-		if (indices.size() != INDEX_COUNT) {
-			indices.clear();
-			indices.reserve(INDEX_COUNT);
-
-			// Add the indices
-			for (size_t i = 1; i < vertices.size(); ++i) {
-				size_t next = (i + 1) % vertices.size();
-				next = (next == 0) ? 1 : next;
+		vertices[0].position = Vector3f(mInnerBounds.min + mInnerBounds.max / 2.f, DEPTH);
 
-				indices.emplace_back(0);
-				indices.emplace_back(i);
-				indices.emplace_back(next);
-			}
+		// Reference the triangle fan indices shared by the shapes of the same point count (if necessary)
+		const Renderable2D& renderable = *this;
+		if (renderable.getIndices().size() != COUNT * 3) {
+			setSharedIndices(getFanIndices(COUNT));
 		}
 	}
 
@@ -234,7 +398,7 @@ namespace ae
 		const bool DIVISIBLEY = mInnerBounds.max.y > 0.f;
 		const Vector2f TEXTURE_SIZE = (mTexture) ? Vector2f(mTexture->getSize()) : Vector2f(1.f, 1.f);
 
-		std::vector<Vertex2D>& vertices = getVertices();
+		Vertex2DList& vertices = getVertices();
 		for (Vertex2D& vertex : vertices) {
 			Vector2f ratio((DIVISIBLEX) ? (vertex.position.x - mInnerBounds.min.x) / mInnerBounds.max.x : 0.f,
 			               (DIVISIBLEY) ? (vertex.position.y - mInnerBounds.min.y) / mInnerBounds.max.y : 0.f);
@@ -245,7 +409,7 @@ namespace ae
 	void Shape::updateFillColors()
 	{
 		const Vector4f FILL_COLOR = mFillColor.normalize();
-		std::vector<Vertex2D>& vertices = getVertices();
+		Vertex2DList& vertices = getVertices();
 		for (Vertex2D& vertex : vertices) {
 			vertex.color = FILL_COLOR;
 		}
@@ -253,33 +417,39 @@ namespace ae
 
 	void Shape::updateShape()
 	{
-		// Updates the vertices' properties
+		// Updates the vertices' properties (the copy merged with the outline will need to be updated as well)
 		if (mUpdatePositions) {
 			updatePositions();
-			mUpdateOutlinePositions = true;
+			mUpdateOutlineNormals = true;
+			mUpdateMergedFill = true;
 			correctProperties();
 			setDirty(std::exchange(mUpdatePositions, false));
 		}
 		if (mUpdateUVs) {
 			updateUVs();
+			mUpdateMergedFill = true;
 			setDirty(std::exchange(mUpdateUVs, false));
 		}
 		if (mUpdateFillColors) {
 			updateFillColors();
+			mUpdateMergedFill = true;
 			setDirty(std::exchange(mUpdateFillColors, false));
 		}
+
+		// The shapes of identical size, texture rect and colors share their fill's vertices
+		shareVertices();
 	}
 
-	void Shape::updateOutlinePositions()
+	void Shape::updateOutlineNormals()
 	{
-		// Update the outline vertices
-		const std::vector<Vertex2D>& vertices = getVertices();
-		const size_t VERTEX_COUNT = vertices.size() - 1;
-		mOutlineVertices.resize(VERTEX_COUNT * 2);
-		for (size_t i = 0; i < VERTEX_COUNT; ++i) {
+		// Compute the extrusion direction of each point
+		const Vertex2DList& vertices = std::as_const(*this).getVertices();
+		const size_t POINT_COUNT = vertices.size() - 1;
+		mOutlineNormals.resize(POINT_COUNT);
+		for (size_t i = 0; i < POINT_COUNT; ++i) {
 			size_t index = i + 1;
-			size_t prev = (i == 0) ? VERTEX_COUNT : index - 1;
-			size_t next = (i + 1 == VERTEX_COUNT) ? 1 : index + 1;
+			size_t prev = (i == 0) ? POINT_COUNT : index - 1;
+			size_t next = (i + 1 == POINT_COUNT) ? 1 : index + 1;
 
 			// Get the two segments shared by the current point
 			Vector2f p0 = vertices[prev].position.xy;
@@ -300,58 +470,95 @@ namespace ae
 
 			// Combine them to get the extrusion direction
 			float factor = 1.f + (n1.x * n2.x + n1.y * n2.y);
-			Vector2f normal = (n1 + n2) / factor;
-
-			// Update the outline vertices
-			mOutlineVertices[i * 2 + 0].position = Vector3f(p1, getPosition().z);
-			mOutlineVertices[i * 2 + 1].position = Vector3f(p1 + normal * mOutlineThickness, getPosition().z);
+			mOutlineNormals[i] = (n1 + n2) / factor;
 		}
+	}
 
-		// Update the model bounding box by taking into account the outline
-		Vector2f minPos = mOutlineVertices[0].position.xy, maxPos = mOutlineVertices[0].position.xy;
-		for (const Vertex2D& vertex : mOutlineVertices) {
-			minPos = min(minPos, vertex.position.xy);
-			maxPos = max(maxPos, vertex.position.xy);
+	void Shape::updateOutlineIndices(bool merged)
+	{
+		const size_t POINT_COUNT = mOutlineNormals.size();
+		const size_t RING_COUNT = POINT_COUNT * 2;
+		mOutlineIndices.clear();
+		mOutlineIndices.reserve(RING_COUNT * 3 + ((merged) ? POINT_COUNT * 3 : 0));
+
+		// Add in the outline's indices
+		for (size_t i = 0; i < RING_COUNT; i += 2) {
+			const size_t NEXT = (i + 1) % RING_COUNT;
+			const size_t NEXT2 = (i + 2) % RING_COUNT;
+			const size_t NEXT3 = (i + 3) % RING_COUNT;
+
+			mOutlineIndices.emplace_back(i);
+			mOutlineIndices.emplace_back(NEXT);
+			mOutlineIndices.emplace_back(NEXT2);
+
+			mOutlineIndices.emplace_back(NEXT);
+			mOutlineIndices.emplace_back(NEXT3);
+			mOutlineIndices.emplace_back(NEXT2);
 		}
-		mModelBounds = Box2f(minPos, maxPos - minPos);
 
-		// Update the indices (if necessary)
-		const size_t INDEX_COUNT = VERTEX_COUNT * 2;
-		if (mOutlineIndices.size() != INDEX_COUNT) {
-			mOutlineIndices.clear();
-			mOutlineIndices.reserve(INDEX_COUNT * 6);
-
-			// Add in indices
-			for (size_t i = 0; i < INDEX_COUNT; i += 2) {
-				const size_t NEXT = (i + 1) % INDEX_COUNT;
-				const size_t NEXT2 = (i + 2) % INDEX_COUNT;
-				const size_t NEXT3 = (i + 3) % INDEX_COUNT;
-
-				mOutlineIndices.emplace_back(i);
-				mOutlineIndices.emplace_back(NEXT);
-				mOutlineIndices.emplace_back(NEXT2);
-
-				mOutlineIndices.emplace_back(NEXT);
-				mOutlineIndices.emplace_back(NEXT3);
-				mOutlineIndices.emplace_back(NEXT2);
+		// Add in the fill's triangle fan indices, offset by the outline's vertices
+		if (merged) {
+			for (const unsigned int INDEX : *getFanIndices(POINT_COUNT)) {
+				mOutlineIndices.emplace_back(static_cast<unsigned int>(INDEX + RING_COUNT));
 			}
 		}
+	}
 
-		// Indicate that the outline colors need to be updated as well
-		mUpdateOutlineColors = true;
+	void Shape::updateOutlinePositions()
+	{
+		// Scale the extrusion directions by the outline thickness
+		const Vertex2DList& vertices = std::as_const(*this).getVertices();
+		const size_t POINT_COUNT = mOutlineNormals.size();
+		const float DEPTH = static_cast<float>(getDepth());
+		for (size_t i = 0; i < POINT_COUNT; ++i) {
+			const Vector2f& POSITION = vertices[i + 1].position.xy;
+			mOutlineVertices[i * 2 + 0].position = Vector3f(POSITION, DEPTH);
+			mOutlineVertices[i * 2 + 1].position = Vector3f(POSITION + mOutlineNormals[i] * mOutlineThickness, DEPTH);
+		}
+
+		// Update the model bounding box by taking into account the outline
+		Vector2f minPos = mOutlineVertices[0].position.xy, maxPos = mOutlineVertices[0].position.xy;
+		for (size_t i = 0; i < POINT_COUNT * 2; ++i) {
+			minPos = min(minPos, mOutlineVertices[i].position.xy);
+			maxPos = max(maxPos, mOutlineVertices[i].position.xy);
+		}
+		mModelBounds = Box2f(minPos, maxPos - minPos);
+		invalidateBounds();
 	}
 
 	void Shape::updateOutlineColors()
 	{
 		const Vector4f OUTLINE_COLOR = mOutlineColor.normalize();
-		for (Vertex2D& vertex : mOutlineVertices) {
-			vertex.color = OUTLINE_COLOR;
+		const size_t RING_COUNT = mOutlineNormals.size() * 2;
+		for (size_t i = 0; i < RING_COUNT; ++i) {
+			mOutlineVertices[i].color = OUTLINE_COLOR;
 		}
 	}
 
 	void Shape::updateOutline()
 	{
-		// Update the outline's vertices' properties
+		// Resize the outline's vertices if the point count has changed or if the fill is merged with/split from the outline
+		const bool MERGED = !mTexture;
+		const size_t POINT_COUNT = std::as_const(*this).getVertices().size() - 1;
+		const size_t VERTEX_COUNT = POINT_COUNT * 2 + ((MERGED) ? POINT_COUNT + 1 : 0);
+		if (mOutlineVertices.size() != VERTEX_COUNT || mOutlineNormals.size() != POINT_COUNT) {
+			mOutlineVertices.resize(VERTEX_COUNT);
+			if (mOutlineNormals.size() != POINT_COUNT) {
+				updateOutlineNormals();
+				mUpdateOutlineNormals = false;
+			}
+			updateOutlineIndices(MERGED);
+			mUpdateOutlinePositions = true;
+			mUpdateOutlineColors = true;
+			mUpdateMergedFill = true;
+		}
+
+		// Update the outline's vertices' properties, the indices are left untouched
+		if (mUpdateOutlineNormals) {
+			updateOutlineNormals();
+			mUpdateOutlinePositions = true;
+			mUpdateOutlineNormals = false;
+		}
 		if (mUpdateOutlinePositions) {
 			updateOutlinePositions();
 			correctProperties();
@@ -361,11 +568,25 @@ namespace ae
 			updateOutlineColors();
 			setDirty(std::exchange(mUpdateOutlineColors, false));
 		}
+
+		// Copy the fill's vertices after the outline's so that the shape is submitted only once
+		if (mUpdateMergedFill) {
+			if (MERGED) {
+				const Vertex2DList& vertices = std::as_const(*this).getVertices();
+				std::copy(vertices.begin(), vertices.end(), mOutlineVertices.begin() + POINT_COUNT * 2);
+			}
+			setDirty(std::exchange(mUpdateMergedFill, false));
+		}
 	}
 
 	// Private virtual method(s)
 	void Shape::updateSelf(const Time& dt)
 	{
+		// Select the point count from the on-screen size (if requested)
+		if (mLodError > 0.f) {
+			updateLevelOfDetail();
+		}
+
 		// Update the shape's properties which may raise the dirty render flag
 		updateShape();
 
@@ -375,32 +596,61 @@ namespace ae
 		}
 	}
 
-	void Shape::renderSelf(RenderStates states) const
+	bool Shape::hasPendingUpdate() const
+	{
+		// The outline's flags are only processed if there is an outline
+		const bool OUTLINE_PENDING = (mOutlineThickness != 0.f) && (mUpdateOutlineNormals || mUpdateOutlinePositions || mUpdateOutlineColors || mUpdateMergedFill);
+		// The shapes with an automatic level of detail follow the camera's zoom every frame
+		return mUpdatePositions || mUpdateUVs || mUpdateFillColors || OUTLINE_PENDING || mLodError > 0.f;
+	}
+
+	void Shape::onDepthModified()
+	{
+		// The outline's positions are rebuilt alongside the fill's
+		mUpdatePositions = true;
+		wake();
+	}
+
+	void Shape::renderSelf(const RenderStates& nodeStates) const
 	{
 		if (!getVertices().empty())
 		{
-			// Setup the render states used by both the outline and the shape
+			// Setup the render states used by both the outline and the shape (on a copy as the node's states are shared with the rest of the traversal)
+			RenderStates states(nodeStates);
 			if (!states.shader) {
-				states.shader = GLResourceFactory::getInstance().get<Shader>("_AEON_Basic2D").get();
+				// The default shader is resolved once per shape, the factory reloading it in place
+				if (!mShader) {
+					mShader = GLResourceFactory::getInstance().get<Shader>("_AEON_Basic2D");
+				}
+				states.shader = mShader.get();
 			}
 			states.dirty = isDirty();
 
-			// Render the outline (if there is one)
-			if (mOutlineThickness != 0.f) {
-				// Setup the appropriate render states
-				states.blendMode = BlendMode::BlendNone;
+			// Render the outline and the untextured fill merged with it at once
+			const bool OUTLINED = (mOutlineThickness != 0.f);
+			if (OUTLINED && !mTexture) {
+				states.blendMode = BlendMode::BlendAlpha;
 				states.texture = nullptr;
-
-				// Send the outline to the renderer
-				Renderer2D::getActiveInstance()->submit(mOutlineVertices, mOutlineIndices, states);
+				Renderer2D::submitToActive(mOutlineVertices, mOutlineIndices, states);
+			}
+			else {
+				// Render the outline (if there is one)
+				if (OUTLINED) {
+					// Setup the appropriate render states
+					states.blendMode = BlendMode::BlendNone;
+					states.texture = nullptr;
+
+					// Send the outline to the renderer
+					Renderer2D::submitToActive(mOutlineVertices, mOutlineIndices, states);
+				}
+
+				// Setup the shape's render states
+				states.blendMode = BlendMode::BlendAlpha;
+				states.texture = mTexture;
+
+				// Send the shape to the renderer
+				submitGeometry(states);
 			}
-
-			// Setup the shape's render states
-			states.blendMode = BlendMode::BlendAlpha;
-			states.texture = mTexture;
-
-			// Send the shape to the renderer
-			Renderer2D::getActiveInstance()->submit(getVertices(), getIndices(), states);
 
 			// Drop the dirty render flag
 			setDirty(false);
@@ -23,6 +23,8 @@
 #include <AEON/Graphics/internal/UniformBuffer.h>
 
 #include <vector>
+#include <cstring>
+#include <algorithm>
 
 #include <GL/glew.h>
 
@@ -39,7 +41,9 @@ namespace ae
 	UniformBuffer::UniformBuffer()
 		: Buffer(GL_UNIFORM_BUFFER)
 		, mUniforms()
-		, mUploadQueue()
+		, mShadow()
+		, mDirtyBegin(0)
+		, mDirtyEnd(0)
 		, mBlockName("")
 		, mBindingPoint(bindingPointCounter++)
 	{
@@ -50,7 +54,9 @@ namespace ae
 	UniformBuffer::UniformBuffer(UniformBuffer&& rvalue) noexcept
 		: Buffer(std::move(rvalue))
 		, mUniforms(std::move(rvalue.mUniforms))
-		, mUploadQueue(std::move(rvalue.mUploadQueue))
+		, mShadow(std::move(rvalue.mShadow))
+		, mDirtyBegin(rvalue.mDirtyBegin)
+		, mDirtyEnd(rvalue.mDirtyEnd)
 		, mBlockName(std::move(rvalue.mBlockName))
 		, mBindingPoint(rvalue.mBindingPoint)
 	{
@@ -62,7 +68,9 @@ namespace ae
 		// Copy the rvalue's trivial data and move the rest
 		Buffer::operator=(std::move(rvalue));
 		mUniforms = std::move(rvalue.mUniforms);
-		mUploadQueue = std::move(rvalue.mUploadQueue);
+		mShadow = std::move(rvalue.mShadow);
+		mDirtyBegin = rvalue.mDirtyBegin;
+		mDirtyEnd = rvalue.mDirtyEnd;
 		mBlockName = std::move(rvalue.mBlockName);
 		mBindingPoint = rvalue.mBindingPoint;
 
@@ -84,24 +92,64 @@ namespace ae
 	void UniformBuffer::queueUniformUpload(const std::string& name, const void* data, size_t size)
 	{
 		// Enqueue the uniform upload if the name provided is associated to a valid uniform
-		auto uniformItr = mUniforms.find(mBlockName + '.' + name);
+		const int OFFSET = getUniformOffset(name);
+		if (OFFSET != -1) {
+			queueUniformUpload(OFFSET, data, size);
+		}
+	}
+
+	void UniformBuffer::queueUniformUpload(int offset, const void* data, size_t size)
+	{
+		// Check that the upload is contained within the uniform block (ignored in Release mode)
+		if _CONSTEXPR_IF (AEON_DEBUG) {
+			if (offset < 0 || offset + size > mShadow.size()) {
+				AEON_LOG_ERROR("Invalid uniform upload", "The uniform upload exceeds the uniform block \"" + mBlockName + "\".\nAborting operation.");
+				return;
+			}
+		}
+
+		// Copy the new data into the CPU copy and extend the modified range, unless the data hasn't changed
+		uint8_t* const destination = mShadow.data() + offset;
+		if (std::memcmp(destination, data, size) == 0) {
+			return;
+		}
+		std::memcpy(destination, data, size);
+
+		const size_t BEGIN = static_cast<size_t>(offset), END = BEGIN + size;
+		if (mDirtyBegin == mDirtyEnd) {
+			mDirtyBegin = BEGIN;
+			mDirtyEnd = END;
+		}
+		else {
+			mDirtyBegin = std::min(mDirtyBegin, BEGIN);
+			mDirtyEnd = std::max(mDirtyEnd, END);
+		}
+	}
+
+	int UniformBuffer::getUniformOffset(const std::string& name) const
+	{
+		auto uniformItr = mUniforms.find(name);
 		if (uniformItr != mUniforms.end()) {
-			mUploadQueue.push({ uniformItr, data, size });
+			return uniformItr->second.metadata.at(GL_UNIFORM_OFFSET);
 		}
+		return -1;
+	}
+
+	int UniformBuffer::getUniformArrayStride(const std::string& name) const
+	{
+		auto uniformItr = mUniforms.find(name);
+		if (uniformItr != mUniforms.end()) {
+			return uniformItr->second.metadata.at(GL_UNIFORM_ARRAY_STRIDE);
+		}
+		return -1;
 	}
 
 	void UniformBuffer::uploadQueuedUniforms()
 	{
-		// Check if any uniform uploads have been enqueued
-		if (!mUploadQueue.empty()) {
-			void* mapped = map(GL_WRITE_ONLY);
-			do {
-				const UniformUpload& upload = mUploadQueue.front();
-				const int OFFSET = upload.uniform->second.metadata[GL_UNIFORM_OFFSET];
-				std::memcpy(static_cast<void*>(static_cast<char*>(mapped) + OFFSET), upload.data, upload.size);
-				mUploadQueue.pop();
-			} while (!mUploadQueue.empty());
-			unmap();
+		// Upload the modified range of the uniform block in a single call (the driver won't have to wait for the GPU as opposed to a mapping)
+		if (mDirtyBegin != mDirtyEnd) {
+			GLCall(glNamedBufferSubData(mHandle, mDirtyBegin, mDirtyEnd - mDirtyBegin, mShadow.data() + mDirtyBegin));
+			mDirtyBegin = mDirtyEnd = 0;
 		}
 	}
 
@@ -152,9 +200,11 @@ namespace ae
 			GLCall(glGetActiveUniformsiv(shaderID, UNIFORM_COUNT, indices.data(), metadata.first, metadata.second.data()));
 		}
 
-		// Keep a copy of each uniform's name, index and metadata
-		for (GLsizei i = 0; i < UNIFORM_COUNT; ++i) {
-			mUniforms.emplace(cppNames[i], Uniform(uniformMetadata, i, indices[i]));
+		// Keep a copy of each uniform's name (without the block's name), index and metadata
+		GLsizei i = 0;
+		for (const std::string& name : uniformNames) {
+			mUniforms.emplace(name, Uniform(uniformMetadata, i, indices[i]));
+			++i;
 		}
 	}
 
@@ -166,8 +216,11 @@ namespace ae
 		GLint blockSize;
 		GLCall(glGetActiveUniformBlockiv(shaderID, BLOCK_INDEX, GL_UNIFORM_BLOCK_DATA_SIZE, &blockSize));
 
-		// Initialize the uniform block's data store
-		GLCall(glNamedBufferData(mHandle, blockSize, nullptr, GL_DYNAMIC_DRAW));
+		// Initialize the uniform block's data store and its CPU copy
+		mShadow.assign(blockSize, 0);
+		mDirtyBegin = mDirtyEnd = 0;
+		GLCall(glNamedBufferData(mHandle, blockSize, mShadow.data(), GL_DYNAMIC_DRAW));
+		mStorageSize = mShadow.size();
 	}
 
 	// UniformBuffer::Uniform		
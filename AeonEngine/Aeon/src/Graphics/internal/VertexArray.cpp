@@ -94,15 +94,50 @@ namespace ae
 		// Destroy the previous ibo (if there was one)
 		if (mIBO) mIBO->destroy();
 
-		// Move the new ibo
+		// Attach the new ibo as the VAO's element buffer and move it
+		GLCall(glVertexArrayElementBuffer(mHandle, ibo->getHandle()));
 		mIBO = std::move(ibo);
 	}
 
+	void VertexArray::setVBOOffset(size_t index, int offset) const
+	{
+		// Check if the index is valid (ignored in Release mode)
+		if _CONSTEXPR_IF (AEON_DEBUG) {
+			if (mVBOs.size() <= index) {
+				AEON_LOG_ERROR("Invalid index", "The index \"" + std::to_string(index) + "\" isn't associated with any VBOs.\nAborting operation.");
+				return;
+			}
+		}
+
+		const VertexBuffer& vbo = *mVBOs[index];
+		GLCall(glVertexArrayVertexBuffer(mHandle, static_cast<GLuint>(index), vbo.getHandle(), offset, vbo.getLayout().getStride()));
+	}
+
+	void VertexArray::attachIBO(const IndexBuffer* ibo) const
+	{
+		const IndexBuffer* const ATTACHED = (ibo) ? ibo : mIBO.get();
+		GLCall(glVertexArrayElementBuffer(mHandle, (ATTACHED) ? ATTACHED->getHandle() : 0));
+	}
+
+	void VertexArray::attachVBO(size_t index, const VertexBuffer* vbo) const
+	{
+		// Check if the index is valid (ignored in Release mode)
+		if _CONSTEXPR_IF (AEON_DEBUG) {
+			if (mVBOs.size() <= index) {
+				AEON_LOG_ERROR("Invalid index", "The index \"" + std::to_string(index) + "\" isn't associated with any VBOs.\nAborting operation.");
+				return;
+			}
+		}
+
+		const VertexBuffer& attached = (vbo) ? *vbo : *mVBOs[index];
+		GLCall(glVertexArrayVertexBuffer(mHandle, static_cast<GLuint>(index), attached.getHandle(), 0, mVBOs[index]->getLayout().getStride()));
+	}
+
 	VertexBuffer* const VertexArray::getVBO(size_t index) const noexcept
 	{
 		// Check if the index is valid
 		if (mVBOs.size() <= index) {
-			AEON_LOG_ERROR("Invalid index", "The index \"" + std::to_string(index) + "\" isn't associated with any VBOs.");
+			AEON_LOG_ERROR_F("Invalid index", "The index \"{}\" isn't associated with any VBOs.", index);
 			return nullptr;
 		}
 
@@ -137,24 +172,19 @@ namespace ae
 		if (mIBO) mIBO->destroy();
 
 		// Destroy the VAO's identifier
+		gl::releaseObject(0, mHandle, 0);
 		GLCall(glDeleteVertexArrays(1, &mHandle));
 	}
 
 	void VertexArray::bind() const
 	{
-		// Bind the VAO to the context
-		GLCall(glBindVertexArray(mHandle));
-
-		// Bind the IBO (if one was added) to the context
-		if (mIBO) mIBO->bind();
+		// Bind the VAO (and its element buffer) to the context
+		gl::bindVertexArray(mHandle);
 	}
 
 	void VertexArray::unbind() const
 	{
-		// Unbind the IBO (if one was added) from the context
-		if (mIBO) mIBO->unbind();
-
-		// Unbind the VAO from the context
-		GLCall(glBindVertexArray(0));
+		// Unbind the VAO (and its element buffer) from the context
+		gl::bindVertexArray(0);
 	}
 }
\ No newline at end of file
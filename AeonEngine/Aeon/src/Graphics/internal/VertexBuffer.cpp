@@ -160,6 +160,7 @@ namespace ae
 	void VertexBuffer::setData(int size, const void* data) const
 	{
 		GLCall(glNamedBufferData(mHandle, size, data, mUsage));
+		mStorageSize = static_cast<size_t>(size);
 	}
 
 	void VertexBuffer::setSubData(int offset, int size, const void* data) const
@@ -0,0 +1,224 @@
+// MIT License
+// 
+// Copyright(c) 2019-2021 Filippos Gleglakos
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+
+#include <AEON/Math/BoxSet2f.h>
+
+#include <algorithm>
+#include <limits>
+#include <utility>
+
+#include <AEON/Math/internal/SIMD.h>
+#include <AEON/System/DebugLogger.h>
+
+namespace ae
+{
+	namespace
+	{
+		// Retrieves the mask of the lanes of the block starting at the index provided which contain boxes (the other ones are padding)
+		unsigned int getLaneMask(size_t index, size_t count) noexcept
+		{
+			return (count - index >= 4) ? 0xFu : (1u << (count - index)) - 1u;
+		}
+	}
+
+	// Public constructor(s)
+	BoxSet2f::BoxSet2f() noexcept
+		: mMinX()
+		, mMinY()
+		, mMaxX()
+		, mMaxY()
+		, mCount(0)
+	{
+	}
+
+	// Public method(s)
+	uint32_t BoxSet2f::add(const Box2f& box)
+	{
+		// Grow the arrays by a block of 4 once the padding is used up
+		if (mCount == mMinX.size()) {
+			const size_t PADDED_SIZE = mMinX.size() + 4;
+			mMinX.resize(PADDED_SIZE, 0.f);
+			mMinY.resize(PADDED_SIZE, 0.f);
+			mMaxX.resize(PADDED_SIZE, 0.f);
+			mMaxY.resize(PADDED_SIZE, 0.f);
+		}
+
+		const uint32_t INDEX = static_cast<uint32_t>(mCount++);
+		set(INDEX, box);
+
+		return INDEX;
+	}
+
+	void BoxSet2f::set(uint32_t index, const Box2f& box)
+	{
+		// Check if the index is valid (ignored in Release mode)
+		if _CONSTEXPR_IF (AEON_DEBUG) {
+			if (index >= mCount) {
+				AEON_LOG_ERROR("Invalid index", "The index provided is greater than the number of boxes.\nAborting operation.");
+				return;
+			}
+		}
+
+		mMinX[index] = box.min.x;
+		mMinY[index] = box.min.y;
+		mMaxX[index] = box.max.x;
+		mMaxY[index] = box.max.y;
+	}
+
+	void BoxSet2f::remove(uint32_t index)
+	{
+		// Check if the index is valid (ignored in Release mode)
+		if _CONSTEXPR_IF (AEON_DEBUG) {
+			if (index >= mCount) {
+				AEON_LOG_ERROR("Invalid index", "The index provided is greater than the number of boxes.\nAborting operation.");
+				return;
+			}
+		}
+
+		// Move the last box to the index
+		--mCount;
+		mMinX[index] = mMinX[mCount];
+		mMinY[index] = mMinY[mCount];
+		mMaxX[index] = mMaxX[mCount];
+		mMaxY[index] = mMaxY[mCount];
+	}
+
+	void BoxSet2f::clear() noexcept
+	{
+		mMinX.clear();
+		mMinY.clear();
+		mMaxX.clear();
+		mMaxY.clear();
+		mCount = 0;
+	}
+
+	void BoxSet2f::reserve(size_t count)
+	{
+		const size_t PADDED_COUNT = (count + 3) & ~static_cast<size_t>(3);
+		mMinX.reserve(PADDED_COUNT);
+		mMinY.reserve(PADDED_COUNT);
+		mMaxX.reserve(PADDED_COUNT);
+		mMaxY.reserve(PADDED_COUNT);
+	}
+
+	Box2f BoxSet2f::get(uint32_t index) const
+	{
+		return Box2f(Vector2f(mMinX[index], mMinY[index]), Vector2f(mMaxX[index], mMaxY[index]));
+	}
+
+	size_t BoxSet2f::getSize() const noexcept
+	{
+		return mCount;
+	}
+
+	void BoxSet2f::queryPoint(const Vector2f& point, std::vector<uint32_t>& indices) const
+	{
+		// A point is contained by the boxes overlapping the degenerate box at its position
+		queryBox(Box2f(point, point), indices);
+	}
+
+	void BoxSet2f::queryBox(const Box2f& box, std::vector<uint32_t>& indices) const
+	{
+		indices.clear();
+		const float BOX[4] = { box.min.x, box.min.y, box.max.x, box.max.y };
+
+		for (size_t i = 0; i < mCount; i += 4) {
+		#if AEON_SIMD
+			unsigned int mask = SIMD::overlapBoxes4(&mMinX[i], &mMinY[i], &mMaxX[i], &mMaxY[i], BOX) & getLaneMask(i, mCount);
+			for (uint32_t lane = 0; mask != 0; ++lane, mask >>= 1) {
+				if (mask & 1u) {
+					indices.push_back(static_cast<uint32_t>(i) + lane);
+				}
+			}
+		#else
+			const size_t END = std::min(i + 4, mCount);
+			for (size_t j = i; j < END; ++j) {
+				if (mMinX[j] <= BOX[2] && mMaxX[j] >= BOX[0] && mMinY[j] <= BOX[3] && mMaxY[j] >= BOX[1]) {
+					indices.push_back(static_cast<uint32_t>(j));
+				}
+			}
+		#endif
+		}
+	}
+
+	void BoxSet2f::raycast(const Vector2f& origin, const Vector2f& direction, float maxDistance, std::vector<uint32_t>& indices, std::vector<float>* const distances) const
+	{
+		indices.clear();
+		if (distances) {
+			distances->clear();
+		}
+
+		// Check if the direction is null (ignored in Release mode)
+		if _CONSTEXPR_IF (AEON_DEBUG) {
+			if (direction.x == 0.f && direction.y == 0.f) {
+				AEON_LOG_ERROR("Invalid ray", "The ray's direction is null.\nAborting operation.");
+				return;
+			}
+		}
+
+		// A null component is replaced by the largest inverse so that the products with a null offset remain 0 instead of NaN
+		const float INV_DIR_X = (direction.x != 0.f) ? 1.f / direction.x : std::numeric_limits<float>::max();
+		const float INV_DIR_Y = (direction.y != 0.f) ? 1.f / direction.y : std::numeric_limits<float>::max();
+		const float RAY[5] = { origin.x, origin.y, INV_DIR_X, INV_DIR_Y, maxDistance };
+
+		// Gather the hits along with their entry distances (the scratch vector is reused between the calling thread's queries)
+		thread_local std::vector<std::pair<float, uint32_t>> hits;
+		hits.clear();
+		for (size_t i = 0; i < mCount; i += 4) {
+		#if AEON_SIMD
+			float entryDistances[4];
+			unsigned int mask = SIMD::raycastBoxes4(&mMinX[i], &mMinY[i], &mMaxX[i], &mMaxY[i], RAY, entryDistances) & getLaneMask(i, mCount);
+			for (uint32_t lane = 0; mask != 0; ++lane, mask >>= 1) {
+				if (mask & 1u) {
+					hits.emplace_back(entryDistances[lane], static_cast<uint32_t>(i) + lane);
+				}
+			}
+		#else
+			const size_t END = std::min(i + 4, mCount);
+			for (size_t j = i; j < END; ++j) {
+				const float T1X = (mMinX[j] - RAY[0]) * RAY[2], T2X = (mMaxX[j] - RAY[0]) * RAY[2];
+				const float T1Y = (mMinY[j] - RAY[1]) * RAY[3], T2Y = (mMaxY[j] - RAY[1]) * RAY[3];
+				const float T_ENTER = std::max(std::max(std::min(T1X, T2X), std::min(T1Y, T2Y)), 0.f);
+				const float T_EXIT = std::min(std::min(std::max(T1X, T2X), std::max(T1Y, T2Y)), RAY[4]);
+				if (T_ENTER <= T_EXIT) {
+					hits.emplace_back(T_ENTER, static_cast<uint32_t>(j));
+				}
+			}
+		#endif
+		}
+
+		// Sort the hits from the nearest to the farthest
+		std::sort(hits.begin(), hits.end());
+		indices.reserve(hits.size());
+		for (const auto& hit : hits) {
+			indices.push_back(hit.second);
+		}
+		if (distances) {
+			distances->reserve(hits.size());
+			for (const auto& hit : hits) {
+				distances->push_back(hit.first);
+			}
+		}
+	}
+}
\ No newline at end of file
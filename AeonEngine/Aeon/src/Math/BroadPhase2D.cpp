@@ -0,0 +1,546 @@
+// MIT License
+// 
+// Copyright(c) 2019-2021 Filippos Gleglakos
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+
+#include <AEON/Math/BroadPhase2D.h>
+
+#include <algorithm>
+#include <limits>
+
+#include <AEON/Math/internal/SIMD.h>
+#include <AEON/System/DebugLogger.h>
+
+namespace ae
+{
+	namespace
+	{
+		// The coordinates assigned to the destroyed proxies and to the padding, such a box never overlaps another one
+		constexpr float EMPTY_MIN = std::numeric_limits<float>::infinity();
+		constexpr float EMPTY_MAX = -std::numeric_limits<float>::infinity();
+
+		// Combines two boxes into the box containing both of them
+		Box2f combine(const Box2f& box1, const Box2f& box2) noexcept
+		{
+			return Box2f(min(box1.min, box2.min), max(box1.max, box2.max));
+		}
+
+		// Computes the perimeter of a box, used as the cost of the dynamic tree's nodes
+		float getPerimeter(const Box2f& box) noexcept
+		{
+			return 2.f * ((box.max.x - box.min.x) + (box.max.y - box.min.y));
+		}
+	}
+
+	// Public constructor(s)
+	BroadPhase2D::BroadPhase2D(Algorithm algorithm, float margin)
+		: mAlgorithm(algorithm)
+		, mMargin(margin)
+		, mMinX()
+		, mMinY()
+		, mMaxX()
+		, mMaxY()
+		, mUserData()
+		, mLeaves()
+		, mFreeProxies()
+		, mSorted()
+		, mSortedMinX()
+		, mSortedMinY()
+		, mSortedMaxX()
+		, mSortedMaxY()
+		, mNodes()
+		, mRoot(-1)
+		, mFreeNode(-1)
+	{
+	}
+
+	// Public method(s)
+	uint32_t BroadPhase2D::createProxy(const Box2f& box, void* userData)
+	{
+		// Reuse a destroyed proxy or append a new one
+		uint32_t proxy;
+		if (!mFreeProxies.empty()) {
+			proxy = mFreeProxies.back();
+			mFreeProxies.pop_back();
+		}
+		else {
+			proxy = static_cast<uint32_t>(mMinX.size());
+			mMinX.push_back(EMPTY_MIN);
+			mMinY.push_back(EMPTY_MIN);
+			mMaxX.push_back(EMPTY_MAX);
+			mMaxY.push_back(EMPTY_MAX);
+			mUserData.push_back(nullptr);
+			mLeaves.push_back(-1);
+		}
+
+		mMinX[proxy] = box.min.x;
+		mMinY[proxy] = box.min.y;
+		mMaxX[proxy] = box.max.x;
+		mMaxY[proxy] = box.max.y;
+		mUserData[proxy] = userData;
+
+		// Add the proxy to the sweep-and-prune (sorted at the next query) or to the dynamic tree
+		if (mAlgorithm == Algorithm::SweepAndPrune) {
+			mSorted.push_back(proxy);
+		}
+		else {
+			const int32_t LEAF = allocateNode();
+			mNodes[LEAF].box = getFatBox(proxy);
+			mNodes[LEAF].proxy = proxy;
+			insertLeaf(LEAF);
+			mLeaves[proxy] = LEAF;
+		}
+
+		return proxy;
+	}
+
+	void BroadPhase2D::destroyProxy(uint32_t proxy)
+	{
+		// Check if the proxy exists (ignored in Release mode)
+		if _CONSTEXPR_IF (AEON_DEBUG) {
+			if (proxy >= mMinX.size() || (mMinX[proxy] == EMPTY_MIN && mMaxX[proxy] == EMPTY_MAX)) {
+				AEON_LOG_ERROR("Invalid proxy", "The proxy provided doesn't exist.\nAborting operation.");
+				return;
+			}
+		}
+
+		// Remove the proxy from the sweep-and-prune or from the dynamic tree
+		if (mAlgorithm == Algorithm::SweepAndPrune) {
+			mSorted.erase(std::find(mSorted.begin(), mSorted.end(), proxy));
+		}
+		else {
+			removeLeaf(mLeaves[proxy]);
+			freeNode(mLeaves[proxy]);
+			mLeaves[proxy] = -1;
+		}
+
+		// Empty the proxy's box so that the linear scans ignore it
+		mMinX[proxy] = EMPTY_MIN;
+		mMinY[proxy] = EMPTY_MIN;
+		mMaxX[proxy] = EMPTY_MAX;
+		mMaxY[proxy] = EMPTY_MAX;
+		mUserData[proxy] = nullptr;
+		mFreeProxies.push_back(proxy);
+	}
+
+	void BroadPhase2D::moveProxy(uint32_t proxy, const Box2f& box)
+	{
+		// Check if the proxy exists (ignored in Release mode)
+		if _CONSTEXPR_IF (AEON_DEBUG) {
+			if (proxy >= mMinX.size() || (mMinX[proxy] == EMPTY_MIN && mMaxX[proxy] == EMPTY_MAX)) {
+				AEON_LOG_ERROR("Invalid proxy", "The proxy provided doesn't exist.\nAborting operation.");
+				return;
+			}
+		}
+
+		mMinX[proxy] = box.min.x;
+		mMinY[proxy] = box.min.y;
+		mMaxX[proxy] = box.max.x;
+		mMaxY[proxy] = box.max.y;
+
+		// Only reinsert the leaf if the box left its fattened box
+		if (mAlgorithm == Algorithm::DynamicTree) {
+			const int32_t LEAF = mLeaves[proxy];
+			const Box2f& FAT_BOX = mNodes[LEAF].box;
+			if (box.min.x < FAT_BOX.min.x || box.min.y < FAT_BOX.min.y || box.max.x > FAT_BOX.max.x || box.max.y > FAT_BOX.max.y) {
+				removeLeaf(LEAF);
+				mNodes[LEAF].box = getFatBox(proxy);
+				insertLeaf(LEAF);
+			}
+		}
+	}
+
+	void BroadPhase2D::queryPairs(const PairCallback& callback)
+	{
+		if (mAlgorithm == Algorithm::SweepAndPrune) {
+			// Restore the order along the X axis, the insertion sort is nearly linear as the order barely changes between frames
+			for (size_t i = 1; i < mSorted.size(); ++i) {
+				const uint32_t PROXY = mSorted[i];
+				const float MIN_X = mMinX[PROXY];
+
+				size_t j = i;
+				for (; j > 0 && mMinX[mSorted[j - 1]] > MIN_X; --j) {
+					mSorted[j] = mSorted[j - 1];
+				}
+				mSorted[j] = PROXY;
+			}
+
+			// Gather the coordinates in the sorted order, padded with empty boxes so that the 4-wide tests never read past the end
+			const size_t COUNT = mSorted.size();
+			mSortedMinX.assign(COUNT + 3, EMPTY_MIN);
+			mSortedMinY.assign(COUNT + 3, EMPTY_MIN);
+			mSortedMaxX.assign(COUNT + 3, EMPTY_MAX);
+			mSortedMaxY.assign(COUNT + 3, EMPTY_MAX);
+			for (size_t i = 0; i < COUNT; ++i) {
+				const uint32_t PROXY = mSorted[i];
+				mSortedMinX[i] = mMinX[PROXY];
+				mSortedMinY[i] = mMinY[PROXY];
+				mSortedMaxX[i] = mMaxX[PROXY];
+				mSortedMaxY[i] = mMaxY[PROXY];
+			}
+
+			// Sweep along the X axis
+			for (size_t i = 0; i < COUNT; ++i) {
+				sweep(i, callback);
+			}
+		}
+		else {
+			// Query the tree with each proxy's box, only reporting the pairs once
+			for (uint32_t proxy = 0; proxy < static_cast<uint32_t>(mLeaves.size()); ++proxy) {
+				if (mLeaves[proxy] == -1) {
+					continue;
+				}
+
+				queryBox(getBox(proxy), [&](uint32_t other) {
+					if (other > proxy) {
+						callback(proxy, other);
+					}
+				});
+			}
+		}
+	}
+
+	void BroadPhase2D::queryBox(const Box2f& box, const ProxyCallback& callback) const
+	{
+		const float BOX[4] = { box.min.x, box.min.y, box.max.x, box.max.y };
+
+		if (mAlgorithm == Algorithm::SweepAndPrune) {
+			// Scan the coordinates linearly, the destroyed proxies' empty boxes never overlap
+			const size_t COUNT = mMinX.size();
+			size_t i = 0;
+		#if AEON_SIMD
+			for (; i + 4 <= COUNT; i += 4) {
+				unsigned int mask = SIMD::overlapBoxes4(&mMinX[i], &mMinY[i], &mMaxX[i], &mMaxY[i], BOX);
+				for (uint32_t lane = 0; mask != 0; ++lane, mask >>= 1) {
+					if (mask & 1u) {
+						callback(static_cast<uint32_t>(i) + lane);
+					}
+				}
+			}
+		#endif
+			for (; i < COUNT; ++i) {
+				if (mMinX[i] <= BOX[2] && mMaxX[i] >= BOX[0] && mMinY[i] <= BOX[3] && mMaxY[i] >= BOX[1]) {
+					callback(static_cast<uint32_t>(i));
+				}
+			}
+			return;
+		}
+
+		// Traverse the dynamic tree, only descending into the fattened boxes overlapping the box
+		if (mRoot == -1) {
+			return;
+		}
+
+		std::vector<int32_t> stack;
+		stack.reserve(64);
+		stack.push_back(mRoot);
+		while (!stack.empty())
+		{
+			const TreeNode& node = mNodes[stack.back()];
+			stack.pop_back();
+			if (!node.box.intersects(box)) {
+				continue;
+			}
+
+			if (node.child1 == -1) {
+				// Test the exact box of the leaf's proxy
+				const uint32_t PROXY = node.proxy;
+				if (mMinX[PROXY] <= BOX[2] && mMaxX[PROXY] >= BOX[0] && mMinY[PROXY] <= BOX[3] && mMaxY[PROXY] >= BOX[1]) {
+					callback(PROXY);
+				}
+			}
+			else {
+				stack.push_back(node.child1);
+				stack.push_back(node.child2);
+			}
+		}
+	}
+
+	Box2f BroadPhase2D::getBox(uint32_t proxy) const
+	{
+		return Box2f(Vector2f(mMinX[proxy], mMinY[proxy]), Vector2f(mMaxX[proxy], mMaxY[proxy]));
+	}
+
+	void* BroadPhase2D::getUserData(uint32_t proxy) const
+	{
+		return mUserData[proxy];
+	}
+
+	size_t BroadPhase2D::getProxyCount() const noexcept
+	{
+		return mMinX.size() - mFreeProxies.size();
+	}
+
+	BroadPhase2D::Algorithm BroadPhase2D::getAlgorithm() const noexcept
+	{
+		return mAlgorithm;
+	}
+
+	// Private method(s)
+	void BroadPhase2D::sweep(size_t index, const PairCallback& callback) const
+	{
+		const float BOX[4] = { mSortedMinX[index], mSortedMinY[index], mSortedMaxX[index], mSortedMaxY[index] };
+		const uint32_t PROXY = mSorted[index];
+		const size_t COUNT = mSorted.size();
+
+		// Test the subsequent boxes until one starts past the box's maximum X coordinate (the padding always does)
+		size_t i = index + 1;
+	#if AEON_SIMD
+		for (; i < COUNT && mSortedMinX[i] <= BOX[2]; i += 4) {
+			unsigned int mask = SIMD::overlapBoxes4(&mSortedMinX[i], &mSortedMinY[i], &mSortedMaxX[i], &mSortedMaxY[i], BOX);
+			for (size_t lane = 0; mask != 0; ++lane, mask >>= 1) {
+				if (mask & 1u) {
+					callback(PROXY, mSorted[i + lane]);
+				}
+			}
+		}
+	#else
+		for (; i < COUNT && mSortedMinX[i] <= BOX[2]; ++i) {
+			if (mSortedMinY[i] <= BOX[3] && mSortedMaxY[i] >= BOX[1]) {
+				callback(PROXY, mSorted[i]);
+			}
+		}
+	#endif
+	}
+
+	int32_t BroadPhase2D::allocateNode()
+	{
+		// Reuse a free node or append a new one
+		int32_t node;
+		if (mFreeNode != -1) {
+			node = mFreeNode;
+			mFreeNode = mNodes[node].parent;
+		}
+		else {
+			node = static_cast<int32_t>(mNodes.size());
+			mNodes.emplace_back();
+		}
+
+		TreeNode& treeNode = mNodes[node];
+		treeNode.parent = -1;
+		treeNode.child1 = -1;
+		treeNode.child2 = -1;
+		treeNode.height = 0;
+		treeNode.proxy = 0;
+
+		return node;
+	}
+
+	void BroadPhase2D::freeNode(int32_t node)
+	{
+		mNodes[node].parent = mFreeNode;
+		mNodes[node].height = -1;
+		mFreeNode = node;
+	}
+
+	void BroadPhase2D::insertLeaf(int32_t leaf)
+	{
+		if (mRoot == -1) {
+			mRoot = leaf;
+			mNodes[leaf].parent = -1;
+			return;
+		}
+
+		// Descend towards the sibling whose combination with the leaf increases the tree's perimeter the least
+		const Box2f LEAF_BOX = mNodes[leaf].box;
+		int32_t index = mRoot;
+		while (mNodes[index].child1 != -1)
+		{
+			const TreeNode& node = mNodes[index];
+			const float PERIMETER = getPerimeter(node.box);
+			const float COMBINED_PERIMETER = getPerimeter(combine(node.box, LEAF_BOX));
+
+			// The cost of creating a new parent for this node and the leaf, and the minimum cost of descending further
+			const float COST = 2.f * COMBINED_PERIMETER;
+			const float INHERITANCE_COST = 2.f * (COMBINED_PERIMETER - PERIMETER);
+
+			// The cost of descending into each child
+			const auto getDescentCost = [&](int32_t child) {
+				const TreeNode& childNode = mNodes[child];
+				const float CHILD_COMBINED = getPerimeter(combine(childNode.box, LEAF_BOX));
+				return ((childNode.child1 == -1) ? CHILD_COMBINED : CHILD_COMBINED - getPerimeter(childNode.box)) + INHERITANCE_COST;
+			};
+			const float COST1 = getDescentCost(node.child1);
+			const float COST2 = getDescentCost(node.child2);
+
+			if (COST < COST1 && COST < COST2) {
+				break;
+			}
+			index = (COST1 < COST2) ? node.child1 : node.child2;
+		}
+
+		// Create a new parent for the sibling and the leaf (the allocation may invalidate the references to the nodes)
+		const int32_t SIBLING = index;
+		const int32_t OLD_PARENT = mNodes[SIBLING].parent;
+		const int32_t NEW_PARENT = allocateNode();
+
+		TreeNode& newParent = mNodes[NEW_PARENT];
+		newParent.parent = OLD_PARENT;
+		newParent.box = combine(LEAF_BOX, mNodes[SIBLING].box);
+		newParent.height = mNodes[SIBLING].height + 1;
+		newParent.child1 = SIBLING;
+		newParent.child2 = leaf;
+
+		if (OLD_PARENT != -1) {
+			TreeNode& oldParent = mNodes[OLD_PARENT];
+			((oldParent.child1 == SIBLING) ? oldParent.child1 : oldParent.child2) = NEW_PARENT;
+		}
+		else {
+			mRoot = NEW_PARENT;
+		}
+		mNodes[SIBLING].parent = NEW_PARENT;
+		mNodes[leaf].parent = NEW_PARENT;
+
+		refit(NEW_PARENT);
+	}
+
+	void BroadPhase2D::removeLeaf(int32_t leaf)
+	{
+		if (leaf == mRoot) {
+			mRoot = -1;
+			return;
+		}
+
+		// Replace the leaf's parent by the leaf's sibling
+		const int32_t PARENT = mNodes[leaf].parent;
+		const int32_t GRAND_PARENT = mNodes[PARENT].parent;
+		const int32_t SIBLING = (mNodes[PARENT].child1 == leaf) ? mNodes[PARENT].child2 : mNodes[PARENT].child1;
+
+		mNodes[SIBLING].parent = GRAND_PARENT;
+		freeNode(PARENT);
+		if (GRAND_PARENT != -1) {
+			TreeNode& grandParent = mNodes[GRAND_PARENT];
+			((grandParent.child1 == PARENT) ? grandParent.child1 : grandParent.child2) = SIBLING;
+			refit(GRAND_PARENT);
+		}
+		else {
+			mRoot = SIBLING;
+		}
+	}
+
+	void BroadPhase2D::refit(int32_t node)
+	{
+		// Rebalance the ancestors and update their boxes and heights
+		while (node != -1)
+		{
+			node = balance(node);
+
+			TreeNode& treeNode = mNodes[node];
+			const TreeNode& child1 = mNodes[treeNode.child1];
+			const TreeNode& child2 = mNodes[treeNode.child2];
+			treeNode.height = 1 + std::max(child1.height, child2.height);
+			treeNode.box = combine(child1.box, child2.box);
+
+			node = treeNode.parent;
+		}
+	}
+
+	int32_t BroadPhase2D::balance(int32_t iA)
+	{
+		TreeNode& a = mNodes[iA];
+		if (a.child1 == -1 || a.height < 2) {
+			return iA;
+		}
+
+		const int32_t iB = a.child1;
+		const int32_t iC = a.child2;
+		TreeNode& b = mNodes[iB];
+		TreeNode& c = mNodes[iC];
+		const int32_t BALANCE = c.height - b.height;
+
+		// Replaces A by its child X in A's parent
+		const auto promote = [&](int32_t iX, TreeNode& x) {
+			x.parent = a.parent;
+			a.parent = iX;
+			if (x.parent != -1) {
+				TreeNode& parent = mNodes[x.parent];
+				((parent.child1 == iA) ? parent.child1 : parent.child2) = iX;
+			}
+			else {
+				mRoot = iX;
+			}
+		};
+
+		// Rotate C up
+		if (BALANCE > 1) {
+			const int32_t iF = c.child1;
+			const int32_t iG = c.child2;
+			TreeNode& f = mNodes[iF];
+			TreeNode& g = mNodes[iG];
+
+			c.child1 = iA;
+			promote(iC, c);
+
+			// The highest of C's children stays under C, the other one replaces C under A
+			const bool F_HIGHER = (f.height > g.height);
+			const int32_t iHigh = F_HIGHER ? iF : iG;
+			const int32_t iLow = F_HIGHER ? iG : iF;
+			TreeNode& high = mNodes[iHigh];
+			TreeNode& low = mNodes[iLow];
+
+			c.child2 = iHigh;
+			a.child2 = iLow;
+			low.parent = iA;
+			a.box = combine(b.box, low.box);
+			c.box = combine(a.box, high.box);
+			a.height = 1 + std::max(b.height, low.height);
+			c.height = 1 + std::max(a.height, high.height);
+
+			return iC;
+		}
+
+		// Rotate B up
+		if (BALANCE < -1) {
+			const int32_t iD = b.child1;
+			const int32_t iE = b.child2;
+			TreeNode& d = mNodes[iD];
+			TreeNode& e = mNodes[iE];
+
+			b.child1 = iA;
+			promote(iB, b);
+
+			// The highest of B's children stays under B, the other one replaces B under A
+			const bool D_HIGHER = (d.height > e.height);
+			const int32_t iHigh = D_HIGHER ? iD : iE;
+			const int32_t iLow = D_HIGHER ? iE : iD;
+			TreeNode& high = mNodes[iHigh];
+			TreeNode& low = mNodes[iLow];
+
+			b.child2 = iHigh;
+			a.child1 = iLow;
+			low.parent = iA;
+			a.box = combine(c.box, low.box);
+			b.box = combine(a.box, high.box);
+			a.height = 1 + std::max(c.height, low.height);
+			b.height = 1 + std::max(a.height, high.height);
+
+			return iB;
+		}
+
+		return iA;
+	}
+
+	Box2f BroadPhase2D::getFatBox(uint32_t proxy) const
+	{
+		return Box2f(Vector2f(mMinX[proxy] - mMargin, mMinY[proxy] - mMargin), Vector2f(mMaxX[proxy] + mMargin, mMaxY[proxy] + mMargin));
+	}
+}
\ No newline at end of file
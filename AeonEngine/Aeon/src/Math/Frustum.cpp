@@ -0,0 +1,150 @@
+// MIT License
+// 
+// Copyright(c) 2019-2021 Filippos Gleglakos
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <AEON/Math/Frustum.h>
+
+#include <cmath>
+
+#include <AEON/Math/internal/SIMD.h>
+
+namespace ae
+{
+	namespace
+	{
+		// The number of planes stored, the near and far planes being repeated to fill the second block
+		constexpr size_t PLANE_COUNT = 8;
+		// The mask of the planes that actually bound the view volume
+		constexpr unsigned int FRUSTUM_MASK = 0x3Fu;
+	}
+
+	// Public constructor(s)
+	Frustum::Frustum() noexcept
+		: mPlanes()
+	{
+		// Null normals with a positive distance place every point in front of the planes
+		for (size_t i = 0; i < PLANE_COUNT; ++i) {
+			mPlanes[i / 4][12 + i % 4] = 1.f;
+		}
+	}
+
+	Frustum::Frustum(const Matrix4f& viewProjection) noexcept
+		: mPlanes()
+	{
+		update(viewProjection);
+	}
+
+	// Public method(s)
+	void Frustum::update(const Matrix4f& viewProjection) noexcept
+	{
+		// Retrieve the rows of the column-major matrix
+		Vector4f rows[4];
+		for (size_t i = 0; i < 4; ++i) {
+			rows[i] = Vector4f(viewProjection.columns[0][i], viewProjection.columns[1][i], viewProjection.columns[2][i], viewProjection.columns[3][i]);
+		}
+
+		setPlane(static_cast<size_t>(Plane::Left),   rows[3] + rows[0]);
+		setPlane(static_cast<size_t>(Plane::Right),  rows[3] - rows[0]);
+		setPlane(static_cast<size_t>(Plane::Bottom), rows[3] + rows[1]);
+		setPlane(static_cast<size_t>(Plane::Top),    rows[3] - rows[1]);
+		setPlane(static_cast<size_t>(Plane::Near),   rows[3] + rows[2]);
+		setPlane(static_cast<size_t>(Plane::Far),    rows[3] - rows[2]);
+	}
+
+	Vector4f Frustum::getPlane(Plane plane) const noexcept
+	{
+		const size_t INDEX = static_cast<size_t>(plane);
+		const float* const BLOCK = mPlanes[INDEX / 4];
+		const size_t LANE = INDEX % 4;
+
+		return Vector4f(BLOCK[LANE], BLOCK[4 + LANE], BLOCK[8 + LANE], BLOCK[12 + LANE]);
+	}
+
+	bool Frustum::contains(const Vector3f& point) const noexcept
+	{
+		const float CENTER[3] = { point.x, point.y, point.z };
+		const float EXTENT[3] = { 0.f, 0.f, 0.f };
+		return classify(CENTER, EXTENT, 0.f) != Intersection::Outside;
+	}
+
+	bool Frustum::intersects(const Box3f& box) const noexcept
+	{
+		return classify(box) != Intersection::Outside;
+	}
+
+	bool Frustum::intersects(const Vector3f& center, float radius) const noexcept
+	{
+		const float CENTER[3] = { center.x, center.y, center.z };
+		const float EXTENT[3] = { 0.f, 0.f, 0.f };
+		return classify(CENTER, EXTENT, radius) != Intersection::Outside;
+	}
+
+	Frustum::Intersection Frustum::classify(const Box3f& box) const noexcept
+	{
+		// Test the box's center and half-size, its nearest corner to each plane being found from the normal's signs
+		const float CENTER[3] = { (box.min.x + box.max.x) * 0.5f, (box.min.y + box.max.y) * 0.5f, (box.min.z + box.max.z) * 0.5f };
+		const float EXTENT[3] = { (box.max.x - box.min.x) * 0.5f, (box.max.y - box.min.y) * 0.5f, (box.max.z - box.min.z) * 0.5f };
+		return classify(CENTER, EXTENT, 0.f);
+	}
+
+	// Private method(s)
+	Frustum::Intersection Frustum::classify(const float* center, const float* extent, float radius) const noexcept
+	{
+		unsigned int outside = 0, straddling = 0;
+	#if AEON_SIMD
+		unsigned int straddling1 = 0;
+		outside = SIMD::classifyPlanes4(mPlanes[0], center, extent, radius, straddling) | SIMD::classifyPlanes4(mPlanes[1], center, extent, radius, straddling1) << 4;
+		straddling |= straddling1 << 4;
+	#else
+		for (size_t i = 0; i < PLANE_COUNT; ++i) {
+			const float* const BLOCK = mPlanes[i / 4];
+			const size_t LANE = i % 4;
+			const float DISTANCE = BLOCK[LANE] * center[0] + BLOCK[4 + LANE] * center[1] + BLOCK[8 + LANE] * center[2] + BLOCK[12 + LANE];
+			const float REACH = std::abs(BLOCK[LANE]) * extent[0] + std::abs(BLOCK[4 + LANE]) * extent[1] + std::abs(BLOCK[8 + LANE]) * extent[2] + radius;
+			outside |= static_cast<unsigned int>(DISTANCE < -REACH) << i;
+			straddling |= static_cast<unsigned int>(DISTANCE < REACH) << i;
+		}
+	#endif
+
+		if (outside & FRUSTUM_MASK) {
+			return Intersection::Outside;
+		}
+		return (straddling & FRUSTUM_MASK) ? Intersection::Intersecting : Intersection::Inside;
+	}
+
+	void Frustum::setPlane(size_t index, const Vector4f& plane) noexcept
+	{
+		// Normalize the plane so that the distances are expressed in world units (a degenerate plane is left as is)
+		const float LENGTH = std::sqrt(plane.x * plane.x + plane.y * plane.y + plane.z * plane.z);
+		const Vector4f NORMALIZED = (LENGTH > 0.f) ? plane / LENGTH : plane;
+
+		// The near and far planes are also stored in the padding lanes of the second block
+		const size_t LAST = (index >= static_cast<size_t>(Plane::Near)) ? index + 2 : index;
+		for (size_t i = index; i <= LAST; i += 2) {
+			float* const BLOCK = mPlanes[i / 4];
+			const size_t LANE = i % 4;
+			BLOCK[LANE] = NORMALIZED.x;
+			BLOCK[4 + LANE] = NORMALIZED.y;
+			BLOCK[8 + LANE] = NORMALIZED.z;
+			BLOCK[12 + LANE] = NORMALIZED.w;
+		}
+	}
+}
\ No newline at end of file
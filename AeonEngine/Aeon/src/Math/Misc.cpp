@@ -0,0 +1,302 @@
+// MIT License
+// 
+// Copyright(c) 2019-2021 Filippos Gleglakos
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+
+
+#include <AEON/Math/Misc.h>
+
+#include <atomic>
+
+namespace ae
+{
+	namespace Math
+	{
+		namespace
+		{
+			// The seed shared by all threads and its generation, incremented whenever it's changed so that the threads reseed their generator
+			std::atomic<uint64_t> seed(0);
+			std::atomic<uint64_t> seedGeneration(0);
+			std::atomic<uint64_t> threadCount(0);
+
+			// The internal struct representing the state of a thread's xoshiro256++ generator
+			struct RandomState
+			{
+				uint64_t s[4];       //!< The generator's state
+				uint64_t generation; //!< The generation of the seed used
+				uint64_t index;      //!< The index of the thread, attributed during its first use of the generator
+
+				RandomState() noexcept
+					: s()
+					, generation(~uint64_t(0))
+					, index(threadCount.fetch_add(1, std::memory_order_relaxed))
+				{
+				}
+			};
+
+			thread_local RandomState randomState;
+
+			// Retrieves the next value of the splitmix64 generator, used to expand the seed into the xoshiro256++ state
+			uint64_t splitMix64(uint64_t& state) noexcept
+			{
+				uint64_t z = (state += 0x9E3779B97F4A7C15u);
+				z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9u;
+				z = (z ^ (z >> 27)) * 0x94D049BB133111EBu;
+				return z ^ (z >> 31);
+			}
+
+			uint64_t rotateLeft(uint64_t value, int count) noexcept
+			{
+				return (value << count) | (value >> (64 - count));
+			}
+
+			// Retrieves the calling thread's generator, reseeding it if the seed has changed since its last use
+			RandomState& getRandomState() noexcept
+			{
+				RandomState& state = randomState;
+				const uint64_t GENERATION = seedGeneration.load(std::memory_order_acquire);
+				if (state.generation != GENERATION)
+				{
+					// Each thread's stream is derived from the seed and the thread's index
+					uint64_t splitMixState = seed.load(std::memory_order_relaxed) ^ (state.index * 0xD1B54A32D192ED03u);
+					for (uint64_t& word : state.s) {
+						word = splitMix64(splitMixState);
+					}
+					state.generation = GENERATION;
+				}
+
+				return state;
+			}
+
+			uint64_t nextRandom(uint64_t* s) noexcept
+			{
+				const uint64_t RESULT = rotateLeft(s[0] + s[3], 23) + s[0];
+				const uint64_t T = s[1] << 17;
+
+				s[2] ^= s[0];
+				s[3] ^= s[1];
+				s[1] ^= s[2];
+				s[0] ^= s[3];
+				s[2] ^= T;
+				s[3] = rotateLeft(s[3], 45);
+
+				return RESULT;
+			}
+		}
+
+		// Public function(s)
+		void seedRandom(uint64_t newSeed) noexcept
+		{
+			seed.store(newSeed, std::memory_order_relaxed);
+			seedGeneration.fetch_add(1, std::memory_order_release);
+		}
+
+		uint64_t randomBits() noexcept
+		{
+			return nextRandom(getRandomState().s);
+		}
+
+		void randomBits(uint64_t* bits, size_t count) noexcept
+		{
+			// Work on a local copy of the state so it can be kept in registers
+			RandomState& state = getRandomState();
+			uint64_t s[4] = { state.s[0], state.s[1], state.s[2], state.s[3] };
+			for (size_t i = 0; i < count; ++i) {
+				bits[i] = nextRandom(s);
+			}
+
+			for (int i = 0; i < 4; ++i) {
+				state.s[i] = s[i];
+			}
+		}
+
+		namespace Fast
+		{
+			// Public function(s)
+			void sincos(const float* angles, float* sines, float* cosines, size_t count) noexcept
+			{
+				size_t i = 0;
+			#if defined(AEON_SIMD_SSE)
+				for (; i + 4 <= count; i += 4)
+				{
+					// Reduce the angles to [-pi/4,pi/4] and retrieve their quadrants
+					const __m128 ANGLE = _mm_loadu_ps(angles + i);
+					const __m128i QUADRANT = _mm_cvtps_epi32(_mm_mul_ps(ANGLE, _mm_set1_ps(0.636619772f)));
+					const __m128 Q = _mm_cvtepi32_ps(QUADRANT);
+					__m128 r = _mm_sub_ps(ANGLE, _mm_mul_ps(Q, _mm_set1_ps(1.5703125f)));
+					r = _mm_sub_ps(r, _mm_mul_ps(Q, _mm_set1_ps(4.837512969970703125e-4f)));
+					r = _mm_sub_ps(r, _mm_mul_ps(Q, _mm_set1_ps(7.54978995489188216e-8f)));
+
+					// Evaluate the polynomials of the reduced angles
+					const __m128 R2 = _mm_mul_ps(r, r);
+					__m128 sine = _mm_add_ps(_mm_set1_ps(8.3321608736e-3f), _mm_mul_ps(R2, _mm_set1_ps(-1.9515295891e-4f)));
+					sine = _mm_add_ps(_mm_set1_ps(-1.6666654611e-1f), _mm_mul_ps(R2, sine));
+					sine = _mm_add_ps(r, _mm_mul_ps(_mm_mul_ps(r, R2), sine));
+					__m128 cosine = _mm_add_ps(_mm_set1_ps(-1.388731625493765e-3f), _mm_mul_ps(R2, _mm_set1_ps(2.443315711809948e-5f)));
+					cosine = _mm_add_ps(_mm_set1_ps(4.166664568298827e-2f), _mm_mul_ps(R2, cosine));
+					cosine = _mm_add_ps(_mm_sub_ps(_mm_set1_ps(1.f), _mm_mul_ps(_mm_set1_ps(0.5f), R2)), _mm_mul_ps(_mm_mul_ps(R2, R2), cosine));
+
+					// Swap the results in the odd quadrants and negate them based on the quadrant
+					const __m128 SWAP = _mm_castsi128_ps(_mm_cmpeq_epi32(_mm_and_si128(QUADRANT, _mm_set1_epi32(1)), _mm_set1_epi32(1)));
+					const __m128 SINE = _mm_or_ps(_mm_and_ps(SWAP, cosine), _mm_andnot_ps(SWAP, sine));
+					const __m128 COSINE = _mm_or_ps(_mm_and_ps(SWAP, sine), _mm_andnot_ps(SWAP, cosine));
+					const __m128 SINE_SIGN = _mm_castsi128_ps(_mm_slli_epi32(_mm_and_si128(QUADRANT, _mm_set1_epi32(2)), 30));
+					const __m128 COSINE_SIGN = _mm_castsi128_ps(_mm_slli_epi32(_mm_and_si128(_mm_add_epi32(QUADRANT, _mm_set1_epi32(1)), _mm_set1_epi32(2)), 30));
+
+					_mm_storeu_ps(sines + i, _mm_xor_ps(SINE, SINE_SIGN));
+					_mm_storeu_ps(cosines + i, _mm_xor_ps(COSINE, COSINE_SIGN));
+				}
+			#elif defined(AEON_SIMD_NEON)
+				for (; i + 4 <= count; i += 4)
+				{
+					// Reduce the angles to [-pi/4,pi/4] and retrieve their quadrants (rounded half away from zero)
+					const float32x4_t ANGLE = vld1q_f32(angles + i);
+					const uint32x4_t ANGLE_SIGN = vandq_u32(vreinterpretq_u32_f32(ANGLE), vdupq_n_u32(0x80000000u));
+					const float32x4_t HALF = vreinterpretq_f32_u32(vorrq_u32(vreinterpretq_u32_f32(vdupq_n_f32(0.5f)), ANGLE_SIGN));
+					const int32x4_t QUADRANT = vcvtq_s32_f32(vmlaq_n_f32(HALF, ANGLE, 0.636619772f));
+					const float32x4_t Q = vcvtq_f32_s32(QUADRANT);
+					float32x4_t r = vmlsq_n_f32(ANGLE, Q, 1.5703125f);
+					r = vmlsq_n_f32(r, Q, 4.837512969970703125e-4f);
+					r = vmlsq_n_f32(r, Q, 7.54978995489188216e-8f);
+
+					// Evaluate the polynomials of the reduced angles
+					const float32x4_t R2 = vmulq_f32(r, r);
+					float32x4_t sine = vmlaq_n_f32(vdupq_n_f32(8.3321608736e-3f), R2, -1.9515295891e-4f);
+					sine = vmlaq_f32(vdupq_n_f32(-1.6666654611e-1f), R2, sine);
+					sine = vmlaq_f32(r, vmulq_f32(r, R2), sine);
+					float32x4_t cosine = vmlaq_n_f32(vdupq_n_f32(-1.388731625493765e-3f), R2, 2.443315711809948e-5f);
+					cosine = vmlaq_f32(vdupq_n_f32(4.166664568298827e-2f), R2, cosine);
+					cosine = vmlaq_f32(vmlsq_n_f32(vdupq_n_f32(1.f), R2, 0.5f), vmulq_f32(R2, R2), cosine);
+
+					// Swap the results in the odd quadrants and negate them based on the quadrant
+					const uint32x4_t SWAP = vtstq_s32(QUADRANT, vdupq_n_s32(1));
+					const float32x4_t SINE = vbslq_f32(SWAP, cosine, sine);
+					const float32x4_t COSINE = vbslq_f32(SWAP, sine, cosine);
+					const uint32x4_t SINE_SIGN = vshlq_n_u32(vandq_u32(vreinterpretq_u32_s32(QUADRANT), vdupq_n_u32(2)), 30);
+					const uint32x4_t COSINE_SIGN = vshlq_n_u32(vandq_u32(vreinterpretq_u32_s32(vaddq_s32(QUADRANT, vdupq_n_s32(1))), vdupq_n_u32(2)), 30);
+
+					vst1q_f32(sines + i, vreinterpretq_f32_u32(veorq_u32(vreinterpretq_u32_f32(SINE), SINE_SIGN)));
+					vst1q_f32(cosines + i, vreinterpretq_f32_u32(veorq_u32(vreinterpretq_u32_f32(COSINE), COSINE_SIGN)));
+				}
+			#endif
+
+				// Process the remaining angles
+				for (; i < count; ++i) {
+					sincos(angles[i], sines[i], cosines[i]);
+				}
+			}
+
+			void rsqrt(const float* values, float* results, size_t count) noexcept
+			{
+				size_t i = 0;
+			#if defined(AEON_SIMD_SSE)
+				for (; i + 4 <= count; i += 4)
+				{
+					// Refine the hardware estimate with a single Newton-Raphson iteration
+					const __m128 VALUE = _mm_loadu_ps(values + i);
+					const __m128 ESTIMATE = _mm_rsqrt_ps(VALUE);
+					const __m128 CORRECTION = _mm_sub_ps(_mm_set1_ps(1.5f), _mm_mul_ps(_mm_mul_ps(_mm_set1_ps(0.5f), VALUE), _mm_mul_ps(ESTIMATE, ESTIMATE)));
+					_mm_storeu_ps(results + i, _mm_mul_ps(ESTIMATE, CORRECTION));
+				}
+			#elif defined(AEON_SIMD_NEON)
+				for (; i + 4 <= count; i += 4)
+				{
+					// The hardware estimate is only precise to 8 bits, two Newton-Raphson iterations are necessary
+					const float32x4_t VALUE = vld1q_f32(values + i);
+					float32x4_t estimate = vrsqrteq_f32(VALUE);
+					estimate = vmulq_f32(estimate, vrsqrtsq_f32(vmulq_f32(VALUE, estimate), estimate));
+					estimate = vmulq_f32(estimate, vrsqrtsq_f32(vmulq_f32(VALUE, estimate), estimate));
+					vst1q_f32(results + i, estimate);
+				}
+			#endif
+
+				// Process the remaining values
+				for (; i < count; ++i) {
+					results[i] = rsqrt(values[i]);
+				}
+			}
+
+			void atan2(const float* y, const float* x, float* results, size_t count) noexcept
+			{
+				size_t i = 0;
+			#if defined(AEON_SIMD_SSE)
+				const __m128 SIGN_MASK = _mm_set1_ps(-0.f);
+				for (; i + 4 <= count; i += 4)
+				{
+					const __m128 Y = _mm_loadu_ps(y + i), X = _mm_loadu_ps(x + i);
+					const __m128 ABS_Y = _mm_andnot_ps(SIGN_MASK, Y), ABS_X = _mm_andnot_ps(SIGN_MASK, X);
+					const __m128 RATIO = _mm_div_ps(_mm_min_ps(ABS_Y, ABS_X), _mm_max_ps(_mm_max_ps(ABS_Y, ABS_X), _mm_set1_ps(1.17549435e-38f)));
+
+					// Evaluate the polynomial within [0,1]
+					const __m128 R2 = _mm_mul_ps(RATIO, RATIO);
+					__m128 angle = _mm_add_ps(_mm_set1_ps(0.05265332f), _mm_mul_ps(R2, _mm_set1_ps(-0.01172120f)));
+					angle = _mm_add_ps(_mm_set1_ps(-0.11643287f), _mm_mul_ps(R2, angle));
+					angle = _mm_add_ps(_mm_set1_ps(0.19354346f), _mm_mul_ps(R2, angle));
+					angle = _mm_add_ps(_mm_set1_ps(-0.33262347f), _mm_mul_ps(R2, angle));
+					angle = _mm_mul_ps(RATIO, _mm_add_ps(_mm_set1_ps(0.99997726f), _mm_mul_ps(R2, angle)));
+
+					// Map the results to their octants
+					const __m128 STEEP = _mm_cmpgt_ps(ABS_Y, ABS_X);
+					angle = _mm_or_ps(_mm_and_ps(STEEP, _mm_sub_ps(_mm_set1_ps(1.57079637f), angle)), _mm_andnot_ps(STEEP, angle));
+					const __m128 BACKWARD = _mm_cmplt_ps(X, _mm_setzero_ps());
+					angle = _mm_or_ps(_mm_and_ps(BACKWARD, _mm_sub_ps(_mm_set1_ps(3.14159274f), angle)), _mm_andnot_ps(BACKWARD, angle));
+
+					_mm_storeu_ps(results + i, _mm_or_ps(angle, _mm_and_ps(SIGN_MASK, Y)));
+				}
+			#elif defined(AEON_SIMD_NEON)
+				for (; i + 4 <= count; i += 4)
+				{
+					const float32x4_t Y = vld1q_f32(y + i), X = vld1q_f32(x + i);
+					const float32x4_t ABS_Y = vabsq_f32(Y), ABS_X = vabsq_f32(X);
+					const float32x4_t DENOMINATOR = vmaxq_f32(vmaxq_f32(ABS_Y, ABS_X), vdupq_n_f32(1.17549435e-38f));
+
+					// Divide with the reciprocal estimate refined by two Newton-Raphson iterations
+					float32x4_t reciprocal = vrecpeq_f32(DENOMINATOR);
+					reciprocal = vmulq_f32(reciprocal, vrecpsq_f32(DENOMINATOR, reciprocal));
+					reciprocal = vmulq_f32(reciprocal, vrecpsq_f32(DENOMINATOR, reciprocal));
+					const float32x4_t RATIO = vmulq_f32(vminq_f32(ABS_Y, ABS_X), reciprocal);
+
+					// Evaluate the polynomial within [0,1]
+					const float32x4_t R2 = vmulq_f32(RATIO, RATIO);
+					float32x4_t angle = vmlaq_n_f32(vdupq_n_f32(0.05265332f), R2, -0.01172120f);
+					angle = vmlaq_f32(vdupq_n_f32(-0.11643287f), R2, angle);
+					angle = vmlaq_f32(vdupq_n_f32(0.19354346f), R2, angle);
+					angle = vmlaq_f32(vdupq_n_f32(-0.33262347f), R2, angle);
+					angle = vmulq_f32(RATIO, vmlaq_f32(vdupq_n_f32(0.99997726f), R2, angle));
+
+					// Map the results to their octants
+					angle = vbslq_f32(vcgtq_f32(ABS_Y, ABS_X), vsubq_f32(vdupq_n_f32(1.57079637f), angle), angle);
+					angle = vbslq_f32(vcltq_f32(X, vdupq_n_f32(0.f)), vsubq_f32(vdupq_n_f32(3.14159274f), angle), angle);
+
+					const uint32x4_t Y_SIGN = vandq_u32(vreinterpretq_u32_f32(Y), vdupq_n_u32(0x80000000u));
+					vst1q_f32(results + i, vreinterpretq_f32_u32(vorrq_u32(vreinterpretq_u32_f32(angle), Y_SIGN)));
+				}
+			#endif
+
+				// Process the remaining points
+				for (; i < count; ++i) {
+					results[i] = atan2(y[i], x[i]);
+				}
+			}
+		}
+	}
+}
\ No newline at end of file
@@ -0,0 +1,197 @@
+// MIT License
+// 
+// Copyright(c) 2019-2021 Filippos Gleglakos
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#include <AEON/Math/Transform2D.h>
+
+#include <algorithm>
+
+#include <AEON/Math/internal/SIMD.h>
+#include <AEON/Graphics/Renderable2D.h>
+
+namespace ae
+{
+	// Public constructor(s)
+	Transform2D::Transform2D() noexcept
+		: xAxis(1.f, 0.f)
+		, yAxis(0.f, 1.f)
+		, translation(0.f, 0.f)
+		, depth(0.f)
+	{
+	}
+
+	Transform2D::Transform2D(const Vector2f& xAxis, const Vector2f& yAxis, const Vector2f& translation, float depth) noexcept
+		: xAxis(xAxis)
+		, yAxis(yAxis)
+		, translation(translation)
+		, depth(depth)
+	{
+	}
+
+	// Public operator(s)
+	Transform2D Transform2D::operator*(const Transform2D& other) const noexcept
+	{
+		return Transform2D(xAxis * other.xAxis.x + yAxis * other.xAxis.y,
+		                   xAxis * other.yAxis.x + yAxis * other.yAxis.y,
+		                   xAxis * other.translation.x + yAxis * other.translation.y + translation,
+		                   depth + other.depth);
+	}
+
+	Vector2f Transform2D::operator*(const Vector2f& point) const noexcept
+	{
+		return xAxis * point.x + yAxis * point.y + translation;
+	}
+
+	Transform2D& Transform2D::operator*=(const Transform2D& other) noexcept
+	{
+		return (*this = *this * other);
+	}
+
+	bool Transform2D::operator==(const Transform2D& other) const noexcept
+	{
+		return xAxis == other.xAxis && yAxis == other.yAxis && translation == other.translation && depth == other.depth;
+	}
+
+	bool Transform2D::operator!=(const Transform2D& other) const noexcept
+	{
+		return !(*this == other);
+	}
+
+	// Public method(s)
+	Transform2D Transform2D::invert() const noexcept
+	{
+		// Check if the linear part can be inverted
+		const float DETERMINANT = xAxis.x * yAxis.y - yAxis.x * xAxis.y;
+		if (DETERMINANT == 0.f) {
+			return Transform2D();
+		}
+
+		// Invert the linear part and apply it to the negated translation
+		const float INV_DET = 1.f / DETERMINANT;
+		const Vector2f INV_X_AXIS(yAxis.y * INV_DET, -xAxis.y * INV_DET);
+		const Vector2f INV_Y_AXIS(-yAxis.x * INV_DET, xAxis.x * INV_DET);
+
+		return Transform2D(INV_X_AXIS, INV_Y_AXIS, -(INV_X_AXIS * translation.x + INV_Y_AXIS * translation.y), -depth);
+	}
+
+	Matrix4f Transform2D::toMatrix4f() const noexcept
+	{
+		Matrix4f mat = Matrix4f::identity();
+		mat.columns[0][0] = xAxis.x;
+		mat.columns[0][1] = xAxis.y;
+		mat.columns[1][0] = yAxis.x;
+		mat.columns[1][1] = yAxis.y;
+		mat.columns[3][0] = translation.x;
+		mat.columns[3][1] = translation.y;
+		mat.columns[3][2] = depth;
+
+		return mat;
+	}
+
+	// Public static method(s)
+	Transform2D Transform2D::compose(const Vector3f& position, const Vector2f& scale, const Vector2f& origin, float rotation) noexcept
+	{
+		// The linear part is the rotation matrix whose columns are multiplied by the scale factors
+		const float COS = Math::cos(rotation);
+		const float SIN = Math::sin(rotation);
+		const Vector2f X_AXIS(COS * scale.x, SIN * scale.x);
+		const Vector2f Y_AXIS(-SIN * scale.y, COS * scale.y);
+
+		// The origin is brought to the position
+		return Transform2D(X_AXIS, Y_AXIS, Vector2f(position.x, position.y) - (X_AXIS * origin.x + Y_AXIS * origin.y), position.z);
+	}
+
+	namespace Math
+	{
+		void transformPoints2D(const Matrix4f& transform, const Vertex2D* in, Vertex2D* out, size_t count) noexcept
+		{
+			// Copy the vertices as a whole, only the XY positions are then overwritten
+			if (in != out) {
+				std::copy(in, in + count, out);
+			}
+
+			// Retrieve the elements of the transform involved in a 2D point transform (the first two rows of the columns 0, 1 and 3)
+			const float* const M = transform.elements.data();
+			size_t i = 0;
+
+		#if defined(AEON_SIMD_AVX)
+			// Transform 8 positions per iteration
+			const __m256 M0_8 = _mm256_set1_ps(M[0]), M1_8 = _mm256_set1_ps(M[1]), M4_8 = _mm256_set1_ps(M[4]);
+			const __m256 M5_8 = _mm256_set1_ps(M[5]), M12_8 = _mm256_set1_ps(M[12]), M13_8 = _mm256_set1_ps(M[13]);
+			for (; i + 8 <= count; i += 8) {
+				const Vertex2D* const v = in + i;
+				const __m256 X = _mm256_setr_ps(v[0].position.x, v[1].position.x, v[2].position.x, v[3].position.x, v[4].position.x, v[5].position.x, v[6].position.x, v[7].position.x);
+				const __m256 Y = _mm256_setr_ps(v[0].position.y, v[1].position.y, v[2].position.y, v[3].position.y, v[4].position.y, v[5].position.y, v[6].position.y, v[7].position.y);
+
+				alignas(32) float x[8], y[8];
+				_mm256_store_ps(x, _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(M0_8, X), _mm256_mul_ps(M4_8, Y)), M12_8));
+				_mm256_store_ps(y, _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(M1_8, X), _mm256_mul_ps(M5_8, Y)), M13_8));
+				for (size_t j = 0; j < 8; ++j) {
+					out[i + j].position.x = x[j];
+					out[i + j].position.y = y[j];
+				}
+			}
+		#endif
+		#if defined(AEON_SIMD_SSE)
+			// Transform 4 positions per iteration
+			const __m128 M0 = _mm_set1_ps(M[0]), M1 = _mm_set1_ps(M[1]), M4 = _mm_set1_ps(M[4]);
+			const __m128 M5 = _mm_set1_ps(M[5]), M12 = _mm_set1_ps(M[12]), M13 = _mm_set1_ps(M[13]);
+			for (; i + 4 <= count; i += 4) {
+				const Vertex2D* const v = in + i;
+				const __m128 X = _mm_setr_ps(v[0].position.x, v[1].position.x, v[2].position.x, v[3].position.x);
+				const __m128 Y = _mm_setr_ps(v[0].position.y, v[1].position.y, v[2].position.y, v[3].position.y);
+
+				alignas(16) float x[4], y[4];
+				_mm_store_ps(x, _mm_add_ps(_mm_add_ps(_mm_mul_ps(M0, X), _mm_mul_ps(M4, Y)), M12));
+				_mm_store_ps(y, _mm_add_ps(_mm_add_ps(_mm_mul_ps(M1, X), _mm_mul_ps(M5, Y)), M13));
+				for (size_t j = 0; j < 4; ++j) {
+					out[i + j].position.x = x[j];
+					out[i + j].position.y = y[j];
+				}
+			}
+		#elif defined(AEON_SIMD_NEON)
+			// Transform 4 positions per iteration
+			for (; i + 4 <= count; i += 4) {
+				const Vertex2D* const v = in + i;
+				const float xs[4] = { v[0].position.x, v[1].position.x, v[2].position.x, v[3].position.x };
+				const float ys[4] = { v[0].position.y, v[1].position.y, v[2].position.y, v[3].position.y };
+				const float32x4_t X = vld1q_f32(xs), Y = vld1q_f32(ys);
+
+				float x[4], y[4];
+				vst1q_f32(x, vmlaq_n_f32(vmlaq_n_f32(vdupq_n_f32(M[12]), X, M[0]), Y, M[4]));
+				vst1q_f32(y, vmlaq_n_f32(vmlaq_n_f32(vdupq_n_f32(M[13]), X, M[1]), Y, M[5]));
+				for (size_t j = 0; j < 4; ++j) {
+					out[i + j].position.x = x[j];
+					out[i + j].position.y = y[j];
+				}
+			}
+		#endif
+
+			// Transform the remaining positions
+			for (; i < count; ++i) {
+				const float X = in[i].position.x, Y = in[i].position.y;
+				out[i].position.x = M[0] * X + M[4] * Y + M[12];
+				out[i].position.y = M[1] * X + M[5] * Y + M[13];
+			}
+		}
+	}
+}
\ No newline at end of file
@@ -22,8 +22,13 @@
 
 #include <AEON/Math/internal/Quaternion.h>
 
+#include <AEON/Math/internal/SIMD.h>
+
 namespace ae
 {
+	// The SIMD kernels operate on the quaternions as arrays of 4 floats
+	static_assert(sizeof(Quaternion) == sizeof(float) * 4, "The ae::Quaternion must be laid out as [w, x, y, z]");
+
 	// Public constructor(s)
 	Quaternion::Quaternion() noexcept
 		: w(1.f)
@@ -98,11 +103,17 @@ namespace ae
 
 	Quaternion Quaternion::operator*(const Quaternion& other) const noexcept
 	{
+	#if AEON_SIMD
+		Quaternion product;
+		SIMD::multiplyQuaternion(&w, &other.w, &product.w);
+		return product;
+	#else
 		return Quaternion(
 			((w * other.w) - (x * other.x) - (y * other.y) - (z * other.z)),
 			((w * other.x) + (x * other.w) + (y * other.z) - (z * other.y)),
 			((w * other.y) - (x * other.z) + (y * other.w) + (z * other.x)),
 			((w * other.z) + (x * other.y) - (y * other.x) + (z * other.w)));
+	#endif
 	}
 
 	Quaternion Quaternion::operator*(float scalar) const noexcept
@@ -221,7 +232,17 @@ namespace ae
 	Quaternion Quaternion::normalize() const
 	{
 		const float MAGNITUDE = magnitude();
-		return (MAGNITUDE <= 0.f) ? Quaternion() : (*this / MAGNITUDE);
+		if (MAGNITUDE <= 0.f) {
+			return Quaternion();
+		}
+
+	#if AEON_SIMD
+		Quaternion unitQuat;
+		SIMD::scale4(&w, 1.f / MAGNITUDE, &unitQuat.w);
+		return unitQuat;
+	#else
+		return *this / MAGNITUDE;
+	#endif
 	}
 
 	float Quaternion::getAngle() const noexcept
@@ -277,4 +298,104 @@ namespace ae
 	{
 		return (q0.w * q1.w + q0.x * q1.x + q0.y * q1.y + q0.z * q1.z);
 	}
+
+	Quaternion Quaternion::nlerp(const Quaternion& q0, const Quaternion& q1, float t) noexcept
+	{
+		// Take the shortest path by negating the second weight if the quaternions lie in opposite hemispheres
+		const float WEIGHT1 = (dot(q0, q1) < 0.f) ? -t : t;
+		return (q0 * (1.f - t) + q1 * WEIGHT1).normalize();
+	}
+
+	Quaternion Quaternion::slerp(const Quaternion& q0, const Quaternion& q1, float t) noexcept
+	{
+		float weight0, weight1;
+		getSlerpWeights(q0, q1, t, weight0, weight1);
+
+		return (q0 * weight0 + q1 * weight1).normalize();
+	}
+
+	void Quaternion::multiply(const Quaternion* lhs, const Quaternion* rhs, Quaternion* result, size_t count) noexcept
+	{
+		size_t i = 0;
+	#if AEON_SIMD
+		for (; i + 4 <= count; i += 4) {
+			SIMD::multiplyQuaternions4(&lhs[i].w, &rhs[i].w, &result[i].w);
+		}
+	#endif
+		for (; i < count; ++i) {
+			result[i] = lhs[i] * rhs[i];
+		}
+	}
+
+	void Quaternion::normalize(const Quaternion* quats, Quaternion* result, size_t count) noexcept
+	{
+		size_t i = 0;
+	#if AEON_SIMD
+		// A blend with the weights 1 and 0 is the normalization of the first quaternions
+		const float ONES[4] = { 1.f, 1.f, 1.f, 1.f };
+		const float ZEROS[4] = { 0.f, 0.f, 0.f, 0.f };
+		for (; i + 4 <= count; i += 4) {
+			SIMD::blendQuaternions4(&quats[i].w, &quats[i].w, ONES, ZEROS, &result[i].w);
+		}
+	#endif
+		for (; i < count; ++i) {
+			result[i] = quats[i].normalize();
+		}
+	}
+
+	void Quaternion::nlerp(const Quaternion* q0, const Quaternion* q1, const float* t, Quaternion* result, size_t count) noexcept
+	{
+		size_t i = 0;
+	#if AEON_SIMD
+		for (; i + 4 <= count; i += 4) {
+			float weights0[4], weights1[4];
+			for (size_t j = 0; j < 4; ++j) {
+				weights0[j] = 1.f - t[i + j];
+				weights1[j] = (dot(q0[i + j], q1[i + j]) < 0.f) ? -t[i + j] : t[i + j];
+			}
+			SIMD::blendQuaternions4(&q0[i].w, &q1[i].w, weights0, weights1, &result[i].w);
+		}
+	#endif
+		for (; i < count; ++i) {
+			result[i] = nlerp(q0[i], q1[i], t[i]);
+		}
+	}
+
+	void Quaternion::slerp(const Quaternion* q0, const Quaternion* q1, const float* t, Quaternion* result, size_t count) noexcept
+	{
+		size_t i = 0;
+	#if AEON_SIMD
+		for (; i + 4 <= count; i += 4) {
+			float weights0[4], weights1[4];
+			for (size_t j = 0; j < 4; ++j) {
+				getSlerpWeights(q0[i + j], q1[i + j], t[i + j], weights0[j], weights1[j]);
+			}
+			SIMD::blendQuaternions4(&q0[i].w, &q1[i].w, weights0, weights1, &result[i].w);
+		}
+	#endif
+		for (; i < count; ++i) {
+			result[i] = slerp(q0[i], q1[i], t[i]);
+		}
+	}
+
+	// Private static method(s)
+	void Quaternion::getSlerpWeights(const Quaternion& q0, const Quaternion& q1, float t, float& weight0, float& weight1) noexcept
+	{
+		// Take the shortest path by negating the second weight if the quaternions lie in opposite hemispheres
+		const float DOT = dot(q0, q1);
+		const float SIGN = (DOT < 0.f) ? -1.f : 1.f;
+		const float COS_THETA = DOT * SIGN;
+
+		// Fall back to the linear weights if the quaternions are nearly parallel as the sine then tends to 0
+		if (COS_THETA > 0.9995f) {
+			weight0 = 1.f - t;
+			weight1 = t * SIGN;
+			return;
+		}
+
+		const float THETA = Math::acos(COS_THETA);
+		const float INV_SIN_THETA = 1.f / Math::sin(THETA);
+		weight0 = Math::sin((1.f - t) * THETA) * INV_SIN_THETA;
+		weight1 = Math::sin(t * THETA) * INV_SIN_THETA * SIGN;
+	}
 }
\ No newline at end of file
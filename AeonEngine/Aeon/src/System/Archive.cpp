@@ -0,0 +1,485 @@
+// MIT License
+// 
+// Copyright(c) 2019-2021 Filippos Gleglakos
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <AEON/System/Archive.h>
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <limits>
+
+#include <AEON/System/DebugLogger.h>
+
+namespace ae
+{
+	namespace
+	{
+		// The identifier and version of the archives
+		// Layout: identifier, version, entry count, string table size, index offset | contents | index | string table
+		constexpr char     ARCHIVE_IDENTIFIER[4] = { 'A', 'E', 'P', 'K' };
+		constexpr uint32_t ARCHIVE_VERSION = 1;
+		constexpr size_t   HEADER_SIZE = sizeof(ARCHIVE_IDENTIFIER) + sizeof(uint32_t) * 3 + sizeof(uint64_t);
+		// Index entry: hash, offset, stored size, size, path offset, path length, compression
+		constexpr size_t   ENTRY_SIZE = sizeof(uint64_t) * 4 + sizeof(uint32_t) + sizeof(uint16_t) * 2;
+
+		// The constraints of the LZ4 block format: the last match starts 12 bytes before the end at the latest and the last 5 bytes are literals
+		constexpr size_t   LZ4_MIN_MATCH = 4;
+		constexpr size_t   LZ4_MATCH_LIMIT = 12;
+		constexpr size_t   LZ4_LAST_LITERALS = 5;
+		constexpr size_t   LZ4_MAX_OFFSET = 65535;
+		constexpr unsigned LZ4_HASH_BITS = 16;
+
+		// Read a little-endian value from the data (the pointer is assumed to be within bounds)
+		template <typename T>
+		T readValue(const uint8_t* data) noexcept
+		{
+			T value = 0;
+			std::memcpy(&value, data, sizeof(T));
+			return value;
+		}
+
+		// Append a little-endian value to the contents
+		template <typename T>
+		void appendValue(std::string& contents, T value)
+		{
+			contents.append(reinterpret_cast<const char*>(&value), sizeof(T));
+		}
+
+		// Compute the 64-bit FNV-1a hash of a path
+		uint64_t hashPath(const std::string& path) noexcept
+		{
+			uint64_t hash = 0xCBF29CE484222325ull;
+			for (const char C : path) {
+				hash ^= static_cast<uint8_t>(C);
+				hash *= 0x100000001B3ull;
+			}
+
+			return hash;
+		}
+
+		// Append a length that doesn't fit in a token's 4 bits (the 15 stored in the token is subtracted beforehand)
+		void appendLength(std::vector<uint8_t>& output, size_t length)
+		{
+			for (length -= 15; length >= 255; length -= 255) {
+				output.push_back(255);
+			}
+			output.push_back(static_cast<uint8_t>(length));
+		}
+
+		// Append a sequence of literals followed by a match (a match length of 0 marks the last sequence, which only holds literals)
+		void appendSequence(std::vector<uint8_t>& output, const uint8_t* literals, size_t literalLength, size_t offset, size_t matchLength)
+		{
+			const size_t MATCH_CODE = (matchLength > 0) ? matchLength - LZ4_MIN_MATCH : 0;
+			output.push_back(static_cast<uint8_t>((std::min<size_t>(literalLength, 15) << 4) | std::min<size_t>(MATCH_CODE, 15)));
+			if (literalLength >= 15) {
+				appendLength(output, literalLength);
+			}
+			output.insert(output.end(), literals, literals + literalLength);
+
+			if (matchLength > 0) {
+				output.push_back(static_cast<uint8_t>(offset & 0xFF));
+				output.push_back(static_cast<uint8_t>(offset >> 8));
+				if (MATCH_CODE >= 15) {
+					appendLength(output, MATCH_CODE);
+				}
+			}
+		}
+
+		// Compress the data with the LZ4 block format, using a greedy search of the last occurrence of each 4-byte sequence
+		std::vector<uint8_t> compressLZ4(const uint8_t* data, size_t size)
+		{
+			std::vector<uint8_t> output;
+			output.reserve(size + size / 255 + 16);
+
+			std::vector<uint32_t> table(size_t(1) << LZ4_HASH_BITS, std::numeric_limits<uint32_t>::max());
+			size_t anchor = 0, position = 0;
+			while (size > LZ4_MATCH_LIMIT && position < size - LZ4_MATCH_LIMIT)
+			{
+				const uint32_t SEQUENCE = readValue<uint32_t>(data + position);
+				const uint32_t HASH = (SEQUENCE * 2654435761u) >> (32 - LZ4_HASH_BITS);
+				const uint32_t CANDIDATE = table[HASH];
+				table[HASH] = static_cast<uint32_t>(position);
+				if (CANDIDATE == std::numeric_limits<uint32_t>::max() || position - CANDIDATE > LZ4_MAX_OFFSET || readValue<uint32_t>(data + CANDIDATE) != SEQUENCE) {
+					++position;
+					continue;
+				}
+
+				// Extend the match, which mustn't reach the last literals
+				size_t length = LZ4_MIN_MATCH;
+				while (position + length < size - LZ4_LAST_LITERALS && data[CANDIDATE + length] == data[position + length]) {
+					++length;
+				}
+
+				appendSequence(output, data + anchor, position - anchor, position - CANDIDATE, length);
+				position += length;
+				anchor = position;
+			}
+
+			appendSequence(output, data + anchor, size - anchor, 0, 0);
+			return output;
+		}
+
+		// Read a length that didn't fit in a token's 4 bits
+		bool readLength(const uint8_t*& input, const uint8_t* end, size_t& length) noexcept
+		{
+			if (length != 15) {
+				return true;
+			}
+
+			uint8_t byte = 0;
+			do {
+				if (input == end) {
+					return false;
+				}
+				byte = *input++;
+				length += byte;
+			} while (byte == 255);
+
+			return true;
+		}
+
+		// Decompress the LZ4 block into the output, which must be filled entirely (the block is checked as it may be corrupted)
+		bool decompressLZ4(const uint8_t* input, size_t inputSize, uint8_t* output, size_t outputSize) noexcept
+		{
+			const uint8_t* const END = input + inputSize;
+			size_t written = 0;
+			while (input < END)
+			{
+				// Copy the literals
+				const uint8_t TOKEN = *input++;
+				size_t literalLength = TOKEN >> 4;
+				if (!readLength(input, END, literalLength) || literalLength > static_cast<size_t>(END - input) || literalLength > outputSize - written) {
+					return false;
+				}
+				std::memcpy(output + written, input, literalLength);
+				input += literalLength;
+				written += literalLength;
+
+				// The last sequence only holds literals
+				if (input == END) {
+					break;
+				}
+
+				// Copy the match byte per byte as it may overlap with itself
+				if (END - input < 2) {
+					return false;
+				}
+				const size_t OFFSET = input[0] | (static_cast<size_t>(input[1]) << 8);
+				input += 2;
+				size_t matchLength = TOKEN & 0x0F;
+				if (OFFSET == 0 || OFFSET > written || !readLength(input, END, matchLength) || matchLength + LZ4_MIN_MATCH > outputSize - written) {
+					return false;
+				}
+				matchLength += LZ4_MIN_MATCH;
+				for (size_t i = 0; i < matchLength; ++i, ++written) {
+					output[written] = output[written - OFFSET];
+				}
+			}
+
+			return written == outputSize;
+		}
+
+		// Read the whole file on disk into memory (the mounted archives are bypassed as the files packed come from the disk)
+		bool readDiskFile(const std::string& filepath, std::vector<uint8_t>& data)
+		{
+			std::ifstream file(filepath, std::ios::binary | std::ios::ate);
+			if (!file) {
+				return false;
+			}
+
+			const std::streamoff SIZE = file.tellg();
+			data.resize(static_cast<size_t>(SIZE));
+			file.seekg(0);
+			return SIZE == 0 || static_cast<bool>(file.read(reinterpret_cast<char*>(data.data()), static_cast<std::streamsize>(SIZE)));
+		}
+	}
+
+		// Public constructor(s)
+	Archive::Archive() noexcept
+		: mMapping()
+		, mIndex(nullptr)
+		, mStrings(nullptr)
+		, mStringSize(0)
+		, mEntryCount(0)
+		, mFilepath()
+	{
+	}
+
+		// Public method(s)
+	bool Archive::open(const std::string& filepath)
+	{
+		close();
+
+		// Map the archive and check its header
+		auto mapping = std::make_shared<FileSystem::MappedFile>(FileSystem::mapFile(filepath));
+		const uint8_t* const DATA = mapping->data();
+		const size_t SIZE = mapping->size();
+		if (!mapping->isOpen() || SIZE < HEADER_SIZE || std::memcmp(DATA, ARCHIVE_IDENTIFIER, sizeof(ARCHIVE_IDENTIFIER)) != 0
+		                       || readValue<uint32_t>(DATA + 4) != ARCHIVE_VERSION) {
+			return false;
+		}
+
+		// Check that the index and the string table are within the archive's bounds
+		const uint32_t ENTRY_COUNT = readValue<uint32_t>(DATA + 8);
+		const uint32_t STRING_SIZE = readValue<uint32_t>(DATA + 12);
+		const uint64_t INDEX_OFFSET = readValue<uint64_t>(DATA + 16);
+		if (INDEX_OFFSET < HEADER_SIZE || INDEX_OFFSET > SIZE || (SIZE - INDEX_OFFSET) != static_cast<uint64_t>(ENTRY_COUNT) * ENTRY_SIZE + STRING_SIZE) {
+			return false;
+		}
+
+		mIndex = DATA + INDEX_OFFSET;
+		mStrings = reinterpret_cast<const char*>(mIndex + static_cast<size_t>(ENTRY_COUNT) * ENTRY_SIZE);
+		mStringSize = STRING_SIZE;
+		mEntryCount = ENTRY_COUNT;
+		mMapping = std::move(mapping);
+		mFilepath = filepath;
+
+		return true;
+	}
+
+	void Archive::close() noexcept
+	{
+		mMapping.reset();
+		mIndex = nullptr;
+		mStrings = nullptr;
+		mStringSize = 0;
+		mEntryCount = 0;
+		mFilepath.clear();
+	}
+
+	bool Archive::contains(const std::string& path) const
+	{
+		Entry entry;
+		return find(path, entry);
+	}
+
+	FileSystem::MappedFile Archive::map(const std::string& path) const
+	{
+		FileSystem::MappedFile file;
+		Entry entry;
+		if (!find(path, entry)) {
+			return file;
+		}
+
+		// View the uncompressed entries directly, the view keeping the archive mapped
+		const uint8_t* const CONTENTS = mMapping->data() + entry.offset;
+		if (entry.compression == Compression::None) {
+			file.mOwner = mMapping;
+			file.mData = CONTENTS;
+			file.mSize = static_cast<size_t>(entry.size);
+			file.mOpen = true;
+			return file;
+		}
+
+		// Decompress the other entries into memory owned by the view
+		auto buffer = std::make_shared<std::vector<uint8_t>>(static_cast<size_t>(entry.size));
+		if (entry.compression != Compression::LZ4 || !decompressLZ4(CONTENTS, static_cast<size_t>(entry.storedSize), buffer->data(), buffer->size())) {
+			AEON_LOG_ERROR("Corrupted archive entry", "The entry \"" + path + "\" of the archive \"" + mFilepath + "\" couldn't be decompressed.\nAborting operation.");
+			return file;
+		}
+		file.mData = buffer->data();
+		file.mSize = buffer->size();
+		file.mOwner = std::move(buffer);
+		file.mOpen = true;
+
+		return file;
+	}
+
+	bool Archive::read(const std::string& path, std::vector<uint8_t>& buffer) const
+	{
+		const FileSystem::MappedFile FILE_VIEW = map(path);
+		if (!FILE_VIEW.isOpen()) {
+			return false;
+		}
+
+		buffer.assign(FILE_VIEW.data(), FILE_VIEW.data() + FILE_VIEW.size());
+		return true;
+	}
+
+	bool Archive::isOpen() const noexcept
+	{
+		return mMapping != nullptr;
+	}
+
+	size_t Archive::getEntryCount() const noexcept
+	{
+		return mEntryCount;
+	}
+
+	const std::string& Archive::getFilepath() const noexcept
+	{
+		return mFilepath;
+	}
+
+		// Public static method(s)
+	bool Archive::pack(const std::string& archivePath, const std::vector<std::string>& filepaths, Compression compression)
+	{
+		// Sort the files by the hash of their normalized paths, which is the order of the index
+		std::vector<std::pair<uint64_t, std::string>> paths;
+		paths.reserve(filepaths.size());
+		for (const std::string& filepath : filepaths) {
+			std::string path = normalizePath(filepath);
+			if (path.empty() || path.size() > std::numeric_limits<uint16_t>::max()) {
+				AEON_LOG_ERROR("Invalid archive entry", "The path \"" + filepath + "\" can't be stored in an archive.\nAborting operation.");
+				return false;
+			}
+			const uint64_t HASH = hashPath(path);
+			paths.emplace_back(HASH, std::move(path));
+		}
+		std::sort(paths.begin(), paths.end());
+		const auto DUPLICATE = std::adjacent_find(paths.begin(), paths.end());
+		if (DUPLICATE != paths.end()) {
+			AEON_LOG_ERROR("Invalid archive entry", "The path \"" + DUPLICATE->second + "\" was provided more than once.\nAborting operation.");
+			return false;
+		}
+
+		std::ofstream file(archivePath, std::ios::binary | std::ios::trunc);
+		if (!file) {
+			AEON_LOG_ERROR("Invalid filepath", "Unable to create the archive at \"" + archivePath + "\".\nAborting operation.");
+			return false;
+		}
+
+		// Write the contents of the entries after the header, compressing those that shrink
+		std::string index, strings;
+		index.reserve(paths.size() * ENTRY_SIZE);
+		uint64_t offset = HEADER_SIZE;
+		file.seekp(HEADER_SIZE);
+		std::vector<uint8_t> contents;
+		for (const std::pair<uint64_t, std::string>& path : paths) {
+			if (!readDiskFile(path.second, contents)) {
+				AEON_LOG_ERROR("Invalid filepath", "Unable to read the file at \"" + path.second + "\" to pack it.\nAborting operation.");
+				return false;
+			}
+
+			Compression entryCompression = Compression::None;
+			std::vector<uint8_t> compressed;
+			if (compression == Compression::LZ4 && contents.size() < std::numeric_limits<uint32_t>::max()) {
+				compressed = compressLZ4(contents.data(), contents.size());
+				if (compressed.size() < contents.size()) {
+					entryCompression = Compression::LZ4;
+				}
+			}
+			const std::vector<uint8_t>& STORED = (entryCompression == Compression::LZ4) ? compressed : contents;
+			file.write(reinterpret_cast<const char*>(STORED.data()), static_cast<std::streamsize>(STORED.size()));
+
+			appendValue<uint64_t>(index, path.first);
+			appendValue<uint64_t>(index, offset);
+			appendValue<uint64_t>(index, STORED.size());
+			appendValue<uint64_t>(index, contents.size());
+			appendValue<uint32_t>(index, static_cast<uint32_t>(strings.size()));
+			appendValue<uint16_t>(index, static_cast<uint16_t>(path.second.size()));
+			appendValue<uint16_t>(index, static_cast<uint16_t>(entryCompression));
+			strings += path.second;
+			offset += STORED.size();
+		}
+		if (strings.size() > std::numeric_limits<uint32_t>::max()) {
+			AEON_LOG_ERROR("Invalid archive", "The paths of the files packed are too long to be stored.\nAborting operation.");
+			return false;
+		}
+
+		// Write the index and the string table, followed by the header which references them
+		file.write(index.data(), static_cast<std::streamsize>(index.size()));
+		file.write(strings.data(), static_cast<std::streamsize>(strings.size()));
+
+		std::string header(ARCHIVE_IDENTIFIER, sizeof(ARCHIVE_IDENTIFIER));
+		appendValue<uint32_t>(header, ARCHIVE_VERSION);
+		appendValue<uint32_t>(header, static_cast<uint32_t>(paths.size()));
+		appendValue<uint32_t>(header, static_cast<uint32_t>(strings.size()));
+		appendValue<uint64_t>(header, offset);
+		file.seekp(0);
+		file.write(header.data(), static_cast<std::streamsize>(header.size()));
+
+		if (!file.flush()) {
+			AEON_LOG_ERROR("Failed to write archive", "Unable to write the archive at \"" + archivePath + "\".\nAborting operation.");
+			return false;
+		}
+
+		return true;
+	}
+
+		// Private method(s)
+	bool Archive::find(const std::string& path, Entry& entry) const
+	{
+		if (!mMapping) {
+			return false;
+		}
+
+		// Find the first entry whose hash isn't lower than the path's
+		const std::string NORMALIZED_PATH = normalizePath(path);
+		const uint64_t HASH = hashPath(NORMALIZED_PATH);
+		uint32_t first = 0, count = mEntryCount;
+		while (count > 0) {
+			const uint32_t HALF = count / 2;
+			if (readValue<uint64_t>(mIndex + static_cast<size_t>(first + HALF) * ENTRY_SIZE) < HASH) {
+				first += HALF + 1;
+				count -= HALF + 1;
+			}
+			else {
+				count = HALF;
+			}
+		}
+
+		// Compare the paths of the entries sharing the hash to resolve collisions, their bounds being checked as the archive may be corrupted
+		for (; first < mEntryCount; ++first) {
+			const uint8_t* const RECORD = mIndex + static_cast<size_t>(first) * ENTRY_SIZE;
+			if (readValue<uint64_t>(RECORD) != HASH) {
+				break;
+			}
+
+			entry.hash = HASH;
+			entry.offset = readValue<uint64_t>(RECORD + 8);
+			entry.storedSize = readValue<uint64_t>(RECORD + 16);
+			entry.size = readValue<uint64_t>(RECORD + 24);
+			entry.pathOffset = readValue<uint32_t>(RECORD + 32);
+			entry.pathLength = readValue<uint16_t>(RECORD + 36);
+			entry.compression = static_cast<Compression>(readValue<uint16_t>(RECORD + 38));
+
+			const uint64_t INDEX_OFFSET = static_cast<uint64_t>(mIndex - mMapping->data());
+			if (static_cast<uint64_t>(entry.pathOffset) + entry.pathLength > mStringSize || entry.offset < HEADER_SIZE || entry.offset > INDEX_OFFSET
+			                                                                          || entry.storedSize > INDEX_OFFSET - entry.offset) {
+				continue;
+			}
+			if ((entry.compression == Compression::None && entry.storedSize != entry.size) || entry.size / 255 > entry.storedSize) {
+				continue;
+			}
+			if (NORMALIZED_PATH.compare(0, std::string::npos, mStrings + entry.pathOffset, entry.pathLength) == 0) {
+				return true;
+			}
+		}
+
+		return false;
+	}
+
+		// Private static method(s)
+	std::string Archive::normalizePath(const std::string& path)
+	{
+		std::string normalizedPath = path;
+		std::replace(normalizedPath.begin(), normalizedPath.end(), '\\', '/');
+
+		size_t start = 0;
+		while (normalizedPath.compare(start, 2, "./") == 0) {
+			start += 2;
+		}
+
+		return normalizedPath.substr(start);
+	}
+}
\ No newline at end of file
@@ -0,0 +1,143 @@
+// MIT License
+// 
+// Copyright(c) 2019-2021 Filippos Gleglakos
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <AEON/System/Benchmark.h>
+
+#include <algorithm>
+#include <iomanip>
+#include <sstream>
+
+#ifdef _MSC_VER
+	#include <intrin.h>
+#endif
+
+#include <AEON/System/FileSystem.h>
+
+namespace ae
+{
+	// Public constructor(s)
+	Benchmark::Benchmark(const Time& minTime, unsigned int repetitions)
+		: mResults()
+		, mMinTime(minTime)
+		, mRepetitions(std::max(repetitions, 1u))
+	{
+	}
+
+	// Public method(s)
+	void Benchmark::clear() noexcept
+	{
+		mResults.clear();
+	}
+
+	const std::vector<Benchmark::Result>& Benchmark::getResults() const noexcept
+	{
+		return mResults;
+	}
+
+	std::string Benchmark::toString() const
+	{
+		// Align the names on the longest one
+		size_t nameWidth = 9;
+		for (const Result& result : mResults) {
+			nameWidth = std::max(nameWidth, result.name.size());
+		}
+
+		std::ostringstream table;
+		table << std::left << std::setw(nameWidth) << "Operation" << std::right << std::setw(14) << "iterations"
+		      << std::setw(12) << "min (ns)" << std::setw(12) << "median (ns)" << std::setw(12) << "mean (ns)";
+		table << std::fixed << std::setprecision(2);
+		for (const Result& result : mResults) {
+			table << "\n" << std::left << std::setw(nameWidth) << result.name << std::right << std::setw(14) << result.iterations
+			      << std::setw(12) << result.minimum << std::setw(12) << result.median << std::setw(12) << result.mean;
+		}
+
+		return table.str();
+	}
+
+	std::string Benchmark::toJSON() const
+	{
+		std::ostringstream json;
+		json << std::fixed << std::setprecision(3) << "{\"benchmarks\":[";
+		for (size_t i = 0; i < mResults.size(); ++i) {
+			const Result& result = mResults[i];
+
+			// Escape the characters that would otherwise invalidate the name's string
+			std::string name;
+			for (const char c : result.name) {
+				if (c == '"' || c == '\\') {
+					name += '\\';
+				}
+				name += (c < ' ') ? ' ' : c;
+			}
+
+			json << ((i == 0) ? "" : ",") << "\n{\"name\":\"" << name << "\",\"iterations\":" << result.iterations
+			     << ",\"min_ns\":" << result.minimum << ",\"median_ns\":" << result.median << ",\"mean_ns\":" << result.mean << "}";
+		}
+		json << "\n]}";
+
+		return json.str();
+	}
+
+	void Benchmark::exportJSON(const std::string& filepath) const
+	{
+		FileSystem::writeFile(filepath, toJSON(), FileSystem::OpenMode::Truncate);
+	}
+
+	// Public static method(s)
+	void Benchmark::clobberMemory() noexcept
+	{
+	#if defined(__GNUC__) || defined(__clang__)
+		asm volatile("" : : : "memory");
+	#elif defined(_MSC_VER)
+		_ReadWriteBarrier();
+	#endif
+	}
+
+	// Private method(s)
+	const Benchmark::Result& Benchmark::addResult(const std::string& name, uint64_t iterations, std::vector<int64_t>& durations)
+	{
+		std::sort(durations.begin(), durations.end());
+
+		int64_t total = 0;
+		for (const int64_t DURATION : durations) {
+			total += DURATION;
+		}
+
+		const double ITERATIONS = static_cast<double>(iterations);
+		Result result;
+		result.name = name;
+		result.iterations = iterations;
+		result.minimum = static_cast<double>(durations.front()) / ITERATIONS;
+		result.median = static_cast<double>(durations[durations.size() / 2]) / ITERATIONS;
+		result.mean = static_cast<double>(total) / static_cast<double>(durations.size()) / ITERATIONS;
+
+		mResults.push_back(std::move(result));
+		return mResults.back();
+	}
+
+	// Private static method(s)
+	void Benchmark::useCharPointer(const volatile char* pointer) noexcept
+	{
+		// The address escaping to another translation unit keeps the value it points to alive
+		static_cast<void>(pointer);
+	}
+}
\ No newline at end of file
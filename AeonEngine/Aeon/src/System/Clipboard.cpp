@@ -26,17 +26,43 @@
 
 namespace ae
 {
+	namespace
+	{
+		// The contents of the clipboard last retrieved or set, and whether they're still up to date
+		std::string cachedString;
+		bool cacheValid = false;
+	}
+
 	namespace Clipboard
 	{
 		// Function(s)
 		void setString(const std::string& string)
 		{
 			glfwSetClipboardString(nullptr, string.c_str());
+			cachedString = string;
+			cacheValid = true;
 		}
 
 		std::string getString()
 		{
-			return glfwGetClipboardString(nullptr);
+			return std::string(getStringView());
+		}
+
+		std::string_view getStringView()
+		{
+			if (!cacheValid) {
+				// The clipboard may be empty or not contain text
+				const char* const STRING = glfwGetClipboardString(nullptr);
+				cachedString.assign((STRING) ? STRING : "");
+				cacheValid = true;
+			}
+
+			return cachedString;
+		}
+
+		void invalidateCache() noexcept
+		{
+			cacheValid = false;
 		}
 	}
 }
\ No newline at end of file
@@ -20,30 +20,37 @@
 // OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
 // SOFTWARE.
 
+
 #include <AEON/System/Clock.h>
 
-#include <GLFW/glfw3.h>
+#include <chrono>
 
 namespace ae
 {
 	// Public constructor(s)
-	Clock::Clock()
-		: mStartTime(Time::seconds(glfwGetTime()))
+	Clock::Clock() noexcept
+		: mStartTime(getCurrentTime())
 	{
 	}
 
 	// Public method(s)
-	Time Clock::getElapsedTime() const
+	Time Clock::getElapsedTime() const noexcept
 	{
-		return Time::seconds(glfwGetTime() - mStartTime.asSeconds());
+		return getCurrentTime() - mStartTime;
 	}
 
-	Time Clock::restart()
+	Time Clock::restart() noexcept
 	{
-		const Time CURRENT_TIME = Time::seconds(glfwGetTime());
+		const Time CURRENT_TIME = getCurrentTime();
 		const Time ELAPSED_TIME = CURRENT_TIME - mStartTime;
 		mStartTime = CURRENT_TIME;
 
 		return ELAPSED_TIME;
 	}
+
+	// Public static method(s)
+	Time Clock::getCurrentTime() noexcept
+	{
+		return Time::nanoseconds(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+	}
 }
\ No newline at end of file
@@ -1,24 +1,40 @@
 #include <AEON/System/DebugLogger.h>
 
+#include <chrono>
 #include <string>
 #include <iostream>
 #include <ctime>
+#include <iterator>
 
-#include <AEON/System/FileSystem.h>
+#include <AEON/System/MemoryTracker.h>
 #include <AEON/System/Time.h>
 
 namespace ae
 {
+	namespace
+	{
+		// The number of slots of the ring (a power of two)
+		constexpr size_t RING_CAPACITY = 1024;
+		// The period at which the background thread checks the ring, in case a notification was missed
+		constexpr std::chrono::milliseconds WAKE_PERIOD(100);
+	}
+
 	// DebugLogger::Log
 		// Public Constructor(s)
 	DebugLogger::Log::Log(std::string&& title, std::string&& description, std::string&& file,
-	                      std::string&& function, Log::Level level, int line)
+	                      std::string&& function, Log::Level level, int line, unsigned int suppressedCount)
 		: formattedInfo()
 		, metadata("File: " + file +  "\nLine: " + std::to_string(line) + "\nFunction: " + function)
 		, description(std::move(description))
 		, title(std::move(title))
 		, level(level)
+		, suppressedCount(suppressedCount)
 	{
+		// Report the logs of the same call site that were suppressed by the rate limit
+		if (suppressedCount > 0) {
+			metadata += "\nSuppressed: " + std::to_string(suppressedCount) + " logs since the previous one";
+		}
+
 		// Create a string of the level of importance
 		std::string levelStr = "Info";
 		switch (level)
@@ -51,30 +67,104 @@ namespace ae
 	}
 
 	// DebugLogger
+		// Public Method(s)
+	DebugLogger::~DebugLogger()
+	{
+		{
+			std::lock_guard<std::mutex> lock(mMutex);
+			mExit = true;
+		}
+		mWakeCondition.notify_one();
+		mThread.join();
+	}
+
 		// Public Method(s)
 	void DebugLogger::log(std::string&& title, std::string&& description, std::string&& file,
-	                      std::string&& function, Log::Level level, int line)
+	                      std::string&& function, Log::Level level, int line, unsigned int suppressedCount)
 	{
-		// Take ownership of the log
-		Log& ownedLog = mLogs.emplace_back(std::forward<std::string>(title), std::forward<std::string>(description), std::forward<std::string>(file),
-		                                   std::forward<std::string>(function), level, line);
+		push(std::move(title), std::move(description), nullptr, std::move(file), std::move(function), level, line, suppressedCount);
+	}
+
+	void DebugLogger::setMinimumLevel(Log::Level level) noexcept
+	{
+		mMinimumLevel.store(static_cast<int>(level), std::memory_order_relaxed);
+	}
+
+	bool DebugLogger::isLevelEnabled(Log::Level level) const noexcept
+	{
+		return static_cast<int>(level) >= mMinimumLevel.load(std::memory_order_relaxed);
+	}
+
+	bool DebugLogger::acquire(CallSite& callSite, unsigned int& suppressedCount) const noexcept
+	{
+		const unsigned int LIMIT = mRateLimit.load(std::memory_order_relaxed);
+		if (LIMIT == 0) {
+			suppressedCount = callSite.suppressedCount.exchange(0, std::memory_order_relaxed);
+			return true;
+		}
 
-		// Display the log to the console (ignored in Release mode)
-		if _CONSTEXPR_IF (AEON_DEBUG) {
-			std::cerr << ownedLog << "\n";
+		// Start a new window once the interval has elapsed (a single thread restarts it)
+		const int64_t NOW = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+		int64_t windowStart = callSite.windowStart.load(std::memory_order_relaxed);
+		if (NOW - windowStart >= mRateInterval.load(std::memory_order_relaxed) && callSite.windowStart.compare_exchange_strong(windowStart, NOW, std::memory_order_relaxed)) {
+			callSite.windowCount.store(0, std::memory_order_relaxed);
 		}
-		// Append the log to the log file on disk
-		FileSystem::writeFile(mErrorLog, ownedLog.formattedInfo, FileSystem::OpenMode::Append);
+
+		// Suppress the logs beyond the limit, they're reported by the next log emitted
+		if (callSite.windowCount.fetch_add(1, std::memory_order_relaxed) >= LIMIT) {
+			callSite.suppressedCount.fetch_add(1, std::memory_order_relaxed);
+			return false;
+		}
+
+		suppressedCount = callSite.suppressedCount.exchange(0, std::memory_order_relaxed);
+		return true;
+	}
+
+	void DebugLogger::setRateLimit(unsigned int count, const Time& interval) noexcept
+	{
+		mRateLimit.store(count, std::memory_order_relaxed);
+		mRateInterval.store(interval.asMicroseconds(), std::memory_order_relaxed);
 	}
 
 	std::list<DebugLogger::Log> DebugLogger::getLogs() noexcept
 	{
-		std::list<Log> logs;
-		mLogs.swap(logs);
-	
+		flush();
+
+		std::lock_guard<std::mutex> lock(mMutex);
+		std::list<Log> logs(std::make_move_iterator(mLogs.begin()), std::make_move_iterator(mLogs.end()));
+		mLogs.clear();
+
 		return logs;
 	}
 
+	void DebugLogger::flush()
+	{
+		// The logs whose slot were reserved so far are waited upon
+		const size_t TARGET = mWritePosition.load(std::memory_order_acquire);
+		std::unique_lock<std::mutex> lock(mMutex);
+		mWakeCondition.notify_one();
+		mFlushCondition.wait(lock, [this, TARGET]() { return mWrittenCount >= TARGET || mExit; });
+	}
+
+	void DebugLogger::setHistoryCapacity(size_t capacity)
+	{
+		std::lock_guard<std::mutex> lock(mMutex);
+		mHistoryCapacity = capacity;
+		while (mLogs.size() > mHistoryCapacity) {
+			mLogs.pop_front();
+		}
+	}
+
+	void DebugLogger::setMemoryResource(std::pmr::memory_resource* resource)
+	{
+		// The stored logs are moved out so that nothing is allocated from the previous resource once it's replaced
+		std::lock_guard<std::mutex> lock(mMutex);
+		std::list<Log> logs(std::make_move_iterator(mLogs.begin()), std::make_move_iterator(mLogs.end()));
+		mLogs.clear();
+		mLogResource.setUpstream(resource);
+		mLogs.insert(mLogs.end(), std::make_move_iterator(logs.begin()), std::make_move_iterator(logs.end()));
+	}
+
 		// Public Static Method(s)
 	DebugLogger& DebugLogger::getInstance()
 	{
@@ -84,8 +174,158 @@ namespace ae
 
 		// Private Constructor(s)
 	DebugLogger::DebugLogger()
-		: mLogs()
+		: mRing(std::make_unique<Record[]>(RING_CAPACITY))
+		, mWritePosition(0)
+		, mReadPosition(0)
+		, mDroppedCount(0)
+		, mMinimumLevel(static_cast<int>(Log::Level::Info))
+		, mRateLimit(10)
+		, mRateInterval(1'000'000)
+		, mLogResource()
+		, mLogs(&mLogResource)
+		, mHistoryCapacity(512)
+		, mWrittenCount(0)
 		, mErrorLog("aeon_errors.log")
+		, mFile()
+		, mMutex()
+		, mWakeCondition()
+		, mFlushCondition()
+		, mExit(false)
+		, mThread()
+	{
+		// Each slot is first written at its own position
+		for (size_t i = 0; i < RING_CAPACITY; ++i) {
+			mRing[i].sequence.store(i, std::memory_order_relaxed);
+		}
+
+		mThread = std::thread(&DebugLogger::run, this);
+	}
+
+		// Private Method(s)
+	void DebugLogger::push(std::string&& title, std::string&& description, std::function<std::string()>&& formatter, std::string&& file,
+	                       std::string&& function, Log::Level level, int line, unsigned int suppressedCount)
+	{
+		AEON_MEMORY_SCOPE(MemoryTag::Logging);
+
+		// Reserve a slot in the ring, the log being dropped if the ring is full
+		size_t position = mWritePosition.load(std::memory_order_relaxed);
+		Record* record = nullptr;
+		while (true)
+		{
+			record = &mRing[position & (RING_CAPACITY - 1)];
+			const size_t SEQUENCE = record->sequence.load(std::memory_order_acquire);
+			const std::ptrdiff_t DIFFERENCE = static_cast<std::ptrdiff_t>(SEQUENCE) - static_cast<std::ptrdiff_t>(position);
+			if (DIFFERENCE == 0) {
+				if (mWritePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+					break;
+				}
+			}
+			else if (DIFFERENCE < 0) {
+				mDroppedCount.fetch_add(1, std::memory_order_relaxed);
+				return;
+			}
+			else {
+				position = mWritePosition.load(std::memory_order_relaxed);
+			}
+		}
+
+		// Fill in the slot and publish it, the formatting being left to the background thread
+		record->title = std::move(title);
+		record->description = std::move(description);
+		record->formatter = std::move(formatter);
+		record->file = std::move(file);
+		record->function = std::move(function);
+		record->level = level;
+		record->line = line;
+		record->suppressed = suppressedCount;
+		record->sequence.store(position + 1, std::memory_order_release);
+
+		mWakeCondition.notify_one();
+	}
+
+	bool DebugLogger::hasPendingRecord() const noexcept
+	{
+		return mRing[mReadPosition & (RING_CAPACITY - 1)].sequence.load(std::memory_order_acquire) == mReadPosition + 1;
+	}
+
+	size_t DebugLogger::writePendingRecords()
+	{
+		// Open the log file upon the first write, it's kept open afterwards
+		if (!mFile.is_open()) {
+			mFile.open(mErrorLog, std::ios::out | std::ios::app);
+		}
+
+		// Report the logs that couldn't be pushed since the last write
+		std::list<Log> logs;
+		const size_t DROPPED_COUNT = mDroppedCount.exchange(0, std::memory_order_relaxed);
+		if (DROPPED_COUNT > 0) {
+			logs.emplace_back("Logs dropped", std::to_string(DROPPED_COUNT) + " logs were dropped as the ring was full.", __FILE__, __func__, Log::Level::Warning, __LINE__);
+		}
+
+		// Format the logs and free their slot for the logging threads
+		size_t readCount = 0;
+		while (hasPendingRecord())
+		{
+			Record& record = mRing[mReadPosition & (RING_CAPACITY - 1)];
+			if (record.formatter) {
+				record.description = record.formatter();
+				record.formatter = nullptr;
+			}
+			logs.emplace_back(std::move(record.title), std::move(record.description), std::move(record.file), std::move(record.function), record.level, record.line, record.suppressed);
+			record.sequence.store(mReadPosition + RING_CAPACITY, std::memory_order_release);
+			++mReadPosition;
+			++readCount;
+		}
+
+		if (logs.empty()) {
+			return 0;
+		}
+
+		// Display the logs to the console (ignored in Release mode) and append them to the log file on disk
+		for (const Log& log : logs) {
+			if _CONSTEXPR_IF (AEON_DEBUG) {
+				std::cerr << log << "\n";
+			}
+			mFile << log.formattedInfo;
+		}
+		mFile.flush();
+
+		// Store the most recent logs (they're moved rather than spliced as the stored logs are allocated from their own resource)
+		std::lock_guard<std::mutex> lock(mMutex);
+		mLogs.insert(mLogs.end(), std::make_move_iterator(logs.begin()), std::make_move_iterator(logs.end()));
+		while (mLogs.size() > mHistoryCapacity) {
+			mLogs.pop_front();
+		}
+
+		return readCount;
+	}
+
+	void DebugLogger::run()
+	{
+		AEON_MEMORY_SCOPE(MemoryTag::Logging);
+
+		std::unique_lock<std::mutex> lock(mMutex);
+		while (true)
+		{
+			mWakeCondition.wait_for(lock, WAKE_PERIOD, [this]() { return mExit || hasPendingRecord(); });
+			const bool EXIT = mExit;
+
+			// The logs are written without holding the lock so that flush() and getLogs() don't wait on the disk
+			lock.unlock();
+			const size_t READ_COUNT = writePendingRecords();
+			lock.lock();
+
+			mWrittenCount += READ_COUNT;
+			mFlushCondition.notify_all();
+			if (EXIT && !hasPendingRecord()) {
+				break;
+			}
+		}
+	}
+
+		// Private Static Method(s)
+	void DebugLogger::appendFormat(std::ostringstream& stream, const char* format)
 	{
+		stream << format;
 	}
 }
\ No newline at end of file
@@ -1,15 +1,245 @@
 #include <AEON/System/FileSystem.h>
 
+#include <algorithm>
+#include <condition_variable>
 #include <fstream>
+#include <mutex>
+#include <queue>
+#include <sstream>
+#include <thread>
+#include <utility>
+
+#ifdef _WIN32
+	#ifndef WIN32_LEAN_AND_MEAN
+		#define WIN32_LEAN_AND_MEAN
+	#endif
+	#ifndef NOMINMAX
+		#define NOMINMAX
+	#endif
+	#include <windows.h>
+#else
+	#include <fcntl.h>
+	#include <sys/mman.h>
+	#include <sys/stat.h>
+	#include <unistd.h>
+#endif
 
 #include <AEON/System/DebugLogger.h>
+#include <AEON/System/Archive.h>
+#include <AEON/System/Profiler.h>
 
 namespace ae
 {
+	namespace
+	{
+		// The mounted archives (the most recently mounted one is last) and the mutex protecting them as loaders read from any thread
+		std::vector<std::shared_ptr<const Archive>> mountedArchives;
+		std::mutex                                  mountMutex;
+
+		// Copy the mounted archives so that they're searched without holding the lock
+		std::vector<std::shared_ptr<const Archive>> getMountedArchives()
+		{
+			std::lock_guard<std::mutex> lock(mountMutex);
+			return mountedArchives;
+		}
+
+		// Retrieve the entry at the path provided from the most recently mounted archive containing it
+		FileSystem::MappedFile mapArchiveEntry(const std::string& filepath)
+		{
+			const std::vector<std::shared_ptr<const Archive>> ARCHIVES = getMountedArchives();
+			for (auto itr = ARCHIVES.rbegin(); itr != ARCHIVES.rend(); ++itr) {
+				FileSystem::MappedFile entry = (*itr)->map(filepath);
+				if (entry.isOpen()) {
+					return entry;
+				}
+			}
+
+			return FileSystem::MappedFile();
+		}
+
+		// The number of I/O threads performing the asynchronous reads (reads rarely benefit from more parallelism than this)
+		constexpr size_t IO_THREAD_COUNT = 2;
+
+		// The pool of I/O threads performing the asynchronous reads, started upon the first read
+		class IOService
+		{
+		public:
+			// A pending asynchronous read
+			struct Request
+			{
+				std::string              filepath;
+				FileSystem::ReadCallback callback;
+				FileSystem::Priority     priority;
+				uint64_t                 sequence;
+
+				// The reads of higher priority come first, followed by the oldest ones
+				bool operator<(const Request& other) const noexcept
+				{
+					return (priority != other.priority) ? priority < other.priority : sequence > other.sequence;
+				}
+			};
+
+			IOService()
+				: mRequests()
+				, mThreads()
+				, mMutex()
+				, mCondition()
+				, mSequence(0)
+				, mExit(false)
+			{
+				for (size_t i = 0; i < IO_THREAD_COUNT; ++i) {
+					mThreads.emplace_back(&IOService::run, this);
+				}
+			}
+
+			IOService(const IOService&) = delete;
+
+			~IOService()
+			{
+				// The reads still pending are completed beforehand as their callbacks may be waited upon
+				{
+					std::lock_guard<std::mutex> lock(mMutex);
+					mExit = true;
+				}
+				mCondition.notify_all();
+				for (std::thread& thread : mThreads) {
+					thread.join();
+				}
+			}
+
+			IOService& operator=(const IOService&) = delete;
+
+			static IOService& getInstance()
+			{
+				static IOService instance;
+				return instance;
+			}
+
+			void push(const std::string& filepath, FileSystem::ReadCallback&& callback, FileSystem::Priority priority)
+			{
+				{
+					std::lock_guard<std::mutex> lock(mMutex);
+					mRequests.push(Request{ filepath, std::move(callback), priority, mSequence++ });
+				}
+				mCondition.notify_one();
+			}
+
+		private:
+			void run()
+			{
+				Profiler::getInstance().setThreadName("I/O thread");
+
+				std::vector<uint8_t> data;
+				std::unique_lock<std::mutex> lock(mMutex);
+				while (true)
+				{
+					mCondition.wait(lock, [this]() { return mExit || !mRequests.empty(); });
+					if (mRequests.empty()) {
+						break;
+					}
+
+					// The top request is moved out before being removed, its priority and sequence which order the queue are left untouched
+					Request request = std::move(const_cast<Request&>(mRequests.top()));
+					mRequests.pop();
+					lock.unlock();
+
+					const bool SUCCESS = FileSystem::readBinary(request.filepath, data);
+					if (request.callback) {
+						request.callback(SUCCESS, std::move(data));
+					}
+					data = std::vector<uint8_t>();
+
+					lock.lock();
+				}
+			}
+
+			std::priority_queue<Request> mRequests;
+			std::vector<std::thread>     mThreads;
+			std::mutex                   mMutex;
+			std::condition_variable      mCondition;
+			uint64_t                     mSequence;
+			bool                         mExit;
+		};
+	}
+
+	// FileSystem::MappedFile
+		// Public constructor(s)
+	FileSystem::MappedFile::MappedFile() noexcept
+		: mOwner()
+		, mData(nullptr)
+		, mSize(0)
+		, mOpen(false)
+	{
+	}
+
+	FileSystem::MappedFile::MappedFile(MappedFile&& rvalue) noexcept
+		: mOwner(std::move(rvalue.mOwner))
+		, mData(std::exchange(rvalue.mData, nullptr))
+		, mSize(std::exchange(rvalue.mSize, 0))
+		, mOpen(std::exchange(rvalue.mOpen, false))
+	{
+	}
+
+	FileSystem::MappedFile::~MappedFile()
+	{
+		close();
+	}
+
+		// Public operator(s)
+	FileSystem::MappedFile& FileSystem::MappedFile::operator=(MappedFile&& rvalue) noexcept
+	{
+		// Unmap the current view and take over the rvalue's
+		if (this != &rvalue) {
+			close();
+			mOwner = std::move(rvalue.mOwner);
+			mData = std::exchange(rvalue.mData, nullptr);
+			mSize = std::exchange(rvalue.mSize, 0);
+			mOpen = std::exchange(rvalue.mOpen, false);
+		}
+
+		return *this;
+	}
+
+		// Public method(s)
+	void FileSystem::MappedFile::close() noexcept
+	{
+		// The views owned by another object (like an archive's entries) are released along with their owner
+		if (mOwner) {
+			mOwner.reset();
+		}
+		else if (mData) {
+		#ifdef _WIN32
+			UnmapViewOfFile(mData);
+		#else
+			munmap(const_cast<uint8_t*>(mData), mSize);
+		#endif
+		}
+
+		mData = nullptr;
+		mSize = 0;
+		mOpen = false;
+	}
+
+	const uint8_t* FileSystem::MappedFile::data() const noexcept
+	{
+		return mData;
+	}
+
+	size_t FileSystem::MappedFile::size() const noexcept
+	{
+		return mSize;
+	}
+
+	bool FileSystem::MappedFile::isOpen() const noexcept
+	{
+		return mOpen;
+	}
+
+	// FileSystem
+		// Public static method(s)
 	std::string FileSystem::readFile(const std::string& filepath, uint_fast16_t openMode)
 	{
 		std::string contents = "";
-		std::string line = "";
 
 		// Setup the file mode according to the flags provided
 		int mode = std::ios::in;
@@ -28,13 +258,19 @@ namespace ae
 			}
 		}
 
-		// Create the input file stream and read in the file's contents
+		// Copy the entry if a mounted archive contains the file
+		const MappedFile ENTRY = mapArchiveEntry(filepath);
+		if (ENTRY.isOpen()) {
+			contents.assign(reinterpret_cast<const char*>(ENTRY.data()), ENTRY.size());
+			return contents;
+		}
+
+		// Create the input file stream and read in the file's contents in a single pass from the current position
 		std::ifstream fin(filepath, mode);
 		if (fin) {
-			// Read in every line
-			while (fin.good() && std::getline(fin, line)) {
-				contents += line + '\n';
-			}
+			std::ostringstream stream;
+			stream << fin.rdbuf();
+			contents = stream.str();
 			fin.close();
 		}
 		else {
@@ -44,6 +280,95 @@ namespace ae
 		return contents;
 	}
 
+	bool FileSystem::readBinary(const std::string& filepath, std::vector<uint8_t>& buffer)
+	{
+		// Copy the entry if a mounted archive contains the file
+		const MappedFile ENTRY = mapArchiveEntry(filepath);
+		if (ENTRY.isOpen()) {
+			buffer.assign(ENTRY.data(), ENTRY.data() + ENTRY.size());
+			return true;
+		}
+
+		// Retrieve the file's size to read it in with a single operation
+		std::ifstream fin(filepath, std::ios::in | std::ios::binary | std::ios::ate);
+		if (!fin) {
+			buffer.clear();
+			return false;
+		}
+
+		const std::streamoff SIZE = fin.tellg();
+		if (SIZE < 0) {
+			buffer.clear();
+			return false;
+		}
+		buffer.resize(static_cast<size_t>(SIZE));
+		fin.seekg(0);
+
+		return SIZE == 0 || static_cast<bool>(fin.read(reinterpret_cast<char*>(buffer.data()), static_cast<std::streamsize>(SIZE)));
+	}
+
+	FileSystem::MappedFile FileSystem::mapFile(const std::string& filepath)
+	{
+		// View the entry if a mounted archive contains the file
+		MappedFile mapping = mapArchiveEntry(filepath);
+		if (mapping.isOpen()) {
+			return mapping;
+		}
+
+	#ifdef _WIN32
+		// The view keeps the mapping alive, so the handles are closed straight away
+		const HANDLE FILE_HANDLE = CreateFileA(filepath.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+		if (FILE_HANDLE == INVALID_HANDLE_VALUE) {
+			return mapping;
+		}
+
+		LARGE_INTEGER size;
+		if (GetFileSizeEx(FILE_HANDLE, &size)) {
+			// Empty files can't be mapped, they're simply considered open
+			if (size.QuadPart == 0) {
+				mapping.mOpen = true;
+			}
+			else if (const HANDLE MAPPING = CreateFileMappingA(FILE_HANDLE, nullptr, PAGE_READONLY, 0, 0, nullptr)) {
+				mapping.mData = static_cast<const uint8_t*>(MapViewOfFile(MAPPING, FILE_MAP_READ, 0, 0, 0));
+				mapping.mSize = (mapping.mData) ? static_cast<size_t>(size.QuadPart) : 0;
+				mapping.mOpen = (mapping.mData != nullptr);
+				CloseHandle(MAPPING);
+			}
+		}
+		CloseHandle(FILE_HANDLE);
+	#else
+		// The mapping remains valid once the file descriptor is closed
+		const int DESCRIPTOR = open(filepath.c_str(), O_RDONLY);
+		if (DESCRIPTOR == -1) {
+			return mapping;
+		}
+
+		struct stat status;
+		if (fstat(DESCRIPTOR, &status) == 0) {
+			// Empty files can't be mapped, they're simply considered open
+			if (status.st_size == 0) {
+				mapping.mOpen = true;
+			}
+			else {
+				void* data = mmap(nullptr, static_cast<size_t>(status.st_size), PROT_READ, MAP_PRIVATE, DESCRIPTOR, 0);
+				if (data != MAP_FAILED) {
+					mapping.mData = static_cast<const uint8_t*>(data);
+					mapping.mSize = static_cast<size_t>(status.st_size);
+					mapping.mOpen = true;
+				}
+			}
+		}
+		::close(DESCRIPTOR);
+	#endif
+
+		return mapping;
+	}
+
+	void FileSystem::readAsync(const std::string& filepath, ReadCallback callback, Priority priority)
+	{
+		IOService::getInstance().push(filepath, std::move(callback), priority);
+	}
+
 	void FileSystem::writeFile(const std::string& filepath, const std::string& content, uint_fast16_t openMode)
 	{
 		// Log an error message if the mode selected is invalid (ignored in Release mode)
@@ -79,4 +404,37 @@ namespace ae
 			AEON_LOG_ERROR("Invalid filepath", "Unable to open file at \"" + filepath + "\".\nAborting operation.");
 		}
 	}
+
+	bool FileSystem::mountArchive(const std::string& filepath)
+	{
+		// Open the archive before acquiring the lock, its index is validated upon opening
+		auto archive = std::make_shared<Archive>();
+		if (!archive->open(filepath)) {
+			AEON_LOG_ERROR("Invalid archive", "Unable to open the archive at \"" + filepath + "\".\nAborting operation.");
+			return false;
+		}
+
+		// Replace the archive if it was already mounted so that it takes precedence
+		std::lock_guard<std::mutex> lock(mountMutex);
+		mountedArchives.erase(std::remove_if(mountedArchives.begin(), mountedArchives.end(), [&filepath](const std::shared_ptr<const Archive>& mounted) {
+			return mounted->getFilepath() == filepath;
+		}), mountedArchives.end());
+		mountedArchives.push_back(std::move(archive));
+
+		return true;
+	}
+
+	void FileSystem::unmountArchive(const std::string& filepath)
+	{
+		std::lock_guard<std::mutex> lock(mountMutex);
+		mountedArchives.erase(std::remove_if(mountedArchives.begin(), mountedArchives.end(), [&filepath](const std::shared_ptr<const Archive>& mounted) {
+			return mounted->getFilepath() == filepath;
+		}), mountedArchives.end());
+	}
+
+	void FileSystem::unmountArchives()
+	{
+		std::lock_guard<std::mutex> lock(mountMutex);
+		mountedArchives.clear();
+	}
 }
\ No newline at end of file
@@ -0,0 +1,228 @@
+// MIT License
+// 
+// Copyright(c) 2019-2021 Filippos Gleglakos
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <AEON/System/FileWatcher.h>
+
+#include <filesystem>
+
+#ifdef _WIN32
+	#ifndef WIN32_LEAN_AND_MEAN
+		#define WIN32_LEAN_AND_MEAN
+	#endif
+	#ifndef NOMINMAX
+		#define NOMINMAX
+	#endif
+	#include <windows.h>
+#else
+	#include <sys/inotify.h>
+	#include <unistd.h>
+#endif
+
+#include <AEON/System/DebugLogger.h>
+
+namespace ae
+{
+	namespace
+	{
+		// The size of the buffer receiving the changes of each directory on Windows, and of the events read at once on Linux
+		constexpr size_t NOTIFICATION_BUFFER_SIZE = 64 * 1024;
+		constexpr size_t EVENT_BUFFER_SIZE = 4096;
+	}
+
+	// Public constructor(s)
+	FileWatcher::FileWatcher()
+		: mDirectories()
+		, mPending()
+		, mDelay(100)
+	#ifdef _WIN32
+		, mHandle(-1)
+	#else
+		, mHandle(inotify_init1(IN_NONBLOCK | IN_CLOEXEC))
+	#endif
+	{
+	}
+
+	FileWatcher::~FileWatcher()
+	{
+	#ifdef _WIN32
+		for (auto& directory : mDirectories) {
+			CancelIo(directory.second.handle);
+			CloseHandle(directory.second.handle);
+			delete static_cast<OVERLAPPED*>(directory.second.overlapped);
+		}
+	#else
+		if (mHandle != -1) {
+			close(mHandle);
+		}
+	#endif
+	}
+
+	// Public method(s)
+	bool FileWatcher::watch(const std::string& directory)
+	{
+		std::error_code error;
+		if (!std::filesystem::is_directory(directory, error)) {
+			AEON_LOG_ERROR("Invalid directory", "The directory \"" + directory + "\" can't be watched as it doesn't exist.\nAborting operation.");
+			return false;
+		}
+
+	#ifdef _WIN32
+		// Open the directory for asynchronous reads of its changes, its subdirectories being watched along with it
+		const HANDLE DIRECTORY_HANDLE = CreateFileA(directory.c_str(), FILE_LIST_DIRECTORY, FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE, nullptr,
+		                                  OPEN_EXISTING, FILE_FLAG_BACKUP_SEMANTICS | FILE_FLAG_OVERLAPPED, nullptr);
+		if (DIRECTORY_HANDLE == INVALID_HANDLE_VALUE) {
+			AEON_LOG_ERROR("Failed to watch directory", "The directory \"" + directory + "\" couldn't be opened.\nAborting operation.");
+			return false;
+		}
+
+		Directory& watched = mDirectories[static_cast<int>(mDirectories.size())];
+		watched.path = normalizePath(directory);
+		watched.handle = DIRECTORY_HANDLE;
+		watched.overlapped = new OVERLAPPED{};
+		watched.buffer.resize(NOTIFICATION_BUFFER_SIZE);
+		ReadDirectoryChangesW(DIRECTORY_HANDLE, watched.buffer.data(), static_cast<DWORD>(watched.buffer.size()), TRUE, FILE_NOTIFY_CHANGE_LAST_WRITE | FILE_NOTIFY_CHANGE_FILE_NAME,
+		                      nullptr, static_cast<OVERLAPPED*>(watched.overlapped), nullptr);
+	#else
+		if (mHandle == -1) {
+			AEON_LOG_ERROR("Failed to watch directory", "The inotify instance couldn't be created.\nAborting operation.");
+			return false;
+		}
+
+		// inotify isn't recursive, each subdirectory is thus watched separately
+		std::vector<std::string> paths = { directory };
+		for (auto itr = std::filesystem::recursive_directory_iterator(directory, std::filesystem::directory_options::skip_permission_denied, error);
+		     itr != std::filesystem::recursive_directory_iterator(); itr.increment(error)) {
+			if (itr->is_directory(error)) {
+				paths.push_back(itr->path().string());
+			}
+		}
+
+		for (const std::string& path : paths) {
+			const int DESCRIPTOR = inotify_add_watch(mHandle, path.c_str(), IN_CLOSE_WRITE | IN_MOVED_TO);
+			if (DESCRIPTOR == -1) {
+				AEON_LOG_WARNING("Failed to watch directory", "The directory \"" + path + "\" couldn't be watched, its files won't be reported.");
+				continue;
+			}
+			mDirectories[DESCRIPTOR] = Directory{ normalizePath(path), nullptr, nullptr, {} };
+		}
+	#endif
+
+		return true;
+	}
+
+	std::vector<std::string> FileWatcher::poll()
+	{
+		readNotifications();
+
+		// Report the files that haven't been modified during the settle delay
+		std::vector<std::string> filepaths;
+		const auto NOW = std::chrono::steady_clock::now();
+		for (auto itr = mPending.begin(); itr != mPending.end();) {
+			if (NOW - itr->second >= mDelay) {
+				filepaths.push_back(itr->first);
+				itr = mPending.erase(itr);
+			}
+			else {
+				++itr;
+			}
+		}
+
+		return filepaths;
+	}
+
+	void FileWatcher::setSettleDelay(std::chrono::milliseconds delay) noexcept
+	{
+		mDelay = delay;
+	}
+
+	bool FileWatcher::isWatching() const noexcept
+	{
+		return !mDirectories.empty();
+	}
+
+	// Public static method(s)
+	std::string FileWatcher::normalizePath(const std::string& filepath)
+	{
+		std::error_code error;
+		const std::filesystem::path ABSOLUTE_PATH = std::filesystem::absolute(filepath, error);
+		return ((error) ? std::filesystem::path(filepath) : ABSOLUTE_PATH).lexically_normal().generic_string();
+	}
+
+	// Private method(s)
+	void FileWatcher::readNotifications()
+	{
+		const auto NOW = std::chrono::steady_clock::now();
+
+	#ifdef _WIN32
+		for (auto& directory : mDirectories) {
+			Directory& watched = directory.second;
+			OVERLAPPED* const OVERLAPPED_READ = static_cast<OVERLAPPED*>(watched.overlapped);
+			DWORD byteCount = 0;
+			if (!GetOverlappedResult(watched.handle, OVERLAPPED_READ, &byteCount, FALSE)) {
+				continue;
+			}
+
+			// Record the files modified, added or renamed (no byte is received if the buffer overflowed)
+			size_t offset = 0;
+			while (byteCount > 0)
+			{
+				const FILE_NOTIFY_INFORMATION* const INFO = reinterpret_cast<const FILE_NOTIFY_INFORMATION*>(watched.buffer.data() + offset);
+				if (INFO->Action == FILE_ACTION_MODIFIED || INFO->Action == FILE_ACTION_ADDED || INFO->Action == FILE_ACTION_RENAMED_NEW_NAME) {
+					const int WIDE_LENGTH = static_cast<int>(INFO->FileNameLength / sizeof(WCHAR));
+					const int LENGTH = WideCharToMultiByte(CP_UTF8, 0, INFO->FileName, WIDE_LENGTH, nullptr, 0, nullptr, nullptr);
+					std::string name(static_cast<size_t>(LENGTH), '\0');
+					WideCharToMultiByte(CP_UTF8, 0, INFO->FileName, WIDE_LENGTH, &name[0], LENGTH, nullptr, nullptr);
+					mPending[normalizePath(watched.path + '/' + name)] = NOW;
+				}
+
+				if (INFO->NextEntryOffset == 0) {
+					break;
+				}
+				offset += INFO->NextEntryOffset;
+			}
+
+			// Request the next changes
+			*OVERLAPPED_READ = OVERLAPPED{};
+			ReadDirectoryChangesW(watched.handle, watched.buffer.data(), static_cast<DWORD>(watched.buffer.size()), TRUE, FILE_NOTIFY_CHANGE_LAST_WRITE | FILE_NOTIFY_CHANGE_FILE_NAME,
+			                      nullptr, OVERLAPPED_READ, nullptr);
+		}
+	#else
+		if (mHandle == -1) {
+			return;
+		}
+
+		// Read in the pending events until none are left (the instance is non-blocking)
+		alignas(inotify_event) char buffer[EVENT_BUFFER_SIZE];
+		ssize_t length = 0;
+		while ((length = read(mHandle, buffer, sizeof(buffer))) > 0) {
+			for (ssize_t offset = 0; offset < length;) {
+				const inotify_event* const EVENT = reinterpret_cast<const inotify_event*>(buffer + offset);
+				const auto DIRECTORY = mDirectories.find(EVENT->wd);
+				if (EVENT->len > 0 && DIRECTORY != mDirectories.end()) {
+					mPending[DIRECTORY->second.path + '/' + EVENT->name] = NOW;
+				}
+				offset += sizeof(inotify_event) + EVENT->len;
+			}
+		}
+	#endif
+	}
+}
\ No newline at end of file
@@ -0,0 +1,146 @@
+// MIT License
+// 
+// Copyright(c) 2019-2021 Filippos Gleglakos
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <AEON/System/FrameArena.h>
+
+#include <atomic>
+#include <cstddef>
+#include <algorithm>
+
+namespace ae
+{
+	namespace
+	{
+		// The minimum size of a block, large enough for a frame's temporaries in most scenes
+		constexpr size_t MIN_BLOCK_SIZE = 256 * 1024;
+		// The alignment of the blocks, the strictest fundamental alignment
+		constexpr size_t BLOCK_ALIGNMENT = alignof(std::max_align_t);
+
+		// The number of frames ended, compared by each arena to its own frame
+		std::atomic<uint64_t> frameCount(0);
+
+		// Rounds the offset up so that the address within the block is aligned
+		size_t alignOffset(const unsigned char* block, size_t offset, size_t alignment) noexcept
+		{
+			const uintptr_t ADDRESS = reinterpret_cast<uintptr_t>(block) + offset;
+			return offset + (((ADDRESS + alignment - 1) & ~(alignment - 1)) - ADDRESS);
+		}
+	}
+
+	// Public method(s)
+	void* FrameArena::allocate(size_t size, size_t alignment)
+	{
+		// Recycle the previous frames' memory
+		const uint64_t FRAME = frameCount.load(std::memory_order_relaxed);
+		if (mFrame != FRAME) {
+			mFrame = FRAME;
+			reset();
+		}
+
+		// Bump the current block's offset, a new block being allocated if the memory doesn't fit
+		size = std::max(size, size_t(1));
+		if (mBlocks.empty() || alignOffset(mBlocks.back().get(), mOffset, alignment) + size > mBlockSize) {
+			grow(size + alignment);
+		}
+
+		unsigned char* const BLOCK = mBlocks.back().get();
+		const size_t OFFSET = alignOffset(BLOCK, mOffset, alignment);
+		mUsedSize += OFFSET + size - mOffset;
+		mOffset = OFFSET + size;
+		return BLOCK + OFFSET;
+	}
+
+	void FrameArena::deallocate(void* ptr, size_t size) noexcept
+	{
+		// Only the most recent allocation of the current frame can be reclaimed
+		if (!ptr || mBlocks.empty()) {
+			return;
+		}
+
+		unsigned char* const BLOCK = mBlocks.back().get();
+		unsigned char* const MEMORY = static_cast<unsigned char*>(ptr);
+		if (MEMORY >= BLOCK && MEMORY + std::max(size, size_t(1)) == BLOCK + mOffset) {
+			const size_t OFFSET = static_cast<size_t>(MEMORY - BLOCK);
+			mUsedSize -= mOffset - OFFSET;
+			mOffset = OFFSET;
+		}
+	}
+
+	size_t FrameArena::getUsedSize() const noexcept
+	{
+		return mUsedSize;
+	}
+
+	size_t FrameArena::getCapacity() const noexcept
+	{
+		return mCapacity;
+	}
+
+	// Public static method(s)
+	FrameArena& FrameArena::getInstance()
+	{
+		thread_local FrameArena instance;
+		return instance;
+	}
+
+	void FrameArena::nextFrame() noexcept
+	{
+		frameCount.fetch_add(1, std::memory_order_relaxed);
+	}
+
+	// Private constructor(s)
+	FrameArena::FrameArena() noexcept
+		: mBlocks()
+		, mBlockSize(0)
+		, mOffset(0)
+		, mUsedSize(0)
+		, mCapacity(0)
+		, mFrame(frameCount.load(std::memory_order_relaxed))
+	{
+	}
+
+	// Private method(s)
+	void FrameArena::reset()
+	{
+		// Merge the blocks so that the next frames fit in a single one
+		if (mBlocks.size() > 1) {
+			const size_t CAPACITY = mCapacity;
+			mBlocks.clear();
+			mBlockSize = 0;
+			mCapacity = 0;
+			grow(CAPACITY);
+		}
+
+		mOffset = 0;
+		mUsedSize = 0;
+	}
+
+	void FrameArena::grow(size_t size)
+	{
+		// The blocks' size doubles so that a frame only requires a few of them
+		mBlockSize = std::max({ size, mBlockSize * 2, MIN_BLOCK_SIZE });
+		mBlockSize = (mBlockSize + BLOCK_ALIGNMENT - 1) & ~(BLOCK_ALIGNMENT - 1);
+		mBlocks.emplace_back(new unsigned char[mBlockSize]);
+		mCapacity += mBlockSize;
+		mOffset = 0;
+	}
+}
\ No newline at end of file
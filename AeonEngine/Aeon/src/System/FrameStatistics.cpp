@@ -0,0 +1,216 @@
+// MIT License
+// 
+// Copyright(c) 2019-2021 Filippos Gleglakos
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <AEON/System/FrameStatistics.h>
+
+#include <algorithm>
+#include <cmath>
+#include <iomanip>
+#include <sstream>
+
+#include <AEON/System/FileSystem.h>
+
+namespace ae
+{
+	namespace
+	{
+		// The weight of the most recent frame in the moving average to which the frames are compared to detect the hitches
+		constexpr double AVERAGE_WEIGHT = 0.05;
+
+		// Retrieves the duration of the phase provided from the frame's sample
+		int64_t getDuration(const FrameStatistics::Sample& sample, FrameStatistics::Phase phase) noexcept
+		{
+			switch (phase)
+			{
+			case FrameStatistics::Phase::Events:
+				return sample.events.asNanoseconds();
+			case FrameStatistics::Phase::Update:
+				return sample.update.asNanoseconds();
+			case FrameStatistics::Phase::Render:
+				return sample.render.asNanoseconds();
+			default:
+				return sample.frame.asNanoseconds();
+			}
+		}
+
+		// Retrieves the duration below which the percentage provided of the sorted durations lie (nearest rank)
+		int64_t getPercentile(const std::vector<int64_t>& durations, double percentage) noexcept
+		{
+			const size_t RANK = static_cast<size_t>(std::ceil(percentage * static_cast<double>(durations.size())));
+			return durations[std::min(std::max(RANK, size_t(1)), durations.size()) - 1];
+		}
+
+		// Formats the duration provided in milliseconds
+		std::string formatMilliseconds(const Time& time)
+		{
+			std::ostringstream stream;
+			stream << std::fixed << std::setprecision(3) << time.asSeconds() * 1000.0;
+			return stream.str();
+		}
+	}
+
+	// Public constructor(s)
+	FrameStatistics::FrameStatistics(size_t capacity)
+		: mSamples()
+		, mCapacity(std::max(capacity, size_t(1)))
+		, mNext(0)
+		, mHitchCount(0)
+		, mHitchThreshold(Time::Zero)
+		, mAverage(Time::Zero)
+	{
+		mSamples.reserve(mCapacity);
+	}
+
+	// Public method(s)
+	void FrameStatistics::addSample(const Sample& sample)
+	{
+		// Compare the frame to the threshold or to the recent frames (the first frame only initializes the average)
+		if (mHitchThreshold != Time::Zero) {
+			mHitchCount += (sample.frame > mHitchThreshold) ? 1 : 0;
+		}
+		else if (mAverage != Time::Zero && sample.frame > mAverage * 2.0) {
+			++mHitchCount;
+		}
+		mAverage = (mAverage == Time::Zero) ? sample.frame : mAverage * (1.0 - AVERAGE_WEIGHT) + sample.frame * AVERAGE_WEIGHT;
+
+		// Overwrite the oldest frame once the ring is full
+		if (mSamples.size() < mCapacity) {
+			mSamples.push_back(sample);
+		}
+		else {
+			mSamples[mNext] = sample;
+			mNext = (mNext + 1) % mCapacity;
+		}
+	}
+
+	void FrameStatistics::clear() noexcept
+	{
+		mSamples.clear();
+		mNext = 0;
+		mHitchCount = 0;
+		mAverage = Time::Zero;
+	}
+
+	void FrameStatistics::setCapacity(size_t capacity)
+	{
+		clear();
+		mCapacity = std::max(capacity, size_t(1));
+		mSamples.shrink_to_fit();
+		mSamples.reserve(mCapacity);
+	}
+
+	void FrameStatistics::setHitchThreshold(const Time& threshold) noexcept
+	{
+		mHitchThreshold = threshold;
+	}
+
+	FrameStatistics::Summary FrameStatistics::getSummary(Phase phase) const
+	{
+		Summary summary{};
+		if (mSamples.empty()) {
+			return summary;
+		}
+
+		// Sort the phase's durations from the shortest to the longest
+		std::vector<int64_t> durations;
+		durations.reserve(mSamples.size());
+		int64_t total = 0;
+		for (const Sample& sample : mSamples) {
+			durations.push_back(getDuration(sample, phase));
+			total += durations.back();
+		}
+		std::sort(durations.begin(), durations.end());
+
+		// The 1% low averages the slowest 1% of the frames (at least the slowest one)
+		const size_t LOW_COUNT = std::max(durations.size() / 100, size_t(1));
+		int64_t lowTotal = 0;
+		for (auto durationItr = durations.end() - LOW_COUNT; durationItr != durations.end(); ++durationItr) {
+			lowTotal += *durationItr;
+		}
+
+		const int64_t COUNT = static_cast<int64_t>(durations.size());
+		summary.average = Time::nanoseconds(total / COUNT);
+		summary.median = Time::nanoseconds(getPercentile(durations, 0.5));
+		summary.p95 = Time::nanoseconds(getPercentile(durations, 0.95));
+		summary.p99 = Time::nanoseconds(getPercentile(durations, 0.99));
+		summary.max = Time::nanoseconds(durations.back());
+		summary.onePercentLow = Time::nanoseconds(lowTotal / static_cast<int64_t>(LOW_COUNT));
+
+		return summary;
+	}
+
+	size_t FrameStatistics::getHitchCount() const noexcept
+	{
+		return mHitchCount;
+	}
+
+	size_t FrameStatistics::getSampleCount() const noexcept
+	{
+		return mSamples.size();
+	}
+
+	std::vector<FrameStatistics::Sample> FrameStatistics::getSamples() const
+	{
+		// Unroll the ring so that the oldest frame comes first
+		std::vector<Sample> samples;
+		samples.reserve(mSamples.size());
+		samples.insert(samples.end(), mSamples.begin() + mNext, mSamples.end());
+		samples.insert(samples.end(), mSamples.begin(), mSamples.begin() + mNext);
+
+		return samples;
+	}
+
+	std::string FrameStatistics::toString() const
+	{
+		std::ostringstream table;
+		table << "Frames: " << mSamples.size() << ", hitches: " << mHitchCount << "\n" << std::left << std::setw(10) << "Phase (ms)" << std::right;
+		for (const char* const COLUMN : { "average", "median", "p95", "p99", "max", "1% low" }) {
+			table << std::setw(10) << COLUMN;
+		}
+
+		const std::pair<Phase, const char*> PHASES[] = {
+			{ Phase::Frame, "Frame" }, { Phase::Events, "Events" }, { Phase::Update, "Update" }, { Phase::Render, "Render" }
+		};
+		for (const std::pair<Phase, const char*>& phase : PHASES) {
+			const Summary SUMMARY = getSummary(phase.first);
+			table << "\n" << std::left << std::setw(10) << phase.second << std::right;
+			for (const Time& time : { SUMMARY.average, SUMMARY.median, SUMMARY.p95, SUMMARY.p99, SUMMARY.max, SUMMARY.onePercentLow }) {
+				table << std::setw(10) << formatMilliseconds(time);
+			}
+		}
+
+		return table.str();
+	}
+
+	void FrameStatistics::exportCSV(const std::string& filepath) const
+	{
+		std::ostringstream csv;
+		csv << std::fixed << std::setprecision(3) << "frame,events,update,render";
+		for (const Sample& sample : getSamples()) {
+			csv << "\n" << sample.frame.asSeconds() * 1000.0 << "," << sample.events.asSeconds() * 1000.0 << ","
+			    << sample.update.asSeconds() * 1000.0 << "," << sample.render.asSeconds() * 1000.0;
+		}
+		csv << "\n";
+
+		FileSystem::writeFile(filepath, csv.str(), FileSystem::OpenMode::Truncate);
+	}
+}
\ No newline at end of file
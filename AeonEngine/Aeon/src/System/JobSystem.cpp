@@ -0,0 +1,279 @@
+// MIT License
+// 
+// Copyright(c) 2019-2021 Filippos Gleglakos
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <AEON/System/JobSystem.h>
+
+#include <algorithm>
+#include <deque>
+
+#include <AEON/System/DebugLogger.h>
+#include <AEON/System/ObjectPool.h>
+
+namespace ae
+{
+	namespace
+	{
+		// The index of the calling thread's work queue (0 for the threads that aren't workers)
+		thread_local size_t queueIndex = 0;
+	}
+
+	// JobSystem::Job
+	/*!
+	 \brief The internal struct representing a task and the number of jobs that need to finish for it to complete.
+	*/
+	struct JobSystem::Job
+	{
+		// Public member(s)
+		std::function<void()> task;       //!< The function to execute
+		Job*                  parent;     //!< The job completing once this job has completed, if any
+		std::atomic<uint32_t> unfinished; //!< The number of unfinished jobs (the job itself and its children)
+
+		// Public constructor(s)
+		Job(std::function<void()> jobTask, Job* const jobParent)
+			: task(std::move(jobTask))
+			, parent(jobParent)
+			, unfinished(1)
+		{
+		}
+	};
+
+	// JobSystem::WorkQueue
+	/*!
+	 \brief The internal struct representing a thread's double-ended queue of jobs.
+	 \details The owning thread pushes and pops its jobs at the back whereas the other threads steal them from the front.
+	*/
+	struct JobSystem::WorkQueue
+	{
+		// Public member(s)
+		std::deque<Job*> jobs;  //!< The queued jobs
+		std::mutex       mutex; //!< The mutex protecting the queued jobs
+	};
+
+	// Public destructor
+	JobSystem::~JobSystem()
+	{
+		// Wake and join the worker threads
+		{
+			std::lock_guard<std::mutex> lock(mSleepMutex);
+			mRunning = false;
+		}
+		mSleepCondition.notify_all();
+
+		for (std::thread& worker : mWorkers) {
+			worker.join();
+		}
+	}
+
+	// Public method(s)
+	JobSystem::Job* JobSystem::createJob(std::function<void()> task, Job* parent)
+	{
+		// The parent's completion depends on the child
+		if (parent) {
+			++parent->unfinished;
+		}
+
+		return new (ObjectPool<Job>::getInstance().allocate()) Job(std::move(task), parent);
+	}
+
+	void JobSystem::run(Job* const job)
+	{
+		WorkQueue& queue = *mQueues[getQueueIndex()];
+		{
+			std::lock_guard<std::mutex> lock(queue.mutex);
+			queue.jobs.push_back(job);
+		}
+
+		// Wake a sleeping worker thread
+		{
+			std::lock_guard<std::mutex> lock(mSleepMutex);
+			++mQueuedJobs;
+		}
+		mSleepCondition.notify_one();
+	}
+
+	void JobSystem::wait(Job* const job)
+	{
+		// Check if a child job is waited upon (ignored in Release mode)
+		if _CONSTEXPR_IF (AEON_DEBUG) {
+			if (job->parent) {
+				AEON_LOG_ERROR("Invalid job wait", "Children jobs can't be waited upon, their parent should be waited upon instead.\nAborting operation.");
+				return;
+			}
+		}
+
+		// Execute the queued jobs until the job has completed
+		const size_t QUEUE_INDEX = getQueueIndex();
+		while (job->unfinished.load(std::memory_order_acquire) != 0) {
+			if (Job* const queuedJob = getJob(QUEUE_INDEX)) {
+				execute(queuedJob);
+			}
+			else {
+				std::this_thread::yield();
+			}
+		}
+
+		// Release the completed job
+		job->~Job();
+		ObjectPool<Job>::getInstance().deallocate(job);
+	}
+
+	void JobSystem::parallelFor(size_t count, const std::function<void(size_t, size_t)>& task, size_t grainSize)
+	{
+		if (count == 0) {
+			return;
+		}
+
+		// Split the range into four batches per thread by default to balance the load
+		if (grainSize == 0) {
+			grainSize = std::max<size_t>(count / ((mWorkers.size() + 1) * 4), 1);
+		}
+
+		// Execute the range directly if it fits in a single batch
+		if (count <= grainSize) {
+			task(0, count);
+			return;
+		}
+
+		Job* const root = createJob(nullptr);
+		for (size_t begin = 0; begin < count; begin += grainSize) {
+			const size_t END = std::min(begin + grainSize, count);
+			run(createJob([&task, begin, END]() { task(begin, END); }, root));
+		}
+		run(root);
+		wait(root);
+	}
+
+	size_t JobSystem::getWorkerCount() const noexcept
+	{
+		return mWorkers.size();
+	}
+
+	// Public static method(s)
+	JobSystem& JobSystem::getInstance()
+	{
+		static JobSystem instance;
+		return instance;
+	}
+
+	// Private constructor(s)
+	JobSystem::JobSystem()
+		: mQueues()
+		, mWorkers()
+		, mSleepMutex()
+		, mSleepCondition()
+		, mQueuedJobs(0)
+		, mRunning(true)
+	{
+		// Construct the job pool beforehand so that it outlives the job system
+		ObjectPool<Job>::getInstance().reserve(256);
+
+		// Create the shared work queue and one queue per worker thread
+		const size_t WORKER_COUNT = std::max(std::thread::hardware_concurrency(), 2u) - 1;
+		mQueues.reserve(WORKER_COUNT + 1);
+		for (size_t i = 0; i <= WORKER_COUNT; ++i) {
+			mQueues.push_back(std::make_unique<WorkQueue>());
+		}
+
+		mWorkers.reserve(WORKER_COUNT);
+		for (size_t i = 1; i <= WORKER_COUNT; ++i) {
+			mWorkers.emplace_back(&JobSystem::runWorker, this, i);
+		}
+	}
+
+	// Private method(s)
+	void JobSystem::runWorker(size_t workerQueueIndex)
+	{
+		queueIndex = workerQueueIndex;
+
+		while (mRunning) {
+			if (Job* const job = getJob(workerQueueIndex)) {
+				execute(job);
+				continue;
+			}
+
+			// Sleep until a job is queued or the job system is destroyed
+			std::unique_lock<std::mutex> lock(mSleepMutex);
+			mSleepCondition.wait(lock, [this]() {
+				return mQueuedJobs != 0 || !mRunning;
+			});
+		}
+	}
+
+	JobSystem::Job* JobSystem::getJob(size_t ownQueueIndex)
+	{
+		// Take the most recent job of the thread's own queue
+		{
+			WorkQueue& queue = *mQueues[ownQueueIndex];
+			std::lock_guard<std::mutex> lock(queue.mutex);
+			if (!queue.jobs.empty()) {
+				Job* const job = queue.jobs.back();
+				queue.jobs.pop_back();
+				--mQueuedJobs;
+				return job;
+			}
+		}
+
+		// Steal the oldest job of the other queues
+		const size_t QUEUE_COUNT = mQueues.size();
+		for (size_t offset = 1; offset < QUEUE_COUNT; ++offset) {
+			WorkQueue& queue = *mQueues[(ownQueueIndex + offset) % QUEUE_COUNT];
+			std::lock_guard<std::mutex> lock(queue.mutex);
+			if (!queue.jobs.empty()) {
+				Job* const job = queue.jobs.front();
+				queue.jobs.pop_front();
+				--mQueuedJobs;
+				return job;
+			}
+		}
+
+		return nullptr;
+	}
+
+	void JobSystem::execute(Job* const job)
+	{
+		if (job->task) {
+			job->task();
+		}
+		finish(job);
+	}
+
+	void JobSystem::finish(Job* const job)
+	{
+		// The parent is retrieved beforehand as the job may be released by a waiting thread as soon as it has completed
+		Job* const parent = job->parent;
+		if (job->unfinished.fetch_sub(1, std::memory_order_acq_rel) != 1) {
+			return;
+		}
+
+		// Complete the parent and release the child jobs as nobody waits upon them
+		if (parent) {
+			finish(parent);
+			job->~Job();
+			ObjectPool<Job>::getInstance().deallocate(job);
+		}
+	}
+
+	size_t JobSystem::getQueueIndex() const noexcept
+	{
+		return queueIndex;
+	}
+}
\ No newline at end of file
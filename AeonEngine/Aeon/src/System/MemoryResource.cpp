@@ -0,0 +1,114 @@
+// MIT License
+// 
+// Copyright(c) 2019-2021 Filippos Gleglakos
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <AEON/System/MemoryResource.h>
+
+#include <AEON/System/DebugLogger.h>
+
+namespace ae
+{
+	// TrackedResource
+		// Public constructor(s)
+	TrackedResource::TrackedResource(MemoryTag tag, std::pmr::memory_resource* upstream) noexcept
+		: mUpstream((upstream) ? upstream : std::pmr::get_default_resource())
+		, mTag(tag)
+	{
+	}
+
+		// Public method(s)
+	MemoryTag TrackedResource::getTag() const noexcept
+	{
+		return mTag;
+	}
+
+	std::pmr::memory_resource* TrackedResource::getUpstream() const noexcept
+	{
+		return mUpstream;
+	}
+
+		// Private virtual method(s)
+	void* TrackedResource::do_allocate(size_t bytes, size_t alignment)
+	{
+		AEON_MEMORY_SCOPE(mTag);
+		return mUpstream->allocate(bytes, alignment);
+	}
+
+	void TrackedResource::do_deallocate(void* ptr, size_t bytes, size_t alignment)
+	{
+		mUpstream->deallocate(ptr, bytes, alignment);
+	}
+
+	bool TrackedResource::do_is_equal(const std::pmr::memory_resource& other) const noexcept
+	{
+		return this == &other;
+	}
+
+	// ForwardingResource
+		// Public constructor(s)
+	ForwardingResource::ForwardingResource() noexcept
+		: mUpstream(std::pmr::get_default_resource())
+		, mLiveBytes(0)
+	{
+	}
+
+		// Public method(s)
+	bool ForwardingResource::setUpstream(std::pmr::memory_resource* upstream) noexcept
+	{
+		// Check if blocks allocated from the current upstream resource are still live
+		if (mLiveBytes.load(std::memory_order_acquire) != 0) {
+			AEON_LOG_ERROR("Memory still in use", "The upstream resource can't be replaced while blocks allocated from it are live.\nAborting operation.");
+			return false;
+		}
+
+		mUpstream.store((upstream) ? upstream : std::pmr::get_default_resource(), std::memory_order_release);
+		return true;
+	}
+
+	std::pmr::memory_resource* ForwardingResource::getUpstream() const noexcept
+	{
+		return mUpstream.load(std::memory_order_acquire);
+	}
+
+	size_t ForwardingResource::getLiveBytes() const noexcept
+	{
+		return mLiveBytes.load(std::memory_order_relaxed);
+	}
+
+		// Private virtual method(s)
+	void* ForwardingResource::do_allocate(size_t bytes, size_t alignment)
+	{
+		void* const BLOCK = mUpstream.load(std::memory_order_acquire)->allocate(bytes, alignment);
+		mLiveBytes.fetch_add(bytes, std::memory_order_relaxed);
+		return BLOCK;
+	}
+
+	void ForwardingResource::do_deallocate(void* ptr, size_t bytes, size_t alignment)
+	{
+		mLiveBytes.fetch_sub(bytes, std::memory_order_release);
+		mUpstream.load(std::memory_order_acquire)->deallocate(ptr, bytes, alignment);
+	}
+
+	bool ForwardingResource::do_is_equal(const std::pmr::memory_resource& other) const noexcept
+	{
+		return this == &other;
+	}
+}
\ No newline at end of file
@@ -0,0 +1,346 @@
+// MIT License
+// 
+// Copyright(c) 2019-2021 Filippos Gleglakos
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <AEON/System/MemoryTracker.h>
+
+#include <atomic>
+#include <cstdlib>
+#include <limits>
+
+namespace ae
+{
+	namespace
+	{
+		// The counters of a tag (the atomics are zero-initialized so that the allocations made before main() are accounted for)
+		struct TagCounters
+		{
+			std::atomic<int64_t>  liveBytes;
+			std::atomic<int64_t>  peakBytes;
+			std::atomic<uint64_t> allocationCount;
+			std::atomic<uint64_t> frameAllocations;
+			std::atomic<uint64_t> lastFrameAllocations;
+		};
+
+		constexpr size_t TAG_COUNT = static_cast<size_t>(MemoryTag::Count);
+
+		// The counters of every tag followed by the combined counters
+		TagCounters counters[TAG_COUNT + 1];
+
+		// The tag of the innermost scope open on the thread
+		thread_local MemoryTag currentTag = MemoryTag::Untagged;
+
+		// Raises the peak provided to the live bytes if they exceed it
+		void updatePeak(std::atomic<int64_t>& peak, int64_t liveBytes) noexcept
+		{
+			int64_t previousPeak = peak.load(std::memory_order_relaxed);
+			while (liveBytes > previousPeak && !peak.compare_exchange_weak(previousPeak, liveBytes, std::memory_order_relaxed)) {}
+		}
+
+		// Converts the counters provided into statistics (the live bytes may momentarily be negative as the threads' updates are relaxed)
+		MemoryTracker::Statistics getCounterStatistics(const TagCounters& tagCounters) noexcept
+		{
+			const int64_t LIVE_BYTES = tagCounters.liveBytes.load(std::memory_order_relaxed);
+			const int64_t PEAK_BYTES = tagCounters.peakBytes.load(std::memory_order_relaxed);
+			return MemoryTracker::Statistics{
+				static_cast<size_t>((LIVE_BYTES > 0) ? LIVE_BYTES : 0),
+				static_cast<size_t>((PEAK_BYTES > 0) ? PEAK_BYTES : 0),
+				tagCounters.allocationCount.load(std::memory_order_relaxed),
+				tagCounters.lastFrameAllocations.load(std::memory_order_relaxed)
+			};
+		}
+
+#if AEON_MEMORY_TRACKING
+		// The header placed in front of each tracked block
+		struct BlockHeader
+		{
+			void*     block; //!< The address returned by std::malloc()
+			size_t    size;  //!< The number of bytes requested
+			MemoryTag tag;   //!< The tag to which the block is attributed
+		};
+
+		// Checks whether a block of the size and the alignment provided can be allocated with its header without the total size wrapping around
+		bool isAllocatable(size_t size, size_t alignment) noexcept
+		{
+			alignment = (alignment < alignof(BlockHeader)) ? alignof(BlockHeader) : alignment;
+			return size <= std::numeric_limits<size_t>::max() - sizeof(BlockHeader) - (alignment - 1);
+		}
+
+		// Allocates a block of the size and the alignment provided preceded by its header (nullptr if the allocation failed or the size is too large)
+		void* allocateTracked(size_t size, size_t alignment) noexcept
+		{
+			if (!isAllocatable(size, alignment)) {
+				return nullptr;
+			}
+
+			alignment = (alignment < alignof(BlockHeader)) ? alignof(BlockHeader) : alignment;
+			void* const BLOCK = std::malloc(size + sizeof(BlockHeader) + alignment - 1);
+			if (!BLOCK) {
+				return nullptr;
+			}
+
+			// Align the address returned past the header
+			const uintptr_t ADDRESS = (reinterpret_cast<uintptr_t>(BLOCK) + sizeof(BlockHeader) + alignment - 1) & ~(static_cast<uintptr_t>(alignment) - 1);
+			BlockHeader* const header = reinterpret_cast<BlockHeader*>(ADDRESS) - 1;
+			header->block = BLOCK;
+			header->size = size;
+			header->tag = currentTag;
+
+			MemoryTracker::recordAllocation(header->tag, size);
+			return reinterpret_cast<void*>(ADDRESS);
+		}
+
+		// Allocates a tracked block, calling the new handler until the allocation succeeds like the default new operators
+		void* allocateOrThrow(size_t size, size_t alignment)
+		{
+			// No handler can make a size that doesn't fit alongside the header allocatable
+			size = (size != 0) ? size : 1;
+			if (!isAllocatable(size, alignment)) {
+				throw std::bad_alloc();
+			}
+			void* ptr = allocateTracked(size, alignment);
+			while (!ptr) {
+				const std::new_handler HANDLER = std::get_new_handler();
+				if (!HANDLER) {
+					throw std::bad_alloc();
+				}
+
+				HANDLER();
+				ptr = allocateTracked(size, alignment);
+			}
+
+			return ptr;
+		}
+
+		// Deallocates a tracked block, the size and the tag being retrieved from its header
+		void deallocateTracked(void* ptr) noexcept
+		{
+			if (!ptr) {
+				return;
+			}
+
+			const BlockHeader* const HEADER = static_cast<const BlockHeader*>(ptr) - 1;
+			MemoryTracker::recordDeallocation(HEADER->tag, HEADER->size);
+			std::free(HEADER->block);
+		}
+#endif // AEON_MEMORY_TRACKING
+	}
+
+	// MemoryTracker::Scope
+		// Public constructor(s)
+	MemoryTracker::Scope::Scope(MemoryTag tag) noexcept
+		: mPreviousTag(currentTag)
+	{
+		currentTag = tag;
+	}
+
+	MemoryTracker::Scope::~Scope()
+	{
+		currentTag = mPreviousTag;
+	}
+
+	// MemoryTracker
+		// Public static method(s)
+	void MemoryTracker::recordAllocation(MemoryTag tag, size_t size) noexcept
+	{
+		const size_t INDEX = static_cast<size_t>(tag);
+		if (INDEX >= TAG_COUNT) {
+			return;
+		}
+
+		// Update the tag's counters and the combined counters
+		const int64_t SIZE = static_cast<int64_t>(size);
+		for (TagCounters* const tagCounters : { &counters[INDEX], &counters[TAG_COUNT] }) {
+			const int64_t LIVE_BYTES = tagCounters->liveBytes.fetch_add(SIZE, std::memory_order_relaxed) + SIZE;
+			updatePeak(tagCounters->peakBytes, LIVE_BYTES);
+			tagCounters->allocationCount.fetch_add(1, std::memory_order_relaxed);
+			tagCounters->frameAllocations.fetch_add(1, std::memory_order_relaxed);
+		}
+	}
+
+	void MemoryTracker::recordDeallocation(MemoryTag tag, size_t size) noexcept
+	{
+		const size_t INDEX = static_cast<size_t>(tag);
+		if (INDEX >= TAG_COUNT) {
+			return;
+		}
+
+		const int64_t SIZE = static_cast<int64_t>(size);
+		counters[INDEX].liveBytes.fetch_sub(SIZE, std::memory_order_relaxed);
+		counters[TAG_COUNT].liveBytes.fetch_sub(SIZE, std::memory_order_relaxed);
+	}
+
+	void MemoryTracker::endFrame() noexcept
+	{
+		for (TagCounters& tagCounters : counters) {
+			tagCounters.lastFrameAllocations.store(tagCounters.frameAllocations.exchange(0, std::memory_order_relaxed), std::memory_order_relaxed);
+		}
+	}
+
+	void MemoryTracker::resetPeaks() noexcept
+	{
+		for (TagCounters& tagCounters : counters) {
+			tagCounters.peakBytes.store(tagCounters.liveBytes.load(std::memory_order_relaxed), std::memory_order_relaxed);
+		}
+	}
+
+	MemoryTracker::Statistics MemoryTracker::getStatistics(MemoryTag tag) noexcept
+	{
+		const size_t INDEX = static_cast<size_t>(tag);
+		return (INDEX < TAG_COUNT) ? getCounterStatistics(counters[INDEX]) : Statistics{ 0, 0, 0, 0 };
+	}
+
+	MemoryTracker::Statistics MemoryTracker::getStatistics() noexcept
+	{
+		return getCounterStatistics(counters[TAG_COUNT]);
+	}
+
+	MemoryTag MemoryTracker::getCurrentTag() noexcept
+	{
+		return currentTag;
+	}
+
+	const char* MemoryTracker::getTagName(MemoryTag tag) noexcept
+	{
+		switch (tag)
+		{
+		case MemoryTag::Untagged:
+			return "Untagged";
+		case MemoryTag::Renderer:
+			return "Renderer";
+		case MemoryTag::SceneGraph:
+			return "Scene graph";
+		case MemoryTag::Text:
+			return "Text";
+		case MemoryTag::GUI:
+			return "GUI";
+		case MemoryTag::Events:
+			return "Events";
+		case MemoryTag::Logging:
+			return "Logging";
+		default:
+			return "Unknown";
+		}
+	}
+}
+
+#if AEON_MEMORY_TRACKING
+// Global replacement new and delete operators
+void* operator new(size_t size)
+{
+	return ae::allocateOrThrow(size, __STDCPP_DEFAULT_NEW_ALIGNMENT__);
+}
+
+void* operator new[](size_t size)
+{
+	return ae::allocateOrThrow(size, __STDCPP_DEFAULT_NEW_ALIGNMENT__);
+}
+
+void* operator new(size_t size, std::align_val_t alignment)
+{
+	return ae::allocateOrThrow(size, static_cast<size_t>(alignment));
+}
+
+void* operator new[](size_t size, std::align_val_t alignment)
+{
+	return ae::allocateOrThrow(size, static_cast<size_t>(alignment));
+}
+
+void* operator new(size_t size, const std::nothrow_t&) noexcept
+{
+	return ae::allocateTracked((size != 0) ? size : 1, __STDCPP_DEFAULT_NEW_ALIGNMENT__);
+}
+
+void* operator new[](size_t size, const std::nothrow_t&) noexcept
+{
+	return ae::allocateTracked((size != 0) ? size : 1, __STDCPP_DEFAULT_NEW_ALIGNMENT__);
+}
+
+void* operator new(size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept
+{
+	return ae::allocateTracked((size != 0) ? size : 1, static_cast<size_t>(alignment));
+}
+
+void* operator new[](size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept
+{
+	return ae::allocateTracked((size != 0) ? size : 1, static_cast<size_t>(alignment));
+}
+
+void operator delete(void* ptr) noexcept
+{
+	ae::deallocateTracked(ptr);
+}
+
+void operator delete[](void* ptr) noexcept
+{
+	ae::deallocateTracked(ptr);
+}
+
+void operator delete(void* ptr, size_t) noexcept
+{
+	ae::deallocateTracked(ptr);
+}
+
+void operator delete[](void* ptr, size_t) noexcept
+{
+	ae::deallocateTracked(ptr);
+}
+
+void operator delete(void* ptr, std::align_val_t) noexcept
+{
+	ae::deallocateTracked(ptr);
+}
+
+void operator delete[](void* ptr, std::align_val_t) noexcept
+{
+	ae::deallocateTracked(ptr);
+}
+
+void operator delete(void* ptr, size_t, std::align_val_t) noexcept
+{
+	ae::deallocateTracked(ptr);
+}
+
+void operator delete[](void* ptr, size_t, std::align_val_t) noexcept
+{
+	ae::deallocateTracked(ptr);
+}
+
+void operator delete(void* ptr, const std::nothrow_t&) noexcept
+{
+	ae::deallocateTracked(ptr);
+}
+
+void operator delete[](void* ptr, const std::nothrow_t&) noexcept
+{
+	ae::deallocateTracked(ptr);
+}
+
+void operator delete(void* ptr, std::align_val_t, const std::nothrow_t&) noexcept
+{
+	ae::deallocateTracked(ptr);
+}
+
+void operator delete[](void* ptr, std::align_val_t, const std::nothrow_t&) noexcept
+{
+	ae::deallocateTracked(ptr);
+}
+#endif // AEON_MEMORY_TRACKING
\ No newline at end of file
@@ -0,0 +1,277 @@
+// MIT License
+// 
+// Copyright(c) 2019-2021 Filippos Gleglakos
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <AEON/System/Profiler.h>
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <iomanip>
+#include <sstream>
+
+#include <AEON/System/DebugLogger.h>
+#include <AEON/System/FileSystem.h>
+
+namespace ae
+{
+	// Profiler::ThreadRing
+	/*!
+	 \brief The internal struct representing the ring buffer into which a single thread records its events.
+	 \details Only the owning thread writes to the ring, the other threads may read it concurrently by checking the write index after copying the events.
+	*/
+	struct Profiler::ThreadRing
+	{
+		// Public static member(s)
+		static constexpr size_t CAPACITY = 16384; //!< The maximum number of events held by the ring
+		static constexpr size_t MAX_DEPTH = 64;   //!< The maximum number of nested scopes that are recorded
+
+		// Public member(s)
+		std::array<Event, CAPACITY>  events;     //!< The ring's events
+		std::array<Event, MAX_DEPTH> openEvents; //!< The scopes currently open
+		std::atomic<uint64_t>        head;       //!< The total number of events written to the ring
+		std::atomic<uint64_t>        tail;       //!< The index of the first event that hasn't been cleared
+		uint32_t                     depth;      //!< The number of scopes currently open
+		uint32_t                     id;         //!< The identifier of the owning thread in the exported traces
+		std::string                  name;       //!< The name of the owning thread in the exported traces
+		std::atomic<bool>            leased;     //!< Whether the ring is currently owned by a running thread
+
+		// Public constructor(s)
+		explicit ThreadRing(uint32_t threadID)
+			: events()
+			, openEvents()
+			, head(0)
+			, tail(0)
+			, depth(0)
+			, id(threadID)
+			, name("Thread " + std::to_string(threadID))
+			, leased(true)
+		{
+		}
+	};
+
+	// Profiler::Scope
+		// Public constructor(s)
+	Profiler::Scope::Scope(const char* name) noexcept
+		: mRecorded(Profiler::getInstance().isEnabled())
+	{
+		if (mRecorded) {
+			Profiler::getInstance().beginScope(name);
+		}
+	}
+
+	Profiler::Scope::~Scope()
+	{
+		if (mRecorded) {
+			Profiler::getInstance().endScope();
+		}
+	}
+
+	// Profiler
+		// Public destructor
+	Profiler::~Profiler()
+	{
+	}
+
+		// Public method(s)
+	void Profiler::beginScope(const char* name) noexcept
+	{
+		if (!mEnabled.load(std::memory_order_relaxed)) {
+			return;
+		}
+
+		// Record the scope's beginning (the deepest scopes are ignored)
+		ThreadRing& ring = getThreadRing();
+		if (ring.depth < ThreadRing::MAX_DEPTH) {
+			Event& event = ring.openEvents[ring.depth];
+			event.name = name;
+			event.depth = ring.depth;
+			event.start = getTimestamp();
+		}
+		++ring.depth;
+	}
+
+	void Profiler::endScope() noexcept
+	{
+		// Check if the calling thread has any open scopes
+		ThreadRing& ring = getThreadRing();
+		if (ring.depth == 0) {
+			return;
+		}
+
+		// Complete the scope's event and write it to the ring (overwriting the oldest event if it's full)
+		if (--ring.depth < ThreadRing::MAX_DEPTH) {
+			Event event = ring.openEvents[ring.depth];
+			event.duration = getTimestamp() - event.start;
+
+			const uint64_t HEAD = ring.head.load(std::memory_order_relaxed);
+			ring.events[HEAD % ThreadRing::CAPACITY] = event;
+			ring.head.store(HEAD + 1, std::memory_order_release);
+		}
+	}
+
+	void Profiler::setThreadName(const std::string& name)
+	{
+		ThreadRing& ring = getThreadRing();
+
+		std::lock_guard<std::mutex> lock(mRingMutex);
+		ring.name = name;
+	}
+
+	void Profiler::clear()
+	{
+		// Move the rings' tails to their heads so that the events previously written are ignored
+		std::lock_guard<std::mutex> lock(mRingMutex);
+		for (const std::unique_ptr<ThreadRing>& ring : mRings) {
+			ring->tail.store(ring->head.load(std::memory_order_acquire), std::memory_order_release);
+		}
+	}
+
+	void Profiler::exportChromeTrace(const std::string& filepath)
+	{
+		std::ostringstream json;
+		json << std::fixed << std::setprecision(3) << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+
+		// Escapes the characters that would otherwise invalidate the JSON strings
+		const auto escape = [](const std::string& str) {
+			std::string escaped;
+			escaped.reserve(str.size());
+			for (const char c : str) {
+				if (c == '"' || c == '\\') {
+					escaped += '\\';
+				}
+				escaped += (c < ' ') ? ' ' : c;
+			}
+			return escaped;
+		};
+
+		// Write each thread's name followed by its events as complete events (in microseconds)
+		bool first = true;
+		std::vector<Event> events;
+		std::lock_guard<std::mutex> lock(mRingMutex);
+		for (const std::unique_ptr<ThreadRing>& ring : mRings)
+		{
+			json << (first ? "" : ",") << "\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":" << ring->id
+			     << ",\"args\":{\"name\":\"" << escape(ring->name) << "\"}}";
+			first = false;
+
+			events.clear();
+			copyEvents(*ring, events);
+			for (const Event& event : events) {
+				json << ",\n{\"name\":\"" << escape(event.name) << "\",\"cat\":\"aeon\",\"ph\":\"X\",\"ts\":" << event.start / 1000.0
+				     << ",\"dur\":" << event.duration / 1000.0 << ",\"pid\":0,\"tid\":" << ring->id << "}";
+			}
+		}
+		json << "\n]}";
+
+		FileSystem::writeFile(filepath, json.str(), FileSystem::OpenMode::Truncate);
+	}
+
+	void Profiler::setEnabled(bool flag) noexcept
+	{
+		mEnabled.store(flag, std::memory_order_relaxed);
+	}
+
+	std::vector<Profiler::Event> Profiler::getEvents()
+	{
+		std::vector<Event> events;
+		copyEvents(getThreadRing(), events);
+
+		return events;
+	}
+
+	bool Profiler::isEnabled() const noexcept
+	{
+		return mEnabled.load(std::memory_order_relaxed);
+	}
+
+		// Public static method(s)
+	Profiler& Profiler::getInstance()
+	{
+		static Profiler instance;
+		return instance;
+	}
+
+		// Private constructor(s)
+	Profiler::Profiler()
+		: mRings()
+		, mRingMutex()
+		, mEpoch(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count())
+		, mEnabled(false)
+	{
+	}
+
+		// Private method(s)
+	Profiler::ThreadRing& Profiler::getThreadRing()
+	{
+		// The lease returns the ring once its thread finishes so that short-lived threads don't accumulate rings
+		struct RingLease
+		{
+			ThreadRing* ring = nullptr;
+			~RingLease() { if (ring) ring->leased.store(false, std::memory_order_release); }
+		};
+
+		// Lend a ring to the calling thread the first time that it opens a scope, reusing the one of a finished thread if possible
+		static thread_local RingLease lease;
+		if (!lease.ring) {
+			std::lock_guard<std::mutex> lock(mRingMutex);
+			for (const std::unique_ptr<ThreadRing>& ring : mRings) {
+				bool expected = false;
+				if (ring->leased.compare_exchange_strong(expected, true, std::memory_order_acquire)) {
+					lease.ring = ring.get();
+					break;
+				}
+			}
+
+			if (!lease.ring) {
+				mRings.emplace_back(std::make_unique<ThreadRing>(static_cast<uint32_t>(mRings.size() + 1)));
+				lease.ring = mRings.back().get();
+			}
+		}
+
+		return *lease.ring;
+	}
+
+	void Profiler::copyEvents(const ThreadRing& ring, std::vector<Event>& events) const
+	{
+		// Copy the events that haven't been cleared nor overwritten
+		const uint64_t HEAD = ring.head.load(std::memory_order_acquire);
+		const uint64_t FIRST = std::max(ring.tail.load(std::memory_order_acquire), (HEAD > ThreadRing::CAPACITY) ? HEAD - ThreadRing::CAPACITY : 0);
+		const size_t OFFSET = events.size();
+		for (uint64_t i = FIRST; i < HEAD; ++i) {
+			events.push_back(ring.events[i % ThreadRing::CAPACITY]);
+		}
+
+		// Discard the events that the owning thread may have overwritten during the copy
+		std::atomic_thread_fence(std::memory_order_acquire);
+		const uint64_t NEW_HEAD = ring.head.load(std::memory_order_relaxed);
+		const uint64_t FIRST_VALID = (NEW_HEAD + 1 > ThreadRing::CAPACITY) ? NEW_HEAD + 1 - ThreadRing::CAPACITY : 0;
+		if (FIRST_VALID > FIRST) {
+			const size_t OVERWRITTEN = static_cast<size_t>(std::min(FIRST_VALID, HEAD) - FIRST);
+			events.erase(events.begin() + OFFSET, events.begin() + OFFSET + OVERWRITTEN);
+		}
+	}
+
+	int64_t Profiler::getTimestamp() const noexcept
+	{
+		return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count() - mEpoch;
+	}
+}
\ No newline at end of file
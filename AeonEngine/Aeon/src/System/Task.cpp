@@ -0,0 +1,187 @@
+// MIT License
+// 
+// Copyright(c) 2019-2021 Filippos Gleglakos
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <AEON/System/Task.h>
+
+#if AEON_COROUTINES
+#include <exception>
+#include <utility>
+
+namespace ae
+{
+	// Task::promise_type
+		// Public method(s)
+	Task Task::promise_type::get_return_object() noexcept
+	{
+		const Handle HANDLE = Handle::from_promise(*this);
+		continuation->handle = HANDLE;
+		return Task(HANDLE);
+	}
+
+	std::suspend_never Task::promise_type::initial_suspend() const noexcept
+	{
+		return std::suspend_never();
+	}
+
+	void Task::promise_type::return_void() const noexcept
+	{
+	}
+
+	void Task::promise_type::unhandled_exception() const noexcept
+	{
+		std::terminate();
+	}
+
+	// Task
+		// Public constructor(s)
+	Task::Task() noexcept
+		: mHandle(nullptr)
+	{
+	}
+
+	Task::Task(Handle handle) noexcept
+		: mHandle(handle)
+	{
+	}
+
+	Task::Task(Task&& rvalue) noexcept
+		: mHandle(std::exchange(rvalue.mHandle, nullptr))
+	{
+	}
+
+	Task::~Task()
+	{
+		cancel();
+	}
+
+		// Public operator(s)
+	Task& Task::operator=(Task&& rvalue) noexcept
+	{
+		if (this != &rvalue) {
+			cancel();
+			mHandle = std::exchange(rvalue.mHandle, nullptr);
+		}
+
+		return *this;
+	}
+
+		// Public method(s)
+	void Task::cancel() noexcept
+	{
+		// The continuation is reset so that the pending resumptions are ignored, the awaited operations being cancelled by their awaitables' destructors
+		if (mHandle) {
+			mHandle.promise().continuation->handle = nullptr;
+			mHandle.destroy();
+			mHandle = nullptr;
+		}
+	}
+
+	bool Task::isDone() const noexcept
+	{
+		return !mHandle || mHandle.done();
+	}
+
+	// TaskScheduler
+		// Public method(s)
+	void TaskScheduler::schedule(std::weak_ptr<Task::Continuation> continuation)
+	{
+		std::lock_guard<std::mutex> lock(mMutex);
+		mQueued.push_back(std::move(continuation));
+	}
+
+	void TaskScheduler::update()
+	{
+		// Retrieve the tasks queued thus far, the ones queued by the resumed tasks are resumed during the next call
+		{
+			std::lock_guard<std::mutex> lock(mMutex);
+			if (mQueued.empty()) {
+				return;
+			}
+			mResumed.swap(mQueued);
+		}
+
+		// Resume the tasks that weren't destroyed in the meantime
+		for (const std::weak_ptr<Task::Continuation>& continuation : mResumed) {
+			const std::shared_ptr<Task::Continuation> CONTINUATION = continuation.lock();
+			if (CONTINUATION && CONTINUATION->handle) {
+				CONTINUATION->handle.resume();
+			}
+		}
+		mResumed.clear();
+	}
+
+		// Public static method(s)
+	TaskScheduler& TaskScheduler::getInstance()
+	{
+		static TaskScheduler instance;
+		return instance;
+	}
+
+		// Private constructor(s)
+	TaskScheduler::TaskScheduler()
+		: mMutex()
+		, mQueued()
+		, mResumed()
+	{
+	}
+
+	// WaitAwaiter
+		// Public constructor(s)
+	WaitAwaiter::WaitAwaiter(const Time& duration) noexcept
+		: mDuration(duration)
+		, mTimer(0)
+	{
+	}
+
+	WaitAwaiter::~WaitAwaiter()
+	{
+		// The timer is no longer scheduled if it has already expired
+		if (mTimer != 0) {
+			TimerWheel::getInstance().cancel(mTimer);
+		}
+	}
+
+		// Public method(s)
+	bool WaitAwaiter::await_ready() const noexcept
+	{
+		return false;
+	}
+
+	void WaitAwaiter::await_suspend(Task::Handle caller)
+	{
+		std::weak_ptr<Task::Continuation> continuation = caller.promise().continuation;
+		mTimer = TimerWheel::getInstance().schedule(mDuration, [continuation = std::move(continuation)]() {
+			TaskScheduler::getInstance().schedule(continuation);
+		});
+	}
+
+	void WaitAwaiter::await_resume() const noexcept
+	{
+	}
+
+	// Public function(s)
+	WaitAwaiter wait(const Time& duration) noexcept
+	{
+		return WaitAwaiter(duration);
+	}
+}
+#endif // AEON_COROUTINES
\ No newline at end of file
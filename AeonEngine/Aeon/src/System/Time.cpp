@@ -23,22 +23,23 @@
 #include <AEON/System/Time.h>
 
 #include <ctime>
+#include <cmath>
 
 #include <AEON/System/DebugLogger.h>
 
 namespace ae
 {
 	// Public static member(s)
-	const Time Time::Zero(0.0);
+	const Time Time::Zero(int64_t(0));
 
 	// Public constructor(s)
 	Time::Time() noexcept
-		: mSeconds(0.0)
+		: mNanoseconds(0)
 	{
 	}
 
 	Time::Time(Time&& rvalue) noexcept
-		: mSeconds(rvalue.mSeconds)
+		: mNanoseconds(rvalue.mNanoseconds)
 	{
 	}
 
@@ -46,36 +47,37 @@ namespace ae
 	Time& Time::operator=(Time&& rvalue) noexcept
 	{
 		// Copy the rvalue's trivial data
-		mSeconds = rvalue.mSeconds;
+		mNanoseconds = rvalue.mNanoseconds;
 		return *this;
 	}
 
 	Time Time::operator+(const Time& other) const noexcept
 	{
-		return Time(mSeconds + other.mSeconds);
+		return Time(mNanoseconds + other.mNanoseconds);
 	}
 
 	Time Time::operator-(const Time& other) const noexcept
 	{
-		return Time(mSeconds - other.mSeconds);
+		return Time(mNanoseconds - other.mNanoseconds);
 	}
 
 	Time Time::operator/(const Time& other) const noexcept
 	{
 		// Check that the other's time value isn't equal to 0 (ignored in Release mode)
 		if _CONSTEXPR_IF (AEON_DEBUG) {
-			if (other.mSeconds == 0.0) {
-				AEON_LOG_ERROR("Attempt to divide by 0", "The time value provided is equal to 0.0.\nRetrieving erroneous data.");
-				return Time(mSeconds);
+			if (other.mNanoseconds == 0) {
+				AEON_LOG_ERROR("Attempt to divide by 0", "The time value provided is equal to 0.\nRetrieving erroneous data.");
+				return Time(mNanoseconds);
 			}
 		}
 
-		return Time(mSeconds / other.mSeconds);
+		// The quotient is a ratio, it's stored as seconds
+		return Time::seconds(static_cast<double>(mNanoseconds) / static_cast<double>(other.mNanoseconds));
 	}
 
 	Time Time::operator*(double scale) const noexcept
 	{
-		return Time(mSeconds * scale);
+		return Time(static_cast<int64_t>(std::llround(static_cast<double>(mNanoseconds) * scale)));
 	}
 
 	Time Time::operator/(double scale) const
@@ -84,28 +86,28 @@ namespace ae
 		if _CONSTEXPR_IF (AEON_DEBUG) {
 			if (scale == 0.0) {
 				AEON_LOG_ERROR("Attempt to divide by 0", "The scale value provided is equal to 0.0.\nRetrieving erroneous data.");
-				return Time(mSeconds);
+				return Time(mNanoseconds);
 			}
 		}
 
-		return Time(mSeconds / scale);
+		return Time(static_cast<int64_t>(std::llround(static_cast<double>(mNanoseconds) / scale)));
 	}
 
 	Time& Time::operator+=(const Time& other) noexcept
 	{
-		mSeconds += other.mSeconds;
+		mNanoseconds += other.mNanoseconds;
 		return *this;
 	}
 
 	Time& Time::operator-=(const Time& other) noexcept
 	{
-		mSeconds -= other.mSeconds;
+		mNanoseconds -= other.mNanoseconds;
 		return *this;
 	}
 
 	Time& Time::operator*=(double scale) noexcept
 	{
-		mSeconds *= scale;
+		mNanoseconds = static_cast<int64_t>(std::llround(static_cast<double>(mNanoseconds) * scale));
 		return *this;
 	}
 
@@ -119,81 +121,91 @@ namespace ae
 			}
 		}
 
-		mSeconds /= scale;
+		mNanoseconds = static_cast<int64_t>(std::llround(static_cast<double>(mNanoseconds) / scale));
 		return *this;
 	}
 
 	bool Time::operator==(const Time& other) const noexcept
 	{
-		return (mSeconds == other.mSeconds);
+		return (mNanoseconds == other.mNanoseconds);
 	}
 
 	bool Time::operator!=(const Time& other) const noexcept
 	{
-		return (mSeconds != other.mSeconds);
+		return (mNanoseconds != other.mNanoseconds);
 	}
 
 	bool Time::operator<(const Time& other) const noexcept
 	{
-		return (mSeconds < other.mSeconds);
+		return (mNanoseconds < other.mNanoseconds);
 	}
 
 	bool Time::operator<=(const Time& other) const noexcept
 	{
-		return (mSeconds <= other.mSeconds);
+		return (mNanoseconds <= other.mNanoseconds);
 	}
 
 	bool Time::operator>(const Time& other) const noexcept
 	{
-		return (mSeconds > other.mSeconds);
+		return (mNanoseconds > other.mNanoseconds);
 	}
 
 	bool Time::operator>=(const Time& other) const noexcept
 	{
-		return (mSeconds >= other.mSeconds);
+		return (mNanoseconds >= other.mNanoseconds);
 	}
 
 	// Friend operator(s)
 	Time operator*(double scale, const Time& time) noexcept
 	{
-		return Time(scale * time.mSeconds);
+		return time * scale;
 	}
 
 	Time operator-(const Time& time) noexcept
 	{
-		return Time(-time.mSeconds);
+		return Time(-time.mNanoseconds);
 	}
 
 	// Public method(s)
 	int_fast32_t Time::asMilliseconds() const noexcept
 	{
-		return static_cast<int_fast32_t>(mSeconds * 1000.0);
+		return static_cast<int_fast32_t>(mNanoseconds / 1'000'000);
 	}
 
 	int_fast64_t Time::asMicroseconds() const noexcept
 	{
-		return static_cast<int_fast64_t>(mSeconds * 1'000'000.0);
+		return static_cast<int_fast64_t>(mNanoseconds / 1'000);
+	}
+
+	int64_t Time::asNanoseconds() const noexcept
+	{
+		return mNanoseconds;
 	}
 
 	double Time::asSeconds() const noexcept
 	{
-		return mSeconds;
+		return static_cast<double>(mNanoseconds) / 1'000'000'000.0;
 	}
 
 	// Public static method(s)
 	Time Time::seconds(double seconds) noexcept
 	{
-		return Time(seconds);
+		return Time(static_cast<int64_t>(std::llround(seconds * 1'000'000'000.0)));
 	}
 
 	Time Time::milliseconds(int_fast32_t milliseconds) noexcept
 	{
-		return Time(static_cast<double>(milliseconds) / 1000.0);
+		return Time(static_cast<int64_t>(milliseconds) * 1'000'000);
 	}
 
 	Time Time::microseconds(int_fast64_t microseconds) noexcept
 	{
-		return Time(static_cast<double>(microseconds) / 1'000'000.0);
+		return Time(static_cast<int64_t>(microseconds) * 1'000);
+	}
+
+	Time Time::nanoseconds(int64_t nanoseconds) noexcept
+	{
+		return Time(nanoseconds);
 	}
 
 	std::string Time::getSystemDate()
@@ -235,8 +247,8 @@ namespace ae
 	}
 
 	// Private constructor(s)
-	Time::Time(double seconds) noexcept
-		: mSeconds(seconds)
+	Time::Time(int64_t nanoseconds) noexcept
+		: mNanoseconds(nanoseconds)
 	{
 	}
 }
\ No newline at end of file
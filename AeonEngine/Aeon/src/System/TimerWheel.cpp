@@ -0,0 +1,286 @@
+// MIT License
+// 
+// Copyright(c) 2019-2021 Filippos Gleglakos
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <AEON/System/TimerWheel.h>
+
+#include <algorithm>
+#include <iterator>
+#include <utility>
+
+#include <AEON/System/DebugLogger.h>
+#include <AEON/System/Profiler.h>
+
+namespace ae
+{
+	namespace
+	{
+		// The number of microseconds spanned by each slot of the wheel's finest level
+		constexpr int64_t TICK_MICROSECONDS = 1000;
+
+		// Converts the time provided into a number of ticks, rounded up so that the timers never expire early
+		uint64_t toTicks(const Time& time) noexcept
+		{
+			const int64_t MICROSECONDS = time.asMicroseconds();
+			return (MICROSECONDS > 0) ? static_cast<uint64_t>((MICROSECONDS + TICK_MICROSECONDS - 1) / TICK_MICROSECONDS) : 0;
+		}
+
+		// Assembles the identifier of a timer from its index and its generation
+		TimerWheel::TimerId makeTimerId(uint32_t index, uint32_t generation) noexcept
+		{
+			return (static_cast<TimerWheel::TimerId>(generation) << 32) | index;
+		}
+	}
+
+	// Public method(s)
+	TimerWheel::TimerId TimerWheel::schedule(const Time& delay, Callback callback, const Time& period)
+	{
+		// Check if a callback was provided (ignored in Release mode)
+		if _CONSTEXPR_IF (AEON_DEBUG) {
+			if (!callback) {
+				AEON_LOG_ERROR("Invalid callback", "The callback provided is empty.\nAborting operation.");
+				return 0;
+			}
+		}
+
+		// Reuse a released timer or create a new one
+		uint32_t index = mFreeTimer;
+		if (index != INVALID_INDEX) {
+			mFreeTimer = mTimers[index].next;
+		}
+		else {
+			index = static_cast<uint32_t>(mTimers.size());
+			mTimers.push_back(Timer{ Callback(), 0, 0, INVALID_INDEX, INVALID_INDEX, 1, 0, false, false });
+		}
+
+		// The timers expire during the next tick at the earliest
+		Timer& timer = mTimers[index];
+		timer.callback = std::move(callback);
+		timer.expiry = mCurrentTick + std::max(toTicks(delay), uint64_t(1));
+		timer.period = toTicks(period);
+		timer.active = true;
+		link(index);
+		++mTimerCount;
+
+		return makeTimerId(index, timer.generation);
+	}
+
+	bool TimerWheel::cancel(TimerId timer)
+	{
+		const uint32_t INDEX = getIndex(timer);
+		if (INDEX == INVALID_INDEX) {
+			return false;
+		}
+
+		// The expired timers aren't stored in a slot, their identifier is simply invalidated
+		if (mTimers[INDEX].linked) {
+			unlink(INDEX);
+		}
+		release(INDEX);
+
+		return true;
+	}
+
+	void TimerWheel::clear()
+	{
+		for (uint32_t i = 0; i < static_cast<uint32_t>(mTimers.size()); ++i) {
+			if (mTimers[i].active) {
+				if (mTimers[i].linked) {
+					unlink(i);
+				}
+				release(i);
+			}
+		}
+	}
+
+	void TimerWheel::advance(const Time& dt)
+	{
+		AEON_PROFILE_SCOPE("TimerWheel::advance");
+
+		// Retrieve the number of ticks elapsed, the remainder being carried over to the next advancement
+		mElapsedMicroseconds += dt.asMicroseconds();
+		const int64_t TICK_COUNT = mElapsedMicroseconds / TICK_MICROSECONDS;
+		if (TICK_COUNT <= 0) {
+			return;
+		}
+		mElapsedMicroseconds -= TICK_COUNT * TICK_MICROSECONDS;
+
+		// The ticks are skipped entirely if no timer is scheduled as all the slots are empty
+		if (mTimerCount == 0) {
+			mCurrentTick += static_cast<uint64_t>(TICK_COUNT);
+			return;
+		}
+		for (int64_t i = 0; i < TICK_COUNT; ++i) {
+			tick();
+		}
+
+		// Call the expired timers' callbacks in a single batch (the callbacks may schedule and cancel timers, including the expired ones)
+		for (const TimerId ID : mExpired) {
+			const uint32_t INDEX = getIndex(ID);
+			if (INDEX == INVALID_INDEX) {
+				continue;
+			}
+
+			// The callback is moved out of the timer as the callbacks scheduling timers may reallocate them
+			Callback callback = std::move(mTimers[INDEX].callback);
+			if (mTimers[INDEX].period == 0) {
+				release(INDEX);
+				callback();
+				continue;
+			}
+			callback();
+
+			// Reschedule the periodic timer from its previous expiry unless its callback cancelled it
+			if (getIndex(ID) == INDEX) {
+				Timer& timer = mTimers[INDEX];
+				timer.callback = std::move(callback);
+				timer.expiry = std::max(timer.expiry + timer.period, mCurrentTick + 1);
+				link(INDEX);
+			}
+		}
+		mExpired.clear();
+	}
+
+	bool TimerWheel::isScheduled(TimerId timer) const noexcept
+	{
+		return getIndex(timer) != INVALID_INDEX;
+	}
+
+	size_t TimerWheel::getTimerCount() const noexcept
+	{
+		return mTimerCount;
+	}
+
+	// Public static method(s)
+	TimerWheel& TimerWheel::getInstance()
+	{
+		static TimerWheel instance;
+		return instance;
+	}
+
+	// Private constructor(s)
+	TimerWheel::TimerWheel()
+		: mTimers()
+		, mExpired()
+		, mSlots()
+		, mFreeTimer(INVALID_INDEX)
+		, mCurrentTick(0)
+		, mElapsedMicroseconds(0)
+		, mTimerCount(0)
+	{
+		std::fill(std::begin(mSlots), std::end(mSlots), INVALID_INDEX);
+	}
+
+	// Private method(s)
+	void TimerWheel::link(uint32_t index) noexcept
+	{
+		Timer& timer = mTimers[index];
+
+		// Select the finest level whose span contains the remaining delay
+		const uint64_t DELAY = timer.expiry - mCurrentTick;
+		size_t level = 0;
+		while (level + 1 < LEVEL_COUNT && (DELAY >> (SLOT_BITS * (level + 1))) != 0) {
+			++level;
+		}
+
+		// The timers expiring beyond the wheel's span are stored in the last slot to be reached, and stored again once it's reached
+		const size_t SHIFT = SLOT_BITS * level;
+		const uint64_t SLOT_TICK = ((DELAY >> (SHIFT + SLOT_BITS)) != 0) ? (mCurrentTick >> SHIFT) + SLOT_COUNT - 1 : timer.expiry >> SHIFT;
+		const size_t SLOT = level * SLOT_COUNT + static_cast<size_t>(SLOT_TICK & (SLOT_COUNT - 1));
+
+		// Insert the timer at the front of the slot's list
+		timer.slot = static_cast<uint16_t>(SLOT);
+		timer.previous = INVALID_INDEX;
+		timer.next = mSlots[SLOT];
+		timer.linked = true;
+		if (timer.next != INVALID_INDEX) {
+			mTimers[timer.next].previous = index;
+		}
+		mSlots[SLOT] = index;
+	}
+
+	void TimerWheel::unlink(uint32_t index) noexcept
+	{
+		Timer& timer = mTimers[index];
+		if (timer.previous != INVALID_INDEX) {
+			mTimers[timer.previous].next = timer.next;
+		}
+		else {
+			mSlots[timer.slot] = timer.next;
+		}
+		if (timer.next != INVALID_INDEX) {
+			mTimers[timer.next].previous = timer.previous;
+		}
+		timer.linked = false;
+	}
+
+	void TimerWheel::release(uint32_t index)
+	{
+		// Destroy the callback's captures and invalidate the timer's identifier (the generation 0 is skipped as the identifier 0 is invalid)
+		Timer& timer = mTimers[index];
+		timer.callback = nullptr;
+		timer.active = false;
+		if (++timer.generation == 0) {
+			timer.generation = 1;
+		}
+
+		timer.next = mFreeTimer;
+		mFreeTimer = index;
+		--mTimerCount;
+	}
+
+	void TimerWheel::tick()
+	{
+		++mCurrentTick;
+
+		// Move the timers of the coarse slots reached to finer slots, the coarsest levels first so that their timers may be moved down to the finest one
+		for (size_t level = LEVEL_COUNT - 1; level > 0; --level) {
+			const size_t SHIFT = SLOT_BITS * level;
+			if ((mCurrentTick & ((uint64_t(1) << SHIFT) - 1)) != 0) {
+				continue;
+			}
+
+			const size_t SLOT = level * SLOT_COUNT + static_cast<size_t>((mCurrentTick >> SHIFT) & (SLOT_COUNT - 1));
+			uint32_t index = mSlots[SLOT];
+			mSlots[SLOT] = INVALID_INDEX;
+			while (index != INVALID_INDEX) {
+				const uint32_t NEXT = mTimers[index].next;
+				link(index);
+				index = NEXT;
+			}
+		}
+
+		// Collect the timers of the finest slot reached, which all expire during this tick
+		const size_t SLOT = static_cast<size_t>(mCurrentTick & (SLOT_COUNT - 1));
+		for (uint32_t index = mSlots[SLOT]; index != INVALID_INDEX; index = mTimers[index].next) {
+			mTimers[index].linked = false;
+			mExpired.push_back(makeTimerId(index, mTimers[index].generation));
+		}
+		mSlots[SLOT] = INVALID_INDEX;
+	}
+
+	uint32_t TimerWheel::getIndex(TimerId timer) const noexcept
+	{
+		const uint32_t INDEX = static_cast<uint32_t>(timer & 0xFFFFFFFF);
+		const uint32_t GENERATION = static_cast<uint32_t>(timer >> 32);
+		return (INDEX < mTimers.size() && mTimers[INDEX].active && mTimers[INDEX].generation == GENERATION) ? INDEX : INVALID_INDEX;
+	}
+}
\ No newline at end of file
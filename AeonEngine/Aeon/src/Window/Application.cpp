@@ -22,19 +22,39 @@
 
 #include <AEON/Window/Application.h>
 
+#include <algorithm>
+#include <thread>
+
 #include <GL/glew.h>
 #include <GLFW/glfw3.h>
 
 #include <AEON/System/Clock.h>
+#include <AEON/System/MemoryTracker.h>
+#include <AEON/System/Profiler.h>
+#include <AEON/System/Task.h>
+#include <AEON/System/TimerWheel.h>
 #include <AEON/Window/internal/EventQueue.h>
+#include <AEON/Window/internal/InputManager.h>
+#include <AEON/Window/EventBus.h>
 #include <AEON/Window/MonitorManager.h>
 #include <AEON/Graphics/GLResourceFactory.h>
+#include <AEON/Graphics/internal/GLCommon.h>
+#include <AEON/Graphics/internal/FontManager.h>
+#include <AEON/Graphics/FrameCapture.h>
+#include <AEON/Graphics/GPUProfiler.h>
+#include <AEON/Graphics/TextureLoader.h>
+#include <AEON/Graphics/TextureResidency.h>
+#include <AEON/Graphics/TweenSystem.h>
 
 namespace ae
 {
 	// Public destructor
 	Application::~Application()
 	{
+		if (mStartupThread.joinable()) {
+			mStartupThread.join();
+		}
+		mSecondaryWindows.clear();
 		glfwTerminate();
 	}
 
@@ -42,21 +62,76 @@ namespace ae
 	void Application::createWindow(const VideoMode& vidMode, const std::string& title, uint32_t style,
 	                               const ContextSettings& settings)
 	{
-		// Create the window and initialize GLEW
-		mWindow = std::make_unique<Window>(vidMode, title, style, settings);
-		glewExperimental = GL_TRUE;
-		GLenum glewError = glewInit();
-		if (glewError != GLEW_OK) {
-			AEON_LOG_ERROR("Initialization of GLEW failed", "Error: " + std::string(reinterpret_cast<const char*>(glewGetErrorString(glewError))));
+		AEON_PROFILE_SCOPE("Application::createWindow");
+
+		// Create the window (the monitors are enumerated on the main thread as required by GLFW)
+		Clock phaseClock;
+		{
+			AEON_PROFILE_SCOPE("Startup: Window creation");
+			mWindow = std::make_unique<Window>(vidMode, title, style, settings);
 		}
+		const Time WINDOW_TIME = phaseClock.restart();
+
+		// Initialize GLEW
+		{
+			AEON_PROFILE_SCOPE("Startup: GLEW initialization");
+			glewExperimental = GL_TRUE;
+			GLenum glewError = glewInit();
+			if (glewError != GLEW_OK) {
+				AEON_LOG_ERROR("Initialization of GLEW failed", "Error: " + std::string(reinterpret_cast<const char*>(glewGetErrorString(glewError))));
+			}
+		}
+		const Time GLEW_TIME = phaseClock.restart();
 
 		// Log an informational message indicating GLEW's version (ignored in Release mode)
 		if _CONSTEXPR_IF (AEON_DEBUG) {
 			AEON_LOG_INFO("GLEW Version", "Using GLEW " + std::string(reinterpret_cast<const char*>(glewGetString(GLEW_VERSION))));
 		}
 
+		// Report the OpenGL errors through the debug output (synchronously in Debug mode so that the errors are reported during the faulting call), unless the context doesn't validate the calls
+		gl::setNoErrorContext(settings.isNoErrorEnabled());
+		if (settings.isDebugOutputEnabled() && !settings.isNoErrorEnabled()) {
+			gl::enableDebugOutput(GL_DEBUG_SEVERITY_MEDIUM, AEON_DEBUG);
+		}
+
 		// Set the window as the active target
 		mWindow->activate();
+
+		// Create the built-in shaders and buffers now that a context exists (their links are submitted to the driver without waiting on them)
+		{
+			AEON_PROFILE_SCOPE("Startup: Built-in resources");
+			static_cast<void>(GLResourceFactory::getInstance());
+		}
+		const Time RESOURCES_TIME = phaseClock.restart();
+
+		// Wait for the font library's initialization, it will generally have completed during the window's creation
+		if (mStartupThread.joinable()) {
+			AEON_PROFILE_SCOPE("Startup: Font library wait");
+			mStartupThread.join();
+		}
+		const Time FONT_WAIT_TIME = phaseClock.restart();
+
+		// Log the duration of every startup phase (ignored in Release mode)
+		if _CONSTEXPR_IF (AEON_DEBUG) {
+			AEON_LOG_INFO("Startup timings", "GLFW initialization: " + std::to_string(mInitTime.asMicroseconds()) + "us\n"
+			                                 "Window creation: " + std::to_string(WINDOW_TIME.asMicroseconds()) + "us\n"
+			                                 "GLEW initialization: " + std::to_string(GLEW_TIME.asMicroseconds()) + "us\n"
+			                                 "Built-in resources: " + std::to_string(RESOURCES_TIME.asMicroseconds()) + "us\n"
+			                                 "Font library wait: " + std::to_string(FONT_WAIT_TIME.asMicroseconds()) + "us");
+		}
+	}
+
+	Window* Application::createSecondaryWindow(const VideoMode& vidMode, const std::string& title, uint32_t style)
+	{
+		// Check that the primary context exists
+		if (!mWindow) {
+			AEON_LOG_ERROR("No active window", "A secondary window can't be created before the application's active window.\nAborting operation.");
+			return nullptr;
+		}
+
+		// The context hints need to match the active window's for the contexts to be shared
+		mSecondaryWindows.push_back(std::make_unique<Window>(vidMode, title, style, mWindow->getContextSettings(), mWindow.get()));
+		return mSecondaryWindows.back().get();
 	}
 
 	void Application::pushState(uint32_t stateID)
@@ -77,20 +152,69 @@ namespace ae
 		Clock clock;
 
 		// The application's game loop
+		bool idle = false;
 		while (mWindow->isOpen())
 		{
-			processEvents();
+			// Wait for events if nothing changed during the previous frame (the time waited isn't simulated)
+			if (idle) {
+				AEON_PROFILE_SCOPE("Application::idle");
+				glfwWaitEventsTimeout(mIdleTimeout.asSeconds());
+				clock.restart();
+			}
+
+			// Time the frame's phases (the time waited for events isn't part of the frame)
+			const Time FRAME_START = Clock::getCurrentTime();
+			mFrameSample = FrameStatistics::Sample();
+
+			// Feed the recorded input in place of the live input before it's published if a session is being replayed
+			GPUProfiler::getInstance().beginFrame();
+			const bool REPLAYING = mInputRecorder.replayFrame();
+			InputManager::updateSnapshot();
+			const bool EVENTS_PROCESSED = processEvents();
+			mFrameSample.events = Clock::getCurrentTime() - FRAME_START;
+
+			// Keep the tracked textures within the video memory budget, upload the textures decoded and the glyphs rasterized in the background
+			// and destroy the resources the GPU is done with
+			TextureResidency::getInstance().update();
+			TextureLoader::getInstance().update();
+			FontManager::getInstance().update();
+			GLResourceFactory::getInstance().update();
 
-			// Retrieve the time elapsed and restart the clock
+			// Retrieve the time elapsed and restart the clock (the longer frames are clamped so that a single hitch doesn't snowball)
 			timeElapsed = clock.restart();
+			const Time UPDATE_TIME = (timeElapsed > mMaxFrameTime) ? mMaxFrameTime : timeElapsed;
 
-			// Update until the fixed time interval is reached
-			timeSinceLastUpdate += timeElapsed;
-			while (timeSinceLastUpdate > mTimeStep) {
-				timeSinceLastUpdate -= mTimeStep;
-				update(mTimeStep);
+			// Consume the fixed time-steps accumulated, the pipelined frame displays the previous updates so it's interpolated with the time that was left over by them
+			// (the non-pipelined frame is rendered between the last two updates)
+			float interpolation = (mPipelined) ? getInterpolation(timeSinceLastUpdate) : 0.f;
+			timeSinceLastUpdate += UPDATE_TIME;
+			int stepCount = consumeTimeSteps(timeSinceLastUpdate);
+			if (!mPipelined) {
+				interpolation = getInterpolation(timeSinceLastUpdate);
 			}
-			render();
+
+			// A replayed frame runs the recorded fixed steps regardless of the time elapsed
+			Time timeStep = mTimeStep;
+			if (REPLAYING) {
+				stepCount = mInputRecorder.getReplayedStepCount();
+				interpolation = mInputRecorder.getReplayedInterpolation();
+				timeStep = mInputRecorder.getTimeStep();
+			}
+			mInputRecorder.recordFrame(stepCount, interpolation, timeStep);
+
+			if (mPipelined) {
+				runPipelinedFrame(stepCount, timeStep, interpolation);
+			}
+			else {
+				// Update until the fixed time interval is reached and render between the last two updates
+				for (int i = 0; i < stepCount; ++i) {
+					update(timeStep);
+				}
+				render(interpolation);
+			}
+
+			// Decide whether the next frame waits for events (frames rendered on demand), the replayed frames never wait
+			idle = !REPLAYING && canIdle(EVENTS_PROCESSED);
 
 			// FPS Counter
 			if ((timeCounter += timeElapsed) >= ONE_SECOND) {
@@ -101,6 +225,13 @@ namespace ae
 			else {
 				++recordedFps;
 			}
+
+			// Wait out the rest of the frame if the framerate is limited
+			limitFrameRate(clock);
+
+			mFrameSample.frame = Clock::getCurrentTime() - FRAME_START;
+			mFrameStatistics.addSample(mFrameSample);
+			MemoryTracker::endFrame();
 		}
 	}
 
@@ -109,16 +240,77 @@ namespace ae
 		mTimeStep = Time::seconds(1.0 / static_cast<double>(timeStep));
 	}
 
+	void Application::setRefreshRateTimeStep(bool flag)
+	{
+		mRefreshRateStep = flag;
+		if (flag) {
+			applyRefreshRateTimeStep();
+		}
+	}
+
+	void Application::setMaxCatchUpSteps(int stepCount) noexcept
+	{
+		mMaxCatchUpSteps = Math::max(stepCount, 1);
+	}
+
+	void Application::setMaxFrameTime(const Time& frameTime) noexcept
+	{
+		mMaxFrameTime = frameTime;
+	}
+
+	void Application::setFrameRateLimit(int frameRate) noexcept
+	{
+		mFrameTimeLimit = (frameRate > 0) ? Time::seconds(1.0 / static_cast<double>(frameRate)) : Time::Zero;
+	}
+
+	void Application::setPipelined(bool flag) noexcept
+	{
+		mPipelined = flag;
+	}
+
 	int Application::getFPS() const noexcept
 	{
 		return mCurrentFPS;
 	}
 
+	FrameStatistics& Application::getFrameStatistics() noexcept
+	{
+		return mFrameStatistics;
+	}
+
+	void Application::setOnDemandRendering(bool flag, const Time& timeout) noexcept
+	{
+		mOnDemand = flag;
+		mIdleTimeout = timeout;
+	}
+
+	void Application::requestRedraw() noexcept
+	{
+		// Wake the game loop up if it's waiting for events
+		mRedrawRequested.store(true, std::memory_order_release);
+		glfwPostEmptyEvent();
+	}
+
+	bool Application::isPipelined() const noexcept
+	{
+		return mPipelined;
+	}
+
+	bool Application::isOnDemandRendering() const noexcept
+	{
+		return mOnDemand;
+	}
+
 	Window& Application::getWindow() noexcept
 	{
 		return *mWindow;
 	}
 
+	InputRecorder& Application::getInputRecorder() noexcept
+	{
+		return mInputRecorder;
+	}
+
 	// Public static method(s)
 	Application& Application::getInstance()
 	{
@@ -129,20 +321,48 @@ namespace ae
 	// Private constructor(s)
 	Application::Application()
 		: mWindow(nullptr)
+		, mSecondaryWindows()
 		, mStateStack(StateStack::getInstance())
 		, mPolledEvent(nullptr)
 		, mEventQueue(EventQueue::getInstance())
 		, mCurrentFPS(0)
+		, mFrameStatistics()
+		, mFrameSample()
+		, mInputRecorder()
 		, mTimeStep(Time::seconds(1.0 / 60.0))
+		, mMaxFrameTime(Time::seconds(0.25))
+		, mFrameTimeLimit(Time::Zero)
+		, mMaxCatchUpSteps(5)
+		, mRefreshRateStep(false)
+		, mFrameSnapshot(RenderCommandList::Storage::Copy)
+		, mPipelined(false)
+		, mOnDemand(false)
+		, mIdleTimeout(Time::seconds(0.5))
+		, mRedrawRequested(false)
+		, mStartupThread()
+		, mInitTime(Time::Zero)
 	{
-		// Initialize GLFW
+		// Initialize GLFW and name the main thread in the profiler's traces
 		init();
+		Profiler::getInstance().setThreadName("Main thread");
 	}
 
 	// Private method(s)
-	void Application::init() const
+	void Application::init()
 	{
-		if (!glfwInit()) {
+		AEON_PROFILE_SCOPE("Startup: GLFW initialization");
+
+		// Initialize the font library in parallel as it's independent of GLFW and of the OpenGL context
+		mStartupThread = std::thread([]() {
+			Profiler::getInstance().setThreadName("Startup thread");
+			AEON_PROFILE_SCOPE("Startup: Font library initialization");
+			static_cast<void>(FontManager::getInstance());
+		});
+
+		const Clock INIT_CLOCK;
+		const bool INITIALIZED = glfwInit();
+		mInitTime = INIT_CLOCK.getElapsedTime();
+		if (!INITIALIZED) {
 			AEON_LOG_ERROR("Initialization of GLFW failed", "Failed to initialize the GLFW library.");
 			return;
 		}
@@ -153,36 +373,223 @@ namespace ae
 		}
 	}
 
-	void Application::processEvents()
+	bool Application::processEvents()
 	{
-		// Poll every input event that has been generated thus far
+		AEON_PROFILE_SCOPE("Application::processEvents");
+		AEON_MEMORY_SCOPE(MemoryTag::Events);
+
+		// Collect the events posted by the other threads and poll every event that has been generated thus far
+		bool processed = false;
+		bool monitorChanged = false;
+		mEventQueue.collectPostedEvents();
 		while (mEventQueue.pollEvent(mPolledEvent))
 		{
+			processed = true;
+			const Event::Type TYPE = mPolledEvent->type;
+			monitorChanged |= (TYPE == Event::Type::MonitorConnected || TYPE == Event::Type::MonitorDisconnected || (TYPE == Event::Type::WindowMoved && mPolledEvent->window == mWindow.get()));
+
 			// Automatically handle certain events
 			if (mPolledEvent->type == Event::Type::MonitorConnected || mPolledEvent->type == Event::Type::MonitorDisconnected) {
 				MonitorEvent* const monitorEvent = mPolledEvent->as<MonitorEvent>();
 				MonitorManager::getInstance().update(monitorEvent);
 				monitorEvent->handled = true;
 			}
-			else if (mPolledEvent->type == Event::Type::WindowClosed) {
+			else if (mPolledEvent->type == Event::Type::WindowClosed && (!mPolledEvent->window || mPolledEvent->window == mWindow.get())) {
+				FrameCapture::getInstance().destroy();
+				GPUProfiler::getInstance().destroy();
+				TextureResidency::getInstance().destroy();
+				TextureLoader::getInstance().destroy();
 				GLResourceFactory::getInstance().destroy();
 			}
 
-			// Send the event to the window and to the user-created states
-			mWindow->handleEvent(mPolledEvent.get());
-			mStateStack.handleEvent(mPolledEvent.get());
+			// Send the event to the window that generated it (the events posted by the application are sent to the active window), to the listeners subscribed to its type and to the user-created states
+			Window* const window = (mPolledEvent->window) ? mPolledEvent->window : mWindow.get();
+			if (window == mWindow.get()) {
+				mInputRecorder.recordEvent(*mPolledEvent);
+			}
+			window->handleEvent(mPolledEvent);
+			EventBus::getInstance().dispatch(mPolledEvent);
+			mStateStack.handleEvent(mPolledEvent);
+		}
+
+		// Apply the last size reported to each window now that the frame's resize events have been coalesced
+		mWindow->applyPendingResize();
+		for (const std::unique_ptr<Window>& window : mSecondaryWindows) {
+			window->applyPendingResize();
+		}
+
+		// The active window may be displayed by another monitor
+		if (monitorChanged && mRefreshRateStep) {
+			applyRefreshRateTimeStep();
 		}
+
+		// Destroy the secondary windows that were closed now that their events have been dispatched
+		mSecondaryWindows.erase(std::remove_if(mSecondaryWindows.begin(), mSecondaryWindows.end(), [](const std::unique_ptr<Window>& window) {
+			return !window->isOpen();
+		}), mSecondaryWindows.end());
+
+		return processed;
+	}
+
+	bool Application::canIdle(bool eventsProcessed)
+	{
+		// The redraw request is consumed even if a frame is rendered for another reason
+		const bool REDRAW_REQUESTED = mRedrawRequested.exchange(false, std::memory_order_acq_rel);
+		return mOnDemand && !eventsProcessed && !REDRAW_REQUESTED && !mStateStack.isAnimating();
 	}
 
 	void Application::update(const Time& dt)
 	{
+		AEON_PROFILE_SCOPE("Application::update");
+		AEON_MEMORY_SCOPE(MemoryTag::SceneGraph);
+		const Time START = Clock::getCurrentTime();
+
+		// The timers expiring during the fixed step are called, the tasks whose awaited operations completed are resumed and the tweens are advanced before the states are updated
+		TimerWheel::getInstance().advance(dt);
+#if AEON_COROUTINES
+		TaskScheduler::getInstance().update();
+#endif // AEON_COROUTINES
+		TweenSystem::getInstance().update(dt);
 		mStateStack.update(dt);
+		mFrameSample.update += Clock::getCurrentTime() - START;
 	}
 
-	void Application::render()
+	void Application::render(float interpolation)
 	{
+		AEON_PROFILE_SCOPE("Application::render");
+		AEON_MEMORY_SCOPE(MemoryTag::Renderer);
+		const Time START = Clock::getCurrentTime();
+
 		//mWindow->clear();
-		mStateStack.draw();
+		mStateStack.draw(interpolation);
+		present();
+
+		mFrameSample.render = Clock::getCurrentTime() - START;
+	}
+
+	void Application::runPipelinedFrame(int stepCount, const Time& timeStep, float interpolation)
+	{
+		// Record the states' rendering into the snapshot before they're updated (the recording and the submission make up the rendering)
+		const Time RECORD_START = Clock::getCurrentTime();
+		{
+			AEON_PROFILE_SCOPE("Application::record");
+			mFrameSnapshot.beginRecording();
+			mStateStack.draw(interpolation);
+			mFrameSnapshot.endRecording();
+		}
+		mFrameSample.render = Clock::getCurrentTime() - RECORD_START;
+
+		// Update the states on the game thread for the frame's fixed steps
+		std::thread gameThread;
+		if (stepCount > 0) {
+			gameThread = std::thread([this, stepCount, timeStep]() {
+				Profiler::getInstance().setThreadName("Game thread");
+				for (int i = 0; i < stepCount; ++i) {
+					update(timeStep);
+				}
+			});
+		}
+
+		// Execute the snapshot meanwhile (the updates are timed on the game thread)
+		{
+			AEON_PROFILE_SCOPE("Application::render");
+			const Time RENDER_START = Clock::getCurrentTime();
+			mFrameSnapshot.submit();
+			present();
+			mFrameSample.render += Clock::getCurrentTime() - RENDER_START;
+		}
+
+		if (gameThread.joinable()) {
+			gameThread.join();
+		}
+	}
+
+	void Application::present()
+	{
+		// Render the GPU profiler's overlay over the states and finish the frame's timings
+		GPUProfiler& profiler = GPUProfiler::getInstance();
+		profiler.renderOverlay(*mWindow);
+		profiler.endFrame();
+
+		if (!mSecondaryWindows.empty()) {
+			presentSecondaryWindows();
+		}
 		mWindow->display();
 	}
+
+	void Application::applyRefreshRateTimeStep()
+	{
+		if (!mWindow) {
+			return;
+		}
+
+		const int REFRESH_RATE = mWindow->getDisplayRefreshRate();
+		if (REFRESH_RATE > 0) {
+			setFixedTimeStep(REFRESH_RATE);
+		}
+	}
+
+	void Application::presentSecondaryWindows()
+	{
+		AEON_PROFILE_SCOPE("Application::presentSecondaryWindows");
+
+		// The secondary contexts wait on the GPU for the primary context's commands to complete (the flush guarantees that the fence is submitted)
+		GLsync fence = GLCall(glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0));
+		GLCall(glFlush());
+
+		for (const std::unique_ptr<Window>& window : mSecondaryWindows) {
+			if (!window->isOpen() || !window->getFramebufferHandle()) {
+				continue;
+			}
+
+			glfwMakeContextCurrent(window->getHandle());
+			GLCall(glWaitSync(fence, 0, GL_TIMEOUT_IGNORED));
+			window->display();
+		}
+
+		// Restore the primary context once every secondary window was presented
+		glfwMakeContextCurrent(mWindow->getHandle());
+		GLCall(glDeleteSync(fence));
+	}
+
+	float Application::getInterpolation(const Time& timeSinceLastUpdate) const noexcept
+	{
+		return Math::clamp(static_cast<float>(timeSinceLastUpdate.asSeconds() / mTimeStep.asSeconds()), 0.f, 1.f);
+	}
+
+	int Application::consumeTimeSteps(Time& timeSinceLastUpdate) const
+	{
+		int stepCount = 0;
+		while (timeSinceLastUpdate > mTimeStep && stepCount < mMaxCatchUpSteps) {
+			timeSinceLastUpdate -= mTimeStep;
+			++stepCount;
+		}
+
+		// Drop the whole time-steps that couldn't be caught up with, only keeping the fraction of the current one
+		if (timeSinceLastUpdate > mTimeStep) {
+			timeSinceLastUpdate = Time::nanoseconds(timeSinceLastUpdate.asNanoseconds() % mTimeStep.asNanoseconds());
+		}
+
+		return stepCount;
+	}
+
+	void Application::limitFrameRate(const Clock& clock) const
+	{
+		// The buffer swaps already pace the frames when vertical synchronization is activated (a headless window never swaps its buffers)
+		if (mFrameTimeLimit == Time::Zero || (mWindow->isVerticalSyncEnabled() && !mWindow->isHeadless())) {
+			return;
+		}
+
+		AEON_PROFILE_SCOPE("Application::limitFrameRate");
+
+		// Sleep for most of the remaining time (the scheduler may oversleep by a few milliseconds) and yield until the deadline
+		const Time SPIN_MARGIN = Time::milliseconds(2);
+		const Time REMAINING_TIME = mFrameTimeLimit - clock.getElapsedTime();
+		if (REMAINING_TIME > SPIN_MARGIN) {
+			std::this_thread::sleep_for(std::chrono::microseconds((REMAINING_TIME - SPIN_MARGIN).asMicroseconds()));
+		}
+		while (clock.getElapsedTime() < mFrameTimeLimit) {
+			std::this_thread::yield();
+		}
+	}
 }
\ No newline at end of file
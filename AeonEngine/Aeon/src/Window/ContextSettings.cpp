@@ -38,6 +38,8 @@ namespace ae
 		, mDepthBits(24)
 		, mStencilBits(8)
 		, mSrgbCapable(sRgb)
+		, mDebugOutput(true)
+		, mProfile(Profile::Default)
 	{
 		setAntialiasingLevel(msaa);
 		setContextVersion(major, minor);
@@ -76,7 +78,7 @@ namespace ae
 		glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
 		glfwWindowHint(GLFW_CONTEXT_ROBUSTNESS, GLFW_NO_ROBUSTNESS);
 		glfwWindowHint(GLFW_CONTEXT_RELEASE_BEHAVIOR, GLFW_ANY_RELEASE_BEHAVIOR);
-		glfwWindowHint(GLFW_CONTEXT_NO_ERROR, !AEON_DEBUG);
+		glfwWindowHint(GLFW_CONTEXT_NO_ERROR, isNoErrorEnabled());
 	}
 
 	void ContextSettings::setAntialiasingLevel(int msaa)
@@ -161,4 +163,29 @@ namespace ae
 	{
 		return mSrgbCapable;
 	}
+
+	void ContextSettings::setDebugOutputEnabled(bool flag) noexcept
+	{
+		mDebugOutput = flag;
+	}
+
+	bool ContextSettings::isDebugOutputEnabled() const noexcept
+	{
+		return mDebugOutput;
+	}
+
+	void ContextSettings::setProfile(Profile profile) noexcept
+	{
+		mProfile = profile;
+	}
+
+	ContextSettings::Profile ContextSettings::getProfile() const noexcept
+	{
+		return mProfile;
+	}
+
+	bool ContextSettings::isNoErrorEnabled() const noexcept
+	{
+		return !AEON_DEBUG && (mProfile == Profile::ReleasePerformance || !mDebugOutput);
+	}
 }
\ No newline at end of file
@@ -31,6 +31,9 @@ namespace ae
 	Event::Event(Type type) noexcept
 		: type(type)
 		, handled(false)
+		, window(nullptr)
+		, phase(Phase::None)
+		, mPropagationStopped(false)
 	{
 	}
 
@@ -39,6 +42,18 @@ namespace ae
 	{
 	}
 
+		// Public method(s)
+	void Event::stopPropagation() noexcept
+	{
+		mPropagationStopped = true;
+		handled = true;
+	}
+
+	bool Event::isPropagationStopped() const noexcept
+	{
+		return mPropagationStopped;
+	}
+
 	// MonitorEvent
 		// Public constructor(s)
 	MonitorEvent::MonitorEvent(GLFWmonitor* const handle, bool connected) noexcept
@@ -82,14 +97,22 @@ namespace ae
 
 	// PathDropEvent
 		// Public constructor(s)
-	PathDropEvent::PathDropEvent(int count, const char** paths) noexcept
+	PathDropEvent::PathDropEvent(const std::string_view* paths, size_t count) noexcept
 		: Event(Type::PathDrop)
-		, paths()
+		, paths(paths)
+		, count(count)
+	{
+	}
+
+		// Public method(s)
+	const std::string_view* PathDropEvent::begin() const noexcept
+	{
+		return paths;
+	}
+
+	const std::string_view* PathDropEvent::end() const noexcept
 	{
-		this->paths.reserve(count);
-		for (int i = 0; i < count; ++i) {
-			this->paths.emplace_back(paths[i]);
-		}
+		return paths + count;
 	}
 
 	// KeyEvent
@@ -144,12 +167,4 @@ namespace ae
 		, offset(offset)
 	{
 	}
-
-	// FontEvent
-		// Public constructor(s)
-	FontEvent::FontEvent(const Font* const font) noexcept
-		: Event(Type::FontUpdated)
-		, font(font)
-	{
-	}
 }
\ No newline at end of file
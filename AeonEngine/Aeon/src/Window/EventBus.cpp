@@ -0,0 +1,197 @@
+// MIT License
+// 
+// Copyright(c) 2019-2021 Filippos Gleglakos
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#include <AEON/Window/EventBus.h>
+
+#include <algorithm>
+
+namespace ae
+{
+	// Public method(s)
+	size_t EventBus::subscribe(Event::Type type, Listener listener)
+	{
+		// The listeners can't be added while they're being iterated over
+		const size_t ID = mNextID++;
+		mTypes.emplace(ID, type);
+		if (mDepth > 0) {
+			mPending.emplace_back(type, Subscriber{ ID, std::move(listener), true });
+		}
+		else {
+			mSubscribers[static_cast<size_t>(type)].push_back(Subscriber{ ID, std::move(listener), true });
+		}
+
+		return ID;
+	}
+
+	void EventBus::unsubscribe(size_t listenerID)
+	{
+		auto typeItr = mTypes.find(listenerID);
+		if (typeItr == mTypes.end()) {
+			return;
+		}
+
+		// The listener is deactivated if it may be being invoked, it's removed once the dispatch is over
+		std::vector<Subscriber>& subscribers = mSubscribers[static_cast<size_t>(typeItr->second)];
+		auto subscriberItr = std::find_if(subscribers.begin(), subscribers.end(), [listenerID](const Subscriber& subscriber) {
+			return subscriber.id == listenerID;
+		});
+		if (subscriberItr != subscribers.end()) {
+			if (mDepth > 0) {
+				subscriberItr->active = false;
+				mRemoved = true;
+			}
+			else {
+				subscribers.erase(subscriberItr);
+			}
+		}
+		else {
+			mPending.erase(std::remove_if(mPending.begin(), mPending.end(), [listenerID](const std::pair<Event::Type, Subscriber>& pending) {
+				return pending.second.id == listenerID;
+			}), mPending.end());
+		}
+		mTypes.erase(typeItr);
+	}
+
+	void EventBus::dispatch(Event* const event)
+	{
+		// Only the listeners subscribed to the event's type are visited
+		std::vector<Subscriber>& subscribers = mSubscribers[static_cast<size_t>(event->type)];
+		if (subscribers.empty()) {
+			return;
+		}
+
+		++mDepth;
+		for (const Subscriber& subscriber : subscribers) {
+			if (subscriber.active) {
+				subscriber.listener(event);
+				if (event->isPropagationStopped()) {
+					break;
+				}
+			}
+		}
+		--mDepth;
+
+		if (mDepth == 0) {
+			applyPendingChanges();
+		}
+	}
+
+	size_t EventBus::getListenerCount(Event::Type type) const noexcept
+	{
+		const std::vector<Subscriber>& SUBSCRIBERS = mSubscribers[static_cast<size_t>(type)];
+		return static_cast<size_t>(std::count_if(SUBSCRIBERS.begin(), SUBSCRIBERS.end(), [](const Subscriber& subscriber) {
+			return subscriber.active;
+		}));
+	}
+
+#if AEON_COROUTINES
+	EventBus::EventAwaiter EventBus::nextEvent(Event::Type type) const noexcept
+	{
+		return EventAwaiter(type);
+	}
+#endif // AEON_COROUTINES
+
+	// Public static method(s)
+	EventBus& EventBus::getInstance() noexcept
+	{
+		static EventBus instance;
+		return instance;
+	}
+
+	// Private constructor(s)
+	EventBus::EventBus() noexcept
+		: mSubscribers()
+		, mPending()
+		, mTypes()
+		, mNextID(0)
+		, mDepth(0)
+		, mRemoved(false)
+	{
+	}
+
+	// Private method(s)
+	void EventBus::applyPendingChanges()
+	{
+		if (mRemoved) {
+			for (std::vector<Subscriber>& subscribers : mSubscribers) {
+				subscribers.erase(std::remove_if(subscribers.begin(), subscribers.end(), [](const Subscriber& subscriber) {
+					return !subscriber.active;
+				}), subscribers.end());
+			}
+			mRemoved = false;
+		}
+
+		for (auto& pending : mPending) {
+			mSubscribers[static_cast<size_t>(pending.first)].push_back(std::move(pending.second));
+		}
+		mPending.clear();
+	}
+
+#if AEON_COROUTINES
+	// EventBus::EventAwaiter
+		// Public constructor(s)
+	EventBus::EventAwaiter::EventAwaiter(Event::Type type) noexcept
+		: mType(type)
+		, mEvent(nullptr)
+		, mListenerID(0)
+		, mSubscribed(false)
+	{
+	}
+
+	EventBus::EventAwaiter::~EventAwaiter()
+	{
+		if (mSubscribed) {
+			EventBus::getInstance().unsubscribe(mListenerID);
+		}
+	}
+
+		// Public method(s)
+	bool EventBus::EventAwaiter::await_ready() const noexcept
+	{
+		return false;
+	}
+
+	void EventBus::EventAwaiter::await_suspend(Task::Handle caller)
+	{
+		// The listener is only invoked while the awaitable exists, as it's unsubscribed by the latter's destructor
+		std::weak_ptr<Task::Continuation> continuation = caller.promise().continuation;
+		mListenerID = EventBus::getInstance().subscribe(mType, [this, continuation = std::move(continuation)](Event* const event) {
+			// Only the first event is received, the task being resumed during the dispatch so that the event remains valid
+			mSubscribed = false;
+			EventBus::getInstance().unsubscribe(mListenerID);
+			mEvent = event;
+
+			const std::shared_ptr<Task::Continuation> CONTINUATION = continuation.lock();
+			if (CONTINUATION && CONTINUATION->handle) {
+				CONTINUATION->handle.resume();
+			}
+		});
+		mSubscribed = true;
+	}
+
+	Event* EventBus::EventAwaiter::await_resume() const noexcept
+	{
+		return mEvent;
+	}
+#endif // AEON_COROUTINES
+}
\ No newline at end of file
@@ -0,0 +1,422 @@
+// MIT License
+// 
+// Copyright(c) 2019-2021 Filippos Gleglakos
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <AEON/Window/InputRecorder.h>
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <limits>
+
+#include <GLFW/glfw3.h>
+
+#include <AEON/System/DebugLogger.h>
+#include <AEON/System/FileSystem.h>
+#include <AEON/Window/internal/EventQueue.h>
+#include <AEON/Window/internal/InputManager.h>
+#include <AEON/Window/Event.h>
+
+namespace ae
+{
+	namespace
+	{
+		// The recording's header: the magic number, the format's version, the fixed time-step in nanoseconds and the number of frames
+		constexpr uint32_t MAGIC = 0x52494541; // "AEIR" in little-endian
+		constexpr uint32_t VERSION = 1;
+		constexpr size_t HEADER_SIZE = sizeof(uint32_t) * 2 + sizeof(int64_t) + sizeof(uint32_t);
+
+		// Append a value to the recording's data
+		template <typename T>
+		void appendValue(std::vector<uint8_t>& data, T value)
+		{
+			const uint8_t* const BYTES = reinterpret_cast<const uint8_t*>(&value);
+			data.insert(data.end(), BYTES, BYTES + sizeof(T));
+		}
+
+		// Read a value from the recording's data, the offset being advanced past it
+		template <typename T>
+		bool readValue(const std::vector<uint8_t>& data, size_t& offset, T& value) noexcept
+		{
+			if (offset + sizeof(T) > data.size()) {
+				return false;
+			}
+
+			std::memcpy(&value, data.data() + offset, sizeof(T));
+			offset += sizeof(T);
+			return true;
+		}
+
+		// Convert the modifier keys of a key or button event back into GLFW's flags
+		template <typename T>
+		uint8_t getMods(const T& event) noexcept
+		{
+			return static_cast<uint8_t>(((event.shift) ? GLFW_MOD_SHIFT : 0) | ((event.control) ? GLFW_MOD_CONTROL : 0) | ((event.alt) ? GLFW_MOD_ALT : 0) |
+			                            ((event.system) ? GLFW_MOD_SUPER : 0) | ((event.capsLock) ? GLFW_MOD_CAPS_LOCK : 0) | ((event.numLock) ? GLFW_MOD_NUM_LOCK : 0));
+		}
+	}
+
+	// Public constructor(s)
+	InputRecorder::InputRecorder() noexcept
+		: mData()
+		, mFrameEvents()
+		, mFilepath()
+		, mReadOffset(0)
+		, mTimeStep(Time::Zero)
+		, mFrameCount(0)
+		, mTotalFrameCount(0)
+		, mFrameEventCount(0)
+		, mReplayedSteps(0)
+		, mReplayedInterpolation(0.f)
+		, mRecording(false)
+		, mReplaying(false)
+	{
+	}
+
+	InputRecorder::~InputRecorder()
+	{
+		stopReplay();
+	}
+
+	// Public method(s)
+	bool InputRecorder::startRecording(const std::string& filepath)
+	{
+		// Check that no session is being replayed
+		if (mReplaying) {
+			AEON_LOG_ERROR("Input replay in progress", "The input can't be recorded while a session is replayed.\nAborting operation.");
+			return false;
+		}
+
+		mData.clear();
+		mFrameEvents.clear();
+		mFilepath = filepath;
+		mTimeStep = Time::Zero;
+		mFrameCount = 0;
+		mFrameEventCount = 0;
+		mRecording = true;
+		return true;
+	}
+
+	bool InputRecorder::stopRecording()
+	{
+		if (!mRecording) {
+			return false;
+		}
+		mRecording = false;
+
+		// Write the header followed by the recorded frames
+		std::vector<uint8_t> header;
+		header.reserve(HEADER_SIZE);
+		appendValue<uint32_t>(header, MAGIC);
+		appendValue<uint32_t>(header, VERSION);
+		appendValue<int64_t>(header, mTimeStep.asNanoseconds());
+		appendValue<uint32_t>(header, mFrameCount);
+
+		std::ofstream file(mFilepath, std::ios::binary | std::ios::trunc);
+		if (!file || !file.write(reinterpret_cast<const char*>(header.data()), static_cast<std::streamsize>(header.size()))
+		          || !file.write(reinterpret_cast<const char*>(mData.data()), static_cast<std::streamsize>(mData.size()))) {
+			AEON_LOG_ERROR("Invalid filepath", "Unable to write the input recording at \"" + mFilepath + "\".\nAborting operation.");
+			return false;
+		}
+
+		// Log the recording's size (ignored in Release mode)
+		if _CONSTEXPR_IF (AEON_DEBUG) {
+			AEON_LOG_INFO("Input recording written", std::to_string(mFrameCount) + " frames recorded in " + std::to_string(HEADER_SIZE + mData.size()) + " bytes at \"" + mFilepath + "\".");
+		}
+
+		mData.clear();
+		mData.shrink_to_fit();
+		return true;
+	}
+
+	bool InputRecorder::startReplay(const std::string& filepath)
+	{
+		// Check that no input is being recorded
+		if (mRecording) {
+			AEON_LOG_ERROR("Input recording in progress", "A session can't be replayed while the input is recorded.\nAborting operation.");
+			return false;
+		}
+
+		std::vector<uint8_t> data;
+		if (!FileSystem::readBinary(filepath, data)) {
+			AEON_LOG_ERROR("Invalid filepath", "Unable to read the input recording at \"" + filepath + "\".\nAborting operation.");
+			return false;
+		}
+
+		// Validate the header
+		size_t offset = 0;
+		uint32_t magic = 0, version = 0, frameCount = 0;
+		int64_t timeStep = 0;
+		if (!readValue(data, offset, magic) || !readValue(data, offset, version) || !readValue(data, offset, timeStep) || !readValue(data, offset, frameCount)
+		    || magic != MAGIC || version != VERSION || timeStep <= 0) {
+			AEON_LOG_ERROR("Invalid input recording", "The file \"" + filepath + "\" isn't a valid input recording.\nAborting operation.");
+			return false;
+		}
+
+		mData = std::move(data);
+		mFilepath = filepath;
+		mReadOffset = offset;
+		mTimeStep = Time::nanoseconds(timeStep);
+		mFrameCount = 0;
+		mTotalFrameCount = frameCount;
+		mReplayedSteps = 0;
+		mReplayedInterpolation = 0.f;
+		mReplaying = true;
+		InputManager::setReplaying(true);
+		return true;
+	}
+
+	void InputRecorder::stopReplay() noexcept
+	{
+		if (!mReplaying) {
+			return;
+		}
+
+		mReplaying = false;
+		mTotalFrameCount = 0;
+		mData.clear();
+		InputManager::setReplaying(false);
+	}
+
+	void InputRecorder::recordEvent(const Event& event)
+	{
+		// The events of the frame are counted within 16 bits, the surplus is dropped
+		if (!mRecording || mFrameEventCount == std::numeric_limits<uint16_t>::max()) {
+			return;
+		}
+
+		// Encode the input events' data, the window events reflect the actual window and aren't recorded
+		const size_t SIZE = mFrameEvents.size();
+		appendValue<uint8_t>(mFrameEvents, static_cast<uint8_t>(event.type));
+		switch (event.type)
+		{
+		case Event::Type::KeyPressed:
+		case Event::Type::KeyReleased:
+		{
+			const KeyEvent& keyEvent = static_cast<const KeyEvent&>(event);
+			appendValue<int32_t>(mFrameEvents, static_cast<int32_t>(keyEvent.key));
+			appendValue<uint8_t>(mFrameEvents, getMods(keyEvent));
+			break;
+		}
+		case Event::Type::TextEntered:
+			appendValue<uint32_t>(mFrameEvents, static_cast<const TextEvent&>(event).unicode);
+			break;
+		case Event::Type::MouseMoved:
+		{
+			const MouseMoveEvent& moveEvent = static_cast<const MouseMoveEvent&>(event);
+			appendValue<double>(mFrameEvents, moveEvent.position.x);
+			appendValue<double>(mFrameEvents, moveEvent.position.y);
+			break;
+		}
+		case Event::Type::MouseButtonPressed:
+		case Event::Type::MouseButtonReleased:
+		{
+			const MouseButtonEvent& buttonEvent = static_cast<const MouseButtonEvent&>(event);
+			appendValue<uint8_t>(mFrameEvents, static_cast<uint8_t>(buttonEvent.button));
+			appendValue<uint8_t>(mFrameEvents, getMods(buttonEvent));
+			break;
+		}
+		case Event::Type::MouseWheelScrolled:
+		{
+			const MouseWheelEvent& wheelEvent = static_cast<const MouseWheelEvent&>(event);
+			appendValue<uint8_t>(mFrameEvents, static_cast<uint8_t>(wheelEvent.wheel));
+			appendValue<double>(mFrameEvents, wheelEvent.offset);
+			break;
+		}
+		case Event::Type::MouseEntered:
+		case Event::Type::MouseLeft:
+		case Event::Type::WindowClosed:
+			break;
+		default:
+			mFrameEvents.resize(SIZE);
+			return;
+		}
+
+		++mFrameEventCount;
+	}
+
+	void InputRecorder::recordFrame(int stepCount, float interpolation, const Time& timeStep)
+	{
+		if (!mRecording) {
+			return;
+		}
+
+		// The session's fixed time-step is the one of its first frame
+		if (mFrameCount == 0) {
+			mTimeStep = timeStep;
+		}
+
+		appendValue<uint8_t>(mData, static_cast<uint8_t>(std::min(stepCount, 255)));
+		appendValue<float>(mData, interpolation);
+		appendValue<uint16_t>(mData, mFrameEventCount);
+		mData.insert(mData.end(), mFrameEvents.begin(), mFrameEvents.end());
+
+		mFrameEvents.clear();
+		mFrameEventCount = 0;
+		++mFrameCount;
+	}
+
+	bool InputRecorder::replayFrame()
+	{
+		if (!mReplaying) {
+			return false;
+		}
+
+		// Resume the live input once every frame has been replayed
+		if (mFrameCount == mTotalFrameCount || mReadOffset == mData.size()) {
+			// Log the replay's completion (ignored in Release mode)
+			if _CONSTEXPR_IF (AEON_DEBUG) {
+				AEON_LOG_INFO("Input replay completed", std::to_string(mFrameCount) + " frames replayed from \"" + mFilepath + "\".");
+			}
+
+			stopReplay();
+			return false;
+		}
+
+		uint8_t stepCount = 0;
+		uint16_t eventCount = 0;
+		bool valid = readValue(mData, mReadOffset, stepCount) && readValue(mData, mReadOffset, mReplayedInterpolation) && readValue(mData, mReadOffset, eventCount);
+		mReplayedSteps = stepCount;
+
+		// Feed the events to the input callbacks without a window, they're then dispatched to the active window
+		for (uint16_t i = 0; valid && i < eventCount; ++i) {
+			uint8_t type = 0;
+			valid = readValue(mData, mReadOffset, type);
+			if (!valid) {
+				break;
+			}
+
+			switch (static_cast<Event::Type>(type))
+			{
+			case Event::Type::KeyPressed:
+			case Event::Type::KeyReleased:
+			{
+				int32_t key = 0;
+				uint8_t mods = 0;
+				valid = readValue(mData, mReadOffset, key) && readValue(mData, mReadOffset, mods);
+				if (valid) {
+					// A key pressed while it's already held down was repeated, which doesn't produce an edge in the input snapshot
+					const bool PRESSED = static_cast<Event::Type>(type) == Event::Type::KeyPressed;
+					const int ACTION = (!PRESSED) ? GLFW_RELEASE : (InputManager::isKeyDown(static_cast<Keyboard::Key>(key))) ? GLFW_REPEAT : GLFW_PRESS;
+					InputManager::key_callback(nullptr, key, 0, ACTION, mods);
+				}
+				break;
+			}
+			case Event::Type::TextEntered:
+			{
+				uint32_t codepoint = 0;
+				if ((valid = readValue(mData, mReadOffset, codepoint))) {
+					InputManager::character_callback(nullptr, codepoint);
+				}
+				break;
+			}
+			case Event::Type::MouseMoved:
+			{
+				double x = 0.0, y = 0.0;
+				if ((valid = readValue(mData, mReadOffset, x) && readValue(mData, mReadOffset, y))) {
+					InputManager::cursor_position_callback(nullptr, x, y);
+				}
+				break;
+			}
+			case Event::Type::MouseButtonPressed:
+			case Event::Type::MouseButtonReleased:
+			{
+				uint8_t button = 0, mods = 0;
+				if ((valid = readValue(mData, mReadOffset, button) && readValue(mData, mReadOffset, mods))) {
+					const int ACTION = (static_cast<Event::Type>(type) == Event::Type::MouseButtonPressed) ? GLFW_PRESS : GLFW_RELEASE;
+					InputManager::mouse_button_callback(nullptr, button, ACTION, mods);
+				}
+				break;
+			}
+			case Event::Type::MouseWheelScrolled:
+			{
+				uint8_t wheel = 0;
+				double offset = 0.0;
+				if ((valid = readValue(mData, mReadOffset, wheel) && readValue(mData, mReadOffset, offset))) {
+					const bool HORIZONTAL = static_cast<Mouse::Wheel>(wheel) == Mouse::Wheel::Horizontal;
+					InputManager::scroll_callback(nullptr, (HORIZONTAL) ? offset : 0.0, (HORIZONTAL) ? 0.0 : offset);
+				}
+				break;
+			}
+			case Event::Type::MouseEntered:
+			case Event::Type::MouseLeft:
+				InputManager::cursor_enter_callback(nullptr, static_cast<Event::Type>(type) == Event::Type::MouseEntered);
+				break;
+			case Event::Type::WindowClosed:
+			{
+				// The close callback requires a GLFW window, the event is enqueued directly
+				EventQueue& queue = EventQueue::getInstance();
+				queue.setEventSource(nullptr);
+				queue.enqueueEvent<Event>(Event::Type::WindowClosed);
+				break;
+			}
+			default:
+				valid = false;
+				break;
+			}
+		}
+
+		// Stop the replay if the recording is corrupted
+		if (!valid) {
+			AEON_LOG_ERROR("Invalid input recording", "The frame " + std::to_string(mFrameCount) + " of the input recording \"" + mFilepath + "\" is corrupted.\nStopping the replay.");
+			stopReplay();
+			return false;
+		}
+
+		++mFrameCount;
+		return true;
+	}
+
+	bool InputRecorder::isRecording() const noexcept
+	{
+		return mRecording;
+	}
+
+	bool InputRecorder::isReplaying() const noexcept
+	{
+		return mReplaying;
+	}
+
+	int InputRecorder::getReplayedStepCount() const noexcept
+	{
+		return mReplayedSteps;
+	}
+
+	float InputRecorder::getReplayedInterpolation() const noexcept
+	{
+		return mReplayedInterpolation;
+	}
+
+	const Time& InputRecorder::getTimeStep() const noexcept
+	{
+		return mTimeStep;
+	}
+
+	uint32_t InputRecorder::getFrameCount() const noexcept
+	{
+		return mFrameCount;
+	}
+
+	uint32_t InputRecorder::getTotalFrameCount() const noexcept
+	{
+		return mTotalFrameCount;
+	}
+}
\ No newline at end of file
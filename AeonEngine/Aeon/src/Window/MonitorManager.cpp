@@ -22,6 +22,7 @@
 
 #include <AEON/Window/MonitorManager.h>
 
+#include <algorithm>
 #include <functional>
 
 #include <GLFW/glfw3.h>
@@ -34,8 +35,8 @@ namespace ae
 	void MonitorManager::update(MonitorEvent* const monitorEvent)
 	{
 		// Check if the monitor provided by the event is in the list
-		auto found = std::find_if(mMonitors.begin(), mMonitors.end(), [monitorEvent](const Monitor& monitor) {
-			return monitorEvent->handle == monitor.getHandle();
+		auto found = std::find_if(mMonitors.begin(), mMonitors.end(), [monitorEvent](const std::unique_ptr<Monitor>& monitor) {
+			return monitorEvent->handle == monitor->getHandle();
 		});
 
 		// Proceed based on the event type
@@ -46,16 +47,9 @@ namespace ae
 				return;
 			}
 
-			// Add the newly connected monitor and provide the monitor event with the pointer to said monitor
-			monitorEvent->monitor = &mMonitors.emplace_back(monitorEvent->handle);
-
-			// Sort the list of connected monitors and make sure that the monitor event still holds the correct pointer after the sort
+			// Add the newly connected monitor and provide the monitor event with the pointer to said monitor (which isn't moved by the sort)
+			monitorEvent->monitor = mMonitors.emplace_back(std::make_unique<Monitor>(monitorEvent->handle)).get();
 			sortMonitors();
-			if (monitorEvent->monitor->getHandle() != monitorEvent->handle) {
-				monitorEvent->monitor = &(*std::find_if(mMonitors.begin(), mMonitors.end(), [monitorEvent](const Monitor& monitor) {
-					return monitorEvent->handle == monitor.getHandle();
-				}));
-			}
 		}
 		else if (monitorEvent->type == Event::Type::MonitorDisconnected) {
 			// Verify that the monitor is in the list of connected monitors
@@ -66,7 +60,6 @@ namespace ae
 
 			// Remove the disconnected monitor
 			mMonitors.erase(found);
-			mMonitors.shrink_to_fit();
 
 			// Sort the list of connected monitors and nullify the event's pointer to the monitor
 			sortMonitors();
@@ -89,7 +82,7 @@ namespace ae
 			}
 		}
 
-		return &mMonitors[index];
+		return mMonitors[index].get();
 	}
 
 	const Monitor* const MonitorManager::getPrimaryMonitor() const
@@ -100,7 +93,17 @@ namespace ae
 			return nullptr;
 		}
 
-		return &mMonitors.front();
+		return mMonitors.front().get();
+	}
+
+	const std::vector<const Monitor*>& MonitorManager::getMonitors() const noexcept
+	{
+		return mMonitorList;
+	}
+
+	uint64_t MonitorManager::getGeneration() const noexcept
+	{
+		return mGeneration;
 	}
 
 	// Public static method(s)
@@ -113,6 +116,8 @@ namespace ae
 	// Private constructor(s)
 	MonitorManager::MonitorManager() noexcept
 		: mMonitors()
+		, mMonitorList()
+		, mGeneration(0)
 	{
 		// Retrieve the list of connected monitors
 		int monitorCount;
@@ -120,8 +125,9 @@ namespace ae
 
 		// Store the list of connected monitors
 		mMonitors.reserve(monitorCount);
+		mMonitorList.reserve(monitorCount);
 		for (int i = 0; i < monitorCount; ++i) {
-			mMonitors.emplace_back(glfwMonitors[i]);
+			mMonitorList.push_back(mMonitors.emplace_back(std::make_unique<Monitor>(glfwMonitors[i])).get());
 		}
 	}
 
@@ -132,18 +138,22 @@ namespace ae
 		int monitorCount;
 		GLFWmonitor** glfwMonitors = glfwGetMonitors(&monitorCount);
 
-		// Reorder the internal list of connected monitors
-		int currentMonitorIndex = 0;
-		for (int i = 0; i < monitorCount; ++i) {
-			if (mMonitors[i].getHandle() != glfwMonitors[i] && mMonitors[currentMonitorIndex].getHandle() == glfwMonitors[i]) {
-				std::swap(mMonitors[i], mMonitors[currentMonitorIndex]);
-				currentMonitorIndex = std::exchange(i, -1);
+		// Reorder the internal list of connected monitors to match the system's order, only the owning pointers being moved
+		for (int i = 0; i < monitorCount && static_cast<size_t>(i) < mMonitors.size(); ++i) {
+			auto found = std::find_if(mMonitors.begin() + i, mMonitors.end(), [handle = glfwMonitors[i]](const std::unique_ptr<Monitor>& monitor) {
+				return monitor->getHandle() == handle;
+			});
+			if (found != mMonitors.end()) {
+				std::iter_swap(mMonitors.begin() + i, found);
 			}
 		}
 
-		// Update the monitors' properties that are dependent on the monitor setup
-		for (Monitor& monitor : mMonitors) {
-			monitor.update();
+		// Update the monitors' properties that are dependent on the monitor setup and rebuild the cached list
+		mMonitorList.clear();
+		for (const std::unique_ptr<Monitor>& monitor : mMonitors) {
+			monitor->update();
+			mMonitorList.push_back(monitor.get());
 		}
+		++mGeneration;
 	}
 }
\ No newline at end of file
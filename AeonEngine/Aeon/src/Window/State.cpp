@@ -7,6 +7,10 @@ namespace ae
 	// Public destructor
 	State::~State()
 	{
+		EventBus& eventBus = EventBus::getInstance();
+		for (const size_t SUBSCRIPTION : mSubscriptions) {
+			eventBus.unsubscribe(SUBSCRIPTION);
+		}
 	}
 
 	// Public Method(s)
@@ -15,6 +19,11 @@ namespace ae
 		return true;
 	}
 
+	void State::routeEvent(Event* const event)
+	{
+		mWidgetIndex.handleEvent(event);
+	}
+
 	bool State::update(const Time& dt)
 	{
 		return true;
@@ -25,11 +34,39 @@ namespace ae
 		return true;
 	}
 
+	bool State::draw(float)
+	{
+		return draw();
+	}
+
+	void State::preload()
+	{
+	}
+
+	void State::onSuspend()
+	{
+	}
+
+	void State::onResume(bool)
+	{
+	}
+
+	void State::onTrimMemory()
+	{
+	}
+
+	bool State::isAnimating() const
+	{
+		return false;
+	}
+
 	// Protected constructor(s)
 	State::State()
 		: mApplication(Application::getInstance())
 		, mWindow(mApplication.getWindow())
+		, mWidgetIndex()
 		, mStack(StateStack::getInstance())
+		, mSubscriptions()
 	{
 	}
 
@@ -39,6 +76,11 @@ namespace ae
 		mStack.pushState(stateID);
 	}
 
+	void State::requestStatePreload(uint32_t stateID)
+	{
+		mStack.preloadState(stateID);
+	}
+
 	void State::requestStateRemove(uint32_t stateID)
 	{
 		mStack.removeState(stateID);
@@ -53,4 +95,9 @@ namespace ae
 	{
 		return mStack.getState(stateID);
 	}
+
+	void State::subscribeEvent(Event::Type type, EventBus::Listener listener)
+	{
+		mSubscriptions.push_back(EventBus::getInstance().subscribe(type, std::move(listener)));
+	}
 }
\ No newline at end of file
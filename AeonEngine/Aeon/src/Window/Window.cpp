@@ -22,20 +22,34 @@
 
 #include <AEON/Window/Window.h>
 
+#include <algorithm>
 #include <string>
 
+#include <GL/glew.h>
 #include <GLFW/glfw3.h>
 
 #include <AEON/Graphics/internal/GLCommon.h>
+#include <AEON/Graphics/FrameCapture.h>
+#include <AEON/Graphics/RenderTexture.h>
+#include <AEON/System/FrameArena.h>
 #include <AEON/Window/MonitorManager.h>
 #include <AEON/Window/Monitor.h>
 #include <AEON/Window/internal/InputManager.h>
 
 namespace ae
 {
+	namespace
+	{
+		// Checks whether the current context supports the negative swap intervals
+		bool isSwapTearSupported()
+		{
+			return glfwExtensionSupported("WGL_EXT_swap_control_tear") || glfwExtensionSupported("GLX_EXT_swap_control_tear");
+		}
+	}
+
 	// Public constructor(s)
 	Window::Window(const VideoMode& vidMode, const std::string& title, uint32_t style,
-	               const ContextSettings& settings)
+	               const ContextSettings& settings, const Window* sharedWindow)
 		: RenderTarget()
 		, mTitle(title)
 		, mVideoMode(vidMode)
@@ -47,6 +61,13 @@ namespace ae
 		, mStyle(style)
 		, mMonitor(MonitorManager::getInstance().getPrimaryMonitor())
 		, mHandle(nullptr)
+		, mVerticalSync(false)
+		, mAdaptiveSync(false)
+		, mBackBuffer(nullptr)
+		, mSharedWindow(sharedWindow)
+		, mPresentFramebuffer(0)
+		, mPresentTexture(0)
+		, mPostProcessChain()
 	{
 		// Apply the OpenGL context hints and create the GLFW window
 		mContextSettings.apply();
@@ -56,6 +77,16 @@ namespace ae
 	// Destructor
 	Window::~Window()
 	{
+		mPostProcessChain.clear();
+		mBackBuffer.reset();
+
+		// The secondary context's framebuffer isn't shared with the primary context
+		if (mPresentFramebuffer) {
+			GLFWwindow* const currentContext = glfwGetCurrentContext();
+			glfwMakeContextCurrent(mHandle);
+			GLCall(glDeleteFramebuffers(1, &mPresentFramebuffer));
+			glfwMakeContextCurrent(currentContext);
+		}
 		glfwDestroyWindow(mHandle);
 	}
 
@@ -66,6 +97,8 @@ namespace ae
 		if (mHandle) {
 			glfwDestroyWindow(mHandle);
 			mHandle = nullptr;
+			mPresentFramebuffer = 0;
+			mPresentTexture = 0;
 		}
 
 		// Modify the window's properties based on the style selected
@@ -81,9 +114,11 @@ namespace ae
 			glfwWindowHint(GLFW_AUTO_ICONIFY, GLFW_FALSE);
 		}
 		else {
-			// Set the windowed mode window hints
+			// Set the windowed mode window hints (a headless window is never shown, it doesn't take the focus)
 			glfwWindowHint(GLFW_RESIZABLE, mStyle & Style::Resizable);
 			glfwWindowHint(GLFW_DECORATED, mStyle & Style::Decorated);
+			glfwWindowHint(GLFW_VISIBLE, !isHeadless());
+			glfwWindowHint(GLFW_FOCUSED, !isHeadless());
 		}
 
 		// Set the video mode hints
@@ -98,7 +133,10 @@ namespace ae
 		glfwWindowHint(GLFW_ALPHA_BITS, ALPHA_BITS);
 
 		// Create the GLFW window based on the selected style and check if it was successfully created
-		mHandle = glfwCreateWindow(mVideoMode.getWidth(), mVideoMode.getHeight(), mTitle.c_str(), monitorHandle, nullptr);
+		GLFWwindow* const sharedHandle = (mSharedWindow) ? mSharedWindow->mHandle : nullptr;
+		mHandle = glfwCreateWindow(mVideoMode.getWidth(), mVideoMode.getHeight(), mTitle.c_str(), monitorHandle, sharedHandle);
+		glfwWindowHint(GLFW_VISIBLE, GLFW_TRUE);
+		glfwWindowHint(GLFW_FOCUSED, GLFW_TRUE);
 		if (!mHandle) {
 			AEON_LOG_ERROR("Window creation failed", "Failed to create the GLFW window.\nThe OpenGL context wasn't made current.");
 			return;
@@ -129,14 +167,31 @@ namespace ae
 		glfwSetMouseButtonCallback(mHandle, InputManager::mouse_button_callback);
 		glfwSetScrollCallback(mHandle, InputManager::scroll_callback);
 
-		// Make the OpenGL context current
-		glfwMakeContextCurrent(mHandle);
+		// Make the OpenGL context current (the primary context stays current when creating a secondary window)
+		if (sharedHandle) {
+			glfwMakeContextCurrent(mHandle);
+			glfwSwapInterval((mAdaptiveSync) ? -1 : mVerticalSync);
+			glfwMakeContextCurrent(sharedHandle);
+		}
+		else {
+			glfwMakeContextCurrent(mHandle);
+		}
 
 		// Retrieve the remaining properties
 		glfwGetFramebufferSize(mHandle, &mFramebufferSize.x, &mFramebufferSize.y);
 		glfwGetWindowContentScale(mHandle, &mContentScale.x, &mContentScale.y);
 		glfwGetWindowPos(mHandle, &mPosition.x, &mPosition.y);
 		glfwSetWindowUserPointer(mHandle, this);
+
+		// A headless window's framebuffer is its back buffer, sized after the video mode as the hidden window's own framebuffer is never presented
+		if (isHeadless()) {
+			mFramebufferSize = mVideoMode.getResolution();
+		}
+
+		// A secondary or headless window's scenes are always rendered into its persistent back buffer by the primary context
+		if ((sharedHandle || isHeadless()) && !mBackBuffer) {
+			createBackBuffer();
+		}
 	}
 
 	void Window::close() const
@@ -146,16 +201,69 @@ namespace ae
 
 	void Window::display()
 	{
+		// The secondary context only presents the back buffer rendered by the primary context
+		if (mSharedWindow) {
+			resetDamage();
+			presentSharedBackBuffer();
+			glfwSwapBuffers(mHandle);
+			return;
+		}
+
+		// A headless window has nothing to present, the frame's commands are submitted so that the GPU works on them during the next frame
+		// (the post-processing effects are still applied onto the hidden window so that the benchmarks account for them)
+		if (isHeadless()) {
+			if (mDamageTracking) {
+				resetDamage();
+			}
+			const bool POST_PROCESSED = !mPostProcessChain.isEmpty() && mBackBuffer;
+			if (POST_PROCESSED) {
+				mPostProcessChain.apply(*mBackBuffer->getTexture(), 0, mFramebufferSize);
+			}
+			FrameCapture::getInstance().captureFrame((POST_PROCESSED) ? 0 : getFramebufferHandle(), mFramebufferSize);
+			GLCall(glFlush());
+			glfwPollEvents();
+			FrameArena::nextFrame();
+			return;
+		}
+
+		// Copy the entire persistent back buffer now that the frame has been rendered, through the post-processing effects if there are any
+		const bool POST_PROCESSED = !mPostProcessChain.isEmpty();
+		if (mDamageTracking) {
+			resetDamage();
+		}
+		if (mBackBuffer) {
+			if (POST_PROCESSED) {
+				mPostProcessChain.apply(*mBackBuffer->getTexture(), 0, mFramebufferSize);
+			}
+			else {
+				blitBackBuffer();
+			}
+		}
+
+		// Read the frame back if it's being captured, now that it's complete
+		FrameCapture::getInstance().captureFrame(0, mFramebufferSize);
 		glfwSwapBuffers(mHandle);
 		glfwPollEvents();
+
+		// The next frames are rendered into the back buffer while effects are enabled
+		if (POST_PROCESSED && !mBackBuffer) {
+			createBackBuffer();
+		}
+		else if (!POST_PROCESSED && !mDamageTracking && mBackBuffer) {
+			mBackBuffer.reset();
+			deactivate();
+		}
+
+		// The frame's temporaries may be recycled
+		FrameArena::nextFrame();
 	}
 
 	void Window::handleEvent(Event* const event)
 	{
 		if (event->type == Event::Type::FramebufferResized) {
+			// The new size is applied once the frame's events have been processed, so the back buffer and the camera are only updated for the last size reported
 			FramebufferResizeEvent* const framebufferResizeEvent = event->as<FramebufferResizeEvent>();
-			mFramebufferSize = framebufferResizeEvent->size;
-			GLCall(glViewport(0, 0, mFramebufferSize.x, mFramebufferSize.y));
+			requestResize(framebufferResizeEvent->size);
 			framebufferResizeEvent->handled = true;
 		}
 		else if (event->type == Event::Type::WindowResized) {
@@ -164,7 +272,9 @@ namespace ae
 			windowResizeEvent->handled = true;
 		}
 		else if (event->type == Event::Type::MonitorDisconnected) {
-			if (!mMonitor) {
+			// Fall back to the primary monitor if the window's monitor is the one that was disconnected
+			const std::vector<const Monitor*>& MONITORS = MonitorManager::getInstance().getMonitors();
+			if (!mMonitor || std::find(MONITORS.begin(), MONITORS.end(), mMonitor) == MONITORS.end()) {
 				mMonitor = MonitorManager::getInstance().getPrimaryMonitor();
 				mVideoMode = VideoMode(mVideoMode.getResolution(), mVideoMode.getRefreshRate(), mVideoMode.getRedBits(), mVideoMode.getGreenBits(), mVideoMode.getBlueBits(), mMonitor);
 				if (mStyle == Style::Fullscreen || mStyle == Style::WindowedFullscreen) {
@@ -176,7 +286,14 @@ namespace ae
 			}
 		}
 		else if (event->type == Event::Type::WindowDamaged) {
-			glfwSwapBuffers(mHandle);
+			// A secondary window is presented again during the next frame as its context isn't current
+			if (mSharedWindow) {
+				invalidate();
+			}
+			else if (!isHeadless()) {
+				blitBackBuffer();
+				glfwSwapBuffers(mHandle);
+			}
 		}
 		else if (event->type == Event::Type::WindowContentScaleChanged) {
 			WindowContentScaleEvent* const windowContentScaleEvent = event->as<WindowContentScaleEvent>();
@@ -220,9 +337,58 @@ namespace ae
 		return !glfwWindowShouldClose(mHandle);
 	}
 
-	void Window::enableVerticalSync(bool flag) const
+	void Window::enableVerticalSync(bool flag, bool adaptive)
+	{
+		// The swap interval applies to the current context
+		if (mSharedWindow) {
+			glfwMakeContextCurrent(mHandle);
+		}
+
+		// Fall back on regular vertical synchronization if the late swaps aren't supported
+		mAdaptiveSync = flag && adaptive && isSwapTearSupported();
+		if _CONSTEXPR_IF (AEON_DEBUG) {
+			if (flag && adaptive && !mAdaptiveSync) {
+				AEON_LOG_WARNING("Adaptive vertical synchronization unsupported", "The driver doesn't support the swap control tear extension.\nRegular vertical synchronization is used instead.");
+			}
+		}
+		glfwSwapInterval((mAdaptiveSync) ? -1 : flag);
+		mVerticalSync = flag;
+
+		if (mSharedWindow) {
+			glfwMakeContextCurrent(mSharedWindow->mHandle);
+		}
+	}
+
+	bool Window::isVerticalSyncEnabled() const noexcept
+	{
+		return mVerticalSync;
+	}
+
+	bool Window::isAdaptiveSyncEnabled() const noexcept
+	{
+		return mAdaptiveSync;
+	}
+
+	void Window::setDamageTracking(bool flag)
+	{
+		if (mDamageTracking == flag) {
+			return;
+		}
+
+		mDamageTracking = flag;
+		if (flag) {
+			createBackBuffer();
+		}
+		else if (!mSharedWindow && !isHeadless() && mPostProcessChain.isEmpty()) {
+			mBackBuffer.reset();
+			deactivate();
+		}
+		invalidate();
+	}
+
+	PostProcessChain& Window::getPostProcessChain() noexcept
 	{
-		glfwSwapInterval(flag);
+		return mPostProcessChain;
 	}
 
 	void Window::setTitle(const std::string& title)
@@ -435,8 +601,128 @@ namespace ae
 		return mMonitor;
 	}
 
+	const Monitor* const Window::getCurrentMonitor() const
+	{
+		if (mStyle == Style::Fullscreen || mStyle == Style::WindowedFullscreen) {
+			return mMonitor;
+		}
+
+		// Find the monitor whose desktop area contains the window's center
+		const MonitorManager& monitorManager = MonitorManager::getInstance();
+		const Vector2i CENTER = mPosition + mVideoMode.getResolution() / 2;
+		for (const Monitor* const monitor : monitorManager.getMonitors()) {
+			const Vector2i& POSITION = monitor->getVirtualPosition();
+			const Vector2i& SIZE = monitor->getDesktopMode().getResolution();
+			if (CENTER.x >= POSITION.x && CENTER.y >= POSITION.y && CENTER.x < POSITION.x + SIZE.x && CENTER.y < POSITION.y + SIZE.y) {
+				return monitor;
+			}
+		}
+
+		return monitorManager.getPrimaryMonitor();
+	}
+
+	int Window::getDisplayRefreshRate() const
+	{
+		if (mStyle == Style::Fullscreen) {
+			return mVideoMode.getRefreshRate();
+		}
+
+		const Monitor* const monitor = getCurrentMonitor();
+		return (monitor) ? monitor->getDesktopMode().getRefreshRate() : mVideoMode.getRefreshRate();
+	}
+
 	GLFWwindow* const Window::getHandle() const noexcept
 	{
 		return mHandle;
 	}
+
+	GLFWwindow* Window::createSharedContext() const
+	{
+		// The context hints need to match the window's for the contexts to be shared
+		mContextSettings.apply();
+		glfwWindowHint(GLFW_VISIBLE, GLFW_FALSE);
+		GLFWwindow* const handle = glfwCreateWindow(1, 1, "", nullptr, mHandle);
+		glfwWindowHint(GLFW_VISIBLE, GLFW_TRUE);
+
+		if (!handle) {
+			AEON_LOG_ERROR("Context creation failed", "Failed to create the hidden window owning the shared OpenGL context.");
+		}
+		return handle;
+	}
+
+	// Public virtual method(s)
+	bool Window::isSecondary() const noexcept
+	{
+		return mSharedWindow != nullptr;
+	}
+
+	bool Window::isHeadless() const noexcept
+	{
+		return (mStyle & Style::Headless) != 0;
+	}
+
+	unsigned int Window::getFramebufferHandle() const noexcept
+	{
+		return (mBackBuffer) ? mBackBuffer->getFramebufferHandle() : 0;
+	}
+
+	// Private virtual method(s)
+	void Window::onResize(const Vector2i& size)
+	{
+		mFramebufferSize = size;
+		if (!mSharedWindow) {
+			GLCall(glViewport(0, 0, mFramebufferSize.x, mFramebufferSize.y));
+		}
+		if (mBackBuffer) {
+			createBackBuffer();
+		}
+	}
+
+	// Private method(s)
+	void Window::createBackBuffer()
+	{
+		// The current back buffer is kept while the window is minimized
+		if (mFramebufferSize.x <= 0 || mFramebufferSize.y <= 0) {
+			return;
+		}
+
+		// The back buffer needs the same depth and stencil channels as the window's backbuffer
+		mBackBuffer = std::make_unique<RenderTexture>(Texture2D::InternalFormat::RGBA8, Texture2D::InternalFormat::DEPTH24STENCIL);
+		mBackBuffer->create(mFramebufferSize.x, mFramebufferSize.y);
+		deactivate();
+	}
+
+	void Window::blitBackBuffer() const
+	{
+		if (!mBackBuffer) {
+			return;
+		}
+
+		// The blit is subject to the scissor test, which must cover the entire window
+		gl::resetDamageRegion();
+		gl::setScissor(0, 0, 0, 0);
+		const Vector2i& SIZE = mBackBuffer->getFramebufferSize();
+		GLCall(glBlitNamedFramebuffer(mBackBuffer->getFramebufferHandle(), 0, 0, 0, SIZE.x, SIZE.y, 0, 0, mFramebufferSize.x, mFramebufferSize.y, GL_COLOR_BUFFER_BIT, GL_NEAREST));
+	}
+
+	void Window::presentSharedBackBuffer()
+	{
+		if (!mBackBuffer) {
+			return;
+		}
+
+		// Framebuffers aren't shared between contexts, but the back buffer's texture is
+		if (!mPresentFramebuffer) {
+			GLCall(glCreateFramebuffers(1, &mPresentFramebuffer));
+		}
+		const unsigned int TEXTURE = mBackBuffer->getTexture()->getHandle();
+		if (mPresentTexture != TEXTURE) {
+			GLCall(glNamedFramebufferTexture(mPresentFramebuffer, GL_COLOR_ATTACHMENT0, TEXTURE, 0));
+			mPresentTexture = TEXTURE;
+		}
+
+		// The secondary context's state is never modified, so the scissor test is disabled
+		const Vector2i& SIZE = mBackBuffer->getFramebufferSize();
+		GLCall(glBlitNamedFramebuffer(mPresentFramebuffer, 0, 0, 0, SIZE.x, SIZE.y, 0, 0, mFramebufferSize.x, mFramebufferSize.y, GL_COLOR_BUFFER_BIT, GL_NEAREST));
+	}
 }
\ No newline at end of file
@@ -21,6 +21,12 @@
 // SOFTWARE.
 
 #include <AEON/Window/internal/EventQueue.h>
+
+#include <cstdint>
+
+#include <GLFW/glfw3.h>
+
+#include <AEON/System/MemoryTracker.h>
 #include <AEON/Window/Event.h>
 
 namespace ae
@@ -28,18 +34,104 @@ namespace ae
 	// Public method(s)
 	void EventQueue::enqueueEvent(std::unique_ptr<Event> event)
 	{
-		mQueue.push(std::move(event));
+		AEON_MEMORY_SCOPE(MemoryTag::Events);
+
+		mOverflowQueue.push(std::move(event));
+	}
+
+	void EventQueue::postEvent(std::unique_ptr<Event> event)
+	{
+		AEON_MEMORY_SCOPE(MemoryTag::Events);
+
+		// Push the event onto the front of the list
+		PostedEvent* const node = new PostedEvent{ std::move(event), mPostedEvents.load(std::memory_order_relaxed) };
+		while (!mPostedEvents.compare_exchange_weak(node->next, node, std::memory_order_release, std::memory_order_relaxed));
+
+		// Wake the main thread up if it's waiting for events
+		glfwPostEmptyEvent();
+	}
+
+	void EventQueue::collectPostedEvents()
+	{
+		// Take the whole list at once, the producers may keep on posting meanwhile
+		PostedEvent* node = mPostedEvents.exchange(nullptr, std::memory_order_acquire);
+
+		// Reverse the list so that the events are enqueued in the order in which they were posted
+		PostedEvent* reversed = nullptr;
+		while (node) {
+			PostedEvent* const next = node->next;
+			node->next = reversed;
+			reversed = node;
+			node = next;
+		}
+
+		while (reversed) {
+			PostedEvent* const next = reversed->next;
+			mOverflowQueue.push(std::move(reversed->event));
+			delete reversed;
+			reversed = next;
+		}
+	}
+
+	void EventQueue::setCoalescing(bool flag) noexcept
+	{
+		mCoalescing = flag;
+	}
+
+	bool EventQueue::isCoalescing() const noexcept
+	{
+		return mCoalescing;
+	}
+
+	void EventQueue::setEventSource(Window* window) noexcept
+	{
+		mEventSource = window;
+	}
+
+	void* EventQueue::allocatePayload(size_t size, size_t alignment)
+	{
+		// Look for the first block (from the current one) with enough room left
+		for (; mPayloadBlock < mPayloadBlocks.size(); ++mPayloadBlock, mPayloadOffset = 0) {
+			PayloadBlock& block = mPayloadBlocks[mPayloadBlock];
+			const uintptr_t ADDRESS = reinterpret_cast<uintptr_t>(block.data.get()) + mPayloadOffset;
+			const size_t OFFSET = mPayloadOffset + (alignment - ADDRESS % alignment) % alignment;
+			if (OFFSET + size <= block.size) {
+				mPayloadOffset = OFFSET + size;
+				return block.data.get() + OFFSET;
+			}
+		}
+
+		// Add a new block, large enough for the payload if it exceeds the default size
+		const size_t BLOCK_SIZE = std::max(PAYLOAD_BLOCK_SIZE, size + alignment);
+		PayloadBlock& block = mPayloadBlocks.emplace_back(PayloadBlock{ std::make_unique<unsigned char[]>(BLOCK_SIZE), BLOCK_SIZE });
+		const uintptr_t ADDRESS = reinterpret_cast<uintptr_t>(block.data.get());
+		const size_t OFFSET = (alignment - ADDRESS % alignment) % alignment;
+		mPayloadOffset = OFFSET + size;
+		return block.data.get() + OFFSET;
 	}
 
-	bool EventQueue::pollEvent(std::unique_ptr<Event>& event)
+	bool EventQueue::pollEvent(Event*& event)
 	{
-		if (!mQueue.empty()) {
-			event = std::move(mQueue.front());
-			mQueue.pop();
+		releasePolledEvent();
 
+		// Retrieve the events stored in the slots first as they were enqueued before the heap-allocated ones
+		if (mCount > 0) {
+			event = reinterpret_cast<Event*>(mSlots[mFront].data);
+			mPolledSlot = true;
+			return true;
+		}
+		if (!mOverflowQueue.empty()) {
+			mPolledOverflow = std::move(mOverflowQueue.front());
+			mOverflowQueue.pop();
+			event = mPolledOverflow.get();
 			return true;
 		}
 
+		// No event referencing the payloads remains, the arena's blocks are reused
+		mPayloadBlock = 0;
+		mPayloadOffset = 0;
+
+		event = nullptr;
 		return false;
 	}
 
@@ -52,7 +144,83 @@ namespace ae
 
 	// Private constructor(s)
 	EventQueue::EventQueue() noexcept
-		: mQueue()
+		: mSlots()
+		, mFront(0)
+		, mCount(0)
+		, mOverflowQueue()
+		, mPolledOverflow(nullptr)
+		, mPolledSlot(false)
+		, mCoalescing(true)
+		, mPostedEvents(nullptr)
+		, mEventSource(nullptr)
+		, mPayloadBlocks()
+		, mPayloadBlock(0)
+		, mPayloadOffset(0)
 	{
 	}
+
+	EventQueue::~EventQueue()
+	{
+		releasePolledEvent();
+		for (; mCount > 0; --mCount, mFront = (mFront + 1) % CAPACITY) {
+			reinterpret_cast<Event*>(mSlots[mFront].data)->~Event();
+		}
+
+		// Destroy the events that were posted but never collected
+		PostedEvent* node = mPostedEvents.exchange(nullptr, std::memory_order_acquire);
+		while (node) {
+			PostedEvent* const next = node->next;
+			delete node;
+			node = next;
+		}
+	}
+
+	// Private method(s)
+	Event* EventQueue::getCoalescableEvent(Event::Type type) noexcept
+	{
+		if (!mCoalescing) {
+			return nullptr;
+		}
+
+		// Retrieve the last event enqueued, the one that was last polled may no longer be modified
+		Event* lastEvent = nullptr;
+		if (!mOverflowQueue.empty()) {
+			lastEvent = mOverflowQueue.back().get();
+		}
+		else if (mCount > ((mPolledSlot) ? 1u : 0u)) {
+			lastEvent = reinterpret_cast<Event*>(mSlots[(mFront + mCount - 1) % CAPACITY].data);
+		}
+
+		return (lastEvent && lastEvent->type == type && lastEvent->window == mEventSource) ? lastEvent : nullptr;
+	}
+
+	Event* EventQueue::getPendingEvent(Event::Type type) noexcept
+	{
+		// The heap-allocated events can't be searched, the resizes are no longer coalesced once every slot is occupied
+		if (!mCoalescing || !mOverflowQueue.empty()) {
+			return nullptr;
+		}
+
+		// Search the unpolled events from the most recent one, the one that was last polled may no longer be modified
+		const size_t FIRST = (mPolledSlot) ? 1 : 0;
+		for (size_t i = mCount; i > FIRST; --i) {
+			Event* const event = reinterpret_cast<Event*>(mSlots[(mFront + i - 1) % CAPACITY].data);
+			if (event->type == type && event->window == mEventSource) {
+				return event;
+			}
+		}
+
+		return nullptr;
+	}
+
+	void EventQueue::releasePolledEvent() noexcept
+	{
+		if (mPolledSlot) {
+			reinterpret_cast<Event*>(mSlots[mFront].data)->~Event();
+			mFront = (mFront + 1) % CAPACITY;
+			--mCount;
+			mPolledSlot = false;
+		}
+		mPolledOverflow.reset();
+	}
 }
\ No newline at end of file
@@ -22,24 +22,85 @@
 
 #include <AEON/Window/internal/InputManager.h>
 
+#include <bitset>
+#include <cstring>
+#include <string_view>
+
 #include <GLFW/glfw3.h>
 
 #include <AEON/Window/internal/EventQueue.h>
 #include <AEON/Window/Event.h>
 #include <AEON/Window/Monitor.h>
+#include <AEON/Window/Window.h>
+#include <AEON/System/Clipboard.h>
 
 namespace ae
 {
-	namespace InputManager
+	namespace
 	{
-		EventQueue& eventQueue = EventQueue::getInstance(); //!< The single instance of the ae::EventQueue
+		// The number of keys and mouse buttons tracked
+		constexpr size_t KEY_COUNT = GLFW_KEY_LAST + 1;
+		constexpr size_t BUTTON_COUNT = GLFW_MOUSE_BUTTON_LAST + 1;
+
+		// The states of the keys and mouse buttons and their edges
+		struct InputState
+		{
+			std::bitset<KEY_COUNT>    keys;            //!< The keys held down
+			std::bitset<KEY_COUNT>    pressedKeys;     //!< The keys pressed since the previous snapshot
+			std::bitset<KEY_COUNT>    releasedKeys;    //!< The keys released since the previous snapshot
+			std::bitset<BUTTON_COUNT> buttons;         //!< The mouse buttons held down
+			std::bitset<BUTTON_COUNT> pressedButtons;  //!< The mouse buttons pressed since the previous snapshot
+			std::bitset<BUTTON_COUNT> releasedButtons; //!< The mouse buttons released since the previous snapshot
+		};
+
+		// The state filled by the callbacks and the snapshot published at the beginning of the frame
+		InputState pendingInput;
+		InputState inputSnapshot;
+
+		// Whether recorded input is being fed to the callbacks in place of GLFW's
+		bool replaying = false;
+
+		// Records the new state of a key or button (the repeats don't produce any edges)
+		template <size_t N>
+		void recordInput(size_t index, int action, std::bitset<N>& down, std::bitset<N>& pressed, std::bitset<N>& released) noexcept
+		{
+			if (index >= N || action == GLFW_REPEAT) {
+				return;
+			}
+
+			const bool PRESSED = action == GLFW_PRESS;
+			down[index] = PRESSED;
+			if (PRESSED) {
+				pressed[index] = true;
+			}
+			else {
+				released[index] = true;
+			}
+		}
+
+		// Retrieves a bit of the snapshot, the unknown keys are never set
+		template <size_t N>
+		bool testInput(const std::bitset<N>& bits, int index) noexcept
+		{
+			return static_cast<size_t>(index) < N && bits[static_cast<size_t>(index)];
+		}
 
+		// Retrieves the event queue after tagging the subsequent events with the window that generated them
+		EventQueue& getQueue(GLFWwindow* glfwWindow) noexcept
+		{
+			EventQueue& queue = EventQueue::getInstance();
+			queue.setEventSource((glfwWindow) ? static_cast<Window*>(glfwGetWindowUserPointer(glfwWindow)) : nullptr);
+			return queue;
+		}
+	}
+
+	namespace InputManager
+	{
 		// Callback function(s)
 		void monitor_callback(GLFWmonitor* glfwMonitor, int connected)
 		{
 			// Create and enqueue the event
-			auto event = std::make_unique<MonitorEvent>(glfwMonitor, connected == GLFW_CONNECTED);
-			eventQueue.enqueueEvent(std::move(event));
+			getQueue(nullptr).enqueueEvent<MonitorEvent>(glfwMonitor, connected == GLFW_CONNECTED);
 		}
 
 		void window_close_callback(GLFWwindow* glfwWindow)
@@ -48,110 +109,140 @@ namespace ae
 			glfwSetWindowShouldClose(glfwWindow, GLFW_FALSE);
 
 			// Create and enqueue the event
-			auto event = std::make_unique<Event>(Event::Type::WindowClosed);
-			eventQueue.enqueueEvent(std::move(event));
+			getQueue(glfwWindow).enqueueEvent<Event>(Event::Type::WindowClosed);
 		}
 
 		void window_size_callback(GLFWwindow* glfwWindow, int width, int height)
 		{
 			// Create and enqueue the event
-			auto event = std::make_unique<WindowResizeEvent>(width, height);
-			eventQueue.enqueueEvent(std::move(event));
+			getQueue(glfwWindow).enqueueEvent<WindowResizeEvent>(width, height);
 		}
 
 		void framebuffer_size_callback(GLFWwindow* glfwWindow, int width, int height)
 		{
 			// Create and enqueue the event
-			auto event = std::make_unique<FramebufferResizeEvent>(width, height);
-			eventQueue.enqueueEvent(std::move(event));
+			getQueue(glfwWindow).enqueueEvent<FramebufferResizeEvent>(width, height);
 		}
 
 		void window_content_scale_callback(GLFWwindow* glfwWindow, float xscale, float yscale)
 		{
 			// Create and enqueue the event
-			auto event = std::make_unique<WindowContentScaleEvent>(xscale, yscale);
-			eventQueue.enqueueEvent(std::move(event));
+			getQueue(glfwWindow).enqueueEvent<WindowContentScaleEvent>(xscale, yscale);
 		}
 
 		void window_pos_callback(GLFWwindow* glfwWindow, int xpos, int ypos)
 		{
 			// Create and enqueue the event
-			auto event = std::make_unique<WindowMoveEvent>(xpos, ypos);
-			eventQueue.enqueueEvent(std::move(event));
+			getQueue(glfwWindow).enqueueEvent<WindowMoveEvent>(xpos, ypos);
 		}
 
 		void window_iconify_callback(GLFWwindow* glfwWindow, int iconified)
 		{
 			// Create and enqueue the event
-			auto event = std::make_unique<Event>((iconified) ? Event::Type::WindowMinimized : Event::Type::WindowRestored);
-			eventQueue.enqueueEvent(std::move(event));
+			getQueue(glfwWindow).enqueueEvent<Event>((iconified) ? Event::Type::WindowMinimized : Event::Type::WindowRestored);
 		}
 
 		void window_maximize_callback(GLFWwindow* glfwWindow, int maximized)
 		{
 			// Create and enqueue the event
-			auto event = std::make_unique<Event>((maximized) ? Event::Type::WindowMaximized : Event::Type::WindowRestored);
-			eventQueue.enqueueEvent(std::move(event));
+			getQueue(glfwWindow).enqueueEvent<Event>((maximized) ? Event::Type::WindowMaximized : Event::Type::WindowRestored);
 		}
 
 		void window_focus_callback(GLFWwindow* glfwWindow, int focused)
 		{
+			// The clipboard may have been modified by another application while the window was unfocused
+			if (focused) {
+				Clipboard::invalidateCache();
+			}
+
 			// Create and enqueue the event
-			auto event = std::make_unique<Event>((focused) ? Event::Type::WindowFocusGained : Event::Type::WindowFocusLost);
-			eventQueue.enqueueEvent(std::move(event));
+			getQueue(glfwWindow).enqueueEvent<Event>((focused) ? Event::Type::WindowFocusGained : Event::Type::WindowFocusLost);
 		}
 
 		void window_refresh_callback(GLFWwindow* glfwWindow)
 		{
 			// Create and enqueue the event
-			auto event = std::make_unique<Event>(Event::Type::WindowDamaged);
-			eventQueue.enqueueEvent(std::move(event));
+			getQueue(glfwWindow).enqueueEvent<Event>(Event::Type::WindowDamaged);
 		}
 
 		void path_drop_callback(GLFWwindow* glfwWindow, int count, const char** paths)
 		{
+			// Copy the paths into the queue's payload arena as GLFW only guarantees their validity during the callback
+			EventQueue& queue = getQueue(glfwWindow);
+			const size_t COUNT = static_cast<size_t>(count);
+			std::string_view* const views = static_cast<std::string_view*>(queue.allocatePayload(COUNT * sizeof(std::string_view), alignof(std::string_view)));
+			for (size_t i = 0; i < COUNT; ++i) {
+				const size_t LENGTH = std::strlen(paths[i]);
+				char* const path = static_cast<char*>(queue.allocatePayload(LENGTH + 1, 1));
+				std::memcpy(path, paths[i], LENGTH + 1);
+				new (views + i) std::string_view(path, LENGTH);
+			}
+
 			// Create and enqueue the event
-			auto event = std::make_unique<PathDropEvent>(count, paths);
-			eventQueue.enqueueEvent(std::move(event));
+			queue.enqueueEvent<PathDropEvent>(views, COUNT);
 		}
 
 		void key_callback(GLFWwindow* glfwWindow, int key, int scancode, int action, int mods)
 		{
+			// The live input is ignored while the recorded input is replayed
+			if (replaying && glfwWindow) {
+				return;
+			}
+
+			recordInput(static_cast<size_t>(key), action, pendingInput.keys, pendingInput.pressedKeys, pendingInput.releasedKeys);
+
 			// Create and enqueue the event
-			auto event = std::make_unique<KeyEvent>(static_cast<Keyboard::Key>(key), action != GLFW_RELEASE, mods);
-			eventQueue.enqueueEvent(std::move(event));
+			getQueue(glfwWindow).enqueueEvent<KeyEvent>(static_cast<Keyboard::Key>(key), action != GLFW_RELEASE, mods);
 		}
 
 		void character_callback(GLFWwindow* glfwWindow, unsigned int codepoint)
 		{
+			if (replaying && glfwWindow) {
+				return;
+			}
+
 			// Create and enqueue the event
-			auto event = std::make_unique<TextEvent>(codepoint);
-			eventQueue.enqueueEvent(std::move(event));
+			getQueue(glfwWindow).enqueueEvent<TextEvent>(codepoint);
 		}
 
 		void cursor_position_callback(GLFWwindow* glfwWindow, double xpos, double ypos)
 		{
+			if (replaying && glfwWindow) {
+				return;
+			}
+
 			// Create and enqueue the event
-			auto event = std::make_unique<MouseMoveEvent>(xpos, ypos);
-			eventQueue.enqueueEvent(std::move(event));
+			getQueue(glfwWindow).enqueueEvent<MouseMoveEvent>(xpos, ypos);
 		}
 
 		void cursor_enter_callback(GLFWwindow* glfwWindow, int entered)
 		{
+			if (replaying && glfwWindow) {
+				return;
+			}
+
 			// Create and enqueue the event
-			auto event = std::make_unique<Event>((entered) ? Event::Type::MouseEntered : Event::Type::MouseLeft);
-			eventQueue.enqueueEvent(std::move(event));
+			getQueue(glfwWindow).enqueueEvent<Event>((entered) ? Event::Type::MouseEntered : Event::Type::MouseLeft);
 		}
 
 		void mouse_button_callback(GLFWwindow* glfwWindow, int button, int action, int mods)
 		{
+			if (replaying && glfwWindow) {
+				return;
+			}
+
+			recordInput(static_cast<size_t>(button), action, pendingInput.buttons, pendingInput.pressedButtons, pendingInput.releasedButtons);
+
 			// Create and enqueue the event
-			auto event = std::make_unique<MouseButtonEvent>(static_cast<Mouse::Button>(button), action != GLFW_RELEASE, mods);
-			eventQueue.enqueueEvent(std::move(event));
+			getQueue(glfwWindow).enqueueEvent<MouseButtonEvent>(static_cast<Mouse::Button>(button), action != GLFW_RELEASE, mods);
 		}
 
 		void scroll_callback(GLFWwindow* glfwWindow, double xoffset, double yoffset)
 		{
+			if (replaying && glfwWindow) {
+				return;
+			}
+
 			// Check which mouse wheel was affected
 			Mouse::Wheel wheel = Mouse::Wheel::Vertical;
 			double offset = yoffset;
@@ -161,8 +252,55 @@ namespace ae
 			}
 
 			// Create and enqueue the event
-			auto event = std::make_unique<MouseWheelEvent>(wheel, offset);
-			eventQueue.enqueueEvent(std::move(event));
+			getQueue(glfwWindow).enqueueEvent<MouseWheelEvent>(wheel, offset);
+		}
+
+		// Function(s)
+		void updateSnapshot() noexcept
+		{
+			// Publish the states and start accumulating the next frame's edges
+			inputSnapshot = pendingInput;
+			pendingInput.pressedKeys.reset();
+			pendingInput.releasedKeys.reset();
+			pendingInput.pressedButtons.reset();
+			pendingInput.releasedButtons.reset();
+		}
+
+		void setReplaying(bool flag) noexcept
+		{
+			// The replay starts and ends with every key and button released so that the live and recorded states don't mix
+			replaying = flag;
+			pendingInput = InputState();
+		}
+
+		bool isKeyDown(Keyboard::Key key) noexcept
+		{
+			return testInput(inputSnapshot.keys, static_cast<int>(key));
+		}
+
+		bool wasKeyPressed(Keyboard::Key key) noexcept
+		{
+			return testInput(inputSnapshot.pressedKeys, static_cast<int>(key));
+		}
+
+		bool wasKeyReleased(Keyboard::Key key) noexcept
+		{
+			return testInput(inputSnapshot.releasedKeys, static_cast<int>(key));
+		}
+
+		bool isButtonDown(Mouse::Button button) noexcept
+		{
+			return testInput(inputSnapshot.buttons, static_cast<int>(button));
+		}
+
+		bool wasButtonPressed(Mouse::Button button) noexcept
+		{
+			return testInput(inputSnapshot.pressedButtons, static_cast<int>(button));
+		}
+
+		bool wasButtonReleased(Mouse::Button button) noexcept
+		{
+			return testInput(inputSnapshot.releasedButtons, static_cast<int>(button));
 		}
 	}
 }
\ No newline at end of file
@@ -21,16 +21,33 @@
 // SOFTWARE.
 
 #include <AEON/Window/internal/StateStack.h>
+
+#include <string>
+
+#include <AEON/System/Profiler.h>
+#include <AEON/System/Task.h>
+#include <AEON/System/TimerWheel.h>
+#include <AEON/Graphics/GLResourceFactory.h>
+#include <AEON/Graphics/TweenSystem.h>
 #include <AEON/Window/Window.h>
 #include <AEON/Window/Application.h>
+#include <AEON/Window/EventBus.h>
 
 namespace ae
 {
 	// Public method(s)
 	void StateStack::handleEvent(Event* const event)
 	{
+		AEON_PROFILE_SCOPE("StateStack::handleEvent");
+
+		// The lower states don't receive the events whose propagation was stopped by a listener, a widget or an actor
 		for (auto& state : mStates) {
-			if (!state.second->handleEvent(event)) {
+			if (event->isPropagationStopped()) {
+				break;
+			}
+
+			state.second->routeEvent(event);
+			if (event->isPropagationStopped() || !state.second->handleEvent(event)) {
 				break;
 			}
 		}
@@ -40,6 +57,9 @@ namespace ae
 
 	void StateStack::update(const Time& dt)
 	{
+		AEON_PROFILE_SCOPE("StateStack::update");
+
+		releasePreloadJobs();
 		for (auto& state : mStates) {
 			if (!state.second->update(dt)) {
 				break;
@@ -49,12 +69,38 @@ namespace ae
 		applyPendingChanges();
 	}
 
-	void StateStack::draw()
+	void StateStack::draw(float interpolation)
 	{
+		AEON_PROFILE_SCOPE("StateStack::draw");
+
+		bool blocked = false, trimmed = false;
 		for (auto& state : mStates) {
-			if (!state.second->draw()) {
-				break;
+			auto suspendedItr = mSuspended.find(state.first);
+
+			// Suspend the states that are no longer drawn
+			if (blocked) {
+				if (suspendedItr == mSuspended.end()) {
+					state.second->onSuspend();
+					if (mMemoryTrimming) {
+						state.second->onTrimMemory();
+						trimmed = true;
+					}
+					mSuspended.emplace(state.first, mMemoryTrimming);
+				}
+				continue;
 			}
+
+			// Resume the suspended states before drawing them so that they may restore their resources
+			if (suspendedItr != mSuspended.end()) {
+				state.second->onResume(suspendedItr->second);
+				mSuspended.erase(suspendedItr);
+			}
+			blocked = !state.second->draw(interpolation);
+		}
+
+		// Queue the OpenGL resources released by the trimmed states for destruction
+		if (trimmed) {
+			GLResourceFactory::getInstance().destroyUnused();
 		}
 	}
 
@@ -63,6 +109,37 @@ namespace ae
 		mPendingQueue.emplace(Action::Push, stateID);
 	}
 
+	void StateStack::preloadState(uint32_t stateID)
+	{
+		// Check if the state is already pushed or preloaded (ignored in Release mode)
+		if _CONSTEXPR_IF (AEON_DEBUG) {
+			if (mStates.find(stateID) != mStates.end() || mReadyPool.find(stateID) != mReadyPool.end()) {
+				AEON_LOG_WARNING("Redundant state preloading", "The state " + std::to_string(stateID) + " is already pushed or preloaded.\nAborting operation.");
+				return;
+			}
+		}
+
+		// Construct the state on the calling thread as it may create OpenGL resources
+		std::unique_ptr<State> state = createState(stateID);
+		if (!state) {
+			return;
+		}
+
+		// Load its resources on a worker thread
+		std::unique_ptr<PreloadedState> preloaded = std::make_unique<PreloadedState>();
+		preloaded->state = std::move(state);
+		preloaded->loaded.store(false, std::memory_order_relaxed);
+
+		JobSystem& jobSystem = JobSystem::getInstance();
+		PreloadedState* const PRELOADED = preloaded.get();
+		preloaded->job = jobSystem.createJob([PRELOADED]() {
+			PRELOADED->state->preload();
+			PRELOADED->loaded.store(true, std::memory_order_release);
+		});
+		mReadyPool.emplace(stateID, std::move(preloaded));
+		jobSystem.run(PRELOADED->job);
+	}
+
 	void StateStack::removeState(uint32_t stateID)
 	{
 		mPendingQueue.emplace(Action::Remove, stateID);
@@ -88,11 +165,38 @@ namespace ae
 		return stateItr->second.get();
 	}
 
+	bool StateStack::isPreloading(uint32_t stateID) const
+	{
+		auto preloadedItr = mReadyPool.find(stateID);
+		return preloadedItr != mReadyPool.end() && !preloadedItr->second->loaded.load(std::memory_order_acquire);
+	}
+
+	void StateStack::setMemoryTrimming(bool flag) noexcept
+	{
+		mMemoryTrimming = flag;
+	}
+
+	bool StateStack::isMemoryTrimming() const noexcept
+	{
+		return mMemoryTrimming;
+	}
+
 	bool StateStack::isEmpty() const noexcept
 	{
 		return mStates.empty();
 	}
 
+	bool StateStack::isAnimating() const
+	{
+		for (const auto& state : mStates) {
+			if (state.second->isAnimating()) {
+				return true;
+			}
+		}
+
+		return false;
+	}
+
 	// Public static method(s)
 	StateStack& StateStack::getInstance() noexcept
 	{
@@ -104,8 +208,18 @@ namespace ae
 	StateStack::StateStack() noexcept
 		: mStates()
 		, mStateFactories()
+		, mReadyPool()
+		, mSuspended()
 		, mPendingQueue()
+		, mMemoryTrimming(false)
 	{
+		// Construct the singletons used by the states' timers, tasks and tweens beforehand so that they outlive the states
+		static_cast<void>(TimerWheel::getInstance());
+		static_cast<void>(EventBus::getInstance());
+		static_cast<void>(TweenSystem::getInstance());
+#if AEON_COROUTINES
+		static_cast<void>(TaskScheduler::getInstance());
+#endif // AEON_COROUTINES
 	}
 
 	// Private method(s)
@@ -125,6 +239,35 @@ namespace ae
 		return found->second();
 	}
 
+	std::unique_ptr<State> StateStack::takePreloadedState(uint32_t stateID)
+	{
+		auto preloadedItr = mReadyPool.find(stateID);
+		if (preloadedItr == mReadyPool.end()) {
+			return nullptr;
+		}
+
+		// The calling thread executes the queued jobs while the preloading is completed
+		PreloadedState& preloaded = *preloadedItr->second;
+		if (preloaded.job) {
+			JobSystem::getInstance().wait(preloaded.job);
+		}
+
+		std::unique_ptr<State> state = std::move(preloaded.state);
+		mReadyPool.erase(preloadedItr);
+		return state;
+	}
+
+	void StateStack::releasePreloadJobs()
+	{
+		// The completed jobs don't block the calling thread
+		for (auto& preloaded : mReadyPool) {
+			if (preloaded.second->job && preloaded.second->loaded.load(std::memory_order_acquire)) {
+				JobSystem::getInstance().wait(preloaded.second->job);
+				preloaded.second->job = nullptr;
+			}
+		}
+	}
+
 	void StateStack::applyPendingChanges()
 	{
 		while (!mPendingQueue.empty()) {
@@ -132,16 +275,37 @@ namespace ae
 			switch (change.action)
 			{
 			case Action::Push:
-				mStates.try_emplace(change.stateID, createState(change.stateID));
+			{
+				// The states that weren't preloaded load their resources synchronously
+				std::unique_ptr<State> state = takePreloadedState(change.stateID);
+				if (!state) {
+					state = createState(change.stateID);
+					if (state) {
+						state->preload();
+					}
+				}
+				mStates.try_emplace(change.stateID, std::move(state));
 				break;
+			}
 			case Action::Remove:
 				mStates.erase(mStates.find(change.stateID));
+				mSuspended.erase(change.stateID);
 				break;
 			case Action::Clear:
 				mStates.clear();
+				mSuspended.clear();
+				for (auto& preloaded : mReadyPool) {
+					if (preloaded.second->job) {
+						JobSystem::getInstance().wait(preloaded.second->job);
+					}
+				}
+				mReadyPool.clear();
 				Application::getInstance().getWindow().close();
 			};
 
+			// The states displayed changed, so the window is entirely redrawn
+			Application::getInstance().getWindow().invalidate();
+
 			// Remove the action that was just handled
 			mPendingQueue.pop();
 		}
@@ -0,0 +1,261 @@
+// MIT License
+// 
+// Copyright(c) 2019-2021 Filippos Gleglakos
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+// Microbenchmark suite of the Math module, the baseline against which the Vector, Matrix, Quaternion and collider changes are evaluated
+// Usage: MathBenchmark [output.json] [minimum milliseconds per operation]
+// The instruction set is selected at compile time: build once as usual and once with AEON_NO_SIMD defined to compare the SIMD and scalar runs.
+
+#include <array>
+#include <cstdio>
+#include <string>
+
+#include <AEON/Math/AABoxCollider.h>
+#include <AEON/Math/Matrix.h>
+#include <AEON/Math/Misc.h>
+#include <AEON/Math/internal/Quaternion.h>
+#include <AEON/System/Benchmark.h>
+
+namespace
+{
+	// The number of distinct inputs cycled through so that the operations can't be folded into constants
+	constexpr size_t INPUT_COUNT = 256;
+
+#if defined(AEON_SIMD_AVX)
+	const char* const INSTRUCTION_SET = "avx";
+#elif defined(AEON_SIMD_SSE)
+	const char* const INSTRUCTION_SET = "sse";
+#elif defined(AEON_SIMD_NEON)
+	const char* const INSTRUCTION_SET = "neon";
+#else
+	const char* const INSTRUCTION_SET = "scalar";
+#endif
+
+	// The reproducible inputs of the operations
+	struct Inputs
+	{
+		std::array<ae::Vector3f, INPUT_COUNT>       vec3;
+		std::array<ae::Vector4f, INPUT_COUNT>       vec4;
+		std::array<ae::Matrix4f, INPUT_COUNT>       models;
+		std::array<ae::Quaternion, INPUT_COUNT>     rotations;
+		std::array<ae::AABoxCollider2f, INPUT_COUNT> boxes2;
+		std::array<ae::AABoxCollider3f, INPUT_COUNT> boxes3;
+		std::array<float, INPUT_COUNT>              angles;
+	};
+
+	// Generate the inputs from a fixed seed so that every run measures the same values
+	void generateInputs(Inputs& inputs)
+	{
+		uint64_t state = 0x9E3779B97F4A7C15ull;
+		auto next = [&state](float min, float max) {
+			state ^= state << 13;
+			state ^= state >> 7;
+			state ^= state << 17;
+			return ae::Math::randomFromBits(state, min, max);
+		};
+
+		for (size_t i = 0; i < INPUT_COUNT; ++i) {
+			inputs.vec3[i] = ae::Vector3f(next(-10.f, 10.f), next(-10.f, 10.f), next(-10.f, 10.f));
+			inputs.vec4[i] = ae::Vector4f(next(-10.f, 10.f), next(-10.f, 10.f), next(-10.f, 10.f), 1.f);
+
+			const ae::Vector3f AXIS = ae::Vector3f(next(0.1f, 1.f), next(0.1f, 1.f), next(0.1f, 1.f)).normalize();
+			const float ANGLE = next(-ae::Math::PI, ae::Math::PI);
+			inputs.models[i] = ae::Matrix4f::translate(inputs.vec3[i]) * ae::Matrix4f::rotate(ANGLE, AXIS) * ae::Matrix4f::scale(ae::Vector3f(next(0.5f, 2.f), next(0.5f, 2.f), next(0.5f, 2.f)));
+			inputs.rotations[i] = ae::Quaternion::rotation(ANGLE, AXIS);
+
+			const ae::Vector2f MIN2(next(-100.f, 100.f), next(-100.f, 100.f));
+			inputs.boxes2[i] = ae::AABoxCollider2f(MIN2, MIN2 + ae::Vector2f(next(1.f, 50.f), next(1.f, 50.f)));
+			const ae::Vector3f MIN3(next(-100.f, 100.f), next(-100.f, 100.f), next(-100.f, 100.f));
+			inputs.boxes3[i] = ae::AABoxCollider3f(MIN3, MIN3 + ae::Vector3f(next(1.f, 50.f), next(1.f, 50.f), next(1.f, 50.f)));
+
+			inputs.angles[i] = ANGLE;
+		}
+	}
+
+	void benchmarkVectors(ae::Benchmark& benchmark, const Inputs& inputs)
+	{
+		size_t i = 0;
+		auto nextIndex = [&i]() { return (i = (i + 1) % INPUT_COUNT); };
+
+		benchmark.run("Vector3f::operator+", [&]() {
+			const size_t I = nextIndex();
+			ae::Benchmark::doNotOptimize(inputs.vec3[I] + inputs.vec3[(I + 1) % INPUT_COUNT]);
+		});
+		benchmark.run("Vector3f::operator*(float)", [&]() {
+			const size_t I = nextIndex();
+			ae::Benchmark::doNotOptimize(inputs.vec3[I] * inputs.angles[I]);
+		});
+		benchmark.run("dot(Vector3f)", [&]() {
+			const size_t I = nextIndex();
+			ae::Benchmark::doNotOptimize(ae::dot(inputs.vec3[I], inputs.vec3[(I + 1) % INPUT_COUNT]));
+		});
+		benchmark.run("cross(Vector3f)", [&]() {
+			const size_t I = nextIndex();
+			ae::Benchmark::doNotOptimize(ae::cross(inputs.vec3[I], inputs.vec3[(I + 1) % INPUT_COUNT]));
+		});
+		benchmark.run("Vector3f::normalize", [&]() {
+			ae::Benchmark::doNotOptimize(inputs.vec3[nextIndex()].normalize());
+		});
+		benchmark.run("Vector4f::operator+", [&]() {
+			const size_t I = nextIndex();
+			ae::Benchmark::doNotOptimize(inputs.vec4[I] + inputs.vec4[(I + 1) % INPUT_COUNT]);
+		});
+		benchmark.run("Vector4f::operator*(float)", [&]() {
+			const size_t I = nextIndex();
+			ae::Benchmark::doNotOptimize(inputs.vec4[I] * inputs.angles[I]);
+		});
+		benchmark.run("dot(Vector4f)", [&]() {
+			const size_t I = nextIndex();
+			ae::Benchmark::doNotOptimize(ae::dot(inputs.vec4[I], inputs.vec4[(I + 1) % INPUT_COUNT]));
+		});
+	}
+
+	void benchmarkMatrices(ae::Benchmark& benchmark, const Inputs& inputs)
+	{
+		size_t i = 0;
+		auto nextIndex = [&i]() { return (i = (i + 1) % INPUT_COUNT); };
+
+		benchmark.run("Matrix4f::operator*(Matrix4f)", [&]() {
+			const size_t I = nextIndex();
+			ae::Benchmark::doNotOptimize(inputs.models[I] * inputs.models[(I + 1) % INPUT_COUNT]);
+		});
+		benchmark.run("Matrix4f::invert", [&]() {
+			ae::Benchmark::doNotOptimize(inputs.models[nextIndex()].invert());
+		});
+		benchmark.run("Matrix4f::invertAffine", [&]() {
+			ae::Benchmark::doNotOptimize(inputs.models[nextIndex()].invertAffine());
+		});
+		benchmark.run("Matrix4f::operator*(Vector4f)", [&]() {
+			const size_t I = nextIndex();
+			ae::Benchmark::doNotOptimize(inputs.models[I] * inputs.vec4[I]);
+		});
+		benchmark.run("Matrix4f::operator*(Vector3f)", [&]() {
+			const size_t I = nextIndex();
+			ae::Benchmark::doNotOptimize(inputs.models[I] * inputs.vec3[I]);
+		});
+	}
+
+	void benchmarkQuaternions(ae::Benchmark& benchmark, const Inputs& inputs)
+	{
+		size_t i = 0;
+		auto nextIndex = [&i]() { return (i = (i + 1) % INPUT_COUNT); };
+
+		benchmark.run("Quaternion::operator*(Quaternion)", [&]() {
+			const size_t I = nextIndex();
+			ae::Benchmark::doNotOptimize(inputs.rotations[I] * inputs.rotations[(I + 1) % INPUT_COUNT]);
+		});
+		benchmark.run("Quaternion::nlerp", [&]() {
+			const size_t I = nextIndex();
+			ae::Benchmark::doNotOptimize(ae::Quaternion::nlerp(inputs.rotations[I], inputs.rotations[(I + 1) % INPUT_COUNT], 0.25f));
+		});
+		benchmark.run("Quaternion::slerp", [&]() {
+			const size_t I = nextIndex();
+			ae::Benchmark::doNotOptimize(ae::Quaternion::slerp(inputs.rotations[I], inputs.rotations[(I + 1) % INPUT_COUNT], 0.25f));
+		});
+	}
+
+	void benchmarkColliders(ae::Benchmark& benchmark, const Inputs& inputs)
+	{
+		size_t i = 0;
+		auto nextIndex = [&i]() { return (i = (i + 1) % INPUT_COUNT); };
+
+		benchmark.run("AABoxCollider2f::intersects", [&]() {
+			const size_t I = nextIndex();
+			ae::Benchmark::doNotOptimize(inputs.boxes2[I].intersects(inputs.boxes2[(I + 1) % INPUT_COUNT]));
+		});
+		benchmark.run("AABoxCollider3f::intersects", [&]() {
+			const size_t I = nextIndex();
+			ae::Benchmark::doNotOptimize(inputs.boxes3[I].intersects(inputs.boxes3[(I + 1) % INPUT_COUNT]));
+		});
+		benchmark.run("AABoxCollider3f::intersects(intersection)", [&]() {
+			const size_t I = nextIndex();
+			ae::AABoxCollider3f intersection;
+			ae::Benchmark::doNotOptimize(inputs.boxes3[I].intersects(inputs.boxes3[(I + 1) % INPUT_COUNT], &intersection));
+			ae::Benchmark::doNotOptimize(intersection);
+		});
+	}
+
+	void benchmarkTrigonometry(ae::Benchmark& benchmark, const Inputs& inputs)
+	{
+		size_t i = 0;
+		auto nextIndex = [&i]() { return (i = (i + 1) % INPUT_COUNT); };
+
+		benchmark.run("Math::sin", [&]() {
+			ae::Benchmark::doNotOptimize(ae::Math::sin(inputs.angles[nextIndex()]));
+		});
+		benchmark.run("Math::cos", [&]() {
+			ae::Benchmark::doNotOptimize(ae::Math::cos(inputs.angles[nextIndex()]));
+		});
+		benchmark.run("Math::tan", [&]() {
+			ae::Benchmark::doNotOptimize(ae::Math::tan(inputs.angles[nextIndex()]));
+		});
+		benchmark.run("Math::atan2", [&]() {
+			const size_t I = nextIndex();
+			ae::Benchmark::doNotOptimize(ae::Math::atan2(inputs.angles[I], inputs.angles[(I + 1) % INPUT_COUNT]));
+		});
+		benchmark.run("Math::rsqrt", [&]() {
+			ae::Benchmark::doNotOptimize(ae::Math::rsqrt(inputs.boxes2[nextIndex()].max.x + 200.f));
+		});
+		benchmark.run("Math::Fast::sin", [&]() {
+			ae::Benchmark::doNotOptimize(ae::Math::Fast::sin(inputs.angles[nextIndex()]));
+		});
+		benchmark.run("Math::Fast::cos", [&]() {
+			ae::Benchmark::doNotOptimize(ae::Math::Fast::cos(inputs.angles[nextIndex()]));
+		});
+		benchmark.run("Math::Fast::atan2", [&]() {
+			const size_t I = nextIndex();
+			ae::Benchmark::doNotOptimize(ae::Math::Fast::atan2(inputs.angles[I], inputs.angles[(I + 1) % INPUT_COUNT]));
+		});
+		benchmark.run("Math::Fast::rsqrt", [&]() {
+			ae::Benchmark::doNotOptimize(ae::Math::Fast::rsqrt(inputs.boxes2[nextIndex()].max.x + 200.f));
+		});
+	}
+}
+
+int main(int argc, char* argv[])
+{
+	if (argc > 3) {
+		std::fprintf(stderr, "Usage: %s [output.json] [minimum milliseconds per operation]\n", argv[0]);
+		return 1;
+	}
+
+	const std::string OUTPUT = (argc >= 2 && argv[1][0] != '\0') ? argv[1] : std::string("math_benchmark_") + INSTRUCTION_SET + ".json";
+	const int MIN_TIME = (argc == 3) ? std::stoi(argv[2]) : 100;
+	if (MIN_TIME <= 0) {
+		std::fprintf(stderr, "The minimum time per operation must be positive.\n");
+		return 1;
+	}
+
+	Inputs inputs;
+	generateInputs(inputs);
+
+	ae::Benchmark benchmark(ae::Time::milliseconds(MIN_TIME));
+	benchmarkVectors(benchmark, inputs);
+	benchmarkMatrices(benchmark, inputs);
+	benchmarkQuaternions(benchmark, inputs);
+	benchmarkColliders(benchmark, inputs);
+	benchmarkTrigonometry(benchmark, inputs);
+
+	std::printf("Math benchmark (%s)\n%s\n", INSTRUCTION_SET, benchmark.toString().c_str());
+	benchmark.exportJSON(OUTPUT);
+	std::printf("Results written to \"%s\".\n", OUTPUT.c_str());
+	return 0;
+}
\ No newline at end of file
@@ -0,0 +1,188 @@
+// MIT License
+// 
+// Copyright(c) 2019-2021 Filippos Gleglakos
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+// Offline converter of Wavefront OBJ models into the binary mesh files loaded by ae::Mesh::loadFromFile()
+// Usage: MeshConverter <input.obj> <output.aemesh>
+// Each object, group or material change of the model starts a new submesh, and the polygons are triangulated as fans.
+
+#include <array>
+#include <cstdio>
+#include <fstream>
+#include <map>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <AEON/Graphics/Mesh.h>
+
+namespace
+{
+	// The indices of a face corner's position, texture coordinates and normal (-1 if absent)
+	using CornerKey = std::array<int, 3>;
+
+	// Resolve an OBJ index (1-based, or negative if relative to the end) into a 0-based index, -1 if it's absent or invalid
+	int resolveIndex(const std::string& token, size_t count)
+	{
+		if (token.empty()) {
+			return -1;
+		}
+
+		const int INDEX = std::stoi(token);
+		const int RESOLVED = (INDEX < 0) ? static_cast<int>(count) + INDEX : INDEX - 1;
+		return (RESOLVED >= 0 && RESOLVED < static_cast<int>(count)) ? RESOLVED : -1;
+	}
+
+	// Parse a face corner ("v", "v/vt", "v//vn" or "v/vt/vn")
+	CornerKey parseCorner(const std::string& corner, size_t positionCount, size_t uvCount, size_t normalCount)
+	{
+		std::string tokens[3];
+		size_t tokenIndex = 0;
+		for (const char C : corner) {
+			if (C == '/') {
+				if (++tokenIndex == 3) break;
+			}
+			else {
+				tokens[tokenIndex] += C;
+			}
+		}
+
+		return { resolveIndex(tokens[0], positionCount), resolveIndex(tokens[1], uvCount), resolveIndex(tokens[2], normalCount) };
+	}
+}
+
+int main(int argc, char* argv[])
+{
+	if (argc != 3) {
+		std::fprintf(stderr, "Usage: %s <input.obj> <output.aemesh>\n", argv[0]);
+		return 1;
+	}
+
+	std::ifstream input(argv[1]);
+	if (!input) {
+		std::fprintf(stderr, "Unable to open \"%s\".\n", argv[1]);
+		return 1;
+	}
+
+	std::vector<ae::Vector3f> positions, normals;
+	std::vector<ae::Vector2f> uvs;
+	std::vector<ae::Vertex3D> vertices;
+	std::vector<unsigned int> indices;
+	std::vector<ae::Mesh::Submesh> submeshes;
+	std::map<CornerKey, unsigned int> uniqueCorners;
+	std::vector<bool> missingNormals;
+
+	// Start a new submesh unless the current one is still empty
+	auto beginSubmesh = [&]() {
+		if (submeshes.empty() || submeshes.back().indexCount > 0) {
+			submeshes.push_back({ static_cast<unsigned int>(indices.size()), 0, ae::Box3f() });
+		}
+	};
+	beginSubmesh();
+
+	std::string line;
+	for (size_t lineNumber = 1; std::getline(input, line); ++lineNumber)
+	{
+		std::istringstream stream(line);
+		std::string keyword;
+		stream >> keyword;
+
+		if (keyword == "v") {
+			ae::Vector3f position;
+			stream >> position.x >> position.y >> position.z;
+			positions.push_back(position);
+		}
+		else if (keyword == "vt") {
+			ae::Vector2f uv;
+			stream >> uv.x >> uv.y;
+			uvs.push_back(uv);
+		}
+		else if (keyword == "vn") {
+			ae::Vector3f normal;
+			stream >> normal.x >> normal.y >> normal.z;
+			normals.push_back(normal);
+		}
+		else if (keyword == "o" || keyword == "g" || keyword == "usemtl") {
+			beginSubmesh();
+		}
+		else if (keyword == "f") {
+			// Retrieve the polygon's vertices, the identical corners being shared
+			std::vector<unsigned int> polygon;
+			std::string corner;
+			while (stream >> corner) {
+				const CornerKey KEY = parseCorner(corner, positions.size(), uvs.size(), normals.size());
+				if (KEY[0] < 0) {
+					std::fprintf(stderr, "Invalid face corner \"%s\" on line %zu.\n", corner.c_str(), lineNumber);
+					return 1;
+				}
+
+				auto insertion = uniqueCorners.try_emplace(KEY, static_cast<unsigned int>(vertices.size()));
+				if (insertion.second) {
+					ae::Vertex3D vertex;
+					vertex.position = positions[KEY[0]];
+					vertex.uv = (KEY[1] >= 0) ? uvs[KEY[1]] : ae::Vector2f();
+					vertex.normal = (KEY[2] >= 0) ? normals[KEY[2]] : ae::Vector3f();
+					vertices.push_back(vertex);
+					missingNormals.push_back(KEY[2] < 0);
+				}
+				polygon.push_back(insertion.first->second);
+			}
+
+			// Triangulate the polygon as a fan
+			for (size_t i = 2; i < polygon.size(); ++i) {
+				indices.insert(indices.end(), { polygon[0], polygon[i - 1], polygon[i] });
+				submeshes.back().indexCount += 3;
+			}
+		}
+	}
+
+	if (submeshes.back().indexCount == 0) {
+		submeshes.pop_back();
+	}
+	if (indices.empty()) {
+		std::fprintf(stderr, "\"%s\" doesn't contain any faces.\n", argv[1]);
+		return 1;
+	}
+
+	// Compute the normals that the model doesn't provide by accumulating the faces' area-weighted normals
+	for (size_t i = 0; i < indices.size(); i += 3) {
+		const ae::Vector3f& P0 = vertices[indices[i]].position;
+		const ae::Vector3f FACE_NORMAL = ae::cross(vertices[indices[i + 1]].position - P0, vertices[indices[i + 2]].position - P0);
+		for (size_t j = 0; j < 3; ++j) {
+			if (missingNormals[indices[i + j]]) {
+				vertices[indices[i + j]].normal += FACE_NORMAL;
+			}
+		}
+	}
+	for (size_t i = 0; i < vertices.size(); ++i) {
+		if (missingNormals[i] && vertices[i].normal != ae::Vector3f()) {
+			vertices[i].normal = vertices[i].normal.normalize();
+		}
+	}
+
+	if (!ae::Mesh::saveToFile(argv[2], vertices, indices, submeshes)) {
+		std::fprintf(stderr, "Unable to write \"%s\".\n", argv[2]);
+		return 1;
+	}
+
+	std::printf("Converted \"%s\": %zu vertices, %zu triangles, %zu submeshes.\n", argv[1], vertices.size(), indices.size() / 3, submeshes.size());
+	return 0;
+}
\ No newline at end of file
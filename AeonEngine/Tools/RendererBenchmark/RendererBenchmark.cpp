@@ -0,0 +1,295 @@
+// MIT License
+// 
+// Copyright(c) 2019-2021 Filippos Gleglakos
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+// Headless benchmark comparing the ae::BasicRenderer2D and the ae::BatchRenderer2D over reproducible scenes
+// Usage: RendererBenchmark <font.ttf> [output.json] [frames per scene]
+// Each scene (sprites, text labels or mixed shapes, with a fraction of animated actors and a number of textures) is generated from a fixed
+// seed and rendered into a headless window by both renderers. The medians of the submission and termination times and the averages of the
+// drawcalls and uploaded bytes per frame are reported as a table and as a JSON document.
+
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <AEON/Math/Misc.h>
+#include <AEON/Window/Application.h>
+#include <AEON/Graphics/BasicRenderer2D.h>
+#include <AEON/Graphics/BatchRenderer2D.h>
+#include <AEON/Graphics/EllipseShape.h>
+#include <AEON/Graphics/Font.h>
+#include <AEON/Graphics/GLResourceFactory.h>
+#include <AEON/Graphics/RectangleShape.h>
+#include <AEON/Graphics/RenderStates.h>
+#include <AEON/Graphics/Sprite.h>
+#include <AEON/Graphics/Text.h>
+#include <AEON/Graphics/Texture2D.h>
+
+namespace
+{
+	constexpr uint64_t     SEED = 0xAE0Eull; // The seed from which every scene is generated
+	constexpr unsigned int WIDTH = 1280;     // The headless window's width
+	constexpr unsigned int HEIGHT = 720;     // The headless window's height
+	constexpr int          WARMUP = 10;      // The number of frames rendered before the measurements so that the caches and the GPU buffers are warm
+
+	enum class Kind { Sprites, Texts, Shapes };
+
+	// The description of a generated scene
+	struct SceneConfig
+	{
+		Kind         kind;         // The type of actors composing the scene
+		size_t       count;        // The number of actors
+		float        animated;     // The fraction of actors moved and rotated every frame
+		unsigned int textureCount; // The number of textures shared by the sprites
+	};
+
+	// The measurements of a scene rendered by a renderer
+	struct SceneResult
+	{
+		std::string name;
+		std::string renderer;
+		SceneConfig config;
+		int         frames;
+		double      submitMedian;    // In microseconds
+		double      endSceneMedian;  // In microseconds
+		double      drawCalls;       // Per frame
+		double      uploadedBytes;   // Per frame
+	};
+
+	const char* getKindName(Kind kind)
+	{
+		switch (kind) {
+			case Kind::Sprites: return "sprites";
+			case Kind::Texts:   return "texts";
+			default:            return "shapes";
+		}
+	}
+
+	std::string getSceneName(const SceneConfig& config)
+	{
+		return std::string(getKindName(config.kind)) + "/" + std::to_string(config.count) + "/animated_" + std::to_string(static_cast<int>(config.animated * 100.f))
+		     + "/textures_" + std::to_string(config.textureCount);
+	}
+
+	// Create the textures shared by the sprites, each filled with a distinct checkerboard
+	std::vector<std::shared_ptr<ae::Texture2D>> createTextures(unsigned int count)
+	{
+		constexpr unsigned int SIZE = 64;
+		std::vector<std::shared_ptr<ae::Texture2D>> textures;
+		std::vector<uint8_t> pixels(SIZE * SIZE * 4);
+		for (unsigned int t = 0; t < count; ++t) {
+			for (unsigned int i = 0; i < SIZE * SIZE; ++i) {
+				const bool EVEN = (((i % SIZE) / 8 + (i / SIZE) / 8) % 2) == 0;
+				pixels[i * 4 + 0] = static_cast<uint8_t>(EVEN ? 255 : (t * 37) % 256);
+				pixels[i * 4 + 1] = static_cast<uint8_t>(EVEN ? 255 : (t * 91) % 256);
+				pixels[i * 4 + 2] = static_cast<uint8_t>(EVEN ? 255 : (t * 53) % 256);
+				pixels[i * 4 + 3] = 255;
+			}
+
+			auto texture = ae::GLResourceFactory::getInstance().create<ae::Texture2D>("", ae::Texture2D::Filter::Linear, ae::Texture2D::Wrap::ClampToEdge, ae::Texture2D::InternalFormat::RGBA8);
+			if (!texture->create(SIZE, SIZE, pixels.data())) {
+				return {};
+			}
+			textures.push_back(std::move(texture));
+		}
+
+		return textures;
+	}
+
+	// Generate the scene described by the configuration, the animated actors are appended to the list provided
+	std::unique_ptr<ae::Actor2D> generateScene(const SceneConfig& config, ae::Font& font, const std::vector<std::shared_ptr<ae::Texture2D>>& textures, std::vector<ae::Actor2D*>& animated)
+	{
+		ae::Math::seedRandom(SEED);
+
+		auto root = std::make_unique<ae::Actor2D>();
+		for (size_t i = 0; i < config.count; ++i) {
+			std::unique_ptr<ae::Actor2D> actor;
+			switch (config.kind) {
+				case Kind::Sprites:
+					actor = std::make_unique<ae::Sprite>(*textures[i % textures.size()]);
+					break;
+				case Kind::Texts:
+				{
+					auto text = std::make_unique<ae::Text>();
+					text->setFont(font);
+					text->setCharacterSize(static_cast<unsigned int>(ae::Math::random(12, 32)));
+					text->setText("Label #" + std::to_string(i));
+					actor = std::move(text);
+					break;
+				}
+				default:
+				{
+					const ae::Color COLOR(static_cast<uint8_t>(ae::Math::random(0, 255)), static_cast<uint8_t>(ae::Math::random(0, 255)), static_cast<uint8_t>(ae::Math::random(0, 255)));
+					if (i % 2 == 0) {
+						auto rectangle = std::make_unique<ae::RectangleShape>(ae::Vector2f(ae::Math::random(8.f, 64.f), ae::Math::random(8.f, 64.f)), (i % 4 == 0) ? 4.f : 0.f, 4);
+						rectangle->setFillColor(COLOR);
+						actor = std::move(rectangle);
+					}
+					else {
+						auto ellipse = std::make_unique<ae::EllipseShape>(ae::Vector2f(ae::Math::random(4.f, 32.f), ae::Math::random(4.f, 32.f)), 24);
+						ellipse->setFillColor(COLOR);
+						actor = std::move(ellipse);
+					}
+					break;
+				}
+			}
+
+			actor->setPosition(ae::Math::random(0.f, static_cast<float>(WIDTH)), ae::Math::random(0.f, static_cast<float>(HEIGHT)));
+			actor->setRotation(ae::Math::random(0.f, 360.f));
+			if (static_cast<float>(i) < config.animated * static_cast<float>(config.count)) {
+				animated.push_back(actor.get());
+			}
+			root->attachChild(std::move(actor));
+		}
+
+		return root;
+	}
+
+	// Retrieve the median of the durations, in microseconds
+	double getMedian(std::vector<double>& values)
+	{
+		std::nth_element(values.begin(), values.begin() + values.size() / 2, values.end());
+		return values[values.size() / 2];
+	}
+
+	// Render the scene for the number of frames provided and measure the renderer's statistics
+	SceneResult measureScene(ae::Renderer2D& renderer, const std::string& rendererName, const SceneConfig& config, ae::Actor2D& scene, const std::vector<ae::Actor2D*>& animated, int frames)
+	{
+		ae::Window& window = ae::Application::getInstance().getWindow();
+		ae::GLResourceFactory& glResourceFactory = ae::GLResourceFactory::getInstance();
+
+		std::vector<double> submitTimes, endSceneTimes;
+		submitTimes.reserve(frames);
+		endSceneTimes.reserve(frames);
+		double drawCalls = 0.0, uploadedBytes = 0.0;
+
+		const ae::Time STEP = ae::Time::microseconds(16667);
+		for (int frame = -WARMUP; frame < frames; ++frame) {
+			for (ae::Actor2D* const actor : animated) {
+				actor->move(1.f, 0.5f);
+				actor->rotate(2.f);
+			}
+			scene.update(STEP);
+
+			window.clear();
+			renderer.beginScene(window);
+			scene.render(ae::RenderStates());
+			renderer.endScene();
+			window.display();
+			glResourceFactory.update();
+
+			if (frame >= 0) {
+				const ae::Renderer2D::Statistics& STATS = renderer.getStatistics();
+				submitTimes.push_back(static_cast<double>(STATS.submitTime.asMicroseconds()));
+				endSceneTimes.push_back(static_cast<double>(STATS.endSceneTime.asMicroseconds()));
+				drawCalls += STATS.drawCalls;
+				uploadedBytes += static_cast<double>(STATS.uploadedBytes);
+			}
+		}
+
+		return { getSceneName(config), rendererName, config, frames, getMedian(submitTimes), getMedian(endSceneTimes), drawCalls / frames, uploadedBytes / frames };
+	}
+
+	std::string toJSON(const std::vector<SceneResult>& results)
+	{
+		std::ostringstream json;
+		json << "{\"scenes\":[";
+		for (size_t i = 0; i < results.size(); ++i) {
+			const SceneResult& RESULT = results[i];
+			json << (i == 0 ? "\n" : ",\n")
+			     << "{\"name\":\"" << RESULT.name << "\",\"renderer\":\"" << RESULT.renderer << "\",\"kind\":\"" << getKindName(RESULT.config.kind)
+			     << "\",\"count\":" << RESULT.config.count << ",\"animated\":" << RESULT.config.animated << ",\"textures\":" << RESULT.config.textureCount
+			     << ",\"frames\":" << RESULT.frames << ",\"submit_us\":" << RESULT.submitMedian << ",\"end_scene_us\":" << RESULT.endSceneMedian
+			     << ",\"draw_calls\":" << RESULT.drawCalls << ",\"uploaded_bytes\":" << RESULT.uploadedBytes << "}";
+		}
+		json << "\n]}\n";
+		return json.str();
+	}
+}
+
+int main(int argc, char* argv[])
+{
+	if (argc < 2 || argc > 4) {
+		std::fprintf(stderr, "Usage: %s <font.ttf> [output.json] [frames per scene]\n", argv[0]);
+		return 1;
+	}
+
+	const std::string OUTPUT = (argc >= 3) ? argv[2] : "renderer_benchmark.json";
+	const int FRAMES = (argc == 4) ? std::stoi(argv[3]) : 60;
+	if (FRAMES <= 0) {
+		std::fprintf(stderr, "The number of frames per scene must be positive.\n");
+		return 1;
+	}
+
+	// The headless window owns the context, its scenes are rendered offscreen into its back buffer
+	ae::Application& app = ae::Application::getInstance();
+	app.createWindow(ae::VideoMode(WIDTH, HEIGHT), "RendererBenchmark", ae::Window::Style::Headless);
+	app.getWindow().enableVerticalSync(false);
+
+	ae::Font font;
+	font.loadFromFile(argv[1]);
+
+	const std::vector<SceneConfig> SCENES = {
+		{ Kind::Sprites,  1000, 0.f,   1 }, { Kind::Sprites,  1000, 0.f,  16 },
+		{ Kind::Sprites, 10000, 0.f,   1 }, { Kind::Sprites, 10000, 0.1f, 1 }, { Kind::Sprites, 10000, 1.f, 1 },
+		{ Kind::Sprites, 10000, 0.1f, 16 }, { Kind::Sprites, 10000, 0.1f, 64 },
+		{ Kind::Sprites, 50000, 0.1f,  4 },
+		{ Kind::Texts,     100, 0.f,   0 }, { Kind::Texts,   1000, 0.f,  0 }, { Kind::Texts,   1000, 1.f, 0 },
+		{ Kind::Shapes,   1000, 0.f,   0 }, { Kind::Shapes, 10000, 0.f,  0 }, { Kind::Shapes, 10000, 0.1f, 0 }, { Kind::Shapes, 10000, 1.f, 0 }
+	};
+
+	struct NamedRenderer { const char* name; ae::Renderer2D& renderer; };
+	const NamedRenderer RENDERERS[] = { { "basic", ae::BasicRenderer2D::getInstance() }, { "batch", ae::BatchRenderer2D::getInstance() } };
+
+	std::vector<SceneResult> results;
+	std::printf("%-36s %-8s %12s %14s %12s %16s\n", "Scene", "Renderer", "submit (us)", "endScene (us)", "drawcalls", "uploaded (B)");
+	for (const SceneConfig& CONFIG : SCENES) {
+		const std::vector<std::shared_ptr<ae::Texture2D>> TEXTURES = createTextures(std::max(CONFIG.textureCount, 1u));
+		if (TEXTURES.empty()) {
+			std::fprintf(stderr, "Unable to create the scene's textures.\n");
+			return 1;
+		}
+
+		// Each renderer measures an identical copy of the scene, generated from the same seed
+		for (const NamedRenderer& RENDERER : RENDERERS) {
+			std::vector<ae::Actor2D*> animated;
+			std::unique_ptr<ae::Actor2D> scene = generateScene(CONFIG, font, TEXTURES, animated);
+
+			results.push_back(measureScene(RENDERER.renderer, RENDERER.name, CONFIG, *scene, animated, FRAMES));
+			const SceneResult& RESULT = results.back();
+			std::printf("%-36s %-8s %12.1f %14.1f %12.1f %16.0f\n", RESULT.name.c_str(), RESULT.renderer.c_str(), RESULT.submitMedian, RESULT.endSceneMedian, RESULT.drawCalls, RESULT.uploadedBytes);
+		}
+	}
+
+	std::ofstream output(OUTPUT, std::ios::trunc);
+	if (!output || !(output << toJSON(results))) {
+		std::fprintf(stderr, "Unable to write \"%s\".\n", OUTPUT.c_str());
+		return 1;
+	}
+
+	std::printf("Results written to \"%s\".\n", OUTPUT.c_str());
+	app.getWindow().close();
+	return 0;
+}
\ No newline at end of file
@@ -0,0 +1,265 @@
+// MIT License
+// 
+// Copyright(c) 2019-2021 Filippos Gleglakos
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+// Stress benchmark of the ae::Actor2D scene graph's traversals and structural changes
+// Usage: SceneGraphBenchmark [output.json] [frames per case]
+// Wide (every node attached to the root), balanced (4 children per node) and deep (chains of 64 nodes) trees of 1k to 500k nodes are
+// built, then update(), the render() submission, getGlobalTransform() after the root moves, and the attachChild()/detachChild() and
+// markForRemoval() churn of 1% of the leaves are timed per frame. The medians are reported as a table and as a JSON document.
+
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <AEON/System/Benchmark.h>
+#include <AEON/System/Clock.h>
+#include <AEON/Window/Application.h>
+#include <AEON/Graphics/BatchRenderer2D.h>
+#include <AEON/Graphics/GLResourceFactory.h>
+#include <AEON/Graphics/RectangleShape.h>
+#include <AEON/Graphics/RenderStates.h>
+
+namespace
+{
+	constexpr size_t CHAIN_LENGTH = 64; // The number of nodes of each chain of the deep trees
+	constexpr size_t BRANCHING = 4;     // The number of children of each node of the balanced trees
+	constexpr int    WARMUP = 3;        // The number of frames run before the measurements
+
+	enum class Shape { Wide, Balanced, Deep };
+
+	// A generated tree along with its leaves, which are churned
+	struct Tree
+	{
+		std::unique_ptr<ae::Actor2D> root;
+		std::vector<ae::Actor2D*>    nodes;   // Every node but the root
+		std::vector<ae::Actor2D*>    parents; // The parent of each node
+		std::vector<size_t>          leaves;  // The indices of the nodes without any children
+	};
+
+	// The per-frame medians of a tree's cases (in microseconds)
+	struct Result
+	{
+		std::string name;
+		size_t      nodeCount;
+		double      build;
+		double      update;
+		double      render;
+		double      globalTransforms;
+		double      attachDetach;
+		double      removal;
+	};
+
+	const char* getShapeName(Shape shape)
+	{
+		switch (shape) {
+			case Shape::Wide:     return "wide";
+			case Shape::Balanced: return "balanced";
+			default:              return "deep";
+		}
+	}
+
+	std::unique_ptr<ae::Actor2D> createNode(size_t index)
+	{
+		auto node = std::make_unique<ae::RectangleShape>(ae::Vector2f(4.f, 4.f));
+		node->setPosition(static_cast<float>(index % 97), static_cast<float>(index % 89));
+		return node;
+	}
+
+	double getElapsed(const ae::Time& start)
+	{
+		return static_cast<double>((ae::Clock::getCurrentTime() - start).asNanoseconds()) / 1000.0;
+	}
+
+	double getMedian(std::vector<double>& values)
+	{
+		std::nth_element(values.begin(), values.begin() + values.size() / 2, values.end());
+		return values[values.size() / 2];
+	}
+
+	// Build the tree of the shape provided, the nodes being attached one by one as an application would
+	Tree buildTree(Shape shape, size_t nodeCount)
+	{
+		Tree tree;
+		tree.root = std::make_unique<ae::Actor2D>();
+		tree.nodes.reserve(nodeCount);
+		tree.parents.reserve(nodeCount);
+
+		// The parent of the node i is the root (wide), the node i / BRANCHING - 1 (balanced) or its predecessor in its chain (deep)
+		std::vector<bool> hasChildren(nodeCount, false);
+		for (size_t i = 0; i < nodeCount; ++i) {
+			ae::Actor2D* parent = tree.root.get();
+			size_t parentIndex = nodeCount;
+			if (shape == Shape::Balanced && i >= BRANCHING) {
+				parentIndex = i / BRANCHING - 1;
+			}
+			else if (shape == Shape::Deep && i % CHAIN_LENGTH != 0) {
+				parentIndex = i - 1;
+			}
+			if (parentIndex != nodeCount) {
+				parent = tree.nodes[parentIndex];
+				hasChildren[parentIndex] = true;
+			}
+
+			std::unique_ptr<ae::Actor2D> node = createNode(i);
+			tree.nodes.push_back(node.get());
+			tree.parents.push_back(parent);
+			parent->attachChild(std::move(node));
+		}
+
+		for (size_t i = 0; i < nodeCount; ++i) {
+			if (!hasChildren[i]) {
+				tree.leaves.push_back(i);
+			}
+		}
+
+		return tree;
+	}
+
+	Result measureTree(Shape shape, size_t nodeCount, int frames)
+	{
+		ae::Window& window = ae::Application::getInstance().getWindow();
+		ae::BatchRenderer2D& renderer = ae::BatchRenderer2D::getInstance();
+		const ae::Time STEP = ae::Time::microseconds(16667);
+
+		Result result = { std::string(getShapeName(shape)) + "/" + std::to_string(nodeCount), nodeCount, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0 };
+		ae::Time start = ae::Clock::getCurrentTime();
+		Tree tree = buildTree(shape, nodeCount);
+		result.build = getElapsed(start);
+
+		const size_t CHURN = std::max(tree.leaves.size() / 100, static_cast<size_t>(1));
+		std::vector<double> updates, renders, globalTransforms, attachDetaches, removals;
+		for (int frame = -WARMUP; frame < frames; ++frame) {
+			const bool MEASURED = (frame >= 0);
+
+			start = ae::Clock::getCurrentTime();
+			tree.root->update(STEP);
+			if (MEASURED) updates.push_back(getElapsed(start));
+
+			// The submission is timed by the renderer itself, between beginScene() and endScene()
+			window.clear();
+			renderer.beginScene(window);
+			tree.root->render(ae::RenderStates());
+			renderer.endScene();
+			window.display();
+			ae::GLResourceFactory::getInstance().update();
+			if (MEASURED) renders.push_back(static_cast<double>(renderer.getStatistics().submitTime.asNanoseconds()) / 1000.0);
+
+			// Moving the root invalidates every global transform, which are then recomputed lazily
+			tree.root->move(1.f, 0.f);
+			start = ae::Clock::getCurrentTime();
+			for (ae::Actor2D* const node : tree.nodes) {
+				ae::Benchmark::doNotOptimize(node->getGlobalTransform());
+			}
+			if (MEASURED) globalTransforms.push_back(getElapsed(start));
+
+			// Detach a slice of the leaves and reattach them to their parents
+			const size_t OFFSET = (static_cast<size_t>(frame + WARMUP) * CHURN) % tree.leaves.size();
+			start = ae::Clock::getCurrentTime();
+			for (size_t i = 0; i < CHURN; ++i) {
+				const size_t LEAF = tree.leaves[(OFFSET + i) % tree.leaves.size()];
+				std::unique_ptr<ae::Actor2D> leaf = tree.parents[LEAF]->detachChild(*tree.nodes[LEAF]);
+				tree.parents[LEAF]->attachChild(std::move(leaf));
+			}
+			if (MEASURED) attachDetaches.push_back(getElapsed(start));
+
+			// Remove another slice of the leaves during an update and replace them with new nodes
+			start = ae::Clock::getCurrentTime();
+			for (size_t i = 0; i < CHURN; ++i) {
+				tree.nodes[tree.leaves[(OFFSET + CHURN + i) % tree.leaves.size()]]->markForRemoval();
+			}
+			tree.root->update(STEP);
+			for (size_t i = 0; i < CHURN; ++i) {
+				const size_t LEAF = tree.leaves[(OFFSET + CHURN + i) % tree.leaves.size()];
+				std::unique_ptr<ae::Actor2D> node = createNode(LEAF);
+				tree.nodes[LEAF] = node.get();
+				tree.parents[LEAF]->attachChild(std::move(node));
+			}
+			if (MEASURED) removals.push_back(getElapsed(start));
+		}
+
+		result.update = getMedian(updates);
+		result.render = getMedian(renders);
+		result.globalTransforms = getMedian(globalTransforms);
+		result.attachDetach = getMedian(attachDetaches);
+		result.removal = getMedian(removals);
+		return result;
+	}
+
+	std::string toJSON(const std::vector<Result>& results)
+	{
+		std::ostringstream json;
+		json << "{\"trees\":[";
+		for (size_t i = 0; i < results.size(); ++i) {
+			const Result& RESULT = results[i];
+			json << (i == 0 ? "\n" : ",\n")
+			     << "{\"name\":\"" << RESULT.name << "\",\"nodes\":" << RESULT.nodeCount << ",\"build_us\":" << RESULT.build << ",\"update_us\":" << RESULT.update
+			     << ",\"render_us\":" << RESULT.render << ",\"global_transforms_us\":" << RESULT.globalTransforms << ",\"attach_detach_us\":" << RESULT.attachDetach
+			     << ",\"removal_us\":" << RESULT.removal << "}";
+		}
+		json << "\n]}\n";
+		return json.str();
+	}
+}
+
+int main(int argc, char* argv[])
+{
+	if (argc > 3) {
+		std::fprintf(stderr, "Usage: %s [output.json] [frames per case]\n", argv[0]);
+		return 1;
+	}
+
+	const std::string OUTPUT = (argc >= 2) ? argv[1] : "scene_graph_benchmark.json";
+	const int FRAMES = (argc == 3) ? std::stoi(argv[2]) : 20;
+	if (FRAMES <= 0) {
+		std::fprintf(stderr, "The number of frames per case must be positive.\n");
+		return 1;
+	}
+
+	// The render submission requires a context, the headless window provides it without presenting anything
+	ae::Application& app = ae::Application::getInstance();
+	app.createWindow(ae::VideoMode(1280, 720), "SceneGraphBenchmark", ae::Window::Style::Headless);
+	app.getWindow().enableVerticalSync(false);
+
+	std::vector<Result> results;
+	std::printf("%-18s %12s %12s %12s %14s %14s %12s\n", "Tree", "build (us)", "update (us)", "render (us)", "global (us)", "attach (us)", "remove (us)");
+	for (const Shape SHAPE : { Shape::Wide, Shape::Balanced, Shape::Deep }) {
+		for (const size_t NODE_COUNT : { 1000, 10000, 100000, 500000 }) {
+			results.push_back(measureTree(SHAPE, NODE_COUNT, FRAMES));
+			const Result& RESULT = results.back();
+			std::printf("%-18s %12.0f %12.1f %12.1f %14.1f %14.1f %12.1f\n", RESULT.name.c_str(), RESULT.build, RESULT.update, RESULT.render, RESULT.globalTransforms, RESULT.attachDetach, RESULT.removal);
+		}
+	}
+
+	std::ofstream output(OUTPUT, std::ios::trunc);
+	if (!output || !(output << toJSON(results))) {
+		std::fprintf(stderr, "Unable to write \"%s\".\n", OUTPUT.c_str());
+		return 1;
+	}
+
+	std::printf("Results written to \"%s\".\n", OUTPUT.c_str());
+	app.getWindow().close();
+	return 0;
+}
\ No newline at end of file
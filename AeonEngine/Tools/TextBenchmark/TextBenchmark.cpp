@@ -0,0 +1,292 @@
+// MIT License
+// 
+// Copyright(c) 2019-2021 Filippos Gleglakos
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files(the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions :
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+// 
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+// Benchmark of the font loading, the text rendering and the texture atlas packing
+// Usage: TextBenchmark <font.ttf> [output.json] [repetitions]
+// The cold glyph requests and the first rendering of a 1k-character string are measured with freshly loaded fonts, the warm glyph requests
+// with the glyphs cached, the setText() churn over 600 frames (10 seconds at 60 Hz) and TextureAtlas::pack() with 100 to 5,000 textures.
+// The medians are reported as a table and as a JSON document.
+
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <AEON/Math/Misc.h>
+#include <AEON/System/Benchmark.h>
+#include <AEON/System/Clock.h>
+#include <AEON/Window/Application.h>
+#include <AEON/Graphics/BatchRenderer2D.h>
+#include <AEON/Graphics/Font.h>
+#include <AEON/Graphics/GLResourceFactory.h>
+#include <AEON/Graphics/RenderStates.h>
+#include <AEON/Graphics/Text.h>
+#include <AEON/Graphics/Texture2D.h>
+#include <AEON/Graphics/TextureAtlas.h>
+#include <AEON/Graphics/internal/Glyph.h>
+
+namespace
+{
+	constexpr uint64_t     SEED = 0xAE0Eull;    // The seed from which the strings and the textures are generated
+	constexpr unsigned int CHARACTER_SIZE = 24; // The character size of the glyphs and texts
+	constexpr int          CHURN_FRAMES = 600;  // The number of frames of the setText() churn (10 seconds at 60 Hz)
+
+	// The measurements of a case (in microseconds)
+	struct Result
+	{
+		std::string name;
+		size_t      count;  // The number of glyphs, characters or textures involved
+		double      minimum;
+		double      median;
+	};
+
+	double getElapsed(const ae::Time& start)
+	{
+		return static_cast<double>((ae::Clock::getCurrentTime() - start).asNanoseconds()) / 1000.0;
+	}
+
+	Result makeResult(const std::string& name, size_t count, std::vector<double>& durations)
+	{
+		std::sort(durations.begin(), durations.end());
+		return { name, count, durations.front(), durations[durations.size() / 2] };
+	}
+
+	// Render the text provided into the headless window with the ae::BatchRenderer2D
+	void renderText(ae::Text& text)
+	{
+		ae::Window& window = ae::Application::getInstance().getWindow();
+		ae::BatchRenderer2D& renderer = ae::BatchRenderer2D::getInstance();
+
+		text.update(ae::Time::microseconds(16667));
+		window.clear();
+		renderer.beginScene(window);
+		text.render(ae::RenderStates());
+		renderer.endScene();
+		window.display();
+		ae::GLResourceFactory::getInstance().update();
+	}
+
+	// Generate a printable ASCII string of the length provided, broken into lines of 80 characters
+	std::string generateString(size_t length)
+	{
+		std::string string;
+		string.reserve(length);
+		for (size_t i = 0; i < length; ++i) {
+			string.push_back((i % 81 == 80) ? '\n' : static_cast<char>(ae::Math::random(0x20, 0x7E)));
+		}
+
+		return string;
+	}
+
+	// The cold requests rasterize the glyphs and grow the font's atlas, a new font being loaded for each repetition
+	Result measureColdGlyphs(const std::string& fontPath, const std::u32string& codepoints, int repetitions)
+	{
+		std::vector<double> durations;
+		for (int repetition = 0; repetition < repetitions; ++repetition) {
+			ae::Font font;
+			font.loadFromFile(fontPath);
+
+			const ae::Time START = ae::Clock::getCurrentTime();
+			for (const char32_t CODEPOINT : codepoints) {
+				ae::Benchmark::doNotOptimize(font.getGlyph(CODEPOINT, CHARACTER_SIZE));
+			}
+			durations.push_back(getElapsed(START));
+		}
+
+		return makeResult("Font::getGlyph/cold", codepoints.size(), durations);
+	}
+
+	// The warm requests only look the cached glyphs up
+	Result measureWarmGlyphs(const std::string& fontPath, const std::u32string& codepoints)
+	{
+		ae::Font font;
+		font.loadFromFile(fontPath);
+		for (const char32_t CODEPOINT : codepoints) {
+			ae::Benchmark::doNotOptimize(font.getGlyph(CODEPOINT, CHARACTER_SIZE));
+		}
+
+		ae::Benchmark benchmark;
+		const ae::Benchmark::Result& RESULT = benchmark.run("Font::getGlyph/warm", [&font, &codepoints]() {
+			for (const char32_t CODEPOINT : codepoints) {
+				ae::Benchmark::doNotOptimize(font.getGlyph(CODEPOINT, CHARACTER_SIZE));
+			}
+		});
+
+		return { RESULT.name, codepoints.size(), RESULT.minimum / 1000.0, RESULT.median / 1000.0 };
+	}
+
+	// The first rendering of a string lays it out and requests all of its glyphs from a newly loaded font
+	Result measureFirstRender(const std::string& fontPath, const std::string& string, int repetitions)
+	{
+		std::vector<double> durations;
+		for (int repetition = 0; repetition < repetitions; ++repetition) {
+			ae::Font font;
+			font.loadFromFile(fontPath);
+
+			const ae::Time START = ae::Clock::getCurrentTime();
+			ae::Text text;
+			text.setFont(font);
+			text.setCharacterSize(CHARACTER_SIZE);
+			text.setText(string);
+			renderText(text);
+			durations.push_back(getElapsed(START));
+		}
+
+		return makeResult("Text/first_render", string.size(), durations);
+	}
+
+	// A HUD-like text modified every frame, its glyphs being cached after the first frames
+	Result measureSetTextChurn(const std::string& fontPath)
+	{
+		ae::Font font;
+		font.loadFromFile(fontPath);
+
+		ae::Text text;
+		text.setFont(font);
+		text.setCharacterSize(CHARACTER_SIZE);
+
+		std::vector<double> durations;
+		size_t length = 0;
+		for (int frame = 0; frame < CHURN_FRAMES; ++frame) {
+			const float SECONDS = static_cast<float>(frame) / 60.f;
+			const std::string STRING = "Frame " + std::to_string(frame) + " - " + std::to_string(SECONDS) + "s - Score " + std::to_string(frame * 37 % 100000);
+			length = std::max(length, STRING.size());
+
+			const ae::Time START = ae::Clock::getCurrentTime();
+			text.setText(STRING);
+			renderText(text);
+			durations.push_back(getElapsed(START));
+		}
+
+		return makeResult("Text::setText/churn_60hz", length, durations);
+	}
+
+	// Pack the textures provided in a new atlas for each repetition
+	Result measurePacking(const std::vector<std::shared_ptr<ae::Texture2D>>& textures, size_t count, int repetitions)
+	{
+		std::vector<double> durations;
+		for (int repetition = 0; repetition < repetitions; ++repetition) {
+			ae::TextureAtlas atlas;
+			for (size_t i = 0; i < count; ++i) {
+				atlas.add(*textures[i]);
+			}
+
+			const ae::Time START = ae::Clock::getCurrentTime();
+			atlas.pack();
+			durations.push_back(getElapsed(START));
+		}
+
+		return makeResult("TextureAtlas::pack", count, durations);
+	}
+
+	// Create the textures of random sizes between 8x8 and 64x64 texels to be packed
+	std::vector<std::shared_ptr<ae::Texture2D>> createTextures(size_t count)
+	{
+		std::vector<std::shared_ptr<ae::Texture2D>> textures;
+		textures.reserve(count);
+		std::vector<uint8_t> pixels(64 * 64 * 4, 255);
+		for (size_t i = 0; i < count; ++i) {
+			const unsigned int WIDTH = static_cast<unsigned int>(ae::Math::random(8, 64));
+			const unsigned int HEIGHT = static_cast<unsigned int>(ae::Math::random(8, 64));
+
+			auto texture = ae::GLResourceFactory::getInstance().create<ae::Texture2D>("", ae::Texture2D::Filter::Linear, ae::Texture2D::Wrap::ClampToEdge, ae::Texture2D::InternalFormat::RGBA8);
+			if (!texture->create(WIDTH, HEIGHT, pixels.data())) {
+				return {};
+			}
+			textures.push_back(std::move(texture));
+		}
+
+		return textures;
+	}
+
+	std::string toJSON(const std::vector<Result>& results)
+	{
+		std::ostringstream json;
+		json << "{\"benchmarks\":[";
+		for (size_t i = 0; i < results.size(); ++i) {
+			const Result& RESULT = results[i];
+			json << (i == 0 ? "\n" : ",\n")
+			     << "{\"name\":\"" << RESULT.name << "\",\"count\":" << RESULT.count << ",\"min_us\":" << RESULT.minimum << ",\"median_us\":" << RESULT.median << "}";
+		}
+		json << "\n]}\n";
+		return json.str();
+	}
+}
+
+int main(int argc, char* argv[])
+{
+	if (argc < 2 || argc > 4) {
+		std::fprintf(stderr, "Usage: %s <font.ttf> [output.json] [repetitions]\n", argv[0]);
+		return 1;
+	}
+
+	const std::string FONT_PATH = argv[1];
+	const std::string OUTPUT = (argc >= 3) ? argv[2] : "text_benchmark.json";
+	const int REPETITIONS = (argc == 4) ? std::stoi(argv[3]) : 10;
+	if (REPETITIONS <= 0) {
+		std::fprintf(stderr, "The number of repetitions must be positive.\n");
+		return 1;
+	}
+
+	// The glyphs are uploaded to the fonts' atlases and the texts are rendered, which requires a context
+	ae::Application& app = ae::Application::getInstance();
+	app.createWindow(ae::VideoMode(1280, 720), "TextBenchmark", ae::Window::Style::Headless);
+	app.getWindow().enableVerticalSync(false);
+	ae::Math::seedRandom(SEED);
+
+	// The printable ASCII and Latin-1 characters
+	const std::u32string CODEPOINTS = ae::Font::getCodepointRange(0x20, 0x7E) + ae::Font::getCodepointRange(0xA0, 0xFF);
+	const std::string STRING = generateString(1000);
+
+	std::vector<Result> results;
+	results.push_back(measureColdGlyphs(FONT_PATH, CODEPOINTS, REPETITIONS));
+	results.push_back(measureWarmGlyphs(FONT_PATH, CODEPOINTS));
+	results.push_back(measureFirstRender(FONT_PATH, STRING, REPETITIONS));
+	results.push_back(measureSetTextChurn(FONT_PATH));
+
+	const std::vector<std::shared_ptr<ae::Texture2D>> TEXTURES = createTextures(5000);
+	if (TEXTURES.empty()) {
+		std::fprintf(stderr, "Unable to create the textures to pack.\n");
+		return 1;
+	}
+	for (const size_t COUNT : { 100, 500, 1000, 2500, 5000 }) {
+		results.push_back(measurePacking(TEXTURES, COUNT, REPETITIONS));
+	}
+
+	std::printf("%-28s %8s %12s %12s\n", "Benchmark", "count", "min (us)", "median (us)");
+	for (const Result& RESULT : results) {
+		std::printf("%-28s %8zu %12.1f %12.1f\n", RESULT.name.c_str(), RESULT.count, RESULT.minimum, RESULT.median);
+	}
+
+	std::ofstream output(OUTPUT, std::ios::trunc);
+	if (!output || !(output << toJSON(results))) {
+		std::fprintf(stderr, "Unable to write \"%s\".\n", OUTPUT.c_str());
+		return 1;
+	}
+
+	std::printf("Results written to \"%s\".\n", OUTPUT.c_str());
+	app.getWindow().close();
+	return 0;
+}
\ No newline at end of file